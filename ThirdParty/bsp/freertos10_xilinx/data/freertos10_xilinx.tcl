@@ -856,6 +856,13 @@ proc generate {os_handle} {
 
         }
 
+	set val [common::get_property CONFIG.lazy_fpu_context $os_handle]
+	if {$val == "false"} {
+		xput_define $config_file "configUSE_LAZY_FPU_CONTEXT"  "0"
+	} else {
+		xput_define $config_file "configUSE_LAZY_FPU_CONTEXT"  "1"
+	}
+
 	set val [common::get_property CONFIG.queue_registry_size $os_handle]
 	if {$val == "false"} {
 		xput_define $config_file "configQUEUE_REGISTRY_SIZE"  "0"
@@ -910,7 +917,12 @@ proc generate {os_handle} {
 		xput_define $config_file "configUSE_PORT_OPTIMISED_TASK_SELECTION"  "1"
 	}
 
-	puts $config_file "#define configUSE_TICKLESS_IDLE	0"
+	set val [common::get_property CONFIG.tickless_idle $os_handle]
+	if {$val == "false"} {
+		xput_define $config_file "configUSE_TICKLESS_IDLE"	"0"
+	} else {
+		xput_define $config_file "configUSE_TICKLESS_IDLE"	"1"
+	}
 	puts $config_file "#define configTASK_RETURN_ADDRESS    prvTaskExitError"
 	puts $config_file "#define INCLUDE_vTaskPrioritySet             1"
 	puts $config_file "#define INCLUDE_uxTaskPriorityGet            1"
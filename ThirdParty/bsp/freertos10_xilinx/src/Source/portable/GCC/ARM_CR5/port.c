@@ -218,6 +218,12 @@ uintptr_t IntrControllerAddr = configINTERRUPT_CONTROLLER_BASE_ADDRESS;
 a floating point context must be saved and restored for the task. */
 uint32_t ulPortTaskHasFPUContext = pdFALSE;
 
+/* Address of the FPU save area of the task whose floating point context is
+held in the FPU registers, 0 if none.  Only used with lazy FPU context
+switching, in which case ulPortTaskHasFPUContext holds the address of the FPU
+save area of the running task. */
+uint32_t ulPortFPUOwner = 0UL;
+
 /* Set to 1 to pend a context switch from an ISR. */
 uint32_t ulPortYieldRequired = pdFALSE;
 
@@ -256,6 +262,16 @@ static int32_t prvEnsureInterruptControllerIsInitialised( void );
  */
 StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
 {
+#if ( configUSE_LAZY_FPU_CONTEXT == 1 )
+StackType_t *pxFPUArea;
+
+	/* The FPU save area sits at the top of the stack, above the task context,
+	where it is never overwritten by the task.  It holds D0-D15 and FPSCR. */
+	pxFPUArea = pxTopOfStack - ( portFPU_REGISTER_WORDS - 1 );
+	memset( pxFPUArea, 0x00, portFPU_REGISTER_WORDS * sizeof( StackType_t ) );
+	pxTopOfStack = pxFPUArea - 1;
+#endif
+
 	/* Setup the initial stack of the task.  The stack is set exactly as
 	expected by the portRESTORE_CONTEXT() macro.
 
@@ -317,7 +333,14 @@ StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t px
 	*pxTopOfStack = portNO_CRITICAL_NESTING;
 
 
-#if (configUSE_TASK_FPU_SUPPORT == 1)
+#if ( configUSE_LAZY_FPU_CONTEXT == 1 )
+	{
+		/* The FPU context indicator holds the address of the FPU save area,
+		the FPU registers are loaded on the first floating point instruction. */
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) pxFPUArea;
+	}
+#elif (configUSE_TASK_FPU_SUPPORT == 1)
 	{
 	/* The task will start without a floating point context.  A task that uses
 	the floating point hardware must call vPortTaskUsesFPU() before executing
@@ -685,7 +708,22 @@ void FreeRTOS_Tick_Handler( void )
 	configCLEAR_TICK_INTERRUPT();
 }
 /*-----------------------------------------------------------*/
-#if (configUSE_TASK_FPU_SUPPORT != 2)
+#if ( configUSE_LAZY_FPU_CONTEXT == 1 )
+void vPortCleanUpTCB( void *pvTCB )
+{
+StackType_t *pxTopOfStack = *( ( StackType_t ** ) pvTCB );
+
+	/* The FPU save area of a deleted task is recorded at the top of its saved
+	context.  Drop the FPU ownership, if any, before the stack is freed so the
+	next owner does not save the registers into freed memory. */
+	taskENTER_CRITICAL();
+	if( ulPortFPUOwner == ( uint32_t ) *pxTopOfStack )
+	{
+		ulPortFPUOwner = 0UL;
+	}
+	taskEXIT_CRITICAL();
+}
+#elif (configUSE_TASK_FPU_SUPPORT != 2)
 void vPortTaskUsesFPU( void )
 {
 uint32_t ulInitialFPSCR = 0;
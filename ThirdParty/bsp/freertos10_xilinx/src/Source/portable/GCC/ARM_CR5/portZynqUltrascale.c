@@ -77,6 +77,32 @@ XScuGic xInterruptController;
 #else
 extern uintptr_t IntrControllerAddr;
 #endif
+
+#if ( configUSE_TICKLESS_IDLE == 1 )
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	#error "configUSE_TICKLESS_IDLE cannot be used with configGENERATE_RUN_TIME_STATS, both need the tick timer"
+#endif
+
+/* The tick interrupt is masked in the core, not in the GIC, while the tick is
+suppressed so that a pending interrupt still wakes the core from WFI. */
+#define portTICKLESS_MASK_IRQ()		__asm volatile ( "CPSID i" ::: "memory" )
+#define portTICKLESS_UNMASK_IRQ()	__asm volatile ( "CPSIE i" ::: "memory" )
+#define portTICKLESS_WFI()			__asm volatile ( "DSB\n\tWFI\n\tISB" ::: "memory" )
+
+#if !defined(XPAR_XILTIMER_ENABLED) && !defined(SDT)
+/* Timer counts in one tick and the most ticks the timer interval can hold. */
+static uint32_t ulTimerCountsPerTick = 0;
+static uint32_t ulMaximumSuppressedTicks = 0;
+#else
+/* Tick period the tick timer is actually programmed with. */
+#define portTICKLESS_TICK_MS	( XTIMER_DELAY_MSEC / ( ( configTICK_RATE_HZ > 1000 ) ? 1000 : configTICK_RATE_HZ ) )
+/* Time stamp of the last tick interrupt. */
+static XTime xLastTickStamp = 0;
+#endif
+/* Part of a tick that elapsed while the tick was suppressed but has not been
+accounted yet, in timer counts. */
+static uint64_t ullCountRemainder = 0;
+#endif
 /*-----------------------------------------------------------*/
 
 #if !defined(XPAR_XILTIMER_ENABLED) && !defined(SDT)
@@ -136,6 +162,10 @@ XScuGic_Config *pxInterruptControllerConfig;
 #endif
 	XTtcPs_SetInterval( &xTimerInstance, usInterval );
 	XTtcPs_SetPrescaler( &xTimerInstance, ucPrescaler );
+#if ( configUSE_TICKLESS_IDLE == 1 )
+	ulTimerCountsPerTick = ( uint32_t ) usInterval + 1UL;
+	ulMaximumSuppressedTicks = XTTCPS_MAX_INTERVAL_COUNT / ulTimerCountsPerTick;
+#endif
 	/* Enable the interrupt for timer. */
 	XScuGic_EnableIntr( configINTERRUPT_CONTROLLER_BASE_ADDRESS, configTIMER_INTERRUPT_ID );
 	XTtcPs_EnableInterrupts( &xTimerInstance, XTTCPS_IXR_INTERVAL_MASK );
@@ -147,6 +177,9 @@ void TimerCounterHandler(void *CallBackRef, u32 TmrCtrNumber)
 {
 	(void) CallBackRef;
 	(void) TmrCtrNumber;
+#if ( configUSE_TICKLESS_IDLE == 1 )
+	xLastTickStamp = XTimer_GetTimestamp();
+#endif
         FreeRTOS_Tick_Handler();
 }
 
@@ -173,6 +206,9 @@ void FreeRTOS_SetupTickInterrupt( void )
 #endif
         XTimer_SetHandler(TimerCounterHandler, 0,
 			portLOWEST_USABLE_INTERRUPT_PRIORITY << portPRIORITY_SHIFT);
+#if ( configUSE_TICKLESS_IDLE == 1 )
+	xLastTickStamp = XTimer_GetTimestamp();
+#endif
 
 }
 #endif
@@ -188,6 +224,160 @@ void FreeRTOS_ClearTickInterrupt( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TICKLESS_IDLE == 1 )
+#if !defined(XPAR_XILTIMER_ENABLED) && !defined(SDT)
+/*
+ * Stops the tick for up to xExpectedIdleTime ticks by stretching the TTC
+ * interval, then corrects the tick count from the TTC counter on wake up.  Any
+ * interrupt wakes the core, the tick interrupt never runs for a suppressed
+ * period as its status is consumed here with IRQs masked.
+ */
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+uint64_t ullElapsedCounts;
+uint32_t ulSleepTicks;
+TickType_t xCompleteTicks;
+TickType_t xModifiableIdleTime;
+
+	if( ulTimerCountsPerTick == 0UL )
+	{
+		return;
+	}
+
+	if( xExpectedIdleTime > ulMaximumSuppressedTicks )
+	{
+		xExpectedIdleTime = ulMaximumSuppressedTicks;
+	}
+	ulSleepTicks = ( uint32_t ) xExpectedIdleTime;
+
+	portTICKLESS_MASK_IRQ();
+
+	if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+	{
+		portTICKLESS_UNMASK_IRQ();
+		return;
+	}
+
+	/* Account the part of the current tick that already elapsed, and a tick
+	that expired but was not yet handled, then stretch the interval. */
+	XTtcPs_Stop( &xTimerInstance );
+	ullCountRemainder += XTtcPs_GetCounterValue( &xTimerInstance );
+	if( ( XTtcPs_GetInterruptStatus( &xTimerInstance ) & XTTCPS_IXR_INTERVAL_MASK ) != 0U )
+	{
+		XTtcPs_ClearInterruptStatus( &xTimerInstance, XTTCPS_IXR_INTERVAL_MASK );
+		ullCountRemainder += ulTimerCountsPerTick;
+	}
+	XTtcPs_SetInterval( &xTimerInstance, ( XInterval ) ( ( ulSleepTicks * ulTimerCountsPerTick ) - 1UL ) );
+	XTtcPs_ResetCounterValue( &xTimerInstance );
+	XTtcPs_Start( &xTimerInstance );
+
+	xModifiableIdleTime = xExpectedIdleTime;
+	configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+	if( xModifiableIdleTime > 0 )
+	{
+		portTICKLESS_WFI();
+	}
+	configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+	XTtcPs_Stop( &xTimerInstance );
+	ullElapsedCounts = XTtcPs_GetCounterValue( &xTimerInstance );
+	if( ( XTtcPs_GetInterruptStatus( &xTimerInstance ) & XTTCPS_IXR_INTERVAL_MASK ) != 0U )
+	{
+		/* The stretched interval expired and the counter restarted. */
+		XTtcPs_ClearInterruptStatus( &xTimerInstance, XTTCPS_IXR_INTERVAL_MASK );
+		ullElapsedCounts += ( uint64_t ) ulSleepTicks * ulTimerCountsPerTick;
+	}
+	ullElapsedCounts += ullCountRemainder;
+
+	/* Restart the normal tick, the remainder is carried to the next sleep. */
+	XTtcPs_SetInterval( &xTimerInstance, ( XInterval ) ( ulTimerCountsPerTick - 1UL ) );
+	XTtcPs_ResetCounterValue( &xTimerInstance );
+	XTtcPs_Start( &xTimerInstance );
+
+	xCompleteTicks = ( TickType_t ) ( ullElapsedCounts / ulTimerCountsPerTick );
+	ullCountRemainder = ullElapsedCounts % ulTimerCountsPerTick;
+	if( xCompleteTicks > xExpectedIdleTime )
+	{
+		xCompleteTicks = xExpectedIdleTime;
+		ullCountRemainder = 0;
+	}
+	vTaskStepTick( xCompleteTicks );
+
+	portTICKLESS_UNMASK_IRQ();
+}
+#else
+/*
+ * Stops the tick for up to xExpectedIdleTime ticks by reprogramming the
+ * XilTimer tick interval, then corrects the tick count from the XilTimer time
+ * stamp on wake up.  The tick timer takes whole milliseconds that divide a
+ * second, so the sleep is rounded down to such a period of at most a second.
+ */
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+uint64_t ullCountsPerTick;
+uint64_t ullElapsedCounts;
+uint32_t ulSleepMs;
+TickType_t xCompleteTicks;
+TickType_t xModifiableIdleTime;
+
+	/* Without a time stamp counter the sleep cannot be measured. */
+	ullCountsPerTick = ( ( uint64_t ) XTimer_GetTimestampFreq() * portTICKLESS_TICK_MS ) / XTIMER_DELAY_MSEC;
+	if( ullCountsPerTick == 0ULL )
+	{
+		return;
+	}
+
+	if( xExpectedIdleTime > ( XTIMER_DELAY_MSEC / portTICKLESS_TICK_MS ) )
+	{
+		xExpectedIdleTime = XTIMER_DELAY_MSEC / portTICKLESS_TICK_MS;
+	}
+	ulSleepMs = ( uint32_t ) xExpectedIdleTime * portTICKLESS_TICK_MS;
+	ulSleepMs = XTIMER_DELAY_MSEC / ( ( XTIMER_DELAY_MSEC + ulSleepMs - 1UL ) / ulSleepMs );
+	if( ulSleepMs <= portTICKLESS_TICK_MS )
+	{
+		return;
+	}
+
+	portTICKLESS_MASK_IRQ();
+
+	if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+	{
+		portTICKLESS_UNMASK_IRQ();
+		return;
+	}
+
+	XTimer_SetInterval( ulSleepMs );
+
+	xModifiableIdleTime = xExpectedIdleTime;
+	configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+	if( xModifiableIdleTime > 0 )
+	{
+		portTICKLESS_WFI();
+	}
+	configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+	/* Any tick that expired is accounted from the time stamp instead. */
+	XTimer_ClearTickInterrupt();
+	XTimer_SetInterval( portTICKLESS_TICK_MS );
+
+	ullElapsedCounts = ( uint64_t ) ( XTimer_GetTimestamp() - xLastTickStamp ) + ullCountRemainder;
+	xLastTickStamp = XTimer_GetTimestamp();
+
+	xCompleteTicks = ( TickType_t ) ( ullElapsedCounts / ullCountsPerTick );
+	ullCountRemainder = ullElapsedCounts % ullCountsPerTick;
+	if( xCompleteTicks > xExpectedIdleTime )
+	{
+		xCompleteTicks = xExpectedIdleTime;
+		ullCountRemainder = 0;
+	}
+	vTaskStepTick( xCompleteTicks );
+
+	portTICKLESS_UNMASK_IRQ();
+}
+#endif
+/*-----------------------------------------------------------*/
+#endif
+
 void vApplicationIRQHandler( uint32_t ulICCIAR )
 {
 extern XScuGic_Config XScuGic_ConfigTable[];
@@ -119,6 +119,12 @@ macros is used. */
 handler for whichever peripheral is used to generate the RTOS tick. */
 void FreeRTOS_Tick_Handler( void );
 
+/* Tickless idle, the tick timer is stretched while the idle task sleeps. */
+#if ( configUSE_TICKLESS_IDLE == 1 )
+	void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+	#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+
 /*
  * Installs pxHandler as the interrupt handler for the peripheral specified by
  * the ucInterruptID parameter.
@@ -169,7 +175,20 @@ void vPortEnableInterrupt( uint8_t ucInterruptID );
  * file, which is itself part of the BSP project.
  */
 void vPortDisableInterrupt( uint8_t ucInterruptID );
-#if (configUSE_TASK_FPU_SUPPORT != 2)
+
+/* With lazy FPU context switching every task has an FPU save area and the FPU
+registers are only saved and restored when another task executes its first
+floating point instruction after a switch, which traps as the FPU is disabled.
+Tasks do not need to call vPortTaskUsesFPU(). */
+#ifndef configUSE_LAZY_FPU_CONTEXT
+	#define configUSE_LAZY_FPU_CONTEXT 0
+#endif
+
+#if ( configUSE_LAZY_FPU_CONTEXT == 1 )
+void vPortCleanUpTCB( void *pvTCB );
+#define portCLEAN_UP_TCB( pxTCB ) vPortCleanUpTCB( pxTCB )
+#define portTASK_USES_FLOATING_POINT()
+#elif (configUSE_TASK_FPU_SUPPORT != 2)
 /* Any task that uses the floating point unit MUST call vPortTaskUsesFPU()
 before any floating point instructions are executed. */
 void vPortTaskUsesFPU( void );
@@ -13,6 +13,9 @@ set(freertos_tick_rate 100 CACHE STRING "Number of RTOS ticks per sec")
 option(freertos_idle_yield "Set to true if the Idle task should yield if another \
 idle priority task is able to run, or false if the idle task should \
 always use its entire time slice unless it is preempted." ON)
+option(freertos_tickless_idle "Set to true to stop the tick interrupt while \
+the idle task runs, only supported by the Cortex-A53 and Cortex-R5 ports and \
+not together with run time stats." OFF)
 set(freertos_max_priorities 8 CACHE STRING "The number of task priorities that \
 will be available.  Priorities can be assigned from \
 zero to (freertos_max_priorities - 1")
@@ -73,6 +76,9 @@ of pointers each task has to store thread local values.")
 set(freertos_use_task_fpu_support 0x1 CACHE STRING "Set to 1 to create tasks \
 without FPU context, set to 2 to have tasks with FPU context by default.")
 set_property(CACHE freertos_use_task_fpu_support PROPERTY STRINGS 0x0 0x1 0x2)
+option(freertos_lazy_fpu_context "Set to true to save and restore the FPU \
+registers only when another task uses the FPU, Cortex-R5 only. Every task \
+then has an FPU context and does not need to call vPortTaskUsesFPU()." OFF)
 set(freertos_generate_runtime_stats 0x0 CACHE STRING "Set to 1 generate \
 runtime stats for tasks.")
 set_property(CACHE freertos_generate_runtime_stats PROPERTY STRINGS 0x0 0x1)
@@ -193,7 +199,11 @@ set(configUSE_16_BIT_TICKS 0x0)
 set(configUSE_APPLICATION_TASK_TAG 0x0)
 set(configUSE_CO_ROUTINES 0x0)
 set(configMAX_CO_ROUTINE_PRIORITIES 2)
-set(configUSE_TICKLESS_IDLE 0x0)
+if (${freertos_tickless_idle})
+    set(configUSE_TICKLESS_IDLE 1)
+else()
+    set(configUSE_TICKLESS_IDLE 0x0)
+endif()
 set(configTASK_RETURN_ADDRESS	NULL)
 set(INCLUDE_vTaskPrioritySet 1)
 set(INCLUDE_uxTaskPriorityGet 1)
@@ -242,6 +252,9 @@ endif()
 if (${freertos_idle_yield})
     set(configIDLE_SHOULD_YIELD " ")
 endif()
+if (${freertos_lazy_fpu_context})
+    set(configUSE_LAZY_FPU_CONTEXT " ")
+endif()
 if (${freertos_use_timeslicing})
     set(configUSE_TIME_SLICING " ")
 endif()
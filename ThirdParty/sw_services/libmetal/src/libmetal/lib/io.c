@@ -28,6 +28,7 @@ void metal_io_init(struct metal_io_region *io, void *virt,
 	else
 		io->page_mask = (1UL << page_shift) - 1UL;
 	io->mem_flags = mem_flags;
+	io->coherency = METAL_IO_CACHE_MAINT;
 	io->ops = ops ? *ops : nops;
 	metal_sys_io_mem_map(io);
 
@@ -20,6 +20,7 @@
 #include <metal/assert.h>
 #include <metal/compiler.h>
 #include <metal/atomic.h>
+#include <metal/cache.h>
 #include <metal/sys.h>
 #include <metal/cpu.h>
 
@@ -37,6 +38,16 @@ extern "C" {
 
 struct metal_io_region;
 
+/** I/O region cache coherency attributes. */
+enum metal_io_coherency {
+	/** Cacheable, needs flush and invalidate around remote accesses */
+	METAL_IO_CACHE_MAINT = 0,
+	/** Mapped non-cacheable, no maintenance needed */
+	METAL_IO_NON_CACHEABLE,
+	/** Cache coherent with the remote (e.g. through CCI) */
+	METAL_IO_COHERENT,
+};
+
 /** Generic I/O operations. */
 struct metal_io_ops {
 	uint64_t	(*read)(struct metal_io_region *io,
@@ -81,6 +92,8 @@ struct metal_io_region {
 	metal_phys_addr_t	page_mask;  /**< page mask of I/O region */
 	unsigned int		mem_flags;  /**< memory attribute of the
 						 I/O region */
+	enum metal_io_coherency	coherency;  /**< cache coherency of the
+						 I/O region */
 	struct metal_io_ops	ops;        /**< I/O region operations */
 	struct metal_list	list;       /**< linked list */
 };
@@ -113,6 +126,66 @@ static inline void metal_io_finish(struct metal_io_region *io)
 	memset(io, 0, sizeof(*io));
 }
 
+/**
+ * @brief	Set the cache coherency attribute of an I/O region.
+ *
+ * Regions default to METAL_IO_CACHE_MAINT. Marking a region coherent
+ * or non-cacheable makes metal_io_cache_flush() and
+ * metal_io_cache_invalidate() skip the cache maintenance for it.
+ *
+ * @param[in]	io		I/O region handle.
+ * @param[in]	coherency	Cache coherency attribute.
+ */
+static inline void
+metal_io_set_coherency(struct metal_io_region *io,
+		       enum metal_io_coherency coherency)
+{
+	io->coherency = coherency;
+}
+
+/**
+ * @brief	Get the cache coherency attribute of an I/O region.
+ *
+ * @param[in]	io	I/O region handle.
+ * @return	Cache coherency attribute.
+ */
+static inline enum metal_io_coherency
+metal_io_get_coherency(struct metal_io_region *io)
+{
+	return io->coherency;
+}
+
+/**
+ * @brief	Flush data cache for a range within an I/O region, if the
+ *		region needs cache maintenance.
+ *
+ * @param[in]	io	I/O region handle.
+ * @param[in]	addr	Start virtual address within the region.
+ * @param[in]	len	Length of the range.
+ */
+static inline void
+metal_io_cache_flush(struct metal_io_region *io, void *addr, unsigned int len)
+{
+	if (io->coherency == METAL_IO_CACHE_MAINT)
+		metal_cache_flush(addr, len);
+}
+
+/**
+ * @brief	Invalidate data cache for a range within an I/O region, if the
+ *		region needs cache maintenance.
+ *
+ * @param[in]	io	I/O region handle.
+ * @param[in]	addr	Start virtual address within the region.
+ * @param[in]	len	Length of the range.
+ */
+static inline void
+metal_io_cache_invalidate(struct metal_io_region *io, void *addr,
+			  unsigned int len)
+{
+	if (io->coherency == METAL_IO_CACHE_MAINT)
+		metal_cache_invalidate(addr, len);
+}
+
 /**
  * @brief	Get size of I/O region.
  *
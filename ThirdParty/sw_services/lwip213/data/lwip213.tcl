@@ -567,6 +567,7 @@ proc generate_lwip_opts {libhandle} {
 		if { [string compare -nocase "freertos10_xilinx" $os_name] == 0} {
 			# mbox options
 			set lwip_tcpip_core_locking_input	[common::get_property CONFIG.lwip_tcpip_core_locking_input $libhandle]
+			set lwip_fast_mbox	[common::get_property CONFIG.lwip_fast_mbox $libhandle]
 			set tcpip_mbox_size	[common::get_property CONFIG.tcpip_mbox_size $libhandle]
 			set default_tcp_recvmbox_size	[common::get_property CONFIG.default_tcp_recvmbox_size $libhandle]
 			set default_udp_recvmbox_size	[common::get_property CONFIG.default_udp_recvmbox_size $libhandle]
@@ -587,6 +588,9 @@ proc generate_lwip_opts {libhandle} {
 			if {$lwip_tcpip_core_locking_input == true} {
 				puts $lwipopts_fd "\#define LWIP_TCPIP_CORE_LOCKING_INPUT 1"
 			}
+			if {$lwip_fast_mbox == true} {
+				puts $lwipopts_fd "\#define LWIP_FAST_MBOX 1"
+			}
 			puts $lwipopts_fd ""
 		}
 	}
@@ -650,6 +654,18 @@ proc generate_lwip_opts {libhandle} {
 	puts $lwipopts_fd "\#define PBUF_POOL_SIZE $pbuf_pool_size"
 	puts $lwipopts_fd "\#define PBUF_POOL_BUFSIZE $pbuf_pool_bufsize"
 	puts $lwipopts_fd "\#define PBUF_LINK_HLEN $pbuf_link_hlen"
+	set pbuf_pool_cache [common::get_property CONFIG.pbuf_pool_cache $libhandle]
+	if {$pbuf_pool_cache > 0} {
+		puts $lwipopts_fd "\#define MEMP_PBUF_POOL_CACHE $pbuf_pool_cache"
+	}
+	set emacps_rx_zerocopy [common::get_property CONFIG.emacps_rx_zerocopy $libhandle]
+	if {$emacps_rx_zerocopy == true} {
+		puts $lwipopts_fd "\#define LWIP_SUPPORT_CUSTOM_PBUF 1"
+	}
+	set emacps_bd_timestamp [common::get_property CONFIG.emacps_bd_timestamp $libhandle]
+	if {$emacps_bd_timestamp == true} {
+		puts $lwipopts_fd "\#define LWIP_PBUF_CUSTOM_DATA u32_t ts_sec; u32_t ts_nsec;"
+	}
 	puts $lwipopts_fd ""
 
 	# ARP options
@@ -694,7 +710,13 @@ proc generate_lwip_opts {libhandle} {
 	puts $lwipopts_fd "\#define IP_REASS_MAX_PBUFS $ip_reass_max_pbufs"
 	puts $lwipopts_fd "\#define IP_FRAG_MAX_MTU $ip_frag_max_mtu"
 	puts $lwipopts_fd "\#define IP_DEFAULT_TTL $ip_default_ttl"
-	puts $lwipopts_fd "\#define LWIP_CHKSUM_ALGORITHM 3"
+	set lwip_arch_chksum [expr [common::get_property CONFIG.lwip_arch_chksum $libhandle] == true]
+	puts $lwipopts_fd "\#define LWIP_ARCH_CHKSUM $lwip_arch_chksum"
+	if {$lwip_arch_chksum == 1} {
+		puts $lwipopts_fd "\#define LWIP_CHECKSUM_ON_COPY 1"
+	} else {
+		puts $lwipopts_fd "\#define LWIP_CHKSUM_ALGORITHM 3"
+	}
 	puts $lwipopts_fd ""
 
 	# UDP options
@@ -735,6 +757,20 @@ proc generate_lwip_opts {libhandle} {
 	puts $lwipopts_fd "\#define TCP_QUEUE_OOSEQ $tcp_queue_ooseq"
 	puts $lwipopts_fd "\#define TCP_SND_QUEUELEN   16 * TCP_SND_BUF/TCP_MSS"
 
+	# the adapters size the window of new connections from the link speed,
+	# tcp_wnd is the largest one and sets the window scale
+	set tcp_wnd_autotune [common::get_property CONFIG.tcp_wnd_autotune $libhandle]
+	if {$tcp_wnd_autotune == true} {
+		set tcp_rcv_scale 0
+		while {[expr $tcp_wnd >> $tcp_rcv_scale] > 65535} {
+			incr tcp_rcv_scale
+		}
+		puts $lwipopts_fd "\#define LWIP_TCP_WND_AUTOTUNE 1"
+		puts $lwipopts_fd "\#define LWIP_WND_SCALE 1"
+		puts $lwipopts_fd "\#define TCP_RCV_SCALE $tcp_rcv_scale"
+		puts $lwipopts_fd "\#define LWIP_TCP_SACK_OUT 1"
+	}
+
 	set have_ethonzynq 0
 	foreach emac $emac_periphs_list {
 		set iptype [common::get_property IP_NAME $emac]
@@ -838,6 +874,18 @@ proc generate_lwip_opts {libhandle} {
 		}
 	}
 
+	# the adapters flag the frames the MAC has verified, lwIP checks the rest
+	set rx_csum_per_packet [common::get_property CONFIG.rx_checksum_per_packet $libhandle]
+	if {$rx_csum_per_packet == true} {
+		puts $lwipopts_fd "\#define LWIP_CHECKSUM_CHECK_PER_PBUF 1"
+		puts $lwipopts_fd "\#undef CHECKSUM_CHECK_TCP"
+		puts $lwipopts_fd "\#undef CHECKSUM_CHECK_UDP"
+		puts $lwipopts_fd "\#undef CHECKSUM_CHECK_IP"
+		puts $lwipopts_fd "\#define CHECKSUM_CHECK_TCP  1"
+		puts $lwipopts_fd "\#define CHECKSUM_CHECK_UDP  1"
+		puts $lwipopts_fd "\#define CHECKSUM_CHECK_IP 	1"
+	}
+
 	puts $lwipopts_fd ""
 
 
@@ -849,6 +897,8 @@ proc generate_lwip_opts {libhandle} {
 	} else {
 		puts $lwipopts_fd "\#define TCP_OVERSIZE TCP_MSS"
 	}
+	set tcp_lso [expr [common::get_property CONFIG.tcp_lso $libhandle] == true]
+	puts $lwipopts_fd "\#define LWIP_TCP_LSO $tcp_lso"
 
 	puts $lwipopts_fd ""
 
@@ -1578,6 +1628,50 @@ proc generate_adapterconfig_include {libhandle} {
 		puts $fd "\#define XLWIP_CONFIG_N_TX_DESC $ndesc"
 		set ndesc [common::get_property CONFIG.n_rx_descriptors $libhandle]
 		puts $fd "\#define XLWIP_CONFIG_N_RX_DESC $ndesc"
+		set emacps_rx_zerocopy [common::get_property CONFIG.emacps_rx_zerocopy $libhandle]
+		if {$emacps_rx_zerocopy == true} {
+			set npool [common::get_property CONFIG.emacps_rx_pool_size $libhandle]
+			puts $fd "\#define XLWIP_CONFIG_EMACPS_RX_ZEROCOPY 1"
+			puts $fd "\#define XLWIP_CONFIG_EMACPS_RX_POOL_SIZE $npool"
+		}
+		set nqueues [common::get_property CONFIG.emacps_num_queues $libhandle]
+		puts $fd "\#define XLWIP_CONFIG_EMACPS_NUM_QUEUES $nqueues"
+		set rx_poll_budget [common::get_property CONFIG.rx_poll_budget $libhandle]
+		if {$rx_poll_budget != 0} {
+			puts $fd "\#define XLWIP_CONFIG_RX_POLL_BUDGET $rx_poll_budget"
+		}
+		set emacps_bd_timestamp [common::get_property CONFIG.emacps_bd_timestamp $libhandle]
+		if {$emacps_bd_timestamp == true} {
+			puts $fd "\#define XLWIP_CONFIG_EMACPS_BD_TIMESTAMP 1"
+		}
+		set phy_intr_gpio_pin [common::get_property CONFIG.phy_intr_gpio_pin $libhandle]
+		if {$phy_intr_gpio_pin >= 0} {
+			puts $fd "\#define XLWIP_CONFIG_PHY_INTR_GPIO_PIN $phy_intr_gpio_pin"
+		}
+		puts $fd ""
+	}
+
+	set mcdma_rx_queues [common::get_property CONFIG.mcdma_rx_queues $libhandle]
+	if {$mcdma_rx_queues > 1} {
+		puts $fd "\#define XLWIP_CONFIG_MCDMA_RX_QUEUES $mcdma_rx_queues"
+		puts $fd ""
+	}
+
+	set rx_bd_buf_size [common::get_property CONFIG.rx_bd_buf_size $libhandle]
+	if {$rx_bd_buf_size != 0} {
+		puts $fd "\#define XLWIP_CONFIG_RX_BD_BUF_SIZE $rx_bd_buf_size"
+		puts $fd ""
+	}
+
+	set tx_deferred_reclaim [common::get_property CONFIG.tx_deferred_reclaim $libhandle]
+	if {$tx_deferred_reclaim == true} {
+		puts $fd "\#define XLWIP_CONFIG_TX_DEFERRED_RECLAIM 1"
+		puts $fd ""
+	}
+
+	set pq_lockfree [common::get_property CONFIG.pq_lockfree $libhandle]
+	if {$pq_lockfree == true} {
+		puts $fd "\#define XLWIP_CONFIG_PQ_LOCKFREE 1"
 		puts $fd ""
 	}
 
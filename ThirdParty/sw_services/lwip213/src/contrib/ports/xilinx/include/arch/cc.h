@@ -72,6 +72,14 @@ typedef signed     long long    s64_t;
 
 typedef unsigned long mem_ptr_t;
 
+#if defined(LWIP_ARCH_CHKSUM) && LWIP_ARCH_CHKSUM
+/* Checksum routines of the port, see xchksum.c */
+u16_t xlwip_chksum(const void *dataptr, int len);
+u16_t xlwip_chksum_copy(void *dst, const void *src, u16_t len);
+#define LWIP_CHKSUM xlwip_chksum
+#define LWIP_CHKSUM_COPY(dst, src, len) xlwip_chksum_copy(dst, src, len)
+#endif
+
 #define PACK_STRUCT_FIELD(x) x
 #define PACK_STRUCT_STRUCT __attribute__((packed))
 #define PACK_STRUCT_BEGIN
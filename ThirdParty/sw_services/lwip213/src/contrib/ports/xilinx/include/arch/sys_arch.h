@@ -50,13 +50,36 @@ extern "C" {
 #include "semphr.h"
 #include "timers.h"
 
+#ifndef LWIP_FAST_MBOX
+#define LWIP_FAST_MBOX	0
+#endif
+
+#define SYS_DEFAULT_THREAD_STACK_DEPTH	configMINIMAL_STACK_SIZE
+
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1)
+/* One PBUF_POOL cache per core of the SMP kernel */
+#define MEMP_PBUF_POOL_CACHE_CPUS		configNUMBER_OF_CORES
+#define MEMP_PBUF_POOL_CACHE_CPU()		portGET_CORE_ID()
+#endif
+
+#if LWIP_FAST_MBOX
+/* Lock-free mailboxes and semaphores woken by task notifications */
+struct xlwip_mbox;
+struct xlwip_sem;
+
+#define SYS_MBOX_NULL					( ( struct xlwip_mbox * ) NULL )
+#define SYS_SEM_NULL					( ( struct xlwip_sem * ) NULL )
+
+typedef struct xlwip_sem *sys_sem_t;
+typedef struct xlwip_mbox *sys_mbox_t;
+#else
 #define SYS_MBOX_NULL					( ( xQueueHandle ) NULL )
 #define SYS_SEM_NULL					( ( xSemaphoreHandle ) NULL )
-#define SYS_DEFAULT_THREAD_STACK_DEPTH	configMINIMAL_STACK_SIZE
 
 typedef xSemaphoreHandle sys_sem_t;
-typedef xSemaphoreHandle sys_mutex_t;
 typedef xQueueHandle sys_mbox_t;
+#endif
+typedef xSemaphoreHandle sys_mutex_t;
 typedef xTaskHandle sys_thread_t;
 
 typedef unsigned long sys_prot_t;
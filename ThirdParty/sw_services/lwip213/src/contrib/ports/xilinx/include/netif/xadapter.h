@@ -37,6 +37,7 @@ extern "C" {
 #endif
 
 #include "lwipopts.h"
+#include "xlwipconfig.h"
 
 #if !NO_SYS
 #include "lwip/sys.h"
@@ -44,6 +45,7 @@ extern "C" {
 
 #include "lwip/netif.h"
 #include "lwip/ip.h"
+#include "lwip/udp.h"
 
 #include "netif/xtopology.h"
 
@@ -70,6 +72,10 @@ void eth_link_detect(struct netif *netif);
 void 		lwip_raw_init();
 int 		xemacif_input(struct netif *netif);
 void 		xemacif_input_thread(struct netif *netif);
+#if !NO_SYS
+sys_thread_t	xemacif_input_thread_start(struct netif *netif, int prio,
+						int core);
+#endif
 struct netif *	xemac_add(struct netif *netif,
 	ip_addr_t *ipaddr, ip_addr_t *netmask, ip_addr_t *gw,
 	unsigned char *mac_ethernet_address,
@@ -77,10 +83,99 @@ struct netif *	xemac_add(struct netif *netif,
 #if defined (__arm__) || defined (__aarch64__)
 void xemacpsif_resetrx_on_no_rxdata(struct netif *netif);
 #endif
+void		xemac_tx_batch_begin(struct netif *netif);
+void		xemac_tx_batch_end(struct netif *netif);
+#if LWIP_TCP && LWIP_TCP_WND_AUTOTUNE
+void		xemac_tcp_wnd_autotune(u32_t speed);
+#endif
+
+#if !NO_SYS
+#define XEMACIF_INPUT_THREAD_STACKSIZE	1024
+#endif
+
+#if LWIP_TCP && LWIP_TCP_WND_AUTOTUNE
+/* Round trip time the TCP window is sized for, in us */
+#ifndef XLWIP_TCP_WND_AUTOTUNE_RTT_US
+#define XLWIP_TCP_WND_AUTOTUNE_RTT_US	1000U
+#endif
+#endif
 
 /* global lwip debug variable used for debugging */
 extern int lwip_runtime_debug;
 
+#if LWIP_UDP
+/* Datagrams handed to a batched receive callback at most at a time */
+#define XUDP_BATCH_MAX	32
+
+/* Destination of one datagram of xudp_sendto_batch_list() */
+struct xudp_dst {
+	ip_addr_t ip;
+	u16_t port;
+};
+
+/* Datagram received, the pbuf is owned by the batched receive callback */
+struct xudp_dgram {
+	struct pbuf *p;
+	ip_addr_t addr;
+	u16_t port;
+};
+
+typedef void (*xudp_recv_batch_fn)(void *arg, struct udp_pcb *pcb,
+				struct xudp_dgram *dgram, u16_t count);
+
+/* Batched receive state of one pcb, storage provided by the application */
+struct xudp_recv_batch {
+	struct xudp_recv_batch *next;
+	struct udp_pcb *pcb;
+	xudp_recv_batch_fn fn;
+	void *arg;
+	u16_t count;
+	struct xudp_dgram dgram[XUDP_BATCH_MAX];
+};
+
+err_t	xudp_sendto_batch(struct udp_pcb *pcb, struct pbuf **p, u16_t *count,
+				const ip_addr_t *dst_ip, u16_t dst_port);
+err_t	xudp_sendto_batch_list(struct udp_pcb *pcb, struct pbuf **p,
+				u16_t *count, const struct xudp_dst *dst);
+void	xudp_recv_batch(struct udp_pcb *pcb, struct xudp_recv_batch *batch,
+				xudp_recv_batch_fn fn, void *arg);
+void	xudp_recv_batch_remove(struct xudp_recv_batch *batch);
+void	xudp_recv_batch_flush(void);
+#endif
+
+#ifdef XLWIP_CONFIG_TX_DEFERRED_RECLAIM
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+#error "XLWIP_CONFIG_TX_DEFERRED_RECLAIM cannot report TX completion to LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE"
+#endif
+/* Completed TX BDs the send path takes back from the hardware at a time */
+#define XLWIP_TX_RECLAIM_BATCH	32
+#endif
+
+#if LWIP_TCP_LSO
+/* Room reserved per frame for the Ethernet, IP and TCP headers of a large
+ * send. Segments with longer headers go out unsegmented.
+ */
+#define XLSO_HDR_SIZE	128
+
+/* State of one large TCP segment while an adapter cuts it into frames */
+struct xlso {
+	struct pbuf *p;		/* segment handed down by the stack */
+	struct pbuf *q;		/* pbuf holding the next TCP data byte */
+	u16_t q_off;		/* offset of that byte in q */
+	u16_t hdr_len;		/* Ethernet, IP and TCP header length */
+	u16_t ip_off;		/* offset of the IP header */
+	u16_t frame_len;	/* TCP data bytes in each full frame */
+	u16_t data_len;		/* TCP data bytes of the whole segment */
+	u16_t nframes;		/* number of frames to send */
+	u16_t nbds;		/* buffer descriptors needed, headers included */
+};
+
+err_t xlso_init(struct xlso *lso, struct pbuf *p);
+u16_t xlso_build_hdr(struct xlso *lso, u16_t frame, u8_t *hdr);
+struct pbuf *xlso_next_data(struct xlso *lso, u16_t *left, void **data,
+								u16_t *len);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -66,10 +66,47 @@ extern "C" {
 #define INTC_DIST_BASE_ADDR     XPAR_SCUGIC_0_DIST_BASEADDR
 #endif
 
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
+/* Number of RX queues the MCDMA channels are spread over. Queue 0 is drained
+ * by xemacif_input_thread, every other queue by its own worker thread.
+ */
+#if defined(XLWIP_CONFIG_MCDMA_RX_QUEUES) && !NO_SYS
+#define XAXIEMACIF_MCDMA_RX_QUEUES	XLWIP_CONFIG_MCDMA_RX_QUEUES
+#else
+#define XAXIEMACIF_MCDMA_RX_QUEUES	1
+#endif
+#define XAXIEMACIF_RX_WORKER_STACKSIZE	1024
+#define XAXIEMACIF_RX_WORKER_PRIO	DEFAULT_THREAD_PRIO
+#endif
+
+#if !defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_FIFO) && \
+	!defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA)
+/* Size of the buffer of an RX BD with AXI DMA. With
+ * XLWIP_CONFIG_RX_BD_BUF_SIZE, a frame larger than the buffers spans several
+ * BDs and is received into a pbuf chain, PBUF_POOL_BUFSIZE must then be at
+ * least the buffer size.
+ */
+#ifdef XLWIP_CONFIG_RX_BD_BUF_SIZE
+#define XAXIEMACIF_RX_CHAIN
+#define XAXIEMACIF_RX_BUF_SIZE	XLWIP_CONFIG_RX_BD_BUF_SIZE
+#elif defined(USE_JUMBO_FRAMES)
+#define XAXIEMACIF_RX_BUF_SIZE	XAE_MAX_JUMBO_FRAME_SIZE
+#else
+#define XAXIEMACIF_RX_BUF_SIZE	XAE_MAX_FRAME_SIZE
+#endif
+#endif
+
+/* Full checksum offload status of a received frame, in app word 2 */
+#define XAXIEMACIF_RX_CSUM_STS_MASK	0x00000038U
+#define XAXIEMACIF_RX_CSUM_STS_SHIFT	3
+#define XAXIEMACIF_RX_CSUM_TCP_OK	2U	/* IP header and TCP checksums good */
+#define XAXIEMACIF_RX_CSUM_UDP_OK	3U	/* IP header and UDP checksums good */
+
 void 	xaxiemacif_setmac(u32_t index, u8_t *addr);
 u8_t*	xaxiemacif_getmac(u32_t index);
 err_t 	xaxiemacif_init(struct netif *netif);
 int 	xaxiemacif_input(struct netif *netif);
+int 	xaxiemacif_queue_input(struct netif *netif, pq_queue_t *recv_q);
 
 unsigned get_IEEE_phy_speed(XAxiEthernet *xaxiemacp);
 void enable_sgmii_clock(XAxiEthernet *xaxiemacp);
@@ -101,6 +138,23 @@ typedef struct {
 	void *tx_bdspace;
 
 	enum ethernet_link_status eth_link_status;
+#if defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA) && XAXIEMACIF_MCDMA_RX_QUEUES > 1
+	/* per RX queue packets and wakeups, queue 0 uses recv_q and
+	 * sem_rx_data_available of the xemac
+	 */
+	pq_queue_t *chan_recv_q[XAXIEMACIF_MCDMA_RX_QUEUES];
+	sys_sem_t chan_sem[XAXIEMACIF_MCDMA_RX_QUEUES];
+#endif
+#if LWIP_TCP_LSO
+	/* per TX BD header copies of large sends, XLSO_HDR_SIZE bytes each
+	 * (used only with SDMA)
+	 */
+	u8_t *lso_hdrspace;
+#endif
+#ifdef XAXIEMACIF_RX_CHAIN
+	/* pbufs of the frame being received, whose last BD is not completed */
+	struct pbuf *rx_chain;
+#endif
 } xaxiemacif_s;
 
 extern xaxiemacif_s xaxiemacif;
@@ -111,6 +165,9 @@ s32_t xaxiemac_is_tx_space_available(xaxiemacif_s *emac);
 s32_t process_sent_bds(XMcdma_ChanCtrl *Tx_Chan);
 #else
 s32_t process_sent_bds(XAxiDma_BdRing *txring);
+#ifdef XLWIP_CONFIG_TX_DEFERRED_RECLAIM
+void xaxiemac_tx_reclaim(xaxiemacif_s *xaxiemacif, s32_t min_free);
+#endif
 #endif
 #endif
 
@@ -119,6 +176,9 @@ s32_t process_sent_bds(XAxiDma_BdRing *txring);
 #ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
 XStatus init_axi_mcdma(struct xemac_s *xemac);
 XStatus axi_mcdma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p);
+#if XAXIEMACIF_MCDMA_RX_QUEUES > 1
+err_t axi_mcdma_start_rx_workers(struct netif *netif, struct xemac_s *xemac);
+#endif
 #else
 XStatus init_axi_dma(struct xemac_s *xemac);
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
@@ -112,10 +112,98 @@ extern "C" {
 
 #define MAX_FRAME_SIZE_JUMBO (XEMACPS_MTU_JUMBO + XEMACPS_HDR_SIZE + XEMACPS_TRL_SIZE)
 
+#ifdef ZYNQMP_USE_JUMBO
+#define XEMACPSIF_MAX_FRAME_SIZE	MAX_FRAME_SIZE_JUMBO
+#else
+#define XEMACPSIF_MAX_FRAME_SIZE	XEMACPS_MAX_FRAME_SIZE
+#endif
+
+/* Size of the buffer of an RX BD. With XLWIP_CONFIG_RX_BD_BUF_SIZE, a frame
+ * larger than the buffers spans several BDs and is received into a pbuf
+ * chain, PBUF_POOL_BUFSIZE must then be at least the buffer size.
+ */
+#ifdef XLWIP_CONFIG_RX_BD_BUF_SIZE
+#define XEMACPSIF_RX_CHAIN
+#define XEMACPSIF_RX_BUF_SIZE	XLWIP_CONFIG_RX_BD_BUF_SIZE
+#define XEMACPSIF_RX_BDS_PER_FRAME	((XEMACPSIF_MAX_FRAME_SIZE + \
+		XEMACPSIF_RX_BUF_SIZE - 1) / XEMACPSIF_RX_BUF_SIZE)
+#if (XLWIP_CONFIG_RX_BD_BUF_SIZE % 64) != 0
+#error "XLWIP_CONFIG_RX_BD_BUF_SIZE must be a multiple of 64"
+#endif
+#else
+#define XEMACPSIF_RX_BUF_SIZE	XEMACPSIF_MAX_FRAME_SIZE
+#define XEMACPSIF_RX_BDS_PER_FRAME	1
+#endif
+
+/* Link detection from the PHY interrupt output wired to a PS GPIO pin. The
+ * PHY is read over MDIO after an interrupt and at every
+ * XEMACPSIF_PHY_INTR_POLL th link check only, in case one was lost.
+ */
+#ifdef XLWIP_CONFIG_PHY_INTR_GPIO_PIN
+#define XEMACPSIF_PHY_INTR
+#define XEMACPSIF_PHY_INTR_POLL	10
+#endif
+
+/* Number of GEM priority queues driven by the adapter, queue 0 included */
+#ifdef XLWIP_CONFIG_EMACPS_NUM_QUEUES
+#define XEMACPSIF_NUM_QUEUES	XLWIP_CONFIG_EMACPS_NUM_QUEUES
+#else
+#define XEMACPSIF_NUM_QUEUES	1
+#endif
+
+/* Number of frame priorities mapped to the TX queues */
+#define XEMACPSIF_NUM_PRIO	8
+
+/* Frames the RX handler moves at most from one ring per interrupt */
+#define XEMACPSIF_RX_BUDGET_ALL	0x7FFFFFFF
+
+/* Poll mode: the first RX interrupt masks the RX interrupts and the input
+ * thread polls at most this many frames per iteration until the rings are
+ * empty. Needs the input thread, so it is only available with an OS.
+ */
+#if !NO_SYS && defined(XLWIP_CONFIG_RX_POLL_BUDGET)
+#if XLWIP_CONFIG_RX_POLL_BUDGET > 0
+#define XEMACPSIF_RX_POLL_BUDGET	XLWIP_CONFIG_RX_POLL_BUDGET
+#endif
+#endif
+
+/* BD timestamping: on GEMs with extended BDs (not Zynq-7000) the MAC writes
+ * the 1588 timestamp of a frame into its BD. RX frames carry it in the
+ * ts_sec and ts_nsec fields of their pbuf, 0 if the frame has none. PTP
+ * event frames sent are handed back once transmitted with their timestamp
+ * in the same fields, see xemacpsif_get_tx_timestamp(). The seconds come
+ * from the TSU seconds register, which the application must keep running.
+ */
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+#define XEMACPSIF_TX_TS_MODE	XEMACPS_BDCTRL_TSMODE_EVENT
+#define XEMACPSIF_RX_TS_MODE	XEMACPS_BDCTRL_TSMODE_ALL
+#endif
+
+/* Checksum status in word 1 of the last RX BD of a frame when the RX checksum
+ * offload of the MAC is on: IPv4 header, and TCP or UDP checksum verified
+ */
+#define XEMACPSIF_RXBUF_CSUM_MASK	0x00C00000U
+#define XEMACPSIF_RXBUF_CSUM_IP		0x00400000U
+#define XEMACPSIF_RXBUF_CSUM_TCP	0x00800000U
+#define XEMACPSIF_RXBUF_CSUM_UDP	0x00C00000U
+
+/* Frames queued in a TX batch before the transmitter is started anyway */
+#define XEMACPSIF_TX_BATCH_KICK	16
+
 void 	xemacpsif_setmac(u32_t index, u8_t *addr);
 u8_t*	xemacpsif_getmac(u32_t index);
 err_t 	xemacpsif_init(struct netif *netif);
 s32_t 	xemacpsif_input(struct netif *netif);
+#if XEMACPSIF_NUM_QUEUES > 1
+err_t	xemacpsif_set_tx_prio_queue(struct netif *netif, u8_t prio, u8_t queue);
+#endif
+#ifdef XEMACPSIF_RX_POLL_BUDGET
+void	xemacpsif_poll_input(struct netif *netif);
+#endif
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+struct pbuf *xemacpsif_get_tx_timestamp(struct netif *netif);
+#endif
+s32_t	xemacpsif_tx_batch(struct netif *netif, s32_t start);
 
 /* xaxiemacif_hw.c */
 void 	xemacps_error_handler(XEmacPs * Temac);
@@ -136,6 +224,45 @@ typedef struct {
 
 	unsigned int last_rx_frms_cntr;
 	enum ethernet_link_status eth_link_status;
+
+#if XEMACPSIF_NUM_QUEUES > 1
+	/* BD rings of the priority queues, queue 0 uses the rings of emacps */
+	XEmacPs_BdRing rxq_ring[XEMACPSIF_NUM_QUEUES - 1];
+	XEmacPs_BdRing txq_ring[XEMACPSIF_NUM_QUEUES - 1];
+
+	/* number of queues in use, 0 until the first init_dma */
+	u32_t num_queues;
+
+	/* TX queue of each frame priority */
+	u8_t tx_prio_queue[XEMACPSIF_NUM_PRIO];
+#endif
+#ifdef XEMACPSIF_RX_POLL_BUDGET
+	/* set while the input thread polls the RX rings */
+	volatile u32_t rx_polling;
+#endif
+#if LWIP_TCP_LSO
+	/* per TX BD header copies of large sends, XLSO_HDR_SIZE bytes each */
+	u8_t *lso_hdrspace;
+#endif
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+	/* sent frames with their TX timestamp, not yet taken by the application */
+	pq_queue_t *tx_ts_q;
+#endif
+	/* open TX batches, and frames queued since the transmitter was started */
+	u32_t tx_batch;
+	u32_t tx_batch_frames;
+#ifdef XEMACPSIF_PHY_INTR
+	/* set once the PHY and GPIO interrupts are set up */
+	u32_t phy_intr;
+	/* set by the GPIO interrupt, cleared when the link check reads the PHY */
+	volatile u32_t phy_intr_event;
+	/* link checks since the PHY was last read */
+	u32_t phy_intr_polls;
+#if !NO_SYS
+	/* wakes the link detect thread */
+	sys_sem_t phy_intr_sem;
+#endif
+#endif
 } xemacpsif_s;
 
 extern xemacpsif_s xemacpsif;
@@ -145,11 +272,28 @@ s32_t	xemacps_is_tx_space_available(xemacpsif_s *emac);
 /* xemacpsif_dma.c */
 
 void  xemacps_process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring);
+u32_t xemacps_num_queues(xemacpsif_s *xemacpsif);
+XEmacPs_BdRing *xemacps_get_rxring(xemacpsif_s *xemacpsif, u32_t queue);
+XEmacPs_BdRing *xemacps_get_txring(xemacpsif_s *xemacpsif, u32_t queue);
+XEmacPs_BdRing *xemacps_select_txring(xemacpsif_s *xemacpsif, struct pbuf *p);
+#ifdef XLWIP_CONFIG_TX_DEFERRED_RECLAIM
+void  xemacps_tx_reclaim(xemacpsif_s *xemacpsif, s32_t min_free);
+#endif
+#ifdef XEMACPSIF_RX_POLL_BUDGET
+s32_t xemacps_rx_poll(xemacpsif_s *xemacpsif, s32_t budget);
+s32_t xemacps_rx_poll_done(xemacpsif_s *xemacpsif);
+#endif
 u32_t phy_setup_emacps (XEmacPs *xemacpsp, u32_t phy_addr);
 #ifdef SGMII_FIXED_LINK
 u32_t pcs_setup_emacps (XEmacPs *xemacps);
 #endif
 void detect_phy(XEmacPs *xemacpsp);
+#ifdef XEMACPSIF_PHY_INTR
+u32_t phy_intr_enable_emacps(XEmacPs *xemacpsp, u32_t phy_addr);
+void phy_intr_ack_emacps(XEmacPs *xemacpsp, u32_t phy_addr);
+XStatus init_phy_intr(xemacpsif_s *xemacpsif);
+void phy_intr_rearm(xemacpsif_s *xemacpsif);
+#endif
 void emacps_send_handler(void *arg);
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p,
@@ -157,6 +301,7 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p,
 #else
 XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p);
 #endif
+void emacps_tx_batch(xemacpsif_s *xemacpsif, s32_t start);
 void emacps_recv_handler(void *arg);
 void emacps_error_handler(void *arg,u8 Direction, u32 ErrorWord);
 void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring);
@@ -37,17 +37,40 @@ extern "C" {
 #endif
 
 #include "debug.h"
+#include "xlwipconfig.h"
 
+/* must be a power of two for the lock-free ring */
 #define PQ_QUEUE_SIZE 4096
 
+#ifdef XLWIP_CONFIG_PQ_LOCKFREE
+/* Packets the input functions take from a receive queue at a time. Without
+ * an OS they hand a single packet to lwIP per call.
+ */
+#if NO_SYS
+#define PQ_INPUT_BATCH	1
+#else
+#define PQ_INPUT_BATCH	16
+#endif
+
+/* Multi-producer/single-consumer ring. Producers claim a slot by advancing
+ * head and then publish the pointer in it; a NULL slot at tail means the
+ * queue is empty or its next entry is not yet published.
+ */
+typedef struct {
+	void *data[PQ_QUEUE_SIZE];
+	volatile unsigned int head, tail;
+} pq_queue_t;
+#else
 typedef struct {
 	void *data[PQ_QUEUE_SIZE];
 	int head, tail, len;
 } pq_queue_t;
+#endif
 
 pq_queue_t*	pq_create_queue();
 int 		pq_enqueue(pq_queue_t *q, void *p);
 void*		pq_dequeue(pq_queue_t *q);
+int		pq_dequeue_batch(pq_queue_t *q, void **p, int n);
 int		pq_qlength(pq_queue_t *q);
 
 #ifdef __cplusplus
@@ -43,6 +43,9 @@
 #include "lwip/tcp.h"
 #include "lwip/udp.h"
 #include "lwip/priv/tcp_priv.h"
+#if LWIP_TCP_LSO
+#include "lwip/inet_chksum.h"
+#endif
 
 #include "netif/etharp.h"
 #include "netif/xadapter.h"
@@ -71,6 +74,10 @@ void link_detect_thread(void *p);
 /* global lwip debug variable used for debugging */
 int lwip_runtime_debug = 0;
 
+#if LWIP_UDP
+static void xudp_recv_batch_input_done(void);
+#endif
+
 u32_t phyaddrforemac;
 
 void
@@ -221,10 +228,51 @@ xemacif_input_thread(struct netif *netif)
 		 */
 		sys_sem_wait(&emac->sem_rx_data_available);
 
+#ifdef XEMACPSIF_RX_POLL_BUDGET
+		/* the RX handler has masked the RX interrupts, poll */
+		if (emac->type == xemac_type_emacps) {
+			xemacpsif_poll_input(netif);
+#if LWIP_UDP
+			xudp_recv_batch_input_done();
+#endif
+			continue;
+		}
+#endif
 		/* move all received packets to lwIP */
 		xemacif_input(netif);
 	}
 }
+
+/*
+ * Starts an input thread for netif, named after the netif so that the
+ * threads of a multi-port system can be told apart. With
+ * LWIP_TCPIP_CORE_LOCKING_INPUT each thread hands its packets to lwIP under
+ * the core lock instead of posting them to tcpip_thread, so raw API receive
+ * callbacks run in the input thread and the ports do not queue up behind
+ * one mailbox. core pins the thread to a core on an SMP kernel with core
+ * affinity; -1, or any value on a single core kernel, leaves it unpinned.
+ */
+sys_thread_t
+xemacif_input_thread_start(struct netif *netif, int prio, int core)
+{
+	char name[] = "xemacif_in_xx0";
+	sys_thread_t thread;
+
+	name[sizeof(name) - 4] = netif->name[0];
+	name[sizeof(name) - 3] = netif->name[1];
+	name[sizeof(name) - 2] = (char)('0' + (netif->num % 10));
+
+	thread = sys_thread_new(name, (void(*)(void*))xemacif_input_thread,
+			netif, XEMACIF_INPUT_THREAD_STACKSIZE, prio);
+#if (configNUMBER_OF_CORES > 1) && (configUSE_CORE_AFFINITY == 1)
+	if (thread != NULL && core >= 0)
+		vTaskCoreAffinitySet(thread, (UBaseType_t)1 << core);
+#else
+	(void)core;
+#endif
+
+	return thread;
+}
 #endif
 
 int
@@ -270,9 +318,262 @@ xemacif_input(struct netif *netif)
 			return 0;
 	}
 
+#if LWIP_UDP
+	/* the input thread has moved all packets, in NO_SYS mode the main
+	 * loop keeps calling until there are none
+	 */
+#if NO_SYS
+	if (n_packets == 0)
+#endif
+		xudp_recv_batch_input_done();
+#endif
+
 	return n_packets;
 }
 
+/*
+ * Opens a TX batch on netif: the frames sent until xemac_tx_batch_end() may
+ * be handed to the DMA without starting it for each one. Adapters that do
+ * not batch ignore it.
+ */
+void
+xemac_tx_batch_begin(struct netif *netif)
+{
+#if defined (__arm__) || defined (__aarch64__)
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+	(void)xemacpsif_tx_batch(netif, 1);
+#endif
+#endif
+	(void)netif;
+}
+
+/* Closes a TX batch, the frames held back are started */
+void
+xemac_tx_batch_end(struct netif *netif)
+{
+#if defined (__arm__) || defined (__aarch64__)
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+	(void)xemacpsif_tx_batch(netif, 0);
+#endif
+#endif
+	(void)netif;
+}
+
+#if LWIP_UDP
+static struct xudp_recv_batch *xudp_recv_batches;
+
+static struct netif *
+xudp_batch_route(struct udp_pcb *pcb, const ip_addr_t *dst_ip)
+{
+	if (pcb->netif_idx != NETIF_NO_INDEX) {
+		return netif_get_by_index(pcb->netif_idx);
+	}
+	return ip_route(&pcb->local_ip, dst_ip);
+}
+
+/*
+ * Sends the datagrams of p in order, to dst_ip/dst_port or, with dst, to
+ * dst[i]. The route is only looked up when the destination changes, and the
+ * frames go out in one TX batch per netif.
+ */
+static err_t
+xudp_batch_send(struct udp_pcb *pcb, struct pbuf **p, u16_t *count,
+		const ip_addr_t *dst_ip, u16_t dst_port, const struct xudp_dst *dst)
+{
+	struct netif *netif = NULL;
+	struct netif *batch_netif = NULL;
+	const ip_addr_t *routed_ip = NULL;
+	err_t err = ERR_OK;
+	u16_t i;
+
+	for (i = 0; i < *count; i++) {
+		if (dst != NULL) {
+			dst_ip = &dst[i].ip;
+			dst_port = dst[i].port;
+		}
+		if ((routed_ip == NULL) || !ip_addr_cmp(dst_ip, routed_ip)) {
+			netif = xudp_batch_route(pcb, dst_ip);
+			if (netif == NULL) {
+				err = ERR_RTE;
+				break;
+			}
+			if (netif != batch_netif) {
+				if (batch_netif != NULL) {
+					xemac_tx_batch_end(batch_netif);
+				}
+				xemac_tx_batch_begin(netif);
+				batch_netif = netif;
+			}
+			routed_ip = dst_ip;
+		}
+		err = udp_sendto_if(pcb, p[i], dst_ip, dst_port, netif);
+		if (err != ERR_OK) {
+			break;
+		}
+	}
+	if (batch_netif != NULL) {
+		xemac_tx_batch_end(batch_netif);
+	}
+
+	*count = i;
+	return err;
+}
+
+/*
+ * xudp_sendto_batch: sends the *count datagrams of p to dst_ip/dst_port, or
+ * to the connected remote of pcb when dst_ip is NULL. The pbufs stay owned
+ * by the caller, as with udp_sendto(). Returns the error of the first
+ * datagram that could not be sent, *count is set to the number sent before
+ * it. Must be called with the lwIP core lock held, like udp_sendto().
+ */
+err_t
+xudp_sendto_batch(struct udp_pcb *pcb, struct pbuf **p, u16_t *count,
+		const ip_addr_t *dst_ip, u16_t dst_port)
+{
+	if (dst_ip == NULL) {
+		dst_ip = &pcb->remote_ip;
+		dst_port = pcb->remote_port;
+	}
+	return xudp_batch_send(pcb, p, count, dst_ip, dst_port, NULL);
+}
+
+/* xudp_sendto_batch_list: as xudp_sendto_batch(), p[i] is sent to dst[i] */
+err_t
+xudp_sendto_batch_list(struct udp_pcb *pcb, struct pbuf **p, u16_t *count,
+		const struct xudp_dst *dst)
+{
+	return xudp_batch_send(pcb, p, count, NULL, 0, dst);
+}
+
+static void
+xudp_recv_batch_deliver(struct xudp_recv_batch *batch)
+{
+	u16_t count = batch->count;
+
+	if (count != 0) {
+		batch->count = 0;
+		batch->fn(batch->arg, batch->pcb, batch->dgram, count);
+	}
+}
+
+static void
+xudp_recv_batch_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p,
+		const ip_addr_t *addr, u16_t port)
+{
+	struct xudp_recv_batch *batch = (struct xudp_recv_batch *)arg;
+	struct xudp_dgram *dgram = &batch->dgram[batch->count++];
+
+	dgram->p = p;
+	ip_addr_copy(dgram->addr, *addr);
+	dgram->port = port;
+	if (batch->count == XUDP_BATCH_MAX) {
+		xudp_recv_batch_deliver(batch);
+	}
+}
+
+/*
+ * xudp_recv_batch: sets the receive callback of pcb to fn, called with up
+ * to XUDP_BATCH_MAX datagrams at a time: when batch is full and once the
+ * adapter has no more received packets. fn must free the pbufs. batch must
+ * stay valid until xudp_recv_batch_remove(), to be called before
+ * udp_remove(pcb).
+ */
+void
+xudp_recv_batch(struct udp_pcb *pcb, struct xudp_recv_batch *batch,
+		xudp_recv_batch_fn fn, void *arg)
+{
+	batch->pcb = pcb;
+	batch->fn = fn;
+	batch->arg = arg;
+	batch->count = 0;
+	batch->next = xudp_recv_batches;
+	xudp_recv_batches = batch;
+
+	udp_recv(pcb, xudp_recv_batch_recv, batch);
+}
+
+/* Delivers the datagrams still held by batch and stops batching its pcb */
+void
+xudp_recv_batch_remove(struct xudp_recv_batch *batch)
+{
+	struct xudp_recv_batch **prev;
+
+	xudp_recv_batch_deliver(batch);
+	for (prev = &xudp_recv_batches; *prev != NULL; prev = &(*prev)->next) {
+		if (*prev == batch) {
+			*prev = batch->next;
+			break;
+		}
+	}
+	udp_recv(batch->pcb, NULL, NULL);
+}
+
+/* Delivers the datagrams held by all batched receive callbacks */
+void
+xudp_recv_batch_flush(void)
+{
+	struct xudp_recv_batch *batch;
+
+	for (batch = xudp_recv_batches; batch != NULL; batch = batch->next) {
+		xudp_recv_batch_deliver(batch);
+	}
+}
+
+#if !NO_SYS && !LWIP_TCPIP_CORE_LOCKING_INPUT
+static void
+xudp_recv_batch_flush_cb(void *arg)
+{
+	(void)arg;
+	xudp_recv_batch_flush();
+}
+#endif
+
+/*
+ * Called by the input path once the received packets are with lwIP. Those
+ * posted to tcpip_thread are flushed by a callback queued behind them.
+ */
+static void
+xudp_recv_batch_input_done(void)
+{
+#if NO_SYS
+	xudp_recv_batch_flush();
+#elif LWIP_TCPIP_CORE_LOCKING_INPUT
+	LOCK_TCPIP_CORE();
+	xudp_recv_batch_flush();
+	UNLOCK_TCPIP_CORE();
+#else
+	if (xudp_recv_batches != NULL) {
+		(void)tcpip_try_callback(xudp_recv_batch_flush_cb, NULL);
+	}
+#endif
+}
+#endif /* LWIP_UDP */
+
+#if LWIP_TCP && LWIP_TCP_WND_AUTOTUNE
+/*
+ * xemac_tcp_wnd_autotune: sizes the receive window and send buffer of new TCP
+ * connections for a link of speed Mbps, to its bandwidth-delay product at
+ * XLWIP_TCP_WND_AUTOTUNE_RTT_US. Received data waits in the PBUF_POOL and
+ * data to send is copied to the heap, a connection gets at most half of
+ * either. The last link that came up sets the values.
+ */
+void xemac_tcp_wnd_autotune(u32_t speed)
+{
+	u64_t bdp = ((u64_t)speed * XLWIP_TCP_WND_AUTOTUNE_RTT_US) / 8U;
+	u64_t wnd = LWIP_MIN(bdp, TCP_WND);
+	u64_t snd_buf = LWIP_MIN(bdp, TCP_SND_BUF);
+
+#if !MEMP_MEM_MALLOC && PBUF_POOL_SIZE
+	wnd = LWIP_MIN(wnd, ((u64_t)PBUF_POOL_SIZE * PBUF_POOL_BUFSIZE) / 2U);
+#endif
+#if !MEM_LIBC_MALLOC
+	snd_buf = LWIP_MIN(snd_buf, (u64_t)MEM_SIZE / 2U);
+#endif
+
+	tcp_set_wnd_default((tcpwnd_size_t)wnd, (tcpwnd_size_t)snd_buf);
+}
+#endif
+
 #ifdef SGMII_FIXED_LINK
 static u32_t pcs_link_detect(XEmacPs *xemacp)
 {
@@ -297,6 +598,20 @@ void emacps_link_status(struct netif *netif, xemacpsif_s *xemacs, XEmacPs *xemac
 	if ((xemacp->IsReady != (u32)XIL_COMPONENT_IS_READY) ||
 			(xemacs->eth_link_status == ETH_LINK_UNDEFINED))
 		return;
+#ifdef XEMACPSIF_PHY_INTR
+	if (xemacs->phy_intr) {
+		/* Without an interrupt, read the PHY only now and then in case
+		 * one was lost.
+		 */
+		if (!xemacs->phy_intr_event &&
+			(++xemacs->phy_intr_polls < XEMACPSIF_PHY_INTR_POLL))
+			return;
+		xemacs->phy_intr_polls = 0;
+		xemacs->phy_intr_event = 0;
+		phy_intr_ack_emacps(xemacp, phyaddrforemac);
+		phy_intr_rearm(xemacs);
+	}
+#endif
 #ifndef SGMII_FIXED_LINK
 	/* Read Phy Status register twice to get the confirmation of the current
 	 * link status.
@@ -335,6 +650,9 @@ void emacps_link_status(struct netif *netif, xemacpsif_s *xemacs, XEmacPs *xemac
 				link_speed = phy_setup_emacps(xemacp,
 						phyaddrforemac);
 				XEmacPs_SetOperatingSpeed(xemacp, link_speed);
+#if LWIP_TCP && LWIP_TCP_WND_AUTOTUNE
+				xemac_tcp_wnd_autotune(link_speed);
+#endif
 				netif_set_link_up(netif);
 				xemacs->eth_link_status = ETH_LINK_UP;
 				xil_printf("Ethernet Link up\r\n");
@@ -390,6 +708,9 @@ void axieth_link_status(struct netif *netif, xaxiemacif_s *xemacs, XAxiEthernet
 
 				link_speed = phy_setup_axiemac(xemacp);
 				XAxiEthernet_SetOperatingSpeed(xemacp,link_speed);
+#if LWIP_TCP && LWIP_TCP_WND_AUTOTUNE
+				xemac_tcp_wnd_autotune(link_speed);
+#endif
 				netif_set_link_up(netif);
 				xemacs->eth_link_status = ETH_LINK_UP;
 				xil_printf("Ethernet Link up\r\n");
@@ -492,12 +813,157 @@ void link_detect_thread(void *p)
 {
 	struct netif *netif = (struct netif *) p;
 
+#ifdef XEMACPSIF_PHY_INTR
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacps = (xemacpsif_s *)(xemac->state);
+#endif
+
 	while (1) {
 		/* Call eth_link_detect() every second to detect Ethernet link
 		 * change.
 		 */
 		eth_link_detect(netif);
+#ifdef XEMACPSIF_PHY_INTR
+		/* or right after a PHY interrupt */
+		if ((xemac->type == xemac_type_emacps) && xemacps->phy_intr) {
+			(void)sys_arch_sem_wait(&xemacps->phy_intr_sem,
+					LINK_DETECT_THREAD_INTERVAL);
+			continue;
+		}
+#endif
 		vTaskDelay(LINK_DETECT_THREAD_INTERVAL / portTICK_RATE_MS);
 	}
 }
 #endif
+
+#if LWIP_TCP_LSO
+#if CHECKSUM_GEN_TCP
+#error "LWIP_TCP_LSO requires TCP transmit checksum offload (CHECKSUM_GEN_TCP 0)"
+#endif
+
+/*
+ * xlso_init: checks that p is a large TCP segment that can be cut into frames
+ * carrying at most p->lso_mss bytes of TCP data each, and counts
+ * the buffer descriptors needed to send it. The Ethernet, IP and TCP headers
+ * must all be in the first pbuf (the stack always builds them there).
+ */
+err_t
+xlso_init(struct xlso *lso, struct pbuf *p)
+{
+	u8_t *frame = (u8_t *)p->payload;
+	struct ip_hdr *iphdr;
+	struct tcp_hdr *tcphdr;
+	u16_t type, off, left, len;
+	u16_t i;
+	void *data;
+
+	if (p->lso_mss == 0)
+		return ERR_VAL;
+
+	/* the padding word, if any, has already been dropped by the caller */
+	off = SIZEOF_ETH_HDR - ETH_PAD_SIZE;
+	if (p->len < off + SIZEOF_VLAN_HDR + IP_HLEN + TCP_HLEN)
+		return ERR_VAL;
+	type = (u16_t)((frame[off - 2] << 8) | frame[off - 1]);
+	if (type == ETHTYPE_VLAN) {
+		off += SIZEOF_VLAN_HDR;
+		type = (u16_t)((frame[off - 2] << 8) | frame[off - 1]);
+	}
+	iphdr = (struct ip_hdr *)(frame + off);
+	if (type != ETHTYPE_IP || IPH_V(iphdr) != 4 ||
+			IPH_PROTO(iphdr) != IP_PROTO_TCP)
+		return ERR_VAL;
+	if (p->len < off + IPH_HL_BYTES(iphdr) + TCP_HLEN)
+		return ERR_VAL;
+	tcphdr = (struct tcp_hdr *)((u8_t *)iphdr + IPH_HL_BYTES(iphdr));
+
+	lso->ip_off = off;
+	lso->hdr_len = off + IPH_HL_BYTES(iphdr) + TCPH_HDRLEN_BYTES(tcphdr);
+	if (lso->hdr_len > XLSO_HDR_SIZE || p->len < lso->hdr_len)
+		return ERR_VAL;
+
+	lso->p = p;
+	lso->frame_len = p->lso_mss;
+	lso->data_len = p->tot_len - lso->hdr_len;
+	lso->nframes = (lso->data_len + lso->frame_len - 1) / lso->frame_len;
+	if (lso->nframes == 0)
+		return ERR_VAL;
+
+	/* one header BD per frame plus one BD per pbuf slice of its data */
+	lso->q = p;
+	lso->q_off = lso->hdr_len;
+	lso->nbds = lso->nframes;
+	for (i = 0; i < lso->nframes; i++) {
+		left = (i == lso->nframes - 1) ?
+			lso->data_len - i * lso->frame_len : lso->frame_len;
+		while (left != 0) {
+			xlso_next_data(lso, &left, &data, &len);
+			lso->nbds++;
+		}
+	}
+
+	lso->q = p;
+	lso->q_off = lso->hdr_len;
+	return ERR_OK;
+}
+
+/*
+ * xlso_build_hdr: writes the headers of the given frame to hdr, which must
+ * have room for XLSO_HDR_SIZE bytes, and returns the number of TCP data bytes
+ * the frame carries. The IP checksum is only computed here if the stack is
+ * configured to generate it; the TCP checksum is always left to the MAC.
+ */
+u16_t
+xlso_build_hdr(struct xlso *lso, u16_t frame, u8_t *hdr)
+{
+	struct ip_hdr *iphdr;
+	struct tcp_hdr *tcphdr;
+	u32_t offset = (u32_t)frame * lso->frame_len;
+	u16_t len;
+
+	len = (frame == lso->nframes - 1) ?
+		(u16_t)(lso->data_len - offset) : lso->frame_len;
+
+	MEMCPY(hdr, lso->p->payload, lso->hdr_len);
+	iphdr = (struct ip_hdr *)(hdr + lso->ip_off);
+	tcphdr = (struct tcp_hdr *)((u8_t *)iphdr + IPH_HL_BYTES(iphdr));
+
+	IPH_LEN_SET(iphdr, lwip_htons(lso->hdr_len - lso->ip_off + len));
+	IPH_ID_SET(iphdr, lwip_htons((u16_t)(lwip_ntohs(IPH_ID(iphdr)) + frame)));
+	IPH_CHKSUM_SET(iphdr, 0);
+#if CHECKSUM_GEN_IP
+	IPH_CHKSUM_SET(iphdr, inet_chksum(iphdr, IPH_HL_BYTES(iphdr)));
+#endif
+
+	tcphdr->seqno = lwip_htonl(lwip_ntohl(tcphdr->seqno) + offset);
+	if (frame != lso->nframes - 1)
+		TCPH_UNSET_FLAG(tcphdr, TCP_FIN | TCP_PSH);
+	tcphdr->chksum = 0;
+
+	return len;
+}
+
+/*
+ * xlso_next_data: returns the pbuf holding the next slice of TCP data of at
+ * most *left bytes, with its address in *data and its length in *len, and
+ * accounts for the slice in *left.
+ */
+struct pbuf *
+xlso_next_data(struct xlso *lso, u16_t *left, void **data, u16_t *len)
+{
+	struct pbuf *q;
+
+	while (lso->q_off == lso->q->len) {
+		lso->q = lso->q->next;
+		lso->q_off = 0;
+	}
+	q = lso->q;
+
+	*len = LWIP_MIN(*left, q->len - lso->q_off);
+	*data = (u8_t *)q->payload + lso->q_off;
+	lso->q_off += *len;
+	*left -= *len;
+
+	return q;
+}
+#endif
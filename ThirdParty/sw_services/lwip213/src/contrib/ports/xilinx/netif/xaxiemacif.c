@@ -183,6 +183,13 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 #endif
         int count = 100;
 
+#if defined(XLWIP_CONFIG_TX_DEFERRED_RECLAIM) && defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_DMA)
+	/* take completed BDs back once the ring is half used */
+	if (XAxiEthernet_IsDma(&xaxiemacif->axi_ethernet)) {
+		xaxiemac_tx_reclaim(xaxiemacif, XLWIP_CONFIG_N_TX_DESC / 2);
+	}
+#endif
+
         SYS_ARCH_PROTECT(lev);
 
         while (count) {
@@ -238,6 +245,7 @@ return_pack_dropped:
         return err;
 }
 
+#ifndef XLWIP_CONFIG_PQ_LOCKFREE
 /*
  * low_level_input():
  *
@@ -245,20 +253,19 @@ return_pack_dropped:
  * packet from the interface into the pbuf.
  *
  */
-static struct pbuf *low_level_input(struct netif *netif)
+static struct pbuf *low_level_input(pq_queue_t *recv_q)
 {
-	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
-	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
 	struct pbuf *p;
 
 	/* see if there is data to process */
-	if (pq_qlength(xaxiemacif->recv_q) == 0)
+	if (pq_qlength(recv_q) == 0)
 		return NULL;
 
 	/* return one packet from receive q */
-	p = (struct pbuf *)pq_dequeue(xaxiemacif->recv_q);
+	p = (struct pbuf *)pq_dequeue(recv_q);
 	return p;
 }
+#endif
 
 /*
  * xaxiemacif_output():
@@ -290,19 +297,55 @@ static err_t xaxiemacif_output(struct netif *netif, struct pbuf *p,
  */
 
 int xaxiemacif_input(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
+
+#if defined(XLWIP_CONFIG_TX_DEFERRED_RECLAIM) && defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_DMA)
+	/* do not leave sent pbufs behind when there is nothing more to send */
+	if (XAxiEthernet_IsDma(&xaxiemacif->axi_ethernet)) {
+		xaxiemac_tx_reclaim(xaxiemacif, XLWIP_CONFIG_N_TX_DESC);
+	}
+#endif
+
+	return xaxiemacif_queue_input(netif, xaxiemacif->recv_q);
+}
+
+/*
+ * xaxiemacif_queue_input():
+ *
+ * Passes the packets of one receive queue to lwIP. Used directly by the
+ * MCDMA RX workers, each of which owns one queue.
+ */
+int xaxiemacif_queue_input(struct netif *netif, pq_queue_t *recv_q)
 {
 	struct eth_hdr *ethhdr;
 	struct pbuf *p;
+#ifdef XLWIP_CONFIG_PQ_LOCKFREE
+	void *batch[PQ_INPUT_BATCH];
+	int n_batch = 0, i_batch = 0;
+#else
 	SYS_ARCH_DECL_PROTECT(lev);
+#endif
 
 #if !NO_SYS
 	while (1)
 #endif
 	{
 		/* move received packet into a new pbuf */
+#ifdef XLWIP_CONFIG_PQ_LOCKFREE
+		/* the RX handler enqueues without locking, drain in batches */
+		if (i_batch == n_batch) {
+			n_batch = pq_dequeue_batch(recv_q, batch,
+							PQ_INPUT_BATCH);
+			i_batch = 0;
+		}
+		p = (i_batch < n_batch) ? (struct pbuf *)batch[i_batch++] : NULL;
+#else
 		SYS_ARCH_PROTECT(lev);
-		p = low_level_input(netif);
+		p = low_level_input(recv_q);
 		SYS_ARCH_UNPROTECT(lev);
+#endif
 
 		/* no packet could be read, silently ignore this */
 		if (p == NULL)
@@ -369,6 +412,13 @@ static err_t low_level_init(struct netif *netif)
 	xemac->type = xemac_type_axi_ethernet;
 
 	xaxiemacif->send_q = NULL;
+#if LWIP_TCP_LSO
+	/* Allocated by init_axi_dma */
+	xaxiemacif->lso_hdrspace = NULL;
+#endif
+#ifdef XAXIEMACIF_RX_CHAIN
+	xaxiemacif->rx_chain = NULL;
+#endif
 	xaxiemacif->recv_q = pq_create_queue();
 	if (!xaxiemacif->recv_q)
 		return ERR_MEM;
@@ -418,6 +468,12 @@ static err_t low_level_init(struct netif *netif)
 #ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_DMA
 		/* initialize the DMA engine */
 		init_axi_dma(xemac);
+#if LWIP_TCP_LSO
+		/* frames per large send, each takes a header BD and one or
+		 * more data BDs
+		 */
+		netif->lso_max_segs = XLWIP_CONFIG_N_TX_DESC / 4;
+#endif
 #endif
 	} else if (XAxiEthernet_IsFifo(&xaxiemacif->axi_ethernet)) {
 #ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_FIFO
@@ -428,6 +484,10 @@ static err_t low_level_init(struct netif *netif)
 #ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
 		/* Initialize MCDMA engine */
 		init_axi_mcdma(xemac);
+#if XAXIEMACIF_MCDMA_RX_QUEUES > 1
+		if (axi_mcdma_start_rx_workers(netif, xemac) != ERR_OK)
+			return ERR_MEM;
+#endif
 #endif
 	} else {
 		/* should not occur */
@@ -40,6 +40,7 @@
 
 #include "lwip/stats.h"
 #include "lwip/inet_chksum.h"
+#include "lwip/sys.h"
 
 #include "netif/xadapter.h"
 #include "netif/xaxiemacif.h"
@@ -256,6 +257,40 @@ s32_t is_checksum_valid(XAxiDma_Bd *rxbd, struct pbuf *p) {
 	}
 }
 
+#if LWIP_CHECKSUM_CHECK_PER_PBUF
+/*
+ * Records in the flags of p which checksums of the frame the hardware has
+ * verified, lwIP checks the others. With partial offload the TCP checksum of
+ * an unfragmented IPv4 frame is verified from the hardware sum.
+ */
+static inline void rx_csum_flags(XAxiDma_Bd *rxbd, struct pbuf *p)
+{
+	u8_t flags = 0;
+#if LWIP_FULL_CSUM_OFFLOAD_RX==1
+	u32_t sts = XAxiDma_BdRead(rxbd, XAXIDMA_BD_USR2_OFFSET);
+
+	sts = (sts & XAXIEMACIF_RX_CSUM_STS_MASK) >> XAXIEMACIF_RX_CSUM_STS_SHIFT;
+	if ((sts == XAXIEMACIF_RX_CSUM_TCP_OK) ||
+		(sts == XAXIEMACIF_RX_CSUM_UDP_OK)) {
+		flags = PBUF_FLAG_CHKSUM_IP_OK | PBUF_FLAG_CHKSUM_L4_OK;
+	}
+#elif LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
+	struct ethip_hdr *ehdr = p->payload;
+
+	if ((p->next == NULL) && (htons(ehdr->eth.type) == ETHTYPE_IP) &&
+		(IPH_PROTO(&ehdr->ip) == IP_PROTO_TCP) &&
+		((IPH_OFFSET(&ehdr->ip) & PP_HTONS(IP_OFFMASK | IP_MF)) == 0) &&
+		is_checksum_valid(rxbd, p)) {
+		flags = PBUF_FLAG_CHKSUM_L4_OK;
+	}
+#else
+	(void)rxbd;
+#endif
+	p->flags = (u8_t)((p->flags &
+			~(PBUF_FLAG_CHKSUM_IP_OK | PBUF_FLAG_CHKSUM_L4_OK)) | flags);
+}
+#endif
+
 static inline void *alloc_bdspace(int n_desc)
 {
 	int space = XAxiDma_BdRingMemCalc(BD_ALIGNMENT, n_desc);
@@ -306,12 +341,19 @@ static void axidma_send_handler(void *arg)
 #endif
 		return;
 	}
+#ifdef XLWIP_CONFIG_TX_DEFERRED_RECLAIM
+	/* The send path takes completed BDs back, keep only the error
+	 * interrupt.
+	 */
+	XAxiDma_BdRingIntEnable(txringptr, XAXIDMA_IRQ_ERROR_MASK);
+#else
 	/* If Transmit done interrupt is asserted, process completed BD's */
 	if (irq_status & (XAXIDMA_IRQ_DELAY_MASK | XAXIDMA_IRQ_IOC_MASK)) {
 		process_sent_bds(txringptr);
 	}
 
 	XAxiDma_BdRingIntEnable(txringptr, XAXIDMA_IRQ_ALL_MASK);
+#endif
 
 #if !NO_SYS
 	xInsideISR--;
@@ -329,11 +371,7 @@ static void setup_rx_bds(XAxiDma_BdRing *rxring)
 	n_bds = XAxiDma_BdRingGetFreeCnt(rxring);
 	while (n_bds > 0) {
 		n_bds--;
-#ifdef USE_JUMBO_FRAMES
-		p = pbuf_alloc(PBUF_RAW, XAE_MAX_JUMBO_FRAME_SIZE, PBUF_POOL);
-#else
-		p = pbuf_alloc(PBUF_RAW, XAE_MAX_FRAME_SIZE, PBUF_POOL);
-#endif
+		p = pbuf_alloc(PBUF_RAW, XAXIEMACIF_RX_BUF_SIZE, PBUF_POOL);
 		if (!p) {
 #if LINK_STATS
 			lwip_stats.link.memerr++;
@@ -362,11 +400,7 @@ static void setup_rx_bds(XAxiDma_BdRing *rxring)
 #if !defined (__MICROBLAZE__)
 		dsb();
 #endif
-#ifdef USE_JUMBO_FRAMES
-		XCACHE_FLUSH_DCACHE_RANGE((UINTPTR)p->payload, (UINTPTR)XAE_MAX_JUMBO_FRAME_SIZE);
-#else
-		XCACHE_FLUSH_DCACHE_RANGE((UINTPTR)p->payload, (UINTPTR)XAE_MAX_FRAME_SIZE);
-#endif
+		XCACHE_FLUSH_DCACHE_RANGE((UINTPTR)p->payload, (UINTPTR)XAXIEMACIF_RX_BUF_SIZE);
 #if !defined(__aarch64__)
 		XCACHE_FLUSH_DCACHE_RANGE(rxbd, sizeof *rxbd);
 #endif
@@ -419,6 +453,13 @@ static void axidma_recv_handler(void *arg)
 	 */
 	if ((irq_status & XAXIDMA_IRQ_ERROR_MASK)) {
 		setup_rx_bds(rxring);
+#ifdef XAXIEMACIF_RX_CHAIN
+		/* the rest of a partly received frame is lost with the reset */
+		if (xaxiemacif->rx_chain != NULL) {
+			pbuf_free(xaxiemacif->rx_chain);
+			xaxiemacif->rx_chain = NULL;
+		}
+#endif
 		LWIP_DEBUGF(NETIF_DEBUG, ("%s: Error: axidma error interrupt is asserted\r\n",
 			__FUNCTION__));
 		XAxiDma_Reset(&xaxiemacif->axidma);
@@ -448,21 +489,41 @@ static void axidma_recv_handler(void *arg)
 		for (i = 0, rxbd = rxbdset; i < bd_processed; i++) {
 			p = (struct pbuf *)(UINTPTR)XAxiDma_BdGetId(rxbd);
 			/* Adjust the buffer size to the actual number of bytes received.*/
+#ifdef XAXIEMACIF_RX_CHAIN
+			/* A frame larger than the buffers spans several BDs, which
+			 * may complete across interrupts, so its chain is kept in
+			 * rx_chain until its last BD.
+			 */
+			rx_bytes = XAxiDma_BdGetActualLength(rxbd, rxring->MaxTransferLen);
+#else
 			rx_bytes = extract_packet_len(rxbd);
+#endif
 			pbuf_realloc(p, rx_bytes);
 
 #if defined(__aarch64__)
-#ifdef USE_JUMBO_FRAMES
-			XCACHE_INVALIDATE_DCACHE_RANGE(p->payload,
-							XAE_MAX_JUMBO_FRAME_SIZE);
-#else
-			XCACHE_INVALIDATE_DCACHE_RANGE(p->payload, XAE_MAX_FRAME_SIZE);
+			XCACHE_INVALIDATE_DCACHE_RANGE(p->payload, XAXIEMACIF_RX_BUF_SIZE);
 #endif
+#ifdef XAXIEMACIF_RX_CHAIN
+			if (xaxiemacif->rx_chain != NULL) {
+				pbuf_cat(xaxiemacif->rx_chain, p);
+				p = xaxiemacif->rx_chain;
+			}
+			if (!(XAxiDma_BdGetSts(rxbd) & XAXIDMA_BD_STS_RXEOF_MASK)) {
+				xaxiemacif->rx_chain = p;
+				rxbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(rxring, rxbd);
+				continue;
+			}
+			xaxiemacif->rx_chain = NULL;
 #endif
 
-#if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
-			/* Verify for partial checksum offload case */
-			if (!is_checksum_valid(rxbd, p)) {
+#if LWIP_CHECKSUM_CHECK_PER_PBUF
+			/* the status words of the frame are in its last BD */
+			rx_csum_flags(rxbd, p);
+#elif LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
+			/* Verify for partial checksum offload case, the status
+			 * words of the frame are in its last BD
+			 */
+			if ((p->next == NULL) && !is_checksum_valid(rxbd, p)) {
 				LWIP_DEBUGF(NETIF_DEBUG, ("Incorrect csum as calculated by the hw\r\n"));
 			}
 #endif
@@ -516,7 +577,10 @@ s32_t process_sent_bds(XAxiDma_BdRing *txring)
 	for (i = 0, txbd = txbdset; i < n_bds; i++) {
 		bdindex = XAxiDma_BD_TO_INDEX(txring, txbd);
 		struct pbuf *p = (struct pbuf *)(UINTPTR)XAxiDma_BdGetId(txbd);
-		pbuf_free(p);
+		/* header BDs of large sends carry no pbuf */
+		if (p != NULL) {
+			pbuf_free(p);
+		}
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
     notifyinfo[bdindex] = 0;
 #endif
@@ -526,6 +590,131 @@ s32_t process_sent_bds(XAxiDma_BdRing *txring)
 	return (XAxiDma_BdRingFree(txring, n_bds, txbdset));
 }
 
+#ifdef XLWIP_CONFIG_TX_DEFERRED_RECLAIM
+/*
+ * xaxiemac_tx_reclaim: called from the send and receive paths, never from
+ * the TX interrupt. When fewer than min_free TX BDs are free, takes the
+ * completed BDs back from the hardware, XLWIP_TX_RECLAIM_BATCH at a time, and
+ * frees their pbufs in bulk outside the protected section.
+ */
+void xaxiemac_tx_reclaim(xaxiemacif_s *xaxiemacif, s32_t min_free)
+{
+	struct pbuf *pbufs[XLWIP_TX_RECLAIM_BATCH];
+	XAxiDma_BdRing *txring = XAxiDma_GetTxRing(&xaxiemacif->axidma);
+	XAxiDma_Bd *txbdset, *txbd;
+	struct pbuf *p;
+	s32_t n_bds, n_pbufs, i;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	if ((s32_t)XAxiDma_BdRingGetFreeCnt(txring) >= min_free) {
+		return;
+	}
+
+	do {
+		n_pbufs = 0;
+		SYS_ARCH_PROTECT(lev);
+		n_bds = XAxiDma_BdRingFromHw(txring, XLWIP_TX_RECLAIM_BATCH,
+								&txbdset);
+		for (i = 0, txbd = txbdset; i < n_bds; i++) {
+			p = (struct pbuf *)(UINTPTR)XAxiDma_BdGetId(txbd);
+			if (p != NULL) {
+				pbufs[n_pbufs++] = p;
+			}
+			txbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(txring, txbd);
+		}
+		if (n_bds > 0) {
+			XAxiDma_BdRingFree(txring, n_bds, txbdset);
+		}
+		SYS_ARCH_UNPROTECT(lev);
+
+		for (i = 0; i < n_pbufs; i++) {
+			pbuf_free(pbufs[i]);
+		}
+	} while (n_bds == XLWIP_TX_RECLAIM_BATCH);
+}
+#endif
+
+#if LWIP_TCP_LSO
+/*
+ * Sends a large TCP segment as a train of frames. Each frame starts with a BD
+ * pointing at a copy of the segment headers patched for that frame, followed
+ * by BDs pointing straight into the payload of the original pbufs. The TCP
+ * checksum of every frame is offloaded through its first BD.
+ */
+static XStatus axidma_lso_sgsend(xaxiemacif_s *xaxiemacif,
+		XAxiDma_BdRing *txring, struct xlso *lso)
+{
+	XAxiDma_Bd *txbdset, *txbd;
+	XStatus status;
+	struct pbuf *q;
+	void *data;
+	u8_t *hdr;
+	u32_t bdindex;
+	u16_t frame, left, len;
+#if LWIP_PARTIAL_CSUM_OFFLOAD_TX==1
+	struct ip_hdr *iphdr;
+	ip4_addr_t src, dest;
+	u32_t tcp_payload_offset;
+	u16_t csum_init;
+#endif
+
+	if (XAxiDma_BdRingGetFreeCnt(txring) < lso->nbds) {
+		process_sent_bds(txring);
+	}
+
+	status = XAxiDma_BdRingAlloc(txring, lso->nbds, &txbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error allocating TxBD\r\n"));
+		return ERR_IF;
+	}
+
+	txbd = txbdset;
+	for (frame = 0; frame < lso->nframes; frame++) {
+		bdindex = XAxiDma_BD_TO_INDEX(txring, txbd);
+		hdr = xaxiemacif->lso_hdrspace + (bdindex * XLSO_HDR_SIZE);
+		left = xlso_build_hdr(lso, frame, hdr);
+		XCACHE_FLUSH_DCACHE_RANGE(hdr, lso->hdr_len);
+
+		XAxiDma_BdSetBufAddr(txbd, (UINTPTR)hdr);
+		XAxiDma_BdSetLength(txbd, lso->hdr_len, txring->MaxTransferLen);
+		XAxiDma_BdSetId(txbd, NULL);
+		XAxiDma_BdSetCtrl(txbd, XAXIDMA_BD_CTRL_TXSOF_MASK);
+#if LWIP_FULL_CSUM_OFFLOAD_TX==1
+		bd_fullcsum_disable(txbd);
+		bd_fullcsum_enable(txbd);
+#endif
+#if LWIP_PARTIAL_CSUM_OFFLOAD_TX==1
+		bd_csum_disable(txbd);
+		iphdr = (struct ip_hdr *)(hdr + lso->ip_off);
+		tcp_payload_offset = lso->ip_off + IPH_HL_BYTES(iphdr);
+		ip4_addr_copy(src, iphdr->src);
+		ip4_addr_copy(dest, iphdr->dest);
+		/* compute pseudo header checksum value of this frame */
+		csum_init = inet_chksum_pseudo(NULL, IP_PROTO_TCP,
+			lso->hdr_len - tcp_payload_offset + left, &src, &dest);
+		bd_csum_set(txbd, tcp_payload_offset, tcp_payload_offset + 16,
+							htons(~csum_init));
+#endif
+
+		while (left != 0) {
+			txbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(txring, txbd);
+			q = xlso_next_data(lso, &left, &data, &len);
+			XAxiDma_BdSetBufAddr(txbd, (UINTPTR)data);
+			XAxiDma_BdSetLength(txbd, len, txring->MaxTransferLen);
+			XAxiDma_BdSetId(txbd, (void *)q);
+			XAxiDma_BdSetCtrl(txbd, (left == 0) ?
+						XAXIDMA_BD_CTRL_TXEOF_MASK : 0);
+			XCACHE_FLUSH_DCACHE_RANGE(data, len);
+			pbuf_ref(q);
+		}
+		txbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(txring, txbd);
+	}
+
+	/* enq to h/w */
+	return XAxiDma_BdRingToHw(txring, lso->nbds, txbdset);
+}
+#endif
+
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p,
         u32_t block_till_tx_complete, u32_t *to_block_index)
@@ -540,6 +729,9 @@ XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 	XAxiDma_BdRing *txring;
 	u32_t max_frame_size;
 	u32_t bdindex = 0;
+#if LWIP_TCP_LSO
+	struct xlso lso;
+#endif
 
 #ifdef USE_JUMBO_FRAMES
 	max_frame_size = XAE_MAX_JUMBO_FRAME_SIZE - 18;
@@ -548,6 +740,12 @@ XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 #endif
 	txring = XAxiDma_GetTxRing(&xaxiemacif->axidma);
 
+#if LWIP_TCP_LSO
+	if (xlso_init(&lso, p) == ERR_OK) {
+		return axidma_lso_sgsend(xaxiemacif, txring, &lso);
+	}
+#endif
+
 	/* first count the number of pbufs */
 	for (q = p, n_pbufs = 0; q != NULL; q = q->next)
 		n_pbufs++;
@@ -701,6 +899,17 @@ XStatus init_axi_dma(struct xemac_s *xemac)
 				__FILE__, __LINE__);
 		return ERR_IF;
 	}
+#if LWIP_TCP_LSO
+	if (xaxiemacif->lso_hdrspace == NULL) {
+		xaxiemacif->lso_hdrspace = mem_malloc(XLWIP_CONFIG_N_TX_DESC *
+							XLSO_HDR_SIZE);
+		if (xaxiemacif->lso_hdrspace == NULL) {
+			xil_printf("%s@%d: Error: Unable to allocate memory for LSO headers",
+					__FILE__, __LINE__);
+			return ERR_IF;
+		}
+	}
+#endif
 	/* initialize DMA */
 #ifndef SDT
 	baseaddr = xaxiemacif->axi_ethernet.Config.AxiDevBaseAddress;
@@ -755,11 +964,7 @@ XStatus init_axi_dma(struct xemac_s *xemac)
 			LWIP_DEBUGF(NETIF_DEBUG, ("init_axi_dma: Error allocating RxBD\r\n"));
 			return ERR_IF;
 		}
-#ifdef USE_JUMBO_FRAMES
-		p = pbuf_alloc(PBUF_RAW, XAE_MAX_JUMBO_FRAME_SIZE, PBUF_POOL);
-#else
-		p = pbuf_alloc(PBUF_RAW, XAE_MAX_FRAME_SIZE, PBUF_POOL);
-#endif
+		p = pbuf_alloc(PBUF_RAW, XAXIEMACIF_RX_BUF_SIZE, PBUF_POOL);
 		if (!p) {
 #if LINK_STATS
 			lwip_stats.link.memerr++;
@@ -777,11 +982,7 @@ XStatus init_axi_dma(struct xemac_s *xemac)
 		XAxiDma_BdSetLength(rxbd, p->len, rxringptr->MaxTransferLen);
 		XAxiDma_BdSetCtrl(rxbd, 0);
 		XAxiDma_BdSetId(rxbd, p);
-#ifdef USE_JUMBO_FRAMES
-		XCACHE_FLUSH_DCACHE_RANGE((UINTPTR)p->payload, (UINTPTR)XAE_MAX_JUMBO_FRAME_SIZE);
-#else
-		XCACHE_FLUSH_DCACHE_RANGE((UINTPTR)p->payload, (UINTPTR)XAE_MAX_FRAME_SIZE);
-#endif
+		XCACHE_FLUSH_DCACHE_RANGE((UINTPTR)p->payload, (UINTPTR)XAXIEMACIF_RX_BUF_SIZE);
 #if !defined(__aarch64__)
 		XCACHE_FLUSH_DCACHE_RANGE(rxbd, sizeof *rxbd);
 #endif
@@ -92,6 +92,7 @@ xllfifo_recv_handler(struct xemac_s *xemac)
 {
 	u32_t frame_length;
 	struct pbuf *p;
+	struct pbuf *q;
 	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
 	XLlFifo *llfifo = &xaxiemacif->axififo;
 
@@ -114,8 +115,13 @@ xllfifo_recv_handler(struct xemac_s *xemac)
 			continue;
                 }
 
-		/* receive packet */
-		XLlFifo_Read(llfifo, p->payload, frame_length);
+		/*
+		 * receive packet straight into the pbufs, a pool pbuf may be
+		 * chained when the frame is longer than PBUF_POOL_BUFSIZE
+		 */
+		for (q = p; q != NULL; q = q->next) {
+			XLlFifo_Read(llfifo, q->payload, q->len);
+		}
 
 #if ETH_PAD_SIZE
 		len += ETH_PAD_SIZE;		/* allow room for Ethernet padding */
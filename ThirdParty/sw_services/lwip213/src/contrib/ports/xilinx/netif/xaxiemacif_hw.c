@@ -79,6 +79,10 @@ void init_axiemac(xaxiemacif_s *xaxiemac, struct netif *netif)
 		xaxiemac->eth_link_status = ETH_LINK_DOWN;
 	else
 		xaxiemac->eth_link_status = ETH_LINK_UP;
+#if LWIP_TCP && LWIP_TCP_WND_AUTOTUNE
+	if (link_speed != 0)
+		xemac_tcp_wnd_autotune(link_speed);
+#endif
 
 	/* Setting the operating speed of the MAC needs a delay. */
 	{
@@ -224,6 +224,40 @@ s32_t is_checksum_valid(XMcdma_Bd *rxbd, struct pbuf *p)
 	}
 }
 
+#if LWIP_CHECKSUM_CHECK_PER_PBUF
+/*
+ * Records in the flags of p which checksums of the frame the hardware has
+ * verified, lwIP checks the others. With partial offload the TCP checksum of
+ * an unfragmented IPv4 frame is verified from the hardware sum.
+ */
+static inline void rx_csum_flags(XMcdma_Bd *rxbd, struct pbuf *p)
+{
+	u8_t flags = 0;
+#if LWIP_FULL_CSUM_OFFLOAD_RX==1
+	u32_t sts = XMcdma_BdRead64(rxbd, XMCDMA_BD_USR2_OFFSET);
+
+	sts = (sts & XAXIEMACIF_RX_CSUM_STS_MASK) >> XAXIEMACIF_RX_CSUM_STS_SHIFT;
+	if ((sts == XAXIEMACIF_RX_CSUM_TCP_OK) ||
+		(sts == XAXIEMACIF_RX_CSUM_UDP_OK)) {
+		flags = PBUF_FLAG_CHKSUM_IP_OK | PBUF_FLAG_CHKSUM_L4_OK;
+	}
+#elif LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
+	struct ethip_hdr *ehdr = p->payload;
+
+	if ((p->next == NULL) && (htons(ehdr->eth.type) == ETHTYPE_IP) &&
+		(IPH_PROTO(&ehdr->ip) == IP_PROTO_TCP) &&
+		((IPH_OFFSET(&ehdr->ip) & PP_HTONS(IP_OFFMASK | IP_MF)) == 0) &&
+		is_checksum_valid(rxbd, p)) {
+		flags = PBUF_FLAG_CHKSUM_L4_OK;
+	}
+#else
+	(void)rxbd;
+#endif
+	p->flags = (u8_t)((p->flags &
+			~(PBUF_FLAG_CHKSUM_IP_OK | PBUF_FLAG_CHKSUM_L4_OK)) | flags);
+}
+#endif
+
 #define XMcdma_BdMemCalc(Alignment, NumBd) \
 	(int)((sizeof(XMcdma_Bd)+((Alignment)-1)) & ~((Alignment)-1))*(NumBd)
 
@@ -393,6 +427,12 @@ static void axi_mcdma_recv_handler(void *CallBackRef, u32 ChanId)
 	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
 	XMcdma *McDmaInstPtr = &xaxiemacif->aximcdma;
 	XMcdma_ChanCtrl *Rx_Chan;
+#if XAXIEMACIF_MCDMA_RX_QUEUES > 1
+	u32_t queue = (ChanId - 1) % XAXIEMACIF_MCDMA_RX_QUEUES;
+	pq_queue_t *recv_q = xaxiemacif->chan_recv_q[queue];
+#else
+	pq_queue_t *recv_q = xaxiemacif->recv_q;
+#endif
 
 #if !NO_SYS
 	xInsideISR++;
@@ -414,7 +454,9 @@ static void axi_mcdma_recv_handler(void *CallBackRef, u32 ChanId)
 #endif
 		pbuf_realloc(p, rx_bytes);
 
-#if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
+#if LWIP_CHECKSUM_CHECK_PER_PBUF
+		rx_csum_flags(rxbd, p);
+#elif LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
 		/* Verify for partial checksum offload case */
 		if (!is_checksum_valid(rxbd, p)) {
 			LWIP_DEBUGF(NETIF_DEBUG, ("Incorrect csum as calculated by the hw\r\n"));
@@ -423,7 +465,7 @@ static void axi_mcdma_recv_handler(void *CallBackRef, u32 ChanId)
 		/* store it in the receive queue,
 		 * where it'll be processed by a different handler
 		 */
-		if (pq_enqueue(xaxiemacif->recv_q, (void*)p) < 0) {
+		if (pq_enqueue(recv_q, (void*)p) < 0) {
 #if LINK_STATS
 			lwip_stats.link.memerr++;
 			lwip_stats.link.drop++;
@@ -439,11 +481,71 @@ static void axi_mcdma_recv_handler(void *CallBackRef, u32 ChanId)
 	/* return all the processed bd's back to the stack */
 	setup_rx_bds(Rx_Chan, Rx_Chan->BdCnt);
 #if !NO_SYS
-	sys_sem_signal(&xemac->sem_rx_data_available);
+#if XAXIEMACIF_MCDMA_RX_QUEUES > 1
+	if (queue)
+		sys_sem_signal(&xaxiemacif->chan_sem[queue]);
+	else
+#endif
+		sys_sem_signal(&xemac->sem_rx_data_available);
 	xInsideISR--;
 #endif
 }
 
+#if XAXIEMACIF_MCDMA_RX_QUEUES > 1
+struct axi_mcdma_rx_worker {
+	struct netif *netif;
+	xaxiemacif_s *xaxiemacif;
+	u32_t queue;
+};
+
+/*
+ * Drains one RX queue into lwIP. The PL steers each flow to a fixed MCDMA
+ * channel and every channel maps to a fixed queue, so the frames of a flow
+ * are still handed to lwIP in order.
+ */
+static void axi_mcdma_rx_worker_thread(void *arg)
+{
+	struct axi_mcdma_rx_worker *worker = (struct axi_mcdma_rx_worker *)arg;
+	u32_t queue = worker->queue;
+
+	while (1) {
+		sys_sem_wait(&worker->xaxiemacif->chan_sem[queue]);
+		xaxiemacif_queue_input(worker->netif,
+				worker->xaxiemacif->chan_recv_q[queue]);
+	}
+}
+
+err_t axi_mcdma_start_rx_workers(struct netif *netif, struct xemac_s *xemac)
+{
+	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
+	struct axi_mcdma_rx_worker *worker;
+	u32_t queue;
+
+	xaxiemacif->chan_recv_q[0] = xaxiemacif->recv_q;
+
+	for (queue = 1; queue < XAXIEMACIF_MCDMA_RX_QUEUES; queue++) {
+		xaxiemacif->chan_recv_q[queue] = pq_create_queue();
+		worker = mem_malloc(sizeof *worker);
+		if (!xaxiemacif->chan_recv_q[queue] || !worker) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("%s: out of memory for RX queue %d\r\n",
+					__func__, queue));
+			return ERR_MEM;
+		}
+		if (sys_sem_new(&xaxiemacif->chan_sem[queue], 0) != ERR_OK)
+			return ERR_MEM;
+
+		worker->netif = netif;
+		worker->xaxiemacif = xaxiemacif;
+		worker->queue = queue;
+		sys_thread_new("xaxiemacif_rx_worker", axi_mcdma_rx_worker_thread,
+				worker, XAXIEMACIF_RX_WORKER_STACKSIZE,
+				XAXIEMACIF_RX_WORKER_PRIO);
+	}
+
+	return ERR_OK;
+}
+#endif
+
 s32_t xaxiemac_is_tx_space_available(xaxiemacif_s *xaxiemacif)
 {
 	XMcdma_ChanCtrl *Tx_Chan;
@@ -528,6 +630,43 @@ static void update_partial_cksum_offload(XMcdma_Bd *txbdset, struct pbuf *p)
 }
 #endif
 
+#if XAXIEMACIF_MCDMA_RX_QUEUES > 1
+/*
+ * Picks the TX channel of a frame from its IPv4 addresses and, for TCP and
+ * UDP, its ports, so that all frames of a flow use the same channel and are
+ * not reordered between channels. Other frames use channel 1.
+ */
+static u8_t axi_mcdma_flow_chan(xaxiemacif_s *xaxiemacif, struct pbuf *p)
+{
+	struct ethip_hdr *ethiphdr = (struct ethip_hdr *)p->payload;
+	u16_t iphdr_len;
+	u32_t hash;
+	u8_t *l4;
+
+	if (p->len <= sizeof(struct ethip_hdr) ||
+	    ethiphdr->eth.type != PP_HTONS(ETHTYPE_IP))
+		return 1;
+
+	hash = ethiphdr->ip.src.addr ^ ethiphdr->ip.dest.addr;
+
+	iphdr_len = IPH_HL(&ethiphdr->ip) << 2;
+	if ((IPH_PROTO(&ethiphdr->ip) == IP_PROTO_TCP ||
+	     IPH_PROTO(&ethiphdr->ip) == IP_PROTO_UDP) &&
+	    (IPH_OFFSET(&ethiphdr->ip) & PP_HTONS(IP_OFFMASK)) == 0 &&
+	    p->len >= sizeof(struct eth_hdr) + iphdr_len + 4) {
+		l4 = (u8_t *)&ethiphdr->ip + iphdr_len;
+		/* both port numbers, the order does not matter for the hash */
+		hash ^= ((u32_t)l4[0] << 24) | ((u32_t)l4[1] << 16) |
+			((u32_t)l4[2] << 8) | l4[3];
+	}
+
+	hash ^= hash >> 16;
+	hash ^= hash >> 8;
+
+	return 1 + (hash % xaxiemacif->axi_ethernet.Config.AxiMcDmaChan_Cnt);
+}
+#endif
+
 XStatus axi_mcdma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 {
 	struct pbuf *q;
@@ -535,13 +674,24 @@ XStatus axi_mcdma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 	XMcdma_Bd *txbdset, *txbd, *last_txbd = NULL;
 	XMcdma_ChanCtrl *Tx_Chan;
 	XStatus status;
+#if XAXIEMACIF_MCDMA_RX_QUEUES == 1
 	static u8_t ChanId = 1;
 	u8_t next_ChanId = ChanId;
+#endif
 
 	/* first count the number of pbufs */
 	for (q = p; q != NULL; q = q->next)
 		n_pbufs++;
 
+#if XAXIEMACIF_MCDMA_RX_QUEUES > 1
+	/* Keep each flow on its own TX DMA channel */
+	Tx_Chan = XMcdma_GetMcdmaTxChan(&xaxiemacif->aximcdma,
+					axi_mcdma_flow_chan(xaxiemacif, p));
+	if (n_pbufs > Tx_Chan->BdCnt) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error, not enough BD space in flow Chan\r\n"));
+		return ERR_IF;
+	}
+#else
 	/* Transfer packets to TX DMA Channels in round-robin manner */
 	do {
 		Tx_Chan = XMcdma_GetMcdmaTxChan(&xaxiemacif->aximcdma, ChanId);
@@ -555,6 +705,7 @@ XStatus axi_mcdma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 		}
 
 	} while (n_pbufs > Tx_Chan->BdCnt);
+#endif
 
 	txbdset = (XMcdma_Bd *)XMcdma_GetChanCurBd(Tx_Chan);
 
@@ -158,15 +158,20 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
 	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
 
+#ifdef XLWIP_CONFIG_TX_DEFERRED_RECLAIM
+	/* take completed BDs back once a ring is half used */
+	xemacps_tx_reclaim(xemacpsif, XLWIP_CONFIG_N_TX_DESC / 2);
+#endif
+
 	SYS_ARCH_PROTECT(lev);
-	/* check if space is available to send */
-    freecnt = xemacps_is_tx_space_available(xemacpsif);
+	/* check if space is available to send on the queue of the frame */
+	txring = xemacps_select_txring(xemacpsif, p);
+    freecnt = XEmacPs_BdRingGetFreeCnt(txring);
     if (freecnt <= 5) {
-	txring = &(XEmacPs_GetTxRing(&xemacpsif->emacps));
 		xemacps_process_sent_bds(xemacpsif, txring);
 	}
 
-    if (xemacps_is_tx_space_available(xemacpsif)) {
+    if (XEmacPs_BdRingGetFreeCnt(txring)) {
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 		if (netif_is_opt_block_tx_set(netif, NETIF_ENABLE_BLOCKING_TX_FOR_PACKET)) {
 			err = _unbuffered_low_level_output(xemacpsif, p, 1, &to_block_index);
@@ -205,6 +210,7 @@ return_pack_dropped:
 	return err;
 }
 
+#ifndef XLWIP_CONFIG_PQ_LOCKFREE
 /*
  * low_level_input():
  *
@@ -226,6 +232,7 @@ static struct pbuf * low_level_input(struct netif *netif)
 	p = (struct pbuf *)pq_dequeue(xemacpsif->recv_q);
 	return p;
 }
+#endif
 
 /*
  * xemacpsif_output():
@@ -260,16 +267,40 @@ s32_t xemacpsif_input(struct netif *netif)
 {
 	struct eth_hdr *ethhdr;
 	struct pbuf *p;
+#if defined(XLWIP_CONFIG_PQ_LOCKFREE) || defined(XLWIP_CONFIG_TX_DEFERRED_RECLAIM)
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+#endif
+#ifdef XLWIP_CONFIG_PQ_LOCKFREE
+	void *batch[PQ_INPUT_BATCH];
+	int n_batch = 0, i_batch = 0;
+#else
 	SYS_ARCH_DECL_PROTECT(lev);
+#endif
+
+#ifdef XLWIP_CONFIG_TX_DEFERRED_RECLAIM
+	/* do not leave sent pbufs behind when there is nothing more to send */
+	xemacps_tx_reclaim(xemacpsif, XLWIP_CONFIG_N_TX_DESC);
+#endif
 
 #if !NO_SYS
 	while (1)
 #endif
 	{
 		/* move received packet into a new pbuf */
+#ifdef XLWIP_CONFIG_PQ_LOCKFREE
+		/* the RX handler enqueues without locking, drain in batches */
+		if (i_batch == n_batch) {
+			n_batch = pq_dequeue_batch(xemacpsif->recv_q, batch,
+							PQ_INPUT_BATCH);
+			i_batch = 0;
+		}
+		p = (i_batch < n_batch) ? (struct pbuf *)batch[i_batch++] : NULL;
+#else
 		SYS_ARCH_PROTECT(lev);
 		p = low_level_input(netif);
 		SYS_ARCH_UNPROTECT(lev);
+#endif
 
 		/* no packet could be read, silently ignore this */
 		if (p == NULL) {
@@ -314,6 +345,35 @@ s32_t xemacpsif_input(struct netif *netif)
 	return 1;
 }
 
+#ifdef XEMACPSIF_RX_POLL_BUDGET
+/*
+ * xemacpsif_poll_input():
+ *
+ * Run by the input thread once the RX handler has masked the RX interrupts.
+ * Polls the BD rings, at most XEMACPSIF_RX_POLL_BUDGET frames at a time, and
+ * hands the frames to lwIP until the rings are empty. Other tasks get the
+ * CPU between two polls.
+ *
+ */
+void xemacpsif_poll_input(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	s32_t n_frames;
+
+	do {
+		while (1) {
+			n_frames = xemacps_rx_poll(xemacpsif,
+						XEMACPSIF_RX_POLL_BUDGET);
+			xemacpsif_input(netif);
+			if (n_frames < XEMACPSIF_RX_POLL_BUDGET)
+				break;
+			taskYIELD();
+		}
+	} while (xemacps_rx_poll_done(xemacpsif) == 0);
+}
+#endif
+
 #if !NO_SYS
 #if defined(__arm__) && !defined(ARMR5)
 void vTimerCallback( TimerHandle_t pxTimer )
@@ -359,9 +419,27 @@ static err_t low_level_init(struct netif *netif)
 	xemac->type = xemac_type_emacps;
 
 	xemacpsif->send_q = NULL;
+#if XEMACPSIF_NUM_QUEUES > 1
+	/* Set from the hardware by init_dma */
+	xemacpsif->num_queues = 0;
+#endif
+#ifdef XEMACPSIF_RX_POLL_BUDGET
+	xemacpsif->rx_polling = 0;
+#endif
+#if LWIP_TCP_LSO
+	/* Allocated by init_dma */
+	xemacpsif->lso_hdrspace = NULL;
+#endif
+	xemacpsif->tx_batch = 0;
+	xemacpsif->tx_batch_frames = 0;
 	xemacpsif->recv_q = pq_create_queue();
 	if (!xemacpsif->recv_q)
 		return ERR_MEM;
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+	xemacpsif->tx_ts_q = pq_create_queue();
+	if (!xemacpsif->tx_ts_q)
+		return ERR_MEM;
+#endif
 
 	/* maximum transfer unit */
 #ifdef ZYNQMP_USE_JUMBO
@@ -370,6 +448,11 @@ static err_t low_level_init(struct netif *netif)
 	netif->mtu = XEMACPS_MTU - XEMACPS_HDR_SIZE;
 #endif
 
+#if LWIP_TCP_LSO
+	/* frames per large send, each takes a header BD and one or more data BDs */
+	netif->lso_max_segs = XLWIP_CONFIG_N_TX_DESC / 4;
+#endif
+
 #if LWIP_IGMP
 	netif->igmp_mac_filter = xemacpsif_mac_filter_update;
 #endif
@@ -435,6 +518,9 @@ static err_t low_level_init(struct netif *netif)
 	setup_isr(xemac);
 	init_dma(xemac);
 	start_emacps(xemacpsif);
+#ifdef XEMACPSIF_PHY_INTR
+	(void)init_phy_intr(xemacpsif);
+#endif
 
 	/* replace the state in netif (currently the emac baseaddress)
 	 * with the mac instance pointer.
@@ -794,3 +880,76 @@ void xemacpsif_resetrx_on_no_rxdata(struct netif *netif)
 
 	resetrx_on_no_rxdata(xemacpsif);
 }
+
+#if XEMACPSIF_NUM_QUEUES > 1
+/*
+ * xemacpsif_set_tx_prio_queue():
+ *
+ * Sends the frames of priority prio (0-7) on TX queue queue. The priority
+ * of a frame is taken from its headers, see xemacpsif_dma.c. May be called
+ * once the interface is added.
+ *
+ */
+
+err_t xemacpsif_set_tx_prio_queue(struct netif *netif, u8_t prio, u8_t queue)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+
+	if ((prio >= XEMACPSIF_NUM_PRIO) || (queue >= xemacps_num_queues(xemacpsif))) {
+		return ERR_ARG;
+	}
+
+	xemacpsif->tx_prio_queue[prio] = queue;
+	return ERR_OK;
+}
+#endif
+
+/*
+ * xemacpsif_tx_batch():
+ *
+ * Opens (start != 0) or closes a TX batch on netif. While a batch is open,
+ * the frames sent are handed to the DMA but the transmitter is started only
+ * every XEMACPSIF_TX_BATCH_KICK frames and when the batch is closed, saving
+ * a register access per frame. Returns 0 when netif is not a GEM interface.
+ *
+ */
+
+s32_t xemacpsif_tx_batch(struct netif *netif, s32_t start)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+
+	if (netif->linkoutput != low_level_output) {
+		return 0;
+	}
+
+	emacps_tx_batch((xemacpsif_s *)(xemac->state), start);
+	return 1;
+}
+
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+/*
+ * xemacpsif_get_tx_timestamp():
+ *
+ * Returns the next sent frame that the MAC timestamped, with the timestamp
+ * in its ts_sec and ts_nsec fields, or NULL when there is none. The frame
+ * is the pbuf chain handed to the interface, the caller identifies it from
+ * its contents (e.g. the PTP sequence id) and must free it.
+ *
+ */
+
+struct pbuf *xemacpsif_get_tx_timestamp(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	struct pbuf *p = NULL;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	if (pq_qlength(xemacpsif->tx_ts_q) != 0) {
+		p = (struct pbuf *)pq_dequeue(xemacpsif->tx_ts_q);
+	}
+	SYS_ARCH_UNPROTECT(lev);
+	return p;
+}
+#endif
@@ -33,6 +33,9 @@
 #include "lwip/stats.h"
 #include "lwip/sys.h"
 #include "lwip/inet_chksum.h"
+#include "lwip/prot/ip.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/udp.h"
 
 #include "netif/xadapter.h"
 #include "netif/xemacpsif.h"
@@ -62,16 +65,32 @@
 #define INTC_DIST_BASE_ADDR	XPAR_SCUGIC_0_DIST_BASEADDR
 #endif
 
+#ifdef XEMACPSIF_PHY_INTR
+#ifndef XPAR_XGPIOPS_0_BASEADDR
+#error "XLWIP_CONFIG_PHY_INTR_GPIO_PIN needs the PS GPIO controller"
+#endif
+#include "xgpiops.h"
+
+extern u32_t phyaddrforemac;
+static XGpioPs phy_intr_gpio;
+#endif
+
 /* Byte alignment of BDs */
 #define BD_ALIGNMENT (XEMACPS_DMABD_MINIMUM_ALIGNMENT*2)
 
-/* A max of 4 different ethernet interfaces are supported */
-static UINTPTR tx_pbufs_storage[4*XLWIP_CONFIG_N_TX_DESC];
-static UINTPTR rx_pbufs_storage[4*XLWIP_CONFIG_N_RX_DESC];
+#if XEMACPSIF_RX_BDS_PER_FRAME > XLWIP_CONFIG_N_RX_DESC
+#error "A frame spans more RX buffers than there are RX descriptors"
+#endif
+
+/* A max of 4 different ethernet interfaces are supported, the storage of
+ * an interface holds the rings of all its queues one after the other
+ */
+static UINTPTR tx_pbufs_storage[4*XEMACPSIF_NUM_QUEUES*XLWIP_CONFIG_N_TX_DESC];
+static UINTPTR rx_pbufs_storage[4*XEMACPSIF_NUM_QUEUES*XLWIP_CONFIG_N_RX_DESC];
 
 static s32_t emac_intr_num;
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
-volatile u32_t notifyinfo[4*XLWIP_CONFIG_N_TX_DESC];
+volatile u32_t notifyinfo[4*XEMACPSIF_NUM_QUEUES*XLWIP_CONFIG_N_TX_DESC];
 #endif
 
 /******************************************************************************
@@ -130,6 +149,48 @@ extern u32 xInsideISR;
 #define XEMACPS_BD_TO_INDEX(ringptr, bdptr)				\
 	(((UINTPTR)bdptr - (UINTPTR)(ringptr)->BaseBdAddr) / (ringptr)->Separation)
 
+/*
+ * Creates a BD ring, of extended BDs which carry the frame timestamps when
+ * BD timestamping is enabled and the GEM supports it.
+ */
+static LONG create_bd_ring(xemacpsif_s *xemacpsif, XEmacPs_BdRing *ring,
+			UINTPTR bdspace, u32_t n_bds)
+{
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+	if (xemacpsif->emacps.Version > 2) {
+		return XEmacPs_BdRingCreateExt(ring, bdspace, bdspace,
+					BD_ALIGNMENT, n_bds);
+	}
+#else
+	LWIP_UNUSED_ARG(xemacpsif);
+#endif
+	return XEmacPs_BdRingCreate(ring, bdspace, bdspace, BD_ALIGNMENT, n_bds);
+}
+
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+/*
+ * Extends the low seconds bits of a BD timestamp with the upper bits of the
+ * TSU seconds, read once per batch of BDs after the hardware completed them.
+ * The timestamp predates the read, so a larger result means the low bits
+ * wrapped in between.
+ */
+static inline u32_t bd_ts_sec(u32_t tsu_sec, u32_t bd_sec)
+{
+	u32_t sec = (tsu_sec & ~(u32_t)XEMACPS_BD_TS_SEC_MASK) | bd_sec;
+
+	if (sec > tsu_sec) {
+		sec -= XEMACPS_BD_TS_SEC_MASK + 1;
+	}
+	return sec;
+}
+
+static inline u32_t read_tsu_sec(xemacpsif_s *xemacpsif)
+{
+	return XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress,
+				XEMACPS_1588_SEC_OFFSET);
+}
+#endif
+
 
 s32_t xemacps_is_tx_space_available(xemacpsif_s *emac)
 {
@@ -155,17 +216,17 @@ u32_t get_base_index_txpbufsstorage (xemacpsif_s *xemacpsif)
 #endif
 #ifdef XPAR_XEMACPS_1_BASEADDR
 	if (xemacpsif->emacps.Config.BaseAddress == XPAR_XEMACPS_1_BASEADDR) {
-		index = XLWIP_CONFIG_N_TX_DESC;
+		index = XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_TX_DESC;
 	}
 #endif
 #ifdef XPAR_XEMACPS_2_BASEADDR
 	if (xemacpsif->emacps.Config.BaseAddress == XPAR_XEMACPS_2_BASEADDR) {
-		index = 2 * XLWIP_CONFIG_N_TX_DESC;
+		index = 2 * XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_TX_DESC;
 	}
 #endif
 #ifdef XPAR_XEMACPS_3_BASEADDR
 	if (xemacpsif->emacps.Config.BaseAddress == XPAR_XEMACPS_3_BASEADDR) {
-		index = 3 * XLWIP_CONFIG_N_TX_DESC;
+		index = 3 * XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_TX_DESC;
 	}
 #endif
 	return index;
@@ -183,17 +244,17 @@ u32_t get_base_index_tasknotifyinfo (xemacpsif_s *xemacpsif)
 #endif
 #ifdef XPAR_XEMACPS_1_BASEADDR
 	if (xemacpsif->emacps.Config.BaseAddress == XPAR_XEMACPS_1_BASEADDR) {
-		index = XLWIP_CONFIG_N_TX_DESC;
+		index = XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_TX_DESC;
 	}
 #endif
 #ifdef XPAR_XEMACPS_2_BASEADDR
 	if (xemacpsif->emacps.Config.BaseAddress == XPAR_XEMACPS_2_BASEADDR) {
-		index = 2 * XLWIP_CONFIG_N_TX_DESC;
+		index = 2 * XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_TX_DESC;
 	}
 #endif
 #ifdef XPAR_XEMACPS_3_BASEADDR
 	if (xemacpsif->emacps.Config.BaseAddress == XPAR_XEMACPS_3_BASEADDR) {
-		index = 3 * XLWIP_CONFIG_N_TX_DESC;
+		index = 3 * XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_TX_DESC;
 	}
 #endif
 	return index;
@@ -211,23 +272,460 @@ u32_t get_base_index_rxpbufsstorage (xemacpsif_s *xemacpsif)
 #endif
 #ifdef XPAR_XEMACPS_1_BASEADDR
 	if (xemacpsif->emacps.Config.BaseAddress == XPAR_XEMACPS_1_BASEADDR) {
-		index = XLWIP_CONFIG_N_RX_DESC;
+		index = XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_RX_DESC;
 	}
 #endif
 #ifdef XPAR_XEMACPS_2_BASEADDR
 	if (xemacpsif->emacps.Config.BaseAddress == XPAR_XEMACPS_2_BASEADDR) {
-		index = 2 * XLWIP_CONFIG_N_RX_DESC;
+		index = 2 * XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_RX_DESC;
 	}
 #endif
 #ifdef XPAR_XEMACPS_3_BASEADDR
 	if (xemacpsif->emacps.Config.BaseAddress == XPAR_XEMACPS_3_BASEADDR) {
-		index = 3 * XLWIP_CONFIG_N_RX_DESC;
+		index = 3 * XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_RX_DESC;
 	}
 #endif
 	return index;
 }
 
-void xemacps_process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
+#ifdef XLWIP_CONFIG_EMACPS_RX_ZEROCOPY
+/******************************************************************************
+ * Zero-copy RX
+ *
+ * The RX BDs are refilled from a dedicated pool of custom pbufs per
+ * interface instead of the lwIP PBUF_POOL. The buffers are cache line
+ * aligned and the whole pool is invalidated once, when it is created.
+ * After that, only the bytes received in a buffer are invalidated: once
+ * after reception, for lines speculatively fetched while the hardware wrote
+ * the buffer, and once when the buffer is freed, for lines the stack or the
+ * application dirtied while they owned it. A buffer is never invalidated
+ * for its full size when it is posted.
+ *
+ * Freed pbufs are pushed on a lock-free list by their free callback, which
+ * can run in any thread or in the RX handler itself. The RX handler is the
+ * only consumer: it takes the whole list at once and serves refills from
+ * its private copy, so the list never sees the ABA problem.
+ *********************************************************************************/
+
+#if !LWIP_SUPPORT_CUSTOM_PBUF
+#error "Zero-copy RX needs LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+
+#if (XLWIP_CONFIG_EMACPS_RX_POOL_SIZE <= (XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_RX_DESC))
+#error "Zero-copy RX pool must be larger than the number of RX descriptors of all queues"
+#endif
+
+/* Largest cache line size of the processors with a GEM */
+#define RX_ZC_ALIGNMENT		64
+
+#define RX_ZC_BUF_SIZE		((XEMACPSIF_RX_BUF_SIZE + RX_ZC_ALIGNMENT - 1) & \
+				 ~(RX_ZC_ALIGNMENT - 1))
+
+/* Only pay for the interfaces present in the design */
+#if defined (XPAR_XEMACPS_3_BASEADDR)
+#define RX_ZC_NUM_POOLS		4
+#elif defined (XPAR_XEMACPS_2_BASEADDR)
+#define RX_ZC_NUM_POOLS		3
+#elif defined (XPAR_XEMACPS_1_BASEADDR)
+#define RX_ZC_NUM_POOLS		2
+#else
+#define RX_ZC_NUM_POOLS		1
+#endif
+
+struct rx_zc_pool;
+
+struct rx_zc_pbuf {
+	/* Must be first, the pbuf is cast back to this structure */
+	struct pbuf_custom pc;
+	struct rx_zc_pbuf *next;
+	struct rx_zc_pool *pool;
+	u8_t *buf;
+	u16_t rx_len;
+};
+
+struct rx_zc_pool {
+	/* Pushed by the free callback, taken by the RX handler */
+	struct rx_zc_pbuf *free_list;
+	/* Owned by the RX handler */
+	struct rx_zc_pbuf *cache;
+	u32_t is_cache_coherent;
+	u32_t initialized;
+};
+
+static u8_t rx_zc_bufs[RX_ZC_NUM_POOLS][XLWIP_CONFIG_EMACPS_RX_POOL_SIZE][RX_ZC_BUF_SIZE]
+	__attribute__ ((aligned (RX_ZC_ALIGNMENT)));
+static struct rx_zc_pbuf rx_zc_pbufs[RX_ZC_NUM_POOLS][XLWIP_CONFIG_EMACPS_RX_POOL_SIZE];
+static struct rx_zc_pool rx_zc_pools[RX_ZC_NUM_POOLS];
+
+static inline
+u32_t get_rx_zc_pool_index(xemacpsif_s *xemacpsif)
+{
+	return get_base_index_rxpbufsstorage(xemacpsif) /
+		(XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_RX_DESC);
+}
+
+static void rx_zc_pbuf_free(struct pbuf *p)
+{
+	struct rx_zc_pbuf *zp = (struct rx_zc_pbuf *)p;
+	struct rx_zc_pool *pool = zp->pool;
+	struct rx_zc_pbuf *head;
+
+	if (pool->is_cache_coherent == 0) {
+		Xil_DCacheInvalidateRange((UINTPTR)zp->buf, (UINTPTR)zp->rx_len);
+	}
+	zp->rx_len = 0;
+
+	head = __atomic_load_n(&pool->free_list, __ATOMIC_RELAXED);
+	do {
+		zp->next = head;
+	} while (!__atomic_compare_exchange_n(&pool->free_list, &head, zp, 1,
+					      __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+static void rx_zc_pool_init(xemacpsif_s *xemacpsif)
+{
+	u32_t pool_index = get_rx_zc_pool_index(xemacpsif);
+	struct rx_zc_pool *pool = &rx_zc_pools[pool_index];
+	struct rx_zc_pbuf *zp;
+	s32_t i;
+
+	/* Buffers held by the stack across a reset still belong to the pool */
+	if (pool->initialized) {
+		return;
+	}
+
+	pool->is_cache_coherent = xemacpsif->emacps.Config.IsCacheCoherent;
+	pool->free_list = NULL;
+	pool->cache = NULL;
+
+	for (i = XLWIP_CONFIG_EMACPS_RX_POOL_SIZE - 1; i >= 0; i--) {
+		zp = &rx_zc_pbufs[pool_index][i];
+		zp->pc.custom_free_function = rx_zc_pbuf_free;
+		zp->pool = pool;
+		zp->buf = rx_zc_bufs[pool_index][i];
+		zp->rx_len = 0;
+		zp->next = pool->cache;
+		pool->cache = zp;
+	}
+
+	if (pool->is_cache_coherent == 0) {
+		Xil_DCacheInvalidateRange((UINTPTR)rx_zc_bufs[pool_index],
+					  (UINTPTR)sizeof(rx_zc_bufs[pool_index]));
+	}
+	pool->initialized = 1;
+}
+
+static struct pbuf *rx_zc_pbuf_alloc(xemacpsif_s *xemacpsif)
+{
+	struct rx_zc_pool *pool = &rx_zc_pools[get_rx_zc_pool_index(xemacpsif)];
+	struct rx_zc_pbuf *zp;
+
+	zp = pool->cache;
+	if (zp == NULL) {
+		zp = __atomic_exchange_n(&pool->free_list, NULL, __ATOMIC_ACQUIRE);
+		if (zp == NULL) {
+			return NULL;
+		}
+	}
+	pool->cache = zp->next;
+
+	/* PBUF_REF keeps the stack from growing headers in front of the buffer */
+	return pbuf_alloced_custom(PBUF_RAW, XEMACPSIF_RX_BUF_SIZE, PBUF_REF, &zp->pc,
+				   zp->buf, RX_ZC_BUF_SIZE);
+}
+#endif
+
+u32_t xemacps_num_queues(xemacpsif_s *xemacpsif)
+{
+#if XEMACPSIF_NUM_QUEUES > 1
+	return xemacpsif->num_queues;
+#else
+	LWIP_UNUSED_ARG(xemacpsif);
+	return 1;
+#endif
+}
+
+XEmacPs_BdRing *xemacps_get_rxring(xemacpsif_s *xemacpsif, u32_t queue)
+{
+#if XEMACPSIF_NUM_QUEUES > 1
+	if (queue != 0) {
+		return &xemacpsif->rxq_ring[queue - 1];
+	}
+#else
+	LWIP_UNUSED_ARG(queue);
+#endif
+	return &XEmacPs_GetRxRing(&xemacpsif->emacps);
+}
+
+XEmacPs_BdRing *xemacps_get_txring(xemacpsif_s *xemacpsif, u32_t queue)
+{
+#if XEMACPSIF_NUM_QUEUES > 1
+	if (queue != 0) {
+		return &xemacpsif->txq_ring[queue - 1];
+	}
+#else
+	LWIP_UNUSED_ARG(queue);
+#endif
+	return &XEmacPs_GetTxRing(&xemacpsif->emacps);
+}
+
+static inline
+u32_t get_rxring_queue(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
+{
+#if XEMACPSIF_NUM_QUEUES > 1
+	if (rxring != &XEmacPs_GetRxRing(&xemacpsif->emacps)) {
+		return (rxring - xemacpsif->rxq_ring) + 1;
+	}
+#else
+	LWIP_UNUSED_ARG(xemacpsif);
+	LWIP_UNUSED_ARG(rxring);
+#endif
+	return 0;
+}
+
+static inline
+u32_t get_txring_queue(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
+{
+#if XEMACPSIF_NUM_QUEUES > 1
+	if (txring != &XEmacPs_GetTxRing(&xemacpsif->emacps)) {
+		return (txring - xemacpsif->txq_ring) + 1;
+	}
+#else
+	LWIP_UNUSED_ARG(xemacpsif);
+	LWIP_UNUSED_ARG(txring);
+#endif
+	return 0;
+}
+
+#if XEMACPSIF_NUM_QUEUES > 1
+/******************************************************************************
+ * Priority queues
+ *
+ * Queue 0 carries the bulk traffic and the highest queue the PTP and control
+ * traffic. lwIP pbufs have no priority, so the priority of a TX frame (0-7)
+ * is read from its headers: PTP and LLDP get 7, ARP 6, VLAN tagged frames
+ * their PCP and IP packets the class selector of their DSCP. PTP event and
+ * general messages over UDP get 7 as well. tx_prio_queue[] then maps the
+ * priority to a TX queue.
+ *
+ * RX frames are steered by the screeners of the GEM: PTP and ARP frames by
+ * the type 2 screeners 0 and 1, PTP over UDP by the type 1 screeners 0 and
+ * 1, all to the highest queue. The other screeners are left to the
+ * application. All queues share one interrupt and the RX handler drains
+ * the highest queue first.
+ *********************************************************************************/
+
+#define PTP_EVENT_PORT		319
+#define PTP_GENERAL_PORT	320
+
+/* Type 2 EtherType registers used by the adapter */
+#define SCREEN_ETHTYPE_PTP	0
+#define SCREEN_ETHTYPE_ARP	1
+
+static u8_t get_frame_prio(struct pbuf *p)
+{
+	u8_t *frame = (u8_t *)p->payload;
+	u8_t *iphdr;
+	u32_t iphlen;
+	u16_t port;
+
+	if (p->len < SIZEOF_ETH_HDR) {
+		return 0;
+	}
+
+	iphdr = frame + SIZEOF_ETH_HDR;
+	switch (lwip_htons(((struct eth_hdr *)frame)->type)) {
+	case ETHTYPE_VLAN:
+		if (p->len < (SIZEOF_ETH_HDR + SIZEOF_VLAN_HDR)) {
+			return 0;
+		}
+		return lwip_htons(((struct eth_vlan_hdr *)iphdr)->prio_vid) >> 13;
+	case ETHTYPE_PTP:
+	case ETHTYPE_LLDP:
+		return 7;
+	case ETHTYPE_ARP:
+		return 6;
+	case ETHTYPE_IP:
+		if (p->len < (SIZEOF_ETH_HDR + IP_HLEN)) {
+			return 0;
+		}
+		iphlen = (iphdr[0] & 0x0F) * 4;
+		/* Only the first fragment has the UDP header */
+		if ((iphdr[9] == IP_PROTO_UDP) &&
+				((iphdr[6] & 0x1F) == 0) && (iphdr[7] == 0) &&
+				(p->len >= (SIZEOF_ETH_HDR + iphlen + UDP_HLEN))) {
+			port = (iphdr[iphlen + 2] << 8) | iphdr[iphlen + 3];
+			if ((port == PTP_EVENT_PORT) || (port == PTP_GENERAL_PORT)) {
+				return 7;
+			}
+		}
+		return iphdr[1] >> 5;
+	case ETHTYPE_IPV6:
+		if (p->len < (SIZEOF_ETH_HDR + 1)) {
+			return 0;
+		}
+		return (iphdr[0] & 0x0F) >> 1;
+	default:
+		return 0;
+	}
+}
+
+static void init_queue_config(xemacpsif_s *xemacpsif)
+{
+	u32_t prio;
+
+	xemacpsif->num_queues = XEmacPs_GetNumQueues(&xemacpsif->emacps);
+	if (xemacpsif->num_queues > XEMACPSIF_NUM_QUEUES) {
+		xemacpsif->num_queues = XEMACPSIF_NUM_QUEUES;
+	}
+
+	/* Spread the priorities evenly over the queues */
+	for (prio = 0; prio < XEMACPSIF_NUM_PRIO; prio++) {
+		xemacpsif->tx_prio_queue[prio] =
+			(prio * xemacpsif->num_queues) / XEMACPSIF_NUM_PRIO;
+	}
+}
+
+static XStatus setup_rx_screeners(xemacpsif_s *xemacpsif)
+{
+	XEmacPs *emacps = &xemacpsif->emacps;
+	u32_t queue = xemacpsif->num_queues - 1;
+	LONG status;
+
+	status = XEmacPs_SetType2EtherType(emacps, ETHTYPE_PTP, SCREEN_ETHTYPE_PTP);
+	if (status == XST_SUCCESS) {
+		status = XEmacPs_SetType2EtherType(emacps, ETHTYPE_ARP, SCREEN_ETHTYPE_ARP);
+	}
+	if (status == XST_SUCCESS) {
+		status = XEmacPs_SetType2Screen(emacps, queue | XEMACPS_SCREENT2_ETHTEN_MASK |
+				(SCREEN_ETHTYPE_PTP << XEMACPS_SCREENT2_ETHT_SHIFT), 0);
+	}
+	if (status == XST_SUCCESS) {
+		status = XEmacPs_SetType2Screen(emacps, queue | XEMACPS_SCREENT2_ETHTEN_MASK |
+				(SCREEN_ETHTYPE_ARP << XEMACPS_SCREENT2_ETHT_SHIFT), 1);
+	}
+	if (status == XST_SUCCESS) {
+		status = XEmacPs_SetType1Screen(emacps, queue | XEMACPS_SCREENT1_UDPEN_MASK |
+				(PTP_EVENT_PORT << XEMACPS_SCREENT1_UDP_SHIFT), 0);
+	}
+	if (status == XST_SUCCESS) {
+		status = XEmacPs_SetType1Screen(emacps, queue | XEMACPS_SCREENT1_UDPEN_MASK |
+				(PTP_GENERAL_PORT << XEMACPS_SCREENT1_UDP_SHIFT), 1);
+	}
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Error setting up RX screeners\r\n"));
+		return ERR_IF;
+	}
+	return XST_SUCCESS;
+}
+
+/*
+ * Set up the BD rings of the queues 1 to num_queues - 1. Their BDs follow
+ * those of queue 0 in the same BD space. TX queue n is given to hardware
+ * queue n, so the TX ring of queue 0 moves from hardware queue 1 to 0.
+ * Hardware queues without a ring stay parked on the terminate BDs.
+ */
+static XStatus init_dma_queues(xemacpsif_s *xemacpsif,
+		XEmacPs_Bd *bdrxterminate, XEmacPs_Bd *bdtxterminate)
+{
+	XEmacPs_Bd bdtemplate;
+	XEmacPs_BdRing *rxringptr, *txringptr;
+	XEmacPs_BdRing *ring;
+	UINTPTR bdspace;
+	XStatus status;
+	u32_t queue;
+
+	rxringptr = &XEmacPs_GetRxRing(&xemacpsif->emacps);
+	txringptr = &XEmacPs_GetTxRing(&xemacpsif->emacps);
+
+	if (((xemacpsif->num_queues * rxringptr->Length) > 0x10000) ||
+			((xemacpsif->num_queues * txringptr->Length) > 0x10000)) {
+		xil_printf("%s@%d: Error: BD rings of %d queues do not fit in the BD space\r\n",
+				__FILE__, __LINE__, xemacpsif->num_queues);
+		return ERR_IF;
+	}
+
+	for (queue = 1; queue < xemacpsif->num_queues; queue++) {
+		ring = xemacps_get_rxring(xemacpsif, queue);
+		bdspace = (UINTPTR)xemacpsif->rx_bdspace + (queue * rxringptr->Length);
+		XEmacPs_BdClear(&bdtemplate);
+		status = create_bd_ring(xemacpsif, ring, bdspace,
+					XLWIP_CONFIG_N_RX_DESC);
+		if (status == XST_SUCCESS) {
+			status = XEmacPs_BdRingClone(ring, &bdtemplate, XEMACPS_RECV);
+		}
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Error setting up RxBD space of queue %d\r\n", queue));
+			return ERR_IF;
+		}
+		setup_rx_bds(xemacpsif, ring);
+		if (XEmacPs_BdRingGetFreeCnt(ring) != 0) {
+			return ERR_IF;
+		}
+		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), ring->BaseBdAddr, queue, XEMACPS_RECV);
+
+		ring = xemacps_get_txring(xemacpsif, queue);
+		bdspace = (UINTPTR)xemacpsif->tx_bdspace + (queue * txringptr->Length);
+		XEmacPs_BdClear(&bdtemplate);
+		XEmacPs_BdSetStatus(&bdtemplate, XEMACPS_TXBUF_USED_MASK);
+		status = create_bd_ring(xemacpsif, ring, bdspace,
+					XLWIP_CONFIG_N_TX_DESC);
+		if (status == XST_SUCCESS) {
+			status = XEmacPs_BdRingClone(ring, &bdtemplate, XEMACPS_SEND);
+		}
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Error setting up TxBD space of queue %d\r\n", queue));
+			return ERR_IF;
+		}
+		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), ring->BaseBdAddr, queue, XEMACPS_SEND);
+	}
+	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), txringptr->BaseBdAddr, 0, XEMACPS_SEND);
+
+	for (; queue < XEmacPs_GetNumQueues(&xemacpsif->emacps); queue++) {
+		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), (UINTPTR)bdrxterminate, queue, XEMACPS_RECV);
+		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), (UINTPTR)bdtxterminate, queue, XEMACPS_SEND);
+	}
+
+	return setup_rx_screeners(xemacpsif);
+}
+#endif
+
+XEmacPs_BdRing *xemacps_select_txring(xemacpsif_s *xemacpsif, struct pbuf *p)
+{
+#if XEMACPSIF_NUM_QUEUES > 1
+	u32_t queue;
+
+	if (xemacpsif->num_queues > 1) {
+		queue = xemacpsif->tx_prio_queue[get_frame_prio(p)];
+		return xemacps_get_txring(xemacpsif, queue);
+	}
+#else
+	LWIP_UNUSED_ARG(p);
+#endif
+	return &XEmacPs_GetTxRing(&xemacpsif->emacps);
+}
+
+static inline void release_sent_pbuf(struct pbuf *p, struct pbuf **pbufs,
+			s32_t *n_pbufs)
+{
+	if (p != NULL) {
+		if (pbufs != NULL) {
+			pbufs[(*n_pbufs)++] = p;
+		} else {
+			pbuf_free(p);
+		}
+	}
+}
+
+/*
+ * Takes up to max_bds completed BDs of txring back from the hardware. The
+ * pbufs they held are freed, or stored in pbufs when it is not NULL, with
+ * their number in *n_pbufs. Returns the number of BDs taken back.
+ * With BD timestamping, a timestamped frame keeps the reference on its
+ * first pbuf, which goes to the TX timestamp queue instead.
+ */
+static s32_t reclaim_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring,
+			s32_t max_bds, struct pbuf **pbufs, s32_t *n_pbufs)
 {
 	XEmacPs_Bd *txbdset;
 	XEmacPs_Bd *curbdpntr;
@@ -241,75 +739,303 @@ void xemacps_process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 	u32_t tx_task_notifier_index;
 #endif
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+	struct pbuf *frame_p = NULL;
+	u32_t frame_start = 1;
+	u32_t tsu_read = 0;
+	u32_t tsu_sec = 0;
+	u32_t ts_valid = 0;
+	u32_t ts_sec = 0;
+	u32_t ts_nsec = 0;
+	u32_t last;
+#endif
 
-	index = get_base_index_txpbufsstorage (xemacpsif);
+	index = get_base_index_txpbufsstorage (xemacpsif) +
+		(get_txring_queue(xemacpsif, txring) * XLWIP_CONFIG_N_TX_DESC);
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
-	tx_task_notifier_index = get_base_index_tasknotifyinfo (xemacpsif);
+	tx_task_notifier_index = get_base_index_tasknotifyinfo (xemacpsif) +
+		(get_txring_queue(xemacpsif, txring) * XLWIP_CONFIG_N_TX_DESC);
 #endif
 
-	while (1) {
-		/* obtain processed BD's */
-		n_bds = XEmacPs_BdRingFromHwTx(txring,
-								XLWIP_CONFIG_N_TX_DESC, &txbdset);
-		if (n_bds == 0)  {
-			return;
-		}
-		/* free the processed BD's */
-		n_pbufs_freed = n_bds;
-		curbdpntr = txbdset;
-		while (n_pbufs_freed > 0) {
-			bdindex = XEMACPS_BD_TO_INDEX(txring, curbdpntr);
-			temp = (u32 *)curbdpntr;
-			*temp = 0;
-			temp++;
-			if (bdindex == (XLWIP_CONFIG_N_TX_DESC - 1)) {
-				*temp = 0xC0000000;
-			} else {
-				*temp = 0x80000000;
+	/* obtain processed BD's */
+	n_bds = XEmacPs_BdRingFromHwTx(txring, max_bds, &txbdset);
+	if (n_bds == 0)  {
+		return 0;
+	}
+	/* free the processed BD's */
+	n_pbufs_freed = n_bds;
+	curbdpntr = txbdset;
+	while (n_pbufs_freed > 0) {
+		bdindex = XEMACPS_BD_TO_INDEX(txring, curbdpntr);
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+		/*
+		 * the MAC writes the timestamp back to the first BD of the
+		 * frame, with its used bit; the frame ends at its last BD
+		 */
+		last = XEmacPs_BdRead(curbdpntr, XEMACPS_BD_STAT_OFFSET) &
+			XEMACPS_TXBUF_LAST_MASK;
+		if ((txring->Separation != sizeof(XEmacPs_Bd)) &&
+				(frame_start != 0) &&
+				XEmacPs_BdIsTxTsValid(curbdpntr)) {
+			if (tsu_read == 0) {
+				tsu_sec = read_tsu_sec(xemacpsif);
+				tsu_read = 1;
 			}
-			dsb();
-			p = (struct pbuf *)tx_pbufs_storage[index + bdindex];
-			if (p != NULL) {
-				pbuf_free(p);
+			ts_sec = bd_ts_sec(tsu_sec, XEmacPs_BdGetTsSec(curbdpntr));
+			ts_nsec = XEmacPs_BdGetTsNanoSec(curbdpntr);
+			ts_valid = 1;
+		}
+#endif
+		temp = (u32 *)curbdpntr;
+		*temp = 0;
+		temp++;
+		if (bdindex == (XLWIP_CONFIG_N_TX_DESC - 1)) {
+			*temp = 0xC0000000;
+		} else {
+			*temp = 0x80000000;
+		}
+		dsb();
+		p = (struct pbuf *)tx_pbufs_storage[index + bdindex];
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+		if (frame_start != 0) {
+			/* the chain of the frame, released with its last BD */
+			frame_p = p;
+			p = NULL;
+			frame_start = 0;
+		}
+		release_sent_pbuf(p, pbufs, n_pbufs);
+		if (last != 0) {
+			if ((ts_valid != 0) && (frame_p != NULL)) {
+				frame_p->ts_sec = ts_sec;
+				frame_p->ts_nsec = ts_nsec;
+				if (pq_enqueue(xemacpsif->tx_ts_q, (void *)frame_p) == 0) {
+					frame_p = NULL;
+				}
 			}
+			release_sent_pbuf(frame_p, pbufs, n_pbufs);
+			frame_p = NULL;
+			frame_start = 1;
+			ts_valid = 0;
+		}
+#else
+		release_sent_pbuf(p, pbufs, n_pbufs);
+#endif
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
-			notifyinfo[tx_task_notifier_index + bdindex] = 0;
+		notifyinfo[tx_task_notifier_index + bdindex] = 0;
 #endif
-			tx_pbufs_storage[index + bdindex] = 0;
-			curbdpntr = XEmacPs_BdRingNext(txring, curbdpntr);
-			n_pbufs_freed--;
-			dsb();
-		}
+		tx_pbufs_storage[index + bdindex] = 0;
+		curbdpntr = XEmacPs_BdRingNext(txring, curbdpntr);
+		n_pbufs_freed--;
+		dsb();
+	}
 
-		status = XEmacPs_BdRingFree(txring, n_bds, txbdset);
-		if (status != XST_SUCCESS) {
-			LWIP_DEBUGF(NETIF_DEBUG, ("Failure while freeing in Tx Done ISR\r\n"));
-		}
+	status = XEmacPs_BdRingFree(txring, n_bds, txbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Failure while freeing in Tx Done ISR\r\n"));
+	}
+	return n_bds;
+}
+
+void xemacps_process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
+{
+	while (reclaim_sent_bds(xemacpsif, txring, XLWIP_CONFIG_N_TX_DESC,
+							NULL, NULL) != 0) {
 	}
 	return;
 }
 
+#ifdef XLWIP_CONFIG_TX_DEFERRED_RECLAIM
+/*
+ * xemacps_tx_reclaim: called from the send and receive paths, never from the
+ * TX interrupt. Takes the completed BDs of every TX ring with fewer than
+ * min_free free BDs back from the hardware, XLWIP_TX_RECLAIM_BATCH at a
+ * time, and frees their pbufs in bulk outside the protected section.
+ */
+void xemacps_tx_reclaim(xemacpsif_s *xemacpsif, s32_t min_free)
+{
+	struct pbuf *pbufs[XLWIP_TX_RECLAIM_BATCH];
+	XEmacPs_BdRing *txring;
+	s32_t n_bds, n_pbufs, i;
+	u32_t queue;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	for (queue = 0; queue < xemacps_num_queues(xemacpsif); queue++) {
+		txring = xemacps_get_txring(xemacpsif, queue);
+		if ((s32_t)XEmacPs_BdRingGetFreeCnt(txring) >= min_free) {
+			continue;
+		}
+		do {
+			n_pbufs = 0;
+			SYS_ARCH_PROTECT(lev);
+			n_bds = reclaim_sent_bds(xemacpsif, txring,
+					XLWIP_TX_RECLAIM_BATCH, pbufs, &n_pbufs);
+			SYS_ARCH_UNPROTECT(lev);
+			for (i = 0; i < n_pbufs; i++) {
+				pbuf_free(pbufs[i]);
+			}
+		} while (n_bds == XLWIP_TX_RECLAIM_BATCH);
+	}
+}
+#endif
+
 void emacps_send_handler(void *arg)
 {
 	struct xemac_s *xemac;
 	xemacpsif_s   *xemacpsif;
-	XEmacPs_BdRing *txringptr;
 	u32_t regval;
+	u32_t queue;
 #if !NO_SYS
 	xInsideISR++;
 #endif
 	xemac = (struct xemac_s *)(arg);
 	xemacpsif = (xemacpsif_s *)(xemac->state);
-	txringptr = &(XEmacPs_GetTxRing(&xemacpsif->emacps));
 	regval = XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_TXSR_OFFSET);
 	XEmacPs_WriteReg(xemacpsif->emacps.Config.BaseAddress,XEMACPS_TXSR_OFFSET, regval);
 
+#ifdef XLWIP_CONFIG_TX_DEFERRED_RECLAIM
+	/* The send path takes completed BDs back, mask the TX complete
+	 * interrupts until the MAC is started again.
+	 */
+	XEmacPs_IntDisable(&xemacpsif->emacps, XEMACPS_IXR_TXCOMPL_MASK);
+	for (queue = 1; queue < xemacps_num_queues(xemacpsif); queue++) {
+		XEmacPs_IntQDisable(&xemacpsif->emacps, queue,
+					XEMACPS_INTQ1SR_TXCOMPL_MASK);
+	}
+#else
 	/* If Transmit done interrupt is asserted, process completed BD's */
-	xemacps_process_sent_bds(xemacpsif, txringptr);
+	for (queue = 0; queue < xemacps_num_queues(xemacpsif); queue++) {
+		xemacps_process_sent_bds(xemacpsif, xemacps_get_txring(xemacpsif, queue));
+	}
+#endif
 #if !NO_SYS
 	xInsideISR--;
 #endif
 }
+
+/*
+ * Starts the transmitter on the BDs just handed to the hardware. Inside a TX
+ * batch only every XEMACPSIF_TX_BATCH_KICK frames do, or now is set, the
+ * batch end starts it for the rest. Called with the TX path protected.
+ */
+static void emacps_start_tx(xemacpsif_s *xemacpsif, u32_t now)
+{
+	if ((xemacpsif->tx_batch != 0) && (now == 0) &&
+		(++xemacpsif->tx_batch_frames < XEMACPSIF_TX_BATCH_KICK)) {
+		return;
+	}
+	xemacpsif->tx_batch_frames = 0;
+
+	XEmacPs_WriteReg((xemacpsif->emacps).Config.BaseAddress,
+	XEMACPS_NWCTRL_OFFSET,
+	(XEmacPs_ReadReg((xemacpsif->emacps).Config.BaseAddress,
+	XEMACPS_NWCTRL_OFFSET) | XEMACPS_NWCTRL_STARTTX_MASK));
+}
+
+/*
+ * Opens (start != 0) or closes a TX batch. Batches nest, closing the
+ * outermost one starts the transmitter on the frames still held back.
+ */
+void emacps_tx_batch(xemacpsif_s *xemacpsif, s32_t start)
+{
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	if (start != 0) {
+		xemacpsif->tx_batch++;
+	} else if (xemacpsif->tx_batch != 0) {
+		xemacpsif->tx_batch--;
+		if ((xemacpsif->tx_batch == 0) &&
+			(xemacpsif->tx_batch_frames != 0)) {
+			emacps_start_tx(xemacpsif, 1);
+		}
+	}
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+#if LWIP_TCP_LSO
+/*
+ * Sends a large TCP segment as a train of frames. Each frame starts with a BD
+ * pointing at a copy of the segment headers patched for that frame, followed
+ * by BDs pointing straight into the payload of the original pbufs. The MAC
+ * inserts the IP and TCP checksums of every frame.
+ */
+static XStatus emacps_lso_sgsend(xemacpsif_s *xemacpsif,
+		XEmacPs_BdRing *txring, u32_t index, struct xlso *lso)
+{
+	XEmacPs_Bd *txbdset, *txbd;
+	XStatus status;
+	struct pbuf *q;
+	void *data;
+	u8_t *hdr;
+	u32_t bdindex;
+	u32_t hdr_index;
+	u16_t frame, left, len;
+	s32_t i;
+
+	if (XEmacPs_BdRingGetFreeCnt(txring) < lso->nbds) {
+		xemacps_process_sent_bds(xemacpsif, txring);
+	}
+
+	status = XEmacPs_BdRingAlloc(txring, lso->nbds, &txbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error allocating TxBD\r\n"));
+		return XST_FAILURE;
+	}
+
+	hdr_index = get_txring_queue(xemacpsif, txring) * XLWIP_CONFIG_N_TX_DESC;
+	txbd = txbdset;
+	for (frame = 0; frame < lso->nframes; frame++) {
+		bdindex = XEMACPS_BD_TO_INDEX(txring, txbd);
+		hdr = xemacpsif->lso_hdrspace +
+				((hdr_index + bdindex) * XLSO_HDR_SIZE);
+		left = xlso_build_hdr(lso, frame, hdr);
+		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
+			Xil_DCacheFlushRange((UINTPTR)hdr, (UINTPTR)lso->hdr_len);
+		}
+		XEmacPs_BdSetAddressTx(txbd, (UINTPTR)hdr);
+		XEmacPs_BdSetLength(txbd, lso->hdr_len & 0x3FFF);
+		XEmacPs_BdClearLast(txbd);
+		tx_pbufs_storage[index + bdindex] = 0;
+
+		while (left != 0) {
+			txbd = XEmacPs_BdRingNext(txring, txbd);
+			bdindex = XEMACPS_BD_TO_INDEX(txring, txbd);
+			q = xlso_next_data(lso, &left, &data, &len);
+			if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
+				Xil_DCacheFlushRange((UINTPTR)data, (UINTPTR)len);
+			}
+			XEmacPs_BdSetAddressTx(txbd, (UINTPTR)data);
+			XEmacPs_BdSetLength(txbd, len & 0x3FFF);
+			tx_pbufs_storage[index + bdindex] = (UINTPTR)q;
+			pbuf_ref(q);
+			if (left == 0) {
+				XEmacPs_BdSetLast(txbd);
+			} else {
+				XEmacPs_BdClearLast(txbd);
+			}
+		}
+		txbd = XEmacPs_BdRingNext(txring, txbd);
+	}
+
+	/* hand the first BD to the hardware only after all the others */
+	txbd = XEmacPs_BdRingNext(txring, txbdset);
+	for (i = 1; i < lso->nbds; i++) {
+		XEmacPs_BdClearTxUsed(txbd);
+		txbd = XEmacPs_BdRingNext(txring, txbd);
+	}
+	XEmacPs_BdClearTxUsed(txbdset);
+	dsb();
+
+	status = XEmacPs_BdRingToHw(txring, lso->nbds, txbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error submitting TxBD\r\n"));
+		return XST_FAILURE;
+	}
+	emacps_start_tx(xemacpsif, 0);
+	return status;
+}
+#endif
+
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p,
 					u32_t block_till_tx_complete, u32_t *to_block_index)
@@ -329,12 +1055,22 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 	u32_t tx_task_notifier_index;
 #endif
+#if LWIP_TCP_LSO
+	struct xlso lso;
+#endif
 
-	txring = &(XEmacPs_GetTxRing(&xemacpsif->emacps));
+	txring = xemacps_select_txring(xemacpsif, p);
 
-	index = get_base_index_txpbufsstorage (xemacpsif);
+	index = get_base_index_txpbufsstorage (xemacpsif) +
+		(get_txring_queue(xemacpsif, txring) * XLWIP_CONFIG_N_TX_DESC);
+#if LWIP_TCP_LSO
+	if (xlso_init(&lso, p) == ERR_OK) {
+		return emacps_lso_sgsend(xemacpsif, txring, index, &lso);
+	}
+#endif
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
-	tx_task_notifier_index = get_base_index_tasknotifyinfo (xemacpsif);
+	tx_task_notifier_index = get_base_index_tasknotifyinfo (xemacpsif) +
+		(get_txring_queue(xemacpsif, txring) * XLWIP_CONFIG_N_TX_DESC);
 #endif
 
 	/* first count the number of pbufs */
@@ -408,11 +1144,12 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error submitting TxBD\r\n"));
 		return XST_FAILURE;
 	}
-	/* Start transmit */
-	XEmacPs_WriteReg((xemacpsif->emacps).Config.BaseAddress,
-	XEMACPS_NWCTRL_OFFSET,
-	(XEmacPs_ReadReg((xemacpsif->emacps).Config.BaseAddress,
-	XEMACPS_NWCTRL_OFFSET) | XEMACPS_NWCTRL_STARTTX_MASK));
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+	/* a blocking send waits for its frame, do not hold it back */
+	emacps_start_tx(xemacpsif, block_till_tx_complete);
+#else
+	emacps_start_tx(xemacpsif, 0);
+#endif
 	return status;
 }
 
@@ -426,15 +1163,16 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 	u32 *temp;
 	u32_t index;
 
-	index = get_base_index_rxpbufsstorage (xemacpsif);
+	index = get_base_index_rxpbufsstorage (xemacpsif) +
+		(get_rxring_queue(xemacpsif, rxring) * XLWIP_CONFIG_N_RX_DESC);
 
 	freebds = XEmacPs_BdRingGetFreeCnt (rxring);
 	while (freebds > 0) {
 		freebds--;
-#ifdef ZYNQMP_USE_JUMBO
-		p = pbuf_alloc(PBUF_RAW, MAX_FRAME_SIZE_JUMBO, PBUF_POOL);
+#ifdef XLWIP_CONFIG_EMACPS_RX_ZEROCOPY
+		p = rx_zc_pbuf_alloc(xemacpsif);
 #else
-		p = pbuf_alloc(PBUF_RAW, XEMACPS_MAX_FRAME_SIZE, PBUF_POOL);
+		p = pbuf_alloc(PBUF_RAW, XEMACPSIF_RX_BUF_SIZE, PBUF_POOL);
 #endif
 		if (!p) {
 #if LINK_STATS
@@ -464,13 +1202,11 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 			XEmacPs_BdRingUnAlloc(rxring, 1, rxbd);
 			return;
 		}
-#ifdef ZYNQMP_USE_JUMBO
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)MAX_FRAME_SIZE_JUMBO);
-		}
+#ifdef XLWIP_CONFIG_EMACPS_RX_ZEROCOPY
+		/* Pool buffers are invalidated when they are freed */
 #else
 		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)XEMACPS_MAX_FRAME_SIZE);
+			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)XEMACPSIF_RX_BUF_SIZE);
 		}
 #endif
 		bdindex = XEMACPS_BD_TO_INDEX(rxring, rxbd);
@@ -496,46 +1232,68 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 	}
 }
 
-void emacps_recv_handler(void *arg)
+/*
+ * Moves up to budget received frames of the given queue to the receive queue
+ * and gives their BDs back to the hardware. Returns the number of frames.
+ * With RX chaining, the BDs of a frame, all full but the last one, are
+ * assembled into a pbuf chain. XEmacPs_BdRingFromHwRx() only returns whole
+ * frames.
+ */
+#if LWIP_CHECKSUM_CHECK_PER_PBUF
+/* pbuf flags of the checksums verified by the MAC for the frame ending at rxbd */
+static inline u8_t emacps_rx_csum_flags(XEmacPs_Bd *rxbd)
+{
+	switch (XEmacPs_BdRead(rxbd, XEMACPS_BD_STAT_OFFSET) &
+			XEMACPSIF_RXBUF_CSUM_MASK) {
+	case XEMACPSIF_RXBUF_CSUM_TCP:
+	case XEMACPSIF_RXBUF_CSUM_UDP:
+		return PBUF_FLAG_CHKSUM_IP_OK | PBUF_FLAG_CHKSUM_L4_OK;
+	case XEMACPSIF_RXBUF_CSUM_IP:
+		return PBUF_FLAG_CHKSUM_IP_OK;
+	default:
+		return 0;
+	}
+}
+#endif
+
+static s32_t process_rx_bds(xemacpsif_s *xemacpsif, u32_t queue, s32_t budget)
 {
 	struct pbuf *p;
 	XEmacPs_Bd *rxbdset, *curbdptr;
-	struct xemac_s *xemac;
-	xemacpsif_s *xemacpsif;
 	XEmacPs_BdRing *rxring;
 	volatile s32_t bd_processed;
 	s32_t rx_bytes, k;
+	s32_t n_frames = 0;
 	u32_t bdindex;
-	u32_t regval;
 	u32_t index;
-	u32_t gigeversion;
-
-	xemac = (struct xemac_s *)(arg);
-	xemacpsif = (xemacpsif_s *)(xemac->state);
-	rxring = &XEmacPs_GetRxRing(&xemacpsif->emacps);
-
-#if !NO_SYS
-	xInsideISR++;
+#ifdef XEMACPSIF_RX_CHAIN
+	struct pbuf *frame = NULL;
+	s32_t frame_len = 0;
+#endif
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+	u32_t tsu_read;
+	u32_t tsu_sec = 0;
+#endif
+#if LWIP_CHECKSUM_CHECK_PER_PBUF
+	u32_t rx_csum = XEmacPs_IsRxCsum(&xemacpsif->emacps);
 #endif
 
-	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
-	index = get_base_index_rxpbufsstorage (xemacpsif);
-	/*
-	 * If Reception done interrupt is asserted, call RX call back function
-	 * to handle the processed BDs and then raise the according flag.
-	 */
-	regval = XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET);
-	XEmacPs_WriteReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET, regval);
-	if (gigeversion <= 2) {
-			resetrx_on_no_rxdata(xemacpsif);
-	}
+	rxring = xemacps_get_rxring(xemacpsif, queue);
+	index = get_base_index_rxpbufsstorage (xemacpsif) +
+		(queue * XLWIP_CONFIG_N_RX_DESC);
 
-	while(1) {
+	while (n_frames < budget) {
 
-		bd_processed = XEmacPs_BdRingFromHwRx(rxring, XLWIP_CONFIG_N_RX_DESC, &rxbdset);
+		bd_processed = XEmacPs_BdRingFromHwRx(rxring,
+				LWIP_MIN(LWIP_MIN(budget - n_frames, XLWIP_CONFIG_N_RX_DESC) *
+					XEMACPSIF_RX_BDS_PER_FRAME, XLWIP_CONFIG_N_RX_DESC),
+				&rxbdset);
 		if (bd_processed <= 0) {
 			break;
 		}
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+		tsu_read = 0;
+#endif
 
 		for (k = 0, curbdptr=rxbdset; k < bd_processed; k++) {
 
@@ -545,7 +1303,15 @@ void emacps_recv_handler(void *arg)
 			/*
 			 * Adjust the buffer size to the actual number of bytes received.
 			 */
-#ifdef ZYNQMP_USE_JUMBO
+#ifdef XEMACPSIF_RX_CHAIN
+			if (XEmacPs_BdIsRxEOF(curbdptr)) {
+				rx_bytes = XEmacPs_GetRxFrameSize(&xemacpsif->emacps, curbdptr) -
+					frame_len;
+			} else {
+				rx_bytes = XEMACPSIF_RX_BUF_SIZE;
+			}
+			frame_len += rx_bytes;
+#elif defined (ZYNQMP_USE_JUMBO)
 			rx_bytes = XEmacPs_GetRxFrameSize(&xemacpsif->emacps, curbdptr);
 #else
 			rx_bytes = XEmacPs_BdGetLength(curbdptr);
@@ -558,16 +1324,67 @@ void emacps_recv_handler(void *arg)
 			if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
 				Xil_DCacheInvalidateRange((UINTPTR)p->payload, rx_bytes);
 			}
+#ifdef XLWIP_CONFIG_EMACPS_RX_ZEROCOPY
+			((struct rx_zc_pbuf *)p)->rx_len = rx_bytes;
+#endif
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+			if ((rxring->Separation != sizeof(XEmacPs_Bd)) &&
+					XEmacPs_BdIsRxTsValid(curbdptr)) {
+				if (tsu_read == 0) {
+					tsu_sec = read_tsu_sec(xemacpsif);
+					tsu_read = 1;
+				}
+				p->ts_sec = bd_ts_sec(tsu_sec, XEmacPs_BdGetTsSec(curbdptr));
+				p->ts_nsec = XEmacPs_BdGetTsNanoSec(curbdptr);
+			} else {
+				p->ts_sec = 0;
+				p->ts_nsec = 0;
+			}
+#endif
+#ifdef XEMACPSIF_RX_CHAIN
+			if (frame != NULL) {
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+				if ((frame->ts_sec == 0) && (frame->ts_nsec == 0)) {
+					frame->ts_sec = p->ts_sec;
+					frame->ts_nsec = p->ts_nsec;
+				}
+#endif
+				pbuf_cat(frame, p);
+				p = frame;
+			}
+			if (XEmacPs_BdIsRxEOF(curbdptr)) {
+				frame = NULL;
+				frame_len = 0;
+			} else {
+				frame = p;
+				p = NULL;
+			}
+#endif
+
+#if LWIP_CHECKSUM_CHECK_PER_PBUF
+			/* tell lwIP which checksums the MAC has verified, the
+			 * status is in the last BD of the frame
+			 */
+			if (p != NULL) {
+				p->flags &= ~(PBUF_FLAG_CHKSUM_IP_OK | PBUF_FLAG_CHKSUM_L4_OK);
+				if (rx_csum) {
+					p->flags |= emacps_rx_csum_flags(curbdptr);
+				}
+			}
+#endif
 
 			/* store it in the receive queue,
 			 * where it'll be processed by a different handler
 			 */
-			if (pq_enqueue(xemacpsif->recv_q, (void*)p) < 0) {
+			if (p != NULL) {
+				if (pq_enqueue(xemacpsif->recv_q, (void*)p) < 0) {
 #if LINK_STATS
-				lwip_stats.link.memerr++;
-				lwip_stats.link.drop++;
+					lwip_stats.link.memerr++;
+					lwip_stats.link.drop++;
 #endif
-				pbuf_free(p);
+					pbuf_free(p);
+				}
+				n_frames++;
 			}
 			curbdptr = XEmacPs_BdRingNext( rxring, curbdptr);
 		}
@@ -575,8 +1392,132 @@ void emacps_recv_handler(void *arg)
 		XEmacPs_BdRingFree(rxring, bd_processed, rxbdset);
 		setup_rx_bds(xemacpsif, rxring);
 	}
+
+	return n_frames;
+}
+
+#ifdef XEMACPSIF_RX_POLL_BUDGET
+static void rx_intr_disable(xemacpsif_s *xemacpsif)
+{
+	u32_t queue;
+
+	XEmacPs_IntDisable(&xemacpsif->emacps, XEMACPS_IXR_FRAMERX_MASK);
+	for (queue = 1; queue < xemacps_num_queues(xemacpsif); queue++) {
+		XEmacPs_IntQDisable(&xemacpsif->emacps, queue,
+					XEMACPS_INTQ1SR_RXCOMPL_MASK);
+	}
+}
+
+static void rx_intr_enable(xemacpsif_s *xemacpsif)
+{
+	u32_t queue;
+
+	XEmacPs_IntEnable(&xemacpsif->emacps, XEMACPS_IXR_FRAMERX_MASK);
+	for (queue = 1; queue < xemacps_num_queues(xemacpsif); queue++) {
+		XEmacPs_IntQEnable(&xemacpsif->emacps, queue,
+					XEMACPS_INTQ1SR_RXCOMPL_MASK);
+	}
+}
+
+/*
+ * xemacps_rx_poll: called by the input thread in poll mode, while the RX
+ * interrupts are masked. Moves up to budget received frames, highest priority
+ * queue first, to the receive queue and returns their number.
+ */
+s32_t xemacps_rx_poll(xemacpsif_s *xemacpsif, s32_t budget)
+{
+	s32_t n_frames = 0;
+	u32_t queue;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	/* the error handler refills the rings from interrupt context */
+	SYS_ARCH_PROTECT(lev);
+	for (queue = xemacps_num_queues(xemacpsif);
+				(queue-- > 0) && (n_frames < budget); ) {
+		n_frames += process_rx_bds(xemacpsif, queue, budget - n_frames);
+	}
+	SYS_ARCH_UNPROTECT(lev);
+
+	return n_frames;
+}
+
+/*
+ * xemacps_rx_poll_done: leaves poll mode and enables the RX interrupts again.
+ * Returns 0, staying in poll mode, if a frame came in before the interrupts
+ * were back on.
+ */
+s32_t xemacps_rx_poll_done(xemacpsif_s *xemacpsif)
+{
+	XEmacPs_BdRing *rxring;
+	s32_t status = 1;
+	u32_t queue;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	xemacpsif->rx_polling = 0;
+	rx_intr_enable(xemacpsif);
+	for (queue = 0; queue < xemacps_num_queues(xemacpsif); queue++) {
+		rxring = xemacps_get_rxring(xemacpsif, queue);
+		if ((rxring->HwCnt != 0) && XEmacPs_BdIsRxNew(rxring->HwHead)) {
+			rx_intr_disable(xemacpsif);
+			xemacpsif->rx_polling = 1;
+			status = 0;
+			break;
+		}
+	}
+	SYS_ARCH_UNPROTECT(lev);
+
+	return status;
+}
+#endif
+
+void emacps_recv_handler(void *arg)
+{
+	struct xemac_s *xemac;
+	xemacpsif_s *xemacpsif;
+	u32_t regval;
+	u32_t gigeversion;
+#ifndef XEMACPSIF_RX_POLL_BUDGET
+	u32_t queue;
+#endif
+
+	xemac = (struct xemac_s *)(arg);
+	xemacpsif = (xemacpsif_s *)(xemac->state);
+
+#if !NO_SYS
+	xInsideISR++;
+#endif
+
+	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
+	/*
+	 * If Reception done interrupt is asserted, call RX call back function
+	 * to handle the processed BDs and then raise the according flag.
+	 */
+	regval = XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET);
+	XEmacPs_WriteReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET, regval);
+	if (gigeversion <= 2) {
+			resetrx_on_no_rxdata(xemacpsif);
+	}
+
+#ifdef XEMACPSIF_RX_POLL_BUDGET
+	/* Leave the rings to the input thread until it has drained them. The
+	 * handler still runs while polling when other interrupts come in.
+	 */
+	if (xemacpsif->rx_polling == 0) {
+		xemacpsif->rx_polling = 1;
+		rx_intr_disable(xemacpsif);
+		sys_sem_signal(&xemac->sem_rx_data_available);
+	}
+#else
+	/* Highest priority queue first */
+	for (queue = xemacps_num_queues(xemacpsif); queue-- > 0; ) {
+		process_rx_bds(xemacpsif, queue, XEMACPSIF_RX_BUDGET_ALL);
+	}
 #if !NO_SYS
 	sys_sem_signal(&xemac->sem_rx_data_available);
+#endif
+#endif
+#if !NO_SYS
 	xInsideISR--;
 #endif
 
@@ -588,6 +1529,10 @@ void clean_dma_txdescs(struct xemac_s *xemac)
 	XEmacPs_Bd bdtemplate;
 	XEmacPs_BdRing *txringptr;
 	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+#if XEMACPSIF_NUM_QUEUES > 1
+	UINTPTR bdspace;
+	u32_t queue;
+#endif
 
 	txringptr = &XEmacPs_GetTxRing(&xemacpsif->emacps);
 
@@ -597,10 +1542,18 @@ void clean_dma_txdescs(struct xemac_s *xemac)
 	/*
 	 * Create the TxBD ring
 	 */
-	XEmacPs_BdRingCreate(txringptr, (UINTPTR) xemacpsif->tx_bdspace,
-			(UINTPTR) xemacpsif->tx_bdspace, BD_ALIGNMENT,
+	create_bd_ring(xemacpsif, txringptr, (UINTPTR) xemacpsif->tx_bdspace,
 				 XLWIP_CONFIG_N_TX_DESC);
 	XEmacPs_BdRingClone(txringptr, &bdtemplate, XEMACPS_SEND);
+
+#if XEMACPSIF_NUM_QUEUES > 1
+	for (queue = 1; queue < xemacpsif->num_queues; queue++) {
+		bdspace = (UINTPTR)xemacpsif->tx_bdspace + (queue * txringptr->Length);
+		create_bd_ring(xemacpsif, &xemacpsif->txq_ring[queue - 1], bdspace,
+				XLWIP_CONFIG_N_TX_DESC);
+		XEmacPs_BdRingClone(&xemacpsif->txq_ring[queue - 1], &bdtemplate, XEMACPS_SEND);
+	}
+#endif
 }
 
 XStatus init_dma(struct xemac_s *xemac)
@@ -624,6 +1577,21 @@ XStatus init_dma(struct xemac_s *xemac)
 
 	index = get_base_index_rxpbufsstorage (xemacpsif);
 	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
+#if XEMACPSIF_NUM_QUEUES > 1
+	if (xemacpsif->num_queues == 0) {
+		init_queue_config(xemacpsif);
+	}
+#endif
+#if LWIP_TCP_LSO
+	if (xemacpsif->lso_hdrspace == NULL) {
+		xemacpsif->lso_hdrspace = mem_malloc(XEMACPSIF_NUM_QUEUES *
+				XLWIP_CONFIG_N_TX_DESC * XLSO_HDR_SIZE);
+		if (xemacpsif->lso_hdrspace == NULL) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Unable to allocate LSO header space\r\n"));
+			return ERR_IF;
+		}
+	}
+#endif
 	/*
 	 * The BDs need to be allocated in uncached memory. Hence the 1 MB
 	 * address range allocated for Bd_Space is made uncached
@@ -686,8 +1654,7 @@ XStatus init_dma(struct xemac_s *xemac)
 	 * Create the RxBD ring
 	 */
 
-	status = XEmacPs_BdRingCreate(rxringptr, (UINTPTR) xemacpsif->rx_bdspace,
-				(UINTPTR) xemacpsif->rx_bdspace, BD_ALIGNMENT,
+	status = create_bd_ring(xemacpsif, rxringptr, (UINTPTR) xemacpsif->rx_bdspace,
 				     XLWIP_CONFIG_N_RX_DESC);
 
 	if (status != XST_SUCCESS) {
@@ -706,8 +1673,7 @@ XStatus init_dma(struct xemac_s *xemac)
 	/*
 	 * Create the TxBD ring
 	 */
-	status = XEmacPs_BdRingCreate(txringptr, (UINTPTR) xemacpsif->tx_bdspace,
-				(UINTPTR) xemacpsif->tx_bdspace, BD_ALIGNMENT,
+	status = create_bd_ring(xemacpsif, txringptr, (UINTPTR) xemacpsif->tx_bdspace,
 				     XLWIP_CONFIG_N_TX_DESC);
 
 	if (status != XST_SUCCESS) {
@@ -723,11 +1689,14 @@ XStatus init_dma(struct xemac_s *xemac)
 	/*
 	 * Allocate RX descriptors, 1 RxBD at a time.
 	 */
+#ifdef XLWIP_CONFIG_EMACPS_RX_ZEROCOPY
+	rx_zc_pool_init(xemacpsif);
+#endif
 	for (i = 0; i < XLWIP_CONFIG_N_RX_DESC; i++) {
-#ifdef ZYNQMP_USE_JUMBO
-		p = pbuf_alloc(PBUF_RAW, MAX_FRAME_SIZE_JUMBO, PBUF_POOL);
+#ifdef XLWIP_CONFIG_EMACPS_RX_ZEROCOPY
+		p = rx_zc_pbuf_alloc(xemacpsif);
 #else
-		p = pbuf_alloc(PBUF_RAW, XEMACPS_MAX_FRAME_SIZE, PBUF_POOL);
+		p = pbuf_alloc(PBUF_RAW, XEMACPSIF_RX_BUF_SIZE, PBUF_POOL);
 #endif
 		if (!p) {
 #if LINK_STATS
@@ -761,13 +1730,11 @@ XStatus init_dma(struct xemac_s *xemac)
 		temp++;
 		*temp = 0;
 		dsb();
-#ifdef ZYNQMP_USE_JUMBO
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)MAX_FRAME_SIZE_JUMBO);
-		}
+#ifdef XLWIP_CONFIG_EMACPS_RX_ZEROCOPY
+		/* Pool buffers are invalidated when they are freed */
 #else
 		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)XEMACPS_MAX_FRAME_SIZE);
+			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)XEMACPSIF_RX_BUF_SIZE);
 		}
 #endif
 		XEmacPs_BdSetAddressRx(rxbd, (UINTPTR)p->payload);
@@ -800,7 +1767,31 @@ XStatus init_dma(struct xemac_s *xemac)
 						XEMACPS_TXBUF_WRAP_MASK));
 		XEmacPs_Out32((xemacpsif->emacps.Config.BaseAddress + XEMACPS_TXQBASE_OFFSET),
 				   (UINTPTR)bdtxterminate);
+#if XEMACPSIF_NUM_QUEUES > 1
+		if (xemacpsif->num_queues > 1) {
+			status = init_dma_queues(xemacpsif, bdrxterminate, bdtxterminate);
+			if (status != XST_SUCCESS) {
+				return ERR_IF;
+			}
+		}
+#endif
+#ifdef XLWIP_CONFIG_EMACPS_BD_TIMESTAMP
+		/* the rings were created with extended BDs */
+		status = XEmacPs_SetBdTsMode(&xemacpsif->emacps,
+				XEMACPSIF_TX_TS_MODE, XEMACPSIF_RX_TS_MODE);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Error enabling BD timestamping\r\n"));
+			return ERR_IF;
+		}
+#endif
+	}
+#ifdef XEMACPSIF_RX_CHAIN
+	/* frames larger than the RX buffers span several BDs */
+	status = XEmacPs_SetRxBufSize(&xemacpsif->emacps, XEMACPSIF_RX_BUF_SIZE);
+	if (status != XST_SUCCESS) {
+		return ERR_IF;
 	}
+#endif
 #if !NO_SYS
 #ifdef SDT
 	xPortInstallInterruptHandler(xemacpsif->emacps.Config.IntrId,
@@ -838,6 +1829,111 @@ XStatus init_dma(struct xemac_s *xemac)
 	return 0;
 }
 
+#ifdef XEMACPSIF_PHY_INTR
+static void phy_intr_handler(void *arg, u32 bank, u32 status)
+{
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)arg;
+
+	(void)bank;
+	(void)status;
+
+	/* The PHY holds the level until its status is read over MDIO, which
+	 * is left to the link check. Mask the pin until then.
+	 */
+	XGpioPs_IntrDisablePin(&phy_intr_gpio, XLWIP_CONFIG_PHY_INTR_GPIO_PIN);
+	xemacpsif->phy_intr_event = 1;
+#if !NO_SYS
+	sys_sem_signal(&xemacpsif->phy_intr_sem);
+#endif
+}
+
+/*
+ * init_phy_intr: enables the link change interrupt of the PHY and the
+ * interrupt of the GPIO pin its active low output is wired to. The GPIO
+ * controller interrupt is taken over by the adapter. On failure the link
+ * stays polled.
+ */
+XStatus init_phy_intr(xemacpsif_s *xemacpsif)
+{
+	XGpioPs_Config *gpio_config;
+	u32_t pin = XLWIP_CONFIG_PHY_INTR_GPIO_PIN;
+
+	xemacpsif->phy_intr = 0;
+	xemacpsif->phy_intr_event = 0;
+	xemacpsif->phy_intr_polls = 0;
+
+#ifndef SDT
+	gpio_config = XGpioPs_LookupConfig(XPAR_XGPIOPS_0_DEVICE_ID);
+#else
+	gpio_config = XGpioPs_LookupConfig(XPAR_XGPIOPS_0_BASEADDR);
+#endif
+	if ((gpio_config == NULL) ||
+		(XGpioPs_CfgInitialize(&phy_intr_gpio, gpio_config,
+				gpio_config->BaseAddr) != XST_SUCCESS)) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("In %s:GPIO Configuration Failed....\r\n", __func__));
+		return XST_FAILURE;
+	}
+	if (phy_intr_enable_emacps(&xemacpsif->emacps, phyaddrforemac) !=
+								XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("In %s:No interrupt for this PHY, polling the link\r\n", __func__));
+		return XST_FAILURE;
+	}
+#if !NO_SYS
+	if (sys_sem_new(&xemacpsif->phy_intr_sem, 0) != ERR_OK) {
+		return XST_FAILURE;
+	}
+#endif
+
+	XGpioPs_SetDirectionPin(&phy_intr_gpio, pin, 0);
+	XGpioPs_SetIntrTypePin(&phy_intr_gpio, pin, XGPIOPS_IRQ_TYPE_LEVEL_LOW);
+	XGpioPs_SetCallbackHandler(&phy_intr_gpio, (void *)xemacpsif,
+				phy_intr_handler);
+	XGpioPs_IntrClearPin(&phy_intr_gpio, pin);
+
+#if !NO_SYS
+#ifdef SDT
+	xPortInstallInterruptHandler(gpio_config->IntrId,
+				     ( Xil_InterruptHandler ) XGpioPs_IntrHandler,
+				     (void *)&phy_intr_gpio);
+#else
+	xPortInstallInterruptHandler(XPAR_XGPIOPS_0_INTR,
+				     ( Xil_InterruptHandler ) XGpioPs_IntrHandler,
+				     (void *)&phy_intr_gpio);
+#endif
+#else
+#ifndef SDT
+	XScuGic_RegisterHandler(INTC_BASE_ADDR, XPAR_XGPIOPS_0_INTR,
+				(Xil_ExceptionHandler)XGpioPs_IntrHandler,
+				(void *)&phy_intr_gpio);
+#endif
+#endif
+#ifdef SDT
+	XSetupInterruptSystem(&phy_intr_gpio, &XGpioPs_IntrHandler,
+			      gpio_config->IntrId, gpio_config->IntrParent,
+			      XINTERRUPT_DEFAULT_PRIORITY);
+#else
+	XScuGic_EnableIntr(INTC_DIST_BASE_ADDR, XPAR_XGPIOPS_0_INTR);
+#endif
+
+	xemacpsif->phy_intr = 1;
+	XGpioPs_IntrEnablePin(&phy_intr_gpio, pin);
+
+	return XST_SUCCESS;
+}
+
+/*
+ * phy_intr_rearm: unmasks the GPIO pin after the link check has read the
+ * interrupt status of the PHY.
+ */
+void phy_intr_rearm(xemacpsif_s *xemacpsif)
+{
+	(void)xemacpsif;
+
+	XGpioPs_IntrClearPin(&phy_intr_gpio, XLWIP_CONFIG_PHY_INTR_GPIO_PIN);
+	XGpioPs_IntrEnablePin(&phy_intr_gpio, XLWIP_CONFIG_PHY_INTR_GPIO_PIN);
+}
+#endif
+
 /*
  * resetrx_on_no_rxdata():
  *
@@ -883,7 +1979,7 @@ void free_txrx_pbufs(xemacpsif_s *xemacpsif)
 
 	index1 = get_base_index_txpbufsstorage (xemacpsif);
 
-	for (index = index1; index < (index1 + XLWIP_CONFIG_N_TX_DESC); index++) {
+	for (index = index1; index < (index1 + (XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_TX_DESC)); index++) {
 		if (tx_pbufs_storage[index] != 0) {
 			p = (struct pbuf *)tx_pbufs_storage[index];
 			pbuf_free(p);
@@ -892,10 +1988,12 @@ void free_txrx_pbufs(xemacpsif_s *xemacpsif)
 	}
 
 	index1 = get_base_index_rxpbufsstorage(xemacpsif);
-	for (index = index1; index < (index1 + XLWIP_CONFIG_N_RX_DESC); index++) {
-		p = (struct pbuf *)rx_pbufs_storage[index];
-		pbuf_free(p);
-
+	for (index = index1; index < (index1 + (XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_RX_DESC)); index++) {
+		if (rx_pbufs_storage[index] != 0) {
+			p = (struct pbuf *)rx_pbufs_storage[index];
+			pbuf_free(p);
+			rx_pbufs_storage[index] = 0;
+		}
 	}
 }
 
@@ -906,7 +2004,7 @@ void free_onlytx_pbufs(xemacpsif_s *xemacpsif)
 	struct pbuf *p;
 
 	index1 = get_base_index_txpbufsstorage (xemacpsif);
-	for (index = index1; index < (index1 + XLWIP_CONFIG_N_TX_DESC); index++) {
+	for (index = index1; index < (index1 + (XEMACPSIF_NUM_QUEUES * XLWIP_CONFIG_N_TX_DESC)); index++) {
 		if (tx_pbufs_storage[index] != 0) {
 			p = (struct pbuf *)tx_pbufs_storage[index];
 			pbuf_free(p);
@@ -920,6 +2018,9 @@ void reset_dma(struct xemac_s *xemac)
 {
 	u8 txqueuenum;
 	u32_t gigeversion;
+#if XEMACPSIF_NUM_QUEUES > 1
+	u32_t queue;
+#endif
 	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
 	XEmacPs_BdRing *txringptr = &XEmacPs_GetTxRing(&xemacpsif->emacps);
 	XEmacPs_BdRing *rxringptr = &XEmacPs_GetRxRing(&xemacpsif->emacps);
@@ -936,6 +2037,20 @@ void reset_dma(struct xemac_s *xemac)
 
 	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.RxBdRing.BaseBdAddr, 0, XEMACPS_RECV);
 	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.TxBdRing.BaseBdAddr, txqueuenum, XEMACPS_SEND);
+
+#if XEMACPSIF_NUM_QUEUES > 1
+	if (xemacpsif->num_queues > 1) {
+		for (queue = 1; queue < xemacpsif->num_queues; queue++) {
+			rxringptr = xemacps_get_rxring(xemacpsif, queue);
+			txringptr = xemacps_get_txring(xemacpsif, queue);
+			XEmacPs_BdRingPtrReset(rxringptr, (void *)rxringptr->BaseBdAddr);
+			XEmacPs_BdRingPtrReset(txringptr, (void *)txringptr->BaseBdAddr);
+			XEmacPs_SetQueuePtr(&(xemacpsif->emacps), rxringptr->BaseBdAddr, queue, XEMACPS_RECV);
+			XEmacPs_SetQueuePtr(&(xemacpsif->emacps), txringptr->BaseBdAddr, queue, XEMACPS_SEND);
+		}
+		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.TxBdRing.BaseBdAddr, 0, XEMACPS_SEND);
+	}
+#endif
 }
 
 #ifndef SDT
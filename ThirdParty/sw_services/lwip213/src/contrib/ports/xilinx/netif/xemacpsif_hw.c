@@ -139,6 +139,9 @@ void init_emacps(xemacpsif_s *xemacps, struct netif *netif)
 	}
 
 	XEmacPs_SetOperatingSpeed(xemacpsp, link_speed);
+#if LWIP_TCP && LWIP_TCP_WND_AUTOTUNE
+	xemac_tcp_wnd_autotune(link_speed);
+#endif
 	/* Setting the operating speed of the MAC needs a delay. */
 	{
 		volatile s32_t wait;
@@ -214,16 +217,13 @@ void emacps_error_handler(void *arg,u8 Direction, u32 ErrorWord)
 {
 	struct xemac_s *xemac;
 	xemacpsif_s   *xemacpsif;
-	XEmacPs_BdRing *rxring;
-	XEmacPs_BdRing *txring;
+	u32_t queue;
 #if !NO_SYS
 	xInsideISR++;
 #endif
 
 	xemac = (struct xemac_s *)(arg);
 	xemacpsif = (xemacpsif_s *)(xemac->state);
-	rxring = &XEmacPs_GetRxRing(&xemacpsif->emacps);
-	txring = &XEmacPs_GetTxRing(&xemacpsif->emacps);
 
 	if (ErrorWord != 0) {
 		switch (Direction) {
@@ -235,12 +235,16 @@ void emacps_error_handler(void *arg,u8 Direction, u32 ErrorWord)
 			if (ErrorWord & XEMACPS_RXSR_RXOVR_MASK) {
 				LWIP_DEBUGF(NETIF_DEBUG, ("Receive over run\r\n"));
 				emacps_recv_handler(arg);
-				setup_rx_bds(xemacpsif, rxring);
+				for (queue = 0; queue < xemacps_num_queues(xemacpsif); queue++) {
+					setup_rx_bds(xemacpsif, xemacps_get_rxring(xemacpsif, queue));
+				}
 			}
 			if (ErrorWord & XEMACPS_RXSR_BUFFNA_MASK) {
 				LWIP_DEBUGF(NETIF_DEBUG, ("Receive buffer not available\r\n"));
 				emacps_recv_handler(arg);
-				setup_rx_bds(xemacpsif, rxring);
+				for (queue = 0; queue < xemacps_num_queues(xemacpsif); queue++) {
+					setup_rx_bds(xemacpsif, xemacps_get_rxring(xemacpsif, queue));
+				}
 			}
 			break;
 			case XEMACPS_SEND:
@@ -262,7 +266,9 @@ void emacps_error_handler(void *arg,u8 Direction, u32 ErrorWord)
 			}
 			if (ErrorWord & XEMACPS_TXSR_FRAMERX_MASK) {
 				LWIP_DEBUGF(NETIF_DEBUG, ("Transmit collision\r\n"));
-				xemacps_process_sent_bds(xemacpsif, txring);
+				for (queue = 0; queue < xemacps_num_queues(xemacpsif); queue++) {
+					xemacps_process_sent_bds(xemacpsif, xemacps_get_txring(xemacpsif, queue));
+				}
 			}
 			break;
 		}
@@ -159,6 +159,20 @@
 
 #define IEEE_CTRL_ISOLATE_DISABLE               0xFBFF
 
+/* Link change interrupt of the PHYs, Marvell, TI and Realtek share the
+ * register layout
+ */
+#define PHY_INTR_ENABLE_REG		0x12
+#define PHY_INTR_STATUS_REG		0x13
+#define PHY_INTR_LINK_CHANGE		0x0400
+#define PHY_INTR_AUTONEG_DONE		0x0800
+#define PHY_TI_CFG3			0x1E
+#define PHY_TI_CFG3_INT_OE		0x0080
+#define ADIN1300_IRQ_MASK		0x0018
+#define ADIN1300_IRQ_STATUS		0x0019
+#define ADIN1300_HW_IRQ_EN		0x0001
+#define ADIN1300_LNK_STAT_CHNG_IRQ_EN	0x0002
+
 u32_t phymapemac0[32];
 u32_t phymapemac1[32];
 
@@ -908,6 +922,73 @@ static u32_t configure_IEEE_phy_speed(XEmacPs *xemacpsp, u32_t phy_addr, u32_t s
 }
 #endif
 
+#ifdef XEMACPSIF_PHY_INTR
+/*
+ * phy_intr_enable_emacps: makes the PHY drive its interrupt output on link
+ * changes and completed autonegotiations. Returns XST_FAILURE for a PHY
+ * without a known interrupt, the link is then polled.
+ */
+u32_t phy_intr_enable_emacps(XEmacPs *xemacpsp, u32_t phy_addr)
+{
+	u16_t phy_identity;
+	u16_t control;
+
+	XEmacPs_PhyRead(xemacpsp, phy_addr, PHY_IDENTIFIER_1_REG,
+					&phy_identity);
+	switch (phy_identity) {
+		case PHY_MARVELL_IDENTIFIER:
+			XEmacPs_PhyWrite(xemacpsp, phy_addr,
+					IEEE_PAGE_ADDRESS_REGISTER, 0);
+			break;
+		case PHY_TI_IDENTIFIER:
+			XEmacPs_PhyRead(xemacpsp, phy_addr, PHY_TI_CFG3, &control);
+			control |= PHY_TI_CFG3_INT_OE;
+			XEmacPs_PhyWrite(xemacpsp, phy_addr, PHY_TI_CFG3, control);
+			break;
+		case PHY_REALTEK_IDENTIFIER:
+			break;
+		case PHY_ADI_IDENTIFIER:
+			XEmacPs_PhyRead(xemacpsp, phy_addr, ADIN1300_IRQ_MASK,
+					&control);
+			control |= ADIN1300_HW_IRQ_EN |
+					ADIN1300_LNK_STAT_CHNG_IRQ_EN;
+			XEmacPs_PhyWrite(xemacpsp, phy_addr, ADIN1300_IRQ_MASK,
+					control);
+			phy_intr_ack_emacps(xemacpsp, phy_addr);
+			return XST_SUCCESS;
+		default:
+			return XST_FAILURE;
+	}
+
+	XEmacPs_PhyRead(xemacpsp, phy_addr, PHY_INTR_ENABLE_REG, &control);
+	control |= PHY_INTR_LINK_CHANGE | PHY_INTR_AUTONEG_DONE;
+	XEmacPs_PhyWrite(xemacpsp, phy_addr, PHY_INTR_ENABLE_REG, control);
+	phy_intr_ack_emacps(xemacpsp, phy_addr);
+
+	return XST_SUCCESS;
+}
+
+/*
+ * phy_intr_ack_emacps: reads the interrupt status of the PHY, which clears
+ * it and releases the interrupt output.
+ */
+void phy_intr_ack_emacps(XEmacPs *xemacpsp, u32_t phy_addr)
+{
+	u16_t phy_identity;
+	u16_t status;
+
+	XEmacPs_PhyRead(xemacpsp, phy_addr, PHY_IDENTIFIER_1_REG,
+					&phy_identity);
+	if (phy_identity == PHY_ADI_IDENTIFIER) {
+		XEmacPs_PhyRead(xemacpsp, phy_addr, ADIN1300_IRQ_STATUS,
+				&status);
+	} else {
+		XEmacPs_PhyRead(xemacpsp, phy_addr, PHY_INTR_STATUS_REG,
+				&status);
+	}
+}
+#endif
+
 static void SetUpSLCRDivisors(UINTPTR mac_baseaddr, s32_t speed)
 {
 #ifndef SDT
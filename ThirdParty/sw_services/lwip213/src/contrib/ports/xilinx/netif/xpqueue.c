@@ -30,6 +30,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "netif/xpqueue.h"
 
@@ -53,11 +54,85 @@ pq_create_queue()
 	if (!q)
 		return q;
 
+#ifdef XLWIP_CONFIG_PQ_LOCKFREE
+	memset(q->data, 0, sizeof(q->data));
+	q->head = q->tail = 0;
+#else
 	q->head = q->tail = q->len = 0;
+#endif
 
 	return q;
 }
 
+#ifdef XLWIP_CONFIG_PQ_LOCKFREE
+/*
+ * pq_enqueue: may be called concurrently from any number of contexts,
+ * interrupt handlers included, without masking interrupts.
+ */
+int
+pq_enqueue(pq_queue_t *q, void *p)
+{
+	unsigned int head;
+
+	if (p == NULL)
+		return -1;
+
+	head = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+	do {
+		if (head - __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE) >=
+								PQ_QUEUE_SIZE)
+			return -1;
+	} while (!__atomic_compare_exchange_n(&q->head, &head, head + 1, 0,
+					__ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+	__atomic_store_n(&q->data[head % PQ_QUEUE_SIZE], p, __ATOMIC_RELEASE);
+
+	return 0;
+}
+
+/*
+ * pq_dequeue_batch: takes up to n packets from q. Only one context may
+ * dequeue from a given queue.
+ */
+int
+pq_dequeue_batch(pq_queue_t *q, void **p, int n)
+{
+	unsigned int tail = q->tail;
+	void **slot;
+	int i;
+
+	for (i = 0; i < n; i++) {
+		slot = &q->data[(tail + i) % PQ_QUEUE_SIZE];
+		p[i] = __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+		if (p[i] == NULL)
+			break;
+		*slot = NULL;
+	}
+
+	/* hand the freed slots back to the producers in one go */
+	if (i != 0)
+		__atomic_store_n(&q->tail, tail + i, __ATOMIC_RELEASE);
+
+	return i;
+}
+
+void*
+pq_dequeue(pq_queue_t *q)
+{
+	void *p;
+
+	if (pq_dequeue_batch(q, &p, 1) == 0)
+		return NULL;
+
+	return p;
+}
+
+int
+pq_qlength(pq_queue_t *q)
+{
+	return (int)(__atomic_load_n(&q->head, __ATOMIC_ACQUIRE) - q->tail);
+}
+#else
 int
 pq_enqueue(pq_queue_t *q, void *p)
 {
@@ -86,8 +161,20 @@ pq_dequeue(pq_queue_t *q)
 	return q->data[ptail];
 }
 
+int
+pq_dequeue_batch(pq_queue_t *q, void **p, int n)
+{
+	int i;
+
+	for (i = 0; i < n && q->len != 0; i++)
+		p[i] = pq_dequeue(q);
+
+	return i;
+}
+
 int
 pq_qlength(pq_queue_t *q)
 {
 	return q->len;
 }
+#endif
@@ -59,6 +59,480 @@ functions are being called from an interrupt context or not.  This relies on
 the interrupt handler setting this variable manually. */
 u32 xInsideISR;
 
+#if LWIP_FAST_MBOX
+
+#include <string.h>
+
+#if configUSE_TASK_NOTIFICATIONS != 1
+#error "LWIP_FAST_MBOX needs configUSE_TASK_NOTIFICATIONS"
+#endif
+
+/*
+ * Mailboxes and semaphores on lock-free rings and direct to task
+ * notifications.
+ *
+ * A mailbox is a multi-producer/single-consumer ring of message pointers,
+ * like the lock-free pbuf queue of the adapter: a poster claims a slot by a
+ * compare-and-swap on head and publishes the message in it, the reader takes
+ * the published slots at tail. A semaphore is a flag that sys_sem_signal()
+ * sets and the waiter clears. Only one task at a time may fetch from a given
+ * mailbox or wait on a given semaphore, which is how lwIP uses them (the
+ * tcpip_thread mailbox, the netconn receive and accept mailboxes, the API
+ * call and adapter input semaphores).
+ *
+ * A reader that finds nothing to take stores its task handle in the object
+ * and blocks on its task notification, which posters and signallers give.
+ * Neither side masks interrupts or takes the kernel queue lists, so a post
+ * to a blocked tcpip_thread costs one compare-and-swap, one store and one
+ * notification. A blocking post to a full mailbox retries every tick.
+ */
+
+/* Notification used for the wakeups. With several per task the last one is
+taken, leaving index 0 to the application. */
+#define XLWIP_NOTIFY_INDEX	( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
+
+struct xlwip_mbox
+{
+	volatile unsigned int uxHead;
+	volatile unsigned int uxTail;
+	unsigned int uxMask;
+	xTaskHandle volatile xReader;
+	void * volatile pvSlots[];
+};
+
+struct xlwip_sem
+{
+	volatile unsigned int uxCount;
+	xTaskHandle volatile xWaiter;
+};
+
+/* Stands for a NULL message, a NULL slot is an empty one */
+static const u8_t ucNullMessage;
+
+static void prvNotifyWaiter( xTaskHandle volatile *pxWaiter )
+{
+xTaskHandle xTask;
+portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+
+	/* Pairs with the fence in prvWait(): either the waiter sees the new
+	message or flag, or the waiter's handle is seen here. */
+	__atomic_thread_fence( __ATOMIC_SEQ_CST );
+	xTask = __atomic_load_n( pxWaiter, __ATOMIC_RELAXED );
+	if( xTask == NULL )
+	{
+		return;
+	}
+
+	if( xInsideISR != pdFALSE )
+	{
+		vTaskNotifyGiveIndexedFromISR( xTask, XLWIP_NOTIFY_INDEX, &xHigherPriorityTaskWoken );
+		if (xHigherPriorityTaskWoken == pdTRUE) {
+			portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+		}
+	}
+	else
+	{
+		xTaskNotifyGiveIndexed( xTask, XLWIP_NOTIFY_INDEX );
+	}
+}
+
+/*
+ * Calls pxTake until it succeeds or xTicks have passed, portMAX_DELAY waits
+ * forever. A notification left over from an earlier wait only costs one more
+ * round in the loop.
+ */
+static portBASE_TYPE prvWait( xTaskHandle volatile *pxWaiter,
+		portBASE_TYPE ( *pxTake )( void *pvObject, void **ppvMsg ),
+		void *pvObject, void **ppvMsg, portTickType xTicks )
+{
+portTickType xStartTime, xElapsed, xRemaining;
+portBASE_TYPE xReturn;
+
+	if( pxTake( pvObject, ppvMsg ) == pdTRUE )
+	{
+		return pdTRUE;
+	}
+
+	xStartTime = xTaskGetTickCount();
+	xRemaining = xTicks;
+	__atomic_store_n( pxWaiter, xTaskGetCurrentTaskHandle(), __ATOMIC_RELAXED );
+
+	for( ;; )
+	{
+		__atomic_thread_fence( __ATOMIC_SEQ_CST );
+		xReturn = pxTake( pvObject, ppvMsg );
+		if( ( xReturn == pdTRUE ) || ( xRemaining == 0 ) )
+		{
+			break;
+		}
+
+		( void ) ulTaskNotifyTakeIndexed( XLWIP_NOTIFY_INDEX, pdTRUE, xRemaining );
+
+		if( xTicks != portMAX_DELAY )
+		{
+			xElapsed = xTaskGetTickCount() - xStartTime;
+			xRemaining = ( xElapsed < xTicks ) ? ( xTicks - xElapsed ) : 0;
+		}
+	}
+
+	__atomic_store_n( pxWaiter, NULL, __ATOMIC_RELAXED );
+
+	return xReturn;
+}
+
+static portBASE_TYPE prvMboxPut( struct xlwip_mbox *pxMbox, void *pvMsg )
+{
+unsigned int uxHead;
+
+	if( pvMsg == NULL )
+	{
+		pvMsg = ( void * ) &ucNullMessage;
+	}
+
+	uxHead = __atomic_load_n( &pxMbox->uxHead, __ATOMIC_RELAXED );
+	do
+	{
+		if( uxHead - __atomic_load_n( &pxMbox->uxTail, __ATOMIC_ACQUIRE ) > pxMbox->uxMask )
+		{
+			return pdFALSE;
+		}
+	} while( !__atomic_compare_exchange_n( &pxMbox->uxHead, &uxHead, uxHead + 1, 0,
+						__ATOMIC_ACQ_REL, __ATOMIC_RELAXED ) );
+
+	__atomic_store_n( &pxMbox->pvSlots[ uxHead & pxMbox->uxMask ], pvMsg, __ATOMIC_RELEASE );
+	prvNotifyWaiter( &pxMbox->xReader );
+
+	return pdTRUE;
+}
+
+static portBASE_TYPE prvMboxTake( void *pvObject, void **ppvMsg )
+{
+struct xlwip_mbox *pxMbox = ( struct xlwip_mbox * ) pvObject;
+unsigned int uxTail = pxMbox->uxTail;
+void * volatile *ppvSlot = &pxMbox->pvSlots[ uxTail & pxMbox->uxMask ];
+void *pvMsg;
+
+	/* NULL is an empty ring or a slot claimed but not yet published */
+	pvMsg = __atomic_load_n( ppvSlot, __ATOMIC_ACQUIRE );
+	if( pvMsg == NULL )
+	{
+		return pdFALSE;
+	}
+
+	*ppvSlot = NULL;
+	__atomic_store_n( &pxMbox->uxTail, uxTail + 1, __ATOMIC_RELEASE );
+	*ppvMsg = ( pvMsg == ( void * ) &ucNullMessage ) ? NULL : pvMsg;
+
+	return pdTRUE;
+}
+
+static portBASE_TYPE prvSemTake( void *pvObject, void **ppvMsg )
+{
+struct xlwip_sem *pxSem = ( struct xlwip_sem * ) pvObject;
+
+	( void ) ppvMsg;
+
+	return ( __atomic_exchange_n( &pxSem->uxCount, 0U, __ATOMIC_ACQUIRE ) != 0U ) ? pdTRUE : pdFALSE;
+}
+
+/* Ticks a fetch or wait may block, none inside an interrupt handler */
+static portTickType prvWaitTicks( u32_t ulTimeOut )
+{
+	if( xInsideISR != pdFALSE )
+	{
+		return 0;
+	}
+
+	return ( ulTimeOut != 0UL ) ? ( portTickType ) ( ulTimeOut / portTICK_RATE_MS ) : portMAX_DELAY;
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_mbox_new
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Creates a new mailbox, holding at least iSize messages
+ * Inputs:
+ *      int size                -- Size of elements in the mailbox
+ * Outputs:
+ *      sys_mbox_t              -- Handle to new mailbox
+ *---------------------------------------------------------------------------*/
+err_t sys_mbox_new( sys_mbox_t *pxMailBox, int iSize )
+{
+struct xlwip_mbox *pxMbox;
+unsigned int uxSize = 1U;
+
+	/* The ring indexes wrap with the counters, its size is a power of two */
+	while( ( int ) uxSize < iSize )
+	{
+		uxSize <<= 1;
+	}
+
+	pxMbox = pvPortMalloc( sizeof( *pxMbox ) + ( uxSize * sizeof( void * ) ) );
+	*pxMailBox = pxMbox;
+	if( pxMbox == NULL )
+	{
+		SYS_STATS_INC( mbox.err );
+		return ERR_MEM;
+	}
+
+	memset( pxMbox, 0, sizeof( *pxMbox ) + ( uxSize * sizeof( void * ) ) );
+	pxMbox->uxMask = uxSize - 1U;
+	SYS_STATS_INC_USED( mbox );
+
+	return ERR_OK;
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_mbox_free
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Deallocates a mailbox. If there are messages still present in the
+ *      mailbox when the mailbox is deallocated, it is an indication of a
+ *      programming error in lwIP and the developer should be notified.
+ * Inputs:
+ *      sys_mbox_t mbox         -- Handle of mailbox
+ *---------------------------------------------------------------------------*/
+void sys_mbox_free( sys_mbox_t *pxMailBox )
+{
+struct xlwip_mbox *pxMbox = *pxMailBox;
+unsigned long ulMessagesWaiting;
+
+	ulMessagesWaiting = pxMbox->uxHead - pxMbox->uxTail;
+	configASSERT( ( ulMessagesWaiting == 0 ) );
+
+	#if SYS_STATS
+	{
+		if( ulMessagesWaiting != 0UL )
+		{
+			SYS_STATS_INC( mbox.err );
+		}
+
+		SYS_STATS_DEC( mbox.used );
+	}
+	#endif /* SYS_STATS */
+
+	vPortFree( pxMbox );
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_mbox_post
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Post the "msg" to the mailbox. Waits while the mailbox is full,
+ *      except inside an interrupt handler, where the message is dropped.
+ * Inputs:
+ *      sys_mbox_t mbox         -- Handle of mailbox
+ *      void *data              -- Pointer to data to post
+ *---------------------------------------------------------------------------*/
+void sys_mbox_post( sys_mbox_t *pxMailBox, void *pxMessageToPost )
+{
+	while( prvMboxPut( *pxMailBox, pxMessageToPost ) != pdTRUE )
+	{
+		if( xInsideISR != pdFALSE )
+		{
+			SYS_STATS_INC( mbox.err );
+			break;
+		}
+		vTaskDelay( 1 );
+	}
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_mbox_trypost
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Try to post the "msg" to the mailbox.  Returns immediately with
+ *      error if cannot.
+ * Inputs:
+ *      sys_mbox_t mbox         -- Handle of mailbox
+ *      void *msg               -- Pointer to data to post
+ * Outputs:
+ *      err_t                   -- ERR_OK if message posted, else ERR_MEM
+ *                                  if not.
+ *---------------------------------------------------------------------------*/
+err_t sys_mbox_trypost( sys_mbox_t *pxMailBox, void *pxMessageToPost )
+{
+	if( prvMboxPut( *pxMailBox, pxMessageToPost ) != pdTRUE )
+	{
+		LWIP_DEBUGF(NETIF_DEBUG, ("Queue is full\r\n"));
+		SYS_STATS_INC( mbox.err );
+		return ERR_MEM;
+	}
+
+	return ERR_OK;
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_arch_mbox_fetch
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Blocks the thread until a message arrives in the mailbox, but does
+ *      not block the thread longer than "timeout" milliseconds. A timeout
+ *      of 0 waits forever. Inside an interrupt handler it does not block.
+ * Inputs:
+ *      sys_mbox_t mbox         -- Handle of mailbox
+ *      void **msg              -- Pointer to pointer to msg received
+ *      u32_t timeout           -- Number of milliseconds until timeout
+ * Outputs:
+ *      u32_t                   -- SYS_ARCH_TIMEOUT if timeout, else number
+ *                                  of milliseconds until received.
+ *---------------------------------------------------------------------------*/
+u32_t sys_arch_mbox_fetch( sys_mbox_t *pxMailBox, void **ppvBuffer, u32_t ulTimeOut )
+{
+void *pvDummy;
+portTickType xStartTime;
+unsigned long ulReturn;
+
+	xStartTime = xTaskGetTickCount();
+
+	if( NULL == ppvBuffer )
+	{
+		ppvBuffer = &pvDummy;
+	}
+
+	if( prvWait( &( *pxMailBox )->xReader, prvMboxTake, *pxMailBox, ppvBuffer,
+			prvWaitTicks( ulTimeOut ) ) == pdTRUE )
+	{
+		ulReturn = ( xTaskGetTickCount() - xStartTime ) * portTICK_RATE_MS;
+		if( ( ulTimeOut == 0UL ) && ( ulReturn == 0UL ) )
+		{
+			ulReturn = 1UL;
+		}
+	}
+	else
+	{
+		*ppvBuffer = NULL;
+		ulReturn = SYS_ARCH_TIMEOUT;
+	}
+
+	return ulReturn;
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_arch_mbox_tryfetch
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Similar to sys_arch_mbox_fetch, but if message is not ready
+ *      immediately, we'll return with SYS_MBOX_EMPTY.  On success, 0 is
+ *      returned.
+ * Inputs:
+ *      sys_mbox_t mbox         -- Handle of mailbox
+ *      void **msg              -- Pointer to pointer to msg received
+ * Outputs:
+ *      u32_t                   -- SYS_MBOX_EMPTY if no messages.  Otherwise,
+ *                                  return ERR_OK.
+ *---------------------------------------------------------------------------*/
+u32_t sys_arch_mbox_tryfetch( sys_mbox_t *pxMailBox, void **ppvBuffer )
+{
+void *pvDummy;
+
+	if( ppvBuffer== NULL )
+	{
+		ppvBuffer = &pvDummy;
+	}
+
+	return ( prvMboxTake( *pxMailBox, ppvBuffer ) == pdTRUE ) ? ERR_OK : SYS_MBOX_EMPTY;
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_sem_new
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Creates and returns a new binary semaphore. The "ucCount" argument
+ *      specifies the initial state of the semaphore.
+ * Inputs:
+ *      u8_t ucCount              -- Initial ucCount of semaphore (1 or 0)
+ * Outputs:
+ *      sys_sem_t               -- Created semaphore or 0 if could not create.
+ *---------------------------------------------------------------------------*/
+err_t sys_sem_new( sys_sem_t *pxSemaphore, u8_t ucCount )
+{
+struct xlwip_sem *pxSem;
+
+	pxSem = pvPortMalloc( sizeof( *pxSem ) );
+	*pxSemaphore = pxSem;
+	if( pxSem == NULL )
+	{
+		LWIP_DEBUGF(SYS_DEBUG, ("Sem creation error\r\n"));
+		SYS_STATS_INC( sem.err );
+		return ERR_MEM;
+	}
+
+	pxSem->uxCount = ( ucCount != 0U ) ? 1U : 0U;
+	pxSem->xWaiter = NULL;
+	SYS_STATS_INC_USED( sem );
+
+	return ERR_OK;
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_arch_sem_wait
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Blocks the thread while waiting for the semaphore to be
+ *      signaled. If the "timeout" argument is non-zero, the thread should
+ *      only be blocked for the specified time (measured in
+ *      milliseconds). Inside an interrupt handler it does not block.
+ * Inputs:
+ *      sys_sem_t sem           -- Semaphore to wait on
+ *      u32_t timeout           -- Number of milliseconds until timeout
+ * Outputs:
+ *      u32_t                   -- Time elapsed or SYS_ARCH_TIMEOUT.
+ *---------------------------------------------------------------------------*/
+u32_t sys_arch_sem_wait( sys_sem_t *pxSemaphore, u32_t ulTimeout )
+{
+portTickType xStartTime;
+unsigned long ulReturn;
+
+	xStartTime = xTaskGetTickCount();
+
+	if( prvWait( &( *pxSemaphore )->xWaiter, prvSemTake, *pxSemaphore, NULL,
+			prvWaitTicks( ulTimeout ) ) == pdTRUE )
+	{
+		ulReturn = ( xTaskGetTickCount() - xStartTime ) * portTICK_RATE_MS;
+		if( ( ulTimeout == 0UL ) && ( ulReturn == 0UL ) )
+		{
+			ulReturn = 1UL;
+		}
+	}
+	else
+	{
+		ulReturn = SYS_ARCH_TIMEOUT;
+	}
+
+	return ulReturn;
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_sem_signal
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Signals (releases) a semaphore
+ * Inputs:
+ *      sys_sem_t sem           -- Semaphore to signal
+ *---------------------------------------------------------------------------*/
+void sys_sem_signal( sys_sem_t *pxSemaphore )
+{
+	__atomic_store_n( &( *pxSemaphore )->uxCount, 1U, __ATOMIC_RELEASE );
+	prvNotifyWaiter( &( *pxSemaphore )->xWaiter );
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_sem_free
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Deallocates a semaphore
+ * Inputs:
+ *      sys_sem_t sem           -- Semaphore to free
+ *---------------------------------------------------------------------------*/
+void sys_sem_free( sys_sem_t *pxSemaphore )
+{
+	SYS_STATS_DEC(sem.used);
+	vPortFree( *pxSemaphore );
+}
+
+#else /* LWIP_FAST_MBOX */
+
 /*---------------------------------------------------------------------------*
  * Routine:  sys_mbox_new
  *---------------------------------------------------------------------------*
@@ -448,6 +922,8 @@ portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
 	return ulReturn;
 }
 
+#endif /* LWIP_FAST_MBOX */
+
 /** Create a new mutex
  * @param mutex pointer to the mutex to create
  * @return a new mutex */
@@ -509,6 +985,7 @@ void sys_mutex_free( sys_mutex_t *pxMutex )
 	vQueueDelete( *pxMutex );
 }
 
+#if !LWIP_FAST_MBOX
 
 /*---------------------------------------------------------------------------*
  * Routine:  sys_sem_signal
@@ -548,6 +1025,7 @@ void sys_sem_free( sys_sem_t *pxSemaphore )
 	SYS_STATS_DEC(sem.used);
 	vQueueDelete( *pxSemaphore );
 }
+#endif /* !LWIP_FAST_MBOX */
 
 /*---------------------------------------------------------------------------*
  * Routine:  sys_init
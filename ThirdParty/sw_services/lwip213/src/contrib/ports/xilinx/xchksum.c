@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ */
+
+/*
+ * Internet checksum routines for the processors of the Xilinx port, used as
+ * LWIP_CHKSUM and LWIP_CHKSUM_COPY when LWIP_ARCH_CHKSUM is set.
+ *
+ * Both return the same value as lwip_standard_chksum(): the folded, not
+ * inverted, ones' complement sum in host order. The data is summed as 32-bit
+ * words into a 64-bit accumulator, so the carries are folded only once at the
+ * end. With NEON (Cortex-A9/A53/A72/A78) 32 bytes per loop iteration are
+ * summed with pairwise add and accumulate; without it (Cortex-R5/R52 and
+ * MicroBlaze) the word loop does the whole buffer.
+ */
+
+#include "lwip/opt.h"
+
+#if defined(LWIP_ARCH_CHKSUM) && LWIP_ARCH_CHKSUM
+
+#include <string.h>
+
+#include "lwip/def.h"
+#include "lwip/inet_chksum.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define XCHKSUM_NEON 1
+
+/* 32-byte blocks summed before the 32-bit lanes are moved into the 64-bit
+ * sum; every block adds at most 2 * 0xffff to a lane
+ */
+#define XCHKSUM_NEON_BLOCKS	16384
+#endif
+
+static u16_t xchksum_fold(u64_t sum)
+{
+	sum = (sum & 0xffffffffULL) + (sum >> 32);
+	sum = (sum & 0xffffffffULL) + (sum >> 32);
+	sum = (sum & 0xffffU) + (sum >> 16);
+	sum = (sum & 0xffffU) + (sum >> 16);
+	sum = (sum & 0xffffU) + (sum >> 16);
+
+	return (u16_t)sum;
+}
+
+#ifdef XCHKSUM_NEON
+static u64_t xchksum_neon_lanes(uint32x4_t acc)
+{
+	uint64x2_t wide = vpaddlq_u32(acc);
+
+	return vgetq_lane_u64(wide, 0) + vgetq_lane_u64(wide, 1);
+}
+
+/* Sums the whole 32-byte blocks of a buffer of any alignment, copying them
+ * to dst if dst is not NULL. Returns the number of bytes done.
+ */
+static int xchksum_neon(u8_t *dst, const u8_t *src, int len, u64_t *sum)
+{
+	uint32x4_t acc0;
+	uint32x4_t acc1;
+	uint8x16_t v0;
+	uint8x16_t v1;
+	int done = 0;
+	int blocks;
+
+	while ((len - done) >= 32) {
+		acc0 = vdupq_n_u32(0);
+		acc1 = vdupq_n_u32(0);
+		for (blocks = 0; (blocks < XCHKSUM_NEON_BLOCKS) &&
+				((len - done) >= 32); blocks++) {
+			v0 = vld1q_u8(src + done);
+			v1 = vld1q_u8(src + done + 16);
+			if (dst != NULL) {
+				vst1q_u8(dst + done, v0);
+				vst1q_u8(dst + done + 16, v1);
+			}
+			acc0 = vpadalq_u16(acc0, vreinterpretq_u16_u8(v0));
+			acc1 = vpadalq_u16(acc1, vreinterpretq_u16_u8(v1));
+			done += 32;
+		}
+		*sum += xchksum_neon_lanes(acc0) + xchksum_neon_lanes(acc1);
+	}
+
+	return done;
+}
+#endif
+
+/* Sums len bytes from a 4-byte aligned address, len is a multiple of 4 */
+static u64_t xchksum_words(const u32_t *pl, int len)
+{
+	u64_t sum = 0;
+
+	while (len >= 16) {
+		sum += pl[0];
+		sum += pl[1];
+		sum += pl[2];
+		sum += pl[3];
+		pl += 4;
+		len -= 16;
+	}
+	while (len > 0) {
+		sum += *pl++;
+		len -= 4;
+	}
+
+	return sum;
+}
+
+/**
+ * Architecture optimized lwip checksum.
+ *
+ * @param dataptr start of the data, at any boundary
+ * @param len length of the data
+ * @return host order (!) lwip checksum (non-inverted Internet sum)
+ */
+u16_t
+xlwip_chksum(const void *dataptr, int len)
+{
+	const u8_t *pb = (const u8_t *)dataptr;
+	u16_t t = 0;
+	u64_t sum = 0;
+	int odd = ((mem_ptr_t)pb & 1);
+	int done;
+
+	/* Get aligned to u16_t, then to u32_t */
+	if (odd && len > 0) {
+		((u8_t *)&t)[1] = *pb++;
+		len--;
+	}
+	if ((((mem_ptr_t)pb & 2) != 0) && len > 1) {
+		sum += *(const u16_t *)(const void *)pb;
+		pb += 2;
+		len -= 2;
+	}
+
+#ifdef XCHKSUM_NEON
+	done = xchksum_neon(NULL, pb, len, &sum);
+	pb += done;
+	len -= done;
+#endif
+
+	done = len & ~3;
+	sum += xchksum_words((const u32_t *)(const void *)pb, done);
+	pb += done;
+	len -= done;
+
+	if (len > 1) {
+		sum += *(const u16_t *)(const void *)pb;
+		pb += 2;
+		len -= 2;
+	}
+	/* Consume left-over byte, if any */
+	if (len > 0) {
+		((u8_t *)&t)[0] = *pb;
+	}
+	sum += t;
+
+	t = xchksum_fold(sum);
+
+	/* Swap if alignment was odd */
+	if (odd) {
+		t = (u16_t)SWAP_BYTES_IN_WORD(t);
+	}
+
+	return t;
+}
+
+/**
+ * Copies data like MEMCPY and returns its lwip checksum, touching the data
+ * once.
+ *
+ * @param dst destination of the copy
+ * @param src data to copy and sum
+ * @param len length of the data
+ * @return host order (!) lwip checksum (non-inverted Internet sum)
+ */
+u16_t
+xlwip_chksum_copy(void *dst, const void *src, u16_t len)
+{
+	u8_t *pd = (u8_t *)dst;
+	const u8_t *ps = (const u8_t *)src;
+	u64_t sum = 0;
+	int left = len;
+	int done = 0;
+
+#ifdef XCHKSUM_NEON
+	done = xchksum_neon(pd, ps, left, &sum);
+#else
+	if ((((mem_ptr_t)pd | (mem_ptr_t)ps) & 3) == 0) {
+		const u32_t *sl = (const u32_t *)(const void *)ps;
+		u32_t *dl = (u32_t *)(void *)pd;
+		u32_t w;
+
+		for (done = 0; (left - done) >= 4; done += 4) {
+			w = *sl++;
+			*dl++ = w;
+			sum += w;
+		}
+	}
+#endif
+
+	/* The tail starts at an even offset, its sum adds up as is */
+	if (done < left) {
+		MEMCPY(pd + done, ps + done, (size_t)(left - done));
+		sum += xlwip_chksum(pd + done, left - done);
+	}
+
+	return xchksum_fold(sum);
+}
+
+#endif /* LWIP_ARCH_CHKSUM */
@@ -496,7 +496,8 @@ ip4_input(struct pbuf *p, struct netif *inp)
 
   /* verify checksum */
 #if CHECKSUM_CHECK_IP
-  IF__NETIF_CHECKSUM_ENABLED(inp, NETIF_CHECKSUM_CHECK_IP) {
+  IF__NETIF_CHECKSUM_ENABLED(inp, NETIF_CHECKSUM_CHECK_IP)
+  IF__PBUF_CHECKSUM_UNVERIFIED(p, PBUF_FLAG_CHKSUM_IP_OK) {
     if (inet_chksum(iphdr, iphdr_hlen) != 0) {
 
       LWIP_DEBUGF(IP_DEBUG | LWIP_DBG_LEVEL_SERIOUS,
@@ -932,6 +933,15 @@ ip4_output_if_opt_src(struct pbuf *p, const ip4_addr_t *src, const ip4_addr_t *d
     chk_sum += iphdr->_id;
 #endif /* CHECKSUM_GEN_IP_INLINE */
     ++ip_id;
+#if LWIP_TCP_LSO
+    if (p->lso_mss != 0) {
+      /* the netif driver gives each frame of the segment the id of the
+         previous one plus 1: reserve them all */
+      struct tcp_hdr *tcphdr = (struct tcp_hdr *)((u8_t *)p->payload + ip_hlen);
+      u16_t data_len = (u16_t)(p->tot_len - ip_hlen - TCPH_HDRLEN_BYTES(tcphdr));
+      ip_id = (u16_t)(ip_id + (data_len + p->lso_mss - 1) / p->lso_mss - 1);
+    }
+#endif /* LWIP_TCP_LSO */
 
     if (src == NULL) {
       ip4_addr_copy(iphdr->src, *IP4_ADDR_ANY4);
@@ -998,7 +1008,12 @@ ip4_output_if_opt_src(struct pbuf *p, const ip4_addr_t *src, const ip4_addr_t *d
 #endif /* ENABLE_LOOPBACK */
 #if IP_FRAG
   /* don't fragment if interface has mtu set to 0 [loopif] */
-  if (netif->mtu && (p->tot_len > netif->mtu)) {
+  if (netif->mtu && (p->tot_len > netif->mtu)
+#if LWIP_TCP_LSO
+      /* large TCP segments are cut by the netif driver */
+      && (p->lso_mss == 0)
+#endif /* LWIP_TCP_LSO */
+     ) {
     return ip4_frag(p, netif, dest);
   }
 #endif /* IP_FRAG */
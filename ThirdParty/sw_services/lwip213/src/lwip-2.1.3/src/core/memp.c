@@ -240,6 +240,170 @@ memp_init(void)
 #endif /* MEMP_OVERFLOW_CHECK >= 2 */
 }
 
+#if MEMP_PBUF_POOL_CACHE
+#if MEMP_MEM_MALLOC || MEMP_OVERFLOW_CHECK
+#error "MEMP_PBUF_POOL_CACHE needs the pool allocator without MEMP_OVERFLOW_CHECK"
+#endif
+
+#ifndef MEMP_PBUF_POOL_CACHE_CPUS
+#define MEMP_PBUF_POOL_CACHE_CPUS       1
+#endif
+#ifndef MEMP_PBUF_POOL_CACHE_CPU
+#define MEMP_PBUF_POOL_CACHE_CPU()      0
+#endif
+
+/* Elements moved between a cache and the pool at a time */
+#define MEMP_PBUF_POOL_CACHE_BATCH      ((MEMP_PBUF_POOL_CACHE + 1) / 2)
+
+/* Free PBUF_POOL elements of a CPU. A slot is emptied or filled by a single
+ * atomic operation, so that tasks and interrupts, also of other CPUs after a
+ * migration, share it without a critical section. The hint is the slot used
+ * last, the search starts there to reuse cache-hot elements first.
+ */
+struct memp_pcpu_cache {
+  struct memp *slot[MEMP_PBUF_POOL_CACHE];
+  unsigned int hint;
+};
+
+static struct memp_pcpu_cache memp_pcpu_caches[MEMP_PBUF_POOL_CACHE_CPUS];
+
+/* Takes an element out of the cache, NULL if it is empty */
+static struct memp *
+memp_pcpu_cache_take(struct memp_pcpu_cache *cache)
+{
+  unsigned int hint = __atomic_load_n(&cache->hint, __ATOMIC_RELAXED);
+  unsigned int i, idx;
+  struct memp *memp;
+
+  for (i = 0; i < MEMP_PBUF_POOL_CACHE; i++) {
+    idx = (hint + MEMP_PBUF_POOL_CACHE - i) % MEMP_PBUF_POOL_CACHE;
+    if (__atomic_load_n(&cache->slot[idx], __ATOMIC_RELAXED) != NULL) {
+      memp = __atomic_exchange_n(&cache->slot[idx], NULL, __ATOMIC_ACQUIRE);
+      if (memp != NULL) {
+        __atomic_store_n(&cache->hint, idx, __ATOMIC_RELAXED);
+        return memp;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+/* Puts an element into a free slot of the cache, 0 if it is full */
+static int
+memp_pcpu_cache_give(struct memp_pcpu_cache *cache, struct memp *memp)
+{
+  unsigned int hint = __atomic_load_n(&cache->hint, __ATOMIC_RELAXED);
+  unsigned int i, idx;
+  struct memp *empty;
+
+  for (i = 0; i < MEMP_PBUF_POOL_CACHE; i++) {
+    idx = (hint + i) % MEMP_PBUF_POOL_CACHE;
+    if (__atomic_load_n(&cache->slot[idx], __ATOMIC_RELAXED) == NULL) {
+      empty = NULL;
+      if (__atomic_compare_exchange_n(&cache->slot[idx], &empty, memp, 0,
+                                      __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+        __atomic_store_n(&cache->hint, idx, __ATOMIC_RELAXED);
+        return 1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+/* Returns elements to the pool in one critical section */
+static void
+memp_pcpu_cache_spill(const struct memp_desc *desc, struct memp **batch, int n)
+{
+  int i;
+  SYS_ARCH_DECL_PROTECT(old_level);
+
+  SYS_ARCH_PROTECT(old_level);
+  for (i = 0; i < n; i++) {
+    batch[i]->next = *desc->tab;
+    *desc->tab = batch[i];
+  }
+#if MEMP_STATS
+  desc->stats->used = (mem_size_t)(desc->stats->used - n);
+#endif
+  SYS_ARCH_UNPROTECT(old_level);
+}
+
+/* Gets an element from the cache of this CPU, refilling it from the pool */
+static struct memp *
+memp_pcpu_cache_alloc(const struct memp_desc *desc)
+{
+  struct memp_pcpu_cache *cache = &memp_pcpu_caches[MEMP_PBUF_POOL_CACHE_CPU()];
+  struct memp *batch[MEMP_PBUF_POOL_CACHE_BATCH];
+  struct memp *memp;
+  int n, i;
+  SYS_ARCH_DECL_PROTECT(old_level);
+
+  memp = memp_pcpu_cache_take(cache);
+  if (memp != NULL) {
+    return memp;
+  }
+
+  SYS_ARCH_PROTECT(old_level);
+  for (n = 0; (n < MEMP_PBUF_POOL_CACHE_BATCH) && (*desc->tab != NULL); n++) {
+    batch[n] = *desc->tab;
+    *desc->tab = batch[n]->next;
+  }
+#if MEMP_STATS
+  if (n == 0) {
+    desc->stats->err++;
+  }
+  desc->stats->used = (mem_size_t)(desc->stats->used + n);
+  if (desc->stats->used > desc->stats->max) {
+    desc->stats->max = desc->stats->used;
+  }
+#endif
+  SYS_ARCH_UNPROTECT(old_level);
+
+  if (n == 0) {
+    LWIP_DEBUGF(MEMP_DEBUG | LWIP_DBG_LEVEL_SERIOUS, ("memp_malloc: out of memory in pool %s\n", desc->desc));
+    return NULL;
+  }
+
+  for (i = 1; i < n; i++) {
+    if (!memp_pcpu_cache_give(cache, batch[i])) {
+      /* filled meanwhile by another context */
+      memp_pcpu_cache_spill(desc, &batch[i], n - i);
+      break;
+    }
+  }
+  LWIP_ASSERT("memp_malloc: memp properly aligned",
+              ((mem_ptr_t)batch[0] % MEM_ALIGNMENT) == 0);
+
+  return batch[0];
+}
+
+/* Puts an element into the cache of this CPU, a full cache is spilled by half
+ * to the pool
+ */
+static void
+memp_pcpu_cache_free(const struct memp_desc *desc, struct memp *memp)
+{
+  struct memp_pcpu_cache *cache = &memp_pcpu_caches[MEMP_PBUF_POOL_CACHE_CPU()];
+  struct memp *batch[MEMP_PBUF_POOL_CACHE_BATCH + 1];
+  int n;
+
+  if (memp_pcpu_cache_give(cache, memp)) {
+    return;
+  }
+
+  batch[0] = memp;
+  for (n = 1; n <= MEMP_PBUF_POOL_CACHE_BATCH; n++) {
+    batch[n] = memp_pcpu_cache_take(cache);
+    if (batch[n] == NULL) {
+      break;
+    }
+  }
+  memp_pcpu_cache_spill(desc, batch, n);
+}
+#endif /* MEMP_PBUF_POOL_CACHE */
+
 static void *
 #if !MEMP_OVERFLOW_CHECK
 do_memp_malloc_pool(const struct memp_desc *desc)
@@ -346,6 +510,12 @@ memp_malloc_fn(memp_t type, const char *file, const int line)
   memp_overflow_check_all();
 #endif /* MEMP_OVERFLOW_CHECK >= 2 */
 
+#if MEMP_PBUF_POOL_CACHE
+  if (type == MEMP_PBUF_POOL) {
+    return memp_pcpu_cache_alloc(memp_pools[type]);
+  }
+#endif /* MEMP_PBUF_POOL_CACHE */
+
 #if !MEMP_OVERFLOW_CHECK
   memp = do_memp_malloc_pool(memp_pools[type]);
 #else
@@ -437,7 +607,14 @@ memp_free(memp_t type, void *mem)
   old_first = *memp_pools[type]->tab;
 #endif
 
-  do_memp_free_pool(memp_pools[type], mem);
+#if MEMP_PBUF_POOL_CACHE
+  if (type == MEMP_PBUF_POOL) {
+    memp_pcpu_cache_free(memp_pools[type], (struct memp *)mem);
+  } else
+#endif /* MEMP_PBUF_POOL_CACHE */
+  {
+    do_memp_free_pool(memp_pools[type], mem);
+  }
 
 #ifdef LWIP_HOOK_MEMP_AVAILABLE
   if (old_first == NULL) {
@@ -325,6 +325,9 @@ netif_add(struct netif *netif,
 #endif /* LWIP_IPV6 */
   NETIF_SET_CHECKSUM_CTRL(netif, NETIF_CHECKSUM_ENABLE_ALL);
   netif->mtu = 0;
+#if LWIP_TCP_LSO
+  netif->lso_max_segs = 0;
+#endif /* LWIP_TCP_LSO */
   netif->flags = 0;
 #ifdef netif_get_client_data
   memset(netif->client_data, 0, sizeof(netif->client_data));
@@ -160,6 +160,11 @@ static u16_t tcp_port = TCP_LOCAL_PORT_RANGE_START;
 
 /* Incremented every coarse grained timer shot (typically every 500 ms). */
 u32_t tcp_ticks;
+#if LWIP_TCP_WND_AUTOTUNE
+/* receive window and send buffer of new pcbs, see tcp_set_wnd_default() */
+static tcpwnd_size_t tcp_wnd_default = TCP_WND;
+static tcpwnd_size_t tcp_snd_buf_default = TCP_SND_BUF;
+#endif
 static const u8_t tcp_backoff[13] =
 { 1, 2, 3, 4, 5, 6, 7, 7, 7, 7, 7, 7, 7};
 /* Times per slowtmr hits */
@@ -935,7 +940,7 @@ tcp_update_rcv_ann_wnd(struct tcp_pcb *pcb)
   LWIP_ASSERT("tcp_update_rcv_ann_wnd: invalid pcb", pcb != NULL);
   new_right_edge = pcb->rcv_nxt + pcb->rcv_wnd;
 
-  if (TCP_SEQ_GEQ(new_right_edge, pcb->rcv_ann_right_edge + LWIP_MIN((TCP_WND / 2), pcb->mss))) {
+  if (TCP_SEQ_GEQ(new_right_edge, pcb->rcv_ann_right_edge + LWIP_MIN((TCP_WND_PCB(pcb) / 2), pcb->mss))) {
     /* we can advertise more window */
     pcb->rcv_ann_wnd = pcb->rcv_wnd;
     return new_right_edge - pcb->rcv_ann_right_edge;
@@ -1003,6 +1008,31 @@ tcp_recved(struct tcp_pcb *pcb, u16_t len)
                           len, pcb->rcv_wnd, (u16_t)(TCP_WND_MAX(pcb) - pcb->rcv_wnd)));
 }
 
+#if LWIP_TCP_WND_AUTOTUNE
+/**
+ * @ingroup tcp_raw
+ * Sets the receive window and send buffer of the connections created from
+ * now on, existing connections keep theirs. The window is limited to
+ * [TCP_MSS..TCP_WND], the send buffer to [2 * TCP_MSS..TCP_SND_BUF]. The
+ * send low-water mark of those connections is TCP_SNDLOWAT, or half the
+ * send buffer if that is lower.
+ *
+ * @param wnd receive window in bytes
+ * @param snd_buf send buffer in bytes
+ */
+void
+tcp_set_wnd_default(tcpwnd_size_t wnd, tcpwnd_size_t snd_buf)
+{
+  LWIP_ASSERT_CORE_LOCKED();
+
+  tcp_wnd_default = (tcpwnd_size_t)LWIP_MIN(LWIP_MAX(wnd, TCP_MSS), TCP_WND);
+  tcp_snd_buf_default = (tcpwnd_size_t)LWIP_MIN(LWIP_MAX(snd_buf, 2 * TCP_MSS),
+                                                TCP_SND_BUF);
+  LWIP_DEBUGF(TCP_DEBUG, ("tcp_set_wnd_default: wnd %"TCPWNDSIZE_F", snd_buf %"TCPWNDSIZE_F"\n",
+                          tcp_wnd_default, tcp_snd_buf_default));
+}
+#endif /* LWIP_TCP_WND_AUTOTUNE */
+
 /**
  * Allocate a new local TCP port.
  *
@@ -1150,7 +1180,7 @@ tcp_connect(struct tcp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port,
   pcb->snd_lbb = iss - 1;
   /* Start with a window that does not need scaling. When window scaling is
      enabled and used, the window is enlarged when both sides agree on scaling. */
-  pcb->rcv_wnd = pcb->rcv_ann_wnd = TCPWND_MIN16(TCP_WND);
+  pcb->rcv_wnd = pcb->rcv_ann_wnd = TCPWND_MIN16(TCP_WND_PCB(pcb));
   pcb->rcv_ann_right_edge = pcb->rcv_nxt;
   pcb->snd_wnd = TCP_WND;
   /* As initial send MSS, we use TCP_MSS but limit it to 536.
@@ -1890,10 +1920,17 @@ tcp_alloc(u8_t prio)
     /* zero out the whole pcb, so there is no need to initialize members to zero */
     memset(pcb, 0, sizeof(struct tcp_pcb));
     pcb->prio = prio;
+#if LWIP_TCP_WND_AUTOTUNE
+    pcb->snd_buf = tcp_snd_buf_default;
+    /* a send buffer sized below TCP_SNDLOWAT would never become writable */
+    pcb->snd_lowat = (tcpwnd_size_t)LWIP_MIN(TCP_SNDLOWAT, tcp_snd_buf_default / 2);
+    pcb->rcv_wnd_max = tcp_wnd_default;
+#else
     pcb->snd_buf = TCP_SND_BUF;
+#endif
     /* Start with a window that does not need scaling. When window scaling is
        enabled and used, the window is enlarged when both sides agree on scaling. */
-    pcb->rcv_wnd = pcb->rcv_ann_wnd = TCPWND_MIN16(TCP_WND);
+    pcb->rcv_wnd = pcb->rcv_ann_wnd = TCPWND_MIN16(TCP_WND_PCB(pcb));
     pcb->ttl = TCP_TTL;
     /* As initial send MSS, we use TCP_MSS but limit it to 536.
        The send MSS is updated when an MSS option is received. */
@@ -145,6 +145,56 @@ tcp_route(const struct tcp_pcb *pcb, const ip_addr_t *src, const ip_addr_t *dst)
   }
 }
 
+#if LWIP_TCP_LSO
+/* tcp_lso_seg_len: length of the segments built by tcp_write, options
+ * included. Larger than the MSS if the netif driver cuts segments itself. */
+static u16_t
+tcp_lso_seg_len(const struct tcp_pcb *pcb)
+{
+  struct netif *netif;
+  u32_t len;
+  u8_t optlen;
+
+  if (!IP_IS_V4(&pcb->remote_ip)) {
+    return pcb->mss;
+  }
+  netif = tcp_route(pcb, &pcb->local_ip, &pcb->remote_ip);
+  if ((netif == NULL) || (netif->lso_max_segs <= 1)) {
+    return pcb->mss;
+  }
+
+#if LWIP_TCP_TIMESTAMPS
+  optlen = LWIP_TCP_OPT_LENGTH_SEGMENT((pcb->flags & TF_TIMESTAMP) ? TF_SEG_OPTS_TS : 0, pcb);
+#else /* LWIP_TCP_TIMESTAMPS */
+  optlen = LWIP_TCP_OPT_LENGTH_SEGMENT(0, pcb);
+#endif /* LWIP_TCP_TIMESTAMPS */
+  /* the driver cuts the data in pieces of (mss - optlen) bytes */
+  len = ((u32_t)netif->lso_max_segs * (u32_t)(pcb->mss - optlen)) + optlen;
+  return (u16_t)LWIP_MIN(len, TCP_LSO_MAX_LEN);
+}
+
+/* tcp_lso_fit_unsent: when only a part of the first unsent segment fits
+ * within the window, split it so that the part holds whole frames. */
+static err_t
+tcp_lso_fit_unsent(struct tcp_pcb *pcb, u32_t wnd)
+{
+  struct tcp_seg *seg = pcb->unsent;
+  u32_t inflight = lwip_ntohl(seg->tcphdr->seqno) - pcb->lastack;
+  u16_t frame_len;
+  u32_t split;
+
+  frame_len = (u16_t)(pcb->mss - LWIP_TCP_OPT_LENGTH_SEGMENT(seg->flags, pcb));
+  if ((seg->len <= frame_len) || (inflight >= wnd) || (inflight + seg->len <= wnd)) {
+    return ERR_VAL;
+  }
+  split = ((wnd - inflight) / frame_len) * frame_len;
+  if (split == 0) {
+    return ERR_VAL;
+  }
+  return tcp_split_unsent_seg(pcb, (u16_t)split);
+}
+#endif /* LWIP_TCP_LSO */
+
 /**
  * Create a TCP segment with prefilled header.
  *
@@ -419,7 +469,11 @@ tcp_write(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags)
   LWIP_ERROR("tcp_write: invalid pcb", pcb != NULL, return ERR_ARG);
 
   /* don't allocate segments bigger than half the maximum window we ever received */
+#if LWIP_TCP_LSO
+  mss_local = LWIP_MIN(tcp_lso_seg_len(pcb), TCPWND_MIN16(pcb->snd_wnd_max / 2));
+#else /* LWIP_TCP_LSO */
   mss_local = LWIP_MIN(pcb->mss, TCPWND_MIN16(pcb->snd_wnd_max / 2));
+#endif /* LWIP_TCP_LSO */
   mss_local = mss_local ? mss_local : pcb->mss;
 
   LWIP_ASSERT_CORE_LOCKED();
@@ -488,8 +542,17 @@ tcp_write(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags)
 
     /* Usable space at the end of the last unsent segment */
     unsent_optlen = LWIP_TCP_OPT_LENGTH_SEGMENT(last_unsent->flags, pcb);
+#if LWIP_TCP_LSO
+    /* the segment may have been built for a large send netif */
+    if (mss_local < last_unsent->len + unsent_optlen) {
+      space = 0;
+    } else
+#else /* LWIP_TCP_LSO */
     LWIP_ASSERT("mss_local is too small", mss_local >= last_unsent->len + unsent_optlen);
-    space = mss_local - (last_unsent->len + unsent_optlen);
+#endif /* LWIP_TCP_LSO */
+    {
+      space = mss_local - (last_unsent->len + unsent_optlen);
+    }
 
     /*
      * Phase 1: Copy data directly into an oversized pbuf.
@@ -861,7 +924,9 @@ tcp_split_unsent_seg(struct tcp_pcb *pcb, u16_t split)
     return ERR_OK;
   }
 
+#if !LWIP_TCP_LSO
   LWIP_ASSERT("split <= mss", split <= pcb->mss);
+#endif /* !LWIP_TCP_LSO */
   LWIP_ASSERT("useg->len > 0", useg->len > 0);
 
   /* We should check that we don't exceed TCP_SND_QUEUELEN but we need
@@ -1307,6 +1372,13 @@ tcp_output(struct tcp_pcb *pcb)
     ip_addr_copy(pcb->local_ip, *local_ip);
   }
 
+#if LWIP_TCP_LSO
+  /* Send the part of a large segment that fits within the window */
+  if (tcp_lso_fit_unsent(pcb, wnd) == ERR_OK) {
+    seg = pcb->unsent;
+  }
+#endif /* LWIP_TCP_LSO */
+
   /* Handle the current segment not fitting within the window */
   if (lwip_ntohl(seg->tcphdr->seqno) - pcb->lastack + seg->len > wnd) {
     /* We need to start the persistent timer when the next unsent segment does not fit
@@ -1609,6 +1681,16 @@ tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb, struct netif *netif
 #endif /* CHECKSUM_GEN_TCP */
   TCP_STATS_INC(tcp.xmit);
 
+#if LWIP_TCP_LSO
+  /* let the netif driver cut segments whose data and options do not fit the
+     MSS, into frames of at most the MSS less the options */
+  {
+    u16_t optlen = LWIP_TCP_OPT_LENGTH_SEGMENT(seg->flags, pcb);
+    seg->p->lso_mss = ((netif->lso_max_segs != 0) && (seg->len + optlen > pcb->mss)) ?
+                      (u16_t)(pcb->mss - optlen) : 0;
+  }
+#endif /* LWIP_TCP_LSO */
+
   NETIF_SET_HINTS(netif, &(pcb->netif_hints));
   err = ip_output_if(seg->p, &pcb->local_ip, &pcb->remote_ip, pcb->ttl,
                      pcb->tos, IP_PROTO_TCP, netif);
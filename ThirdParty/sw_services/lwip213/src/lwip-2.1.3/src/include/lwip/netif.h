@@ -336,6 +336,11 @@ struct netif {
 #endif /* LWIP_CHECKSUM_CTRL_PER_NETIF*/
   /** maximum transfer unit (in bytes) */
   u16_t mtu;
+#if LWIP_TCP_LSO
+  /** maximum number of MSS sized frames the driver cuts a large TCP
+   * segment to, 0 if large send is not supported */
+  u16_t lso_max_segs;
+#endif /* LWIP_TCP_LSO */
 #if LWIP_IPV6 && LWIP_ND6_ALLOW_RA_UPDATES
   /** maximum transfer unit (in bytes), updated by RA */
   u16_t mtu6;
@@ -410,6 +415,12 @@ struct netif {
 #define IF__NETIF_CHECKSUM_ENABLED(netif, chksumflag)
 #endif /* LWIP_CHECKSUM_CTRL_PER_NETIF */
 
+#if LWIP_CHECKSUM_CHECK_PER_PBUF
+#define IF__PBUF_CHECKSUM_UNVERIFIED(p, chksumflag) if (((p)->flags & (chksumflag)) == 0)
+#else /* LWIP_CHECKSUM_CHECK_PER_PBUF */
+#define IF__PBUF_CHECKSUM_UNVERIFIED(p, chksumflag)
+#endif /* LWIP_CHECKSUM_CHECK_PER_PBUF */
+
 #if LWIP_SINGLE_NETIF
 #define NETIF_FOREACH(netif) if (((netif) = netif_default) != NULL)
 #else /* LWIP_SINGLE_NETIF */
@@ -284,6 +284,21 @@
 #define MEMP_MEM_INIT                   0
 #endif
 
+/**
+ * MEMP_PBUF_POOL_CACHE: Number of free PBUF_POOL elements kept in a cache of
+ * each CPU, 0 to disable. memp_malloc() and memp_free() of MEMP_PBUF_POOL
+ * take and fill its slots with atomic operations (GCC __atomic builtins)
+ * instead of a SYS_ARCH_PROTECT critical section. The pool itself is only
+ * locked to refill an empty cache or to spill a full one, half a cache at a
+ * time. Cached elements count as used in the memp stats.
+ * The port may define MEMP_PBUF_POOL_CACHE_CPUS and MEMP_PBUF_POOL_CACHE_CPU()
+ * (the index of the running CPU) in sys_arch.h, there is a single cache by
+ * default. Not available with MEMP_MEM_MALLOC or MEMP_OVERFLOW_CHECK.
+ */
+#if !defined MEMP_PBUF_POOL_CACHE || defined __DOXYGEN__
+#define MEMP_PBUF_POOL_CACHE            0
+#endif
+
 /**
  * MEM_ALIGNMENT: should be set to the alignment of the CPU
  *    4 byte alignment -> \#define MEM_ALIGNMENT 4
@@ -1424,6 +1439,26 @@
 #define TCP_OVERSIZE                    TCP_MSS
 #endif
 
+/**
+ * LWIP_TCP_LSO==1: Large send for IPv4. On a netif with a non-zero
+ * lso_max_segs, tcp_write() builds segments of up to lso_max_segs times the
+ * MSS, and sets pbuf->lso_mss on them to the data length per frame. The netif
+ * driver cuts such a segment into MSS sized frames, numbered with consecutive
+ * IP ids that ip4_output_if() reserves. The TCP checksum must be generated by
+ * the hardware (CHECKSUM_GEN_TCP==0).
+ */
+#if !defined LWIP_TCP_LSO || defined __DOXYGEN__
+#define LWIP_TCP_LSO                    0
+#endif
+
+/**
+ * TCP_LSO_MAX_LEN: The largest TCP segment length built for large send,
+ * which leaves room for the IP and TCP headers with options.
+ */
+#if !defined TCP_LSO_MAX_LEN || defined __DOXYGEN__
+#define TCP_LSO_MAX_LEN                 (0xFFFF - 80)
+#endif
+
 /**
  * LWIP_TCP_TIMESTAMPS==1: support the TCP timestamp option.
  * The timestamp option is currently only used to help remote hosts, it is not
@@ -1474,6 +1509,16 @@
 #define TCP_RCV_SCALE                   0
 #endif
 
+/**
+ * LWIP_TCP_WND_AUTOTUNE==1: The receive window and send buffer of new
+ * connections are set at runtime with tcp_set_wnd_default(), e.g. by the
+ * netif driver from the link speed. TCP_WND and TCP_SND_BUF are then only
+ * their upper limits.
+ */
+#if !defined LWIP_TCP_WND_AUTOTUNE || defined __DOXYGEN__
+#define LWIP_TCP_WND_AUTOTUNE           0
+#endif
+
 /**
  * LWIP_TCP_PCB_NUM_EXT_ARGS:
  * When this is > 0, every tcp pcb (including listen pcb) includes a number of
@@ -2284,6 +2329,17 @@
 #define LWIP_CHECKSUM_CTRL_PER_NETIF    0
 #endif
 
+/**
+ * LWIP_CHECKSUM_CHECK_PER_PBUF==1: Skip the CHECKSUM_CHECK_* checks of a
+ * received packet when the netif driver has set PBUF_FLAG_CHKSUM_IP_OK
+ * (IPv4 header checksum) or PBUF_FLAG_CHKSUM_L4_OK (TCP or UDP checksum) in
+ * the flags of its first pbuf, i.e. the MAC has verified them. Packets the
+ * hardware did not verify, e.g. IP fragments, are still checked in software.
+ */
+#if !defined LWIP_CHECKSUM_CHECK_PER_PBUF || defined __DOXYGEN__
+#define LWIP_CHECKSUM_CHECK_PER_PBUF    0
+#endif
+
 /**
  * CHECKSUM_GEN_IP==1: Generate checksums in software for outgoing IP packets.
  */
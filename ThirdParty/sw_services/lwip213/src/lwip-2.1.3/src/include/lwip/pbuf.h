@@ -181,6 +181,12 @@ typedef enum {
 #define PBUF_FLAG_LLMCAST   0x10U
 /** indicates this pbuf includes a TCP FIN flag */
 #define PBUF_FLAG_TCP_FIN   0x20U
+/** indicates the netif hardware has verified the IPv4 header checksum of this
+    received packet (see LWIP_CHECKSUM_CHECK_PER_PBUF) */
+#define PBUF_FLAG_CHKSUM_IP_OK 0x40U
+/** indicates the netif hardware has verified the TCP or UDP checksum of this
+    received packet (see LWIP_CHECKSUM_CHECK_PER_PBUF) */
+#define PBUF_FLAG_CHKSUM_L4_OK 0x80U
 
 /** Main packet buffer struct */
 struct pbuf {
@@ -220,6 +226,13 @@ struct pbuf {
   /** For incoming packets, this contains the input netif's index */
   u8_t if_idx;
 
+#if LWIP_TCP_LSO
+  /** For outgoing TCP segments larger than the MSS, the number of TCP data
+   * bytes (net of TCP options) the netif driver must put in each frame,
+   * 0 otherwise */
+  u16_t lso_mss;
+#endif /* LWIP_TCP_LSO */
+
   /** In case the user needs to store data custom data on a pbuf */
   LWIP_PBUF_CUSTOM_DATA
 };
@@ -133,16 +133,23 @@ typedef void  (*tcp_err_fn)(void *arg, err_t err);
  */
 typedef err_t (*tcp_connected_fn)(void *arg, struct tcp_pcb *tpcb, err_t err);
 
+#if LWIP_TCP_WND_AUTOTUNE
+#define TCP_WND_PCB(pcb)        ((pcb)->rcv_wnd_max)
+#define TCP_SNDLOWAT_PCB(pcb)   ((pcb)->snd_lowat)
+#else
+#define TCP_WND_PCB(pcb)        TCP_WND
+#define TCP_SNDLOWAT_PCB(pcb)   TCP_SNDLOWAT
+#endif
 #if LWIP_WND_SCALE
 #define RCV_WND_SCALE(pcb, wnd) (((wnd) >> (pcb)->rcv_scale))
 #define SND_WND_SCALE(pcb, wnd) (((wnd) << (pcb)->snd_scale))
 #define TCPWND16(x)             ((u16_t)LWIP_MIN((x), 0xFFFF))
-#define TCP_WND_MAX(pcb)        ((tcpwnd_size_t)(((pcb)->flags & TF_WND_SCALE) ? TCP_WND : TCPWND16(TCP_WND)))
+#define TCP_WND_MAX(pcb)        ((tcpwnd_size_t)(((pcb)->flags & TF_WND_SCALE) ? TCP_WND_PCB(pcb) : TCPWND16(TCP_WND_PCB(pcb))))
 #else
 #define RCV_WND_SCALE(pcb, wnd) (wnd)
 #define SND_WND_SCALE(pcb, wnd) (wnd)
 #define TCPWND16(x)             (x)
-#define TCP_WND_MAX(pcb)        TCP_WND
+#define TCP_WND_MAX(pcb)        TCP_WND_PCB(pcb)
 #endif
 /* Increments a tcpwnd_size_t and holds at max value rather than rollover */
 #define TCP_WND_INC(wnd, inc)   do { \
@@ -284,6 +291,9 @@ struct tcp_pcb {
   tcpwnd_size_t rcv_wnd;   /* receiver window available */
   tcpwnd_size_t rcv_ann_wnd; /* receiver window to announce */
   u32_t rcv_ann_right_edge; /* announced right edge of window */
+#if LWIP_TCP_WND_AUTOTUNE
+  tcpwnd_size_t rcv_wnd_max; /* receiver window when all data is processed */
+#endif
 
 #if LWIP_TCP_SACK_OUT
   /* SACK ranges to include in ACK packets (entry is invalid if left==right) */
@@ -324,6 +334,9 @@ struct tcp_pcb {
   tcpwnd_size_t snd_wnd_max; /* the maximum sender window announced by the remote host */
 
   tcpwnd_size_t snd_buf;   /* Available buffer space for sending (in bytes). */
+#if LWIP_TCP_WND_AUTOTUNE
+  tcpwnd_size_t snd_lowat; /* snd_buf above which the netconn is writable */
+#endif
 #define TCP_SNDQUEUELEN_OVERFLOW (0xffffU-3)
   u16_t snd_queuelen; /* Number of pbufs currently in the send buffer. */
 
@@ -455,6 +468,9 @@ void             tcp_backlog_accepted(struct tcp_pcb* pcb);
 #define          tcp_accepted(pcb) do { LWIP_UNUSED_ARG(pcb); } while(0) /* compatibility define, not needed any more */
 
 void             tcp_recved  (struct tcp_pcb *pcb, u16_t len);
+#if LWIP_TCP_WND_AUTOTUNE
+void             tcp_set_wnd_default(tcpwnd_size_t wnd, tcpwnd_size_t snd_buf);
+#endif
 err_t            tcp_bind    (struct tcp_pcb *pcb, const ip_addr_t *ipaddr,
                               u16_t port);
 void             tcp_bind_netif(struct tcp_pcb *pcb, const struct netif *netif);
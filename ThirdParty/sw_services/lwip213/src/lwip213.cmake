@@ -8,6 +8,9 @@ set_property(CACHE lwip213_api_mode PROPERTY STRINGS RAW_API SOCKET_API)
 option(lwip213_no_sys_no_timers "Drops support for sys_timeout when NO_SYS==1" ON)
 set(lwip213_socket_mode_thread_prio 2 CACHE STRING "Priority of threads in socket mode")
 option(lwip213_tcp_keepalive "Enable keepalive processing with default interval" OFF)
+option(lwip213_arch_chksum "Use the architecture optimized checksum routines (NEON on Cortex-A) and checksum TCP data while copying it" ON)
+option(lwip213_tcp_lso "Send large TCP segments that the GEM and AXI DMA adapters cut into frames (needs TCP TX checksum offload)" OFF)
+option(lwip213_tcp_wnd_autotune "Size the TCP window and sender buffer of new connections from the link speed, with window scaling and SACK" OFF)
 set(sgmii_fixed_link 0 CACHE STRING "Enable fixed link for GEM SGMII at 1Gbps")
 set_property(CACHE sgmii_fixed_link PROPERTY STRINGS 0 1)
 
@@ -15,10 +18,21 @@ set(lwip213_n_tx_descriptors 64 CACHE STRING "Number of TX Buffer Descriptors to
 set(lwip213_n_rx_descriptors 64 CACHE STRING "Number of RX Buffer Descriptors to be used in SDMA mode")
 set(lwip213_n_tx_coalesce 1 CACHE STRING "Setting for TX Interrupt coalescing.")
 set(lwip213_n_rx_coalesce 1 CACHE STRING "Setting for RX Interrupt coalescing.")
+option(lwip213_emacps_rx_zerocopy "Receive GEM frames into a dedicated pool of zero-copy pbufs" OFF)
+set(lwip213_emacps_rx_pool_size 128 CACHE STRING "Number of zero-copy RX pbufs per GEM interface, must exceed the RX descriptors")
+set(lwip213_emacps_num_queues 1 CACHE STRING "Number of GEM priority queues to use, each with its own TX and RX descriptors")
+set(lwip213_rx_poll_budget 0 CACHE STRING "GEM RX frames the input thread polls per iteration after masking RX interrupts, 0 to process frames in the RX interrupt")
+set(lwip213_phy_intr_gpio_pin -1 CACHE STRING "PS GPIO pin the GEM PHY interrupt output is wired to, the link is then checked after PHY interrupts, -1 to poll the PHY")
+set(lwip213_mcdma_rx_queues 1 CACHE STRING "Number of RX queues, each with its own worker thread, the AXI MCDMA channels are spread over (FreeRTOS only)")
+set(lwip213_rx_bd_buf_size 0 CACHE STRING "Size of the buffer of an RX BD, a multiple of 64; larger frames span several BDs and are received into pbuf chains (GEM and AXI DMA), 0 for one buffer per frame")
+option(lwip213_tx_deferred_reclaim "Take completed TX BDs back in batches from the send path instead of the TX interrupt (GEM and AXI DMA)" OFF)
+option(lwip213_emacps_bd_timestamp "Timestamp GEM frames through extended buffer descriptors and carry the timestamps in the pbufs" OFF)
+option(lwip213_pq_lockfree "Use a lock-free multi-producer/single-consumer ring for the adapter packet queues" OFF)
 option(lwip213_temac_tcp_rx_checksum_offload "Offload TCP Receive checksum calculation (hardware support required)" OFF)
 option(lwip213_temac_tcp_tx_checksum_offload "Offload TCP Transmit checksum calculation (hardware support required)" OFF)
 option(lwip213_temac_tcp_ip_rx_checksum_offload "Offload TCP and IP Receive checksum calculation (hardware support required)" OFF)
 option(lwip213_temac_tcp_ip_tx_checksum_offload "Offload TCP and IP Transmit checksum calculation (hardware support required)" OFF)
+option(lwip213_rx_checksum_per_packet "Keep the receive checksum checks of lwIP and skip them only for the frames whose checksums the MAC has verified" OFF)
 set(lwip213_temac_phy_link_speed CONFIG_LINKSPEED_AUTODETECT CACHE STRING "link speed as negotiated by the PHY")
 set_property(CACHE lwip213_temac_phy_link_speed PROPERTY STRINGS CONFIG_LINKSPEED10 CONFIG_LINKSPEED100 CONFIG_LINKSPEED1000 CONFIG_LINKSPEED_AUTODETECT)
 option(lwip213_temac_use_jumbo_frames "use jumbo frames" OFF)
@@ -37,10 +51,12 @@ set(lwip213_memp_num_api_msg 16 CACHE STRING "Number of api msg structures (sock
 set(lwip213_memp_num_tcpip_msg 64 CACHE STRING "Number of tcpip msg structures (socket mode only)")
 
 set(lwip213_pbuf_pool_size 256 CACHE STRING "Number of buffers in pbuf pool.")
+set(lwip213_pbuf_pool_cache 0 CACHE STRING "Free pool pbufs cached per CPU for lock-free allocation, 0 to disable.")
 set(lwip213_pbuf_pool_bufsize 1700 CACHE STRING "Size of each pbuf in pbuf pool.")
 set(lwip213_pbuf_link_hlen 16 CACHE STRING "Number of bytes that should be allocated for a link level header.")
 
 option(lwip213_lwip_tcpip_core_locking_input "TCPIP input core locking" OFF)
+option(lwip213_lwip_fast_mbox "Mailboxes and semaphores on lock-free rings woken by task notifications" OFF)
 set(lwip213_tcpip_mbox_size 200 CACHE STRING "Size of TCPIP mbox queue.")
 set(lwip213_default_tcp_recvmbox_size 200 CACHE STRING "Size of TCP receive mbox queue.")
 set(lwip213_default_udp_recvmbox_size 100 CACHE STRING "Size of UDP receive mbox queue.")
@@ -114,6 +130,14 @@ if(${lwip213_tcp_keepalive})
     set(LWIP_TCP_KEEPALIVE " ")
 endif()
 
+if(${lwip213_arch_chksum})
+    set(LWIP_ARCH_CHKSUM " ")
+endif()
+
+if(${lwip213_tcp_lso})
+    set(LWIP_TCP_LSO " ")
+endif()
+
 if(${sgmii_fixed_link})
     set(SGMII_FIXED_LINK   " ")
 endif()
@@ -145,6 +169,9 @@ set(MEMP_NUM_TCPIP_MSG_INPKT ${lwip213_memp_num_tcpip_msg})
 set(PBUF_POOL_SIZE ${lwip213_pbuf_pool_size})
 set(PBUF_POOL_BUFSIZE ${lwip213_pbuf_pool_bufsize})
 set(PBUF_LINK_HLEN ${lwip213_pbuf_link_hlen})
+if(NOT "${lwip213_pbuf_pool_cache}" STREQUAL "0")
+    set(MEMP_PBUF_POOL_CACHE ${lwip213_pbuf_pool_cache})
+endif()
 
 # ARP options
 set(ARP_TABLE_SIZE ${lwip213_arp_table_size})
@@ -187,6 +214,17 @@ set(TCP_MAXRTX ${lwip213_tcp_maxrtx})
 set(TCP_SYNMAXRTX ${lwip213_tcp_synmaxrtx})
 set(TCP_QUEUE_OOSEQ ${lwip213_tcp_queue_ooseq})
 
+# tcp_wnd is the largest window of a connection and sets the window scale
+set(TCP_RCV_SCALE 0)
+if (${lwip213_tcp_wnd_autotune})
+    set(LWIP_TCP_WND_AUTOTUNE " ")
+    math(EXPR tcp_wnd_scaled "${lwip213_tcp_wnd}")
+    while (tcp_wnd_scaled GREATER 65535)
+        math(EXPR TCP_RCV_SCALE "${TCP_RCV_SCALE} + 1")
+        math(EXPR tcp_wnd_scaled "${lwip213_tcp_wnd} >> ${TCP_RCV_SCALE}")
+    endwhile()
+endif()
+
 ## Checksum handling should be based on the MAC_INSTANCE variable
 list(LENGTH MAC_INSTANCES _len)
 if (${_len} GREATER 1)
@@ -272,6 +310,14 @@ if (${CONFIG_EMACPS})
     endif()
 endif()
 
+if (${lwip213_rx_checksum_per_packet})
+    # The adapters flag the frames the MAC has verified, lwIP checks the rest
+    set(LWIP_CHECKSUM_CHECK_PER_PBUF 1)
+    set(CHECKSUM_CHECK_TCP 1)
+    set(CHECKSUM_CHECK_UDP 1)
+    set(CHECKSUM_CHECK_IP 1)
+endif()
+
 if(("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "microblaze") OR
    ("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "microblazeel") OR
    ("${CMAKE_SYSTEM_PROCESSOR}" STREQUAL "plm_microblaze") OR
@@ -360,6 +406,36 @@ set(XLWIP_CONFIG_N_RX_DESC ${lwip213_n_rx_descriptors})
 set(XLWIP_CONFIG_N_TX_COALESCE ${lwip213_n_tx_coalesce})
 set(XLWIP_CONFIG_N_RX_COALESCE ${lwip213_n_rx_coalesce})
 
+if (${CONFIG_EMACPS} AND ${lwip213_emacps_rx_zerocopy})
+    set(XLWIP_CONFIG_EMACPS_RX_ZEROCOPY 1)
+    set(XLWIP_CONFIG_EMACPS_RX_POOL_SIZE ${lwip213_emacps_rx_pool_size})
+    set(LWIP_SUPPORT_CUSTOM_PBUF 1)
+endif()
+set(XLWIP_CONFIG_EMACPS_NUM_QUEUES ${lwip213_emacps_num_queues})
+if (NOT ${lwip213_rx_poll_budget} EQUAL 0)
+    set(XLWIP_CONFIG_RX_POLL_BUDGET ${lwip213_rx_poll_budget})
+endif()
+# with a suffix, so that pin 0 is not taken for false by #cmakedefine
+if (${CONFIG_EMACPS} AND NOT ${lwip213_phy_intr_gpio_pin} LESS 0)
+    set(XLWIP_CONFIG_PHY_INTR_GPIO_PIN "${lwip213_phy_intr_gpio_pin}U")
+endif()
+if (${lwip213_mcdma_rx_queues} GREATER 1)
+    set(XLWIP_CONFIG_MCDMA_RX_QUEUES ${lwip213_mcdma_rx_queues})
+endif()
+if (NOT ${lwip213_rx_bd_buf_size} EQUAL 0)
+    set(XLWIP_CONFIG_RX_BD_BUF_SIZE ${lwip213_rx_bd_buf_size})
+endif()
+if (${lwip213_tx_deferred_reclaim})
+    set(XLWIP_CONFIG_TX_DEFERRED_RECLAIM 1)
+endif()
+if (${lwip213_pq_lockfree})
+    set(XLWIP_CONFIG_PQ_LOCKFREE 1)
+endif()
+if (${CONFIG_EMACPS} AND ${lwip213_emacps_bd_timestamp})
+    set(XLWIP_CONFIG_EMACPS_BD_TIMESTAMP 1)
+    set(LWIP_PBUF_CUSTOM_DATA "u32_t ts_sec; u32_t ts_nsec;")
+endif()
+
 if(("${CMAKE_SYSTEM_NAME}" STREQUAL "FreeRTOS") AND
    ("${lwip213_api_mode}" STREQUAL SOCKET_API))
     set(OS_IS_FREERTOS " ")
@@ -387,6 +463,9 @@ if(("${CMAKE_SYSTEM_NAME}" STREQUAL "FreeRTOS") AND
     if (${lwip213_lwip_tcpip_core_locking_input})
         set(LWIP_TCPIP_CORE_LOCKING_INPUT 1)
     endif()
+    if (${lwip213_lwip_fast_mbox})
+        set(LWIP_FAST_MBOX 1)
+    endif()
 endif()
 
 
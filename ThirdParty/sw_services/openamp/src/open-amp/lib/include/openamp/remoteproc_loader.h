@@ -101,6 +101,66 @@ struct loader_ops {
 	int (*get_load_state)(void *img_info);
 };
 
+/**
+ * struct remoteproc_seg_ops - segment copy and verification operations
+ *                             of the memory image store
+ * @copy_start: start copying len bytes from src to the target memory at pa
+ *              in io, e.g. with a DMA engine, and return without waiting.
+ *              Returns 0 on success, negative value on failure.
+ * @copy_wait: wait for the copy started by copy_start to complete.
+ *             Returns 0 on success, negative value on failure.
+ * @verify: optional, feed len bytes at offset of the image, located at
+ *          src, to the verification of the image, e.g. a SHA-256 or SHA3
+ *          update. It runs while the copy of the segment is in flight.
+ *          Returns 0 on success, negative value to abort the load.
+ *
+ * If copy_start is NULL, the segments are written by the CPU.
+ */
+struct remoteproc_seg_ops {
+	int (*copy_start)(void *priv, metal_phys_addr_t pa,
+			  struct metal_io_region *io,
+			  const void *src, size_t len);
+	int (*copy_wait)(void *priv);
+	int (*verify)(void *priv, size_t offset, const void *src, size_t len);
+};
+
+/**
+ * struct remoteproc_mem_store - image store of an executable image which
+ *                               is already in local memory
+ * @img: start of the image
+ * @size: size of the image
+ * @ops: segment copy and verification operations, NULL to copy with the CPU
+ * @priv: private data passed to the segment operations
+ */
+struct remoteproc_mem_store {
+	const void *img;
+	size_t size;
+	const struct remoteproc_seg_ops *ops;
+	void *priv;
+};
+
+/* Image store operations of struct remoteproc_mem_store */
+extern const struct image_store_ops remoteproc_mem_store_ops;
+
+/**
+ * remoteproc_mem_store_init
+ *
+ * Initialize a memory image store, to be passed to remoteproc_load() with
+ * remoteproc_mem_store_ops. The path argument of remoteproc_load() is not
+ * used. With remoteproc_load_noblock(), the target data can be loaded by
+ * calling remoteproc_mem_store_ops.load() with the returned pa and io.
+ *
+ * @store: pointer to the memory image store
+ * @img: start of the image
+ * @size: size of the image
+ * @ops: segment copy and verification operations, can be NULL
+ * @priv: private data passed to the segment operations
+ */
+void remoteproc_mem_store_init(struct remoteproc_mem_store *store,
+			       const void *img, size_t size,
+			       const struct remoteproc_seg_ops *ops,
+			       void *priv);
+
 #if defined __cplusplus
 }
 #endif
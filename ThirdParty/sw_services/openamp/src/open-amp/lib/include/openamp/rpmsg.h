@@ -89,6 +89,10 @@ struct rpmsg_endpoint {
  * @get_tx_payload_buffer: get RPMsg TX buffer
  * @send_offchannel_nocopy: send RPMsg data without copy
  * @release_tx_buffer: release RPMsg TX buffer
+ * @send_offchannel_nocopy_batch: send several RPMsg buffers without copy,
+ *                                notifying the remote once
+ * @release_rx_buffers: release several RPMsg RX buffers, notifying the
+ *                      remote once
  */
 struct rpmsg_device_ops {
 	int (*send_offchannel_raw)(struct rpmsg_device *rdev,
@@ -102,6 +106,12 @@ struct rpmsg_device_ops {
 				      uint32_t src, uint32_t dst,
 				       const void *data, int len);
 	int (*release_tx_buffer)(struct rpmsg_device *rdev, void *txbuf);
+	int (*send_offchannel_nocopy_batch)(struct rpmsg_device *rdev,
+					    uint32_t src, uint32_t dst,
+					    void * const *data,
+					    const int *len, int count);
+	void (*release_rx_buffers)(struct rpmsg_device *rdev,
+				   void * const *rxbufs, int count);
 };
 
 /**
@@ -326,6 +336,21 @@ void rpmsg_hold_rx_buffer(struct rpmsg_endpoint *ept, void *rxbuf);
  */
 void rpmsg_release_rx_buffer(struct rpmsg_endpoint *ept, void *rxbuf);
 
+/**
+ * @brief Releases several held rx buffers for future reuse in vring.
+ *
+ * Same as calling rpmsg_release_rx_buffer() for each buffer, but the remote
+ * processor is notified once for the whole batch.
+ *
+ * @ept: the rpmsg endpoint
+ * @rxbufs: rx buffers with message payload
+ * @count: number of buffers in rxbufs
+ *
+ * @see rpmsg_release_rx_buffer
+ */
+void rpmsg_release_rx_buffers(struct rpmsg_endpoint *ept, void * const *rxbufs,
+			      int count);
+
 /**
  * @brief Gets the tx buffer for message payload.
  *
@@ -482,6 +507,85 @@ static inline int rpmsg_send_nocopy(struct rpmsg_endpoint *ept,
 					    ept->dest_addr, data, len);
 }
 
+/**
+ * rpmsg_send_offchannel_nocopy_batch() - send several messages in tx buffers
+ * reserved by rpmsg_get_tx_payload_buffer() across to the remote processor.
+ *
+ * Same as calling rpmsg_send_offchannel_nocopy() for each buffer, but all
+ * the buffers are placed on the vring before the remote processor is
+ * notified, once for the whole batch.
+ *
+ * @ept:   The rpmsg endpoint
+ * @src:   The rpmsg endpoint local address
+ * @dst:   The rpmsg endpoint remote address
+ * @data:  TX buffers with message filled
+ * @len:   Length of payload of each buffer
+ * @count: Number of buffers in data
+ *
+ * @return number of messages it has sent or negative error value on failure.
+ *
+ * @see rpmsg_send_offchannel_nocopy
+ * @see rpmsg_sendto_nocopy_batch
+ * @see rpmsg_send_nocopy_batch
+ */
+int rpmsg_send_offchannel_nocopy_batch(struct rpmsg_endpoint *ept,
+				       uint32_t src, uint32_t dst,
+				       void * const *data, const int *len,
+				       int count);
+
+/**
+ * rpmsg_sendto_nocopy_batch() - send several messages in tx buffers reserved
+ * by rpmsg_get_tx_payload_buffer() to the dst address, notifying the remote
+ * processor once.
+ *
+ * @ept:   The rpmsg endpoint
+ * @data:  TX buffers with message filled
+ * @len:   Length of payload of each buffer
+ * @count: Number of buffers in data
+ * @dst:   Destination address
+ *
+ * @return number of messages it has sent or negative error value on failure.
+ *
+ * @see rpmsg_send_offchannel_nocopy_batch
+ */
+static inline int rpmsg_sendto_nocopy_batch(struct rpmsg_endpoint *ept,
+					    void * const *data,
+					    const int *len, int count,
+					    uint32_t dst)
+{
+	if (!ept)
+		return RPMSG_ERR_PARAM;
+
+	return rpmsg_send_offchannel_nocopy_batch(ept, ept->addr, dst, data,
+						  len, count);
+}
+
+/**
+ * rpmsg_send_nocopy_batch() - send several messages in tx buffers reserved by
+ * rpmsg_get_tx_payload_buffer() on the ept endpoint, notifying the remote
+ * processor once.
+ *
+ * @ept:   The rpmsg endpoint
+ * @data:  TX buffers with message filled
+ * @len:   Length of payload of each buffer
+ * @count: Number of buffers in data
+ *
+ * @return number of messages it has sent or negative error value on failure.
+ *
+ * @see rpmsg_send_offchannel_nocopy_batch
+ */
+static inline int rpmsg_send_nocopy_batch(struct rpmsg_endpoint *ept,
+					  void * const *data,
+					  const int *len, int count)
+{
+	if (!ept)
+		return RPMSG_ERR_PARAM;
+
+	return rpmsg_send_offchannel_nocopy_batch(ept, ept->addr,
+						  ept->dest_addr, data, len,
+						  count);
+}
+
 /**
  * rpmsg_create_ept - create rpmsg endpoint and register it to rpmsg device
  *
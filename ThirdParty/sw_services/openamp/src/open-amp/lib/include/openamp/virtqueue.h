@@ -88,6 +88,12 @@ struct virtqueue {
 	 */
 	uint16_t vq_available_idx;
 
+	/*
+	 * Set while callbacks are disabled, so that consuming buffers does
+	 * not re-arm the event index published by virtqueue_disable_cb().
+	 */
+	bool vq_cb_disabled;
+
 #ifdef VQUEUE_DEBUG
 	bool vq_inuse;
 #endif
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Image store of an executable image which is already in local memory,
+ * e.g. read to DDR by a boot loader or received from the host.
+ *
+ * Headers are parsed in place. Segments are copied to the target memory
+ * with the CPU, or with the copy operations given to the store, usually a
+ * DMA engine. While the engine copies a segment, the CPU feeds the same
+ * source bytes to the verify operation, so hashing the image adds little
+ * to the load time.
+ */
+
+#include <metal/cache.h>
+#include <metal/io.h>
+#include <metal/log.h>
+#include <openamp/remoteproc.h>
+#include <openamp/remoteproc_loader.h>
+
+static int remoteproc_mem_store_open(void *store, const char *path,
+				     const void **img_data)
+{
+	struct remoteproc_mem_store *mstore = store;
+
+	(void)path;
+	if (!mstore || !mstore->img || !mstore->size)
+		return -RPROC_EINVAL;
+	*img_data = mstore->img;
+
+	return (int)mstore->size;
+}
+
+static void remoteproc_mem_store_close(void *store)
+{
+	(void)store;
+}
+
+static int remoteproc_mem_store_copy(struct remoteproc_mem_store *mstore,
+				     size_t offset, const void *src,
+				     size_t size, metal_phys_addr_t pa,
+				     struct metal_io_region *io, void *dst)
+{
+	const struct remoteproc_seg_ops *ops = mstore->ops;
+	int ret = 0;
+	int wret;
+
+	if (!ops || !ops->copy_start) {
+		ret = metal_io_block_write(io, metal_io_phys_to_offset(io, pa),
+					   src, size);
+		if (ret != (int)size)
+			return -RPROC_EINVAL;
+		metal_io_cache_flush(io, dst, size);
+		if (ops && ops->verify)
+			ret = ops->verify(mstore->priv, offset, src, size);
+		return ret < 0 ? ret : (int)size;
+	}
+
+	/* The engine reads the source from memory and writes the target
+	 * behind the cache of this CPU.
+	 */
+	metal_cache_flush((void *)src, size);
+	metal_io_cache_invalidate(io, dst, size);
+
+	ret = ops->copy_start(mstore->priv, pa, io, src, size);
+	if (ret < 0) {
+		metal_log(METAL_LOG_ERROR,
+			  "mem store: copy start failed 0x%lx, 0x%lx\r\n",
+			  (unsigned long)pa, (unsigned long)size);
+		return ret;
+	}
+	if (ops->verify)
+		ret = ops->verify(mstore->priv, offset, src, size);
+	/* Always wait, the engine must be idle before the next segment */
+	wret = ops->copy_wait(mstore->priv);
+	if (wret < 0) {
+		metal_log(METAL_LOG_ERROR,
+			  "mem store: copy failed 0x%lx, 0x%lx\r\n",
+			  (unsigned long)pa, (unsigned long)size);
+		return wret;
+	}
+
+	return ret < 0 ? ret : (int)size;
+}
+
+static int remoteproc_mem_store_load(void *store, size_t offset, size_t size,
+				     const void **data, metal_phys_addr_t pa,
+				     struct metal_io_region *io,
+				     char is_blocking)
+{
+	struct remoteproc_mem_store *mstore = store;
+	const unsigned char *src;
+	void *dst;
+	int ret;
+
+	(void)is_blocking;
+	if (offset > mstore->size || size > mstore->size - offset) {
+		metal_log(METAL_LOG_ERROR,
+			  "mem store: 0x%lx, 0x%lx is out of the image\r\n",
+			  (unsigned long)offset, (unsigned long)size);
+		return -RPROC_EINVAL;
+	}
+	src = (const unsigned char *)mstore->img + offset;
+
+	if (size == 0)
+		return 0;
+	if (pa == RPROC_LOAD_ANYADDR) {
+		/* Headers are used in place */
+		*data = src;
+		return (int)size;
+	}
+
+	dst = metal_io_phys_to_virt(io, pa);
+	if (!dst || metal_io_phys_to_virt(io, pa + size - 1) == NULL) {
+		metal_log(METAL_LOG_ERROR,
+			  "mem store: no mapping for 0x%lx, 0x%lx\r\n",
+			  (unsigned long)pa, (unsigned long)size);
+		return -RPROC_EINVAL;
+	}
+
+	ret = remoteproc_mem_store_copy(mstore, offset, src, size, pa, io,
+					dst);
+	if (ret < 0)
+		metal_log(METAL_LOG_ERROR,
+			  "mem store: load failed 0x%lx, %d\r\n",
+			  (unsigned long)offset, ret);
+
+	return ret;
+}
+
+const struct image_store_ops remoteproc_mem_store_ops = {
+	.open = remoteproc_mem_store_open,
+	.close = remoteproc_mem_store_close,
+	.load = remoteproc_mem_store_load,
+	.features = SUPPORT_SEEK,
+};
+
+void remoteproc_mem_store_init(struct remoteproc_mem_store *store,
+			       const void *img, size_t size,
+			       const struct remoteproc_seg_ops *ops,
+			       void *priv)
+{
+	store->img = img;
+	store->size = size;
+	store->ops = ops;
+	store->priv = priv;
+}
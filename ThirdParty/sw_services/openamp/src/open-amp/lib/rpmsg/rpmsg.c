@@ -170,6 +170,25 @@ void rpmsg_release_rx_buffer(struct rpmsg_endpoint *ept, void *rxbuf)
 		rdev->ops.release_rx_buffer(rdev, rxbuf);
 }
 
+void rpmsg_release_rx_buffers(struct rpmsg_endpoint *ept, void * const *rxbufs,
+			      int count)
+{
+	struct rpmsg_device *rdev;
+	int i;
+
+	if (!ept || !ept->rdev || !rxbufs || count <= 0)
+		return;
+
+	rdev = ept->rdev;
+
+	if (rdev->ops.release_rx_buffers) {
+		rdev->ops.release_rx_buffers(rdev, rxbufs, count);
+	} else if (rdev->ops.release_rx_buffer) {
+		for (i = 0; i < count; i++)
+			rdev->ops.release_rx_buffer(rdev, rxbufs[i]);
+	}
+}
+
 int rpmsg_release_tx_buffer(struct rpmsg_endpoint *ept, void *buf)
 {
 	struct rpmsg_device *rdev;
@@ -218,6 +237,45 @@ int rpmsg_send_offchannel_nocopy(struct rpmsg_endpoint *ept, uint32_t src,
 	return RPMSG_ERR_PARAM;
 }
 
+int rpmsg_send_offchannel_nocopy_batch(struct rpmsg_endpoint *ept,
+				       uint32_t src, uint32_t dst,
+				       void * const *data, const int *len,
+				       int count)
+{
+	struct rpmsg_device *rdev;
+	int status;
+	int i;
+
+	if (!ept || !ept->rdev || !data || !len || count <= 0 ||
+	    dst == RPMSG_ADDR_ANY)
+		return RPMSG_ERR_PARAM;
+
+	for (i = 0; i < count; i++) {
+		if (!data[i] || len[i] < 0)
+			return RPMSG_ERR_PARAM;
+	}
+
+	rdev = ept->rdev;
+
+	if (rdev->ops.send_offchannel_nocopy_batch)
+		return rdev->ops.send_offchannel_nocopy_batch(rdev, src, dst,
+							      data, len,
+							      count);
+
+	/* No batch support in the device, send the messages one by one */
+	if (!rdev->ops.send_offchannel_nocopy)
+		return RPMSG_ERR_PARAM;
+
+	for (i = 0; i < count; i++) {
+		status = rdev->ops.send_offchannel_nocopy(rdev, src, dst,
+							  data[i], len[i]);
+		if (status < 0)
+			return i ? i : status;
+	}
+
+	return count;
+}
+
 struct rpmsg_endpoint *rpmsg_get_endpoint(struct rpmsg_device *rdev,
 					  const char *name, uint32_t addr,
 					  uint32_t dest_addr)
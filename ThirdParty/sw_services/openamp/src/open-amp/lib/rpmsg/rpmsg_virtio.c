@@ -131,10 +131,6 @@ static int rpmsg_virtio_enqueue_buffer(struct rpmsg_virtio_device *rvdev,
 {
 	unsigned int role = rpmsg_virtio_get_role(rvdev);
 
-#ifdef VIRTIO_CACHED_BUFFERS
-	metal_cache_flush(buffer, len);
-#endif /* VIRTIO_CACHED_BUFFERS */
-
 #ifndef VIRTIO_DEVICE_ONLY
 	if (role == RPMSG_HOST) {
 		struct virtqueue_buf vqbuf;
@@ -244,7 +240,8 @@ static void *rpmsg_virtio_get_rx_buffer(struct rpmsg_virtio_device *rvdev,
 
 #ifdef VIRTIO_CACHED_BUFFERS
 	/* Invalidate the buffer before returning it */
-	metal_cache_invalidate(data, *len);
+	if (data)
+		metal_io_cache_invalidate(rvdev->shbuf_io, data, *len);
 #endif /* VIRTIO_CACHED_BUFFERS */
 
 	return data;
@@ -329,28 +326,53 @@ static void rpmsg_virtio_hold_rx_buffer(struct rpmsg_device *rdev, void *rxbuf)
 	rp_hdr->reserved |= RPMSG_BUF_HELD;
 }
 
-static void rpmsg_virtio_release_rx_buffer(struct rpmsg_device *rdev,
-					   void *rxbuf)
+/* Returns a held rx buffer on the virtqueue, called with the device locked */
+static void rpmsg_virtio_return_held_buffer(struct rpmsg_virtio_device *rvdev,
+					    void *rxbuf)
 {
-	struct rpmsg_virtio_device *rvdev;
 	struct rpmsg_hdr *rp_hdr;
 	uint16_t idx;
 	uint32_t len;
 
-	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
 	rp_hdr = RPMSG_LOCATE_HDR(rxbuf);
 	/* The reserved field contains buffer index */
 	idx = (uint16_t)(rp_hdr->reserved & ~RPMSG_BUF_HELD);
 
-	metal_mutex_acquire(&rdev->lock);
-	/* Return buffer on virtqueue. */
 	len = virtqueue_get_buffer_length(rvdev->rvq, idx);
 	rpmsg_virtio_return_buffer(rvdev, rp_hdr, len, idx);
+}
+
+static void rpmsg_virtio_release_rx_buffer(struct rpmsg_device *rdev,
+					   void *rxbuf)
+{
+	struct rpmsg_virtio_device *rvdev;
+
+	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
+
+	metal_mutex_acquire(&rdev->lock);
+	/* Return buffer on virtqueue. */
+	rpmsg_virtio_return_held_buffer(rvdev, rxbuf);
 	/* Tell peer we return some rx buffers */
 	virtqueue_kick(rvdev->rvq);
 	metal_mutex_release(&rdev->lock);
 }
 
+static void rpmsg_virtio_release_rx_buffers(struct rpmsg_device *rdev,
+					    void * const *rxbufs, int count)
+{
+	struct rpmsg_virtio_device *rvdev;
+	int i;
+
+	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
+
+	metal_mutex_acquire(&rdev->lock);
+	for (i = 0; i < count; i++)
+		rpmsg_virtio_return_held_buffer(rvdev, rxbufs[i]);
+	/* Tell peer we return the rx buffers, once for the whole batch */
+	virtqueue_kick(rvdev->rvq);
+	metal_mutex_release(&rdev->lock);
+}
+
 static void *rpmsg_virtio_get_tx_payload_buffer(struct rpmsg_device *rdev,
 						uint32_t *len, int wait)
 {
@@ -395,24 +417,34 @@ static void *rpmsg_virtio_get_tx_payload_buffer(struct rpmsg_device *rdev,
 	return RPMSG_LOCATE_DATA(rp_hdr);
 }
 
-static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
-					       uint32_t src, uint32_t dst,
-					       const void *data, int len)
+/**
+ * rpmsg_virtio_fill_tx_hdr
+ *
+ * Writes the RPMsg header of a tx buffer reserved by
+ * rpmsg_virtio_get_tx_payload_buffer.
+ *
+ * @param rvdev - pointer to rpmsg virtio device
+ * @param src   - source address of channel
+ * @param dst   - destination address of channel
+ * @param data  - tx payload buffer
+ * @param len   - size of data
+ * @param idx   - returns the buffer index
+ *
+ * @return - pointer to the buffer header
+ */
+static struct rpmsg_hdr *
+rpmsg_virtio_fill_tx_hdr(struct rpmsg_virtio_device *rvdev, uint32_t src,
+			 uint32_t dst, const void *data, int len,
+			 uint16_t *idx)
 {
-	struct rpmsg_virtio_device *rvdev;
 	struct metal_io_region *io;
 	struct rpmsg_hdr rp_hdr;
 	struct rpmsg_hdr *hdr;
-	uint32_t buff_len;
-	uint16_t idx;
 	int status;
 
-	/* Get the associated remote device for channel. */
-	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
-
 	hdr = RPMSG_LOCATE_HDR(data);
 	/* The reserved field contains buffer index */
-	idx = hdr->reserved;
+	*idx = hdr->reserved;
 
 	/* Initialize RPMSG header. */
 	rp_hdr.dst = dst;
@@ -427,7 +459,24 @@ static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
 				      &rp_hdr, sizeof(rp_hdr));
 	RPMSG_ASSERT(status == sizeof(rp_hdr), "failed to write header\r\n");
 
-	metal_mutex_acquire(&rdev->lock);
+	return hdr;
+}
+
+/**
+ * rpmsg_virtio_enqueue_tx_buffer
+ *
+ * Places a filled tx buffer on the virtqueue without notifying the other
+ * side, called with the device locked.
+ *
+ * @param rvdev - pointer to rpmsg virtio device
+ * @param hdr   - buffer header
+ * @param idx   - buffer index
+ */
+static void rpmsg_virtio_enqueue_tx_buffer(struct rpmsg_virtio_device *rvdev,
+					   struct rpmsg_hdr *hdr, uint16_t idx)
+{
+	uint32_t buff_len;
+	int status;
 
 #ifndef VIRTIO_DEVICE_ONLY
 	if (rpmsg_virtio_get_role(rvdev) == RPMSG_HOST)
@@ -436,9 +485,33 @@ static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
 #endif /*!VIRTIO_DEVICE_ONLY*/
 		buff_len = virtqueue_get_buffer_length(rvdev->svq, idx);
 
+#ifdef VIRTIO_CACHED_BUFFERS
+	/* Only the header and payload were written, flush just those */
+	metal_io_cache_flush(rvdev->shbuf_io, hdr,
+			     sizeof(struct rpmsg_hdr) + hdr->len);
+#endif /* VIRTIO_CACHED_BUFFERS */
+
 	/* Enqueue buffer on virtqueue. */
 	status = rpmsg_virtio_enqueue_buffer(rvdev, hdr, buff_len, idx);
 	RPMSG_ASSERT(status == VQUEUE_SUCCESS, "failed to enqueue buffer\r\n");
+}
+
+static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
+					       uint32_t src, uint32_t dst,
+					       const void *data, int len)
+{
+	struct rpmsg_virtio_device *rvdev;
+	struct rpmsg_hdr *hdr;
+	uint16_t idx;
+
+	/* Get the associated remote device for channel. */
+	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
+
+	hdr = rpmsg_virtio_fill_tx_hdr(rvdev, src, dst, data, len, &idx);
+
+	metal_mutex_acquire(&rdev->lock);
+
+	rpmsg_virtio_enqueue_tx_buffer(rvdev, hdr, idx);
 	/* Let the other side know that there is a job to process. */
 	virtqueue_kick(rvdev->svq);
 
@@ -447,6 +520,35 @@ static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
 	return len;
 }
 
+static int
+rpmsg_virtio_send_offchannel_nocopy_batch(struct rpmsg_device *rdev,
+					  uint32_t src, uint32_t dst,
+					  void * const *data, const int *len,
+					  int count)
+{
+	struct rpmsg_virtio_device *rvdev;
+	struct rpmsg_hdr *hdr;
+	uint16_t idx;
+	int i;
+
+	/* Get the associated remote device for channel. */
+	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
+
+	metal_mutex_acquire(&rdev->lock);
+
+	for (i = 0; i < count; i++) {
+		hdr = rpmsg_virtio_fill_tx_hdr(rvdev, src, dst, data[i],
+					       len[i], &idx);
+		rpmsg_virtio_enqueue_tx_buffer(rvdev, hdr, idx);
+	}
+	/* One notification for the whole batch. */
+	virtqueue_kick(rvdev->svq);
+
+	metal_mutex_release(&rdev->lock);
+
+	return count;
+}
+
 static int rpmsg_virtio_release_tx_buffer(struct rpmsg_device *rdev, void *txbuf)
 {
 	struct rpmsg_virtio_device *rvdev;
@@ -718,6 +820,9 @@ int rpmsg_init_vdev_with_config(struct rpmsg_virtio_device *rvdev,
 	rdev->ops.get_tx_payload_buffer = rpmsg_virtio_get_tx_payload_buffer;
 	rdev->ops.send_offchannel_nocopy = rpmsg_virtio_send_offchannel_nocopy;
 	rdev->ops.release_tx_buffer = rpmsg_virtio_release_tx_buffer;
+	rdev->ops.send_offchannel_nocopy_batch =
+		rpmsg_virtio_send_offchannel_nocopy_batch;
+	rdev->ops.release_rx_buffers = rpmsg_virtio_release_rx_buffers;
 	role = rpmsg_virtio_get_role(rvdev);
 
 #ifndef VIRTIO_DEVICE_ONLY
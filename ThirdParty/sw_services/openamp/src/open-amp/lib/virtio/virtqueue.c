@@ -215,6 +215,14 @@ void *virtqueue_get_buffer(struct virtqueue *vq, uint32_t *len, uint16_t *idx)
 
 	if (idx)
 		*idx = used_idx;
+
+	/* Ask the device to notify on the next used buffer */
+	if ((vq->vq_dev->features & VIRTIO_RING_F_EVENT_IDX) &&
+	    !vq->vq_cb_disabled) {
+		vring_used_event(&vq->vq_ring) = vq->vq_used_cons_idx;
+		VRING_FLUSH(vring_used_event(&vq->vq_ring));
+		atomic_thread_fence(memory_order_seq_cst);
+	}
 	VQUEUE_IDLE(vq);
 
 	return cookie;
@@ -288,6 +296,14 @@ void *virtqueue_get_available_buffer(struct virtqueue *vq, uint16_t *avail_idx,
 	buffer = virtqueue_phys_to_virt(vq, vq->vq_ring.desc[*avail_idx].addr);
 	*len = vq->vq_ring.desc[*avail_idx].len;
 
+	/* Ask the driver to notify on the next available buffer */
+	if ((vq->vq_dev->features & VIRTIO_RING_F_EVENT_IDX) &&
+	    !vq->vq_cb_disabled) {
+		vring_avail_event(&vq->vq_ring) = vq->vq_available_idx;
+		VRING_FLUSH(vring_avail_event(&vq->vq_ring));
+		atomic_thread_fence(memory_order_seq_cst);
+	}
+
 	VQUEUE_IDLE(vq);
 
 	return buffer;
@@ -347,6 +363,8 @@ int virtqueue_add_consumed_buffer(struct virtqueue *vq, uint16_t head_idx,
  */
 int virtqueue_enable_cb(struct virtqueue *vq)
 {
+	vq->vq_cb_disabled = false;
+
 	return vq_ring_enable_interrupt(vq, 0);
 }
 
@@ -360,6 +378,8 @@ void virtqueue_disable_cb(struct virtqueue *vq)
 {
 	VQUEUE_BUSY(vq);
 
+	vq->vq_cb_disabled = true;
+
 	if (vq->vq_dev->features & VIRTIO_RING_F_EVENT_IDX) {
 #ifndef VIRTIO_DEVICE_ONLY
 		if (vq->vq_dev->role == VIRTIO_DEV_DRIVER) {
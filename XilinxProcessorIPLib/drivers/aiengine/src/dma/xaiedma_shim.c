@@ -22,6 +22,7 @@
 * 1.3  Hyun    01/08/2019  Use the poll function
 * 1.4  Hyun    06/20/2019  Added APIs for individual BD / Channel reset
 * 1.5  Hyun    06/20/2019  Add XAieDma_ShimSoftInitialize()
+* 1.6  fl      10/14/2026  Add the BD streaming engine
 * </pre>
 *
 ******************************************************************************/
@@ -593,6 +594,274 @@ u8 XAieDma_ShimPendingBdCount(XAieDma_Shim *DmaInstPtr, u32 ChNum)
 	return StartQSize;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API initializes a stream over a Shim DMA channel. The stream owns BDs
+* FirstBd to FirstBd + NumBds - 1 and hands them a queued buffer each time
+* the channel is done with one of them.
+*
+* @param	StrmPtr - Pointer to the Shim DMA stream.
+* @param	DmaInstPtr - Pointer to the Shim DMA instance.
+* @param	ChNum - Channel number (0-S2MM0,1-S2MM1,2-MM2S0,3-MM2S1).
+* @param	FirstBd - First BD of the stream.
+* @param	NumBds - Number of BDs, 2 for ping-pong, up to the start queue
+*		depth (4).
+* @param	DoneFunc - Called with every completed buffer, or NULL.
+* @param	CallbackRef - Passed to DoneFunc.
+*
+* @return	XAIE_SUCCESS if successful, else XAIE_FAILURE.
+*
+* @note		The AXI and packet attributes of the BDs are kept, set them
+*		with XAieDma_ShimBdSetAxi() and XAieDma_ShimBdSetPkt() before
+*		the stream starts.
+*
+*******************************************************************************/
+u32 XAieDma_ShimStrmInit(XAieDma_ShimStrm *StrmPtr, XAieDma_Shim *DmaInstPtr,
+		u8 ChNum, u8 FirstBd, u8 NumBds,
+		XAieDma_ShimStrmDoneFunc DoneFunc, void *CallbackRef)
+{
+	u8 BdIdx;
+
+	XAie_AssertNonvoid(StrmPtr != XAIE_NULL);
+	XAie_AssertNonvoid(DmaInstPtr != XAIE_NULL);
+	XAie_AssertNonvoid(ChNum < XAIEDMA_SHIM_MAX_NUM_CHANNELS);
+
+	if ((NumBds == 0U) || (NumBds > XAIEGBL_NOC_DMASTA_STARTQ_MAX) ||
+			((FirstBd + NumBds) > XAIEDMA_SHIM_MAX_NUM_DESCRS)) {
+		return XAIE_FAILURE;
+	}
+
+	StrmPtr->DmaInstPtr = DmaInstPtr;
+	StrmPtr->ChNum = ChNum;
+	StrmPtr->FirstBd = FirstBd;
+	StrmPtr->NumBds = NumBds;
+	StrmPtr->LockEn = XAIE_DISABLE;
+	StrmPtr->LockBase = 0U;
+	StrmPtr->LkAcqVal = XAIEDMA_SHIM_LKACQRELVAL_INVALID;
+	StrmPtr->LkRelVal = XAIEDMA_SHIM_LKACQRELVAL_INVALID;
+	StrmPtr->Running = 0U;
+	StrmPtr->Head = 0U;
+	StrmPtr->Issued = 0U;
+	StrmPtr->Done = 0U;
+	StrmPtr->DoneFunc = DoneFunc;
+	StrmPtr->CallbackRef = CallbackRef;
+
+	/* Every buffer runs on a BD of its own, BDs are never chained */
+	for (BdIdx = FirstBd; BdIdx < (FirstBd + NumBds); BdIdx++) {
+		DmaInstPtr->Descrs[BdIdx].NextBdEn = XAIE_DISABLE;
+		DmaInstPtr->Descrs[BdIdx].NextBd = 0U;
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API makes the BDs of a stream acquire and release locks, to
+* synchronize the buffers with the AIE graph. BD FirstBd + N uses lock
+* LockBase + N.
+*
+* @param	StrmPtr - Pointer to the Shim DMA stream.
+* @param	LockBase - Lock of the first BD.
+* @param	LkAcqVal - Lock acquire value (Valid:0/1 & Invalid:0xFF).
+* @param	LkRelVal - Lock release value (Valid:0/1 & Invalid:0xFF).
+*
+* @return	None.
+*
+* @note		Call it before XAieDma_ShimStrmStart().
+*
+*******************************************************************************/
+void XAieDma_ShimStrmSetLock(XAieDma_ShimStrm *StrmPtr, u8 LockBase,
+		u8 LkAcqVal, u8 LkRelVal)
+{
+	u8 BdIdx;
+
+	XAie_AssertVoid(StrmPtr != XAIE_NULL);
+	XAie_AssertVoid((LockBase + StrmPtr->NumBds) <=
+			XAIEDMA_SHIM_MAX_NUM_LOCKS);
+
+	StrmPtr->LockEn = XAIE_ENABLE;
+	StrmPtr->LockBase = LockBase;
+	StrmPtr->LkAcqVal = LkAcqVal;
+	StrmPtr->LkRelVal = LkRelVal;
+
+	for (BdIdx = 0U; BdIdx < StrmPtr->NumBds; BdIdx++) {
+		XAieDma_ShimBdSetLock(StrmPtr->DmaInstPtr,
+				StrmPtr->FirstBd + BdIdx, LockBase + BdIdx,
+				XAIE_ENABLE, LkRelVal, XAIE_ENABLE, LkAcqVal);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds a host buffer to the queue of a stream. A running stream
+* hands it to a BD in XAieDma_ShimStrmService().
+*
+* @param	StrmPtr - Pointer to the Shim DMA stream.
+* @param	Addr - Buffer address (128-bit aligned, 48 bits).
+* @param	Length - Buffer length in bytes (32-bit aligned).
+* @param	Priv - User data passed back with the completed buffer.
+*
+* @return	XAIE_SUCCESS if queued, XAIE_FAILURE if the queue is full.
+*
+* @note		Only one context may queue buffers of a stream. It may be the
+*		completion callback.
+*
+*******************************************************************************/
+u32 XAieDma_ShimStrmQueue(XAieDma_ShimStrm *StrmPtr, u64 Addr, u32 Length,
+		void *Priv)
+{
+	XAieDma_ShimStrmBuf *BufPtr;
+	u32 Head;
+
+	XAie_AssertNonvoid(StrmPtr != XAIE_NULL);
+	XAie_AssertNonvoid((Addr & XAIEDMA_SHIM_ADDRLOW_ALIGN_MASK) == 0U);
+	XAie_AssertNonvoid((Length & XAIEDMA_SHIM_TXFER_LEN32_MASK) == 0U);
+
+	Head = StrmPtr->Head;
+	if ((Head - __atomic_load_n(&StrmPtr->Done, __ATOMIC_ACQUIRE)) >=
+			XAIEDMA_SHIM_STRM_MAX_BUFS) {
+		return XAIE_FAILURE;
+	}
+
+	BufPtr = &StrmPtr->Bufs[Head % XAIEDMA_SHIM_STRM_MAX_BUFS];
+	BufPtr->Addr = Addr;
+	BufPtr->Length = Length;
+	BufPtr->Priv = Priv;
+	__atomic_store_n(&StrmPtr->Head, Head + 1U, __ATOMIC_RELEASE);
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API hands queued buffers to the free BDs of a stream and pushes the
+* BDs to the start queue of the channel.
+*
+* @param	StrmPtr - Pointer to the Shim DMA stream.
+*
+* @return	None.
+*
+* @note		The BDs are used in order, so they complete in order.
+*
+*******************************************************************************/
+static void XAieDma_ShimStrmRefill(XAieDma_ShimStrm *StrmPtr)
+{
+	XAieDma_ShimStrmBuf *BufPtr;
+	u32 Head;
+	u8 BdNum;
+
+	Head = __atomic_load_n(&StrmPtr->Head, __ATOMIC_ACQUIRE);
+	while ((StrmPtr->Issued != Head) &&
+			((StrmPtr->Issued - StrmPtr->Done) < StrmPtr->NumBds)) {
+		BufPtr = &StrmPtr->Bufs[StrmPtr->Issued %
+			XAIEDMA_SHIM_STRM_MAX_BUFS];
+		BdNum = StrmPtr->FirstBd + (StrmPtr->Issued % StrmPtr->NumBds);
+
+		XAieDma_ShimBdSetAddr(StrmPtr->DmaInstPtr, BdNum,
+				(u16)(BufPtr->Addr >> 32U), (u32)BufPtr->Addr,
+				BufPtr->Length);
+		XAieDma_ShimBdWrite(StrmPtr->DmaInstPtr, BdNum);
+		XAieDma_ShimSetStartBd(StrmPtr->DmaInstPtr, StrmPtr->ChNum,
+				BdNum);
+		StrmPtr->Issued++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API enables the channel of a stream and starts the queued buffers.
+*
+* @param	StrmPtr - Pointer to the Shim DMA stream.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieDma_ShimStrmStart(XAieDma_ShimStrm *StrmPtr)
+{
+	XAie_AssertVoid(StrmPtr != XAIE_NULL);
+
+	XAieDma_ShimChControl(StrmPtr->DmaInstPtr, StrmPtr->ChNum,
+			XAIE_DISABLE, XAIE_DISABLE, XAIE_ENABLE);
+	StrmPtr->Running = 1U;
+	XAieDma_ShimStrmRefill(StrmPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API retires the buffers the channel of a stream is done with and
+* refills the freed BDs with queued buffers.
+*
+* @param	StrmPtr - Pointer to the Shim DMA stream.
+*
+* @return	Number of buffers completed.
+*
+* @note		Call it from a poll loop or from the interrupt handler of the
+*		DMA events routed to the PS. Only one context may service a
+*		stream. The completion callback runs in that context.
+*
+*******************************************************************************/
+u32 XAieDma_ShimStrmService(XAieDma_ShimStrm *StrmPtr)
+{
+	XAieDma_ShimStrmBuf Buf;
+	u32 InFlight, Pending, Completed, Idx;
+
+	XAie_AssertNonvoid(StrmPtr != XAIE_NULL);
+
+	if (StrmPtr->Running == 0U) {
+		return 0U;
+	}
+
+	/* BDs complete in order, the oldest ones not pending are done */
+	InFlight = StrmPtr->Issued - StrmPtr->Done;
+	Pending = XAieDma_ShimPendingBdCount(StrmPtr->DmaInstPtr,
+			StrmPtr->ChNum);
+	Completed = (InFlight > Pending) ? (InFlight - Pending) : 0U;
+
+	for (Idx = 0U; Idx < Completed; Idx++) {
+		Buf = StrmPtr->Bufs[StrmPtr->Done % XAIEDMA_SHIM_STRM_MAX_BUFS];
+		__atomic_store_n(&StrmPtr->Done, StrmPtr->Done + 1U,
+				__ATOMIC_RELEASE);
+		if (StrmPtr->DoneFunc != XAIE_NULL) {
+			StrmPtr->DoneFunc(StrmPtr->CallbackRef, &Buf);
+		}
+	}
+
+	XAieDma_ShimStrmRefill(StrmPtr);
+
+	return Completed;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stops a stream. The channel is reset, buffers not completed stay
+* queued and restart from their beginning with XAieDma_ShimStrmStart().
+*
+* @param	StrmPtr - Pointer to the Shim DMA stream.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieDma_ShimStrmStop(XAieDma_ShimStrm *StrmPtr)
+{
+	XAie_AssertVoid(StrmPtr != XAIE_NULL);
+
+	(void)XAieDma_ShimChReset(StrmPtr->DmaInstPtr, StrmPtr->ChNum);
+	StrmPtr->Running = 0U;
+	StrmPtr->Issued = StrmPtr->Done;
+}
+
 /** @} */
 
 
@@ -22,6 +22,7 @@
 * 1.3  Hyun    06/20/2019  Added APIs for individual BD / Channel reset
 * 1.4  Hyun    06/20/2019  Add XAieDma_ShimSoftInitialize()
 * 1.5  Dishita 02/07/2020  Resolved macro compilation error
+* 1.6  fl      10/14/2026  Add the BD streaming engine
 * </pre>
 *
 ******************************************************************************/
@@ -61,6 +62,8 @@ extern XAieGbl_RegShimDmaSts ShimDmaSts[];
 #define XAIEDMA_SHIM_TXFER_LEN32_OFFSET		2U
 #define XAIEDMA_SHIM_TXFER_LEN32_MASK		3U
 
+#define XAIEDMA_SHIM_STRM_MAX_BUFS		16U	/* Queued buffers per stream */
+
 /**************************** Type Definitions *******************************/
 /**
  * This typedef contains the lock attributes for the BD.
@@ -117,6 +120,47 @@ typedef struct
 	XAieDma_ShimBd Descrs[XAIEDMA_SHIM_MAX_NUM_DESCRS];	/**< Data structure to hold the 16 descriptors of the Shim DMA */
 }XAieDma_Shim;
 
+/**
+ * This typedef contains a host buffer of a Shim DMA stream.
+ */
+typedef struct
+{
+	u64 Addr;			/**< Buffer address (128-bit aligned) */
+	u32 Length;			/**< Buffer length in bytes */
+	void *Priv;			/**< User data of the buffer */
+} XAieDma_ShimStrmBuf;
+
+/**
+ * Callback of a Shim DMA stream, called when the DMA is done with a buffer.
+ */
+typedef void (*XAieDma_ShimStrmDoneFunc)(void *CallbackRef,
+		XAieDma_ShimStrmBuf *BufPtr);
+
+/**
+ * This typedef is a Shim DMA stream, which feeds a queue of host buffers to
+ * a channel through a circular set of BDs. Buffers Done to Issued are owned
+ * by the DMA, buffers Issued to Head wait for a free BD. The counters are
+ * free running.
+ */
+typedef struct
+{
+	XAieDma_Shim *DmaInstPtr;	/**< Shim DMA of the channel */
+	u8 ChNum;			/**< Channel number */
+	u8 FirstBd;			/**< First BD of the stream */
+	u8 NumBds;			/**< Number of BDs of the stream */
+	u8 LockEn;			/**< BDs synchronize on locks */
+	u8 LockBase;			/**< Lock of the first BD */
+	u8 LkAcqVal;			/**< Lock acquire value */
+	u8 LkRelVal;			/**< Lock release value */
+	u8 Running;			/**< Channel is enabled */
+	XAieDma_ShimStrmBuf Bufs[XAIEDMA_SHIM_STRM_MAX_BUFS]; /**< Buffer queue */
+	u32 Head;			/**< Buffers queued */
+	u32 Issued;			/**< Buffers handed to a BD */
+	u32 Done;			/**< Buffers completed */
+	XAieDma_ShimStrmDoneFunc DoneFunc;	/**< Completion callback */
+	void *CallbackRef;		/**< Callback reference */
+} XAieDma_ShimStrm;
+
 /***************************** Macro Definitions *****************************/
 #define XAIEGBL_NOC_DMASTA_STA_IDLE		0x0U
 #define XAIEGBL_NOC_DMASTA_STARTQ_MAX		0x4U
@@ -183,5 +227,11 @@ void XAieDma_ShimBdClear(XAieDma_Shim *DmaInstPtr, u8 BdNum);
 void XAieDma_ShimBdClearAll(XAieDma_Shim *DmaInstPtr);
 u8 XAieDma_ShimWaitDone(XAieDma_Shim *DmaInstPtr, u32 ChNum, u32 TimeOut);
 u8 XAieDma_ShimPendingBdCount(XAieDma_Shim *DmaInstPtr, u32 ChNum);
+u32 XAieDma_ShimStrmInit(XAieDma_ShimStrm *StrmPtr, XAieDma_Shim *DmaInstPtr, u8 ChNum, u8 FirstBd, u8 NumBds, XAieDma_ShimStrmDoneFunc DoneFunc, void *CallbackRef);
+void XAieDma_ShimStrmSetLock(XAieDma_ShimStrm *StrmPtr, u8 LockBase, u8 LkAcqVal, u8 LkRelVal);
+u32 XAieDma_ShimStrmQueue(XAieDma_ShimStrm *StrmPtr, u64 Addr, u32 Length, void *Priv);
+void XAieDma_ShimStrmStart(XAieDma_ShimStrm *StrmPtr);
+u32 XAieDma_ShimStrmService(XAieDma_ShimStrm *StrmPtr);
+void XAieDma_ShimStrmStop(XAieDma_ShimStrm *StrmPtr);
 
 #endif
@@ -89,6 +89,7 @@
 * 1.6  Wendy   01/10/2020  Add tile location type
 * 1.7  Wendy   01/20/2020  Add events handlers for each events
 * 1.7  Wendy   02/24/2020  Add errors handlers for each error
+* 1.8  fl      10/14/2026  Add lock release event counts to the tile
 * </pre>
 *
 ******************************************************************************/
@@ -168,6 +169,8 @@ typedef struct XAieGbl_Tile
 	u32 MemBCUsedMask;	/**< Memory module used broadcast event mask */
 	u32 CoreBCUsedMask;	/**< Core module used broadcast event mask */
 	u32 PlIntEvtUsedMask;	/**< PL module used internal event mask */
+	volatile u32 LockRelEvents[XAIEGBL_TILE_LOCK_NUM_MAX]; /**< Lock
+				     release events seen by the events ISR */
 	void *Private;		/**< Private data */
 } XAieGbl_Tile;
 
@@ -38,6 +38,8 @@
 * 2.6  Tejus   10/14/2019  Enable assertion for linux and simulation
 * 2.7  Wendy   02/25/2020  Add logging API
 * 2.8  Tejus   04/17/2020  Fix variable overflow issue.
+* 2.9  fl      10/14/2026  Add register transaction mode
+* 3.0  fl      10/14/2026  Load elfs from memory on baremetal
 * </pre>
 *
 ******************************************************************************/
@@ -108,6 +110,8 @@ typedef struct XAieLib_MemInst
 static FILE *XAieLib_LogFPtr; /**< Pointer to Log file pointer. */
 #endif
 
+static XAieLib_Txn *XAieLib_ActiveTxn; /**< Transaction being recorded */
+
 /************************** Function Definitions *****************************/
 
 /*****************************************************************************/
@@ -229,7 +233,8 @@ u32 XAieLib_LoadElfMem(XAieGbl_Tile *TileInstPtr, u8 *ElfPtr, u8 LoadSym)
 #ifdef __AIESIM__
 	return XAIELIB_FAILURE;
 #elif defined __AIEBAREMTL__
-	return XAIELIB_FAILURE;
+	(void)LoadSym;
+	return XAieLib_LoadElfMemMulti(&TileInstPtr, &ElfPtr, 1U);
 #else
 	return XAieSim_LoadElfMem(TileInstPtr, ElfPtr, LoadSym);
 #endif
@@ -879,6 +884,372 @@ u32 XAieLib_MemRead32(XAieLib_MemInst *XAieLib_MemInstPtr, u64 Addr)
 #endif
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the internal function to apply operations of a transaction.
+*
+* @param	TxnPtr: Transaction.
+* @param	Start: First word to apply.
+* @param	End: Word after the last operation to apply.
+*
+* @return	XAIELIB_SUCCESS on success, XAIELIB_FAILURE if a mask poll
+*		timed out or an operation is malformed.
+*
+* @note		Used only in this file. No transaction must be active, so
+*		the IO functions issue the operations.
+*
+*******************************************************************************/
+static u32 XAieLib_TxnApply(XAieLib_Txn *TxnPtr, u32 Start, u32 End)
+{
+	u32 Idx, Hdr, Count, Word;
+	u32 Ret = XAIELIB_SUCCESS;
+	u64 Addr;
+
+	Idx = Start;
+	while (Idx < End) {
+		if ((End - Idx) < 3U) {
+			return XAIELIB_FAILURE;
+		}
+		Hdr = TxnPtr->Buf[Idx];
+		Count = Hdr & XAIELIB_TXN_COUNT_MASK;
+		Addr = (u64)TxnPtr->Buf[Idx + 1U] |
+			((u64)TxnPtr->Buf[Idx + 2U] << 32);
+		Idx += 3U;
+
+		switch (Hdr >> XAIELIB_TXN_OP_SHIFT) {
+		case XAIELIB_TXN_OP_WRITE:
+			if ((End - Idx) < Count) {
+				return XAIELIB_FAILURE;
+			}
+			if ((Count > 1U) && (TxnPtr->BlockWrite != NULL) &&
+					(TxnPtr->BlockWrite(Addr,
+					&TxnPtr->Buf[Idx], Count) ==
+					XAIELIB_SUCCESS)) {
+				Idx += Count;
+				break;
+			}
+			for (Word = 0U; Word < Count; Word++) {
+				XAieLib_Write32(Addr + Word * 4U,
+						TxnPtr->Buf[Idx + Word]);
+			}
+			Idx += Count;
+			break;
+		case XAIELIB_TXN_OP_MASKWRITE:
+			if ((End - Idx) < 2U) {
+				return XAIELIB_FAILURE;
+			}
+			XAieLib_MaskWrite32(Addr, TxnPtr->Buf[Idx],
+					TxnPtr->Buf[Idx + 1U]);
+			Idx += 2U;
+			break;
+		case XAIELIB_TXN_OP_MASKPOLL:
+			if ((End - Idx) < 3U) {
+				return XAIELIB_FAILURE;
+			}
+			if (XAieLib_MaskPoll(Addr, TxnPtr->Buf[Idx],
+					TxnPtr->Buf[Idx + 1U],
+					TxnPtr->Buf[Idx + 2U]) !=
+					XAIELIB_SUCCESS) {
+				TxnPtr->PollFailed = 1U;
+				Ret = XAIELIB_FAILURE;
+			}
+			Idx += 3U;
+			break;
+		default:
+			return XAIELIB_FAILURE;
+		}
+	}
+
+	return Ret;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to apply the pending operations of the active
+* transaction.
+*
+* @return	None.
+*
+* @note		Used only in this file. The buffer is emptied unless the
+*		transaction keeps its operations, and the applied operations
+*		are never merged with later ones.
+*
+*******************************************************************************/
+static void XAieLib_TxnFlush(void)
+{
+	XAieLib_Txn *TxnPtr = XAieLib_ActiveTxn;
+
+	XAieLib_ActiveTxn = NULL;
+	(void)XAieLib_TxnApply(TxnPtr, TxnPtr->Applied, TxnPtr->Len);
+	if ((TxnPtr->Flags & XAIELIB_TXN_KEEP) != 0U) {
+		TxnPtr->Applied = TxnPtr->Len;
+	} else {
+		TxnPtr->Len = 0U;
+		TxnPtr->Applied = 0U;
+	}
+	TxnPtr->LastHdr = TxnPtr->Size;
+	XAieLib_ActiveTxn = TxnPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to append a new operation to the active
+* transaction.
+*
+* @param	Op: XAIELIB_TXN_OP_*.
+* @param	Addr: Address of the operation.
+* @param	Words: Words of the operation after the address.
+*
+* @return	Index of the first word after the address, or 0 if the operation
+*		does not fit. The pending operations are applied in that case,
+*		so the caller issues the operation itself.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u32 XAieLib_TxnAppend(u32 Op, u64 Addr, u32 Words)
+{
+	XAieLib_Txn *TxnPtr = XAieLib_ActiveTxn;
+	u32 Idx;
+
+	if ((TxnPtr->Len + 3U + Words) > TxnPtr->Size) {
+		XAieLib_TxnFlush();
+		if (((TxnPtr->Flags & XAIELIB_TXN_KEEP) != 0U) ||
+				((3U + Words) > TxnPtr->Size)) {
+			TxnPtr->Overflow = 1U;
+			return 0U;
+		}
+	}
+
+	Idx = TxnPtr->Len;
+	TxnPtr->Buf[Idx] = (Op << XAIELIB_TXN_OP_SHIFT) | Words;
+	TxnPtr->Buf[Idx + 1U] = (u32)Addr;
+	TxnPtr->Buf[Idx + 2U] = (u32)(Addr >> 32);
+	TxnPtr->LastHdr = Idx;
+	TxnPtr->Len += 3U + Words;
+
+	return Idx + 3U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to record a write of consecutive words into
+* the active transaction. A write that continues the last recorded write is
+* merged into it.
+*
+* @param	Addr: Address to write to.
+* @param	Data: Words to be written.
+* @param	Count: Number of words.
+*
+* @return	XAIELIB_SUCCESS if recorded, otherwise XAIELIB_FAILURE and the
+*		caller writes the data itself.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u32 XAieLib_TxnWrite(u64 Addr, const u32 *Data, u32 Count)
+{
+	XAieLib_Txn *TxnPtr = XAieLib_ActiveTxn;
+	u32 Hdr, LastCount, Idx;
+	u64 LastAddr;
+
+	if (TxnPtr->LastHdr != TxnPtr->Size) {
+		Hdr = TxnPtr->Buf[TxnPtr->LastHdr];
+		LastCount = Hdr & XAIELIB_TXN_COUNT_MASK;
+		LastAddr = (u64)TxnPtr->Buf[TxnPtr->LastHdr + 1U] |
+			((u64)TxnPtr->Buf[TxnPtr->LastHdr + 2U] << 32);
+		if (((Hdr >> XAIELIB_TXN_OP_SHIFT) == XAIELIB_TXN_OP_WRITE) &&
+				((LastAddr + LastCount * 4U) == Addr) &&
+				((LastCount + Count) <=
+				 XAIELIB_TXN_COUNT_MASK) &&
+				((TxnPtr->Len + Count) <= TxnPtr->Size)) {
+			(void)memcpy(&TxnPtr->Buf[TxnPtr->Len], Data,
+					Count * sizeof(u32));
+			TxnPtr->Buf[TxnPtr->LastHdr] = Hdr + Count;
+			TxnPtr->Len += Count;
+			return XAIELIB_SUCCESS;
+		}
+	}
+
+	Idx = XAieLib_TxnAppend(XAIELIB_TXN_OP_WRITE, Addr, Count);
+	if (Idx == 0U) {
+		return XAIELIB_FAILURE;
+	}
+	(void)memcpy(&TxnPtr->Buf[Idx], Data, Count * sizeof(u32));
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to record a mask write into the active
+* transaction. A mask write to the last word of the last recorded operation
+* is folded into it.
+*
+* @param	Addr: Address to write to.
+* @param	Mask: Mask to be applied to Data.
+* @param	Data: 32-bit data to be written.
+*
+* @return	XAIELIB_SUCCESS if recorded, otherwise XAIELIB_FAILURE and the
+*		caller writes the data itself.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u32 XAieLib_TxnMaskWrite(u64 Addr, u32 Mask, u32 Data)
+{
+	XAieLib_Txn *TxnPtr = XAieLib_ActiveTxn;
+	u32 Hdr, Count, Idx;
+	u64 LastAddr;
+
+	if (TxnPtr->LastHdr != TxnPtr->Size) {
+		Hdr = TxnPtr->Buf[TxnPtr->LastHdr];
+		Count = Hdr & XAIELIB_TXN_COUNT_MASK;
+		LastAddr = (u64)TxnPtr->Buf[TxnPtr->LastHdr + 1U] |
+			((u64)TxnPtr->Buf[TxnPtr->LastHdr + 2U] << 32);
+		Idx = TxnPtr->LastHdr + 3U;
+
+		if (((Hdr >> XAIELIB_TXN_OP_SHIFT) == XAIELIB_TXN_OP_WRITE) &&
+				((LastAddr + (Count - 1U) * 4U) == Addr)) {
+			Idx += Count - 1U;
+			TxnPtr->Buf[Idx] = (TxnPtr->Buf[Idx] & ~Mask) | Data;
+			return XAIELIB_SUCCESS;
+		}
+		if (((Hdr >> XAIELIB_TXN_OP_SHIFT) ==
+				XAIELIB_TXN_OP_MASKWRITE) &&
+				(LastAddr == Addr)) {
+			TxnPtr->Buf[Idx] |= Mask;
+			TxnPtr->Buf[Idx + 1U] =
+				(TxnPtr->Buf[Idx + 1U] & ~Mask) | Data;
+			return XAIELIB_SUCCESS;
+		}
+	}
+
+	Idx = XAieLib_TxnAppend(XAIELIB_TXN_OP_MASKWRITE, Addr, 2U);
+	if (Idx == 0U) {
+		return XAIELIB_FAILURE;
+	}
+	TxnPtr->Buf[Idx] = Mask;
+	TxnPtr->Buf[Idx + 1U] = Data;
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a register transaction.
+*
+* @param	TxnPtr: Transaction to initialize.
+* @param	Buf: Buffer for the operations.
+* @param	Size: Size of Buf in 32-bit words.
+* @param	Flags: XAIELIB_TXN_KEEP to keep every operation in Buf, so
+*		the transaction can be saved and replayed. Otherwise the
+*		buffer is applied and reused whenever it fills up.
+*
+* @return	None.
+*
+* @note		To replay a saved buffer, initialize a transaction with it and
+*		set Len to the number of saved words.
+*
+*******************************************************************************/
+void XAieLib_TxnInit(XAieLib_Txn *TxnPtr, u32 *Buf, u32 Size, u32 Flags)
+{
+	XAieLib_AssertVoid(TxnPtr != NULL, __func__, __LINE__);
+	XAieLib_AssertVoid(Buf != NULL, __func__, __LINE__);
+
+	(void)memset(TxnPtr, 0, sizeof(*TxnPtr));
+	TxnPtr->Buf = Buf;
+	TxnPtr->Size = Size;
+	TxnPtr->LastHdr = Size;
+	TxnPtr->Flags = Flags;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts recording the register operations into a transaction.
+*
+* @param	TxnPtr: Initialized transaction.
+*
+* @return	None.
+*
+* @note		Only one transaction may be active, and the driver must not be
+*		used from another thread meanwhile. A recorded mask poll
+*		returns XAIELIB_SUCCESS, its result is reported by
+*		XAieLib_TxnEnd().
+*
+*******************************************************************************/
+void XAieLib_TxnStart(XAieLib_Txn *TxnPtr)
+{
+	XAieLib_AssertVoid(TxnPtr != NULL, __func__, __LINE__);
+	XAieLib_AssertVoid(XAieLib_ActiveTxn == NULL, __func__, __LINE__);
+
+	TxnPtr->LastHdr = TxnPtr->Size;
+	XAieLib_ActiveTxn = TxnPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function applies the pending operations of the active transaction and
+* stops recording.
+*
+* @param	TxnPtr: Active transaction.
+*
+* @return	XAIELIB_SUCCESS on success, XAIELIB_FAILURE if a recorded mask
+*		poll timed out or, with XAIELIB_TXN_KEEP, Buf was too small to
+*		keep all the operations. The operations were issued in both
+*		cases.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_TxnEnd(XAieLib_Txn *TxnPtr)
+{
+	XAieLib_AssertNonvoid(TxnPtr != NULL, __func__, __LINE__);
+	XAieLib_AssertNonvoid(XAieLib_ActiveTxn == TxnPtr, __func__, __LINE__);
+
+	XAieLib_TxnFlush();
+	XAieLib_ActiveTxn = NULL;
+
+	if ((TxnPtr->Overflow != 0U) || (TxnPtr->PollFailed != 0U)) {
+		return XAIELIB_FAILURE;
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function applies all the operations of a transaction again, ex to
+* load the same graph configuration repeatedly.
+*
+* @param	TxnPtr: Transaction recorded with XAIELIB_TXN_KEEP, or
+*		initialized with a saved buffer.
+*
+* @return	XAIELIB_SUCCESS on success, XAIELIB_FAILURE if a mask poll
+*		timed out or the buffer is malformed.
+*
+* @note		No transaction may be active.
+*
+*******************************************************************************/
+u32 XAieLib_TxnReplay(XAieLib_Txn *TxnPtr)
+{
+	XAieLib_AssertNonvoid(TxnPtr != NULL, __func__, __LINE__);
+	XAieLib_AssertNonvoid(XAieLib_ActiveTxn == NULL, __func__, __LINE__);
+
+	TxnPtr->PollFailed = 0U;
+
+	return XAieLib_TxnApply(TxnPtr, 0U, TxnPtr->Len);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -893,6 +1264,11 @@ u32 XAieLib_MemRead32(XAieLib_MemInst *XAieLib_MemInstPtr, u64 Addr)
 *******************************************************************************/
 u32 XAieLib_Read32(u64 Addr)
 {
+	if ((XAieLib_ActiveTxn != NULL) &&
+			(XAieLib_ActiveTxn->Len != XAieLib_ActiveTxn->Applied)) {
+		XAieLib_TxnFlush();
+	}
+
 #ifdef __AIESIM__
 	return(XAieSim_Read32(Addr));
 #elif defined __AIEBAREMTL__
@@ -919,6 +1295,11 @@ void XAieLib_Read128(u64 Addr, u32 *Data)
 {
 	u8 Idx;
 
+	if ((XAieLib_ActiveTxn != NULL) &&
+			(XAieLib_ActiveTxn->Len != XAieLib_ActiveTxn->Applied)) {
+		XAieLib_TxnFlush();
+	}
+
 	for(Idx = 0U; Idx < 4U; Idx++) {
 #ifdef __AIESIM__
 		Data[Idx] = XAieSim_Read32(Addr + Idx*4U);
@@ -945,6 +1326,11 @@ void XAieLib_Read128(u64 Addr, u32 *Data)
 *******************************************************************************/
 void XAieLib_Write32(u64 Addr, u32 Data)
 {
+	if ((XAieLib_ActiveTxn != NULL) &&
+			(XAieLib_TxnWrite(Addr, &Data, 1U) == XAIELIB_SUCCESS)) {
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_Write32(Addr, Data);
 #elif defined __AIEBAREMTL__
@@ -973,6 +1359,12 @@ void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
 {
 	u32 RegVal;
 
+	if ((XAieLib_ActiveTxn != NULL) &&
+			(XAieLib_TxnMaskWrite(Addr, Mask, Data) ==
+			 XAIELIB_SUCCESS)) {
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_MaskWrite32(Addr, Mask, Data);
 #elif defined __AIEBAREMTL__
@@ -1003,6 +1395,11 @@ void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
 *******************************************************************************/
 void XAieLib_Write128(u64 Addr, u32 *Data)
 {
+	if ((XAieLib_ActiveTxn != NULL) &&
+			(XAieLib_TxnWrite(Addr, Data, 4U) == XAIELIB_SUCCESS)) {
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_Write128(Addr, Data);
 #elif defined __AIEBAREMTL__
@@ -1057,6 +1454,17 @@ void XAieLib_WriteCmd(u8 Command, u8 ColId, u8 RowId, u32 CmdWd0,
 u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 {
 	u32 Ret = XAIELIB_FAILURE;
+	u32 Idx;
+
+	if (XAieLib_ActiveTxn != NULL) {
+		Idx = XAieLib_TxnAppend(XAIELIB_TXN_OP_MASKPOLL, Addr, 3U);
+		if (Idx != 0U) {
+			XAieLib_ActiveTxn->Buf[Idx] = Mask;
+			XAieLib_ActiveTxn->Buf[Idx + 1U] = Value;
+			XAieLib_ActiveTxn->Buf[Idx + 2U] = TimeOutUs;
+			return XAIELIB_SUCCESS;
+		}
+	}
 
 #ifdef __AIESIM__
 	if (XAieSim_MaskPoll(Addr, Mask, Value, TimeOutUs) == XAIESIM_SUCCESS) {
@@ -26,6 +26,8 @@
 * 1.7  Hyun    01/08/2019  Add XAieLib_MaskPoll()
 * 1.8  Tejus   10/14/2019  Enable assertion for linux and simulation
 * 1.9  Wendy   02/25/2020  Add Logging API
+* 2.0  fl      10/14/2026  Add register transaction mode
+* 2.1  fl      10/14/2026  Add XAieLib_LoadElfMemMulti()
 * </pre>
 *
 ******************************************************************************/
@@ -54,11 +56,51 @@ typedef uint64_t		u64;
 /* Enable cache for memory mapping */
 #define XAIELIB_MEM_ATTR_CACHE		0x1U
 
+/* Transaction flags */
+#define XAIELIB_TXN_KEEP		0x1U	/* Keep applied operations for
+						   XAieLib_TxnReplay() */
+
+/* Transaction operations, in bits 31:24 of the header word */
+#define XAIELIB_TXN_OP_WRITE		0x0U	/* Addr, Count data words */
+#define XAIELIB_TXN_OP_MASKWRITE	0x1U	/* Addr, Mask, Data */
+#define XAIELIB_TXN_OP_MASKPOLL		0x2U	/* Addr, Mask, Value, TimeOutUs */
+#define XAIELIB_TXN_OP_SHIFT		24U
+#define XAIELIB_TXN_COUNT_MASK		0xFFFFFFU
+
 typedef enum {
 	XAIELIB_LOGINFO,
 	XAIELIB_LOGERROR
 } XAieLib_LogLevel;
 
+/*
+ * Register transaction. While a transaction is started, register writes,
+ * mask writes and mask polls of this file are recorded into Buf instead of
+ * being issued, and writes to consecutive addresses are merged into one
+ * block write. A read applies the recorded operations first, so reads
+ * always observe the earlier writes.
+ *
+ * Buf is a sequence of operations, each a header word made of the operation
+ * and a count, the 64-bit address as two words and the operation words. It
+ * holds no pointers, so a buffer saved with XAIELIB_TXN_KEEP can be stored
+ * and replayed later.
+ */
+typedef struct {
+	u32 *Buf;	/**< Operation words */
+	u32 Size;	/**< Size of Buf in words */
+	u32 Len;	/**< Words recorded */
+	u32 Applied;	/**< Words already applied */
+	u32 LastHdr;	/**< Header of the last operation, Size for none */
+	u32 Flags;	/**< XAIELIB_TXN_* */
+	u8 Overflow;	/**< Buf was too small to keep all operations */
+	u8 PollFailed;	/**< A recorded mask poll timed out */
+	/**
+	 * Optional block write, ex through a DMA, for merged writes of more
+	 * than one word. Returns XAIELIB_SUCCESS, or XAIELIB_FAILURE to fall
+	 * back to single writes.
+	 */
+	u32 (*BlockWrite)(u64 Addr, const u32 *Data, u32 Count);
+} XAieLib_Txn;
+
 /************************** Variable Definitions *****************************/
 
 /************************** Function Prototypes  *****************************/
@@ -70,6 +112,11 @@ void XAieLib_Write128(u64 Addr, u32 *Data);
 void XAieLib_WriteCmd(u8 Command, u8 ColId, u8 RowId, u32 CmdWd0, u32 CmdWd1, u8 *CmdStr);
 u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs);
 
+void XAieLib_TxnInit(XAieLib_Txn *TxnPtr, u32 *Buf, u32 Size, u32 Flags);
+void XAieLib_TxnStart(XAieLib_Txn *TxnPtr);
+u32 XAieLib_TxnEnd(XAieLib_Txn *TxnPtr);
+u32 XAieLib_TxnReplay(XAieLib_Txn *TxnPtr);
+
 u32 XAieLib_NPIRead32(u64 Addr);
 void XAieLib_NPIWrite32(u64 Addr, u32 Data);
 u32 XAieLib_NPIMaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs);
@@ -83,6 +130,8 @@ typedef struct XAieGbl_Tile XAieGbl_Tile;
 
 u32 XAieLib_LoadElf(XAieGbl_Tile *TileInstPtr, u8 *ElfPtr, u8 LoadSym);
 u32 XAieLib_LoadElfMem(XAieGbl_Tile *TileInstPtr, u8 *ElfPtr, u8 LoadSym);
+u32 XAieLib_LoadElfMemMulti(XAieGbl_Tile **TileInstPtrs, u8 **ElfPtrs,
+		u32 NumTiles);
 
 void XAieLib_InitDev(void);
 u32 XAieLib_InitTile(XAieGbl_Tile *TileInstPtr);
@@ -0,0 +1,334 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaielib_elf.c
+* @{
+*
+* This file contains the multi tile elf loader. Every distinct elf is parsed
+* once and its loadable segments are written to all the tiles running it,
+* segment by segment, so the writes to the tiles of a segment can be batched
+* with the register transaction mode.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  fl      10/14/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#include <string.h>
+#include "xaiegbl.h"
+#include "xaielib.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIELIB_ELF_MAX_SEGS	16U	/* Loadable segments per elf */
+
+#define XAIELIB_ELF_PT_LOAD	1U
+#define XAIELIB_ELF_PHDR_SIZE	32U	/* Elf32_Phdr */
+
+/* Core view of the memories, see xaietile_proc.c */
+#define XAIELIB_ELF_DATAMEM	0x20000U
+#define XAIELIB_ELF_DATAMEM_SZ	0x8000U
+
+/************************** Variable Definitions *****************************/
+/**
+ * Loadable segment of an elf
+ */
+typedef struct {
+	u32 DevAddr;	/**< Address in the core view */
+	u32 Offset;	/**< Offset of the data in the elf */
+	u32 FileSz;	/**< Bytes of data in the elf */
+	u32 MemSz;	/**< Bytes in memory, the rest is cleared */
+} XAieLib_ElfSeg;
+
+extern XAieGbl_Config XAieGbl_ConfigTable[];
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to read a little endian word of the elf.
+*
+* @param	ElfPtr: Pointer to the elf in memory.
+* @param	Offset: Offset of the word.
+*
+* @return	Word value.
+*
+* @note		Used only in this file. The elf may be unaligned.
+*
+*******************************************************************************/
+static u32 XAieLib_ElfWord(const u8 *ElfPtr, u32 Offset)
+{
+	return (u32)ElfPtr[Offset] | ((u32)ElfPtr[Offset + 1U] << 8) |
+		((u32)ElfPtr[Offset + 2U] << 16) |
+		((u32)ElfPtr[Offset + 3U] << 24);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to collect the loadable segments of an elf.
+*
+* @param	ElfPtr: Pointer to the elf in memory.
+* @param	Segs: Array filled with up to XAIELIB_ELF_MAX_SEGS segments.
+* @param	NumSegsPtr: Filled with the number of segments.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u32 XAieLib_ElfParse(const u8 *ElfPtr, XAieLib_ElfSeg *Segs,
+		u32 *NumSegsPtr)
+{
+	u32 PhOff, PhEntSize, PhNum, Idx, Ph;
+	u32 NumSegs = 0U;
+
+	/* 32-bit little endian elf */
+	if ((ElfPtr[0] != 0x7FU) || (ElfPtr[1] != (u8)'E') ||
+			(ElfPtr[2] != (u8)'L') || (ElfPtr[3] != (u8)'F') ||
+			(ElfPtr[4] != 1U) || (ElfPtr[5] != 1U)) {
+		XAieLib_print("Error: Invalid elf header\n");
+		return XAIELIB_FAILURE;
+	}
+
+	PhOff = XAieLib_ElfWord(ElfPtr, 28U);
+	PhEntSize = XAieLib_ElfWord(ElfPtr, 40U) & 0xFFFFU;
+	PhNum = XAieLib_ElfWord(ElfPtr, 44U) & 0xFFFFU;
+	if (PhEntSize < XAIELIB_ELF_PHDR_SIZE) {
+		XAieLib_print("Error: Invalid elf program header size\n");
+		return XAIELIB_FAILURE;
+	}
+
+	for (Idx = 0U; Idx < PhNum; Idx++) {
+		Ph = PhOff + Idx * PhEntSize;
+		if (XAieLib_ElfWord(ElfPtr, Ph) != XAIELIB_ELF_PT_LOAD) {
+			continue;
+		}
+		if (NumSegs == XAIELIB_ELF_MAX_SEGS) {
+			XAieLib_print("Error: Too many elf segments\n");
+			return XAIELIB_FAILURE;
+		}
+		Segs[NumSegs].Offset = XAieLib_ElfWord(ElfPtr, Ph + 4U);
+		Segs[NumSegs].DevAddr = XAieLib_ElfWord(ElfPtr, Ph + 12U);
+		Segs[NumSegs].FileSz = XAieLib_ElfWord(ElfPtr, Ph + 16U);
+		Segs[NumSegs].MemSz = XAieLib_ElfWord(ElfPtr, Ph + 20U);
+		if (Segs[NumSegs].MemSz < Segs[NumSegs].FileSz) {
+			XAieLib_print("Error: Invalid elf segment size\n");
+			return XAIELIB_FAILURE;
+		}
+		NumSegs++;
+	}
+
+	*NumSegsPtr = NumSegs;
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to translate a core view address of a tile
+* to the tile address of the memory.
+*
+* @param	TileInstPtr: Tile instance running the elf.
+* @param	DevAddr: Address in the core view.
+* @param	Size: Size of the segment.
+* @param	AddrPtr: Filled with the tile address.
+*
+* @return	XAIELIB_SUCCESS on success, XAIELIB_FAILURE if the address
+*		does not map to a memory of the array.
+*
+* @note		Used only in this file. Data memories are seen from the core
+*		as south, west, north and east, the west and east memories
+*		alternate with the row parity.
+*
+*******************************************************************************/
+static u32 XAieLib_ElfMap(XAieGbl_Tile *TileInstPtr, u32 DevAddr, u32 Size,
+		u64 *AddrPtr)
+{
+	s32 Row = (s32)TileInstPtr->RowId;
+	s32 Col = (s32)TileInstPtr->ColId;
+	u32 Dir;
+	u64 TileAddr;
+
+	if (DevAddr < XAIELIB_ELF_DATAMEM) {
+		/* program memory */
+		*AddrPtr = TileInstPtr->TileAddr + XAIEGBL_CORE_PRGMEM + DevAddr;
+		return XAIELIB_SUCCESS;
+	}
+
+	if ((Size > XAIELIB_ELF_DATAMEM_SZ) ||
+			(DevAddr >= (XAIELIB_ELF_DATAMEM +
+				     4U * XAIELIB_ELF_DATAMEM_SZ))) {
+		return XAIELIB_FAILURE;
+	}
+
+	Dir = (DevAddr - XAIELIB_ELF_DATAMEM) / XAIELIB_ELF_DATAMEM_SZ;
+	DevAddr = (DevAddr - XAIELIB_ELF_DATAMEM) % XAIELIB_ELF_DATAMEM_SZ;
+	if ((DevAddr + Size) > XAIELIB_ELF_DATAMEM_SZ) {
+		return XAIELIB_FAILURE;
+	}
+
+	switch (Dir) {
+	case 0U:
+		/* south */
+		Row--;
+		break;
+	case 1U:
+		/* west, left of the tile in odd rows */
+		Col += (Row % 2) ? -1 : 0;
+		break;
+	case 2U:
+		/* north */
+		Row++;
+		break;
+	default:
+		/* east, right of the tile in even rows */
+		Col += (Row % 2) ? 0 : 1;
+		break;
+	}
+
+	if ((Row < 1) || (Row > (s32)XAieGbl_ConfigTable->NumRows) ||
+			(Col < 0) ||
+			(Col >= (s32)XAieGbl_ConfigTable->NumCols)) {
+		return XAIELIB_FAILURE;
+	}
+
+	TileAddr = TileInstPtr->TileAddr;
+	TileAddr &= ~(u64)XAIEGBL_TILE_BASE_ADDRMASK;
+	TileAddr |= (u64)Col << XAIEGBL_TILE_ADDR_COL_SHIFT;
+	TileAddr |= (u64)Row << XAIEGBL_TILE_ADDR_ROW_SHIFT;
+	*AddrPtr = TileAddr + XAIEGBL_MEM_DATMEM + DevAddr;
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to write a segment of an elf to a tile.
+*
+* @param	TileInstPtr: Tile instance running the elf.
+* @param	ElfPtr: Pointer to the elf in memory.
+* @param	SegPtr: Segment to write.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE
+*
+* @note		Used only in this file. A segment without data that does not
+*		map to a memory is skipped, the AIE tools emit such bss
+*		segments.
+*
+*******************************************************************************/
+static u32 XAieLib_ElfWriteSeg(XAieGbl_Tile *TileInstPtr, const u8 *ElfPtr,
+		const XAieLib_ElfSeg *SegPtr)
+{
+	u32 Idx, Data, Rem;
+	u64 Addr;
+
+	if (XAieLib_ElfMap(TileInstPtr, SegPtr->DevAddr, SegPtr->MemSz,
+				&Addr) != XAIELIB_SUCCESS) {
+		if (SegPtr->FileSz == 0U) {
+			return XAIELIB_SUCCESS;
+		}
+		XAieLib_print("Error: Elf segment 0x%x not in tile(%d,%d)\n",
+				SegPtr->DevAddr, TileInstPtr->ColId,
+				TileInstPtr->RowId);
+		return XAIELIB_FAILURE;
+	}
+
+	for (Idx = 0U; (Idx + 4U) <= SegPtr->FileSz; Idx += 4U) {
+		XAieLib_Write32(Addr + Idx,
+				XAieLib_ElfWord(ElfPtr, SegPtr->Offset + Idx));
+	}
+
+	Rem = SegPtr->FileSz - Idx;
+	if (Rem != 0U) {
+		Data = 0U;
+		(void)memcpy(&Data, &ElfPtr[SegPtr->Offset + Idx], Rem);
+		XAieLib_Write32(Addr + Idx, Data);
+		Idx += 4U;
+	}
+
+	for (; Idx < SegPtr->MemSz; Idx += 4U) {
+		XAieLib_Write32(Addr + Idx, 0U);
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API loads elfs in memory to many tiles. Tiles running the same elf
+* share one parse of it, and every segment is written to all of them before
+* the next segment.
+*
+* @param	TileInstPtrs: Array of NumTiles tile instances.
+* @param	ElfPtrs: Array of NumTiles pointers to the elf of each tile in
+*		memory. Tiles running the same elf use the same pointer.
+* @param	NumTiles: Number of tiles.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE
+*
+* @note		The AIE array has no broadcast write, every tile is written.
+*		Start a register transaction with a BlockWrite hook around
+*		the call to turn the writes of every segment into block
+*		writes.
+*
+*******************************************************************************/
+u32 XAieLib_LoadElfMemMulti(XAieGbl_Tile **TileInstPtrs, u8 **ElfPtrs,
+		u32 NumTiles)
+{
+	XAieLib_ElfSeg Segs[XAIELIB_ELF_MAX_SEGS];
+	u32 NumSegs, Idx, Prev, Tile, Seg;
+
+	XAie_AssertNonvoid(TileInstPtrs != NULL);
+	XAie_AssertNonvoid(ElfPtrs != NULL);
+
+	for (Idx = 0U; Idx < NumTiles; Idx++) {
+		XAie_AssertNonvoid(TileInstPtrs[Idx] != NULL);
+		XAie_AssertNonvoid(TileInstPtrs[Idx]->TileType ==
+				XAIEGBL_TILE_TYPE_AIETILE);
+		XAie_AssertNonvoid(ElfPtrs[Idx] != NULL);
+
+		/* Loaded with the first tile running the same elf */
+		for (Prev = 0U; Prev < Idx; Prev++) {
+			if (ElfPtrs[Prev] == ElfPtrs[Idx]) {
+				break;
+			}
+		}
+		if (Prev != Idx) {
+			continue;
+		}
+
+		if (XAieLib_ElfParse(ElfPtrs[Idx], Segs, &NumSegs) !=
+				XAIELIB_SUCCESS) {
+			return XAIELIB_FAILURE;
+		}
+
+		for (Seg = 0U; Seg < NumSegs; Seg++) {
+			for (Tile = Idx; Tile < NumTiles; Tile++) {
+				if (ElfPtrs[Tile] != ElfPtrs[Idx]) {
+					continue;
+				}
+				if (XAieLib_ElfWriteSeg(TileInstPtrs[Tile],
+						ElfPtrs[Idx], &Segs[Seg]) !=
+						XAIELIB_SUCCESS) {
+					return XAIELIB_FAILURE;
+				}
+			}
+		}
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+/** @} */
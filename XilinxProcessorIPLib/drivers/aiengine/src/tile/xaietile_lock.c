@@ -23,12 +23,14 @@
 * 1.4  Hyun    01/08/2019  Use the poll function
 * 1.5  Nishad  03/20/2019  Fix usage of uninitialized variable in
 * 			   XAieTile_LockAcquire and XAieTile_LockRelease
+* 1.6  fl      10/14/2026  Add event driven XAieTile_LockAcquireWait
 * </pre>
 *
 ******************************************************************************/
 #include "xaiegbl_defs.h"
 #include "xaiegbl.h"
 #include "xaiegbl_reginit.h"
+#include "xaietile_event.h"
 #include "xaietile_lock.h"
 
 /***************************** Include Files *********************************/
@@ -183,5 +185,195 @@ u8 XAieTile_LockRelease(XAieGbl_Tile *TileInstPtr, u8 LockId, u8 LockVal,
 	return RelDone;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the event callback of the lock release events. It counts the
+* release of the lock in the tile the event is from.
+*
+* @param	AieInst - Pointer to the AIE device instance.
+* @param	Loc - Location of the tile.
+* @param	Module - XAIEGBL_MODULE_MEM or XAIEGBL_MODULE_PL.
+* @param	Event - Lock release event id.
+* @param	Arg - Unused.
+*
+* @return	None.
+*
+* @note		Used only within this file.
+*
+*******************************************************************************/
+static void XAieTile_LockEventCb(XAieGbl *AieInst, XAie_LocType Loc,
+						u8 Module, u8 Event, void *Arg)
+{
+	XAieGbl_Tile *TilePtr;
+	u8 LockId;
+
+	(void)Arg;
+	TilePtr = AieInst->Tiles;
+	TilePtr += Loc.Col * (AieInst->Config->NumRows + 1) + Loc.Row;
+
+	if(Module == XAIEGBL_MODULE_MEM) {
+		LockId = (Event - XAIETILE_EVENT_MEM_LOCK_0_RELEASE) / 2U;
+	} else {
+		LockId = (Event - XAIETILE_EVENT_SHIM_LOCK_0_RELEASE_NOC) / 2U;
+	}
+	TilePtr->LockRelEvents[LockId]++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API maps the tile type of the first tile to the module and lock
+* release event of the specified lock.
+*
+* @param	AieInst - Pointer to the AIE device instance.
+* @param	Loc - Pointer to the tile location array.
+* @param	LockId - Lock value index, ranging from 0-15.
+* @param	Module - Pointer to return the module type.
+* @param	Event - Pointer to return the lock release event id.
+*
+* @return	None.
+*
+* @note		Used only within this file.
+*
+*******************************************************************************/
+static void XAieTile_LockEventGet(XAieGbl *AieInst, XAie_LocType *Loc,
+					u8 LockId, u8 *Module, u8 *Event)
+{
+	XAieGbl_Tile *TilePtr = AieInst->Tiles;
+
+	if(Loc != XAIE_NULL) {
+		TilePtr += Loc[0].Col * (AieInst->Config->NumRows + 1) +
+								Loc[0].Row;
+	}
+
+	if(TilePtr->TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+		*Module = XAIEGBL_MODULE_MEM;
+		*Event = XAIETILE_EVENT_MEM_LOCK_0_RELEASE + 2U * LockId;
+	} else {
+		*Module = XAIEGBL_MODULE_PL;
+		*Event = XAIETILE_EVENT_SHIM_LOCK_0_RELEASE_NOC + 2U * LockId;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API routes the release events of the specified lock of the tiles
+* through the event broadcast network to the AIE interrupt, so that
+* XAieTile_LockAcquireWait() waits for a release instead of polling the
+* lock registers.
+*
+* @param	AieInst - Pointer to the AIE device instance.
+* @param	Loc - Pointer to the tile location array. All the tiles have
+*		to be AIE tiles or all shim tiles.
+* @param	NumTiles - Number of tiles.
+* @param	LockId - Lock value index, ranging from 0-15.
+*
+* @return	XAIE_SUCCESS if successful, else XAIE_FAILURE.
+*
+* @note		Every tile uses one broadcast signal, or one shim internal
+*		event, per registered lock. The events ISR has to be set up,
+*		see XAieTile_EventsIsr().
+*
+*******************************************************************************/
+int XAieTile_LockEventsRegister(XAieGbl *AieInst, XAie_LocType *Loc,
+						u32 NumTiles, u8 LockId)
+{
+	u8 Module, Event;
+
+	XAie_AssertNonvoid(AieInst != XAIE_NULL);
+	XAie_AssertNonvoid(Loc != XAIE_NULL);
+	XAie_AssertNonvoid(NumTiles > 0U);
+	XAie_AssertNonvoid(LockId < XAIEGBL_TILE_LOCK_NUM_MAX);
+
+	XAieTile_LockEventGet(AieInst, Loc, LockId, &Module, &Event);
+
+	return XAieTile_EventRegisterNotification(AieInst, Loc, NumTiles,
+				Module, Event, XAieTile_LockEventCb, XAIE_NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API removes the lock release event routing set up by
+* XAieTile_LockEventsRegister().
+*
+* @param	AieInst - Pointer to the AIE device instance.
+* @param	Loc - Pointer to the tile location array.
+* @param	NumTiles - Number of tiles.
+* @param	LockId - Lock value index, ranging from 0-15.
+*
+* @return	XAIE_SUCCESS if successful, else XAIE_FAILURE.
+*
+* @note		None.
+*
+*******************************************************************************/
+int XAieTile_LockEventsUnregister(XAieGbl *AieInst, XAie_LocType *Loc,
+						u32 NumTiles, u8 LockId)
+{
+	u8 Module, Event;
+
+	XAie_AssertNonvoid(AieInst != XAIE_NULL);
+	XAie_AssertNonvoid(Loc != XAIE_NULL);
+	XAie_AssertNonvoid(NumTiles > 0U);
+	XAie_AssertNonvoid(LockId < XAIEGBL_TILE_LOCK_NUM_MAX);
+
+	XAieTile_LockEventGet(AieInst, Loc, LockId, &Module, &Event);
+
+	return XAieTile_EventUnregisterNotification(AieInst, Loc, NumTiles,
+							Module, Event);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acquires the specified lock like XAieTile_LockAcquire(), but
+* between the acquire attempts it waits for a release event of the lock
+* instead of reading the lock registers. While the lock is held elsewhere
+* there is no AXI/NPI traffic and the calling task sleeps.
+*
+* @param	TileInstPtr - Pointer to the Tile instance.
+* @param	LockId - Lock value index, ranging from 0-15.
+* @param	LockVal - Lock value used for acquire. If set to 0xFF, lock
+*		acquired with no value.
+* @param	TimeOut - Time-out value in usecs. If 0, one acquire attempt
+*		is made.
+*
+* @return	1 if acquire successful, else 0.
+*
+* @note		The lock release events of the tile have to be registered
+*		with XAieTile_LockEventsRegister(). The wait sleeps in steps
+*		of XAIETILE_LOCK_WAIT_SLEEP_US.
+*
+*******************************************************************************/
+u8 XAieTile_LockAcquireWait(XAieGbl_Tile *TileInstPtr, u8 LockId, u8 LockVal,
+								u32 TimeOut)
+{
+	u32 Events;
+	u32 Waited = 0U;
+
+	XAie_AssertNonvoid(TileInstPtr != XAIE_NULL);
+	XAie_AssertNonvoid(LockId < XAIEGBL_TILE_LOCK_NUM_MAX);
+
+	while(1) {
+		/* Sample the count first, a release after the attempt wakes */
+		Events = TileInstPtr->LockRelEvents[LockId];
+
+		if(XAieTile_LockAcquire(TileInstPtr, LockId, LockVal, 0U) ==
+						XAIETILE_LOCK_ACQ_SUCCESS) {
+			return XAIETILE_LOCK_ACQ_SUCCESS;
+		}
+
+		while(TileInstPtr->LockRelEvents[LockId] == Events) {
+			if(Waited >= TimeOut) {
+				return XAIETILE_LOCK_ACQ_FAILED;
+			}
+			XAie_usleep(XAIETILE_LOCK_WAIT_SLEEP_US);
+			Waited += XAIETILE_LOCK_WAIT_SLEEP_US;
+		}
+	}
+}
+
 /** @} */
 
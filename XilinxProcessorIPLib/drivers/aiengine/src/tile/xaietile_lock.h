@@ -19,6 +19,7 @@
 * 1.0  Naresh  03/14/2018  Initial creation
 * 1.1  Naresh  07/11/2018  Updated copyright info
 * 1.2  Nishad  12/05/2018  Renamed ME attributes to AIE
+* 1.3  fl      10/14/2026  Add event driven lock acquire wait
 * </pre>
 *
 ******************************************************************************/
@@ -40,6 +41,8 @@
 #define XAIETILE_LOCK_REL_VAL0			0U
 #define XAIETILE_LOCK_REL_VAL1			1U
 
+#define XAIETILE_LOCK_WAIT_SLEEP_US		10U
+
 /**************************** Type Definitions *******************************/
 
 /***************************** Macro Definitions *****************************/
@@ -47,6 +50,9 @@
 /************************** Function Prototypes  *****************************/
 u8 XAieTile_LockAcquire(XAieGbl_Tile *TileInstPtr, u8 LockId, u8 LockVal, u32 TimeOut);
 u8 XAieTile_LockRelease(XAieGbl_Tile *TileInstPtr, u8 LockId, u8 LockVal, u32 TimeOut);
+int XAieTile_LockEventsRegister(XAieGbl *AieInst, XAie_LocType *Loc, u32 NumTiles, u8 LockId);
+int XAieTile_LockEventsUnregister(XAieGbl *AieInst, XAie_LocType *Loc, u32 NumTiles, u8 LockId);
+u8 XAieTile_LockAcquireWait(XAieGbl_Tile *TileInstPtr, u8 LockId, u8 LockVal, u32 TimeOut);
 
 #endif            /* end of protection macro */
 /** @} */
@@ -21,6 +21,7 @@
 * 1.2   Nishad  12/05/2018  Renamed ME attributes to AIE
 * 1.3   Tejus   10/14/2019  Remove unwanted assertions
 * 1.4   Dishita 11/01/2019  Fix coverity warnings
+* 1.5   fl      10/14/2026  Add the array-wide sampling service
 * </pre>
 *
 ******************************************************************************/
@@ -32,15 +33,13 @@
 #include "xaietile_perfcnt.h"
 
 /***************************** Macro Definitions *****************************/
-#define XAIETILE_PERFCNT_MODULE_CORE		0x0
-#define XAIETILE_PERFCNT_MODULE_PL		0x1
-#define XAIETILE_PERFCNT_MODULE_MEM		0x2
 
 /************************** Variable Definitions *****************************/
 extern XAieGbl_RegPerfCtrls PerfCtrl[];
 extern XAieGbl_RegPerfCtrlReset PerfCtrlReset[];
 extern XAieGbl_RegPerfCounter PerfCounter[];
 extern XAieGbl_RegPerfCounterEvent PerfCounterEvent[];
+extern XAieGbl_RegTimer TimerReg[];
 
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
@@ -433,3 +432,186 @@ u32 XAieTileCore_PerfCounterEventValue(XAieGbl_Tile *TileInstPtr, u8 Counter,
 		EventVal);
 	return XAIE_SUCCESS;
 }
+
+/*****************************************************************************/
+/**
+*
+* This API initializes a sampler of the performance counters of a module in
+* a set of tiles, and the sample ring it writes.
+*
+* @param	SamplerPtr - Pointer to the sampler.
+* @param	TileInstPtrs - Array of NumTiles tile instances. The array is
+* used by the sampler and must stay valid.
+* @param	NumTiles - Number of tiles.
+* @param	ModId - XAIETILE_PERFCNT_MODULE_CORE or _MEM for AIE tiles,
+* XAIETILE_PERFCNT_MODULE_PL for shim tiles.
+* @param	NumCounters - Counters sampled per tile, from counter 0. Up to 4
+* for the core module, 2 otherwise.
+* @param	RingBase - Memory of the sample ring, 8 byte aligned.
+* @param	RingSize - Size of the memory in bytes.
+*
+* @return	XAIE_SUCCESS on success, XAIE_FAILURE if the ring does not hold
+* the records of one snapshot.
+*
+* @note		None.
+*
+*******************************************************************************/
+u8 XAieTilePerf_Init(XAieTilePerf_Sampler *SamplerPtr,
+		XAieGbl_Tile **TileInstPtrs, u32 NumTiles, u8 ModId,
+		u8 NumCounters, void *RingBase, u32 RingSize)
+{
+	u32 Idx, NumRecs;
+	u8 TileType;
+
+	XAie_AssertNonvoid(SamplerPtr != XAIE_NULL);
+	XAie_AssertNonvoid(TileInstPtrs != XAIE_NULL);
+	XAie_AssertNonvoid(RingBase != XAIE_NULL);
+	XAie_AssertNonvoid(NumCounters > 0U);
+	XAie_AssertNonvoid(NumCounters <=
+			((ModId == XAIETILE_PERFCNT_MODULE_CORE) ? 4U : 2U));
+
+	for (Idx = 0U; Idx < NumTiles; Idx++) {
+		XAie_AssertNonvoid(TileInstPtrs[Idx] != XAIE_NULL);
+		TileType = TileInstPtrs[Idx]->TileType;
+		if (ModId == XAIETILE_PERFCNT_MODULE_PL) {
+			XAie_AssertNonvoid(TileType == XAIEGBL_TILE_TYPE_SHIMNOC ||
+					TileType == XAIEGBL_TILE_TYPE_SHIMPL);
+		} else {
+			XAie_AssertNonvoid(TileType == XAIEGBL_TILE_TYPE_AIETILE);
+		}
+	}
+
+	if (RingSize < sizeof(XAieTilePerf_RingHdr)) {
+		return XAIE_FAILURE;
+	}
+	NumRecs = (RingSize - sizeof(XAieTilePerf_RingHdr)) /
+		sizeof(XAieTilePerf_Record);
+	if ((NumRecs == 0U) || (NumRecs < NumTiles)) {
+		return XAIE_FAILURE;
+	}
+
+	SamplerPtr->TileInstPtrs = TileInstPtrs;
+	SamplerPtr->NumTiles = NumTiles;
+	SamplerPtr->ModId = ModId;
+	SamplerPtr->NumCounters = NumCounters;
+	SamplerPtr->RingHdr = (XAieTilePerf_RingHdr *)RingBase;
+	SamplerPtr->Recs = (XAieTilePerf_Record *)(SamplerPtr->RingHdr + 1);
+
+	SamplerPtr->RingHdr->Version = XAIETILE_PERF_RING_VERSION;
+	SamplerPtr->RingHdr->RecSize = sizeof(XAieTilePerf_Record);
+	SamplerPtr->RingHdr->NumRecs = NumRecs;
+	SamplerPtr->RingHdr->Head = 0U;
+	SamplerPtr->RingHdr->Seq = 0U;
+	for (Idx = 0U; Idx < 3U; Idx++) {
+		SamplerPtr->RingHdr->Reserved[Idx] = 0U;
+	}
+	/* A consumer trusts the ring once the magic is set */
+	__atomic_store_n(&SamplerPtr->RingHdr->Magic, XAIETILE_PERF_RING_MAGIC,
+			__ATOMIC_RELEASE);
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the performance counter control of a counter in all the tiles
+* of a sampler.
+*
+* @param	SamplerPtr - Pointer to the sampler.
+* @param	Counter - Counter ID, below the number of sampled counters.
+* @param	StartEvent - Event ID to start
+* @param	StopEvent - Event ID to stop
+* @param	ResetEvent - Event ID to reset
+*
+* @return	XAIE_SUCCESS on success
+*
+* @note		Run it within a register transaction to batch the writes of
+* all the tiles.
+*
+*******************************************************************************/
+u8 XAieTilePerf_CounterControl(XAieTilePerf_Sampler *SamplerPtr, u8 Counter,
+		u16 StartEvent, u16 StopEvent, u16 ResetEvent)
+{
+	u32 Idx;
+
+	XAie_AssertNonvoid(SamplerPtr != XAIE_NULL);
+	XAie_AssertNonvoid(Counter < SamplerPtr->NumCounters);
+
+	for (Idx = 0U; Idx < SamplerPtr->NumTiles; Idx++) {
+		(void)_XAieTile_PerfCounterControl(SamplerPtr->TileInstPtrs[Idx],
+				SamplerPtr->ModId, Counter, StartEvent,
+				StopEvent, ResetEvent);
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API takes a snapshot of the counters of all the tiles of a sampler and
+* appends one record per tile to the sample ring.
+*
+* @param	SamplerPtr - Pointer to the sampler.
+*
+* @return	Sequence number of the snapshot
+*
+* @note		Call it periodically, ex from a timer interrupt. The module
+* timer is read first, so the record time is never later than the counter
+* values. Four adjacent counters are read with one 128 bit read.
+*
+*******************************************************************************/
+u32 XAieTilePerf_Snapshot(XAieTilePerf_Sampler *SamplerPtr)
+{
+	XAieTilePerf_RingHdr *HdrPtr;
+	XAieTilePerf_Record *RecPtr;
+	XAieGbl_Tile *TileInstPtr;
+	const u32 *RegOff;
+	u32 Idx, Cnt, Head, Seq, Low, High;
+	u8 ModId;
+
+	XAie_AssertNonvoid(SamplerPtr != XAIE_NULL);
+
+	HdrPtr = SamplerPtr->RingHdr;
+	ModId = SamplerPtr->ModId;
+	RegOff = PerfCounter[ModId].RegOff;
+	Head = HdrPtr->Head;
+	Seq = HdrPtr->Seq;
+
+	for (Idx = 0U; Idx < SamplerPtr->NumTiles; Idx++) {
+		TileInstPtr = SamplerPtr->TileInstPtrs[Idx];
+		RecPtr = &SamplerPtr->Recs[Head % HdrPtr->NumRecs];
+
+		Low = XAieGbl_Read32(TileInstPtr->TileAddr +
+				TimerReg[ModId].LowOff);
+		High = XAieGbl_Read32(TileInstPtr->TileAddr +
+				TimerReg[ModId].HighOff);
+
+		RecPtr->Seq = Seq;
+		RecPtr->ColId = TileInstPtr->ColId;
+		RecPtr->RowId = (u8)TileInstPtr->RowId;
+		RecPtr->ModId = ModId;
+		RecPtr->Timer = ((u64)High << 0x20U) | Low;
+
+		if ((SamplerPtr->NumCounters == 4U) &&
+				((RegOff[0] & 0xFU) == 0U) &&
+				(RegOff[3] == (RegOff[0] + 12U))) {
+			XAieGbl_Read128(TileInstPtr->TileAddr + RegOff[0],
+					RecPtr->Counter);
+		} else {
+			for (Cnt = 0U; Cnt < XAIETILE_PERF_MAX_COUNTERS; Cnt++) {
+				RecPtr->Counter[Cnt] =
+					(Cnt < SamplerPtr->NumCounters) ?
+					XAieGbl_Read32(TileInstPtr->TileAddr +
+						RegOff[Cnt]) : 0U;
+			}
+		}
+		Head++;
+	}
+
+	HdrPtr->Seq = Seq + 1U;
+	__atomic_store_n(&HdrPtr->Head, Head, __ATOMIC_RELEASE);
+
+	return Seq;
+}
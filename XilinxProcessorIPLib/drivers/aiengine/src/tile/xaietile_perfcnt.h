@@ -18,6 +18,7 @@
 * ----- ------  -------- -----------------------------------------------------
 * 1.0  Hyun    10/02/2018  Initial creation
 * 1.1  Nishad  12/05/2018  Renamed ME attributes to AIE
+* 1.2  fl      10/14/2026  Add the array-wide sampling service
 * </pre>
 *
 ******************************************************************************/
@@ -29,7 +30,56 @@
 /***************************** Constant Definitions **************************/
 #define XAIETILE_PERFCNT_EVENT_INVALID		0xFFFFU
 
+#define XAIETILE_PERFCNT_MODULE_CORE		0x0
+#define XAIETILE_PERFCNT_MODULE_PL		0x1
+#define XAIETILE_PERFCNT_MODULE_MEM		0x2
+
+#define XAIETILE_PERF_RING_MAGIC		0x50454941U	/* "AIEP" */
+#define XAIETILE_PERF_RING_VERSION		1U
+#define XAIETILE_PERF_MAX_COUNTERS		4U
+
 /***************************** Type Definitions ******************************/
+/*
+ * Sample ring in memory, for consumers outside of the driver. All fields are
+ * little endian. The ring starts with a XAieTilePerf_RingHdr, followed by
+ * NumRecs records of RecSize bytes, each a XAieTilePerf_Record. Head counts
+ * the records ever written and is updated after the records of a snapshot,
+ * record N is at index N % NumRecs. A consumer that fell more than NumRecs
+ * records behind lost the oldest ones.
+ */
+typedef struct {
+	u32 Magic;		/**< XAIETILE_PERF_RING_MAGIC */
+	u16 Version;		/**< XAIETILE_PERF_RING_VERSION */
+	u16 RecSize;		/**< Bytes per record */
+	u32 NumRecs;		/**< Records in the ring */
+	u32 Head;		/**< Records written */
+	u32 Seq;		/**< Snapshots taken */
+	u32 Reserved[3];
+} XAieTilePerf_RingHdr;
+
+/*
+ * Sample of one tile, all the records of one snapshot share its Seq.
+ */
+typedef struct {
+	u32 Seq;		/**< Snapshot sequence number */
+	u16 ColId;		/**< Column of the tile */
+	u8 RowId;		/**< Row of the tile */
+	u8 ModId;		/**< XAIETILE_PERFCNT_MODULE_* */
+	u64 Timer;		/**< Module timer when sampled */
+	u32 Counter[XAIETILE_PERF_MAX_COUNTERS]; /**< Unused counters are 0 */
+} XAieTilePerf_Record;
+
+/*
+ * Sampler of the performance counters of a module in a set of tiles.
+ */
+typedef struct {
+	XAieGbl_Tile **TileInstPtrs;	/**< Sampled tiles */
+	u32 NumTiles;			/**< Number of tiles */
+	u8 ModId;			/**< XAIETILE_PERFCNT_MODULE_* */
+	u8 NumCounters;			/**< Counters sampled per tile */
+	XAieTilePerf_RingHdr *RingHdr;	/**< Sample ring */
+	XAieTilePerf_Record *Recs;	/**< Records of the ring */
+} XAieTilePerf_Sampler;
 
 /***************************** Macro Definitions *****************************/
 
@@ -49,6 +99,10 @@ u32 XAieTileMem_PerfCounterGet(XAieGbl_Tile *TileInstPtr, u8 Counter);
 u32 XAieTileMem_PerfCounterSet(XAieGbl_Tile *TileInstPtr, u8 Counter, u32 CounterVal);
 u32 XAieTileMem_PerfCounterEventValue(XAieGbl_Tile *TileInstPtr, u8 Counter, u32 EventVal);
 
+u8 XAieTilePerf_Init(XAieTilePerf_Sampler *SamplerPtr, XAieGbl_Tile **TileInstPtrs, u32 NumTiles, u8 ModId, u8 NumCounters, void *RingBase, u32 RingSize);
+u8 XAieTilePerf_CounterControl(XAieTilePerf_Sampler *SamplerPtr, u8 Counter, u16 StartEvent, u16 StopEvent, u16 ResetEvent);
+u32 XAieTilePerf_Snapshot(XAieTilePerf_Sampler *SamplerPtr);
+
 #endif		/* end of protection macro */
 
 /** @} */
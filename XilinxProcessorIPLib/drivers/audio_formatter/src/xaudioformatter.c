@@ -86,6 +86,8 @@ u32 XAudioFormatter_CfgInitialize(XAudioFormatter *InstancePtr,
 	/* Setup the instance */
 	InstancePtr->Config = *CfgPtr;
 	InstancePtr->BaseAddress = CfgPtr->BaseAddress;
+	InstancePtr->S2MMRing.State = XAUD_RING_IDLE;
+	InstancePtr->MM2SRing.State = XAUD_RING_IDLE;
 	val = XAudioFormatter_ReadReg(CfgPtr->BaseAddress,
 		XAUD_FORMATTER_CORE_CONFIG);
 	if (val & XAUD_CFG_MM2S_MASK) {
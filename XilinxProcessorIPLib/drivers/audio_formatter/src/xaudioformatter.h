@@ -21,6 +21,18 @@
 * The driver does the interrupt handling, and dispatch to the user application
 * through callback functions that user has registered.
 *
+* <b> Ring buffer </b>
+*
+* XAudioFormatter_RingInit() runs a channel as a continuous ring of periods.
+* The IOC interrupt of every period advances the hardware pointer and calls
+* the period callback. The application fills (MM2S) or reads (S2MM) the
+* period at XAudioFormatter_RingApplAddr() and hands it over with
+* XAudioFormatter_RingCommit(). A playback underrun or a capture overrun is
+* counted and reported to the xrun callback; with auto restart the channel
+* is reset and started again, playback once the start threshold is queued.
+* XAudioFormatter_RingPeriodBytes() gives the period size for a period time,
+* periods of 1 ms and less are possible within XAUD_PERIOD_BYTES_MIN.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -87,11 +99,18 @@ typedef enum {
         XAudioFormatter_ERROR_Handler,
 } XAudioFormatter_HandlerType;
 
+/* Ring buffer states */
+#define XAUD_RING_IDLE		0U	/**< Not configured or stopped */
+#define XAUD_RING_PREPARED	1U	/**< Configured, DMA not started */
+#define XAUD_RING_RUNNING	2U	/**< DMA running */
+#define XAUD_RING_XRUN		3U	/**< Stopped by an xrun */
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 
 /**************************** Type Definitions *******************************/
 typedef void (*XAudioFormatter_Callback)(void *CallbackRef);
+typedef void (*XAudioFormatter_PeriodCallback)(void *CallbackRef, u32 Avail);
 /**
 * This typedef contains configuration information for a audio formatter core.
 * Each audio formatter core should have a configuration structure associated.
@@ -118,6 +137,37 @@ typedef struct {
 } XAudioFormatter_Config;
 
 extern XAudioFormatter_Config XAudioFormatter_ConfigTable[];
+
+/**
+* This typedef contains hw params information for a audio formatter core.
+*/
+typedef struct {
+	u64 buf_addr;
+	u32 active_ch;
+	u32 bits_per_sample;
+	u32 periods;
+	u32 bytes_per_period;
+} XAudioFormatterHwParams;
+
+/**
+* Ring buffer state of one channel. HwPtr and ApplPtr count periods since the
+* start and wrap around, the period in the buffer is the count modulo the
+* number of periods.
+*/
+typedef struct {
+	XAudioFormatterHwParams HwParams;	/**< Ring buffer layout */
+	u32 StartThreshold;	/**< MM2S periods queued before the DMA
+				  *  starts */
+	u32 AutoRestart;	/**< Restart the channel after an xrun */
+	u32 State;		/**< XAUD_RING_* state */
+	volatile u32 HwPtr;	/**< Periods completed by the DMA */
+	volatile u32 ApplPtr;	/**< Periods committed by the application */
+	u32 XrunCount;		/**< Underruns or overruns seen */
+	XAudioFormatter_PeriodCallback PeriodCallback;
+	void *PeriodCallbackRef;
+	XAudioFormatter_Callback XrunCallback;
+	void *XrunCallbackRef;
+} XAudioFormatterRing;
 /******************************************************************************/
 /**
 *
@@ -145,19 +195,10 @@ typedef struct {
 	void *S2MMERRCallbackRef;
 	XAudioFormatter_Callback MM2SERRCallback;
 	void *MM2SERRCallbackRef;
+	XAudioFormatterRing S2MMRing;	/**< S2MM ring buffer state */
+	XAudioFormatterRing MM2SRing;	/**< MM2S ring buffer state */
 } XAudioFormatter;
 
-/**
-* This typedef contains hw params information for a audio formatter core.
-*/
-typedef struct {
-	u64 buf_addr;
-	u32 active_ch;
-	u32 bits_per_sample;
-	u32 periods;
-	u32 bytes_per_period;
-} XAudioFormatterHwParams;
-
 /*****************************************************************************/
 
 
@@ -189,6 +230,23 @@ void XAudioFormatterSetFsMultiplier(XAudioFormatter *InstancePtr, u32 Mclk,
 u32 XAudioFormatterGetDMATransferCount(XAudioFormatter *InstancePtr);
 void XSdiAud_GetChStat(XAudioFormatter *InstancePtr, u8 *ChStatBuf);
 void XAudioFormatterSetS2MMTimeOut(XAudioFormatter *InstancePtr, u32 TimeOut);
+
+u32 XAudioFormatter_RingPeriodBytes(u32 Rate, u32 Channels,
+	u32 BytesPerSample, u32 PeriodUs);
+u32 XAudioFormatter_RingInit(XAudioFormatter *InstancePtr,
+	XAudioFormatterHwParams *HwParams, u32 StartThreshold,
+	u32 AutoRestart);
+void XAudioFormatter_RingSetPeriodCallback(XAudioFormatter *InstancePtr,
+	XAudioFormatter_PeriodCallback CallbackFunc, void *CallbackRef);
+void XAudioFormatter_RingSetXrunCallback(XAudioFormatter *InstancePtr,
+	XAudioFormatter_Callback CallbackFunc, void *CallbackRef);
+u32 XAudioFormatter_RingStart(XAudioFormatter *InstancePtr);
+void XAudioFormatter_RingStop(XAudioFormatter *InstancePtr);
+u32 XAudioFormatter_RingAvail(XAudioFormatter *InstancePtr);
+UINTPTR XAudioFormatter_RingApplAddr(XAudioFormatter *InstancePtr);
+u32 XAudioFormatter_RingCommit(XAudioFormatter *InstancePtr, u32 Count);
+u32 XAudioFormatter_RingGetXrunCount(XAudioFormatter *InstancePtr);
+void XAudioFormatter_RingPeriodDone(XAudioFormatter *InstancePtr);
 /******************************************************************************/
 
 #ifdef __cplusplus
@@ -90,6 +90,7 @@ void *XAudioFormatterS2MMIntrHandler(void *InstancePtr)
 		XAUD_FORMATTER_STS + XAUD_FORMATTER_S2MM_OFFSET);
 	if (Data & XAUD_STS_IOC_IRQ_MASK) {
 		XAudioFormatter_InterruptClear(AFPtr, XAUD_STS_IOC_IRQ_MASK);
+		XAudioFormatter_RingPeriodDone(AFPtr);
 		if (AFPtr->S2MMIOCCallback)
 			AFPtr->S2MMIOCCallback(AFPtr);
 	}
@@ -121,6 +122,7 @@ void *XAudioFormatterMM2SIntrHandler(void *InstancePtr)
 		XAUD_FORMATTER_STS + XAUD_FORMATTER_MM2S_OFFSET);
 	if (Data & XAUD_STS_IOC_IRQ_MASK) {
 		XAudioFormatter_InterruptClear(AFPtr, XAUD_STS_IOC_IRQ_MASK);
+		XAudioFormatter_RingPeriodDone(AFPtr);
 		if (AFPtr->MM2SIOCCallback)
 			AFPtr->MM2SIOCCallback(AFPtr);
 	}
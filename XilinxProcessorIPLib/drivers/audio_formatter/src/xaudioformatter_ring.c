@@ -0,0 +1,473 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+*
+* @file xaudioformatter_ring.c
+* @addtogroup audio_formatter Overview
+* @{
+*
+* This file contains the ring buffer engine of the audio formatter driver. A
+* channel runs continuously over XAudioFormatterHwParams::periods periods,
+* the IOC interrupt of each period advances the hardware pointer and the
+* application hands periods over by advancing the application pointer.
+*
+* The functions work on the channel selected by InstancePtr->ChannelId, like
+* the other functions of the driver.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaudioformatter.h"
+
+/************************** Function Prototypes ******************************/
+
+static XAudioFormatterRing *XAudioFormatter_GetRing(
+	XAudioFormatter *InstancePtr);
+
+/************************** Function Definitions *****************************/
+
+static XAudioFormatterRing *XAudioFormatter_GetRing(
+	XAudioFormatter *InstancePtr)
+{
+	if (InstancePtr->ChannelId == XAudioFormatter_MM2S)
+		return &InstancePtr->MM2SRing;
+
+	return &InstancePtr->S2MMRing;
+}
+
+static UINTPTR XAudioFormatter_RingPeriodAddr(XAudioFormatterRing *Ring,
+	u32 Ptr)
+{
+	return (UINTPTR)(Ring->HwParams.buf_addr +
+		((u64)(Ptr % Ring->HwParams.periods) *
+		 Ring->HwParams.bytes_per_period));
+}
+
+/*
+ * Periods the application can fill (MM2S) or read (S2MM).
+ */
+static u32 XAudioFormatter_RingSpace(XAudioFormatter *InstancePtr,
+	XAudioFormatterRing *Ring)
+{
+	u32 Queued;
+
+	if (InstancePtr->ChannelId == XAudioFormatter_MM2S) {
+		Queued = Ring->ApplPtr - Ring->HwPtr;
+		return (Queued < Ring->HwParams.periods) ?
+			(Ring->HwParams.periods - Queued) : 0U;
+	}
+
+	Queued = Ring->HwPtr - Ring->ApplPtr;
+	return (Queued < Ring->HwParams.periods) ?
+		Queued : Ring->HwParams.periods;
+}
+
+static void XAudioFormatter_RingTrigger(XAudioFormatter *InstancePtr,
+	XAudioFormatterRing *Ring)
+{
+	if (Ring->State != XAUD_RING_PREPARED)
+		return;
+
+	/* Playback starts once enough data is queued */
+	if ((InstancePtr->ChannelId == XAudioFormatter_MM2S) &&
+	    ((Ring->ApplPtr - Ring->HwPtr) < Ring->StartThreshold))
+		return;
+
+	Ring->State = XAUD_RING_RUNNING;
+	XAudioFormatterDMAStart(InstancePtr);
+}
+
+static void XAudioFormatter_RingXrun(XAudioFormatter *InstancePtr,
+	XAudioFormatterRing *Ring)
+{
+	u32 offset;
+	u32 IrqMask;
+
+	Ring->XrunCount++;
+	XAudioFormatterDMAStop(InstancePtr);
+	Ring->State = XAUD_RING_XRUN;
+
+	if (Ring->XrunCallback)
+		Ring->XrunCallback(Ring->XrunCallbackRef);
+
+	if ((Ring->AutoRestart == 0U) || (Ring->State != XAUD_RING_XRUN))
+		return;
+
+	/* The reset clears the control register, keep the enabled interrupts */
+	offset = (InstancePtr->ChannelId == XAudioFormatter_MM2S) ?
+		XAUD_FORMATTER_MM2S_OFFSET : XAUD_FORMATTER_S2MM_OFFSET;
+	IrqMask = XAudioFormatter_ReadReg(InstancePtr->BaseAddress,
+		XAUD_FORMATTER_CTRL + offset) & (XAUD_CTRL_IOC_IRQ_MASK |
+		XAUD_CTRL_TIMEOUT_IRQ_MASK | XAUD_CTRL_ERR_IRQ_MASK);
+
+	XAudioFormatterDMAReset(InstancePtr);
+	XAudioFormatterSetHwParams(InstancePtr, &Ring->HwParams);
+	XAudioFormatter_InterruptEnable(InstancePtr, IrqMask);
+
+	/* The DMA starts over at the first period */
+	Ring->HwPtr = 0U;
+	Ring->ApplPtr = 0U;
+	Ring->State = XAUD_RING_PREPARED;
+	XAudioFormatter_RingTrigger(InstancePtr, Ring);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the period size in bytes for a period time.
+*
+* @param	Rate is the sample rate in Hz.
+* @param	Channels is the number of active channels.
+* @param	BytesPerSample is the size of one sample in memory.
+* @param	PeriodUs is the period time in us.
+*
+* @return	Bytes per period, a whole number of frames.
+*
+* @note		The result has to be within XAUD_PERIOD_BYTES_MIN and
+*		XAUD_PERIOD_BYTES_MAX to be usable as bytes_per_period.
+*
+******************************************************************************/
+u32 XAudioFormatter_RingPeriodBytes(u32 Rate, u32 Channels,
+	u32 BytesPerSample, u32 PeriodUs)
+{
+	u32 Frames;
+
+	Xil_AssertNonvoid(Rate > 0U);
+	Xil_AssertNonvoid(PeriodUs > 0U);
+
+	Frames = (u32)(((u64)Rate * PeriodUs + 999999U) / 1000000U);
+
+	return Frames * Channels * BytesPerSample;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function programs the channel for ring buffer operation and enables
+* its IOC interrupt. The DMA is started by XAudioFormatter_RingStart().
+*
+* @param	InstancePtr is a pointer to the XAudioFormatter instance.
+* @param	HwParams is the ring buffer layout, see
+*		XAudioFormatterSetHwParams().
+* @param	StartThreshold is the number of periods to queue before the
+*		MM2S DMA starts, at least 1. It is not used for S2MM.
+* @param	AutoRestart restarts the channel after an xrun when set,
+*		otherwise the channel stays stopped in XAUD_RING_XRUN.
+*
+* @return	XST_SUCCESS, or XST_INVALID_PARAM if the start threshold does
+*		not fit in the buffer.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XAudioFormatter_RingInit(XAudioFormatter *InstancePtr,
+	XAudioFormatterHwParams *HwParams, u32 StartThreshold,
+	u32 AutoRestart)
+{
+	XAudioFormatterRing *Ring;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(HwParams != NULL);
+
+	if ((InstancePtr->ChannelId == XAudioFormatter_MM2S) &&
+	    ((StartThreshold == 0U) || (StartThreshold > HwParams->periods)))
+		return XST_INVALID_PARAM;
+
+	Ring = XAudioFormatter_GetRing(InstancePtr);
+	Ring->State = XAUD_RING_IDLE;
+	XAudioFormatterDMAStop(InstancePtr);
+
+	Ring->HwParams = *HwParams;
+	Ring->StartThreshold = StartThreshold;
+	Ring->AutoRestart = AutoRestart;
+	Ring->HwPtr = 0U;
+	Ring->ApplPtr = 0U;
+	Ring->XrunCount = 0U;
+
+	XAudioFormatterDMAReset(InstancePtr);
+	XAudioFormatterSetHwParams(InstancePtr, &Ring->HwParams);
+	XAudioFormatter_InterruptEnable(InstancePtr, XAUD_CTRL_IOC_IRQ_MASK);
+	Ring->State = XAUD_RING_PREPARED;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the callback called from the IOC interrupt after each
+* completed period.
+*
+* @param	InstancePtr is a pointer to the XAudioFormatter instance.
+* @param	CallbackFunc is called with CallbackRef and the periods the
+*		application can process, see XAudioFormatter_RingAvail().
+* @param	CallbackRef is passed back to CallbackFunc.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAudioFormatter_RingSetPeriodCallback(XAudioFormatter *InstancePtr,
+	XAudioFormatter_PeriodCallback CallbackFunc, void *CallbackRef)
+{
+	XAudioFormatterRing *Ring;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Ring = XAudioFormatter_GetRing(InstancePtr);
+	Ring->PeriodCallback = CallbackFunc;
+	Ring->PeriodCallbackRef = CallbackRef;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the callback called from the IOC interrupt when a
+* playback underrun or capture overrun is detected, before the channel is
+* restarted.
+*
+* @param	InstancePtr is a pointer to the XAudioFormatter instance.
+* @param	CallbackFunc is the xrun callback.
+* @param	CallbackRef is passed back to CallbackFunc.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAudioFormatter_RingSetXrunCallback(XAudioFormatter *InstancePtr,
+	XAudioFormatter_Callback CallbackFunc, void *CallbackRef)
+{
+	XAudioFormatterRing *Ring;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Ring = XAudioFormatter_GetRing(InstancePtr);
+	Ring->XrunCallback = CallbackFunc;
+	Ring->XrunCallbackRef = CallbackRef;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts the ring buffer. S2MM starts right away, MM2S as soon
+* as the start threshold is queued.
+*
+* @param	InstancePtr is a pointer to the XAudioFormatter instance.
+*
+* @return	XST_SUCCESS, or XST_FAILURE if the ring is not prepared.
+*
+* @note		A ring stopped by an xrun is prepared again with
+*		XAudioFormatter_RingInit().
+*
+******************************************************************************/
+u32 XAudioFormatter_RingStart(XAudioFormatter *InstancePtr)
+{
+	XAudioFormatterRing *Ring;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Ring = XAudioFormatter_GetRing(InstancePtr);
+	if (Ring->State != XAUD_RING_PREPARED)
+		return XST_FAILURE;
+
+	XAudioFormatter_RingTrigger(InstancePtr, Ring);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stops the DMA of the ring buffer.
+*
+* @param	InstancePtr is a pointer to the XAudioFormatter instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAudioFormatter_RingStop(XAudioFormatter *InstancePtr)
+{
+	XAudioFormatterRing *Ring;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Ring = XAudioFormatter_GetRing(InstancePtr);
+	Ring->State = XAUD_RING_IDLE;
+	XAudioFormatterDMAStop(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of periods the application can fill
+* (MM2S) or read (S2MM) without waiting.
+*
+* @param	InstancePtr is a pointer to the XAudioFormatter instance.
+*
+* @return	Number of periods.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XAudioFormatter_RingAvail(XAudioFormatter *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	return XAudioFormatter_RingSpace(InstancePtr,
+		XAudioFormatter_GetRing(InstancePtr));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the address of the period at the application
+* pointer. For S2MM the period is invalidated in the data cache, so that it
+* can be read right away.
+*
+* @param	InstancePtr is a pointer to the XAudioFormatter instance.
+*
+* @return	Address of the period to fill or read next.
+*
+* @note		Only valid while XAudioFormatter_RingAvail() is not 0.
+*
+******************************************************************************/
+UINTPTR XAudioFormatter_RingApplAddr(XAudioFormatter *InstancePtr)
+{
+	XAudioFormatterRing *Ring;
+	UINTPTR Addr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Ring = XAudioFormatter_GetRing(InstancePtr);
+	Addr = XAudioFormatter_RingPeriodAddr(Ring, Ring->ApplPtr);
+	if (InstancePtr->ChannelId == XAudioFormatter_S2MM)
+		Xil_DCacheInvalidateRange((INTPTR)Addr,
+			Ring->HwParams.bytes_per_period);
+
+	return Addr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function advances the application pointer. For MM2S the committed
+* periods are flushed from the data cache and the DMA is started when the
+* start threshold is reached.
+*
+* @param	InstancePtr is a pointer to the XAudioFormatter instance.
+* @param	Count is the number of periods filled or read.
+*
+* @return	Number of periods committed, at most
+*		XAudioFormatter_RingAvail().
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XAudioFormatter_RingCommit(XAudioFormatter *InstancePtr, u32 Count)
+{
+	XAudioFormatterRing *Ring;
+	u32 Avail;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Ring = XAudioFormatter_GetRing(InstancePtr);
+	Avail = XAudioFormatter_RingSpace(InstancePtr, Ring);
+	if (Count > Avail)
+		Count = Avail;
+
+	if (InstancePtr->ChannelId == XAudioFormatter_MM2S) {
+		for (Index = 0U; Index < Count; Index++)
+			Xil_DCacheFlushRange((INTPTR)
+				XAudioFormatter_RingPeriodAddr(Ring,
+					Ring->ApplPtr + Index),
+				Ring->HwParams.bytes_per_period);
+	}
+	Ring->ApplPtr += Count;
+
+	XAudioFormatter_RingTrigger(InstancePtr, Ring);
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of xruns since XAudioFormatter_RingInit().
+*
+* @param	InstancePtr is a pointer to the XAudioFormatter instance.
+*
+* @return	Number of underruns (MM2S) or overruns (S2MM).
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XAudioFormatter_RingGetXrunCount(XAudioFormatter *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	return XAudioFormatter_GetRing(InstancePtr)->XrunCount;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function advances the hardware pointer by one period. It is called
+* by the interrupt handlers on IOC, for the channel in
+* InstancePtr->ChannelId.
+*
+* Playback underruns when the period the DMA plays next was not committed,
+* capture overruns when the period the DMA writes next was not read.
+*
+* @param	InstancePtr is a pointer to the XAudioFormatter instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAudioFormatter_RingPeriodDone(XAudioFormatter *InstancePtr)
+{
+	XAudioFormatterRing *Ring;
+	u32 Xrun;
+
+	Ring = XAudioFormatter_GetRing(InstancePtr);
+	if (Ring->State != XAUD_RING_RUNNING)
+		return;
+
+	Ring->HwPtr++;
+	if (InstancePtr->ChannelId == XAudioFormatter_MM2S)
+		Xrun = ((s32)(Ring->ApplPtr - Ring->HwPtr) <= 0) ? 1U : 0U;
+	else
+		Xrun = ((Ring->HwPtr - Ring->ApplPtr) >=
+			Ring->HwParams.periods) ? 1U : 0U;
+
+	if (Xrun != 0U) {
+		XAudioFormatter_RingXrun(InstancePtr, Ring);
+		return;
+	}
+
+	if (Ring->PeriodCallback)
+		Ring->PeriodCallback(Ring->PeriodCallbackRef,
+			XAudioFormatter_RingSpace(InstancePtr, Ring));
+}
+/** @} */
@@ -201,6 +201,14 @@
  *
  * </pre>
  *
+ * <b>Copy Queue</b>
+ *
+ * XAxiCdma_QueueSubmit() queues copies without any BD management by the
+ * application. When several copies are pending, the small ones are chained
+ * into one SG transfer; a single or large copy is done as a simple transfer.
+ * Completion is polled with XAxiCdma_QueuePoll(), and byte and latency
+ * counters are read with XAxiCdma_QueueGetStats().
+ *
  * <b>Physical/Virtual Addresses</b>
  *
  * Addresses for the transfer buffers are physical addresses.
@@ -319,6 +327,7 @@
  *                     for doxygen generation of examples.
  * 4.10  sa   08/12/22 Updated the examples to use latest MIG cannoical define
  * 		       i.e XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR.
+ * 4.12  fl   10/14/26 Added the copy queue front end in xaxicdma_queue.c.
  * </pre>
  *****************************************************************************/
 
@@ -348,6 +357,10 @@ extern "C" {
 #define XAXICDMA_SG_MODE        1
 #define XAXICDMA_SIMPLE_MODE    2
 
+/* Number of copies a copy queue holds, a power of 2
+ */
+#define XAXICDMA_QUEUE_DEPTH    32U
+
 /* Maximum active SG interrupt handler this driver can manage
  *
  * The limitation comes from the interrupt handler. It is now one interrupt
@@ -476,6 +489,62 @@ typedef struct {
 } XAxiCdma;
 /* @} */
 
+/**
+ * Callback of a queued copy, Status is XST_SUCCESS or XST_DMA_ERROR
+ */
+typedef void (*XAxiCdma_QueueDoneFn)(void *DoneRef, int Status);
+
+/**
+ * Time stamp function for the latency counters of a copy queue
+ */
+typedef u64 (*XAxiCdma_QueueTimeFn)(void);
+
+/**
+ * One copy of a copy queue
+ */
+typedef struct {
+	UINTPTR SrcAddr;		/**< Source buffer address */
+	UINTPTR DstAddr;		/**< Destination buffer address */
+	u32 Length;			/**< Length in bytes */
+	XAxiCdma_QueueDoneFn DoneFn;	/**< Completion callback */
+	void *DoneRef;			/**< Completion callback reference */
+	u64 SubmitTime;			/**< Time stamp of the submission */
+} XAxiCdma_QueueReq;
+
+/**
+ * The counters of a copy queue
+ */
+typedef struct {
+	u64 Bytes;		/**< Bytes copied */
+	u32 Copies;		/**< Copies completed successfully */
+	u32 Errors;		/**< Copies completed with an error */
+	u32 SimpleXfers;	/**< Copies done as a simple transfer */
+	u32 SgChains;		/**< SG transfers of chained copies */
+	u64 LatencySum;		/**< Sum of submission to completion times */
+	u64 LatencyMax;		/**< Largest submission to completion time */
+} XAxiCdma_QueueStats;
+
+/**
+ * @name XAxiCdma_Queue
+ *
+ * A copy queue on top of a driver instance, see xaxicdma_queue.c.
+ *
+ * @{
+ */
+typedef struct {
+	XAxiCdma *InstancePtr;		/**< Driver instance of the engine */
+	XAxiCdma_QueueReq Req[XAXICDMA_QUEUE_DEPTH]; /**< Copies */
+	u32 Head;			/**< Oldest copy not completed */
+	u32 Next;			/**< Oldest copy not started */
+	u32 Tail;			/**< Next free entry */
+	int Mode;			/**< Kind of the transfer in flight */
+	int Halted;			/**< Halted on a DMA error */
+	u32 SimpleMinLen;		/**< Length always done as simple */
+	XAxiCdma_QueueTimeFn TimeFn;	/**< Time stamp function or NULL */
+	XAxiCdma_QueueStats Stats;	/**< Counters */
+} XAxiCdma_Queue;
+/* @} */
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -565,6 +634,18 @@ u32 XAxiCdma_BdRingFree(XAxiCdma *InstancePtr, int NumBd,
 void XAxiCdma_BdSetCurBdPtr(XAxiCdma *InstancePtr, UINTPTR CurBdPtr);
 void XAxiCdma_BdSetTailBdPtr(XAxiCdma *InstancePtr, UINTPTR TailBdPtr);
 
+/* Copy queue API functions
+ */
+int XAxiCdma_QueueInit(XAxiCdma_Queue *QueuePtr, XAxiCdma *InstancePtr,
+		       u32 SimpleMinLen, XAxiCdma_QueueTimeFn TimeFn);
+int XAxiCdma_QueueSubmit(XAxiCdma_Queue *QueuePtr, UINTPTR SrcAddr,
+			 UINTPTR DstAddr, u32 Length,
+			 XAxiCdma_QueueDoneFn DoneFn, void *DoneRef);
+u32 XAxiCdma_QueuePoll(XAxiCdma_Queue *QueuePtr);
+int XAxiCdma_QueueIsBusy(XAxiCdma_Queue *QueuePtr);
+void XAxiCdma_QueueGetStats(XAxiCdma_Queue *QueuePtr,
+			    XAxiCdma_QueueStats *StatsPtr, int Clear);
+
 /* Debug utility function
  */
 void XAxiCdma_DumpRegisters(XAxiCdma *InstancePtr);
@@ -0,0 +1,470 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xaxicdma_queue.c
+* @addtogroup axicdma Overview
+* @{
+ *
+ * The implementation of the copy queue front end of the AXI CDMA driver.
+ *
+ * Copies are submitted to a software queue and started by the driver. When
+ * several copies are pending and the hardware has the SG engine, the small
+ * ones are chained into one SG transfer, so the hardware runs them back to
+ * back. A copy that is alone in the queue, or that is at least SimpleMinLen
+ * bytes long, is done with a simple transfer, which has no BD overhead.
+ *
+ * The queue is polled with XAxiCdma_QueuePoll(), the interrupts of the
+ * engine must stay disabled. The BD ring, if any, must not be used by the
+ * application while the queue owns the engine.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 4.12  fl   10/14/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxicdma.h"
+#include "xaxicdma_i.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XAXICDMA_QUEUE_MASK	(XAXICDMA_QUEUE_DEPTH - 1U)
+
+/* Transfer kinds of the queue */
+#define XAXICDMA_QUEUE_IDLE	0
+#define XAXICDMA_QUEUE_SIMPLE	1
+#define XAXICDMA_QUEUE_SG	2
+
+/************************** Function Prototypes ******************************/
+
+static void XAxiCdma_QueueStart(XAxiCdma_Queue *QueuePtr);
+static u32 XAxiCdma_QueueStartSg(XAxiCdma_Queue *QueuePtr, u32 NumReq);
+static void XAxiCdma_QueueDone(XAxiCdma_Queue *QueuePtr, int Status);
+
+/*****************************************************************************/
+/**
+ * This function initializes a copy queue on top of a driver instance.
+ *
+ * @param	QueuePtr is the queue to initialize
+ * @param	InstancePtr is the driver instance, initialized with
+ *		XAxiCdma_CfgInitialize(). To chain small copies, a BD ring must
+ *		have been created and cloned on the instance.
+ * @param	SimpleMinLen is the length in bytes from which a copy is always
+ *		done with a simple transfer
+ * @param	TimeFn is the function returning the time stamps used for the
+ *		latency counters, in any unit. NULL disables the latency
+ *		counters.
+ *
+ * @return
+ *		- XST_SUCCESS for success
+ *		- XST_FAILURE if the driver instance is not initialized
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+int XAxiCdma_QueueInit(XAxiCdma_Queue *QueuePtr, XAxiCdma *InstancePtr,
+		       u32 SimpleMinLen, XAxiCdma_QueueTimeFn TimeFn)
+{
+	if (!InstancePtr->Initialized) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "QueueInit: driver instance not "
+			    "initialized\r\n");
+		return XST_FAILURE;
+	}
+
+	memset(QueuePtr, 0, sizeof(XAxiCdma_Queue));
+
+	QueuePtr->InstancePtr = InstancePtr;
+	QueuePtr->SimpleMinLen = SimpleMinLen;
+	QueuePtr->TimeFn = TimeFn;
+	QueuePtr->Mode = XAXICDMA_QUEUE_IDLE;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function queues one copy. The copy is started right away if the
+ * engine is idle, else when the copies ahead of it are done.
+ *
+ * @param	QueuePtr is the queue we are working on
+ * @param	SrcAddr is the address of the source buffer
+ * @param	DstAddr is the address of the destination buffer
+ * @param	Length is the length of the copy in bytes
+ * @param	DoneFn is called by XAxiCdma_QueuePoll() when the copy is done,
+ *		NULL is fine
+ * @param	DoneRef is the reference pointer passed to DoneFn
+ *
+ * @return
+ *		- XST_SUCCESS if the copy is queued
+ *		- XST_INVALID_PARAM if Length is out of the valid range, or an
+ *		address is not aligned when DRE is not built in
+ *		- XST_FIFO_NO_ROOM if the queue is full
+ *		- XST_FAILURE if the queue is halted after a DMA error
+ *
+ * @note	The caller is responsible for the cache coherency of the
+ *		buffers.
+ *
+ *****************************************************************************/
+int XAxiCdma_QueueSubmit(XAxiCdma_Queue *QueuePtr, UINTPTR SrcAddr,
+			 UINTPTR DstAddr, u32 Length,
+			 XAxiCdma_QueueDoneFn DoneFn, void *DoneRef)
+{
+	XAxiCdma *InstancePtr = QueuePtr->InstancePtr;
+	XAxiCdma_QueueReq *ReqPtr;
+	u32 WordBits;
+
+	if (QueuePtr->Halted) {
+		return XST_FAILURE;
+	}
+
+	if ((Length < 1U) || (Length > (u32)InstancePtr->MaxTransLen)) {
+		return XST_INVALID_PARAM;
+	}
+
+	WordBits = (u32)(InstancePtr->WordLength - 1);
+
+	if (((SrcAddr & WordBits) || (DstAddr & WordBits)) &&
+	    !InstancePtr->HasDRE) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+			    "Unaligned transfer without DRE %x/%x\r\n",
+			    (unsigned int)SrcAddr, (unsigned int)DstAddr);
+
+		return XST_INVALID_PARAM;
+	}
+
+	if ((QueuePtr->Tail - QueuePtr->Head) == XAXICDMA_QUEUE_DEPTH) {
+		return XST_FIFO_NO_ROOM;
+	}
+
+	ReqPtr = &QueuePtr->Req[QueuePtr->Tail & XAXICDMA_QUEUE_MASK];
+	ReqPtr->SrcAddr = SrcAddr;
+	ReqPtr->DstAddr = DstAddr;
+	ReqPtr->Length = Length;
+	ReqPtr->DoneFn = DoneFn;
+	ReqPtr->DoneRef = DoneRef;
+	if (QueuePtr->TimeFn != NULL) {
+		ReqPtr->SubmitTime = QueuePtr->TimeFn();
+	}
+
+	QueuePtr->Tail++;
+
+	if (QueuePtr->Mode == XAXICDMA_QUEUE_IDLE) {
+		XAxiCdma_QueueStart(QueuePtr);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function checks the progress of the engine. The callbacks of the
+ * copies that are done are called in submission order, then the next
+ * pending copies are started.
+ *
+ * @param	QueuePtr is the queue we are working on
+ *
+ * @return	The number of copies completed by this call.
+ *
+ * @note	After a DMA error, the copies in flight and the pending copies
+ *		complete with XST_DMA_ERROR and the queue is halted. The engine
+ *		must be reset and the queue initialized again.
+ *
+ *****************************************************************************/
+u32 XAxiCdma_QueuePoll(XAxiCdma_Queue *QueuePtr)
+{
+	XAxiCdma *InstancePtr = QueuePtr->InstancePtr;
+	XAxiCdma_Bd *BdPtr;
+	XAxiCdma_Bd *CurBdPtr;
+	u32 Done = 0U;
+	u32 NumBd;
+	u32 Index;
+	int Tmp;
+
+	if (QueuePtr->Mode == XAXICDMA_QUEUE_SIMPLE) {
+		if (XAxiCdma_IsBusy(InstancePtr)) {
+			return 0U;
+		}
+
+		if (XAxiCdma_GetError(InstancePtr) != 0x0) {
+			QueuePtr->Halted = 1;
+		} else {
+			XAxiCdma_QueueDone(QueuePtr, XST_SUCCESS);
+			Done = 1U;
+		}
+	} else if (QueuePtr->Mode == XAXICDMA_QUEUE_SG) {
+		NumBd = XAxiCdma_BdRingFromHw(InstancePtr, XAXICDMA_ALL_BDS,
+					      &BdPtr);
+
+		CurBdPtr = BdPtr;
+		for (Index = 0U; Index < NumBd; Index++) {
+			if (XAxiCdma_BdGetSts(CurBdPtr) &
+			    XAXICDMA_BD_STS_ALL_ERR_MASK) {
+				QueuePtr->Halted = 1;
+				break;
+			}
+
+			XAxiCdma_QueueDone(QueuePtr, XST_SUCCESS);
+			CurBdPtr = XAxiCdma_BdRingNext(InstancePtr, CurBdPtr);
+		}
+		Done = Index;
+
+		if (NumBd > 0U) {
+			XAxiCdma_BdRingFree(InstancePtr, (int)NumBd, BdPtr);
+		}
+
+		if ((!QueuePtr->Halted) &&
+		    (XAxiCdma_GetError(InstancePtr) != 0x0)) {
+			QueuePtr->Halted = 1;
+		}
+
+		/* The whole chain is done, release its handler entry, which
+		 * is not consumed since the interrupts are disabled
+		 */
+		if ((!QueuePtr->Halted) &&
+		    (QueuePtr->Head == QueuePtr->Next)) {
+			Tmp = InstancePtr->SgHandlerHead + 1;
+
+			if (Tmp == XAXICDMA_MAXIMUM_MAX_HANDLER) {
+				Tmp = 0;
+			}
+
+			InstancePtr->SgHandlerHead = Tmp;
+		}
+	} else {
+		return 0U;
+	}
+
+	if (QueuePtr->Halted) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "QueuePoll: DMA error %x\r\n",
+			    (unsigned int)XAxiCdma_GetError(InstancePtr));
+
+		while (QueuePtr->Head != QueuePtr->Tail) {
+			XAxiCdma_QueueDone(QueuePtr, XST_DMA_ERROR);
+			Done++;
+		}
+		QueuePtr->Next = QueuePtr->Tail;
+		QueuePtr->Mode = XAXICDMA_QUEUE_IDLE;
+
+		return Done;
+	}
+
+	if (QueuePtr->Head == QueuePtr->Next) {
+		QueuePtr->Mode = XAXICDMA_QUEUE_IDLE;
+		XAxiCdma_QueueStart(QueuePtr);
+	}
+
+	return Done;
+}
+
+/*****************************************************************************/
+/**
+ * This function reports whether copies are pending or in flight.
+ *
+ * @param	QueuePtr is the queue we are working on
+ *
+ * @return	TRUE if the queue has copies not completed yet, FALSE if it is
+ *		empty.
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+int XAxiCdma_QueueIsBusy(XAxiCdma_Queue *QueuePtr)
+{
+	return (QueuePtr->Head != QueuePtr->Tail) ? TRUE : FALSE;
+}
+
+/*****************************************************************************/
+/**
+ * This function gets the counters of the queue, and optionally clears them.
+ *
+ * @param	QueuePtr is the queue we are working on
+ * @param	StatsPtr is where the counters are copied to
+ * @param	Clear is TRUE to clear the counters after the copy
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+void XAxiCdma_QueueGetStats(XAxiCdma_Queue *QueuePtr,
+			    XAxiCdma_QueueStats *StatsPtr, int Clear)
+{
+	memcpy(StatsPtr, &QueuePtr->Stats, sizeof(XAxiCdma_QueueStats));
+
+	if (Clear) {
+		memset(&QueuePtr->Stats, 0, sizeof(XAxiCdma_QueueStats));
+	}
+}
+
+/*****************************************************************************/
+/*
+ * Start the pending copies ahead of the queue. Small copies are chained
+ * into one SG transfer when more than one copy is pending; a copy that is
+ * alone or large is done with a simple transfer.
+ *
+ * @param	QueuePtr is the queue we are working on
+ *
+ * @return	None.
+ *
+ * @note	The engine must be idle.
+ *
+ *****************************************************************************/
+static void XAxiCdma_QueueStart(XAxiCdma_Queue *QueuePtr)
+{
+	XAxiCdma *InstancePtr = QueuePtr->InstancePtr;
+	XAxiCdma_QueueReq *ReqPtr;
+	u32 Pending = QueuePtr->Tail - QueuePtr->Next;
+	u32 NumReq = 0U;
+
+	if (Pending == 0U) {
+		return;
+	}
+
+	/* Count the small copies that can go in one chain */
+	if ((!InstancePtr->SimpleOnlyBuild) && (InstancePtr->AllBdCnt > 0)) {
+		while ((NumReq < Pending) &&
+		       (NumReq < (u32)InstancePtr->FreeBdCnt)) {
+			ReqPtr = &QueuePtr->Req[(QueuePtr->Next + NumReq) &
+						XAXICDMA_QUEUE_MASK];
+			if (ReqPtr->Length >= QueuePtr->SimpleMinLen) {
+				break;
+			}
+			NumReq++;
+		}
+	}
+
+	if ((NumReq > 1U) && (XAxiCdma_QueueStartSg(QueuePtr, NumReq) ==
+			      (u32)XST_SUCCESS)) {
+		QueuePtr->Next += NumReq;
+		QueuePtr->Mode = XAXICDMA_QUEUE_SG;
+		QueuePtr->Stats.SgChains++;
+
+		return;
+	}
+
+	ReqPtr = &QueuePtr->Req[QueuePtr->Next & XAXICDMA_QUEUE_MASK];
+	if (XAxiCdma_SimpleTransfer(InstancePtr, ReqPtr->SrcAddr,
+				    ReqPtr->DstAddr, (int)ReqPtr->Length,
+				    NULL, NULL) != (u32)XST_SUCCESS) {
+		/* The engine is idle and the copy is valid, only a hardware
+		 * fault can bring us here
+		 */
+		QueuePtr->Halted = 1;
+		while (QueuePtr->Head != QueuePtr->Tail) {
+			XAxiCdma_QueueDone(QueuePtr, XST_DMA_ERROR);
+		}
+		QueuePtr->Next = QueuePtr->Tail;
+
+		return;
+	}
+
+	QueuePtr->Next++;
+	QueuePtr->Mode = XAXICDMA_QUEUE_SIMPLE;
+	QueuePtr->Stats.SimpleXfers++;
+}
+
+/*****************************************************************************/
+/*
+ * Chain the pending copies ahead of the queue into one SG transfer.
+ *
+ * @param	QueuePtr is the queue we are working on
+ * @param	NumReq is the number of copies to chain, no more than the free
+ *		BDs of the ring
+ *
+ * @return
+ *		- XST_SUCCESS if the chain is submitted to the hardware
+ *		- XST_FAILURE if the BD ring could not take the chain, the BDs
+ *		are given back to the ring
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+static u32 XAxiCdma_QueueStartSg(XAxiCdma_Queue *QueuePtr, u32 NumReq)
+{
+	XAxiCdma *InstancePtr = QueuePtr->InstancePtr;
+	XAxiCdma_QueueReq *ReqPtr;
+	XAxiCdma_Bd *BdSetPtr;
+	XAxiCdma_Bd *BdPtr;
+	u32 Index;
+
+	if (XAxiCdma_BdRingAlloc(InstancePtr, (int)NumReq, &BdSetPtr) !=
+	    XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	BdPtr = BdSetPtr;
+	for (Index = 0U; Index < NumReq; Index++) {
+		ReqPtr = &QueuePtr->Req[(QueuePtr->Next + Index) &
+					XAXICDMA_QUEUE_MASK];
+
+		/* Alignment and length were checked at submission */
+		(void)XAxiCdma_BdSetSrcBufAddr(BdPtr, ReqPtr->SrcAddr);
+		(void)XAxiCdma_BdSetDstBufAddr(BdPtr, ReqPtr->DstAddr);
+		(void)XAxiCdma_BdSetLength(BdPtr, (int)ReqPtr->Length);
+
+		BdPtr = XAxiCdma_BdRingNext(InstancePtr, BdPtr);
+	}
+
+	if (XAxiCdma_BdRingToHw(InstancePtr, (int)NumReq, BdSetPtr, NULL,
+				NULL) != XST_SUCCESS) {
+		(void)XAxiCdma_BdRingUnAlloc(InstancePtr, (int)NumReq,
+					     BdSetPtr);
+
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+ * Complete the oldest copy of the queue: update the counters and call the
+ * callback of the copy.
+ *
+ * @param	QueuePtr is the queue we are working on
+ * @param	Status is the completion status of the copy
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+static void XAxiCdma_QueueDone(XAxiCdma_Queue *QueuePtr, int Status)
+{
+	XAxiCdma_QueueReq *ReqPtr;
+	u64 Latency;
+
+	ReqPtr = &QueuePtr->Req[QueuePtr->Head & XAXICDMA_QUEUE_MASK];
+	QueuePtr->Head++;
+
+	if (Status == XST_SUCCESS) {
+		QueuePtr->Stats.Copies++;
+		QueuePtr->Stats.Bytes += ReqPtr->Length;
+
+		if (QueuePtr->TimeFn != NULL) {
+			Latency = QueuePtr->TimeFn() - ReqPtr->SubmitTime;
+			QueuePtr->Stats.LatencySum += Latency;
+			if (Latency > QueuePtr->Stats.LatencyMax) {
+				QueuePtr->Stats.LatencyMax = Latency;
+			}
+		}
+	} else {
+		QueuePtr->Stats.Errors++;
+	}
+
+	if (ReqPtr->DoneFn != NULL) {
+		ReqPtr->DoneFn(ReqPtr->DoneRef, Status);
+	}
+}
+/** @} */
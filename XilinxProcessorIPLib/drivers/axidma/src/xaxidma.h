@@ -163,6 +163,14 @@
 *   -----   XAxiDma_Pause() or XAxiDma_Reset()                 ------
 * </pre>
 *
+* <b>Split Producer/Consumer Rings</b>
+*
+* A started BD ring can be handed to XAxiDma_BdRingSpscInit() so that one
+* processor submits BDs (XAxiDma_BdRingSpscAlloc(), XAxiDma_BdRingSpscToHw())
+* while another one reaps them (XAxiDma_BdRingSpscFromHw(),
+* XAxiDma_BdRingSpscFree()). The two sides exchange free running indices held
+* on separate cache lines, so no lock is needed between them.
+*
 * <b>Interrupt Coalescing</b>
 *
 * SGDMA provides control over the frequency of interrupts through interrupt
@@ -177,6 +185,12 @@
 *   and no new packets to process. Note that the interrupt will only fire if
 *   at least one packet has been processed.
 *
+* XAxiDma_CoalesceCtrlInit() sets up an optional adaptive controller that
+* moves both settings within application given bounds. The interrupt handler
+* reports the BDs it handled with XAxiDma_CoalesceCtrlIntr(), and a periodic
+* call to XAxiDma_CoalesceCtrlUpdate() retunes the channel and publishes the
+* interrupt rate and average BDs per interrupt of the last interval.
+*
 * <b> Interrupt </b>
 *
 * Interrupts are handled by the user application. Each DMA channel has its own
@@ -322,7 +336,9 @@
 * <b> Limitations </b>
 *
 * This driver does not have any mechanisms for mutual exclusion. It is up to
-* the application to provide this protection.
+* the application to provide this protection. The split producer/consumer
+* ring mode described above is the exception, for exactly one producer and
+* one consumer.
 *
 * <b> Hardware Defaults & Exclusive Use </b>
 *
@@ -456,6 +472,8 @@
 * 9.15  sa   08/12/22 Updated the examples to use latest MIG cannoical define
 * 		       i.e XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR.
 *      adk   08/16/22 Fix syntax error in the XAxiDma_BdRingGetCurrBd() API.
+* 9.17 fl    10/14/26 Added split producer/consumer BD ring mode.
+*      fl    10/14/26 Added adaptive interrupt coalescing controller.
 * </pre>
 *
 ******************************************************************************/
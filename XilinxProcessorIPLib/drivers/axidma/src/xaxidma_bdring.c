@@ -45,6 +45,12 @@
 *       rsp  01/17/18  Use virtual address for register read/write.
 *                      In _BdRingCreate() assign VA to BdaRestart CR#976392
 * 9.9   rsp  02/05/19  Fix XAxiDma_BdRingFromHw implementation for cyclic mode.
+* 9.17  fl   10/14/26  Added split producer/consumer ring API
+*		       XAxiDma_BdRingSpsc*() and factored the BD commit and
+*		       completion scan out of XAxiDma_BdRingToHw() and
+*		       XAxiDma_BdRingFromHw().
+*       fl   10/14/26  Added XAxiDma_BdRingToHwBatch() and flush committed BD
+*		       sets as address ranges instead of BD by BD.
 *
 * </pre>
 ******************************************************************************/
@@ -142,6 +148,30 @@
 		(BdPtr) = (XAxiDma_Bd*)Addr;                                  \
 	}
 
+/******************************************************************************
+ * Memory barrier used to publish and observe the free running indices of a
+ * split producer/consumer ring. A release is a barrier followed by the index
+ * store, an acquire is the index load followed by a barrier.
+ *
+ * @note	The hardware barrier orders the accesses for the other core,
+ *		the empty asm statement keeps the compiler from moving BD
+ *		accesses across it.
+ *
+ *****************************************************************************/
+#if defined (__MICROBLAZE__)
+#define XAXIDMA_SPSC_HW_BARRIER()	mbar(1)
+#elif defined (__riscv)
+#define XAXIDMA_SPSC_HW_BARRIER()	fence()
+#else
+#define XAXIDMA_SPSC_HW_BARRIER()	dmb()
+#endif
+
+#define XAXIDMA_SPSC_BARRIER()				\
+	{						\
+		XAXIDMA_SPSC_HW_BARRIER();		\
+		__asm__ __volatile__("" : : : "memory");	\
+	}
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
@@ -958,65 +988,34 @@ int XAxiDma_BdRingUnAlloc(XAxiDma_BdRing *RingPtr, int NumBd,
 }
 /*****************************************************************************/
 /**
- * Enqueue a set of BDs to hardware that were previously allocated by
- * XAxiDma_BdRingAlloc(). Once this function returns, the argument BD set goes
- * under hardware control. Changes to these BDs should be held until they are
- * finished by hardware to avoid data corruption and system instability.
- *
- * For transmit, the set will be rejected if the last BD of the set does not
- * mark the end of a packet or the first BD does not mark the start of a packet.
+ * Validate a set of BDs that is about to be handed to hardware and clear their
+ * completed status bit. Ring pointers and counters are not modified, so this
+ * is shared by all of the commit paths.
  *
  * @param	RingPtr is a pointer to the descriptor ring instance to be
  *		worked on.
- * @param	NumBd is the number of BDs in the set.
- * @param	BdSetPtr is the first BD of the set to commit to hardware.
+ * @param	NumBd is the number of BDs in the set, must be at least 1.
+ * @param	BdSetPtr is the first BD of the set.
+ * @param	LastBdPtr is an output parameter, it points to the last BD of
+ *		the set on success.
  *
  * @return
- *		- XST_SUCCESS if the set of BDs was accepted and enqueued to
- *		hardware
- *		- XST_INVALID_PARAM if passed in NumBd is negative
- *		- XST_FAILURE if the set of BDs was rejected because the first
- *		BD does not have its start-of-packet bit set, or the last BD
- *		does not have its end-of-packet bit set, or any one of the BDs
- *		has 0 length.
- *		- XST_DMA_SG_LIST_ERROR if this function was called out of
- *		sequence with XAxiDma_BdRingAlloc()
+ *		- XST_SUCCESS if the set of BDs is ready for hardware
+ *		- XST_FAILURE if the first BD does not have its start-of-packet
+ *		bit set, or the last BD does not have its end-of-packet bit set,
+ *		or any one of the BDs has 0 length.
  *
- * @note	This function should not be preempted by another XAxiDma ring
- *		function call that modifies the BD space. It is the caller's
- *		responsibility to provide a mutual exclusion mechanism.
- *
- *		This function can be used only when DMA is in SG mode
+ * @note	The caller is responsible for flushing the set with
+ *		XAxiDma_BdRingFlushSet() and for the final DATA_SYNC.
  *
  *****************************************************************************/
-int XAxiDma_BdRingToHw(XAxiDma_BdRing *RingPtr, int NumBd,
-		       XAxiDma_Bd *BdSetPtr)
+static int XAxiDma_BdRingPrepHw(XAxiDma_BdRing *RingPtr, int NumBd,
+				XAxiDma_Bd *BdSetPtr, XAxiDma_Bd **LastBdPtr)
 {
 	XAxiDma_Bd *CurBdPtr;
 	int i;
 	u32 BdCr;
 	u32 BdSts;
-	int RingIndex = RingPtr->RingIndex;
-
-	if (NumBd < 0) {
-
-		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingToHw: negative BD number "
-			    "%d\r\n", NumBd);
-
-		return XST_INVALID_PARAM;
-	}
-
-	/* If the commit set is empty, do nothing */
-	if (NumBd == 0) {
-		return XST_SUCCESS;
-	}
-
-	/* Make sure we are in sync with XAxiDma_BdRingAlloc() */
-	if ((RingPtr->PreCnt < NumBd) || (RingPtr->PreHead != BdSetPtr)) {
-
-		xdbg_printf(XDBG_DEBUG_ERROR, "Bd ring has problems\r\n");
-		return XST_DMA_SG_LIST_ERROR;
-	}
 
 	CurBdPtr = BdSetPtr;
 	BdCr = XAxiDma_BdGetCtrl(CurBdPtr);
@@ -1049,9 +1048,6 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing *RingPtr, int NumBd,
 		BdSts &=  ~XAXIDMA_BD_STS_COMPLETE_MASK;
 		XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
 
-		/* Flush the current BD so DMA core could see the updates */
-		XAXIDMA_CACHE_FLUSH(CurBdPtr);
-
 		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
 		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
 		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
@@ -1080,196 +1076,363 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing *RingPtr, int NumBd,
 	BdSts &= ~XAXIDMA_BD_STS_COMPLETE_MASK;
 	XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
 
-	/* Flush the last BD so DMA core could see the updates */
-	XAXIDMA_CACHE_FLUSH(CurBdPtr);
-	DATA_SYNC;
-
-	/* This set has completed pre-processing, adjust ring pointers and
-	 * counters
-	 */
-	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PreHead, NumBd);
-	RingPtr->PreCnt -= NumBd;
-	RingPtr->HwTail = CurBdPtr;
-	RingPtr->HwCnt += NumBd;
-
-	/* If it is running, signal the engine to begin processing */
-	if (RingPtr->RunState == AXIDMA_CHANNEL_NOT_HALTED) {
-		if (RingPtr->Cyclic) {
-			XAxiDma_WriteReg(RingPtr->ChanBase,
-					 XAXIDMA_TDESC_OFFSET,
-					 (u32)XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd));
-			if (RingPtr->Addr_ext)
-				XAxiDma_WriteReg(RingPtr->ChanBase,
-						 XAXIDMA_TDESC_MSB_OFFSET,
-						 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd)));
-			return XST_SUCCESS;
-		}
-
-		if (RingPtr->IsRxChannel) {
-			if (!RingIndex) {
-				XAxiDma_WriteReg(RingPtr->ChanBase,
-						 XAXIDMA_TDESC_OFFSET, (XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK));
-				if (RingPtr->Addr_ext)
-					XAxiDma_WriteReg(RingPtr->ChanBase, XAXIDMA_TDESC_MSB_OFFSET,
-							 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
-			} else {
-				XAxiDma_WriteReg(RingPtr->ChanBase,
-						 (XAXIDMA_RX_TDESC0_OFFSET +
-						  (RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET),
-						 (XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK ));
-				if (RingPtr->Addr_ext)
-					XAxiDma_WriteReg(RingPtr->ChanBase,
-							 (XAXIDMA_RX_TDESC0_MSB_OFFSET +
-							  (RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET),
-							 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
-			}
-		} else {
-			XAxiDma_WriteReg(RingPtr->ChanBase,
-					 XAXIDMA_TDESC_OFFSET, (XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK));
-			if (RingPtr->Addr_ext)
-				XAxiDma_WriteReg(RingPtr->ChanBase, XAXIDMA_TDESC_MSB_OFFSET,
-						 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
-		}
-	}
+	*LastBdPtr = CurBdPtr;
 
 	return XST_SUCCESS;
 }
 
 /*****************************************************************************/
 /**
- * Returns a set of BD(s) that have been processed by hardware. The returned
- * BDs may be examined by the application to determine the outcome of the DMA
- * transactions. Once the BDs have been examined, the application must call
- * XAxiDma_BdRingFree() in the same order which they were retrieved here.
- *
- * Example:
- *
- * <pre>
- *        NumBd = XAxiDma_BdRingFromHw(MyRingPtr, XAXIDMA_ALL_BDS, &MyBdSet);
+ * Flush a set of adjacent BDs out of the data cache so the DMA core sees the
+ * updates. The set is flushed as one address range, or as two ranges if it
+ * wraps around the end of the ring, instead of BD by BD.
  *
- *        if (NumBd == 0)
- *        {
- *           // hardware has nothing ready for us yet
- *        }
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	BdSetPtr is the first BD of the set.
+ * @param	NumBd is the number of BDs in the set.
  *
- *        CurBd = MyBdSet;
- *        for (i=0; i<NumBd; i++)
- *        {
- *           // Examine CurBd for post processing.....
+ * @return	None
  *
- *           // Onto next BD
- *           CurBd = XAxiDma_BdRingNext(MyRingPtr, CurBd);
- *        }
+ *****************************************************************************/
+static void XAxiDma_BdRingFlushSet(XAxiDma_BdRing *RingPtr,
+				   XAxiDma_Bd *BdSetPtr, int NumBd)
+{
+	UINTPTR Start = (UINTPTR)(void *)BdSetPtr;
+	UINTPTR RingEnd = RingPtr->FirstBdAddr + RingPtr->Length;
+	u32 Len = (u32)(RingPtr->Separation * (u32)NumBd);
+	u32 HeadLen;
+
+	if ((Start + Len) > RingEnd) {
+		HeadLen = (u32)(RingEnd - Start);
+		XAXIDMA_CACHE_FLUSH_RANGE(Start, HeadLen);
+		XAXIDMA_CACHE_FLUSH_RANGE(RingPtr->FirstBdAddr, Len - HeadLen);
+	} else {
+		XAXIDMA_CACHE_FLUSH_RANGE(Start, Len);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * Write the tail descriptor register of a running channel so the engine
+ * processes BDs up to and including TailBdPtr.
  *
- *        XAxiDma_BdRingFree(MyRingPtr, NumBd, MyBdSet); // Return the list
- * </pre>
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	TailBdPtr is the last BD committed to hardware.
  *
- * A more advanced use of this function may allocate multiple sets of BDs.
- * They must be retrieved from hardware and freed in the correct sequence:
- * <pre>
- *        // Legal
- *        XAxiDma_BdRingFromHw(MyRingPtr, NumBd1, &MySet1);
- *        XAxiDma_BdRingFree(MyRingPtr, NumBd1, MySet1);
+ * @return	None
  *
- *        // Legal
- *        XAxiDma_BdRingFromHw(MyRingPtr, NumBd1, &MySet1);
- *        XAxiDma_BdRingFromHw(MyRingPtr, NumBd2, &MySet2);
- *        XAxiDma_BdRingFree(MyRingPtr, NumBd1, MySet1);
- *        XAxiDma_BdRingFree(MyRingPtr, NumBd2, MySet2);
+ * @note	In cyclic mode the tail is always set to RingPtr->CyclicBd.
  *
- *        // Not legal
- *        XAxiDma_BdRingFromHw(MyRingPtr, NumBd1, &MySet1);
- *        XAxiDma_BdRingFromHw(MyRingPtr, NumBd2, &MySet2);
- *        XAxiDma_BdRingFree(MyRingPtr, NumBd2, MySet2);
- *        XAxiDma_BdRingFree(MyRingPtr, NumBd1, MySet1);
- * </pre>
+ *****************************************************************************/
+static void XAxiDma_BdRingUpdateTail(XAxiDma_BdRing *RingPtr,
+				     XAxiDma_Bd *TailBdPtr)
+{
+	int RingIndex = RingPtr->RingIndex;
+
+	if (RingPtr->Cyclic) {
+		XAxiDma_WriteReg(RingPtr->ChanBase,
+				 XAXIDMA_TDESC_OFFSET,
+				 (u32)XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd));
+		if (RingPtr->Addr_ext)
+			XAxiDma_WriteReg(RingPtr->ChanBase,
+					 XAXIDMA_TDESC_MSB_OFFSET,
+					 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd)));
+		return;
+	}
+
+	if (RingPtr->IsRxChannel) {
+		if (!RingIndex) {
+			XAxiDma_WriteReg(RingPtr->ChanBase,
+					 XAXIDMA_TDESC_OFFSET, (XAXIDMA_VIRT_TO_PHYS(TailBdPtr) & XAXIDMA_DESC_LSB_MASK));
+			if (RingPtr->Addr_ext)
+				XAxiDma_WriteReg(RingPtr->ChanBase, XAXIDMA_TDESC_MSB_OFFSET,
+						 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(TailBdPtr)));
+		} else {
+			XAxiDma_WriteReg(RingPtr->ChanBase,
+					 (XAXIDMA_RX_TDESC0_OFFSET +
+					  (RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET),
+					 (XAXIDMA_VIRT_TO_PHYS(TailBdPtr) & XAXIDMA_DESC_LSB_MASK ));
+			if (RingPtr->Addr_ext)
+				XAxiDma_WriteReg(RingPtr->ChanBase,
+						 (XAXIDMA_RX_TDESC0_MSB_OFFSET +
+						  (RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET),
+						 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(TailBdPtr)));
+		}
+	} else {
+		XAxiDma_WriteReg(RingPtr->ChanBase,
+				 XAXIDMA_TDESC_OFFSET, (XAXIDMA_VIRT_TO_PHYS(TailBdPtr) & XAXIDMA_DESC_LSB_MASK));
+		if (RingPtr->Addr_ext)
+			XAxiDma_WriteReg(RingPtr->ChanBase, XAXIDMA_TDESC_MSB_OFFSET,
+					 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(TailBdPtr)));
+	}
+}
+
+/*****************************************************************************/
+/**
+ * Enqueue a set of BDs to hardware that were previously allocated by
+ * XAxiDma_BdRingAlloc(). Once this function returns, the argument BD set goes
+ * under hardware control. Changes to these BDs should be held until they are
+ * finished by hardware to avoid data corruption and system instability.
  *
- * If hardware has partially completed a packet spanning multiple BDs, then
- * none of the BDs for that packet will be included in the results.
+ * For transmit, the set will be rejected if the last BD of the set does not
+ * mark the end of a packet or the first BD does not mark the start of a packet.
  *
  * @param	RingPtr is a pointer to the descriptor ring instance to be
  *		worked on.
- * @param	BdLimit is the maximum number of BDs to return in the set. Use
- *		XAXIDMA_ALL_BDS to return all BDs that have been processed.
- * @param	BdSetPtr is an output parameter, it points to the first BD
- *		available for examination.
- *
- * @return	The number of BDs processed by hardware. A value of 0 indicates
- *		that no data is available. No more than BdLimit BDs will be
- *		returned.
+ * @param	NumBd is the number of BDs in the set.
+ * @param	BdSetPtr is the first BD of the set to commit to hardware.
  *
- * @note	Treat BDs returned by this function as read-only.
+ * @return
+ *		- XST_SUCCESS if the set of BDs was accepted and enqueued to
+ *		hardware
+ *		- XST_INVALID_PARAM if passed in NumBd is negative
+ *		- XST_FAILURE if the set of BDs was rejected because the first
+ *		BD does not have its start-of-packet bit set, or the last BD
+ *		does not have its end-of-packet bit set, or any one of the BDs
+ *		has 0 length.
+ *		- XST_DMA_SG_LIST_ERROR if this function was called out of
+ *		sequence with XAxiDma_BdRingAlloc()
  *
- * 		This function should not be preempted by another XAxiDma ring
+ * @note	This function should not be preempted by another XAxiDma ring
  *		function call that modifies the BD space. It is the caller's
  *		responsibility to provide a mutual exclusion mechanism.
  *
  *		This function can be used only when DMA is in SG mode
  *
  *****************************************************************************/
-int XAxiDma_BdRingFromHw(XAxiDma_BdRing *RingPtr, int BdLimit,
-			 XAxiDma_Bd **BdSetPtr)
+int XAxiDma_BdRingToHw(XAxiDma_BdRing *RingPtr, int NumBd,
+		       XAxiDma_Bd *BdSetPtr)
 {
-	XAxiDma_Bd *CurBdPtr;
-	int BdCount;
-	int BdPartialCount;
-	u32 BdSts;
-	u32 BdCr;
+	XAxiDma_Bd *LastBdPtr;
+	int Status;
 
-	CurBdPtr = RingPtr->HwHead;
-	BdCount = 0;
-	BdPartialCount = 0;
-	BdSts = 0;
-	BdCr = 0;
+	if (NumBd < 0) {
 
-	/* If no BDs in work group, then there's nothing to search */
-	if (RingPtr->HwCnt == 0) {
-		*BdSetPtr = (XAxiDma_Bd *)NULL;
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingToHw: negative BD number "
+			    "%d\r\n", NumBd);
 
-		return 0;
+		return XST_INVALID_PARAM;
 	}
 
-	if (BdLimit > RingPtr->HwCnt) {
-		BdLimit = RingPtr->HwCnt;
+	/* If the commit set is empty, do nothing */
+	if (NumBd == 0) {
+		return XST_SUCCESS;
 	}
 
-	/* Starting at HwHead, keep moving forward in the list until:
-	 *  - A BD is encountered with its completed bit clear in the status
-	 *    word which means hardware has not completed processing of that
-	 *    BD.
-	 *  - RingPtr->HwTail is reached
-	 *  - The number of requested BDs has been processed
-	 */
-
-	while (BdCount < BdLimit) {
-		/* Read the status */
-		XAXIDMA_CACHE_INVALIDATE(CurBdPtr);
-		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
-		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
+	/* Make sure we are in sync with XAxiDma_BdRingAlloc() */
+	if ((RingPtr->PreCnt < NumBd) || (RingPtr->PreHead != BdSetPtr)) {
 
-		/* If the hardware still hasn't processed this BD then we are
-		 * done
-		 */
-		if (!(BdSts & XAXIDMA_BD_STS_COMPLETE_MASK)) {
-			break;
-		}
+		xdbg_printf(XDBG_DEBUG_ERROR, "Bd ring has problems\r\n");
+		return XST_DMA_SG_LIST_ERROR;
+	}
 
-		BdCount++;
+	Status = XAxiDma_BdRingPrepHw(RingPtr, NumBd, BdSetPtr, &LastBdPtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
 
-		/* Hardware has processed this BD so check the "last" bit. If
-		 * it is clear, then there are more BDs for the current packet.
-		 * Keep a count of these partial packet BDs.
-		 *
-		 * For tx BDs, EOF bit is in the control word
-		 * For rx BDs, EOF bit is in the status word
-		 */
-		if (((!(RingPtr->IsRxChannel) &&
-		      (BdCr & XAXIDMA_BD_CTRL_TXEOF_MASK)) ||
-		     ((RingPtr->IsRxChannel) && (BdSts &
-						 XAXIDMA_BD_STS_RXEOF_MASK)))) {
+	/* Flush the set so DMA core could see the updates */
+	XAxiDma_BdRingFlushSet(RingPtr, BdSetPtr, NumBd);
+	DATA_SYNC;
 
-			BdPartialCount = 0;
-		} else {
+	/* This set has completed pre-processing, adjust ring pointers and
+	 * counters
+	 */
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PreHead, NumBd);
+	RingPtr->PreCnt -= NumBd;
+	RingPtr->HwTail = LastBdPtr;
+	RingPtr->HwCnt += NumBd;
+
+	/* If it is running, signal the engine to begin processing */
+	if (RingPtr->RunState == AXIDMA_CHANNEL_NOT_HALTED) {
+		XAxiDma_BdRingUpdateTail(RingPtr, RingPtr->HwTail);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Enqueue several packets to hardware in one operation. The packets must have
+ * been allocated back to back with XAxiDma_BdRingAlloc() and are described by
+ * the number of BDs each of them uses. Compared to one XAxiDma_BdRingToHw()
+ * call per packet, the BDs are flushed as one contiguous range and the tail
+ * descriptor register is written once for the whole batch.
+ *
+ * Each packet is validated as XAxiDma_BdRingToHw() would validate it. If any
+ * packet is rejected, none of the batch is handed to hardware.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	NumPkts is the number of packets in the batch.
+ * @param	PktBdCnt is an array of NumPkts entries holding the number of
+ *		BDs of each packet.
+ * @param	BdSetPtr is the first BD of the first packet.
+ * @param	HwCntPtr is an output parameter, if not NULL it returns the
+ *		number of BDs under hardware control after the commit, i.e. the
+ *		BDs the hardware is still processing plus the completed ones not
+ *		yet retrieved with XAxiDma_BdRingFromHw().
+ *
+ * @return
+ *		- XST_SUCCESS if all packets were accepted and enqueued to
+ *		hardware
+ *		- XST_INVALID_PARAM if NumPkts is negative or a packet has no
+ *		BDs
+ *		- XST_FAILURE if a packet was rejected because its first BD
+ *		does not have its start-of-packet bit set, or its last BD
+ *		does not have its end-of-packet bit set, or any one of its BDs
+ *		has 0 length.
+ *		- XST_DMA_SG_LIST_ERROR if this function was called out of
+ *		sequence with XAxiDma_BdRingAlloc()
+ *
+ * @note	This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingToHwBatch(XAxiDma_BdRing *RingPtr, int NumPkts,
+			    const int *PktBdCnt, XAxiDma_Bd *BdSetPtr,
+			    int *HwCntPtr)
+{
+	XAxiDma_Bd *PktBdPtr;
+	XAxiDma_Bd *LastBdPtr = NULL;
+	int NumBd = 0;
+	int Index;
+	int Status;
+
+	if (NumPkts < 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingToHwBatch: negative "
+			    "packet number %d\r\n", NumPkts);
+
+		return XST_INVALID_PARAM;
+	}
+
+	for (Index = 0; Index < NumPkts; Index++) {
+		if (PktBdCnt[Index] <= 0) {
+
+			xdbg_printf(XDBG_DEBUG_ERROR, "BdRingToHwBatch: packet "
+				    "%d has %d BDs\r\n", Index,
+				    PktBdCnt[Index]);
+
+			return XST_INVALID_PARAM;
+		}
+		NumBd += PktBdCnt[Index];
+	}
+
+	if (NumBd == 0) {
+		if (HwCntPtr != NULL) {
+			*HwCntPtr = RingPtr->HwCnt;
+		}
+
+		return XST_SUCCESS;
+	}
+
+	/* Make sure we are in sync with XAxiDma_BdRingAlloc() */
+	if ((RingPtr->PreCnt < NumBd) || (RingPtr->PreHead != BdSetPtr)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "Bd ring has problems\r\n");
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	/* Validate every packet, the flush is done once for the batch */
+	PktBdPtr = BdSetPtr;
+	for (Index = 0; Index < NumPkts; Index++) {
+		Status = XAxiDma_BdRingPrepHw(RingPtr, PktBdCnt[Index],
+					      PktBdPtr, &LastBdPtr);
+		if (Status != XST_SUCCESS) {
+
+			xdbg_printf(XDBG_DEBUG_ERROR, "BdRingToHwBatch: packet "
+				    "%d rejected\r\n", Index);
+
+			return Status;
+		}
+		PktBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr,
+				LastBdPtr));
+	}
+
+	XAxiDma_BdRingFlushSet(RingPtr, BdSetPtr, NumBd);
+	DATA_SYNC;
+
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PreHead, NumBd);
+	RingPtr->PreCnt -= NumBd;
+	RingPtr->HwTail = LastBdPtr;
+	RingPtr->HwCnt += NumBd;
+
+	/* One tail pointer update for the whole batch */
+	if (RingPtr->RunState == AXIDMA_CHANNEL_NOT_HALTED) {
+		XAxiDma_BdRingUpdateTail(RingPtr, RingPtr->HwTail);
+	}
+
+	if (HwCntPtr != NULL) {
+		*HwCntPtr = RingPtr->HwCnt;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Walk the work group starting at HeadBdPtr and count the BDs that hardware
+ * has completed, stopping at the first BD that is still owned by hardware.
+ * BDs that belong to a partially completed packet are not counted.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	HeadBdPtr is the first BD to examine.
+ * @param	TailBdPtr is the last BD that may be examined, or NULL if the
+ *		walk is bounded by BdLimit only.
+ * @param	BdLimit is the maximum number of BDs to examine, it must not
+ *		exceed the number of BDs under hardware control.
+ *
+ * @return	The number of BDs of fully completed packets.
+ *
+ * @note	Ring pointers and counters are not modified.
+ *
+ *****************************************************************************/
+static int XAxiDma_BdRingScanHw(XAxiDma_BdRing *RingPtr,
+				XAxiDma_Bd *HeadBdPtr, XAxiDma_Bd *TailBdPtr,
+				int BdLimit)
+{
+	XAxiDma_Bd *CurBdPtr = HeadBdPtr;
+	int BdCount = 0;
+	int BdPartialCount = 0;
+	u32 BdSts;
+	u32 BdCr;
+
+	while (BdCount < BdLimit) {
+		/* Read the status */
+		XAXIDMA_CACHE_INVALIDATE(CurBdPtr);
+		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
+		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
+
+		/* If the hardware still hasn't processed this BD then we are
+		 * done
+		 */
+		if (!(BdSts & XAXIDMA_BD_STS_COMPLETE_MASK)) {
+			break;
+		}
+
+		BdCount++;
+
+		/* Hardware has processed this BD so check the "last" bit. If
+		 * it is clear, then there are more BDs for the current packet.
+		 * Keep a count of these partial packet BDs.
+		 *
+		 * For tx BDs, EOF bit is in the control word
+		 * For rx BDs, EOF bit is in the status word
+		 */
+		if (((!(RingPtr->IsRxChannel) &&
+		      (BdCr & XAXIDMA_BD_CTRL_TXEOF_MASK)) ||
+		     ((RingPtr->IsRxChannel) && (BdSts &
+						 XAXIDMA_BD_STS_RXEOF_MASK)))) {
+
+			BdPartialCount = 0;
+		} else {
 			BdPartialCount++;
 		}
 
@@ -1280,7 +1443,7 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing *RingPtr, int BdLimit,
 		}
 
 		/* Reached the end of the work group */
-		if (CurBdPtr == RingPtr->HwTail) {
+		if (CurBdPtr == TailBdPtr) {
 			break;
 		}
 
@@ -1291,6 +1454,108 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing *RingPtr, int BdLimit,
 	/* Subtract off any partial packet BDs found */
 	BdCount -= BdPartialCount;
 
+	return BdCount;
+}
+
+/*****************************************************************************/
+/**
+ * Returns a set of BD(s) that have been processed by hardware. The returned
+ * BDs may be examined by the application to determine the outcome of the DMA
+ * transactions. Once the BDs have been examined, the application must call
+ * XAxiDma_BdRingFree() in the same order which they were retrieved here.
+ *
+ * Example:
+ *
+ * <pre>
+ *        NumBd = XAxiDma_BdRingFromHw(MyRingPtr, XAXIDMA_ALL_BDS, &MyBdSet);
+ *
+ *        if (NumBd == 0)
+ *        {
+ *           // hardware has nothing ready for us yet
+ *        }
+ *
+ *        CurBd = MyBdSet;
+ *        for (i=0; i<NumBd; i++)
+ *        {
+ *           // Examine CurBd for post processing.....
+ *
+ *           // Onto next BD
+ *           CurBd = XAxiDma_BdRingNext(MyRingPtr, CurBd);
+ *        }
+ *
+ *        XAxiDma_BdRingFree(MyRingPtr, NumBd, MyBdSet); // Return the list
+ * </pre>
+ *
+ * A more advanced use of this function may allocate multiple sets of BDs.
+ * They must be retrieved from hardware and freed in the correct sequence:
+ * <pre>
+ *        // Legal
+ *        XAxiDma_BdRingFromHw(MyRingPtr, NumBd1, &MySet1);
+ *        XAxiDma_BdRingFree(MyRingPtr, NumBd1, MySet1);
+ *
+ *        // Legal
+ *        XAxiDma_BdRingFromHw(MyRingPtr, NumBd1, &MySet1);
+ *        XAxiDma_BdRingFromHw(MyRingPtr, NumBd2, &MySet2);
+ *        XAxiDma_BdRingFree(MyRingPtr, NumBd1, MySet1);
+ *        XAxiDma_BdRingFree(MyRingPtr, NumBd2, MySet2);
+ *
+ *        // Not legal
+ *        XAxiDma_BdRingFromHw(MyRingPtr, NumBd1, &MySet1);
+ *        XAxiDma_BdRingFromHw(MyRingPtr, NumBd2, &MySet2);
+ *        XAxiDma_BdRingFree(MyRingPtr, NumBd2, MySet2);
+ *        XAxiDma_BdRingFree(MyRingPtr, NumBd1, MySet1);
+ * </pre>
+ *
+ * If hardware has partially completed a packet spanning multiple BDs, then
+ * none of the BDs for that packet will be included in the results.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	BdLimit is the maximum number of BDs to return in the set. Use
+ *		XAXIDMA_ALL_BDS to return all BDs that have been processed.
+ * @param	BdSetPtr is an output parameter, it points to the first BD
+ *		available for examination.
+ *
+ * @return	The number of BDs processed by hardware. A value of 0 indicates
+ *		that no data is available. No more than BdLimit BDs will be
+ *		returned.
+ *
+ * @note	Treat BDs returned by this function as read-only.
+ *
+ * 		This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingFromHw(XAxiDma_BdRing *RingPtr, int BdLimit,
+			 XAxiDma_Bd **BdSetPtr)
+{
+	int BdCount;
+
+	/* If no BDs in work group, then there's nothing to search */
+	if (RingPtr->HwCnt == 0) {
+		*BdSetPtr = (XAxiDma_Bd *)NULL;
+
+		return 0;
+	}
+
+	if (BdLimit > RingPtr->HwCnt) {
+		BdLimit = RingPtr->HwCnt;
+	}
+
+	/* Starting at HwHead, keep moving forward in the list until:
+	 *  - A BD is encountered with its completed bit clear in the status
+	 *    word which means hardware has not completed processing of that
+	 *    BD.
+	 *  - RingPtr->HwTail is reached
+	 *  - The number of requested BDs has been processed
+	 */
+
+	BdCount = XAxiDma_BdRingScanHw(RingPtr, RingPtr->HwHead,
+				       RingPtr->HwTail, BdLimit);
+
 	/* If BdCount is non-zero then BDs were found to return. Set return
 	 * parameters, update pointers and counters, return success
 	 */
@@ -1369,6 +1634,322 @@ int XAxiDma_BdRingFree(XAxiDma_BdRing *RingPtr, int NumBd,
 
 	return XST_SUCCESS;
 }
+
+/*****************************************************************************/
+/**
+ * Put a BD ring in split producer/consumer mode. After this call one context
+ * (the producer) uses XAxiDma_BdRingSpscAlloc() and XAxiDma_BdRingSpscToHw(),
+ * and another context (the consumer) uses XAxiDma_BdRingSpscFromHw() and
+ * XAxiDma_BdRingSpscFree(). The two sides may run concurrently on different
+ * processors without any lock.
+ *
+ * @param	SpscPtr is a pointer to the SPSC control block to initialize.
+ *		It must be visible to both sides with coherent caching.
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		driven. The ring must have been created, cloned and started,
+ *		and all of its BDs must be in the free group.
+ *
+ * @return
+ *		- XST_SUCCESS if the ring is now in split producer/consumer mode
+ *		- XST_DMA_SG_NO_LIST if the BD list has not been created
+ *		- XST_INVALID_PARAM if the ring is in cyclic mode
+ *		- XST_DMA_SG_LIST_ERROR if some BDs are not in the free group
+ *		- XST_DMA_ERROR if the channel has not been started
+ *
+ * @note	The regular XAxiDma_BdRing*() functions that move BDs between
+ *		groups must not be used on the ring afterwards.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscInit(XAxiDma_BdRingSpsc *SpscPtr,
+			   XAxiDma_BdRing *RingPtr)
+{
+	if (RingPtr->AllCnt == 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscInit: no bds\r\n");
+
+		return XST_DMA_SG_NO_LIST;
+	}
+
+	if (RingPtr->Cyclic) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscInit: cyclic mode "
+			    "not supported\r\n");
+
+		return XST_INVALID_PARAM;
+	}
+
+	if (RingPtr->FreeCnt != RingPtr->AllCnt) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscInit: %d BDs in "
+			    "use\r\n", RingPtr->AllCnt - RingPtr->FreeCnt);
+
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	if (RingPtr->RunState != AXIDMA_CHANNEL_NOT_HALTED) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscInit: channel not "
+			    "started\r\n");
+
+		return XST_DMA_ERROR;
+	}
+
+	SpscPtr->RingPtr = RingPtr;
+	SpscPtr->SubmitIdx = 0U;
+	SpscPtr->AllocIdx = 0U;
+	SpscPtr->FreeIdx = 0U;
+	SpscPtr->ReapIdx = 0U;
+	XAXIDMA_SPSC_BARRIER();
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Producer side of XAxiDma_BdRingAlloc() for a ring in split producer/consumer
+ * mode. The allocated BDs are contiguous and must be committed with
+ * XAxiDma_BdRingSpscToHw() in the order they were allocated.
+ *
+ * @param	SpscPtr is a pointer to the SPSC control block.
+ * @param	NumBd is the number of BDs to allocate
+ * @param	BdSetPtr is an output parameter, it points to the first BD
+ *		available for modification.
+ *
+ * @return
+ *		- XST_SUCCESS if the requested number of BDs were returned in
+ *		the BdSetPtr parameter.
+ *		- XST_INVALID_PARAM if passed in NumBd is not positive
+ *		- XST_FAILURE if there were not enough free BDs to satisfy
+ *		the request.
+ *
+ * @note	Only the producer may call this function.
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscAlloc(XAxiDma_BdRingSpsc *SpscPtr, int NumBd,
+			    XAxiDma_Bd **BdSetPtr)
+{
+	XAxiDma_BdRing *RingPtr = SpscPtr->RingPtr;
+	u32 FreeIdx;
+	u32 FreeCnt;
+
+	if (NumBd <= 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscAlloc: negative BD "
+			    "number %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	/* Acquire the consumer index: the BDs it covers may be reused only
+	 * after the consumer is done reading them
+	 */
+	FreeIdx = SpscPtr->FreeIdx;
+	XAXIDMA_SPSC_BARRIER();
+
+	FreeCnt = (u32)RingPtr->AllCnt - (SpscPtr->AllocIdx - FreeIdx);
+	if (FreeCnt < (u32)NumBd) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+			    "Not enough BDs to alloc %d/%d\r\n", NumBd,
+			    (int)FreeCnt);
+
+		return XST_FAILURE;
+	}
+
+	/* Set the return argument and move FreeHead forward */
+	*BdSetPtr = RingPtr->FreeHead;
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->FreeHead, NumBd);
+	SpscPtr->AllocIdx += (u32)NumBd;
+	RingPtr->PreCnt += NumBd;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Producer side of XAxiDma_BdRingToHw() for a ring in split producer/consumer
+ * mode. The BDs are flushed and handed to hardware, then the submit index is
+ * published to the consumer.
+ *
+ * @param	SpscPtr is a pointer to the SPSC control block.
+ * @param	NumBd is the number of BDs in the set.
+ * @param	BdSetPtr is the first BD of the set to commit to hardware.
+ *
+ * @return
+ *		- XST_SUCCESS if the set of BDs was accepted and enqueued to
+ *		hardware
+ *		- XST_INVALID_PARAM if passed in NumBd is negative
+ *		- XST_FAILURE if the set of BDs was rejected, see
+ *		XAxiDma_BdRingToHw()
+ *		- XST_DMA_SG_LIST_ERROR if this function was called out of
+ *		sequence with XAxiDma_BdRingSpscAlloc()
+ *
+ * @note	Only the producer may call this function.
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscToHw(XAxiDma_BdRingSpsc *SpscPtr, int NumBd,
+			   XAxiDma_Bd *BdSetPtr)
+{
+	XAxiDma_BdRing *RingPtr = SpscPtr->RingPtr;
+	XAxiDma_Bd *LastBdPtr;
+	int Status;
+
+	if (NumBd < 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscToHw: negative BD "
+			    "number %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	if (NumBd == 0) {
+		return XST_SUCCESS;
+	}
+
+	/* Make sure we are in sync with XAxiDma_BdRingSpscAlloc() */
+	if ((RingPtr->PreCnt < NumBd) || (RingPtr->PreHead != BdSetPtr)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "Bd ring has problems\r\n");
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	Status = XAxiDma_BdRingPrepHw(RingPtr, NumBd, BdSetPtr, &LastBdPtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	/* Flush the set so DMA core could see the updates */
+	XAxiDma_BdRingFlushSet(RingPtr, BdSetPtr, NumBd);
+	DATA_SYNC;
+
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PreHead, NumBd);
+	RingPtr->PreCnt -= NumBd;
+	RingPtr->HwTail = LastBdPtr;
+
+	XAxiDma_BdRingUpdateTail(RingPtr, LastBdPtr);
+
+	/* Release the BDs to the consumer */
+	XAXIDMA_SPSC_BARRIER();
+	SpscPtr->SubmitIdx += (u32)NumBd;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Consumer side of XAxiDma_BdRingFromHw() for a ring in split
+ * producer/consumer mode. Only BDs that the producer has published are
+ * examined, so this never races with a concurrent XAxiDma_BdRingSpscToHw().
+ *
+ * @param	SpscPtr is a pointer to the SPSC control block.
+ * @param	BdLimit is the maximum number of BDs to return in the set. Use
+ *		XAXIDMA_ALL_BDS to return all BDs that have been processed.
+ * @param	BdSetPtr is an output parameter, it points to the first BD
+ *		available for examination.
+ *
+ * @return	The number of BDs processed by hardware. A value of 0 indicates
+ *		that no data is available. No more than BdLimit BDs will be
+ *		returned.
+ *
+ * @note	Only the consumer may call this function.
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscFromHw(XAxiDma_BdRingSpsc *SpscPtr, int BdLimit,
+			     XAxiDma_Bd **BdSetPtr)
+{
+	XAxiDma_BdRing *RingPtr = SpscPtr->RingPtr;
+	u32 SubmitIdx;
+	int HwCnt;
+	int BdCount;
+
+	/* Acquire the producer index before looking at the BDs it covers */
+	SubmitIdx = SpscPtr->SubmitIdx;
+	XAXIDMA_SPSC_BARRIER();
+
+	HwCnt = (int)(SubmitIdx - SpscPtr->ReapIdx);
+	if (HwCnt == 0) {
+		*BdSetPtr = (XAxiDma_Bd *)NULL;
+
+		return 0;
+	}
+
+	if (BdLimit > HwCnt) {
+		BdLimit = HwCnt;
+	}
+
+	BdCount = XAxiDma_BdRingScanHw(RingPtr, RingPtr->HwHead, NULL, BdLimit);
+	if (BdCount == 0) {
+		*BdSetPtr = (XAxiDma_Bd *)NULL;
+
+		return 0;
+	}
+
+	*BdSetPtr = RingPtr->HwHead;
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->HwHead, BdCount);
+	SpscPtr->ReapIdx += (u32)BdCount;
+	RingPtr->PostCnt += BdCount;
+
+	return BdCount;
+}
+
+/*****************************************************************************/
+/**
+ * Consumer side of XAxiDma_BdRingFree() for a ring in split producer/consumer
+ * mode. The BDs are returned to the free group and the free index is
+ * published to the producer.
+ *
+ * @param	SpscPtr is a pointer to the SPSC control block.
+ * @param	NumBd is the number of BDs to free.
+ * @param	BdSetPtr is the head of a list of BDs returned by
+ *		XAxiDma_BdRingSpscFromHw().
+ *
+ * @return
+ *		- XST_SUCCESS if the set of BDs was freed.
+ *		- XST_INVALID_PARAM if NumBd is negative
+ *		- XST_DMA_SG_LIST_ERROR if this function was called out of
+ *		sequence with XAxiDma_BdRingSpscFromHw().
+ *
+ * @note	Only the consumer may call this function.
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscFree(XAxiDma_BdRingSpsc *SpscPtr, int NumBd,
+			   XAxiDma_Bd *BdSetPtr)
+{
+	XAxiDma_BdRing *RingPtr = SpscPtr->RingPtr;
+
+	if (NumBd < 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR,
+			    "BdRingSpscFree: negative BDs %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	if (NumBd == 0) {
+		return XST_SUCCESS;
+	}
+
+	/* Make sure we are in sync with XAxiDma_BdRingSpscFromHw() */
+	if ((RingPtr->PostCnt < NumBd) || (RingPtr->PostHead != BdSetPtr)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscFree: Error free BDs: "
+			    "post count %d to free %d\r\n",
+			    RingPtr->PostCnt, NumBd);
+
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	RingPtr->PostCnt -= NumBd;
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PostHead, NumBd);
+
+	/* Release the BDs to the producer */
+	XAXIDMA_SPSC_BARRIER();
+	SpscPtr->FreeIdx += (u32)NumBd;
+
+	return XST_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
  * Check the internal data structures of the BD ring for the provided channel.
@@ -45,6 +45,10 @@
 * 9.2   vak  15/04/16  Fixed the compilation warnings in axidma driver
 * 9.7   rsp  01/11/18  Use UINTPTR instead of u32 for ChanBase CR#976392
 * 9.15  adk  08/16/22  Fix syntax error in the XAxiDma_BdRingGetCurrBd() API.
+* 9.17  fl   10/14/26  Added XAxiDma_BdRingSpsc for lock-free split
+*		       producer/consumer use of a BD ring.
+*       fl   10/14/26  Added XAxiDma_BdRingToHwBatch().
+*       fl   10/14/26  Added XAxiDma_CoalesceCtrl adaptive coalescing.
 *
 * </pre>
 *
@@ -74,6 +78,11 @@ extern "C" {
 #define XAXIDMA_NO_CHANGE		0xFFFFFFFF
 #define XAXIDMA_ALL_BDS			0x0FFFFFFF /* 268 Million */
 
+/* Alignment of the producer and consumer halves of XAxiDma_BdRingSpsc. It
+ * covers the largest data cache line of the supported processors.
+ */
+#define XAXIDMA_SPSC_ALIGN		64U
+
 /**************************** Type Definitions *******************************/
 
 /** Container structure for descriptor storage control. If address translation
@@ -113,6 +122,52 @@ typedef struct {
 	int Cyclic;		/**< Check for cyclic DMA Mode */
 } XAxiDma_BdRing;
 
+/** Split producer/consumer (SPSC) control block for a BD ring. One context
+ * allocates and commits BDs (producer), another one retrieves and frees them
+ * (consumer). Each side only writes its own half, the halves are placed on
+ * separate cache lines and the published indices are free running counters,
+ * so neither side needs a lock.
+ *
+ * While a ring is driven through this block, the FreeCnt and HwCnt members
+ * of XAxiDma_BdRing are not maintained; use XAxiDma_BdRingSpscGetFreeCnt()
+ * and XAxiDma_BdRingSpscGetHwCnt() instead.
+ */
+typedef struct {
+	XAxiDma_BdRing *RingPtr;	/**< BD ring being driven */
+
+	/* Producer half, written only by the producer */
+	volatile u32 SubmitIdx __attribute__ ((aligned(XAXIDMA_SPSC_ALIGN)));
+				/**< BDs committed to hardware, published */
+	u32 AllocIdx;		/**< BDs allocated by the producer */
+	u8 ProducerPad[XAXIDMA_SPSC_ALIGN - (2U * sizeof(u32))];
+				/**< Fills the producer cache line */
+
+	/* Consumer half, written only by the consumer */
+	volatile u32 FreeIdx __attribute__ ((aligned(XAXIDMA_SPSC_ALIGN)));
+				/**< BDs returned to the free group, published */
+	u32 ReapIdx;		/**< BDs retrieved from hardware */
+	u8 ConsumerPad[XAXIDMA_SPSC_ALIGN - (2U * sizeof(u32))];
+				/**< Fills the consumer cache line */
+} XAxiDma_BdRingSpsc;
+
+/** Adaptive interrupt coalescing controller state. The threshold and delay
+ * timer of the channel are retuned by XAxiDma_CoalesceCtrlUpdate() from the
+ * interrupts and BDs reported through XAxiDma_CoalesceCtrlIntr().
+ */
+typedef struct {
+	XAxiDma_BdRing *RingPtr;	/**< BD ring being controlled */
+	u32 MinCount;		/**< Lowest packet threshold */
+	u32 MaxCount;		/**< Highest packet threshold */
+	u32 MinTimer;		/**< Delay timer used with MinCount */
+	u32 MaxTimer;		/**< Delay timer used with MaxCount */
+	u32 CurCount;		/**< Packet threshold in use */
+	u32 CurTimer;		/**< Delay timer in use */
+	u32 IntrCnt;		/**< Interrupts in the current interval */
+	u32 BdCnt;		/**< BDs handled in the current interval */
+	u32 IntrPerSec;		/**< Interrupt rate of the last interval */
+	u32 AvgBdPerIntr;	/**< Average BDs per interrupt, last interval */
+} XAxiDma_CoalesceCtrl;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -518,6 +573,74 @@ typedef struct {
 #define XAxiDma_BdRingEnableCyclicDMA(RingPtr)			\
 	(RingPtr->Cyclic = 1)
 
+/****************************************************************************/
+/**
+* Return the number of BDs the producer of a split producer/consumer ring can
+* allocate. The result may be stale by the time it is used, but never
+* overstates the free space when called from the producer.
+*
+* @param	SpscPtr is the SPSC control block to operate on.
+*
+* @return	The number of BDs currently allocatable.
+*
+* @note
+*		C-style signature:
+*		int XAxiDma_BdRingSpscGetFreeCnt(XAxiDma_BdRingSpsc* SpscPtr)
+*
+*****************************************************************************/
+#define XAxiDma_BdRingSpscGetFreeCnt(SpscPtr)				\
+	((int)((u32)(SpscPtr)->RingPtr->AllCnt -			\
+	       ((SpscPtr)->AllocIdx - (SpscPtr)->FreeIdx)))
+
+/****************************************************************************/
+/**
+* Return the number of BDs of a split producer/consumer ring that are under
+* hardware control and have not yet been retrieved by the consumer.
+*
+* @param	SpscPtr is the SPSC control block to operate on.
+*
+* @return	The number of BDs in the work group.
+*
+* @note
+*		C-style signature:
+*		int XAxiDma_BdRingSpscGetHwCnt(XAxiDma_BdRingSpsc* SpscPtr)
+*
+*****************************************************************************/
+#define XAxiDma_BdRingSpscGetHwCnt(SpscPtr)				\
+	((int)((SpscPtr)->SubmitIdx - (SpscPtr)->ReapIdx))
+
+/****************************************************************************/
+/**
+* Return the interrupt rate measured over the last sampling interval of an
+* adaptive coalescing controller.
+*
+* @param	CtrlPtr is the controller to operate on.
+*
+* @return	Interrupts per second.
+*
+* @note
+*		C-style signature:
+*		u32 XAxiDma_CoalesceCtrlGetIntrRate(XAxiDma_CoalesceCtrl* CtrlPtr)
+*
+*****************************************************************************/
+#define XAxiDma_CoalesceCtrlGetIntrRate(CtrlPtr) ((CtrlPtr)->IntrPerSec)
+
+/****************************************************************************/
+/**
+* Return the average number of BDs handled per interrupt over the last
+* sampling interval of an adaptive coalescing controller.
+*
+* @param	CtrlPtr is the controller to operate on.
+*
+* @return	Average BDs per interrupt.
+*
+* @note
+*		C-style signature:
+*		u32 XAxiDma_CoalesceCtrlGetAvgBd(XAxiDma_CoalesceCtrl* CtrlPtr)
+*
+*****************************************************************************/
+#define XAxiDma_CoalesceCtrlGetAvgBd(CtrlPtr) ((CtrlPtr)->AvgBdPerIntr)
+
 /****************************************************************************/
 
 /************************* Function Prototypes ******************************/
@@ -536,6 +659,9 @@ int XAxiDma_BdRingUnAlloc(XAxiDma_BdRing *RingPtr, int NumBd,
 			  XAxiDma_Bd *BdSetPtr);
 int XAxiDma_BdRingToHw(XAxiDma_BdRing *RingPtr, int NumBd,
 		       XAxiDma_Bd *BdSetPtr);
+int XAxiDma_BdRingToHwBatch(XAxiDma_BdRing *RingPtr, int NumPkts,
+			    const int *PktBdCnt, XAxiDma_Bd *BdSetPtr,
+			    int *HwCntPtr);
 int XAxiDma_BdRingFromHw(XAxiDma_BdRing *RingPtr, int BdLimit,
 			 XAxiDma_Bd **BdSetPtr);
 int XAxiDma_BdRingFree(XAxiDma_BdRing *RingPtr, int NumBd,
@@ -545,6 +671,29 @@ int XAxiDma_BdRingSetCoalesce(XAxiDma_BdRing *RingPtr, u32 Counter, u32 Timer);
 void XAxiDma_BdRingGetCoalesce(XAxiDma_BdRing *RingPtr,
 			       u32 *CounterPtr, u32 *TimerPtr);
 
+/*
+ * Split producer/consumer ring functions xaxidma_bdring.c
+ */
+int XAxiDma_BdRingSpscInit(XAxiDma_BdRingSpsc *SpscPtr,
+			   XAxiDma_BdRing *RingPtr);
+int XAxiDma_BdRingSpscAlloc(XAxiDma_BdRingSpsc *SpscPtr, int NumBd,
+			    XAxiDma_Bd **BdSetPtr);
+int XAxiDma_BdRingSpscToHw(XAxiDma_BdRingSpsc *SpscPtr, int NumBd,
+			   XAxiDma_Bd *BdSetPtr);
+int XAxiDma_BdRingSpscFromHw(XAxiDma_BdRingSpsc *SpscPtr, int BdLimit,
+			     XAxiDma_Bd **BdSetPtr);
+int XAxiDma_BdRingSpscFree(XAxiDma_BdRingSpsc *SpscPtr, int NumBd,
+			   XAxiDma_Bd *BdSetPtr);
+
+/*
+ * Adaptive interrupt coalescing functions xaxidma_coalesce.c
+ */
+int XAxiDma_CoalesceCtrlInit(XAxiDma_CoalesceCtrl *CtrlPtr,
+			     XAxiDma_BdRing *RingPtr, u32 MinCount,
+			     u32 MaxCount, u32 MinTimer, u32 MaxTimer);
+void XAxiDma_CoalesceCtrlIntr(XAxiDma_CoalesceCtrl *CtrlPtr, u32 NumBd);
+int XAxiDma_CoalesceCtrlUpdate(XAxiDma_CoalesceCtrl *CtrlPtr, u32 IntervalUs);
+
 /* The following functions are for debug only
  */
 int XAxiDma_BdRingCheck(XAxiDma_BdRing *RingPtr);
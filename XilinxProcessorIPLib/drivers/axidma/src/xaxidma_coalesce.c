@@ -0,0 +1,225 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xaxidma_coalesce.c
+* @addtogroup AXIDMA Overview
+* @{
+*
+* This file implements an optional adaptive interrupt coalescing controller
+* on top of XAxiDma_BdRingSetCoalesce(). The application reports the number
+* of BDs handled by each interrupt and periodically calls the update function
+* with the length of the elapsed interval. The controller then moves the
+* packet threshold and the delay timer of the channel within the bounds
+* given at initialization:
+*
+*   - When interrupts are mostly raised by the packet threshold (the load is
+*     high), the threshold is doubled to cut the interrupt rate.
+*   - When interrupts are mostly raised by the delay timer (the load is low),
+*     the threshold is halved so that packets are not held back.
+*
+* The delay timer follows the threshold linearly between its bounds, so a
+* lightly loaded channel also gets the shortest delay.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.17  fl   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxidma_bdring.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XAXIDMA_US_PER_SEC	1000000U
+
+/* Largest coalescing threshold and delay timer values of the hardware */
+#define XAXIDMA_COALESCE_MAX	0xFFU
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+
+static u32 XAxiDma_CoalesceTimerFor(XAxiDma_CoalesceCtrl *CtrlPtr, u32 Count);
+
+/************************** Variable Definitions *****************************/
+
+
+/*****************************************************************************/
+/**
+ * Initialize an adaptive coalescing controller for a BD ring and program the
+ * channel with the lowest threshold and delay timer.
+ *
+ * @param	CtrlPtr is a pointer to the controller to initialize.
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		controlled.
+ * @param	MinCount is the smallest packet threshold, 1..255.
+ * @param	MaxCount is the largest packet threshold, MinCount..255.
+ * @param	MinTimer is the delay timer used with MinCount, 0..255.
+ * @param	MaxTimer is the delay timer used with MaxCount, MinTimer..255.
+ *		It bounds the latency added to the last packet of a burst.
+ *
+ * @return
+ *		- XST_SUCCESS if the controller is initialized
+ *		- XST_INVALID_PARAM if a bound is out of range
+ *		- XST_FAILURE if the channel could not be programmed
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_CoalesceCtrlInit(XAxiDma_CoalesceCtrl *CtrlPtr,
+			     XAxiDma_BdRing *RingPtr, u32 MinCount,
+			     u32 MaxCount, u32 MinTimer, u32 MaxTimer)
+{
+	if ((MinCount == 0U) || (MinCount > MaxCount) ||
+	    (MaxCount > XAXIDMA_COALESCE_MAX) || (MinTimer > MaxTimer) ||
+	    (MaxTimer > XAXIDMA_COALESCE_MAX)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "CoalesceCtrlInit: invalid "
+			    "bounds\r\n");
+
+		return XST_INVALID_PARAM;
+	}
+
+	CtrlPtr->RingPtr = RingPtr;
+	CtrlPtr->MinCount = MinCount;
+	CtrlPtr->MaxCount = MaxCount;
+	CtrlPtr->MinTimer = MinTimer;
+	CtrlPtr->MaxTimer = MaxTimer;
+	CtrlPtr->CurCount = MinCount;
+	CtrlPtr->CurTimer = MinTimer;
+	CtrlPtr->IntrCnt = 0U;
+	CtrlPtr->BdCnt = 0U;
+	CtrlPtr->IntrPerSec = 0U;
+	CtrlPtr->AvgBdPerIntr = 0U;
+
+	return XAxiDma_BdRingSetCoalesce(RingPtr, CtrlPtr->CurCount,
+					 CtrlPtr->CurTimer);
+}
+
+/*****************************************************************************/
+/**
+ * Account for one interrupt of the controlled channel. Call this from the
+ * interrupt handler with the number of BDs retrieved with
+ * XAxiDma_BdRingFromHw() while handling that interrupt.
+ *
+ * @param	CtrlPtr is a pointer to the controller.
+ * @param	NumBd is the number of BDs handled by this interrupt.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XAxiDma_CoalesceCtrlIntr(XAxiDma_CoalesceCtrl *CtrlPtr, u32 NumBd)
+{
+	CtrlPtr->IntrCnt++;
+	CtrlPtr->BdCnt += NumBd;
+}
+
+/*****************************************************************************/
+/**
+ * Close a sampling interval: compute the interrupt rate and the average
+ * number of BDs per interrupt, and retune the channel if the load changed.
+ *
+ * @param	CtrlPtr is a pointer to the controller.
+ * @param	IntervalUs is the length of the interval that just ended, in
+ *		microseconds.
+ *
+ * @return
+ *		- XST_SUCCESS if the statistics were updated
+ *		- XST_INVALID_PARAM if IntervalUs is 0
+ *		- XST_FAILURE if the channel could not be reprogrammed
+ *
+ * @note	This function must not run concurrently with
+ *		XAxiDma_CoalesceCtrlIntr() for the same controller; call it
+ *		with the channel interrupt masked or from the same context.
+ *
+ *****************************************************************************/
+int XAxiDma_CoalesceCtrlUpdate(XAxiDma_CoalesceCtrl *CtrlPtr, u32 IntervalUs)
+{
+	u32 IntrCnt = CtrlPtr->IntrCnt;
+	u32 BdCnt = CtrlPtr->BdCnt;
+	u32 Count = CtrlPtr->CurCount;
+	u32 Timer;
+
+	if (IntervalUs == 0U) {
+		return XST_INVALID_PARAM;
+	}
+
+	CtrlPtr->IntrCnt = 0U;
+	CtrlPtr->BdCnt = 0U;
+
+	CtrlPtr->IntrPerSec = (u32)(((u64)IntrCnt * XAXIDMA_US_PER_SEC) /
+				    IntervalUs);
+	CtrlPtr->AvgBdPerIntr = (IntrCnt != 0U) ? (BdCnt / IntrCnt) : 0U;
+
+	if (IntrCnt == 0U) {
+		/* Idle interval, fall back to the lowest latency setting */
+		Count = CtrlPtr->MinCount;
+	} else if (CtrlPtr->AvgBdPerIntr >= CtrlPtr->CurCount) {
+		/* Interrupts are raised by the threshold, raise it */
+		Count = CtrlPtr->CurCount << 1U;
+		if (Count > CtrlPtr->MaxCount) {
+			Count = CtrlPtr->MaxCount;
+		}
+	} else if ((CtrlPtr->AvgBdPerIntr << 1U) < CtrlPtr->CurCount) {
+		/* Interrupts are raised by the delay timer, lower it */
+		Count = CtrlPtr->CurCount >> 1U;
+		if (Count < CtrlPtr->MinCount) {
+			Count = CtrlPtr->MinCount;
+		}
+	}
+
+	if (Count == CtrlPtr->CurCount) {
+		return XST_SUCCESS;
+	}
+
+	Timer = XAxiDma_CoalesceTimerFor(CtrlPtr, Count);
+	if (XAxiDma_BdRingSetCoalesce(CtrlPtr->RingPtr, Count, Timer) !=
+	    XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	CtrlPtr->CurCount = Count;
+	CtrlPtr->CurTimer = Timer;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Compute the delay timer that goes with a packet threshold by linear
+ * interpolation between the controller bounds.
+ *
+ * @param	CtrlPtr is a pointer to the controller.
+ * @param	Count is the packet threshold, MinCount..MaxCount.
+ *
+ * @return	The delay timer value.
+ *
+ *****************************************************************************/
+static u32 XAxiDma_CoalesceTimerFor(XAxiDma_CoalesceCtrl *CtrlPtr, u32 Count)
+{
+	u32 CountSpan = CtrlPtr->MaxCount - CtrlPtr->MinCount;
+	u32 TimerSpan = CtrlPtr->MaxTimer - CtrlPtr->MinTimer;
+
+	if (CountSpan == 0U) {
+		return CtrlPtr->MaxTimer;
+	}
+
+	return CtrlPtr->MinTimer +
+	       ((Count - CtrlPtr->MinCount) * TimerSpan) / CountSpan;
+}
+/** @} */
@@ -0,0 +1,204 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xaxipmon_prof_decode.c
+*
+* This file contains a host program decoding a profiling ring written by the
+* XAxiPmon_Prof service of the AXI Performance Monitor driver. The ring is
+* read from a raw memory dump, for example taken with "mrd -bin" in XSDB or
+* read from /dev/mem, and printed as CSV, oldest record first. The byte count
+* metrics are also converted to a bandwidth in MB/s.
+*
+* Build it with the host compiler, it does not use the driver:
+*	gcc -o xaxipmon_prof_decode xaxipmon_prof_decode.c
+* and run it as:
+*	xaxipmon_prof_decode <dump file> <APM clock in Hz>
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------------
+* 6.11  fl     10/14/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Layout of XAxiPmon_ProfHeader and XAxiPmon_ProfRecord in xaxipmon.h,
+ * decoded byte by byte so that the host endianness does not matter.
+ */
+#define PROF_MAGIC		0x464F5250U
+#define PROF_VERSION		1U
+#define PROF_MAX_COUNTERS	10U
+#define PROF_HDR_SIZE		56U
+#define PROF_SEQ_INVALID	0xFFFFFFFFU
+
+#define HDR_MAGIC		0U
+#define HDR_VERSION		4U
+#define HDR_RECORD_SIZE		8U
+#define HDR_NUM_RECORDS		12U
+#define HDR_NUM_COUNTERS	16U
+#define HDR_SAMPLE_INTERVAL	20U
+#define HDR_METRIC		24U
+#define HDR_SLOT		34U
+#define HDR_RD_LAT_START	44U
+#define HDR_RD_LAT_END		45U
+#define HDR_WR_LAT_START	46U
+#define HDR_WR_LAT_END		47U
+#define HDR_HEAD		48U
+#define HDR_LOST		52U
+
+#define REC_TIMESTAMP		0U
+#define REC_SEQ			8U
+#define REC_INTERVAL		12U
+#define REC_COUNT		16U
+
+/* Byte count metrics, XAPM_METRIC_SET_2, _3 and _18 */
+#define IS_BYTE_METRIC(m)	(((m) == 2U) || ((m) == 3U) || ((m) == 18U))
+
+/************************** Function Prototypes ******************************/
+
+static uint32_t Get32(const uint8_t *Ptr);
+static uint64_t Get64(const uint8_t *Ptr);
+
+/************************** Variable Definitions *****************************/
+
+static const char *MetricName[] = {
+	"WrTranCnt", "RdTranCnt", "WrByteCnt", "RdByteCnt", "WrBeatCnt",
+	"TotRdLat", "TotWrLat", "SlvWrIdle", "MstRdIdle", "NumBValids",
+	"NumWLasts", "NumRLasts", "MinWrLat", "MaxWrLat", "MinRdLat",
+	"MaxRdLat", "XferCycles", "PktCnt", "DataByteCnt", "PosByteCnt",
+	"NullByteCnt", "SlvIdle", "MstIdle"
+};
+
+static uint32_t Get32(const uint8_t *Ptr)
+{
+	return (uint32_t)Ptr[0] | ((uint32_t)Ptr[1] << 8) |
+	       ((uint32_t)Ptr[2] << 16) | ((uint32_t)Ptr[3] << 24);
+}
+
+static uint64_t Get64(const uint8_t *Ptr)
+{
+	return (uint64_t)Get32(Ptr) | ((uint64_t)Get32(Ptr + 4) << 32);
+}
+
+int main(int argc, char *argv[])
+{
+	FILE *File;
+	uint8_t *Buf;
+	const uint8_t *Rec;
+	long Size;
+	double ClkHz;
+	uint32_t RecordSize, NumRecords, NumCounters, Head, Seq, First;
+	uint32_t Interval, Index, Count;
+	uint8_t Metric;
+
+	if (argc != 3) {
+		fprintf(stderr, "usage: %s <dump file> <APM clock in Hz>\n",
+			argv[0]);
+		return 1;
+	}
+	ClkHz = atof(argv[2]);
+
+	File = fopen(argv[1], "rb");
+	if (File == NULL) {
+		perror(argv[1]);
+		return 1;
+	}
+	fseek(File, 0, SEEK_END);
+	Size = ftell(File);
+	fseek(File, 0, SEEK_SET);
+	if (Size < (long)PROF_HDR_SIZE) {
+		fprintf(stderr, "%s: too short for a ring header\n", argv[1]);
+		fclose(File);
+		return 1;
+	}
+	Buf = malloc((size_t)Size);
+	if ((Buf == NULL) || (fread(Buf, 1, (size_t)Size, File) !=
+			      (size_t)Size)) {
+		fprintf(stderr, "%s: read failed\n", argv[1]);
+		fclose(File);
+		free(Buf);
+		return 1;
+	}
+	fclose(File);
+
+	RecordSize = Get32(Buf + HDR_RECORD_SIZE);
+	NumRecords = Get32(Buf + HDR_NUM_RECORDS);
+	NumCounters = Get32(Buf + HDR_NUM_COUNTERS);
+	Head = Get32(Buf + HDR_HEAD);
+	if ((Get32(Buf + HDR_MAGIC) != PROF_MAGIC) ||
+	    (Get32(Buf + HDR_VERSION) != PROF_VERSION) ||
+	    (RecordSize < (REC_COUNT + (4U * PROF_MAX_COUNTERS))) ||
+	    (NumCounters > PROF_MAX_COUNTERS) || (NumRecords == 0U) ||
+	    ((uint64_t)Size < PROF_HDR_SIZE +
+	     ((uint64_t)RecordSize * NumRecords))) {
+		fprintf(stderr, "%s: not a complete profiling ring\n", argv[1]);
+		free(Buf);
+		return 1;
+	}
+
+	printf("# interval %u cycles, rd latency %u-%u, wr latency %u-%u, "
+	       "%u records, %u lost\n", Get32(Buf + HDR_SAMPLE_INTERVAL),
+	       Buf[HDR_RD_LAT_START], Buf[HDR_RD_LAT_END],
+	       Buf[HDR_WR_LAT_START], Buf[HDR_WR_LAT_END], Head,
+	       Get32(Buf + HDR_LOST));
+	printf("seq,timestamp,time_us");
+	for (Index = 0U; Index < NumCounters; Index++) {
+		Metric = Buf[HDR_METRIC + Index];
+		printf(",%s_s%u",
+		       (Metric < (sizeof(MetricName) / sizeof(MetricName[0]))) ?
+		       MetricName[Metric] : "Metric", Buf[HDR_SLOT + Index]);
+		if (IS_BYTE_METRIC(Metric)) {
+			printf(",MBps_s%u", Buf[HDR_SLOT + Index]);
+		}
+	}
+	printf("\n");
+
+	/* Oldest record still in the ring */
+	First = (Head > NumRecords) ? (Head - NumRecords) : 0U;
+	for (Seq = First; Seq != Head; Seq++) {
+		Rec = Buf + PROF_HDR_SIZE +
+		      ((uint64_t)RecordSize * (Seq % NumRecords));
+
+		/* Torn by a write in progress, or overwritten after the dump */
+		if (Get32(Rec + REC_SEQ) != Seq) {
+			continue;
+		}
+
+		Interval = Get32(Rec + REC_INTERVAL);
+		printf("%u,%llu,%.3f", Seq,
+		       (unsigned long long)Get64(Rec + REC_TIMESTAMP),
+		       (ClkHz > 0.0) ?
+		       ((double)Get64(Rec + REC_TIMESTAMP) * 1e6 / ClkHz) : 0.0);
+		for (Index = 0U; Index < NumCounters; Index++) {
+			Count = Get32(Rec + REC_COUNT + (4U * Index));
+			printf(",%u", Count);
+			if (IS_BYTE_METRIC(Buf[HDR_METRIC + Index])) {
+				printf(",%.3f", (Interval != 0U) ?
+				       ((double)Count * ClkHz / Interval / 1e6) :
+				       0.0);
+			}
+		}
+		printf("\n");
+	}
+
+	free(Buf);
+
+	return 0;
+}
@@ -237,6 +237,8 @@
 * 6.6   ms   04/18/17 Modified tcl file to add suffix U for all macro
 *                     definitions of axipmon in xparameters.h
 * 6.10  ht   06/23/23 Added support for system device-tree flow.
+* 6.11  fl   10/14/26 Added the profiling service in xaxipmon_prof.c, which
+*                     streams time stamped sampled metrics to a memory ring.
 * </pre>
 *
 *****************************************************************************/
@@ -461,6 +463,57 @@ typedef struct {
 	u8   Mode;		/**< APM Mode */
 } XAxiPmon;
 
+/**
+ * @name Profiling ring definitions
+ * @{
+ */
+#define XAPM_PROF_MAGIC		0x464F5250U /**< "PROF" ring header magic */
+#define XAPM_PROF_VERSION	1U	    /**< Ring layout version */
+#define XAPM_PROF_SEQ_INVALID	0xFFFFFFFFU /**< Record being written */
+/*@}*/
+
+/**
+ * Header at the start of a profiling ring, followed by NumRecords records.
+ * All fields are little endian, the layout is shared with the host decoder
+ * in the examples folder.
+ */
+typedef struct {
+	u32 Magic;			/**< XAPM_PROF_MAGIC */
+	u32 Version;			/**< XAPM_PROF_VERSION */
+	u32 RecordSize;			/**< Size of a record in bytes */
+	u32 NumRecords;			/**< Records in the ring */
+	u32 NumCounters;		/**< Counters sampled per record */
+	u32 SampleInterval;		/**< Sample interval in clock cycles */
+	u8  Metric[XAPM_MAX_COUNTERS];	/**< Metric of each counter */
+	u8  Slot[XAPM_MAX_COUNTERS];	/**< Monitor slot of each counter */
+	u8  RdLatencyStart;		/**< Read latency start point */
+	u8  RdLatencyEnd;		/**< Read latency end point */
+	u8  WrLatencyStart;		/**< Write latency start point */
+	u8  WrLatencyEnd;		/**< Write latency end point */
+	u32 Head;			/**< Records written, free running */
+	u32 Lost;			/**< Sample intervals not recorded */
+} XAxiPmon_ProfHeader;
+
+/**
+ * Record of one sample interval. Seq is XAPM_PROF_SEQ_INVALID while the
+ * record is written, then the value of Head the record was written at.
+ */
+typedef struct {
+	u64 Timestamp;			/**< Global clock counter at sampling */
+	u32 Seq;			/**< Record sequence number */
+	u32 Interval;			/**< Sample interval in clock cycles */
+	u32 Count[XAPM_MAX_COUNTERS];	/**< Sampled metric counters */
+} XAxiPmon_ProfRecord;
+
+/**
+ * Profiling service instance, initialized with XAxiPmon_ProfInit().
+ */
+typedef struct {
+	XAxiPmon *InstancePtr;		/**< Monitor being sampled */
+	XAxiPmon_ProfHeader *HdrPtr;	/**< Ring header */
+	XAxiPmon_ProfRecord *RecPtr;	/**< First record of the ring */
+} XAxiPmon_Prof;
+
 /***************** Macros (Inline Functions) Definitions ********************/
 
 
@@ -920,6 +973,21 @@ u32 XAxiPmon_GetWriteIdMask(XAxiPmon *InstancePtr);
 u32 XAxiPmon_GetReadIdMask(XAxiPmon *InstancePtr);
 
 
+/**
+ * Functions in xaxipmon_prof.c
+ */
+s32 XAxiPmon_ProfInit(XAxiPmon_Prof *ProfPtr, XAxiPmon *InstancePtr,
+		      UINTPTR BufAddr, u32 BufSize);
+
+s32 XAxiPmon_ProfSetCounter(XAxiPmon_Prof *ProfPtr, u8 CounterNum, u8 Slot,
+			    u8 Metrics);
+
+s32 XAxiPmon_ProfStart(XAxiPmon_Prof *ProfPtr, u32 SampleInterval);
+
+void XAxiPmon_ProfStop(XAxiPmon_Prof *ProfPtr);
+
+void XAxiPmon_ProfIntrHandler(void *CallBackRef);
+
 /**
  * Functions in xaxipmon_selftest.c
  */
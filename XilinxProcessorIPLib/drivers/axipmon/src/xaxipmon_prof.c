@@ -0,0 +1,322 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xaxipmon_prof.c
+* @addtogroup axipmon Overview
+* @{
+*
+* This file contains the profiling service of the XAxiPmon driver. The
+* service samples the metric counters on every sample interval interrupt and
+* writes time stamped records into a ring in memory, see XAxiPmon_ProfHeader
+* for the layout.
+*
+* @note	None.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------------
+* 6.11  fl     10/14/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xaxipmon.h"
+#include "xil_cache.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a profiling service on a ring buffer.
+*
+* @param	ProfPtr is a pointer to the profiling service.
+* @param	InstancePtr is a pointer to the XAxiPmon instance, in Advanced
+*		mode.
+* @param	BufAddr is the ring buffer address, 8 byte aligned. It is
+*		typically in DDR so that a host can read it.
+* @param	BufSize is the ring buffer size in bytes.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_INVALID_PARAM if the buffer holds no record.
+*
+* @note		No counter is sampled until configured with
+*		XAxiPmon_ProfSetCounter().
+*
+******************************************************************************/
+s32 XAxiPmon_ProfInit(XAxiPmon_Prof *ProfPtr, XAxiPmon *InstancePtr,
+		      UINTPTR BufAddr, u32 BufSize)
+{
+	XAxiPmon_ProfHeader *HdrPtr;
+	u32 Index;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(ProfPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(InstancePtr->Mode == XAPM_MODE_ADVANCED);
+	Xil_AssertNonvoid((BufAddr & 0x7U) == 0U);
+
+	if (BufSize < (sizeof(XAxiPmon_ProfHeader) +
+		       sizeof(XAxiPmon_ProfRecord))) {
+		return XST_INVALID_PARAM;
+	}
+
+	HdrPtr = (XAxiPmon_ProfHeader *)BufAddr;
+	HdrPtr->Magic = XAPM_PROF_MAGIC;
+	HdrPtr->Version = XAPM_PROF_VERSION;
+	HdrPtr->RecordSize = (u32)sizeof(XAxiPmon_ProfRecord);
+	HdrPtr->NumRecords = (BufSize - (u32)sizeof(XAxiPmon_ProfHeader)) /
+			     (u32)sizeof(XAxiPmon_ProfRecord);
+	HdrPtr->NumCounters = 0U;
+	HdrPtr->SampleInterval = 0U;
+	for (Index = 0U; Index < XAPM_MAX_COUNTERS; Index++) {
+		HdrPtr->Metric[Index] = 0U;
+		HdrPtr->Slot[Index] = 0U;
+	}
+	HdrPtr->RdLatencyStart = 0U;
+	HdrPtr->RdLatencyEnd = 0U;
+	HdrPtr->WrLatencyStart = 0U;
+	HdrPtr->WrLatencyEnd = 0U;
+	HdrPtr->Head = 0U;
+	HdrPtr->Lost = 0U;
+
+	ProfPtr->InstancePtr = InstancePtr;
+	ProfPtr->HdrPtr = HdrPtr;
+	ProfPtr->RecPtr = (XAxiPmon_ProfRecord *)(BufAddr +
+						  sizeof(XAxiPmon_ProfHeader));
+
+	Xil_DCacheFlushRange(BufAddr, sizeof(XAxiPmon_ProfHeader));
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function assigns a metric of a monitor slot to a counter sampled by
+* the profiling service. Counters are sampled from 0 to the highest counter
+* configured.
+*
+* @param	ProfPtr is a pointer to the profiling service.
+* @param	CounterNum is the counter number, 0 to 9.
+* @param	Slot is the monitor slot, 0 to 7.
+* @param	Metrics is one of the XAPM_METRIC_SET_* values.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if the metric could not be set.
+*
+* @note		Call before XAxiPmon_ProfStart().
+*
+******************************************************************************/
+s32 XAxiPmon_ProfSetCounter(XAxiPmon_Prof *ProfPtr, u8 CounterNum, u8 Slot,
+			    u8 Metrics)
+{
+	XAxiPmon_ProfHeader *HdrPtr;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(ProfPtr != NULL);
+	Xil_AssertNonvoid(CounterNum < XAPM_MAX_COUNTERS);
+
+	if (XAxiPmon_SetMetrics(ProfPtr->InstancePtr, Slot, Metrics,
+				CounterNum) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	HdrPtr = ProfPtr->HdrPtr;
+	HdrPtr->Metric[CounterNum] = Metrics;
+	HdrPtr->Slot[CounterNum] = Slot;
+	if (HdrPtr->NumCounters <= CounterNum) {
+		HdrPtr->NumCounters = (u32)CounterNum + 1U;
+	}
+
+	Xil_DCacheFlushRange((UINTPTR)HdrPtr, sizeof(XAxiPmon_ProfHeader));
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts the profiling service. The metric counters are reset
+* on every sample interval lapse, so every record holds the counts of one
+* interval.
+*
+* @param	ProfPtr is a pointer to the profiling service.
+* @param	SampleInterval is the sample interval in APM clock cycles.
+*
+* @return	XST_SUCCESS
+*
+* @note		XAxiPmon_ProfIntrHandler() must be connected to the APM
+*		interrupt. The latency start and end points in effect are
+*		recorded in the ring header.
+*
+******************************************************************************/
+s32 XAxiPmon_ProfStart(XAxiPmon_Prof *ProfPtr, u32 SampleInterval)
+{
+	XAxiPmon *InstancePtr;
+	XAxiPmon_ProfHeader *HdrPtr;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(ProfPtr != NULL);
+	Xil_AssertNonvoid(SampleInterval != 0U);
+
+	InstancePtr = ProfPtr->InstancePtr;
+	HdrPtr = ProfPtr->HdrPtr;
+
+	HdrPtr->SampleInterval = SampleInterval;
+	HdrPtr->RdLatencyStart = XAxiPmon_GetRdLatencyStart(InstancePtr);
+	HdrPtr->RdLatencyEnd = XAxiPmon_GetRdLatencyEnd(InstancePtr);
+	HdrPtr->WrLatencyStart = XAxiPmon_GetWrLatencyStart(InstancePtr);
+	HdrPtr->WrLatencyEnd = XAxiPmon_GetWrLatencyEnd(InstancePtr);
+	Xil_DCacheFlushRange((UINTPTR)HdrPtr, sizeof(XAxiPmon_ProfHeader));
+
+	(void)XAxiPmon_ResetMetricCounter(InstancePtr);
+	XAxiPmon_IntrClear(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+	XAxiPmon_IntrEnable(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+	XAxiPmon_IntrGlobalEnable(InstancePtr);
+
+	(void)XAxiPmon_StartCounters(InstancePtr, SampleInterval);
+
+	/* Keep the down counter enabled and reset the counters on lapse */
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_SICR_OFFSET,
+			  XAPM_SICR_ENABLE_MASK | XAPM_SICR_MCNTR_RST_MASK);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stops the profiling service, the records already written
+* remain in the ring.
+*
+* @param	ProfPtr is a pointer to the profiling service.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAxiPmon_ProfStop(XAxiPmon_Prof *ProfPtr)
+{
+	XAxiPmon *InstancePtr;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(ProfPtr != NULL);
+
+	InstancePtr = ProfPtr->InstancePtr;
+
+	XAxiPmon_DisableSampleIntervalCounter(InstancePtr);
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_IE_OFFSET,
+			  XAxiPmon_ReadReg(InstancePtr->Config.BaseAddress,
+					   XAPM_IE_OFFSET) &
+			  ~XAPM_IXR_SIC_OVERFLOW_MASK);
+	(void)XAxiPmon_StopCounters(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler of the profiling service. On a
+* sample interval lapse it writes one record with the sampled counters to
+* the ring, overwriting the oldest record once the ring is full.
+*
+* @param	CallBackRef is a pointer to the XAxiPmon_Prof profiling
+*		service.
+*
+* @return	None.
+*
+* @note		A record is marked invalid while it is written, so a host
+*		reading the ring concurrently can skip it. Lapses missed
+*		because the interrupt was served late are counted in the Lost
+*		field of the header.
+*
+******************************************************************************/
+void XAxiPmon_ProfIntrHandler(void *CallBackRef)
+{
+	XAxiPmon_Prof *ProfPtr = (XAxiPmon_Prof *)CallBackRef;
+	XAxiPmon *InstancePtr;
+	XAxiPmon_ProfHeader *HdrPtr;
+	XAxiPmon_ProfRecord *RecPtr;
+	u32 IntrStatus;
+	u32 CntHigh;
+	u32 CntLow;
+	u32 Head;
+	u32 Index;
+
+	Xil_AssertVoid(ProfPtr != NULL);
+
+	InstancePtr = ProfPtr->InstancePtr;
+	HdrPtr = ProfPtr->HdrPtr;
+
+	IntrStatus = XAxiPmon_IntrGetStatus(InstancePtr);
+	XAxiPmon_IntrClear(InstancePtr, IntrStatus);
+	if ((IntrStatus & XAPM_IXR_SIC_OVERFLOW_MASK) == 0U) {
+		return;
+	}
+
+	Head = HdrPtr->Head;
+	RecPtr = &ProfPtr->RecPtr[Head % HdrPtr->NumRecords];
+
+	RecPtr->Seq = XAPM_PROF_SEQ_INVALID;
+	Xil_DCacheFlushRange((UINTPTR)&RecPtr->Seq, sizeof(RecPtr->Seq));
+
+	XAxiPmon_GetGlobalClkCounter(InstancePtr, &CntHigh, &CntLow);
+	RecPtr->Timestamp = ((u64)CntHigh << 32U) | (u64)CntLow;
+	RecPtr->Interval = HdrPtr->SampleInterval;
+	for (Index = 0U; Index < XAPM_MAX_COUNTERS; Index++) {
+		if ((Index < HdrPtr->NumCounters) &&
+		    (InstancePtr->Config.HaveSampledCounters == 1U)) {
+			RecPtr->Count[Index] =
+				XAxiPmon_GetSampledMetricCounter(InstancePtr,
+								 Index);
+		} else if (Index < HdrPtr->NumCounters) {
+			RecPtr->Count[Index] =
+				XAxiPmon_GetMetricCounter(InstancePtr, Index);
+		} else {
+			RecPtr->Count[Index] = 0U;
+		}
+	}
+
+	/* A second lapse already happened, the interval was not recorded */
+	IntrStatus = XAxiPmon_IntrGetStatus(InstancePtr);
+	if ((IntrStatus & XAPM_IXR_SIC_OVERFLOW_MASK) != 0U) {
+		HdrPtr->Lost++;
+	}
+
+	RecPtr->Seq = Head;
+	Xil_DCacheFlushRange((UINTPTR)RecPtr, sizeof(XAxiPmon_ProfRecord));
+
+	HdrPtr->Head = Head + 1U;
+	Xil_DCacheFlushRange((UINTPTR)HdrPtr, sizeof(XAxiPmon_ProfHeader));
+}
+/** @} */
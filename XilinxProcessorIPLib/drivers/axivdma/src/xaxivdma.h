@@ -153,6 +153,17 @@
 * Video IPs to connect to the VDMA. One of the Video IP does the write and the
 * other does the read.
 *
+* <b>Frame Buffer Ownership</b>
+*
+* In direct register mode, the buffers written by the write channel can be
+* handed to software without copying them, see xaxivdma_frmring.c:
+*  1. XAxiVdma_FrmRingInit() with the frame store addresses and a pool of
+*     spare buffers.
+*  2. XAxiVdma_FrmRingUpdate() from the write channel completion callback,
+*     with a write frame count of 1.
+*  3. XAxiVdma_FrmRingAcquire() to own the frame written last, and
+*     XAxiVdma_FrmRingRelease() once done with it.
+*
 * <b>Cache Coherency</b>
 *
 * This driver does not handle any cache coherency for the data buffers.
@@ -279,6 +290,7 @@
 * 6.6   rsp  07/02/18 Add vertical flip states in config structures
 * 6.12  sa   08/12/22 Updated the examples to use latest MIG cannoical define
 * 		       i.e XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR.
+* 6.14  fl   10/14/26 Added frame buffer ownership API of the write channel.
 *
 * </pre>
 *
@@ -525,6 +537,25 @@ typedef struct {
 	int AddrWidth;		  /**< Address Width */
 } XAxiVdma;
 
+/**
+ * The XAxiVdma_FrmRing structure tracks the frame buffers of the write
+ * channel for the frame buffer ownership API.
+ */
+typedef struct {
+	XAxiVdma *InstancePtr;		/**< DMA engine the ring belongs to */
+	int NumFrames;			/**< Number of frame stores */
+	UINTPTR StoreAddr[XAXIVDMA_MAX_FRAMESTORE];
+	/**< Buffer currently in each frame store */
+	UINTPTR SpareAddr[XAXIVDMA_MAX_FRAMESTORE];
+	/**< Spare buffers, not in a frame store nor owned by the application */
+	int NumSpare;			/**< Number of spare buffers */
+	int MaxSpare;			/**< Size of the spare buffer pool */
+	u32 CurStore;			/**< Frame store being written */
+	u32 DoneStore;			/**< Frame store written last */
+	u32 DoneCnt;			/**< Number of frames written */
+	u32 AcquireCnt;			/**< DoneCnt at the last acquire */
+} XAxiVdma_FrmRing;
+
 
 /************************** Function Prototypes ******************************/
 /* Initialization */
@@ -601,6 +632,17 @@ int XAxiVdma_SetCallBack(XAxiVdma *InstancePtr, u32 HandlerType,
 			 void *CallBackFunc, void *CallBackRef, u16 Direction);
 int XAxiVdma_Selftest(XAxiVdma *InstancePtr);
 
+/*
+ * Frame buffer ownership functions in xaxivdma_frmring.c
+ */
+int XAxiVdma_FrmRingInit(XAxiVdma_FrmRing *RingPtr, XAxiVdma *InstancePtr,
+			 UINTPTR *StoreAddrSet, UINTPTR *SpareAddrSet,
+			 int NumSpare);
+void XAxiVdma_FrmRingUpdate(XAxiVdma_FrmRing *RingPtr);
+int XAxiVdma_FrmRingAcquire(XAxiVdma_FrmRing *RingPtr,
+			    UINTPTR *BufferAddrPtr);
+int XAxiVdma_FrmRingRelease(XAxiVdma_FrmRing *RingPtr, UINTPTR BufferAddr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,267 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xaxivdma_frmring.c
+* @addtogroup axivdma Overview
+* @{
+*
+* Implementation of the frame buffer ownership API of the write channel.
+*
+* The write channel owns one buffer per frame store. In addition, the
+* application gives the driver a pool of spare buffers of the same size.
+* When a frame is acquired, the buffer of the frame store that was written
+* last is handed to the application, and a spare buffer takes its place in
+* the frame store. The application processes the frame in place and gives
+* the buffer back with XAxiVdma_FrmRingRelease(), which puts it in the
+* spare pool again. The hardware never writes into a buffer held by the
+* application.
+*
+* The frame store written last is not derived from the current frame store
+* alone, because a genlock slave skips the frame store used by its master.
+* Instead, XAxiVdma_FrmRingUpdate() is called on every frame count
+* interrupt of the write channel, and it records the frame store the
+* hardware has just left.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 6.14  fl   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxivdma.h"
+#include "xaxivdma_i.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Fewer frame stores give the hardware no time to latch a new address
+ * before it comes back to the frame store that was handed out
+ */
+#define XAXIVDMA_FRMRING_MIN_FRAMES	3
+
+/*****************************************************************************/
+/**
+ * Initialize the frame buffer ownership ring of the write channel
+ *
+ * The write channel must have been configured with XAxiVdma_DmaConfig() and
+ * XAxiVdma_DmaSetBufferAddr(), in circular buffer mode. It may already be
+ * running.
+ *
+ * @param RingPtr is the pointer to the ring to initialize
+ * @param InstancePtr is the pointer to the DMA engine to work on
+ * @param StoreAddrSet is the set of addresses given to
+ *        XAxiVdma_DmaSetBufferAddr(), one per frame store
+ * @param SpareAddrSet is the set of spare buffer addresses. The buffers
+ *        must have the size and the alignment of the frame store buffers.
+ * @param NumSpare is the number of spare buffers, which is also the number
+ *        of frames the application can hold at the same time
+ *
+ * @return
+ * - XST_SUCCESS if successful
+ * - XST_INVALID_PARAM if NumSpare is out of range or the channel has fewer
+ *   than 3 frame stores
+ * - XST_DEVICE_NOT_FOUND if the write channel is invalid
+ * - XST_NO_FEATURE if the hardware has the SG engine
+ *
+ *****************************************************************************/
+int XAxiVdma_FrmRingInit(XAxiVdma_FrmRing *RingPtr, XAxiVdma *InstancePtr,
+			 UINTPTR *StoreAddrSet, UINTPTR *SpareAddrSet,
+			 int NumSpare)
+{
+	XAxiVdma_Channel *Channel;
+	int Index;
+
+	Channel = XAxiVdma_GetChannel(InstancePtr, XAXIVDMA_WRITE);
+
+	if (!Channel->IsValid) {
+		return XST_DEVICE_NOT_FOUND;
+	}
+
+	/* Only the start address registers can be updated on the fly
+	 */
+	if (Channel->HasSG) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+			    "Frame ring needs direct register mode\r\n");
+
+		return XST_NO_FEATURE;
+	}
+
+	if ((Channel->NumFrames < XAXIVDMA_FRMRING_MIN_FRAMES) ||
+	    (NumSpare <= 0) || (NumSpare > XAXIVDMA_MAX_FRAMESTORE)) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+			    "Invalid frame ring: %d frames, %d spares\r\n",
+			    Channel->NumFrames, NumSpare);
+
+		return XST_INVALID_PARAM;
+	}
+
+	RingPtr->InstancePtr = InstancePtr;
+	RingPtr->NumFrames = Channel->NumFrames;
+
+	for (Index = 0; Index < RingPtr->NumFrames; Index++) {
+		RingPtr->StoreAddr[Index] = StoreAddrSet[Index];
+	}
+
+	for (Index = 0; Index < NumSpare; Index++) {
+		RingPtr->SpareAddr[Index] = SpareAddrSet[Index];
+	}
+
+	RingPtr->MaxSpare = NumSpare;
+	RingPtr->NumSpare = NumSpare;
+	RingPtr->CurStore = XAxiVdma_CurrFrameStore(InstancePtr,
+			    XAXIVDMA_WRITE);
+	RingPtr->DoneStore = RingPtr->CurStore;
+	RingPtr->DoneCnt = 0;
+	RingPtr->AcquireCnt = 0;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Record the progress of the write channel
+ *
+ * This function should be called from the completion callback of the write
+ * channel, with the frame count interrupt threshold of the write channel set
+ * to 1 through XAxiVdma_SetFrameCounter().
+ *
+ * @param RingPtr is the pointer to the ring to work on
+ *
+ * @return
+ *   None
+ *
+ * @note
+ * A parked write channel never leaves its frame store, so no frame becomes
+ * available while parking is on.
+ *****************************************************************************/
+void XAxiVdma_FrmRingUpdate(XAxiVdma_FrmRing *RingPtr)
+{
+	u32 Store;
+
+	Store = XAxiVdma_CurrFrameStore(RingPtr->InstancePtr, XAXIVDMA_WRITE);
+
+	if (Store != RingPtr->CurStore) {
+		RingPtr->DoneStore = RingPtr->CurStore;
+		RingPtr->CurStore = Store;
+		RingPtr->DoneCnt++;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * Take ownership of the frame written last by the write channel
+ *
+ * The buffer of the frame store is replaced by a spare buffer. The new
+ * address takes effect from the next frame, which is before the hardware
+ * comes back to this frame store.
+ *
+ * @param RingPtr is the pointer to the ring to work on
+ * @param BufferAddrPtr is an output parameter, it returns the address of
+ *        the frame buffer now owned by the application
+ *
+ * @return
+ * - XST_SUCCESS if successful
+ * - XST_NO_DATA if no new frame was written since the last acquire
+ * - XST_DEVICE_BUSY if the application holds all spare buffers
+ * - XST_INVALID_PARAM if the channel rejects the spare buffer address
+ *
+ * @note
+ * This function must not be preempted by XAxiVdma_FrmRingUpdate(). Call it
+ * from the completion callback, or with the write channel interrupt masked.
+ *****************************************************************************/
+int XAxiVdma_FrmRingAcquire(XAxiVdma_FrmRing *RingPtr,
+			    UINTPTR *BufferAddrPtr)
+{
+	XAxiVdma_Channel *Channel;
+	UINTPTR BufferAddr;
+	u32 Store;
+	int Status;
+
+	if (RingPtr->AcquireCnt == RingPtr->DoneCnt) {
+		return XST_NO_DATA;
+	}
+
+	if (RingPtr->NumSpare == 0) {
+		return XST_DEVICE_BUSY;
+	}
+
+	Store = RingPtr->DoneStore;
+
+	/* Updates were missed and the hardware is back on this frame store,
+	 * the frame is being overwritten
+	 */
+	if (XAxiVdma_CurrFrameStore(RingPtr->InstancePtr,
+				    XAXIVDMA_WRITE) == Store) {
+		RingPtr->AcquireCnt = RingPtr->DoneCnt;
+
+		return XST_NO_DATA;
+	}
+
+	Channel = XAxiVdma_GetChannel(RingPtr->InstancePtr, XAXIVDMA_WRITE);
+
+	BufferAddr = RingPtr->StoreAddr[Store];
+	RingPtr->StoreAddr[Store] = RingPtr->SpareAddr[RingPtr->NumSpare - 1];
+
+	Status = XAxiVdma_ChannelSetBufferAddr(Channel, RingPtr->StoreAddr,
+					       RingPtr->NumFrames);
+	if (Status != XST_SUCCESS) {
+		RingPtr->StoreAddr[Store] = BufferAddr;
+
+		return Status;
+	}
+
+	/* Start addresses are latched on the vsize write
+	 */
+	XAxiVdma_WriteReg(Channel->StartAddrBase, XAXIVDMA_VSIZE_OFFSET,
+			  Channel->Vsize);
+
+	RingPtr->NumSpare--;
+	RingPtr->AcquireCnt = RingPtr->DoneCnt;
+	*BufferAddrPtr = BufferAddr;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Give back a frame buffer obtained with XAxiVdma_FrmRingAcquire()
+ *
+ * The buffer goes to the spare pool, and is put in a frame store again by a
+ * later acquire.
+ *
+ * @param RingPtr is the pointer to the ring to work on
+ * @param BufferAddr is the address of the frame buffer
+ *
+ * @return
+ * - XST_SUCCESS if successful
+ * - XST_FAILURE if the application holds no frame buffer
+ *
+ * @note
+ * This function must not be preempted by XAxiVdma_FrmRingAcquire().
+ *****************************************************************************/
+int XAxiVdma_FrmRingRelease(XAxiVdma_FrmRing *RingPtr, UINTPTR BufferAddr)
+{
+	if (RingPtr->NumSpare == RingPtr->MaxSpare) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+			    "Release of unowned buffer %x\r\n",
+			    (unsigned int)BufferAddr);
+
+		return XST_FAILURE;
+	}
+
+	RingPtr->SpareAddr[RingPtr->NumSpare] = BufferAddr;
+	RingPtr->NumSpare++;
+
+	return XST_SUCCESS;
+}
+/** @} */
@@ -63,6 +63,7 @@
 * 2.3	se   03/09/20 Initialize IsPl of config structure.
 * 2.8	ht   06/19/23 Added support for system device-tree flow.
 * 2.8	gm   06/22/23 Add support for request/release node.
+* 2.9	fl   10/14/26 Added XCanFd_Recv_Bulk to drain an RX FIFO in one pass.
 *
 * </pre>
 ******************************************************************************/
@@ -99,6 +100,8 @@ static void StubHandler(void);
 static int XCanfd_TrrVal_Get_SetBit_Position(u32 u);
 static u32 XCanFd_SeqRecv_logic(XCanFd *InstancePtr, u32 ReadIndex,
 				u32 FsrVal, u32 *FramePtr, u8 fifo_no);
+static void XCanFd_SeqRead_Frame(XCanFd *InstancePtr, u32 ReadIndex,
+				 u32 *FramePtr, u8 fifo_no);
 
 /************************** Global Variables ******************************/
 
@@ -775,6 +778,76 @@ u32 XCanFd_Recv_Sequential(XCanFd *InstancePtr, u32 *FramePtr)
 
 }
 
+/*****************************************************************************/
+/**
+*
+* This function drains one RX FIFO in sequential mode. Frames are copied into
+* consecutive XCANFD_MAX_FRAME_SIZE byte slots of the user buffer until the
+* FIFO is empty or MaxFrames frames were read, frames that arrive meanwhile
+* are read in the same pass.
+*
+* Compared to calling XCanFd_Recv_Sequential() per frame, the fill level and
+* read index come from a single FSR read per frame and the read index is
+* advanced with a plain write of the IRI bit, without a read-modify-write.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	FifoNo is XCANFD_RX_FIFO_0 or XCANFD_RX_FIFO_1.
+* @param	FramePtr is a pointer to a 32-bit aligned buffer of MaxFrames
+*		frames, frame N starts at word N * (XCANFD_MAX_FRAME_SIZE / 4).
+* @param	MaxFrames is the number of frames the buffer holds.
+*
+* @return	Number of frames read, 0 if the FIFO was empty.
+*
+* @note		Call from the receive callback. With the watermark interrupt
+*		(see XCanFd_SetRxBatch()) one interrupt then moves a whole batch
+*		of frames. This API is meant to be used with IP with CanFD 2.0
+*		spec support only.
+*
+******************************************************************************/
+u32 XCanFd_Recv_Bulk(XCanFd *InstancePtr, u8 FifoNo, u32 *FramePtr,
+		     u32 MaxFrames)
+{
+	u32 FsrVal;
+	u32 ReadIndex;
+	u32 NumFrames = 0;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(FramePtr != NULL);
+	Xil_AssertNonvoid((FifoNo == (u8)XCANFD_RX_FIFO_0) ||
+			  (FifoNo == (u8)XCANFD_RX_FIFO_1));
+
+	while (NumFrames < MaxFrames) {
+		FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+					XCANFD_FSR_OFFSET);
+		if (FifoNo == (u8)XCANFD_RX_FIFO_0) {
+			if ((FsrVal & XCANFD_FSR_FL_MASK) == (u32)0) {
+				break;
+			}
+			ReadIndex = FsrVal & XCANFD_FSR_RI_MASK;
+		} else {
+			if ((FsrVal & XCANFD_FSR_FL_1_MASK) == (u32)0) {
+				break;
+			}
+			ReadIndex = ((FsrVal & XCANFD_FSR_RI_1_MASK)
+				     >> XCANFD_FSR_RI_1_SHIFT);
+		}
+
+		XCanFd_SeqRead_Frame(InstancePtr, ReadIndex,
+				     &FramePtr[NumFrames * (XCANFD_MAX_FRAME_SIZE /
+					       (u32)4)], FifoNo);
+
+		/* FL and RI are read only, IRI alone increments RI */
+		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_FSR_OFFSET,
+				(FifoNo == (u8)XCANFD_RX_FIFO_0) ?
+				XCANFD_FSR_IRI_MASK : XCANFD_FSR_IRI_1_MASK);
+		NumFrames++;
+	}
+
+	return NumFrames;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1866,6 +1939,45 @@ static int XCanfd_TrrVal_Get_SetBit_Position(u32 u)
 *
 ******************************************************************************/
 static u32 XCanFd_SeqRecv_logic(XCanFd *InstancePtr, u32 ReadIndex, u32 FsrVal, u32 *FramePtr, u8 fifo_no)
+{
+	XCanFd_SeqRead_Frame(InstancePtr, ReadIndex, FramePtr, fifo_no);
+
+	/* Set the IRI bit causes core to increment RI in FSR Register */
+	if (fifo_no == (u8)XCANFD_RX_FIFO_0) {
+		FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+					XCANFD_FSR_OFFSET);
+		FsrVal |= XCANFD_FSR_IRI_MASK;
+		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_FSR_OFFSET, FsrVal);
+	} else {
+		FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+					XCANFD_FSR_OFFSET);
+		FsrVal |= XCANFD_FSR_IRI_1_MASK;
+		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_FSR_OFFSET, FsrVal);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function copies the CAN/CAN FD Frame at the given Read Index of an RX
+* FIFO, the Read Index is not advanced.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	ReadIndex is Current RI(Read Index) maintained by Can Core.
+* @param	FramePtr is a pointer to a 32-bit aligned buffer where the
+*		CAN/CAN FD frame is to be written.
+* @param	fifo_no is target fifo number
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XCanFd_SeqRead_Frame(XCanFd *InstancePtr, u32 ReadIndex,
+				 u32 *FramePtr, u8 fifo_no)
 {
 	u32 DwIndex = 0;
 	u32 CanEDL;
@@ -1933,23 +2045,6 @@ static u32 XCanFd_SeqRecv_logic(XCanFd *InstancePtr, u32 ReadIndex, u32 FsrVal,
 			DwIndex++;
 		}
 	}
-
-	/* Set the IRI bit causes core to increment RI in FSR Register */
-	if (fifo_no == (u8)XCANFD_RX_FIFO_0) {
-		FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
-					XCANFD_FSR_OFFSET);
-		FsrVal |= XCANFD_FSR_IRI_MASK;
-		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
-				XCANFD_FSR_OFFSET, FsrVal);
-	} else {
-		FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
-					XCANFD_FSR_OFFSET);
-		FsrVal |= XCANFD_FSR_IRI_1_MASK;
-		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
-				XCANFD_FSR_OFFSET, FsrVal);
-	}
-
-	return XST_SUCCESS;
 }
 /*****************************************************************************/
 /**
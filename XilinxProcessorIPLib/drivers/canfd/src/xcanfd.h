@@ -260,6 +260,8 @@ exclusion
 * 2.8	ht   06/19/23 Added support for system device-tree flow.
 * 2.8	gm   06/22/23 Add XCanFd_stop to support release node.
 * 2.8	ht   07/18/23 Fixed GCC warnings.
+* 2.9	fl   10/14/26 Added XCanFd_Recv_Bulk, XCanFd_FilterApply and
+*		      XCanFd_SetRxBatch.
 * </pre>
 *
 ******************************************************************************/
@@ -320,6 +322,9 @@ extern "C" {
 #define XCANFD_RX_FIFO_1	         1 /**< Selection for RX Fifo 1 */
 /** @} */
 
+#define XCANFD_FILTER_MAX_ENTRIES	64U /**< Entries accepted by
+					      *  XCanFd_FilterApply() */
+
 /** @name Callback identifiers used as parameters to XCanFd_SetHandler()
  *  @{
  */
@@ -430,6 +435,18 @@ typedef struct {
 
 } XCanFd;
 
+/*****************************************************************************/
+/**
+ * Receive filter entry, see XCanFd_FilterApply(). A frame is accepted when
+ * its ID register value AND Mask equals Id AND Mask.
+ */
+typedef struct {
+	u32 Id;		/**< ID register value, see XCanFd_CreateIdValue() */
+	u32 Mask;	/**< ID bits to compare */
+	u8 RxFifo;	/**< RX FIFO of the matching frames, sequential mode
+			  *  only */
+} XCanFd_FilterEntry;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -1069,6 +1086,8 @@ u32 XCanFd_RxBuff_MailBox_DeActive(XCanFd *InstancePtr, u32 RxBuffer);
 u32 XCanFd_Set_MailBox_IdMask(XCanFd *InstancePtr, u32 RxBuffer,
 			      u32 MaskValue, u32 IdValue);
 u32 XCanFd_Recv_Sequential(XCanFd *InstancePtr, u32 *FramePtr);
+u32 XCanFd_Recv_Bulk(XCanFd *InstancePtr, u8 FifoNo, u32 *FramePtr,
+		     u32 MaxFrames);
 u32 XCanFd_Recv_Mailbox(XCanFd *InstancePtr, u32 *FramePtr);
 u32 XCanFd_Recv_TXEvents_Sequential(XCanFd *InstancePtr, u32 *FramePtr);
 void XCanFd_PollQueue_Buffer(XCanFd *InstancePtr);
@@ -1100,6 +1119,11 @@ u32 XCanFd_SetRxIntrWatermarkFifo1(XCanFd *InstancePtr, s8 Threshold);
 u32 XCanFd_SetTxEventIntrWatermark(XCanFd *InstancePtr, u8 Threshold);
 u32 XCanFd_SetRxFilterPartition(XCanFd *InstancePtr, u8 FilterPartition);
 
+/* Receive filter functions in xcanfd_filter.c */
+u32 XCanFd_FilterApply(XCanFd *InstancePtr, const XCanFd_FilterEntry *Entries,
+		       u32 NumEntries, u32 *NumSlotsPtr);
+u32 XCanFd_SetRxBatch(XCanFd *InstancePtr, u8 FifoNo, s8 Threshold);
+
 /* Diagnostic functions in xcan_selftest.c */
 int XCanFd_SelfTest(XCanFd *InstancePtr);
 
@@ -0,0 +1,275 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xcanfd_filter.c
+* @addtogroup canfd Overview
+* @{
+*
+* This file contains the acceptance filter manager and the batched receive
+* set up. XCanFd_FilterApply() programs a list of ID/Mask pairs into the
+* acceptance filters (sequential mode) or the RX mailboxes (mailbox mode),
+* so the core drops unwanted IDs instead of the software.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 2.9   fl   10/14/26 First release
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xcanfd.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static u32 XCanFd_FilterReduce(XCanFd_FilterEntry *Entries, u32 NumEntries);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function merges the entries of a filter list which the hardware can
+* match with fewer slots, without accepting any other ID:
+*	- an entry accepted by another entry of the same RX FIFO is dropped.
+*	- two entries with the same Mask and FIFO whose IDs differ in a single
+*	  compared bit become one entry that ignores this bit.
+*
+* @param	Entries is the filter list, the IDs must be masked.
+* @param	NumEntries is the number of entries.
+*
+* @return	Number of entries left at the start of the list.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XCanFd_FilterReduce(XCanFd_FilterEntry *Entries, u32 NumEntries)
+{
+	u32 Index;
+	u32 Other;
+	u32 Diff;
+	u32 Changed = (u32)1;
+
+	while (Changed != (u32)0) {
+		Changed = 0;
+		for (Index = 0; Index < NumEntries; Index++) {
+			for (Other = 0; Other < NumEntries; Other++) {
+				if ((Other == Index) || (Entries[Other].RxFifo !=
+						Entries[Index].RxFifo)) {
+					continue;
+				}
+
+				Diff = Entries[Index].Id ^ Entries[Other].Id;
+				if (((Entries[Other].Mask & ~Entries[Index].Mask) ==
+						(u32)0) && ((Diff & Entries[Other].Mask)
+						== (u32)0)) {
+					/* Other accepts every ID of Index */
+				} else if ((Entries[Other].Mask ==
+						Entries[Index].Mask) &&
+						((Diff & (Diff - (u32)1)) == (u32)0)) {
+					Entries[Other].Mask &= ~Diff;
+					Entries[Other].Id &= ~Diff;
+				} else {
+					continue;
+				}
+
+				NumEntries--;
+				Entries[Index] = Entries[NumEntries];
+				Changed = (u32)1;
+				break;
+			}
+		}
+	}
+
+	return NumEntries;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function programs a list of ID/Mask pairs into the hardware receive
+* filters of the core. In sequential mode every entry takes one acceptance
+* filter, the entries of RX FIFO 0 come first; in mailbox mode every entry
+* takes one RX buffer, starting from buffer 0. Entries that the hardware can
+* match together are merged first, see XCanFd_FilterReduce().
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	Entries is the filter list. Use XCanFd_CreateIdValue() for the
+*		Id and Mask values.
+* @param	NumEntries is the number of entries, at most
+*		XCANFD_FILTER_MAX_ENTRIES.
+* @param	NumSlotsPtr is set to the number of filters or RX buffers the
+*		list takes after merging. It may be NULL.
+*
+* @return	- XST_SUCCESS if the list was programmed.
+*		- XST_FAILURE if the list needs more slots than the core has,
+*		the filters are left unchanged.
+*		- XST_FAILURE if the core is in sequential mode and the CAN
+*		device is not in Configuration Mode, which the filter
+*		partition needs.
+*
+* @note		Filters and RX buffers beyond the list are disabled. In
+*		sequential mode an empty list disables all the filters, so that
+*		every ID is received, in mailbox mode it deactivates all the RX
+*		buffers. In sequential mode the filter partition is always set
+*		to the number of RX FIFO 0 filters, so that a partition left
+*		by an earlier list does not move them to RX FIFO 1.
+*
+******************************************************************************/
+u32 XCanFd_FilterApply(XCanFd *InstancePtr, const XCanFd_FilterEntry *Entries,
+		       u32 NumEntries, u32 *NumSlotsPtr)
+{
+	XCanFd_FilterEntry List[XCANFD_FILTER_MAX_ENTRIES];
+	u32 NumSlots;
+	u32 Index;
+	u32 Slot;
+	u32 NumFifo0 = 0;
+	u32 MaxPartition = XCANFD_WMR_RXFP_MASK >> XCANFD_WMR_RXFP_SHIFT;
+	u32 Fifo;
+	u32 EnableMask = 0;
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid((Entries != NULL) || (NumEntries == (u32)0));
+	Xil_AssertNonvoid(NumEntries <= (u32)XCANFD_FILTER_MAX_ENTRIES);
+
+	for (Index = 0; Index < NumEntries; Index++) {
+		Xil_AssertNonvoid(Entries[Index].RxFifo <= (u8)XCANFD_RX_FIFO_1);
+		List[Index].Id = Entries[Index].Id & Entries[Index].Mask;
+		List[Index].Mask = Entries[Index].Mask;
+		List[Index].RxFifo = (XCANFD_GET_RX_MODE(InstancePtr) ==
+				      (u32)1) ? (u8)XCANFD_RX_FIFO_0 :
+				     Entries[Index].RxFifo;
+	}
+	NumEntries = XCanFd_FilterReduce(List, NumEntries);
+
+	if (NumSlotsPtr != NULL) {
+		*NumSlotsPtr = NumEntries;
+	}
+
+	if (XCANFD_GET_RX_MODE(InstancePtr) == (u32)1) {
+		NumSlots = InstancePtr->CanFdConfig.NumofRxMbBuf;
+	} else {
+		NumSlots = XCANFD_NOOF_AFR;
+	}
+	if (NumEntries > NumSlots) {
+		return (u32)XST_FAILURE;
+	}
+
+	if (XCANFD_GET_RX_MODE(InstancePtr) == (u32)1) {
+		for (Slot = 0; Slot < NumSlots; Slot++) {
+			if (Slot < NumEntries) {
+				(void)XCanFd_Set_MailBox_IdMask(InstancePtr, Slot,
+						List[Slot].Mask, List[Slot].Id);
+				(void)XCanFd_RxBuff_MailBox_Active(InstancePtr,
+								   Slot);
+			} else {
+				(void)XCanFd_RxBuff_MailBox_DeActive(InstancePtr,
+								     Slot);
+			}
+		}
+		return (u32)XST_SUCCESS;
+	}
+
+	for (Index = 0; Index < NumEntries; Index++) {
+		if (List[Index].RxFifo == (u8)XCANFD_RX_FIFO_0) {
+			NumFifo0++;
+		}
+	}
+	/* The field holds 31 at most, beyond only RX FIFO 0 filters exist */
+	if (NumFifo0 > MaxPartition) {
+		NumFifo0 = MaxPartition;
+	}
+	Status = XCanFd_SetRxFilterPartition(InstancePtr, (u8)NumFifo0);
+	if (Status != (u32)XST_SUCCESS) {
+		return Status;
+	}
+
+	XCanFd_AcceptFilterDisable(InstancePtr, XCANFD_AFR_UAF_ALL_MASK);
+
+	/* Filter indexes start at 1, RX FIFO 0 filters first */
+	Slot = 0;
+	for (Fifo = XCANFD_RX_FIFO_0; Fifo <= (u32)XCANFD_RX_FIFO_1; Fifo++) {
+		for (Index = 0; Index < NumEntries; Index++) {
+			if (List[Index].RxFifo != (u8)Fifo) {
+				continue;
+			}
+			(void)XCanFd_AcceptFilterSet(InstancePtr, Slot + (u32)1,
+						     List[Index].Mask,
+						     List[Index].Id);
+			EnableMask |= ((u32)1 << Slot);
+			Slot++;
+		}
+	}
+
+	XCanFd_AcceptFilterEnable(InstancePtr, EnableMask);
+
+	return (u32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets up batched reception on an RX FIFO. The watermark
+* interrupt of the FIFO is raised once Threshold frames are stored, and the
+* receive callback can then read all of them with XCanFd_Recv_Bulk().
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	FifoNo is XCANFD_RX_FIFO_0 or XCANFD_RX_FIFO_1.
+* @param	Threshold is the number of frames per batch, see
+*		XCanFd_SetRxIntrWatermark() and
+*		XCanFd_SetRxIntrWatermarkFifo1() for the valid values.
+*
+* @return	- XST_SUCCESS if the watermark was set and its interrupt
+*		enabled.
+*		- XST_FAILURE if the CAN device is not in Configuration Mode.
+*
+* @note		The RXOK interrupt still fires for every frame if it is
+*		enabled. Disable XCANFD_IXR_RXOK_MASK to take one interrupt per
+*		batch, and poll XCanFd_Recv_Bulk() at a low rate so that the
+*		last frames below the threshold are not held back. This API is
+*		meant to be used with IP with CanFD 2.0 spec support only.
+*
+******************************************************************************/
+u32 XCanFd_SetRxBatch(XCanFd *InstancePtr, u8 FifoNo, s8 Threshold)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid((FifoNo == (u8)XCANFD_RX_FIFO_0) ||
+			  (FifoNo == (u8)XCANFD_RX_FIFO_1));
+
+	if (FifoNo == (u8)XCANFD_RX_FIFO_0) {
+		Status = XCanFd_SetRxIntrWatermark(InstancePtr, Threshold);
+	} else {
+		Status = XCanFd_SetRxIntrWatermarkFifo1(InstancePtr, Threshold);
+	}
+
+	if (Status == (u32)XST_SUCCESS) {
+		XCanFd_InterruptEnable(InstancePtr,
+				       (FifoNo == (u8)XCANFD_RX_FIFO_0) ?
+				       XCANFD_IXR_RXFWMFLL_MASK :
+				       XCANFD_IXR_RXFWMFLL_1_MASK);
+	}
+
+	return Status;
+}
+/** @} */
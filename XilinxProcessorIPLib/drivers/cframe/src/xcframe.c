@@ -27,6 +27,8 @@
 *       mss  09/04/2023 Fixed MISRA-C violation 7.2
 *       mss  09/04/2023 Fixed MISRA-C violation 4.6
 *       mss  09/04/2023 Fixed MISRA-C violation 8.13
+* 1.6   fl   10/14/2026 Added XCframe_SetReadRange and XCframe_ReadFrames
+*                       APIs for multi-frame readback
 *
 * </pre>
 *
@@ -321,6 +323,95 @@ void XCframe_SetReadParam(const XCframe *InstancePtr,
 	XCframe_WriteReg(InstancePtr, XCFRAME_FRCNT_OFFSET, CframeNo, &Value128);
 }
 
+/*****************************************************************************/
+/**
+ * This function sets up one read of FrameCnt consecutive frames of a CFRAME
+ * row starting at FrameAddr. The frame data is then read from the CFU FDRO
+ * keyhole, FrameCnt * XCFRAME_FRAME_WORDS words in total, either with
+ * XCframe_ReadFrames or with a DMA transfer from the keyhole.
+ *
+ * @param	InstancePtr is a pointer to the XCframe instance.
+ * @param	CframeNo is the index of the CFRAME row
+ * @param	FrameAddr is the address of the first frame
+ * @param	FrameCnt is the number of frames to read
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XCframe_SetReadRange(const XCframe *InstancePtr,
+		XCframe_FrameNo CframeNo, u32 FrameAddr, u32 FrameCnt)
+{
+	Xuint128 Value128={0};
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	/* Enable ROWON, READ_CFR, frame address and quad word count */
+	XCframe_WriteCmd(InstancePtr, CframeNo,	XCFRAME_CMD_REG_ROWON);
+	XCframe_WriteCmd(InstancePtr, CframeNo,	XCFRAME_CMD_REG_RCFG);
+	Value128.Word0 = FrameAddr;
+	XCframe_WriteReg(InstancePtr, XCFRAME_FAR_OFFSET, CframeNo, &Value128);
+
+	Value128.Word0 = FrameCnt * XCFRAME_FRAME_QWORDS;
+	XCframe_WriteReg(InstancePtr, XCFRAME_FRCNT_OFFSET, CframeNo, &Value128);
+}
+
+/*****************************************************************************/
+/**
+ * This function reads the frames requested with XCframe_SetReadRange from the
+ * FDRO keyhole, one 128 bit quad word at a time. The frames are compared with
+ * the golden data while they are read, so a readback verification needs no
+ * second pass over the data.
+ *
+ * @param	FdroAddr is the address of the CFU FDRO keyhole
+ * @param	Buf is the buffer for the frame data, can be NULL if only the
+ *		comparison is needed
+ * @param	FrameCnt is the number of frames to read
+ * @param	Golden is the expected frame data, NULL to skip the comparison
+ * @param	MismatchCnt is the number of words different from the golden
+ *		data, can be NULL
+ *
+ * @return
+ *		- XST_SUCCESS if the frames match the golden data or no golden
+ *		data is given
+ *		- XST_FAILURE if a frame differs from the golden data
+ *
+ ******************************************************************************/
+s32 XCframe_ReadFrames(UINTPTR FdroAddr, u32 *Buf, u32 FrameCnt,
+		const u32 *Golden, u32 *MismatchCnt)
+{
+	s32 Status = XST_FAILURE;
+	u32 Words = FrameCnt * XCFRAME_FRAME_WORDS;
+	u32 Mismatch = 0U;
+	u32 Val[4U];
+	u32 Index;
+	u32 Word;
+
+	for (Index = 0U; Index < Words; Index += 4U) {
+		/* FDRO is 128 bits wide, every quad word is read in full */
+		Val[0U] = XCframe_ReadReg32(FdroAddr, 0x0U);
+		Val[1U] = XCframe_ReadReg32(FdroAddr, 0x4U);
+		Val[2U] = XCframe_ReadReg32(FdroAddr, 0x8U);
+		Val[3U] = XCframe_ReadReg32(FdroAddr, 0xCU);
+		for (Word = 0U; Word < 4U; Word++) {
+			if (Buf != NULL) {
+				Buf[Index + Word] = Val[Word];
+			}
+			if ((Golden != NULL) &&
+				(Golden[Index + Word] != Val[Word])) {
+				Mismatch++;
+			}
+		}
+	}
+
+	if (MismatchCnt != NULL) {
+		*MismatchCnt = Mismatch;
+	}
+	if (Mismatch == 0U) {
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * This function clears CFRAME ISRs and is called as part of CFRAME error recovery
@@ -24,6 +24,8 @@
 * 1.04  ng   06/30/23   Added support for system device tree flow
 * 1.5   mss  09/04/2023 Fixed MISRA-C violation 4.6
 *       mss  09/04/2023 Fixed MISRA-C violation 8.13
+* 1.6   fl   10/14/2026 Added XCframe_SetReadRange and XCframe_ReadFrames
+*                       APIs for multi-frame readback
 *
 * </pre>
 *
@@ -67,6 +69,10 @@ extern "C" {
 
 #define XCFRAME_FRAME_OFFSET				(0x2000U)
 
+/* Length of a configuration frame */
+#define XCFRAME_FRAME_QWORDS			(25U)
+#define XCFRAME_FRAME_WORDS			(XCFRAME_FRAME_QWORDS * 4U)
+
 typedef enum
 {
 	XCFRAME_FRAME_0 = 0,
@@ -169,6 +175,10 @@ void XCframe_SetReadParam(const XCframe *InstancePtr,
 			XCframe_FrameNo CframeNo, u32 CframeLen);
 void XCframe_ReadReg(const XCframe *InstancePtr, u32 AddrOffset,
 			XCframe_FrameNo FrameNo, u32* ValPtr);
+void XCframe_SetReadRange(const XCframe *InstancePtr,
+			XCframe_FrameNo CframeNo, u32 FrameAddr, u32 FrameCnt);
+s32 XCframe_ReadFrames(UINTPTR FdroAddr, u32 *Buf, u32 FrameCnt,
+			const u32 *Golden, u32 *MismatchCnt);
 void XCframe_ClearCframeErr(const XCframe *InstancePtr);
 s32 XCframe_SafetyWriteReg(const XCframe *InstancePtr, u32 AddrOffset,
 		XCframe_FrameNo FrameNo,const Xuint128 *Val);
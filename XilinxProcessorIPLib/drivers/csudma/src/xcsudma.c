@@ -44,6 +44,9 @@
 * 1.14	ab	01/16/23 Added Xil_WaitForEvent() to XcsuDma_WaitForDoneTimeout.
 * 1.14	ab	01/18/23 Added byte-aligned transfer API for VERSAL_NET devices.
 * 1.14	bm	05/01/23 Fixed Assert condition in XCsuDma_Transfer for VERSAL_NET.
+* 1.14	fl	10/14/26 Added scatter gather list transfer APIs that keep both
+*			 channels busy and overlap cache maintenance of the
+*			 next chunk with the current one.
 * </pre>
 *
 ******************************************************************************/
@@ -56,8 +59,18 @@
 /************************** Constant Definitions *****************************/
 #define XCSUDMA_WORD_SIZE	(4U)	/**< Transfer size conversion to
 					 * bytes for Versal Net */
+#ifdef VERSAL_NET
+#define XCSUDMA_SG_DATA_SIZE(Size)	((Size) * XCSUDMA_WORD_SIZE)
+#else
+#define XCSUDMA_SG_DATA_SIZE(Size)	(Size)
+#endif
 /************************** Function Prototypes ******************************/
 
+static void XCsuDma_CacheOp(XCsuDma_Channel Channel, u64 Addr, u32 DataSize);
+static void XCsuDma_WriteCmd(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+			     u64 Addr, u32 DataSize, u8 EnDataLast);
+static void XCsuDma_SgNext(XCsuDma_SgXfer *SgPtr, XCsuDma_Channel Channel,
+			   u8 IsFirst);
 
 /************************** Function Definitions *****************************/
 
@@ -162,56 +175,8 @@ void XCsuDma_Transfer(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
 	DataSize = Size;
 #endif
 
-	/* Cache flush/invalidate */
-#if defined(ARMR52)
-	if (((Addr >> XCSUDMA_MSB_ADDR_SHIFT) == 0U) && (Channel == (XCSUDMA_DST_CHANNEL))) {
-		Xil_DCacheInvalidateRange((INTPTR)Addr, DataSize << XCSUDMA_SIZE_SHIFT);
-	}
-#elif defined(ARMR5)
-	/* No action if 64 bit address is used when this code is running on R5.
-	 * Flush if 32 bit addressing is used.
-	 */
-	if ((Addr >> XCSUDMA_MSB_ADDR_SHIFT) == 0U) {
-		Xil_DCacheFlushRange((INTPTR)Addr, DataSize << XCSUDMA_SIZE_SHIFT);
-	}
-#endif
-	/* No action required for PSU_PMU.
-	 * Perform cache operations on ARM64 (either 32 bit and 64 bit address)
-	 */
-#if defined(__aarch64__)
-	if (Channel == (XCSUDMA_SRC_CHANNEL)) {
-		Xil_DCacheFlushRange((INTPTR)Addr,
-				     (INTPTR)(DataSize << XCSUDMA_SIZE_SHIFT));
-	} else {
-		Xil_DCacheInvalidateRange((INTPTR)Addr,
-					  (INTPTR)(DataSize << XCSUDMA_SIZE_SHIFT));
-	}
-#endif
-	/* Set the starting address of the data to be tansferred from/to memory */
-	XCsuDma_WriteReg(InstancePtr->Config.BaseAddress,
-			 ((u32)(XCSUDMA_ADDR_OFFSET) +
-			  ((u32)Channel * (u32)(XCSUDMA_OFFSET_DIFF))),
-			 ((u32)(Addr) & (u32)(XCSUDMA_ADDR_MASK)));
-
-	XCsuDma_WriteReg(InstancePtr->Config.BaseAddress,
-			 (u32)(XCSUDMA_ADDR_MSB_OFFSET +
-			       ((u32)Channel * XCSUDMA_OFFSET_DIFF)),
-			 ((u32)((Addr & ULONG64_HI_MASK) >> XCSUDMA_MSB_ADDR_SHIFT) &
-			  (u32)(XCSUDMA_MSB_ADDR_MASK)));
-
-	/* Check and inform DMA if this is the last word(end of data) */
-	if (EnDataLast == (u8)1U) {
-		XCsuDma_WriteReg(InstancePtr->Config.BaseAddress,
-				 ((u32)(XCSUDMA_SIZE_OFFSET) +
-				  ((u32)Channel * (u32)(XCSUDMA_OFFSET_DIFF))),
-				 ((DataSize << (u32)(XCSUDMA_SIZE_SHIFT)) |
-				  (u32)(XCSUDMA_LAST_WORD_MASK)));
-	} else {
-		XCsuDma_WriteReg(InstancePtr->Config.BaseAddress,
-				 ((u32)(XCSUDMA_SIZE_OFFSET) +
-				  ((u32)Channel * (u32)(XCSUDMA_OFFSET_DIFF))),
-				 (DataSize << (u32)(XCSUDMA_SIZE_SHIFT)));
-	}
+	XCsuDma_CacheOp(Channel, Addr, DataSize);
+	XCsuDma_WriteCmd(InstancePtr, Channel, Addr, DataSize, EnDataLast);
 }
 
 /*****************************************************************************/
@@ -1013,4 +978,326 @@ void XCsuDma_ByteAlignedTransfer(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
 	}
 }
 #endif
+
+/*****************************************************************************/
+/**
+*
+* This function prepares a scatter gather transfer. The source list is read
+* by the source channel and the destination list is written by the
+* destination channel; either list may be empty when only one channel is
+* used, e.g. for SHA feeding through the source channel only.
+*
+* @param	SgPtr is a pointer to the scatter gather context to be
+*		initialized. It must stay valid until the transfer is done.
+* @param	InstancePtr is a pointer to XCsuDma instance to be worked on.
+* @param	SrcList is the list of source chunks, or NULL.
+* @param	SrcNum is the number of entries of SrcList.
+* @param	DstList is the list of destination chunks, or NULL.
+* @param	DstNum is the number of entries of DstList.
+* @param	EnDataLast asserts data_inp_last with the last source chunk
+*		when set to 1.
+*
+* @return	None.
+*
+* @note		Chunk sizes are numbers of 4 byte words as for
+*		XCsuDma_Transfer(). The lists are not copied.
+*
+******************************************************************************/
+void XCsuDma_SgInit(XCsuDma_SgXfer *SgPtr, XCsuDma *InstancePtr,
+		    const XCsuDma_SgEntry *SrcList, u32 SrcNum,
+		    const XCsuDma_SgEntry *DstList, u32 DstNum, u8 EnDataLast)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(SgPtr != NULL);
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)(XIL_COMPONENT_IS_READY));
+	Xil_AssertVoid((SrcList != NULL) || (SrcNum == 0U));
+	Xil_AssertVoid((DstList != NULL) || (DstNum == 0U));
+
+	SgPtr->InstancePtr = InstancePtr;
+	SgPtr->List[XCSUDMA_SRC_CHANNEL] = SrcList;
+	SgPtr->Num[XCSUDMA_SRC_CHANNEL] = SrcNum;
+	SgPtr->List[XCSUDMA_DST_CHANNEL] = DstList;
+	SgPtr->Num[XCSUDMA_DST_CHANNEL] = DstNum;
+	SgPtr->Next[XCSUDMA_SRC_CHANNEL] = 0U;
+	SgPtr->Next[XCSUDMA_DST_CHANNEL] = 0U;
+	SgPtr->Busy[XCSUDMA_SRC_CHANNEL] = FALSE;
+	SgPtr->Busy[XCSUDMA_DST_CHANNEL] = FALSE;
+	SgPtr->Started = 0U;
+	SgPtr->EnDataLast = EnDataLast;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts a scatter gather transfer prepared with
+* XCsuDma_SgInit(). The first chunk of each list is handed to its channel
+* and the cache maintenance of the second chunk is done while the first one
+* is in progress.
+*
+* @param	SgPtr is a pointer to the scatter gather context.
+*
+* @return	None.
+*
+* @note		Both channels must be idle. The transfer is completed with
+*		XCsuDma_SgPoll() or XCsuDma_SgWaitForDone().
+*
+******************************************************************************/
+void XCsuDma_SgStart(XCsuDma_SgXfer *SgPtr)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(SgPtr != NULL);
+
+	/* DST first, so it is ready to drain what SRC pushes into the SSS */
+	if (SgPtr->Num[XCSUDMA_DST_CHANNEL] != 0U) {
+		XCsuDma_SgNext(SgPtr, XCSUDMA_DST_CHANNEL, TRUE);
+	}
+	if (SgPtr->Num[XCSUDMA_SRC_CHANNEL] != 0U) {
+		XCsuDma_SgNext(SgPtr, XCSUDMA_SRC_CHANNEL, TRUE);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function advances a scatter gather transfer without blocking. Each
+* channel whose current chunk is done is given its next chunk right away,
+* then the cache maintenance of the chunk after it is done while the
+* hardware is busy.
+*
+* @param	SgPtr is a pointer to the scatter gather context.
+*
+* @return
+*		- XST_SUCCESS if all chunks of both lists are done.
+*		- XST_DEVICE_BUSY if chunks are still in progress.
+*
+* @note		The done interrupt status of the channels is consumed by this
+*		function.
+*
+******************************************************************************/
+s32 XCsuDma_SgPoll(XCsuDma_SgXfer *SgPtr)
+{
+	s32 Status = XST_SUCCESS;
+	XCsuDma_Channel Channel;
+	u32 IntrStatus;
+	u32 Index;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(SgPtr != NULL);
+
+	for (Index = 0U; Index < XCSUDMA_SG_NUM_CHANNELS; Index++) {
+		Channel = (XCsuDma_Channel)Index;
+		if (SgPtr->Busy[Channel] == FALSE) {
+			continue;
+		}
+
+		IntrStatus = XCsuDma_ReadReg(SgPtr->InstancePtr->Config.BaseAddress,
+					     ((u32)(XCSUDMA_I_STS_OFFSET) +
+					      ((u32)Channel * (u32)(XCSUDMA_OFFSET_DIFF))));
+		if ((IntrStatus & XCSUDMA_IXR_DONE_MASK) == 0U) {
+			Status = XST_DEVICE_BUSY;
+			continue;
+		}
+
+		XCsuDma_IntrClear(SgPtr->InstancePtr, Channel,
+				  XCSUDMA_IXR_DONE_MASK);
+		SgPtr->Busy[Channel] = FALSE;
+		if (SgPtr->Next[Channel] < SgPtr->Num[Channel]) {
+			XCsuDma_SgNext(SgPtr, Channel, FALSE);
+			Status = XST_DEVICE_BUSY;
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits for a scatter gather transfer to complete, feeding the
+* channels with XCsuDma_SgPoll(). The timeout restarts whenever a chunk
+* completes, so it applies per chunk as for XCsuDma_WaitForDoneTimeout().
+*
+* @param	SgPtr is a pointer to the scatter gather context.
+*
+* @return	XST_SUCCESS - In case of Success
+*		XST_FAILURE - In case of Timeout.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XCsuDma_SgWaitForDone(XCsuDma_SgXfer *SgPtr)
+{
+	u32 PollCount = XCSUDMA_DONE_TIMEOUT_VAL;
+	u32 Started;
+	u32 Status = (u32)XST_FAILURE;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(SgPtr != NULL);
+
+	Started = SgPtr->Started;
+	while (PollCount > 0U) {
+		if (XCsuDma_SgPoll(SgPtr) == XST_SUCCESS) {
+			Status = (u32)XST_SUCCESS;
+			break;
+		}
+
+		/* Restart the timeout when a new chunk got started */
+		if (SgPtr->Started != Started) {
+			Started = SgPtr->Started;
+			PollCount = XCSUDMA_DONE_TIMEOUT_VAL;
+			continue;
+		}
+
+		PollCount--;
+#ifdef VERSAL_PLM
+		Xil_PlmStubHandler();
+#endif
+		usleep(1U);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function hands the next chunk of a list to its channel, then
+* does the cache maintenance of the chunk after it so that this cost overlaps
+* with the transfer just started.
+*
+* @param	SgPtr is a pointer to the scatter gather context.
+* @param	Channel represents the type of channel either it is Source or
+* 		Destination.
+* @param	IsFirst is TRUE for the first chunk, whose cache maintenance
+*		has not been done yet.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XCsuDma_SgNext(XCsuDma_SgXfer *SgPtr, XCsuDma_Channel Channel,
+			   u8 IsFirst)
+{
+	const XCsuDma_SgEntry *Entry =
+		&SgPtr->List[Channel][SgPtr->Next[Channel]];
+	u8 EnDataLast = 0U;
+
+#ifndef VERSAL_NET
+	Xil_AssertVoid(((Entry->Addr) & (u64)(XCSUDMA_ADDR_LSB_MASK)) == (u64)0x00);
+#endif
+	Xil_AssertVoid(Entry->Size <= (u32)(XCSUDMA_SIZE_MAX));
+
+	if (IsFirst == TRUE) {
+		XCsuDma_CacheOp(Channel, Entry->Addr,
+				XCSUDMA_SG_DATA_SIZE(Entry->Size));
+	}
+
+	SgPtr->Next[Channel]++;
+	if ((Channel == XCSUDMA_SRC_CHANNEL) &&
+	    (SgPtr->Next[Channel] == SgPtr->Num[Channel])) {
+		EnDataLast = SgPtr->EnDataLast;
+	}
+
+	XCsuDma_WriteCmd(SgPtr->InstancePtr, Channel, Entry->Addr,
+			 XCSUDMA_SG_DATA_SIZE(Entry->Size), EnDataLast);
+	SgPtr->Busy[Channel] = TRUE;
+	SgPtr->Started++;
+
+	if (SgPtr->Next[Channel] < SgPtr->Num[Channel]) {
+		Entry++;
+		XCsuDma_CacheOp(Channel, Entry->Addr,
+				XCSUDMA_SG_DATA_SIZE(Entry->Size));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function does the cache maintenance needed before a buffer is
+* handed to a channel: flush for the source channel and invalidate for the
+* destination channel, depending on the processor.
+*
+* @param	Channel represents the type of channel either it is Source or
+* 		Destination.
+* @param	Addr is the address of the buffer.
+* @param	DataSize is the size of the buffer as programmed in the size
+*		register, i.e. in words except on VERSAL_NET.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XCsuDma_CacheOp(XCsuDma_Channel Channel, u64 Addr, u32 DataSize)
+{
+#if defined(ARMR52)
+	if (((Addr >> XCSUDMA_MSB_ADDR_SHIFT) == 0U) && (Channel == (XCSUDMA_DST_CHANNEL))) {
+		Xil_DCacheInvalidateRange((INTPTR)Addr, DataSize << XCSUDMA_SIZE_SHIFT);
+	}
+#elif defined(ARMR5)
+	/* No action if 64 bit address is used when this code is running on R5.
+	 * Flush if 32 bit addressing is used.
+	 */
+	if ((Addr >> XCSUDMA_MSB_ADDR_SHIFT) == 0U) {
+		Xil_DCacheFlushRange((INTPTR)Addr, DataSize << XCSUDMA_SIZE_SHIFT);
+	}
+#endif
+	/* No action required for PSU_PMU.
+	 * Perform cache operations on ARM64 (either 32 bit and 64 bit address)
+	 */
+#if defined(__aarch64__)
+	if (Channel == (XCSUDMA_SRC_CHANNEL)) {
+		Xil_DCacheFlushRange((INTPTR)Addr,
+				     (INTPTR)(DataSize << XCSUDMA_SIZE_SHIFT));
+	} else {
+		Xil_DCacheInvalidateRange((INTPTR)Addr,
+					  (INTPTR)(DataSize << XCSUDMA_SIZE_SHIFT));
+	}
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function programs the address and size registers of a channel,
+* which starts the transfer.
+*
+* @param	InstancePtr is a pointer to XCsuDma instance to be worked on.
+* @param	Channel represents the type of channel either it is Source or
+* 		Destination.
+* @param	Addr is the address of the buffer.
+* @param	DataSize is the size to be written in the size register.
+* @param	EnDataLast asserts data_inp_last at the end of the command.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XCsuDma_WriteCmd(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+			     u64 Addr, u32 DataSize, u8 EnDataLast)
+{
+	/* Set the starting address of the data to be tansferred from/to memory */
+	XCsuDma_WriteReg(InstancePtr->Config.BaseAddress,
+			 ((u32)(XCSUDMA_ADDR_OFFSET) +
+			  ((u32)Channel * (u32)(XCSUDMA_OFFSET_DIFF))),
+			 ((u32)(Addr) & (u32)(XCSUDMA_ADDR_MASK)));
+
+	XCsuDma_WriteReg(InstancePtr->Config.BaseAddress,
+			 (u32)(XCSUDMA_ADDR_MSB_OFFSET +
+			       ((u32)Channel * XCSUDMA_OFFSET_DIFF)),
+			 ((u32)((Addr & ULONG64_HI_MASK) >> XCSUDMA_MSB_ADDR_SHIFT) &
+			  (u32)(XCSUDMA_MSB_ADDR_MASK)));
+
+	/* Check and inform DMA if this is the last word(end of data) */
+	if (EnDataLast == (u8)1U) {
+		XCsuDma_WriteReg(InstancePtr->Config.BaseAddress,
+				 ((u32)(XCSUDMA_SIZE_OFFSET) +
+				  ((u32)Channel * (u32)(XCSUDMA_OFFSET_DIFF))),
+				 ((DataSize << (u32)(XCSUDMA_SIZE_SHIFT)) |
+				  (u32)(XCSUDMA_LAST_WORD_MASK)));
+	} else {
+		XCsuDma_WriteReg(InstancePtr->Config.BaseAddress,
+				 ((u32)(XCSUDMA_SIZE_OFFSET) +
+				  ((u32)Channel * (u32)(XCSUDMA_OFFSET_DIFF))),
+				 (DataSize << (u32)(XCSUDMA_SIZE_SHIFT)));
+	}
+}
+
 /** @} */
@@ -44,6 +44,13 @@
 * This driver will not support handling of interrupts user should write handler
 * to handle the interrupts.
 *
+* <b> Scatter Gather Lists </b>
+*
+* XCsuDma_SgInit() and XCsuDma_SgStart() start a transfer described by a list
+* of chunks per channel. XCsuDma_SgPoll() or XCsuDma_SgWaitForDone() give each
+* channel its next chunk as soon as the current one is done, and the cache
+* maintenance of the following chunk runs while the hardware is busy.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -109,6 +116,7 @@
 * 1.14	ab	01/16/23 Added Xil_PlmStubHandler() to XCsuDma_WaitForDone.
 * 1.14	ab	01/18/23 Added byte-aligned transfer API for VERSAL_NET devices.
 * 1.14  adk     04/14/23 Added support for system device-tree flow.
+* 1.14	fl	10/14/26 Added scatter gather list transfer APIs.
 * </pre>
 *
 ******************************************************************************/
@@ -426,6 +434,36 @@ typedef struct {
 				  *  commands */
 }XCsuDma_Configure;
 
+#define XCSUDMA_SG_NUM_CHANNELS	2U	/**< SRC and DST channels */
+
+/******************************************************************************/
+/**
+* This typedef describes one chunk of a scatter gather list.
+*/
+typedef struct {
+	u64 Addr;		/**< Address of the chunk */
+	u32 Size;		/**< Number of 4 byte words of the chunk */
+}XCsuDma_SgEntry;
+
+/******************************************************************************/
+/**
+* This typedef contains the state of a scatter gather transfer.
+*/
+typedef struct {
+	XCsuDma *InstancePtr;	/**< CSU_DMA instance doing the transfer */
+	const XCsuDma_SgEntry *List[XCSUDMA_SG_NUM_CHANNELS];
+				/**< Chunk list per channel */
+	u32 Num[XCSUDMA_SG_NUM_CHANNELS];
+				/**< Number of chunks per channel */
+	u32 Next[XCSUDMA_SG_NUM_CHANNELS];
+				/**< Next chunk to program per channel */
+	u8 Busy[XCSUDMA_SG_NUM_CHANNELS];
+				/**< A chunk is in progress on the channel */
+	u32 Started;		/**< Chunks programmed so far */
+	u8 EnDataLast;		/**< Assert data_inp_last on the last SRC
+				  *  chunk */
+}XCsuDma_SgXfer;
+
 /*****************************************************************************/
 
 /************************** Variable Definitions *****************************/
@@ -475,6 +513,14 @@ void XCsuDma_GetConfig(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
 
 u32 XCsuDma_WaitForDoneTimeout(XCsuDma *InstancePtr, XCsuDma_Channel Channel);
 
+/* Scatter gather list APIs */
+void XCsuDma_SgInit(XCsuDma_SgXfer *SgPtr, XCsuDma *InstancePtr,
+		    const XCsuDma_SgEntry *SrcList, u32 SrcNum,
+		    const XCsuDma_SgEntry *DstList, u32 DstNum, u8 EnDataLast);
+void XCsuDma_SgStart(XCsuDma_SgXfer *SgPtr);
+s32 XCsuDma_SgPoll(XCsuDma_SgXfer *SgPtr);
+u32 XCsuDma_SgWaitForDone(XCsuDma_SgXfer *SgPtr);
+
 /* Interrupt related APIs */
 u32 XCsuDma_IntrGetStatus(XCsuDma *InstancePtr, XCsuDma_Channel Channel);
 void XCsuDma_IntrClear(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
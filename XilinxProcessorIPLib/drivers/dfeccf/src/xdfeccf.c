@@ -55,6 +55,7 @@
 *       dc     06/20/23 Depricate obsolete APIs
 *       cog    07/04/23 Add support for SDT
 *       dc     08/29/23 Remove immediate trigger
+*       fl     10/14/26 Add staged CC configuration commit
 * </pre>
 * @addtogroup dfeccf Overview
 * @{
@@ -1492,6 +1493,82 @@ u32 XDfeCcf_SetNextCCCfgAndTrigger(XDfeCcf *InstancePtr, XDfeCcf_CCCfg *CCCfg)
 	return XST_FAILURE;
 }
 
+/****************************************************************************/
+/**
+*
+* Writes local CC configuration to the shadow (NEXT) registers without
+* triggering the update. This is the first half of
+* XDfeCcf_SetNextCCCfgAndTrigger(), use it to stage one carrier change on
+* several DFE IPs before arming any of them, XDfeCcf_CommitNextCCCfg() then
+* arms the update.
+*
+* @param    InstancePtr Pointer to the Ccf instance.
+* @param    CCCfg CC configuration container.
+*
+* @return
+*           - XST_SUCCESS if successful.
+*           - XST_FAILURE if the previous update is still pending, nothing
+*             is written then.
+*
+* @note     With the CCUpdate trigger in TUSER Single Shot mode the staged
+*           configurations of all the IPs are applied on the same TUSER
+*           event, provided all of them are committed before it.
+*
+****************************************************************************/
+u32 XDfeCcf_StageNextCCCfg(const XDfeCcf *InstancePtr,
+			   const XDfeCcf_CCCfg *CCCfg)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(CCCfg != NULL);
+
+	/* Exit with error if the previous update did not complete */
+	if ((XDFECCF_CC_UPDATE_TRIGGERED_HIGH ==
+	     XDfeCcf_RdRegBitField(InstancePtr, XDFECCF_ISR,
+				   XDFECCF_CC_UPDATE_TRIGGERED_WIDTH,
+				   XDFECCF_CC_UPDATE_TRIGGERED_OFFSET)) ||
+	    (XDFECCF_TRIGGERS_TRIGGER_ENABLE_ENABLED ==
+	     XDfeCcf_RdRegBitField(InstancePtr,
+				   XDFECCF_TRIGGERS_CC_UPDATE_OFFSET,
+				   XDFECCF_TRIGGERS_TRIGGER_ENABLE_WIDTH,
+				   XDFECCF_TRIGGERS_TRIGGER_ENABLE_OFFSET))) {
+		metal_log(METAL_LOG_ERROR, "CCUpdate pending in %s\n",
+			  __func__);
+		return XST_FAILURE;
+	}
+
+	XDfeCcf_SetNextCCCfg(InstancePtr, CCCfg);
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Triggers copying of a configuration staged with XDfeCcf_StageNextCCCfg()
+* from shadow to operational (CURRENT) registers.
+*
+* @param    InstancePtr Pointer to the Ccf instance.
+* @param    CCCfg CC configuration container passed to
+*           XDfeCcf_StageNextCCCfg().
+*
+* @return
+*           - XST_SUCCESS if successful.
+*           - XST_FAILURE if error occurs.
+*
+****************************************************************************/
+u32 XDfeCcf_CommitNextCCCfg(XDfeCcf *InstancePtr, const XDfeCcf_CCCfg *CCCfg)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(CCCfg != NULL);
+
+	if (XST_SUCCESS == XDfeCcf_EnableCCUpdateTrigger(InstancePtr)) {
+		InstancePtr->NotUsedCCID = CCCfg->Sequence.NotUsedCCID;
+		return XST_SUCCESS;
+	}
+	metal_log(METAL_LOG_ERROR, "CC Update Trigger failed in %s\n",
+		  __func__);
+	return XST_FAILURE;
+}
+
 /****************************************************************************/
 /**
 *
@@ -85,6 +85,7 @@
 *       dc     10/28/22 Switching Uplink/Downlink support
 *       dc     11/11/22 Align AddCC to switchable UL/DL algorithm
 * 1.6   cog    07/04/23 Add support for SDT
+*       fl     10/14/26 Add staged CC configuration commit
 *
 * </pre>
 * @endcond
@@ -476,6 +477,9 @@ void XDfeCcf_RemoveCCfromCCCfg(XDfeCcf *InstancePtr, XDfeCcf_CCCfg *CCCfg,
 void XDfeCcf_UpdateCCinCCCfg(const XDfeCcf *InstancePtr, XDfeCcf_CCCfg *CCCfg,
 			     s32 CCID, const XDfeCcf_CarrierCfg *CarrierCfg);
 u32 XDfeCcf_SetNextCCCfgAndTrigger(XDfeCcf *InstancePtr, XDfeCcf_CCCfg *CCCfg);
+u32 XDfeCcf_StageNextCCCfg(const XDfeCcf *InstancePtr,
+			   const XDfeCcf_CCCfg *CCCfg);
+u32 XDfeCcf_CommitNextCCCfg(XDfeCcf *InstancePtr, const XDfeCcf_CCCfg *CCCfg);
 u32 XDfeCcf_SetNextCCCfgAndTriggerSwitchable(XDfeCcf *InstancePtr,
 					     XDfeCcf_CCCfg *CCCfgDownlink,
 					     XDfeCcf_CCCfg *CCCfgUplink);
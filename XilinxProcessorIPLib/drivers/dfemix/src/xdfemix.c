@@ -61,6 +61,7 @@
 *       dc     06/20/23 Depricate obsolete APIs
 *       cog    07/04/23 Add support for SDT
 *       dc     08/28/23 Remove immediate trigger
+*       fl     10/14/26 Add staged CC configuration commit
 * </pre>
 * @addtogroup dfemix Overview
 * @{
@@ -2643,6 +2644,83 @@ u32 XDfeMix_SetNextCCCfgAndTrigger(XDfeMix *InstancePtr,
 	return XST_FAILURE;
 }
 
+/****************************************************************************/
+/**
+*
+* Writes local CC configuration to the shadow (NEXT) and NCO registers
+* without triggering the update. This is the first half of
+* XDfeMix_SetNextCCCfgAndTrigger(), use it to stage one carrier change on
+* several DFE IPs before arming any of them, XDfeMix_CommitNextCCCfg() then
+* arms the update.
+*
+* @param    InstancePtr Pointer to the Mixer instance.
+* @param    CCCfg CC configuration container.
+*
+* @return
+*           - XST_SUCCESS if successful.
+*           - XST_FAILURE if the previous update is still pending, nothing
+*             is written then.
+*
+* @note     With the CCUpdate trigger in TUSER Single Shot mode the staged
+*           configurations of all the IPs are applied on the same TUSER
+*           event, provided all of them are committed before it.
+*
+****************************************************************************/
+u32 XDfeMix_StageNextCCCfg(const XDfeMix *InstancePtr,
+			   const XDfeMix_CCCfg *CCCfg)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(CCCfg != NULL);
+
+	/* Exit with error if the previous update did not complete */
+	if ((XDFEMIX_CC_UPDATE_TRIGGERED_HIGH ==
+	     XDfeMix_RdRegBitField(InstancePtr, XDFEMIX_ISR,
+				   XDFEMIX_CC_UPDATE_TRIGGERED_WIDTH,
+				   XDFEMIX_CC_UPDATE_TRIGGERED_OFFSET)) ||
+	    (XDFEMIX_TRIGGERS_TRIGGER_ENABLE_ENABLED ==
+	     XDfeMix_RdRegBitField(InstancePtr,
+				   XDFEMIX_TRIGGERS_CC_UPDATE_OFFSET,
+				   XDFEMIX_TRIGGERS_TRIGGER_ENABLE_WIDTH,
+				   XDFEMIX_TRIGGERS_TRIGGER_ENABLE_OFFSET))) {
+		metal_log(METAL_LOG_ERROR, "CCUpdate pending in %s\n",
+			  __func__);
+		return XST_FAILURE;
+	}
+
+	XDfeMix_SetNextCCCfg(InstancePtr, CCCfg);
+	XDfeMix_SetNCORegisters(InstancePtr, CCCfg);
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Triggers copying of a configuration staged with XDfeMix_StageNextCCCfg()
+* from shadow to operational registers.
+*
+* @param    InstancePtr Pointer to the Mixer instance.
+* @param    CCCfg CC configuration container passed to
+*           XDfeMix_StageNextCCCfg().
+*
+* @return
+*           - XST_SUCCESS if successful.
+*           - XST_FAILURE if error occurs.
+*
+****************************************************************************/
+u32 XDfeMix_CommitNextCCCfg(XDfeMix *InstancePtr, const XDfeMix_CCCfg *CCCfg)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(CCCfg != NULL);
+
+	if (XST_SUCCESS == XDfeMix_EnableCCUpdateTrigger(InstancePtr)) {
+		InstancePtr->NotUsedCCID = CCCfg->Sequence.NotUsedCCID;
+		return XST_SUCCESS;
+	}
+	metal_log(METAL_LOG_ERROR, "CC Update Trigger failed in %s\n",
+		  __func__);
+	return XST_FAILURE;
+}
+
 /**
 * @cond nocomments
 */
@@ -85,6 +85,7 @@
 *       dc     11/11/22 Update NCOIdx and CCID check
 * 1.6   dc     06/15/23 Correct comment about gain
 *       cog    07/04/23 Add support for SDT
+*       fl     10/14/26 Add staged CC configuration commit
 *
 * </pre>
 * @endcond
@@ -598,6 +599,9 @@ u32 XDfeMix_UpdateCCinCCCfg(XDfeMix *InstancePtr, XDfeMix_CCCfg *CCCfg,
 			    s32 CCID, const XDfeMix_CarrierCfg *CarrierCfg);
 u32 XDfeMix_SetNextCCCfgAndTrigger(XDfeMix *InstancePtr,
 				   const XDfeMix_CCCfg *CCCfg);
+u32 XDfeMix_StageNextCCCfg(const XDfeMix *InstancePtr,
+			   const XDfeMix_CCCfg *CCCfg);
+u32 XDfeMix_CommitNextCCCfg(XDfeMix *InstancePtr, const XDfeMix_CCCfg *CCCfg);
 u32 XDfeMix_SetNextCCCfgAndTriggerSwitchable(XDfeMix *InstancePtr,
 					     XDfeMix_CCCfg *CCCfgDownlink,
 					     XDfeMix_CCCfg *CCCfgUplink);
@@ -51,6 +51,7 @@
 *       dc     06/20/23 Depricate obsolete APIs
 *       cog    07/04/23 Add support for SDT
 *       dc     30/28/23 Remove immediate trigger
+*       fl     10/14/26 Add staged configuration commit
 * </pre>
 * @addtogroup dfeprach Overview
 * @{
@@ -2490,6 +2491,94 @@ u32 XDfePrach_SetNextCfg(const XDfePrach *InstancePtr,
 	return XST_SUCCESS;
 }
 
+/****************************************************************************/
+/**
+*
+* Writes local CC and RC configuration to the shadow (NEXT) registers without
+* triggering the update. This is the first half of XDfePrach_SetNextCfg(),
+* use it to stage one carrier change on several DFE IPs before arming any of
+* them, XDfePrach_CommitNextCfg() then arms the update.
+*
+* @param    InstancePtr Pointer to the PRACH instance.
+* @param    NextCCCfg CC configuration container.
+* @param    NextRCCfg RC configuration container.
+*
+* @return
+*           - XST_SUCCESS if successful.
+*           - XST_FAILURE if the previous update is still pending, nothing
+*             is written then.
+*
+* @note     With the RACH update trigger in TUSER Single Shot mode the
+*           staged configurations of all the IPs are applied on the same
+*           TUSER event, provided all of them are committed before it.
+*
+****************************************************************************/
+u32 XDfePrach_StageNextCfg(const XDfePrach *InstancePtr,
+			   const XDfePrach_CCCfg *NextCCCfg,
+			   XDfePrach_RCCfg *NextRCCfg)
+{
+	u32 Index;
+	u32 BandId;
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(NextCCCfg != NULL);
+	Xil_AssertNonvoid(NextRCCfg != NULL);
+
+	/* Exit with error if the previous update did not complete */
+	if ((XDFEPRACH_RACH_UPDATE_TRIGGERED_HIGH ==
+	     XDfePrach_RdRegBitField(InstancePtr, XDFEPRACH_ISR,
+				     XDFEPRACH_RACH_UPDATE_TRIGGERED_WIDTH,
+				     XDFEPRACH_RACH_UPDATE_TRIGGERED_OFFSET)) ||
+	    (XDFEPRACH_TRIGGERS_TRIGGER_ENABLE_ENABLED ==
+	     XDfePrach_RdRegBitField(InstancePtr,
+				     XDFEPRACH_TRIGGERS_RACH_UPDATE_OFFSET,
+				     XDFEPRACH_TRIGGERS_TRIGGER_ENABLE_WIDTH,
+				     XDFEPRACH_TRIGGERS_TRIGGER_ENABLE_OFFSET))) {
+		metal_log(METAL_LOG_ERROR, "RachUpdate pending in %s\n",
+			  __func__);
+		return XST_FAILURE;
+	}
+
+	/* Set all CCCfg registers */
+	for (BandId = 0; BandId < InstancePtr->Config.NumBands; BandId++) {
+		XDfePrach_SetNextCCCfg(InstancePtr, NextCCCfg, BandId);
+	}
+
+	/* Set all RCCfg registers */
+	for (Index = 0; Index < XDFEPRACH_RC_NUM_MAX; Index++) {
+		XDfePrach_SetRC(InstancePtr, NextRCCfg, Index);
+	}
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Triggers copying of a configuration staged with XDfePrach_StageNextCfg()
+* from shadow to operational registers.
+*
+* @param    InstancePtr Pointer to the PRACH instance.
+*
+* @return
+*           - XST_SUCCESS if successful.
+*           - XST_FAILURE if error occurs.
+*
+****************************************************************************/
+u32 XDfePrach_CommitNextCfg(const XDfePrach *InstancePtr)
+{
+	u32 BandId;
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (XST_FAILURE == XDfePrach_EnableUpdateTrigger(InstancePtr)) {
+		metal_log(METAL_LOG_ERROR, "Trigger failure, %s\n", __func__);
+		return XST_FAILURE;
+	}
+	/* Enable the frame marker trigger too. */
+	for (BandId = 0; BandId < InstancePtr->Config.NumBands; BandId++) {
+		XDfePrach_EnableFrameMarkerTrigger(InstancePtr, BandId);
+	}
+	return XST_SUCCESS;
+}
+
 /****************************************************************************/
 /**
 *
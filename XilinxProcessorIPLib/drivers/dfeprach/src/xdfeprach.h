@@ -78,6 +78,7 @@
 *       dc     01/02/23 Multiband registers update
 * 1.6   dc     08/06/23 Support dynamic and static modes of operation
 *       cog    07/04/23 Add support for SDT
+*       fl     10/14/26 Add staged configuration commit
 *
 * </pre>
 * @endcond
@@ -703,6 +704,10 @@ u32 XDfePrach_UpdateCCinCCCfg(const XDfePrach *InstancePtr,
 u32 XDfePrach_SetNextCfg(const XDfePrach *InstancePtr,
 			 const XDfePrach_CCCfg *NextCCCfg,
 			 XDfePrach_RCCfg *NextRCCfg);
+u32 XDfePrach_StageNextCfg(const XDfePrach *InstancePtr,
+			   const XDfePrach_CCCfg *NextCCCfg,
+			   XDfePrach_RCCfg *NextRCCfg);
+u32 XDfePrach_CommitNextCfg(const XDfePrach *InstancePtr);
 u32 XDfePrach_AddCC(XDfePrach *InstancePtr, s32 CCID, u32 CCSeqBitmap,
 		    const XDfePrach_CarrierCfg *CarrierCfg);
 u32 XDfePrach_RemoveCC(XDfePrach *InstancePtr, s32 CCID);
@@ -272,12 +272,14 @@
  *   were experienced if skipping stream 2 and assigning stream 4 instead).
  *   skipping monitors in a daisy chain is OK as long as they are assigned to
  *   streams in order.
- * - In MST mode, the current version of the driver does not support removal of
- *   an allocated stream from the virtual channel payload ID table without
- *   clearing the entire table.
- * - Some sideband messages have not been implemented in the current version of
- *   the driver for MST mode. Notably, reception of a CONNECTION_STATUS_NOTIFY
- *   sideband message.
+ * - In MST mode, a single stream can be removed from or added to the virtual
+ *   channel payload ID table with XDp_TxDeallocatePayloadStream and
+ *   XDp_TxAllocatePayloadStream, the other streams keep running.
+ * - Up requests are not handled by the interrupt handler. On an HPD pulse, the
+ *   application calls XDp_TxReceiveConnStatusNotify to receive and acknowledge
+ *   a CONNECTION_STATUS_NOTIFY sideband message, then
+ *   XDp_TxTopologyUpdateBranch to rediscover the devices downstream of the
+ *   branch device that sent it.
  * - The driver does not handle audio. See the audio example in the driver
  *   examples directory for the required sequence for enabling audio.
  *
@@ -364,6 +366,10 @@
  *                     capability for receiving colorimetry information through
  *                     VSC SDP packets.
  * 7.4   rg   09/26/20 Added support yuv420 color format.
+ * 7.8   fl   10/14/26 Added XDp_TxReceiveConnStatusNotify,
+ *                     XDp_TxTopologyUpdateBranch, XDp_TxAllocatePayloadStream
+ *                     and XDp_TxDeallocatePayloadStream for updating the MST
+ *                     topology and the payload of a single stream on hotplug.
  *
  * </pre>
  *
@@ -675,6 +681,12 @@ typedef struct {
 	u8 MstStreamEnable;		/**< In MST mode, enables the
 						corresponding stream for this
 						MSA configuration. */
+	u8 AllocStartTs;		/**< The first timeslot allocated to
+						the stream in the payload ID
+						table. */
+	u8 AllocNumTs;			/**< The number of timeslots allocated
+						to the stream, 0 if the stream
+						is not allocated. */
 } XDp_TxMstStream;
 
 /**
@@ -734,8 +746,39 @@ typedef struct {
 						MST topology. The entries will
 						point to the sinks in the
 						NodeTable. */
+	u8 RootGuid[XDP_GUID_NBYTES];	/**< The GUID of the branch device
+						directly downstream to the
+						DisplayPort TX. */
 } XDp_TxTopology;
 
+/**
+ * This typedef describes a CONNECTION_STATUS_NOTIFY up request received from
+ * a branch device in the MST topology.
+ */
+typedef struct {
+	u8 Guid[XDP_GUID_NBYTES];	/**< The GUID of the branch device that
+						sent the notification. */
+	u8 PortNum;			/**< The port of the branch device whose
+						connection status changed. */
+	u8 LegacyDevPlugStatus;		/**< A legacy device is plugged into
+						the port. */
+	u8 DpDevPlugStatus;		/**< A DisplayPort device is plugged
+						into the port. */
+	u8 MsgCapStatus;		/**< The device on the port is capable
+						of sending and receiving
+						sideband messages. */
+	u8 InputPort;			/**< The port is an upstream facing
+						port. */
+	u8 PeerDeviceType;		/**< The type of the device on the
+						port. */
+	u8 BranchLct;			/**< The total number of DisplayPort
+						links from the DisplayPort TX to
+						the branch device. */
+	u8 BranchRad[15];		/**< The relative address from the
+						DisplayPort TX to the branch
+						device. */
+} XDp_TxConnStatusNotify;
+
 /**
  * This typedef describes Audio InfoFrame packet.
  */
@@ -1579,6 +1622,10 @@ u32 XDp_TxFindAccessibleDpDevices(XDp *InstancePtr, u8 LinkCountTotal,
 							u8 *RelativeAddress);
 void XDp_TxTopologySwapSinks(XDp *InstancePtr, u8 Index0, u8 Index1);
 void XDp_TxTopologySortSinksByTiling(XDp *InstancePtr);
+u32 XDp_TxReceiveConnStatusNotify(XDp *InstancePtr,
+				  XDp_TxConnStatusNotify *Notify);
+u32 XDp_TxTopologyUpdateBranch(XDp *InstancePtr, u8 LinkCountTotal,
+							u8 *RelativeAddress);
 
 /* xdp_mst.c: Multi-stream transport (MST) functions for communicating
  * with downstream DisplayPort devices. */
@@ -1598,6 +1645,8 @@ u32 XDp_TxAllocatePayloadStreams(XDp *InstancePtr);
 u32 XDp_TxAllocatePayloadVcIdTable(XDp *InstancePtr, u8 VcId, u8 Ts,
 		u8 StartTs);
 u32 XDp_TxClearPayloadVcIdTable(XDp *InstancePtr);
+u32 XDp_TxAllocatePayloadStream(XDp *InstancePtr, u8 Stream);
+u32 XDp_TxDeallocatePayloadStream(XDp *InstancePtr, u8 Stream);
 
 /* xdp_mst.c: Multi-stream transport (MST) functions for issuing sideband
  * messages. */
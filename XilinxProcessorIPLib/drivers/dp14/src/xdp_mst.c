@@ -28,6 +28,11 @@
  * 5.2  aad  01/24/16 XDp_RxAllocatePayloadStream now adjusts to timeslot
  *			   rearragement
  * 6.0	tu   05/30/17 Initialized variable in XDp_RxDeviceInfoToRawData
+ * 7.8   fl   10/14/26 Added reception of CONNECTION_STATUS_NOTIFY, update of
+ *                     the topology downstream of one branch device and
+ *                     allocation and removal of the payload of one stream.
+ *                     The GUID of a branch device is now stored in its own
+ *                     node instead of the GUID of its upstream branch.
  * </pre>
  *
 *******************************************************************************/
@@ -183,6 +188,10 @@ static void XDp_TxGetDeviceInfoFromSbMsgLinkAddress(
 			XDp_SidebandReply *SbReply,
 			XDp_SbMsgLinkAddressReplyDeviceInfo *FormatReply);
 static u32 XDp_TxSendActTrigger(XDp *InstancePtr);
+static u8 XDp_TxFirstTimeslot(XDp *InstancePtr);
+static void XDp_TxWriteVcPayloadTable(XDp *InstancePtr);
+static u32 XDp_TxUpdateStreamPayload(XDp *InstancePtr, u8 VcId, u8 StartTs,
+								u8 NumTs);
 #endif /* XPAR_XDPTXSS_NUM_INSTANCES */
 
 static u32 XDp_SendSbMsgFragment(XDp *InstancePtr, XDp_SidebandMsg *Msg);
@@ -194,6 +203,10 @@ static void XDp_RxReadDownReq(XDp *InstancePtr, XDp_SidebandMsg *Msg);
 #if XPAR_XDPTXSS_NUM_INSTANCES
 static u32 XDp_TxReceiveSbMsg(XDp *InstancePtr, XDp_SidebandReply *SbReply);
 static u32 XDp_TxWaitSbReply(XDp *InstancePtr);
+static u32 XDp_TxReceiveUpReq(XDp *InstancePtr, XDp_SidebandMsg *Msg,
+						XDp_SidebandReply *UpReq);
+static u32 XDp_TxWaitUpReq(XDp *InstancePtr);
+static u32 XDp_TxSendUpRep(XDp *InstancePtr, u8 RequestId, u8 SeqNum);
 #endif /* XPAR_XDPTXSS_NUM_INSTANCES */
 
 static u32 XDp_Transaction2MsgFormat(u8 *Transaction, XDp_SidebandMsg *Msg);
@@ -717,6 +730,24 @@ u32 XDp_TxFindAccessibleDpDevices(XDp *InstancePtr, u8 LinkCountTotal,
 	/* Write GUID to the branch device if it doesn't already have one. */
 	XDp_TxIssueGuid(InstancePtr, LinkCountTotal, RelativeAddress, Topology,
 							DeviceInfo.Guid);
+
+	/* Record the GUID of the branch device, up requests identify their
+	 * originator by it. */
+	if (LinkCountTotal == 1) {
+		memcpy(Topology->RootGuid, DeviceInfo.Guid, XDP_GUID_NBYTES);
+	}
+	for (Index = 0; (LinkCountTotal > 1) && (Index < Topology->NodeTotal);
+								Index++) {
+		XDp_TxTopologyNode *Node = &Topology->NodeTable[Index];
+
+		if ((Node->DeviceType == XDP_MST_BRANCH_DEVICE_DETECTED) &&
+		    (Node->LinkCountTotal == LinkCountTotal) &&
+		    (memcmp(Node->RelativeAddress, RelativeAddress,
+					LinkCountTotal - 1) == 0)) {
+			memcpy(Node->Guid, DeviceInfo.Guid, XDP_GUID_NBYTES);
+		}
+	}
+
 	/* Downstream devices will be an extra link away from the source than
 	 * this branch device. */
 	LinkCountTotal++;
@@ -783,6 +814,192 @@ u32 XDp_TxFindAccessibleDpDevices(XDp *InstancePtr, u8 LinkCountTotal,
 	return XST_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+ * This function will rediscover the part of the topology downstream of one
+ * branch device. The nodes found downstream of the branch device in an
+ * earlier discovery are removed from the topology's node table and sink list,
+ * the rest of the cached topology is kept, and the branch device is explored
+ * again with XDp_TxFindAccessibleDpDevices.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	LinkCountTotal is the number of DisplayPort links from the
+ *		DisplayPort source to the branch device.
+ * @param	RelativeAddress is the relative address from the DisplayPort
+ *		source to the branch device.
+ *
+ * @return
+ *		- XST_SUCCESS if the branch was rediscovered successfully.
+ *		- XST_FAILURE otherwise - if sending a LINK_ADDRESS sideband
+ *		  message to one of the branch devices failed.
+ *
+ * @note	Sinks that remain keep their order in the sink list, newly
+ *		found sinks are appended. With a LinkCountTotal of 1 the whole
+ *		topology is rediscovered.
+ *
+*******************************************************************************/
+u32 XDp_TxTopologyUpdateBranch(XDp *InstancePtr, u8 LinkCountTotal,
+							u8 *RelativeAddress)
+{
+	XDp_TxTopology *Topology;
+	XDp_TxTopologyNode *Node;
+	u8 NewIndex[63];
+	u8 RadCopy[15];
+	u8 Index;
+	u8 Index2;
+	u8 Kept = 0;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+	Xil_AssertNonvoid(LinkCountTotal > 0);
+	Xil_AssertNonvoid((RelativeAddress != NULL) || (LinkCountTotal == 1));
+
+	Topology = &InstancePtr->TxInstance.Topology;
+
+	/* Drop the nodes downstream of the branch, compacting the table. */
+	for (Index = 0; Index < Topology->NodeTotal; Index++) {
+		Node = &Topology->NodeTable[Index];
+		NewIndex[Index] = 0xFF;
+		if (Node->LinkCountTotal > LinkCountTotal) {
+			for (Index2 = 0; Index2 < (LinkCountTotal - 1); Index2++) {
+				if (Node->RelativeAddress[Index2] !=
+						RelativeAddress[Index2]) {
+					break;
+				}
+			}
+			if (Index2 == (LinkCountTotal - 1)) {
+				continue;
+			}
+		}
+		if (Kept != Index) {
+			Topology->NodeTable[Kept] = *Node;
+		}
+		NewIndex[Index] = Kept++;
+	}
+
+	/* Relink the sink list to the compacted node table. */
+	Index2 = 0;
+	for (Index = 0; Index < Topology->SinkTotal; Index++) {
+		Node = Topology->SinkList[Index];
+		if (NewIndex[Node - Topology->NodeTable] != 0xFF) {
+			Topology->SinkList[Index2++] = &Topology->NodeTable[
+				NewIndex[Node - Topology->NodeTable]];
+		}
+	}
+	Topology->NodeTotal = Kept;
+	Topology->SinkTotal = Index2;
+
+	for (Index = 0; Index < (LinkCountTotal - 1); Index++) {
+		RadCopy[Index] = RelativeAddress[Index];
+	}
+
+	return XDp_TxFindAccessibleDpDevices(InstancePtr, LinkCountTotal,
+								RadCopy);
+}
+
+/******************************************************************************/
+/**
+ * This function will receive a CONNECTION_STATUS_NOTIFY up request sent by a
+ * branch device when a device is plugged into or unplugged from one of its
+ * ports, acknowledge it, and locate the branch device in the topology.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Notify is a pointer to the structure that will be filled in
+ *		with the content of the notification.
+ *
+ * @return
+ *		- XST_SUCCESS if a notification was received and its branch
+ *		  device was found in the topology. Pass Notify->BranchLct and
+ *		  Notify->BranchRad to XDp_TxTopologyUpdateBranch.
+ *		- XST_NO_DATA if no up request is pending.
+ *		- XST_NO_FEATURE if an up request other than
+ *		  CONNECTION_STATUS_NOTIFY was received and acknowledged.
+ *		- XST_DEVICE_NOT_FOUND if the branch device is not in the
+ *		  topology, the topology must be discovered again.
+ *		- XST_FAILURE otherwise - if an AUX transaction failed or the
+ *		  CRC of the up request did not match.
+ *
+ * @note	Call from the HPD pulse handling, up requests are enabled by
+ *		XDp_TxMstEnable.
+ *
+*******************************************************************************/
+u32 XDp_TxReceiveConnStatusNotify(XDp *InstancePtr,
+				  XDp_TxConnStatusNotify *Notify)
+{
+	u32 Status;
+	u8 Index;
+	u8 Index2;
+	u8 *Data;
+	XDp_SidebandMsg Msg;
+	XDp_SidebandReply UpReq;
+	XDp_TxTopology *Topology;
+	XDp_TxTopologyNode *Node;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+	Xil_AssertNonvoid(Notify != NULL);
+
+	Status = XDp_TxReceiveUpReq(InstancePtr, &Msg, &UpReq);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	/* Acknowledge the request with an UP_REP. */
+	Status = XDp_TxSendUpRep(InstancePtr, UpReq.Data[0] & 0x7F,
+						Msg.Header.MsgSequenceNum);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	if ((UpReq.Data[0] & 0x7F) != XDP_SBMSG_CONNECTION_STATUS_NOTIFY) {
+		return XST_NO_FEATURE;
+	}
+	if (UpReq.Length < (3 + XDP_GUID_NBYTES)) {
+		return XST_FAILURE;
+	}
+
+	Data = &UpReq.Data[1];
+	Notify->PortNum = Data[0] >> 4;
+	for (Index = 0; Index < XDP_GUID_NBYTES; Index++) {
+		Notify->Guid[Index] = Data[1 + Index];
+	}
+	Data += 1 + XDP_GUID_NBYTES;
+	Notify->LegacyDevPlugStatus = (Data[0] >> 6) & 0x1;
+	Notify->DpDevPlugStatus = (Data[0] >> 5) & 0x1;
+	Notify->MsgCapStatus = (Data[0] >> 4) & 0x1;
+	Notify->InputPort = (Data[0] >> 3) & 0x1;
+	Notify->PeerDeviceType = Data[0] & 0x7;
+
+	/* Locate the branch device that sent the notification. */
+	Topology = &InstancePtr->TxInstance.Topology;
+	Notify->BranchLct = 0;
+	if (memcmp(Notify->Guid, Topology->RootGuid, XDP_GUID_NBYTES) == 0) {
+		Notify->BranchLct = 1;
+	}
+	for (Index = 0; (Index < Topology->NodeTotal) &&
+					(Notify->BranchLct == 0); Index++) {
+		Node = &Topology->NodeTable[Index];
+		if ((Node->DeviceType == XDP_MST_BRANCH_DEVICE_DETECTED) &&
+		    (memcmp(Notify->Guid, Node->Guid, XDP_GUID_NBYTES) == 0)) {
+			Notify->BranchLct = Node->LinkCountTotal;
+			for (Index2 = 0; Index2 < (Node->LinkCountTotal - 1);
+								Index2++) {
+				Notify->BranchRad[Index2] =
+						Node->RelativeAddress[Index2];
+			}
+		}
+	}
+	if (Notify->BranchLct == 0) {
+		return XST_DEVICE_NOT_FOUND;
+	}
+
+	return XST_SUCCESS;
+}
+
 /******************************************************************************/
 /**
  * Swap the ordering of the sinks in the topology's sink list. All sink
@@ -1414,6 +1631,10 @@ u32 XDp_TxAllocatePayloadStreams(XDp *InstancePtr)
 		if (Status != XST_SUCCESS) {
 			return Status;
 		}
+		MstStream =
+			&InstancePtr->TxInstance.MstStreamConfig[StreamIndex];
+		MstStream->AllocStartTs = StartTs;
+		MstStream->AllocNumTs = MsaConfig->TransferUnitSize;
 		StartTs += MsaConfig->TransferUnitSize;
 
 		/* Generate an ACT event. */
@@ -1422,9 +1643,6 @@ u32 XDp_TxAllocatePayloadStreams(XDp *InstancePtr)
 			return Status;
 		}
 
-		MstStream =
-			&InstancePtr->TxInstance.MstStreamConfig[StreamIndex];
-
 		Status = XDp_TxSendSbMsgAllocatePayload(InstancePtr,
 			MstStream->LinkCountTotal, MstStream->RelativeAddress,
 			StreamIndex + XDP_TX_STREAM_ID1, MstStream->MstPbn);
@@ -1584,12 +1802,17 @@ u32 XDp_TxAllocatePayloadVcIdTable(XDp *InstancePtr, u8 VcId, u8 Ts, u8 StartTs)
 u32 XDp_TxClearPayloadVcIdTable(XDp *InstancePtr)
 {
 	u32 Status;
+	u8 StreamIndex;
 
 	/* Verify arguments. */
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
 
+	for (StreamIndex = 0; StreamIndex < XDP_TX_STREAM_ID4; StreamIndex++) {
+		InstancePtr->TxInstance.MstStreamConfig[StreamIndex].AllocNumTs = 0;
+	}
+
 	Status = XDp_TxAllocatePayloadVcIdTable(InstancePtr, 0, 64, 0);
 	if (Status != XST_SUCCESS) {
 		return Status;
@@ -1601,6 +1824,152 @@ u32 XDp_TxClearPayloadVcIdTable(XDp *InstancePtr)
 	return Status;
 }
 
+/******************************************************************************/
+/**
+ * This function will allocate the virtual channel payload of a single stream
+ * in both the DisplayPort TX and the downstream DisplayPort devices, without
+ * touching the payloads of the other streams. The payload is appended after
+ * the timeslots in use, as required by the payload ID table of the immediate
+ * downstream device.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Stream is the stream ID to allocate.
+ *
+ * @return
+ *		- XST_SUCCESS if the payload ID tables were successfully updated
+ *		  with the new allocation.
+ *		- XST_DEVICE_BUSY if the stream is already allocated.
+ *		- XST_BUFFER_TOO_SMALL if there is not enough free timeslots in
+ *		  the payload ID table for the stream.
+ *		- XST_ERROR_COUNT_MAX or XST_FAILURE if an AUX transaction or
+ *		  the ALLOCATE_PAYLOAD sideband message failed.
+ *
+ * @note	Used after a hotplug to bring up the stream of one sink while
+ *		the other streams keep running. The stream must have been
+ *		configured with XDp_TxSetStreamSinkRad() and its MSA.
+ *
+*******************************************************************************/
+u32 XDp_TxAllocatePayloadStream(XDp *InstancePtr, u8 Stream)
+{
+	u32 Status;
+	u8 StreamIndex;
+	u8 StartTs;
+	u8 NumTs;
+	XDp_TxMstStream *MstStream;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+	Xil_AssertNonvoid((Stream >= XDP_TX_STREAM_ID1) &&
+			  (Stream <= XDP_TX_STREAM_ID4));
+
+	MstStream = &InstancePtr->TxInstance.MstStreamConfig[Stream - 1];
+	if (MstStream->AllocNumTs != 0) {
+		return XST_DEVICE_BUSY;
+	}
+
+	/* Append the payload after the allocated timeslots. */
+	StartTs = XDp_TxFirstTimeslot(InstancePtr);
+	for (StreamIndex = 0; StreamIndex < XDP_TX_STREAM_ID4; StreamIndex++) {
+		XDp_TxMstStream *Other =
+			&InstancePtr->TxInstance.MstStreamConfig[StreamIndex];
+
+		if ((Other->AllocNumTs != 0) &&
+		    ((Other->AllocStartTs + Other->AllocNumTs) > StartTs)) {
+			StartTs = Other->AllocStartTs + Other->AllocNumTs;
+		}
+	}
+	NumTs = InstancePtr->TxInstance.MsaConfig[Stream - 1].TransferUnitSize;
+	if ((NumTs == 0) ||
+	    ((StartTs + NumTs) > XDP_TX_NUM_PAYLOAD_TIMESLOTS)) {
+		return XST_BUFFER_TOO_SMALL;
+	}
+
+	MstStream->AllocStartTs = StartTs;
+	MstStream->AllocNumTs = NumTs;
+	InstancePtr->TxInstance.MsaConfig[Stream - 1].StartTs = StartTs;
+
+	Status = XDp_TxUpdateStreamPayload(InstancePtr, Stream, StartTs, NumTs);
+	if (Status != XST_SUCCESS) {
+		MstStream->AllocNumTs = 0;
+		XDp_TxWriteVcPayloadTable(InstancePtr);
+		return Status;
+	}
+
+	return XDp_TxSendSbMsgAllocatePayload(InstancePtr,
+			MstStream->LinkCountTotal, MstStream->RelativeAddress,
+			Stream, MstStream->MstPbn);
+}
+
+/******************************************************************************/
+/**
+ * This function will remove the virtual channel payload of a single stream
+ * from both the DisplayPort TX and the downstream DisplayPort devices. The
+ * payloads of the other streams are kept, the ones allocated after this
+ * stream move down by the freed number of timeslots.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Stream is the stream ID to remove.
+ *
+ * @return
+ *		- XST_SUCCESS if the payload was removed.
+ *		- XST_ERROR_COUNT_MAX or XST_FAILURE if an AUX transaction or
+ *		  the ALLOCATE_PAYLOAD sideband message failed.
+ *
+ * @note	The sideband message is sent to the path of the stream as
+ *		currently configured, call this function before pointing the
+ *		stream to another sink. A NACK from a branch whose sink has
+ *		been unplugged is reported, the payload ID tables are updated
+ *		regardless.
+ *
+*******************************************************************************/
+u32 XDp_TxDeallocatePayloadStream(XDp *InstancePtr, u8 Stream)
+{
+	u32 Status;
+	u8 StreamIndex;
+	u8 StartTs;
+	u8 NumTs;
+	XDp_TxMstStream *MstStream;
+	XDp_TxMstStream *Other;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+	Xil_AssertNonvoid((Stream >= XDP_TX_STREAM_ID1) &&
+			  (Stream <= XDP_TX_STREAM_ID4));
+
+	MstStream = &InstancePtr->TxInstance.MstStreamConfig[Stream - 1];
+	if (MstStream->AllocNumTs == 0) {
+		return XST_SUCCESS;
+	}
+	StartTs = MstStream->AllocStartTs;
+	NumTs = MstStream->AllocNumTs;
+
+	/* The immediate downstream device compacts its payload ID table when
+	 * a virtual channel is deleted, mirror this in the DisplayPort TX. */
+	MstStream->AllocNumTs = 0;
+	for (StreamIndex = 0; StreamIndex < XDP_TX_STREAM_ID4; StreamIndex++) {
+		Other = &InstancePtr->TxInstance.MstStreamConfig[StreamIndex];
+		if ((Other->AllocNumTs != 0) && (Other->AllocStartTs > StartTs)) {
+			Other->AllocStartTs -= NumTs;
+			InstancePtr->TxInstance.MsaConfig[StreamIndex].StartTs =
+							Other->AllocStartTs;
+		}
+	}
+
+	Status = XDp_TxUpdateStreamPayload(InstancePtr, Stream, StartTs, 0);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	/* Release the bandwidth along the path of the stream. */
+	return XDp_TxSendSbMsgAllocatePayload(InstancePtr,
+			MstStream->LinkCountTotal, MstStream->RelativeAddress,
+			Stream, 0);
+}
+
 /******************************************************************************/
 /**
  * This function will send a REMOTE_DPCD_WRITE sideband message which will write
@@ -2203,7 +2572,8 @@ u32 XDp_TxSendSbMsgEnumPathResources(XDp *InstancePtr, u8 LinkCountTotal,
  *
  * @note	ALLOCATE_PAYLOAD is a path message that will be serviced by all
  *		downstream DisplayPort devices connecting the DisplayPort TX and
- *		the target device.
+ *		the target device. A Pbn of 0 releases the bandwidth of the
+ *		virtual channel.
  *
 *******************************************************************************/
 u32 XDp_TxSendSbMsgAllocatePayload(XDp *InstancePtr, u8 LinkCountTotal,
@@ -2221,7 +2591,6 @@ u32 XDp_TxSendSbMsgAllocatePayload(XDp *InstancePtr, u8 LinkCountTotal,
 	Xil_AssertNonvoid(LinkCountTotal > 0);
 	Xil_AssertNonvoid((RelativeAddress != NULL) || (LinkCountTotal == 1));
 	Xil_AssertNonvoid(VcId > 0);
-	Xil_AssertNonvoid(Pbn > 0);
 
 	Msg.FragmentNum = 0;
 
@@ -3564,6 +3933,131 @@ static u32 XDp_TxSendActTrigger(XDp *InstancePtr)
 
 	return XST_SUCCESS;
 }
+
+/******************************************************************************/
+/**
+ * This function will return the first timeslot of the payload ID table that
+ * can be allocated to a stream.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return	The first allocatable timeslot.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u8 XDp_TxFirstTimeslot(XDp *InstancePtr)
+{
+	(void)InstancePtr;
+
+	/* Timeslot 0 holds the MTP header. */
+	return 1;
+}
+
+/******************************************************************************/
+/**
+ * This function will write the virtual channel payload table of the
+ * DisplayPort TX from the timeslots allocated to each stream.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XDp_TxWriteVcPayloadTable(XDp *InstancePtr)
+{
+	u8 Index;
+	u8 StreamIndex;
+	u8 VcId;
+	XDp_TxMstStream *MstStream;
+
+	for (Index = XDp_TxFirstTimeslot(InstancePtr);
+			Index < XDP_TX_NUM_PAYLOAD_TIMESLOTS; Index++) {
+		VcId = 0;
+		for (StreamIndex = 0; StreamIndex < XDP_TX_STREAM_ID4;
+							StreamIndex++) {
+			MstStream =
+			&InstancePtr->TxInstance.MstStreamConfig[StreamIndex];
+			if ((MstStream->AllocNumTs != 0) &&
+			    (Index >= MstStream->AllocStartTs) &&
+			    (Index < (MstStream->AllocStartTs +
+				      MstStream->AllocNumTs))) {
+				VcId = StreamIndex + XDP_TX_STREAM_ID1;
+			}
+		}
+		XDp_WriteReg(InstancePtr->Config.BaseAddr,
+			     (XDP_TX_VC_PAYLOAD_BUFFER_ADDR + (4 * Index)), VcId);
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function will add or delete the virtual channel of one stream in the
+ * payload ID table of the immediate downstream device, update the table of
+ * the DisplayPort TX and switch both with an ACT trigger.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	VcId is the virtual channel ID of the stream.
+ * @param	StartTs is the starting timeslot of the stream.
+ * @param	NumTs is the number of timeslots, 0 to delete the virtual
+ *		channel.
+ *
+ * @return
+ *		- XST_SUCCESS if both payload ID tables were updated.
+ *		- XST_ERROR_COUNT_MAX if waiting for the payload ID table to be
+ *		  updated timed out.
+ *		- XST_FAILURE or XST_DEVICE_NOT_FOUND if an AUX transaction
+ *		  failed.
+ *
+ * @note	The allocation of the stream in MstStreamConfig must already
+ *		reflect the change.
+ *
+*******************************************************************************/
+static u32 XDp_TxUpdateStreamPayload(XDp *InstancePtr, u8 VcId, u8 StartTs,
+								u8 NumTs)
+{
+	u32 Status;
+	u8 AuxData[3];
+	u8 TimeoutCount = 0;
+
+	/* Clear the VC payload ID table updated bit. */
+	AuxData[0] = 0x1;
+	Status = XDp_TxAuxWrite(InstancePtr,
+			XDP_DPCD_PAYLOAD_TABLE_UPDATE_STATUS, 1, AuxData);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	XDp_TxWriteVcPayloadTable(InstancePtr);
+
+	AuxData[0] = VcId;
+	AuxData[1] = StartTs;
+	AuxData[2] = NumTs;
+	Status = XDp_TxAuxWrite(InstancePtr, XDP_DPCD_PAYLOAD_ALLOCATE_SET, 3,
+								AuxData);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	/* Wait for the VC table to be updated. */
+	do {
+		Status = XDp_TxAuxRead(InstancePtr,
+			XDP_DPCD_PAYLOAD_TABLE_UPDATE_STATUS, 1, AuxData);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+		if (TimeoutCount > XDP_TX_ALLOCATE_PAYLOAD_MAX_TIMEOUT_COUNT) {
+			return XST_ERROR_COUNT_MAX;
+		}
+		TimeoutCount++;
+		XDp_WaitUs(InstancePtr, 1000);
+	} while ((AuxData[0] & 0x01) != 0x01);
+
+	/* Generate an ACT event. */
+	return XDp_TxSendActTrigger(InstancePtr);
+}
 #endif /* XPAR_XDPTXSS_NUM_INSTANCES */
 
 
@@ -3836,6 +4330,192 @@ static u32 XDp_TxWaitSbReply(XDp *InstancePtr)
 
 	return XST_SUCCESS;
 }
+
+/******************************************************************************/
+/**
+ * This function will read a pending up request from the RX device directly
+ * downstream to the DisplayPort TX.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Msg is a pointer to the sideband message that will hold the
+ *		header of the last fragment of the request.
+ * @param	UpReq is a pointer to the structure that will be filled in
+ *		with the body data of the request.
+ *
+ * @return
+ *		- XST_SUCCESS if an up request was received.
+ *		- XST_NO_DATA if no up request is pending.
+ *		- XST_FAILURE otherwise - if an AUX transaction failed or the
+ *		  CRC did not match.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxReceiveUpReq(XDp *InstancePtr, XDp_SidebandMsg *Msg,
+						XDp_SidebandReply *UpReq)
+{
+	u32 Status;
+	int BytesToRead;
+	u8 Index;
+	u8 AuxData[80];
+	u8 Offset;
+	u8 First = 1;
+
+	Msg->FragmentNum = 0;
+	UpReq->Length = 0;
+
+	do {
+		Status = XDp_TxAuxRead(InstancePtr,
+				XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0,
+				1, AuxData);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+		/* UP_REQ_MSG_RDY. */
+		if ((AuxData[0] & 0x20) != 0x20) {
+			if (First) {
+				return XST_NO_DATA;
+			}
+			Status = XDp_TxWaitUpReq(InstancePtr);
+			if (Status != XST_SUCCESS) {
+				return Status;
+			}
+		}
+		First = 0;
+
+		Status = XDp_TxAuxRead(InstancePtr, XDP_DPCD_UP_REQ,
+					XDP_MAX_BYTES_TO_READ, AuxData);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+		Offset = XDP_DOWN_REQ_OFFSET;
+		BytesToRead = (AuxData[1] & 0x3F) - XDP_MAX_BYTES_TO_READ;
+		while (BytesToRead >= 0) {
+			Status = XDp_TxAuxRead(InstancePtr,
+					XDP_DPCD_UP_REQ + Offset,
+					XDP_MAX_BYTES_TO_READ, &AuxData[Offset]);
+			if (Status != XST_SUCCESS) {
+				return Status;
+			}
+			BytesToRead -= XDP_MAX_BYTES_TO_READ;
+			Offset += XDP_DOWN_REQ_OFFSET;
+		}
+
+		Status = XDp_Transaction2MsgFormat(AuxData, Msg);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		/* Clear UP_REQ_MSG_RDY. */
+		AuxData[0] = 0x20;
+		Status = XDp_TxAuxWrite(InstancePtr,
+				XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0,
+				1, AuxData);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+
+		for (Index = 0; Index < Msg->Body.MsgDataLength; Index++) {
+			UpReq->Data[UpReq->Length++] = Msg->Body.MsgData[Index];
+		}
+	}
+	while (Msg->Header.EndOfMsgTransaction == 0);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function will wait until the RX device directly downstream to the
+ * DisplayPort TX indicates that the next fragment of an up request is ready.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return
+ *		- XST_SUCCESS if a fragment is ready.
+ *		- XST_ERROR_COUNT_MAX if waiting timed out.
+ *		- XST_FAILURE if the AUX read transaction failed.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxWaitUpReq(XDp *InstancePtr)
+{
+	u32 Status;
+	u8 AuxData;
+	u16 TimeoutCount = 0;
+
+	do {
+		Status = XDp_TxAuxRead(InstancePtr,
+				XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0,
+				1, &AuxData);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+		if (TimeoutCount > XDP_TX_MAX_SBMSG_REPLY_TIMEOUT_COUNT) {
+			return XST_ERROR_COUNT_MAX;
+		}
+		TimeoutCount++;
+		XDp_WaitUs(InstancePtr, 1000);
+	}
+	while ((AuxData & 0x20) != 0x20);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function will acknowledge an up request by writing an UP_REP to the
+ * RX device directly downstream to the DisplayPort TX.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	RequestId is the request identifier of the up request.
+ * @param	SeqNum is the message sequence number of the up request.
+ *
+ * @return
+ *		- XST_SUCCESS if the reply was written.
+ *		- XST_FAILURE if the AUX write transaction failed.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxSendUpRep(XDp *InstancePtr, u8 RequestId, u8 SeqNum)
+{
+	XDp_SidebandMsg Msg;
+	u8 Data[5];
+
+	Msg.FragmentNum = 0;
+
+	/* Prepare the sideband message header, the reply goes to the immediate
+	 * downstream device so no relative address is needed. */
+	Msg.Header.LinkCountTotal = 1;
+	Msg.Header.LinkCountRemaining = 0;
+	Msg.Header.BroadcastMsg = 0;
+	Msg.Header.PathMsg = 0;
+	Msg.Header.MsgBodyLength = 2;
+	Msg.Header.StartOfMsgTransaction = 1;
+	Msg.Header.EndOfMsgTransaction = 1;
+	Msg.Header.MsgSequenceNum = SeqNum;
+	Msg.Header.MsgHeaderLength = 3;
+	Msg.Header.Crc = XDp_Crc4CalculateHeader(&Msg.Header);
+
+	/* Prepare the sideband message body, an ACK of the request. */
+	Msg.Body.MsgData[0] = RequestId;
+	Msg.Body.MsgDataLength = Msg.Header.MsgBodyLength - 1;
+	Msg.Body.Crc = XDp_Crc8CalculateBody(&Msg);
+
+	Data[0] = (Msg.Header.LinkCountTotal << 4) |
+					Msg.Header.LinkCountRemaining;
+	Data[1] = (Msg.Header.BroadcastMsg << 7) | (Msg.Header.PathMsg << 6) |
+					Msg.Header.MsgBodyLength;
+	Data[2] = (Msg.Header.StartOfMsgTransaction << 7) |
+			(Msg.Header.EndOfMsgTransaction << 6) |
+			(Msg.Header.MsgSequenceNum << 4) | Msg.Header.Crc;
+	Data[3] = Msg.Body.MsgData[0];
+	Data[4] = Msg.Body.Crc;
+
+	return XDp_TxAuxWrite(InstancePtr, XDP_DPCD_UP_REP, 5, Data);
+}
 #endif /* XPAR_XDPTXSS_NUM_INSTANCES */
 
 /******************************************************************************/
@@ -369,6 +369,11 @@ u32 XDpTxSs_CfgInitialize(XDpTxSs *InstancePtr, XDpTxSs_Config *CfgPtr,
 		return XST_FAILURE;
 	}
 
+	/* No Vsync callback and latency tracker yet */
+	InstancePtr->VsyncHandler = NULL;
+	InstancePtr->VsyncRef = NULL;
+	InstancePtr->Latency = NULL;
+
 	/* Set the flag to indicate the subsystem is ready */
 	InstancePtr->IsReady = (u32)XIL_COMPONENT_IS_READY;
 
@@ -102,6 +102,8 @@
 * 6.4  rg  09/01/20 Added handler type as enum for extended packet transmit
 *                   done interrupt.
 * 6.4  rg  09/26/20 Added support for YUV420 color format.
+* 6.10 fl  10/14/26 Added XDpTxSs_SetLatency to mark the Vsync in a video
+*                   latency tracker.
 *
 * </pre>
 *
@@ -120,6 +122,7 @@ extern "C" {
 #include "xil_assert.h"
 #include "xstatus.h"
 #include "xvidc.h"
+#include "xvidc_lat.h"
 #include "xdebug.h"
 
 /* Subsystem sub-cores header files */
@@ -381,6 +384,12 @@ typedef struct {
 	XDpTxSs_HdcpEventQueue HdcpEventQueue; /**< HDCP22 event queue */
 	u8 *Hdcp22Lc128Ptr;			/**< Pointer to HDCP 2.2 LC128*/
 	u8 *Hdcp22SrmPtr;			/**< Pointer to HDCP 2.2 SRM */
+	XDp_IntrHandler VsyncHandler;	/**< User Vsync callback */
+	void *VsyncRef;			/**< To be passed to the Vsync
+					  *  callback */
+	XVidC_Latency *Latency;		/**< Latency tracker, NULL if not
+					  *  used */
+	u8 LatStage;			/**< Pipeline stage of the subsystem */
 } XDpTxSs;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -474,6 +483,7 @@ void XDpTxSs_Hdcp22SetKey(XDpTxSs *InstancePtr,
 void XDpTxSs_DpIntrHandler(void *InstancePtr);
 u32 XDpTxSs_SetCallBack(XDpTxSs *InstancePtr, u32 HandlerType,
 			void *CallbackFunc, void *CallbackRef);
+void XDpTxSs_SetLatency(XDpTxSs *InstancePtr, XVidC_Latency *LatPtr, u8 Stage);
 void XDpTxSs_SetUserTimerHandler(XDpTxSs *InstancePtr,
 		XDpTxSs_TimerHandler CallbackFunc, void *CallbackRef);
 u32 XDpTxSs_CheckVscColorimetrySupport(XDpTxSs *InstancePtr);
@@ -41,6 +41,8 @@
 * 6.4  rg  09/26/20 Added driver handler function XDpTxSs_WriteVscExtPktProcess
 *		    for programming the extended packet up on receiving extended
 *		    packet transmission done interrupt.
+* 6.10 fl  10/14/26 Added XDpTxSs_SetLatency, the Vsync handler marks the
+*                   frame in the latency tracker before the user callback.
 * </pre>
 *
 ******************************************************************************/
@@ -60,6 +62,7 @@
 
 /************************** Function Prototypes ******************************/
 
+static void XDpTxSs_LatVsyncHandler(void *InstancePtr);
 
 /************************** Variable Definitions *****************************/
 
@@ -481,9 +484,14 @@ u32 XDpTxSs_SetCallBack(XDpTxSs *InstancePtr, u32 HandlerType,
 			break;
 
 		case XDPTXSS_HANDLER_DP_VSYNC:
-			XDp_TxSetCallback(InstancePtr->DpPtr,
-					XDP_TX_HANDLER_VSYNC,
-				CallbackFunc, CallbackRef);
+			InstancePtr->VsyncHandler = (XDp_IntrHandler)CallbackFunc;
+			InstancePtr->VsyncRef = CallbackRef;
+			/* With a latency tracker its handler calls the user's */
+			if (InstancePtr->Latency == NULL) {
+				XDp_TxSetCallback(InstancePtr->DpPtr,
+						XDP_TX_HANDLER_VSYNC,
+					CallbackFunc, CallbackRef);
+			}
 			Status = XST_SUCCESS;
 			break;
 
@@ -562,4 +570,68 @@ void XDpTxSs_SetUserTimerHandler(XDpTxSs *InstancePtr,
 	/* Set custom timer wait handler */
 	XDp_SetUserTimerHandler(InstancePtr->DpPtr, CallbackFunc, CallbackRef);
 }
+/*****************************************************************************/
+/**
+*
+* This function attaches a latency tracker to the DisplayPort TX Subsystem.
+* With a tracker attached, every Vsync interrupt of the DisplayPort TX core
+* marks the frame sent out as a stage of the pipeline, the newest frame of
+* the stage before, and then calls the callback of XDPTXSS_HANDLER_DP_VSYNC.
+*
+* @param	InstancePtr is a pointer to the XDpTxSs instance.
+* @param	LatPtr is a pointer to an initialized latency tracker, or NULL
+*		to detach the tracker.
+* @param	Stage is the pipeline stage of the subsystem.
+*
+* @return	None.
+*
+* @note		The Vsync interrupt of the DisplayPort TX core must be
+*		unmasked.
+*
+******************************************************************************/
+void XDpTxSs_SetLatency(XDpTxSs *InstancePtr, XVidC_Latency *LatPtr, u8 Stage)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid((LatPtr == NULL) || (Stage < LatPtr->NumStages));
+
+	InstancePtr->Latency = NULL;
+	InstancePtr->LatStage = Stage;
+	InstancePtr->Latency = LatPtr;
+
+	if (LatPtr != NULL) {
+		XDp_TxSetCallback(InstancePtr->DpPtr, XDP_TX_HANDLER_VSYNC,
+				XDpTxSs_LatVsyncHandler, InstancePtr);
+	} else if (InstancePtr->VsyncHandler != NULL) {
+		XDp_TxSetCallback(InstancePtr->DpPtr, XDP_TX_HANDLER_VSYNC,
+				InstancePtr->VsyncHandler, InstancePtr->VsyncRef);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the Vsync handler of the DisplayPort TX core while a
+* latency tracker is attached. It marks the frame and calls the user Vsync
+* callback, if any.
+*
+* @param	InstancePtr is a pointer to the XDpTxSs instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XDpTxSs_LatVsyncHandler(void *InstancePtr)
+{
+	XDpTxSs *XDpTxSsPtr = (XDpTxSs *)InstancePtr;
+
+	if (XDpTxSsPtr->Latency != NULL) {
+		(void)XVidC_LatMark(XDpTxSsPtr->Latency, XDpTxSsPtr->LatStage);
+	}
+	if (XDpTxSsPtr->VsyncHandler != NULL) {
+		XDpTxSsPtr->VsyncHandler(XDpTxSsPtr->VsyncRef);
+	}
+}
 /** @} */
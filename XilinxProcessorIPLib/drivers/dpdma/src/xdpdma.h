@@ -21,6 +21,7 @@
  * Ver	Who   Date     Changes
  * ---- ----- -------- ----------------------------------------------------
  * 1.0  aad   04/12/16 Initial release.
+ * 1.6  fl    10/14/26 Add flip queue with pre-built descriptors.
  * </pre>
  *
  *****************************************************************************/
@@ -48,6 +49,10 @@ extern "C" {
 #define XDPDMA_DESCRIPTOR_ALIGN 256U
 /* DPDMA preamble field */
 #define XDPDMA_DESCRIPTOR_PREAMBLE 0xA5
+/* Frame buffers per flip queue */
+#define XDPDMA_FLIP_MAX_BUFS 4U
+/* No frame buffer */
+#define XDPDMA_FLIP_NONE 0xFFU
 /**************************** Type Definitions ********************************/
 
 /**
@@ -164,6 +169,57 @@ typedef struct {
 	XDpDma_Descriptor *Current;
 } XDpDma_Channel;
 
+/**
+ * Time stamp source of a flip queue, called from the VSync interrupt.
+ */
+typedef u64 (*XDpDma_FlipTimeFunc)(void);
+
+/**
+ * This typedef contains the flip latency statistics, from
+ * XDpDma_FlipQueueSubmit() to the VSync at which the frame buffer is
+ * scanned out, in units of the time stamp source.
+ */
+typedef struct {
+	u32 Flips;			/**< Frame buffers scanned out */
+	u32 Replaced;			/**< Flips replaced before VSync */
+	u64 LatencyMin;			/**< Shortest latency */
+	u64 LatencyMax;			/**< Longest latency */
+	u64 LatencyLast;		/**< Latency of the last flip */
+	u64 LatencyTotal;		/**< Sum of all latencies */
+} XDpDma_FlipStats;
+
+/**
+ * This typedef defines the descriptors of a frame buffer of a flip queue,
+ * one per plane.
+ */
+typedef struct {
+	XDpDma_Descriptor Plane0;
+	XDpDma_Descriptor Plane1;
+	XDpDma_Descriptor Plane2;
+} XDpDma_FlipDescriptors;
+
+/**
+ * This typedef defines a flip queue. The user allocates it, the descriptors
+ * of every registered frame buffer are built once by XDpDma_FlipQueueInit()
+ * and a flip only programs the descriptor address and retriggers the
+ * channel on the next VSync.
+ */
+typedef struct {
+	XDpDma_FlipDescriptors Desc[XDPDMA_FLIP_MAX_BUFS]; /**< Descriptors of
+							    every buffer */
+	XDpDma_ChannelType Channel;	/**< VideoChan or GraphicsChan */
+	u8 NumBufs;			/**< Registered frame buffers */
+	u8 NumPlanes;			/**< Planes per frame buffer */
+	u8 Started;			/**< Channel has been triggered */
+	volatile u8 Pending;		/**< Buffer to show on the next VSync */
+	u8 Queued;			/**< Buffer fetched from the next frame */
+	volatile u8 Displayed;		/**< Buffer on scan-out */
+	u64 RequestTime[XDPDMA_FLIP_MAX_BUFS]; /**< Flip request times */
+	u64 QueuedTime;			/**< Request time of Queued */
+	XDpDma_FlipTimeFunc GetTime;	/**< Time stamp source, optional */
+	XDpDma_FlipStats Stats;		/**< Latency statistics */
+} XDpDma_FlipQueue;
+
 /**
  * This typedef defines the Video Channel attributes.
  */
@@ -173,6 +229,7 @@ typedef struct {
 	u8 AVBufEn;
 	XAVBuf_VideoAttribute *VideoInfo;
 	XDpDma_FrameBuffer *FrameBuffer[3];
+	XDpDma_FlipQueue *FlipQueue;
 } XDpDma_VideoChannel;
 
 /**
@@ -184,6 +241,7 @@ typedef struct {
 	u8 AVBufEn;
 	XAVBuf_VideoAttribute *VideoInfo;
 	XDpDma_FrameBuffer *FrameBuffer;
+	XDpDma_FlipQueue *FlipQueue;
 } XDpDma_GfxChannel;
 
 /**
@@ -269,6 +327,19 @@ void XDpDma_InitAudioDescriptor(XDpDma_AudioChannel *Channel,
 int XDpDma_PlayAudio(XDpDma *InstancePtr, XDpDma_AudioBuffer *Buffer,
 		      u8 ChannelNum);
 
+/* Flip queue functions in xdpdma_flip.c */
+int XDpDma_FlipQueueInit(XDpDma *InstancePtr, XDpDma_FlipQueue *QueuePtr,
+			 XDpDma_ChannelType Channel,
+			 XDpDma_FrameBuffer *Bufs, u8 NumBufs);
+void XDpDma_FlipQueueRelease(XDpDma *InstancePtr, XDpDma_ChannelType Channel);
+void XDpDma_FlipQueueSetTimeFunc(XDpDma_FlipQueue *QueuePtr,
+				 XDpDma_FlipTimeFunc GetTime);
+int XDpDma_FlipQueueSubmit(XDpDma_FlipQueue *QueuePtr, u8 Idx);
+u8 XDpDma_FlipQueueGetDisplayed(XDpDma_FlipQueue *QueuePtr);
+void XDpDma_FlipQueueResetStats(XDpDma_FlipQueue *QueuePtr);
+void XDpDma_FlipQueueVSyncHandler(XDpDma *InstancePtr,
+				  XDpDma_FlipQueue *QueuePtr);
+
 /*************************** Variable Declarations ****************************/
 
 /**
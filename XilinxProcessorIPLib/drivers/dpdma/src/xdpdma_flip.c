@@ -0,0 +1,373 @@
+/*******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xdpdma_flip.c
+ *
+ * This file contains the flip queue of the Video and Graphics channels. The
+ * descriptors of a pool of frame buffers are built and flushed once when the
+ * queue is initialized. A flip only selects one of them, the VSync handler
+ * programs its address and retriggers the channel.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 1.6   fl   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+#include <string.h>
+#include "xdpdma.h"
+#include "xil_cache.h"
+
+/************************** Constant Definitions ******************************/
+#define XDPDMA_FLIP_CH_OFFSET		0x100U
+#define XDPDMA_FLIP_GRAPHICS_CHANNEL	3U
+
+/*************************************************************************/
+/**
+ *
+ * This function returns the descriptor of a plane of a frame buffer.
+ *
+ * @param    QueuePtr is a pointer to the flip queue.
+ * @param    Idx is the frame buffer index.
+ * @param    Plane is the plane number.
+ *
+ * @return   Pointer to the descriptor.
+ *
+ * @note     None.
+ *
+ * **************************************************************************/
+static XDpDma_Descriptor *XDpDma_FlipQueueDesc(XDpDma_FlipQueue *QueuePtr,
+					       u8 Idx, u8 Plane)
+{
+	XDpDma_Descriptor *Desc;
+
+	switch(Plane) {
+	case 1U:
+		Desc = &QueuePtr->Desc[Idx].Plane1;
+		break;
+	case 2U:
+		Desc = &QueuePtr->Desc[Idx].Plane2;
+		break;
+	default:
+		Desc = &QueuePtr->Desc[Idx].Plane0;
+		break;
+	}
+
+	return Desc;
+}
+
+/*************************************************************************/
+/**
+ *
+ * This function programs the descriptors of a frame buffer as the start
+ * descriptors of the channel.
+ *
+ * @param    InstancePtr is a pointer to the DPDMA instance.
+ * @param    QueuePtr is a pointer to the flip queue.
+ * @param    Idx is the frame buffer index.
+ *
+ * @return   None.
+ *
+ * @note     None.
+ *
+ * **************************************************************************/
+static void XDpDma_FlipQueueSetAddress(XDpDma *InstancePtr,
+				       XDpDma_FlipQueue *QueuePtr, u8 Idx)
+{
+	u32 ChannelNum;
+	u64 DescAddr;
+	u8 Plane;
+
+	for(Plane = 0; Plane < QueuePtr->NumPlanes; Plane++) {
+		ChannelNum = (QueuePtr->Channel == GraphicsChan) ?
+			     XDPDMA_FLIP_GRAPHICS_CHANNEL : (u32)Plane;
+		DescAddr = (UINTPTR)XDpDma_FlipQueueDesc(QueuePtr, Idx, Plane);
+		XDpDma_WriteReg(InstancePtr->Config.BaseAddr,
+				XDPDMA_CH0_DSCR_STRT_ADDRE +
+				(XDPDMA_FLIP_CH_OFFSET * ChannelNum),
+				UPPER_32_BITS(DescAddr));
+		XDpDma_WriteReg(InstancePtr->Config.BaseAddr,
+				XDPDMA_CH0_DSCR_STRT_ADDR +
+				(XDPDMA_FLIP_CH_OFFSET * ChannelNum),
+				LOWER_32_BITS(DescAddr));
+	}
+}
+
+/*************************************************************************/
+/**
+ *
+ * This function initializes a flip queue and attaches it to a channel.
+ *
+ * @param    InstancePtr is a pointer to the DPDMA instance.
+ * @param    QueuePtr is a pointer to the flip queue.
+ * @param    Channel is VideoChan or GraphicsChan.
+ * @param    Bufs is an array of NumBufs frame buffers with one entry per
+ *	     plane, Bufs[Idx * NumPlanes + Plane], where NumPlanes follows
+ *	     the format set with XDpDma_SetVideoFormat() or
+ *	     XDpDma_SetGraphicsFormat().
+ * @param    NumBufs is the number of frame buffers, up to
+ *	     XDPDMA_FLIP_MAX_BUFS.
+ *
+ * @return   XST_SUCCESS if the queue was initialized.
+ *	     XST_INVALID_PARAM if NumBufs is out of range.
+ *	     XST_FAILURE if the format of the channel is not set.
+ *
+ * @note     The channel is triggered on the VSync after the first
+ *	     XDpDma_FlipQueueSubmit(). Do not use
+ *	     XDpDma_DisplayVideoFrameBuffer() or XDpDma_DisplayGfxFrameBuffer()
+ *	     on a channel with a flip queue.
+ *
+ * **************************************************************************/
+int XDpDma_FlipQueueInit(XDpDma *InstancePtr, XDpDma_FlipQueue *QueuePtr,
+			 XDpDma_ChannelType Channel,
+			 XDpDma_FrameBuffer *Bufs, u8 NumBufs)
+{
+	XAVBuf_VideoAttribute *VideoInfo;
+	u8 Idx, Plane, NumPlanes;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid((Channel == VideoChan) || (Channel == GraphicsChan));
+	Xil_AssertNonvoid(Bufs != NULL);
+
+	if((NumBufs == 0U) || (NumBufs > XDPDMA_FLIP_MAX_BUFS)) {
+		return (int)XST_INVALID_PARAM;
+	}
+
+	if(Channel == VideoChan) {
+		VideoInfo = InstancePtr->Video.VideoInfo;
+		if(VideoInfo == NULL) {
+			return (int)XST_FAILURE;
+		}
+		NumPlanes = (u8)VideoInfo->Mode + 1U;
+	}
+	else {
+		if(InstancePtr->Gfx.VideoInfo == NULL) {
+			return (int)XST_FAILURE;
+		}
+		NumPlanes = 1U;
+	}
+
+	(void)memset(QueuePtr, 0, sizeof(XDpDma_FlipQueue));
+	QueuePtr->Channel = Channel;
+	QueuePtr->NumBufs = NumBufs;
+	QueuePtr->NumPlanes = NumPlanes;
+	QueuePtr->Pending = XDPDMA_FLIP_NONE;
+	QueuePtr->Queued = XDPDMA_FLIP_NONE;
+	QueuePtr->Displayed = XDPDMA_FLIP_NONE;
+
+	/* Every descriptor links to itself, the frame repeats until a flip */
+	for(Idx = 0; Idx < NumBufs; Idx++) {
+		for(Plane = 0; Plane < NumPlanes; Plane++) {
+			XDpDma_InitVideoDescriptor(
+				XDpDma_FlipQueueDesc(QueuePtr, Idx, Plane),
+				&Bufs[(Idx * NumPlanes) + Plane]);
+		}
+	}
+	Xil_DCacheFlushRange((UINTPTR)QueuePtr->Desc, sizeof(QueuePtr->Desc));
+
+	if(Channel == VideoChan) {
+		InstancePtr->Video.FlipQueue = QueuePtr;
+	}
+	else {
+		InstancePtr->Gfx.FlipQueue = QueuePtr;
+	}
+
+	return (int)XST_SUCCESS;
+}
+
+/*************************************************************************/
+/**
+ *
+ * This function detaches the flip queue of a channel.
+ *
+ * @param    InstancePtr is a pointer to the DPDMA instance.
+ * @param    Channel is VideoChan or GraphicsChan.
+ *
+ * @return   None.
+ *
+ * @note     The channel keeps scanning out the last frame buffer.
+ *
+ * **************************************************************************/
+void XDpDma_FlipQueueRelease(XDpDma *InstancePtr, XDpDma_ChannelType Channel)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid((Channel == VideoChan) || (Channel == GraphicsChan));
+
+	if(Channel == VideoChan) {
+		InstancePtr->Video.FlipQueue = NULL;
+	}
+	else {
+		InstancePtr->Gfx.FlipQueue = NULL;
+	}
+}
+
+/*************************************************************************/
+/**
+ *
+ * This function sets the source of the flip time stamps.
+ *
+ * @param    QueuePtr is a pointer to the flip queue.
+ * @param    GetTime is called on flip requests and from the VSync
+ *	     interrupt, or NULL to disable the latency statistics.
+ *
+ * @return   None.
+ *
+ * @note     None.
+ *
+ * **************************************************************************/
+void XDpDma_FlipQueueSetTimeFunc(XDpDma_FlipQueue *QueuePtr,
+				 XDpDma_FlipTimeFunc GetTime)
+{
+	Xil_AssertVoid(QueuePtr != NULL);
+
+	QueuePtr->GetTime = GetTime;
+}
+
+/*************************************************************************/
+/**
+ *
+ * This function requests a flip to a registered frame buffer on the next
+ * VSync.
+ *
+ * @param    QueuePtr is a pointer to the flip queue.
+ * @param    Idx is the frame buffer index.
+ *
+ * @return   XST_SUCCESS if the flip was queued.
+ *	     XST_INVALID_PARAM if Idx is not a registered frame buffer.
+ *
+ * @note     A flip not yet served by the VSync handler is replaced and
+ *	     counted in Stats.Replaced. The buffer returned by
+ *	     XDpDma_FlipQueueGetDisplayed() must not be written.
+ *
+ * **************************************************************************/
+int XDpDma_FlipQueueSubmit(XDpDma_FlipQueue *QueuePtr, u8 Idx)
+{
+	u8 Prev;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	if(Idx >= QueuePtr->NumBufs) {
+		return (int)XST_INVALID_PARAM;
+	}
+
+	QueuePtr->RequestTime[Idx] = (QueuePtr->GetTime != NULL) ?
+				     QueuePtr->GetTime() : 0U;
+	Prev = __atomic_exchange_n(&QueuePtr->Pending, Idx, __ATOMIC_RELEASE);
+	if(Prev != XDPDMA_FLIP_NONE) {
+		QueuePtr->Stats.Replaced++;
+	}
+
+	return (int)XST_SUCCESS;
+}
+
+/*************************************************************************/
+/**
+ *
+ * This function returns the frame buffer being scanned out.
+ *
+ * @param    QueuePtr is a pointer to the flip queue.
+ *
+ * @return   Frame buffer index, or XDPDMA_FLIP_NONE before the first flip.
+ *
+ * @note     None.
+ *
+ * **************************************************************************/
+u8 XDpDma_FlipQueueGetDisplayed(XDpDma_FlipQueue *QueuePtr)
+{
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	return QueuePtr->Displayed;
+}
+
+/*************************************************************************/
+/**
+ *
+ * This function clears the latency statistics of a flip queue.
+ *
+ * @param    QueuePtr is a pointer to the flip queue.
+ *
+ * @return   None.
+ *
+ * @note     None.
+ *
+ * **************************************************************************/
+void XDpDma_FlipQueueResetStats(XDpDma_FlipQueue *QueuePtr)
+{
+	Xil_AssertVoid(QueuePtr != NULL);
+
+	(void)memset(&QueuePtr->Stats, 0, sizeof(XDpDma_FlipStats));
+}
+
+/*************************************************************************/
+/**
+ *
+ * This function serves a flip queue on VSync. The buffer retriggered on the
+ * previous VSync is now scanned out, the pending buffer is retriggered for
+ * the next frame.
+ *
+ * @param    InstancePtr is a pointer to the DPDMA instance.
+ * @param    QueuePtr is a pointer to the flip queue.
+ *
+ * @return   None.
+ *
+ * @note     Called by XDpDma_VSyncHandler().
+ *
+ * **************************************************************************/
+void XDpDma_FlipQueueVSyncHandler(XDpDma *InstancePtr,
+				  XDpDma_FlipQueue *QueuePtr)
+{
+	XDpDma_FlipStats *Stats = &QueuePtr->Stats;
+	u64 Latency;
+	u8 Idx;
+
+	if(QueuePtr->Queued != XDPDMA_FLIP_NONE) {
+		QueuePtr->Displayed = QueuePtr->Queued;
+		QueuePtr->Queued = XDPDMA_FLIP_NONE;
+		if(QueuePtr->GetTime != NULL) {
+			Latency = QueuePtr->GetTime() - QueuePtr->QueuedTime;
+			if((Stats->Flips == 0U) ||
+			   (Latency < Stats->LatencyMin)) {
+				Stats->LatencyMin = Latency;
+			}
+			if(Latency > Stats->LatencyMax) {
+				Stats->LatencyMax = Latency;
+			}
+			Stats->LatencyLast = Latency;
+			Stats->LatencyTotal += Latency;
+		}
+		Stats->Flips++;
+	}
+
+	Idx = __atomic_exchange_n(&QueuePtr->Pending, XDPDMA_FLIP_NONE,
+				  __ATOMIC_ACQUIRE);
+	if(Idx == XDPDMA_FLIP_NONE) {
+		return;
+	}
+
+	XDpDma_FlipQueueSetAddress(InstancePtr, QueuePtr, Idx);
+	if(QueuePtr->Started == 0U) {
+		(void)XDpDma_SetChannelState(InstancePtr, QueuePtr->Channel,
+					     XDPDMA_ENABLE);
+		(void)XDpDma_Trigger(InstancePtr, QueuePtr->Channel);
+		QueuePtr->Started = 1U;
+	}
+	else {
+		(void)XDpDma_ReTrigger(InstancePtr, QueuePtr->Channel);
+	}
+	QueuePtr->Queued = Idx;
+	QueuePtr->QueuedTime = QueuePtr->RequestTime[Idx];
+}
@@ -18,6 +18,7 @@
  * Ver   Who  Date     Changes
  * ----- ---- -------- -----------------------------------------------
  * 1.0   aad  01/17/17 Initial release.
+ * 1.6   fl   10/14/26 Serve flip queues on VSync.
  * </pre>
  *
 *******************************************************************************/
@@ -97,6 +98,16 @@ void XDpDma_VSyncHandler(XDpDma *InstancePtr)
 {
 	Xil_AssertVoid(InstancePtr != NULL);
 
+	/* Flip queues, the descriptors are already built */
+	if(InstancePtr->Video.FlipQueue != NULL) {
+		XDpDma_FlipQueueVSyncHandler(InstancePtr,
+					     InstancePtr->Video.FlipQueue);
+	}
+	if(InstancePtr->Gfx.FlipQueue != NULL) {
+		XDpDma_FlipQueueVSyncHandler(InstancePtr,
+					     InstancePtr->Gfx.FlipQueue);
+	}
+
 	/* Video Channel Trigger/Retrigger Handler */
 	if(InstancePtr->Video.TriggerStatus == XDPDMA_TRIGGER_EN) {
 		XDpDma_SetupChannel(InstancePtr, VideoChan);
@@ -33,6 +33,8 @@
 * 3.8  mus  11/05/18 Support 64 bit DMA addresses for Microblaze-X platform.
 * 3.10 hk   05/16/19 Clear status registers properly in reset
 * 3.11 sd   02/14/20 Add clock support
+* 3.19 fl   10/14/26 Detect the priority queues, set the RX and TX pointers
+*                    of any queue and enable the queue interrupts.
 *
 * </pre>
 ******************************************************************************/
@@ -111,6 +113,9 @@ LONG XEmacPs_CfgInitialize(XEmacPs *InstancePtr, XEmacPs_Config * CfgPtr,
 	InstancePtr->RecvHandler = ((XEmacPs_Handler)(void*)XEmacPs_StubHandler);
 	InstancePtr->ErrorHandler = ((XEmacPs_ErrHandler)(void*)XEmacPs_StubHandler);
 
+	/* Detected by the reset */
+	InstancePtr->NumQueues = 1U;
+
 	/* Reset the hardware and set default options */
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 	XEmacPs_Reset(InstancePtr);
@@ -149,6 +154,7 @@ LONG XEmacPs_CfgInitialize(XEmacPs *InstancePtr, XEmacPs_Config * CfgPtr,
 void XEmacPs_Start(XEmacPs *InstancePtr)
 {
 	u32 Reg;
+	u8 Queue;
 
 	/* Assert bad arguments and conditions */
 	Xil_AssertVoid(InstancePtr != NULL);
@@ -211,6 +217,11 @@ void XEmacPs_Start(XEmacPs *InstancePtr)
 	if (InstancePtr->Version > 2)
 		XEmacPs_IntQ1Enable(InstancePtr, XEMACPS_INTQ1_IXR_ALL_MASK);
 
+	/* Enable TX and RX interrupts of the priority queues */
+	for (Queue = 1U; Queue < InstancePtr->NumQueues; Queue++) {
+		XEmacPs_IntQEnable(InstancePtr, Queue, XEMACPS_INTQ_IXR_ALL_MASK);
+	}
+
 	/* Mark as started */
 	InstancePtr->IsStarted = XIL_COMPONENT_IS_STARTED;
 
@@ -246,6 +257,7 @@ void XEmacPs_Start(XEmacPs *InstancePtr)
 void XEmacPs_Stop(XEmacPs *InstancePtr)
 {
 	u32 Reg;
+	u8 Queue;
 
 	Xil_AssertVoid(InstancePtr != NULL);
 	Xil_AssertVoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
@@ -253,6 +265,9 @@ void XEmacPs_Stop(XEmacPs *InstancePtr)
 	/* Disable all interrupts */
 	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress, XEMACPS_IDR_OFFSET,
 			   XEMACPS_IXR_ALL_MASK);
+	for (Queue = 1U; Queue < InstancePtr->NumQueues; Queue++) {
+		XEmacPs_IntQDisable(InstancePtr, Queue, XEMACPS_INTQ_IXR_ALL_MASK);
+	}
 
 	/* Disable the receiver & transmitter */
 	Reg = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
@@ -319,6 +334,17 @@ void XEmacPs_Reset(XEmacPs *InstancePtr)
 
 	InstancePtr->Version = (InstancePtr->Version >> 16) & 0xFFF;
 
+	/* Priority queues present are flagged from bit 1 on */
+	InstancePtr->NumQueues = 1U;
+	if (InstancePtr->Version > 2) {
+		Reg = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+					XEMACPS_DCFG6_OFFSET);
+		while ((InstancePtr->NumQueues < XEMACPS_MAX_QUEUES) &&
+		       ((Reg & ((u32)1U << InstancePtr->NumQueues)) != 0U)) {
+			InstancePtr->NumQueues++;
+		}
+	}
+
 	InstancePtr->MaxMtuSize = XEMACPS_MTU;
 	InstancePtr->MaxFrameSize = XEMACPS_MTU + XEMACPS_HDR_SIZE +
 					XEMACPS_TRL_SIZE;
@@ -448,6 +474,12 @@ void XEmacPs_StubHandler(void)
 * The buffer queue addresses has to be set before starting the transfer, so
 * this function has to be called in prior to XEmacPs_Start()
 *
+* A receive queue other than 0 takes the receive buffer size of queue 0, so
+* this function has to be called after the buffer size is set.
+*
+* The upper 32 bits of the address are shared by all the transmit queues,
+* and by all the receive queues.
+*
 ******************************************************************************/
 void XEmacPs_SetQueuePtr(XEmacPs *InstancePtr, UINTPTR QPtr, u8 QueueNum,
 			 u16 Direction)
@@ -472,10 +504,22 @@ void XEmacPs_SetQueuePtr(XEmacPs *InstancePtr, UINTPTR QPtr, u8 QueueNum,
 				(QPtr & ULONG64_LO_MASK));
 		}
 	}
-	 else {
+	else if (Direction == XEMACPS_SEND) {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			XEMACPS_QUEUE_OFFSET(XEMACPS_TXQ1BASE_OFFSET, QueueNum),
+			(QPtr & ULONG64_LO_MASK));
+	} else {
 		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
-			XEMACPS_TXQ1BASE_OFFSET,
+			XEMACPS_QUEUE_OFFSET(XEMACPS_RXQ1BASE_OFFSET, QueueNum),
 			(QPtr & ULONG64_LO_MASK));
+
+		/* Same unit as the DMACR field */
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			XEMACPS_QUEUE_OFFSET(XEMACPS_RXBUFQ1SIZE_OFFSET, QueueNum),
+			((XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+				XEMACPS_DMACR_OFFSET) &
+				(u32)XEMACPS_DMACR_RXBUF_MASK) >>
+				(u32)XEMACPS_DMACR_RXBUF_SHIFT));
 	}
 #ifdef __aarch64__
 	if (Direction == XEMACPS_SEND) {
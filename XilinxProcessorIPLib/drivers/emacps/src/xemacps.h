@@ -213,6 +213,20 @@
  * If any of the checksums are verified incorrect by the hardware, the packet
  * is discarded and the appropriate statistics counter incremented.
  *
+ * <b>Priority Queues</b>
+ *
+ * Except on Zynq, the GEM can have priority queues in addition to queue 0.
+ * XEmacPs_GetNumQueues() returns the number of queues of the hardware. Each
+ * queue has its own transmit and receive BD list, set with
+ * XEmacPs_SetQueuePtr(). The BD rings of the instance are the lists of queue
+ * 0, the upper layer creates the rings of the other queues. On transmit, the
+ * queue with the highest number is served first. On receive, frames are
+ * steered to a queue by the type 1 screeners (IP DS/TC byte, UDP port) and
+ * the type 2 screeners (VLAN priority, EtherType), set with
+ * XEmacPs_SetType1Screen() and XEmacPs_SetType2Screen(). Frames matching no
+ * screener are received in queue 0. Completions on any queue invoke the
+ * send and receive callbacks of the instance.
+ *
  * <b>PHY Interfaces</b>
  *
  * RGMII 1.3 is the only interface supported.
@@ -310,6 +324,9 @@
  * 3.9   hk   01/23/19 Add RX watermark support
  * 3.11  sd   02/14/20 Add clock support
  * 3.13  nsk  12/14/20 Updated the tcl to not to use the instance names.
+ * 3.19  fl   10/14/26 Add priority queue and RX screener support.
+ * 3.19  fl   10/14/26 Add timestamping through extended buffer descriptors.
+ * 3.19  fl   10/14/26 Add XEmacPs_SetRxBufSize().
  *
  * </pre>
  *
@@ -559,6 +576,7 @@ typedef struct XEmacPs_Instance {
 	u32 MaxMtuSize;
 	u32 MaxFrameSize;
 	u32 MaxVlanFrameSize;
+	u32 NumQueues;		/* Number of priority queues, including 0 */
 
 } XEmacPs;
 
@@ -681,6 +699,65 @@ typedef struct XEmacPs_Instance {
 			 XEMACPS_INTQ1_IDR_OFFSET,                               \
 			 ((Mask) & XEMACPS_INTQ1_IXR_ALL_MASK));
 
+/****************************************************************************/
+/**
+*
+* Enable the interrupts specified in <i>Mask</i> of priority queue
+* <i>Queue</i>.
+*
+* @param InstancePtr is a pointer to the instance to be worked on.
+* @param Queue is the priority queue, from 1 to XEmacPs_GetNumQueues() - 1.
+* @param Mask contains a bit mask of interrupts to enable, formed from the
+*        XEMACPS_INTQ1SR_*_MASK values.
+*
+* @note
+* C-style signature
+*     void XEmacPs_IntQEnable(XEmacPs *InstancePtr, u8 Queue, u32 Mask)
+*
+*****************************************************************************/
+#define XEmacPs_IntQEnable(InstancePtr, Queue, Mask)                      \
+	XEmacPs_WriteReg((InstancePtr)->Config.BaseAddress,             \
+			 XEMACPS_QUEUE_OFFSET(XEMACPS_INTQ1_IER_OFFSET, (Queue)), \
+			 ((Mask) & XEMACPS_INTQ_IXR_ALL_MASK));
+
+/****************************************************************************/
+/**
+*
+* Disable the interrupts specified in <i>Mask</i> of priority queue
+* <i>Queue</i>.
+*
+* @param InstancePtr is a pointer to the instance to be worked on.
+* @param Queue is the priority queue, from 1 to XEmacPs_GetNumQueues() - 1.
+* @param Mask contains a bit mask of interrupts to disable, formed from the
+*        XEMACPS_INTQ1SR_*_MASK values.
+*
+* @note
+* C-style signature
+*     void XEmacPs_IntQDisable(XEmacPs *InstancePtr, u8 Queue, u32 Mask)
+*
+*****************************************************************************/
+#define XEmacPs_IntQDisable(InstancePtr, Queue, Mask)                     \
+	XEmacPs_WriteReg((InstancePtr)->Config.BaseAddress,             \
+			 XEMACPS_QUEUE_OFFSET(XEMACPS_INTQ1_IDR_OFFSET, (Queue)), \
+			 ((Mask) & XEMACPS_INTQ_IXR_ALL_MASK));
+
+/****************************************************************************/
+/**
+*
+* Retrieve the number of priority queues of the hardware, including queue 0.
+* It is 1 when the hardware has no priority queues.
+*
+* @param InstancePtr is a pointer to the instance to be worked on.
+*
+* @return Number of queues
+*
+* @note
+* C-style signature
+*     u32 XEmacPs_GetNumQueues(XEmacPs *InstancePtr)
+*
+*****************************************************************************/
+#define XEmacPs_GetNumQueues(InstancePtr) ((InstancePtr)->NumQueues)
+
 /****************************************************************************/
 /**
 *
@@ -845,6 +922,11 @@ LONG XEmacPs_PhyRead(XEmacPs *InstancePtr, u32 PhyAddress,
 LONG XEmacPs_PhyWrite(XEmacPs *InstancePtr, u32 PhyAddress,
 		      u32 RegisterNum, u16 PhyData);
 LONG XEmacPs_SetTypeIdCheck(XEmacPs *InstancePtr, u32 Id_Check, u8 Index);
+LONG XEmacPs_SetType1Screen(XEmacPs *InstancePtr, u32 Screen, u8 Index);
+LONG XEmacPs_SetType2Screen(XEmacPs *InstancePtr, u32 Screen, u8 Index);
+LONG XEmacPs_SetType2EtherType(XEmacPs *InstancePtr, u16 EtherType, u8 Index);
+LONG XEmacPs_SetBdTsMode(XEmacPs *InstancePtr, u32 TxMode, u32 RxMode);
+LONG XEmacPs_SetRxBufSize(XEmacPs *InstancePtr, u32 BufSize);
 
 LONG XEmacPs_SendPausePacket(XEmacPs *InstancePtr);
 void XEmacPs_DMABLengthUpdate(XEmacPs *InstancePtr, s32 BLength);
@@ -46,6 +46,7 @@
  * 3.2   hk   11/18/15 Change BD typedef and number of words.
  * 3.8   hk   08/18/18 Remove duplicate definition of XEmacPs_BdSetLength
  * 3.8   mus  11/05/18 Support 64 bit DMA addresses for Microblaze-X platform.
+ * 3.19  fl   10/14/26 Add timestamp access macros for extended BDs.
  *
  * </pre>
  *
@@ -83,6 +84,11 @@ extern "C" {
  */
 typedef u32 XEmacPs_Bd[XEMACPS_BD_NUM_WORDS];
 
+/* Extra words of an extended (timestamp) BD, see XEmacPs_BdRingCreateExt() */
+#define XEMACPS_BD_TS_NUM_WORDS 2U
+#define XEMACPS_BD_TS_OFFSET    ((u32)sizeof(XEmacPs_Bd)) /**< timestamp
+								word 0 */
+
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -753,6 +759,84 @@ typedef u32 XEmacPs_Bd[XEMACPS_BD_NUM_WORDS];
     XEMACPS_RXBUF_SOF_MASK)!=0U ? TRUE : FALSE)
 
 
+/*****************************************************************************/
+/**
+ * Determine whether the hardware stored a timestamp in the extended receive
+ * BD.
+ *
+ * @param  BdPtr is the BD pointer to operate on
+ *
+ * @return TRUE if the BD holds a timestamp, FALSE otherwise
+ *
+ * @note
+ * C-style signature:
+ *    u32 XEmacPs_BdIsRxTsValid(XEmacPs_Bd* BdPtr)
+ *
+ *****************************************************************************/
+#define XEmacPs_BdIsRxTsValid(BdPtr)                               \
+    ((XEmacPs_BdRead((BdPtr), XEMACPS_BD_ADDR_OFFSET) &           \
+    XEMACPS_RXBUF_TS_VALID_MASK)!=0U ? TRUE : FALSE)
+
+
+/*****************************************************************************/
+/**
+ * Determine whether the hardware stored a timestamp in the extended transmit
+ * BD. Only the first BD of a frame holds the timestamp.
+ *
+ * @param  BdPtr is the BD pointer to operate on
+ *
+ * @return TRUE if the BD holds a timestamp, FALSE otherwise
+ *
+ * @note
+ * C-style signature:
+ *    u32 XEmacPs_BdIsTxTsValid(XEmacPs_Bd* BdPtr)
+ *
+ *****************************************************************************/
+#define XEmacPs_BdIsTxTsValid(BdPtr)                               \
+    ((XEmacPs_BdRead((BdPtr), XEMACPS_BD_STAT_OFFSET) &           \
+    XEMACPS_TXBUF_TS_VALID_MASK)!=0U ? TRUE : FALSE)
+
+
+/*****************************************************************************/
+/**
+ * Get the nanoseconds of the timestamp in an extended BD.
+ *
+ * @param  BdPtr is the BD pointer to operate on
+ *
+ * @return Nanoseconds of the timestamp
+ *
+ * @note
+ * C-style signature:
+ *    u32 XEmacPs_BdGetTsNanoSec(XEmacPs_Bd* BdPtr)
+ *
+ *****************************************************************************/
+#define XEmacPs_BdGetTsNanoSec(BdPtr)                              \
+    (XEmacPs_BdRead((BdPtr), XEMACPS_BD_TS_OFFSET) &              \
+    XEMACPS_BD_TS_NSEC_MASK)
+
+
+/*****************************************************************************/
+/**
+ * Get the seconds of the timestamp in an extended BD. The BD holds only the
+ * XEMACPS_BD_TS_SEC_MASK low bits of the seconds, the upper bits must be
+ * taken from the 1588 timer.
+ *
+ * @param  BdPtr is the BD pointer to operate on
+ *
+ * @return Low bits of the seconds of the timestamp
+ *
+ * @note
+ * C-style signature:
+ *    u32 XEmacPs_BdGetTsSec(XEmacPs_Bd* BdPtr)
+ *
+ *****************************************************************************/
+#define XEmacPs_BdGetTsSec(BdPtr)                                  \
+    (((XEmacPs_BdRead((BdPtr), (XEMACPS_BD_TS_OFFSET + 4U)) &     \
+    XEMACPS_BD_TS_SECH_MASK) << XEMACPS_BD_TS_SECH_SHIFT) |        \
+    (XEmacPs_BdRead((BdPtr), XEMACPS_BD_TS_OFFSET) >>              \
+    XEMACPS_BD_TS_SECL_SHIFT))
+
+
 /************************** Function Prototypes ******************************/
 
 #ifdef __cplusplus
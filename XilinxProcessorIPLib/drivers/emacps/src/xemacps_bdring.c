@@ -34,6 +34,8 @@
 * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.6   rb   09/08/17 Add XEmacPs_BdRingPtrReset() API to reset BD ring
 * 		      pointers
+* 3.19  fl   10/14/26 Add XEmacPs_BdRingCreateExt() for rings of extended
+*		      (timestamp) BDs.
 *
 * </pre>
 ******************************************************************************/
@@ -138,6 +140,9 @@
 
 static void XEmacPs_BdSetRxWrap(UINTPTR BdPtr);
 static void XEmacPs_BdSetTxWrap(UINTPTR BdPtr);
+static LONG XEmacPs_BdRingCreateSep(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
+				    UINTPTR VirtAddr, u32 Alignment,
+				    u32 BdCount, u32 Separation);
 
 /************************** Variable Definitions *****************************/
 
@@ -176,6 +181,44 @@ static void XEmacPs_BdSetTxWrap(UINTPTR BdPtr);
  *****************************************************************************/
 LONG XEmacPs_BdRingCreate(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
 			  UINTPTR VirtAddr, u32 Alignment, u32 BdCount)
+{
+	return XEmacPs_BdRingCreateSep(RingPtr, PhysAddr, VirtAddr, Alignment,
+				       BdCount, (u32)sizeof(XEmacPs_Bd));
+}
+
+/*****************************************************************************/
+/**
+ * Create and setup a BD list of extended BDs, which carry the
+ * XEMACPS_BD_TS_NUM_WORDS timestamp words after the normal BD words. The
+ * extended descriptor mode of the direction must be enabled with
+ * XEmacPs_SetBdTsMode() before the ring is handed to the hardware. The
+ * memory region must hold BdCount extended BDs.
+ *
+ * @param RingPtr is the instance to be worked on.
+ * @param PhysAddr is the physical base address of user memory region.
+ * @param VirtAddr is the virtual base address of the user memory region.
+ * @param Alignment governs the byte alignment of individual BDs.
+ * @param BdCount is the number of BDs to setup in the user memory region.
+ *
+ * @return See XEmacPs_BdRingCreate().
+ *
+ *****************************************************************************/
+LONG XEmacPs_BdRingCreateExt(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
+			     UINTPTR VirtAddr, u32 Alignment, u32 BdCount)
+{
+	return XEmacPs_BdRingCreateSep(RingPtr, PhysAddr, VirtAddr, Alignment,
+				       BdCount, (u32)sizeof(XEmacPs_Bd) +
+				       (XEMACPS_BD_TS_NUM_WORDS * 4U));
+}
+
+/*****************************************************************************/
+/**
+ * Create a BD list whose BDs are Separation bytes apart, see
+ * XEmacPs_BdRingCreate().
+ *****************************************************************************/
+static LONG XEmacPs_BdRingCreateSep(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
+				    UINTPTR VirtAddr, u32 Alignment,
+				    u32 BdCount, u32 Separation)
 {
 	u32 i;
 	UINTPTR BdVirtAddr;
@@ -213,7 +256,7 @@ LONG XEmacPs_BdRingCreate(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
 	}
 
 	/* Figure out how many bytes will be between the start of adjacent BDs */
-	RingPtr->Separation = ((u32)sizeof(XEmacPs_Bd));
+	RingPtr->Separation = Separation;
 
 	/* Must make sure the ring doesn't span address 0x00000000. If it does,
 	 * then the next/prev BD traversal macros will fail.
@@ -24,6 +24,7 @@
 * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.6   rb   09/08/17 HwCnt variable (in XEmacPs_BdRing structure) is
 *		      changed to volatile.
+* 3.19  fl   10/14/26 Add XEmacPs_BdRingCreateExt().
 *
 * </pre>
 *
@@ -189,6 +190,8 @@ typedef struct {
  */
 LONG XEmacPs_BdRingCreate(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
 			  UINTPTR VirtAddr, u32 Alignment, u32 BdCount);
+LONG XEmacPs_BdRingCreateExt(XEmacPs_BdRing * RingPtr, UINTPTR PhysAddr,
+			     UINTPTR VirtAddr, u32 Alignment, u32 BdCount);
 LONG XEmacPs_BdRingClone(XEmacPs_BdRing * RingPtr, XEmacPs_Bd * SrcBdPtr,
 			 u8 Direction);
 LONG XEmacPs_BdRingAlloc(XEmacPs_BdRing * RingPtr, u32 NumBd,
@@ -27,6 +27,10 @@
  * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
  * 3.0   hk   02/20/15 Added support for jumbo frames.
  * 3.2   hk   02/22/16 Added SGMII support for Zynq Ultrascale+ MPSoC.
+ * 3.19  fl   10/14/26 Added APIs to set the type 1 and type 2 RX screeners.
+ * 3.19  fl   10/14/26 Added XEmacPs_SetBdTsMode() for timestamps in the BDs.
+ * 3.19  fl   10/14/26 Added XEmacPs_SetRxBufSize() for frames spanning
+ *		       several RX buffers.
  * </pre>
  *****************************************************************************/
 
@@ -410,6 +414,227 @@ LONG XEmacPs_SetTypeIdCheck(XEmacPs *InstancePtr, u32 Id_Check, u8 Index)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * Set a type 1 screener for this driver/device. A frame whose IP DS/TC byte
+ * and UDP destination port match the enabled fields of the screener is
+ * received in the queue of the screener. The device must be stopped before
+ * calling this function.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param Screen is the screener value, formed from the
+ *        XEMACPS_SCREENT1_*_MASK values. 0 disables the screener.
+ * @param Index is the screener (0-15). The number of screeners depends on
+ *        the hardware.
+ *
+ * @return
+ * - XST_SUCCESS if the screener was set successfully
+ * - XST_DEVICE_IS_STARTED if the device has not yet been stopped
+ * - XST_NO_FEATURE if the device has no priority queues
+ * - XST_INVALID_PARAM if the queue of the screener does not exist
+ *
+ *****************************************************************************/
+LONG XEmacPs_SetType1Screen(XEmacPs *InstancePtr, u32 Screen, u8 Index)
+{
+	LONG Status;
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Index < (u8)XEMACPS_MAX_SCREEN);
+
+	if (InstancePtr->IsStarted == (u32)XIL_COMPONENT_IS_STARTED) {
+		Status = (LONG)(XST_DEVICE_IS_STARTED);
+	} else if (InstancePtr->NumQueues == 1U) {
+		Status = (LONG)(XST_NO_FEATURE);
+	} else if ((Screen & XEMACPS_SCREENT1_QUEUE_MASK) >=
+		   InstancePtr->NumQueues) {
+		Status = (LONG)(XST_INVALID_PARAM);
+	} else {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 ((u32)XEMACPS_SCREENT1_OFFSET + ((u32)Index * (u32)4)),
+				 Screen);
+		Status = (LONG)(XST_SUCCESS);
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * Set a type 2 screener for this driver/device. A frame whose VLAN priority
+ * and EtherType match the enabled fields of the screener is received in the
+ * queue of the screener. The EtherType is given by one of the EtherType
+ * registers, set with XEmacPs_SetType2EtherType(). The device must be
+ * stopped before calling this function.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param Screen is the screener value, formed from the
+ *        XEMACPS_SCREENT2_*_MASK values. 0 disables the screener.
+ * @param Index is the screener (0-15). The number of screeners depends on
+ *        the hardware.
+ *
+ * @return
+ * - XST_SUCCESS if the screener was set successfully
+ * - XST_DEVICE_IS_STARTED if the device has not yet been stopped
+ * - XST_NO_FEATURE if the device has no priority queues
+ * - XST_INVALID_PARAM if the queue of the screener does not exist
+ *
+ *****************************************************************************/
+LONG XEmacPs_SetType2Screen(XEmacPs *InstancePtr, u32 Screen, u8 Index)
+{
+	LONG Status;
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Index < (u8)XEMACPS_MAX_SCREEN);
+
+	if (InstancePtr->IsStarted == (u32)XIL_COMPONENT_IS_STARTED) {
+		Status = (LONG)(XST_DEVICE_IS_STARTED);
+	} else if (InstancePtr->NumQueues == 1U) {
+		Status = (LONG)(XST_NO_FEATURE);
+	} else if ((Screen & XEMACPS_SCREENT2_QUEUE_MASK) >=
+		   InstancePtr->NumQueues) {
+		Status = (LONG)(XST_INVALID_PARAM);
+	} else {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 ((u32)XEMACPS_SCREENT2_OFFSET + ((u32)Index * (u32)4)),
+				 Screen);
+		Status = (LONG)(XST_SUCCESS);
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * Set an EtherType register matched by the type 2 screeners. The device must
+ * be stopped before calling this function.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param EtherType is the EtherType, in host order.
+ * @param Index is the EtherType register (0-7).
+ *
+ * @return
+ * - XST_SUCCESS if the EtherType was set successfully
+ * - XST_DEVICE_IS_STARTED if the device has not yet been stopped
+ * - XST_NO_FEATURE if the device has no priority queues
+ *
+ *****************************************************************************/
+LONG XEmacPs_SetType2EtherType(XEmacPs *InstancePtr, u16 EtherType, u8 Index)
+{
+	LONG Status;
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Index < (u8)XEMACPS_MAX_SCREEN_ETHTYPE);
+
+	if (InstancePtr->IsStarted == (u32)XIL_COMPONENT_IS_STARTED) {
+		Status = (LONG)(XST_DEVICE_IS_STARTED);
+	} else if (InstancePtr->NumQueues == 1U) {
+		Status = (LONG)(XST_NO_FEATURE);
+	} else {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 ((u32)XEMACPS_SCREENT2_ETHT_OFFSET + ((u32)Index * (u32)4)),
+				 (u32)EtherType);
+		Status = (LONG)(XST_SUCCESS);
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * Select which frames get their 1588 timestamp written into the buffer
+ * descriptors. A mode other than XEMACPS_BDCTRL_TSMODE_NONE switches the
+ * direction to extended descriptors, so its BD rings must have been created
+ * with XEmacPs_BdRingCreateExt(). The device must be stopped before calling
+ * this function.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param TxMode is one of the XEMACPS_BDCTRL_TSMODE_* values for transmit.
+ * @param RxMode is one of the XEMACPS_BDCTRL_TSMODE_* values for receive.
+ *
+ * @return
+ * - XST_SUCCESS if the mode was set successfully
+ * - XST_DEVICE_IS_STARTED if the device has not yet been stopped
+ * - XST_NO_FEATURE if the GEM has no extended descriptors (Zynq-7000)
+ *
+ *****************************************************************************/
+LONG XEmacPs_SetBdTsMode(XEmacPs *InstancePtr, u32 TxMode, u32 RxMode)
+{
+	u32 Reg;
+	LONG Status;
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid((TxMode & ~XEMACPS_BDCTRL_TSMODE_MASK) == 0x00000000U);
+	Xil_AssertNonvoid((RxMode & ~XEMACPS_BDCTRL_TSMODE_MASK) == 0x00000000U);
+
+	if (InstancePtr->IsStarted == (u32)XIL_COMPONENT_IS_STARTED) {
+		Status = (LONG)(XST_DEVICE_IS_STARTED);
+	} else if (InstancePtr->Version <= 2) {
+		Status = (LONG)(XST_NO_FEATURE);
+	} else {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XEMACPS_TXBDCTRL_OFFSET, TxMode);
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XEMACPS_RXBDCTRL_OFFSET, RxMode);
+
+		Reg = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+				      XEMACPS_DMACR_OFFSET);
+		Reg &= ~(XEMACPS_DMACR_TXEXTEND_MASK |
+			 XEMACPS_DMACR_RXEXTEND_MASK);
+		if (TxMode != XEMACPS_BDCTRL_TSMODE_NONE) {
+			Reg |= XEMACPS_DMACR_TXEXTEND_MASK;
+		}
+		if (RxMode != XEMACPS_BDCTRL_TSMODE_NONE) {
+			Reg |= XEMACPS_DMACR_RXEXTEND_MASK;
+		}
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XEMACPS_DMACR_OFFSET, Reg);
+		Status = (LONG)(XST_SUCCESS);
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * Set the size of the receive buffers. A received frame larger than the
+ * buffers is written into several buffers, with the start and end of the
+ * frame flagged in the BDs of the first and the last one. This overrides the
+ * buffer size set by XEmacPs_Reset() and the XEMACPS_JUMBO_ENABLE_OPTION,
+ * so it must be called after setting the options. The device must be stopped
+ * before calling this function.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param BufSize is the size of every receive buffer, a non-zero multiple
+ *        of XEMACPS_RX_BUF_UNIT up to 255 units.
+ *
+ * @return
+ * - XST_SUCCESS if the size was set successfully
+ * - XST_DEVICE_IS_STARTED if the device has not yet been stopped
+ *
+ *****************************************************************************/
+LONG XEmacPs_SetRxBufSize(XEmacPs *InstancePtr, u32 BufSize)
+{
+	u32 Reg;
+	LONG Status;
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid((BufSize != 0x00000000U) &&
+			  ((BufSize % (u32)XEMACPS_RX_BUF_UNIT) == 0x00000000U));
+	Xil_AssertNonvoid(((BufSize / (u32)XEMACPS_RX_BUF_UNIT) <<
+			   XEMACPS_DMACR_RXBUF_SHIFT) <= XEMACPS_DMACR_RXBUF_MASK);
+
+	if (InstancePtr->IsStarted == (u32)XIL_COMPONENT_IS_STARTED) {
+		Status = (LONG)(XST_DEVICE_IS_STARTED);
+	} else {
+		Reg = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+				      XEMACPS_DMACR_OFFSET);
+		Reg &= ~XEMACPS_DMACR_RXBUF_MASK;
+		Reg |= ((BufSize / (u32)XEMACPS_RX_BUF_UNIT) <<
+			(u32)(XEMACPS_DMACR_RXBUF_SHIFT)) &
+			(u32)(XEMACPS_DMACR_RXBUF_MASK);
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XEMACPS_DMACR_OFFSET, Reg);
+		Status = (LONG)(XST_SUCCESS);
+	}
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * Set options for the driver/device. The driver should be stopped with
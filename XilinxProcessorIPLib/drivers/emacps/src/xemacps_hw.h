@@ -40,6 +40,10 @@
 * 3.9  hk   01/23/19 Add RX watermark support
 * 3.10 hk   05/16/19 Clear status registers properly in reset
 * 3.18  sne 01/11/23 Add PCS control and status registers information.
+* 3.19  fl   10/14/26 Add priority queue, RX queue buffer size and screener
+*                     register information.
+*       fl   10/14/26 Add BD timestamp control registers and the timestamp
+*                     fields of extended buffer descriptors.
 * </pre>
 *
 ******************************************************************************/
@@ -62,6 +66,12 @@ extern "C" {
 #define XEMACPS_MAX_MAC_ADDR     4U   /**< Maxmum number of mac address
                                            supported */
 #define XEMACPS_MAX_TYPE_ID      4U   /**< Maxmum number of type id supported */
+#define XEMACPS_MAX_QUEUES       16U  /**< Maximum number of priority queues,
+                                           including queue 0 */
+#define XEMACPS_MAX_SCREEN       16U  /**< Maximum number of type 1 and of
+                                           type 2 screeners */
+#define XEMACPS_MAX_SCREEN_ETHTYPE 8U /**< Maximum number of type 2 screener
+                                           EtherType values */
 
 #ifdef __aarch64__
 #define XEMACPS_BD_ALIGNMENT     64U   /**< Minimum buffer descriptor alignment
@@ -278,6 +288,8 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 						      nanosecond counter */
 #define XEMACPS_PCS_CONTROL_OFFSET	0x00000200U /** PCS control register */
 #define XEMACPS_PCS_STATUS_OFFSET	0x00000204U /** PCS status register */
+#define XEMACPS_DCFG6_OFFSET	     0x00000294U /**< Design config 6 reg,
+							priority queues present */
 
 #define XEMACPS_INTQ1_STS_OFFSET     0x00000400U /**< Interrupt Q1 Status
 							reg */
@@ -285,16 +297,34 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 							reg */
 #define XEMACPS_RXQ1BASE_OFFSET	     0x00000480U /**< RX Q1 Base address
 							reg */
+#define XEMACPS_RXBUFQ1SIZE_OFFSET   0x000004A0U /**< RX Q1 Buffer size
+							reg */
 #define XEMACPS_MSBBUF_TXQBASE_OFFSET  0x000004C8U /**< MSB Buffer TX Q Base
 							reg */
+#define XEMACPS_TXBDCTRL_OFFSET      0x000004CCU /**< TX BD timestamp control
+							reg */
+#define XEMACPS_RXBDCTRL_OFFSET      0x000004D0U /**< RX BD timestamp control
+							reg */
 #define XEMACPS_MSBBUF_RXQBASE_OFFSET  0x000004D4U /**< MSB Buffer RX Q Base
 							reg */
+#define XEMACPS_SCREENT1_OFFSET      0x00000500U /**< Type 1 screener 0
+							reg */
+#define XEMACPS_SCREENT2_OFFSET      0x00000540U /**< Type 2 screener 0
+							reg */
 #define XEMACPS_INTQ1_IER_OFFSET     0x00000600U /**< Interrupt Q1 Enable
 							reg */
 #define XEMACPS_INTQ1_IDR_OFFSET     0x00000620U /**< Interrupt Q1 Disable
 							reg */
 #define XEMACPS_INTQ1_IMR_OFFSET     0x00000640U /**< Interrupt Q1 Mask
 							reg */
+#define XEMACPS_SCREENT2_ETHT_OFFSET 0x000006E0U /**< Type 2 screener
+							EtherType 0 reg */
+
+/* The registers of queues 1 and above follow the queue 1 register, one word
+ * apart. Q1Offset is the offset of the queue 1 register.
+ */
+#define XEMACPS_QUEUE_OFFSET(Q1Offset, Queue) \
+	((u32)(Q1Offset) + (((u32)(Queue) - 1U) * 4U))
 
 /* Define some bit positions for registers. */
 
@@ -443,6 +473,38 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 
 /*@}*/
 
+/**
+ * @name Type 1 screener register bit definitions
+ * A frame matching all the enabled fields is received in the queue
+ * @{
+ */
+#define XEMACPS_SCREENT1_QUEUE_MASK	0x0000000FU /**< Queue number */
+#define XEMACPS_SCREENT1_DSTC_MASK	0x00000FF0U /**< IPv4 DS / IPv6 TC
+							byte to match */
+#define XEMACPS_SCREENT1_DSTC_SHIFT	4U
+#define XEMACPS_SCREENT1_UDP_MASK	0x0FFFF000U /**< UDP destination port
+							to match */
+#define XEMACPS_SCREENT1_UDP_SHIFT	12U
+#define XEMACPS_SCREENT1_DSTCEN_MASK	0x10000000U /**< Match DS/TC */
+#define XEMACPS_SCREENT1_UDPEN_MASK	0x20000000U /**< Match UDP port */
+/*@}*/
+
+/**
+ * @name Type 2 screener register bit definitions
+ * A frame matching all the enabled fields is received in the queue
+ * @{
+ */
+#define XEMACPS_SCREENT2_QUEUE_MASK	0x0000000FU /**< Queue number */
+#define XEMACPS_SCREENT2_VLANPRI_MASK	0x00000070U /**< VLAN priority to
+							match */
+#define XEMACPS_SCREENT2_VLANPRI_SHIFT	4U
+#define XEMACPS_SCREENT2_VLANEN_MASK	0x00000100U /**< Match VLAN priority */
+#define XEMACPS_SCREENT2_ETHT_MASK	0x00000E00U /**< Index of the EtherType
+							reg to match */
+#define XEMACPS_SCREENT2_ETHT_SHIFT	9U
+#define XEMACPS_SCREENT2_ETHTEN_MASK	0x00001000U /**< Match EtherType */
+/*@}*/
+
 /**
  * @name PCS control register bit definitions
  * @{
@@ -463,10 +525,14 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
  */
 #define XEMACPS_INTQ1SR_TXCOMPL_MASK	0x00000080U /**< Transmit completed OK */
 #define XEMACPS_INTQ1SR_TXERR_MASK	0x00000040U /**< Transmit AMBA Error */
+#define XEMACPS_INTQ1SR_RXCOMPL_MASK	0x00000002U /**< Frame received OK */
 
 #define XEMACPS_INTQ1_IXR_ALL_MASK	((u32)XEMACPS_INTQ1SR_TXCOMPL_MASK | \
 					 (u32)XEMACPS_INTQ1SR_TXERR_MASK)
 
+#define XEMACPS_INTQ_IXR_ALL_MASK	((u32)XEMACPS_INTQ1_IXR_ALL_MASK | \
+					 (u32)XEMACPS_INTQ1SR_RXCOMPL_MASK)
+
 /*@}*/
 
 /**
@@ -562,6 +628,8 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_TXBUF_TCP_MASK   0x04000000U /**< Late collision. */
 #define XEMACPS_TXBUF_NOCRC_MASK 0x00010000U /**< No CRC */
 #define XEMACPS_TXBUF_LAST_MASK  0x00008000U /**< Last buffer */
+#define XEMACPS_TXBUF_TS_VALID_MASK 0x00800000U /**< Timestamp captured,
+						   extended BDs only */
 #define XEMACPS_TXBUF_LEN_MASK   0x00003FFFU /**< Mask for length field */
 /*
  * @}
@@ -598,6 +666,29 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_RXBUF_WRAP_MASK      0x00000002U /**< Wrap bit, last BD */
 #define XEMACPS_RXBUF_NEW_MASK       0x00000001U /**< Used bit.. */
 #define XEMACPS_RXBUF_ADD_MASK       0xFFFFFFFCU /**< Mask for address */
+#define XEMACPS_RXBUF_TS_VALID_MASK  0x00000004U /**< Timestamp captured,
+						    extended BDs only */
+/*
+ * @}
+ */
+
+/* Timestamp words of extended buffer descriptors, which follow the normal
+ * BD words. Word 0 holds the nanoseconds and the two low bits of the
+ * seconds, word 1 the next four bits of the seconds. The upper bits of the
+ * seconds come from the 1588 timer.
+ * @{
+ */
+#define XEMACPS_BD_TS_NSEC_MASK      0x3FFFFFFFU /**< Nanoseconds, word 0 */
+#define XEMACPS_BD_TS_SECL_SHIFT     30U         /**< Seconds[1:0], word 0 */
+#define XEMACPS_BD_TS_SECH_MASK      0x0000000FU /**< Seconds[5:2], word 1 */
+#define XEMACPS_BD_TS_SECH_SHIFT     2U
+#define XEMACPS_BD_TS_SEC_MASK       0x0000003FU /**< Seconds in the BD */
+
+#define XEMACPS_BDCTRL_TSMODE_MASK   0x00000030U /**< Frames timestamped */
+#define XEMACPS_BDCTRL_TSMODE_NONE   0x00000000U /**< No frames */
+#define XEMACPS_BDCTRL_TSMODE_EVENT  0x00000010U /**< PTP event frames */
+#define XEMACPS_BDCTRL_TSMODE_PTP    0x00000020U /**< All PTP frames */
+#define XEMACPS_BDCTRL_TSMODE_ALL    0x00000030U /**< All frames */
 /*
  * @}
  */
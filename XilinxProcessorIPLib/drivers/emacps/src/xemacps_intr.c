@@ -34,6 +34,8 @@
 * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.1   hk   07/27/15 Do not call error handler with '0' error code when
 *                     there is no error. CR# 869403
+* 3.19  fl   10/14/26 Handle receive and transmit interrupts of the priority
+*                     queues.
 * </pre>
 ******************************************************************************/
 
@@ -126,6 +128,10 @@ void XEmacPs_IntrHandler(void *XEmacPsPtr)
 	u32 RegSR;
 	u32 RegCtrl;
 	u32 RegQ1ISR = 0U;
+	u32 RegQISR;
+	u32 QueueRx = 0U;
+	u32 QueueTx = 0U;
+	u8 Queue;
 	XEmacPs *InstancePtr = (XEmacPs *) XEmacPsPtr;
 
 	Xil_AssertVoid(InstancePtr != NULL);
@@ -186,6 +192,45 @@ void XEmacPs_IntrHandler(void *XEmacPsPtr)
 		InstancePtr->SendHandler(InstancePtr->SendRef);
 	}
 
+	/* Priority queue interrupts, the transmit interrupts of queue 1 are
+	 * handled above
+	 */
+	for (Queue = 1U; Queue < InstancePtr->NumQueues; Queue++) {
+		if (Queue == 1U) {
+			RegQISR = RegQ1ISR;
+		} else {
+			RegQISR = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+				XEMACPS_QUEUE_OFFSET(XEMACPS_INTQ1_STS_OFFSET, Queue));
+		}
+
+		if ((RegQISR & XEMACPS_INTQ1SR_RXCOMPL_MASK) != 0x00000000U) {
+			XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XEMACPS_QUEUE_OFFSET(XEMACPS_INTQ1_STS_OFFSET, Queue),
+				XEMACPS_INTQ1SR_RXCOMPL_MASK);
+			QueueRx = 1U;
+		}
+
+		if ((Queue > 1U) &&
+		    ((RegQISR & XEMACPS_INTQ1SR_TXCOMPL_MASK) != 0x00000000U)) {
+			XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XEMACPS_QUEUE_OFFSET(XEMACPS_INTQ1_STS_OFFSET, Queue),
+				RegQISR & XEMACPS_INTQ1_IXR_ALL_MASK);
+			if ((RegQISR & XEMACPS_INTQ1SR_TXERR_MASK) != 0x00000000U) {
+				InstancePtr->ErrorHandler(InstancePtr->ErrorRef,
+							  XEMACPS_SEND, RegQISR);
+			}
+			QueueTx = 1U;
+		}
+	}
+
+	/* The callbacks process the BD rings of all the queues */
+	if (QueueRx != 0U) {
+		InstancePtr->RecvHandler(InstancePtr->RecvRef);
+	}
+	if (QueueTx != 0U) {
+		InstancePtr->SendHandler(InstancePtr->SendRef);
+	}
+
 	/* Receive error conditions interrupt */
 	if ((RegISR & XEMACPS_IXR_RX_ERR_MASK) != 0x00000000U) {
 		/* Clear RX status register */
@@ -36,6 +36,7 @@
 *                     Literal value requires a U suffix.
 * 3.5   sne  03/13/19 Added Versal support.
 * 3.12  gm   07/11/23 Added SDT support.
+* 3.13  fl   10/14/26 Added XGpioPs_WriteMasked and XGpioPs_WriteMaskedBatch.
 *
 * </pre>
 *
@@ -55,6 +56,9 @@
 
 /************************** Function Prototypes ******************************/
 
+static void XGpioPs_MaskedBankWrite(UINTPTR BaseAddr, u8 Bank, u32 Mask,
+				    u32 Data);
+
 void StubHandler(void *CallBackRef, u32 Bank, u32 Status); /**< Stub handler */
 
 /*****************************************************************************/
@@ -288,6 +292,127 @@ void XGpioPs_Write(const XGpioPs *InstancePtr, u8 Bank, u32 Data)
 			  XGPIOPS_DATA_OFFSET, Data);
 }
 
+/****************************************************************************/
+/**
+*
+* Write the pins of a bank selected by a mask through the Mask/Data
+* registers. Each register covers 16 pins of the bank, its upper 16 bits
+* select the pins that keep their value, so no read of the bank is needed.
+*
+* @param	BaseAddr is the base address of the GPIO device.
+* @param	Bank is the bank number of the GPIO to operate on.
+* @param	Mask is the bit mask of the pins to update.
+* @param	Data is the new value of the pins in Mask.
+*
+* @return	None.
+*
+* @note		A register is only written when Mask selects some of its pins.
+*
+*****************************************************************************/
+static void XGpioPs_MaskedBankWrite(UINTPTR BaseAddr, u8 Bank, u32 Mask,
+				    u32 Data)
+{
+	u32 RegOffset = (u32)Bank * XGPIOPS_DATA_MASK_OFFSET;
+
+	if ((Mask & 0x0000FFFFU) != 0U) {
+		XGpioPs_WriteReg(BaseAddr, RegOffset + XGPIOPS_DATA_LSW_OFFSET,
+				 ((~Mask << 16U) & 0xFFFF0000U) |
+				 (Data & Mask & 0x0000FFFFU));
+	}
+
+	if ((Mask & 0xFFFF0000U) != 0U) {
+		XGpioPs_WriteReg(BaseAddr, RegOffset + XGPIOPS_DATA_MSW_OFFSET,
+				 (~Mask & 0xFFFF0000U) |
+				 ((Data & Mask) >> 16U));
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Write the pins of the specified GPIO Bank selected by a mask. The other
+* pins of the bank keep their value.
+*
+* @param	InstancePtr is a pointer to the XGpioPs instance.
+* @param	Bank is the bank number of the GPIO to operate on.
+*		Valid values are 0-3 in Zynq and 0-5 in Zynq Ultrascale+ MP.
+* @param	Mask is the bit mask of the pins to update. Bit 0 is the first
+*		pin of the bank.
+* @param	Data is the new value of the pins in Mask.
+*
+* @return	None.
+*
+* @note		Unlike XGpioPs_WritePin() this is done without reading the
+*		bank, so it does not race with other masters writing other
+*		pins. The update of pins 0-15 and of pins 16-31 are each a
+*		single register write, a Mask covering both halves takes two
+*		writes, the lower half first.
+*
+*****************************************************************************/
+void XGpioPs_WriteMasked(const XGpioPs *InstancePtr, u8 Bank, u32 Mask,
+			 u32 Data)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Bank < InstancePtr->MaxBanks);
+#ifdef versal
+	if (InstancePtr->PmcGpio == (u32)TRUE) {
+		Xil_AssertVoid(Bank != XGPIOPS_TWO);
+	} else {
+		Xil_AssertVoid((Bank != XGPIOPS_ONE) && (Bank != XGPIOPS_TWO));
+	}
+#endif
+
+	XGpioPs_MaskedBankWrite(InstancePtr->GpioConfig.BaseAddr, Bank, Mask,
+				Data);
+}
+
+/****************************************************************************/
+/**
+*
+* Apply a sequence of masked writes, in order. This is meant for bit-banged
+* protocols which set several pins per step, for example data and strobe
+* pins of a parallel bus.
+*
+* @param	InstancePtr is a pointer to the XGpioPs instance.
+* @param	WritePtr is a pointer to the array of masked writes.
+* @param	NumWrites is the number of entries in the array.
+*
+* @return	None.
+*
+* @note		Each entry is written as with XGpioPs_WriteMasked(). There
+*		is no delay between the writes, the caller adds one between
+*		entries if the protocol needs a minimum pulse width.
+*
+*****************************************************************************/
+void XGpioPs_WriteMaskedBatch(const XGpioPs *InstancePtr,
+			      const XGpioPs_MaskedWrite *WritePtr, u32 NumWrites)
+{
+	UINTPTR BaseAddr;
+	u32 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid((WritePtr != NULL) || (NumWrites == 0U));
+
+	BaseAddr = InstancePtr->GpioConfig.BaseAddr;
+
+	for (Index = 0U; Index < NumWrites; Index++) {
+		Xil_AssertVoid(WritePtr[Index].Bank < InstancePtr->MaxBanks);
+#ifdef versal
+		if (InstancePtr->PmcGpio == (u32)TRUE) {
+			Xil_AssertVoid(WritePtr[Index].Bank != XGPIOPS_TWO);
+		} else {
+			Xil_AssertVoid((WritePtr[Index].Bank != XGPIOPS_ONE) &&
+				       (WritePtr[Index].Bank != XGPIOPS_TWO));
+		}
+#endif
+		XGpioPs_MaskedBankWrite(BaseAddr, WritePtr[Index].Bank,
+					WritePtr[Index].Mask,
+					WritePtr[Index].Data);
+	}
+}
+
 /****************************************************************************/
 /**
 *
@@ -125,6 +125,7 @@
 * 3.9	sne  03/15/21 Fixed MISRA-C violations.
 * 3.11  sg   02/23/23 Update bank and pin mapping information.
 * 3.12  gm   07/11/23 Added SDT support.
+* 3.13  fl   10/14/26 Added XGpioPs_WriteMasked and XGpioPs_WriteMaskedBatch.
 *
 * </pre>
 *
@@ -206,6 +207,15 @@ extern "C" {
  *****************************************************************************/
 typedef void (*XGpioPs_Handler) (void *CallBackRef, u32 Bank, u32 Status);
 
+/**
+ * This typedef describes one masked write of XGpioPs_WriteMaskedBatch().
+ */
+typedef struct {
+	u8 Bank;		/**< GPIO bank to write */
+	u32 Mask;		/**< Pins of the bank to update */
+	u32 Data;		/**< New values of the pins in Mask */
+} XGpioPs_MaskedWrite;
+
 /**
  * This typedef contains configuration information for a device.
  */
@@ -258,6 +268,10 @@ void XGpioPs_SetDirection(const XGpioPs *InstancePtr, u8 Bank, u32 Direction);
 u32 XGpioPs_GetDirection(const XGpioPs *InstancePtr, u8 Bank);
 void XGpioPs_SetOutputEnable(const XGpioPs *InstancePtr, u8 Bank, u32 OpEnable);
 u32 XGpioPs_GetOutputEnable(const XGpioPs *InstancePtr, u8 Bank);
+void XGpioPs_WriteMasked(const XGpioPs *InstancePtr, u8 Bank, u32 Mask,
+			 u32 Data);
+void XGpioPs_WriteMaskedBatch(const XGpioPs *InstancePtr,
+			      const XGpioPs_MaskedWrite *WritePtr, u32 NumWrites);
 #ifdef versal
 void XGpioPs_GetBankPin(const XGpioPs *InstancePtr,u8 PinNumber,u8 *BankNumber, u8 *PinNumberInBank);
 #else
@@ -32,6 +32,8 @@
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.01  MH   02/28/17 Fixed compiler warnings.
 * 2.20  MH   06/08/17 Updated for 64 bit support.
+*       fl   10/14/26 Updated to perform Montgomery R^2 calculation
+*                     when XHdcp22Rx_LoadPrivateKey is called.
 *</pre>
 *
 *****************************************************************************/
@@ -1000,6 +1002,22 @@ int XHdcp22Rx_LoadPrivateKey(XHdcp22_Rx *InstancePtr, const u8 *PrivateKeyPtr)
 	    return Status;
 	}
 
+	/* Calculate Montgomery Multiplier RSquareP */
+	Status = XHdcp22Rx_CalcMontRSquare(InstancePtr->RSquareP, (u8 *)PrivateKey->p, XHDCP22_RX_P_SIZE/4);
+	if(Status != XST_SUCCESS)
+	{
+	    xil_printf("ERROR: HDCP22-RX MMult RSquareP Generation Failed\r\n");
+	    return Status;
+	}
+
+	/* Calculate Montgomery Multiplier RSquareQ */
+	Status = XHdcp22Rx_CalcMontRSquare(InstancePtr->RSquareQ, (u8 *)PrivateKey->q, XHDCP22_RX_P_SIZE/4);
+	if(Status != XST_SUCCESS)
+	{
+	    xil_printf("ERROR: HDCP22-RX MMult RSquareQ Generation Failed\r\n");
+	    return Status;
+	}
+
 	return Status;
 }
 
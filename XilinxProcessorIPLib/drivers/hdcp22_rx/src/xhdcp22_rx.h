@@ -77,6 +77,7 @@
 *                     to array. Added function XHDCP22Rx_GetVersion.
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.01  MH   02/28/17 Fixed compiler warnings.
+*       fl   10/14/26 Added RSquareP and RSquareQ arrays.
 *</pre>
 *
 *****************************************************************************/
@@ -567,6 +568,10 @@ typedef struct
 	u8 NPrimeP[64];
 	/** Montgomery NPrimeQ array */
 	u8 NPrimeQ[64];
+	/** Montgomery R^2 mod(p) array */
+	u8 RSquareP[64];
+	/** Montgomery R^2 mod(q) array */
+	u8 RSquareQ[64];
 	/** HDCP-RX authentication and key exchange info */
 	XHdcp22_Rx_Info Info;
 	/** HDCP-RX authentication and key exchange parameters */
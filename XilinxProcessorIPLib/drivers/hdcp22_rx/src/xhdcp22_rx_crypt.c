@@ -23,6 +23,9 @@
 * 1.00  MH   10/30/15 First Release
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.20  MH   06/21/17 Updated for 64 bit support.
+*       fl   10/14/26 Updated XHdcp22Rx_Pkcs1MontExp to convert the base
+*                     with a precomputed R^2 on the MMULT and to skip the
+*                     leading zero bits of the exponent.
 *</pre>
 *
 *****************************************************************************/
@@ -66,7 +69,7 @@ static void XHdcp22Rx_Pkcs1MontMultFiosStub(u32 *U, u32 *A, u32 *B, u32 *N,
 static void XHdcp22Rx_Pkcs1MontMultAdd(u32 *A, u32 C, int SDigit, int NDigits);
 #endif
 static int  XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A, u32 *E,
-	            u32 *N, const u32 *NPrime, int NDigits);
+	            u32 *N, const u32 *NPrime, const u32 *RSquare, int NDigits);
 
 /* Functions for implementing other cryptographic tasks */
 static void XHdcp22Rx_ComputeDKey(const u8* Rrx, const u8* Rtx, const u8 *Km,
@@ -158,6 +161,56 @@ int XHdcp22Rx_CalcMontNPrime(u8 *NPrime, const u8 *N, int NDigits)
 	return XST_SUCCESS;
 }
 
+/****************************************************************************/
+/**
+* This function computes the Montgomery constant R^2*mod(N), which is used
+* to convert the base of a modular exponentiation into its n-residue with a
+* single Montgomery multiplication.
+*
+* @param	RSquare is the output R^2*mod(N)
+* @param	N is modulus
+* @param	NDigits is the integer precision of arguments (N, RSquare),
+* 			which should always be 16 for the HDCP2.2 receiver.
+*
+* @return	XST_SUCCESS or FAILURE.
+*
+* @note		None.
+******************************************************************************/
+int XHdcp22Rx_CalcMontRSquare(u8 *RSquare, const u8 *N, int NDigits)
+{
+	/* Verify arguments */
+	Xil_AssertNonvoid(RSquare != NULL);
+	Xil_AssertNonvoid(N != NULL);
+	Xil_AssertNonvoid(NDigits == 16);
+
+	u32 N_i[XHDCP22_RX_N_SIZE/4];
+	u32 R[XHDCP22_RX_N_SIZE/4];
+	u32 RSquare_i[XHDCP22_RX_N_SIZE/4];
+
+	/* Clear variables */
+	memset(N_i, 0, sizeof(N_i));
+	memset(R, 0, sizeof(R));
+	memset(RSquare_i, 0, sizeof(RSquare_i));
+
+	/* Convert from octet string */
+	mpConvFromOctets(N_i, XHdcp22Rx_MpSizeof(N_i), N, 4*NDigits);
+
+	/* Step 1: R = 2^(NDigits*32) */
+	R[0] = 1;
+	mpShiftLeft(R, R, 32*NDigits, XHdcp22Rx_MpSizeof(R));
+
+	/* Step 2: RSquare = R*mod(N) */
+	mpModulo(RSquare_i, R, XHdcp22Rx_MpSizeof(R), N_i, NDigits);
+
+	/* Step 3: RSquare = R*R*mod(N) */
+	mpModMult(RSquare_i, RSquare_i, RSquare_i, N_i, NDigits);
+
+	/* Convert to octet string */
+	mpConvToOctets(RSquare_i, NDigits, RSquare, 4*NDigits);
+
+	return XST_SUCCESS;
+}
+
 /****************************************************************************/
 /**
 * This function implements the RSAES-OAEP-Encrypt operation. The message
@@ -354,6 +407,7 @@ static int XHdcp22Rx_Pkcs1Rsadp(XHdcp22_Rx *InstancePtr, const XHdcp22_Rx_KprivR
 	u32 D[XHDCP22_RX_N_SIZE/4];
 	u32 M1[XHDCP22_RX_N_SIZE/4];
 	u32 M2[XHDCP22_RX_N_SIZE/4];
+	u32 RSquare[XHDCP22_RX_N_SIZE/4];
 	u32 Status;
 
 	/* Clear variables */
@@ -363,21 +417,24 @@ static int XHdcp22Rx_Pkcs1Rsadp(XHdcp22_Rx *InstancePtr, const XHdcp22_Rx_KprivR
 	memset(D, 0, sizeof(D));
 	memset(M1, 0, sizeof(M1));
 	memset(M2, 0, sizeof(M2));
+	memset(RSquare, 0, sizeof(RSquare));
 
 	/* Step 2b part I: Generate m1 = c^dP * mod(p) */
 	mpConvFromOctets(A, XHdcp22Rx_MpSizeof(A), KprivRx->p, XHDCP22_RX_P_SIZE);
 	mpConvFromOctets(B, XHdcp22Rx_MpSizeof(B), KprivRx->dp, XHDCP22_RX_P_SIZE);
 	mpConvFromOctets(C, XHdcp22Rx_MpSizeof(C), EncryptedMessage, XHDCP22_RX_N_SIZE);
 	mpConvFromOctets(D, XHdcp22Rx_MpSizeof(D), InstancePtr->NPrimeP, XHDCP22_RX_P_SIZE);
+	mpConvFromOctets(RSquare, XHdcp22Rx_MpSizeof(RSquare), InstancePtr->RSquareP, XHDCP22_RX_P_SIZE);
 	//Status = mpModExp(M1, C, B, A, XHDCP22_RX_N_SIZE/4);
-	Status = XHdcp22Rx_Pkcs1MontExp(InstancePtr, M1, C, B, A, D, 16);
+	Status = XHdcp22Rx_Pkcs1MontExp(InstancePtr, M1, C, B, A, D, RSquare, 16);
 
 	/* Step 2b part I: Generate m2 = c^dQ * mod(q) */
 	mpConvFromOctets(A, XHdcp22Rx_MpSizeof(A), KprivRx->q, XHDCP22_RX_P_SIZE);
 	mpConvFromOctets(B, XHdcp22Rx_MpSizeof(B), KprivRx->dq, XHDCP22_RX_P_SIZE);
 	mpConvFromOctets(D, XHdcp22Rx_MpSizeof(D), InstancePtr->NPrimeQ, XHDCP22_RX_P_SIZE);
+	mpConvFromOctets(RSquare, XHdcp22Rx_MpSizeof(RSquare), InstancePtr->RSquareQ, XHDCP22_RX_P_SIZE);
 	//Status = mpModExp(M2, C, D, B, XHDCP22_RX_N_SIZE/4);
-	Status = XHdcp22Rx_Pkcs1MontExp(InstancePtr, M2, C, B, A, D, 16);
+	Status = XHdcp22Rx_Pkcs1MontExp(InstancePtr, M2, C, B, A, D, RSquare, 16);
 
 	/* Step 2b part II: Skip since u=2 */
 
@@ -890,15 +947,19 @@ static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx *InstancePtr, u32 *U,
 * @param	E is the exponent
 * @param	N is the modulus
 * @param	NPrime is a constant
+* @param	RSquare is the constant R^2*mod(N)
 * @param	NDigits is the integer precision of the arguments (C,A,B,N,NPrime).
 * 			Maximum integer precision is 16.
 *
 * @return	None.
 *
-* @note		None.
+* @note		The n-residue of the base is computed with one Montgomery
+* 			multiplication by RSquare instead of a full precision software
+* 			multiply and reduce, and the square and multiply loop starts
+* 			at the most significant set bit of the exponent.
 *****************************************************************************/
 static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A,
-	u32 *E, u32 *N, const u32 *NPrime, int NDigits)
+	u32 *E, u32 *N, const u32 *NPrime, const u32 *RSquare, int NDigits)
 {
 	int Offset;
 	u32 R[XHDCP22_RX_N_SIZE/4];
@@ -909,22 +970,41 @@ static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A,
 	memset(Abar, 0, sizeof(Abar));
 	memset(Xbar, 0, sizeof(Xbar));
 
+	/* Step 0: Find the most significant set bit of the exponent */
+	for(Offset=32*NDigits-1; Offset>=0; Offset--)
+	{
+		if(mpGetBit(E, NDigits, Offset) == TRUE)
+		{
+			break;
+		}
+	}
+
+	/* A^0 = 1 */
+	if(Offset < 0)
+	{
+		memset(C, 0, 4*NDigits);
+		C[0] = 1;
+		return XST_SUCCESS;
+	}
+
 #ifndef _XHDCP22_RX_SW_MMULT_
 	XHdcp22Rx_Pkcs1MontMultFiosInit(InstancePtr, N, NPrime, NDigits);
 #endif
 
-	/* Step 0: R = 2^(NDigits*32) */
-	R[0] = 1;
-	mpShiftLeft(R, R, NDigits*32, XHDCP22_RX_N_SIZE/4);
-
-	/* Step 1: Xbar = 1*R*mod(N) */
-	mpModulo(Xbar, R, XHDCP22_RX_N_SIZE/4, N, NDigits); // Optimization
+	/* Step 1: Xbar = A*mod(N) */
+	mpModulo(Xbar, A, XHDCP22_RX_N_SIZE/4, N, NDigits);
 
-	/* Step 2: Abar = A*R*mod(N) */
-	mpModMult(Abar, A, Xbar, N, 2*NDigits);
+	/* Step 2: Abar = MonPro(A, R^2) = A*R*mod(N) */
+#ifndef _XHDCP22_RX_SW_MMULT_
+	XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Abar, Xbar, (u32 *)RSquare, NDigits);
+#else
+	XHdcp22Rx_Pkcs1MontMultFiosStub(Abar, Xbar, (u32 *)RSquare, N, NPrime, NDigits);
+#endif
 
-	/* Step 3: Binary square and multiply */
-	for(Offset=32*NDigits-1; Offset>=0; Offset--)
+	/* Step 3: Binary square and multiply, the most significant set bit
+	 * gives Xbar = Abar */
+	memcpy(Xbar, Abar, sizeof(Xbar));
+	for(Offset=Offset-1; Offset>=0; Offset--)
 	{
 #ifndef _XHDCP22_RX_SW_MMULT_
 		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Xbar, NDigits);
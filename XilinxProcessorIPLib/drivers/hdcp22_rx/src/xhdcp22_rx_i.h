@@ -23,6 +23,7 @@
 * 1.01  MH   03/02/16 Moved prototype of XHdcp22Rx_CalcMontNPrime to
 *                     to internal functions.
 * 1.02  MH   04/14/16 Updated for repeater upstream support.
+*       fl   10/14/26 Added prototype of XHdcp22Rx_CalcMontRSquare.
 *</pre>
 *
 *****************************************************************************/
@@ -420,6 +421,7 @@ typedef union
 
 /* Crypto Functions */
 int  XHdcp22Rx_CalcMontNPrime(u8 *NPrime, const u8 *N, int NDigits);
+int  XHdcp22Rx_CalcMontRSquare(u8 *RSquare, const u8 *N, int NDigits);
 void XHdcp22Rx_GenerateRandom(XHdcp22_Rx *InstancePtr, int NumOctets, u8* RandomNumberPtr);
 int  XHdcp22Rx_RsaesOaepEncrypt(const XHdcp22_Rx_KpubRx *KpubRx, const u8 *Message,
 			const u32 MessageLen, const u8 *MaskingSeed, u8 *EncryptedMessage);
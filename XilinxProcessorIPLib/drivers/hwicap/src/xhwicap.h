@@ -164,6 +164,8 @@
 *                      function prototypes from the header file.
 * 11.5 Nava   09/30/22 Added new IDCODE's as mentioned in the ug570 Doc.
 * 11.6 Nava   06/28/23 Added support for system device-tree flow.
+* 11.7 fl     10/14/26 Added XHwIcap_DeviceWriteStream to write a stream
+*                      supplied in chunks by a callback.
 *
 * </pre>
 *
@@ -219,6 +221,19 @@ extern "C" {
 typedef void (*XHwIcap_StatusHandler) (void *CallBackRef, u32 StatusEvent,
 				       u32 WordCount);
 
+/**
+ * The chunk handler supplies the configuration stream to
+ * XHwIcap_DeviceWriteStream, for example by reading the next part of a
+ * partial bitstream file into a buffer.
+ *
+ * @param 	CallBackRef is the reference passed to
+ *		XHwIcap_DeviceWriteStream.
+ * @param 	ChunkPtr is set to the words of the next chunk.
+ *
+ * @return	Number of 32 bit words of the chunk, 0 at the end of the stream.
+ */
+typedef u32 (*XHwIcap_ChunkHandler) (void *CallBackRef, u32 **ChunkPtr);
+
 
 /**
  * This typedef contains configuration information for the device.
@@ -679,6 +694,13 @@ int XHwIcap_DeviceWriteFrame(XHwIcap *InstancePtr, long Top,
 			     long MajorFrame, long MinorFrame,
 			     u32 *FrameData);
 
+/*
+ * Functions in the xhwicap_device_write_stream.c
+ */
+int XHwIcap_DeviceWriteStream(XHwIcap *InstancePtr,
+			      XHwIcap_ChunkHandler ChunkHandler,
+			      void *CallBackRef);
+
 /************************** Variable Declarations ***************************/
 
 #ifdef __cplusplus
@@ -0,0 +1,164 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xhwicap_device_write_stream.c
+* @addtogroup hwicap Overview
+* @{
+*
+* This file contains the function that writes a configuration stream supplied
+* in chunks by a callback to the device (ICAP).
+*
+* @note none.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 11.7  fl   10/14/26 First release
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xhwicap.h"
+#include <xil_types.h>
+#include <xil_assert.h>
+
+/************************** Constant Definitions ****************************/
+
+
+/**************************** Type Definitions ******************************/
+
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+
+/************************** Variable Definitions ****************************/
+
+
+/************************** Function Prototypes *****************************/
+
+/****************************************************************************/
+/**
+*
+* Writes a configuration stream, for example a partial bitstream read from a
+* file, to the ICAP device in the polled mode. The stream is requested from
+* the ChunkHandler one chunk at a time until it returns 0 words.
+*
+* The Write FIFO is filled across chunk boundaries, so each transfer from the
+* FIFO to the ICAP moves a full FIFO regardless of the chunk size. The FIFO
+* vacancy is read only once per transfer, after the FIFO has been drained.
+*
+* @param	InstancePtr is a pointer to the XHwIcap instance.
+* @param	ChunkHandler is the function returning the next chunk of the
+*		stream.
+* @param	CallBackRef is passed to the ChunkHandler.
+*
+* @return
+*		- XST_SUCCESS if the whole stream has been written
+*		- XST_FAILURE if the device is busy with the last Read/Write
+*		or a chunk could not be written
+*
+* @note		This is a blocking function. In Lite Mode and for ICAP widths
+*		of 8 and 16 bits every chunk is written with
+*		XHwIcap_DeviceWrite.
+*
+*****************************************************************************/
+int XHwIcap_DeviceWriteStream(XHwIcap *InstancePtr,
+			      XHwIcap_ChunkHandler ChunkHandler,
+			      void *CallBackRef)
+{
+	u32 *ChunkPtr = NULL;
+	u32 NumWords;
+#if (XPAR_HWICAP_0_MODE == 0) && \
+	!((XPAR_HWICAP_0_ICAP_DWIDTH == 8) || (XPAR_HWICAP_0_ICAP_DWIDTH == 16))
+	u32 WrFifoVacancy = 0U;
+	u32 FifoWords = 0U;
+#endif
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(ChunkHandler != NULL);
+
+#if (XPAR_HWICAP_0_MODE == 1) || \
+	(XPAR_HWICAP_0_ICAP_DWIDTH == 8) || (XPAR_HWICAP_0_ICAP_DWIDTH == 16)
+	while ((NumWords = ChunkHandler(CallBackRef, &ChunkPtr)) != 0U) {
+		if (XHwIcap_DeviceWrite(InstancePtr, ChunkPtr,
+					NumWords) != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+#else
+	/*
+	 * Make sure that the last Read/Write by the driver is complete.
+	 */
+	if (XHwIcap_IsTransferDone(InstancePtr) == FALSE) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Check if the ICAP device is Busy with the last Read/Write
+	 */
+	if (XHwIcap_IsDeviceBusy(InstancePtr) == TRUE) {
+		return XST_FAILURE;
+	}
+
+	InstancePtr->IsTransferInProgress = TRUE;
+	XHwIcap_IntrGlobalDisable(InstancePtr);
+
+	while ((NumWords = ChunkHandler(CallBackRef, &ChunkPtr)) != 0U) {
+		while (NumWords > 0U) {
+			if (WrFifoVacancy == 0U) {
+				/*
+				 * Drain the full FIFO to the ICAP before
+				 * refilling it
+				 */
+				if (FifoWords != 0U) {
+					XHwIcap_StartConfig(InstancePtr);
+					while ((XHwIcap_ReadReg(InstancePtr->
+						HwIcapConfig.BaseAddress,
+						XHI_CR_OFFSET)) &
+						XHI_CR_WRITE_MASK);
+					FifoWords = 0U;
+				}
+				WrFifoVacancy =
+					XHwIcap_GetWrFifoVacancy(InstancePtr);
+				if (WrFifoVacancy == 0U) {
+					continue;
+				}
+			}
+
+			while ((WrFifoVacancy != 0U) && (NumWords > 0U)) {
+				XHwIcap_FifoWrite(InstancePtr, *ChunkPtr);
+				ChunkPtr++;
+				NumWords--;
+				WrFifoVacancy--;
+				FifoWords++;
+			}
+		}
+	}
+
+	/*
+	 * Write the last, partially filled FIFO
+	 */
+	if (FifoWords != 0U) {
+		XHwIcap_StartConfig(InstancePtr);
+		while ((XHwIcap_ReadReg(InstancePtr->HwIcapConfig.BaseAddress,
+					XHI_CR_OFFSET)) & XHI_CR_WRITE_MASK);
+	}
+
+	InstancePtr->IsTransferInProgress = FALSE;
+	InstancePtr->RequestedWords = 0x0;
+#endif
+
+	return XST_SUCCESS;
+}
+/** @} */
@@ -21,6 +21,7 @@
 * 1.00 	sd   11/21/21 First release
 * 1.2   sd    2/12/23 Remove the hardcoding devices
 *       	      Copy the input clock
+* 1.3   fl   10/14/26 Clear the IBI handlers
 * </pre>
 *
 ******************************************************************************/
@@ -30,6 +31,7 @@
 #include "xi3cpsx.h"
 #include "xi3cpsx_pr.h"
 #include "sleep.h"
+#include <string.h>
 
 XI3cPsx_Cmd DAA_Cmd[2];
 
@@ -49,6 +51,7 @@ s32 XI3cPsx_CfgInitialize(XI3cPsx *InstancePtr, XI3cPsx_Config *ConfigPtr,
 	InstancePtr->Config.BaseAddress = EffectiveAddr;
 	InstancePtr->Config.DeviceCount = ConfigPtr->DeviceCount;
 	InstancePtr->Config.InputClockHz = ConfigPtr->InputClockHz;
+	(void)memset(InstancePtr->Ibi, 0, sizeof(InstancePtr->Ibi));
 
 	/* Indicate the instance is now ready to use, initialized without error */
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
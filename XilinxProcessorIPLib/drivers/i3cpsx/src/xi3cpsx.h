@@ -69,6 +69,8 @@
 * Ver   Who     Date     Changes
 * ----- ------  -------- -----------------------------------------------
 * 1.00  sd  06/10/22 First release
+* 1.3   fl  10/14/26 Add command queue batches, HDR-DDR transfers and
+*                    in-band interrupts
 * </pre>
 *
 ******************************************************************************/
@@ -128,6 +130,31 @@ extern "C" {
 
 #define XI3CPSX_DATA_LEN			0x00FFU  /**< Data length */
 #define XI3CPSX_TRANSFER_ERROR			0xF0000000U  /**< Error */
+
+#define XI3CPSX_MAX_DEVICES		20U  /**< Device address table entries */
+#define XI3CPSX_MAX_BATCH		16U  /**< Transfers per batch, TID */
+#define XI3CPSX_IBI_MAX_PAYLOAD		32U  /**< IBI bytes passed to handler */
+
+/** @name Transfer modes
+ *
+ * Speed and mode of a batch transfer, the values are those of the speed
+ * field of the transfer command.
+ * @{
+ */
+#define XI3CPSX_MODE_SDR0		0U  /**< SDR, bus SCL rate */
+#define XI3CPSX_MODE_SDR1		1U  /**< SDR, 8 MHz */
+#define XI3CPSX_MODE_SDR2		2U  /**< SDR, 6 MHz */
+#define XI3CPSX_MODE_SDR3		3U  /**< SDR, 4 MHz */
+#define XI3CPSX_MODE_SDR4		4U  /**< SDR, 2 MHz */
+#define XI3CPSX_MODE_HDR_DDR		6U  /**< HDR double data rate */
+/** @} */
+
+/** @name Transfer flags
+ * @{
+ */
+#define XI3CPSX_XFER_READ		0x01U  /**< Read from the target */
+#define XI3CPSX_XFER_CCC		0x02U  /**< Cmd is a CCC code */
+/** @} */
 /**************************** Type Definitions *******************************/
 
 /**
@@ -143,6 +170,18 @@ extern "C" {
 */
 typedef void (*XI3cPsx_IntrHandler) (void *CallBackRef, u32 StatusEvent);
 
+/**
+* The in-band interrupt handler type. It is executed in interrupt context
+* for every IBI the target raises.
+*
+* @param	CallBackRef is the reference given to XI3cPsx_IbiEnable().
+* @param	Payload is the mandatory data byte and the payload of the IBI.
+* @param	Len is the number of payload bytes, at most
+*		XI3CPSX_IBI_MAX_PAYLOAD.
+*/
+typedef void (*XI3cPsx_IbiHandler) (void *CallBackRef, const u8 *Payload,
+				    u16 Len);
+
 /**
  * This typedef contains configuration information for the device.
  */
@@ -177,6 +216,30 @@ struct CmdInfo
 	u8 TxLen;
 	u8 RxLen;
 };
+
+/**
+ * This typedef describes one transfer of a command queue batch, see
+ * XI3cPsx_MasterXferBatch().
+ */
+typedef struct {
+	u8 DevIndex;	/**< Device address table index of the target */
+	u8 Mode;	/**< One of XI3CPSX_MODE_* */
+	u8 Flags;	/**< XI3CPSX_XFER_* flags */
+	u8 Cmd;		/**< CCC code, or HDR-DDR command code */
+	u8 *Buffer;	/**< Data to send, or buffer for the data read */
+	u16 Len;	/**< Bytes to send, or most bytes to read */
+	u16 RxLen;	/**< Bytes read, set by the driver */
+	u8 Error;	/**< RESPONSE_ERROR_* status, set by the driver */
+} XI3cPsx_Xfer;
+
+/**
+ * In-band interrupt handler of one target.
+ */
+typedef struct {
+	XI3cPsx_IbiHandler Handler;	/**< NULL if IBIs are disabled */
+	void *CallBackRef;		/**< Handler reference */
+	u8 DynAddr;			/**< Dynamic address of the target */
+} XI3cPsx_IbiSlot;
 /**
  * The XI3cPsx driver instance data. The user is required to allocate a
  * variable of this type for each IIC device in the system. A pointer
@@ -203,6 +266,8 @@ typedef struct {
 
 	XI3cPsx_IntrHandler StatusHandler;  /**< Event handler function */
 	void *CallBackRef;	/**< Callback reference for event handler */
+
+	XI3cPsx_IbiSlot Ibi[XI3CPSX_MAX_DEVICES]; /**< IBI handlers */
 } XI3cPsx;
 
 /************************** Variable Definitions *****************************/
@@ -301,6 +366,17 @@ s32 XI3cPsx_MasterRecvPolled(XI3cPsx *InstancePtr, u8 *MsgPtr, s32 ByteCount,
 		 XI3cPsx_Cmd *Cmd);
 void XI3cPsx_MasterInterruptHandler(XI3cPsx *InstancePtr);
 
+/*
+ * Functions for command queue batches and in-band interrupts,
+ * in xi3cpsx_ibi.c
+ */
+s32 XI3cPsx_MasterXferBatch(XI3cPsx *InstancePtr, XI3cPsx_Xfer *Xfers,
+			    u32 NumXfers);
+s32 XI3cPsx_IbiEnable(XI3cPsx *InstancePtr, u8 DevIndex,
+		      XI3cPsx_IbiHandler Handler, void *CallBackRef);
+s32 XI3cPsx_IbiDisable(XI3cPsx *InstancePtr, u8 DevIndex);
+void XI3cPsx_IbiService(XI3cPsx *InstancePtr);
+
 /*
  * Functions for device as slave, in XI3cPsx_slave.c
  */
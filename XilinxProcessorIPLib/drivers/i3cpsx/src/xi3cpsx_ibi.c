@@ -0,0 +1,538 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xi3cpsx_ibi.c
+* @addtogroup Overview
+* @{
+*
+* Handles command queue batches, HDR-DDR transfers and in-band interrupts.
+*
+* A batch writes the data and the commands of several transfers to the
+* queues at once, the controller runs them back to back and the responses
+* are read in bulk, matched to the transfers by their TID. IBIs are taken
+* from the IBI queue and passed to the handler of the target that raised
+* them.
+*
+* <pre> MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---  -------- ---------------------------------------------
+* 1.3   fl  10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xi3cpsx.h"
+#include "xi3cpsx_pr.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define BATCH_MAX_LOOPCNT 1000000U	/**< Response polls of a batch */
+
+#define IBI_INTR_MASK	XI3CPSX_INTR_STATUS_EN_IBI_THLD_STS_EN_MASK /**< IBI */
+
+/************************** Function Prototypes ******************************/
+
+static void XI3cPsx_WrData(XI3cPsx *InstancePtr, const u8 *Buf, u16 Len);
+static void XI3cPsx_RdData(UINTPTR BaseAddress, u32 Port, u8 *Buf,
+			   u16 Len, u16 Keep);
+static void XI3cPsx_BatchAbort(XI3cPsx *InstancePtr);
+static s32 XI3cPsx_SetEvents(XI3cPsx *InstancePtr, u8 DevIndex, u8 Cmd);
+
+/************************* Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* This function writes bytes to the TX FIFO, four bytes per word, the first
+* byte in the low byte.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	Buf is the data.
+* @param	Len is the number of bytes.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void XI3cPsx_WrData(XI3cPsx *InstancePtr, const u8 *Buf, u16 Len)
+{
+	u32 Val;
+	u16 i;
+
+	for (i = 0; i < Len; i += 4U) {
+		Val = Buf[i];
+		if ((i + 1U) < Len) {
+			Val |= (u32)Buf[i + 1U] << 8;
+		}
+		if ((i + 2U) < Len) {
+			Val |= (u32)Buf[i + 2U] << 16;
+		}
+		if ((i + 3U) < Len) {
+			Val |= (u32)Buf[i + 3U] << 24;
+		}
+		XI3cPsx_WriteReg(InstancePtr->Config.BaseAddress,
+				 XI3CPSX_TX_RX_DATA_PORT, Val);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function reads bytes from a word FIFO port. All the words of Len
+* bytes are read, the bytes past Keep are dropped.
+*
+* @param	BaseAddress is the base address of the device.
+* @param	Port is the FIFO port.
+* @param	Buf is the buffer for Keep bytes.
+* @param	Len is the number of bytes in the FIFO.
+* @param	Keep is the number of bytes to store, up to Len.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void XI3cPsx_RdData(UINTPTR BaseAddress, u32 Port, u8 *Buf,
+			   u16 Len, u16 Keep)
+{
+	u32 Val;
+	u16 i;
+	u16 j;
+
+	for (i = 0; i < Len; i += 4U) {
+		Val = XI3cPsx_ReadReg(BaseAddress, Port);
+		for (j = i; (j < (i + 4U)) && (j < Keep); j++) {
+			Buf[j] = (u8)(Val >> (8U * (j - i)));
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function clears the queues after a failed batch and lets the
+* controller leave the halt state. The commands after the failed one are
+* dropped.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void XI3cPsx_BatchAbort(XI3cPsx *InstancePtr)
+{
+	u32 Reg;
+
+	XI3cPsx_ResetFifos(InstancePtr);
+
+	Reg = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+			      XI3CPSX_DEVICE_CTRL);
+	Reg = Reg | XI3CPSX_DEVICE_CTRL_RESUME_MASK;
+	XI3cPsx_WriteReg(InstancePtr->Config.BaseAddress, XI3CPSX_DEVICE_CTRL,
+			 Reg);
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function runs a batch of transfers in polled mode. The data of all
+* the writes and the commands of all the transfers are queued first, then
+* the controller runs them back to back with repeated starts and the
+* responses are read as they arrive.
+*
+* SDR transfers with the XI3CPSX_XFER_CCC flag send the CCC Cmd, the other
+* SDR transfers are private transfers. HDR-DDR transfers always send the
+* HDR command Cmd, read commands are 0x80 to 0xFF. The controller enters
+* and exits HDR-DDR mode by itself.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	Xfers is the array of transfers. RxLen and Error of every
+*		transfer are set on return.
+* @param	NumXfers is the number of transfers, up to XI3CPSX_MAX_BATCH.
+*
+* @return
+*		- XST_SUCCESS if all the transfers completed.
+*		- XST_BUFFER_TOO_SMALL if the batch does not fit in the free
+*		space of the command queue or the TX FIFO, nothing is sent.
+*		- XST_FAILURE if a transfer failed or timed out. The transfers
+*		after it are not run and their Error is
+*		RESPONSE_ERROR_TRANSF_ABORT.
+*
+* @note		The data of every read must fit in the RX FIFO. The batch
+*		must not be mixed with interrupt mode transfers.
+*
+****************************************************************************/
+s32 XI3cPsx_MasterXferBatch(XI3cPsx *InstancePtr, XI3cPsx_Xfer *Xfers,
+			    u32 NumXfers)
+{
+	UINTPTR BaseAddress;
+	XI3cPsx_Xfer *XferPtr;
+	u32 TxWords = 0;
+	u32 Level;
+	u32 Resp;
+	u32 Arg;
+	u32 Cmd;
+	u32 Done = 0;
+	u32 LoopCnt = 0;
+	u32 i;
+	u16 RxLen;
+	s32 Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Xfers != NULL);
+	Xil_AssertNonvoid((NumXfers > 0U) && (NumXfers <= XI3CPSX_MAX_BATCH));
+
+	BaseAddress = InstancePtr->Config.BaseAddress;
+
+	for (i = 0; i < NumXfers; i++) {
+		XferPtr = &Xfers[i];
+		Xil_AssertNonvoid(XferPtr->DevIndex < XI3CPSX_MAX_DEVICES);
+		Xil_AssertNonvoid((XferPtr->Mode <= XI3CPSX_MODE_SDR4) ||
+				  (XferPtr->Mode == XI3CPSX_MODE_HDR_DDR));
+		Xil_AssertNonvoid((XferPtr->Buffer != NULL) ||
+				  (XferPtr->Len == 0U));
+		if (XferPtr->Mode == XI3CPSX_MODE_HDR_DDR) {
+			/* HDR-DDR moves 16 bit words */
+			Xil_AssertNonvoid((XferPtr->Len & 1U) == 0U);
+			Xil_AssertNonvoid(((XferPtr->Cmd & I3C_CCC_DIRECT) != 0U) ==
+					  ((XferPtr->Flags & XI3CPSX_XFER_READ) != 0U));
+		}
+
+		XferPtr->RxLen = 0;
+		XferPtr->Error = RESPONSE_ERROR_TRANSF_ABORT;
+		if ((XferPtr->Flags & XI3CPSX_XFER_READ) == 0U) {
+			TxWords += XI3CPSX_CEIL_DIV((u32)XferPtr->Len, 4U);
+		}
+	}
+
+	/* Every command takes two queue locations */
+	Level = XI3cPsx_ReadReg(BaseAddress, XI3CPSX_QUEUE_STATUS_LEVEL);
+	if ((Level & XI3CPSX_QUEUE_STATUS_LEVEL_CMD_QUEUE_EMPTY_LOC_MASK) <
+	    (2U * NumXfers)) {
+		return XST_BUFFER_TOO_SMALL;
+	}
+	Level = XI3cPsx_ReadReg(BaseAddress, XI3CPSX_DATA_BUFFER_STATUS_LEVEL);
+	if ((Level & XI3CPSX_DATA_BUFFER_STATUS_LEVEL_TX_BUF_EMPTY_LOC_MASK) <
+	    TxWords) {
+		return XST_BUFFER_TOO_SMALL;
+	}
+
+	/* The TX FIFO is used in the order of the commands */
+	for (i = 0; i < NumXfers; i++) {
+		XferPtr = &Xfers[i];
+		if ((XferPtr->Flags & XI3CPSX_XFER_READ) == 0U) {
+			XI3cPsx_WrData(InstancePtr, XferPtr->Buffer,
+				       XferPtr->Len);
+		}
+	}
+
+	for (i = 0; i < NumXfers; i++) {
+		XferPtr = &Xfers[i];
+		Arg = COMMAND_PORT_ARG_DATA_LEN((u32)XferPtr->Len) |
+		      COMMAND_PORT_TRANSFER_ARG;
+		Cmd = COMMAND_PORT_SPEED((u32)XferPtr->Mode) |
+		      COMMAND_PORT_DEV_INDEX((u32)XferPtr->DevIndex) |
+		      COMMAND_PORT_TID(i) | COMMAND_PORT_ROC;
+		if ((XferPtr->Mode == XI3CPSX_MODE_HDR_DDR) ||
+		    ((XferPtr->Flags & XI3CPSX_XFER_CCC) != 0U)) {
+			Cmd |= COMMAND_PORT_CP |
+			       COMMAND_PORT_CMD((u32)XferPtr->Cmd);
+		}
+		if ((XferPtr->Flags & XI3CPSX_XFER_READ) != 0U) {
+			Cmd |= COMMAND_PORT_READ_TRANSFER;
+		}
+		if ((i + 1U) == NumXfers) {
+			Cmd |= COMMAND_PORT_TOC;
+		}
+		XI3cPsx_WriteReg(BaseAddress, XI3CPSX_COMMAND_QUEUE_PORT, Arg);
+		XI3cPsx_WriteReg(BaseAddress, XI3CPSX_COMMAND_QUEUE_PORT, Cmd);
+	}
+
+	/*
+	 * Read the responses as they arrive, so that the RX FIFO is drained
+	 * between the reads of the batch.
+	 */
+	while (Done < NumXfers) {
+		Level = XI3cPsx_ReadReg(BaseAddress, XI3CPSX_QUEUE_STATUS_LEVEL);
+		Level = (Level & XI3CPSX_QUEUE_STATUS_LEVEL_RESP_BUF_BLR_MASK) >>
+			XI3CPSX_QUEUE_STATUS_LEVEL_RESP_BUF_BLR_SHIFT;
+		if (Level == 0U) {
+			LoopCnt++;
+			if (LoopCnt == BATCH_MAX_LOOPCNT) {
+				Status = XST_FAILURE;
+				break;
+			}
+			continue;
+		}
+
+		for (; Level > 0U; Level--) {
+			Resp = XI3cPsx_ReadReg(BaseAddress,
+					       XI3CPSX_RESPONSE_QUEUE_PORT);
+			i = RESPONSE_PORT_TID(Resp);
+			if (i >= NumXfers) {
+				Status = XST_FAILURE;
+				break;
+			}
+			XferPtr = &Xfers[i];
+			XferPtr->Error = (u8)RESPONSE_PORT_ERR_STATUS(Resp);
+			RxLen = (u16)RESPONSE_PORT_DATA_LEN(Resp);
+			if ((XferPtr->Flags & XI3CPSX_XFER_READ) != 0U) {
+				XferPtr->RxLen = (RxLen < XferPtr->Len) ?
+						 RxLen : XferPtr->Len;
+				XI3cPsx_RdData(BaseAddress,
+					       XI3CPSX_TX_RX_DATA_PORT,
+					       XferPtr->Buffer, RxLen,
+					       XferPtr->RxLen);
+			}
+			Done++;
+			if (XferPtr->Error != RESPONSE_NO_ERROR) {
+				Status = XST_FAILURE;
+				break;
+			}
+		}
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+	}
+
+	if (Status != XST_SUCCESS) {
+		XI3cPsx_BatchAbort(InstancePtr);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* This function sends the ENEC or DISEC CCC with the SIR event to one
+* target.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	DevIndex is the device address table index of the target.
+* @param	Cmd is I3C_CCC_ENEC(FALSE) or I3C_CCC_DISEC(FALSE).
+*
+* @return
+*		- XST_SUCCESS if the target acknowledged the CCC.
+*		- XST_FAILURE otherwise.
+*
+* @note		None.
+*
+****************************************************************************/
+static s32 XI3cPsx_SetEvents(XI3cPsx *InstancePtr, u8 DevIndex, u8 Cmd)
+{
+	XI3cPsx_Xfer Xfer;
+	u8 Events = (u8)I3C_CCC_EVENT_SIR;
+
+	Xfer.DevIndex = DevIndex;
+	Xfer.Mode = XI3CPSX_MODE_SDR0;
+	Xfer.Flags = XI3CPSX_XFER_CCC;
+	Xfer.Cmd = Cmd;
+	Xfer.Buffer = &Events;
+	Xfer.Len = 1;
+
+	if (XI3cPsx_MasterXferBatch(InstancePtr, &Xfer, 1) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function enables the in-band interrupts of one target. The target
+* is allowed to raise IBIs with the ENEC CCC, the controller accepts them
+* and Handler is called for each of them from XI3cPsx_IbiService().
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	DevIndex is the device address table index of the target.
+* @param	Handler is the IBI handler of the target.
+* @param	CallBackRef is passed to Handler.
+*
+* @return
+*		- XST_SUCCESS if IBIs are enabled.
+*		- XST_DEVICE_NOT_FOUND if the entry has no dynamic address.
+*		- XST_FAILURE if the target did not acknowledge ENEC.
+*
+* @note		The IBI threshold interrupt is enabled, connect
+*		XI3cPsx_MasterInterruptHandler() or call XI3cPsx_IbiService()
+*		to take the IBIs.
+*
+****************************************************************************/
+s32 XI3cPsx_IbiEnable(XI3cPsx *InstancePtr, u8 DevIndex,
+		      XI3cPsx_IbiHandler Handler, void *CallBackRef)
+{
+	UINTPTR BaseAddress;
+	u32 Reg;
+	u8 DynAddr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(DevIndex < XI3CPSX_MAX_DEVICES);
+	Xil_AssertNonvoid(Handler != NULL);
+
+	BaseAddress = InstancePtr->Config.BaseAddress;
+
+	/* The dynamic address field holds the parity in its top bit */
+	Reg = XI3cPsx_ReadReg(BaseAddress, DEV_ADDR_TABLE_LOC((u32)DevIndex));
+	DynAddr = (u8)(((Reg & XI3CPSX_DEV_ADDR_TABLE_LOC1_DEV_DYNAMIC_ADDR_MASK) >>
+		       XI3CPSX_DEV_ADDR_TABLE_LOC1_DEV_DYNAMIC_ADDR_SHIFT) & 0x7FU);
+	if (DynAddr == 0U) {
+		return XST_DEVICE_NOT_FOUND;
+	}
+
+	InstancePtr->Ibi[DevIndex].CallBackRef = CallBackRef;
+	InstancePtr->Ibi[DevIndex].DynAddr = DynAddr;
+	InstancePtr->Ibi[DevIndex].Handler = Handler;
+
+	Reg = XI3cPsx_ReadReg(BaseAddress, XI3CPSX_IBI_SIR_REQ_REJECT);
+	Reg &= ~BIT(IBI_SIR_REQ_ID((u32)DynAddr));
+	XI3cPsx_WriteReg(BaseAddress, XI3CPSX_IBI_SIR_REQ_REJECT, Reg);
+
+	Reg = XI3cPsx_ReadReg(BaseAddress, XI3CPSX_INTR_STATUS_EN);
+	XI3cPsx_WriteReg(BaseAddress, XI3CPSX_INTR_STATUS_EN,
+			 Reg | IBI_INTR_MASK);
+	Reg = XI3cPsx_ReadReg(BaseAddress, XI3CPSX_INTR_SIGNAL_EN);
+	XI3cPsx_WriteReg(BaseAddress, XI3CPSX_INTR_SIGNAL_EN,
+			 Reg | IBI_INTR_MASK);
+
+	if (XI3cPsx_SetEvents(InstancePtr, DevIndex,
+			      (u8)I3C_CCC_ENEC(FALSE)) != XST_SUCCESS) {
+		(void)XI3cPsx_IbiDisable(InstancePtr, DevIndex);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function disables the in-band interrupts of one target with the
+* DISEC CCC, the IBIs it still raises are rejected by the controller.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	DevIndex is the device address table index of the target.
+*
+* @return
+*		- XST_SUCCESS if the target acknowledged DISEC.
+*		- XST_FAILURE otherwise, the IBIs are rejected anyway.
+*
+* @note		The reject bit of the controller is shared by the addresses
+*		with the same IBI_SIR_REQ_ID(), it is only set once none of
+*		them has a handler.
+*
+****************************************************************************/
+s32 XI3cPsx_IbiDisable(XI3cPsx *InstancePtr, u8 DevIndex)
+{
+	UINTPTR BaseAddress;
+	u32 Reg;
+	u32 Id;
+	u32 i;
+	u8 DynAddr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(DevIndex < XI3CPSX_MAX_DEVICES);
+
+	BaseAddress = InstancePtr->Config.BaseAddress;
+	DynAddr = InstancePtr->Ibi[DevIndex].DynAddr;
+
+	InstancePtr->Ibi[DevIndex].Handler = NULL;
+	if (DynAddr == 0U) {
+		return XST_SUCCESS;
+	}
+
+	Id = IBI_SIR_REQ_ID((u32)DynAddr);
+	for (i = 0; i < XI3CPSX_MAX_DEVICES; i++) {
+		if ((InstancePtr->Ibi[i].Handler != NULL) &&
+		    (IBI_SIR_REQ_ID((u32)InstancePtr->Ibi[i].DynAddr) == Id)) {
+			break;
+		}
+	}
+	if (i == XI3CPSX_MAX_DEVICES) {
+		Reg = XI3cPsx_ReadReg(BaseAddress, XI3CPSX_IBI_SIR_REQ_REJECT);
+		XI3cPsx_WriteReg(BaseAddress, XI3CPSX_IBI_SIR_REQ_REJECT,
+				 Reg | BIT(Id));
+	}
+
+	return XI3cPsx_SetEvents(InstancePtr, DevIndex,
+				 (u8)I3C_CCC_DISEC(FALSE));
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function takes all the IBIs from the IBI queue and calls the handler
+* of the target that raised each of them. IBIs of targets without a handler
+* and IBIs the controller did not acknowledge are dropped.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+*
+* @return	None.
+*
+* @note		It is called from XI3cPsx_MasterInterruptHandler() on the IBI
+*		threshold interrupt, and may be polled instead.
+*
+****************************************************************************/
+void XI3cPsx_IbiService(XI3cPsx *InstancePtr)
+{
+	UINTPTR BaseAddress;
+	XI3cPsx_IbiSlot *SlotPtr;
+	u8 Payload[XI3CPSX_IBI_MAX_PAYLOAD];
+	u32 Count;
+	u32 Status;
+	u32 Addr;
+	u32 i;
+	u16 Len;
+	u16 Keep;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	BaseAddress = InstancePtr->Config.BaseAddress;
+
+	Count = XI3cPsx_ReadReg(BaseAddress, XI3CPSX_QUEUE_STATUS_LEVEL);
+	Count = (Count & XI3CPSX_QUEUE_STATUS_LEVEL_IBI_STS_CNT_MASK) >>
+		XI3CPSX_QUEUE_STATUS_LEVEL_IBI_STS_CNT_SHIFT;
+
+	for (; Count > 0U; Count--) {
+		Status = XI3cPsx_ReadReg(BaseAddress, XI3CPSX_IBI_QUEUE_STATUS);
+		Addr = IBI_QUEUE_STATUS_ADDR(Status);
+		Len = (u16)IBI_QUEUE_STATUS_DATA_LEN(Status);
+		Keep = (Len < XI3CPSX_IBI_MAX_PAYLOAD) ? Len :
+		       (u16)XI3CPSX_IBI_MAX_PAYLOAD;
+
+		/* The payload follows its status in the same queue */
+		XI3cPsx_RdData(BaseAddress, XI3CPSX_IBI_QUEUE_STATUS, Payload,
+			       Len, Keep);
+
+		if (IBI_QUEUE_STATUS_IBI_NACK(Status) ||
+		    !IBI_QUEUE_STATUS_RNW(Status)) {
+			continue;
+		}
+
+		for (i = 0; i < XI3CPSX_MAX_DEVICES; i++) {
+			SlotPtr = &InstancePtr->Ibi[i];
+			if ((SlotPtr->Handler != NULL) &&
+			    ((u32)SlotPtr->DynAddr == Addr)) {
+				SlotPtr->Handler(SlotPtr->CallBackRef, Payload,
+						 Keep);
+				break;
+			}
+		}
+	}
+}
+/** @} */
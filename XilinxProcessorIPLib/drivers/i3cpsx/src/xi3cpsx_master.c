@@ -19,6 +19,7 @@
 * ----- ---  -------- ---------------------------------------------
 * 1.00  sd  06/10/22 First release
 * 1.01  sd  12/14/22 Fix warnings
+* 1.3   fl  10/14/26 Service in-band interrupts
 * </pre>
 *
 ******************************************************************************/
@@ -454,6 +455,13 @@ void XI3cPsx_MasterInterruptHandler(XI3cPsx *InstancePtr)
 	 */
 	XI3cPsx_WriteReg(InstancePtr->Config.BaseAddress, (u32)XI3CPSX_INTR_STATUS, IntrStatusReg);
 
+	if (IntrStatusReg & XI3CPSX_INTR_STATUS_IBI_THLD_STS_MASK) {
+		XI3cPsx_IbiService(InstancePtr);
+		if (!(IntrStatusReg & ~XI3CPSX_INTR_STATUS_IBI_THLD_STS_MASK)) {
+			return;
+		}
+	}
+
 	Rbuf_level = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
 					XI3CPSX_QUEUE_STATUS_LEVEL);
 
@@ -115,6 +115,16 @@
 #define RESPONSE_PORT_TID(x)		(((x) & GENMASK(27, 24)) >> 24)
 #define RESPONSE_PORT_DATA_LEN(x)	((x) & 0xFFFF)
 
+#define IBI_QUEUE_STATUS_IBI_NACK(x)	(((x) & GENMASK(31, 28)) != 0U)
+#define IBI_QUEUE_STATUS_ADDR(x)	(((x) & GENMASK(15, 9)) >> 9)
+#define IBI_QUEUE_STATUS_RNW(x)		(((x) & BIT(8)) != 0U)
+#define IBI_QUEUE_STATUS_DATA_LEN(x)	((x) & GENMASK(7, 0))
+#define IBI_SIR_REQ_ID(x)		((((x) & GENMASK(6, 5)) >> 5) + \
+					 ((x) & GENMASK(4, 0)))
+
+#define DEV_ADDR_TABLE_LOC(x)		(XI3CPSX_DEV_ADDR_TABLE_LOC1 + \
+					 ((x) * 4U))
+
 
 #define SCL_I3C_TIMING_HCNT(x)		(((x) << 16) & GENMASK(23, 16))
 #define SCL_I3C_TIMING_LCNT(x)		((x) & GENMASK(7, 0))
@@ -33,6 +33,7 @@
 * 3.11  sd	02/06/20 Added clocking support.
 * 3.11  rna	02/11/20 Moved XIicPs_Reset to xiicps_hw.c
 * 3.18  gm	07/14/23 Added SDT support.
+* 3.19  fl	10/14/26 Initialize the transaction queue.
 *
 * </pre>
 *
@@ -127,6 +128,10 @@ s32 XIicPs_CfgInitialize(XIicPs *InstancePtr, XIicPs_Config *ConfigPtr,
 	/* Initialize repeated start flag to 0 */
 	InstancePtr->IsRepeatedStart = 0;
 
+	InstancePtr->TxnHead = NULL;
+	InstancePtr->TxnTail = NULL;
+	InstancePtr->TxnActive = 0U;
+
 	return (s32)XST_SUCCESS;
 }
 
@@ -177,6 +177,7 @@
 * 		      Added support for clock stretching and timeout support.
 * 3.18  gm   07/14/23 Added SDT support.
 * 	sd   09/06/23 Compile refclk for SDT
+* 3.19  fl   10/14/26 Added master transaction queue, XIicPs_MasterSubmit.
 *
 * </pre>
 *
@@ -238,6 +239,17 @@ extern "C" {
 #define XIICPS_EVENT_RX_UNF			0x0200U  /**< RX underflow */
 /** @} */
 
+/** @name Transaction segment flags
+ *
+ * Flags of an XIicPs_Segment, see XIicPs_MasterSubmit().
+ *
+ * @{
+ */
+#define XIICPS_SEG_READ			0x01U  /**< Read, else write */
+#define XIICPS_SEG_REP_START		0x02U  /**< Last segment only, keep the
+						 *  bus for the next transaction */
+/** @} */
+
 /** name Role constants
  *
  * These constants are used to pass into the device setup routines to
@@ -264,6 +276,30 @@ extern "C" {
 */
 typedef void (*XIicPs_IntrHandler) (void *CallBackRef, u32 StatusEvent);
 
+/**
+ * One write or read of a transaction.
+ */
+typedef struct {
+	u8 *BufferPtr;		/**< Data to send or receive buffer */
+	s32 ByteCount;		/**< Number of bytes */
+	u32 Flags;		/**< XIICPS_SEG_* flags */
+} XIicPs_Segment;
+
+/**
+ * A master transaction, segments to one slave joined with repeated starts.
+ * The user fills in the fields up to CallBackRef and passes the transaction
+ * to XIicPs_MasterSubmit().
+ */
+typedef struct XIicPs_TxnS {
+	u16 SlaveAddr;			/**< Slave address */
+	XIicPs_Segment *Segments;	/**< Segments, in bus order */
+	u32 NumSegments;		/**< Number of segments */
+	XIicPs_IntrHandler Handler;	/**< Completion handler, optional */
+	void *CallBackRef;		/**< Passed to the handler */
+	struct XIicPs_TxnS *Next;	/**< Driver use, next queued */
+	u32 CurrSegment;		/**< Driver use, segment on the bus */
+} XIicPs_Txn;
+
 /**
  * This typedef contains configuration information for the device.
  */
@@ -313,6 +349,11 @@ typedef struct {
 	u32 IsClkEnabled;	/**< Input clock enabled */
 #endif
 	void *CallBackRef;	/**< Callback reference for event handler */
+
+	XIicPs_Txn *TxnHead;	/**< Transaction on the bus */
+	XIicPs_Txn *TxnTail;	/**< Last queued transaction */
+	u32 TxnActive;		/**< Transaction queue is running */
+	s32 TxnRepStart;	/**< Repeated start option of the user */
 } XIicPs;
 
 /************************** Variable Definitions *****************************/
@@ -432,6 +473,11 @@ void XIicPs_DisableSlaveMonitor(XIicPs *InstancePtr);
 void XIicPs_MasterInterruptHandler(XIicPs *InstancePtr);
 /** @} */
 
+/**
+ * Functions for the master transaction queue, in xiicps_txn.c
+ */
+s32 XIicPs_MasterSubmit(XIicPs *InstancePtr, XIicPs_Txn *TxnPtr);
+
 /**
  * Functions for device as slave, in xiicps_slave.c
  * @{
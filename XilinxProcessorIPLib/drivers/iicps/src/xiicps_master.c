@@ -54,6 +54,7 @@
 *	rna 05/24/21 Fix Misra c violations
 * 3.18 gm  08/11/23 Update Receive Polled and Interrupt Handler functions
 * 		     as modular.
+* 3.19 fl  10/14/26 Pass events to the transaction queue when it is running.
 * </pre>
 *
 ******************************************************************************/
@@ -818,11 +819,16 @@ void XIicPs_MasterInterruptHandler(XIicPs *InstancePtr)
 	}
 
 	/*
-	 * Signal application if there are any events.
+	 * Signal application if there are any events, queued transactions
+	 * move on to their next segment instead.
 	 */
 	if (StatusEvent != 0U) {
-		InstancePtr->StatusHandler(InstancePtr->CallBackRef,
-					   StatusEvent);
+		if (InstancePtr->TxnActive != 0U) {
+			XIicPs_TxnEvent(InstancePtr, StatusEvent);
+		} else {
+			InstancePtr->StatusHandler(InstancePtr->CallBackRef,
+						   StatusEvent);
+		}
 	}
 
 }
@@ -0,0 +1,293 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xiicps_txn.c
+* @addtogroup iicps Overview
+* @{
+*
+* The xiicps_txn.c file contains the master transaction queue. A transaction
+* is a list of write and read segments to one slave, the segments are joined
+* with repeated starts and the queue is run from
+* XIicPs_MasterInterruptHandler(), so a register read (write the register
+* address, repeated start, read the data) needs no help from the application
+* between the segments.
+*
+* <pre> MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---  -------- ---------------------------------------------
+* 3.19  fl   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xiicps.h"
+#include "xiicps_xfer.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define TXN_BUS_LOOPCNT		10000U	/**< Bus free polls before a start */
+
+#define TXN_ERROR_EVENTS	(XIICPS_EVENT_TIME_OUT | XIICPS_EVENT_ERROR | \
+				 XIICPS_EVENT_ARB_LOST | XIICPS_EVENT_NACK | \
+				 XIICPS_EVENT_RX_OVR | XIICPS_EVENT_TX_OVR | \
+				 XIICPS_EVENT_RX_UNF) /**< Transaction failed */
+
+/************************** Function Prototypes ******************************/
+
+static void XIicPs_TxnStartSegment(XIicPs *InstancePtr);
+static s32 XIicPs_TxnStart(XIicPs *InstancePtr);
+static void XIicPs_TxnComplete(XIicPs *InstancePtr, u32 StatusEvent);
+static void XIicPs_TxnRun(XIicPs *InstancePtr);
+
+/************************* Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* This function starts the current segment of the transaction at the head of
+* the queue. All segments but the last one, and the last one if it has the
+* XIICPS_SEG_REP_START flag, keep the bus with the hold bit.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void XIicPs_TxnStartSegment(XIicPs *InstancePtr)
+{
+	XIicPs_Txn *TxnPtr = InstancePtr->TxnHead;
+	XIicPs_Segment *SegPtr = &TxnPtr->Segments[TxnPtr->CurrSegment];
+
+	if (((TxnPtr->CurrSegment + 1U) < TxnPtr->NumSegments) ||
+		((SegPtr->Flags & XIICPS_SEG_REP_START) != 0U)) {
+		InstancePtr->IsRepeatedStart = 1;
+	} else {
+		InstancePtr->IsRepeatedStart = 0;
+	}
+
+	if ((SegPtr->Flags & XIICPS_SEG_READ) != 0U) {
+		XIicPs_MasterRecv(InstancePtr, SegPtr->BufferPtr,
+				  SegPtr->ByteCount, TxnPtr->SlaveAddr);
+	} else {
+		XIicPs_MasterSend(InstancePtr, SegPtr->BufferPtr,
+				  SegPtr->ByteCount, TxnPtr->SlaveAddr);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function starts the transaction at the head of the queue. When the
+* previous transaction ended with a stop, the stop has to be on the bus
+* before the next start.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+*
+* @return
+*		- XST_SUCCESS if the first segment was started.
+*		- XST_FAILURE if the bus stayed busy.
+*
+* @note		None.
+*
+****************************************************************************/
+static s32 XIicPs_TxnStart(XIicPs *InstancePtr)
+{
+	UINTPTR BaseAddr = InstancePtr->Config.BaseAddress;
+	u32 LoopCnt = 0U;
+
+	if ((XIicPs_ReadReg(BaseAddr, XIICPS_CR_OFFSET) &
+			XIICPS_CR_HOLD_MASK) == 0U) {
+		while ((XIicPs_ReadReg(BaseAddr, XIICPS_SR_OFFSET) &
+				XIICPS_SR_BA_MASK) != 0U) {
+			LoopCnt++;
+			if (LoopCnt == TXN_BUS_LOOPCNT) {
+				return (s32)XST_FAILURE;
+			}
+		}
+	}
+
+	InstancePtr->TxnHead->CurrSegment = 0U;
+	XIicPs_TxnStartSegment(InstancePtr);
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function removes the transaction at the head of the queue and calls
+* its handler.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+* @param	StatusEvent is passed to the handler.
+*
+* @return	None.
+*
+* @note		The handler may submit transactions, including the one it was
+*		called for.
+*
+****************************************************************************/
+static void XIicPs_TxnComplete(XIicPs *InstancePtr, u32 StatusEvent)
+{
+	XIicPs_Txn *TxnPtr = InstancePtr->TxnHead;
+
+	InstancePtr->TxnHead = TxnPtr->Next;
+	if (InstancePtr->TxnHead == NULL) {
+		InstancePtr->TxnTail = NULL;
+	}
+
+	if (TxnPtr->Handler != NULL) {
+		TxnPtr->Handler(TxnPtr->CallBackRef, StatusEvent);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function starts the next queued transaction. Transactions that cannot
+* be started complete with XIICPS_EVENT_TIME_OUT. Once the queue is empty the
+* repeated start option of the application is restored.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void XIicPs_TxnRun(XIicPs *InstancePtr)
+{
+	while (InstancePtr->TxnHead != NULL) {
+		if (XIicPs_TxnStart(InstancePtr) == (s32)XST_SUCCESS) {
+			return;
+		}
+		XIicPs_TxnComplete(InstancePtr, XIICPS_EVENT_TIME_OUT);
+	}
+
+	InstancePtr->IsRepeatedStart = InstancePtr->TxnRepStart;
+	InstancePtr->TxnActive = 0U;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function queues a master transaction. The transaction starts at once
+* if the queue is idle, else after the queued ones. Its segments run from the
+* interrupt handler and its handler is called once, from interrupt context,
+* with either XIICPS_EVENT_COMPLETE_SEND or XIICPS_EVENT_COMPLETE_RECV for
+* its last segment, or with the error events that ended it.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+* @param	TxnPtr is a pointer to the transaction. It belongs to the
+*		driver until its handler is called.
+*
+* @return	XST_SUCCESS.
+*
+* @note		Transactions end with a stop unless the last segment has the
+*		XIICPS_SEG_REP_START flag, then the next transaction follows
+*		with a repeated start. The status handler is not called for
+*		transfers of the queue, and the repeated start option must not
+*		be changed while transactions are queued.
+*
+****************************************************************************/
+s32 XIicPs_MasterSubmit(XIicPs *InstancePtr, XIicPs_Txn *TxnPtr)
+{
+	UINTPTR BaseAddr;
+	u32 IntrMask = 0U;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(TxnPtr != NULL);
+	Xil_AssertNonvoid(TxnPtr->Segments != NULL);
+	Xil_AssertNonvoid(TxnPtr->NumSegments > 0U);
+	Xil_AssertNonvoid((u16)XIICPS_ADDR_MASK >= TxnPtr->SlaveAddr);
+
+	BaseAddr = InstancePtr->Config.BaseAddress;
+	TxnPtr->Next = NULL;
+
+	/*
+	 * Keep the interrupt handler out while the queue is updated, it only
+	 * runs with transactions queued.
+	 */
+	if (InstancePtr->TxnActive != 0U) {
+		IntrMask = ~XIicPs_ReadReg(BaseAddr, XIICPS_IMR_OFFSET) &
+				XIICPS_IXR_ALL_INTR_MASK;
+		XIicPs_DisableInterrupts(BaseAddr, IntrMask);
+	}
+
+	if (InstancePtr->TxnTail != NULL) {
+		InstancePtr->TxnTail->Next = TxnPtr;
+	} else {
+		InstancePtr->TxnHead = TxnPtr;
+	}
+	InstancePtr->TxnTail = TxnPtr;
+
+	if (InstancePtr->TxnActive != 0U) {
+		XIicPs_EnableInterrupts(BaseAddr, IntrMask);
+	} else {
+		InstancePtr->TxnActive = 1U;
+		InstancePtr->TxnRepStart = InstancePtr->IsRepeatedStart;
+		XIicPs_TxnRun(InstancePtr);
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function handles the transfer events of the transaction queue. It is
+* invoked from the master interrupt handler in place of the status handler.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+* @param	StatusEvent is the set of XIICPS_EVENT_* events of the transfer.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+void XIicPs_TxnEvent(XIicPs *InstancePtr, u32 StatusEvent)
+{
+	XIicPs_Txn *TxnPtr = InstancePtr->TxnHead;
+	UINTPTR BaseAddr = InstancePtr->Config.BaseAddress;
+	u32 Flags;
+
+	if ((StatusEvent & TXN_ERROR_EVENTS) == 0U) {
+		if ((StatusEvent & (XIICPS_EVENT_COMPLETE_SEND |
+				XIICPS_EVENT_COMPLETE_RECV)) == 0U) {
+			return;
+		}
+		if ((TxnPtr->CurrSegment + 1U) < TxnPtr->NumSegments) {
+			TxnPtr->CurrSegment++;
+			XIicPs_TxnStartSegment(InstancePtr);
+			return;
+		}
+	}
+
+	/*
+	 * Release the bus unless the transaction asked to keep it. A short
+	 * last write was fully in the FIFO, so nothing cleared the hold bit.
+	 */
+	Flags = TxnPtr->Segments[TxnPtr->CurrSegment].Flags;
+	if (((StatusEvent & TXN_ERROR_EVENTS) != 0U) ||
+		((Flags & XIICPS_SEG_REP_START) == 0U)) {
+		XIicPs_WriteReg(BaseAddr, XIICPS_CR_OFFSET,
+				XIicPs_ReadReg(BaseAddr, XIICPS_CR_OFFSET) &
+				(~(u32)XIICPS_CR_HOLD_MASK));
+	}
+
+	XIicPs_TxnComplete(InstancePtr, StatusEvent &
+			   (TXN_ERROR_EVENTS | XIICPS_EVENT_COMPLETE_SEND |
+			    XIICPS_EVENT_COMPLETE_RECV));
+	XIicPs_TxnRun(InstancePtr);
+}
+/** @} */
@@ -22,6 +22,7 @@
 * 3.18  gm      08/25/23 Added function prototypes for XIicPs_MasterPolledRead,
 * 			 XIicPs_MasterIntrSend, XIicPs_MasterIntrRead and
 * 			 XIicPs_MasterRead.
+* 3.19  fl      10/14/26 Added function prototype for XIicPs_TxnEvent.
 * </pre>
 *
 ******************************************************************************/
@@ -121,6 +122,11 @@ void XIicPs_MasterRead(XIicPs *InstancePtr, s32 IsHold, s32 *ByteCntPtr);
  */
 s32 SlaveRecvData(XIicPs *InstancePtr);
 
+/*
+ * This function handles the transfer events of the transaction queue.
+ */
+void XIicPs_TxnEvent(XIicPs *InstancePtr, u32 StatusEvent);
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,6 +68,22 @@
 * tables should not mislead the user into thinking they no longer need to
 * register/connect interrupt handlers with this driver.
 *
+* <b>Fast and Normal Interrupts</b>
+*
+* When the controller is built with fast interrupts, each interrupt of the
+* primary controller is either fast or normal. A fast interrupt, connected
+* with XIntc_ConnectFastHandler(), makes the processor jump to the address
+* programmed in its IVAR register, without any software dispatch. Normal
+* interrupts go through XIntc_DeviceInterruptHandler(), which finds the
+* highest priority pending interrupt with a count zeros instruction instead
+* of testing the pending bits one by one. The latency critical interrupts
+* can so be fast while all others keep their regular handlers.
+*
+* If the driver is compiled with XINTC_DISPATCH_STATS defined, the time from
+* the entry of XIntc_DeviceInterruptHandler() to the call of the handler is
+* recorded per interrupt, see XIntc_SetDispatchTimestamp() and
+* XIntc_GetDispatchStats() in xintc_l.h.
+*
 * <pre>
 * MODIFICATION HISTORY:
 *
@@ -201,6 +217,8 @@
 * 3.11   adk  10/03/20 Fix race condition for designs where interrupt pin is
 *                      connected to cascade slices.
 * 3.13   mus  12/22/20 Updated source code comments. It fixes CR#1080821
+* 3.17   fl   10/14/26 Documented the mixed fast and normal interrupt mode
+*                      and the dispatch statistics.
 * </pre>
 *
 ******************************************************************************/
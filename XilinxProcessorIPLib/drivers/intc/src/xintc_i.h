@@ -50,6 +50,20 @@ extern "C" {
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
+/*
+ * Number of the lowest set bit of a non zero interrupt status, that is of the
+ * highest priority pending interrupt. The compiler uses the count leading
+ * zeros instruction of the processor, on MicroBlaze the one enabled with the
+ * pattern compare instructions.
+ */
+#define XIntc_LowestPending(Status)	((int)__builtin_ctz(Status))
+
+/*
+ * Interrupt status bits of the interrupt sources of a controller.
+ */
+#define XIntc_SourceMask(NumIntrs) \
+	(((NumIntrs) >= 32) ? 0xFFFFFFFFU : ((1U << (NumIntrs)) - 1U))
+
 
 /************************** Function Prototypes ******************************/
 
@@ -60,6 +60,10 @@
 *                     in case of microbalze. It fixes CR#1120158.
 * 3.16  mus  10/04/22 Fixed warnings reported with "-Wundef" compiler flag.
 *                     It fixes CR#1142085.
+* 3.17  fl   10/14/26 Updated XIntc_DeviceInterruptHandler and
+*                     XIntc_CascadeHandler to go to the pending interrupts
+*                     with a count zeros instruction. Added the
+*                     XINTC_DISPATCH_STATS dispatch statistics.
 *
 * </pre>
 *
@@ -83,6 +87,14 @@
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
+#ifdef XINTC_DISPATCH_STATS
+#define XINTC_STATS_ENTRY(Entry) \
+	((Entry) = (XIntc_Timestamp != NULL) ? XIntc_Timestamp() : 0U)
+#define XINTC_STATS_ADD(Id, Entry)	XIntc_StatsAdd((Id), (Entry))
+#else
+#define XINTC_STATS_ENTRY(Entry)
+#define XINTC_STATS_ADD(Id, Entry)
+#endif
 
 /************************** Function Prototypes ******************************/
 
@@ -92,8 +104,21 @@ XIntc_Config *LookupConfigByBaseAddress(UINTPTR BaseAddress);
 static void XIntc_CascadeHandler(void *DeviceId);
 #endif
 
+#ifdef XINTC_DISPATCH_STATS
+static void XIntc_StatsAdd(int Id, u32 Entry);
+#endif
+
 /************************** Variable Definitions *****************************/
 
+#ifdef XINTC_DISPATCH_STATS
+static XIntc_TimestampHandler XIntc_Timestamp;
+static XIntc_DispatchStats XIntc_Stats[XPAR_INTC_MAX_NUM_INTR_INPUTS];
+#if defined (XPAR_INTC_0_INTC_TYPE) && (XPAR_INTC_0_INTC_TYPE != XIN_INTC_NOCASCADE)
+/* Entry time stamp of the cascade handling, it does not nest */
+static u32 XIntc_CascadeEntry;
+#endif
+#endif
+
 #ifdef XPAR_INTC_SINGLE_DEVICE_ID
 /*****************************************************************************/
 /**
@@ -172,10 +197,15 @@ void XIntc_LowLevelInterruptHandler(void)
 void XIntc_DeviceInterruptHandler(void *DeviceId)
 {
 	u32 IntrStatus;
-	u32 IntrMask = 1;
+	u32 IntrMask;
 	int IntrNumber;
 	XIntc_Config *CfgPtr;
 	u32 Imr;
+#ifdef XINTC_DISPATCH_STATS
+	u32 Entry;
+
+	XINTC_STATS_ENTRY(Entry);
+#endif
 
 #if defined(SDT)
 	CfgPtr = LookupConfigByBaseAddress((UINTPTR)DeviceId);
@@ -186,6 +216,9 @@ void XIntc_DeviceInterruptHandler(void *DeviceId)
 
 #if defined (XPAR_INTC_0_INTC_TYPE) && (XPAR_INTC_0_INTC_TYPE != XIN_INTC_NOCASCADE)
 	if (CfgPtr->IntcType != XIN_INTC_NOCASCADE) {
+#ifdef XINTC_DISPATCH_STATS
+		XIntc_CascadeEntry = Entry;
+#endif
 		XIntc_CascadeHandler(DeviceId);
 	} else
 #endif
@@ -210,105 +243,99 @@ void XIntc_DeviceInterruptHandler(void *DeviceId)
 			IntrStatus &=  ~Imr;
 		}
 
-		/* Service each interrupt that is active and enabled by
-		 * checking each bit in the register from LSB to MSB which
-		 * corresponds to an interrupt input signal
+		/* Service each interrupt that is active and enabled, going
+		 * from the lowest set bit, the highest priority interrupt, to
+		 * the highest one
 		 */
-		for (IntrNumber = 0; IntrNumber < (CfgPtr->NumberofIntrs + CfgPtr->NumberofSwIntrs);
-		     IntrNumber++) {
-			if (IntrStatus & 1) {
-				XIntc_VectorTableEntry *TablePtr;
+		IntrStatus &= XIntc_SourceMask(CfgPtr->NumberofIntrs +
+					       CfgPtr->NumberofSwIntrs);
+		while (IntrStatus != 0) {
+			XIntc_VectorTableEntry *TablePtr;
+
+			IntrNumber = XIntc_LowestPending(IntrStatus);
+			IntrMask = XIntc_BitPosMask[IntrNumber];
+			IntrStatus &= ~IntrMask;
+
 #if defined (XPAR_XINTC_HAS_ILR) && (XPAR_XINTC_HAS_ILR == TRUE)
-				/* Write to ILR the current interrupt
-				* number
-				*/
-				Xil_Out32(CfgPtr->BaseAddress +
-					  XIN_ILR_OFFSET, IntrNumber);
+			/* Write to ILR the current interrupt
+			* number
+			*/
+			Xil_Out32(CfgPtr->BaseAddress +
+				  XIN_ILR_OFFSET, IntrNumber);
 
-				/* Read back ILR to ensure the value
-				* has been updated and it is safe to
-				* enable interrupts
-				*/
+			/* Read back ILR to ensure the value
+			* has been updated and it is safe to
+			* enable interrupts
+			*/
 
-				Xil_In32(CfgPtr->BaseAddress +
-					 XIN_ILR_OFFSET);
+			Xil_In32(CfgPtr->BaseAddress +
+				 XIN_ILR_OFFSET);
 
-				/* Enable interrupts */
+			/* Enable interrupts */
 #ifdef __MICROBLAZE__
-				microblaze_enable_interrupts();
+			microblaze_enable_interrupts();
 #else
-				Xil_ExceptionEnable();
+			Xil_ExceptionEnable();
 #endif
 #endif
-				/* If the interrupt has been setup to
-				 * acknowledge it before servicing the
-				 * interrupt, then ack it */
-				if (CfgPtr->AckBeforeService & IntrMask) {
-					XIntc_AckIntr(CfgPtr->BaseAddress,
-						      IntrMask);
-				}
-
-				/* The interrupt is active and enabled, call
-				 * the interrupt handler that was setup with
-				 * the specified parameter
-				 */
-				TablePtr = &(CfgPtr->HandlerTable[IntrNumber]);
-				TablePtr->Handler(TablePtr->CallBackRef);
-
-				/* If the interrupt has been setup to
-				 * acknowledge it after it has been serviced
-				 * then ack it
-				 */
-				if ((CfgPtr->AckBeforeService &
-				     IntrMask) == 0) {
-					XIntc_AckIntr(CfgPtr->BaseAddress,
-						      IntrMask);
-				}
+			/* If the interrupt has been setup to
+			 * acknowledge it before servicing the
+			 * interrupt, then ack it */
+			if (CfgPtr->AckBeforeService & IntrMask) {
+				XIntc_AckIntr(CfgPtr->BaseAddress,
+					      IntrMask);
+			}
+
+			/* The interrupt is active and enabled, call
+			 * the interrupt handler that was setup with
+			 * the specified parameter
+			 */
+			TablePtr = &(CfgPtr->HandlerTable[IntrNumber]);
+			XINTC_STATS_ADD(IntrNumber, Entry);
+			TablePtr->Handler(TablePtr->CallBackRef);
+
+			/* If the interrupt has been setup to
+			 * acknowledge it after it has been serviced
+			 * then ack it
+			 */
+			if ((CfgPtr->AckBeforeService &
+			     IntrMask) == 0) {
+				XIntc_AckIntr(CfgPtr->BaseAddress,
+					      IntrMask);
+			}
 
 #if defined (XPAR_XINTC_HAS_ILR) && (XPAR_XINTC_HAS_ILR == TRUE)
-				/* Disable interrupts */
+			/* Disable interrupts */
 #ifdef __MICROBLAZE__
-				microblaze_disable_interrupts();
+			microblaze_disable_interrupts();
 #else
-				Xil_ExceptionDisable();
+			Xil_ExceptionDisable();
 #endif
-				/* Restore ILR */
-				Xil_Out32(CfgPtr->BaseAddress + XIN_ILR_OFFSET,
-					  ILR_reg);
+			/* Restore ILR */
+			Xil_Out32(CfgPtr->BaseAddress + XIN_ILR_OFFSET,
+				  ILR_reg);
 #endif
-				/*
-				 * Read the ISR again to handle architectures
-				 * with posted write bus access issues.
-				 */
-				(void) XIntc_GetIntrStatus(CfgPtr->BaseAddress);
-
-				/*
-				 * If only the highest priority interrupt is to
-				 * be serviced, exit loop and return after
-				 * servicing
-				 * the interrupt
-				 */
-				if (CfgPtr->Options == XIN_SVC_SGL_ISR_OPTION) {
+			/*
+			 * Read the ISR again to handle architectures
+			 * with posted write bus access issues.
+			 */
+			(void) XIntc_GetIntrStatus(CfgPtr->BaseAddress);
+
+			/*
+			 * If only the highest priority interrupt is to
+			 * be serviced, exit loop and return after
+			 * servicing
+			 * the interrupt
+			 */
+			if (CfgPtr->Options == XIN_SVC_SGL_ISR_OPTION) {
 
 #if defined (XPAR_XINTC_HAS_ILR) && (XPAR_XINTC_HAS_ILR == TRUE)
 #ifdef __MICROBLAZE__
-					/* Restore r14 */
-					mtgpr(r14, R14_register);
+				/* Restore r14 */
+				mtgpr(r14, R14_register);
 #endif
 #endif
-					return;
-				}
-			}
-
-			/* Move	 to the next interrupt to check */
-			IntrMask <<= 1;
-			IntrStatus >>= 1;
-
-			/* If there are no other bits set indicating that all
-			 * interrupts have been serviced, then exit the loop
-			 */
-			if (IntrStatus == 0) {
-				break;
+				return;
 			}
 		}
 #if defined (XPAR_XINTC_HAS_ILR) && (XPAR_XINTC_HAS_ILR == TRUE)
@@ -617,7 +644,7 @@ void XIntc_RegisterFastHandler(UINTPTR BaseAddress, u8 Id,
 static void XIntc_CascadeHandler(void *DeviceId)
 {
 	u32 IntrStatus;
-	u32 IntrMask = 1;
+	u32 IntrMask;
 	int IntrNumber;
 	u32 Imr;
 	XIntc_Config *CfgPtr;
@@ -638,80 +665,183 @@ static void XIntc_CascadeHandler(void *DeviceId)
 		IntrStatus &=  ~Imr;
 	}
 
-	/* Service each interrupt that is active and enabled by
-	 * checking each bit in the register from LSB to MSB which
-	 * corresponds to an interrupt input signal
+	/* Service each interrupt that is active and enabled, going from the
+	 * lowest set bit, the highest priority interrupt, to the highest one
 	 */
-	for (IntrNumber = 0; IntrNumber < (CfgPtr->NumberofIntrs + CfgPtr->NumberofSwIntrs); IntrNumber++) {
-		if (IntrStatus & 1) {
-			XIntc_VectorTableEntry *TablePtr;
-
-			/* In Cascade mode call this function recursively
-			 * for interrupt id 31 and until interrupts of last
-			 * instance/controller are handled
-			 */
-			if ((IntrNumber == 31) &&
-			    (CfgPtr->IntcType != XIN_INTC_LAST) &&
-			    (CfgPtr->IntcType != XIN_INTC_NOCASCADE)) {
-				XIntc_CascadeHandler((void *)++Id);
-				Id--;
-			}
-
-			/* If the interrupt has been setup to
-			 * acknowledge it before servicing the
-			 * interrupt, then ack it */
-			if (CfgPtr->AckBeforeService & IntrMask) {
-				XIntc_AckIntr(CfgPtr->BaseAddress, IntrMask);
-			}
+	IntrStatus &= XIntc_SourceMask(CfgPtr->NumberofIntrs +
+				       CfgPtr->NumberofSwIntrs);
+	while (IntrStatus != 0) {
+		XIntc_VectorTableEntry *TablePtr;
+
+		IntrNumber = XIntc_LowestPending(IntrStatus);
+		IntrMask = XIntc_BitPosMask[IntrNumber];
+		IntrStatus &= ~IntrMask;
+
+		/* In Cascade mode call this function recursively
+		 * for interrupt id 31 and until interrupts of last
+		 * instance/controller are handled
+		 */
+		if ((IntrNumber == 31) &&
+		    (CfgPtr->IntcType != XIN_INTC_LAST) &&
+		    (CfgPtr->IntcType != XIN_INTC_NOCASCADE)) {
+			XIntc_CascadeHandler((void *)++Id);
+			Id--;
+		}
 
-			/* Handler of 31 interrupt Id has to be called only
-			 * for Last controller in cascade Mode
-			 */
-			if (!((IntrNumber == 31) &&
-			      (CfgPtr->IntcType != XIN_INTC_LAST) &&
-			      (CfgPtr->IntcType != XIN_INTC_NOCASCADE))) {
-
-				/* The interrupt is active and enabled, call
-				 * the interrupt handler that was setup with
-				 * the specified parameter
-				 */
-				TablePtr = &(CfgPtr->HandlerTable[IntrNumber]);
-				TablePtr->Handler(TablePtr->CallBackRef);
-			}
-			/* If the interrupt has been setup to acknowledge it
-			 * after it has been serviced then ack it
-			 */
-			if ((CfgPtr->AckBeforeService & IntrMask) == 0) {
-				XIntc_AckIntr(CfgPtr->BaseAddress, IntrMask);
-			}
+		/* If the interrupt has been setup to
+		 * acknowledge it before servicing the
+		 * interrupt, then ack it */
+		if (CfgPtr->AckBeforeService & IntrMask) {
+			XIntc_AckIntr(CfgPtr->BaseAddress, IntrMask);
+		}
 
-			/*
-			 * Read the ISR again to handle architectures with
-			 * posted write bus access issues.
-			 */
-			XIntc_GetIntrStatus(CfgPtr->BaseAddress);
+		/* Handler of 31 interrupt Id has to be called only
+		 * for Last controller in cascade Mode
+		 */
+		if (!((IntrNumber == 31) &&
+		      (CfgPtr->IntcType != XIN_INTC_LAST) &&
+		      (CfgPtr->IntcType != XIN_INTC_NOCASCADE))) {
 
-			/*
-			 * If only the highest priority interrupt is to be
-			 * serviced, exit loop and return after servicing
-			 * the interrupt
+			/* The interrupt is active and enabled, call
+			 * the interrupt handler that was setup with
+			 * the specified parameter
 			 */
-			if (CfgPtr->Options == XIN_SVC_SGL_ISR_OPTION) {
-				return;
-			}
+			TablePtr = &(CfgPtr->HandlerTable[IntrNumber]);
+			XINTC_STATS_ADD((Id * XIN_CONTROLLER_MAX_INTRS) +
+					IntrNumber, XIntc_CascadeEntry);
+			TablePtr->Handler(TablePtr->CallBackRef);
+		}
+		/* If the interrupt has been setup to acknowledge it
+		 * after it has been serviced then ack it
+		 */
+		if ((CfgPtr->AckBeforeService & IntrMask) == 0) {
+			XIntc_AckIntr(CfgPtr->BaseAddress, IntrMask);
 		}
 
-		/* Move	 to the next interrupt to check */
-		IntrMask <<= 1;
-		IntrStatus >>= 1;
+		/*
+		 * Read the ISR again to handle architectures with
+		 * posted write bus access issues.
+		 */
+		XIntc_GetIntrStatus(CfgPtr->BaseAddress);
 
-		/* If there are no other bits set indicating that all interrupts
-		 * have been serviced, then exit the loop
+		/*
+		 * If only the highest priority interrupt is to be
+		 * serviced, exit loop and return after servicing
+		 * the interrupt
 		 */
-		if (IntrStatus == 0) {
-			break;
+		if (CfgPtr->Options == XIN_SVC_SGL_ISR_OPTION) {
+			return;
 		}
 	}
 }
 #endif
+
+#ifdef XINTC_DISPATCH_STATS
+/*****************************************************************************/
+/**
+*
+* Sets the time stamp function of the dispatch statistics. The statistics
+* are only recorded while a time stamp function is set.
+*
+* @param	Timestamp returns a free running, incrementing time stamp, for
+*		example the counter of a timer. NULL stops the recording.
+*
+* @return	None.
+*
+* @note		The function is called at each interrupt, it has to be short.
+*		Fast interrupts do not go through XIntc_DeviceInterruptHandler()
+*		and are not recorded.
+*
+******************************************************************************/
+void XIntc_SetDispatchTimestamp(XIntc_TimestampHandler Timestamp)
+{
+	XIntc_Timestamp = Timestamp;
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the dispatch statistics of an interrupt.
+*
+* @param	Id is the interrupt ID, in the range of 0 to
+*		XPAR_INTC_MAX_NUM_INTR_INPUTS - 1.
+* @param	StatsPtr is filled with the statistics.
+*
+* @return
+*		- XST_SUCCESS if the statistics are returned.
+*		- XST_INVALID_PARAM if the Id is out of range.
+*
+* @note		MinTicks is 0 as long as Count is 0.
+*
+******************************************************************************/
+int XIntc_GetDispatchStats(u8 Id, XIntc_DispatchStats *StatsPtr)
+{
+	if ((Id >= XPAR_INTC_MAX_NUM_INTR_INPUTS) || (StatsPtr == NULL)) {
+		return XST_INVALID_PARAM;
+	}
+
+	*StatsPtr = XIntc_Stats[Id];
+	if (StatsPtr->Count == 0U) {
+		StatsPtr->MinTicks = 0U;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Clears the dispatch statistics of all interrupts.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XIntc_ResetDispatchStats(void)
+{
+	int Index;
+
+	for (Index = 0; Index < XPAR_INTC_MAX_NUM_INTR_INPUTS; Index++) {
+		XIntc_Stats[Index].Count = 0U;
+		XIntc_Stats[Index].MinTicks = 0xFFFFFFFFU;
+		XIntc_Stats[Index].MaxTicks = 0U;
+		XIntc_Stats[Index].TotalTicks = 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Records one dispatch of an interrupt.
+*
+* @param	Id is the interrupt ID.
+* @param	Entry is the time stamp of the handler entry.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XIntc_StatsAdd(int Id, u32 Entry)
+{
+	XIntc_DispatchStats *StatsPtr;
+	u32 Ticks;
+
+	if ((XIntc_Timestamp == NULL) || (Id >= XPAR_INTC_MAX_NUM_INTR_INPUTS)) {
+		return;
+	}
+
+	StatsPtr = &XIntc_Stats[Id];
+	Ticks = XIntc_Timestamp() - Entry;
+	if ((StatsPtr->Count == 0U) || (Ticks < StatsPtr->MinTicks)) {
+		StatsPtr->MinTicks = Ticks;
+	}
+	if (Ticks > StatsPtr->MaxTicks) {
+		StatsPtr->MaxTicks = Ticks;
+	}
+	StatsPtr->TotalTicks += Ticks;
+	StatsPtr->Count++;
+}
+#endif
 /** @} */
@@ -58,6 +58,7 @@
 *                      compilation failures. It fixes CR#1128446.
 * 3.16  mus  10/04/22 Fixed warnings reported with "-Wundef" compiler flag.
 *                     It fixes CR#1142085.
+* 3.17  fl   10/14/26 Added the XINTC_DISPATCH_STATS dispatch statistics.
 *
 * </pre>
 *
@@ -153,6 +154,21 @@ typedef struct {
 
 typedef void (*XFastInterruptHandler) (void);
 
+#ifdef XINTC_DISPATCH_STATS
+/* Free running time stamp read by the dispatch statistics, in any unit */
+typedef u32 (*XIntc_TimestampHandler) (void);
+
+/* Dispatch statistics of one interrupt, in time stamp ticks from the entry
+ * of XIntc_DeviceInterruptHandler() to the call of the interrupt handler
+ */
+typedef struct {
+	u32 Count;		/* Number of dispatches */
+	u32 MinTicks;		/* Shortest dispatch time */
+	u32 MaxTicks;		/* Longest dispatch time */
+	u64 TotalTicks;		/* Sum of all dispatch times */
+} XIntc_DispatchStats;
+#endif
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*
@@ -307,6 +323,12 @@ void XIntc_RegisterHandler(UINTPTR BaseAddress, int InterruptId,
 void XIntc_RegisterFastHandler(UINTPTR BaseAddress, u8 Id,
 			       XFastInterruptHandler FastHandler);
 
+#ifdef XINTC_DISPATCH_STATS
+void XIntc_SetDispatchTimestamp(XIntc_TimestampHandler Timestamp);
+int XIntc_GetDispatchStats(u8 Id, XIntc_DispatchStats *StatsPtr);
+void XIntc_ResetDispatchStats(void);
+#endif
+
 /************************** Variable Definitions *****************************/
 
 
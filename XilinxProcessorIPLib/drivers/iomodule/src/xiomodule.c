@@ -34,6 +34,7 @@
 * 2.13	sk   10/04/21 Update functions return type to fix misra-c violation.
 * 2.15  ml   27/02/23 Update typecast,add U to Numerical and functions return
 *                     type to fix misra-c violations.
+* 2.16  fl   10/14/26 Added XIOModule_IoReadBurst and XIOModule_IoWriteBurst.
 * </pre>
 *
 ******************************************************************************/
@@ -1351,4 +1352,72 @@ void XIOModule_IoWriteByte(XIOModule * InstancePtr,
 
 	XIomodule_Out8((InstancePtr->IoBaseAddress + ByteOffset), Data);
 }
+
+/****************************************************************************/
+/**
+* Read consecutive 32-bit words from the IO Bus memory mapped IO
+*
+* @param	InstancePtr is a pointer to an XIOModule instance to be
+*		worked on.
+* @param	ByteOffset is the byte offset of the first word from the
+*		beginning of the IO Bus address area
+* @param	BufferPtr is the buffer the words are read to
+* @param	WordCount is the number of words to read
+*
+* @return	None.
+*
+* @note		The words are read in increasing address order, one IO Bus
+*		access each.
+*
+*****************************************************************************/
+void XIOModule_IoReadBurst(XIOModule * InstancePtr, u32 ByteOffset,
+			   u32 *BufferPtr, u32 WordCount)
+{
+	UINTPTR Addr;
+	u32 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid((BufferPtr != NULL) || (WordCount == 0U));
+
+	Addr = InstancePtr->IoBaseAddress + ByteOffset;
+	for (Index = 0U; Index < WordCount; Index++) {
+		BufferPtr[Index] = XIomodule_In32(Addr);
+		Addr += 4U;
+	}
+}
+
+/****************************************************************************/
+/**
+* Write consecutive 32-bit words to the IO Bus memory mapped IO
+*
+* @param	InstancePtr is a pointer to an XIOModule instance to be
+*		worked on.
+* @param	ByteOffset is the byte offset of the first word from the
+*		beginning of the IO Bus address area
+* @param	BufferPtr is the buffer of the words to write
+* @param	WordCount is the number of words to write
+*
+* @return	None.
+*
+* @note		The words are written in increasing address order, one IO
+*		Bus access each.
+*
+*****************************************************************************/
+void XIOModule_IoWriteBurst(XIOModule * InstancePtr, u32 ByteOffset,
+			    const u32 *BufferPtr, u32 WordCount)
+{
+	UINTPTR Addr;
+	u32 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid((BufferPtr != NULL) || (WordCount == 0U));
+
+	Addr = InstancePtr->IoBaseAddress + ByteOffset;
+	for (Index = 0U; Index < WordCount; Index++) {
+		XIomodule_Out32(Addr, BufferPtr[Index]);
+		Addr += 4U;
+	}
+}
 /** @} */
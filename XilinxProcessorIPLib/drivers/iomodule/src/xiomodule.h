@@ -178,6 +178,21 @@
 * The routine defined by XIOModule_Connect() can be used by setting normal
 * interrupt mode, using XIOModule_SetNormalIntrMode().
 *
+* The mode is selected per interrupt, so the latency critical interrupts can
+* be connected with XIOModule_ConnectFastHandler() and vectored by the
+* hardware, while the others keep their XIOModule_Connect() handlers. The
+* normal handlers are dispatched by XIOModule_DeviceInterruptHandler(), which
+* goes directly to the highest priority pending interrupt with a count zeros
+* instruction.
+*
+* <b>Fast Access</b>
+*
+* XIOModule_IoReadWordFast(), XIOModule_IoWriteWordFast(),
+* XIOModule_DiscreteReadFast() and XIOModule_DiscreteWriteFast() are macro
+* versions of the IO Bus and GPIO functions without argument checks, for
+* code where every cycle counts. XIOModule_IoReadBurst() and
+* XIOModule_IoWriteBurst() access consecutive IO Bus words in one call.
+*
 * @note
 *
 * This API utilizes 32 bit I/O to the registers. With less than 32 bits, the
@@ -239,6 +254,8 @@
 * 2.15  ml   02/27/23  converted signed macros into unsigned macros to fix
 *                      misra-c violations.
 * 2.15  adk  04/14/23  Added support for system device-tree flow.
+* 2.16  fl   10/14/26  Added the fast IO Bus and GPIO access macros and the
+*                      IO Bus burst functions.
 * </pre>
 *
 ******************************************************************************/
@@ -460,6 +477,97 @@ typedef struct {
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
+/****************************************************************************/
+/**
+*
+* Read a 32-bit word from the IO Bus, like XIOModule_IoReadWord() without
+* the argument checks.
+*
+* @param	InstancePtr is a pointer to an XIOModule instance to be
+*		worked on.
+* @param	ByteOffset is a byte offset from the beginning of the
+*		IO Bus address area.
+*
+* @return	Value read from the IO Bus - 32-bit word
+*
+* @note		C-style signature:
+*		u32 XIOModule_IoReadWordFast(XIOModule *InstancePtr,
+*					     u32 ByteOffset)
+*
+*****************************************************************************/
+#define XIOModule_IoReadWordFast(InstancePtr, ByteOffset) \
+	XIomodule_In32((InstancePtr)->IoBaseAddress + (ByteOffset))
+
+/****************************************************************************/
+/**
+*
+* Write a 32-bit word to the IO Bus, like XIOModule_IoWriteWord() without
+* the argument checks.
+*
+* @param	InstancePtr is a pointer to an XIOModule instance to be
+*		worked on.
+* @param	ByteOffset is a byte offset from the beginning of the
+*		IO Bus address area.
+* @param	Data is the value to be written to the IO Bus - 32-bit
+*
+* @return	None.
+*
+* @note		C-style signature:
+*		void XIOModule_IoWriteWordFast(XIOModule *InstancePtr,
+*					       u32 ByteOffset, u32 Data)
+*
+*****************************************************************************/
+#define XIOModule_IoWriteWordFast(InstancePtr, ByteOffset, Data) \
+	XIomodule_Out32((InstancePtr)->IoBaseAddress + (ByteOffset), (u32)(Data))
+
+/****************************************************************************/
+/**
+*
+* Read the discretes of a GPI channel, like XIOModule_DiscreteRead() without
+* the argument checks.
+*
+* @param	InstancePtr is a pointer to an XIOModule instance to be
+*		worked on.
+* @param	Channel contains the channel of the GPI (1, 2, 3 or 4).
+*
+* @return	Current copy of the discretes register.
+*
+* @note		C-style signature:
+*		u32 XIOModule_DiscreteReadFast(XIOModule *InstancePtr,
+*					       u32 Channel)
+*
+*****************************************************************************/
+#define XIOModule_DiscreteReadFast(InstancePtr, Channel) \
+	XIOModule_ReadReg((InstancePtr)->BaseAddress, \
+		(((Channel) - 1U) * XGPI_CHAN_OFFSET) + XGPI_DATA_OFFSET)
+
+/****************************************************************************/
+/**
+*
+* Write the discretes of a GPO channel, like XIOModule_DiscreteWrite()
+* without the argument checks. The GPO value kept in the instance is
+* updated too, so that XIOModule_DiscreteSet() and XIOModule_DiscreteClear()
+* keep working.
+*
+* @param	InstancePtr is a pointer to an XIOModule instance to be
+*		worked on.
+* @param	Channel contains the channel of the GPO (1, 2, 3 or 4).
+* @param	Data is the value to be written to the discretes register.
+*
+* @return	None.
+*
+* @note		C-style signature:
+*		void XIOModule_DiscreteWriteFast(XIOModule *InstancePtr,
+*						 u32 Channel, u32 Data)
+*
+*****************************************************************************/
+#define XIOModule_DiscreteWriteFast(InstancePtr, Channel, Data) \
+	do { \
+		XIOModule_WriteReg((InstancePtr)->BaseAddress, \
+			(((Channel) - 1U) * XGPO_CHAN_OFFSET) + \
+			XGPO_DATA_OFFSET, (Data)); \
+		(InstancePtr)->GpoValue[(Channel) - 1U] = (u32)(Data); \
+	} while (0)
 
 /************************** Function Prototypes ******************************/
 
@@ -616,6 +724,11 @@ void XIOModule_IoWriteWord(XIOModule *InstancePtr, u32 ByteOffset, u32 Data);
 void XIOModule_IoWriteHalfword(XIOModule *InstancePtr, u32 ByteOffset, u16 Data);
 void XIOModule_IoWriteByte(XIOModule *InstancePtr, u32 ByteOffset, u8 Data);
 
+void XIOModule_IoReadBurst(XIOModule *InstancePtr, u32 ByteOffset,
+			   u32 *BufferPtr, u32 WordCount);
+void XIOModule_IoWriteBurst(XIOModule *InstancePtr, u32 ByteOffset,
+			    const u32 *BufferPtr, u32 WordCount);
+
 #ifdef __cplusplus
 }
 #endif
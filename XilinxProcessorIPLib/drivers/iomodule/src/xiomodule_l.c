@@ -33,6 +33,8 @@
 * 		       in XIOModule_DeviceInterruptHandler function to skip
 * 		       processing when IntrStatus is 0.
 * 2.15  ml   02/27/23  update functions return type to fix misra-c violation.
+* 2.16  fl   10/14/26  Updated XIOModule_DeviceInterruptHandler to go to the
+*                      pending interrupts with a count zeros instruction.
 * </pre>
 *
 ******************************************************************************/
@@ -137,7 +139,7 @@ void XIOModule_LowLevelInterruptHandler(void)
 void XIOModule_DeviceInterruptHandler(void *DeviceId)
 {
 	u32 IntrStatus;
-	u32 IntrMask = 1;
+	u32 IntrMask;
 	u32 IntrNumber;
 	XIOModule_Config *CfgPtr;
 	XIOModule_VectorTableEntry *TablePtr;
@@ -153,22 +155,21 @@ void XIOModule_DeviceInterruptHandler(void *DeviceId)
 	 */
 	IntrStatus = XIOModule_GetIntrStatus(CfgPtr->BaseAddress);
 
-	/* Service each interrupt that is active and enabled by checking each
-	 * bit in the register from LSB to MSB which corresponds to an interrupt
-	 * input signal. Skip fast interrupts, indicated by null handler.
+	/* Service each interrupt that is active and enabled, going from the
+	 * lowest set bit, the highest priority interrupt, to the highest one.
+	 * Skip fast interrupts, indicated by null handler.
 	 */
-	for (IntrNumber = 0U; IntrNumber < XPAR_IOMODULE_INTC_MAX_INTR_SIZE;
-	     IntrNumber++) {
-		/* If there are no other bits set indicating that all interrupts
-		 * have been serviced, then exit the loop
-		 */
-		if (IntrStatus == 0U) {
-			break;
-		}
+#if (XPAR_IOMODULE_INTC_MAX_INTR_SIZE < 32)
+	IntrStatus &= (1U << XPAR_IOMODULE_INTC_MAX_INTR_SIZE) - 1U;
+#endif
+	while (IntrStatus != 0U) {
+		IntrNumber = (u32)__builtin_ctz(IntrStatus);
+		IntrMask = XIOModule_BitPosMask[IntrNumber];
+		IntrStatus &= ~IntrMask;
 
 		TablePtr = &(CfgPtr->HandlerTable[IntrNumber]);
 
-		if ((bool)(IntrStatus & 1U) && (TablePtr->Handler != NULL)) {
+		if (TablePtr->Handler != NULL) {
 			/* If the interrupt has been setup to acknowledge it
 			 * before servicing the interrupt, then ack it
 			 */
@@ -204,11 +205,6 @@ void XIOModule_DeviceInterruptHandler(void *DeviceId)
 				return;
 			}
 		}
-
-		/* Move to the next interrupt to check */
-		IntrMask <<= 1;
-		IntrStatus >>= 1;
-
 	}
 }
 
@@ -37,6 +37,8 @@
 * 2.10	sd	07/14/21	Fix a unused label warning
 * 2.12	sd	03/29/22	Make the message pointer in XIpiPsu_WriteMessage constant
 * 2.14	ht	06/13/23	Restructured the code for more modularity
+*	fl	10/14/26	Added XIpiPsu_WriteMessageMulti,
+*				XIpiPsu_PollForAckMulti and XIpiPsu_SetCrcBypass
 * </pre>
 *
 *****************************************************************************/
@@ -84,6 +86,7 @@ XStatus XIpiPsu_CfgInitialize(XIpiPsu *InstancePtr, XIpiPsu_Config *CfgPtr,
 	InstancePtr->Config.BufferIndex = CfgPtr->BufferIndex;
 
 	InstancePtr->Config.TargetCount = CfgPtr->TargetCount;
+	InstancePtr->CrcBypassMask = 0U;
 
 	/* Initialize the TargetList */
 	for (Index = 0U; Index < CfgPtr->TargetCount; Index++) {
@@ -128,7 +131,8 @@ void XIpiPsu_Reset(XIpiPsu *InstancePtr)
  * @brief	Trigger an IPI to a Destination CPU
  *
  * @param	InstancePtr is the pointer to current IPI instance
- * @param	DestCpuMask is the Mask of the CPU to which IPI is to be triggered
+ * @param	DestCpuMask is the Mask of the CPU to which IPI is to be triggered,
+ *		several CPU masks may be OR'd to trigger them together
  *
  *
  * @return	XST_SUCCESS if successful
@@ -187,6 +191,42 @@ XStatus XIpiPsu_PollForAck(const XIpiPsu *InstancePtr, u32 DestCpuMask,
 	return Status;
 }
 
+/**
+ * @brief Poll for acknowledgements from several destinations
+ *
+ * @param	InstancePtr is the pointer to current IPI instance
+ * @param	DestCpuMask is the OR'd Masks of the destination CPUs from which
+ *		ACK is expected
+ * @param	TimeOutCount is the Count after which the routines returns failure
+ * @param	PendingMask is updated with the Masks of the CPUs that did not
+ *		acknowledge, 0 on success
+ *
+ * @return	XST_SUCCESS if all destinations acknowledged
+ * 			XST_FAILURE if a timeout occurred
+ */
+
+XStatus XIpiPsu_PollForAckMulti(const XIpiPsu *InstancePtr, u32 DestCpuMask,
+				u32 TimeOutCount, u32 *PendingMask)
+{
+	XStatus Status;
+
+	Xil_AssertNonvoid(PendingMask != NULL);
+
+	/* One OBS read covers every destination in the mask */
+	Status = XIpiPsu_PollForAck(InstancePtr, DestCpuMask, TimeOutCount);
+	if (Status == (XStatus)XST_SUCCESS) {
+		*PendingMask = 0U;
+	} else {
+		*PendingMask = XIpiPsu_GetObsStatus(InstancePtr) & DestCpuMask;
+		/* Late acks between the last poll and the read above */
+		if (*PendingMask == 0U) {
+			Status = (XStatus)XST_SUCCESS;
+		}
+	}
+
+	return Status;
+}
+
 
 /**
  * @brief	Read an Incoming Message from a Source
@@ -222,12 +262,15 @@ XStatus XIpiPsu_ReadMessage(XIpiPsu *InstancePtr, u32 SrcCpuMask, u32 *MsgPtr,
 					     InstancePtr->Config.BitMask, BufferType);
 	if (BufferPtr != NULL) {
 #ifdef ENABLE_IPI_CRC
-		Crc = XIpiPsu_CalculateCRC((u32)BufferPtr, XIPIPSU_W0_TO_W6_SIZE);
-
-		/* Word 8 in IPI is reserved for storing CRC */
-		if (BufferPtr[XIPIPSU_CRC_INDEX] != Crc) {
-			Status = (XStatus)XIPIPSU_CRC_ERROR;
-			goto END;
+		if ((SrcCpuMask & InstancePtr->CrcBypassMask) == 0U) {
+			Crc = XIpiPsu_CalculateCRC((u32)BufferPtr,
+						   XIPIPSU_W0_TO_W6_SIZE);
+
+			/* Word 8 in IPI is reserved for storing CRC */
+			if (BufferPtr[XIPIPSU_CRC_INDEX] != Crc) {
+				Status = (XStatus)XIPIPSU_CRC_ERROR;
+				goto END;
+			}
 		}
 #endif
 		/* Copy the IPI Buffer contents into Users's Buffer*/
@@ -281,9 +324,12 @@ XStatus XIpiPsu_WriteMessage(XIpiPsu *InstancePtr, u32 DestCpuMask, const u32 *M
 			BufferPtr[Index] = MsgPtr[Index];
 		}
 #ifdef ENABLE_IPI_CRC
-		/* Word 8 in IPI is reserved for storing CRC */
-		BufferPtr[XIPIPSU_CRC_INDEX] =
-			XIpiPsu_CalculateCRC((u32)BufferPtr, XIPIPSU_W0_TO_W6_SIZE);
+		if ((DestCpuMask & InstancePtr->CrcBypassMask) == 0U) {
+			/* Word 8 in IPI is reserved for storing CRC */
+			BufferPtr[XIPIPSU_CRC_INDEX] =
+				XIpiPsu_CalculateCRC((u32)BufferPtr,
+						     XIPIPSU_W0_TO_W6_SIZE);
+		}
 #endif
 		Status = (XStatus)XST_SUCCESS;
 	}
@@ -292,6 +338,105 @@ XStatus XIpiPsu_WriteMessage(XIpiPsu *InstancePtr, u32 DestCpuMask, const u32 *M
 	return Status;
 }
 
+/**
+ * @brief	Send the same Message to several Destinations
+ *
+ * @param	InstancePtr is the pointer to current IPI instance
+ * @param	DestCpuMask is the OR'd Device Masks of the destination CPUs
+ * @param	MsgPtr is the pointer to Buffer which contains the message to be sent
+ * @param	MsgLength is the length of the buffer/message
+ * @param	BufferType is the type of buffer (XIPIPSU_BUF_TYPE_MSG or XIPIPSU_BUF_TYPE_RESP)
+ *
+ * @return	XST_SUCCESS if successful
+ * 			XST_FAILURE if a destination is not a valid target
+ *
+ * @note	The CRC is calculated once and copied to every destination
+ *		buffer. Use XIpiPsu_TriggerIpi() with the same mask afterwards.
+ */
+
+XStatus XIpiPsu_WriteMessageMulti(XIpiPsu *InstancePtr, u32 DestCpuMask,
+				  const u32 *MsgPtr, u32 MsgLength,
+				  u8 BufferType)
+{
+	XStatus Status = (XStatus)XST_FAILURE;
+	u32 *BufferPtr;
+	u32 Pending = DestCpuMask;
+	u32 TargetMask;
+	u32 Index;
+	u32 Word;
+	u32 Crc = 0U;
+	u32 HasCrc = 0U;
+
+	(void)Crc;
+	(void)HasCrc;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(MsgPtr != NULL);
+	Xil_AssertNonvoid(MsgLength <= XIPIPSU_MAX_MSG_LEN);
+
+	for (Index = 0U; Index < InstancePtr->Config.TargetCount; Index++) {
+		TargetMask = InstancePtr->Config.TargetList[Index].Mask;
+		if ((Pending & TargetMask) == 0U) {
+			continue;
+		}
+		Pending &= ~TargetMask;
+
+		/*Get the Buffer Address for a given pair of CPUs */
+		BufferPtr = XIpiPsu_GetBufferAddress(InstancePtr,
+						     InstancePtr->Config.BitMask,
+						     TargetMask, BufferType);
+		if (BufferPtr == NULL) {
+			goto END;
+		}
+
+		/* Copy the Message to IPI Buffer */
+		for (Word = 0U; Word < MsgLength; Word++) {
+			BufferPtr[Word] = MsgPtr[Word];
+		}
+#ifdef ENABLE_IPI_CRC
+		if ((TargetMask & InstancePtr->CrcBypassMask) == 0U) {
+			if (HasCrc == 0U) {
+				Crc = XIpiPsu_CalculateCRC((u32)BufferPtr,
+							   XIPIPSU_W0_TO_W6_SIZE);
+				HasCrc = 1U;
+			}
+			/* Word 8 in IPI is reserved for storing CRC */
+			BufferPtr[XIPIPSU_CRC_INDEX] = Crc;
+		}
+#endif
+	}
+
+	if (Pending == 0U) {
+		Status = (XStatus)XST_SUCCESS;
+	}
+
+END:
+	/* Return statement */
+	return Status;
+}
+
+/**
+ * @brief	Select the CPUs whose messages skip the CRC
+ *
+ * @param	InstancePtr is the pointer to current IPI instance
+ * @param	CpuMask is the OR'd Masks of the CPUs on trusted channels, 0 to
+ *		check the CRC on every channel
+ *
+ * @note	Only effective when ENABLE_IPI_CRC is set. The remote end must
+ *		bypass the CRC for this CPU as well.
+ */
+
+void XIpiPsu_SetCrcBypass(XIpiPsu *InstancePtr, u32 CpuMask)
+{
+	/* Validate the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->CrcBypassMask = CpuMask & XIPIPSU_ALL_MASK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -55,6 +55,21 @@
  * @note	XIpiPsu_GetObsStatus() before sending an IPI to ensure that the
  * previous IPI was serviced by the target
  *
+ * <b>Broadcasting an IPI</b>
+ *
+ * DestCpuMask of XIpiPsu_TriggerIpi() may hold several target masks OR'd
+ * together, which triggers all of them with one register write.
+ * XIpiPsu_WriteMessageMulti() fills the message buffer of every target in
+ * the mask and XIpiPsu_PollForAckMulti() waits for all of them and reports
+ * the targets that did not acknowledge.
+ *
+ * <b>Skipping the CRC</b>
+ *
+ * When ENABLE_IPI_CRC is set, XIpiPsu_SetCrcBypass() selects targets for
+ * which the CRC is neither written nor checked, for trusted channels whose
+ * buffers are already ECC protected. Both ends must bypass the CRC for the
+ * channel.
+ *
  * <b>Receiving an IPI</b>
  *
  * To receive an IPI, the following sequence can be followed:
@@ -99,6 +114,8 @@
  * 2.14 adk 05/22/23 Added IPI Mask's for referring to processor IPI Targets
  * 		     in system device-tree flow.
  * 2.14 sd 07/27/23  Update the target count.
+ *      fl 10/14/26  Added multi target messages, aggregated ack polling and
+ *                   per target CRC bypass.
  * </pre>
  *
  *****************************************************************************/
@@ -195,6 +212,7 @@ typedef struct {
 	XIpiPsu_Config Config; /**< Configuration structure */
 	u32 IsReady; /**< Device is initialized and ready */
 	u32 Options; /**< Options set in the device */
+	u32 CrcBypassMask; /**< Targets whose messages skip the CRC */
 } XIpiPsu;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -364,6 +382,15 @@ XStatus XIpiPsu_ReadMessage(XIpiPsu *InstancePtr, u32 SrcCpuMask, u32 *MsgPtr,
 XStatus XIpiPsu_WriteMessage(XIpiPsu *InstancePtr, u32 DestCpuMask, const u32 *MsgPtr,
 			     u32 MsgLength, u8 BufferType);
 
+XStatus XIpiPsu_WriteMessageMulti(XIpiPsu *InstancePtr, u32 DestCpuMask,
+				  const u32 *MsgPtr, u32 MsgLength,
+				  u8 BufferType);
+
+XStatus XIpiPsu_PollForAckMulti(const XIpiPsu *InstancePtr, u32 DestCpuMask,
+				u32 TimeOutCount, u32 *PendingMask);
+
+void XIpiPsu_SetCrcBypass(XIpiPsu *InstancePtr, u32 CpuMask);
+
 void XIpiPsu_SetConfigTable(u32 DeviceId, XIpiPsu_Config *ConfigTblPtr);
 
 #ifdef __cplusplus
@@ -35,6 +35,8 @@
  * 5.5   sk   06/15/20 In XLlFifo_iRead_Aligned and XLlFifo_iWrite_Aligned add
  *		       type casting to fix gcc warnings.
  * 5.6   sd   07/7/23  Add system devicetree support.
+ * 5.7   fl   10/14/26 XLlFifo_iRead_Aligned and XLlFifo_iWrite_Aligned resolve
+ *		       the data register once and move four words per loop.
  * </pre>
  ******************************************************************************/
 
@@ -48,6 +50,17 @@
 /************************** Constant Definitions *****************************/
 #define FIFO_WIDTH_BYTES 4
 
+/*
+ * Returns the address of the receive or transmit data register, which
+ * depends on the data interface of the FIFO.
+ */
+#define XLLF_RX_DATA_ADDR(InstancePtr) \
+	((InstancePtr)->Axi4BaseAddress + ((InstancePtr)->Datainterface ? \
+		XLLF_AXI4_RDFD_OFFSET : XLLF_RDFD_OFFSET))
+#define XLLF_TX_DATA_ADDR(InstancePtr) \
+	((InstancePtr)->Axi4BaseAddress + ((InstancePtr)->Datainterface ? \
+		XLLF_AXI4_TDFD_OFFSET : XLLF_TDFD_OFFSET))
+
 /*
  * Implementation Notes:
  *
@@ -154,12 +167,16 @@ u32 XLlFifo_iRxGetLen(XLlFifo *InstancePtr)
 * @return   XLlFifo_iRead_Aligned always returns XST_SUCCESS. Error handling is
 *           otherwise handled through hardware exceptions and interrupts.
 *
+* @note     The words are read four at a time from the data register, which
+*           is looked up once per call.
+*
 ******************************************************************************/
 int XLlFifo_iRead_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 			     unsigned WordCount)
 {
 	unsigned WordsRemaining = WordCount;
 	u32 *BufPtrIdx = (u32 *)BufPtr;
+	UINTPTR DataAddr;
 
 	xdbg_printf(XDBG_DEBUG_FIFO_RX, "XLlFifo_iRead_Aligned: start\n");
 	Xil_AssertNonvoid(InstancePtr);
@@ -168,12 +185,21 @@ int XLlFifo_iRead_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 	Xil_AssertNonvoid(((UINTPTR)BufPtr & 0x3) == 0x0);
 	xdbg_printf(XDBG_DEBUG_FIFO_RX, "XLlFifo_iRead_Aligned: after asserts\n");
 
+	DataAddr = XLLF_RX_DATA_ADDR(InstancePtr);
+	while (WordsRemaining >= 4) {
+		BufPtrIdx[0] = Xil_In32(DataAddr);
+		BufPtrIdx[1] = Xil_In32(DataAddr);
+		BufPtrIdx[2] = Xil_In32(DataAddr);
+		BufPtrIdx[3] = Xil_In32(DataAddr);
+		BufPtrIdx += 4;
+		WordsRemaining -= 4;
+	}
 	while (WordsRemaining) {
 /*		xdbg_printf(XDBG_DEBUG_FIFO_RX,
 			    "XLlFifo_iRead_Aligned: WordsRemaining: %d\n",
 			    WordsRemaining);
 */
-		*BufPtrIdx = XLlFifo_RxGetWord(InstancePtr);
+		*BufPtrIdx = Xil_In32(DataAddr);
 		BufPtrIdx++;
 		WordsRemaining--;
 	}
@@ -255,7 +281,8 @@ void XLlFifo_iTxSetLen(XLlFifo *InstancePtr, u32 Bytes)
 * @return   XLlFifo_iWrite_Aligned always returns XST_SUCCESS. Error handling is
 *           otherwise handled through hardware exceptions and interrupts.
 *
-* @note
+* @note     The words are written four at a time to the data register, which
+*           is looked up once per call.
 *
 * C Signature: int XLlFifo_iWrite_Aligned(XLlFifo *InstancePtr,
 *                      void *BufPtr, unsigned WordCount);
@@ -266,6 +293,7 @@ int XLlFifo_iWrite_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 {
 	unsigned WordsRemaining = WordCount;
 	u32 *BufPtrIdx = (u32 *)BufPtr;
+	UINTPTR DataAddr;
 
 	xdbg_printf(XDBG_DEBUG_FIFO_TX,
 		    "XLlFifo_iWrite_Aligned: Inst: %p; Buff: %p; Count: %d\n",
@@ -278,8 +306,17 @@ int XLlFifo_iWrite_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 	xdbg_printf(XDBG_DEBUG_FIFO_TX,
 		    "XLlFifo_iWrite_Aligned: WordsRemaining: %d\n",
 		    WordsRemaining);
+	DataAddr = XLLF_TX_DATA_ADDR(InstancePtr);
+	while (WordsRemaining >= 4) {
+		Xil_Out32(DataAddr, BufPtrIdx[0]);
+		Xil_Out32(DataAddr, BufPtrIdx[1]);
+		Xil_Out32(DataAddr, BufPtrIdx[2]);
+		Xil_Out32(DataAddr, BufPtrIdx[3]);
+		BufPtrIdx += 4;
+		WordsRemaining -= 4;
+	}
 	while (WordsRemaining) {
-		XLlFifo_TxPutWord(InstancePtr, *BufPtrIdx);
+		Xil_Out32(DataAddr, *BufPtrIdx);
 		BufPtrIdx++;
 		WordsRemaining--;
 	}
@@ -38,6 +38,7 @@
 * 4.1   sk   11/10/15 Used UINTPTR instead of u32 for Baseaddress CR# 867425.
 *                     Changed the prototypes of XMbox_CfgInitialize API.
 * 4.3   sa   04/20/17 Support for FIFO reset using hardware control register.
+*       fl   10/14/26 Blocking functions spin then call the wait handler.
 *
 * </pre>
 *
@@ -55,8 +56,18 @@
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
+/*
+ * Evaluates to TRUE while the receive FIFO is empty (Mask is XMB_IX_RTA) or
+ * the send FIFO is full (Mask is XMB_IX_STA)
+ */
+#define XMbox_IsBlockedHw(BaseAddress, Mask)			\
+	(((Mask) == XMB_IX_RTA) ? XMbox_IsEmptyHw(BaseAddress) :	\
+	 XMbox_IsFullHw(BaseAddress))
+
 /************************** Function Prototypes ******************************/
 
+static void XMbox_WaitHw(XMbox *InstancePtr, u32 Mask);
+
 /************************** Variable Definitions *****************************/
 
 /*****************************************************************************/
@@ -212,7 +223,7 @@ void XMbox_ReadBlocking(XMbox *InstancePtr, u32 *BufferPtr,
 		/* Block while the mailbox FIFO has at-least some data */
 
 		do {
-			while(XMbox_IsEmptyHw(InstancePtr->Config.BaseAddress));
+			XMbox_WaitHw(InstancePtr, XMB_IX_RTA);
 
 			/*
 			 * Read the Mailbox until empty or the length
@@ -361,7 +372,7 @@ void XMbox_WriteBlocking(XMbox *InstancePtr, u32 *BufferPtr, u32 RequestedBytes)
 		 * at-least one word
 		 */
 		do {
-			while (XMbox_IsFullHw(InstancePtr->Config.BaseAddress));
+			XMbox_WaitHw(InstancePtr, XMB_IX_STA);
 
 			XMbox_WriteMBox(InstancePtr->Config.BaseAddress,
 					 *BufferPtr++);
@@ -674,4 +685,70 @@ u32 XMbox_GetStatus(XMbox *InstancePtr)
 	return Value;
 
 }
+/*****************************************************************************/
+/**
+*
+* Installs the handler the blocking functions call once the FIFO stays empty
+* or full for SpinCount polls of the status register. See xmbox.h for the
+* expected interrupt setup.
+*
+* @param	InstancePtr is a pointer to the XMbox instance to be worked on.
+* @param	SpinCount is the number of polls before calling the handler.
+* @param	FuncPtr is the wait handler, NULL to always spin.
+* @param	CallBackRef is passed to the handler.
+*
+* @return	None.
+*
+* @note		Only used for the memory mapped interface.
+*
+******************************************************************************/
+void XMbox_SetWaitHandler(XMbox *InstancePtr, u32 SpinCount,
+			  XMbox_WaitHandler FuncPtr, void *CallBackRef)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->SpinCount = SpinCount;
+	InstancePtr->WaitRef = CallBackRef;
+	InstancePtr->WaitHandler = FuncPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* Waits until the receive FIFO is not empty (Mask is XMB_IX_RTA) or the send
+* FIFO is not full (Mask is XMB_IX_STA), spinning first and then sleeping in
+* the wait handler.
+*
+* @param	InstancePtr is a pointer to the XMbox instance to be worked on.
+* @param	Mask is XMB_IX_RTA or XMB_IX_STA.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XMbox_WaitHw(XMbox *InstancePtr, u32 Mask)
+{
+	UINTPTR BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 Count;
+
+	for (Count = 0; Count < InstancePtr->SpinCount; Count++) {
+		if (!XMbox_IsBlockedHw(BaseAddress, Mask)) {
+			return;
+		}
+	}
+
+	while (XMbox_IsBlockedHw(BaseAddress, Mask)) {
+		if (InstancePtr->WaitHandler == NULL) {
+			continue;
+		}
+
+		/*
+		 * Clear a stale edge, then re-check so that data arriving
+		 * before the clear is not missed
+		 */
+		XMbox_WriteReg(BaseAddress, XMB_IS_REG_OFFSET, Mask);
+		if (XMbox_IsBlockedHw(BaseAddress, Mask)) {
+			InstancePtr->WaitHandler(InstancePtr->WaitRef, Mask);
+		}
+	}
+}
 /** @} */
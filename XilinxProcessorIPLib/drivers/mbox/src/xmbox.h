@@ -80,6 +80,16 @@
 * the processor will hang until the requested length is received, which might
 * be quite a long time.
 *
+* For the memory mapped interface the blocking functions can instead sleep.
+* XMbox_SetWaitHandler() installs a spin count and a wait handler, none by
+* default. Once the FIFO stays empty (or full) for the spin count, the
+* driver clears the stale RTA (or STA) status, re-checks the FIFO and calls
+* the handler. Under an RTOS the handler typically takes a semaphore that the
+* caller's mailbox interrupt handler gives, with a timeout to bound the wait
+* should an edge be missed. RIT should be 0 so that RTI fires on the first
+* word, and SIT one below the FIFO depth so that STI fires on the first free
+* entry.
+*
 * @note
 *
 * This driver is intended to be RTOS and processor independent. It works with
@@ -140,6 +150,8 @@
 *       sd   07/26/17 Modified tcl file to prevent false unconnected flagging.
 * 4.5   sd   09/03/20 Updated makefile for parallel execution.
 * 4.6   ht   07/06/23 Added support for system device-tree flow.
+*       fl   10/14/26 Added spin-then-sleep wait handler for the blocking
+*                     functions.
 *</pre>
 *
 ******************************************************************************/
@@ -182,6 +194,12 @@ typedef struct {
 #endif
 } XMbox_Config;
 
+/**
+ * Wait handler called by the blocking functions when the FIFO stays empty
+ * (Mask is XMB_IX_RTA) or full (Mask is XMB_IX_STA) after spinning.
+ */
+typedef void (*XMbox_WaitHandler) (void *CallBackRef, u32 Mask);
+
 /**
  * The XMbox driver instance data. The user is required to allocate a
  * variable of this type for every mbox device in the system. A
@@ -192,6 +210,9 @@ typedef struct {
 	XMbox_Config Config;	/**< Configuration data, includes base address
 				  */
 	u32 IsReady;		/**< Device is initialized and ready */
+	XMbox_WaitHandler WaitHandler;	/**< Blocking wait handler */
+	void *WaitRef;		/**< Callback reference for the wait handler */
+	u32 SpinCount;		/**< FIFO polls before calling the handler */
 } XMbox;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -222,6 +243,8 @@ void XMbox_ClearInterrupt(XMbox *InstancePtr, u32 Mask);
 u32 XMbox_GetStatus(XMbox *InstancePtr);
 void XMbox_SetSendThreshold(XMbox *InstancePtr, u32 Value);
 void XMbox_SetReceiveThreshold(XMbox *InstancePtr, u32 Value);
+void XMbox_SetWaitHandler(XMbox *InstancePtr, u32 SpinCount,
+			  XMbox_WaitHandler FuncPtr, void *CallBackRef);
 
 /*
  * Static initialization function, in file xmbox_sinit.c
@@ -81,6 +81,15 @@
 *
 * </pre>
 *
+* <b> Channel Groups </b>
+*
+* Several channels of one direction can be managed as a channel group. The
+* BD chains of the group are carved from one arena (XMcdma_GroupCreate()),
+* packets are pulled from the application and spread over the channels by a
+* weighted round robin that follows the MM2S WRR weights
+* (XMcdma_GroupSchedule()), and XMcdma_GroupIntrHandler() reaps and frees the
+* completed BDs of every channel flagged in the serviced-channel register.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -124,6 +133,8 @@
 * 			 the gcc warning in mcdma integration test suite.
 * 1.7   sa      08/12/22 Updated the examples to use latest MIG cannoical define
 * 		         i.e XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR.
+* 1.9   fl      10/14/26 Added channel groups with a shared BD arena, weighted
+*                        round robin submit and a common interrupt handler.
 ******************************************************************************/
 #ifndef XMCDMA_H_
 #define XMCDMA_H_
@@ -289,6 +300,36 @@ typedef struct {
 	                                     * interrupt callback */
 
 } XMcdma;
+
+typedef void (*XMcdma_GroupDoneHandler) (void *CallBackRef, u32 Chan_Id,
+					 XMcdma_Bd *BdSetPtr, int BdCount);
+typedef s32 (*XMcdma_GroupFillHandler) (void *CallBackRef, u32 Chan_Id,
+					UINTPTR *BufAddrPtr, u32 *LenPtr,
+					u32 MaxLen);
+
+/**
+ * Channel group, a set of channels of one direction sharing one BD arena,
+ * one submit scheduler and one interrupt handler.
+ */
+typedef struct {
+	XMcdma *InstancePtr;	/**< MCDMA instance of the channels */
+	u32 Direction;		/**< XMCDMA_MEM_TO_DEV or XMCDMA_DEV_TO_MEM */
+	u32 ChanMask;		/**< Channels of the group, bit 0 is channel 1 */
+	u32 NumChans;		/**< Number of channels in ChanMask */
+	u32 BdsPerChan;		/**< BDs carved from the arena per channel */
+	u32 NextChan;		/**< Channel the next schedule pass starts at */
+	u8 Weight[XMCDMA_MAX_CHAN_PER_DEVICE + 1]; /**< Packets per round */
+
+	XMcdma_GroupDoneHandler DoneHandler; /**< Call back for transfer
+					       *  done interrupt */
+	void *DoneRef;			/**< To be passed to the done
+					 * interrupt callback */
+	XMcdma_ErrorHandler ErrorHandler; /**< Call back for error
+					    *  interrupt */
+	void *ErrorRef;			/**< To be passed to the error
+					 * interrupt callback */
+} XMcdma_ChanGroup;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -588,6 +629,36 @@ typedef struct {
 
 /*@}*/
 
+/*****************************************************************************/
+/**
+* Bit of a channel in the channel mask of a channel group.
+*
+* @param	ChanId is the channel number, starting from 1.
+*
+* @return	The channel mask bit.
+*
+* @note		C-style signature:
+*		u32 XMCDMA_GROUP_CHAN_BIT(u32 ChanId)
+*
+******************************************************************************/
+#define XMCDMA_GROUP_CHAN_BIT(ChanId)	((u32)1U << ((ChanId) - 1U))
+
+/*****************************************************************************/
+/**
+* Size of the BD arena needed by a channel group.
+*
+* @param	NumChans is the number of channels in the group.
+* @param	BdsPerChan is the number of BDs of each channel.
+*
+* @return	The arena size in bytes.
+*
+* @note		C-style signature:
+*		u32 XMcdma_GroupBdMemCalc(u32 NumChans, u32 BdsPerChan)
+*
+******************************************************************************/
+#define XMcdma_GroupBdMemCalc(NumChans, BdsPerChan) \
+	((u32)(NumChans) * (u32)(BdsPerChan) * (u32)sizeof(XMcdma_Bd))
+
 /************************ Prototypes of functions **************************/
 #ifndef SDT
 XMcdma_Config *XMcdma_LookupConfig(u16 DeviceId);
@@ -640,6 +711,17 @@ s32 XMcdma_SetCallBack(XMcdma *InstancePtr, XMcdma_Handler HandlerType,
 void XMcdma_ChanIntrHandler(void *Instance);
 s32 XMcdma_ChanSetCallBack(XMcdma_ChanCtrl *Chan, XMcdma_ChanHandler HandlerType,
 			   void *CallBackFunc, void *CallBackRef);
+/* Channel groups */
+s32 XMcdma_GroupCreate(XMcdma_ChanGroup *GroupPtr, XMcdma *InstancePtr,
+		       u32 Direction, u32 ChanMask, UINTPTR ArenaAddr,
+		       u32 ArenaSize, u32 BdsPerChan);
+s32 XMcdma_GroupSetCallBack(XMcdma_ChanGroup *GroupPtr,
+			    XMcdma_ChanHandler HandlerType,
+			    void *CallBackFunc, void *CallBackRef);
+u32 XMcdma_GroupSchedule(XMcdma_ChanGroup *GroupPtr,
+			 XMcdma_GroupFillHandler Fill, void *FillRef,
+			 u32 MaxPkts);
+void XMcdma_GroupIntrHandler(void *Instance);
 #ifdef __cplusplus
 }
 
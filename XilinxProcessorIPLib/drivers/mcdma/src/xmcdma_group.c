@@ -0,0 +1,449 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_group.c
+* @addtogroup mcdma Overview
+* @{
+*
+* This file contains the channel group support of the MCDMA driver. A channel
+* group manages several channels of one direction as a unit:
+*
+* - The BD chains of all channels are carved from a single memory arena
+*   supplied by the application (XMcdma_GroupCreate()).
+* - Packets are submitted with a software weighted round robin that follows
+*   the MM2S WRR weights programmed in the core (XMcdma_GroupSchedule()).
+* - Completions of all channels are reaped from one interrupt handler pass
+*   driven by the interrupt serviced-channel bitmap
+*   (XMcdma_GroupIntrHandler()).
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.9   fl      10/14/26 Initial version.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xmcdma.h"
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/**************************** Type Definitions *******************************/
+
+
+/************************** Function Prototypes ******************************/
+
+static XMcdma_ChanCtrl *XMcdma_GroupGetChan(XMcdma_ChanGroup *GroupPtr,
+		u32 ChanId);
+static void XMcdma_GroupMarkPkt(XMcdma_Bd *FirstBdPtr, XMcdma_Bd *LastBdPtr);
+
+/************************** Variable Definitions *****************************/
+
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function creates a channel group. The BD chains of all channels in
+* ChanMask are created back to back in the arena, BdsPerChan BDs each, and the
+* WRR weight of every MM2S channel is read back from the core.
+*
+* @param	GroupPtr is a pointer to the channel group to be initialized.
+* @param	InstancePtr is a pointer to the XMcdma instance to be worked on.
+* @param	Direction is XMCDMA_MEM_TO_DEV (MM2S) or XMCDMA_DEV_TO_MEM
+*		(S2MM).
+* @param	ChanMask is the bitmap of the channels in the group, bit 0 is
+*		channel 1.
+* @param	ArenaAddr is the address of the BD arena. It must be aligned to
+*		XMCDMA_BD_MINIMUM_ALIGNMENT.
+* @param	ArenaSize is the size of the BD arena in bytes, at least
+*		XMcdma_GroupBdMemCalc() for the group.
+* @param	BdsPerChan is the number of BDs of each channel.
+*
+* @return
+*		- XST_SUCCESS if the group was created.
+*		- XST_INVALID_PARAM if an argument is invalid or the arena is
+*		  too small.
+*
+* @note		The channels must not be used outside of the group afterwards.
+*
+******************************************************************************/
+s32 XMcdma_GroupCreate(XMcdma_ChanGroup *GroupPtr, XMcdma *InstancePtr,
+		       u32 Direction, u32 ChanMask, UINTPTR ArenaAddr,
+		       u32 ArenaSize, u32 BdsPerChan)
+{
+	XMcdma_ChanCtrl *Chan;
+	u32 NumChans;
+	u32 ChanId;
+	u32 Weight;
+	UINTPTR BdAddr = ArenaAddr;
+	int MaxChans;
+
+	Xil_AssertNonvoid(GroupPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (Direction == XMCDMA_MEM_TO_DEV) {
+		MaxChans = InstancePtr->Config.TxNumChannels;
+	} else if (Direction == XMCDMA_DEV_TO_MEM) {
+		MaxChans = InstancePtr->Config.RxNumChannels;
+	} else {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((ChanMask == 0U) || (BdsPerChan == 0U) ||
+	    ((ChanMask >> MaxChans) != 0U) ||
+	    ((ArenaAddr & (XMCDMA_BD_MINIMUM_ALIGNMENT - 1)) != 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	NumChans = 0U;
+	for (ChanId = 1U; ChanId <= (u32)MaxChans; ChanId++) {
+		if ((ChanMask & XMCDMA_GROUP_CHAN_BIT(ChanId)) != 0U) {
+			NumChans++;
+		}
+	}
+
+	if (ArenaSize < XMcdma_GroupBdMemCalc(NumChans, BdsPerChan)) {
+		xil_printf("BD arena too small for %d channels\n\r", NumChans);
+		return XST_INVALID_PARAM;
+	}
+
+	GroupPtr->InstancePtr = InstancePtr;
+	GroupPtr->Direction = Direction;
+	GroupPtr->ChanMask = ChanMask;
+	GroupPtr->NumChans = NumChans;
+	GroupPtr->BdsPerChan = BdsPerChan;
+	GroupPtr->NextChan = 1U;
+	GroupPtr->DoneHandler = NULL;
+	GroupPtr->DoneRef = NULL;
+	GroupPtr->ErrorHandler = NULL;
+	GroupPtr->ErrorRef = NULL;
+
+	for (ChanId = 1U; ChanId <= (u32)MaxChans; ChanId++) {
+		GroupPtr->Weight[ChanId] = 0U;
+		if ((ChanMask & XMCDMA_GROUP_CHAN_BIT(ChanId)) == 0U) {
+			continue;
+		}
+
+		Chan = XMcdma_GroupGetChan(GroupPtr, ChanId);
+		if (XMcDma_ChanBdCreate(Chan, BdAddr, BdsPerChan) !=
+		    XST_SUCCESS) {
+			return XST_INVALID_PARAM;
+		}
+		BdAddr += (UINTPTR)BdsPerChan * sizeof(XMcdma_Bd);
+
+		/* S2MM has no WRR arbitration, serve its channels equally */
+		Weight = 1U;
+		if (Direction == XMCDMA_MEM_TO_DEV) {
+			Weight = XMCdma_GetChan_Weight(Chan);
+			if (Weight == 0U) {
+				Weight = 1U;
+			}
+		}
+		GroupPtr->Weight[ChanId] = (u8)Weight;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine installs the asynchronous callback of a channel group.
+*
+* <pre>
+* HandlerType                Callback Function Type
+* -------------------------  ------------------------------------------------
+* XMCDMA_CHAN_HANDLER_DONE   XMcdma_GroupDoneHandler, called once per channel
+*                            with the BDs completed on that channel
+* XMCDMA_CHAN_HANDLER_ERROR  XMcdma_ErrorHandler
+* </pre>
+*
+* @param	GroupPtr is a pointer to the channel group to be worked on.
+* @param	HandlerType specifies which callback is to be attached.
+* @param	CallBackFunc is the address of the callback function.
+* @param	CallBackRef is a user data item that will be passed to the
+* 		callback function when it is invoked.
+*
+* @return
+*		- XST_SUCCESS when handler is installed.
+*		- XST_INVALID_PARAM when HandlerType is invalid.
+*
+******************************************************************************/
+s32 XMcdma_GroupSetCallBack(XMcdma_ChanGroup *GroupPtr,
+			    XMcdma_ChanHandler HandlerType,
+			    void *CallBackFunc, void *CallBackRef)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(GroupPtr != NULL);
+	Xil_AssertNonvoid(CallBackFunc != NULL);
+
+	switch (HandlerType) {
+		case XMCDMA_CHAN_HANDLER_DONE:
+			GroupPtr->DoneHandler = (XMcdma_GroupDoneHandler)((void *)CallBackFunc);
+			GroupPtr->DoneRef = CallBackRef;
+			Status = (XST_SUCCESS);
+			break;
+
+		case XMCDMA_CHAN_HANDLER_ERROR:
+			GroupPtr->ErrorHandler = (XMcdma_ErrorHandler)((void *)CallBackFunc);
+			GroupPtr->ErrorRef = CallBackRef;
+			Status = (XST_SUCCESS);
+			break;
+
+		default:
+			Status = (XST_INVALID_PARAM);
+			break;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits packets to the channels of a group using a weighted
+* round robin. In each round a channel may take up to its weight in packets.
+* The packets are pulled from the application through the Fill callback,
+* which returns XST_SUCCESS with a buffer no longer than MaxLen, or any other
+* value when it has nothing for that channel. Rounds continue until no
+* channel accepts a packet or MaxPkts packets were submitted. Every channel
+* that received packets is then kicked once.
+*
+* The channel served last is remembered, so successive calls keep rotating
+* through the group instead of always favouring the lowest channel.
+*
+* @param	GroupPtr is a pointer to the channel group to be worked on.
+* @param	Fill is the callback that provides the next buffer of a channel.
+* @param	FillRef is a user data item passed to Fill.
+* @param	MaxPkts is the maximum number of packets to submit.
+*
+* @return	The number of packets submitted.
+*
+* @note		For MM2S each packet is marked with SOF on its first BD and
+*		EOF on its last BD.
+*
+******************************************************************************/
+u32 XMcdma_GroupSchedule(XMcdma_ChanGroup *GroupPtr,
+			 XMcdma_GroupFillHandler Fill, void *FillRef,
+			 u32 MaxPkts)
+{
+	XMcdma_ChanCtrl *Chan;
+	XMcdma_Bd *FirstBdPtr;
+	UINTPTR BufAddr;
+	u32 Len;
+	u32 MaxLen;
+	u32 ChanId = GroupPtr->NextChan;
+	u32 LastChan = 0U;
+	u32 Kicked = 0U;
+	u32 Submitted = 0U;
+	u32 RoundCnt;
+	u32 Visited;
+	u32 Quota;
+
+	Xil_AssertNonvoid(Fill != NULL);
+
+	do {
+		RoundCnt = 0U;
+
+		for (Visited = 0U; (Visited < XMCDMA_MAX_CHAN_PER_DEVICE) &&
+		     (Submitted < MaxPkts); Visited++) {
+			if ((GroupPtr->ChanMask & XMCDMA_GROUP_CHAN_BIT(ChanId)) != 0U) {
+				Chan = XMcdma_GroupGetChan(GroupPtr, ChanId);
+
+				for (Quota = GroupPtr->Weight[ChanId];
+				     (Quota > 0U) && (Submitted < MaxPkts) &&
+				     (Chan->BdCnt > 0U); Quota--) {
+					MaxLen = Chan->BdCnt * Chan->MaxTransferLen;
+					if (Fill(FillRef, ChanId, &BufAddr, &Len,
+						 MaxLen) != XST_SUCCESS) {
+						break;
+					}
+
+					FirstBdPtr = Chan->BdRestart;
+					if (XMcDma_ChanSubmit(Chan, BufAddr, Len) !=
+					    XST_SUCCESS) {
+						break;
+					}
+
+					if (GroupPtr->Direction == XMCDMA_MEM_TO_DEV) {
+						XMcdma_GroupMarkPkt(FirstBdPtr,
+								    Chan->BdTail);
+					}
+
+					Kicked |= XMCDMA_GROUP_CHAN_BIT(ChanId);
+					LastChan = ChanId;
+					Submitted++;
+					RoundCnt++;
+				}
+			}
+
+			ChanId = (ChanId >= XMCDMA_MAX_CHAN_PER_DEVICE) ? 1U :
+				 (ChanId + 1U);
+		}
+	} while ((RoundCnt != 0U) && (Submitted < MaxPkts));
+
+	if (Kicked == 0U) {
+		return 0U;
+	}
+
+	/* Resume the next call after the channel served last */
+	GroupPtr->NextChan = (LastChan >= XMCDMA_MAX_CHAN_PER_DEVICE) ? 1U :
+			     (LastChan + 1U);
+
+	DATA_SYNC;
+
+	/* One tail descriptor update per channel for the whole pass */
+	for (ChanId = 1U; ChanId <= XMCDMA_MAX_CHAN_PER_DEVICE; ChanId++) {
+		if ((Kicked & XMCDMA_GROUP_CHAN_BIT(ChanId)) != 0U) {
+			(void)XMcDma_ChanToHw(XMcdma_GroupGetChan(GroupPtr,
+					      ChanId));
+		}
+	}
+
+	return Submitted;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler of a channel group. It should be
+* connected instead of XMcdma_IntrHandler()/XMcdma_TxIntrHandler() for the
+* direction of the group.
+*
+* The serviced-channel bitmap is read once per pass, and for every channel of
+* the group with a pending completion the finished BDs are reaped, handed to
+* the done callback and freed before moving on to the next channel.
+*
+* @param	Instance is a pointer to the XMcdma_ChanGroup to be worked on.
+*
+* @return	None.
+*
+* @note		The done callback must be done with the BDs when it returns.
+*
+******************************************************************************/
+void XMcdma_GroupIntrHandler(void *Instance)
+{
+	XMcdma_ChanGroup *GroupPtr = (XMcdma_ChanGroup *)((void *)Instance);
+	UINTPTR BaseAddr = GroupPtr->InstancePtr->Config.BaseAddress;
+	XMcdma_ChanCtrl *Chan;
+	XMcdma_Bd *BdSetPtr;
+	u32 SerOffset;
+	u32 SerMask;
+	u32 IrqStatus;
+	u32 ChanId;
+	int BdCount;
+
+	if (GroupPtr->Direction == XMCDMA_MEM_TO_DEV) {
+		SerOffset = XMCDMA_TXINT_SER_OFFSET;
+	} else {
+		SerOffset = XMCDMA_RX_OFFSET + XMCDMA_RXINT_SER_OFFSET;
+	}
+
+	while (1) {
+		SerMask = XMcdma_ReadReg(BaseAddr, SerOffset) &
+			  GroupPtr->ChanMask;
+		if (SerMask == 0U) {
+			break;
+		}
+
+		for (ChanId = 1U; SerMask != 0U; ChanId++, SerMask >>= 1) {
+			if ((SerMask & 1U) == 0U) {
+				continue;
+			}
+
+			Chan = XMcdma_GroupGetChan(GroupPtr, ChanId);
+			IrqStatus = XMcdma_ChanGetIrq(Chan);
+
+			/* Acknowledge pending interrupts */
+			XMcdma_ChanAckIrq(Chan, IrqStatus);
+
+			if ((IrqStatus & XMCDMA_IRQ_ERROR_MASK) != 0U) {
+				Chan->ChanState = XMCDMA_CHAN_PAUSE;
+				if (GroupPtr->ErrorHandler != NULL) {
+					GroupPtr->ErrorHandler(GroupPtr->ErrorRef,
+							       ChanId, IrqStatus);
+				}
+				continue;
+			}
+
+			if ((IrqStatus & (XMCDMA_IRQ_DELAY_MASK |
+					  XMCDMA_IRQ_IOC_MASK)) == 0U) {
+				continue;
+			}
+
+			BdCount = XMcdma_BdChainFromHW(Chan, GroupPtr->BdsPerChan,
+						       &BdSetPtr);
+			if (BdCount > 0) {
+				if (GroupPtr->DoneHandler != NULL) {
+					GroupPtr->DoneHandler(GroupPtr->DoneRef,
+							      ChanId, BdSetPtr,
+							      BdCount);
+				}
+				(void)XMcdma_BdChainFree(Chan, BdCount, BdSetPtr);
+			}
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the channel control structure of a group channel.
+*
+* @param	GroupPtr is a pointer to the channel group.
+* @param	ChanId is the channel number.
+*
+* @return	Pointer to the channel.
+*
+******************************************************************************/
+static XMcdma_ChanCtrl *XMcdma_GroupGetChan(XMcdma_ChanGroup *GroupPtr,
+		u32 ChanId)
+{
+	if (GroupPtr->Direction == XMCDMA_MEM_TO_DEV) {
+		return XMcdma_GetMcdmaTxChan(GroupPtr->InstancePtr, ChanId);
+	}
+
+	return XMcdma_GetMcdmaRxChan(GroupPtr->InstancePtr, ChanId);
+}
+
+/*****************************************************************************/
+/**
+*
+* Sets the SOF and EOF control bits of an MM2S packet and flushes its first
+* and last BD.
+*
+* @param	FirstBdPtr is the first BD of the packet.
+* @param	LastBdPtr is the last BD of the packet.
+*
+* @return	None.
+*
+* @note		XMcDma_BdSetCtrl() replaces both bits, so a single BD packet
+*		gets them in one write.
+*
+******************************************************************************/
+static void XMcdma_GroupMarkPkt(XMcdma_Bd *FirstBdPtr, XMcdma_Bd *LastBdPtr)
+{
+	if (FirstBdPtr == LastBdPtr) {
+		XMcDma_BdSetCtrl(FirstBdPtr, XMCDMA_BD_CTRL_SOF_MASK |
+				 XMCDMA_BD_CTRL_EOF_MASK);
+	} else {
+		XMcDma_BdSetCtrl(FirstBdPtr, XMCDMA_BD_CTRL_SOF_MASK);
+		XMcDma_BdSetCtrl(LastBdPtr, XMCDMA_BD_CTRL_EOF_MASK);
+		XMCDMA_CACHE_FLUSH((UINTPTR)(LastBdPtr));
+	}
+	XMCDMA_CACHE_FLUSH((UINTPTR)(FirstBdPtr));
+}
+
+/** @} */
@@ -92,6 +92,11 @@
 * 1.11  akm    03/31/22    Fix unused parameter warning.
 * 1.11  akm    03/31/22    Fix misleading-indentation warning.
 * 1.12  akm    06/27/23    Update the driver to support for system device-tree flow.
+* 1.12  fl     10/14/26    Use the ONFI cache read and page cache program
+*			   commands for sequential pages in XNandPsu_Read()
+*			   and XNandPsu_Write().
+* 1.12  fl     10/14/26    Check the length including bad blocks with the
+*			   bad block counts of the BBT bitmap.
 *
 * </pre>
 *
@@ -174,10 +179,12 @@ static s32 XNandPsu_OnfiReadParamPage(XNandPsu *InstancePtr, u32 Target,
 				      u8 *Buf);
 
 static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
-				u32 Col, u8 *Buf);
+				u32 Col, u8 *Buf, u8 Cmd2);
 
 static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
-			     u32 Col, u8 *Buf);
+			     u32 Col, u8 *Buf, u32 ProgMask);
+
+static u32 XNandPsu_IsCacheRun(XNandPsu *InstancePtr, u32 Page, u64 Length);
 
 static s32 XNandPsu_CheckOnDie(XNandPsu *InstancePtr);
 
@@ -579,6 +586,10 @@ static void XNandPsu_InitFeatures(XNandPsu *InstancePtr, OnfiParamPage *Param)
 				       1U : 0U;
 	InstancePtr->Features.ExtPrmPage = ((Param->Features & (1U << 7)) != 0U) ?
 					   1U : 0U;
+	InstancePtr->Features.CacheProgram =
+		((Param->OptionalCmds & (1U << 0)) != 0U) ? 1U : 0U;
+	InstancePtr->Features.CacheRead =
+		((Param->OptionalCmds & (1U << 1)) != 0U) ? 1U : 0U;
 }
 
 /*****************************************************************************/
@@ -1368,27 +1379,29 @@ static s32 XNandPsu_CalculateLength(XNandPsu *InstancePtr, u64 Offset,
 {
 	s32 Status;
 	u32 BlockSize;
-	u32 BlockLen;
 	u32 Block;
-	u64 TempLen = 0;
-	u64 OffsetVar = Offset;
+	u64 GoodLen = 0U;
 
 	BlockSize = InstancePtr->Geometry.BlockSize;
 
-	while (TempLen < Length) {
-		Block = (u32)(OffsetVar / BlockSize);
-		BlockLen = BlockSize - (u32)(OffsetVar % BlockSize);
-		if (OffsetVar >= InstancePtr->Geometry.DeviceSize) {
-			Status = XST_FAILURE;
-			goto Out;
-		}
-		/* Check if the block is bad */
-		Status = XNandPsu_IsBlockBad(InstancePtr, Block);
-		if (Status != XST_SUCCESS) {
-			/* Good block */
-			TempLen += BlockLen;
-		}
-		OffsetVar += BlockLen;
+	if (Offset >= InstancePtr->Geometry.DeviceSize) {
+		Status = XST_FAILURE;
+		goto Out;
+	}
+	/*
+	 * Good bytes from the offset to the end of the flash, the bad block
+	 * counts of the bitmap avoid walking the blocks of the range.
+	 */
+	Block = (u32)(Offset / BlockSize);
+	if (XNandPsu_IsBlockBad(InstancePtr, Block) != XST_SUCCESS) {
+		GoodLen = BlockSize - (u32)(Offset % BlockSize);
+	}
+	GoodLen += (u64)XNandPsu_NumGoodBlocks(InstancePtr, Block + 1U) *
+		   (u64)BlockSize;
+
+	if (GoodLen < Length) {
+		Status = XST_FAILURE;
+		goto Out;
 	}
 
 	Status = XST_SUCCESS;
@@ -1431,6 +1444,7 @@ s32 XNandPsu_Write(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *SrcBuf)
 	u32 PartialBytes = 0;
 	u32 NumBytes;
 	u32 RemLen;
+	u8 Cmd2;
 	u8 *BufPtr;
 	u8 *SrcBufPtr = (u8 *)SrcBuf;
 	u64 OffsetVar = Offset;
@@ -1492,9 +1506,20 @@ s32 XNandPsu_Write(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *SrcBuf)
 				   InstancePtr->Geometry.BytesPerPage :
 				   (u32)LengthVar;
 		}
-		/* Program page */
+		/*
+		 * Program page. A full page followed by another one in the
+		 * same block is sent with the cache program command, the
+		 * ready wait then only covers the cache register transfer.
+		 */
+		if ((PartialBytes == 0U) &&
+		    (InstancePtr->Features.CacheProgram == 1U) &&
+		    (XNandPsu_IsCacheRun(InstancePtr, Page, LengthVar) == 1U)) {
+			Cmd2 = ONFI_CMD_PG_CACHE_PROG2;
+		} else {
+			Cmd2 = ONFI_CMD_PG_PROG2;
+		}
 		Status = XNandPsu_ProgramPage(InstancePtr, Target, Page, 0U,
-					      BufPtr);
+					      BufPtr, Cmd2);
 		if (Status != XST_SUCCESS) {
 			goto Out;
 		}
@@ -1548,6 +1573,8 @@ s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *DestBuf)
 	u32 PartialBytes = 0U;
 	u32 RemLen;
 	u32 NumBytes;
+	u32 ProgMask;
+	u32 InCache = 0U;
 	u8 *BufPtr;
 	u8 *DestBufPtr = (u8 *)DestBuf;
 	u64 OffsetVar = Offset;
@@ -1604,10 +1631,39 @@ s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *DestBuf)
 				   InstancePtr->Geometry.BytesPerPage :
 				   (u32)LengthVar;
 		}
-		/* Read page */
+		/*
+		 * Read page. Full pages followed by another one in the same
+		 * block are read with the read cache commands, the flash
+		 * loads the next page while the current one is transferred.
+		 * The last page of such a run ends the cache read.
+		 */
+		if (InCache == 1U) {
+			if (XNandPsu_IsCacheRun(InstancePtr, Page,
+						LengthVar) == 1U) {
+				ProgMask = XNANDPSU_PROG_RD_CACHE_SEQ_MASK;
+			} else {
+				ProgMask = XNANDPSU_PROG_RD_CACHE_END_MASK;
+				InCache = 0U;
+			}
+		} else if ((PartialBytes == 0U) &&
+			   (InstancePtr->Features.CacheRead == 1U) &&
+			   (XNandPsu_IsCacheRun(InstancePtr, Page,
+						LengthVar) == 1U)) {
+			ProgMask = XNANDPSU_PROG_RD_CACHE_START_MASK;
+			InCache = 1U;
+		} else {
+			ProgMask = XNANDPSU_PROG_RD_MASK;
+		}
 		Status = XNandPsu_ReadPage(InstancePtr, Target, Page, 0U,
-					   BufPtr);
+					   BufPtr, ProgMask);
 		if (Status != XST_SUCCESS) {
+			if (InCache == 1U) {
+				/* Leave the flash out of the cache read */
+				(void)XNandPsu_ReadPage(InstancePtr, Target,
+						Page + 1U, 0U,
+						&InstancePtr->PartialDataBuf[0],
+						XNANDPSU_PROG_RD_CACHE_END_MASK);
+			}
 			goto Out;
 		}
 		if (PartialBytes > 0U) {
@@ -1623,6 +1679,35 @@ Out:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function checks if a full page access continues with the next page
+* in a cache read or cache program run.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Page is the page address value accessed.
+* @param	Length is the number of bytes left from the start of the page.
+*
+* @return
+*		- 1 if a full page of the same block follows the page.
+*		- 0 otherwise.
+*
+* @note		None
+*
+******************************************************************************/
+static u32 XNandPsu_IsCacheRun(XNandPsu *InstancePtr, u32 Page, u64 Length)
+{
+	u32 Status = 0U;
+
+	if ((Length >= ((u64)InstancePtr->Geometry.BytesPerPage * 2U)) &&
+	    (((Page + 1U) % InstancePtr->Geometry.PagesPerBlock) != 0U)) {
+		Status = 1U;
+	}
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1733,6 +1818,8 @@ Out:
 * @param	Page is the page address value to program.
 * @param	Col is the column address value to program.
 * @param	Buf is the data buffer to program.
+* @param	Cmd2 is the second program command cycle, ONFI_CMD_PG_PROG2
+*		or ONFI_CMD_PG_CACHE_PROG2 for a cache program.
 *
 * @return
 *		- XST_SUCCESS if successful.
@@ -1742,7 +1829,7 @@ Out:
 *
 ******************************************************************************/
 static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
-				u32 Col, u8 *Buf)
+				u32 Col, u8 *Buf, u8 Cmd2)
 {
 	u32 PktSize;
 	u32 PktCount;
@@ -1758,7 +1845,7 @@ static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	}
 	PktCount = InstancePtr->Geometry.BytesPerPage / PktSize;
 
-	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_PG_PROG1, ONFI_CMD_PG_PROG2,
+	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_PG_PROG1, Cmd2,
 			     1U, 1U, (u8)AddrCycles);
 
 	if (InstancePtr->DmaMode == XNANDPSU_MDMA) {
@@ -1946,16 +2033,21 @@ Out:
 * @param	Page is the page address value to read.
 * @param	Col is the column address value to read.
 * @param	Buf is the data buffer to fill in.
+* @param	ProgMask is the read operation, XNANDPSU_PROG_RD_MASK for a
+*		page read or one of the XNANDPSU_PROG_RD_CACHE_START_MASK,
+*		XNANDPSU_PROG_RD_CACHE_SEQ_MASK and
+*		XNANDPSU_PROG_RD_CACHE_END_MASK cache read steps.
 *
 * @return
 *		- XST_SUCCESS if successful.
 *		- XST_FAILURE if failed.
 *
-* @note		None
+* @note		The sequential and end cache read steps transfer the page
+*		following the previous step, they send no address cycles.
 *
 ******************************************************************************/
 static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
-			     u32 Col, u8 *Buf)
+			     u32 Col, u8 *Buf, u32 ProgMask)
 {
 	u32 PktSize;
 	u32 PktCount;
@@ -1963,6 +2055,8 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	u32 RegVal;
 	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
 			 InstancePtr->Geometry.ColAddrCycles;
+	u8 Cmd1 = ONFI_CMD_RD1;
+	u8 Cmd2 = ONFI_CMD_RD2;
 
 	if (InstancePtr->EccCfg.CodeWordSize > 9U) {
 		PktSize = 1024U;
@@ -1971,8 +2065,17 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	}
 	PktCount = InstancePtr->Geometry.BytesPerPage / PktSize;
 
-	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD1, ONFI_CMD_RD2,
-			     1U, 1U, (u8)AddrCycles);
+	if (ProgMask == XNANDPSU_PROG_RD_CACHE_SEQ_MASK) {
+		Cmd1 = ONFI_CMD_RD_CACHE_SEQ;
+		Cmd2 = ONFI_CMD_INVALID;
+		AddrCycles = 0U;
+	} else if (ProgMask == XNANDPSU_PROG_RD_CACHE_END_MASK) {
+		Cmd1 = ONFI_CMD_RD_CACHE_END;
+		Cmd2 = ONFI_CMD_INVALID;
+		AddrCycles = 0U;
+	}
+
+	XNandPsu_Prepare_Cmd(InstancePtr, Cmd1, Cmd2, 1U, 1U, (u8)AddrCycles);
 
 	if (InstancePtr->DmaMode == XNANDPSU_MDMA) {
 		RegVal = XNANDPSU_INTR_STS_EN_TRANS_COMP_STS_EN_MASK |
@@ -2009,7 +2112,7 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 
 	/* Set Read command in Program Register */
 	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
-			  XNANDPSU_PROG_OFFSET, XNANDPSU_PROG_RD_MASK);
+			  XNANDPSU_PROG_OFFSET, ProgMask);
 
 	Status = XNandPsu_Data_ReadWrite(InstancePtr, Buf, PktCount, PktSize, 0, 1);
 
@@ -156,6 +156,8 @@
 * 1.11  akm    03/31/22    Fix unused parameter warning.
 * 1.11  akm    03/31/22    Fix misleading-indentation warning.
 * 1.12  akm    06/27/23    Update the driver to support for system device-tree flow.
+* 1.12  fl     10/14/26    Added cache read and cache program features.
+* 1.12  fl     10/14/26    Added bad block bitmap and BBT update page.
 *
 * </pre>
 *
@@ -299,6 +301,8 @@ typedef struct {
 	u8 Version[XNANDPSU_MAX_TARGETS];
 	/**< BBT version */
 	u32 Valid;		/**< BBT descriptor is valid or not */
+	u32 NextPage[XNANDPSU_MAX_TARGETS];
+	/**< Page offset of the next BBT update, 0 to erase the block */
 } XNandPsu_BbtDesc;
 
 /**
@@ -345,6 +349,8 @@ typedef struct {
 	u32 EzNand;
 	u32 OnDie;
 	u32 ExtPrmPage;
+	u32 CacheRead;		/**< Read cache commands supported */
+	u32 CacheProgram;	/**< Page cache program supported */
 } XNandPsu_Features;
 
 /**
@@ -404,6 +410,9 @@ typedef struct {
 	XNandPsu_BadBlockPattern BbPattern;	/**< Bad block pattern to
 						  search */
 	u8 Bbt[XNANDPSU_MAX_BLOCKS >> 2];	/**< Bad block table array */
+	u32 BbtBadMap[XNANDPSU_MAX_BLOCKS >> 5];	/**< Bad block bitmap */
+	u16 BbtBadCount[XNANDPSU_MAX_BLOCKS >> 5];	/**< Bad blocks before
+							  each bitmap word */
 } XNandPsu;
 
 /******************* Macro Definitions (Inline Functions) *******************/
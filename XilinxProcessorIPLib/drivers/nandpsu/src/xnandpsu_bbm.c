@@ -30,6 +30,8 @@
 *	                   data access.
 * 1.4	nsk    04/10/18    Added ICCARM compiler support.
 * 1.10	akm    01/05/22    Remove assert checks form static and internal APIs.
+* 1.12	fl     10/14/26    Added the bad block bitmap and appended the BBT
+*			   updates to the free pages of the BBT block.
 * </pre>
 *
 ******************************************************************************/
@@ -65,6 +67,15 @@ static s32 XNandPsu_MarkBbt(XNandPsu *InstancePtr, XNandPsu_BbtDesc *Desc,
 
 static s32 XNandPsu_UpdateBbt(XNandPsu *InstancePtr, u32 Target);
 
+static s32 XNandPsu_ReadBbtSig(XNandPsu *InstancePtr, XNandPsu_BbtDesc *Desc,
+			       u32 Page, u8 *Buf);
+
+static u32 XNandPsu_BbtSlotPages(XNandPsu *InstancePtr);
+
+static void XNandPsu_BuildBadMap(XNandPsu *InstancePtr);
+
+static u32 XNandPsu_BbtPopCount(u32 Data);
+
 /************************** Variable Definitions *****************************/
 
 /*****************************************************************************/
@@ -99,6 +110,7 @@ void XNandPsu_InitBbtDesc(XNandPsu *InstancePtr)
 	(void)strcpy(&InstancePtr->BbtDesc.Signature[0], "Bbt0");
 	for (Index = 0U; Index < XNANDPSU_MAX_TARGETS; Index++) {
 		InstancePtr->BbtDesc.Version[Index] = 0U;
+		InstancePtr->BbtDesc.NextPage[Index] = 0U;
 	}
 	InstancePtr->BbtDesc.Valid = 0U;
 
@@ -129,6 +141,7 @@ void XNandPsu_InitBbtDesc(XNandPsu *InstancePtr)
 	(void)strcpy(&InstancePtr->BbtMirrorDesc.Signature[0], "1tbB");
 	for (Index = 0U; Index < XNANDPSU_MAX_TARGETS; Index++) {
 		InstancePtr->BbtMirrorDesc.Version[Index] = 0U;
+		InstancePtr->BbtMirrorDesc.NextPage[Index] = 0U;
 	}
 	InstancePtr->BbtMirrorDesc.Valid = 0U;
 
@@ -234,6 +247,8 @@ static void XNandPsu_CreateBbt(XNandPsu *InstancePtr, u32 Target)
 			}
 		}
 	}
+
+	XNandPsu_BuildBadMap(InstancePtr);
 }
 
 /*****************************************************************************/
@@ -262,6 +277,7 @@ s32 XNandPsu_ScanBbt(XNandPsu *InstancePtr)
 	BbtLen = InstancePtr->Geometry.NumBlocks >>
 		 XNANDPSU_BBT_BLOCK_SHIFT;
 	(void)memset(&InstancePtr->Bbt[0], 0, BbtLen);
+	XNandPsu_BuildBadMap(InstancePtr);
 
 	for (Index = 0U; Index < InstancePtr->Geometry.NumTargets; Index++) {
 
@@ -369,6 +385,8 @@ static void XNandPsu_ConvertBbt(XNandPsu *InstancePtr, u8 *Buf, u32 Target)
 			}
 		}
 	}
+
+	XNandPsu_BuildBadMap(InstancePtr);
 }
 
 /*****************************************************************************/
@@ -525,11 +543,13 @@ static s32 XNandPsu_SearchBbt(XNandPsu *InstancePtr, XNandPsu_BbtDesc *Desc,
 			      u32 Target)
 {
 	u32 StartBlock;
-	u32 SigOffset;
-	u32 VerOffset;
 	u32 MaxBlocks;
 	u32 PageOff;
-	u32 SigLength;
+	u32 SlotPages;
+	u32 Low;
+	u32 Mid;
+	u32 High;
+	u8 Version;
 #ifdef __ICCARM__
 #pragma pack(push, 1)
 	u8 Buf[XNANDPSU_MAX_SPARE_SIZE] = {0U};
@@ -538,36 +558,43 @@ static s32 XNandPsu_SearchBbt(XNandPsu *InstancePtr, XNandPsu_BbtDesc *Desc,
 	u8 Buf[XNANDPSU_MAX_SPARE_SIZE] __attribute__ ((aligned(64))) = {0U};
 #endif
 	u32 Block;
-	u32 Offset;
 	s32 Status;
 
 	StartBlock = ((Target + (u32)1) *
 		      InstancePtr->Geometry.NumTargetBlocks) - (u32)1;
-	SigOffset = Desc->SigOffset;
-	VerOffset = Desc->VerOffset;
 	MaxBlocks = Desc->MaxBlocks;
-	SigLength = Desc->SigLength;
+	SlotPages = XNandPsu_BbtSlotPages(InstancePtr);
 
 	/* Read the last 4 blocks for Bad Block Table(BBT) signature */
 	for (Block = 0U; Block < MaxBlocks; Block++) {
 		PageOff = (StartBlock - Block) *
 			  InstancePtr->Geometry.PagesPerBlock;
 
-		Status = XNandPsu_ReadSpareBytes(InstancePtr, PageOff, &Buf[0]);
-		if (Status != XST_SUCCESS) {
-			continue;
-		}
-		/* Check the Bad Block Table(BBT) signature */
-		for (Offset = 0U; Offset < SigLength; Offset++) {
-			if (Buf[Offset + SigOffset] !=
-			    (u8)(Desc->Signature[Offset])) {
-				break; /* Check the next blocks */
+		Status = XNandPsu_ReadBbtSig(InstancePtr, Desc, PageOff,
+					     &Buf[0]);
+		if (Status == XST_SUCCESS) {
+			/*
+			 * Bad Block Table(BBT) found, the updates are written
+			 * in order so look for the last signed page slot.
+			 */
+			Version = Buf[Desc->VerOffset];
+			Low = 0U;
+			High = InstancePtr->Geometry.PagesPerBlock / SlotPages;
+			while ((Low + 1U) < High) {
+				Mid = (Low + High) / 2U;
+				Status = XNandPsu_ReadBbtSig(InstancePtr, Desc,
+						PageOff + (Mid * SlotPages),
+						&Buf[0]);
+				if (Status == XST_SUCCESS) {
+					Low = Mid;
+					Version = Buf[Desc->VerOffset];
+				} else {
+					High = Mid;
+				}
 			}
-		}
-		if (Offset >= SigLength) {
-			/* Bad Block Table(BBT) found */
-			Desc->PageOffset[Target] = PageOff;
-			Desc->Version[Target] = Buf[VerOffset];
+			Desc->PageOffset[Target] = PageOff + (Low * SlotPages);
+			Desc->Version[Target] = Version;
+			Desc->NextPage[Target] = 0U;
 			Desc->Valid = 1U;
 
 			Status = XST_SUCCESS;
@@ -620,8 +647,16 @@ static s32 XNandPsu_WriteBbt(XNandPsu *InstancePtr, XNandPsu_BbtDesc *Desc,
 	u8 BlockType;
 	u32 BbtLen = InstancePtr->Geometry.NumBlocks >>
 		     XNANDPSU_BBT_BLOCK_SHIFT;
+	u32 PagesPerBlock = InstancePtr->Geometry.PagesPerBlock;
+	u32 SlotPages = XNandPsu_BbtSlotPages(InstancePtr);
+	u32 NextPage = Desc->NextPage[Target];
+
+	/* An interrupted update leaves no known free page in the block */
+	Desc->NextPage[Target] = 0U;
+
 	/* Find a valid block to write the Bad Block Table(BBT) */
 	if ((!Desc->Valid) != 0U) {
+		NextPage = 0U;
 		for (Index = 0U; Index < Desc->MaxBlocks; Index++) {
 			Block  = (EndBlock - Index);
 			BlockOffset = Block >> XNANDPSU_BBT_BLOCK_SHIFT;
@@ -656,9 +691,13 @@ static s32 XNandPsu_WriteBbt(XNandPsu *InstancePtr, XNandPsu_BbtDesc *Desc,
 			Status = XST_FAILURE;
 			goto Out;
 		}
+	} else if (NextPage != 0U) {
+		/* Append to the free pages following the last update */
+		Block = NextPage / PagesPerBlock;
+		Desc->PageOffset[Target] = NextPage;
 	} else {
-		Block = Desc->PageOffset[Target] /
-			InstancePtr->Geometry.PagesPerBlock;
+		Block = Desc->PageOffset[Target] / PagesPerBlock;
+		Desc->PageOffset[Target] = Block * PagesPerBlock;
 	}
 	/* Convert the memory based BBT to flash based table */
 	(void)memset(Buf, 0xff, BbtLen);
@@ -677,9 +716,11 @@ static s32 XNandPsu_WriteBbt(XNandPsu *InstancePtr, XNandPsu_BbtDesc *Desc,
 		}
 	}
 	/* Write the Bad Block Table(BBT) to flash */
-	Status = XNandPsu_EraseBlock(InstancePtr, 0U, Block);
-	if (Status != XST_SUCCESS) {
-		goto Out;
+	if (NextPage == 0U) {
+		Status = XNandPsu_EraseBlock(InstancePtr, 0U, Block);
+		if (Status != XST_SUCCESS) {
+			goto Out;
+		}
 	}
 
 	/* Write the BBT to page offset */
@@ -707,6 +748,12 @@ static s32 XNandPsu_WriteBbt(XNandPsu *InstancePtr, XNandPsu_BbtDesc *Desc,
 		goto Out;
 	}
 
+	/* The next update goes to the following pages if they fit */
+	NextPage = Desc->PageOffset[Target] + SlotPages;
+	if ((NextPage + SlotPages) <= ((Block + 1U) * PagesPerBlock)) {
+		Desc->NextPage[Target] = NextPage;
+	}
+
 	Status = XST_SUCCESS;
 Out:
 	return Status;
@@ -833,19 +880,10 @@ s32 XNandPsu_IsBlockBad(XNandPsu *InstancePtr, u32 Block)
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY)
 	Xil_AssertNonvoid(Block < InstancePtr->Geometry.NumBlocks);
 
-	u8 Data;
-	u8 BlockShift;
-	u8 BlockType;
-	u32 BlockOffset;
 	s32 Status;
 
-	BlockOffset = Block >> XNANDPSU_BBT_BLOCK_SHIFT;
-	BlockShift = XNandPsu_BbtBlockShift(Block);
-	Data = InstancePtr->Bbt[BlockOffset];	/* Block information in BBT */
-	BlockType = (Data >> BlockShift) & XNANDPSU_BLOCK_TYPE_MASK;
-
-	if ((BlockType != XNANDPSU_BLOCK_GOOD) &&
-	    (BlockType != XNANDPSU_BLOCK_RESERVED)) {
+	if ((InstancePtr->BbtBadMap[Block >> XNANDPSU_BBT_MAP_SHIFT] &
+	     XNandPsu_BbtMapMask(Block)) != 0U) {
 		Status = XST_SUCCESS;
 	} else {
 		Status = XST_FAILURE;
@@ -879,6 +917,8 @@ s32 XNandPsu_MarkBlockBad(XNandPsu *InstancePtr, u32 Block)
 	u8 NewVal;
 	s32 Status;
 	u32 Target;
+	u32 Word;
+	u32 NumWords;
 
 	Target = Block / InstancePtr->Geometry.NumTargetBlocks;
 
@@ -893,6 +933,17 @@ s32 XNandPsu_MarkBlockBad(XNandPsu *InstancePtr, u32 Block)
 	NewVal = Data;
 	InstancePtr->Bbt[BlockOffset] = Data;
 
+	/* Update the bitmap and the bad block counts of the following words */
+	Word = Block >> XNANDPSU_BBT_MAP_SHIFT;
+	if ((InstancePtr->BbtBadMap[Word] & XNandPsu_BbtMapMask(Block)) == 0U) {
+		InstancePtr->BbtBadMap[Word] |= XNandPsu_BbtMapMask(Block);
+		NumWords = (InstancePtr->Geometry.NumBlocks +
+			    XNANDPSU_BBT_MAP_WORD_MASK) >> XNANDPSU_BBT_MAP_SHIFT;
+		for (Word++; Word < NumWords; Word++) {
+			InstancePtr->BbtBadCount[Word]++;
+		}
+	}
+
 	/* Update the Bad Block Table(BBT) in flash */
 	if (OldVal != NewVal) {
 		Status = XNandPsu_UpdateBbt(InstancePtr, Target);
@@ -905,4 +956,157 @@ s32 XNandPsu_MarkBlockBad(XNandPsu *InstancePtr, u32 Block)
 Out:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+* This function returns the number of good blocks from a block to the end of
+* the flash, using the bad block counts of the bitmap words.
+*
+* @param	InstancePtr is the pointer to the XNandPsu instance.
+* @param	Block is the first block number.
+*
+* @return
+*		- Number of good blocks.
+*
+******************************************************************************/
+u32 XNandPsu_NumGoodBlocks(XNandPsu *InstancePtr, u32 Block)
+{
+	u32 NumBlocks = InstancePtr->Geometry.NumBlocks;
+	u32 Last;
+	u32 Word;
+	u32 NumBad;
+	u32 NumGood = 0U;
+
+	if (Block >= NumBlocks) {
+		goto Out;
+	}
+
+	/* Bad blocks of the flash less the ones before the block */
+	Last = (NumBlocks - 1U) >> XNANDPSU_BBT_MAP_SHIFT;
+	NumBad = (u32)InstancePtr->BbtBadCount[Last] +
+		 XNandPsu_BbtPopCount(InstancePtr->BbtBadMap[Last]);
+	Word = Block >> XNANDPSU_BBT_MAP_SHIFT;
+	NumBad -= (u32)InstancePtr->BbtBadCount[Word] +
+		  XNandPsu_BbtPopCount(InstancePtr->BbtBadMap[Word] &
+				       (XNandPsu_BbtMapMask(Block) - 1U));
+	NumGood = (NumBlocks - Block) - NumBad;
+Out:
+	return NumGood;
+}
+
+/*****************************************************************************/
+/**
+* This function reads the spare bytes of a page and checks them for the
+* Bad Block Table(BBT) signature.
+*
+* @param	InstancePtr is the pointer to the XNandPsu instance.
+* @param	Desc is the BBT descriptor pattern to search.
+* @param	Page is the page to check.
+* @param	Buf is the buffer to read the spare bytes into.
+*
+* @return
+*		- XST_SUCCESS if the signature is found.
+*		- XST_FAILURE if not.
+*
+******************************************************************************/
+static s32 XNandPsu_ReadBbtSig(XNandPsu *InstancePtr, XNandPsu_BbtDesc *Desc,
+			       u32 Page, u8 *Buf)
+{
+	u32 Offset;
+	s32 Status;
+
+	Status = XNandPsu_ReadSpareBytes(InstancePtr, Page, Buf);
+	if (Status != XST_SUCCESS) {
+		goto Out;
+	}
+	for (Offset = 0U; Offset < Desc->SigLength; Offset++) {
+		if (Buf[Offset + Desc->SigOffset] !=
+		    (u8)(Desc->Signature[Offset])) {
+			Status = XST_FAILURE;
+			break;
+		}
+	}
+Out:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* This function returns the number of pages taken by one copy of the Bad
+* Block Table(BBT) in flash.
+*
+* @param	InstancePtr is the pointer to the XNandPsu instance.
+*
+* @return
+*		- Number of pages.
+*
+******************************************************************************/
+static u32 XNandPsu_BbtSlotPages(XNandPsu *InstancePtr)
+{
+	u32 BbtLen = InstancePtr->Geometry.NumBlocks >>
+		     XNANDPSU_BBT_BLOCK_SHIFT;
+
+	return (BbtLen + InstancePtr->Geometry.BytesPerPage - 1U) /
+	       InstancePtr->Geometry.BytesPerPage;
+}
+
+/*****************************************************************************/
+/**
+* This function builds the bad block bitmap and the bad block counts of its
+* words from the RAM based Bad Block Table(BBT).
+*
+* @param	InstancePtr is the pointer to the XNandPsu instance.
+*
+* @return
+*		- NONE.
+*
+******************************************************************************/
+static void XNandPsu_BuildBadMap(XNandPsu *InstancePtr)
+{
+	u32 Block;
+	u32 Word;
+	u8 BlockType;
+	u16 NumBad = 0U;
+
+	(void)memset(&InstancePtr->BbtBadMap[0], 0,
+		     sizeof(InstancePtr->BbtBadMap));
+
+	for (Block = 0U; Block < InstancePtr->Geometry.NumBlocks; Block++) {
+		Word = Block >> XNANDPSU_BBT_MAP_SHIFT;
+		if ((Block & XNANDPSU_BBT_MAP_WORD_MASK) == 0U) {
+			InstancePtr->BbtBadCount[Word] = NumBad;
+		}
+		BlockType = (InstancePtr->Bbt[Block >> XNANDPSU_BBT_BLOCK_SHIFT] >>
+			     XNandPsu_BbtBlockShift(Block)) &
+			    XNANDPSU_BLOCK_TYPE_MASK;
+		if ((BlockType != XNANDPSU_BLOCK_GOOD) &&
+		    (BlockType != XNANDPSU_BLOCK_RESERVED)) {
+			InstancePtr->BbtBadMap[Word] |= XNandPsu_BbtMapMask(Block);
+			NumBad++;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function returns the number of bits set in a bitmap word.
+*
+* @param	Data is the bitmap word.
+*
+* @return
+*		- Number of bits set.
+*
+******************************************************************************/
+static u32 XNandPsu_BbtPopCount(u32 Data)
+{
+	u32 Count = 0U;
+	u32 Value = Data;
+
+	while (Value != 0U) {
+		Value &= Value - 1U;
+		Count++;
+	}
+
+	return Count;
+}
 /** @} */
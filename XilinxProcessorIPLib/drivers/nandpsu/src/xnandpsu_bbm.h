@@ -36,6 +36,11 @@
 * version number increments on every update to the bad block table and the
 * version wraps at 0xff.
 *
+* The updates made in one session are appended to the next free pages of the
+* block holding the table, the block is erased only when it is full and on the
+* first update after a reboot. On reboot the last page with the signature in
+* the block holds the current table.
+*
 * Each block in the Bad Block Table(BBT) is represented by 2 bits.
 * The two bits are encoded as follows in RAM BBT.
 * 0'b00 -> Good Block
@@ -49,6 +54,11 @@
 * 0'b10 -> Block is bad due to wear
 * 0'b11 -> Good Block
 *
+* The RAM BBT is mirrored in a bitmap with one bit set per bad block, along
+* with the number of bad blocks before each 32 block word of the bitmap. The
+* bad block check of a block and the number of good blocks in a range then
+* take constant time.
+*
 * The user can check for the validity of the block using the API
 * XNandPsu_IsBlockBad and take the action based on the return value. Also user
 * can update the bad block table using XNandPsu_MarkBlockBad API.
@@ -65,6 +75,8 @@
 *			   in page section by enabling XNANDPSU_BBT_NO_OOB.
 *			   Modified Bbt Signature and Version Offset value for
 *			   Oob and No-Oob region.
+* 1.12  fl     10/14/26    Added the bad block bitmap and appended the BBT
+*			   updates to the free pages of the BBT block.
 * </pre>
 *
 ******************************************************************************/
@@ -138,6 +150,11 @@ extern "C" {
 #define XNANDPSU_ONDIE_SIG_OFFSET		0x4U
 #define XNANDPSU_ONDIE_VER_OFFSET		0x14U
 
+#define XNANDPSU_BBT_MAP_SHIFT		5U	/**< Blocks per bitmap
+						     word shift */
+#define XNANDPSU_BBT_MAP_WORD_MASK	0x1FU	/**< Block index mask in
+						     a bitmap word */
+
 #define XNANDPSU_BBT_VERSION_LENGTH	1U
 #define XNANDPSU_BBT_SIG_LENGTH		4U
 
@@ -165,6 +182,21 @@ extern "C" {
 #define XNandPsu_BbtBlockShift(Block) \
 	(u8)(((Block) * 2U) & XNANDPSU_BLOCK_SHIFT_MASK)
 
+/****************************************************************************/
+/**
+*
+* This macro returns the bit mask of a Block in its bad block bitmap word.
+*
+* @param        Block is the block number.
+*
+* @return       Bit mask of the block
+*
+* @note         None.
+*
+*****************************************************************************/
+#define XNandPsu_BbtMapMask(Block) \
+	((u32)1U << ((Block) & XNANDPSU_BBT_MAP_WORD_MASK))
+
 /************************** Variable Definitions *****************************/
 
 /************************** Function Prototypes ******************************/
@@ -173,6 +205,8 @@ void XNandPsu_InitBbtDesc(XNandPsu *InstancePtr);
 
 s32 XNandPsu_IsBlockBad(XNandPsu *InstancePtr, u32 Block);
 
+u32 XNandPsu_NumGoodBlocks(XNandPsu *InstancePtr, u32 Block);
+
 #ifdef __cplusplus
 }
 #endif
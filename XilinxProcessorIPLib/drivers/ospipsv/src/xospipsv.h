@@ -85,6 +85,9 @@
 * 1.8   sk   11/11/22 Enable Master DLL mode by default for Versal Net.
 *       sk   11/29/22 Added support for Indirect Non-Dma write.
 * 1.9   sb   06/06/23 Added support for system device-tree flow.
+* 1.9   fl   10/14/26 Added write queue APIs, which chain page programs
+*                     with the write completion auto polling and suspend
+*                     a sector erase for reads.
 *
 * </pre>
 *
@@ -199,6 +202,51 @@ typedef struct {
 #endif
 } XOspiPsv;
 
+/**
+ * This typedef contains the flash commands used by the write queue.
+ */
+typedef struct {
+	u8 ProgramOpcode;	/**< Page program opcode */
+	u8 ProgramProto;	/**< Page program protocol in SDR mode */
+	u8 EraseOpcode;		/**< Sector erase opcode */
+	u8 StatusOpcode;	/**< Read status register opcode */
+	u8 BusyMask;		/**< Status bit set while programming/erasing */
+	u8 SuspendOpcode;	/**< Erase suspend opcode, 0 if not supported */
+	u8 ResumeOpcode;	/**< Erase resume opcode */
+	u8 Addrsize;		/**< Size of address in bytes */
+	u32 PageSize;		/**< Page size in bytes */
+} XOspiPsv_FlashCmds;
+
+/**
+ * This typedef contains a request of the write queue.
+ */
+typedef struct {
+	u32 Addr;		/**< Flash address */
+	u8 *TxBfrPtr;		/**< Data to program, NULL to erase the sector */
+	u32 ByteCount;		/**< Number of bytes to program */
+} XOspiPsv_WriteReq;
+
+/**
+ * This typedef contains the state of a write queue. The requests are kept
+ * in a ring of caller provided entries.
+ */
+typedef struct {
+	const XOspiPsv_FlashCmds *Cmds;	/**< Flash commands */
+	XOspiPsv_WriteReq *Req;	/**< Ring of requests */
+	u32 NumReq;		/**< Number of entries of the ring */
+	u32 Head;		/**< Entry of the oldest request */
+	u32 Count;		/**< Number of queued requests */
+	u8 EraseBusy;		/**< Erase of the oldest request in progress */
+	XOspiPsv_Msg Msg;	/**< Message of the flash commands */
+#ifdef __ICCARM__
+#pragma pack(push, 8)
+	u8 StatusBfr[4];	/**< Status register read buffer */
+#pragma pack(pop)
+#else
+	u8 StatusBfr[4] __attribute__ ((aligned(4))); /**< Status buffer */
+#endif
+} XOspiPsv_WriteQueue;
+
 /************************** Variable Definitions *****************************/
 extern XOspiPsv_Config XOspiPsv_ConfigTable[];
 
@@ -441,6 +489,14 @@ u32 XOspiPsv_StartDmaTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg);
 u32 XOspiPsv_CheckDmaDone(XOspiPsv *InstancePtr);
 u32 XOspiPsv_SetDllDelay(XOspiPsv *InstancePtr);
 u32 XOspiPsv_ConfigDualByteOpcode(XOspiPsv *InstancePtr, u8 Enable);
+/* Write queue functions */
+u32 XOspiPsv_WriteQueueInit(XOspiPsv *InstancePtr, XOspiPsv_WriteQueue *QueuePtr,
+		const XOspiPsv_FlashCmds *Cmds, XOspiPsv_WriteReq *ReqPtr, u32 NumReq);
+u32 XOspiPsv_WriteQueueAdd(XOspiPsv_WriteQueue *QueuePtr, u32 Addr,
+		u8 *TxBfrPtr, u32 ByteCount);
+u32 XOspiPsv_WriteQueuePoll(XOspiPsv *InstancePtr, XOspiPsv_WriteQueue *QueuePtr);
+u32 XOspiPsv_WriteQueueRead(XOspiPsv *InstancePtr, XOspiPsv_WriteQueue *QueuePtr,
+		XOspiPsv_Msg *Msg);
 #ifdef __cplusplus
 }
 #endif
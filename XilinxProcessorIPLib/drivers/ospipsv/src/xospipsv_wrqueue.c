@@ -0,0 +1,497 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xospipsv_wrqueue.c
+* @addtogroup ospipsv Overview
+* @{
+*
+* This file implements the write queue of the OSPIPSV driver. Programs and
+* sector erases are queued and run in order by XOspiPsv_WriteQueuePoll().
+*
+* A program is issued as one write of the whole request. The controller
+* splits it at the page boundaries set in the device size register, sends
+* the write enable before every page and polls the flash status after every
+* page with the write completion auto polling, so no CPU status polling is
+* done between the pages. A sector erase is started and left running, and
+* XOspiPsv_WriteQueueRead() suspends it for a read and resumes it after.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- -----------------------------------------------
+* 1.9   fl  10/14/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xospipsv.h"
+#include "xospipsv_control.h"
+#include "sleep.h"
+
+/************************** Constant Definitions *****************************/
+
+#define WRITE_ENABLE_CMD	0x06U	/**< Write enable opcode */
+#define MAX_BUSY_POLL_CNT	1000000U	/**< Status polls, 10us apart */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static u32 XOspiPsv_WrqCmd(XOspiPsv *InstancePtr,
+		XOspiPsv_WriteQueue *QueuePtr, u8 Opcode, u8 Addrvalid, u32 Addr);
+static u32 XOspiPsv_WrqIsBusy(XOspiPsv *InstancePtr,
+		XOspiPsv_WriteQueue *QueuePtr, u8 *Busy);
+static u32 XOspiPsv_WrqWaitReady(XOspiPsv *InstancePtr,
+		XOspiPsv_WriteQueue *QueuePtr);
+static u32 XOspiPsv_WrqProgram(XOspiPsv *InstancePtr,
+		XOspiPsv_WriteQueue *QueuePtr, const XOspiPsv_WriteReq *Req);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* @brief
+* This function initializes a write queue and configures the controller to
+* program whole pages on its own: the page size and the write completion
+* auto polling of the status register. The write enable before each page is
+* sent by the controller, as the write instruction setup leaves WEL_DIS
+* cleared.
+*
+* @param	InstancePtr is a pointer to the XOspiPsv instance.
+* @param	QueuePtr is a pointer to the write queue.
+* @param	Cmds is a pointer to the flash commands, used until the queue
+*		is no longer used.
+* @param	ReqPtr is a pointer to the ring of request entries.
+* @param	NumReq is the number of entries of the ring.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if the flash commands are not valid.
+*
+******************************************************************************/
+u32 XOspiPsv_WriteQueueInit(XOspiPsv *InstancePtr, XOspiPsv_WriteQueue *QueuePtr,
+		const XOspiPsv_FlashCmds *Cmds, XOspiPsv_WriteReq *ReqPtr, u32 NumReq)
+{
+	u32 Status;
+	u32 ReadReg;
+	u32 BitIndex = 0U;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(Cmds != NULL);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+	Xil_AssertNonvoid(NumReq > 0U);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((Cmds->BusyMask == 0U) || (Cmds->PageSize == 0U) ||
+			(Cmds->PageSize > (XOSPIPSV_DEV_SIZE_CONFIG_REG_BYTES_PER_DEVICE_PAGE_FLD_MASK >>
+			XOSPIPSV_DEV_SIZE_CONFIG_REG_BYTES_PER_DEVICE_PAGE_FLD_SHIFT))) {
+		Status = XST_FAILURE;
+		goto ERROR_PATH;
+	}
+
+	while (((u32)Cmds->BusyMask & ((u32)1U << BitIndex)) == 0U) {
+		BitIndex++;
+	}
+
+	QueuePtr->Cmds = Cmds;
+	QueuePtr->Req = ReqPtr;
+	QueuePtr->NumReq = NumReq;
+	QueuePtr->Head = 0U;
+	QueuePtr->Count = 0U;
+	QueuePtr->EraseBusy = (u8)FALSE;
+
+	XOspiPsv_Disable(InstancePtr);
+	ReadReg = XOspiPsv_ReadReg(InstancePtr->Config.BaseAddress,
+			XOSPIPSV_DEV_SIZE_CONFIG_REG);
+	ReadReg &= ~XOSPIPSV_DEV_SIZE_CONFIG_REG_BYTES_PER_DEVICE_PAGE_FLD_MASK;
+	ReadReg |= (Cmds->PageSize <<
+			XOSPIPSV_DEV_SIZE_CONFIG_REG_BYTES_PER_DEVICE_PAGE_FLD_SHIFT);
+	XOspiPsv_WriteReg(InstancePtr->Config.BaseAddress,
+			XOSPIPSV_DEV_SIZE_CONFIG_REG, ReadReg);
+
+	/* Poll the busy bit of the status register until it reads 0 */
+	ReadReg = XOspiPsv_ReadReg(InstancePtr->Config.BaseAddress,
+			XOSPIPSV_WRITE_COMPLETION_CTRL_REG);
+	ReadReg &= ~(XOSPIPSV_WRITE_COMPLETION_CTRL_REG_DISABLE_POLLING_FLD_MASK |
+			XOSPIPSV_WRITE_COMPLETION_CTRL_REG_POLLING_POLARITY_FLD_MASK |
+			XOSPIPSV_WRITE_COMPLETION_CTRL_REG_POLLING_ADDR_EN_FLD_MASK |
+			XOSPIPSV_WRITE_COMPLETION_CTRL_REG_POLLING_BIT_INDEX_FLD_MASK |
+			XOSPIPSV_WRITE_COMPLETION_CTRL_REG_OPCODE_FLD_MASK);
+	ReadReg |= (BitIndex <<
+			XOSPIPSV_WRITE_COMPLETION_CTRL_REG_POLLING_BIT_INDEX_FLD_SHIFT);
+	ReadReg |= ((u32)Cmds->StatusOpcode <<
+			XOSPIPSV_WRITE_COMPLETION_CTRL_REG_OPCODE_FLD_SHIFT);
+	XOspiPsv_WriteReg(InstancePtr->Config.BaseAddress,
+			XOSPIPSV_WRITE_COMPLETION_CTRL_REG, ReadReg);
+	XOspiPsv_Enable(InstancePtr);
+
+	/* Dummy cycles of the status read, which depend on the edge mode */
+	XOspiPsv_ConfigureAutoPolling(InstancePtr, InstancePtr->SdrDdrMode);
+
+	Status = (u32)XST_SUCCESS;
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function queues a program or a sector erase. The data of a program
+* must stay valid until the request is run by XOspiPsv_WriteQueuePoll().
+*
+* @param	QueuePtr is a pointer to the write queue.
+* @param	Addr is the flash address.
+* @param	TxBfrPtr is the data to program, NULL to erase the sector at
+*		Addr.
+* @param	ByteCount is the number of bytes to program, ignored for an
+*		erase.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FIFO_NO_ROOM if all the entries of the ring are used.
+*
+******************************************************************************/
+u32 XOspiPsv_WriteQueueAdd(XOspiPsv_WriteQueue *QueuePtr, u32 Addr,
+		u8 *TxBfrPtr, u32 ByteCount)
+{
+	u32 Status;
+	XOspiPsv_WriteReq *Req;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid((TxBfrPtr == NULL) || (ByteCount > 0U));
+
+	if (QueuePtr->Count == QueuePtr->NumReq) {
+		Status = XST_FIFO_NO_ROOM;
+		goto ERROR_PATH;
+	}
+
+	Req = &QueuePtr->Req[(QueuePtr->Head + QueuePtr->Count) % QueuePtr->NumReq];
+	Req->Addr = Addr;
+	Req->TxBfrPtr = TxBfrPtr;
+	Req->ByteCount = ByteCount;
+	QueuePtr->Count++;
+
+	Status = (u32)XST_SUCCESS;
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function runs the queued requests in order. Programs run to
+* completion. A sector erase is started and this function returns while it
+* is in progress; the next call checks whether it has completed.
+*
+* @param	InstancePtr is a pointer to the XOspiPsv instance.
+* @param	QueuePtr is a pointer to the write queue.
+*
+* @return
+*		- XST_SUCCESS if the queue is empty and the flash is idle.
+*		- XST_DEVICE_BUSY if a sector erase is in progress.
+*		- XST_FAILURE if a request failed. It is removed from the queue.
+*
+******************************************************************************/
+u32 XOspiPsv_WriteQueuePoll(XOspiPsv *InstancePtr, XOspiPsv_WriteQueue *QueuePtr)
+{
+	u32 Status = (u32)XST_SUCCESS;
+	const XOspiPsv_WriteReq *Req;
+	u8 Busy;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	while ((QueuePtr->Count != 0U) && (Status == (u32)XST_SUCCESS)) {
+		Req = &QueuePtr->Req[QueuePtr->Head];
+		if (QueuePtr->EraseBusy != (u8)FALSE) {
+			Status = XOspiPsv_WrqIsBusy(InstancePtr, QueuePtr, &Busy);
+			if ((Status == (u32)XST_SUCCESS) && (Busy != 0U)) {
+				Status = (u32)XST_DEVICE_BUSY;
+				goto ERROR_PATH;
+			}
+			QueuePtr->EraseBusy = (u8)FALSE;
+		} else if (Req->TxBfrPtr == NULL) {
+			Status = XOspiPsv_WrqCmd(InstancePtr, QueuePtr, WRITE_ENABLE_CMD,
+					0U, 0U);
+			if (Status == (u32)XST_SUCCESS) {
+				Status = XOspiPsv_WrqCmd(InstancePtr, QueuePtr,
+						QueuePtr->Cmds->EraseOpcode, 1U, Req->Addr);
+			}
+			if (Status == (u32)XST_SUCCESS) {
+				QueuePtr->EraseBusy = (u8)TRUE;
+				Status = (u32)XST_DEVICE_BUSY;
+				goto ERROR_PATH;
+			}
+		} else {
+			Status = XOspiPsv_WrqProgram(InstancePtr, QueuePtr, Req);
+		}
+
+		QueuePtr->Head = (QueuePtr->Head + 1U) % QueuePtr->NumReq;
+		QueuePtr->Count--;
+	}
+
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function performs a read with XOspiPsv_PollTransfer() while a write
+* queue may have a sector erase in progress. The erase is suspended for the
+* read and resumed after it, or waited for if the flash has no erase
+* suspend.
+*
+* @param	InstancePtr is a pointer to the XOspiPsv instance.
+* @param	QueuePtr is a pointer to the write queue.
+* @param	Msg is a pointer to the structure containing the read.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if the read or the suspend/resume failed.
+*		- XST_DEVICE_BUSY if a transfer is already in progress.
+*
+******************************************************************************/
+u32 XOspiPsv_WriteQueueRead(XOspiPsv *InstancePtr, XOspiPsv_WriteQueue *QueuePtr,
+		XOspiPsv_Msg *Msg)
+{
+	u32 Status;
+	u32 ResumeStatus;
+	u8 Busy = 0U;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(Msg != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (QueuePtr->EraseBusy != (u8)FALSE) {
+		Status = XOspiPsv_WrqIsBusy(InstancePtr, QueuePtr, &Busy);
+		if (Status != (u32)XST_SUCCESS) {
+			goto ERROR_PATH;
+		}
+	}
+
+	if (Busy == 0U) {
+		Status = XOspiPsv_PollTransfer(InstancePtr, Msg);
+		goto ERROR_PATH;
+	}
+
+	if (QueuePtr->Cmds->SuspendOpcode == 0U) {
+		Status = XOspiPsv_WrqWaitReady(InstancePtr, QueuePtr);
+		if (Status == (u32)XST_SUCCESS) {
+			Status = XOspiPsv_PollTransfer(InstancePtr, Msg);
+		}
+		goto ERROR_PATH;
+	}
+
+	/* The busy bit clears once the erase is suspended */
+	Status = XOspiPsv_WrqCmd(InstancePtr, QueuePtr,
+			QueuePtr->Cmds->SuspendOpcode, 0U, 0U);
+	if (Status == (u32)XST_SUCCESS) {
+		Status = XOspiPsv_WrqWaitReady(InstancePtr, QueuePtr);
+	}
+	if (Status == (u32)XST_SUCCESS) {
+		Status = XOspiPsv_PollTransfer(InstancePtr, Msg);
+	}
+
+	/* Resume even after a failure, not to leave the erase suspended */
+	ResumeStatus = XOspiPsv_WrqCmd(InstancePtr, QueuePtr,
+			QueuePtr->Cmds->ResumeOpcode, 0U, 0U);
+	if (Status == (u32)XST_SUCCESS) {
+		Status = ResumeStatus;
+	}
+
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function sends a flash command without data.
+*
+* @param	InstancePtr is a pointer to the XOspiPsv instance.
+* @param	QueuePtr is a pointer to the write queue.
+* @param	Opcode is the command.
+* @param	Addrvalid is 1 if the command takes Addr, 0 otherwise.
+* @param	Addr is the flash address.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if transfer fails.
+*
+******************************************************************************/
+static u32 XOspiPsv_WrqCmd(XOspiPsv *InstancePtr,
+		XOspiPsv_WriteQueue *QueuePtr, u8 Opcode, u8 Addrvalid, u32 Addr)
+{
+	XOspiPsv_Msg *Msg = &QueuePtr->Msg;
+
+	Msg->Opcode = Opcode;
+	Msg->Addrvalid = Addrvalid;
+	Msg->Addrsize = (Addrvalid != 0U) ? QueuePtr->Cmds->Addrsize : 0U;
+	Msg->Addr = Addr;
+	Msg->TxBfrPtr = NULL;
+	Msg->RxBfrPtr = NULL;
+	Msg->ByteCount = 0U;
+	Msg->Flags = XOSPIPSV_MSG_FLAG_TX;
+	Msg->Dummy = 0U;
+	Msg->IsDDROpCode = 0U;
+	Msg->Xfer64bit = 0U;
+	Msg->Proto = 0U;
+	if (InstancePtr->SdrDdrMode == XOSPIPSV_EDGE_MODE_DDR_PHY) {
+		Msg->Proto = (Addrvalid != 0U) ? XOSPIPSV_WRITE_8_8_0 :
+				XOSPIPSV_WRITE_8_0_0;
+	}
+	Msg->ExtendedOpcode = (u8)(~Opcode);
+
+	return XOspiPsv_PollTransfer(InstancePtr, Msg);
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function reads the status register of the flash.
+*
+* @param	InstancePtr is a pointer to the XOspiPsv instance.
+* @param	QueuePtr is a pointer to the write queue.
+* @param	Busy returns non-zero if a program or erase is in progress.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if transfer fails.
+*
+******************************************************************************/
+static u32 XOspiPsv_WrqIsBusy(XOspiPsv *InstancePtr,
+		XOspiPsv_WriteQueue *QueuePtr, u8 *Busy)
+{
+	XOspiPsv_Msg *Msg = &QueuePtr->Msg;
+	u32 Status;
+
+	Msg->Opcode = QueuePtr->Cmds->StatusOpcode;
+	Msg->Addrvalid = 0U;
+	Msg->Addrsize = 0U;
+	Msg->Addr = 0U;
+	Msg->TxBfrPtr = NULL;
+	Msg->RxBfrPtr = QueuePtr->StatusBfr;
+	Msg->ByteCount = 1U;
+	Msg->Flags = XOSPIPSV_MSG_FLAG_RX;
+	Msg->Dummy = InstancePtr->Extra_DummyCycle;
+	Msg->IsDDROpCode = 0U;
+	Msg->Xfer64bit = 0U;
+	Msg->Proto = 0U;
+	if (InstancePtr->SdrDdrMode == XOSPIPSV_EDGE_MODE_DDR_PHY) {
+		Msg->Proto = XOSPIPSV_READ_8_0_8;
+		Msg->ByteCount = 2U;
+		Msg->Dummy += XOSPIPSV_DDR_STATS_REG_DUMMY;
+	}
+	Msg->ExtendedOpcode = (u8)(~Msg->Opcode);
+
+	Status = XOspiPsv_PollTransfer(InstancePtr, Msg);
+	*Busy = QueuePtr->StatusBfr[0] & QueuePtr->Cmds->BusyMask;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function waits for the flash to complete a program or an erase, or
+* to suspend an erase.
+*
+* @param	InstancePtr is a pointer to the XOspiPsv instance.
+* @param	QueuePtr is a pointer to the write queue.
+*
+* @return
+*		- XST_SUCCESS if the flash is idle.
+*		- XST_FAILURE if transfer fails or on a timeout.
+*
+******************************************************************************/
+static u32 XOspiPsv_WrqWaitReady(XOspiPsv *InstancePtr,
+		XOspiPsv_WriteQueue *QueuePtr)
+{
+	u32 Status;
+	u32 Count = 0U;
+	u8 Busy;
+
+	do {
+		Status = XOspiPsv_WrqIsBusy(InstancePtr, QueuePtr, &Busy);
+		if ((Status != (u32)XST_SUCCESS) || (Busy == 0U)) {
+			goto ERROR_PATH;
+		}
+		usleep(10);
+		Count++;
+	} while (Count < MAX_BUSY_POLL_CNT);
+
+	Status = XST_FAILURE;
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function programs a request with one write. The controller splits
+* it into page programs and auto polls the flash after each page.
+*
+* @param	InstancePtr is a pointer to the XOspiPsv instance.
+* @param	QueuePtr is a pointer to the write queue.
+* @param	Req is a pointer to the request.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if transfer fails.
+*
+******************************************************************************/
+static u32 XOspiPsv_WrqProgram(XOspiPsv *InstancePtr,
+		XOspiPsv_WriteQueue *QueuePtr, const XOspiPsv_WriteReq *Req)
+{
+	XOspiPsv_Msg *Msg = &QueuePtr->Msg;
+	u32 Status;
+
+	Status = XOspiPsv_WrqCmd(InstancePtr, QueuePtr, WRITE_ENABLE_CMD, 0U, 0U);
+	if (Status != (u32)XST_SUCCESS) {
+		goto ERROR_PATH;
+	}
+
+	Msg->Opcode = QueuePtr->Cmds->ProgramOpcode;
+	Msg->Addrvalid = 1U;
+	Msg->Addrsize = QueuePtr->Cmds->Addrsize;
+	Msg->Addr = Req->Addr;
+	Msg->TxBfrPtr = Req->TxBfrPtr;
+	Msg->RxBfrPtr = NULL;
+	Msg->ByteCount = Req->ByteCount;
+	Msg->Flags = XOSPIPSV_MSG_FLAG_TX;
+	Msg->Dummy = 0U;
+	Msg->IsDDROpCode = 0U;
+	Msg->Xfer64bit = 0U;
+	Msg->Proto = QueuePtr->Cmds->ProgramProto;
+	if (InstancePtr->SdrDdrMode == XOSPIPSV_EDGE_MODE_DDR_PHY) {
+		Msg->Proto = XOSPIPSV_WRITE_8_8_8;
+	}
+	Msg->ExtendedOpcode = (u8)(~Msg->Opcode);
+
+	Status = XOspiPsv_PollTransfer(InstancePtr, Msg);
+	if (Status != (u32)XST_SUCCESS) {
+		goto ERROR_PATH;
+	}
+
+	/* Short programs go through STIG, which is not auto polled */
+	Status = XOspiPsv_WrqWaitReady(InstancePtr, QueuePtr);
+
+ERROR_PATH:
+	return Status;
+}
+/** @} */
@@ -17,6 +17,9 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 1.0	bs	08/21/2018	First release
+* 1.1	fl	10/14/2026	Added the topology cache and fast enumeration,
+*				single device scan below PCIe ports and the
+*				split initialization with XPciePsu_WaitLinkUp
 * </pre>
 *
 *******************************************************************************/
@@ -32,6 +35,8 @@
 
 /**************************** Variable Definitions ****************************/
 
+/* Last bus number assigned by the enumeration */
+static u8 LastBusNum;
 
 /***************************** Function Prototypes ****************************/
 
@@ -187,7 +192,6 @@ static int XPciePsu_BridgeInit(XPciePsu *InstancePtr)
 	XPciePsu_Config *CfgPtr;
 	s32 Status;
 	u32 BRegVal, ECamVal, FirstBusNo = 0, ECamValMin, ECamSize;
-	int Err;
 
 	CfgPtr = &(InstancePtr->Config);
 
@@ -225,13 +229,6 @@ static int XPciePsu_BridgeInit(XPciePsu *InstancePtr)
 	XPciePsu_WriteReg(CfgPtr->BrigReg, XPCIEPSU_BRCFG_RX_MSG_FILTER,
 			  CFG_ENABLE_MSG_FILTER_MASK);
 
-	/* Check for linkup */
-	Err = XPciePsu_PcieLinkUpTimeout(CfgPtr);
-	if (Err != (s32)XPCIEPSU_LINKUP_SUCCESS){
-		Status = (s32)XST_FAILURE;
-		goto End;
-	}
-
 	ECamVal = XPciePsu_ReadReg(CfgPtr->BrigReg,
 				XPCIEPSU_E_ECAM_CAPABILITIES) & E_ECAM_PRESENT;
 	if (ECamVal == 0U) {
@@ -277,6 +274,38 @@ static int XPciePsu_BridgeInit(XPciePsu *InstancePtr)
 
 	XPciePsu_WriteReg(CfgPtr->Ecam, XPCIEPSU_PRIMARY_BUS, ECamVal);
 
+	Status = (s32)XST_SUCCESS;
+
+End:
+	return Status;
+}
+
+/******************************************************************************/
+/**
+* This function waits for the PCIe link of the bridge initialized by
+* XPciePsu_BridgeInit and masks the misc and legacy interrupts.
+*
+* @param   InstancePtr pointer to XPciePsu Instance Pointer
+*
+* @return  0 if success
+*          error value on failure
+*
+*******************************************************************************/
+static int XPciePsu_BridgeLinkInit(XPciePsu *InstancePtr)
+{
+	XPciePsu_Config *CfgPtr;
+	s32 Status;
+	int Err;
+
+	CfgPtr = &(InstancePtr->Config);
+
+	/* Check for linkup */
+	Err = XPciePsu_PcieLinkUpTimeout(CfgPtr);
+	if (Err != (s32)XPCIEPSU_LINKUP_SUCCESS){
+		Status = (s32)XST_FAILURE;
+		goto End;
+	}
+
 	/* check link up */
 	if (XPciePsu_PcieLinkUp(CfgPtr) == (s32)XPCIEPSU_LINKUP_SUCCESS) {
 		XPciePsu_Dbg("Link is UP\r\n");
@@ -563,6 +592,110 @@ static u32 XPciePsu_ReserveBarMem(XPciePsu *InstancePtr, u32 Size)
 	return Ret;
 }
 #endif
+/******************************************************************************/
+/**
+* This function adds a function to the topology cache being recorded.
+*
+* @param   InstancePtr pointer to XPciePsu Instance Pointer
+* @param   Bus
+* @param   Device
+* @param   Function
+* @param   Id vendor and device ID register of the function
+* @param   IsBridge 1 for a type 1 header
+*
+* @return  entry of the function
+*          NULL if no topology is recorded or the cache is full
+*
+*******************************************************************************/
+static XPciePsu_TopoEntry *XPciePsu_TopoAdd(XPciePsu *InstancePtr, u8 Bus,
+					    u8 Device, u8 Function, u32 Id,
+					    u8 IsBridge)
+{
+	XPciePsu_Topology *TopoPtr = InstancePtr->Topology;
+	XPciePsu_TopoEntry *EntryPtr;
+
+	if (TopoPtr == NULL) {
+		return NULL;
+	}
+
+	if (TopoPtr->Count >= XPCIEPSU_TOPO_MAX_FUNCS) {
+		/* Does not fit, the topology is not cached */
+		TopoPtr->Count = XPCIEPSU_TOPO_MAX_FUNCS + 1U;
+		return NULL;
+	}
+
+	EntryPtr = &TopoPtr->Entry[TopoPtr->Count];
+	(void)memset(EntryPtr, 0, sizeof(XPciePsu_TopoEntry));
+	EntryPtr->Bus = Bus;
+	EntryPtr->Device = Device;
+	EntryPtr->Function = Function;
+	EntryPtr->Id = Id;
+	EntryPtr->IsBridge = IsBridge;
+	TopoPtr->Count++;
+
+	return EntryPtr;
+}
+
+/******************************************************************************/
+/**
+* This function records the value written to a BAR in the topology cache.
+*
+* @param   EntryPtr topology entry of the function, NULL if not recorded
+* @param   BarNo BAR number
+* @param   Value address written to the BAR
+*
+*******************************************************************************/
+static void XPciePsu_TopoSetBar(XPciePsu_TopoEntry *EntryPtr, u8 BarNo,
+				u32 Value)
+{
+	if ((EntryPtr != NULL) && (BarNo < XPCIEPSU_TOPO_MAX_BARS)) {
+		EntryPtr->Bar[BarNo] = Value;
+		EntryPtr->BarMask |= (u32)1U << BarNo;
+	}
+}
+
+/******************************************************************************/
+/**
+* This function checks whether the link below a bridge can only have
+* device 0, that is whether the bridge is a PCIe root or downstream port.
+*
+* @param   InstancePtr pointer to XPciePsu Instance Pointer
+* @param   Bus
+* @param   Device
+* @param   Function
+*
+* @return  1 if only device 0 has to be scanned on the secondary bus
+*          0 otherwise
+*
+*******************************************************************************/
+static u8 XPciePsu_HasSingleDeviceLink(XPciePsu *InstancePtr, u8 Bus,
+				       u8 Device, u8 Function)
+{
+	u16 CapOffset;
+	u32 CapReg;
+	u32 PortType;
+
+	CapOffset = XPciePsu_GetCapabilityOffset(InstancePtr, Bus, Device,
+						 Function, XPCIEPSU_CAP_ID_PCIE);
+	if (CapOffset == 0U) {
+		return 0U;
+	}
+
+	if (XPciePsu_ReadConfigSpace(InstancePtr, Bus, Device, Function,
+				     CapOffset, &CapReg) != (u8)XST_SUCCESS) {
+		return 0U;
+	}
+
+	PortType = (CapReg >> XPCIEPSU_PCIE_PORT_TYPE_SHIFT) &
+		   XPCIEPSU_PCIE_PORT_TYPE_MASK;
+	if ((PortType == XPCIEPSU_PCIE_PORT_TYPE_ROOT) ||
+	    (PortType == XPCIEPSU_PCIE_PORT_TYPE_DOWN)) {
+		return 1U;
+	}
+
+	return 0U;
+}
+
 /******************************************************************************/
 /**
 * This function Composes configuration space location
@@ -572,13 +705,14 @@ static u32 XPciePsu_ReserveBarMem(XPciePsu *InstancePtr, u32 Size)
 * @param   Bus
 * @param   Device
 * @param   Function
+* @param   EntryPtr topology entry to record the BARs in, NULL if none
 *
 * @return  int XST_SUCCESS on success
 *          err on fail
 *
 *******************************************************************************/
 static int XPciePsu_AllocBarSpace(XPciePsu *InstancePtr, u32 Headertype, u8 Bus,
-                           u8 Device, u8 Function)
+                           u8 Device, u8 Function, XPciePsu_TopoEntry *EntryPtr)
 {
 	u32 Data = DATA_MASK_32;
 	u32 Location = 0;
@@ -670,12 +804,14 @@ static int XPciePsu_AllocBarSpace(XPciePsu *InstancePtr, u32 Headertype, u8 Bus,
 			/* Write actual bar address here */
 			XPciePsu_WriteReg((InstancePtr->Config.Ecam), Location,
 					  Tmp);
+			XPciePsu_TopoSetBar(EntryPtr, BarNo, Tmp);
 
 			Tmp = (u32)(BarAddr >> 32U);
 
 			/* Write actual bar address here */
 			XPciePsu_WriteReg((InstancePtr->Config.Ecam),
 						Location_1, Tmp);
+			XPciePsu_TopoSetBar(EntryPtr, BarNo + 1U, Tmp);
 			XPciePsu_Dbg(
 				"bus: %d, device: %d, function: %d: BAR %d, "
 				"ADDR: 0x%p size : %dK\r\n",
@@ -695,6 +831,7 @@ static int XPciePsu_AllocBarSpace(XPciePsu *InstancePtr, u32 Headertype, u8 Bus,
 			/* Write actual bar address here */
 			XPciePsu_WriteReg((InstancePtr->Config.Ecam), Location,
 					Tmp);
+			XPciePsu_TopoSetBar(EntryPtr, BarNo, Tmp);
 			XPciePsu_Dbg(
 				"bus: %d, device: %d, function: %d: BAR %d, "
 				"ADDR: 0x%p size : %dK\r\n",
@@ -727,6 +864,7 @@ static int XPciePsu_AllocBarSpace(XPciePsu *InstancePtr, u32 Headertype, u8 Bus,
 			/* Write actual bar address here */
 			XPciePsu_WriteReg((InstancePtr->Config.Ecam), Location,
 					Tmp);
+			XPciePsu_TopoSetBar(EntryPtr, BarNo, Tmp);
 			XPciePsu_Dbg(
 				"bus: %d, device: %d, function: %d: BAR %d, "
 				"ADDR: 0x%p size : %dK\r\n",
@@ -785,15 +923,20 @@ static void XPciePsu_IncreamentPMem(XPciePsu *InstancePtr)
 *
 * @param   	InstancePtr pointer to XPciePsu Instance Pointer
 * @param   	bus_num	to scans for connected bridges/endpoints on it.
+* @param   	SingleDevice 1 if the bus is the link of a PCIe port, which
+*		only has device 0.
 *
 * @return  	none
 *
 *******************************************************************************/
-static void XPciePsu_FetchDevicesInBus(XPciePsu *InstancePtr, u8 BusNum)
+static void XPciePsu_FetchDevicesInBus(XPciePsu *InstancePtr, u8 BusNum,
+				       u8 SingleDevice)
 {
 	u32 ConfigData = 0;
-	static u8 LastBusNum;
+	XPciePsu_TopoEntry *EntryPtr;
+	u8 ChildSingleDevice;
 
+	u32 PCIeId;
 	u16 PCIeVendorID;
 	u16 PCIeDeviceID;
 	u32 PCIeHeaderType;
@@ -818,6 +961,10 @@ static void XPciePsu_FetchDevicesInBus(XPciePsu *InstancePtr, u8 BusNum)
 
 	for (u8 PCIeDevNum = 0U; PCIeDevNum < XPCIEPSU_CFG_MAX_NUM_OF_DEV;
 	     PCIeDevNum++) {
+		if ((SingleDevice != 0U) && (PCIeDevNum != 0U)) {
+			/* Nothing but device 0 on a PCIe link */
+			break;
+		}
 		for (u8 PCIeFunNum = 0U; PCIeFunNum < XPCIEPSU_CFG_MAX_NUM_OF_FUN;
 		     PCIeFunNum++) {
 
@@ -828,6 +975,7 @@ static void XPciePsu_FetchDevicesInBus(XPciePsu *InstancePtr, u8 BusNum)
 				return;
 			}
 
+			PCIeId = ConfigData;
 			PCIeVendorID = (u16)(ConfigData & 0xFFFFU);
 			PCIeDeviceID = (u16)((ConfigData >> 16U) & 0xFFFFU);
 
@@ -866,6 +1014,9 @@ static void XPciePsu_FetchDevicesInBus(XPciePsu *InstancePtr, u8 BusNum)
 				if (PCIeHeaderType == XPCIEPSU_CFG_HEADER_O_TYPE) {
 					/* This is an End Point */
 					XPciePsu_Dbg("This is an End Point\r\n");
+					EntryPtr = XPciePsu_TopoAdd(InstancePtr,
+						BusNum, PCIeDevNum, PCIeFunNum,
+						PCIeId, 0U);
 
 					/*
 					 * Write Address to PCIe BAR
@@ -873,7 +1024,7 @@ static void XPciePsu_FetchDevicesInBus(XPciePsu *InstancePtr, u8 BusNum)
 					Ret = XPciePsu_AllocBarSpace(
 						InstancePtr, PCIeHeaderType,
 						BusNum, PCIeDevNum,
-						PCIeFunNum);
+						PCIeFunNum, EntryPtr);
 					if (Ret != (s32)XST_SUCCESS) {
 						return;
 					}
@@ -901,6 +1052,10 @@ static void XPciePsu_FetchDevicesInBus(XPciePsu *InstancePtr, u8 BusNum)
 						return;
 					}
 
+					if (EntryPtr != NULL) {
+						EntryPtr->Command = ConfigData;
+					}
+
 					XPciePsu_Dbg(
 						"End Point has been "
 						"enabled\r\n");
@@ -913,13 +1068,16 @@ static void XPciePsu_FetchDevicesInBus(XPciePsu *InstancePtr, u8 BusNum)
 				} else {
 					/* This is a bridge */
 					XPciePsu_Dbg("This is a Bridge\r\n");
+					EntryPtr = XPciePsu_TopoAdd(InstancePtr,
+						BusNum, PCIeDevNum, PCIeFunNum,
+						PCIeId, 1U);
 
 					/* alloc bar space and configure bridge
 					 */
 					Ret = XPciePsu_AllocBarSpace(
 						InstancePtr, PCIeHeaderType,
 						BusNum, PCIeDevNum,
-						PCIeFunNum);
+						PCIeFunNum, EntryPtr);
 
 					if (Ret != (s32)XST_SUCCESS) {
 						continue;
@@ -987,8 +1145,13 @@ static void XPciePsu_FetchDevicesInBus(XPciePsu *InstancePtr, u8 BusNum)
 #endif
 
 					/* Searches secondary bus devices. */
+					ChildSingleDevice =
+						XPciePsu_HasSingleDeviceLink(
+							InstancePtr, BusNum,
+							PCIeDevNum, PCIeFunNum);
 					XPciePsu_FetchDevicesInBus(InstancePtr,
-							  LastBusNum);
+							  LastBusNum,
+							  ChildSingleDevice);
 
 					/*
 					 * update subordinate bus no
@@ -1082,6 +1245,17 @@ static void XPciePsu_FetchDevicesInBus(XPciePsu *InstancePtr, u8 BusNum)
 						ConfigData) != (u8)XST_SUCCESS) {
 						return;
 					}
+
+					if (EntryPtr != NULL) {
+						EntryPtr->BusNums = Adr06;
+						EntryPtr->NpMem = Adr08;
+#if defined(__aarch64__) || defined(__arch64__)
+						EntryPtr->PMem = Adr09;
+						EntryPtr->PMemUpper = Adr10;
+						EntryPtr->PMemLimitUpper = Adr11;
+#endif
+						EntryPtr->Command = ConfigData;
+					}
 				}
 			}
 			if ((PCIeFunNum == 0U) && (PCIeMultiFun == 0U)) {
@@ -1108,8 +1282,172 @@ static void XPciePsu_FetchDevicesInBus(XPciePsu *InstancePtr, u8 BusNum)
 *******************************************************************************/
 u8 XPciePsu_EnumerateBus(XPciePsu *InstancePtr)
 {
+	XPciePsu_Topology *TopoPtr;
+
 	Xil_AssertNonvoid(InstancePtr != NULL);
-	XPciePsu_FetchDevicesInBus(InstancePtr, 0U);
+
+	TopoPtr = InstancePtr->Topology;
+	if (TopoPtr != NULL) {
+		TopoPtr->Magic = 0U;
+		TopoPtr->Count = 0U;
+	}
+
+	LastBusNum = 0U;
+	XPciePsu_FetchDevicesInBus(InstancePtr, 0U, 0U);
+
+	if ((TopoPtr != NULL) && (TopoPtr->Count <= XPCIEPSU_TOPO_MAX_FUNCS)) {
+		TopoPtr->BrigReg = (UINTPTR)InstancePtr->Config.BrigReg;
+		TopoPtr->NpMemBaseAddr = InstancePtr->Config.NpMemBaseAddr;
+#if defined(__aarch64__) || defined(__arch64__)
+		TopoPtr->PMemBaseAddr = InstancePtr->Config.PMemBaseAddr;
+#endif
+		TopoPtr->Magic = XPCIEPSU_TOPO_MAGIC;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+* This function sets the topology cache recorded by XPciePsu_EnumerateBus and
+* used by XPciePsu_FastEnumerateBus.
+*
+* @param    InstancePtr pointer to XPciePsu Instance Pointer
+* @param    TopologyPtr pointer to the topology cache, NULL for none. To be
+*           used across resets it has to be in memory that is kept.
+*
+*******************************************************************************/
+void XPciePsu_SetTopologyCache(XPciePsu *InstancePtr,
+			       XPciePsu_Topology *TopologyPtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->Topology = TopologyPtr;
+}
+
+/******************************************************************************/
+/**
+* This function programs one function from its topology cache entry, after
+* checking that the same function is still there.
+*
+* @param    InstancePtr pointer to XPciePsu Instance Pointer
+* @param    EntryPtr topology entry of the function
+*
+* @return   XST_SUCCESS if the function is programmed
+*           XST_FAILURE if the function changed
+*
+*******************************************************************************/
+static u8 XPciePsu_TopoRestore(XPciePsu *InstancePtr,
+			       const XPciePsu_TopoEntry *EntryPtr)
+{
+	u32 ConfigData;
+	u32 Location;
+	u8 BarNo;
+
+	if ((XPciePsu_ReadConfigSpace(InstancePtr, EntryPtr->Bus,
+				      EntryPtr->Device, EntryPtr->Function,
+				      XPCIEPSU_CFG_ID_REG,
+				      &ConfigData) != (u8)XST_SUCCESS) ||
+	    (ConfigData != EntryPtr->Id)) {
+		return XST_FAILURE;
+	}
+
+	for (BarNo = 0U; BarNo < XPCIEPSU_TOPO_MAX_BARS; BarNo++) {
+		if ((EntryPtr->BarMask & ((u32)1U << BarNo)) != 0U) {
+			Location = XPciePsu_ComposeExternalConfigAddress(
+				EntryPtr->Bus, EntryPtr->Device,
+				EntryPtr->Function,
+				XPCIEPSU_CFG_BAR_BASE_OFFSET + (u16)BarNo);
+			XPciePsu_WriteReg((InstancePtr->Config.Ecam), Location,
+					  EntryPtr->Bar[BarNo]);
+		}
+	}
+
+	if (EntryPtr->IsBridge != 0U) {
+		/* Bus numbers first, the next entries are behind it */
+		if ((XPciePsu_WriteConfigSpace(InstancePtr, EntryPtr->Bus,
+				EntryPtr->Device, EntryPtr->Function,
+				XPCIEPSU_CFG_BUS_NUMS_T1_REG,
+				EntryPtr->BusNums) != (u8)XST_SUCCESS) ||
+		    (XPciePsu_WriteConfigSpace(InstancePtr, EntryPtr->Bus,
+				EntryPtr->Device, EntryPtr->Function,
+				XPCIEPSU_CFG_NP_MEM_T1_REG,
+				EntryPtr->NpMem) != (u8)XST_SUCCESS)) {
+			return XST_FAILURE;
+		}
+#if defined(__aarch64__) || defined(__arch64__)
+		if ((XPciePsu_WriteConfigSpace(InstancePtr, EntryPtr->Bus,
+				EntryPtr->Device, EntryPtr->Function,
+				XPCIEPSU_CFG_P_MEM_T1_REG,
+				EntryPtr->PMem) != (u8)XST_SUCCESS) ||
+		    (XPciePsu_WriteConfigSpace(InstancePtr, EntryPtr->Bus,
+				EntryPtr->Device, EntryPtr->Function,
+				XPCIEPSU_CFG_P_UPPER_MEM_T1_REG,
+				EntryPtr->PMemUpper) != (u8)XST_SUCCESS) ||
+		    (XPciePsu_WriteConfigSpace(InstancePtr, EntryPtr->Bus,
+				EntryPtr->Device, EntryPtr->Function,
+				XPCIEPSU_CFG_P_LIMIT_MEM_T1_REG,
+				EntryPtr->PMemLimitUpper) != (u8)XST_SUCCESS)) {
+			return XST_FAILURE;
+		}
+#endif
+	}
+
+	return XPciePsu_WriteConfigSpace(InstancePtr, EntryPtr->Bus,
+					 EntryPtr->Device, EntryPtr->Function,
+					 XPCIEPSU_CFG_CMD_STATUS_REG,
+					 EntryPtr->Command);
+}
+
+/******************************************************************************/
+/**
+* This function enumerates the PCIe topology from the topology cache. Only
+* the vendor and device IDs of the cached functions are read, the bus numbers,
+* BARs and bridge windows of the cache are written back. If no valid topology
+* is cached for this bridge or a function changed, a full enumeration is done
+* with XPciePsu_EnumerateBus, which records the topology again.
+*
+* @param    InstancePtr pointer to XPciePsu Instance Pointer
+*
+* @return 	1 if success
+* 0 if fails
+*
+* @note     Functions added to the topology, beside the cached ones, are not
+*           found. A full enumeration is needed after a hardware change.
+*
+*******************************************************************************/
+u8 XPciePsu_FastEnumerateBus(XPciePsu *InstancePtr)
+{
+	XPciePsu_Topology *TopoPtr;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	TopoPtr = InstancePtr->Topology;
+	if ((TopoPtr == NULL) || (TopoPtr->Magic != XPCIEPSU_TOPO_MAGIC) ||
+	    (TopoPtr->Count > XPCIEPSU_TOPO_MAX_FUNCS) ||
+	    (TopoPtr->BrigReg != (UINTPTR)InstancePtr->Config.BrigReg)) {
+		return XPciePsu_EnumerateBus(InstancePtr);
+	}
+
+	for (Index = 0U; Index < TopoPtr->Count; Index++) {
+		if (XPciePsu_TopoRestore(InstancePtr,
+					 &TopoPtr->Entry[Index]) !=
+		    (u8)XST_SUCCESS) {
+			XPciePsu_Dbg("Topology changed at %02X:%02X.%X, "
+				     "enumerating\r\n",
+				     TopoPtr->Entry[Index].Bus,
+				     TopoPtr->Entry[Index].Device,
+				     TopoPtr->Entry[Index].Function);
+			return XPciePsu_EnumerateBus(InstancePtr);
+		}
+	}
+
+	InstancePtr->Config.NpMemBaseAddr = TopoPtr->NpMemBaseAddr;
+#if defined(__aarch64__) || defined(__arch64__)
+	InstancePtr->Config.PMemBaseAddr = TopoPtr->PMemBaseAddr;
+#endif
 
 	return XST_SUCCESS;
 }
@@ -1128,6 +1466,36 @@ u8 XPciePsu_EnumerateBus(XPciePsu *InstancePtr)
 *******************************************************************************/
 u32 XPciePsu_CfgInitialize(XPciePsu *InstancePtr, const XPciePsu_Config *CfgPtr,
 			   UINTPTR EffectiveBrgAddress)
+{
+	u32 Status;
+
+	Status = XPciePsu_CfgInitializeAsync(InstancePtr, CfgPtr,
+					     EffectiveBrgAddress);
+	if (Status == (u32)XST_SUCCESS) {
+		Status = XPciePsu_WaitLinkUp(InstancePtr);
+	}
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+* This function initializes the config space and PCIe bridge like
+* XPciePsu_CfgInitialize, without waiting for the PCIe link. The link is
+* waited for with XPciePsu_WaitLinkUp, other initializations can be done in
+* between while the link trains.
+*
+* @param   InstancePtr pointer to XPciePsu Instance Pointer
+* @param   CfgPtr pointer to XPciePsu_Config instrance Pointer.
+* @param   EffectiveBrgAddress config brigReg address
+*
+* @return  XST_SUCCESS on success
+*          err on failure
+*
+*******************************************************************************/
+u32 XPciePsu_CfgInitializeAsync(XPciePsu *InstancePtr,
+				const XPciePsu_Config *CfgPtr,
+				UINTPTR EffectiveBrgAddress)
 {
 	s32 Status;
 
@@ -1155,3 +1523,29 @@ u32 XPciePsu_CfgInitialize(XPciePsu *InstancePtr, const XPciePsu_Config *CfgPtr,
 
 	return (u32)Status;
 }
+
+/******************************************************************************/
+/**
+* This function waits for the PCIe link of a bridge initialized with
+* XPciePsu_CfgInitializeAsync, then masks the misc and legacy interrupts.
+*
+* @param   InstancePtr pointer to XPciePsu Instance Pointer
+*
+* @return  XST_SUCCESS on success
+*          err on failure
+*
+*******************************************************************************/
+u32 XPciePsu_WaitLinkUp(XPciePsu *InstancePtr)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Status = XPciePsu_BridgeLinkInit(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		XPciePsu_Err("Bridge init failed\r\n");
+	}
+
+	return (u32)Status;
+}
@@ -36,12 +36,34 @@
 *   address translation, the provided virtual memory base address replaces the
 *   physical address present in the configuration structure.
 *
+*   - XPciePsu_CfgInitializeAsync(InstancePtr, CfgPtr, EffectiveAddress) and
+*   XPciePsu_WaitLinkUp(InstancePtr) - Same as XPciePsu_CfgInitialize() in
+*   two steps, so that the application can initialize other parts of the
+*   system while the link trains.
+*
+* <b>Topology Cache</b>
+*
+* XPciePsu_SetTopologyCache() gives the driver a XPciePsu_Topology to record
+* the functions found by XPciePsu_EnumerateBus() and the resources assigned
+* to them. XPciePsu_FastEnumerateBus() then only reads the vendor and device
+* IDs of the recorded functions and writes the recorded bus numbers, BARs and
+* windows back, which is much faster than a full scan. When an ID does not
+* match, or nothing is recorded, it falls back to a full enumeration. For the
+* cache to survive a reset, the XPciePsu_Topology has to be in memory that is
+* not cleared or reloaded at boot.
+*
+* Below PCIe root and downstream ports only device 0 is scanned, the link
+* cannot have any other device.
+*
 * <pre>
 * MODIFICATION HISTORY:
 *
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 1.0	bs	08/21/2018	First release
+* 1.1	fl	10/14/2026	Added the topology cache, fast enumeration,
+*				the single device scan below PCIe ports and
+*				the split initialization.
 * </pre>
 *
 *******************************************************************************/
@@ -60,6 +82,10 @@ extern "C" {
 
 /**************************** Constant Definitions ****************************/
 
+#define XPCIEPSU_TOPO_MAX_FUNCS	32U	/**< Functions in a topology cache */
+#define XPCIEPSU_TOPO_MAX_BARS	6U	/**< BARs of a type 0 header */
+#define XPCIEPSU_TOPO_MAGIC	0x50544F50U	/**< Valid topology cache */
+
 /******************** Macros (Inline Functions) Definitions *******************/
 #define ARRAY_SIZE(x)	sizeof(x) / sizeof(x[0])
 
@@ -100,10 +126,45 @@ typedef struct {
 	u8	PcieMode;		/**< pcie mode rc or endpoint */
 } XPciePsu_Config;
 
+/**
+ * One function of the topology, with the register values the enumeration
+ * wrote to it
+ */
+typedef struct {
+	u8 Bus;			/**< Bus number */
+	u8 Device;		/**< Device number */
+	u8 Function;		/**< Function number */
+	u8 IsBridge;		/**< Type 1 header */
+	u32 Id;			/**< Vendor and device ID register */
+	u32 BarMask;		/**< BARs assigned, one bit per BAR */
+	u32 Bar[XPCIEPSU_TOPO_MAX_BARS];	/**< Assigned BAR values */
+	u32 BusNums;		/**< Bridge primary, secondary, subordinate */
+	u32 NpMem;		/**< Bridge non prefetchable window */
+	u32 PMem;		/**< Bridge prefetchable window */
+	u32 PMemUpper;		/**< Bridge prefetchable base upper 32 bits */
+	u32 PMemLimitUpper;	/**< Bridge prefetchable limit upper 32 bits */
+	u32 Command;		/**< Command register */
+} XPciePsu_TopoEntry;
+
+/**
+ * Topology recorded by XPciePsu_EnumerateBus()
+ */
+typedef struct {
+	u32 Magic;		/**< XPCIEPSU_TOPO_MAGIC when valid */
+	u32 Count;		/**< Number of entries */
+	UINTPTR BrigReg;	/**< Bridge the topology was recorded on */
+	u32 NpMemBaseAddr;	/**< Next non prefetchable address */
+#if defined(__aarch64__) || defined(__arch64__)
+	u64 PMemBaseAddr;	/**< Next prefetchable address */
+#endif
+	XPciePsu_TopoEntry Entry[XPCIEPSU_TOPO_MAX_FUNCS]; /**< Functions */
+} XPciePsu_Topology;
+
 typedef struct {
 	XPciePsu_Config Config; /**< Configuration data */
 	u32 IsReady;		/**< Is IP been initialized and ready */
 	u32 MaxSupportedBusNo;		/**< If this is RC IP, Max Number of  Buses */
+	XPciePsu_Topology *Topology;	/**< Topology cache, NULL if none */
 } XPciePsu;
 
 /***************************** Variable defintions ****************************/
@@ -120,7 +181,14 @@ XPciePsu_Config *XPciePsu_LookupConfig(UINTPTR BrigReg);
 
 u32 XPciePsu_CfgInitialize(XPciePsu *InstancePtr, const XPciePsu_Config *CfgPtr,
 			   UINTPTR EffectiveBrgAddress);
+u32 XPciePsu_CfgInitializeAsync(XPciePsu *InstancePtr,
+				const XPciePsu_Config *CfgPtr,
+				UINTPTR EffectiveBrgAddress);
+u32 XPciePsu_WaitLinkUp(XPciePsu *InstancePtr);
 u8 XPciePsu_EnumerateBus(XPciePsu *InstancePtr);
+void XPciePsu_SetTopologyCache(XPciePsu *InstancePtr,
+			       XPciePsu_Topology *TopologyPtr);
+u8 XPciePsu_FastEnumerateBus(XPciePsu *InstancePtr);
 u8 XPciePsu_ReadConfigSpace(XPciePsu *InstancePtr, u8 Bus, u8 Device,
 				    u8 Function, u16 Offset, u32 *DataPtr);
 u8 XPciePsu_WriteConfigSpace(XPciePsu *InstancePtr, u8 Bus, u8 Device,
@@ -134,6 +202,8 @@ u32 XPciePsu_ComposeExternalConfigAddress(u8 Bus, u8 Device, u8 Function,
 
 u8 XPciePsu_HasCapability(XPciePsu *InstancePtr, u8 Bus, u8 Device,
 		u8 Function, u8 CapId);
+u16 XPciePsu_GetCapabilityOffset(XPciePsu *InstancePtr, u8 Bus, u8 Device,
+		u8 Function, u8 CapId);
 #if defined(__aarch64__) || defined(__arch64__)
 u64 XPciePsu_GetCapability(XPciePsu *InstancePtr, u8 Bus, u8 Device,
 		u8 Function, u8 CapId);
@@ -16,6 +16,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 1.0	bs	08/21/2018	First release
+* 1.1	fl	10/14/2026	Added XPciePsu_GetCapabilityOffset
 * </pre>
 *
 *******************************************************************************/
@@ -117,6 +118,46 @@ u8 XPciePsu_HasCapability(XPciePsu *InstancePtr, u8 Bus, u8 Device,
 
 }
 
+/******************************************************************************/
+/**
+* This function returns the configuration register number of the matching
+* capability ID from the Function's Linked list of the capability registers.
+*
+* @param   InstancePtr pointer to XPciePsu Instance Pointer
+* @param   Bus is the number of the Bus
+* @param   Device is the number of the Device
+* @param   Function is number of the Function
+* @param   cap id to get capability register number
+*
+* @return  u16 register number of the capability, to be used as Offset of
+* XPciePsu_ReadConfigSpace(), if available.
+* 0 if not available.
+*
+*******************************************************************************/
+u16 XPciePsu_GetCapabilityOffset(XPciePsu *InstancePtr, u8 Bus, u8 Device,
+		u8 Function, u8 CapId)
+{
+	u32 CapBase = XPciePsu_GetBaseCapability(InstancePtr, Bus, Device,
+			Function);
+	u32 Adr;
+	u16 Offset = CAP_NOT_PRESENT;
+
+	while (CapBase != 0U) {
+		Adr = CapBase;
+		if (XPciePsu_ReadConfigSpace(InstancePtr, Bus, Device,
+			Function, XPciePsu_GetCapabilityAddr(CapBase), &CapBase) != (u8)XST_SUCCESS) {
+			break;
+		}
+		if (CapId == (CapBase & XPCIEPSU_CFG_CAP_ID_LOC)) {
+			Offset = XPciePsu_GetCapabilityAddr(Adr);
+			break;
+		}
+		CapBase = (u32)((CapBase >> XPCIEPSU_CAP_SHIFT) & (u32)XPCIEPSU_CAP_PTR_LOC);
+	}
+
+	return Offset;
+}
+
 #if defined(__aarch64__) || defined(__arch64__)
 /******************************************************************************/
 /**
@@ -107,6 +107,13 @@ extern "C" {
 #define CAP_PRESENT			(1U)
 #define CAP_NOT_PRESENT			(0U)
 
+/* PCI Express capability and device/port types */
+#define XPCIEPSU_CAP_ID_PCIE		0x10U
+#define XPCIEPSU_PCIE_PORT_TYPE_SHIFT	20U
+#define XPCIEPSU_PCIE_PORT_TYPE_MASK	0xFU
+#define XPCIEPSU_PCIE_PORT_TYPE_ROOT	0x4U
+#define XPCIEPSU_PCIE_PORT_TYPE_DOWN	0x6U
+
 /* PCIe mode */
 #define XPCIEPSU_MODE_ENDPOINT		0x0U
 
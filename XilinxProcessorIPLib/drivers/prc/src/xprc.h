@@ -114,6 +114,8 @@
 * 1.2  Nava   29/03/19      Updated the tcl logic to generated the
 *                           XPrc_ConfigTable properly.
 * 2.2  Nava   07/04/23      Added support for system device-tree flow.
+* 2.3  fl     10/14/26      Added the Reconfigurable Module cache in
+*                           xprc_rmcache.c.
 * </pre>
 *
 ******************************************************************************/
@@ -228,6 +230,16 @@ extern "C" {
 #define CP_FIFO_TYPE_BLOCKRAM		(1)	/**< Fifo Value for Blockram */
 /*@}*/
 
+/** @name Reconfigurable Module cache
+ * @{
+ */
+#define XPRC_RMCACHE_MAX_SLOTS		(8)	/**< Maximum bitstream slots
+						  *  of a cache */
+#define XPRC_RMCACHE_MAX_RMS		(32)	/**< Maximum RMs of a
+						  *  cache */
+#define XPRC_RMCACHE_NONE		(0xFF)	/**< No slot or no RM */
+/*@}*/
+
 /**************************** Type Definitions *******************************/
 
 /* This typedef contains configuration information for a device */
@@ -305,6 +317,55 @@ typedef struct {
 	XPrc_Config Config;	/**< Pointer to instance config entry */
 } XPrc;
 
+/**
+ * Callback reading a partial bitstream from storage into memory. It returns
+ * XST_SUCCESS when Size bytes of the bitstream identified by Source were
+ * written at Dest.
+ */
+typedef s32 (*XPrc_RmFetchFn)(void *CallBackRef, u32 Source, UINTPTR Dest,
+			      u32 Size);
+
+/**
+ * Reconfigurable Module of an RM cache.
+ */
+typedef struct {
+	u32 Source;		/**< Bitstream identifier in storage */
+	u32 Size;		/**< Bitstream size in bytes, 0 if not added */
+	u32 LastUse;		/**< Use count at the last access */
+	u16 BsIndex;		/**< Bitstream Information row of the RM */
+	u16 TriggerId;		/**< Software trigger mapped to the RM */
+	u8 Slot;		/**< Slot holding the bitstream, or
+				  *  XPRC_RMCACHE_NONE */
+	u8 Next;		/**< RM that followed this one last time */
+	u8 Pinned;		/**< Never evicted when 1 */
+	u8 Dirty;		/**< Bitstream Information registers need
+				  *  an update */
+} XPrc_RmCacheEntry;
+
+/**
+ * Reconfigurable Module cache of a VSM. The user allocates a variable of
+ * this type for every VSM swapped by software and initializes it with
+ * XPrc_RmCacheInit().
+ */
+typedef struct {
+	XPrc *PrcPtr;			/**< PRC instance */
+	u16 VsmId;			/**< VSM managed by the cache */
+	u8 NumSlots;			/**< Slots in use */
+	u8 Current;			/**< RM last triggered, or
+					  *  XPRC_RMCACHE_NONE */
+	UINTPTR SlotBase;		/**< Address of the first slot */
+	u32 SlotSize;			/**< Size of a slot in bytes */
+	XPrc_RmFetchFn FetchFn;		/**< Reads bitstreams from storage */
+	void *FetchRef;			/**< Passed to FetchFn */
+	u8 SlotRm[XPRC_RMCACHE_MAX_SLOTS];	/**< RM in each slot, or
+						  *  XPRC_RMCACHE_NONE */
+	XPrc_RmCacheEntry Rm[XPRC_RMCACHE_MAX_RMS];	/**< RMs by RM
+							  *  identifier */
+	u32 UseCount;			/**< Swaps since initialization */
+	u32 Hits;			/**< Swaps without a storage read */
+	u32 Misses;			/**< Bitstreams read from storage */
+} XPrc_RmCache;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -796,6 +857,19 @@ void XPrc_PrintVsmStatus(XPrc *InstancePtr, u32 VsmIdOrStatus, char *Prefix);
 /* Functions in xprc_selftest.c */
 s32 XPrc_SelfTest(XPrc *InstancePtr);
 
+/* Reconfigurable Module cache in xprc_rmcache.c */
+s32 XPrc_RmCacheInit(XPrc_RmCache *CachePtr, XPrc *InstancePtr, u16 VsmId,
+		     UINTPTR SlotBase, u32 SlotSize, u8 NumSlots,
+		     XPrc_RmFetchFn FetchFn, void *FetchRef);
+s32 XPrc_RmCacheAddRm(XPrc_RmCache *CachePtr, u16 RmId, u32 Source, u32 Size,
+		      u16 TriggerId);
+s32 XPrc_RmCachePrefetch(XPrc_RmCache *CachePtr, u16 RmId);
+s32 XPrc_RmCachePrefetchNext(XPrc_RmCache *CachePtr);
+s32 XPrc_RmCachePin(XPrc_RmCache *CachePtr, u16 RmId, u8 Pin);
+s32 XPrc_RmCacheSwap(XPrc_RmCache *CachePtr, u16 RmId);
+s32 XPrc_RmCacheGetImage(XPrc_RmCache *CachePtr, u16 RmId, UINTPTR *AddrPtr,
+			 u32 *SizePtr);
+
 #ifdef __cplusplus
 }
 #endif
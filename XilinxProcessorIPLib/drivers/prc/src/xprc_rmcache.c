@@ -0,0 +1,524 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xprc_rmcache.c
+* @addtogroup prc Overview
+* @{
+*
+* This file contains the Reconfigurable Module cache of the PRC driver. The
+* cache keeps the partial bitstreams of the RMs of one VSM in slots in memory
+* and points the Bitstream Information registers of each RM at its slot, so a
+* swap to a resident RM only sends a software trigger and the fetch path reads
+* the bitstream from memory. The bitstreams are read from storage through a
+* user callback, either on a miss or ahead of time with XPrc_RmCachePrefetch().
+* The cache predicts the next RM from the RM that followed the current one the
+* last time, XPrc_RmCachePrefetchNext() loads it while the current RM runs.
+*
+* The Bitstream Information registers can only be written in the shutdown
+* state, so the registers of the RMs loaded since the last swap are written at
+* the next swap, within one shutdown and restart of the VSM.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date        Changes
+* ---- -----  ------------  ----------------------------------------------
+* 2.3  fl     10/14/26      First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xprc.h"
+#include "xil_cache.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XPRC_RMCACHE_SHUTDOWN_POLLS	(1000000U)	/**< Polls of the
+							  *  status register
+							  *  for shutdown */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Variable Definitions *****************************/
+
+/************************** Function Prototypes ******************************/
+
+static u8 XPrc_RmCacheGetVictim(XPrc_RmCache *CachePtr);
+static s32 XPrc_RmCacheUpdateBsInfo(XPrc_RmCache *CachePtr);
+
+/****************************** Functions Definitions ************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a Reconfigurable Module cache for a VSM.
+*
+* @param	CachePtr is a pointer to the RM cache.
+* @param	InstancePtr is a pointer to the PRC instance.
+* @param	VsmId is the identifier of the VSM the cache manages.
+* @param	SlotBase is the address of the first slot, in memory the
+*		fetch path of the PRC can read.
+* @param	SlotSize is the size of a slot in bytes, the largest partial
+*		bitstream of the VSM rounded up to a cache line.
+* @param	NumSlots is the number of slots, up to XPRC_RMCACHE_MAX_SLOTS.
+* @param	FetchFn is called to read a partial bitstream from storage.
+* @param	FetchRef is passed to FetchFn.
+*
+* @return
+*		- XST_SUCCESS if the cache was initialized.
+*		- XST_INVALID_PARAM if NumSlots is out of range.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XPrc_RmCacheInit(XPrc_RmCache *CachePtr, XPrc *InstancePtr, u16 VsmId,
+		     UINTPTR SlotBase, u32 SlotSize, u8 NumSlots,
+		     XPrc_RmFetchFn FetchFn, void *FetchRef)
+{
+	u16 Index;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(VsmId < XPrc_GetNumberOfVsms(InstancePtr));
+	Xil_AssertNonvoid(FetchFn != NULL);
+
+	if ((NumSlots == 0U) || (NumSlots > XPRC_RMCACHE_MAX_SLOTS) ||
+	    (SlotSize == 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	CachePtr->PrcPtr = InstancePtr;
+	CachePtr->VsmId = VsmId;
+	CachePtr->SlotBase = SlotBase;
+	CachePtr->SlotSize = SlotSize;
+	CachePtr->NumSlots = NumSlots;
+	CachePtr->FetchFn = FetchFn;
+	CachePtr->FetchRef = FetchRef;
+	CachePtr->Current = XPRC_RMCACHE_NONE;
+	CachePtr->UseCount = 0U;
+	CachePtr->Hits = 0U;
+	CachePtr->Misses = 0U;
+
+	for (Index = 0U; Index < XPRC_RMCACHE_MAX_SLOTS; Index++) {
+		CachePtr->SlotRm[Index] = XPRC_RMCACHE_NONE;
+	}
+	for (Index = 0U; Index < XPRC_RMCACHE_MAX_RMS; Index++) {
+		CachePtr->Rm[Index].Size = 0U;
+		CachePtr->Rm[Index].Slot = XPRC_RMCACHE_NONE;
+		CachePtr->Rm[Index].Next = XPRC_RMCACHE_NONE;
+		CachePtr->Rm[Index].Pinned = 0U;
+		CachePtr->Rm[Index].Dirty = 0U;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a Reconfigurable Module to the cache.
+*
+* @param	CachePtr is a pointer to the RM cache.
+* @param	RmId is the identifier of the Reconfigurable Module.
+* @param	Source identifies the partial bitstream in storage, it is
+*		passed to the fetch callback.
+* @param	Size is the partial bitstream size in bytes.
+* @param	TriggerId is the software trigger mapped to the RM.
+*
+* @return
+*		- XST_SUCCESS if the RM was added.
+*		- XST_INVALID_PARAM if RmId is out of range or the bitstream
+*		  does not fit a slot.
+*
+* @note		The RM_BS_INDEX register of the RM and the trigger to RM
+*		mapping must be set up before. The cache owns the Bitstream
+*		Information registers the RM points to from now on.
+*
+******************************************************************************/
+s32 XPrc_RmCacheAddRm(XPrc_RmCache *CachePtr, u16 RmId, u32 Source, u32 Size,
+		      u16 TriggerId)
+{
+	XPrc_RmCacheEntry *RmPtr;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+
+	if ((RmId >= XPRC_RMCACHE_MAX_RMS) ||
+	    (RmId >= XPrc_GetNumRms(CachePtr->PrcPtr,
+				    CachePtr->VsmId)) ||
+	    (Size == 0U) || (Size > CachePtr->SlotSize)) {
+		return XST_INVALID_PARAM;
+	}
+
+	RmPtr = &CachePtr->Rm[RmId];
+	RmPtr->Source = Source;
+	RmPtr->Size = Size;
+	RmPtr->TriggerId = TriggerId;
+	RmPtr->BsIndex = (u16)XPrc_GetRmBsIndex(CachePtr->PrcPtr,
+						 CachePtr->VsmId, RmId);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function selects the slot to load the next bitstream into, a free slot
+* or else the least recently used slot of an RM that is neither pinned nor
+* current.
+*
+* @param	CachePtr is a pointer to the RM cache.
+*
+* @return	Slot number, or XPRC_RMCACHE_NONE if every slot is in use.
+*
+* @note		None.
+*
+******************************************************************************/
+static u8 XPrc_RmCacheGetVictim(XPrc_RmCache *CachePtr)
+{
+	XPrc_RmCacheEntry *RmPtr;
+	u8 Victim = XPRC_RMCACHE_NONE;
+	u32 Oldest = 0U;
+	u8 Slot;
+
+	for (Slot = 0U; Slot < CachePtr->NumSlots; Slot++) {
+		if (CachePtr->SlotRm[Slot] == XPRC_RMCACHE_NONE) {
+			return Slot;
+		}
+
+		RmPtr = &CachePtr->Rm[CachePtr->SlotRm[Slot]];
+		if ((RmPtr->Pinned != 0U) ||
+		    (CachePtr->SlotRm[Slot] == CachePtr->Current)) {
+			continue;
+		}
+
+		/* Age in uses, wraps with UseCount */
+		if ((Victim == XPRC_RMCACHE_NONE) ||
+		    ((CachePtr->UseCount - RmPtr->LastUse) > Oldest)) {
+			Victim = Slot;
+			Oldest = CachePtr->UseCount - RmPtr->LastUse;
+		}
+	}
+
+	return Victim;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function loads the partial bitstream of a Reconfigurable Module into a
+* slot, unless it is resident already.
+*
+* @param	CachePtr is a pointer to the RM cache.
+* @param	RmId is the identifier of the Reconfigurable Module.
+*
+* @return
+*		- XST_SUCCESS if the bitstream is resident.
+*		- XST_INVALID_PARAM if the RM was not added to the cache.
+*		- XST_DEVICE_BUSY if every slot holds a pinned or the current
+*		  RM.
+*		- XST_FAILURE if the fetch callback failed.
+*
+* @note		Does not access the PRC, so it can run while the VSM loads or
+*		runs another RM. The RM evicted from the slot can no longer
+*		be triggered until it is loaded again.
+*
+******************************************************************************/
+s32 XPrc_RmCachePrefetch(XPrc_RmCache *CachePtr, u16 RmId)
+{
+	XPrc_RmCacheEntry *RmPtr;
+	UINTPTR Addr;
+	u8 Slot;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+
+	if ((RmId >= XPRC_RMCACHE_MAX_RMS) ||
+	    (CachePtr->Rm[RmId].Size == 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	RmPtr = &CachePtr->Rm[RmId];
+	RmPtr->LastUse = CachePtr->UseCount;
+	if (RmPtr->Slot != XPRC_RMCACHE_NONE) {
+		return XST_SUCCESS;
+	}
+
+	Slot = XPrc_RmCacheGetVictim(CachePtr);
+	if (Slot == XPRC_RMCACHE_NONE) {
+		return XST_DEVICE_BUSY;
+	}
+
+	if (CachePtr->SlotRm[Slot] != XPRC_RMCACHE_NONE) {
+		CachePtr->Rm[CachePtr->SlotRm[Slot]].Slot = XPRC_RMCACHE_NONE;
+		CachePtr->Rm[CachePtr->SlotRm[Slot]].Dirty = 1U;
+		CachePtr->SlotRm[Slot] = XPRC_RMCACHE_NONE;
+	}
+
+	Addr = CachePtr->SlotBase + ((UINTPTR)Slot * CachePtr->SlotSize);
+	if (CachePtr->FetchFn(CachePtr->FetchRef, RmPtr->Source, Addr,
+			      RmPtr->Size) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	Xil_DCacheFlushRange(Addr, RmPtr->Size);
+
+	CachePtr->SlotRm[Slot] = (u8)RmId;
+	RmPtr->Slot = Slot;
+	RmPtr->Dirty = 1U;
+	CachePtr->Misses++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function loads the partial bitstream of the RM predicted to follow the
+* current one.
+*
+* @param	CachePtr is a pointer to the RM cache.
+*
+* @return
+*		- XST_SUCCESS if the predicted bitstream is resident.
+*		- XST_NO_DATA if there is no prediction yet.
+*		- The errors of XPrc_RmCachePrefetch() otherwise.
+*
+* @note		Call it after XPrc_RmCacheSwap(), while the current RM runs.
+*
+******************************************************************************/
+s32 XPrc_RmCachePrefetchNext(XPrc_RmCache *CachePtr)
+{
+	u8 Next;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+
+	if (CachePtr->Current == XPRC_RMCACHE_NONE) {
+		return XST_NO_DATA;
+	}
+
+	Next = CachePtr->Rm[CachePtr->Current].Next;
+	if (Next == XPRC_RMCACHE_NONE) {
+		return XST_NO_DATA;
+	}
+
+	return XPrc_RmCachePrefetch(CachePtr, Next);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function pins a Reconfigurable Module in the cache, loading it if it is
+* not resident, or unpins it.
+*
+* @param	CachePtr is a pointer to the RM cache.
+* @param	RmId is the identifier of the Reconfigurable Module.
+* @param	Pin is 1 to pin the RM and 0 to unpin it.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- The errors of XPrc_RmCachePrefetch() when pinning.
+*
+* @note		A pinned RM is never evicted. At least one slot must be left
+*		unpinned for the other RMs.
+*
+******************************************************************************/
+s32 XPrc_RmCachePin(XPrc_RmCache *CachePtr, u16 RmId, u8 Pin)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(RmId < XPRC_RMCACHE_MAX_RMS);
+	Xil_AssertNonvoid(Pin <= 1U);
+
+	if (Pin != 0U) {
+		Status = XPrc_RmCachePrefetch(CachePtr, RmId);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+	}
+	CachePtr->Rm[RmId].Pinned = Pin;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes the Bitstream Information registers of the RMs loaded
+* or evicted since the last update, in one shutdown of the VSM.
+*
+* @param	CachePtr is a pointer to the RM cache.
+*
+* @return
+*		- XST_SUCCESS if the registers are up to date.
+*		- XST_DEVICE_BUSY if the VSM is loading an RM.
+*		- XST_FAILURE if the VSM did not enter the shutdown state.
+*
+* @note		An evicted RM gets a bitstream size of 0, so a trigger of it
+*		fails instead of loading the bitstream that replaced it.
+*
+******************************************************************************/
+static s32 XPrc_RmCacheUpdateBsInfo(XPrc_RmCache *CachePtr)
+{
+	XPrc *InstancePtr = CachePtr->PrcPtr;
+	u16 VsmId = CachePtr->VsmId;
+	XPrc_RmCacheEntry *RmPtr;
+	u32 State;
+	u32 Polls;
+	u16 RmId;
+	u8 Dirty = 0U;
+
+	for (RmId = 0U; RmId < XPRC_RMCACHE_MAX_RMS; RmId++) {
+		Dirty |= CachePtr->Rm[RmId].Dirty;
+	}
+	if (Dirty == 0U) {
+		return XST_SUCCESS;
+	}
+
+	State = XPrc_GetVsmState(InstancePtr, VsmId);
+	if ((State != XPRC_SR_STATE_EMPTY) && (State != XPRC_SR_STATE_FULL)) {
+		return XST_DEVICE_BUSY;
+	}
+
+	XPrc_SendShutdownCommand(InstancePtr, VsmId);
+	for (Polls = 0U; Polls < XPRC_RMCACHE_SHUTDOWN_POLLS; Polls++) {
+		if (XPrc_IsVsmInShutdown(InstancePtr, VsmId) ==
+		    XPRC_SR_SHUTDOWN_ON) {
+			break;
+		}
+	}
+	if (Polls == XPRC_RMCACHE_SHUTDOWN_POLLS) {
+		return XST_FAILURE;
+	}
+
+	for (RmId = 0U; RmId < XPRC_RMCACHE_MAX_RMS; RmId++) {
+		RmPtr = &CachePtr->Rm[RmId];
+		if (RmPtr->Dirty == 0U) {
+			continue;
+		}
+
+		if (RmPtr->Slot != XPRC_RMCACHE_NONE) {
+			XPrc_SetBsAddress(InstancePtr, VsmId, RmPtr->BsIndex,
+					  (u32)(CachePtr->SlotBase +
+						((UINTPTR)RmPtr->Slot *
+						 CachePtr->SlotSize)));
+			XPrc_SetBsSize(InstancePtr, VsmId, RmPtr->BsIndex,
+				       RmPtr->Size);
+		} else {
+			XPrc_SetBsSize(InstancePtr, VsmId, RmPtr->BsIndex,
+				       0U);
+		}
+		RmPtr->Dirty = 0U;
+	}
+
+	/* The RM in the Virtual Socket did not change */
+	XPrc_SendRestartWithNoStatusCommand(InstancePtr, VsmId);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function swaps the VSM to a Reconfigurable Module. A resident RM is
+* loaded from its slot without reading storage, otherwise it is loaded into a
+* slot first.
+*
+* @param	CachePtr is a pointer to the RM cache.
+* @param	RmId is the identifier of the Reconfigurable Module.
+*
+* @return
+*		- XST_SUCCESS if the software trigger was sent.
+*		- XST_DEVICE_BUSY if the VSM is loading an RM, or no slot is
+*		  free.
+*		- XST_INVALID_PARAM if the RM was not added to the cache.
+*		- XST_FAILURE if the fetch callback failed or the VSM did not
+*		  enter the shutdown state.
+*
+* @note		The function returns once the trigger is sent, the VSM status
+*		reports when the RM is loaded. The VSM must be triggered by
+*		software only while the cache manages it.
+*
+******************************************************************************/
+s32 XPrc_RmCacheSwap(XPrc_RmCache *CachePtr, u16 RmId)
+{
+	u32 Misses;
+	s32 Status;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+
+	CachePtr->UseCount++;
+	Misses = CachePtr->Misses;
+	Status = XPrc_RmCachePrefetch(CachePtr, RmId);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+	if (Misses == CachePtr->Misses) {
+		CachePtr->Hits++;
+	}
+
+	Status = XPrc_RmCacheUpdateBsInfo(CachePtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	if (CachePtr->Current != XPRC_RMCACHE_NONE) {
+		CachePtr->Rm[CachePtr->Current].Next = (u8)RmId;
+	}
+	CachePtr->Current = (u8)RmId;
+
+	XPrc_SendSwTrigger(CachePtr->PrcPtr, CachePtr->VsmId,
+			   CachePtr->Rm[RmId].TriggerId);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the slot of a resident Reconfigurable Module, to load
+* it with another configuration path such as xilfpga and PCAP.
+*
+* @param	CachePtr is a pointer to the RM cache.
+* @param	RmId is the identifier of the Reconfigurable Module.
+* @param	AddrPtr is filled with the address of the partial bitstream.
+* @param	SizePtr is filled with the size of the partial bitstream.
+*
+* @return
+*		- XST_SUCCESS if the RM is resident.
+*		- XST_NO_DATA if it is not.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XPrc_RmCacheGetImage(XPrc_RmCache *CachePtr, u16 RmId, UINTPTR *AddrPtr,
+			 u32 *SizePtr)
+{
+	XPrc_RmCacheEntry *RmPtr;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(RmId < XPRC_RMCACHE_MAX_RMS);
+	Xil_AssertNonvoid(AddrPtr != NULL);
+	Xil_AssertNonvoid(SizePtr != NULL);
+
+	RmPtr = &CachePtr->Rm[RmId];
+	if (RmPtr->Slot == XPRC_RMCACHE_NONE) {
+		return XST_NO_DATA;
+	}
+
+	*AddrPtr = CachePtr->SlotBase + ((UINTPTR)RmPtr->Slot *
+					 CachePtr->SlotSize);
+	*SizePtr = RmPtr->Size;
+
+	return XST_SUCCESS;
+}
+/** @} */
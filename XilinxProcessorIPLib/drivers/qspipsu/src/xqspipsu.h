@@ -176,6 +176,9 @@
  *                   to volatile.
  * 1.18 ht  07/18/23 Fixed GCC warnings.
  * 1.18 sb  08/01/23 Added support for Feed back clock
+ * 1.18 fl  10/14/26 Added bulk read APIs, which read a flash region in DMA
+ *		     chunks and fetch the next chunk while the caller uses
+ *		     the current one.
  *
  * </pre>
  *
@@ -293,6 +296,26 @@ typedef struct {
 	void *StatusRef;	/**< Callback reference for status handler */
 } XQspiPsu;
 
+/**
+ * This typedef contains the state of a bulk read started by
+ * XQspiPsu_BulkReadStart(). The chunk in flight uses the messages and the
+ * command buffer, so the structure must stay valid until the bulk read
+ * completes.
+ */
+typedef struct {
+	u8 *DestPtr;		/**< Destination of the next chunk */
+	u32 FlashAddr;		/**< Flash address of the next chunk */
+	u32 Remaining;		/**< Bytes not yet requested */
+	u32 ChunkSize;		/**< Maximum bytes per DMA chunk */
+	u8 *ChunkPtr;		/**< Destination of the current chunk */
+	u32 ChunkBytes;		/**< Size of the current chunk, 0 if none */
+	u8 ChunkDone;		/**< Current chunk read in IO mode, no DMA */
+	u8 ReadCmd;		/**< Fast read command */
+	u8 AddrBytes;		/**< 3 or 4 address bytes */
+	u8 CmdBfr[5];		/**< Command and address of the chunk */
+	XQspiPsu_Msg Msg[3];	/**< Command, dummy and data messages */
+} XQspiPsu_BulkReadState;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /**
@@ -385,6 +408,8 @@ typedef struct {
 
 #define XQSPIPSU_RXADDR_OVER_32BIT	0x100000000U /**< Rx address over 32 bit */
 
+#define XQSPIPSU_BULK_READ_ALIGN	8U /**< DMA chunk size multiple of bulk read */
+
 #define XQSPIPSU_SET_WP		1 /**< GQSPI configuration to toggle WP of flash */
 
 /**
@@ -562,6 +587,17 @@ s32 XQspiPsu_StartDmaTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
 			      u32 NumMsg);
 s32 XQspiPsu_CheckDmaDone(XQspiPsu *InstancePtr);
 
+/* Bulk read functions */
+s32 XQspiPsu_BulkReadStart(XQspiPsu *InstancePtr,
+			   XQspiPsu_BulkReadState *BulkPtr, u32 FlashAddr,
+			   u8 *DestPtr, u32 ByteCount, u32 ChunkSize,
+			   u8 AddrBytes);
+s32 XQspiPsu_BulkReadNext(XQspiPsu *InstancePtr,
+			  XQspiPsu_BulkReadState *BulkPtr, u8 **ChunkPtr,
+			  u32 *ChunkBytes);
+s32 XQspiPsu_BulkRead(XQspiPsu *InstancePtr, u32 FlashAddr, u8 *DestPtr,
+		      u32 ByteCount, u8 AddrBytes);
+
 /* Configuration functions */
 s32 XQspiPsu_SetClkPrescaler(const XQspiPsu *InstancePtr, u8 Prescaler);
 void XQspiPsu_SelectFlash(XQspiPsu *InstancePtr, u8 FlashCS, u8 FlashBus);
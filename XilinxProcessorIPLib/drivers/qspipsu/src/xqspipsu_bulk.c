@@ -0,0 +1,401 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+ *
+ * @file xqspipsu_bulk.c
+ * @addtogroup qspipsu Overview
+ * @{
+ *
+ * This file implements the bulk read of a flash region. The region is read
+ * with the fastest read command the bus width of the board allows, in DMA
+ * chunks of up to XQSPIPSU_DMA_BYTES_MAX bytes. Each chunk is a single
+ * command, dummy and data message set started with
+ * XQspiPsu_StartDmaTransfer(), and the next chunk is started as soon as the
+ * current one is handed to the caller, so the flash keeps streaming while
+ * the caller consumes the data.
+ *
+ * In parallel mode both flashes are read at once with the data striped
+ * across them. In stacked mode the caller selects the flash with
+ * XQspiPsu_SelectFlash() and a bulk read must not cross into the other one.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who Date     Changes
+ * ----- --- -------- -----------------------------------------------
+ * 1.18  fl  10/14/26 First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xqspipsu.h"
+#include "xqspipsu_control.h"
+
+/************************** Constant Definitions *****************************/
+#define MAX_DELAY_CNT	1000000000U	/**< Max delay count */
+
+#define XQSPIPSU_FAST_READ_CMD		0x0BU	/**< Fast read, 3 byte address */
+#define XQSPIPSU_FAST_READ_CMD_4B	0x0CU	/**< Fast read, 4 byte address */
+#define XQSPIPSU_DUAL_READ_CMD		0x3BU	/**< Dual output fast read */
+#define XQSPIPSU_DUAL_READ_CMD_4B	0x3CU	/**< Dual output fast read 4B */
+#define XQSPIPSU_QUAD_READ_CMD		0x6BU	/**< Quad output fast read */
+#define XQSPIPSU_QUAD_READ_CMD_4B	0x6CU	/**< Quad output fast read 4B */
+
+#define XQSPIPSU_BULK_DUMMY_CLOCKS	8U	/**< Dummy clocks of the reads */
+
+#define XQSPIPSU_BUSWIDTH_SINGLE	0U	/**< Config.BusWidth of x1 */
+#define XQSPIPSU_BUSWIDTH_DOUBLE	1U	/**< Config.BusWidth of x2 */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static s32 XQspiPsu_BulkReadChunk(XQspiPsu *InstancePtr,
+				  XQspiPsu_BulkReadState *BulkPtr);
+static s32 XQspiPsu_BulkReadWait(XQspiPsu *InstancePtr);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ *
+ * This function starts a bulk read of a flash region. The first chunk is
+ * started before returning, and the chunks are then collected in order
+ * with XQspiPsu_BulkReadNext().
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	BulkPtr is a pointer to the bulk read state, which must stay
+ *		valid until the bulk read completes.
+ * @param	FlashAddr is the flash offset to read from. In parallel mode
+ *		it is the offset in the striped address space of both flashes
+ *		and must be even.
+ * @param	DestPtr is the destination, 4 byte aligned.
+ * @param	ByteCount is the number of bytes to read.
+ * @param	ChunkSize is the maximum size of a DMA chunk, 0 for
+ *		XQSPIPSU_DMA_BYTES_MAX. It is rounded down to a multiple of
+ *		XQSPIPSU_BULK_READ_ALIGN.
+ * @param	AddrBytes is the number of address bytes of the flash, 3 or 4.
+ *
+ * @return
+ *		- XST_SUCCESS if the bulk read is started.
+ *		- XST_INVALID_PARAM if an argument is not valid.
+ *		- XST_DEVICE_BUSY if a transfer is already in progress.
+ *		- XST_FAILURE if the first chunk could not be started.
+ *
+ * @note	The read command is fast read, dual or quad output fast read
+ *		as Config.BusWidth allows.
+ *
+ ******************************************************************************/
+s32 XQspiPsu_BulkReadStart(XQspiPsu *InstancePtr,
+			   XQspiPsu_BulkReadState *BulkPtr, u32 FlashAddr,
+			   u8 *DestPtr, u32 ByteCount, u32 ChunkSize,
+			   u8 AddrBytes)
+{
+	u32 DataBusWidth;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BulkPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+#ifdef DEBUG
+	xil_printf("\nXQspiPsu_BulkReadStart\r\n");
+#endif
+
+	if ((ByteCount == 0U) || (((UINTPTR)DestPtr & 0x3U) != 0U) ||
+	    ((AddrBytes != 3U) && (AddrBytes != 4U))) {
+		return (s32)XST_INVALID_PARAM;
+	}
+	if ((InstancePtr->Config.ConnectionMode ==
+	     XQSPIPSU_CONNECTION_MODE_PARALLEL) && ((FlashAddr & 0x1U) != 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+	if ((ChunkSize == 0U) || (ChunkSize > XQSPIPSU_DMA_BYTES_MAX)) {
+		ChunkSize = XQSPIPSU_DMA_BYTES_MAX;
+	}
+	ChunkSize &= ~(XQSPIPSU_BULK_READ_ALIGN - 1U);
+	if (ChunkSize == 0U) {
+		return (s32)XST_INVALID_PARAM;
+	}
+	if (InstancePtr->IsBusy == (u32)TRUE) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	if (InstancePtr->Config.BusWidth == XQSPIPSU_BUSWIDTH_SINGLE) {
+		BulkPtr->ReadCmd = (AddrBytes == 4U) ?
+			XQSPIPSU_FAST_READ_CMD_4B : XQSPIPSU_FAST_READ_CMD;
+		DataBusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	} else if (InstancePtr->Config.BusWidth == XQSPIPSU_BUSWIDTH_DOUBLE) {
+		BulkPtr->ReadCmd = (AddrBytes == 4U) ?
+			XQSPIPSU_DUAL_READ_CMD_4B : XQSPIPSU_DUAL_READ_CMD;
+		DataBusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
+	} else {
+		BulkPtr->ReadCmd = (AddrBytes == 4U) ?
+			XQSPIPSU_QUAD_READ_CMD_4B : XQSPIPSU_QUAD_READ_CMD;
+		DataBusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+	}
+
+	if (InstancePtr->Config.ConnectionMode ==
+	    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		XQspiPsu_SelectFlash(InstancePtr, XQSPIPSU_SELECT_FLASH_CS_BOTH,
+				     XQSPIPSU_SELECT_FLASH_BUS_BOTH);
+	}
+
+	for (Index = 0U; Index < 3U; Index++) {
+		BulkPtr->Msg[Index].TxBfrPtr = NULL;
+		BulkPtr->Msg[Index].RxBfrPtr = NULL;
+		BulkPtr->Msg[Index].PollData = 0U;
+		BulkPtr->Msg[Index].PollTimeout = 0U;
+		BulkPtr->Msg[Index].PollStatusCmd = 0U;
+		BulkPtr->Msg[Index].PollBusMask = 0U;
+		BulkPtr->Msg[Index].RxAddr64bit = 0U;
+		BulkPtr->Msg[Index].Xfer64bit = 0U;
+	}
+
+	/* Command and address, sent to both flashes in parallel mode */
+	BulkPtr->Msg[0].TxBfrPtr = BulkPtr->CmdBfr;
+	BulkPtr->Msg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	BulkPtr->Msg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+
+	/* Bus width of the dummy phase is the one of the data phase */
+	BulkPtr->Msg[1].ByteCount = XQSPIPSU_BULK_DUMMY_CLOCKS;
+	BulkPtr->Msg[1].BusWidth = DataBusWidth;
+	BulkPtr->Msg[1].Flags = 0U;
+
+	BulkPtr->Msg[2].BusWidth = DataBusWidth;
+	BulkPtr->Msg[2].Flags = XQSPIPSU_MSG_FLAG_RX;
+	if (InstancePtr->Config.ConnectionMode ==
+	    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		BulkPtr->Msg[2].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+	}
+
+	BulkPtr->DestPtr = DestPtr;
+	BulkPtr->FlashAddr = FlashAddr;
+	BulkPtr->Remaining = ByteCount;
+	BulkPtr->ChunkSize = ChunkSize;
+	BulkPtr->AddrBytes = AddrBytes;
+	BulkPtr->ChunkPtr = NULL;
+	BulkPtr->ChunkBytes = 0U;
+
+	return XQspiPsu_BulkReadChunk(InstancePtr, BulkPtr);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function waits for the current chunk of a bulk read, starts the
+ * next one and returns the completed chunk. The completed chunk may be used
+ * while the next one is read from the flash, until the following call.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	BulkPtr is a pointer to the bulk read state.
+ * @param	ChunkPtr returns the start of the completed chunk.
+ * @param	ChunkBytes returns the size of the completed chunk.
+ *
+ * @return
+ *		- XST_SUCCESS if a chunk is returned.
+ *		- XST_NO_DATA if the bulk read is complete.
+ *		- XST_FAILURE if the transfer failed. The bulk read is ended.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+s32 XQspiPsu_BulkReadNext(XQspiPsu *InstancePtr,
+			  XQspiPsu_BulkReadState *BulkPtr, u8 **ChunkPtr,
+			  u32 *ChunkBytes)
+{
+	u8 *DonePtr;
+	u32 DoneBytes;
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BulkPtr != NULL);
+	Xil_AssertNonvoid(ChunkPtr != NULL);
+	Xil_AssertNonvoid(ChunkBytes != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	*ChunkPtr = NULL;
+	*ChunkBytes = 0U;
+	if (BulkPtr->ChunkBytes == 0U) {
+		return (s32)XST_NO_DATA;
+	}
+
+	if (BulkPtr->ChunkDone == (u8)FALSE) {
+		Status = XQspiPsu_BulkReadWait(InstancePtr);
+		if (Status != (s32)XST_SUCCESS) {
+			XQspiPsu_Abort(InstancePtr);
+			InstancePtr->IsBusy = (u32)FALSE;
+			BulkPtr->ChunkBytes = 0U;
+			BulkPtr->Remaining = 0U;
+			return (s32)XST_FAILURE;
+		}
+	}
+	DonePtr = BulkPtr->ChunkPtr;
+	DoneBytes = BulkPtr->ChunkBytes;
+	BulkPtr->ChunkBytes = 0U;
+
+	/* Keep the flash busy while the caller consumes this chunk */
+	if (BulkPtr->Remaining != 0U) {
+		Status = XQspiPsu_BulkReadChunk(InstancePtr, BulkPtr);
+		if (Status != (s32)XST_SUCCESS) {
+			BulkPtr->Remaining = 0U;
+			return (s32)XST_FAILURE;
+		}
+	}
+
+	*ChunkPtr = DonePtr;
+	*ChunkBytes = DoneBytes;
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function reads a flash region to memory with a bulk read, and
+ * returns when all of it is read.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	FlashAddr is the flash offset to read from.
+ * @param	DestPtr is the destination, 4 byte aligned.
+ * @param	ByteCount is the number of bytes to read.
+ * @param	AddrBytes is the number of address bytes of the flash, 3 or 4.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_INVALID_PARAM if an argument is not valid.
+ *		- XST_DEVICE_BUSY if a transfer is already in progress.
+ *		- XST_FAILURE if the transfer failed.
+ *
+ * @note	See XQspiPsu_BulkReadStart().
+ *
+ ******************************************************************************/
+s32 XQspiPsu_BulkRead(XQspiPsu *InstancePtr, u32 FlashAddr, u8 *DestPtr,
+		      u32 ByteCount, u8 AddrBytes)
+{
+	XQspiPsu_BulkReadState Bulk;
+	u8 *ChunkPtr;
+	u32 ChunkBytes;
+	s32 Status;
+
+	Status = XQspiPsu_BulkReadStart(InstancePtr, &Bulk, FlashAddr, DestPtr,
+					ByteCount, 0U, AddrBytes);
+	while (Status == (s32)XST_SUCCESS) {
+		Status = XQspiPsu_BulkReadNext(InstancePtr, &Bulk, &ChunkPtr,
+					       &ChunkBytes);
+	}
+
+	return (Status == (s32)XST_NO_DATA) ? (s32)XST_SUCCESS : Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function starts the next chunk of a bulk read. A chunk is a multiple
+ * of XQSPIPSU_BULK_READ_ALIGN bytes and read by DMA, except for a shorter
+ * tail, which is read in IO mode before returning.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	BulkPtr is a pointer to the bulk read state.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_DEVICE_BUSY if a transfer is already in progress.
+ *		- XST_FAILURE if the chunk could not be started.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_BulkReadChunk(XQspiPsu *InstancePtr,
+				  XQspiPsu_BulkReadState *BulkPtr)
+{
+	u32 Addr = BulkPtr->FlashAddr;
+	u32 Bytes;
+	u32 Index = 0U;
+	s32 Status;
+
+	/* Each flash holds every other byte, at half the offset */
+	if (InstancePtr->Config.ConnectionMode ==
+	    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		Addr /= 2U;
+	}
+
+	BulkPtr->CmdBfr[Index] = BulkPtr->ReadCmd;
+	Index++;
+	if (BulkPtr->AddrBytes == 4U) {
+		BulkPtr->CmdBfr[Index] = (u8)((Addr & 0xFF000000U) >> 24);
+		Index++;
+	}
+	BulkPtr->CmdBfr[Index] = (u8)((Addr & 0xFF0000U) >> 16);
+	Index++;
+	BulkPtr->CmdBfr[Index] = (u8)((Addr & 0xFF00U) >> 8);
+	Index++;
+	BulkPtr->CmdBfr[Index] = (u8)(Addr & 0xFFU);
+	Index++;
+	BulkPtr->Msg[0].ByteCount = Index;
+
+	if (BulkPtr->Remaining > BulkPtr->ChunkSize) {
+		Bytes = BulkPtr->ChunkSize;
+	} else if (BulkPtr->Remaining >= XQSPIPSU_BULK_READ_ALIGN) {
+		Bytes = BulkPtr->Remaining & ~(XQSPIPSU_BULK_READ_ALIGN - 1U);
+	} else {
+		Bytes = BulkPtr->Remaining;
+	}
+	BulkPtr->Msg[2].RxBfrPtr = BulkPtr->DestPtr;
+	BulkPtr->Msg[2].ByteCount = Bytes;
+
+	if (Bytes >= XQSPIPSU_BULK_READ_ALIGN) {
+		BulkPtr->ChunkDone = (u8)FALSE;
+		Status = XQspiPsu_StartDmaTransfer(InstancePtr, BulkPtr->Msg, 3U);
+	} else {
+		/* Too short for DMA, wait for it */
+		BulkPtr->ChunkDone = (u8)TRUE;
+		Status = XQspiPsu_PolledTransfer(InstancePtr, BulkPtr->Msg, 3U);
+	}
+	if (Status != (s32)XST_SUCCESS) {
+		return Status;
+	}
+
+	BulkPtr->ChunkPtr = BulkPtr->DestPtr;
+	BulkPtr->ChunkBytes = Bytes;
+	BulkPtr->DestPtr += Bytes;
+	BulkPtr->FlashAddr += Bytes;
+	BulkPtr->Remaining -= Bytes;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function waits for the DMA chunk in progress to complete.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ *
+ * @return
+ *		- XST_SUCCESS if the chunk is complete.
+ *		- XST_FAILURE on a timeout.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_BulkReadWait(XQspiPsu *InstancePtr)
+{
+	if (Xil_WaitForEvent((InstancePtr->Config.BaseAddress +
+			      XQSPIPSU_QSPIDMA_DST_I_STS_OFFSET),
+			     XQSPIPSU_QSPIDMA_DST_I_STS_DONE_MASK,
+			     XQSPIPSU_QSPIDMA_DST_I_STS_DONE_MASK,
+			     MAX_DELAY_CNT) != (u32)XST_SUCCESS) {
+		return (s32)XST_FAILURE;
+	}
+
+	return XQspiPsu_CheckDmaDone(InstancePtr);
+}
+/** @} */
@@ -292,6 +292,10 @@
 * 12.1  cog    07/04/23 Add support for SDT.
 *       cog    07/14/23 Fix issues with SDT flow.
 *       cog    07/27/23 Add NCO frequency to config structures.
+*       fl     10/14/26 Add RF profiles, captured register images of the
+*                       mixer and rate change settings applied as deltas.
+*       fl     10/14/26 Added XRFdc_MultiConverter_Resync() reusing the DTC
+*                       codes of the last good multi-tile sync.
 *
 * </pre>
 *
@@ -440,6 +444,9 @@ typedef struct {
 	int SysRef_Enable;
 	XRFdc_MTS_DTC_Settings DTC_Set_PLL;
 	XRFdc_MTS_DTC_Settings DTC_Set_T1;
+	int Cached_Latency[4]; /* Latency of the last good full sync */
+	int Cached_Offset[4]; /* Offset of the last good full sync */
+	u32 Cache_Valid; /* Set to 1, after a good full sync */
 } XRFdc_MultiConverter_Sync_Config;
 
 /**
@@ -784,6 +791,24 @@ typedef struct {
 	void *CallBackRef; /* Callback reference for event handler */
 	u8 UpdateMixerScale; /* Set to 1, if user overwrite mixer scale */
 } XRFdc;
+
+/**
+ * RF profile block, register image of the mixer, NCO and rate change
+ * settings of an ADC or DAC block.
+ */
+typedef struct {
+	u16 Reg[13]; /* XRFDC_PROFILE_NUM_REGS registers */
+	XRFdc_Mixer_Settings Mixer_Settings;
+	u32 MixerInputDataType;
+	u8 Valid; /* Set to 1, if the block is part of the profile */
+} XRFdc_Profile_Block;
+
+/**
+ * RF profile, indexed by type, tile and block.
+ */
+typedef struct {
+	XRFdc_Profile_Block Block[2][4][4];
+} XRFdc_Profile;
 #ifndef __BAREMETAL__
 #pragma pack()
 #endif
@@ -1075,6 +1100,9 @@ typedef struct {
 #define XRFDC_NUM_OF_TILES3 0x3U
 #define XRFDC_NUM_OF_TILES4 0x4U
 
+#define XRFDC_PROFILE_NUM_REGS 13U
+#define XRFDC_PROFILE_NO_EVENT 0xFFU
+
 #define XRFDC_SM_STATE0 0x0U
 #define XRFDC_SM_STATE1 0x1U
 #define XRFDC_SM_STATE3 0x3U
@@ -1327,6 +1355,7 @@ typedef struct {
 
 #define XRFDC_MTS_SCAN_INIT 0U
 #define XRFDC_MTS_SCAN_RELOAD 1U
+#define XRFDC_MTS_SCAN_CACHED 2U
 
 /* MTS Error Codes */
 #define XRFDC_MTS_OK 0U
@@ -1489,6 +1518,7 @@ u32 XRFdc_GetMaxSampleRate(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double *Ma
 u32 XRFdc_GetMinSampleRate(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double *MinSampleRatePtr);
 double XRFdc_GetDriverVersion(void);
 u32 XRFdc_MultiConverter_Sync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter_Sync_Config *ConfigPtr);
+u32 XRFdc_MultiConverter_Resync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter_Sync_Config *ConfigPtr);
 u32 XRFdc_MultiConverter_Init(XRFdc_MultiConverter_Sync_Config *ConfigPtr, int *PLL_CodesPtr, int *T1_CodesPtr,
 			      u32 RefTile);
 u32 XRFdc_MTS_Sysref_Config(XRFdc *InstancePtr, XRFdc_MultiConverter_Sync_Config *DACSyncConfigPtr,
@@ -1497,6 +1527,8 @@ u32 XRFdc_GetMTSEnable(XRFdc *InstancePtr, u32 Type, u32 Tile, u32 *EnablePtr);
 u32 XRFdc_SetDACDataScaler(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u32 Enable);
 u32 XRFdc_GetDACDataScaler(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u32 *EnablePtr);
 u8 XRFdc_GetTileLayout(XRFdc *InstancePtr);
+u32 XRFdc_ProfileCapture(XRFdc *InstancePtr, XRFdc_Profile *ProfilePtr);
+u32 XRFdc_ProfileApply(XRFdc *InstancePtr, const XRFdc_Profile *ProfilePtr, XRFdc_Profile *CurrentPtr);
 #ifndef __BAREMETAL__
 s32 XRFdc_GetDeviceNameByDeviceId(char *DevNamePtr, u16 DevId);
 #endif
@@ -55,6 +55,9 @@
 *       cog    01/18/22 Added safety checks.
 *       cog    01/18/22 Add cast in XRFdc_MTS_Dtc_Calc.
 *       cog    01/18/22 Initialize DatapathMode in XRFdc_MTS_Latency.
+* 12.1  fl     10/14/26 Added XRFdc_MultiConverter_Resync, which reapplies the
+*                       DTC codes of the last full sync and only scans again
+*                       if the latencies do not match.
 *
 * </pre>
 *
@@ -596,25 +599,39 @@ static u32 XRFdc_MTS_Dtc_Scan(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_M
 
 	SRctl = XRFdc_ReadReg16(InstancePtr, BaseAddr, SRCtrlAddr) & ~SRclr_m;
 
-	for (Index = 0U; Index < XRFDC_MTS_NUM_DTC; Index++) {
-		Flags[Index] = 0U;
-	}
-	for (Index = 0U; (Index < XRFDC_MTS_NUM_DTC) && (Status == XRFDC_MTS_OK); Index++) {
-		Status |= XRFdc_MTS_Dtc_Code(InstancePtr, Type, BaseAddr, SRCtrlAddr, DTCAddr, SRctl, SRclr_m, Index);
-		Flags[Index] = (XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_SRFLAG) >> Flag_s) & 0x3U;
-	}
+	if (SettingsPtr->Scan_Mode == XRFDC_MTS_SCAN_CACHED) {
+		/* Reapply the code of the last full scan, an edge seen at it means it is no longer safe */
+		if (SettingsPtr->DTC_Code[Tile_Id] == -1) {
+			Status |= XRFDC_MTS_DTC_INVALID;
+		} else {
+			Status |= XRFdc_MTS_Dtc_Code(InstancePtr, Type, BaseAddr, SRCtrlAddr, DTCAddr, SRctl, SRclr_m,
+						     SettingsPtr->DTC_Code[Tile_Id]);
+			if (((XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_SRFLAG) >> Flag_s) & 0x3U) != 0U) {
+				Status |= XRFDC_MTS_DTC_INVALID;
+			}
+		}
+	} else {
+		for (Index = 0U; Index < XRFDC_MTS_NUM_DTC; Index++) {
+			Flags[Index] = 0U;
+		}
+		for (Index = 0U; (Index < XRFDC_MTS_NUM_DTC) && (Status == XRFDC_MTS_OK); Index++) {
+			Status |= XRFdc_MTS_Dtc_Code(InstancePtr, Type, BaseAddr, SRCtrlAddr, DTCAddr, SRctl, SRclr_m,
+						     Index);
+			Flags[Index] = (XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_SRFLAG) >> Flag_s) & 0x3U;
+		}
 
-	/* Calculate the best DTC code */
-	(void)XRFdc_MTS_Dtc_Calc(InstancePtr, Type, Tile_Id, SettingsPtr, Flags);
+		/* Calculate the best DTC code */
+		(void)XRFdc_MTS_Dtc_Calc(InstancePtr, Type, Tile_Id, SettingsPtr, Flags);
 
-	/* Program the calculated code */
-	if (SettingsPtr->DTC_Code[Tile_Id] == -1) {
-		metal_log(METAL_LOG_ERROR, "Unable to capture analog SysRef safely on %s tile %d\n",
-			  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id);
-		Status |= XRFDC_MTS_DTC_INVALID;
-	} else {
-		(void)XRFdc_MTS_Dtc_Code(InstancePtr, Type, BaseAddr, SRCtrlAddr, DTCAddr, SRctl, SRclr_m,
-					 SettingsPtr->DTC_Code[Tile_Id]);
+		/* Program the calculated code */
+		if (SettingsPtr->DTC_Code[Tile_Id] == -1) {
+			metal_log(METAL_LOG_ERROR, "Unable to capture analog SysRef safely on %s tile %d\n",
+				  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id);
+			Status |= XRFDC_MTS_DTC_INVALID;
+		} else {
+			(void)XRFdc_MTS_Dtc_Code(InstancePtr, Type, BaseAddr, SRCtrlAddr, DTCAddr, SRctl, SRclr_m,
+						 SettingsPtr->DTC_Code[Tile_Id]);
+		}
 	}
 
 	if (SettingsPtr->IsPLL != 0U) {
@@ -1232,6 +1249,7 @@ u32 XRFdc_MultiConverter_Init(XRFdc_MultiConverter_Sync_Config *ConfigPtr, int *
 	ConfigPtr->Target_Latency = -1;
 	ConfigPtr->Marker_Delay = 15;
 	ConfigPtr->SysRef_Enable = 1; /* By default enable Sysref capture after MTS */
+	ConfigPtr->Cache_Valid = 0U;
 
 	/* Initialize variables per tile */
 	for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
@@ -1364,6 +1382,83 @@ u32 XRFdc_MultiConverter_Sync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter
 	Status |= XRFdc_MTS_GetMarker(InstancePtr, Type, ConfigPtr->Tiles, &Markers, ConfigPtr->Marker_Delay);
 	/* Calculate latency difference and adjust for it */
 	Status |= XRFdc_MTS_Latency(InstancePtr, Type, ConfigPtr, &Markers);
+
+	/* Keep the result of a good full scan for XRFdc_MultiConverter_Resync */
+	if ((Status == XRFDC_MTS_OK) && (ConfigPtr->DTC_Set_T1.Scan_Mode != XRFDC_MTS_SCAN_CACHED)) {
+		for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
+			ConfigPtr->Cached_Latency[Index] = ConfigPtr->Latency[Index];
+			ConfigPtr->Cached_Offset[Index] = ConfigPtr->Offset[Index];
+		}
+		ConfigPtr->Cache_Valid = 1U;
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API resynchronizes the tiles of a group, after a clock switch for
+* example. The DTC codes of the last good XRFdc_MultiConverter_Sync() are
+* programmed directly instead of being scanned, then the markers are
+* measured. A full sync runs if a cached code sees a SysRef edge or the
+* latencies and delay offsets differ from the ones of the last full sync.
+*
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    ConfigPtr Multi-tile sync config structure of the last sync.
+*
+* @return
+* 		- XRFDC_MTS_OK if successful.
+* 		- Status of XRFdc_MultiConverter_Sync() if the full sync ran.
+*
+* @note     Without a previous good full sync, this runs a full sync.
+*
+******************************************************************************/
+u32 XRFdc_MultiConverter_Resync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter_Sync_Config *ConfigPtr)
+{
+	u32 Status;
+	u32 Index;
+	int PLL_Scan_Mode;
+	int T1_Scan_Mode;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ConfigPtr != NULL);
+
+	if (ConfigPtr->Cache_Valid == 0U) {
+		return XRFdc_MultiConverter_Sync(InstancePtr, Type, ConfigPtr);
+	}
+
+	PLL_Scan_Mode = ConfigPtr->DTC_Set_PLL.Scan_Mode;
+	T1_Scan_Mode = ConfigPtr->DTC_Set_T1.Scan_Mode;
+	ConfigPtr->DTC_Set_PLL.Scan_Mode = XRFDC_MTS_SCAN_CACHED;
+	ConfigPtr->DTC_Set_T1.Scan_Mode = XRFDC_MTS_SCAN_CACHED;
+
+	Status = XRFdc_MultiConverter_Sync(InstancePtr, Type, ConfigPtr);
+
+	ConfigPtr->DTC_Set_PLL.Scan_Mode = PLL_Scan_Mode;
+	ConfigPtr->DTC_Set_T1.Scan_Mode = T1_Scan_Mode;
+
+	/* Verify the markers against the last full sync */
+	for (Index = XRFDC_TILE_ID0; (Index < XRFDC_TILE_ID4) && (Status == XRFDC_MTS_OK); Index++) {
+		if (((1U << Index) & ConfigPtr->Tiles) == 0U) {
+			continue;
+		}
+		if ((ConfigPtr->Latency[Index] != ConfigPtr->Cached_Latency[Index]) ||
+		    (ConfigPtr->Offset[Index] != ConfigPtr->Cached_Offset[Index])) {
+			metal_log(METAL_LOG_INFO, "%s%d latency %d differs from %d\n",
+				  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Index, ConfigPtr->Latency[Index],
+				  ConfigPtr->Cached_Latency[Index]);
+			Status = XRFDC_MTS_MARKER_MISM;
+		}
+	}
+
+	if (Status != XRFDC_MTS_OK) {
+		metal_log(METAL_LOG_INFO, "\nCached DTC codes failed verification, running a full scan\n");
+		ConfigPtr->Cache_Valid = 0U;
+		Status = XRFdc_MultiConverter_Sync(InstancePtr, Type, ConfigPtr);
+	}
+
 	return Status;
 }
 
@@ -0,0 +1,309 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xrfdc_profile.c
+* @addtogroup Overview
+* @{
+*
+* Contains the RF profile functions of the XRFdc driver. A profile is a
+* register image of the mixer, NCO and rate change settings of every enabled
+* block. It is captured once, after the settings were made with the regular
+* APIs, and applied later by writing only the registers that differ from the
+* current image, followed by one update event per tile.
+* See xrfdc.h for a detailed description of the device and driver.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 12.1  fl     10/14/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xrfdc.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u32 XRFdc_ProfileNumRegs(u32 Type);
+static u32 XRFdc_ProfileUpdateEvents(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 *EventSourcePtr);
+
+/************************** Variable Definitions *****************************/
+/*
+ * Block registers of a profile, in the order they are written. The event
+ * source goes first so the settings after it wait for the update event. The
+ * NCO phase mode register only exists in ADC blocks and stays last.
+ */
+static const u16 XRFdc_ProfileRegs[XRFDC_PROFILE_NUM_REGS] = {
+	XRFDC_NCO_UPDT_OFFSET,
+	XRFDC_ADC_FABRIC_RATE_OFFSET,
+	XRFDC_ADC_DECI_CONFIG_OFFSET, /* XRFDC_DAC_INTERP_CTRL_OFFSET */
+	XRFDC_ADC_DECI_MODE_OFFSET, /* XRFDC_DAC_ITERP_DATA_OFFSET */
+	XRFDC_ADC_NCO_FQWD_UPP_OFFSET,
+	XRFDC_ADC_NCO_FQWD_MID_OFFSET,
+	XRFDC_ADC_NCO_FQWD_LOW_OFFSET,
+	XRFDC_NCO_PHASE_UPP_OFFSET,
+	XRFDC_NCO_PHASE_LOW_OFFSET,
+	XRFDC_ADC_MXR_CFG0_OFFSET,
+	XRFDC_ADC_MXR_CFG1_OFFSET,
+	XRFDC_MXR_MODE_OFFSET,
+	XRFDC_ADC_NCO_PHASE_MOD_OFFSET,
+};
+
+/*****************************************************************************/
+/**
+*
+* Static API returning the number of profile registers of a block.
+*
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+*
+* @return   Number of registers.
+*
+* @note     Static API
+*
+******************************************************************************/
+static u32 XRFdc_ProfileNumRegs(u32 Type)
+{
+	return (Type == XRFDC_ADC_TILE) ? XRFDC_PROFILE_NUM_REGS : (XRFDC_PROFILE_NUM_REGS - 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API captures the current mixer, NCO, decimation and interpolation
+* settings of every enabled block into a profile. The instance settings of
+* the blocks are captured along with the registers.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    ProfilePtr is a pointer to the profile to fill.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*
+* @note     Make the settings of the profile with XRFdc_SetMixerSettings(),
+*           XRFdc_SetDecimationFactor() and XRFdc_SetInterpolationFactor()
+*           first. Capture the settings in use with the same API to get the
+*           image that the first XRFdc_ProfileApply() compares to.
+*
+******************************************************************************/
+u32 XRFdc_ProfileCapture(XRFdc *InstancePtr, XRFdc_Profile *ProfilePtr)
+{
+	XRFdc_Profile_Block *BlockPtr;
+	u32 Type;
+	u32 Tile_Id;
+	u32 Block_Id;
+	u32 BaseAddr;
+	u32 NumRegs;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ProfilePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		NumRegs = XRFdc_ProfileNumRegs(Type);
+		for (Tile_Id = 0U; Tile_Id < XRFDC_NUM_OF_TILES4; Tile_Id++) {
+			for (Block_Id = 0U; Block_Id < XRFDC_NUM_OF_BLKS4; Block_Id++) {
+				BlockPtr = &ProfilePtr->Block[Type][Tile_Id][Block_Id];
+				BlockPtr->Valid = 0U;
+
+				/* A 4GSPS ADC block uses two slices, each slice is captured */
+				if ((Type == XRFDC_ADC_TILE) && (XRFdc_IsHighSpeedADC(InstancePtr, Tile_Id) == 1)) {
+					if (XRFdc_IsADCDigitalPathEnabled(InstancePtr, Tile_Id, Block_Id / 2U) == 0U) {
+						continue;
+					}
+				} else if (XRFdc_CheckDigitalPathEnabled(InstancePtr, Type, Tile_Id, Block_Id) !=
+					   XRFDC_SUCCESS) {
+					continue;
+				}
+
+				BaseAddr = XRFDC_BLOCK_BASE(Type, Tile_Id, Block_Id);
+				for (Index = 0U; Index < NumRegs; Index++) {
+					BlockPtr->Reg[Index] =
+						XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFdc_ProfileRegs[Index]);
+				}
+
+				if (Type == XRFDC_ADC_TILE) {
+					BlockPtr->Mixer_Settings = InstancePtr->ADC_Tile[Tile_Id]
+									   .ADCBlock_Digital_Datapath[Block_Id]
+									   .Mixer_Settings;
+					BlockPtr->MixerInputDataType = InstancePtr->ADC_Tile[Tile_Id]
+									       .ADCBlock_Digital_Datapath[Block_Id]
+									       .MixerInputDataType;
+				} else {
+					BlockPtr->Mixer_Settings = InstancePtr->DAC_Tile[Tile_Id]
+									   .DACBlock_Digital_Datapath[Block_Id]
+									   .Mixer_Settings;
+					BlockPtr->MixerInputDataType = InstancePtr->DAC_Tile[Tile_Id]
+									       .DACBlock_Digital_Datapath[Block_Id]
+									       .MixerInputDataType;
+				}
+				BlockPtr->Valid = 1U;
+			}
+		}
+	}
+
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Static API triggering the update events of the blocks of a tile changed by
+* a profile.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    EventSourcePtr is the event source of each block of the tile,
+*           or XRFDC_PROFILE_NO_EVENT for blocks that did not change.
+*
+* @return
+*           - XRFDC_SUCCESS if the events were triggered.
+*           - XRFDC_FAILURE if a block waits for an event issued external
+*             to the driver.
+*
+* @note     Static API. Blocks on the tile event share a single write.
+*
+******************************************************************************/
+static u32 XRFdc_ProfileUpdateEvents(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 *EventSourcePtr)
+{
+	u32 Status = XRFDC_SUCCESS;
+	u32 Block_Id;
+	u32 BaseAddr;
+	u32 Offset;
+	u32 TileEvent = 0U;
+
+	Offset = (Type == XRFDC_ADC_TILE) ? XRFDC_ADC_UPDATE_DYN_OFFSET : XRFDC_DAC_UPDATE_DYN_OFFSET;
+
+	for (Block_Id = 0U; Block_Id < XRFDC_NUM_OF_BLKS4; Block_Id++) {
+		BaseAddr = XRFDC_BLOCK_BASE(Type, Tile_Id, Block_Id);
+		switch (EventSourcePtr[Block_Id]) {
+		case XRFDC_PROFILE_NO_EVENT:
+			break;
+		case XRFDC_EVNT_SRC_IMMEDIATE:
+			XRFdc_ClrSetReg(InstancePtr, BaseAddr, Offset, XRFDC_UPDT_EVNT_MASK, XRFDC_UPDT_EVNT_NCO_MASK);
+			break;
+		case XRFDC_EVNT_SRC_SLICE:
+			XRFdc_WriteReg16(InstancePtr, BaseAddr, Offset, 0x1);
+			break;
+		case XRFDC_EVNT_SRC_TILE:
+			TileEvent = 1U;
+			break;
+		default:
+			/* SYSREF, marker and PL events are issued external to the driver */
+			Status = XRFDC_FAILURE;
+			break;
+		}
+	}
+
+	if (TileEvent == 1U) {
+		BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_HSCOM_UPDT_DYN_OFFSET, 0x1);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API applies a profile. Only the registers that differ from the current
+* image are written, then every changed block gets its update event, one
+* write per tile for blocks on the tile event source.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    ProfilePtr is a pointer to the profile to apply.
+* @param    CurrentPtr is a pointer to the image of the settings in use, as
+*           captured with XRFdc_ProfileCapture(). It is updated to the
+*           applied profile.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if changed blocks wait for a SYSREF, marker or
+*             PL event, the caller must issue it.
+*
+* @note     Capture the profiles with XRFDC_EVNT_SRC_TILE or
+*           XRFDC_EVNT_SRC_SYSREF as event source to retune all the blocks
+*           of a tile, or the whole device, at once. The tile level FIFO and
+*           clock settings are not part of a profile, profiles that change
+*           the rate change factor must keep the fabric clocking.
+*
+******************************************************************************/
+u32 XRFdc_ProfileApply(XRFdc *InstancePtr, const XRFdc_Profile *ProfilePtr, XRFdc_Profile *CurrentPtr)
+{
+	const XRFdc_Profile_Block *BlockPtr;
+	XRFdc_Profile_Block *CurBlockPtr;
+	u32 EventSource[XRFDC_NUM_OF_BLKS4];
+	u32 Status = XRFDC_SUCCESS;
+	u32 Type;
+	u32 Tile_Id;
+	u32 Block_Id;
+	u32 BaseAddr;
+	u32 NumRegs;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ProfilePtr != NULL);
+	Xil_AssertNonvoid(CurrentPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		NumRegs = XRFdc_ProfileNumRegs(Type);
+		for (Tile_Id = 0U; Tile_Id < XRFDC_NUM_OF_TILES4; Tile_Id++) {
+			for (Block_Id = 0U; Block_Id < XRFDC_NUM_OF_BLKS4; Block_Id++) {
+				EventSource[Block_Id] = XRFDC_PROFILE_NO_EVENT;
+				BlockPtr = &ProfilePtr->Block[Type][Tile_Id][Block_Id];
+				CurBlockPtr = &CurrentPtr->Block[Type][Tile_Id][Block_Id];
+				if (BlockPtr->Valid == 0U) {
+					continue;
+				}
+
+				BaseAddr = XRFDC_BLOCK_BASE(Type, Tile_Id, Block_Id);
+				for (Index = 0U; Index < NumRegs; Index++) {
+					if ((CurBlockPtr->Valid == 0U) ||
+					    (CurBlockPtr->Reg[Index] != BlockPtr->Reg[Index])) {
+						XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFdc_ProfileRegs[Index],
+								 BlockPtr->Reg[Index]);
+						EventSource[Block_Id] =
+							BlockPtr->Reg[0] & XRFDC_NCO_UPDT_MODE_MASK;
+					}
+				}
+				*CurBlockPtr = *BlockPtr;
+
+				if (Type == XRFDC_ADC_TILE) {
+					InstancePtr->ADC_Tile[Tile_Id].ADCBlock_Digital_Datapath[Block_Id].Mixer_Settings =
+						BlockPtr->Mixer_Settings;
+					InstancePtr->ADC_Tile[Tile_Id]
+						.ADCBlock_Digital_Datapath[Block_Id]
+						.MixerInputDataType = BlockPtr->MixerInputDataType;
+				} else {
+					InstancePtr->DAC_Tile[Tile_Id].DACBlock_Digital_Datapath[Block_Id].Mixer_Settings =
+						BlockPtr->Mixer_Settings;
+					InstancePtr->DAC_Tile[Tile_Id]
+						.DACBlock_Digital_Datapath[Block_Id]
+						.MixerInputDataType = BlockPtr->MixerInputDataType;
+				}
+			}
+
+			if (XRFdc_ProfileUpdateEvents(InstancePtr, Type, Tile_Id, EventSource) != XRFDC_SUCCESS) {
+				Status = XRFDC_FAILURE;
+			}
+		}
+	}
+
+	return Status;
+}
+/** @} */
@@ -174,6 +174,9 @@
 * 5.2   ml   09/07/23 Compared with zero to fix MISRA-C_RULE_14.4 violation.
 * 5.2   ml   09/07/23 Added comments to fix HIS COMF violations.
 * 5.2   ml   09/07/23 Include xplatform_info.h  for all processors.
+* 5.2   fl   10/14/26 Added XScuGic_MapInterruptsToCpus to route a set of
+*                     SPIs in one pass and XScuGic_BalanceInterrupts to
+*                     spread SPIs over CPUs by handler load.
 * </pre>
 *
 ******************************************************************************/
@@ -189,6 +192,7 @@
 
 #define DEFAULT_PRIORITY    0xa0a0a0a0U /**< Default value for priority_level
                                              register */
+#define XSCUGIC_BALANCE_MAX_CPUS	16U /**< Maximum CPUs for balancing */
 
 /**************************** Type Definitions *******************************/
 
@@ -1320,6 +1324,181 @@ void XScuGic_UnmapAllInterruptsFromCpu(XScuGic *InstancePtr, u8 Cpu_Identifier)
 	 */
 	XIL_SPINUNLOCK();
 }
+
+/****************************************************************************/
+/**
+* Routes an SPI interrupt to a single CPU, replacing its previous targets.
+* For GICv2 the caller holds the spinlock.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	Cpu_Identifier is the target CPU, encoded as for
+*		XScuGic_InterruptMaptoCpu.
+* @param	Int_Id is the SPI interrupt ID.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XScuGic_RouteToCpu(XScuGic *InstancePtr, u8 Cpu_Identifier,
+			       u32 Int_Id)
+{
+	u32 RegValue;
+#if defined (GICv3)
+#if defined (VERSAL_NET)
+#if defined (ARMR52)
+	RegValue = ((u32)Cpu_Identifier & XSCUGIC_COREID_MASK);
+#else
+	RegValue = (((u32)Cpu_Identifier & XSCUGIC_CLUSTERID_MASK) >>
+		    XSCUGIC_CLUSTERID_SHIFT);
+	RegValue = (RegValue << XSCUGIC_IROUTER_AFFINITY2_SHIFT);
+	RegValue |= (((u32)Cpu_Identifier & XSCUGIC_COREID_MASK) <<
+		     XSCUGIC_IROUTER_AFFINITY1_SHIFT);
+#endif
+#else
+	RegValue = (u32)Cpu_Identifier;
+#endif
+	XScuGic_DistWriteReg(InstancePtr, XSCUGIC_IROUTER_OFFSET_CALC(Int_Id),
+			     RegValue);
+#else
+	u32 Shift = (Int_Id & 0x3U) * 8U;
+
+	RegValue = XScuGic_DistReadReg(InstancePtr,
+				       XSCUGIC_SPI_TARGET_OFFSET_CALC(Int_Id));
+	RegValue &= ~((u32)0xFFU << Shift);
+	RegValue |= ((u32)0x1U << Cpu_Identifier) << Shift;
+	XScuGic_DistWriteReg(InstancePtr,
+			     XSCUGIC_SPI_TARGET_OFFSET_CALC(Int_Id), RegValue);
+#endif
+}
+
+/****************************************************************************/
+/**
+* Routes a set of SPI interrupts, each to a single CPU, in one pass. Unlike
+* XScuGic_InterruptMaptoCpu, the previous targets of each interrupt are
+* replaced. The set is validated before any routing is changed.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	Affinity is an array of interrupt ID and target CPU pairs.
+* @param	Count is the number of entries in Affinity.
+*
+* @return	XST_SUCCESS if the interrupts are routed,
+*		XST_INVALID_PARAM if an entry is not a valid SPI.
+*
+* @note		None
+*
+*****************************************************************************/
+s32 XScuGic_MapInterruptsToCpus(XScuGic *InstancePtr,
+				const XScuGic_IntrAffinity *Affinity, u32 Count)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Affinity != NULL);
+
+	for (Index = 0U; Index < Count; Index++) {
+		if ((Affinity[Index].Int_Id < XSCUGIC_SPI_INT_ID_START) ||
+		    (Affinity[Index].Int_Id >= XSCUGIC_MAX_NUM_INTR_INPUTS)) {
+			return (s32)XST_INVALID_PARAM;
+		}
+	}
+
+	/*
+	 * Call spinlock to protect multiple applications running at separate
+	 * CPUs to write to the same register. The lock is taken once for the
+	 * whole set.
+	 */
+	XIL_SPINLOCK();
+
+	for (Index = 0U; Index < Count; Index++) {
+		XScuGic_RouteToCpu(InstancePtr, Affinity[Index].Cpu_Identifier,
+				   Affinity[Index].Int_Id);
+	}
+
+	XIL_SPINUNLOCK();
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Spreads a set of SPI interrupts over CPUs, by handler load. Interrupts
+* are assigned from the highest load down, each to the CPU with the lowest
+* load assigned so far, and then routed with one pass over the set.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	Int_Ids is the array of SPI interrupt IDs to balance.
+* @param	Load is the load of each interrupt, in any unit, for example
+*		TotalTime from XScuGic_GetIntrStats over a measurement window.
+* @param	Count is the number of interrupts in Int_Ids and Load.
+* @param	Cpus is the array of CPUs to balance over, encoded as for
+*		XScuGic_InterruptMaptoCpu.
+* @param	NumCpus is the number of CPUs in Cpus, at most 16.
+*
+* @return	XST_SUCCESS if the interrupts are routed,
+*		XST_INVALID_PARAM if an interrupt is not a valid SPI, or the
+*		number of interrupts or CPUs is not supported.
+*
+* @note		None
+*
+*****************************************************************************/
+s32 XScuGic_BalanceInterrupts(XScuGic *InstancePtr, const u32 *Int_Ids,
+			      const u64 *Load, u32 Count, const u8 *Cpus,
+			      u32 NumCpus)
+{
+	u16 Order[XSCUGIC_MAX_NUM_INTR_INPUTS];
+	u64 CpuLoad[XSCUGIC_BALANCE_MAX_CPUS] = {0U};
+	u32 Index;
+	u32 Next;
+	u32 Cpu;
+	u32 Best;
+	u16 Temp;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Int_Ids != NULL);
+	Xil_AssertNonvoid(Load != NULL);
+	Xil_AssertNonvoid(Cpus != NULL);
+
+	if ((Count > (XSCUGIC_MAX_NUM_INTR_INPUTS - XSCUGIC_SPI_INT_ID_START)) ||
+	    (NumCpus == 0U) || (NumCpus > XSCUGIC_BALANCE_MAX_CPUS)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+	for (Index = 0U; Index < Count; Index++) {
+		if ((Int_Ids[Index] < XSCUGIC_SPI_INT_ID_START) ||
+		    (Int_Ids[Index] >= XSCUGIC_MAX_NUM_INTR_INPUTS)) {
+			return (s32)XST_INVALID_PARAM;
+		}
+		Order[Index] = (u16)Index;
+	}
+
+	/* Sort by decreasing load, the set is small */
+	for (Index = 1U; Index < Count; Index++) {
+		Temp = Order[Index];
+		Next = Index;
+		while ((Next > 0U) && (Load[Order[Next - 1U]] < Load[Temp])) {
+			Order[Next] = Order[Next - 1U];
+			Next--;
+		}
+		Order[Next] = Temp;
+	}
+
+	XIL_SPINLOCK();
+
+	for (Index = 0U; Index < Count; Index++) {
+		Best = 0U;
+		for (Cpu = 1U; Cpu < NumCpus; Cpu++) {
+			if (CpuLoad[Cpu] < CpuLoad[Best]) {
+				Best = Cpu;
+			}
+		}
+		CpuLoad[Best] += Load[Order[Index]];
+		XScuGic_RouteToCpu(InstancePtr, Cpus[Best],
+				   Int_Ids[Order[Index]]);
+	}
+
+	XIL_SPINUNLOCK();
+
+	return (s32)XST_SUCCESS;
+}
+
 /****************************************************************************/
 /**
 * It checks if the interrupt target register contains all interrupts to be
@@ -192,6 +192,10 @@
 *                     It fixes CR#1150432.
 * 5.2   ml   03/02/23 Add description to fix Doxygen warnings.
 * 5.2   adk  04/14/23 Added support for system device-tree flow.
+* 5.2   fl   10/14/26 Added XScuGic_InterruptHandlerFast with optional
+*                     nesting and per interrupt statistics.
+* 5.2   fl   10/14/26 Added XScuGic_MapInterruptsToCpus and
+*                     XScuGic_BalanceInterrupts.
 * </pre>
 *
 ******************************************************************************/
@@ -298,6 +302,35 @@ typedef struct
 	u32 UnhandledInterrupts; /**< Intc Statistics */
 } XScuGic;
 
+/**
+ * Target CPU of an SPI interrupt, used with XScuGic_MapInterruptsToCpus.
+ */
+typedef struct
+{
+	u32 Int_Id;		/**< SPI interrupt ID */
+	u8 Cpu_Identifier;	/**< Target CPU, encoded as for
+				     XScuGic_InterruptMaptoCpu */
+} XScuGic_IntrAffinity;
+
+#ifdef XSCUGIC_DISPATCH_STATS
+/**
+ * Time source for the dispatch statistics, returns a free running counter.
+ */
+typedef u64 (*XScuGic_TimeSource)(void);
+
+/**
+ * Per interrupt statistics collected by XScuGic_InterruptHandlerFast. Times
+ * are in counts of the time source set with XScuGic_SetStatsTimeSource and
+ * include the time spent in nested interrupts.
+ */
+typedef struct
+{
+	u32 Count;	/**< Number of times the handler was called */
+	u32 MaxTime;	/**< Longest handler run time */
+	u64 TotalTime;	/**< Sum of the handler run times */
+} XScuGic_IntrStats;
+#endif
+
 /************************** Variable Definitions *****************************/
 
 extern XScuGic_Config XScuGic_ConfigTable[];	/**< Config table */
@@ -682,6 +715,11 @@ void XScuGic_SetPriorityTriggerType(XScuGic *InstancePtr, u32 Int_Id,
 void XScuGic_InterruptMaptoCpu(XScuGic *InstancePtr, u8 Cpu_Identifier, u32 Int_Id);
 void XScuGic_InterruptUnmapFromCpu(XScuGic *InstancePtr, u8 Cpu_Identifier, u32 Int_Id);
 void XScuGic_UnmapAllInterruptsFromCpu(XScuGic *InstancePtr, u8 Cpu_Identifier);
+s32 XScuGic_MapInterruptsToCpus(XScuGic *InstancePtr,
+				const XScuGic_IntrAffinity *Affinity, u32 Count);
+s32 XScuGic_BalanceInterrupts(XScuGic *InstancePtr, const u32 *Int_Ids,
+			      const u64 *Load, u32 Count, const u8 *Cpus,
+			      u32 NumCpus);
 void XScuGic_Stop(XScuGic *InstancePtr);
 void XScuGic_SetCpuID(u32 CpuCoreId);
 u32 XScuGic_GetCpuID(void);
@@ -707,6 +745,12 @@ XScuGic_Config *XScuGic_LookupConfig(UINTPTR BaseAddr);
  * Interrupt functions in xscugic_intr.c
  */
 void XScuGic_InterruptHandler(XScuGic *InstancePtr);
+void XScuGic_InterruptHandlerFast(XScuGic *InstancePtr);
+#ifdef XSCUGIC_DISPATCH_STATS
+void XScuGic_SetStatsTimeSource(XScuGic_TimeSource TimeSource);
+const XScuGic_IntrStats *XScuGic_GetIntrStats(u32 Int_Id);
+void XScuGic_ResetIntrStats(void);
+#endif
 
 /*
  * Self-test functions in xscugic_selftest.c
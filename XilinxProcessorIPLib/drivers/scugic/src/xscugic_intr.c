@@ -41,6 +41,10 @@
 *                     reported by coverity tool. It fixes CR#1006344.
 * 3.10  mus  07/17/18 Updated file to fix the various coding style issues
 *                     reported by checkpatch. It fixes CR#1006344.
+* 5.2   fl   10/14/26 Added XScuGic_InterruptHandlerFast, which handles all
+*                     the pending interrupts in one exception and optionally
+*                     nests higher priority interrupts and collects per
+*                     interrupt statistics.
 *
 * </pre>
 *
@@ -62,6 +66,21 @@
 #include "xscugic.h"
 
 /************************** Constant Definitions *****************************/
+/*
+ * Interrupt IDs 1020 to 1023 are special, 1023 is returned when no interrupt
+ * is pending and must not be acknowledged.
+ */
+#define XSCUGIC_SPECIAL_INTID_START	1020U
+
+/*
+ * Interrupt nesting in XScuGic_InterruptHandlerFast uses the BSP
+ * Xil_EnableNestedInterrupts/Xil_DisableNestedInterrupts macros, which
+ * switch to system mode on Cortex-A9 and Cortex-R5/R52.
+ */
+#if defined (XSCUGIC_NESTED_DISPATCH) && defined (__GNUC__) && \
+	!defined (__aarch64__) && !defined (ARMA53_32)
+#define XSCUGIC_NESTING_SUPPORTED
+#endif
 
 /**************************** Type Definitions *******************************/
 
@@ -70,6 +89,10 @@
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
+#ifdef XSCUGIC_DISPATCH_STATS
+static XScuGic_IntrStats XScuGic_Stats[XSCUGIC_MAX_NUM_INTR_INPUTS];
+static XScuGic_TimeSource XScuGic_StatsTime;
+#endif
 
 /*****************************************************************************/
 /**
@@ -161,4 +184,177 @@ IntrExit:
 	     * could happen here.
 	     */
 }
+
+#ifdef XSCUGIC_NESTING_SUPPORTED
+/*****************************************************************************/
+/**
+* This function calls an interrupt handler with higher priority interrupts
+* enabled. The GIC only signals interrupts of higher priority than the one
+* being handled until its EOI is written.
+*
+* @param	TablePtr is a pointer to the vector table entry to call.
+*
+* @return	None.
+*
+* @note		Kept as a separate function so that no local variable is
+*		accessed on the stack while the processor mode is switched.
+*
+******************************************************************************/
+static void __attribute__ ((noinline))
+XScuGic_CallNested(const XScuGic_VectorTableEntry *TablePtr)
+{
+	Xil_EnableNestedInterrupts();
+	TablePtr->Handler(TablePtr->CallBackRef);
+	Xil_DisableNestedInterrupts();
+}
+#endif
+
+/*****************************************************************************/
+/**
+* This function is an alternative primary interrupt handler for the driver,
+* connected in place of XScuGic_InterruptHandler. Before returning, it
+* keeps acknowledging and handling interrupts until none is pending, so
+* back to back interrupts are handled without taking the exception again.
+*
+* When XSCUGIC_NESTED_DISPATCH is defined, handlers on Cortex-A9 and
+* Cortex-R5/R52 run with interrupts enabled, so a higher priority interrupt
+* preempts a running lower priority handler. Priorities are set with
+* XScuGic_SetPriorityTriggerType. A handler must clear its interrupt source
+* before it can be preempted by the same interrupt again.
+*
+* When XSCUGIC_DISPATCH_STATS is defined, the number of calls and the run
+* time of each handler are recorded, see XScuGic_GetIntrStats.
+*
+* @param	InstancePtr is a pointer to the XScuGic instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XScuGic_InterruptHandlerFast(XScuGic *InstancePtr)
+{
+	const XScuGic_VectorTableEntry *HandlerTable;
+	u32 InterruptID;
+#if !defined (GICv3)
+	u32 IntIDFull;
+#endif
+#ifdef XSCUGIC_DISPATCH_STATS
+	XScuGic_IntrStats *StatsPtr;
+	u64 Start = 0U;
+	u32 Time;
+#endif
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	HandlerTable = InstancePtr->Config->HandlerTable;
+
+	for (;;) {
+#if defined (GICv3)
+		InterruptID = XScuGic_get_IntID();
+#else
+		IntIDFull = XScuGic_CPUReadReg(InstancePtr,
+					       XSCUGIC_INT_ACK_OFFSET);
+		InterruptID = IntIDFull & XSCUGIC_ACK_INTID_MASK;
+#endif
+		if (InterruptID >= XSCUGIC_MAX_NUM_INTR_INPUTS) {
+			break;
+		}
+
+#ifdef XSCUGIC_DISPATCH_STATS
+		if (XScuGic_StatsTime != NULL) {
+			Start = XScuGic_StatsTime();
+		}
+#endif
+
+#ifdef XSCUGIC_NESTING_SUPPORTED
+		XScuGic_CallNested(&HandlerTable[InterruptID]);
+#else
+		HandlerTable[InterruptID].Handler(
+			HandlerTable[InterruptID].CallBackRef);
+#endif
+
+#ifdef XSCUGIC_DISPATCH_STATS
+		StatsPtr = &XScuGic_Stats[InterruptID];
+		StatsPtr->Count++;
+		if (XScuGic_StatsTime != NULL) {
+			Time = (u32)(XScuGic_StatsTime() - Start);
+			StatsPtr->TotalTime += Time;
+			if (Time > StatsPtr->MaxTime) {
+				StatsPtr->MaxTime = Time;
+			}
+		}
+#endif
+
+#if defined (GICv3)
+		XScuGic_ack_Int(InterruptID);
+#else
+		XScuGic_CPUWriteReg(InstancePtr, XSCUGIC_EOI_OFFSET, IntIDFull);
+#endif
+	}
+
+	/* Invalid interrupt IDs are acknowledged, spurious ones are not */
+	if (InterruptID < XSCUGIC_SPECIAL_INTID_START) {
+#if defined (GICv3)
+		XScuGic_ack_Int(InterruptID);
+#else
+		XScuGic_CPUWriteReg(InstancePtr, XSCUGIC_EOI_OFFSET, IntIDFull);
+#endif
+	}
+}
+
+#ifdef XSCUGIC_DISPATCH_STATS
+/*****************************************************************************/
+/**
+* This function sets the time source used to measure the handler run times
+* in XScuGic_InterruptHandlerFast, for example a function returning the
+* processor cycle counter.
+*
+* @param	TimeSource is the function returning the current time, NULL
+*		to only count the interrupts.
+*
+* @return	None.
+*
+******************************************************************************/
+void XScuGic_SetStatsTimeSource(XScuGic_TimeSource TimeSource)
+{
+	XScuGic_StatsTime = TimeSource;
+}
+
+/*****************************************************************************/
+/**
+* This function returns the dispatch statistics of an interrupt.
+*
+* @param	Int_Id is the interrupt ID.
+*
+* @return	Pointer to the statistics, NULL if Int_Id is invalid.
+*
+******************************************************************************/
+const XScuGic_IntrStats *XScuGic_GetIntrStats(u32 Int_Id)
+{
+	if (Int_Id >= XSCUGIC_MAX_NUM_INTR_INPUTS) {
+		return NULL;
+	}
+
+	return &XScuGic_Stats[Int_Id];
+}
+
+/*****************************************************************************/
+/**
+* This function clears the dispatch statistics of all the interrupts.
+*
+* @return	None.
+*
+******************************************************************************/
+void XScuGic_ResetIntrStats(void)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < XSCUGIC_MAX_NUM_INTR_INPUTS; Index++) {
+		XScuGic_Stats[Index].Count = 0U;
+		XScuGic_Stats[Index].MaxTime = 0U;
+		XScuGic_Stats[Index].TotalTime = 0U;
+	}
+}
+#endif
 /** @} */
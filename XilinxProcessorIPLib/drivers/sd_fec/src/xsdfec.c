@@ -7,6 +7,10 @@
 /***************************** Include Files *********************************/
 #include "xsdfec.h"
 
+/************************** Function Prototypes *****************************/
+static void XSdFecInvalidateOverlap(XSdFec *InstancePtr, const XSdFecLdpcCode* CodePtr);
+static int XSdFecWriteTable(XSdFec *InstancePtr, u32 Addr, const u32 *DataPtr, u32 NumWords);
+
 /************************** Function Implementation *************************/
 int XSdFecCfgInitialize(XSdFec *InstancePtr, XSdFec_Config *ConfigPtr) {
     Xil_AssertNonvoid(InstancePtr != NULL);
@@ -20,6 +24,9 @@ int XSdFecCfgInitialize(XSdFec *InstancePtr, XSdFec_Config *ConfigPtr) {
       u32 wdata = ConfigPtr->Initialization[i+1];
       XSdFecWriteReg(InstancePtr->BaseAddress, addr, wdata);
     }
+    InstancePtr->TableWriteFn  = NULL;
+    InstancePtr->TableWriteRef = NULL;
+    XSdFecInvalidateLdpcCodes(InstancePtr);
     InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
     return XST_SUCCESS;
@@ -60,6 +67,15 @@ void XSdFecAddLdpcParams(XSdFec *InstancePtr, u32 CodeId, u32 SCOffset, u32 LAOf
     XSdFecWrite_LDPC_LA_TABLE_Words(InstancePtr->BaseAddress,LAOffset*4, ParamsPtr->LATable,ParamsPtr->NLayers); // Further 4x applied to offset in function
     XSdFecWrite_LDPC_QC_TABLE_Words(InstancePtr->BaseAddress,QCOffset*4, ParamsPtr->QCTable,ParamsPtr->NQC);
 
+    // Written behind the residency cache, drop codes sharing these tables
+    XSdFecLdpcCode code;
+    if (XSdFecCompileLdpcCode(CodeId, SCOffset, LAOffset, QCOffset, ParamsPtr, &code) == XST_SUCCESS) {
+      XSdFecInvalidateOverlap(InstancePtr, &code);
+    } else {
+      XSdFecInvalidateLdpcCodes(InstancePtr);
+    }
+    InstancePtr->Resident[CodeId] = NULL;
+
     // Store offsets
     InstancePtr->SCOffset[CodeId] = SCOffset;
     InstancePtr->LAOffset[CodeId] = LAOffset;
@@ -129,6 +145,122 @@ XSdFecInterruptClass XSdFecInterruptClassifier(XSdFec *InstancePtr) {
   return IntClass;
 }
 
+int XSdFecCompileLdpcCode(u32 CodeId, u32 SCOffset, u32 LAOffset, u32 QCOffset, const XSdFecLdpcParameters* ParamsPtr, XSdFecLdpcCode* CodePtr) {
+  Xil_AssertNonvoid(ParamsPtr != NULL);
+  Xil_AssertNonvoid(CodePtr   != NULL);
+
+  CodePtr->CodeId   = CodeId;
+  CodePtr->SCOffset = SCOffset;
+  CodePtr->LAOffset = LAOffset*4; // Offsets are in units of 4 words
+  CodePtr->QCOffset = QCOffset*4;
+  CodePtr->SCSize   = (ParamsPtr->NLayers+3)>>2; // Scale is packed, 4 per reg
+  CodePtr->LASize   = ParamsPtr->NLayers;
+  CodePtr->QCSize   = ParamsPtr->NQC;
+  CodePtr->SCTable  = ParamsPtr->SCTable;
+  CodePtr->LATable  = ParamsPtr->LATable;
+  CodePtr->QCTable  = ParamsPtr->QCTable;
+  if (CodeId >= XSDFEC_LDPC_CODE_NUM ||
+      CodePtr->SCOffset + CodePtr->SCSize > XSDFEC_LDPC_SC_TABLE_DEPTH ||
+      CodePtr->LAOffset + CodePtr->LASize > XSDFEC_LDPC_LA_TABLE_DEPTH ||
+      CodePtr->QCOffset + CodePtr->QCSize > XSDFEC_LDPC_QC_TABLE_DEPTH) {
+    return XST_INVALID_PARAM;
+  }
+
+  CodePtr->CodeReg[0] = (XSDFEC_LDPC_CODE_REG0_N_MASK & (ParamsPtr->N << XSDFEC_LDPC_CODE_REG0_N_LSB)) |
+                        (XSDFEC_LDPC_CODE_REG0_K_MASK & (ParamsPtr->K << XSDFEC_LDPC_CODE_REG0_K_LSB));
+  CodePtr->CodeReg[1] = (XSDFEC_LDPC_CODE_REG1_PSIZE_MASK      & (ParamsPtr->PSize     << XSDFEC_LDPC_CODE_REG1_PSIZE_LSB)) |
+                        (XSDFEC_LDPC_CODE_REG1_NO_PACKING_MASK & (ParamsPtr->NoPacking << XSDFEC_LDPC_CODE_REG1_NO_PACKING_LSB)) |
+                        (XSDFEC_LDPC_CODE_REG1_NM_MASK         & (ParamsPtr->NM        << XSDFEC_LDPC_CODE_REG1_NM_LSB));
+  CodePtr->CodeReg[2] = (XSDFEC_LDPC_CODE_REG2_NLAYERS_MASK               & (ParamsPtr->NLayers       << XSDFEC_LDPC_CODE_REG2_NLAYERS_LSB)) |
+                        (XSDFEC_LDPC_CODE_REG2_NMQC_MASK                  & (ParamsPtr->NMQC          << XSDFEC_LDPC_CODE_REG2_NMQC_LSB)) |
+                        (XSDFEC_LDPC_CODE_REG2_NORM_TYPE_MASK             & (ParamsPtr->NormType      << XSDFEC_LDPC_CODE_REG2_NORM_TYPE_LSB)) |
+                        (XSDFEC_LDPC_CODE_REG2_SPECIAL_QC_MASK            & (ParamsPtr->SpecialQC     << XSDFEC_LDPC_CODE_REG2_SPECIAL_QC_LSB)) |
+                        (XSDFEC_LDPC_CODE_REG2_NO_FINAL_PARITY_CHECK_MASK & (ParamsPtr->NoFinalParity << XSDFEC_LDPC_CODE_REG2_NO_FINAL_PARITY_CHECK_LSB)) |
+                        (XSDFEC_LDPC_CODE_REG2_MAX_SCHEDULE_MASK          & (ParamsPtr->MaxSchedule   << XSDFEC_LDPC_CODE_REG2_MAX_SCHEDULE_LSB));
+  CodePtr->CodeReg[3] = (XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK & (SCOffset << XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB)) |
+                        (XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK & (LAOffset << XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB)) |
+                        (XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK & (QCOffset << XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB));
+  return XST_SUCCESS;
+}
+
+// Ranges [Off, Off+Size) of one table overlap
+#define XSDFEC_TABLE_OVERLAP(Off0, Size0, Off1, Size1) \
+  ((Size0) != 0 && (Size1) != 0 && (Off0) < (Off1) + (Size1) && (Off1) < (Off0) + (Size0))
+
+static void XSdFecInvalidateOverlap(XSdFec *InstancePtr, const XSdFecLdpcCode* CodePtr) {
+  for (u32 id = 0; id < XSDFEC_LDPC_CODE_NUM; id++) {
+    const XSdFecLdpcCode* res = InstancePtr->Resident[id];
+    if (res == NULL) {
+      continue;
+    }
+    if (XSDFEC_TABLE_OVERLAP(res->SCOffset, res->SCSize, CodePtr->SCOffset, CodePtr->SCSize) ||
+        XSDFEC_TABLE_OVERLAP(res->LAOffset, res->LASize, CodePtr->LAOffset, CodePtr->LASize) ||
+        XSDFEC_TABLE_OVERLAP(res->QCOffset, res->QCSize, CodePtr->QCOffset, CodePtr->QCSize)) {
+      InstancePtr->Resident[id] = NULL;
+    }
+  }
+}
+
+static int XSdFecWriteTable(XSdFec *InstancePtr, u32 Addr, const u32 *DataPtr, u32 NumWords) {
+  if (NumWords == 0) {
+    return XST_SUCCESS;
+  }
+  if (InstancePtr->TableWriteFn != NULL) {
+    return InstancePtr->TableWriteFn(InstancePtr->TableWriteRef, InstancePtr->BaseAddress + Addr, DataPtr, NumWords);
+  }
+  for (u32 idx = 0; idx < NumWords; idx++) {
+    XSdFecWriteReg(InstancePtr->BaseAddress, Addr + idx*4, DataPtr[idx]);
+  }
+  return XST_SUCCESS;
+}
+
+int XSdFecLoadLdpcCode(XSdFec *InstancePtr, const XSdFecLdpcCode* CodePtr) {
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(CodePtr     != NULL);
+  Xil_AssertNonvoid(InstancePtr->IsReady  == XIL_COMPONENT_IS_READY);
+  Xil_AssertNonvoid(InstancePtr->Standard == XSDFEC_STANDARD_OTHER);
+  Xil_AssertNonvoid(CodePtr->CodeId < XSDFEC_LDPC_CODE_NUM);
+
+  u32 id = CodePtr->CodeId;
+  if (InstancePtr->Resident[id] == CodePtr) {
+    return XST_SUCCESS;
+  }
+
+  InstancePtr->Resident[id] = NULL;
+  XSdFecInvalidateOverlap(InstancePtr, CodePtr);
+
+  // Tables first, the code registers make the code usable
+  if (XSdFecWriteTable(InstancePtr, XSDFEC_LDPC_SC_TABLE_ADDR_BASE + CodePtr->SCOffset*XSDFEC_LDPC_SC_TABLE_STEP,
+                       CodePtr->SCTable, CodePtr->SCSize) != XST_SUCCESS ||
+      XSdFecWriteTable(InstancePtr, XSDFEC_LDPC_LA_TABLE_ADDR_BASE + CodePtr->LAOffset*XSDFEC_LDPC_LA_TABLE_STEP,
+                       CodePtr->LATable, CodePtr->LASize) != XST_SUCCESS ||
+      XSdFecWriteTable(InstancePtr, XSDFEC_LDPC_QC_TABLE_ADDR_BASE + CodePtr->QCOffset*XSDFEC_LDPC_QC_TABLE_STEP,
+                       CodePtr->QCTable, CodePtr->QCSize) != XST_SUCCESS ||
+      XSdFecWriteTable(InstancePtr, XSDFEC_LDPC_CODE_REG0_ADDR_BASE + id*XSDFEC_LDPC_CODE_REG0_STEP,
+                       CodePtr->CodeReg, 4) != XST_SUCCESS) {
+    return XST_FAILURE;
+  }
+
+  InstancePtr->SCOffset[id] = (CodePtr->CodeReg[3] & XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB;
+  InstancePtr->LAOffset[id] = (CodePtr->CodeReg[3] & XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB;
+  InstancePtr->QCOffset[id] = (CodePtr->CodeReg[3] & XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB;
+  InstancePtr->Resident[id] = CodePtr;
+  return XST_SUCCESS;
+}
+
+void XSdFecSetTableWriter(XSdFec *InstancePtr, XSdFecTableWriteFn WriteFn, void *CallBackRef) {
+  Xil_AssertVoid(InstancePtr != NULL);
+  InstancePtr->TableWriteFn  = WriteFn;
+  InstancePtr->TableWriteRef = CallBackRef;
+}
+
+void XSdFecInvalidateLdpcCodes(XSdFec *InstancePtr) {
+  Xil_AssertVoid(InstancePtr != NULL);
+  for (u32 id = 0; id < XSDFEC_LDPC_CODE_NUM; id++) {
+    InstancePtr->Resident[id] = NULL;
+  }
+}
+
 /************************** Base API Function Implementation *************************/
 void XSdFecSet_CORE_AXI_WR_PROTECT(UINTPTR BaseAddress, u32 Data) {
   XSdFecWriteReg(BaseAddress, XSDFEC_CORE_AXI_WR_PROTECT_ADDR, Data);
@@ -32,6 +32,9 @@
  * - XSdFecSetTurboParams(InstancePtr, ParamsPtr)                                        - Set Turbo parameters on a device
  * - XSdFecadd_ldpc_params(InstancePtr, CodeId, SCOffset, LAOffset, QCOffset, ParamsPtr) - Add LDPC parameters to a device
  * - XSdFecShareTableSize(ParamsPtr, SCSizePtr, LASizePtr, QCSizePtr)                    - Calculate share table size for a LDPC code
+ * - XSdFecCompileLdpcCode(CodeId, SCOffset, LAOffset, QCOffset, ParamsPtr, CodePtr)   - Compile LDPC parameters into a loadable code
+ * - XSdFecLoadLdpcCode(InstancePtr, CodePtr)                                          - Load a compiled LDPC code unless already resident
+ * - XSdFecSetTableWriter(InstancePtr, WriteFn, CallBackRef)                           - Set bulk table writer, e.g. DMA based
  * - XSdFecInterruptClassifier(InstancePtr)                                              - Classify interrupts
  *
  * In addition, the driver provides set and get functions for all the individual registers defined for the SD-FEC.
@@ -60,8 +63,20 @@ extern "C" {
 #define XSDFEC_STANDARD_OTHER 0
 #define XSDFEC_STANDARD_5G    1
 
+/// Number of LDPC code IDs
+#define XSDFEC_LDPC_CODE_NUM  128
+
 // Type Definitions
 
+/** \brief Bulk table writer
+ *
+ * Writes NumWords consecutive 32-bit registers starting at Addr, typically with a DMA transfer. The writer must
+ * flush DataPtr from the data cache as needed and return once the transfer is complete.
+ *
+ * @returns XST_SUCCESS, or XST_FAILURE if the transfer failed
+ */
+typedef int (*XSdFecTableWriteFn)(void *CallBackRef, UINTPTR Addr, const u32 *DataPtr, u32 NumWords);
+
 /** \brief Device configuration
  *
  * Contains configuration information for the device.
@@ -88,6 +103,9 @@ typedef struct {
     u32 SCOffset[128]; /**< Lookup to SC table offsets for each code ID */
     u32 LAOffset[128]; /**< Lookup to LA table offsets for each code ID */
     u32 QCOffset[128]; /**< Lookup to QC table offsets for each code ID */
+    const struct XSdFecLdpcCode *Resident[XSDFEC_LDPC_CODE_NUM]; /**< Compiled code loaded for each code ID, or NULL */
+    XSdFecTableWriteFn TableWriteFn; /**< Bulk table writer, NULL for register writes */
+    void *TableWriteRef;             /**< Callback reference for TableWriteFn */
 } XSdFec;
 
 /** \brief Struct defining LDPC code parameters
@@ -112,6 +130,27 @@ typedef struct {
   u32* QCTable;
 } XSdFecLdpcParameters;
 
+/** \brief Compiled LDPC code
+ *
+ * Register image of a LDPC code built by XSdFecCompileLdpcCode(), or defined statically in the same format. The code
+ * registers are stored pre-packed and the table offsets are register word offsets, so a code is loaded with four
+ * contiguous writes. The driver identifies resident codes by the address of this struct, it must not be modified
+ * while loaded.
+ */
+typedef struct XSdFecLdpcCode {
+  u32        CodeId;     /**< Code number */
+  u32        CodeReg[4]; /**< LDPC_CODE_REG0 to LDPC_CODE_REG3 values */
+  u32        SCOffset;   /**< First SC table word */
+  u32        LAOffset;   /**< First LA table word */
+  u32        QCOffset;   /**< First QC table word */
+  u32        SCSize;     /**< SC table words */
+  u32        LASize;     /**< LA table words */
+  u32        QCSize;     /**< QC table words */
+  const u32* SCTable;
+  const u32* LATable;
+  const u32* QCTable;
+} XSdFecLdpcCode;
+
 /** \brief Struct defining Turbo Decode parameters
  *
  * Member values defined in device specific header x<ipinst_name>_turbo_params.h as per IP GUI configuration
@@ -202,6 +241,52 @@ void XSdFecSetTurboParams(XSdFec *InstancePtr, const XSdFecTurboParameters* Para
  */
 void XSdFecShareTableSize(const XSdFecLdpcParameters* ParamsPtr, u32* SCSizePtr, u32* LASizePtr, u32* QCSizePtr);
 
+/**\brief Compile LDPC parameters into a loadable code
+ *
+ * Packs the code registers and resolves the table offsets of a LDPC code once, so that it can be loaded any number
+ * of times with XSdFecLoadLdpcCode(). The tables are referenced, not copied.
+ *
+ * @param CodeId      Code number to be used for the specified LDPC code
+ * @param SCOffset    Scale table offset to use for specified LDPC code
+ * @param LAOffset    LA table offset to use for specified LDPC code
+ * @param QCOffset    QC table offset to use for specified LDPC code
+ * @param ParamsPtr   Pointer to parameters struct for the LDPC code
+ * @param CodePtr     Pointer to the compiled code to populate
+ *
+ * @returns XST_SUCCESS, or XST_INVALID_PARAM if the code ID or the tables are out of range
+ */
+int XSdFecCompileLdpcCode(u32 CodeId, u32 SCOffset, u32 LAOffset, u32 QCOffset, const XSdFecLdpcParameters* ParamsPtr, XSdFecLdpcCode* CodePtr);
+
+/**\brief Load a compiled LDPC code
+ *
+ * Writes the tables and code registers of a compiled code, unless the same code is already resident. Each table is
+ * written with one call of the bulk table writer. Codes whose tables are overwritten are no longer resident.
+ *
+ * NOTE: Only load codes while the device is not processing blocks that use the overwritten tables.
+ *
+ * @param InstancePtr Pointer to device instance struct
+ * @param CodePtr     Pointer to the compiled code
+ *
+ * @returns XST_SUCCESS, or XST_FAILURE if the table writer failed, the code is not resident then
+ */
+int XSdFecLoadLdpcCode(XSdFec *InstancePtr, const XSdFecLdpcCode* CodePtr);
+
+/**\brief Set bulk table writer
+ *
+ * @param InstancePtr Pointer to device instance struct
+ * @param WriteFn     Writer used by XSdFecLoadLdpcCode(), NULL for register writes
+ * @param CallBackRef Passed to WriteFn
+ */
+void XSdFecSetTableWriter(XSdFec *InstancePtr, XSdFecTableWriteFn WriteFn, void *CallBackRef);
+
+/**\brief Invalidate LDPC code residency
+ *
+ * Marks all codes as not resident, e.g. after the device was reset or the tables were written directly.
+ *
+ * @param InstancePtr Pointer to device instance struct
+ */
+void XSdFecInvalidateLdpcCodes(XSdFec *InstancePtr);
+
 /**\brief Classify interrupts
  * 
  * Queries interrupt status registers and classifies interrupt and reports recovery action
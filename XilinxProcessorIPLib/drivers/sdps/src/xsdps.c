@@ -91,6 +91,9 @@
 *       sk     04/07/22 Add support to read custom tap delay values from design
 *                       for SD/eMMC.
 * 4.2   ro     06/12/23 Added support for system device-tree flow.
+*       fl     10/14/26 Initialize the callback and command queue state.
+*       fl     10/14/26 Add XSdPs_SetInitCache() and initialize a known card
+*                       from the cached bus configuration.
 *
 * </pre>
 *
@@ -106,6 +109,8 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static s32 XSdPs_InitCard(XSdPs *InstancePtr);
+
 /*****************************************************************************/
 /**
 *
@@ -185,6 +190,15 @@ s32 XSdPs_CfgInitialize(XSdPs *InstancePtr, XSdPs_Config *ConfigPtr,
 	InstancePtr->IsBusy = FALSE;
 	InstancePtr->BlkSize = 0U;
 	InstancePtr->IsTuningDone = 0U;
+	InstancePtr->Handler = NULL;
+	InstancePtr->CallBackRef = NULL;
+	InstancePtr->XferBuff = NULL;
+	InstancePtr->XferLen = 0U;
+	InstancePtr->IsCmdQueueEn = 0U;
+	InstancePtr->CmdQueueDepth = 0U;
+	InstancePtr->CmdQueueWrite = 0U;
+	InstancePtr->InitCache = NULL;
+	InstancePtr->IsInitCached = 0U;
 
 	/* Host Controller version is read. */
 	InstancePtr->HC_Version =
@@ -235,6 +249,13 @@ RETURN_PATH:
 * 			c) One of the steps (commands) in the
 *			   initialization cycle failed
 *
+* @note		With an initialization cache set by XSdPs_SetInitCache(), a
+*		card with the cached card ID is brought up in the cached bus
+*		configuration and checked with a read of its first block. If
+*		that fails, the cache is invalidated and the card is powered
+*		off and initialized again through the full sequence. After a
+*		successful initialization the cache holds the configuration
+*		in use.
 *
 ******************************************************************************/
 s32 XSdPs_CardInitialize(XSdPs *InstancePtr)
@@ -244,15 +265,86 @@ s32 XSdPs_CardInitialize(XSdPs *InstancePtr)
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
+#if defined  (XCLOCKING)
+	Xil_ClockEnable(InstancePtr->Config.RefClk);
+#endif
+
+	Status = XSdPs_InitCard(InstancePtr);
+	if ((Status == XST_SUCCESS) && (InstancePtr->IsInitCached != 0U)) {
+		Status = XSdPs_VerifyInitCache(InstancePtr);
+	}
+
+	if ((Status != XST_SUCCESS) && (InstancePtr->IsInitCached != 0U)) {
+		/* The cached configuration does not work, start over */
+		InstancePtr->InitCache->IsValid = 0U;
+
+		Status = XSdPs_ResetConfig(InstancePtr);
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+		XSdPs_HostConfig(InstancePtr);
+
+		Status = XSdPs_InitCard(InstancePtr);
+	}
+
+	if ((Status == XST_SUCCESS) && (InstancePtr->InitCache != NULL)) {
+		XSdPs_StoreInitCache(InstancePtr);
+	}
+
+RETURN_PATH:
+#if defined  (XCLOCKING)
+	Xil_ClockDisable(InstancePtr->Config.RefClk);
+#endif
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function sets the initialization cache used by XSdPs_CardInitialize().
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	CachePtr is a pointer to the cache, owned by the application.
+*		A cache with IsValid cleared is filled by the next successful
+*		initialization. NULL disables the cache.
+*
+* @return	None
+*
+******************************************************************************/
+void XSdPs_SetInitCache(XSdPs *InstancePtr, XSdPs_InitCache *CachePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->InitCache = CachePtr;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function identifies and initializes the card, from the initialization
+* cache when it matches the card.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return
+* 		- XST_SUCCESS if initialization was successful
+* 		- XST_FAILURE if failure
+*
+******************************************************************************/
+static s32 XSdPs_InitCard(XSdPs *InstancePtr)
+{
+	s32 Status;
+
 	/* Default settings */
 	InstancePtr->BusWidth = XSDPS_1_BIT_WIDTH;
 	InstancePtr->CardType = XSDPS_CARD_SD;
 	InstancePtr->Switch1v8 = 0U;
 	InstancePtr->BusSpeed = XSDPS_CLK_400_KHZ;
-
-#if defined  (XCLOCKING)
-	Xil_ClockEnable(InstancePtr->Config.RefClk);
-#endif
+	InstancePtr->Mode = XSDPS_DEFAULT_SPEED_MODE;
+	InstancePtr->IsTuningDone = 0U;
+	InstancePtr->IsInitCached = 0U;
 
 	/* Change the clock frequency to 400 KHz */
 	Status = XSdPs_Change_ClkFreq(InstancePtr, InstancePtr->BusSpeed);
@@ -285,9 +377,6 @@ s32 XSdPs_CardInitialize(XSdPs *InstancePtr)
 	}
 
 RETURN_PATH:
-#if defined  (XCLOCKING)
-	Xil_ClockDisable(InstancePtr->Config.RefClk);
-#endif
 	return Status;
 }
 
@@ -64,8 +64,23 @@
 * descriptor table and hence care will have to be taken to call read/write
 * API's in a loop for large file sizes.
 *
-* Interrupt mode is not supported because it offers no improvement when used
-* with file system.
+* <b>Non-blocking transfers</b>
+*
+* XSdPs_StartReadTransfer() and XSdPs_StartWriteTransfer() return once the
+* command is accepted, while ADMA2 moves the data. Completion is found by
+* polling XSdPs_CheckReadTransfer()/XSdPs_CheckWriteTransfer(), or, after
+* registering a handler with XSdPs_SetCallback() and connecting
+* XSdPs_IntrHandler() to the interrupt controller, from the transfer complete
+* or error interrupt. The handler is called in interrupt context.
+*
+* For eMMC 5.1 devices supporting command queuing, XSdPs_CmdQueueEnable()
+* enables the device queue. Up to the queue depth of tasks are queued with
+* XSdPs_CmdQueueTask(), also while the data of another task is transferred,
+* XSdPs_CmdQueueStatus() reports which tasks the device has made ready and
+* XSdPs_StartQueuedTransfer() starts the data transfer of a ready task. The
+* queue is managed by the driver with CMD44 to CMD47, the host controller
+* has no command queue engine. While command queuing is enabled the device
+* rejects XSdPs_ReadPolled()/XSdPs_WritePolled().
 *
 * <b>eMMC support</b>
 *
@@ -163,6 +178,9 @@
 * 	sa     01/25/23	Use instance structure to store DMA descriptor tables.
 * 4.2   ro     06/12/23 Added support for system device-tree flow.
 * 4.2   ap     08/09/23 Reordered XSdPs_FrameCmd XSdPs_Identify_UhsMode functions
+*       fl     10/14/26 Add interrupt driven completion of non-blocking transfers
+*                       and eMMC command queuing.
+*       fl     10/14/26 Add the card initialization cache.
 *
 * </pre>
 *
@@ -241,6 +259,30 @@ extern "C" {
 
 /**************************** Type Definitions *******************************/
 
+/**
+ * Callback for the completion of a non-blocking transfer, called from
+ * XSdPs_IntrHandler() with XST_SUCCESS or XST_FAILURE.
+ */
+typedef void (*XSdPs_Handler)(void *CallBackRef, s32 Status);
+
+/**
+ * Bus configuration negotiated by XSdPs_CardInitialize(), kept by the
+ * application across initializations, e.g. in memory retained over a
+ * reboot. When the card ID matches, the next initialization applies it
+ * instead of querying the card capabilities again.
+ */
+typedef struct {
+	u32 IsValid;		/**< Cache holds a verified configuration */
+	u32 CardID[4];		/**< Card ID Register of the card */
+	u8  CardType;		/**< Type of card - SD/MMC/eMMC */
+	u8  BusWidth;		/**< Operating bus width */
+	u8  Switch1v8;		/**< Card was switched to 1.8V */
+	u32 Mode;		/**< Bus Speed Mode */
+	u32 OTapDelay;		/**< Output Tap Delay */
+	u32 ITapDelay;		/**< Input Tap Delay */
+	u32 SectorCount;	/**< Sector Count */
+} XSdPs_InitCache;
+
 /**
  * This typedef contains configuration information for the device.
  */
@@ -330,6 +372,16 @@ typedef struct {
 	u8  IsBusy;			/**< Busy Flag*/
 	u32 BlkSize;		/**< Block Size*/
 	u8  IsTuningDone;	/**< Flag to indicate HS200 tuning complete */
+	XSdPs_Handler Handler;	/**< Transfer completion callback */
+	void *CallBackRef;	/**< Callback reference of Handler */
+	u8 *XferBuff;		/**< Buffer of the non-blocking read in progress */
+	u32 XferLen;		/**< Length of XferBuff */
+	u8  IsCmdQueueEn;	/**< eMMC command queuing is enabled */
+	u8  CmdQueueDepth;	/**< eMMC command queue depth */
+	u32 CmdQueueWrite;	/**< Bit per queued task, set for writes */
+	u16 CmdQueueBlkCnt[XSDPS_CMDQ_MAX_DEPTH];	/**< Blocks per queued task */
+	XSdPs_InitCache *InitCache;	/**< Initialization cache, NULL if unused */
+	u8  IsInitCached;	/**< Card was initialized from InitCache */
 #ifdef __ICCARM__
 #pragma data_alignment = 32
 	XSdPs_Adma2Descriptor32 Adma2_DescrTbl32[32];		/**< ADMA descriptor table 32 Bit */
@@ -381,6 +433,7 @@ XSdPs_Config *XSdPs_LookupConfig(u32 BaseAddress);
 s32 XSdPs_CfgInitialize(XSdPs *InstancePtr, XSdPs_Config *ConfigPtr,
 			UINTPTR EffectiveAddr);
 s32 XSdPs_CardInitialize(XSdPs *InstancePtr);
+void XSdPs_SetInitCache(XSdPs *InstancePtr, XSdPs_InitCache *CachePtr);
 s32 XSdPs_ReadPolled(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff);
 s32 XSdPs_WritePolled(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, const u8 *Buff);
 s32 XSdPs_Idle(XSdPs *InstancePtr);
@@ -401,6 +454,18 @@ s32 XSdPs_CheckReadTransfer(XSdPs *InstancePtr);
 s32 XSdPs_StartWriteTransfer(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff);
 s32 XSdPs_CheckWriteTransfer(XSdPs *InstancePtr);
 s32 XSdPs_Erase(XSdPs *InstancePtr, u32 StartAddr, u32 EndAddr);
+s32 XSdPs_CmdQueueEnable(XSdPs *InstancePtr, u8 Enable);
+s32 XSdPs_CmdQueueTask(XSdPs *InstancePtr, u8 TaskId, u8 IsWrite, u32 Arg,
+		       u32 BlkCnt);
+s32 XSdPs_CmdQueueStatus(XSdPs *InstancePtr, u32 *ReadyTasks);
+s32 XSdPs_StartQueuedTransfer(XSdPs *InstancePtr, u8 TaskId, u8 *Buff);
+
+/*
+ * Interrupt related functions in xsdps_intr.c
+ */
+void XSdPs_SetCallback(XSdPs *InstancePtr, XSdPs_Handler FuncPtr,
+		       void *CallBackRef);
+void XSdPs_IntrHandler(void *XSdPsPtr);
 
 #ifdef __cplusplus
 }
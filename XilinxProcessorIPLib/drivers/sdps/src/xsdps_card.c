@@ -39,6 +39,8 @@
 * 			Xil_WaitForEvents API.
 * 	sa     01/25/23 Use instance structure to store DMA descriptor tables.
 * 4.2   ap     08/09/23 reordered function XSdPs_Identify_UhsMode.
+*       fl     10/14/26 Initialize a card matching the initialization cache
+*                       from the cached bus configuration.
 * </pre>
 *
 ******************************************************************************/
@@ -302,7 +304,12 @@ s32 XSdPs_SdCardInitialize(XSdPs *InstancePtr)
 		goto RETURN_PATH;
 	}
 
-	Status = XSdPs_SdModeInit(InstancePtr);
+	if (XSdPs_InitCacheMatch(InstancePtr) != 0U) {
+		InstancePtr->IsInitCached = 1U;
+		Status = XSdPs_SdModeInitCached(InstancePtr);
+	} else {
+		Status = XSdPs_SdModeInit(InstancePtr);
+	}
 	if (Status != XST_SUCCESS) {
 		Status = XST_FAILURE;
 		goto RETURN_PATH;
@@ -358,7 +365,12 @@ s32 XSdPs_MmcCardInitialize(XSdPs *InstancePtr)
 			goto RETURN_PATH;
 		}
 	} else if (InstancePtr->CardType == XSDPS_CHIP_EMMC) {
-		Status = XSdPs_EmmcModeInit(InstancePtr);
+		if (XSdPs_InitCacheMatch(InstancePtr) != 0U) {
+			InstancePtr->IsInitCached = 1U;
+			Status = XSdPs_EmmcModeInitCached(InstancePtr);
+		} else {
+			Status = XSdPs_EmmcModeInit(InstancePtr);
+		}
 		if (Status != XST_SUCCESS) {
 			Status = XST_FAILURE;
 			goto RETURN_PATH;
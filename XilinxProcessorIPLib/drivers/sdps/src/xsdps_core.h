@@ -28,6 +28,8 @@
 * 4.0   sk     02/25/22 Add support for eMMC5.1.
 * 4.1   sa     01/06/23 Include xil_util.h in this file.
 * 4.2   ap     08/09/23 Add XSdPs_SetTapDelay APIs.
+*       fl     10/14/26 Add non-blocking transfer helpers.
+*       fl     10/14/26 Add the initialization cache helpers.
 * </pre>
 *
 ******************************************************************************/
@@ -83,6 +85,11 @@ s32 XSdPs_SdCardEnum(XSdPs *InstancePtr);
 s32 XSdPs_MmcCardEnum(XSdPs *InstancePtr);
 s32 XSdPs_MmcModeInit(XSdPs *InstancePtr);
 s32 XSdPs_EmmcModeInit(XSdPs *InstancePtr);
+u8 XSdPs_InitCacheMatch(XSdPs *InstancePtr);
+s32 XSdPs_SdModeInitCached(XSdPs *InstancePtr);
+s32 XSdPs_EmmcModeInitCached(XSdPs *InstancePtr);
+s32 XSdPs_VerifyInitCache(XSdPs *InstancePtr);
+void XSdPs_StoreInitCache(XSdPs *InstancePtr);
 s32 XSdPs_ResetConfig(XSdPs *InstancePtr);
 void XSdPs_HostConfig(XSdPs *InstancePtr);
 s32 XSdPs_Reset(XSdPs *InstancePtr, u8 Value);
@@ -115,6 +122,8 @@ void XSdPs_SetTapDelay_SDR104(XSdPs *InstancePtr);
 void XSdPs_SetTapDelay_SDR50(XSdPs *InstancePtr);
 void XSdPs_SetTapDelay_DDR50(XSdPs *InstancePtr);
 void XSdPs_SetTapDelay_SDR25(XSdPs *InstancePtr);
+void XSdPs_EnableXferIntr(XSdPs *InstancePtr);
+void XSdPs_InvalidateXferBuff(XSdPs *InstancePtr);
 #ifdef VERSAL_NET
 u32 XSdPs_Select_HS400(XSdPs *InstancePtr);
 #endif
@@ -40,6 +40,9 @@
 * 			Xil_WaitForEvents API.
 * 	sa     01/25/23 Use instance structure to store DMA descriptor tables.
 * 4.2   ap     08/09/23 Restructured XSdPs_FrameCmd API
+*       fl     10/14/26 Frame CMD13 and the eMMC command queuing commands.
+*       fl     10/14/26 Add the SD and eMMC mode initialization from the
+*                       initialization cache.
 * </pre>
 *
 ******************************************************************************/
@@ -581,6 +584,249 @@ RETURN_PATH:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* @brief
+* This function checks if the initialization cache holds the configuration
+* of the enumerated card.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return	1 if the cache is valid for the card, 0 otherwise
+*
+******************************************************************************/
+u8 XSdPs_InitCacheMatch(XSdPs *InstancePtr)
+{
+	const XSdPs_InitCache *CachePtr = InstancePtr->InitCache;
+	u8 IsMatch = 0U;
+
+	if ((CachePtr != NULL) && (CachePtr->IsValid != 0U) &&
+	    (CachePtr->CardType == InstancePtr->CardType) &&
+	    (CachePtr->CardID[0] == InstancePtr->CardID[0]) &&
+	    (CachePtr->CardID[1] == InstancePtr->CardID[1]) &&
+	    (CachePtr->CardID[2] == InstancePtr->CardID[2]) &&
+	    (CachePtr->CardID[3] == InstancePtr->CardID[3])) {
+		IsMatch = 1U;
+	}
+
+	return IsMatch;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function does SD mode initialization from the initialization cache.
+* The SCR and the CMD6 function status are not read, the cached bus width,
+* speed mode and tap delays are applied directly. Tuning is done again by
+* XSdPs_Change_BusSpeed() for the modes that need it.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return
+* 		- XST_SUCCESS if initialization is successful
+* 		- XST_FAILURE if failure
+*
+******************************************************************************/
+s32 XSdPs_SdModeInitCached(XSdPs *InstancePtr)
+{
+	const XSdPs_InitCache *CachePtr = InstancePtr->InitCache;
+	s32 Status;
+
+	if (CachePtr->BusWidth == XSDPS_4_BIT_WIDTH) {
+		InstancePtr->BusWidth = XSDPS_4_BIT_WIDTH;
+		Status = XSdPs_Change_BusWidth(InstancePtr);
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+	}
+
+	if (CachePtr->Switch1v8 != InstancePtr->Switch1v8) {
+		/* Only the 8-bit configuration switches after enumeration */
+		if ((CachePtr->Switch1v8 == 0U) ||
+		    (InstancePtr->Config.BusWidth != XSDPS_WIDTH_8)) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+
+		InstancePtr->Switch1v8 = 1U;
+
+		Status = XSdPs_CardSetVoltage18(InstancePtr);
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+	}
+
+	if ((CachePtr->Mode != XSDPS_DEFAULT_SPEED_MODE) &&
+	    (CachePtr->Mode != XSDPS_UHS_SPEED_MODE_SDR12)) {
+		InstancePtr->Mode = CachePtr->Mode;
+		InstancePtr->OTapDelay = CachePtr->OTapDelay;
+		InstancePtr->ITapDelay = CachePtr->ITapDelay;
+
+		Status = XSdPs_Change_BusSpeed(InstancePtr);
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+	} else {
+		InstancePtr->Mode = CachePtr->Mode;
+	}
+
+	Status = XSdPs_SetBlkSize(InstancePtr, XSDPS_BLK_SIZE_512_MASK);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function does eMMC mode initialization from the initialization cache.
+* The device type is not read from the Extended CSD, the cached bus width,
+* speed mode, tap delays and sector count are applied directly. The timing
+* is still checked in the Extended CSD after the speed change.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return
+* 		- XST_SUCCESS if initialization is successful
+* 		- XST_FAILURE if failure
+*
+******************************************************************************/
+s32 XSdPs_EmmcModeInitCached(XSdPs *InstancePtr)
+{
+	const XSdPs_InitCache *CachePtr = InstancePtr->InitCache;
+	s32 Status;
+
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+	static u8 ExtCsd[512];
+#else
+	static u8 ExtCsd[512] __attribute__ ((aligned(32)));
+#endif
+
+	InstancePtr->BusWidth = CachePtr->BusWidth;
+	Status = XSdPs_Change_BusWidth(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	InstancePtr->SectorCount = CachePtr->SectorCount;
+	InstancePtr->Mode = CachePtr->Mode;
+	InstancePtr->OTapDelay = CachePtr->OTapDelay;
+	InstancePtr->ITapDelay = CachePtr->ITapDelay;
+	InstancePtr->IsTuningDone = 0U;
+
+	if (InstancePtr->Mode != XSDPS_DEFAULT_SPEED_MODE) {
+		Status = XSdPs_Change_BusSpeed(InstancePtr);
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+
+		Status = XSdPs_CheckEmmcTiming(InstancePtr, ExtCsd);
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+
+		if (InstancePtr->Mode == XSDPS_DDR52_MODE) {
+			Status = XSdPs_Change_BusWidth(InstancePtr);
+			if (Status != XST_SUCCESS) {
+				Status = XST_FAILURE;
+				goto RETURN_PATH;
+			}
+		}
+	}
+
+	/* RST_n was enabled permanently by the full initialization */
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function checks the bus configuration applied from the initialization
+* cache by reading the first block of the card.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return
+* 		- XST_SUCCESS if the block was read
+* 		- XST_FAILURE if failure
+*
+******************************************************************************/
+s32 XSdPs_VerifyInitCache(XSdPs *InstancePtr)
+{
+	s32 Status;
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+	static u8 Buff[XSDPS_BLK_SIZE_512_MASK];
+#else
+	static u8 Buff[XSDPS_BLK_SIZE_512_MASK] __attribute__ ((aligned(32)));
+#endif
+
+	Status = XSdPs_SetupTransfer(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_Read(InstancePtr, 0U, 1U, Buff);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdps_CheckTransferDone(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+	}
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function stores the configuration of the initialized card in the
+* initialization cache.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return	None
+*
+******************************************************************************/
+void XSdPs_StoreInitCache(XSdPs *InstancePtr)
+{
+	XSdPs_InitCache *CachePtr = InstancePtr->InitCache;
+
+	CachePtr->CardID[0] = InstancePtr->CardID[0];
+	CachePtr->CardID[1] = InstancePtr->CardID[1];
+	CachePtr->CardID[2] = InstancePtr->CardID[2];
+	CachePtr->CardID[3] = InstancePtr->CardID[3];
+	CachePtr->CardType = InstancePtr->CardType;
+	CachePtr->BusWidth = InstancePtr->BusWidth;
+	CachePtr->Switch1v8 = InstancePtr->Switch1v8;
+	CachePtr->Mode = InstancePtr->Mode;
+	CachePtr->OTapDelay = InstancePtr->OTapDelay;
+	CachePtr->ITapDelay = InstancePtr->ITapDelay;
+	CachePtr->SectorCount = InstancePtr->SectorCount;
+	CachePtr->IsValid = 1U;
+}
+
 /*****************************************************************************/
 /**
 * @brief
@@ -1772,6 +2018,9 @@ u32 XSdPs_FrameCmd(XSdPs *InstancePtr, u32 Cmd)
 		case ACMD42:
 		case CMD52:
 		case CMD55:
+		case CMD13:
+		case CMD44:
+		case CMD45:
 			RetVal |= RESP_R1;
 			break;
 		case CMD8:
@@ -1791,6 +2040,8 @@ u32 XSdPs_FrameCmd(XSdPs *InstancePtr, u32 Cmd)
 		case CMD24:
 		case CMD25:
 		case ACMD51:
+		case CMD46:
+		case CMD47:
 			RetVal |= RESP_R1 | (u32)XSDPS_DAT_PRESENT_SEL_MASK;
 			break;
 		case CMD58:
@@ -46,6 +46,7 @@
 *       sk     04/07/22 Fix typo in 'XSDPS_MMC_1_BIT_BUS_ARG' macro definition.
 * 4.1   sk     11/10/22 Add SD/eMMC Tap delay support for Versal Net.
 * 4.2   ro     06/12/23 Added support for system device-tree flow.
+*       fl     10/14/26 Add eMMC command queuing commands and EXT_CSD fields.
 *
 * </pre>
 *
@@ -690,6 +691,7 @@ extern "C" {
 #define CMD10	 0x0A00U
 #define CMD11	 0x0B00U
 #define CMD12	 0x0C00U
+#define CMD13	 0x0D00U
 #define ACMD13	 (XSDPS_APP_CMD_PREFIX + 0x0D00U)
 #define CMD16	 0x1000U
 #define CMD17	 0x1100U
@@ -708,6 +710,10 @@ extern "C" {
 #define CMD41	 0x2900U
 #define ACMD41	 (XSDPS_APP_CMD_PREFIX + 0x2900U)
 #define ACMD42	 (XSDPS_APP_CMD_PREFIX + 0x2A00U)
+#define CMD44	 0x2C00U
+#define CMD45	 0x2D00U
+#define CMD46	 0x2E00U
+#define CMD47	 0x2F00U
 #define ACMD51	 (XSDPS_APP_CMD_PREFIX + 0x3300U)
 #define CMD52	 0x3400U
 #define CMD55	 0x3700U
@@ -974,6 +980,13 @@ extern "C" {
 #define EXT_CSD_HS_TIMING_HS200		2U	/* Card is in HS200 mode */
 #define EXT_CSD_HS_TIMING_HS400		3U	/* Card is in HS200 mode */
 
+#define EXT_CSD_CMDQ_MODE_EN_BYTE	15U
+#define EXT_CSD_CMDQ_MODE_EN		1U	/* Command queuing is enabled */
+#define EXT_CSD_CMDQ_DEPTH_BYTE		307U
+#define EXT_CSD_CMDQ_DEPTH_MASK		0x1FU	/* Queue depth minus one */
+#define EXT_CSD_CMDQ_SUPPORT_BYTE	308U
+#define EXT_CSD_CMDQ_SUPPORT_MASK	0x1U	/* Command queuing is supported */
+
 #define EXT_CSD_RST_N_FUN_BYTE		162U
 #define EXT_CSD_RST_N_FUN_TEMP_DIS	0U	/* RST_n signal is temporarily disabled */
 #define EXT_CSD_RST_N_FUN_PERM_EN	1U	/* RST_n signal is permanently enabled */
@@ -1032,10 +1045,35 @@ extern "C" {
 		| ((u32)EXT_CSD_RST_N_FUN_BYTE << 16) \
 		| ((u32)EXT_CSD_RST_N_FUN_PERM_EN << 8))
 
+#define XSDPS_MMC_CMDQ_EN_ARG		(((u32)XSDPS_EXT_CSD_WRITE_BYTE << 24) \
+		| ((u32)EXT_CSD_CMDQ_MODE_EN_BYTE << 16) \
+		| ((u32)EXT_CSD_CMDQ_MODE_EN << 8))
+
+#define XSDPS_MMC_CMDQ_DIS_ARG		(((u32)XSDPS_EXT_CSD_WRITE_BYTE << 24) \
+		| ((u32)EXT_CSD_CMDQ_MODE_EN_BYTE << 16) \
+		| ((u32)0U << 8))
+
 #define XSDPS_MMC_DELAY_FOR_SWITCH	1000U
 
 /** @} */
 
+/**
+ * @name eMMC command queuing arguments
+ * @{
+ */
+/**
+ * Fields of the CMD44 (QUEUED_TASK_PARAMS) argument and the CMD13 argument
+ * to read the Queue Status Register.
+ */
+#define XSDPS_CMD44_DIR_READ_MASK	0x40000000U	/**< Read task */
+#define XSDPS_CMD44_PRIORITY_MASK	0x00800000U	/**< High priority task */
+#define XSDPS_CMD44_TASK_ID_SHIFT	16U		/**< Task ID shift */
+#define XSDPS_CMD44_BLK_CNT_MASK	0x0000FFFFU	/**< Number of blocks */
+#define XSDPS_CMD46_TASK_ID_SHIFT	16U		/**< CMD46/47 Task ID shift */
+#define XSDPS_CMD13_SQS_MASK		0x00008000U	/**< Send Queue Status */
+#define XSDPS_CMDQ_MAX_DEPTH		32U		/**< Maximum queue depth */
+/** @} */
+
 /**
  * @name General Delay definitions
  * @{
@@ -0,0 +1,152 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdps_intr.c
+* @addtogroup sdps Overview
+* @{
+*
+* The xsdps_intr.c file contains the interrupt driven completion of the
+* non-blocking transfers started by XSdPs_StartReadTransfer(),
+* XSdPs_StartWriteTransfer() and XSdPs_StartQueuedTransfer().
+* See xsdps.h for a detailed description of the device and driver.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.2   fl     10/14/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsdps_core.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Errors of the data phase, signaled to end a non-blocking transfer */
+#define XSDPS_XFER_ERR_SIG_MASK	(XSDPS_INTR_ERR_DT_MASK | \
+				 XSDPS_INTR_ERR_DCRC_MASK | \
+				 XSDPS_INTR_ERR_DEB_MASK | \
+				 XSDPS_INTR_ERR_AUTO_CMD12_MASK | \
+				 XSDPS_INTR_ERR_ADMA_MASK)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/*****************************************************************************/
+/**
+* @brief
+* This function sets the callback called from XSdPs_IntrHandler() when a
+* non-blocking transfer completes. The transfer complete and data error
+* interrupts are raised only while a callback is set.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	FuncPtr is the callback, NULL to poll for the completion.
+* @param	CallBackRef is passed to the callback.
+*
+* @return	None
+*
+******************************************************************************/
+void XSdPs_SetCallback(XSdPs *InstancePtr, XSdPs_Handler FuncPtr,
+		       void *CallBackRef)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->Handler = FuncPtr;
+	InstancePtr->CallBackRef = CallBackRef;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function enables the completion interrupt of the non-blocking
+* transfer just started, if a callback is set.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return	None
+*
+******************************************************************************/
+void XSdPs_EnableXferIntr(XSdPs *InstancePtr)
+{
+	if (InstancePtr->Handler == NULL) {
+		return;
+	}
+
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_ERR_INTR_SIG_EN_OFFSET, XSDPS_XFER_ERR_SIG_MASK);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_NORM_INTR_SIG_EN_OFFSET, XSDPS_INTR_TC_MASK);
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function is the interrupt handler of the SD controller. It completes
+* the non-blocking transfer in progress and calls the callback with
+* XST_SUCCESS, or with XST_FAILURE after resetting the data line if the
+* transfer failed. The application connects it to the interrupt controller
+* with the instance as the argument.
+*
+* @param	XSdPsPtr is a pointer to the XSdPs instance.
+*
+* @return	None
+*
+******************************************************************************/
+void XSdPs_IntrHandler(void *XSdPsPtr)
+{
+	XSdPs *InstancePtr = (XSdPs *)XSdPsPtr;
+	u16 NormStatus;
+	u16 ErrStatus;
+	s32 Status;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	NormStatus = XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+				     XSDPS_NORM_INTR_STS_OFFSET);
+	ErrStatus = XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+				    XSDPS_ERR_INTR_STS_OFFSET);
+	if (((NormStatus & XSDPS_INTR_TC_MASK) == 0U) &&
+	    ((ErrStatus & XSDPS_XFER_ERR_SIG_MASK) == 0U)) {
+		return;
+	}
+
+	/* Mask the signals, the next transfer enables them again */
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_NORM_INTR_SIG_EN_OFFSET, 0x0U);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_ERR_INTR_SIG_EN_OFFSET, 0x0U);
+
+	if (InstancePtr->IsBusy == FALSE) {
+		return;
+	}
+
+	Status = XSdPs_CheckTransferComplete(InstancePtr);
+	if (Status == XST_SUCCESS) {
+		XSdPs_InvalidateXferBuff(InstancePtr);
+	} else {
+		/* Leave the host ready for the next transfer */
+		(void)XSdPs_Reset(InstancePtr, XSDPS_SWRST_DAT_LINE_MASK);
+		InstancePtr->XferBuff = NULL;
+		InstancePtr->IsBusy = FALSE;
+		Status = XST_FAILURE;
+	}
+
+	if (InstancePtr->Handler != NULL) {
+		InstancePtr->Handler(InstancePtr->CallBackRef, Status);
+	}
+}
+/** @} */
@@ -64,6 +64,9 @@
 * 3.14  mn     11/28/21 Fix MISRA-C violations.
 * 4.0   sk     02/25/22 Add support for eMMC5.1.
 * 4.1   sk     11/10/22 Add SD/eMMC Tap delay support for Versal Net.
+* 4.2   fl     10/14/26 Invalidate the buffer of a completed non-blocking read,
+*                       raise the completion interrupt when a callback is set
+*                       and add eMMC command queuing.
 *
 * </pre>
 *
@@ -792,9 +795,13 @@ s32 XSdPs_StartReadTransfer(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff)
 	Status = XSdPs_Read(InstancePtr, Arg, BlkCnt, Buff);
 	if (Status != XST_SUCCESS) {
 		Status = XST_FAILURE;
+		goto RETURN_PATH;
 	}
 
+	InstancePtr->XferBuff = Buff;
+	InstancePtr->XferLen = BlkCnt * InstancePtr->BlkSize;
 	InstancePtr->IsBusy = TRUE;
+	XSdPs_EnableXferIntr(InstancePtr);
 
 RETURN_PATH:
 	return Status;
@@ -840,9 +847,12 @@ s32 XSdPs_StartWriteTransfer(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff)
 	Status = XSdPs_Write(InstancePtr, Arg, BlkCnt, Buff);
 	if (Status != XST_SUCCESS) {
 		Status = XST_FAILURE;
+		goto RETURN_PATH;
 	}
 
+	InstancePtr->XferBuff = NULL;
 	InstancePtr->IsBusy = TRUE;
+	XSdPs_EnableXferIntr(InstancePtr);
 
 RETURN_PATH:
 	return Status;
@@ -869,6 +879,9 @@ s32 XSdPs_CheckReadTransfer(XSdPs *InstancePtr)
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
 	Status = XSdPs_CheckTransferComplete(InstancePtr);
+	if (Status == XST_SUCCESS) {
+		XSdPs_InvalidateXferBuff(InstancePtr);
+	}
 
 	return Status;
 }
@@ -898,4 +911,366 @@ s32 XSdPs_CheckWriteTransfer(XSdPs *InstancePtr)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* @brief
+* This function invalidates the buffer of a completed non-blocking read, so
+* that the data written by the DMA is not hidden by stale cache lines.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return	None
+*
+******************************************************************************/
+void XSdPs_InvalidateXferBuff(XSdPs *InstancePtr)
+{
+	if ((InstancePtr->XferBuff != NULL) &&
+	    (InstancePtr->Config.IsCacheCoherent == 0U)) {
+		Xil_DCacheInvalidateRange((INTPTR)InstancePtr->XferBuff,
+					  (INTPTR)InstancePtr->XferLen);
+	}
+	InstancePtr->XferBuff = NULL;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function sends an eMMC command queuing command which uses only the
+* command line. It may be called while the data of another task is being
+* transferred, so the block count and the status of the transfer are left
+* untouched.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	Cmd is the command to be sent.
+* @param	Arg is the argument to be sent along with the command.
+*
+* @return
+* 		- XST_SUCCESS if the command was successful
+* 		- XST_FAILURE if the command line is busy or the command failed
+*
+******************************************************************************/
+static s32 XSdPs_CmdQueueCmd(XSdPs *InstancePtr, u32 Cmd, u32 Arg)
+{
+	u32 Timeout = 10000000U;
+	u32 CmdErrMask = XSDPS_INTR_ERR_CT_MASK | XSDPS_INTR_ERR_CCRC_MASK |
+			 XSDPS_INTR_ERR_CEB_MASK | XSDPS_INTR_ERR_CI_MASK;
+	u32 StatusReg;
+	u32 CommandReg;
+	u16 ErrReg;
+	s32 Status;
+
+	Status = XSdPs_CheckBusIdle(InstancePtr, XSDPS_PSR_INHIBIT_CMD_MASK);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress,
+		       XSDPS_ARGMT_OFFSET, Arg);
+
+	/*
+	 * The transfer mode half of the write is ignored by the host while
+	 * a data transfer is in progress.
+	 */
+	CommandReg = XSdPs_FrameCmd(InstancePtr, Cmd) & 0x3FFFU;
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_XFER_MODE_OFFSET,
+		       (CommandReg << 16) | InstancePtr->TransferMode);
+
+	Status = Xil_WaitForEvents(InstancePtr->Config.BaseAddress + XSDPS_NORM_INTR_STS_OFFSET,
+				   XSDPS_INTR_ERR_MASK | XSDPS_INTR_CC_MASK,
+				   XSDPS_INTR_ERR_MASK | XSDPS_INTR_CC_MASK,
+				   Timeout, &StatusReg);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	ErrReg = XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+				 XSDPS_ERR_INTR_STS_OFFSET);
+	if (((u32)ErrReg & CmdErrMask) != 0U) {
+		/* Clear only the command errors, data errors belong to the transfer */
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				 XSDPS_ERR_INTR_STS_OFFSET, (u16)((u32)ErrReg & CmdErrMask));
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if ((StatusReg & XSDPS_INTR_CC_MASK) == 0U) {
+		/* The error is of the data transfer, wait for the command */
+		Status = Xil_WaitForEvents(InstancePtr->Config.BaseAddress + XSDPS_NORM_INTR_STS_OFFSET,
+					   XSDPS_INTR_CC_MASK, XSDPS_INTR_CC_MASK,
+					   Timeout, &StatusReg);
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+	}
+
+	/* Write to clear bit */
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_NORM_INTR_STS_OFFSET, XSDPS_INTR_CC_MASK);
+
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function enables or disables command queuing of an eMMC 5.1 device.
+* It must be called while no transfer is in progress and, when disabling,
+* with an empty device queue.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	Enable is 1 to enable and 0 to disable command queuing.
+*
+* @return
+* 		- XST_SUCCESS if successful
+* 		- XST_FAILURE if the device is not an eMMC supporting command
+* 		queuing, a transfer is in progress or the switch failed
+*
+******************************************************************************/
+s32 XSdPs_CmdQueueEnable(XSdPs *InstancePtr, u8 Enable)
+{
+	s32 Status;
+	u8 Depth;
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+	static u8 ExtCsd[512];
+#else
+	static u8 ExtCsd[512] __attribute__ ((aligned(32)));
+#endif
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((InstancePtr->CardType != XSDPS_CHIP_EMMC) ||
+	    (InstancePtr->IsBusy == TRUE)) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if (Enable == 0U) {
+		Status = XSdPs_Set_Mmc_ExtCsd(InstancePtr, XSDPS_MMC_CMDQ_DIS_ARG);
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+		InstancePtr->IsCmdQueueEn = 0U;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_Get_Mmc_ExtCsd(InstancePtr, ExtCsd);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if ((ExtCsd[EXT_CSD_CMDQ_SUPPORT_BYTE] & EXT_CSD_CMDQ_SUPPORT_MASK) == 0U) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+	Depth = (ExtCsd[EXT_CSD_CMDQ_DEPTH_BYTE] & EXT_CSD_CMDQ_DEPTH_MASK) + 1U;
+
+	Status = XSdPs_Set_Mmc_ExtCsd(InstancePtr, XSDPS_MMC_CMDQ_EN_ARG);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	InstancePtr->CmdQueueDepth = Depth;
+	InstancePtr->CmdQueueWrite = 0U;
+	InstancePtr->IsCmdQueueEn = 1U;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function queues a read or write task in the eMMC device queue with
+* CMD44 and CMD45. It may be called while the data of another task is being
+* transferred.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	TaskId is the task ID, less than the queue depth and not used
+* 		by another queued task.
+* @param	IsWrite is 1 for a write task and 0 for a read task.
+* @param	Arg is the start block address of the task, a byte address
+* 		for standard capacity devices.
+* @param	BlkCnt is the number of blocks of the task.
+*
+* @return
+* 		- XST_SUCCESS if the task was queued
+* 		- XST_FAILURE if command queuing is not enabled, the parameters
+* 		are invalid or the device rejected the task
+*
+******************************************************************************/
+s32 XSdPs_CmdQueueTask(XSdPs *InstancePtr, u8 TaskId, u8 IsWrite, u32 Arg,
+		       u32 BlkCnt)
+{
+	s32 Status;
+	u32 TaskArg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((InstancePtr->IsCmdQueueEn == 0U) ||
+	    (TaskId >= InstancePtr->CmdQueueDepth) ||
+	    (BlkCnt == 0U) || (BlkCnt > XSDPS_CMD44_BLK_CNT_MASK)) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	TaskArg = ((u32)TaskId << XSDPS_CMD44_TASK_ID_SHIFT) | BlkCnt;
+	if (IsWrite == 0U) {
+		TaskArg |= XSDPS_CMD44_DIR_READ_MASK;
+	}
+
+	Status = XSdPs_CmdQueueCmd(InstancePtr, CMD44, TaskArg);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_CmdQueueCmd(InstancePtr, CMD45, Arg);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	InstancePtr->CmdQueueBlkCnt[TaskId] = (u16)BlkCnt;
+	if (IsWrite == 0U) {
+		InstancePtr->CmdQueueWrite &= ~((u32)1U << TaskId);
+	} else {
+		InstancePtr->CmdQueueWrite |= (u32)1U << TaskId;
+	}
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function reads the Queue Status Register of the eMMC device with
+* CMD13. It may be called while the data of another task is being
+* transferred.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	ReadyTasks is filled with a bit per task ID, set for the queued
+* 		tasks the device is ready to execute.
+*
+* @return
+* 		- XST_SUCCESS if successful
+* 		- XST_FAILURE if command queuing is not enabled or CMD13 failed
+*
+******************************************************************************/
+s32 XSdPs_CmdQueueStatus(XSdPs *InstancePtr, u32 *ReadyTasks)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(ReadyTasks != NULL);
+
+	if (InstancePtr->IsCmdQueueEn == 0U) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_CmdQueueCmd(InstancePtr, CMD13,
+				   InstancePtr->RelCardAddr | XSDPS_CMD13_SQS_MASK);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	*ReadyTasks = XSdPs_ReadReg(InstancePtr->Config.BaseAddress,
+				    XSDPS_RESP0_OFFSET);
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function starts the data transfer of a queued task the device has
+* reported ready, with CMD46 for a read and CMD47 for a write task. The
+* completion is checked with XSdPs_CheckReadTransfer() or
+* XSdPs_CheckWriteTransfer(), or reported to the callback.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	TaskId is the task ID passed to XSdPs_CmdQueueTask().
+* @param	Buff - Pointer to the data buffer for the DMA transfer, of the
+* 		block count of the task.
+*
+* @return
+* 		- XST_SUCCESS if the transfer was started
+* 		- XST_FAILURE if command queuing is not enabled, another
+* 		transfer is in progress or the command failed
+*
+******************************************************************************/
+s32 XSdPs_StartQueuedTransfer(XSdPs *InstancePtr, u8 TaskId, u8 *Buff)
+{
+	s32 Status;
+	u32 BlkCnt;
+	u32 IsWrite;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((InstancePtr->IsCmdQueueEn == 0U) || (InstancePtr->IsBusy == TRUE) ||
+	    (TaskId >= InstancePtr->CmdQueueDepth)) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_SetupTransfer(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	BlkCnt = InstancePtr->CmdQueueBlkCnt[TaskId];
+	if ((BlkCnt * InstancePtr->BlkSize) > (32U * XSDPS_DESC_MAX_LENGTH)) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	IsWrite = InstancePtr->CmdQueueWrite & ((u32)1U << TaskId);
+	if (IsWrite != 0U) {
+		XSdPs_SetupWriteDma(InstancePtr, (u16)BlkCnt,
+				    (u16)InstancePtr->BlkSize, Buff);
+	} else {
+		XSdPs_SetupReadDma(InstancePtr, (u16)BlkCnt,
+				   (u16)InstancePtr->BlkSize, Buff);
+	}
+	/* The device knows the block count of the task, no CMD12 */
+	InstancePtr->TransferMode &= (u16)~XSDPS_TM_AUTO_CMD12_EN_MASK;
+
+	Status = XSdPs_CmdTransfer(InstancePtr, (IsWrite != 0U) ? CMD47 : CMD46,
+				   (u32)TaskId << XSDPS_CMD46_TASK_ID_SHIFT, BlkCnt);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if (IsWrite != 0U) {
+		InstancePtr->XferBuff = NULL;
+	} else {
+		InstancePtr->XferBuff = Buff;
+		InstancePtr->XferLen = BlkCnt * InstancePtr->BlkSize;
+	}
+	InstancePtr->IsBusy = TRUE;
+	XSdPs_EnableXferIntr(InstancePtr);
+
+RETURN_PATH:
+	return Status;
+}
+
 /** @} */
@@ -57,6 +57,8 @@
 * 3.9   sb     07/05/23 Added support for system device-tree flow.
 * 3.9   sb     07/27/23 Fix the issue of driver giving junk values when its
 *                       running at low clock speed in slave mode.
+* 3.10  fl     10/14/26 Refill the TX FIFO at the TX threshold and added
+*                       XSpiPs_TransferMsgs.
 * </pre>
 *
 ******************************************************************************/
@@ -112,6 +114,9 @@
 
 static void StubStatusHandler(const void *CallBackRef, u32 StatusEvent,
 			      u32 ByteCount);
+static void XSpiPs_StartTransfer(XSpiPs *InstancePtr, u8 *SendBufPtr,
+				 u8 *RecvBufPtr, u32 ByteCount);
+static void XSpiPs_NextMsg(XSpiPs *InstancePtr);
 
 /************************** Variable Definitions *****************************/
 
@@ -183,6 +188,9 @@ s32 XSpiPs_CfgInitialize(XSpiPs *InstancePtr, const XSpiPs_Config *ConfigPtr,
 		InstancePtr->RecvBufferPtr = NULL;
 		InstancePtr->RequestedBytes = 0U;
 		InstancePtr->RemainingBytes = 0U;
+		InstancePtr->MsgPtr = NULL;
+		InstancePtr->RemainingMsgs = 0U;
+		InstancePtr->TxThreshold = 1U;
 		InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
 		/*
@@ -235,6 +243,107 @@ void XSpiPs_Reset(XSpiPs *InstancePtr)
 
 }
 
+/*****************************************************************************/
+/**
+*
+* Starts an interrupt driven transfer: selects the slave, fills the TX FIFO
+* and enables the interrupts. The busy flag must be set.
+*
+* @param	InstancePtr is a pointer to the XSpiPs instance.
+* @param	SendBufPtr is a pointer to a buffer of data for sending.
+* @param	RecvBufPtr is a pointer to a buffer for received data, or NULL.
+* @param	ByteCount contains the number of bytes to send/receive.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XSpiPs_StartTransfer(XSpiPs *InstancePtr, u8 *SendBufPtr,
+				 u8 *RecvBufPtr, u32 ByteCount)
+{
+	u32 ConfigReg;
+	u32 TransCount = 0U;
+
+	/*
+	 * Set up buffer pointers.
+	 */
+	InstancePtr->SendBufferPtr = SendBufPtr;
+	InstancePtr->RecvBufferPtr = RecvBufPtr;
+
+	InstancePtr->RequestedBytes = ByteCount;
+	InstancePtr->RemainingBytes = ByteCount;
+
+	/*
+	 * Enable the device.
+	 */
+	XSpiPs_Enable(InstancePtr);
+
+	/*
+	 * If manual chip select mode, initialize the slave select value.
+	 */
+	if (XSpiPs_IsManualChipSelect(InstancePtr) != FALSE) {
+		ConfigReg = XSpiPs_ReadReg(InstancePtr->Config.BaseAddress,
+					   XSPIPS_CR_OFFSET);
+		/*
+		 * Set the slave select value.
+		 */
+		ConfigReg &= (u32)(~XSPIPS_CR_SSCTRL_MASK);
+		ConfigReg |= InstancePtr->SlaveSelect;
+		XSpiPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XSPIPS_CR_OFFSET, ConfigReg);
+	}
+
+	/*
+	 * Clear all the interrupts.
+	 */
+	XSpiPs_WriteReg(InstancePtr->Config.BaseAddress, XSPIPS_SR_OFFSET,
+			XSPIPS_IXR_WR_TO_CLR_MASK);
+
+	/*
+	 * Fill the TXFIFO with as many bytes as it will take (or as many as
+	 * we have to send).
+	 */
+	while ((InstancePtr->RemainingBytes > 0U) &&
+	       (TransCount < XSPIPS_FIFO_DEPTH)) {
+		XSpiPs_SendByte(InstancePtr->Config.BaseAddress,
+				*InstancePtr->SendBufferPtr);
+		InstancePtr->SendBufferPtr += 1;
+		InstancePtr->RemainingBytes--;
+		TransCount++;
+	}
+
+	/*
+	 * Refill at the threshold while there is more to send, the last
+	 * bytes are read once the FIFO is empty.
+	 */
+	if (InstancePtr->TxThreshold > 1U) {
+		XSpiPs_SetTXWatermark(InstancePtr,
+				      (InstancePtr->RemainingBytes > 0U) ?
+				      InstancePtr->TxThreshold : 1U);
+	}
+
+	/*
+	 * Enable interrupts (connecting to the interrupt controller and
+	 * enabling interrupts should have been done by the caller).
+	 */
+	XSpiPs_WriteReg(InstancePtr->Config.BaseAddress,
+			XSPIPS_IER_OFFSET, XSPIPS_IXR_DFLT_MASK);
+
+	/*
+	 * If master mode and manual start mode, issue manual start command
+	 * to start the transfer.
+	 */
+	if ((XSpiPs_IsManualStart(InstancePtr) == TRUE)
+	    && (XSpiPs_IsMaster(InstancePtr) == TRUE)) {
+		ConfigReg = XSpiPs_ReadReg(InstancePtr->Config.BaseAddress,
+					   XSPIPS_CR_OFFSET);
+		ConfigReg |= XSPIPS_CR_MANSTRT_MASK;
+		XSpiPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XSPIPS_CR_OFFSET, ConfigReg);
+	}
+}
+
 /*****************************************************************************/
 /**
 *
@@ -306,8 +415,6 @@ void XSpiPs_Reset(XSpiPs *InstancePtr)
 s32 XSpiPs_Transfer(XSpiPs *InstancePtr, u8 *SendBufPtr,
 		    u8 *RecvBufPtr, u32 ByteCount)
 {
-	u32 ConfigReg;
-	u8 TransCount = 0U;
 	s32 StatusTransfer;
 
 	/*
@@ -330,77 +437,108 @@ s32 XSpiPs_Transfer(XSpiPs *InstancePtr, u8 *SendBufPtr,
 		 * transfer is entirely done.
 		 */
 		InstancePtr->IsBusy = TRUE;
+		InstancePtr->MsgPtr = NULL;
+		InstancePtr->RemainingMsgs = 0U;
+		XSpiPs_StartTransfer(InstancePtr, SendBufPtr, RecvBufPtr,
+				     ByteCount);
+		StatusTransfer = (s32)XST_SUCCESS;
+	}
+	return StatusTransfer;
+}
 
-		/*
-		 * Set up buffer pointers.
-		 */
-		InstancePtr->SendBufferPtr = SendBufPtr;
-		InstancePtr->RecvBufferPtr = RecvBufPtr;
-
-		InstancePtr->RequestedBytes = ByteCount;
-		InstancePtr->RemainingBytes = ByteCount;
+/*****************************************************************************/
+/**
+*
+* Transfers a list of messages on the SPI bus, one after the other, from the
+* interrupt handler. The slave stays selected from one message to the next
+* unless the XSPIPS_MSG_CS_CHANGE flag of the message is set, and it is
+* deselected after the last message. The status callback function is called
+* once, when the last message has been sent/received.
+*
+* This function is non-blocking. As a master, the SetSlaveSelect function must
+* be called prior to this function.
+*
+* @param	InstancePtr is a pointer to the XSpiPs instance.
+* @param	Msgs is the array of messages. It must stay valid until the
+*		status callback is called. The buffers of every message follow
+*		the rules of XSpiPs_Transfer().
+* @param	NumMsgs is the number of messages.
+*
+* @return
+*		- XST_SUCCESS if the messages are successfully handed off to
+*		the device for transfer.
+*		- XST_DEVICE_BUSY indicates that a data transfer is already in
+*		progress. This is determined by the driver.
+*
+* @note
+*
+* The slave select is only held between the messages with the
+* XSPIPS_FORCE_SSELECT_OPTION, otherwise the controller deselects the slave
+* whenever the TX FIFO is empty. This function is not thread-safe.
+*
+******************************************************************************/
+s32 XSpiPs_TransferMsgs(XSpiPs *InstancePtr, XSpiPs_Msg *Msgs, u32 NumMsgs)
+{
+	u32 Index;
+	s32 StatusTransfer;
 
-		/*
-		 * Enable the device.
-		 */
-		XSpiPs_Enable(InstancePtr);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Msgs != NULL);
+	Xil_AssertNonvoid(NumMsgs > 0U);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
 
-		/*
-		 * If manual chip select mode, initialize the slave select value.
-		 */
-		if (XSpiPs_IsManualChipSelect(InstancePtr) != FALSE) {
-			ConfigReg = XSpiPs_ReadReg(InstancePtr->Config.BaseAddress,
-						   XSPIPS_CR_OFFSET);
-			/*
-			 * Set the slave select value.
-			 */
-			ConfigReg &= (u32)(~XSPIPS_CR_SSCTRL_MASK);
-			ConfigReg |= InstancePtr->SlaveSelect;
-			XSpiPs_WriteReg(InstancePtr->Config.BaseAddress,
-					XSPIPS_CR_OFFSET, ConfigReg);
-		}
+	for (Index = 0U; Index < NumMsgs; Index++) {
+		Xil_AssertNonvoid(Msgs[Index].SendBufPtr != NULL);
+		Xil_AssertNonvoid(Msgs[Index].ByteCount > 0U);
+	}
 
-		/*
-		 * Clear all the interrupts.
-		 */
-		XSpiPs_WriteReg(InstancePtr->Config.BaseAddress, XSPIPS_SR_OFFSET,
-				XSPIPS_IXR_WR_TO_CLR_MASK);
+	/*
+	 * Check whether there is another transfer in progress. Not thread-safe.
+	 */
+	if (InstancePtr->IsBusy == TRUE) {
+		StatusTransfer = (s32)XST_DEVICE_BUSY;
+	} else {
+		InstancePtr->IsBusy = TRUE;
+		InstancePtr->MsgPtr = Msgs;
+		InstancePtr->RemainingMsgs = NumMsgs - 1U;
+		XSpiPs_StartTransfer(InstancePtr, Msgs->SendBufPtr,
+				     Msgs->RecvBufPtr, Msgs->ByteCount);
+		StatusTransfer = (s32)XST_SUCCESS;
+	}
+	return StatusTransfer;
+}
 
-		/*
-		 * Fill the TXFIFO with as many bytes as it will take (or as many as
-		 * we have to send).
-		 */
-		while ((InstancePtr->RemainingBytes > 0U) &&
-		       (TransCount < XSPIPS_FIFO_DEPTH)) {
-			XSpiPs_SendByte(InstancePtr->Config.BaseAddress,
-					*InstancePtr->SendBufferPtr);
-			InstancePtr->SendBufferPtr += 1;
-			InstancePtr->RemainingBytes--;
-			TransCount++;
-		}
+/*****************************************************************************/
+/**
+*
+* Starts the next message of XSpiPs_TransferMsgs() once the current one is
+* done. Called from the interrupt handler.
+*
+* @param	InstancePtr is a pointer to the XSpiPs instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XSpiPs_NextMsg(XSpiPs *InstancePtr)
+{
+	u32 ConfigReg;
 
-		/*
-		 * Enable interrupts (connecting to the interrupt controller and
-		 * enabling interrupts should have been done by the caller).
-		 */
+	if (((InstancePtr->MsgPtr->Flags & XSPIPS_MSG_CS_CHANGE) != 0U) &&
+	    (XSpiPs_IsManualChipSelect(InstancePtr) == TRUE)) {
+		ConfigReg = XSpiPs_ReadReg(InstancePtr->Config.BaseAddress,
+					   XSPIPS_CR_OFFSET);
+		ConfigReg |= XSPIPS_CR_SSCTRL_MASK;
 		XSpiPs_WriteReg(InstancePtr->Config.BaseAddress,
-				XSPIPS_IER_OFFSET, XSPIPS_IXR_DFLT_MASK);
-
-		/*
-		 * If master mode and manual start mode, issue manual start command
-		 * to start the transfer.
-		 */
-		if ((XSpiPs_IsManualStart(InstancePtr) == TRUE)
-		    && (XSpiPs_IsMaster(InstancePtr) == TRUE)) {
-			ConfigReg = XSpiPs_ReadReg(InstancePtr->Config.BaseAddress,
-						   XSPIPS_CR_OFFSET);
-			ConfigReg |= XSPIPS_CR_MANSTRT_MASK;
-			XSpiPs_WriteReg(InstancePtr->Config.BaseAddress,
-					XSPIPS_CR_OFFSET, ConfigReg);
-		}
-		StatusTransfer = (s32)XST_SUCCESS;
+				XSPIPS_CR_OFFSET, ConfigReg);
 	}
-	return StatusTransfer;
+
+	InstancePtr->MsgPtr += 1;
+	InstancePtr->RemainingMsgs--;
+	XSpiPs_StartTransfer(InstancePtr, InstancePtr->MsgPtr->SendBufPtr,
+			     InstancePtr->MsgPtr->RecvBufPtr,
+			     InstancePtr->MsgPtr->ByteCount);
 }
 
 /*****************************************************************************/
@@ -519,7 +657,12 @@ s32 XSpiPs_PolledTransfer(XSpiPs *InstancePtr, u8 *SendBufPtr,
 
 		while ((InstancePtr->RemainingBytes > (u32)0U) ||
 		       (InstancePtr->RequestedBytes > (u32)0U)) {
-			TransCount = 0U;
+			/*
+			 * Bytes left in the FIFO by a refill at the TX threshold
+			 * count against the FIFO depth.
+			 */
+			TransCount = InstancePtr->RequestedBytes -
+				     InstancePtr->RemainingBytes;
 			/*
 			 * Fill the TXFIFO with as many bytes as it will take (or as
 			 * many as we have to send).
@@ -533,6 +676,12 @@ s32 XSpiPs_PolledTransfer(XSpiPs *InstancePtr, u8 *SendBufPtr,
 				++TransCount;
 			}
 
+			if (InstancePtr->TxThreshold > 1U) {
+				XSpiPs_SetTXWatermark(InstancePtr,
+					(InstancePtr->RemainingBytes > 0U) ?
+					InstancePtr->TxThreshold : 1U);
+			}
+
 			/*
 			 * If master mode and manual start mode, issue manual start
 			 * command to start the transfer.
@@ -578,8 +727,15 @@ s32 XSpiPs_PolledTransfer(XSpiPs *InstancePtr, u8 *SendBufPtr,
 			 * count obtained while filling tx fifo. Always get the
 			 * received data, but only fill the receive buffer if it
 			 * points to something (the upper layer software may not
-			 * care to receive data).
+			 * care to receive data). Refilling at the TX threshold,
+			 * only the bytes surely shifted out are read.
 			 */
+			if ((InstancePtr->TxThreshold > 1U) &&
+			    (InstancePtr->RemainingBytes > 0U)) {
+				TransCount = (TransCount > InstancePtr->TxThreshold) ?
+					     (TransCount - InstancePtr->TxThreshold) :
+					     0U;
+			}
 			while (TransCount != (u32)0U) {
 				TempData = (u8)XSpiPs_RecvByte(
 						   InstancePtr->Config.BaseAddress);
@@ -926,6 +1082,7 @@ void XSpiPs_InterruptHandler(XSpiPs *InstancePtr)
 	if ((IntrStatus & XSPIPS_IXR_TXOW_MASK) != 0U) {
 		u8 TempData;
 		u32 TransCount;
+		u32 RecvCount;
 		/*
 		 * A transmit has just completed. Process received data and
 		 * check for more data to transmit.
@@ -938,19 +1095,42 @@ void XSpiPs_InterruptHandler(XSpiPs *InstancePtr)
 		 */
 		TransCount = SpiPtr->RequestedBytes - SpiPtr->RemainingBytes;
 
-		while (TransCount != 0U) {
-			/* Fixed delay due to controller limitation with
-			 * RX_NEMPTY incorrect status
-			 * Xilinx AR:65885 contains more details
-			 */
-			usleep(10);
-			TempData = (u8)XSpiPs_RecvByte(SpiPtr->Config.BaseAddress);
-			if (SpiPtr->RecvBufferPtr != NULL) {
-				*SpiPtr->RecvBufferPtr = TempData;
-				SpiPtr->RecvBufferPtr += 1;
+		/*
+		 * Refilling at the TX threshold, the TX FIFO still holds up
+		 * to TxThreshold - 1 bytes and one byte may be shifting. The
+		 * other bytes are long done, so they are read without the
+		 * delay and the rest stays in the FIFO for the next interrupt.
+		 */
+		if ((SpiPtr->TxThreshold > 1U) && (SpiPtr->RemainingBytes > 0U)) {
+			RecvCount = (TransCount > SpiPtr->TxThreshold) ?
+				    (TransCount - SpiPtr->TxThreshold) : 0U;
+			TransCount -= RecvCount;
+			while (RecvCount != 0U) {
+				TempData = (u8)XSpiPs_RecvByte(
+						   SpiPtr->Config.BaseAddress);
+				if (SpiPtr->RecvBufferPtr != NULL) {
+					*SpiPtr->RecvBufferPtr = TempData;
+					SpiPtr->RecvBufferPtr += 1;
+				}
+				SpiPtr->RequestedBytes--;
+				--RecvCount;
+			}
+		} else {
+			while (TransCount != 0U) {
+				/* Fixed delay due to controller limitation with
+				 * RX_NEMPTY incorrect status
+				 * Xilinx AR:65885 contains more details
+				 */
+				usleep(10);
+				TempData = (u8)XSpiPs_RecvByte(
+						   SpiPtr->Config.BaseAddress);
+				if (SpiPtr->RecvBufferPtr != NULL) {
+					*SpiPtr->RecvBufferPtr = TempData;
+					SpiPtr->RecvBufferPtr += 1;
+				}
+				SpiPtr->RequestedBytes--;
+				--TransCount;
 			}
-			SpiPtr->RequestedBytes--;
-			--TransCount;
 		}
 
 		/*
@@ -966,7 +1146,15 @@ void XSpiPs_InterruptHandler(XSpiPs *InstancePtr)
 			++TransCount;
 		}
 
+		if ((SpiPtr->TxThreshold > 1U) && (SpiPtr->RemainingBytes == 0U)) {
+			XSpiPs_SetTXWatermark(SpiPtr, 1U);
+		}
+
 		if ((SpiPtr->RemainingBytes == 0U) &&
+		    (SpiPtr->RequestedBytes == 0U) &&
+		    (SpiPtr->RemainingMsgs != 0U)) {
+			XSpiPs_NextMsg(SpiPtr);
+		} else if ((SpiPtr->RemainingBytes == 0U) &&
 		    (SpiPtr->RequestedBytes == 0U)) {
 			/*
 			 * No more data to send. Disable the interrupt and
@@ -1036,6 +1224,7 @@ void XSpiPs_InterruptHandler(XSpiPs *InstancePtr)
 	if ((IntrStatus & XSPIPS_IXR_RXOVR_MASK) != 0U) {
 		BytesDone = SpiPtr->RequestedBytes - SpiPtr->RemainingBytes;
 		SpiPtr->IsBusy = FALSE;
+		SpiPtr->RemainingMsgs = 0U;
 
 		/*
 		 * The Slave select lines are being manually controlled.
@@ -1059,6 +1248,7 @@ void XSpiPs_InterruptHandler(XSpiPs *InstancePtr)
 		BytesDone = SpiPtr->RequestedBytes - SpiPtr->RemainingBytes;
 
 		SpiPtr->IsBusy = FALSE;
+		SpiPtr->RemainingMsgs = 0U;
 		/*
 		 * The Slave select lines are being manually controlled.
 		 * Disable them because the transfer is complete.
@@ -1086,8 +1276,8 @@ END:
 /**
 *
 * Aborts a transfer in progress by disabling the device and resetting the FIFOs
-* if present. The byte counts are cleared, the busy flag is cleared, and mode
-* fault is cleared.
+* if present. The byte counts are cleared, the busy flag is cleared, mode
+* fault is cleared and the TX FIFO watermark is reset.
 *
 * @param	InstancePtr is a pointer to the XSpiPs instance.
 *
@@ -1138,8 +1328,15 @@ void XSpiPs_Abort(XSpiPs *InstancePtr)
 			XSPIPS_SR_OFFSET,
 			XSPIPS_IXR_MODF_MASK);
 
+	/*
+	 * An aborted transfer may have left the TX threshold programmed.
+	 */
+	XSpiPs_SetTXWatermark(InstancePtr,
+			      (XSPIPS_TXWR_RESET_VALUE & XSPIPS_TXWR_MASK));
+
 	InstancePtr->RemainingBytes = 0U;
 	InstancePtr->RequestedBytes = 0U;
+	InstancePtr->RemainingMsgs = 0U;
 	InstancePtr->IsBusy = FALSE;
 }
 
@@ -239,6 +239,8 @@
 * 3.7   asa    04/01/22 Updated version to 3.7. Fixed issue in selftest
 *                       example.
 * 3.9   sb     07/05/23 Added support for system device-tree flow.
+* 3.10  fl     10/14/26 Added TX FIFO refill threshold and message queue
+*                       transfers.
 *
 * </pre>
 *
@@ -357,6 +359,16 @@ extern "C" {
 						RX FIFO full */
 /*@}*/
 
+/** @name Message flags
+ *
+ * Flags of the messages passed to XSpiPs_TransferMsgs().
+ *
+ * @{
+ */
+#define XSPIPS_MSG_CS_CHANGE		0x00000001U /**< Deselect the slave
+						after the message */
+/*@}*/
+
 
 /**************************** Type Definitions *******************************/
 /**
@@ -397,6 +409,16 @@ typedef struct {
 				 * Parent base address */
 } XSpiPs_Config;
 
+/**
+ * This typedef describes one message of XSpiPs_TransferMsgs().
+ */
+typedef struct {
+	u8 *SendBufPtr;		/**< Buffer to send, must not be NULL */
+	u8 *RecvBufPtr;		/**< Buffer to receive, can be NULL */
+	u32 ByteCount;		/**< Number of bytes to send/receive */
+	u32 Flags;		/**< XSPIPS_MSG_* flags */
+} XSpiPs_Msg;
+
 /**
  * The XSpiPs driver instance data. The user is required to allocate a
  * variable of this type for every SPI device in the system. A pointer
@@ -417,6 +439,10 @@ typedef struct {
 	XSpiPs_StatusHandler StatusHandler;
 	void *StatusRef;  	 /**< Callback reference for status handler */
 
+	XSpiPs_Msg *MsgPtr;	 /**< Message being transferred (state) */
+	u32 RemainingMsgs;	 /**< Messages after MsgPtr (state) */
+	u32 TxThreshold;	 /**< TX FIFO level at which it is refilled */
+
 } XSpiPs;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -668,6 +694,8 @@ s32 XSpiPs_Transfer(XSpiPs *InstancePtr, u8 *SendBufPtr, u8 *RecvBufPtr,
 s32 XSpiPs_PolledTransfer(XSpiPs *InstancePtr, u8 *SendBufPtr,
 			  u8 *RecvBufPtr, u32 ByteCount);
 
+s32 XSpiPs_TransferMsgs(XSpiPs *InstancePtr, XSpiPs_Msg *Msgs, u32 NumMsgs);
+
 void XSpiPs_SetStatusHandler(XSpiPs *InstancePtr, void *CallBackRef,
 			     XSpiPs_StatusHandler FunctionPtr);
 void XSpiPs_InterruptHandler(XSpiPs *InstancePtr);
@@ -695,6 +723,9 @@ s32 XSpiPs_SetDelays(const XSpiPs *InstancePtr, u8 DelayNss, u8 DelayBtwn,
 		     u8 DelayAfter, u8 DelayInit);
 void XSpiPs_GetDelays(const XSpiPs *InstancePtr, u8 *DelayNss, u8 *DelayBtwn,
 		      u8 *DelayAfter, u8 *DelayInit);
+
+s32 XSpiPs_SetTxThreshold(XSpiPs *InstancePtr, u32 Threshold);
+u32 XSpiPs_GetTxThreshold(const XSpiPs *InstancePtr);
 #ifdef __cplusplus
 }
 #endif
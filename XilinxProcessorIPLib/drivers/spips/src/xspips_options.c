@@ -28,6 +28,7 @@
 * 3.2   aru    01/20/19 Fixes violations according to MISRAC-2012
 *                       in safety mode and done changes such as
 *                       Declared the pointer param as Pointer to const
+* 3.10  fl     10/14/26 Added XSpiPs_SetTxThreshold and XSpiPs_GetTxThreshold.
 * </pre>
 *
 ******************************************************************************/
@@ -406,4 +407,73 @@ void XSpiPs_GetDelays(const XSpiPs *InstancePtr,u8 *DelayNss, u8 *DelayBtwn,
 				XSPIPS_DR_NSS_SHIFT);
 
 }
+/*****************************************************************************/
+/**
+*
+* This function sets the TX FIFO level at which the interrupt handler and
+* the polled transfer refill the FIFO. With the default threshold of 1 the
+* FIFO is refilled once it is empty, so the bus stops while the received
+* bytes are read and new ones are written. A higher threshold refills the
+* FIFO while Threshold bytes are still queued, the bus keeps running as
+* long as the refill takes less time than sending them.
+*
+* @param	InstancePtr is a pointer to the XSpiPs instance.
+* @param	Threshold is the refill level, from 1 to XSPIPS_FIFO_DEPTH - 1.
+*
+* @return
+*		- XST_SUCCESS if the threshold is set.
+*		- XST_DEVICE_BUSY if a transfer is in progress.
+*
+* @note		The last FIFO of a transfer is always drained at threshold 1.
+*		A threshold of a quarter of the FIFO suits most clock rates.
+*
+******************************************************************************/
+s32 XSpiPs_SetTxThreshold(XSpiPs *InstancePtr, u32 Threshold)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid((Threshold > 0U) && (Threshold < XSPIPS_FIFO_DEPTH));
+
+	/*
+	 * Do not allow the threshold to change while a transfer is in
+	 * progress. Not thread-safe.
+	 */
+	if (InstancePtr->IsBusy == TRUE) {
+		Status = (s32)XST_DEVICE_BUSY;
+	} else {
+		InstancePtr->TxThreshold = Threshold;
+		/*
+		 * Transfers only program the watermark above 1, restore the
+		 * default for the ones that follow.
+		 */
+		if (Threshold == 1U) {
+			XSpiPs_SetTXWatermark(InstancePtr,
+				(XSPIPS_TXWR_RESET_VALUE & XSPIPS_TXWR_MASK));
+		}
+		Status = (s32)XST_SUCCESS;
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function gets the TX FIFO refill threshold.
+*
+* @param	InstancePtr is a pointer to the XSpiPs instance.
+*
+* @return	The threshold set with XSpiPs_SetTxThreshold(), 1 by default.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XSpiPs_GetTxThreshold(const XSpiPs *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	return InstancePtr->TxThreshold;
+}
 /** @} */
@@ -0,0 +1,501 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xsrio_msg_example.c
+ *
+ * This file demonstrates how to send and receive messages and doorbells with
+ * the messaging queues of the xsrio driver on the Xilinx SRIO Gen2 Core.
+ *
+ * Inorder to test this example external loopback is required at the board
+ * level between the SRIO Tx and Rx pins.
+ *
+ * H/W Requirments:
+ * The SRIO Initiator Request is connected to the MM2S channel and the SRIO
+ * Target Request to the S2MM channel of an AXI DMA in scatter gather mode,
+ * with a 64-bit stream interface.
+ *
+ * S/W Flow:
+ * 1) A TX queue and an RX queue are set up, whose submit function gives the
+ *    slots of the queue to the AXI DMA as one buffer descriptor each and
+ *    hands them to the hardware in one call.
+ * 2) The RX slots are given to the DMA.
+ * 3) NUM_DOORBELLS doorbells and a message of MSG_LENGTH bytes are queued
+ *    and given to the DMA with one flush.
+ * 4) The completed buffer descriptors are polled, the received packets are
+ *    dispatched to the doorbell handler, in batches, and to the message
+ *    handler, and compared with the ones sent.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.5   fl   10/14/26 Initial release
+ * </pre>
+ *
+ * ***************************************************************************
+ */
+
+/***************************** Include Files *********************************/
+#include "xparameters.h"
+#include "xil_printf.h"
+#include "xil_types.h"
+#include "xil_cache.h"
+#include "xstatus.h"
+#include "xsrio.h"
+#include "xaxidma.h"
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define SRIO_DEVICE_ID   XPAR_SRIO_0_DEVICE_ID
+#define DMA_DEV_ID       XPAR_AXIDMA_0_DEVICE_ID
+
+#define NUM_SLOTS	64	/* Slots per queue */
+#define SLOT_SIZE	(XSRIO_HELLO_HDR_SIZE + XSRIO_MSG_SEG_SIZE)
+#define NUM_DOORBELLS	40	/* More than one doorbell batch */
+#define MSG_LENGTH	600	/* Three segments */
+#define MSG_MBOX	1
+#define POLL_TIMEOUT	1000000
+
+/******************** Variable Definitions **********************************/
+XSrio Srio;		 /* Instance of the XSrio */
+XAxiDma AxiDma;          /* Instance of the XAxiDma */
+XSrio_MsgQueue TxQueue;	 /* Initiator request packets */
+XSrio_MsgQueue RxQueue;	 /* Target request packets */
+
+static u8 TxSlots[NUM_SLOTS * SLOT_SIZE] __attribute__ ((aligned(64)));
+static u8 RxSlots[NUM_SLOTS * SLOT_SIZE] __attribute__ ((aligned(64)));
+static u8 TxBdSpace[NUM_SLOTS * XAXIDMA_BD_MINIMUM_ALIGNMENT]
+			__attribute__ ((aligned(XAXIDMA_BD_MINIMUM_ALIGNMENT)));
+static u8 RxBdSpace[NUM_SLOTS * XAXIDMA_BD_MINIMUM_ALIGNMENT]
+			__attribute__ ((aligned(XAXIDMA_BD_MINIMUM_ALIGNMENT)));
+
+static u8 MsgSent[MSG_LENGTH];
+static u8 MsgReceived[XSRIO_MSG_MAX_SEGS * XSRIO_MSG_SEG_SIZE];
+static u32 MsgSegments;		/* Segments received */
+static u32 DoorbellCount;	/* Doorbells received */
+static u32 DoorbellBatches;	/* Calls of the doorbell handler */
+static int RxError;		/* Doorbell out of order */
+
+/******************** Function Prototypes ************************************/
+int XSrioMsgExample(XSrio *InstancePtr, u16 DeviceId);
+static int DmaRingSetup(XAxiDma_BdRing *RingPtr, UINTPTR BdSpace);
+static int DmaSubmit(void *CallbackRef, XSrio_MsgQueue *QueuePtr,
+		     u32 First, u32 Count);
+static int DmaComplete(XAxiDma_BdRing *RingPtr, u8 Direction);
+static void DoorbellHandler(void *CallbackRef, const u16 *Info, u32 Count);
+static void MessageHandler(void *CallbackRef,
+			   const XSrio_MsgSegment *SegmentPtr);
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* This function is the main entry of the SRIO messaging test.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if tests pass
+* 		- XST_FAILURE if fails.
+*
+* @note		None
+*
+******************************************************************************/
+int main()
+{
+	int Status;
+
+	xil_printf("Entering main\n\r");
+
+	Status = XSrioMsgExample(&Srio, SRIO_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("SRIO Messaging Test Failed\n\r");
+		xil_printf("--- Exiting main() ---\n\r");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran SRIO Messaging Test\n\r");
+	xil_printf("--- Exiting main() ---\n\r");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* XSrioMsgExample sends doorbells and a message through the external
+* loopback and checks that they are received.
+*
+* @param	InstancePtr is a pointer to the instance of the
+*		XSrio driver.
+* @param	DeviceId is Device ID of the SRIO Gen2 Device.
+*
+* @return
+*		-XST_SUCCESS to indicate success
+*		-XST_FAILURE to indicate failure
+*
+******************************************************************************/
+int XSrioMsgExample(XSrio *InstancePtr, u16 DeviceId)
+{
+	XSrio_Config *SrioConfig;
+	XAxiDma_Config *DmaConfig;
+	XAxiDma_BdRing *TxRingPtr;
+	XAxiDma_BdRing *RxRingPtr;
+	XSrio_MsgTemplate DbTemplate;
+	XSrio_MsgTemplate MsgTemplate;
+	int Status;
+	int Count;
+	int Done;
+	int Index;
+
+	SrioConfig = XSrio_LookupConfig(DeviceId);
+	if (!SrioConfig) {
+		xil_printf("No SRIO config found for %d\r\n", DeviceId);
+		return XST_FAILURE;
+	}
+
+	Status = XSrio_CfgInitialize(InstancePtr, SrioConfig,
+				SrioConfig->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Initialization failed for SRIO\n\r");
+		return Status;
+	}
+
+	/* Doorbells and messages are sent and received in the loopback */
+	if ((XSrio_IsOperationSupported(InstancePtr, XSRIO_OP_MODE_DOORBELL,
+					XSRIO_DIR_TX) != XST_SUCCESS) ||
+	    (XSrio_IsOperationSupported(InstancePtr, XSRIO_OP_MODE_DOORBELL,
+					XSRIO_DIR_RX) != XST_SUCCESS) ||
+	    (XSrio_IsOperationSupported(InstancePtr,
+			XSRIO_OP_MODE_DATA_MESSAGE, XSRIO_DIR_TX) != XST_SUCCESS) ||
+	    (XSrio_IsOperationSupported(InstancePtr,
+			XSRIO_OP_MODE_DATA_MESSAGE, XSRIO_DIR_RX) != XST_SUCCESS)) {
+		xil_printf("SRIO does not support messaging\n\r");
+		return XST_FAILURE;
+	}
+
+	XSrio_SetWaterMark(InstancePtr, 0x5, 0x4, 0x3);
+	XSrio_SetPortRespTimeOutValue(InstancePtr, 0x010203);
+
+	/* DMA Configuration */
+	DmaConfig = XAxiDma_LookupConfig(DMA_DEV_ID);
+	if (!DmaConfig) {
+		xil_printf("No DMA config found for %d\r\n", DMA_DEV_ID);
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_CfgInitialize(&AxiDma, DmaConfig);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Initialization failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+	if (!XAxiDma_HasSg(&AxiDma)) {
+		xil_printf("Device configured as Simple mode \r\n");
+		return XST_FAILURE;
+	}
+
+	TxRingPtr = XAxiDma_GetTxRing(&AxiDma);
+	RxRingPtr = XAxiDma_GetRxRing(&AxiDma);
+	if ((DmaRingSetup(TxRingPtr, (UINTPTR)TxBdSpace) != XST_SUCCESS) ||
+	    (DmaRingSetup(RxRingPtr, (UINTPTR)RxBdSpace) != XST_SUCCESS)) {
+		return XST_FAILURE;
+	}
+
+	/* Messaging queues on top of the DMA rings */
+	Status = XSrio_MsgQueueInit(&TxQueue, XSRIO_DIR_TX, (UINTPTR)TxSlots,
+				    SLOT_SIZE, NUM_SLOTS, DmaSubmit, TxRingPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	Status = XSrio_MsgQueueInit(&RxQueue, XSRIO_DIR_RX, (UINTPTR)RxSlots,
+				    SLOT_SIZE, NUM_SLOTS, DmaSubmit, RxRingPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	XSrio_MsgSetHandler(&RxQueue, XSRIO_MSG_HANDLER_DOORBELL,
+			    (void *)DoorbellHandler, NULL);
+	XSrio_MsgSetHandler(&RxQueue, XSRIO_MSG_HANDLER_MESSAGE,
+			    (void *)MessageHandler, NULL);
+
+	Status = XSrio_MsgRxStart(&RxQueue);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* Pre-built headers, only TID, size and info vary per packet */
+	XSrio_MsgTemplateInit(&DbTemplate, XSRIO_FTYPE_DOORBELL, 1, 0, 0, 0);
+	XSrio_MsgTemplateInit(&MsgTemplate, XSRIO_FTYPE_MESSAGE, 0, 0,
+			      MSG_MBOX, 0);
+
+	for (Index = 0; Index < NUM_DOORBELLS; Index++) {
+		Status = XSrio_DoorbellSend(&TxQueue, &DbTemplate, (u16)Index);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	for (Index = 0; Index < MSG_LENGTH; Index++) {
+		MsgSent[Index] = (u8)Index;
+	}
+	Status = XSrio_MsgSend(&TxQueue, &MsgTemplate, MsgSent, MSG_LENGTH);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* All the packets go to the DMA at once */
+	Status = XSrio_MsgFlush(&TxQueue);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Count = 0; Count < POLL_TIMEOUT; Count++) {
+		Done = DmaComplete(TxRingPtr, XSRIO_DIR_TX);
+		if (Done < 0) {
+			return XST_FAILURE;
+		}
+		XSrio_MsgTxDone(&TxQueue, Done);
+
+		Done = DmaComplete(RxRingPtr, XSRIO_DIR_RX);
+		if (Done < 0) {
+			return XST_FAILURE;
+		}
+		if (Done > 0) {
+			Status = XSrio_MsgRxProcess(&RxQueue, Done);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+		}
+
+		if ((DoorbellCount == NUM_DOORBELLS) &&
+		    (MsgSegments == (MSG_LENGTH + XSRIO_MSG_SEG_SIZE - 1) /
+					XSRIO_MSG_SEG_SIZE)) {
+			break;
+		}
+	}
+	if (Count == POLL_TIMEOUT) {
+		xil_printf("Timeout, %d doorbells and %d segments received\n\r",
+			   DoorbellCount, MsgSegments);
+		return XST_FAILURE;
+	}
+
+	/* Verifying the Data */
+	if (RxError || (RxQueue.Dropped != 0)) {
+		xil_printf("\n ERROR in Doorbells\n\r");
+		return XST_FAILURE;
+	}
+	for (Index = 0; Index < MSG_LENGTH; Index++) {
+		if (MsgReceived[Index] != MsgSent[Index]) {
+			xil_printf("\n ERROR in Message\n\r");
+			return XST_FAILURE;
+		}
+	}
+
+	xil_printf("%d doorbells in %d batches, %d message segments\n\r",
+		   DoorbellCount, DoorbellBatches, MsgSegments);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Create a buffer descriptor ring of NUM_SLOTS descriptors and start it.
+*
+* @param	RingPtr is a pointer to the ring of the channel.
+* @param	BdSpace is the memory of the buffer descriptors.
+*
+* @return
+*		-XST_SUCCESS to indicate success
+*		-XST_FAILURE to indicate failure
+*
+******************************************************************************/
+static int DmaRingSetup(XAxiDma_BdRing *RingPtr, UINTPTR BdSpace)
+{
+	XAxiDma_Bd BdTemplate;
+	int Status;
+
+	XAxiDma_BdRingIntDisable(RingPtr, XAXIDMA_IRQ_ALL_MASK);
+
+	Status = XAxiDma_BdRingCreate(RingPtr, BdSpace, BdSpace,
+				      XAXIDMA_BD_MINIMUM_ALIGNMENT, NUM_SLOTS);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Create BD ring failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdClear(&BdTemplate);
+	Status = XAxiDma_BdRingClone(RingPtr, &BdTemplate);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Clone BD failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingStart(RingPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Start hw failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Submit function of the queues. The slots are given to the ring of the
+* queue, one buffer descriptor per packet, in one call to the hardware.
+*
+* @param	CallbackRef is the ring of the queue.
+* @param	QueuePtr is a pointer to the messaging queue.
+* @param	First is the index of the first slot.
+* @param	Count is the number of slots.
+*
+* @return
+*		-XST_SUCCESS to indicate success
+*		-XST_FAILURE to indicate failure
+*
+******************************************************************************/
+static int DmaSubmit(void *CallbackRef, XSrio_MsgQueue *QueuePtr,
+		     u32 First, u32 Count)
+{
+	XAxiDma_BdRing *RingPtr = (XAxiDma_BdRing *)CallbackRef;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	UINTPTR Addr;
+	u32 Length;
+	u32 Index;
+	int Status;
+
+	Status = XAxiDma_BdRingAlloc(RingPtr, Count, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	BdCurPtr = BdPtr;
+	for (Index = First; Index != First + Count; Index++) {
+		Addr = XSrio_MsgSlotAddr(QueuePtr, Index);
+		Length = XSrio_MsgSlotLength(QueuePtr, Index);
+
+		if (QueuePtr->Direction == XSRIO_DIR_TX) {
+			Xil_DCacheFlushRange(Addr, Length);
+			XAxiDma_BdSetCtrl(BdCurPtr, XAXIDMA_BD_CTRL_TXSOF_MASK |
+					  XAXIDMA_BD_CTRL_TXEOF_MASK);
+		} else {
+			Xil_DCacheInvalidateRange(Addr, Length);
+			XAxiDma_BdSetCtrl(BdCurPtr, 0);
+		}
+
+		if ((XAxiDma_BdSetBufAddr(BdCurPtr, Addr) != XST_SUCCESS) ||
+		    (XAxiDma_BdSetLength(BdCurPtr, Length,
+					 RingPtr->MaxTransferLen) !=
+				XST_SUCCESS)) {
+			XAxiDma_BdRingUnAlloc(RingPtr, Count, BdPtr);
+			return XST_FAILURE;
+		}
+
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr, BdCurPtr);
+	}
+
+	Status = XAxiDma_BdRingToHw(RingPtr, Count, BdPtr);
+	if (Status != XST_SUCCESS) {
+		XAxiDma_BdRingUnAlloc(RingPtr, Count, BdPtr);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Take the completed buffer descriptors of a ring back from the hardware and
+* free them.
+*
+* @param	RingPtr is a pointer to the ring of the channel.
+* @param	Direction is XSRIO_DIR_TX or XSRIO_DIR_RX.
+*
+* @return	Number of slots completed, or -1 if freeing the descriptors
+*		failed.
+*
+******************************************************************************/
+static int DmaComplete(XAxiDma_BdRing *RingPtr, u8 Direction)
+{
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	int Count;
+	int Index;
+
+	Count = XAxiDma_BdRingFromHw(RingPtr, XAXIDMA_ALL_BDS, &BdPtr);
+	if (Count == 0) {
+		return 0;
+	}
+
+	/* Received data is read by the processor after the DMA wrote it */
+	if (Direction == XSRIO_DIR_RX) {
+		BdCurPtr = BdPtr;
+		for (Index = 0; Index < Count; Index++) {
+			Xil_DCacheInvalidateRange(XAxiDma_BdGetBufAddr(BdCurPtr),
+						  SLOT_SIZE);
+			BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr,
+								   BdCurPtr);
+		}
+	}
+
+	if (XAxiDma_BdRingFree(RingPtr, Count, BdPtr) != XST_SUCCESS) {
+		return -1;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+* Doorbell handler, the doorbells are expected in the order they were sent.
+*
+* @param	CallbackRef is not used.
+* @param	Info is the array of the info fields of the doorbells.
+* @param	Count is the number of doorbells.
+*
+* @return	None.
+*
+******************************************************************************/
+static void DoorbellHandler(void *CallbackRef, const u16 *Info, u32 Count)
+{
+	u32 Index;
+
+	(void)CallbackRef;
+
+	for (Index = 0; Index < Count; Index++) {
+		if (Info[Index] != DoorbellCount) {
+			RxError = 1;
+		}
+		DoorbellCount++;
+	}
+	DoorbellBatches++;
+}
+
+/*****************************************************************************/
+/**
+* Message handler, the segments are copied to their place in MsgReceived.
+*
+* @param	CallbackRef is not used.
+* @param	SegmentPtr is a pointer to the received segment.
+*
+* @return	None.
+*
+******************************************************************************/
+static void MessageHandler(void *CallbackRef,
+			   const XSrio_MsgSegment *SegmentPtr)
+{
+	(void)CallbackRef;
+
+	if (SegmentPtr->Mbox == MSG_MBOX) {
+		memcpy(&MsgReceived[SegmentPtr->Segment * XSRIO_MSG_SEG_SIZE],
+		       SegmentPtr->Data, SegmentPtr->Length);
+		MsgSegments++;
+	}
+}
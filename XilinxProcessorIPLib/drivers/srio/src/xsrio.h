@@ -46,10 +46,41 @@
 * <b>Interrupts</b>
 * There are no interrupts available for the SRIO Gen2 Core.
 *
+* <b>Messaging</b>
+*
+* Messages and doorbells are sent and received as HELLO packets on the
+* AXI4-Stream ports of the core, moved to and from memory by a DMA engine,
+* typically an AXI DMA or AXI MCDMA in scatter gather mode. The functions in
+* xsrio_msg.c keep the packets in queues of fixed size slots in DMA capable
+* memory, one XSrio_MsgQueue for the initiator request port and one for the
+* target request port:
+*
+* - XSrio_MsgTemplateInit() builds the header fields that are the same for
+*   every packet of a mailbox or of the doorbells, so that only the
+*   transaction ID, size and segment or info fields are filled in per packet.
+* - XSrio_MsgSend() and XSrio_DoorbellSend() write packets into the slots of
+*   a TX queue, XSrio_MsgFlush() gives all the new ones to the DMA in one call
+*   of the submit function of the queue, and XSrio_MsgTxDone() frees the
+*   slots the DMA has completed.
+* - XSrio_MsgRxStart() gives the slots of an RX queue to the DMA, and
+*   XSrio_MsgRxProcess() dispatches the packets received in them. Messages
+*   are passed to the message handler one segment at a time, doorbells are
+*   collected and passed to the doorbell handler up to
+*   XSRIO_MSG_DB_BATCH at a time. The slots are then given back to the DMA
+*   in one call.
+*
+* The driver does not depend on a DMA driver. The submit function gives a
+* run of slots to the DMA and is written by the application, see
+* xsrio_msg_example.c for one on top of the AXI DMA driver. It is also
+* responsible for the cache maintenance of the slots. The destination and
+* source IDs of a packet are carried on TUSER of the stream ports, not in the
+* slots.
+*
 * <b> Examples </b>
 *
-* There is an example provided to show the usage of the APIs
+* There are examples provided to show the usage of the APIs
 * - SRIO Dma loopback example (xsrio_dma_loopback_example.c)
+* - SRIO Messaging example (xsrio_msg_example.c)
 *
 * <b> Asserts </b>
 *
@@ -86,6 +117,7 @@
 * 1.4   mus  09/02/20 Updated makefile to support parallel make and
 *                     incremental builds. It would help to reduce compilation
 *                     time
+* 1.5   fl   10/14/26 Added messaging and doorbell queues in xsrio_msg.c
 * </pre>
 ******************************************************************************/
 
@@ -144,6 +176,24 @@ extern "C" {
 #define XSRIO_DIR_TX		1 /**< Transmit Direction Flag */ 
 #define XSRIO_DIR_RX		2 /**< Receive Direction Flag */
 
+/* Messaging queue limits */
+#define XSRIO_MSG_MAX_SLOTS	64  /**< Maximum slots of a queue */
+#define XSRIO_MSG_SEG_SIZE	256 /**< Maximum payload of a message
+				     * segment
+				     */
+#define XSRIO_MSG_MAX_SEGS	16  /**< Maximum segments of a message */
+#define XSRIO_MSG_DB_BATCH	32  /**< Doorbells passed to the doorbell
+				     * handler at a time
+				     */
+
+/* Messaging queue handler types */
+#define XSRIO_MSG_HANDLER_DOORBELL	1 /**< Handler for received
+					   * doorbells
+					   */
+#define XSRIO_MSG_HANDLER_MESSAGE	2 /**< Handler for received message
+					   * segments
+					   */
+
 /************************** Type Definitions *****************************/
 
 /**
@@ -163,6 +213,84 @@ typedef struct XSrio {
 	int IsReady;	       /**< Device is initialized and ready */	
 	int PortWidth;	       /**< Serial lane Port width (1x or 2x or 4x) */
 } XSrio;
+
+/**
+ * Header fields shared by the packets of a mailbox or of the doorbells,
+ * built by XSrio_MsgTemplateInit().
+ */
+typedef struct XSrio_MsgTemplate {
+	u32 Upper;	/**< Upper header word, without TID and size */
+	u32 Lower;	/**< Lower header word, without segment or info */
+} XSrio_MsgTemplate;
+
+/**
+ * A received message segment, passed to the message handler.
+ */
+typedef struct XSrio_MsgSegment {
+	u8 Mbox;		/**< Mailbox */
+	u8 Letter;		/**< Letter */
+	u8 Segment;		/**< Segment of the message, from 0 */
+	u8 NumSegments;		/**< Segments of the message */
+	u32 Length;		/**< Payload bytes of the segment */
+	const u8 *Data;		/**< Payload, valid until the handler returns */
+} XSrio_MsgSegment;
+
+struct XSrio_MsgQueue;
+
+/**
+ * Function that gives the slots First to First + Count - 1 of a queue to the
+ * DMA, each of XSrio_MsgSlotLength() bytes at XSrio_MsgSlotAddr(). It
+ * returns XST_SUCCESS or XST_FAILURE if the slots could not be given.
+ */
+typedef int (*XSrio_MsgSubmitFunc)(void *CallbackRef,
+				   struct XSrio_MsgQueue *QueuePtr,
+				   u32 First, u32 Count);
+
+/**
+ * Handler of the received doorbells, called with the info fields of up to
+ * XSRIO_MSG_DB_BATCH doorbells in the order of reception.
+ */
+typedef void (*XSrio_DoorbellHandler)(void *CallbackRef, const u16 *Info,
+				      u32 Count);
+
+/**
+ * Handler of a received message segment.
+ */
+typedef void (*XSrio_MessageHandler)(void *CallbackRef,
+				     const XSrio_MsgSegment *SegmentPtr);
+
+/**
+ * A queue of message and doorbell packets. The slot indices are free
+ * running, slot Index is at Index % NumSlots in the slot memory.
+ */
+typedef struct XSrio_MsgQueue {
+	UINTPTR BaseAddr;	/**< Slot memory, DMA capable */
+	u32 SlotSize;		/**< Bytes per slot */
+	u32 NumSlots;		/**< Slots of the queue */
+	u8 Direction;		/**< XSRIO_DIR_TX or XSRIO_DIR_RX */
+	u8 NextTid;		/**< Transaction ID of the next packet */
+	u32 Head;		/**< TX: slots filled, RX: slots processed */
+	u32 Submitted;		/**< Slots given to the DMA */
+	u32 Tail;		/**< TX: slots completed by the DMA */
+	u16 Length[XSRIO_MSG_MAX_SLOTS]; /**< Bytes to move per slot */
+
+	XSrio_MsgSubmitFunc SubmitFunc;	/**< Gives slots to the DMA */
+	void *SubmitRef;		/**< To be passed to SubmitFunc */
+	XSrio_DoorbellHandler DoorbellHandler; /**< Received doorbells */
+	void *DoorbellRef;		/**< To be passed to DoorbellHandler */
+	XSrio_MessageHandler MessageHandler; /**< Received segments */
+	void *MessageRef;		/**< To be passed to MessageHandler */
+
+	u16 DoorbellInfo[XSRIO_MSG_DB_BATCH]; /**< Doorbells not yet passed
+					       * to the handler
+					       */
+	u32 NumDoorbells;	/**< Entries of DoorbellInfo */
+
+	u32 Packets;		/**< Packets sent or received */
+	u32 Dropped;		/**< Received packets of other format types or
+				 * with a size beyond the slot
+				 */
+} XSrio_MsgQueue;
 	
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -1513,6 +1641,59 @@ typedef struct XSrio {
 	(XSrio_ReadReg((InstancePtr)->Config.BaseAddress,	\
 	     XSRIO_PORT_N_CTL_CSR_OFFSET) & \
 	     XSRIO_PORT_N_CTL_CSR_STATUS_ALL_MASK) 
+
+/****************************************************************************/
+/**
+*
+* XSrio_MsgSlotAddr returns the address of a slot of a messaging queue.
+*
+* @param        QueuePtr is a pointer to the messaging queue.
+* @param	Index is the free running index of the slot.
+*
+* @return	Address of the slot.
+*
+* @note         C-style signature:
+*               UINTPTR XSrio_MsgSlotAddr(XSrio_MsgQueue *QueuePtr, u32 Index)
+*
+*****************************************************************************/
+#define XSrio_MsgSlotAddr(QueuePtr, Index)	\
+	((QueuePtr)->BaseAddr +	\
+	 (UINTPTR)(((Index) % (QueuePtr)->NumSlots) * (QueuePtr)->SlotSize))
+
+/****************************************************************************/
+/**
+*
+* XSrio_MsgSlotLength returns the number of bytes the DMA moves for a slot
+* of a messaging queue, the packet length for a TX queue and the slot size
+* for an RX queue.
+*
+* @param        QueuePtr is a pointer to the messaging queue.
+* @param	Index is the free running index of the slot.
+*
+* @return	Bytes to move.
+*
+* @note         C-style signature:
+*               u32 XSrio_MsgSlotLength(XSrio_MsgQueue *QueuePtr, u32 Index)
+*
+*****************************************************************************/
+#define XSrio_MsgSlotLength(QueuePtr, Index)	\
+	((u32)(QueuePtr)->Length[(Index) % (QueuePtr)->NumSlots])
+
+/****************************************************************************/
+/**
+*
+* XSrio_MsgTxFree returns the number of free slots of a TX messaging queue.
+*
+* @param        QueuePtr is a pointer to the messaging queue.
+*
+* @return	Free slots.
+*
+* @note         C-style signature:
+*               u32 XSrio_MsgTxFree(XSrio_MsgQueue *QueuePtr)
+*
+*****************************************************************************/
+#define XSrio_MsgTxFree(QueuePtr)	\
+	((QueuePtr)->NumSlots - ((QueuePtr)->Head - (QueuePtr)->Tail))
 	     
 /*************************** Function Prototypes ******************************/
 /**
@@ -1528,6 +1709,26 @@ void XSrio_SetWaterMark(XSrio *InstancePtr, u8 WaterMark0, u8 WaterMark1,
 					u8 WaterMark2);
 void XSrio_GetWaterMark(XSrio *InstancePtr, u8 *WaterMark0, u8 *WaterMark1,
 					u8 *WaterMark2);
+
+/**
+ * Messaging and doorbell functions in xsrio_msg.c
+ */
+int XSrio_MsgQueueInit(XSrio_MsgQueue *QueuePtr, u8 Direction,
+		       UINTPTR BaseAddr, u32 SlotSize, u32 NumSlots,
+		       XSrio_MsgSubmitFunc SubmitFunc, void *SubmitRef);
+int XSrio_MsgSetHandler(XSrio_MsgQueue *QueuePtr, u32 HandlerType,
+			void *CallbackFunc, void *CallbackRef);
+void XSrio_MsgTemplateInit(XSrio_MsgTemplate *TemplatePtr, u8 Ftype,
+			   u8 Prio, u8 Crf, u8 Mbox, u8 Letter);
+int XSrio_MsgSend(XSrio_MsgQueue *QueuePtr,
+		  const XSrio_MsgTemplate *TemplatePtr,
+		  const void *Data, u32 Length);
+int XSrio_DoorbellSend(XSrio_MsgQueue *QueuePtr,
+		       const XSrio_MsgTemplate *TemplatePtr, u16 Info);
+int XSrio_MsgFlush(XSrio_MsgQueue *QueuePtr);
+void XSrio_MsgTxDone(XSrio_MsgQueue *QueuePtr, u32 Count);
+int XSrio_MsgRxStart(XSrio_MsgQueue *QueuePtr);
+int XSrio_MsgRxProcess(XSrio_MsgQueue *QueuePtr, u32 Count);
 			
 #ifdef __cplusplus
 }
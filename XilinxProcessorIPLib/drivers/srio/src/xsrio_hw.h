@@ -21,6 +21,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- --------------------------------------------------------- 
 * 1.0   adk  16/04/14 Initial release.
+* 1.5   fl   10/14/26 Added the HELLO packet header definitions.
 * 
 ******************************************************************************/
 
@@ -603,6 +604,56 @@ extern "C" {
 
 /*@}*/
 
+/** @name HELLO packet header definitions.
+ *  The 64-bit header that starts a HELLO packet on the AXI4-Stream ports,
+ *  stored in memory as its lower word followed by its upper word.
+ * @{
+ */
+#define XSRIO_HELLO_HDR_LOWER_OFFSET	0x0 /**< Lower word of the header */
+#define XSRIO_HELLO_HDR_UPPER_OFFSET	0x4 /**< Upper word of the header */
+#define XSRIO_HELLO_HDR_SIZE		8   /**< Header bytes */
+
+#define XSRIO_HELLO_TID_MASK		0xFF000000 /**< Transaction ID Mask */
+#define XSRIO_HELLO_FTYPE_MASK		0x00F00000 /**< Format Type Mask */
+#define XSRIO_HELLO_TTYPE_MASK		0x000F0000 /**< Transaction Type
+						    * Mask
+						    */
+#define XSRIO_HELLO_PRIO_MASK		0x00006000 /**< Priority Mask */
+#define XSRIO_HELLO_CRF_MASK		0x00001000 /**< CRF Mask */
+#define XSRIO_HELLO_SIZE_MASK		0x00000FF0 /**< Size (bytes - 1)
+						    * Mask
+						    */
+#define XSRIO_HELLO_TID_SHIFT		24
+#define XSRIO_HELLO_FTYPE_SHIFT		20
+#define XSRIO_HELLO_TTYPE_SHIFT		16
+#define XSRIO_HELLO_PRIO_SHIFT		13
+#define XSRIO_HELLO_CRF_SHIFT		12
+#define XSRIO_HELLO_SIZE_SHIFT		4
+
+#define XSRIO_HELLO_DB_INFO_MASK	0xFFFF0000 /**< Doorbell Info Mask,
+						    * lower word
+						    */
+#define XSRIO_HELLO_MSG_MBOX_MASK	0x0000003F /**< Message Mailbox Mask,
+						    * lower word
+						    */
+#define XSRIO_HELLO_MSG_LETTER_MASK	0x000000C0 /**< Message Letter Mask,
+						    * lower word
+						    */
+#define XSRIO_HELLO_MSG_SEG_MASK	0x00000F00 /**< Message Segment Mask,
+						    * lower word
+						    */
+#define XSRIO_HELLO_MSG_LEN_MASK	0x0000F000 /**< Message Length (segments
+						    * - 1) Mask, lower word
+						    */
+#define XSRIO_HELLO_DB_INFO_SHIFT	16
+#define XSRIO_HELLO_MSG_LETTER_SHIFT	6
+#define XSRIO_HELLO_MSG_SEG_SHIFT	8
+#define XSRIO_HELLO_MSG_LEN_SHIFT	12
+
+#define XSRIO_FTYPE_DOORBELL		0xA	/**< Doorbell Format Type */
+#define XSRIO_FTYPE_MESSAGE		0xB	/**< Message Format Type */
+/*@}*/
+
 /****************** Macros (Inline Functions) Definitions ********************/
 /*****************************************************************************/
 /**
@@ -0,0 +1,564 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsrio_msg.c
+* @addtogroup srio_v1_4
+* @{
+* This file contains the messaging and doorbell queues of the XSrio driver.
+* The packets are HELLO packets in fixed size slots of DMA capable memory,
+* the DMA engine is driven by the submit function of the queue. See the
+* xsrio.h header file for an overview.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.5   fl   10/14/26 First release
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xsrio.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XSRIO_MSG_ALIGN		8U	/**< Slot and payload alignment */
+
+/************************** Function Prototypes ******************************/
+
+static void XSrio_MsgPutHeader(XSrio_MsgQueue *QueuePtr, UINTPTR Slot,
+			       const XSrio_MsgTemplate *TemplatePtr,
+			       u32 Size, u32 Lower);
+static void XSrio_MsgDoorbellBatch(XSrio_MsgQueue *QueuePtr);
+
+/*****************************************************************************/
+/**
+* Initialize a messaging queue.
+*
+* A TX queue holds the packets sent on the initiator request port, an RX
+* queue the packets received on the target request port. The slots are
+* given to the DMA engine through SubmitFunc.
+*
+* @param	QueuePtr is a pointer to the messaging queue to initialize.
+* @param	Direction is XSRIO_DIR_TX or XSRIO_DIR_RX.
+* @param	BaseAddr is the address of the slot memory, NumSlots * SlotSize
+*		bytes of DMA capable memory aligned to 8 bytes.
+* @param	SlotSize is the size of a slot in bytes, a multiple of 8. A slot
+*		holds one packet, the 8 byte header and up to
+*		XSRIO_MSG_SEG_SIZE bytes of payload.
+* @param	NumSlots is the number of slots, a power of two of at most
+*		XSRIO_MSG_MAX_SLOTS, so that the free running slot indices
+*		wrap with the ring.
+* @param	SubmitFunc is the function that gives slots to the DMA.
+* @param	SubmitRef is passed to SubmitFunc.
+*
+* @return
+*		- XST_SUCCESS if the queue is initialized.
+*		- XST_INVALID_PARAM if the memory or slots are not valid.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XSrio_MsgQueueInit(XSrio_MsgQueue *QueuePtr, u8 Direction,
+		       UINTPTR BaseAddr, u32 SlotSize, u32 NumSlots,
+		       XSrio_MsgSubmitFunc SubmitFunc, void *SubmitRef)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid((Direction == XSRIO_DIR_TX) ||
+			  (Direction == XSRIO_DIR_RX));
+	Xil_AssertNonvoid(SubmitFunc != NULL);
+
+	if ((BaseAddr & (XSRIO_MSG_ALIGN - 1U)) ||
+	    (SlotSize < XSRIO_HELLO_HDR_SIZE) || (SlotSize > 0xFFFFU) ||
+	    (SlotSize & (XSRIO_MSG_ALIGN - 1U)) ||
+	    (NumSlots == 0U) || (NumSlots > XSRIO_MSG_MAX_SLOTS) ||
+	    (NumSlots & (NumSlots - 1U))) {
+		return XST_INVALID_PARAM;
+	}
+
+	memset(QueuePtr, 0, sizeof(XSrio_MsgQueue));
+	QueuePtr->BaseAddr = BaseAddr;
+	QueuePtr->SlotSize = SlotSize;
+	QueuePtr->NumSlots = NumSlots;
+	QueuePtr->Direction = Direction;
+	QueuePtr->SubmitFunc = SubmitFunc;
+	QueuePtr->SubmitRef = SubmitRef;
+
+	/* RX slots are always received into in full */
+	if (Direction == XSRIO_DIR_RX) {
+		for (Index = 0U; Index < NumSlots; Index++) {
+			QueuePtr->Length[Index] = (u16)SlotSize;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Install a handler of the packets received in an RX messaging queue.
+*
+* HandlerType                     Callback Function Type
+* ------------------------------- -------------------------------------
+* XSRIO_MSG_HANDLER_DOORBELL      XSrio_DoorbellHandler
+* XSRIO_MSG_HANDLER_MESSAGE       XSrio_MessageHandler
+*
+* @param	QueuePtr is a pointer to the messaging queue.
+* @param	HandlerType specifies the type of handler.
+* @param	CallbackFunc is the address of the handler function.
+* @param	CallbackRef is passed back to the handler when it is called.
+*
+* @return
+*		- XST_SUCCESS if the handler is installed.
+*		- XST_INVALID_PARAM if HandlerType is not valid.
+*
+* @note		Packets without a handler are counted and dropped.
+*
+*****************************************************************************/
+int XSrio_MsgSetHandler(XSrio_MsgQueue *QueuePtr, u32 HandlerType,
+			void *CallbackFunc, void *CallbackRef)
+{
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(CallbackFunc != NULL);
+
+	switch (HandlerType) {
+		case XSRIO_MSG_HANDLER_DOORBELL:
+			QueuePtr->DoorbellHandler =
+				(XSrio_DoorbellHandler)CallbackFunc;
+			QueuePtr->DoorbellRef = CallbackRef;
+			break;
+		case XSRIO_MSG_HANDLER_MESSAGE:
+			QueuePtr->MessageHandler =
+				(XSrio_MessageHandler)CallbackFunc;
+			QueuePtr->MessageRef = CallbackRef;
+			break;
+		default:
+			return XST_INVALID_PARAM;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Build the header template of the messages of a mailbox or of doorbells.
+*
+* @param	TemplatePtr is a pointer to the template to build.
+* @param	Ftype is XSRIO_FTYPE_MESSAGE or XSRIO_FTYPE_DOORBELL.
+* @param	Prio is the priority of the packets, 0 to 2.
+* @param	Crf is the CRF bit of the packets.
+* @param	Mbox is the mailbox of the messages, ignored for doorbells.
+* @param	Letter is the letter of the messages, ignored for doorbells.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XSrio_MsgTemplateInit(XSrio_MsgTemplate *TemplatePtr, u8 Ftype,
+			   u8 Prio, u8 Crf, u8 Mbox, u8 Letter)
+{
+	Xil_AssertVoid(TemplatePtr != NULL);
+	Xil_AssertVoid((Ftype == XSRIO_FTYPE_MESSAGE) ||
+		       (Ftype == XSRIO_FTYPE_DOORBELL));
+	Xil_AssertVoid(Prio < 3);
+
+	TemplatePtr->Upper = (((u32)Ftype << XSRIO_HELLO_FTYPE_SHIFT) &
+				XSRIO_HELLO_FTYPE_MASK) |
+			     (((u32)Prio << XSRIO_HELLO_PRIO_SHIFT) &
+				XSRIO_HELLO_PRIO_MASK) |
+			     (((u32)Crf << XSRIO_HELLO_CRF_SHIFT) &
+				XSRIO_HELLO_CRF_MASK);
+
+	if (Ftype == XSRIO_FTYPE_MESSAGE) {
+		TemplatePtr->Lower = ((u32)Mbox & XSRIO_HELLO_MSG_MBOX_MASK) |
+				     (((u32)Letter <<
+					XSRIO_HELLO_MSG_LETTER_SHIFT) &
+					XSRIO_HELLO_MSG_LETTER_MASK);
+	} else {
+		TemplatePtr->Lower = 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* Write a message into the slots of a TX messaging queue.
+*
+* The message is split into segments of XSRIO_MSG_SEG_SIZE bytes, one per
+* slot, the last segment is padded with zeros to a multiple of 8 bytes. The
+* packets are given to the DMA by the next XSrio_MsgFlush().
+*
+* @param	QueuePtr is a pointer to the TX messaging queue.
+* @param	TemplatePtr is a pointer to the template of the mailbox.
+* @param	Data is a pointer to the message.
+* @param	Length is the length of the message in bytes, 1 to
+*		XSRIO_MSG_MAX_SEGS * XSRIO_MSG_SEG_SIZE.
+*
+* @return
+*		- XST_SUCCESS if the message is queued.
+*		- XST_DEVICE_BUSY if there are not enough free slots.
+*		- XST_INVALID_PARAM if the message is empty, too long or does
+*		  not fit in a slot.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XSrio_MsgSend(XSrio_MsgQueue *QueuePtr,
+		  const XSrio_MsgTemplate *TemplatePtr,
+		  const void *Data, u32 Length)
+{
+	const u8 *Src = (const u8 *)Data;
+	u32 NumSegs;
+	u32 SegLen;
+	u32 Padded;
+	u32 Seg;
+	u32 Lower;
+	UINTPTR Slot;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->Direction == XSRIO_DIR_TX);
+	Xil_AssertNonvoid(TemplatePtr != NULL);
+	Xil_AssertNonvoid(Data != NULL);
+
+	if ((Length == 0U) ||
+	    (Length > (XSRIO_MSG_MAX_SEGS * XSRIO_MSG_SEG_SIZE))) {
+		return XST_INVALID_PARAM;
+	}
+
+	NumSegs = (Length + XSRIO_MSG_SEG_SIZE - 1U) / XSRIO_MSG_SEG_SIZE;
+	SegLen = (NumSegs > 1U) ? XSRIO_MSG_SEG_SIZE : Length;
+	Padded = (SegLen + XSRIO_MSG_ALIGN - 1U) & ~(XSRIO_MSG_ALIGN - 1U);
+	if ((XSRIO_HELLO_HDR_SIZE + Padded) > QueuePtr->SlotSize) {
+		return XST_INVALID_PARAM;
+	}
+	if (XSrio_MsgTxFree(QueuePtr) < NumSegs) {
+		return XST_DEVICE_BUSY;
+	}
+
+	for (Seg = 0U; Seg < NumSegs; Seg++) {
+		SegLen = (Length > XSRIO_MSG_SEG_SIZE) ?
+				XSRIO_MSG_SEG_SIZE : Length;
+		Padded = (SegLen + XSRIO_MSG_ALIGN - 1U) &
+				~(XSRIO_MSG_ALIGN - 1U);
+
+		Slot = XSrio_MsgSlotAddr(QueuePtr, QueuePtr->Head);
+		Lower = TemplatePtr->Lower |
+			((Seg << XSRIO_HELLO_MSG_SEG_SHIFT) &
+				XSRIO_HELLO_MSG_SEG_MASK) |
+			(((NumSegs - 1U) << XSRIO_HELLO_MSG_LEN_SHIFT) &
+				XSRIO_HELLO_MSG_LEN_MASK);
+		XSrio_MsgPutHeader(QueuePtr, Slot, TemplatePtr, Padded, Lower);
+
+		memcpy((void *)(Slot + XSRIO_HELLO_HDR_SIZE), Src, SegLen);
+		if (Padded != SegLen) {
+			memset((void *)(Slot + XSRIO_HELLO_HDR_SIZE + SegLen),
+			       0, Padded - SegLen);
+		}
+
+		QueuePtr->Length[QueuePtr->Head % QueuePtr->NumSlots] =
+			(u16)(XSRIO_HELLO_HDR_SIZE + Padded);
+		QueuePtr->Head++;
+
+		Src += SegLen;
+		Length -= SegLen;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Write a doorbell into a slot of a TX messaging queue. The packet is given
+* to the DMA by the next XSrio_MsgFlush().
+*
+* @param	QueuePtr is a pointer to the TX messaging queue.
+* @param	TemplatePtr is a pointer to the doorbell template.
+* @param	Info is the info field of the doorbell.
+*
+* @return
+*		- XST_SUCCESS if the doorbell is queued.
+*		- XST_DEVICE_BUSY if there is no free slot.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XSrio_DoorbellSend(XSrio_MsgQueue *QueuePtr,
+		       const XSrio_MsgTemplate *TemplatePtr, u16 Info)
+{
+	UINTPTR Slot;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->Direction == XSRIO_DIR_TX);
+	Xil_AssertNonvoid(TemplatePtr != NULL);
+
+	if (XSrio_MsgTxFree(QueuePtr) == 0U) {
+		return XST_DEVICE_BUSY;
+	}
+
+	Slot = XSrio_MsgSlotAddr(QueuePtr, QueuePtr->Head);
+	XSrio_MsgPutHeader(QueuePtr, Slot, TemplatePtr, 0U,
+			   ((u32)Info << XSRIO_HELLO_DB_INFO_SHIFT) &
+				XSRIO_HELLO_DB_INFO_MASK);
+
+	QueuePtr->Length[QueuePtr->Head % QueuePtr->NumSlots] =
+		XSRIO_HELLO_HDR_SIZE;
+	QueuePtr->Head++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Give the packets queued since the last flush to the DMA, in one call of
+* the submit function of the queue.
+*
+* @param	QueuePtr is a pointer to the TX messaging queue.
+*
+* @return
+*		- XST_SUCCESS if the packets were given to the DMA or there
+*		  were none.
+*		- XST_FAILURE if the submit function failed, the packets stay
+*		  queued for the next flush.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XSrio_MsgFlush(XSrio_MsgQueue *QueuePtr)
+{
+	u32 Count;
+	int Status;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->Direction == XSRIO_DIR_TX);
+
+	Count = QueuePtr->Head - QueuePtr->Submitted;
+	if (Count == 0U) {
+		return XST_SUCCESS;
+	}
+
+	Status = QueuePtr->SubmitFunc(QueuePtr->SubmitRef, QueuePtr,
+				      QueuePtr->Submitted, Count);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	QueuePtr->Submitted += Count;
+	QueuePtr->Packets += Count;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Free the slots of a TX messaging queue the DMA has completed, called with
+* the number of packets completed, in the order they were submitted.
+*
+* @param	QueuePtr is a pointer to the TX messaging queue.
+* @param	Count is the number of packets completed.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XSrio_MsgTxDone(XSrio_MsgQueue *QueuePtr, u32 Count)
+{
+	Xil_AssertVoid(QueuePtr != NULL);
+	Xil_AssertVoid(QueuePtr->Direction == XSRIO_DIR_TX);
+	Xil_AssertVoid(Count <= (QueuePtr->Submitted - QueuePtr->Tail));
+
+	QueuePtr->Tail += Count;
+}
+
+/*****************************************************************************/
+/**
+* Give the slots of an RX messaging queue that are not with the DMA to the
+* DMA, in one call of the submit function. It is called once to start
+* reception, and again after XSrio_MsgRxProcess() could not give the
+* processed slots back.
+*
+* @param	QueuePtr is a pointer to the RX messaging queue.
+*
+* @return
+*		- XST_SUCCESS if the slots were given to the DMA.
+*		- XST_FAILURE if the submit function failed.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XSrio_MsgRxStart(XSrio_MsgQueue *QueuePtr)
+{
+	u32 Count;
+	int Status;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->Direction == XSRIO_DIR_RX);
+
+	Count = QueuePtr->NumSlots - (QueuePtr->Submitted - QueuePtr->Head);
+	if (Count == 0U) {
+		return XST_SUCCESS;
+	}
+
+	Status = QueuePtr->SubmitFunc(QueuePtr->SubmitRef, QueuePtr,
+				      QueuePtr->Submitted, Count);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	QueuePtr->Submitted += Count;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Dispatch the packets the DMA has received in an RX messaging queue, called
+* with the number of slots completed, in the order they were submitted.
+*
+* Message segments are passed to the message handler as they are found.
+* Doorbells are collected and passed to the doorbell handler
+* XSRIO_MSG_DB_BATCH at a time, and before a message segment and at the end
+* so that the handlers see the packets in the order they were received.
+* The slots are then given back to the DMA in one call of the submit
+* function.
+*
+* @param	QueuePtr is a pointer to the RX messaging queue.
+* @param	Count is the number of slots completed.
+*
+* @return
+*		- XST_SUCCESS if the slots were given back to the DMA.
+*		- XST_FAILURE if the submit function failed, the slots are
+*		  given back by the next XSrio_MsgRxStart().
+*
+* @note		The DMA has to have made the received data visible to the
+*		processor, for example by invalidating the data cache for the
+*		slots, before this function is called.
+*
+*****************************************************************************/
+int XSrio_MsgRxProcess(XSrio_MsgQueue *QueuePtr, u32 Count)
+{
+	XSrio_MsgSegment Segment;
+	UINTPTR Slot;
+	u32 Upper;
+	u32 Lower;
+	u32 Size;
+	u32 Index;
+	u32 First;
+	u8 Ftype;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->Direction == XSRIO_DIR_RX);
+	Xil_AssertNonvoid(Count <= (QueuePtr->Submitted - QueuePtr->Head));
+
+	First = QueuePtr->Head;
+	for (Index = First; Index != (First + Count); Index++) {
+		Slot = XSrio_MsgSlotAddr(QueuePtr, Index);
+		Lower = *(volatile u32 *)(Slot + XSRIO_HELLO_HDR_LOWER_OFFSET);
+		Upper = *(volatile u32 *)(Slot + XSRIO_HELLO_HDR_UPPER_OFFSET);
+		Ftype = (u8)((Upper & XSRIO_HELLO_FTYPE_MASK) >>
+				XSRIO_HELLO_FTYPE_SHIFT);
+		Size = ((Upper & XSRIO_HELLO_SIZE_MASK) >>
+				XSRIO_HELLO_SIZE_SHIFT) + 1U;
+
+		if ((Ftype == XSRIO_FTYPE_DOORBELL) &&
+		    (QueuePtr->DoorbellHandler != NULL)) {
+			if (QueuePtr->NumDoorbells == XSRIO_MSG_DB_BATCH) {
+				XSrio_MsgDoorbellBatch(QueuePtr);
+			}
+			QueuePtr->DoorbellInfo[QueuePtr->NumDoorbells++] =
+				(u16)((Lower & XSRIO_HELLO_DB_INFO_MASK) >>
+					XSRIO_HELLO_DB_INFO_SHIFT);
+			QueuePtr->Packets++;
+		} else if ((Ftype == XSRIO_FTYPE_MESSAGE) &&
+			   (QueuePtr->MessageHandler != NULL) &&
+			   ((XSRIO_HELLO_HDR_SIZE + Size) <=
+				QueuePtr->SlotSize)) {
+			XSrio_MsgDoorbellBatch(QueuePtr);
+
+			Segment.Mbox = (u8)(Lower & XSRIO_HELLO_MSG_MBOX_MASK);
+			Segment.Letter = (u8)((Lower &
+					XSRIO_HELLO_MSG_LETTER_MASK) >>
+					XSRIO_HELLO_MSG_LETTER_SHIFT);
+			Segment.Segment = (u8)((Lower &
+					XSRIO_HELLO_MSG_SEG_MASK) >>
+					XSRIO_HELLO_MSG_SEG_SHIFT);
+			Segment.NumSegments = (u8)(((Lower &
+					XSRIO_HELLO_MSG_LEN_MASK) >>
+					XSRIO_HELLO_MSG_LEN_SHIFT) + 1U);
+			Segment.Length = Size;
+			Segment.Data = (const u8 *)(Slot +
+					XSRIO_HELLO_HDR_SIZE);
+			QueuePtr->MessageHandler(QueuePtr->MessageRef,
+						 &Segment);
+			QueuePtr->Packets++;
+		} else {
+			QueuePtr->Dropped++;
+		}
+	}
+	XSrio_MsgDoorbellBatch(QueuePtr);
+
+	QueuePtr->Head += Count;
+
+	return XSrio_MsgRxStart(QueuePtr);
+}
+
+/*****************************************************************************/
+/**
+* Write the header of a packet into a slot from a template.
+*
+* @param	QueuePtr is a pointer to the TX messaging queue.
+* @param	Slot is the address of the slot.
+* @param	TemplatePtr is a pointer to the template of the packet.
+* @param	Size is the payload size in bytes, 0 for a doorbell.
+* @param	Lower is the lower header word.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XSrio_MsgPutHeader(XSrio_MsgQueue *QueuePtr, UINTPTR Slot,
+			       const XSrio_MsgTemplate *TemplatePtr,
+			       u32 Size, u32 Lower)
+{
+	u32 Upper = TemplatePtr->Upper |
+		    (((u32)QueuePtr->NextTid << XSRIO_HELLO_TID_SHIFT) &
+			XSRIO_HELLO_TID_MASK);
+
+	if (Size != 0U) {
+		Upper |= ((Size - 1U) << XSRIO_HELLO_SIZE_SHIFT) &
+				XSRIO_HELLO_SIZE_MASK;
+	}
+	QueuePtr->NextTid++;
+
+	*(u32 *)(Slot + XSRIO_HELLO_HDR_LOWER_OFFSET) = Lower;
+	*(u32 *)(Slot + XSRIO_HELLO_HDR_UPPER_OFFSET) = Upper;
+}
+
+/*****************************************************************************/
+/**
+* Pass the collected doorbells of an RX messaging queue to the doorbell
+* handler.
+*
+* @param	QueuePtr is a pointer to the RX messaging queue.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XSrio_MsgDoorbellBatch(XSrio_MsgQueue *QueuePtr)
+{
+	if (QueuePtr->NumDoorbells != 0U) {
+		QueuePtr->DoorbellHandler(QueuePtr->DoorbellRef,
+					  QueuePtr->DoorbellInfo,
+					  QueuePtr->NumDoorbells);
+		QueuePtr->NumDoorbells = 0U;
+	}
+}
+/** @} */
@@ -33,6 +33,7 @@
 * 4.0   se     10/04/22 Update return value definitions
 *		se	   11/10/22 Secure and Non-Secure mode integration
 * 4.1   cog    07/18/23 Add support for SDT flow
+*       fl     10/14/26 Add sample stream
 * </pre>
 *
 ******************************************************************************/
@@ -113,6 +114,8 @@ typedef struct {
 	XSysMonPsv_EventHandler TempEvent; /**< Device Temperature event
                                             handler information */
 	XSysMonPsv_EventHandler OTEvent; /**< OT event handler information */
+	struct XSysMonPsv_Stream *Stream; /**< Sample stream filled on new
+                                            data interrupts, or NULL */
 #endif
 	u32 IsReady; /**< Is device ready */
 #if defined (XSYSMONPSV_SECURE_MODE)
@@ -34,6 +34,7 @@
 *                       arch64 architecture
 * 4.0   se     10/04/22 Update return value definitions
 *		se	   11/10/22 Secure and Non-Secure mode integration
+* 4.1   fl     10/14/26 Added XSysMonPsv_ReadSupplySnapshot
 * </pre>
 *
 ******************************************************************************/
@@ -83,6 +84,10 @@ s64 XSysMonPsv_CfgInitialize(XSysMonPsv *InstancePtr, XSysMonPsv_Config *CfgPtr)
 		InstancePtr->Config.Supply_List[i] = CfgPtr->Supply_List[i];
 	}
 
+#if defined (ARMR5) || defined (__aarch64__)
+	InstancePtr->Stream = NULL;
+#endif
+
 	/* Indicate the instance is now ready to use, initialized without error */
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
@@ -1178,6 +1183,53 @@ int XSysMonPsv_ReadSupplyRaw(XSysMonPsv *InstancePtr, u32 Supply, u32 *Val)
 	return XST_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+ * This function reads the raw voltage of all the configured supplies in one
+ * pass.
+ *
+ * @param	InstancePtr is a pointer to the driver instance.
+ * @param	Val is an array indexed by XSysMonPsv_Supply, filled with the
+ *		raw voltages. Supplies that are not configured read as
+ *		XSYSMONPSV_INVALID.
+ * @param	NumVal is the number of entries of Val, supplies from NumVal
+ *		on are not read.
+ *
+ * @return	- -XST_FAILURE if error
+ * 		- XST_SUCCESS if successful.
+ *
+ * @note	Use XSysMonPsv_RawToVoltage() to convert the values.
+ *
+*******************************************************************************/
+int XSysMonPsv_ReadSupplySnapshot(XSysMonPsv *InstancePtr, u32 *Val,
+				  u32 NumVal)
+{
+	u32 Supply;
+	u8 SupplyReg;
+
+	if ((InstancePtr == NULL) || (Val == NULL)) {
+		return -XST_FAILURE;
+	}
+
+	if (NumVal > (u32)EndList) {
+		NumVal = (u32)EndList;
+	}
+
+	/* Supply registers are contiguous, index them directly */
+	for (Supply = 0U; Supply < NumVal; Supply++) {
+		SupplyReg = InstancePtr->Config.Supply_List[Supply];
+		if (SupplyReg == XSYSMONPSV_INVALID_SUPPLY) {
+			Val[Supply] = XSYSMONPSV_INVALID;
+			continue;
+		}
+		XSysMonPsv_ReadReg32(InstancePtr,
+				     XSYSMONPSV_SUPPLY + ((u32)SupplyReg * 4U),
+				     &Val[Supply]);
+	}
+
+	return XST_SUCCESS;
+}
+
 /******************************************************************************/
 /**
  * This function sets upper threshold voltage for the supply.
@@ -116,6 +116,7 @@
 * 3.1   cog    04/09/22 Remove GIC standalone related functionality for
 *                       arch64 architecture
 * 4.0   se     10/04/22 Update return value definitions
+* 4.1   fl     10/14/26 Add supply snapshot and sample stream
 *
 * </pre>
 *
@@ -193,6 +194,40 @@ typedef enum {
 } XSysMonPsv_VoltageScale;
 /*@}*/
 
+/**
+ * @brief This typedef contains the aggregate of one supply over a window of
+ * a sample stream.
+ * @{
+ */
+typedef struct {
+	float Min; /**< Minimum voltage */
+	float Max; /**< Maximum voltage */
+	float Sum; /**< Sum of the voltages, divided by the decimation gives
+                                          the mean */
+} XSysMonPsv_Aggregate;
+/*@}*/
+
+/**
+ * @brief This typedef contains a sample stream. On every new data interrupt
+ * the interrupt handler reads the stream supplies into the window being
+ * filled, a window is published to the ring after Decimation samples. The
+ * ring has a single reader, XSysMonPsv_StreamRead().
+ * @{
+ */
+typedef struct XSysMonPsv_Stream {
+	const XSysMonPsv_Supply *Supplies; /**< Supplies sampled */
+	u32 NumSupplies; /**< Number of supplies sampled */
+	XSysMonPsv_Aggregate *Ring; /**< Depth windows of NumSupplies
+                                          aggregates each */
+	u32 Depth; /**< Windows in the ring */
+	u32 Decimation; /**< Samples per window */
+	u32 Count; /**< Samples in the window being filled */
+	u32 Head; /**< Windows published, written by the handler */
+	u32 Tail; /**< Windows read, written by the reader */
+	u32 Dropped; /**< Samples dropped while the ring was full */
+} XSysMonPsv_Stream;
+/*@}*/
+
 /************************* Variable Definitions ******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -407,6 +442,8 @@ int XSysMonPsv_GetTempThresholdLower(XSysMonPsv *InstancePtr,
 int XSysMonPsv_ReadSupplyProcessed(XSysMonPsv *InstancePtr, int Supply,
 				   float *Val);
 int XSysMonPsv_ReadSupplyRaw(XSysMonPsv *InstancePtr, u32 Supply, u32 *Val);
+int XSysMonPsv_ReadSupplySnapshot(XSysMonPsv *InstancePtr, u32 *Val,
+				  u32 NumVal);
 int XSysMonPsv_SetSupplyThresholdUpper(XSysMonPsv *InstancePtr, u32 Supply,
 				       u32 Val);
 int XSysMonPsv_SetSupplyThresholdLower(XSysMonPsv *InstancePtr, int Supply,
@@ -456,6 +493,16 @@ void XSysMonPsv_SetSupplyEventHandler(XSysMonPsv *InstancePtr,
 				      XSysMonPsv_Handler CallbackFunc,
 				      void *CallbackRef);
 void XSysMonPsv_AlarmEventHandler(XSysMonPsv *InstancePtr);
+int XSysMonPsv_StreamInit(XSysMonPsv_Stream *StreamPtr,
+			  const XSysMonPsv_Supply *Supplies, u32 NumSupplies,
+			  XSysMonPsv_Aggregate *Ring, u32 Depth,
+			  u32 Decimation);
+int XSysMonPsv_StreamStart(XSysMonPsv *InstancePtr,
+			   XSysMonPsv_Stream *StreamPtr,
+			   XSysMonPsv_Supply Trigger, u8 IntrNum);
+void XSysMonPsv_StreamStop(XSysMonPsv *InstancePtr, u8 IntrNum);
+int XSysMonPsv_StreamRead(XSysMonPsv_Stream *StreamPtr,
+			  XSysMonPsv_Aggregate *Aggr);
 #endif
 /* Functions in xsysmonpsv_sinit.c */
 XSysMonPsv_Config *XSysMonPsv_LookupConfig(void);
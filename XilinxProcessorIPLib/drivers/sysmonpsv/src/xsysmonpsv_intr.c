@@ -32,6 +32,7 @@
 * 3.1   cog    04/09/22 Remove GIC standalone related functionality for
 *                       arch64 architecture
 * 4.0   se     11/10/22 Secure and Non-Secure mode integration
+* 4.1   fl     10/14/26 Added sample stream filled on new data interrupt
 *
 * </pre>
 *
@@ -54,6 +55,10 @@
 /***************** Macros (Inline Functions) Definitions ********************/
 
 /************************** Function Prototypes *****************************/
+#if defined (ARMR5) || defined (__aarch64__)
+static void XSysMonPsv_StreamSample(XSysMonPsv *InstancePtr,
+				    XSysMonPsv_Stream *StreamPtr);
+#endif
 
 /************************** Variable Definitions ****************************/
 /****************************************************************************/
@@ -382,6 +387,12 @@ void XSysMonPsv_AlarmEventHandler(XSysMonPsv *InstancePtr)
 	/* Clear interrupt status register */
 	XSysMonPsv_IntrClear(InstancePtr, IntrStatus);
 
+	/* Sample the stream supplies */
+	if (((IntrStatus & XSYSMONPSV_ISR_NEW_DATA0_MASK) != 0U) &&
+	    (InstancePtr->Stream != NULL)) {
+		XSysMonPsv_StreamSample(InstancePtr, InstancePtr->Stream);
+	}
+
 	SupplyAlarm = IntrStatus &
 		      (XSYSMONPSV_ISR_ALARM0_MASK | XSYSMONPSV_ISR_ALARM1_MASK |
 		       XSYSMONPSV_ISR_ALARM2_MASK | XSYSMONPSV_ISR_ALARM3_MASK |
@@ -420,5 +431,201 @@ void XSysMonPsv_AlarmEventHandler(XSysMonPsv *InstancePtr)
 		}
 	}
 }
+
+/******************************************************************************/
+/**
+ * This function initializes a sample stream.
+ *
+ * @param       StreamPtr is a pointer to the stream.
+ * @param       Supplies is the list of supplies to sample, it is referenced,
+ *              not copied.
+ * @param       NumSupplies is the number of supplies in the list.
+ * @param       Ring is an array of Depth * NumSupplies aggregates.
+ * @param       Depth is the number of windows in the ring.
+ * @param       Decimation is the number of samples aggregated per window.
+ *
+ * @return      - -XST_FAILURE if error
+ *              - XST_SUCCESS if successful.
+ *
+ * @note        None.
+ *
+*******************************************************************************/
+int XSysMonPsv_StreamInit(XSysMonPsv_Stream *StreamPtr,
+			  const XSysMonPsv_Supply *Supplies, u32 NumSupplies,
+			  XSysMonPsv_Aggregate *Ring, u32 Depth,
+			  u32 Decimation)
+{
+	if ((StreamPtr == NULL) || (Supplies == NULL) || (Ring == NULL) ||
+	    (NumSupplies == 0U) || (Depth == 0U) || (Decimation == 0U)) {
+		return -XST_FAILURE;
+	}
+
+	StreamPtr->Supplies = Supplies;
+	StreamPtr->NumSupplies = NumSupplies;
+	StreamPtr->Ring = Ring;
+	StreamPtr->Depth = Depth;
+	StreamPtr->Decimation = Decimation;
+	StreamPtr->Count = 0U;
+	StreamPtr->Head = 0U;
+	StreamPtr->Tail = 0U;
+	StreamPtr->Dropped = 0U;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function starts filling a sample stream from the new data interrupt.
+ *
+ * @param       InstancePtr is a pointer to the XSysMonPsv instance.
+ * @param       StreamPtr is a pointer to a stream set up with
+ *              XSysMonPsv_StreamInit().
+ * @param       Trigger is the supply whose new data paces the stream,
+ *              normally the last supply of the sequence.
+ * @param       IntrNum is the interrupt line the handler is connected to.
+ *
+ * @return      - -XST_FAILURE if error
+ *              - XST_SUCCESS if successful.
+ *
+ * @note        Uses the NEW_DATA0 interrupt. Without a stream only
+ *              threshold alarm interrupts are handled.
+ *
+*******************************************************************************/
+int XSysMonPsv_StreamStart(XSysMonPsv *InstancePtr,
+			   XSysMonPsv_Stream *StreamPtr,
+			   XSysMonPsv_Supply Trigger, u8 IntrNum)
+{
+	if ((InstancePtr == NULL) || (StreamPtr == NULL) ||
+	    (InstancePtr->Config.Supply_List[Trigger] ==
+	     XSYSMONPSV_INVALID_SUPPLY)) {
+		return -XST_FAILURE;
+	}
+
+	InstancePtr->Stream = StreamPtr;
+	XSysMonPsv_SetNewDataIntSrc(InstancePtr, Trigger,
+				    XSYSMONPSV_IER0_NEW_DATA0_MASK);
+	XSysMonPsv_IntrClear(InstancePtr, XSYSMONPSV_ISR_NEW_DATA0_MASK);
+	XSysMonPsv_IntrEnable(InstancePtr, XSYSMONPSV_IER0_NEW_DATA0_MASK,
+			      IntrNum);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function stops the sample stream, the windows already published can
+ * still be read.
+ *
+ * @param       InstancePtr is a pointer to the XSysMonPsv instance.
+ * @param       IntrNum is the interrupt line passed to XSysMonPsv_StreamStart().
+ *
+ * @return      None.
+ *
+ * @note        None.
+ *
+*******************************************************************************/
+void XSysMonPsv_StreamStop(XSysMonPsv *InstancePtr, u8 IntrNum)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	XSysMonPsv_IntrDisable(InstancePtr, XSYSMONPSV_IER0_NEW_DATA0_MASK,
+			       IntrNum);
+	InstancePtr->Stream = NULL;
+}
+
+/******************************************************************************/
+/**
+ * This function reads the oldest window of a sample stream.
+ *
+ * @param       StreamPtr is a pointer to the stream.
+ * @param       Aggr is an array of NumSupplies aggregates, in the order of
+ *              the stream supplies.
+ *
+ * @return      - XST_NO_DATA if no window is complete
+ *              - XST_SUCCESS if successful.
+ *
+ * @note        Only one context may read a stream.
+ *
+*******************************************************************************/
+int XSysMonPsv_StreamRead(XSysMonPsv_Stream *StreamPtr,
+			  XSysMonPsv_Aggregate *Aggr)
+{
+	const XSysMonPsv_Aggregate *Slot;
+	u32 Tail = StreamPtr->Tail;
+	u32 Index;
+
+	Xil_AssertNonvoid(Aggr != NULL);
+
+	if (Tail == __atomic_load_n(&StreamPtr->Head, __ATOMIC_ACQUIRE)) {
+		return XST_NO_DATA;
+	}
+
+	Slot = &StreamPtr->Ring[(Tail % StreamPtr->Depth) *
+				StreamPtr->NumSupplies];
+	for (Index = 0U; Index < StreamPtr->NumSupplies; Index++) {
+		Aggr[Index] = Slot[Index];
+	}
+	__atomic_store_n(&StreamPtr->Tail, Tail + 1U, __ATOMIC_RELEASE);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function adds one sample of the stream supplies to the window being
+ * filled and publishes the window once complete.
+ *
+ * @param       InstancePtr is a pointer to the XSysMonPsv instance.
+ * @param       StreamPtr is a pointer to the stream.
+ *
+ * @return      None.
+ *
+ * @note        Called from the interrupt handler.
+ *
+*******************************************************************************/
+static void XSysMonPsv_StreamSample(XSysMonPsv *InstancePtr,
+				    XSysMonPsv_Stream *StreamPtr)
+{
+	XSysMonPsv_Aggregate *Slot;
+	u32 Head = StreamPtr->Head;
+	u32 Index, Raw;
+	float Volts;
+
+	/* The slot to fill is still being read, drop the sample */
+	if ((Head - __atomic_load_n(&StreamPtr->Tail, __ATOMIC_ACQUIRE)) >=
+	    StreamPtr->Depth) {
+		StreamPtr->Dropped++;
+		return;
+	}
+
+	Slot = &StreamPtr->Ring[(Head % StreamPtr->Depth) *
+				StreamPtr->NumSupplies];
+	for (Index = 0U; Index < StreamPtr->NumSupplies; Index++) {
+		XSysMonPsv_ReadReg32(InstancePtr,
+				     XSysMonPsv_SupplyOffset(InstancePtr,
+						(int)StreamPtr->Supplies[Index]),
+				     &Raw);
+		Volts = XSysMonPsv_RawToVoltage(Raw);
+		if (StreamPtr->Count == 0U) {
+			Slot[Index].Min = Volts;
+			Slot[Index].Max = Volts;
+			Slot[Index].Sum = Volts;
+		} else {
+			if (Volts < Slot[Index].Min) {
+				Slot[Index].Min = Volts;
+			}
+			if (Volts > Slot[Index].Max) {
+				Slot[Index].Max = Volts;
+			}
+			Slot[Index].Sum += Volts;
+		}
+	}
+
+	StreamPtr->Count++;
+	if (StreamPtr->Count == StreamPtr->Decimation) {
+		StreamPtr->Count = 0U;
+		__atomic_store_n(&StreamPtr->Head, Head + 1U, __ATOMIC_RELEASE);
+	}
+}
 #endif
 /** @} */
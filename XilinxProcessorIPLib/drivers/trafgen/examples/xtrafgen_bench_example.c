@@ -0,0 +1,335 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xtrafgen_bench_example.c
+ *
+ * This file demonstrates how to use the AXI Traffic Generator cores of a
+ * design as a memory system benchmark, with XTrafGen_BenchProgram() and
+ * XTrafGen_BenchRun().
+ *
+ * Every pattern (sequential, 4KB strided and random), burst length and read
+ * share is run on 1 up to all the Traffic Generators in Full mode, each one
+ * on its own BENCH_SPAN bytes of memory, so that the bandwidth can be drawn
+ * against the number of masters and the burst size (saturation curves).
+ * The results are printed as CSV lines:
+ *
+ *   pattern,burst_bytes,read_pct,masters,bytes,ns,mbps,rd_lat_avg,rd_lat_max
+ *
+ * ns is the time of the runs from the xiltimer. If the design has an AXI
+ * Performance Monitor in Advanced mode, with slot 0 on the memory port, the
+ * bytes are counted by it and the average and maximum read latencies are in
+ * its clock cycles. Otherwise the bytes are those programmed and the
+ * latencies are 0.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 4.5   fl   10/14/26 First release
+ * </pre>
+ *
+ * ***************************************************************************
+ */
+
+/***************************** Include Files *********************************/
+
+#include "xtrafgen.h"
+#include "xparameters.h"
+#include "xil_printf.h"
+#include "xiltimer.h"
+
+#if defined(XPAR_AXIPMON_0_DEVICE_ID) || defined(XPAR_XAXIPMON_0_BASEADDR)
+#include "xaxipmon.h"
+#define BENCH_APM
+#endif
+
+/************************** Constant Definitions *****************************/
+
+#ifdef XPAR_MIG_0_BASEADDRESS
+#define MEM_BASE_ADDR	(XPAR_MIG_0_BASEADDRESS + 0x1000000)
+#else
+#warning CHECK FOR THE VALID DDR ADDRESS IN XPARAMETERS.H, \
+			DEFAULT SET TO 0x01000000
+#define MEM_BASE_ADDR	0x01000000
+#endif
+
+#define BENCH_MAX_INST	4		/* Traffic Generators used at most */
+#define BENCH_SPAN	0x100000U	/* Memory per Traffic Generator */
+#define BENCH_STRIDE	0x1000U		/* Stride of the strided pattern */
+#define BENCH_BEAT_SIZE	2U		/* 4 byte beats, any master width */
+#define BENCH_NUM_CMDS	254U		/* Bursts per run and master */
+#define BENCH_REPEAT	16U		/* Runs per measurement */
+#define BENCH_TIMEOUT	0x1000000U	/* Polling rounds per run */
+
+/************************** Function Prototypes ******************************/
+
+static int BenchInit(void);
+static int BenchMeasure(const XTrafGen_BenchPattern *PatternPtr,
+			u32 NumInst);
+
+/************************** Variable Definitions *****************************/
+
+/*
+ * Device instance definitions
+ */
+XTrafGen BenchInst[BENCH_MAX_INST];
+XTrafGen *BenchInstPtrs[BENCH_MAX_INST];
+u32 BenchNumInst;
+
+#ifdef BENCH_APM
+XAxiPmon BenchApm;
+#endif
+
+static const char8 *BenchPatternNames[] = { "sequential", "strided",
+					    "random" };
+static const u32 BenchBurstLens[] = { 1U, 4U, 16U, 64U, 256U };
+static const u32 BenchReadPcts[] = { 100U, 50U, 0U };
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* This function is the main entry of the traffic generator benchmark.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if all the runs pass
+*		- XST_FAILURE if fails.
+*
+* @note		None.
+*
+******************************************************************************/
+int main()
+{
+	XTrafGen_BenchPattern Pattern;
+	u32 Pat;
+	u32 Burst;
+	u32 Mix;
+	u32 NumInst;
+
+	xil_printf("Entering main\n\r");
+
+	if (BenchInit() != XST_SUCCESS) {
+		xil_printf("Traffic Generator Benchmark Example Test Failed\n\r");
+		xil_printf("--- Exiting main() ---\n\r");
+		return XST_FAILURE;
+	}
+
+	xil_printf("pattern,burst_bytes,read_pct,masters,bytes,ns,mbps,"
+		   "rd_lat_avg,rd_lat_max\n\r");
+
+	memset(&Pattern, 0, sizeof(Pattern));
+	Pattern.Span = BENCH_SPAN;
+	Pattern.Stride = BENCH_STRIDE;
+	Pattern.Size = BENCH_BEAT_SIZE;
+	Pattern.NumCmds = BENCH_NUM_CMDS;
+
+	for (Pat = XTG_BENCH_SEQUENTIAL; Pat <= XTG_BENCH_RANDOM; Pat++) {
+		Pattern.Pattern = Pat;
+		for (Burst = 0U; Burst < (sizeof(BenchBurstLens) /
+					  sizeof(BenchBurstLens[0])); Burst++) {
+			Pattern.BurstLen = BenchBurstLens[Burst];
+			for (Mix = 0U; Mix < (sizeof(BenchReadPcts) /
+					      sizeof(BenchReadPcts[0])); Mix++) {
+				Pattern.ReadPct = BenchReadPcts[Mix];
+				for (NumInst = 1U; NumInst <= BenchNumInst;
+				     NumInst++) {
+					if (BenchMeasure(&Pattern, NumInst) !=
+					    XST_SUCCESS) {
+						xil_printf("Traffic Generator "
+							   "Benchmark Example "
+							   "Test Failed\n\r");
+						xil_printf("--- Exiting main() "
+							   "---\n\r");
+						return XST_FAILURE;
+					}
+				}
+			}
+		}
+	}
+
+	xil_printf("Successfully ran Traffic Generator Benchmark Example\n\r");
+	xil_printf("--- Exiting main() ---\n\r");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes the Traffic Generators in Full mode, up to
+* BENCH_MAX_INST of them, and the AXI Performance Monitor if there is one.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if a Traffic Generator in Full mode was found
+*		- XST_FAILURE if fails.
+*
+* @note		None.
+*
+******************************************************************************/
+static int BenchInit(void)
+{
+	extern XTrafGen_Config XTrafGen_ConfigTable[];
+	XTrafGen_Config *Config;
+	XTrafGen *InstancePtr;
+	u32 Index;
+	int Status;
+#ifdef BENCH_APM
+	XAxiPmon_Config *ApmConfig;
+#endif
+
+	BenchNumInst = 0U;
+#ifndef SDT
+	for (Index = 0U; Index < XPAR_XTRAFGEN_NUM_INSTANCES; Index++) {
+#else
+	for (Index = 0U; XTrafGen_ConfigTable[Index].Name != NULL; Index++) {
+#endif
+		if (BenchNumInst == BENCH_MAX_INST) {
+			break;
+		}
+		Config = &XTrafGen_ConfigTable[Index];
+		InstancePtr = &BenchInst[BenchNumInst];
+		Status = XTrafGen_CfgInitialize(InstancePtr, Config,
+						Config->BaseAddress);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		if (InstancePtr->OperatingMode != XTG_MODE_FULL) {
+			continue;
+		}
+		BenchInstPtrs[BenchNumInst] = InstancePtr;
+		BenchNumInst++;
+	}
+	if (BenchNumInst == 0U) {
+		xil_printf("No Traffic Generator in Full mode\n\r");
+		return XST_FAILURE;
+	}
+
+#ifdef BENCH_APM
+#ifndef SDT
+	ApmConfig = XAxiPmon_LookupConfig(XPAR_AXIPMON_0_DEVICE_ID);
+#else
+	ApmConfig = XAxiPmon_LookupConfig(XPAR_XAXIPMON_0_BASEADDR);
+#endif
+	if (ApmConfig == NULL) {
+		return XST_FAILURE;
+	}
+	Status = XAxiPmon_CfgInitialize(&BenchApm, ApmConfig,
+					ApmConfig->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	(void)XAxiPmon_SetMetrics(&BenchApm, 0U, XAPM_METRIC_SET_2,
+				  XAPM_METRIC_COUNTER_0);
+	(void)XAxiPmon_SetMetrics(&BenchApm, 0U, XAPM_METRIC_SET_3,
+				  XAPM_METRIC_COUNTER_1);
+	(void)XAxiPmon_SetMetrics(&BenchApm, 0U, XAPM_METRIC_SET_1,
+				  XAPM_METRIC_COUNTER_2);
+	(void)XAxiPmon_SetMetrics(&BenchApm, 0U, XAPM_METRIC_SET_5,
+				  XAPM_METRIC_COUNTER_3);
+	(void)XAxiPmon_SetMetrics(&BenchApm, 0U, XAPM_METRIC_SET_15,
+				  XAPM_METRIC_COUNTER_4);
+#endif
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function programs a pattern into the first NumInst Traffic
+* Generators, runs it BENCH_REPEAT times on all of them at once and prints
+* one CSV line of results.
+*
+* @param	PatternPtr is the pattern, BaseAddr and Seed are set per
+*		Traffic Generator.
+* @param	NumInst is the number of Traffic Generators to run.
+*
+* @return
+*		- XST_SUCCESS if the runs pass
+*		- XST_FAILURE if fails.
+*
+* @note		None.
+*
+******************************************************************************/
+static int BenchMeasure(const XTrafGen_BenchPattern *PatternPtr,
+			u32 NumInst)
+{
+	XTrafGen_BenchPattern Pattern = *PatternPtr;
+	XTime Start;
+	XTime End;
+	u64 Bytes;
+	u64 Ns;
+	u32 RdLatAvg = 0U;
+	u32 RdLatMax = 0U;
+	u32 Index;
+	int Status;
+#ifdef BENCH_APM
+	u32 RdCount;
+#endif
+
+	for (Index = 0U; Index < NumInst; Index++) {
+		Pattern.BaseAddr = MEM_BASE_ADDR + (Index * BENCH_SPAN);
+		Pattern.Seed = Index + 1U;
+		Status = XTrafGen_BenchProgram(BenchInstPtrs[Index], &Pattern);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+#ifdef BENCH_APM
+	(void)XAxiPmon_ResetMetricCounter(&BenchApm);
+	XAxiPmon_EnableMetricsCounter(&BenchApm);
+#endif
+
+	XTime_GetTime(&Start);
+	for (Index = 0U; Index < BENCH_REPEAT; Index++) {
+		Status = XTrafGen_BenchRun(BenchInstPtrs, NumInst,
+					   BENCH_TIMEOUT);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+	XTime_GetTime(&End);
+
+#ifdef BENCH_APM
+	XAxiPmon_DisableMetricsCounter(&BenchApm);
+	Bytes = (u64)XAxiPmon_GetMetricCounter(&BenchApm,
+					       XAPM_METRIC_COUNTER_0) +
+		XAxiPmon_GetMetricCounter(&BenchApm, XAPM_METRIC_COUNTER_1);
+	RdCount = XAxiPmon_GetMetricCounter(&BenchApm, XAPM_METRIC_COUNTER_2);
+	if (RdCount != 0U) {
+		RdLatAvg = XAxiPmon_GetMetricCounter(&BenchApm,
+						     XAPM_METRIC_COUNTER_3) /
+			   RdCount;
+	}
+	RdLatMax = XAxiPmon_GetMetricCounter(&BenchApm, XAPM_METRIC_COUNTER_4);
+#else
+	Bytes = (u64)BENCH_NUM_CMDS * (Pattern.BurstLen << Pattern.Size) *
+		NumInst * BENCH_REPEAT;
+#endif
+
+	Ns = ((u64)(End - Start) * 1000000000ULL) / XTime_GetTimeFreq();
+	if (Ns == 0U) {
+		Ns = 1U;
+	}
+
+	xil_printf("%s,%u,%u,%u,%lu,%lu,%lu,%u,%u\n\r",
+		   BenchPatternNames[Pattern.Pattern],
+		   Pattern.BurstLen << Pattern.Size, Pattern.ReadPct, NumInst,
+		   (unsigned long)Bytes, (unsigned long)Ns,
+		   (unsigned long)((Bytes * 1000U) / Ns), RdLatAvg, RdLatMax);
+
+	return XST_SUCCESS;
+}
@@ -97,6 +97,18 @@
 *
 * - XTrafGen_PrintAllCmds(): This function displays the list of commands.
 *
+* <b>Memory Benchmark</b>
+*
+* xtrafgen_bench.c fills the command list with a memory access pattern, so
+* that the core can be used to measure the bandwidth and latency of a memory
+* or interconnect:
+*
+* - XTrafGen_BenchProgram(): Programs the commands of a sequential, strided
+*   or random pattern with the given burst length and read/write mix.
+*
+* - XTrafGen_BenchRun(): Starts the master logic of several cores at once
+*   and waits for all of them, so that their traffic overlaps.
+*
 * <b>Master RAM Handling</b>
 *
 * AXI Traffic Generator uses MSTRAM to
@@ -131,6 +143,7 @@
 * We provided two examples to show how to use the driver API:
 * - One for interrupt mode (xtrafgen_interrupt_example.c)
 * - One for polling mode (xtrafgen_polling_example.c)
+* - One for memory benchmarking with several cores (xtrafgen_bench_example.c)
 *
 * <b> Asserts </b>
 *
@@ -182,6 +195,8 @@
 * 4.2   ms  04/18/17 Modified tcl file to add suffix U for all macros
 *                    definitions of trafgen in xparameters.h
 * 4.4   sd   09/03/20 Updated makefile for parallel execution.
+* 4.5   fl   10/14/26 Added the memory benchmark command programming,
+*		      XTrafGen_BenchProgram() and XTrafGen_BenchRun().
 * </pre>
 ******************************************************************************/
 
@@ -208,6 +223,17 @@ extern "C" {
 #define XTG_WRITE	1	/**< Write Direction Flag */
 #define XTG_READ	0	/**< Read Direction Flag */
 
+/* Benchmark address patterns */
+#define XTG_BENCH_SEQUENTIAL	0U	/**< Back to back bursts */
+#define XTG_BENCH_STRIDED	1U	/**< Bursts Stride bytes apart */
+#define XTG_BENCH_RANDOM	2U	/**< Bursts at random aligned offsets */
+
+#define XTG_BENCH_MAX_CMDS	(MAX_NUM_ENTRIES - 1) /**< Commands per
+							* region, one entry
+							* ends the region */
+#define XTG_BENCH_MAX_BYTES	4096U	/**< Bytes per burst, AXI bursts do
+					  *  not cross a 4KB boundary */
+
 /* Operating Mode flags */
 #define XTG_MODE_FULL		0	/**< Full Mode */
 #define XTG_MODE_BASIC		1	/**< Basic Mode */
@@ -350,6 +376,26 @@ typedef struct XTrafGen {
 	int IsReady;	/* Device is initialized and ready */
 } XTrafGen;
 
+/**
+ * Memory benchmark pattern, see XTrafGen_BenchProgram()
+ *
+ * Every command is a burst of BurstLen beats of (1 << Size) bytes. The
+ * bursts stay within Span bytes from BaseAddr.
+ */
+typedef struct XTrafGen_BenchPattern {
+	UINTPTR BaseAddr;	/**< Start of the tested memory, burst aligned */
+	u32 Span;		/**< Bytes of memory the bursts cover */
+	u32 Pattern;		/**< XTG_BENCH_SEQUENTIAL/STRIDED/RANDOM */
+	u32 Stride;		/**< Bytes between bursts, strided pattern */
+	u32 BurstLen;		/**< Beats per burst, 1 to 256 */
+	u32 Size;		/**< Beat size, a*_size encoding */
+	u32 NumCmds;		/**< Bursts, read and write together */
+	u32 ReadPct;		/**< Percentage of the bursts that are reads */
+	u32 Seed;		/**< Seed of the random pattern, not 0 */
+	u32 Qos;		/**< a*_qos of the bursts */
+	u32 Cache;		/**< a*_cache of the bursts */
+} XTrafGen_BenchPattern;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /****************************************************************************/
@@ -1200,6 +1246,14 @@ void XTrafGen_AccessMasterRam(XTrafGen *InstancePtr, u32 Offset,
 void XTrafGen_PrintCmds(XTrafGen *InstancePtr);
 int XTrafGen_EraseAllCommands(XTrafGen *InstancePtr);
 
+/*
+ * Memory benchmark functions in xtrafgen_bench.c
+ */
+int XTrafGen_BenchProgram(XTrafGen *InstancePtr,
+			  const XTrafGen_BenchPattern *PatternPtr);
+int XTrafGen_BenchRun(XTrafGen **InstancePtrs, u32 NumInstances,
+		      u32 TimeOut);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,315 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xtrafgen_bench.c
+* @addtogroup trafgen Overview
+* @{
+*
+* This file implements the memory benchmark command programming of the AXI
+* Traffic Generator driver. A pattern is turned into the commands of the
+* write and read regions, which the core issues independently of each other,
+* and several cores can be run at the same time to load a memory from more
+* than one master.
+*
+* The driver only generates the traffic. Bandwidth and latency are measured
+* by the application, with an AXI Performance Monitor on the memory port or
+* with the time the run takes, see xtrafgen_bench_example.c.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.5   fl   10/14/26 First release
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xtrafgen.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XTG_BENCH_BURST_INCR	1U	/**< a*_burst of an INCR burst */
+#define XTG_BENCH_RESP_ALL	0x7U	/**< Accept every response */
+
+/************************** Function Prototypes ******************************/
+
+static u32 XTrafGen_BenchRandom(u32 *StatePtr);
+static UINTPTR XTrafGen_BenchOffset(const XTrafGen_BenchPattern *PatternPtr,
+				    u32 Bytes, u32 Index, u32 *StatePtr);
+static int XTrafGen_BenchEndRegion(XTrafGen *InstancePtr, u8 RdWrFlag);
+
+/*****************************************************************************/
+/**
+* Program a memory benchmark pattern
+*
+* This function replaces the commands of the instance with NumCmds bursts of
+* the pattern and writes them to the Command and Parameter RAMs. The bursts
+* are given to the read and write regions in the ReadPct proportion, spread
+* evenly over the pattern, and the regions do not depend on each other, so
+* that reads and writes overlap as they would from a processor.
+*
+* - XTG_BENCH_SEQUENTIAL: the bursts follow each other from BaseAddr and
+*   wrap after Span bytes.
+* - XTG_BENCH_STRIDED: the bursts are Stride bytes apart and wrap after
+*   Span bytes.
+* - XTG_BENCH_RANDOM: the bursts are at random burst aligned offsets within
+*   Span, from a pseudo random sequence started with Seed, so that a run can
+*   be repeated.
+*
+* Write data is taken from the start of the Master RAM and read data is
+* stored there, its contents do not matter to the benchmark.
+*
+* @param	InstancePtr is a pointer to the Axi TrafGen instance to be
+*		worked on.
+* @param	PatternPtr is a pointer to the pattern to program.
+*
+* @return
+*		- XST_SUCCESS if successful
+*		- XST_INVALID_PARAM if the burst is not a power of two of at
+*		  most XTG_BENCH_MAX_BYTES bytes, BaseAddr, Span or Stride are
+*		  not multiples of it, Seed is 0 for the random pattern, or
+*		  a region would take more than XTG_BENCH_MAX_CMDS commands
+*		- XST_FAILURE if the core is not in Full mode or programming
+*		  internal RAMs failed
+*
+*****************************************************************************/
+int XTrafGen_BenchProgram(XTrafGen *InstancePtr,
+			  const XTrafGen_BenchPattern *PatternPtr)
+{
+	XTrafGen_Cmd Cmd;
+	u32 Bytes;
+	u32 NumRd;
+	u32 State;
+	u32 Acc = 0U;
+	u32 Index;
+	int Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(PatternPtr != NULL);
+	Xil_AssertNonvoid(PatternPtr->Pattern <= XTG_BENCH_RANDOM);
+	Xil_AssertNonvoid(PatternPtr->ReadPct <= 100U);
+
+	if (InstancePtr->OperatingMode != XTG_MODE_FULL) {
+		return XST_FAILURE;
+	}
+
+	if ((PatternPtr->BurstLen == 0U) ||
+	    (PatternPtr->BurstLen > (XTG_LEN_MASK + 1U)) ||
+	    (PatternPtr->Size > XTG_SIZE_MASK)) {
+		return XST_INVALID_PARAM;
+	}
+	Bytes = PatternPtr->BurstLen << PatternPtr->Size;
+	if (((Bytes & (Bytes - 1U)) != 0U) || (Bytes > XTG_BENCH_MAX_BYTES) ||
+	    ((PatternPtr->BaseAddr & (Bytes - 1U)) != 0U) ||
+	    (PatternPtr->Span < Bytes) ||
+	    ((PatternPtr->Span & (Bytes - 1U)) != 0U)) {
+		return XST_INVALID_PARAM;
+	}
+	if ((PatternPtr->Pattern == XTG_BENCH_STRIDED) &&
+	    ((PatternPtr->Stride == 0U) ||
+	     ((PatternPtr->Stride & (Bytes - 1U)) != 0U))) {
+		return XST_INVALID_PARAM;
+	}
+	if ((PatternPtr->Pattern == XTG_BENCH_RANDOM) &&
+	    (PatternPtr->Seed == 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	NumRd = (u32)(((u64)PatternPtr->NumCmds * PatternPtr->ReadPct) / 100U);
+	if ((NumRd > XTG_BENCH_MAX_CMDS) ||
+	    ((PatternPtr->NumCmds - NumRd) > XTG_BENCH_MAX_CMDS)) {
+		return XST_INVALID_PARAM;
+	}
+
+	Status = XTrafGen_EraseAllCommands(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	memset(&Cmd, 0, sizeof(Cmd));
+	Cmd.CRamCmd.ValidCmd = 1;
+	Cmd.CRamCmd.Length = PatternPtr->BurstLen - 1U;
+	Cmd.CRamCmd.Size = PatternPtr->Size;
+	Cmd.CRamCmd.Burst = XTG_BENCH_BURST_INCR;
+	Cmd.CRamCmd.Qos = PatternPtr->Qos;
+	Cmd.CRamCmd.Cache = PatternPtr->Cache;
+	Cmd.CRamCmd.ExpectedResp = XTG_BENCH_RESP_ALL;
+
+	State = PatternPtr->Seed;
+	for (Index = 0U; Index < PatternPtr->NumCmds; Index++) {
+		/* Burst Index is a read when the read share passes 100 */
+		Acc += PatternPtr->ReadPct;
+		if (Acc >= 100U) {
+			Acc -= 100U;
+			Cmd.RdWrFlag = XTG_READ;
+		} else {
+			Cmd.RdWrFlag = XTG_WRITE;
+		}
+
+		Cmd.CRamCmd.Address = PatternPtr->BaseAddr +
+			XTrafGen_BenchOffset(PatternPtr, Bytes, Index, &State);
+
+		Status = XTrafGen_AddCommand(InstancePtr, &Cmd);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	Status = XTrafGen_BenchEndRegion(InstancePtr, XTG_WRITE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	Status = XTrafGen_BenchEndRegion(InstancePtr, XTG_READ);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return XTrafGen_WriteCmdsToHw(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+* Run the programmed commands of several cores at once
+*
+* This function starts the master logic of all the instances back to back
+* and polls them until every one is done, so that the traffic of the cores
+* overlaps for all but the start and the end of the run.
+*
+* @param	InstancePtrs is an array of pointers to the Axi TrafGen
+*		instances to be worked on, programmed with
+*		XTrafGen_BenchProgram() or XTrafGen_AddCommand().
+* @param	NumInstances is the number of instances in InstancePtrs.
+* @param	TimeOut is the number of polling rounds to wait for.
+*
+* @return
+*		- XST_SUCCESS if all the instances completed without error
+*		- XST_FAILURE if an instance reported an error or did not
+*		  complete within TimeOut rounds
+*
+* @note		The errors of an instance that failed are left in its error
+*		status register for the caller.
+*
+*****************************************************************************/
+int XTrafGen_BenchRun(XTrafGen **InstancePtrs, u32 NumInstances,
+		      u32 TimeOut)
+{
+	u32 Index;
+	u32 Pending;
+	u32 Round;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtrs != NULL);
+	Xil_AssertNonvoid(NumInstances > 0U);
+
+	for (Index = 0U; Index < NumInstances; Index++) {
+		Xil_AssertNonvoid(InstancePtrs[Index] != NULL);
+		Xil_AssertNonvoid(InstancePtrs[Index]->IsReady ==
+				  XIL_COMPONENT_IS_READY);
+	}
+
+	for (Index = 0U; Index < NumInstances; Index++) {
+		XTrafGen_StartMasterLogic(InstancePtrs[Index]);
+	}
+
+	for (Round = 0U; Round < TimeOut; Round++) {
+		Pending = 0U;
+		for (Index = 0U; Index < NumInstances; Index++) {
+			if (XTrafGen_ReadErrors(InstancePtrs[Index]) != 0U) {
+				return XST_FAILURE;
+			}
+			if (!XTrafGen_IsMasterLogicDone(InstancePtrs[Index])) {
+				Pending++;
+			}
+		}
+		if (Pending == 0U) {
+			return XST_SUCCESS;
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+* Next value of the xorshift32 sequence of the random pattern
+*
+* @param	StatePtr is a pointer to the sequence state, not 0.
+*
+* @return	Next value of the sequence, never 0.
+*
+*****************************************************************************/
+static u32 XTrafGen_BenchRandom(u32 *StatePtr)
+{
+	u32 Value = *StatePtr;
+
+	Value ^= Value << 13;
+	Value ^= Value >> 17;
+	Value ^= Value << 5;
+	*StatePtr = Value;
+
+	return Value;
+}
+
+/*****************************************************************************/
+/**
+* Offset of a burst of the pattern from BaseAddr
+*
+* @param	PatternPtr is a pointer to the pattern.
+* @param	Bytes is the size of a burst.
+* @param	Index is the number of the burst in the pattern.
+* @param	StatePtr is a pointer to the state of the random sequence.
+*
+* @return	Burst aligned offset below Span.
+*
+*****************************************************************************/
+static UINTPTR XTrafGen_BenchOffset(const XTrafGen_BenchPattern *PatternPtr,
+				    u32 Bytes, u32 Index, u32 *StatePtr)
+{
+	u32 Slots = PatternPtr->Span / Bytes;
+	u64 Offset;
+
+	switch (PatternPtr->Pattern) {
+	case XTG_BENCH_STRIDED:
+		Offset = ((u64)Index * PatternPtr->Stride) % PatternPtr->Span;
+		break;
+	case XTG_BENCH_RANDOM:
+		Offset = (u64)(XTrafGen_BenchRandom(StatePtr) % Slots) * Bytes;
+		break;
+	default:
+		Offset = (u64)(Index % Slots) * Bytes;
+		break;
+	}
+
+	return (UINTPTR)Offset;
+}
+
+/*****************************************************************************/
+/**
+* End a region with an invalid command, the core stops issuing commands of
+* the region there.
+*
+* @param        InstancePtr is a pointer to the Axi TrafGen instance to be
+*               worked on.
+* @param	RdWrFlag specifies a Read or Write Region.
+*
+* @return	Return value of XTrafGen_AddCommand().
+*
+*****************************************************************************/
+static int XTrafGen_BenchEndRegion(XTrafGen *InstancePtr, u8 RdWrFlag)
+{
+	XTrafGen_Cmd Cmd;
+
+	memset(&Cmd, 0, sizeof(Cmd));
+	Cmd.RdWrFlag = RdWrFlag;
+
+	return XTrafGen_AddCommand(InstancePtr, &Cmd);
+}
+/** @} */
@@ -53,6 +53,7 @@
 *                     register and update the error stats.
 * 3.8	gm   09/25/22 Use XUartLite_GetSR instead of accessing status register
 *                     directly.
+* 3.10	fl   10/14/26 Initialize the chained transmit queue.
 *
 * </pre>
 *
@@ -144,6 +145,10 @@ int XUartLite_CfgInitialize(XUartLite *InstancePtr, XUartLite_Config *Config,
 	InstancePtr->RecvHandler = StubHandler;
 	InstancePtr->SendHandler = StubHandler;
 
+	InstancePtr->TxChainHead = NULL;
+	InstancePtr->TxChainTail = NULL;
+	InstancePtr->TxDoneHandler = NULL;
+
 	/* Write to the control register to disable the interrupts, don't
 	 * reset the FIFOs are the user may want the data that's present
 	 */
@@ -129,6 +129,7 @@
 * 		      configured as a TMR SEM fix for CR-1121291, changes are
 * 		      made in the uartlite_tapp.tcl file.
 * 3.9	ht  07/18/23  Fixed GCC warnings.
+* 3.10	fl  10/14/26  Added the chained buffer transmit queue.
 *
 * </pre>
 *
@@ -160,6 +161,27 @@ extern "C" {
  */
 typedef void (*XUartLite_Handler)(void *CallBackRef, unsigned int ByteCount);
 
+/**
+ * Buffer of the chained transmit queue. The driver sends the data in place,
+ * the buffer belongs to the driver from XUartLite_TxChainEnqueue() until it
+ * is passed to the transmit done handler.
+ */
+typedef struct XUartLite_TxBuf {
+	struct XUartLite_TxBuf *Next;	/**< Next buffer, driver use */
+	u8 *DataPtr;			/**< Data to send */
+	unsigned int Length;		/**< Number of bytes to send */
+	unsigned int SentBytes;		/**< Bytes put in the FIFO, driver
+					  *  use */
+} XUartLite_TxBuf;
+
+/**
+ * Transmit done callback of the chained transmit queue, called from the
+ * interrupt handler with each buffer of the queue once all of its bytes are
+ * in the transmit FIFO.
+ */
+typedef void (*XUartLite_TxDoneHandler)(void *CallBackRef,
+				XUartLite_TxBuf *BufPtr);
+
 /**
  * Statistics for the XUartLite driver
  */
@@ -224,6 +246,11 @@ typedef struct {
 	void *RecvCallBackRef;		/* Callback ref for recv handler */
 	XUartLite_Handler SendHandler;
 	void *SendCallBackRef;		/* Callback ref for send handler */
+
+	XUartLite_TxBuf *TxChainHead;	/* Oldest buffer of the TX queue */
+	XUartLite_TxBuf *TxChainTail;	/* Newest buffer of the TX queue */
+	XUartLite_TxDoneHandler TxDoneHandler;
+	void *TxDoneCallBackRef;	/* Callback ref for TX done handler */
 } XUartLite;
 
 
@@ -283,6 +310,11 @@ void XUartLite_SetSendHandler(XUartLite *InstancePtr, XUartLite_Handler FuncPtr,
 
 void XUartLite_InterruptHandler(XUartLite *InstancePtr);
 
+void XUartLite_SetTxDoneHandler(XUartLite *InstancePtr,
+				XUartLite_TxDoneHandler FuncPtr,
+				void *CallBackRef);
+int XUartLite_TxChainEnqueue(XUartLite *InstancePtr, XUartLite_TxBuf *BufPtr);
+
 #ifdef __cplusplus
 }
 #endif
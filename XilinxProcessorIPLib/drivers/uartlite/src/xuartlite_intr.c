@@ -28,6 +28,7 @@
 *		      renamed to remove _m from the name.
 * 3.8	gm   09/25/22 Use XUartLite_GetSR instead of accessing status register
 *                     directly.
+* 3.10	fl   10/14/26 Added the chained buffer transmit queue.
 * </pre>
 *
 *****************************************************************************/
@@ -48,6 +49,7 @@
 
 static void ReceiveDataHandler(XUartLite *InstancePtr);
 static void SendDataHandler(XUartLite *InstancePtr);
+static void TxChainFill(XUartLite *InstancePtr, int FromIsr);
 
 /************************** Variable Definitions ****************************/
 
@@ -157,6 +159,12 @@ void XUartLite_InterruptHandler(XUartLite *InstancePtr)
 		(InstancePtr->SendBuffer.RequestedBytes > 0)) {
 		SendDataHandler(InstancePtr);
 	}
+
+	if (((IsrStatus & XUL_SR_TX_FIFO_EMPTY) != 0) &&
+		(InstancePtr->TxChainHead != NULL)) {
+		TxChainFill(InstancePtr, TRUE);
+		InstancePtr->Stats.TransmitInterrupts++;
+	}
 }
 
 /****************************************************************************/
@@ -250,6 +258,149 @@ static void SendDataHandler(XUartLite *InstancePtr)
 }
 
 
+/****************************************************************************/
+/**
+*
+* This function sets the handler called when a buffer of the chained transmit
+* queue has been sent.
+*
+* @param	InstancePtr is a pointer to the XUartLite instance.
+* @param	FuncPtr is the handler, or NULL to not be notified.
+* @param	CallBackRef is passed to the handler.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartLite_SetTxDoneHandler(XUartLite *InstancePtr,
+				XUartLite_TxDoneHandler FuncPtr,
+				void *CallBackRef)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->TxDoneHandler = FuncPtr;
+	InstancePtr->TxDoneCallBackRef = CallBackRef;
+}
+
+/****************************************************************************/
+/**
+*
+* This function adds a buffer to the chained transmit queue and returns
+* without waiting. The interrupt handler refills the transmit FIFO from the
+* queue on every transmit FIFO empty interrupt, across buffer boundaries, so
+* any number of buffers is sent with one interrupt per FIFO of data.
+*
+* @param	InstancePtr is a pointer to the XUartLite instance.
+* @param	BufPtr is the buffer to send. DataPtr and Length must be set,
+*		the data is not copied.
+*
+* @return
+*		- XST_SUCCESS if the buffer was queued.
+*		- XST_DEVICE_BUSY if a XUartLite_Send() transfer is in
+*		  progress.
+*
+* @note		The queue works in interrupt mode only. Buffers are passed to
+*		the transmit done handler in order.
+*
+*****************************************************************************/
+int XUartLite_TxChainEnqueue(XUartLite *InstancePtr, XUartLite_TxBuf *BufPtr)
+{
+	u8 StatusRegister;
+	int Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(BufPtr != NULL);
+	Xil_AssertNonvoid(BufPtr->DataPtr != NULL);
+	Xil_AssertNonvoid(BufPtr->Length > 0);
+
+	BufPtr->Next = NULL;
+	BufPtr->SentBytes = 0;
+
+	/*
+	 * Enter a critical region by disabling the UART interrupts, the
+	 * queue is shared with the interrupt handler
+	 */
+	StatusRegister = XUartLite_GetSR(InstancePtr);
+	XUartLite_WriteReg(InstancePtr->RegBaseAddress,
+				XUL_CONTROL_REG_OFFSET, 0);
+
+	if (InstancePtr->SendBuffer.RequestedBytes > 0) {
+		Status = XST_DEVICE_BUSY;
+	} else if (InstancePtr->TxChainHead == NULL) {
+		InstancePtr->TxChainHead = BufPtr;
+		InstancePtr->TxChainTail = BufPtr;
+
+		/* Start the transmitter, the interrupt continues from here */
+		TxChainFill(InstancePtr, FALSE);
+	} else {
+		InstancePtr->TxChainTail->Next = BufPtr;
+		InstancePtr->TxChainTail = BufPtr;
+	}
+
+	StatusRegister &= XUL_CR_ENABLE_INTR;
+	XUartLite_WriteReg(InstancePtr->RegBaseAddress,
+				XUL_CONTROL_REG_OFFSET, StatusRegister);
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* This function fills the transmit FIFO from the chained transmit queue.
+*
+* @param	InstancePtr is a pointer to the XUartLite instance.
+* @param	FromIsr is TRUE when called from the interrupt handler.
+*
+* @return	None.
+*
+* @note		Buffers are completed from the interrupt handler only, a
+*		buffer emptied when the transmitter is started stays at the
+*		head of the queue until the next transmit FIFO empty
+*		interrupt.
+*
+*****************************************************************************/
+static void TxChainFill(XUartLite *InstancePtr, int FromIsr)
+{
+	XUartLite_TxBuf *BufPtr;
+	unsigned int SentCount = 0;
+
+	while (InstancePtr->TxChainHead != NULL) {
+		BufPtr = InstancePtr->TxChainHead;
+
+		if (BufPtr->SentBytes == BufPtr->Length) {
+			if (!FromIsr) {
+				break;
+			}
+
+			InstancePtr->TxChainHead = BufPtr->Next;
+			if (InstancePtr->TxChainHead == NULL) {
+				InstancePtr->TxChainTail = NULL;
+			}
+			if (InstancePtr->TxDoneHandler != NULL) {
+				InstancePtr->TxDoneHandler(
+					InstancePtr->TxDoneCallBackRef, BufPtr);
+			}
+			continue;
+		}
+
+		if ((XUartLite_GetSR(InstancePtr) & XUL_SR_TX_FIFO_FULL) != 0) {
+			break;
+		}
+
+		XUartLite_WriteReg(InstancePtr->RegBaseAddress,
+				XUL_TX_FIFO_OFFSET,
+				BufPtr->DataPtr[BufPtr->SentBytes]);
+		BufPtr->SentBytes++;
+		SentCount++;
+	}
+
+	InstancePtr->Stats.CharactersTransmitted += SentCount;
+}
+
 /*****************************************************************************/
 /**
 *
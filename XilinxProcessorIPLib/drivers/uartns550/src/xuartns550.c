@@ -44,6 +44,7 @@
 * 3.4   sk   11/10/15 Used UINTPTR instead of u32 for Baseaddress CR# 867425.
 *                     Changed the prototype of XUartNs550_CfgInitialize API.
 * 3.7   sd   03/02/20 Update the macro names.
+* 3.10  fl   10/14/26 Initialize the chained transmit queue.
 * </pre>
 *
 *****************************************************************************/
@@ -137,6 +138,10 @@ int XUartNs550_CfgInitialize(XUartNs550 *InstancePtr,
 	 */
 	InstancePtr->Handler = XUartNs550_StubHandler;
 
+	InstancePtr->TxChainHead = NULL;
+	InstancePtr->TxChainTail = NULL;
+	InstancePtr->TxDoneHandler = NULL;
+
 	InstancePtr->SendBuffer.NextBytePtr = NULL;
 	InstancePtr->SendBuffer.RemainingBytes = 0;
 	InstancePtr->SendBuffer.RequestedBytes = 0;
@@ -150,6 +150,7 @@
 * 3.5   ms   04/18/17 Modified tcl file to add suffix U for all macros
 *                     definitions of uartns550 in xparameters.h
 * 3.9   gm   07/09/23 Added SDT support
+* 3.10  fl   10/14/26 Added the chained buffer transmit queue.
 * </pre>
 *
 *****************************************************************************/
@@ -349,6 +350,33 @@ typedef struct {
 typedef void (*XUartNs550_Handler)(void *CallBackRef, u32 Event,
 					unsigned int EventData);
 
+/**
+ * Buffer of the chained transmit queue. The driver sends the data in place,
+ * the buffer belongs to the driver from XUartNs550_TxChainEnqueue() until it
+ * is passed to the transmit done handler.
+ */
+typedef struct XUartNs550TxBuf {
+	struct XUartNs550TxBuf *Next;	/**< Next buffer, driver use */
+	u8 *DataPtr;			/**< Data to send */
+	unsigned int Length;		/**< Number of bytes to send */
+	unsigned int SentBytes;		/**< Bytes put in the FIFO, driver
+					  *  use */
+} XUartNs550TxBuf;
+
+/*****************************************************************************/
+/**
+* This data type defines the transmit done handler of the chained transmit
+* queue. It is called from the interrupt handler with each buffer of the
+* queue once all of its bytes are in the transmit FIFO.
+*
+* @param	CallBackRef is a callback reference passed in by the upper layer
+*		when setting the handler.
+* @param	BufPtr is the buffer that has been sent.
+*
+*****************************************************************************/
+typedef void (*XUartNs550_TxDoneHandler)(void *CallBackRef,
+					XUartNs550TxBuf *BufPtr);
+
 /**
  * UART statistics
  */
@@ -384,6 +412,11 @@ typedef struct {
 
 	XUartNs550_Handler Handler; /**< Call back handler */
 	void *CallBackRef;	/* Callback reference for control handler */
+
+	XUartNs550TxBuf *TxChainHead;	/**< Oldest buffer of the TX queue */
+	XUartNs550TxBuf *TxChainTail;	/**< Newest buffer of the TX queue */
+	XUartNs550_TxDoneHandler TxDoneHandler; /**< TX done handler */
+	void *TxDoneCallBackRef;	/**< Callback ref for TX done handler */
 } XUartNs550;
 
 /***************** Macros (Inline Functions) Definitions ********************/
@@ -443,6 +476,12 @@ void XUartNs550_SetHandler(XUartNs550 *InstancePtr, XUartNs550_Handler FuncPtr,
 
 void XUartNs550_InterruptHandler(XUartNs550 *InstancePtr);
 
+void XUartNs550_SetTxDoneHandler(XUartNs550 *InstancePtr,
+				XUartNs550_TxDoneHandler FuncPtr,
+				void *CallBackRef);
+int XUartNs550_TxChainEnqueue(XUartNs550 *InstancePtr,
+				XUartNs550TxBuf *BufPtr);
+
 /*
  * Statistics functions in xuartns550_stats.c
  */
@@ -34,6 +34,7 @@
 *		      data is equal to the threshold).
 *		      The callback function with XUN_EVENT_RECV_DATA will be
 *		      called when all the requested data has been received
+* 3.10  fl   10/14/26 Added the chained buffer transmit queue.
 * </pre>
 *
 *****************************************************************************/
@@ -58,6 +59,7 @@ static void ReceiveTimeoutHandler(XUartNs550 *InstancePtr);
 static void ReceiveDataHandler(XUartNs550 *InstancePtr);
 static void SendDataHandler(XUartNs550 *InstancePtr);
 static void ModemHandler(XUartNs550 *InstancePtr);
+static void TxChainFill(XUartNs550 *InstancePtr, int FromIsr);
 
 /************************** Variable Definitions ****************************/
 
@@ -374,6 +376,16 @@ static void SendDataHandler(XUartNs550 *InstancePtr)
 {
 	u32 IerRegister;
 
+	/*
+	 * The chained transmit queue refills the FIFO across its buffers and
+	 * disables the transmit interrupt itself once it is empty
+	 */
+	if (InstancePtr->TxChainHead != NULL) {
+		TxChainFill(InstancePtr, TRUE);
+		InstancePtr->Stats.TransmitInterrupts++;
+		return;
+	}
+
 	/*
 	 * If there are not bytes to be sent from the specified buffer then
 	 * disable the transmit interrupt so it will stop interrupting as it
@@ -409,6 +421,200 @@ static void SendDataHandler(XUartNs550 *InstancePtr)
 	InstancePtr->Stats.TransmitInterrupts++;
 }
 
+/****************************************************************************/
+/**
+*
+* This function sets the handler called when a buffer of the chained transmit
+* queue has been sent.
+*
+* @param	InstancePtr is a pointer to the XUartNs550 instance.
+* @param	FuncPtr is the handler, or NULL to not be notified.
+* @param	CallBackRef is passed to the handler.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartNs550_SetTxDoneHandler(XUartNs550 *InstancePtr,
+				XUartNs550_TxDoneHandler FuncPtr,
+				void *CallBackRef)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->TxDoneHandler = FuncPtr;
+	InstancePtr->TxDoneCallBackRef = CallBackRef;
+}
+
+/****************************************************************************/
+/**
+*
+* This function adds a buffer to the chained transmit queue and returns
+* without waiting. The interrupt handler refills the transmit FIFO from the
+* queue on every transmitter empty interrupt, across buffer boundaries, so
+* any number of buffers is sent with one interrupt per FIFO of data.
+*
+* @param	InstancePtr is a pointer to the XUartNs550 instance.
+* @param	BufPtr is the buffer to send. DataPtr and Length must be set,
+*		the data is not copied.
+*
+* @return
+*		- XST_SUCCESS if the buffer was queued.
+*		- XST_DEVICE_BUSY if a XUartNs550_Send() transfer is in
+*		  progress.
+*
+* @note		The queue works in interrupt mode only, with the data
+*		interrupts enabled by XUN_OPTION_DATA_INTR. Buffers are passed
+*		to the transmit done handler in order.
+*
+*****************************************************************************/
+int XUartNs550_TxChainEnqueue(XUartNs550 *InstancePtr,
+				XUartNs550TxBuf *BufPtr)
+{
+	u32 IerRegister;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(BufPtr != NULL);
+	Xil_AssertNonvoid(BufPtr->DataPtr != NULL);
+	Xil_AssertNonvoid(BufPtr->Length > 0);
+
+	BufPtr->Next = NULL;
+	BufPtr->SentBytes = 0;
+
+	/*
+	 * Enter a critical region by disabling the transmit interrupt, the
+	 * queue is shared with the transmit interrupt only
+	 */
+	IerRegister = XUartNs550_ReadReg(InstancePtr->BaseAddress,
+						XUN_IER_OFFSET);
+	XUartNs550_WriteReg(InstancePtr->BaseAddress, XUN_IER_OFFSET,
+				IerRegister & ~XUN_IER_TX_EMPTY);
+
+	if (InstancePtr->SendBuffer.RemainingBytes != 0) {
+		XUartNs550_WriteReg(InstancePtr->BaseAddress, XUN_IER_OFFSET,
+					IerRegister);
+		return XST_DEVICE_BUSY;
+	}
+
+	if (InstancePtr->TxChainHead == NULL) {
+		InstancePtr->TxChainHead = BufPtr;
+		InstancePtr->TxChainTail = BufPtr;
+
+		/* Start the transmitter, the interrupt continues from here */
+		TxChainFill(InstancePtr, FALSE);
+	} else {
+		InstancePtr->TxChainTail->Next = BufPtr;
+		InstancePtr->TxChainTail = BufPtr;
+	}
+
+	/*
+	 * Exit the critical region with the transmit interrupt enabled when
+	 * interrupts are in use, as indicated by the receive interrupt
+	 */
+	if (IerRegister & XUN_IER_RX_DATA) {
+		IerRegister |= XUN_IER_TX_EMPTY;
+	}
+	XUartNs550_WriteReg(InstancePtr->BaseAddress, XUN_IER_OFFSET,
+				IerRegister);
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function fills the transmit FIFO from the chained transmit queue.
+*
+* @param	InstancePtr is a pointer to the XUartNs550 instance.
+* @param	FromIsr is TRUE when called from the interrupt handler.
+*
+* @return	None.
+*
+* @note		Buffers are completed from the interrupt handler only, a
+*		buffer emptied when the transmitter is started stays at the
+*		head of the queue until the next transmitter empty interrupt.
+*		The transmit interrupt is disabled once the queue is empty.
+*
+*****************************************************************************/
+static void TxChainFill(XUartNs550 *InstancePtr, int FromIsr)
+{
+	XUartNs550TxBuf *BufPtr;
+	unsigned int SentCount = 0;
+	unsigned int Room = 0;
+	int WasLast = FALSE;
+	u32 LsrRegister;
+	u32 IerRegister;
+
+	LsrRegister = XUartNs550_GetLineStatusReg(InstancePtr->BaseAddress);
+	if (LsrRegister & XUN_LSR_TX_BUFFER_EMPTY) {
+		/*
+		 * A FIFO of size N holds N - 1 bytes plus the transmitter
+		 * register, without FIFOs only one byte can be written
+		 */
+		if (XUartNs550_ReadReg(InstancePtr->BaseAddress,
+				XUN_IIR_OFFSET) & XUN_INT_ID_FIFOS_ENABLED) {
+			Room = (LsrRegister & XUN_LSR_TX_EMPTY) ?
+				XUN_FIFO_SIZE : (XUN_FIFO_SIZE - 1);
+		} else {
+			Room = 1;
+		}
+	}
+
+	while (InstancePtr->TxChainHead != NULL) {
+		BufPtr = InstancePtr->TxChainHead;
+
+		if (BufPtr->SentBytes == BufPtr->Length) {
+			if (!FromIsr) {
+				break;
+			}
+
+			InstancePtr->TxChainHead = BufPtr->Next;
+			if (InstancePtr->TxChainHead == NULL) {
+				InstancePtr->TxChainTail = NULL;
+				WasLast = TRUE;
+			}
+			if (InstancePtr->TxDoneHandler != NULL) {
+				InstancePtr->TxDoneHandler(
+					InstancePtr->TxDoneCallBackRef, BufPtr);
+			}
+
+			/*
+			 * A buffer queued by the handler into the empty queue
+			 * has started the transmitter itself, the room read
+			 * above is gone
+			 */
+			if (WasLast && (InstancePtr->TxChainHead != NULL)) {
+				break;
+			}
+			continue;
+		}
+
+		if (SentCount == Room) {
+			break;
+		}
+
+		XUartNs550_WriteReg(InstancePtr->BaseAddress, XUN_THR_OFFSET,
+					BufPtr->DataPtr[BufPtr->SentBytes]);
+		BufPtr->SentBytes++;
+		SentCount++;
+	}
+
+	InstancePtr->Stats.CharactersTransmitted += SentCount;
+
+	/*
+	 * The transmitter empty interrupt occurs whenever the FIFO is empty,
+	 * stop it once there is nothing left to send
+	 */
+	if (FromIsr && (InstancePtr->TxChainHead == NULL)) {
+		IerRegister = XUartNs550_ReadReg(InstancePtr->BaseAddress,
+							XUN_IER_OFFSET);
+		XUartNs550_WriteReg(InstancePtr->BaseAddress, XUN_IER_OFFSET,
+					IerRegister & ~XUN_IER_TX_EMPTY);
+	}
+}
+
 /****************************************************************************/
 /**
 *
@@ -27,6 +27,7 @@
 * 3.5	NK     09/26/17 Fix the RX Buffer Overflow issue.
 * 3.7   aru    08/17/18 Resolved MISRA-C mandatory violations.(CR#1007755)
 * 3.9   sd     02/06/20 Added clock support
+* 3.14  fl     10/14/26 Ring mode is disabled at initialization.
 * </pre>
 *
 *****************************************************************************/
@@ -145,6 +146,8 @@ s32 XUartPs_CfgInitialize(XUartPs *InstancePtr,
 
 	InstancePtr->is_rxbs_error = 0U;
 
+	InstancePtr->RingMode = 0U;
+
 	/* Flag that the driver instance is ready to use */
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
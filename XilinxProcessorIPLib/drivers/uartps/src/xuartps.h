@@ -150,6 +150,7 @@
 * 3.9   sd     02/06/20 Added clock support
 * 3.12	gm     11/04/22 Added timeout support using Xil_WaitForEvent
 * 3.13	adk    14/04/23 Added support for system device-tree flow.
+* 3.14	fl     10/14/26 Added the RX and TX ring mode.
 *
 * </pre>
 *
@@ -300,6 +301,18 @@ typedef struct {
 	u32 RemainingBytes;
 } XUartPsBuffer;
 
+/**
+ * Lock free ring of the ring mode. Head is written by the producer and Tail
+ * by the consumer only, both are free running and the size is a power of
+ * two.
+ */
+typedef struct {
+	u8 *BufferPtr;	/**< Ring storage */
+	u32 Mask;	/**< Ring size minus 1 */
+	u32 Head;	/**< Bytes written to the ring */
+	u32 Tail;	/**< Bytes read from the ring */
+} XUartPsRing;
+
 /**
  * Keep track of data format setting of a device.
  */
@@ -347,6 +360,12 @@ typedef struct {
 	void *CallBackRef;	/* Callback reference for event handler */
 	u32 Platform;
 	u8 is_rxbs_error;
+
+	u8 RingMode;		/* Ring mode enabled */
+	XUartPsRing RxRing;	/* Receive ring, filled by the ISR */
+	XUartPsRing TxRing;	/* Transmit ring, drained by the ISR */
+	u32 RxRingOverrun;	/* Bytes dropped because the RX ring was full */
+	u32 RxFifoOverrun;	/* RX FIFO overrun errors */
 } XUartPs;
 
 
@@ -512,6 +531,18 @@ void XUartPs_InterruptHandler(XUartPs *InstancePtr);
 void XUartPs_SetHandler(XUartPs *InstancePtr, XUartPs_Handler FuncPtr,
 			 void *CallBackRef);
 
+s32 XUartPs_RingInit(XUartPs *InstancePtr, u8 *RxBufPtr, u32 RxSize,
+			 u8 *TxBufPtr, u32 TxSize);
+
+void XUartPs_RingStop(XUartPs *InstancePtr);
+
+u32 XUartPs_RingRead(XUartPs *InstancePtr, u8 *BufferPtr, u32 NumBytes);
+
+u32 XUartPs_RingWrite(XUartPs *InstancePtr, const u8 *BufferPtr,
+			 u32 NumBytes);
+
+u32 XUartPs_RingRxLevel(XUartPs *InstancePtr);
+
 /* self-test functions in xuartps_selftest.c */
 s32 XUartPs_SelfTest(XUartPs *InstancePtr);
 
@@ -22,6 +22,7 @@
 * 3.00  kvn    02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.1	kvn    04/10/15 Modified code for latest RTL changes.
 * 3.7   aru    08/17/18 Resolved MISRA-C mandatory violations.(CR#1007755)
+* 3.14  fl     10/14/26 Added the RX and TX ring mode.
 * </pre>
 *
 *****************************************************************************/
@@ -32,6 +33,10 @@
 
 /************************** Constant Definitions ****************************/
 
+/* Interrupts of the ring mode, the TX interrupt is enabled by the writer */
+#define XUARTPS_RING_RX_IXR	((u32)XUARTPS_IXR_RXOVR | (u32)XUARTPS_IXR_RXFULL | \
+				 (u32)XUARTPS_IXR_TOUT | (u32)XUARTPS_IXR_OVER)
+
 /**************************** Type Definitions ******************************/
 
 /***************** Macros (Inline Functions) Definitions ********************/
@@ -43,6 +48,8 @@ static void SendDataHandler(XUartPs *InstancePtr, u32 IsrStatus);
 static void ReceiveErrorHandler(XUartPs *InstancePtr, u32 IsrStatus);
 static void ReceiveTimeoutHandler(XUartPs *InstancePtr);
 static void ModemHandler(XUartPs *InstancePtr);
+static void RingReceiveHandler(XUartPs *InstancePtr, u32 IsrStatus);
+static void RingSendHandler(XUartPs *InstancePtr);
 
 
 /* Internal function prototypes implemented in xuartps.c */
@@ -174,6 +181,20 @@ void XUartPs_InterruptHandler(XUartPs *InstancePtr)
 	IsrStatus &= XUartPs_ReadReg(InstancePtr->Config.BaseAddress,
 				   XUARTPS_ISR_OFFSET);
 
+	if (InstancePtr->RingMode != 0U) {
+		/* Clear first, a FIFO refilled meanwhile interrupts again */
+		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XUARTPS_ISR_OFFSET, IsrStatus);
+
+		if ((IsrStatus & XUARTPS_RING_RX_IXR) != (u32)0) {
+			RingReceiveHandler(InstancePtr, IsrStatus);
+		}
+		if ((IsrStatus & (u32)XUARTPS_IXR_TXEMPTY) != (u32)0) {
+			RingSendHandler(InstancePtr);
+		}
+		return;
+	}
+
 	/* Dispatch an appropriate handler. */
 	if((IsrStatus & ((u32)XUARTPS_IXR_RXOVR | (u32)XUARTPS_IXR_RXEMPTY |
 			(u32)XUARTPS_IXR_RXFULL)) != (u32)0) {
@@ -423,4 +444,316 @@ static void ModemHandler(XUartPs *InstancePtr)
 				  MsrRegister);
 
 }
+
+/****************************************************************************/
+/**
+*
+* This function starts the ring mode. The interrupt handler then moves every
+* received byte into the RX ring, and sends the bytes of the TX ring, until
+* XUartPs_RingStop() is called. XUartPs_Send() and XUartPs_Recv() must not be
+* used in ring mode.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	RxBufPtr is the storage of the RX ring.
+* @param	RxSize is the size of the RX ring, a power of two.
+* @param	TxBufPtr is the storage of the TX ring, or NULL for no TX ring.
+* @param	TxSize is the size of the TX ring, a power of two, unless
+*		TxBufPtr is NULL.
+*
+* @return
+*		- XST_SUCCESS if the ring mode was started.
+*		- XST_INVALID_PARAM if a size is not a power of two.
+*
+* @note		The RX FIFO is drained when it reaches the threshold set with
+*		XUartPs_SetFifoThreshold() and when the receive timeout set
+*		with XUartPs_SetRecvTimeout() expires, so the timeout must not
+*		be 0. The handler is called with XUARTPS_EVENT_RECV_DATA and the
+*		number of bytes added to the RX ring, and with
+*		XUARTPS_EVENT_RECV_ORERR on an RX FIFO overrun.
+*
+*****************************************************************************/
+s32 XUartPs_RingInit(XUartPs *InstancePtr, u8 *RxBufPtr, u32 RxSize,
+			 u8 *TxBufPtr, u32 TxSize)
+{
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(RxBufPtr != NULL);
+
+	if ((RxSize == (u32)0) || ((RxSize & (RxSize - (u32)1)) != (u32)0)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+	if ((TxBufPtr != NULL) && ((TxSize == (u32)0) ||
+			((TxSize & (TxSize - (u32)1)) != (u32)0))) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	XUartPs_SetInterruptMask(InstancePtr, 0U);
+
+	InstancePtr->RxRing.BufferPtr = RxBufPtr;
+	InstancePtr->RxRing.Mask = RxSize - (u32)1;
+	InstancePtr->RxRing.Head = 0U;
+	InstancePtr->RxRing.Tail = 0U;
+
+	InstancePtr->TxRing.BufferPtr = TxBufPtr;
+	InstancePtr->TxRing.Mask = (TxBufPtr != NULL) ? (TxSize - (u32)1) : 0U;
+	InstancePtr->TxRing.Head = 0U;
+	InstancePtr->TxRing.Tail = 0U;
+
+	InstancePtr->RxRingOverrun = 0U;
+	InstancePtr->RxFifoOverrun = 0U;
+	InstancePtr->RingMode = 1U;
+
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_ISR_OFFSET,
+			XUARTPS_IXR_MASK);
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_IER_OFFSET,
+			XUARTPS_RING_RX_IXR);
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function stops the ring mode and disables the interrupts.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	None.
+*
+* @note		Bytes left in the rings are discarded.
+*
+*****************************************************************************/
+void XUartPs_RingStop(XUartPs *InstancePtr)
+{
+	/* Assert validates the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	XUartPs_SetInterruptMask(InstancePtr, 0U);
+	InstancePtr->RingMode = 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the number of bytes waiting in the RX ring.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	Number of bytes XUartPs_RingRead() can read.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XUartPs_RingRxLevel(XUartPs *InstancePtr)
+{
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	return __atomic_load_n(&InstancePtr->RxRing.Head, __ATOMIC_ACQUIRE) -
+		InstancePtr->RxRing.Tail;
+}
+
+/****************************************************************************/
+/**
+*
+* This function reads received bytes from the RX ring. It does not block and
+* does not lock, it may run concurrently with the interrupt handler.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	BufferPtr is filled with the received bytes.
+* @param	NumBytes is the size of the buffer.
+*
+* @return	Number of bytes read, 0 if the ring is empty.
+*
+* @note		Only one context may read the RX ring.
+*
+*****************************************************************************/
+u32 XUartPs_RingRead(XUartPs *InstancePtr, u8 *BufferPtr, u32 NumBytes)
+{
+	XUartPsRing *RingPtr;
+	u32 Head;
+	u32 Tail;
+	u32 Count;
+	u32 Index;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->RingMode != 0U);
+
+	RingPtr = &InstancePtr->RxRing;
+	Head = __atomic_load_n(&RingPtr->Head, __ATOMIC_ACQUIRE);
+	Tail = RingPtr->Tail;
+	Count = Head - Tail;
+	if (Count > NumBytes) {
+		Count = NumBytes;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		BufferPtr[Index] = RingPtr->BufferPtr[(Tail + Index) &
+						      RingPtr->Mask];
+	}
+
+	/* The bytes are copied before the slots are returned to the ISR */
+	__atomic_store_n(&RingPtr->Tail, Tail + Count, __ATOMIC_RELEASE);
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* This function queues bytes in the TX ring and starts the transmitter. It
+* does not block and does not lock, it may run concurrently with the
+* interrupt handler.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	BufferPtr is the bytes to send.
+* @param	NumBytes is the number of bytes to send.
+*
+* @return	Number of bytes queued, less than NumBytes when the ring is
+*		full.
+*
+* @note		Only one context may write the TX ring.
+*
+*****************************************************************************/
+u32 XUartPs_RingWrite(XUartPs *InstancePtr, const u8 *BufferPtr,
+			 u32 NumBytes)
+{
+	XUartPsRing *RingPtr;
+	u32 Head;
+	u32 Tail;
+	u32 Count;
+	u32 Index;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->RingMode != 0U);
+	Xil_AssertNonvoid(InstancePtr->TxRing.BufferPtr != NULL);
+
+	RingPtr = &InstancePtr->TxRing;
+	Head = RingPtr->Head;
+	Tail = __atomic_load_n(&RingPtr->Tail, __ATOMIC_ACQUIRE);
+	Count = (RingPtr->Mask + (u32)1) - (Head - Tail);
+	if (Count > NumBytes) {
+		Count = NumBytes;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		RingPtr->BufferPtr[(Head + Index) & RingPtr->Mask] =
+			BufferPtr[Index];
+	}
+	__atomic_store_n(&RingPtr->Head, Head + Count, __ATOMIC_RELEASE);
+
+	/*
+	 * Enable the TX empty interrupt after the bytes are published, the
+	 * handler checks the ring again after disabling it, so the ring is
+	 * never left with bytes and the interrupt disabled.
+	 */
+	if (Count != (u32)0) {
+		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XUARTPS_IER_OFFSET, XUARTPS_IXR_TXEMPTY);
+	}
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* This function drains the RX FIFO into the RX ring in the ring mode. The
+* head is published once per interrupt.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	IsrStatus is the interrupt status being handled.
+*
+* @return	None.
+*
+* @note		Bytes received while the ring is full are dropped and counted
+*		in RxRingOverrun.
+*
+*****************************************************************************/
+static void RingReceiveHandler(XUartPs *InstancePtr, u32 IsrStatus)
+{
+	XUartPsRing *RingPtr = &InstancePtr->RxRing;
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 Head = RingPtr->Head;
+	u32 Tail;
+	u32 Added;
+	u8 Byte;
+
+	Tail = __atomic_load_n(&RingPtr->Tail, __ATOMIC_ACQUIRE);
+
+	while (XUartPs_IsReceiveData(BaseAddress)) {
+		Byte = (u8)XUartPs_ReadReg(BaseAddress, XUARTPS_FIFO_OFFSET);
+		if ((Head - Tail) > RingPtr->Mask) {
+			/* Full, the reader may have freed slots meanwhile */
+			Tail = __atomic_load_n(&RingPtr->Tail,
+					__ATOMIC_ACQUIRE);
+			if ((Head - Tail) > RingPtr->Mask) {
+				InstancePtr->RxRingOverrun++;
+				continue;
+			}
+		}
+		RingPtr->BufferPtr[Head & RingPtr->Mask] = Byte;
+		Head++;
+	}
+
+	Added = Head - RingPtr->Head;
+	__atomic_store_n(&RingPtr->Head, Head, __ATOMIC_RELEASE);
+
+	if ((IsrStatus & (u32)XUARTPS_IXR_OVER) != (u32)0) {
+		InstancePtr->RxFifoOverrun++;
+		InstancePtr->Handler(InstancePtr->CallBackRef,
+				XUARTPS_EVENT_RECV_ORERR,
+				InstancePtr->RxFifoOverrun);
+	}
+
+	if (Added != (u32)0) {
+		InstancePtr->Handler(InstancePtr->CallBackRef,
+				XUARTPS_EVENT_RECV_DATA, Added);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function fills the TX FIFO from the TX ring in the ring mode, and
+* disables the TX empty interrupt once the ring is empty.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void RingSendHandler(XUartPs *InstancePtr)
+{
+	XUartPsRing *RingPtr = &InstancePtr->TxRing;
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 Tail = RingPtr->Tail;
+	u32 Head;
+
+	Head = __atomic_load_n(&RingPtr->Head, __ATOMIC_ACQUIRE);
+	while ((Tail != Head) && (!XUartPs_IsTransmitFull(BaseAddress))) {
+		XUartPs_WriteReg(BaseAddress, XUARTPS_FIFO_OFFSET,
+				RingPtr->BufferPtr[Tail & RingPtr->Mask]);
+		Tail++;
+	}
+	__atomic_store_n(&RingPtr->Tail, Tail, __ATOMIC_RELEASE);
+
+	if (Tail == Head) {
+		XUartPs_WriteReg(BaseAddress, XUARTPS_IDR_OFFSET,
+				XUARTPS_IXR_TXEMPTY);
+
+		/* Bytes queued after the head was read re-enable it */
+		if (__atomic_load_n(&RingPtr->Head, __ATOMIC_ACQUIRE) != Tail) {
+			XUartPs_WriteReg(BaseAddress, XUARTPS_IER_OFFSET,
+					XUARTPS_IXR_TXEMPTY);
+		}
+	}
+}
 /** @} */
@@ -94,6 +94,7 @@
 * 1.10	pm    08/30/21 Update MACRO to fix plm compilation warnings
 * 1.13	pm    01/05/23 Added "xil_util.h" header to use polling logic API
 * 1.14	pm    21/06/23 Added support for system device-tree flow.
+* 1.15	fl    10/14/26 Added TRB ring mode for bulk and interrupt endpoints.
 *
 * </pre>
 *
@@ -189,6 +190,8 @@ extern "C" {
 /**< EP status pending request */
 #define XUSBPSU_EP_MISSED_ISOC		(0x00000001U << 6U)
 /**< EP status missed ISOC */
+#define XUSBPSU_EP_RING			(0x00000001U << 7U)
+/**< EP status TRB ring mode */
 
 #define	XUSBPSU_GHWPARAMS0		0U	/**< Global Hardware Parameter Register 0 */
 #define	XUSBPSU_GHWPARAMS1		1U	/**< Global Hardware Parameter Register 1 */
@@ -480,6 +483,8 @@ struct XUsbPsu_Ep {
 				 */
 	u8	Direction;	/**< Direction - EP_DIR_OUT/EP_DIR_IN */
 	u8	UnalignedTx;	/**< Unaligned Tx flag - 0/1 */
+	u32	RingLen[NO_OF_TRB_PER_EP]; /**< Size of each TRB in ring mode */
+	u32	RingCount;	/**< TRBs owned by the core in ring mode */
 }; /**< Endpoint representation */
 
 /**
@@ -922,6 +927,14 @@ s32 XUsbPsu_IsEpStalled(struct XUsbPsu *InstancePtr, u8 Epnum, u8 Dir);
 void XUsbPsu_StopTransfer(struct XUsbPsu *InstancePtr, u8 UsbEpNum,
 			  u8 Dir, u8 Force);
 
+/*
+ * Functions in xusbpsu_ring.c
+ */
+s32 XUsbPsu_EpRingEnable(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir);
+s32 XUsbPsu_EpRingDisable(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir);
+s32 XUsbPsu_EpRingQueue(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir,
+			u8 *BufferPtr, u32 Length, u8 Ioc);
+
 /*
  * Functions in xusbpsu_intr.c
  */
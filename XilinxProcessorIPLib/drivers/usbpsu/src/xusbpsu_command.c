@@ -21,6 +21,8 @@
 * 1.8	pm  24/07/20 Fixed MISRA-C and Coverity warnings
 * 1.10	pm  24/07/21 Fixed MISRA-C and Coverity warnings
 * 1.12	pm  10/08/22 Update doxygen tag and addtogroup version
+* 1.15	fl  10/14/26 Reset the TRB ring count in XUsbPsu_EpEnable and
+*		     XUsbPsu_EpDisable
 *
 * </pre>
 *
@@ -110,6 +112,7 @@ s32 XUsbPsu_EpEnable(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir,
 	if (InstancePtr->IsHibernated == (u8)FALSE) {
 		Ept->TrbEnqueue	= 0U;
 		Ept->TrbDequeue	= 0U;
+		Ept->RingCount	= 0U;
 	}
 
 	if (((Ept->EpStatus & XUSBPSU_EP_ENABLED) == 0U)
@@ -208,6 +211,7 @@ s32 XUsbPsu_EpDisable(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir)
 	Ept->MaxSize = 0U;
 	Ept->TrbEnqueue	= 0U;
 	Ept->TrbDequeue	= 0U;
+	Ept->RingCount	= 0U;
 
 	return (s32)XST_SUCCESS;
 }
@@ -28,6 +28,7 @@
 * 1.7 	pm  23/03/20 Restructured the code for more readability and modularity
 * 1.8	pm  24/07/20 Fixed MISRA-C and Coverity warnings
 * 1.12	pm  10/08/22 Update doxygen tag and addtogroup version
+* 1.15	fl  10/14/26 Enable XferInProgress events in TRB ring mode
 *
 * </pre>
 *
@@ -196,6 +197,11 @@ s32 XUsbPsu_SetEpConfig(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir,
 		Params->Param1 |= XUSBPSU_DEPCFG_XFER_IN_PROGRESS_EN;
 	}
 
+	/* Completions of a TRB ring are reported as in progress */
+	if ((Ept->EpStatus & XUSBPSU_EP_RING) != 0U) {
+		Params->Param1 |= XUSBPSU_DEPCFG_XFER_IN_PROGRESS_EN;
+	}
+
 	return XUsbPsu_SendEpCmd(InstancePtr, UsbEpNum, Dir,
 				 XUSBPSU_DEPCMD_SETEPCONFIG,
 				 Params);
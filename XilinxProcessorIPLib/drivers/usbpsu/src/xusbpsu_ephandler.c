@@ -20,6 +20,7 @@
 * 1.0   pm  03/23/20 First release
 * 1.8	pm  24/07/20 Fixed MISRA-C and Coverity warnings
 * 1.12	pm  10/08/22 Update doxygen tag and addtogroup version
+* 1.15	fl  10/14/26 Reap the completions of TRB ring endpoints
 *
 * </pre>
 *
@@ -679,6 +680,12 @@ void XUsbPsu_EpXferComplete(struct XUsbPsu *InstancePtr,
 
 	Epnum = Event->Epnumber;
 	Ept = &InstancePtr->eps[Epnum];
+
+	if ((Ept->EpStatus & XUSBPSU_EP_RING) != 0U) {
+		XUsbPsu_EpRingReap(InstancePtr, Ept, Event);
+		return;
+	}
+
 	Dir = Ept->Direction;
 	TrbPtr = &Ept->EpTrb[Ept->TrbDequeue];
 
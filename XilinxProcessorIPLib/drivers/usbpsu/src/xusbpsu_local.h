@@ -20,6 +20,7 @@
 * ----- -----  -------- -----------------------------------------------------
 * 1.0   pm    03/23/20 First release
 * 1.9   pm    03/15/21 Fixed doxygen warnings
+* 1.15  fl    10/14/26 Added XUsbPsu_EpRingReap
 *
 * </pre>
 *
@@ -97,6 +98,12 @@ s32 XUsbPsu_SetXferResource(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir);
 void XUsbPsu_ClearStallAllEp(struct XUsbPsu *InstancePtr);
 void XUsbPsu_StopActiveTransfers(struct XUsbPsu *InstancePtr);
 
+/*
+ * Functions in xusbpsu_ring.c
+ */
+void XUsbPsu_EpRingReap(struct XUsbPsu *InstancePtr, struct XUsbPsu_Ep *Ept,
+			const struct XUsbPsu_Event_Epevt *Event);
+
 /*
  * Functions in xusbpsu_controltransfer.c
  */
@@ -0,0 +1,347 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*****************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xusbpsu_ring.c
+* @addtogroup usbpsu Overview
+* @{
+*
+* This file contains the TRB ring mode of bulk and interrupt endpoints. In
+* ring mode the TRBs of an endpoint form a ring closed by its link TRB and
+* one transfer stays started: requests are added to the ring while the
+* core works on the previous ones, and the completed TRBs are reaped in one
+* pass on each XferInProgress event.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.15	fl  10/14/26 First release
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xusbpsu_endpoint.h"
+#include "xusbpsu_local.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+
+/****************************************************************************/
+/**
+* @brief
+* Switches an endpoint to TRB ring mode.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	UsbEpNum is USB endpoint number.
+* @param	Dir is direction of endpoint
+* 				- XUSBPSU_EP_DIR_IN/XUSBPSU_EP_DIR_OUT.
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+* @note		The endpoint must be an enabled bulk or interrupt endpoint
+*		with no transfer in progress. Requests are then queued with
+*		XUsbPsu_EpRingQueue() instead of XUsbPsu_EpBufferSend() and
+*		XUsbPsu_EpBufferRecv(). XUsbPsu_EpDisable() ends ring mode.
+*
+*****************************************************************************/
+s32 XUsbPsu_EpRingEnable(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir)
+{
+	struct XUsbPsu_Ep *Ept;
+	u8 PhyEpNum;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((UsbEpNum > (u8)0U) && (UsbEpNum <= (u8)16U));
+	Xil_AssertNonvoid((Dir == XUSBPSU_EP_DIR_IN) ||
+			  (Dir == XUSBPSU_EP_DIR_OUT));
+
+	PhyEpNum = XUSBPSU_PhysicalEp(UsbEpNum, Dir);
+	Ept = &InstancePtr->eps[PhyEpNum];
+
+	if (((Ept->EpStatus & XUSBPSU_EP_ENABLED) == 0U) ||
+	    ((Ept->EpStatus & XUSBPSU_EP_BUSY) != 0U) ||
+	    ((Ept->Type != XUSBPSU_ENDPOINT_XFER_BULK) &&
+	     (Ept->Type != XUSBPSU_ENDPOINT_XFER_INT))) {
+		return (s32)XST_FAILURE;
+	}
+
+	Ept->EpStatus |= XUSBPSU_EP_RING;
+	Ept->TrbEnqueue = 0U;
+	Ept->TrbDequeue = 0U;
+	Ept->RingCount = 0U;
+
+	if (XUsbPsu_SetEpConfig(InstancePtr, UsbEpNum, Dir, Ept->MaxSize,
+				Ept->Type, (u8)FALSE) == XST_FAILURE) {
+		Ept->EpStatus &= ~XUSBPSU_EP_RING;
+		return (s32)XST_FAILURE;
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* @brief
+* Ends TRB ring mode of an endpoint. The transfer is stopped and the
+* requests still in the ring are dropped without calling the handler.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	UsbEpNum is USB endpoint number.
+* @param	Dir is direction of endpoint
+* 				- XUSBPSU_EP_DIR_IN/XUSBPSU_EP_DIR_OUT.
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+s32 XUsbPsu_EpRingDisable(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir)
+{
+	struct XUsbPsu_Ep *Ept;
+	u8 PhyEpNum;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((UsbEpNum > (u8)0U) && (UsbEpNum <= (u8)16U));
+	Xil_AssertNonvoid((Dir == XUSBPSU_EP_DIR_IN) ||
+			  (Dir == XUSBPSU_EP_DIR_OUT));
+
+	PhyEpNum = XUSBPSU_PhysicalEp(UsbEpNum, Dir);
+	Ept = &InstancePtr->eps[PhyEpNum];
+
+	if ((Ept->EpStatus & XUSBPSU_EP_RING) == 0U) {
+		return (s32)XST_SUCCESS;
+	}
+
+	if ((Ept->EpStatus & XUSBPSU_EP_BUSY) != 0U) {
+		XUsbPsu_StopTransfer(InstancePtr, UsbEpNum, Dir, (u8)TRUE);
+	}
+
+	Ept->EpStatus &= ~XUSBPSU_EP_RING;
+	Ept->TrbEnqueue = 0U;
+	Ept->TrbDequeue = 0U;
+	Ept->RingCount = 0U;
+
+	return XUsbPsu_SetEpConfig(InstancePtr, UsbEpNum, Dir, Ept->MaxSize,
+				   Ept->Type, (u8)FALSE);
+}
+
+/****************************************************************************/
+/**
+* @brief
+* Adds a request to the TRB ring of an endpoint. The first request starts
+* the transfer, the next ones are added to it while the core is busy, so
+* the endpoint moves data as long as requests are queued.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	UsbEpNum is USB endpoint number.
+* @param	Dir is direction of endpoint
+* 				- XUSBPSU_EP_DIR_IN/XUSBPSU_EP_DIR_OUT.
+* @param	BufferPtr is pointer to data. This data buffer is cache-aligned.
+* @param	Length is length of the data to send or receive. For OUT
+*		endpoints it is rounded up to a multiple of the maximum packet
+*		size, the buffer must hold the rounded length.
+* @param	Ioc is TRUE to raise an event when the request completes. The
+*		requests completed before it are reaped on the same event.
+*
+* @return
+*		- XST_SUCCESS if the request was queued.
+*		- XST_DEVICE_BUSY if all the TRBs of the ring are in use.
+*		- XST_FAILURE if the endpoint is not in ring mode or the
+*		command failed.
+*
+* @note		The endpoint handler is called once per request, in queue
+*		order, with the TRB size and the number of bytes moved. Set Ioc
+*		on the last request queued, so that it is not held back. A
+*		short OUT packet also raises an event.
+*
+*****************************************************************************/
+s32 XUsbPsu_EpRingQueue(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir,
+			u8 *BufferPtr, u32 Length, u8 Ioc)
+{
+	struct XUsbPsu_Trb *TrbPtr;
+	struct XUsbPsu_Ep *Ept;
+	struct XUsbPsu_EpParams Params;
+	u8	PhyEpNum;
+	u32	Size;
+	u32	cmd;
+	s32	RetVal;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((UsbEpNum > (u8)0U) && (UsbEpNum <= (u8)16U));
+	Xil_AssertNonvoid((Dir == XUSBPSU_EP_DIR_IN) ||
+			  (Dir == XUSBPSU_EP_DIR_OUT));
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid(Length <= XUSBPSU_TRB_SIZE_MASK);
+
+	PhyEpNum = XUSBPSU_PhysicalEp(UsbEpNum, Dir);
+	Ept = &InstancePtr->eps[PhyEpNum];
+
+	if ((Ept->EpStatus & XUSBPSU_EP_RING) == 0U) {
+		return (s32)XST_FAILURE;
+	}
+
+	if (Ept->RingCount == NO_OF_TRB_PER_EP) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	/*
+	 * 8.2.5 - An OUT transfer size (Total TRB buffer allocation)
+	 * must be a multiple of MaxPacketSize even if software is expecting a
+	 * fixed non-multiple of MaxPacketSize transfer from the Host.
+	 */
+	Size = Length;
+	if ((Dir == XUSBPSU_EP_DIR_OUT) && (!IS_ALIGNED(Length, Ept->MaxSize))) {
+		Size = (u32)roundup(Length, (u32)Ept->MaxSize);
+	}
+
+	TrbPtr = &Ept->EpTrb[Ept->TrbEnqueue];
+	Ept->RingLen[Ept->TrbEnqueue] = Size;
+
+	Ept->TrbEnqueue++;
+	if (Ept->TrbEnqueue == NO_OF_TRB_PER_EP) {
+		Ept->TrbEnqueue = 0U;
+	}
+
+	TrbPtr->BufferPtrLow  = (UINTPTR)BufferPtr;
+	TrbPtr->BufferPtrHigh = ((UINTPTR)BufferPtr >> 16U) >> 16U;
+	TrbPtr->Size = Size & XUSBPSU_TRB_SIZE_MASK;
+
+	/*
+	 * No LST bit, the transfer goes on with the next TRB. OUT TRBs
+	 * continue on a short packet and report it.
+	 */
+	if (Dir == XUSBPSU_EP_DIR_OUT) {
+		TrbPtr->Ctrl = (XUSBPSU_TRBCTL_NORMAL
+				| XUSBPSU_TRB_CTRL_CSP
+				| XUSBPSU_TRB_CTRL_ISP_IMI);
+	} else {
+		TrbPtr->Ctrl = XUSBPSU_TRBCTL_NORMAL;
+	}
+
+	if (Ioc == (u8)TRUE) {
+		TrbPtr->Ctrl |= XUSBPSU_TRB_CTRL_IOC;
+	}
+
+	TrbPtr->Ctrl |= XUSBPSU_TRB_CTRL_HWO;
+
+	if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+		if (Dir == XUSBPSU_EP_DIR_OUT) {
+			Xil_DCacheInvalidateRange((INTPTR)BufferPtr, Size);
+		} else {
+			Xil_DCacheFlushRange((INTPTR)BufferPtr, Length);
+		}
+		Xil_DCacheFlushRange((INTPTR)TrbPtr,
+				     sizeof(struct XUsbPsu_Trb));
+	}
+
+	Ept->RingCount++;
+
+	Params.Param0 = 0U;
+	Params.Param1 = (UINTPTR)TrbPtr;
+	Params.Param2 = 0U;
+
+	if ((Ept->EpStatus & XUSBPSU_EP_BUSY) != (u32)0U) {
+		cmd = XUSBPSU_DEPCMD_UPDATETRANSFER;
+		cmd |= XUSBPSU_DEPCMD_PARAM(Ept->ResourceIndex);
+	} else {
+		cmd = XUSBPSU_DEPCMD_STARTTRANSFER;
+	}
+
+	RetVal = XUsbPsu_SendEpCmd(InstancePtr, UsbEpNum, Ept->Direction,
+				   cmd, &Params);
+	if (RetVal != (s32)XST_SUCCESS) {
+		return (s32)XST_FAILURE;
+	}
+
+	if ((Ept->EpStatus & XUSBPSU_EP_BUSY) == (u32)0U) {
+		Ept->ResourceIndex = (u8)XUsbPsu_EpGetTransferIndex(InstancePtr,
+				     Ept->UsbEpNum,
+				     Ept->Direction);
+
+		Ept->EpStatus |= XUSBPSU_EP_BUSY;
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Reaps the completed TRBs of a ring mode endpoint and calls the endpoint
+* handler for each of them, in queue order.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	Ept is a pointer to the endpoint.
+* @param	Event is a pointer to the Endpoint event occurred in core.
+*
+* @return	None.
+*
+* @note		The handler may queue new requests, the TRB of the request
+*		it is called for is free.
+*
+*****************************************************************************/
+void XUsbPsu_EpRingReap(struct XUsbPsu *InstancePtr, struct XUsbPsu_Ep *Ept,
+			const struct XUsbPsu_Event_Epevt *Event)
+{
+	struct XUsbPsu_Trb *TrbPtr;
+	UINTPTR BufferAddr;
+	u32 Requested;
+	u32 Length;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(Ept != NULL);
+	Xil_AssertVoid(Event != NULL);
+
+	if (Event->Endpoint_Event == XUSBPSU_DEPEVT_XFERCOMPLETE) {
+		Ept->EpStatus &= ~(XUSBPSU_EP_BUSY);
+		Ept->ResourceIndex = 0U;
+	}
+
+	while (Ept->RingCount > 0U) {
+		TrbPtr = &Ept->EpTrb[Ept->TrbDequeue];
+
+		if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+			Xil_DCacheInvalidateRange((INTPTR)TrbPtr,
+						  sizeof(struct XUsbPsu_Trb));
+		}
+
+		if ((TrbPtr->Ctrl & XUSBPSU_TRB_CTRL_HWO) != 0U) {
+			break;
+		}
+
+		Requested = Ept->RingLen[Ept->TrbDequeue];
+		Length = Requested - (TrbPtr->Size & XUSBPSU_TRB_SIZE_MASK);
+
+		Ept->TrbDequeue++;
+		if (Ept->TrbDequeue == NO_OF_TRB_PER_EP) {
+			Ept->TrbDequeue = 0U;
+		}
+		Ept->RingCount--;
+
+		if ((Ept->Direction == XUSBPSU_EP_DIR_OUT) &&
+		    (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U)) {
+			BufferAddr = (UINTPTR)TrbPtr->BufferPtrLow;
+			BufferAddr |= ((UINTPTR)TrbPtr->BufferPtrHigh << 16U) <<
+				      16U;
+			Xil_DCacheInvalidateRange((INTPTR)BufferAddr, Length);
+		}
+
+		if (Ept->Handler != NULL) {
+			Ept->Handler(InstancePtr->AppData, Requested, Length);
+		}
+	}
+}
+/** @} */
@@ -30,6 +30,7 @@
 * 2.1   rco   02/09/17 Fix c++ warnings
 * 2.2   vyc   10/04/17 Added support for 4:2:0
 * 2.3   viv   06/19/18 Added support for color range
+* 2.6   fl    10/14/26 Stage coefficient updates, commit them on frame done
 * </pre>
 *
 ******************************************************************************/
@@ -87,6 +88,8 @@ static void cscFwComputeCoeff(XV_Csc_l2 *CscPtr,
                               s32 K2[3][4]);
 static void cscUpdateIPReg(XV_Csc_l2 *CscPtr,
                            XV_CSC_REG_UPDT_WIN win);
+static void cscWriteCoeffRegs(XV_Csc_l2 *CscPtr, u32 firstReg,
+                              s32 K[3][4], u32 clampMin, u32 clipMax);
 /*****************************************************************************/
 /**
 * This function provides the write interface for FW register bank
@@ -1467,7 +1470,6 @@ static void cscUpdateIPReg(XV_Csc_l2 *CscPtr,
   u8 x,y;
   s32 K[3][4];
   u32 clampMin, clipMax;
-  XV_csc *pCsc = &CscPtr->Csc;
 
   switch(win)
   {
@@ -1485,20 +1487,7 @@ static void cscUpdateIPReg(XV_Csc_l2 *CscPtr,
         clampMin = cscFw_RegR(CscPtr, CSC_FW_REG_ClampMin);
         clipMax  = cscFw_RegR(CscPtr, CSC_FW_REG_ClipMax);
 
-        XV_csc_Set_HwReg_K11(pCsc, K[0][0]);
-        XV_csc_Set_HwReg_K12(pCsc, K[0][1]);
-        XV_csc_Set_HwReg_K13(pCsc, K[0][2]);
-        XV_csc_Set_HwReg_K21(pCsc, K[1][0]);
-        XV_csc_Set_HwReg_K22(pCsc, K[1][1]);
-        XV_csc_Set_HwReg_K23(pCsc, K[1][2]);
-        XV_csc_Set_HwReg_K31(pCsc, K[2][0]);
-        XV_csc_Set_HwReg_K32(pCsc, K[2][1]);
-        XV_csc_Set_HwReg_K33(pCsc, K[2][2]);
-        XV_csc_Set_HwReg_ROffset_V(pCsc,  K[0][3]);
-        XV_csc_Set_HwReg_GOffset_V(pCsc,  K[1][3]);
-        XV_csc_Set_HwReg_BOffset_V(pCsc,  K[2][3]);
-        XV_csc_Set_HwReg_ClampMin_V(pCsc, clampMin);
-        XV_csc_Set_HwReg_ClipMax_V(pCsc,  clipMax);
+        cscWriteCoeffRegs(CscPtr, CSC_FW_REG_K11, K, clampMin, clipMax);
         break;
 
     case UPD_REG_DEMO_WIN:
@@ -1515,35 +1504,9 @@ static void cscUpdateIPReg(XV_Csc_l2 *CscPtr,
         clampMin = cscFw_RegR(CscPtr, CSC_FW_REG_ClampMin_2);
         clipMax  = cscFw_RegR(CscPtr, CSC_FW_REG_ClipMax_2);
         if (XV_CscIsDemoWindowEnabled(CscPtr)) {
-          XV_csc_Set_HwReg_K11_2(pCsc, K[0][0]);
-          XV_csc_Set_HwReg_K12_2(pCsc, K[0][1]);
-          XV_csc_Set_HwReg_K13_2(pCsc, K[0][2]);
-          XV_csc_Set_HwReg_K21_2(pCsc, K[1][0]);
-          XV_csc_Set_HwReg_K22_2(pCsc, K[1][1]);
-          XV_csc_Set_HwReg_K23_2(pCsc, K[1][2]);
-          XV_csc_Set_HwReg_K31_2(pCsc, K[2][0]);
-          XV_csc_Set_HwReg_K32_2(pCsc, K[2][1]);
-          XV_csc_Set_HwReg_K33_2(pCsc, K[2][2]);
-          XV_csc_Set_HwReg_ROffset_2_V(pCsc,  K[0][3]);
-          XV_csc_Set_HwReg_GOffset_2_V(pCsc,  K[1][3]);
-          XV_csc_Set_HwReg_BOffset_2_V(pCsc,  K[2][3]);
-          XV_csc_Set_HwReg_ClampMin_2_V(pCsc, clampMin);
-          XV_csc_Set_HwReg_ClipMax_2_V(pCsc,  clipMax);
+          cscWriteCoeffRegs(CscPtr, CSC_FW_REG_K11_2, K, clampMin, clipMax);
         } else {
-          XV_csc_Set_HwReg_K11(pCsc, K[0][0]);
-          XV_csc_Set_HwReg_K12(pCsc, K[0][1]);
-          XV_csc_Set_HwReg_K13(pCsc, K[0][2]);
-          XV_csc_Set_HwReg_K21(pCsc, K[1][0]);
-          XV_csc_Set_HwReg_K22(pCsc, K[1][1]);
-          XV_csc_Set_HwReg_K23(pCsc, K[1][2]);
-          XV_csc_Set_HwReg_K31(pCsc, K[2][0]);
-          XV_csc_Set_HwReg_K32(pCsc, K[2][1]);
-          XV_csc_Set_HwReg_K33(pCsc, K[2][2]);
-          XV_csc_Set_HwReg_ROffset_V(pCsc,  K[0][3]);
-          XV_csc_Set_HwReg_GOffset_V(pCsc,  K[1][3]);
-          XV_csc_Set_HwReg_BOffset_V(pCsc,  K[2][3]);
-          XV_csc_Set_HwReg_ClampMin_V(pCsc, clampMin);
-          XV_csc_Set_HwReg_ClipMax_V(pCsc,  clipMax);
+          cscWriteCoeffRegs(CscPtr, CSC_FW_REG_K11, K, clampMin, clipMax);
         }
         break;
 
@@ -1552,6 +1515,171 @@ static void cscUpdateIPReg(XV_Csc_l2 *CscPtr,
   }
 }
 
+/*****************************************************************************/
+/**
+* This function writes a set of coefficient registers, K11 to ClipMax of the
+* full frame or of the demo window. During an update the values are staged
+* until XV_CscCommitUpdate().
+*
+* @param  CscPtr is a pointer to layer 2 of csc core instance
+* @param  firstReg is CSC_FW_REG_K11 or CSC_FW_REG_K11_2
+* @param  K is the coefficient matrix and offsets
+* @param  clampMin is the clamp value
+* @param  clipMax is the clip value
+*
+* @return None
+*
+******************************************************************************/
+static void cscWriteCoeffRegs(XV_Csc_l2 *CscPtr, u32 firstReg,
+                              s32 K[3][4], u32 clampMin, u32 clipMax)
+{
+  u32 val[CSC_FW_REG_K11_2 - CSC_FW_REG_K11];
+  u32 base, i, x, y;
+
+  /* Same order as the registers, 8 bytes apart from K11 */
+  for(x=0; x<3; ++x)
+  {
+    for(y=0; y<3; ++y)
+    {
+      val[x*3+y] = (u32)K[x][y];
+    }
+  }
+  val[CSC_FW_REG_ROffset  - CSC_FW_REG_K11] = (u32)K[0][3];
+  val[CSC_FW_REG_GOffset  - CSC_FW_REG_K11] = (u32)K[1][3];
+  val[CSC_FW_REG_BOffset  - CSC_FW_REG_K11] = (u32)K[2][3];
+  val[CSC_FW_REG_ClampMin - CSC_FW_REG_K11] = clampMin;
+  val[CSC_FW_REG_ClipMax  - CSC_FW_REG_K11] = clipMax;
+
+  base = firstReg - CSC_FW_REG_K11;
+  for(i=0; i<(CSC_FW_REG_K11_2 - CSC_FW_REG_K11); ++i)
+  {
+    if(CscPtr->StageState == XV_CSC_UPDATE_OPEN) {
+      CscPtr->Staged[base+i] = val[i];
+      CscPtr->StageDirty |= (1U << (base+i));
+    } else {
+      XV_csc_WriteReg(CscPtr->Csc.Config.BaseAddress,
+                      XV_CSC_CTRL_ADDR_HWREG_K11_DATA + (base+i)*8, val[i]);
+    }
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function starts an update. The coefficients computed by the functions
+* that follow are kept in memory until XV_CscEndUpdate().
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return XST_SUCCESS if the update was started
+*         XST_DEVICE_BUSY if an update is already open
+*
+* @note   An update ended but not yet committed is reopened, its coefficients
+*         are committed with the new ones.
+*
+******************************************************************************/
+int XV_CscBeginUpdate(XV_Csc_l2 *InstancePtr)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if(InstancePtr->StageState == XV_CSC_UPDATE_OPEN) {
+    return(XST_DEVICE_BUSY);
+  }
+  InstancePtr->StageState = XV_CSC_UPDATE_OPEN;
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function ends an update. In interrupt mode the coefficients are
+* written by XV_CscInterruptHandler() on the next frame done.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return XST_SUCCESS if the update was ended
+*         XST_FAILURE if no update is open
+*
+******************************************************************************/
+int XV_CscEndUpdate(XV_Csc_l2 *InstancePtr)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if(InstancePtr->StageState != XV_CSC_UPDATE_OPEN) {
+    return(XST_FAILURE);
+  }
+  InstancePtr->StageState = XV_CSC_UPDATE_PENDING;
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function writes an ended update to the core
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return Number of registers written, 0 if no update was pending
+*
+* @note   Called by XV_CscInterruptHandler() in interrupt mode. In polling
+*         mode the application calls it on frame done, after
+*         XV_CscEndUpdate().
+*
+******************************************************************************/
+u32 XV_CscCommitUpdate(XV_Csc_l2 *InstancePtr)
+{
+  u32 i;
+  u32 count = 0;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if(InstancePtr->StageState != XV_CSC_UPDATE_PENDING) {
+    return 0;
+  }
+
+  for(i=0; i<XV_CSC_STAGE_REGS; ++i)
+  {
+    if(InstancePtr->StageDirty & (1U << i)) {
+      XV_csc_WriteReg(InstancePtr->Csc.Config.BaseAddress,
+                      XV_CSC_CTRL_ADDR_HWREG_K11_DATA + i*8,
+                      InstancePtr->Staged[i]);
+      ++count;
+    }
+  }
+  InstancePtr->StageDirty = 0;
+  InstancePtr->StageState = XV_CSC_UPDATE_NONE;
+
+  return count;
+}
+
+/*****************************************************************************/
+/**
+* This function is the interrupt handler of the CSC core. On frame done it
+* clears the interrupt and writes the staged coefficients, which take effect
+* from the next frame.
+*
+* The application is responsible for connecting this function to the
+* interrupt system and for enabling the done interrupt with
+* XV_csc_InterruptEnable() and XV_csc_InterruptGlobalEnable().
+*
+* @param  InstancePtr is a pointer to the core instance that just
+*         interrupted.
+*
+* @return None
+*
+******************************************************************************/
+void XV_CscInterruptHandler(XV_Csc_l2 *InstancePtr)
+{
+  u32 status;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  status = XV_csc_InterruptGetStatus(&InstancePtr->Csc);
+  if(status & XV_CSC_IRQ_DONE_MASK) {
+    XV_csc_InterruptClear(&InstancePtr->Csc, XV_CSC_IRQ_DONE_MASK);
+    XV_CscCommitUpdate(InstancePtr);
+  }
+}
+
 /*****************************************************************************/
 /**
 * This function prints CSC IP status on console
@@ -55,7 +55,12 @@
 *
 * <b> Interrupts </b>
 *
-* This driver does not have any interrupts
+* The coefficients set between XV_CscBeginUpdate() and XV_CscEndUpdate() are
+* staged in memory and written by XV_CscInterruptHandler() on frame done, so
+* that the whole matrix changes on the same frame instead of register by
+* register during active video. The application connects the handler to the
+* interrupt of the core and enables the done interrupt. Without interrupts
+* the application calls XV_CscCommitUpdate() itself when the core is done.
 *
 * <b> Virtual Memory </b>
 *
@@ -79,6 +84,7 @@
 *                        that were added to the XV_csc_Config structure
 * 2.20  vyc   10/04/17   Macro queries Is420Enabled flag that was added to the
 *                        XV_csc_Config structure
+* 2.6   fl    10/14/26   Stage coefficient updates, commit them on frame done
 * </pre>
 *
 ******************************************************************************/
@@ -92,6 +98,17 @@ extern "C" {
 #include "xvidc.h"
 #include "xv_csc.h"
 
+/************************** Constant Definitions *****************************/
+#define XV_CSC_IRQ_DONE_MASK      (0x01)
+
+/* Coefficient registers K11 to ClipMax_2 staged by an update */
+#define XV_CSC_STAGE_REGS         (CSC_FW_REG_ClipMax_2 - CSC_FW_REG_K11 + 1)
+
+#define XV_CSC_UPDATE_NONE        0  /**< Coefficients go to the core */
+#define XV_CSC_UPDATE_OPEN        1  /**< Coefficients are being staged */
+#define XV_CSC_UPDATE_PENDING     2  /**< Staged coefficients wait for
+                                          frame done */
+
 
 /****************************** Type Definitions ******************************/
 /**
@@ -164,6 +181,10 @@ typedef struct
   s32 K_active[3][4];
 
   s32 regMap[CSC_FW_NUM_REGS];
+  u32 Staged[XV_CSC_STAGE_REGS]; /*<< Coefficient registers of the update */
+  u32 StageDirty;                /*<< Bit N set when Staged[N] is to be
+                                      written */
+  u8 StageState;                 /*<< XV_CSC_UPDATE_* */
 }XV_Csc_l2;
 
 /************************** Macros Definitions *******************************/
@@ -389,6 +410,10 @@ void XV_CscSetSaturation(XV_Csc_l2 *InstancePtr, s32 val);
 void XV_CscSetRedGain(XV_Csc_l2 *InstancePtr, s32 val);
 void XV_CscSetGreenGain(XV_Csc_l2 *InstancePtr, s32 val);
 void XV_CscSetBlueGain(XV_Csc_l2 *InstancePtr, s32 val);
+int XV_CscBeginUpdate(XV_Csc_l2 *InstancePtr);
+int XV_CscEndUpdate(XV_Csc_l2 *InstancePtr);
+u32 XV_CscCommitUpdate(XV_Csc_l2 *InstancePtr);
+void XV_CscInterruptHandler(XV_Csc_l2 *InstancePtr);
 void XV_CscDbgReportStatus(XV_Csc_l2 *InstancePtr);
 
 #ifdef __cplusplus
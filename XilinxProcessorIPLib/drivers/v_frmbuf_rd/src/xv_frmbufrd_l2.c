@@ -731,6 +731,42 @@ UINTPTR XVFrmbufRd_GetVChromaBufferAddr(XV_FrmbufRd_l2 *InstancePtr)
 	return(ReadVal);
 }
 
+/*****************************************************************************/
+/**
+* This function sets the buffer addresses of all the planes of a video buffer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  BufPtr is the video buffer to be read by the core
+*
+* @return XST_SUCCESS or an error of the Set*BufferAddr functions
+*
+* @note   The memory format must have been set with a stride of
+*         BufPtr->Plane[0].Stride. The buffer is flushed only when the CPU
+*         wrote it since it was last flushed.
+*
+******************************************************************************/
+int XVFrmbufRd_SetVideoBuf(XV_FrmbufRd_l2 *InstancePtr,
+			  XVidC_VideoBuf *BufPtr)
+{
+	int Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufPtr != NULL);
+
+	XVidC_VBufForDevice(BufPtr);
+
+	Status = XVFrmbufRd_SetBufferAddr(InstancePtr, BufPtr->Plane[0].Addr);
+	if ((Status == XST_SUCCESS) && (BufPtr->NumPlanes > 1)) {
+		Status = XVFrmbufRd_SetChromaBufferAddr(InstancePtr,
+							BufPtr->Plane[1].Addr);
+	}
+	if ((Status == XST_SUCCESS) && (BufPtr->NumPlanes > 2)) {
+		Status = XVFrmbufRd_SetVChromaBufferAddr(InstancePtr,
+							 BufPtr->Plane[2].Addr);
+	}
+	return(Status);
+}
+
 /*****************************************************************************/
 /**
 * This function sets the buffer address for the UV plane for semi-planar formats
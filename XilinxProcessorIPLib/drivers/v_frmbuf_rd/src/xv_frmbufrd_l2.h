@@ -100,6 +100,9 @@
 * 4.50  kp    13/07/21   Added new 3 planar video format Y_U_V8
 * 4.60  kp    12/03/21   Added new 3 planar video format Y_U_V10
 * 4.70  pg    05/23/23   Added new 3 planar video format Y_U_V8_420.
+* 4.80  fl    10/14/26   Added frame queue support
+*                        Added XVidC_VideoBuf support
+*                        Added latency tracker marks
 * </pre>
 *
 ******************************************************************************/
@@ -112,6 +115,9 @@ extern "C" {
 
 #include "xvidc.h"
 #include "xv_frmbufrd.h"
+#include "xvidc_frmq.h"
+#include "xvidc_lat.h"
+#include "xvidc_vbuf.h"
 
 /************************** Constant Definitions *****************************/
 #define XVFRMBUFRD_IRQ_DONE_MASK            (0x01)
@@ -172,6 +178,13 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Output AXIS */
+
+    XVidC_FrameQueue *FrameQueue; /**< Frame queue, NULL if not used */
+    u8 QueueActive;              /**< Queue buffer the core reads */
+    u8 QueueStaged;              /**< Queue buffer programmed next */
+
+    XVidC_Latency *Latency;      /**< Latency tracker, NULL if not used */
+    u8 LatStage;                 /**< Pipeline stage of the core */
 }XV_FrmbufRd_l2;
 
 /************************** Macros Definitions *******************************/
@@ -693,6 +706,8 @@ UINTPTR XVFrmbufRd_GetChromaBufferAddr(XV_FrmbufRd_l2 *InstancePtr);
 int XVFrmbufRd_SetVChromaBufferAddr(XV_FrmbufRd_l2 *InstancePtr,
                               UINTPTR Addr);
 UINTPTR XVFrmbufRd_GetVChromaBufferAddr(XV_FrmbufRd_l2 *InstancePtr);
+int XVFrmbufRd_SetVideoBuf(XV_FrmbufRd_l2 *InstancePtr,
+                          XVidC_VideoBuf *BufPtr);
 int XVFrmbufRd_SetFieldID(XV_FrmbufRd_l2 *InstancePtr,
                           u32 FieldID);
 u32 XVFrmbufRd_GetFieldID(XV_FrmbufRd_l2 *InstancePtr);
@@ -705,6 +720,10 @@ void XVFrmbufRd_DbgReportStatus(XV_FrmbufRd_l2 *InstancePtr);
 
 /* Interrupt related function */
 void XVFrmbufRd_InterruptHandler(void *InstancePtr);
+int XVFrmbufRd_SetFrameQueue(XV_FrmbufRd_l2 *InstancePtr,
+                             XVidC_FrameQueue *QueuePtr);
+void XVFrmbufRd_SetLatency(XV_FrmbufRd_l2 *InstancePtr,
+                           XVidC_Latency *LatPtr, u8 Stage);
 int XVFrmbufRd_SetCallback(XV_FrmbufRd_l2 *InstancePtr,
                            u32 HandlerType,
                            void *CallbackFunc,
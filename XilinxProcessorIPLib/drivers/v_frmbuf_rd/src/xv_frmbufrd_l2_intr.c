@@ -24,6 +24,8 @@
 * 4.20  pg    01/31/20   Removed Frmbuf start function from Interrupt handler.
 * 4.50  pg    01/07/21   Added new registers to support fid_out interlace solution.
 *						Interrupt count support for throughput measurement.
+* 4.80  fl    10/14/26   Added frame queue support
+*                        Added latency tracker marks
 * </pre>
 *
 ******************************************************************************/
@@ -87,6 +89,163 @@ int XVFrmbufRd_SetCallback(XV_FrmbufRd_l2 *InstancePtr, u32 HandlerType,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function programs the address registers with a frame queue buffer
+*
+* @param    InstancePtr is a pointer to the core instance.
+* @param    Idx is the buffer index.
+*
+* @return   None.
+*
+* @note     The planes with an address of 0 are left unchanged.
+*
+******************************************************************************/
+static void XVFrmbufRd_ProgramQueueBuf(XV_FrmbufRd_l2 *InstancePtr, u8 Idx)
+{
+	XVidC_FrameBuf *BufPtr = XVidC_FrmQGetBuf(InstancePtr->FrameQueue, Idx);
+
+	(void)XVFrmbufRd_SetBufferAddr(InstancePtr, BufPtr->Addr);
+	if (BufPtr->ChromaAddr != 0) {
+		(void)XVFrmbufRd_SetChromaBufferAddr(InstancePtr, BufPtr->ChromaAddr);
+	}
+	if (BufPtr->VChromaAddr != 0) {
+		(void)XVFrmbufRd_SetVChromaBufferAddr(InstancePtr, BufPtr->VChromaAddr);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function attaches a frame queue to the core as consumer
+*
+* With a queue attached, the ap_ready interrupt handler releases every frame
+* read and programs the address of the next buffer, the application only has to
+* enable XVFRMBUFRD_IRQ_READY_MASK. Call this function before
+* XVFrmbufRd_Start().
+*
+* @param    InstancePtr is a pointer to the core instance.
+* @param    QueuePtr is a pointer to an initialized frame queue, or NULL to
+*           detach the queue.
+*
+* @return
+*           - XST_SUCCESS if the queue was attached or detached.
+*           - XST_NO_DATA if no frame is ready yet, retry once the producer
+*             completed its first frame.
+*
+* @note     None.
+*
+******************************************************************************/
+int XVFrmbufRd_SetFrameQueue(XV_FrmbufRd_l2 *InstancePtr,
+                             XVidC_FrameQueue *QueuePtr)
+{
+	u8 Idx;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	InstancePtr->FrameQueue = NULL;
+	if (QueuePtr == NULL) {
+		return XST_SUCCESS;
+	}
+
+	Idx = XVidC_FrmQFirstReady(QueuePtr);
+	if (Idx == XVIDC_FRMQ_NONE) {
+		return XST_NO_DATA;
+	}
+
+	InstancePtr->FrameQueue = QueuePtr;
+	InstancePtr->QueueActive = XVIDC_FRMQ_NONE;
+	InstancePtr->QueueStaged = Idx;
+	XVFrmbufRd_ProgramQueueBuf(InstancePtr, Idx);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function attaches a latency tracker to the core
+*
+* With a tracker attached, the frame done interrupt handler marks the frame
+* read by the core as a stage of the pipeline. With a frame queue, the frame
+* is the one the Frame Buffer Write driver stored in the queue buffer, so
+* that the latency through the buffers is measured per frame.
+*
+* @param    InstancePtr is a pointer to the core instance.
+* @param    LatPtr is a pointer to an initialized latency tracker, or NULL to
+*           detach the tracker.
+* @param    Stage is the pipeline stage of the core.
+*
+* @return   None.
+*
+* @note     The frame done interrupt, XVFRMBUFRD_IRQ_DONE_MASK, must be
+*           enabled.
+*
+******************************************************************************/
+void XVFrmbufRd_SetLatency(XV_FrmbufRd_l2 *InstancePtr,
+                           XVidC_Latency *LatPtr, u8 Stage)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid((LatPtr == NULL) || (Stage < LatPtr->NumStages));
+
+	InstancePtr->Latency = NULL;
+	InstancePtr->LatStage = Stage;
+	InstancePtr->Latency = LatPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function marks the frame the core has read in the latency tracker
+*
+* @param    InstancePtr is a pointer to the core instance.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+static void XVFrmbufRd_LatencyDone(XV_FrmbufRd_l2 *InstancePtr)
+{
+	if ((InstancePtr->FrameQueue != NULL) && (InstancePtr->LatStage != 0) &&
+	    (InstancePtr->QueueActive != XVIDC_FRMQ_NONE)) {
+		XVidC_LatMarkFrame(InstancePtr->Latency, InstancePtr->LatStage,
+				XVidC_FrmQGetBuf(InstancePtr->FrameQueue,
+					InstancePtr->QueueActive)->LatId);
+	} else {
+		(void)XVidC_LatMark(InstancePtr->Latency, InstancePtr->LatStage);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function advances the frame queue on ap_ready
+*
+* The core has latched the staged buffer, so the buffer it read before is
+* released, and the next ready frame is staged, or the staged one again.
+*
+* @param    InstancePtr is a pointer to the core instance.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+static void XVFrmbufRd_QueueReady(XV_FrmbufRd_l2 *InstancePtr)
+{
+	u8 Next;
+
+	Next = XVidC_FrmQConsume(InstancePtr->FrameQueue, InstancePtr->QueueActive,
+			InstancePtr->QueueStaged);
+	InstancePtr->QueueActive = InstancePtr->QueueStaged;
+	if (Next != InstancePtr->QueueStaged) {
+		InstancePtr->QueueStaged = Next;
+		XVFrmbufRd_ProgramQueueBuf(InstancePtr, Next);
+	}
+}
+
 /*****************************************************************************/
 /**
  *
@@ -125,6 +284,9 @@ void XVFrmbufRd_InterruptHandler(void *InstancePtr)
 	if(Status & XVFRMBUFRD_IRQ_DONE_MASK) {
 		/* Clear the interrupt */
 		XV_frmbufrd_InterruptClear(&FrmbufRdPtr->FrmbufRd, XVFRMBUFRD_IRQ_DONE_MASK);
+		if(FrmbufRdPtr->Latency) {
+			XVFrmbufRd_LatencyDone(FrmbufRdPtr);
+		}
 		//Call user registered callback function, if any
 		if(FrmbufRdPtr->FrameDoneCallback) {
 			FrmbufRdPtr->FrameDoneCallback(FrmbufRdPtr->CallbackDoneRef);
@@ -135,6 +297,9 @@ void XVFrmbufRd_InterruptHandler(void *InstancePtr)
 	if(Status & XVFRMBUFRD_IRQ_READY_MASK) {
 		/* Clear the interrupt */
 		XV_frmbufrd_InterruptClear(&FrmbufRdPtr->FrmbufRd, XVFRMBUFRD_IRQ_READY_MASK);
+		if(FrmbufRdPtr->FrameQueue) {
+			XVFrmbufRd_QueueReady(FrmbufRdPtr);
+		}
 		//Call user registered callback function, if any
 		if(FrmbufRdPtr->FrameReadyCallback) {
 			FrmbufRdPtr->FrameReadyCallback(FrmbufRdPtr->CallbackReadyRef);
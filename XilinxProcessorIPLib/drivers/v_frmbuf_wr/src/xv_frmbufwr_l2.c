@@ -754,6 +754,46 @@ UINTPTR XVFrmbufWr_GetVChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr)
   return(ReadVal);
 }
 
+/*****************************************************************************/
+/**
+* This function sets the buffer addresses of all the planes of a video buffer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  BufPtr is the video buffer to be written by the core
+*
+* @return XST_SUCCESS or an error of the Set*BufferAddr functions
+*
+* @note   The memory format must have been set with a stride of
+*         BufPtr->Plane[0].Stride. Dirty cache lines of the buffer are
+*         flushed and the buffer is marked as written by the device, so
+*         XVidC_VBufForCpu() invalidates it before the CPU reads the frame.
+*
+******************************************************************************/
+int XVFrmbufWr_SetVideoBuf(XV_FrmbufWr_l2 *InstancePtr,
+                          XVidC_VideoBuf *BufPtr)
+{
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(BufPtr != NULL);
+
+  XVidC_VBufForDevice(BufPtr);
+
+  Status = XVFrmbufWr_SetBufferAddr(InstancePtr, BufPtr->Plane[0].Addr);
+  if ((Status == XST_SUCCESS) && (BufPtr->NumPlanes > 1)) {
+    Status = XVFrmbufWr_SetChromaBufferAddr(InstancePtr,
+                                            BufPtr->Plane[1].Addr);
+  }
+  if ((Status == XST_SUCCESS) && (BufPtr->NumPlanes > 2)) {
+    Status = XVFrmbufWr_SetVChromaBufferAddr(InstancePtr,
+                                             BufPtr->Plane[2].Addr);
+  }
+  if (Status == XST_SUCCESS) {
+    XVidC_VBufDeviceWritten(BufPtr);
+  }
+  return(Status);
+}
+
 /*****************************************************************************/
 /**
 * This function reads the field ID
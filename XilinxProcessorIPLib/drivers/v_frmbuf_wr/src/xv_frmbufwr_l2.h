@@ -100,6 +100,9 @@
 * 4.50  kp    12/07/21   Added new 3 planar video format Y_U_V8.
 * 4.60  kp    10/27/21   Added new 3 planar video format Y_U_V10.
 * 4.70  pg    05/23/23   Added new 3 planar video format Y_U_V8_420.
+* 4.80  fl    10/14/26   Added frame queue support
+*                        Added XVidC_VideoBuf support
+*                        Added latency tracker marks
 * </pre>
 *
 ******************************************************************************/
@@ -112,6 +115,9 @@ extern "C" {
 
 #include "xvidc.h"
 #include "xv_frmbufwr.h"
+#include "xvidc_frmq.h"
+#include "xvidc_lat.h"
+#include "xvidc_vbuf.h"
 
 /************************** Constant Definitions *****************************/
 #define XVFRMBUFWR_IRQ_DONE_MASK            (0x01)
@@ -172,6 +178,13 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+
+    XVidC_FrameQueue *FrameQueue; /**< Frame queue, NULL if not used */
+    u8 QueueActive;              /**< Queue buffer the core writes */
+    u8 QueueStaged;              /**< Queue buffer programmed next */
+
+    XVidC_Latency *Latency;      /**< Latency tracker, NULL if not used */
+    u8 LatStage;                 /**< Pipeline stage of the core */
 }XV_FrmbufWr_l2;
 
 /************************** Macros Definitions *******************************/
@@ -648,11 +661,17 @@ UINTPTR XVFrmbufWr_GetChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr);
 int XVFrmbufWr_SetVChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr,
                               UINTPTR Addr);
 UINTPTR XVFrmbufWr_GetVChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr);
+int XVFrmbufWr_SetVideoBuf(XV_FrmbufWr_l2 *InstancePtr,
+                          XVidC_VideoBuf *BufPtr);
 u32 XVFrmbufWr_GetFieldID(XV_FrmbufWr_l2 *InstancePtr);
 void XVFrmbufWr_DbgReportStatus(XV_FrmbufWr_l2 *InstancePtr);
 
 /* Interrupt related function */
 void XVFrmbufWr_InterruptHandler(void *InstancePtr);
+int XVFrmbufWr_SetFrameQueue(XV_FrmbufWr_l2 *InstancePtr,
+                             XVidC_FrameQueue *QueuePtr);
+void XVFrmbufWr_SetLatency(XV_FrmbufWr_l2 *InstancePtr,
+                           XVidC_Latency *LatPtr, u8 Stage);
 int XVFrmbufWr_SetCallback(XV_FrmbufWr_l2 *InstancePtr,
                            u32 HandlerType,
                            void *CallbackFunc,
@@ -22,6 +22,8 @@
 * 1.00  vyc   04/05/17   Initial Release
 * 3.00  vyc   04/04/18   Add interrupt handler for ap_ready
 * 4.20  pg    01/31/20   Removed Frmbufwr_start function from Interrupt handler
+* 4.80  fl    10/14/26   Added frame queue support
+*                        Added latency tracker marks
 * </pre>
 *
 ******************************************************************************/
@@ -86,6 +88,160 @@ int XVFrmbufWr_SetCallback(XV_FrmbufWr_l2 *InstancePtr, u32 HandlerType,
   return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function programs the address registers with a frame queue buffer
+*
+* @param    InstancePtr is a pointer to the core instance.
+* @param    Idx is the buffer index.
+*
+* @return   None.
+*
+* @note     The planes with an address of 0 are left unchanged.
+*
+******************************************************************************/
+static void XVFrmbufWr_ProgramQueueBuf(XV_FrmbufWr_l2 *InstancePtr, u8 Idx)
+{
+  XVidC_FrameBuf *BufPtr = XVidC_FrmQGetBuf(InstancePtr->FrameQueue, Idx);
+
+  (void)XVFrmbufWr_SetBufferAddr(InstancePtr, BufPtr->Addr);
+  if (BufPtr->ChromaAddr != 0) {
+    (void)XVFrmbufWr_SetChromaBufferAddr(InstancePtr, BufPtr->ChromaAddr);
+  }
+  if (BufPtr->VChromaAddr != 0) {
+    (void)XVFrmbufWr_SetVChromaBufferAddr(InstancePtr, BufPtr->VChromaAddr);
+  }
+}
+
+/*****************************************************************************/
+/**
+*
+* This function attaches a frame queue to the core as producer
+*
+* With a queue attached, the ap_ready interrupt handler queues every completed frame
+* and programs the address of the next buffer, the application only has to
+* enable XVFRMBUFWR_IRQ_READY_MASK. Call this function before
+* XVFrmbufWr_Start().
+*
+* @param    InstancePtr is a pointer to the core instance.
+* @param    QueuePtr is a pointer to an initialized frame queue, or NULL to
+*           detach the queue.
+*
+* @return
+*           - XST_SUCCESS if the queue was attached or detached.
+*           - XST_NO_DATA if the queue has no free buffer.
+*
+* @note     None.
+*
+******************************************************************************/
+int XVFrmbufWr_SetFrameQueue(XV_FrmbufWr_l2 *InstancePtr,
+                             XVidC_FrameQueue *QueuePtr)
+{
+  u8 Idx;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  InstancePtr->FrameQueue = NULL;
+  if (QueuePtr == NULL) {
+    return XST_SUCCESS;
+  }
+
+  Idx = XVidC_FrmQFirstFree(QueuePtr);
+  if (Idx == XVIDC_FRMQ_NONE) {
+    return XST_NO_DATA;
+  }
+
+  InstancePtr->FrameQueue = QueuePtr;
+  InstancePtr->QueueActive = XVIDC_FRMQ_NONE;
+  InstancePtr->QueueStaged = Idx;
+  XVFrmbufWr_ProgramQueueBuf(InstancePtr, Idx);
+
+  return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function attaches a latency tracker to the core
+*
+* With a tracker attached, the frame done interrupt handler marks the frame
+* written by the core as a stage of the pipeline. With a frame queue, the
+* frame ID is stored in the queue buffer for the Frame Buffer Read driver.
+*
+* @param    InstancePtr is a pointer to the core instance.
+* @param    LatPtr is a pointer to an initialized latency tracker, or NULL to
+*           detach the tracker.
+* @param    Stage is the pipeline stage of the core.
+*
+* @return   None.
+*
+* @note     The frame done interrupt, XVFRMBUFWR_IRQ_DONE_MASK, must be
+*           enabled.
+*
+******************************************************************************/
+void XVFrmbufWr_SetLatency(XV_FrmbufWr_l2 *InstancePtr,
+                           XVidC_Latency *LatPtr, u8 Stage)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid((LatPtr == NULL) || (Stage < LatPtr->NumStages));
+
+  InstancePtr->Latency = NULL;
+  InstancePtr->LatStage = Stage;
+  InstancePtr->Latency = LatPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function marks the frame the core has written in the latency tracker
+*
+* @param    InstancePtr is a pointer to the core instance.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+static void XVFrmbufWr_LatencyDone(XV_FrmbufWr_l2 *InstancePtr)
+{
+  u32 FrameId;
+
+  FrameId = XVidC_LatMark(InstancePtr->Latency, InstancePtr->LatStage);
+  if ((InstancePtr->FrameQueue != NULL) &&
+      (InstancePtr->QueueActive != XVIDC_FRMQ_NONE)) {
+    XVidC_FrmQGetBuf(InstancePtr->FrameQueue,
+                     InstancePtr->QueueActive)->LatId = FrameId;
+  }
+}
+
+/*****************************************************************************/
+/**
+*
+* This function advances the frame queue on ap_ready
+*
+* The core has latched the staged buffer, so the buffer it wrote before is
+* complete and is queued, and the next buffer is staged.
+*
+* @param    InstancePtr is a pointer to the core instance.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+static void XVFrmbufWr_QueueReady(XV_FrmbufWr_l2 *InstancePtr)
+{
+  u8 Next;
+
+  Next = XVidC_FrmQProduce(InstancePtr->FrameQueue, InstancePtr->QueueActive);
+  InstancePtr->QueueActive = InstancePtr->QueueStaged;
+  if (Next != XVIDC_FRMQ_NONE) {
+    InstancePtr->QueueStaged = Next;
+    XVFrmbufWr_ProgramQueueBuf(InstancePtr, Next);
+  }
+}
+
 /*****************************************************************************/
 /**
 *
@@ -124,6 +280,9 @@ void XVFrmbufWr_InterruptHandler(void *InstancePtr)
   if(Status & XVFRMBUFWR_IRQ_DONE_MASK) {
     /* Clear the interrupt */
     XV_frmbufwr_InterruptClear(&FrmbufWrPtr->FrmbufWr, XVFRMBUFWR_IRQ_DONE_MASK);
+    if(FrmbufWrPtr->Latency) {
+          XVFrmbufWr_LatencyDone(FrmbufWrPtr);
+    }
     //Call user registered callback function, if any
     if(FrmbufWrPtr->FrameDoneCallback) {
           FrmbufWrPtr->FrameDoneCallback(FrmbufWrPtr->CallbackDoneRef);
@@ -134,6 +293,9 @@ void XVFrmbufWr_InterruptHandler(void *InstancePtr)
   if(Status & XVFRMBUFWR_IRQ_READY_MASK) {
     /* Clear the interrupt */
     XV_frmbufwr_InterruptClear(&FrmbufWrPtr->FrmbufWr, XVFRMBUFWR_IRQ_READY_MASK);
+    if(FrmbufWrPtr->FrameQueue) {
+          XVFrmbufWr_QueueReady(FrmbufWrPtr);
+    }
     //Call user registered callback function, if any
     if(FrmbufWrPtr->FrameReadyCallback) {
           FrmbufWrPtr->FrameReadyCallback(FrmbufWrPtr->CallbackReadyRef);
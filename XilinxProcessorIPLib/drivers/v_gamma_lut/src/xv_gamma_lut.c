@@ -4,6 +4,7 @@
 // ==============================================================
 
 /***************************** Include Files *********************************/
+#include <string.h>
 #include "xv_gamma_lut.h"
 
 /************************** Function Implementation *************************/
@@ -19,6 +20,9 @@ int XV_gamma_lut_CfgInitialize(XV_gamma_lut *InstancePtr,
     InstancePtr->Config = *ConfigPtr;
     InstancePtr->Config.BaseAddress = EffectiveAddr;
 
+    /* LUT contents are not known until they are staged */
+    memset(&InstancePtr->Stage, 0, sizeof(InstancePtr->Stage));
+
     /* Set the flag to indicate the driver is ready */
     InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
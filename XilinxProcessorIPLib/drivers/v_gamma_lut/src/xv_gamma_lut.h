@@ -62,6 +62,28 @@ typedef struct {
 } XV_gamma_lut_Config;
 #endif
 
+#define XVGAMMA_LUT_NUM_CHANNELS   3    /**< LUTs of the core */
+#define XVGAMMA_LUT_WORDS          (XV_GAMMA_LUT_CTRL_DEPTH_HWREG_GAMMA_LUT_0/2)
+                                        /**< 32-bit words per LUT */
+#define XVGAMMA_LUT_MASK_WORDS     (XVGAMMA_LUT_WORDS/32)
+
+#define XVGAMMA_LUT_UPDATE_NONE    0    /**< LUT writes go to the core */
+#define XVGAMMA_LUT_UPDATE_OPEN    1    /**< LUTs are being staged */
+#define XVGAMMA_LUT_UPDATE_PENDING 2    /**< Staged LUTs wait for frame done */
+
+/**
+* LUTs staged for the next frame. Word holds the packed entries the core
+* will hold once the update is committed, Dirty the words still to write.
+*/
+typedef struct {
+    u32 Word[XVGAMMA_LUT_NUM_CHANNELS][XVGAMMA_LUT_WORDS];
+    u32 Dirty[XVGAMMA_LUT_NUM_CHANNELS][XVGAMMA_LUT_MASK_WORDS];
+    u16 KnownWords[XVGAMMA_LUT_NUM_CHANNELS]; /**< Words of Word[] known to
+                                                 be in the core or dirty */
+    u8 State;                  /**< XVGAMMA_LUT_UPDATE_* */
+    u32 CommitWrites;          /**< Words written by the last commit */
+} XVGammaLut_Stage;
+
 /**
 * Driver instance data. An instance must be allocated for each core in use.
 */
@@ -74,6 +96,7 @@ typedef struct {
     XVGamma_Lut_Callback FrameReadyCallback;
     void *CallbackReadyRef;     /**< To be passed to the connect interrupt
                                 callback */
+    XVGammaLut_Stage Stage;     /**< LUTs staged for the next frame */
 } XV_gamma_lut;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -162,6 +185,12 @@ void XVGammaLut_SetCallback(XV_gamma_lut *InstancePtr, u32 HandlerType,
 		void *CallbackFunc, void *CallbackRef);
 void XVGammaLut_InterruptHandler(XV_gamma_lut *InstancePtr);
 
+int XVGammaLut_BeginUpdate(XV_gamma_lut *InstancePtr);
+int XVGammaLut_StageLut(XV_gamma_lut *InstancePtr, u32 Channel,
+		const u16 *Lut, u32 Entries);
+int XVGammaLut_EndUpdate(XV_gamma_lut *InstancePtr);
+u32 XVGammaLut_CommitUpdate(XV_gamma_lut *InstancePtr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,6 +20,7 @@
  * Ver   Who    Date     Changes
  * ----- ---- -------- -------------------------------------------------------
  * 1.00  praveenv   13/09/18   Initial Release
+ * 1.5   fl         10/14/26   Commit staged LUTs on frame done
  * </pre>
  *
  ******************************************************************************/
@@ -87,8 +88,8 @@ void XVGammaLut_SetCallback(XV_gamma_lut *InstancePtr, u32 HandlerType,
  * This function is the interrupt handler for the Gamma Lut core driver.
  *
  * This handler clears the pending interrupt and determined if the source is
- * frame done signal. If yes, starts the next frame processing and calls the
- * registered callback function
+ * frame done signal. If yes, writes the LUTs staged with XVGammaLut_StageLut(),
+ * starts the next frame processing and calls the registered callback function
  *
  * The application is responsible for connecting this function to the interrupt
  * system. Application beyond this driver is also responsible for providing
@@ -118,6 +119,8 @@ void XVGammaLut_InterruptHandler(XV_gamma_lut *InstancePtr)
 	if(Status & XVGAMMA_LUT_IRQ_DONE_MASK) {
 		/* Clear the interrupt */
 		XV_gamma_lut_InterruptClear(InstancePtr, XVGAMMA_LUT_IRQ_DONE_MASK);
+		/* Staged LUTs take effect from the next frame */
+		XVGammaLut_CommitUpdate(InstancePtr);
 		//Call user registered callback function, if any
 		if(InstancePtr->FrameDoneCallback) {
 			InstancePtr->FrameDoneCallback(InstancePtr->CallbackDoneRef);
@@ -0,0 +1,238 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xv_gamma_lut_stage.c
+ * @addtogroup v_gamma_lut Overview
+ * @{
+ *
+ * The functions in this file stage new gamma tables in memory and write them
+ * to the core at a frame boundary.
+ *
+ * The core has a single bank for each LUT and reads it while a frame is
+ * processed, so LUT writes made during active video show up on screen. The
+ * tables given to XVGammaLut_StageLut() between XVGammaLut_BeginUpdate() and
+ * XVGammaLut_EndUpdate() are packed into XV_gamma_lut.Stage. In interrupt mode
+ * XVGammaLut_InterruptHandler() writes them on frame done, while the core
+ * waits for the start of the next frame, so that all the LUTs change on the
+ * same frame. Words already in the core are skipped, a small change to a LUT
+ * costs a few register writes. In polling mode the application calls
+ * XVGammaLut_CommitUpdate() itself when XV_gamma_lut_IsDone() is set.
+ *
+ * Outside an update the changed words are written to the core right away,
+ * for the tables programmed before the core is started.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who    Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.5   fl   10/14/26 Initial Release
+ * </pre>
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xv_gamma_lut.h"
+
+/************************** Constant Definitions *****************************/
+/* Byte distance of the LUTs of two channels */
+#define XVGAMMA_LUT_CHANNEL_STRIDE \
+	(XV_GAMMA_LUT_CTRL_ADDR_HWREG_GAMMA_LUT_1_BASE - \
+	 XV_GAMMA_LUT_CTRL_ADDR_HWREG_GAMMA_LUT_0_BASE)
+
+/************************** Function Prototypes ******************************/
+static u32 XVGammaLut_WriteWords(XV_gamma_lut *InstancePtr, u32 Channel);
+
+/*****************************************************************************/
+/**
+ *
+ * This function starts an update. The LUTs staged with XVGammaLut_StageLut()
+ * are kept in memory until XVGammaLut_EndUpdate().
+ *
+ * @param    InstancePtr is a pointer to the GammaLut IP instance.
+ *
+ * @return   XST_SUCCESS if the update was started
+ *           XST_DEVICE_BUSY if an update is already open
+ *
+ * @note     An update ended but not yet committed is reopened, its LUTs are
+ *           committed with the new ones.
+ *
+ ******************************************************************************/
+int XVGammaLut_BeginUpdate(XV_gamma_lut *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->Stage.State == XVGAMMA_LUT_UPDATE_OPEN) {
+		return (XST_DEVICE_BUSY);
+	}
+	InstancePtr->Stage.State = XVGAMMA_LUT_UPDATE_OPEN;
+
+	return (XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function stages a LUT. Two entries are packed per word, as the core
+ * holds them, and the words that differ from the LUT in the core are marked
+ * to be written.
+ *
+ * @param    InstancePtr is a pointer to the GammaLut IP instance.
+ * @param    Channel is the LUT to stage, 0 to XVGAMMA_LUT_NUM_CHANNELS - 1.
+ * @param    Lut is a pointer to the entries.
+ * @param    Entries is the number of entries, 2 to
+ *           XV_GAMMA_LUT_CTRL_DEPTH_HWREG_GAMMA_LUT_0, normally
+ *           1 << MaxDataWidth.
+ *
+ * @return   XST_SUCCESS if the LUT was staged
+ *           XST_INVALID_PARAM if Entries is odd or out of range
+ *
+ * @note     Outside an update the changed words are written to the core.
+ *
+ ******************************************************************************/
+int XVGammaLut_StageLut(XV_gamma_lut *InstancePtr, u32 Channel,
+		const u16 *Lut, u32 Entries)
+{
+	XVGammaLut_Stage *StagePtr;
+	u32 Words;
+	u32 Index;
+	u32 Value;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Channel < XVGAMMA_LUT_NUM_CHANNELS);
+	Xil_AssertNonvoid(Lut != NULL);
+
+	if ((Entries == 0) || (Entries & 1) ||
+	    (Entries > XV_GAMMA_LUT_CTRL_DEPTH_HWREG_GAMMA_LUT_0)) {
+		return (XST_INVALID_PARAM);
+	}
+
+	StagePtr = &InstancePtr->Stage;
+	Words = Entries/2;
+	for (Index = 0; Index < Words; Index++) {
+		Value = (u32)Lut[2*Index] | ((u32)Lut[2*Index + 1] << 16);
+		if ((Index >= StagePtr->KnownWords[Channel]) ||
+		    (StagePtr->Word[Channel][Index] != Value)) {
+			StagePtr->Word[Channel][Index] = Value;
+			StagePtr->Dirty[Channel][Index/32] |= (1U << (Index % 32));
+		}
+	}
+	if (Words > StagePtr->KnownWords[Channel]) {
+		StagePtr->KnownWords[Channel] = (u16)Words;
+	}
+
+	if (StagePtr->State == XVGAMMA_LUT_UPDATE_NONE) {
+		StagePtr->CommitWrites = XVGammaLut_WriteWords(InstancePtr, Channel);
+	}
+
+	return (XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function ends an update. In interrupt mode the staged LUTs are
+ * written by the interrupt handler on the next frame done.
+ *
+ * @param    InstancePtr is a pointer to the GammaLut IP instance.
+ *
+ * @return   XST_SUCCESS if the update was ended
+ *           XST_FAILURE if no update is open
+ *
+ ******************************************************************************/
+int XVGammaLut_EndUpdate(XV_gamma_lut *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (InstancePtr->Stage.State != XVGAMMA_LUT_UPDATE_OPEN) {
+		return (XST_FAILURE);
+	}
+	InstancePtr->Stage.State = XVGAMMA_LUT_UPDATE_PENDING;
+
+	return (XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function writes an ended update to the core.
+ *
+ * @param    InstancePtr is a pointer to the GammaLut IP instance.
+ *
+ * @return   Number of words written, 0 if no update was pending.
+ *
+ * @note     Called by XVGammaLut_InterruptHandler() in interrupt mode. In
+ *           polling mode the application calls it on frame done, after
+ *           XVGammaLut_EndUpdate().
+ *
+ ******************************************************************************/
+u32 XVGammaLut_CommitUpdate(XV_gamma_lut *InstancePtr)
+{
+	u32 Channel;
+	u32 Count = 0;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (InstancePtr->Stage.State != XVGAMMA_LUT_UPDATE_PENDING) {
+		return 0;
+	}
+
+	for (Channel = 0; Channel < XVGAMMA_LUT_NUM_CHANNELS; Channel++) {
+		Count += XVGammaLut_WriteWords(InstancePtr, Channel);
+	}
+	InstancePtr->Stage.CommitWrites = Count;
+	InstancePtr->Stage.State = XVGAMMA_LUT_UPDATE_NONE;
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function writes the dirty words of a LUT, in address order so that
+ * runs of changed words go out back to back.
+ *
+ * @param    InstancePtr is a pointer to the GammaLut IP instance.
+ * @param    Channel is the LUT to write.
+ *
+ * @return   Number of words written.
+ *
+ ******************************************************************************/
+static u32 XVGammaLut_WriteWords(XV_gamma_lut *InstancePtr, u32 Channel)
+{
+	XVGammaLut_Stage *StagePtr = &InstancePtr->Stage;
+	UINTPTR Addr;
+	u32 Mask;
+	u32 Word;
+	u32 Bit;
+	u32 Count = 0;
+
+	Addr = InstancePtr->Config.BaseAddress +
+	       XV_GAMMA_LUT_CTRL_ADDR_HWREG_GAMMA_LUT_0_BASE +
+	       Channel*XVGAMMA_LUT_CHANNEL_STRIDE;
+
+	for (Word = 0; Word < XVGAMMA_LUT_MASK_WORDS; Word++) {
+		Mask = StagePtr->Dirty[Channel][Word];
+		if (Mask == 0) {
+			continue;
+		}
+		for (Bit = 0; Bit < 32; Bit++) {
+			if (Mask & (1U << Bit)) {
+				XV_gamma_lut_WriteReg(Addr, (Word*32 + Bit)*4,
+					StagePtr->Word[Channel][Word*32 + Bit]);
+				Count++;
+			}
+		}
+		StagePtr->Dirty[Channel][Word] = 0;
+	}
+
+	return Count;
+}
+/** @} */
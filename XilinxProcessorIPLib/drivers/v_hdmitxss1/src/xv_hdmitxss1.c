@@ -18,6 +18,9 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  EB   22/05/18 Initial release.
+* 3.4   fl   10/14/26 Hash the sink EDID in XV_HdmiTxSs1_ReadEdid for the
+*                     FRL training cache.
+*                     Mark the Vsync in the latency tracker.
 * </pre>
 *
 ******************************************************************************/
@@ -451,6 +454,13 @@ int XV_HdmiTxSs1_CfgInitialize(XV_HdmiTxSs1 *InstancePtr,
 
   memset((void *)&HdmiTxSs1Ptr->DrmInfoframe, 0, sizeof(XHdmiC_DRMInfoFrame));
   HdmiTxSs1Ptr->DrmInfoframe.Static_Metadata_Descriptor_ID = 0xff;
+
+  /* Initialize the FRL training cache, disabled by default */
+  memset((void *)&HdmiTxSs1Ptr->FrlCache, 0, sizeof(XV_HdmiTxSs1_FrlCache));
+  HdmiTxSs1Ptr->FrlCache.Active = XV_HDMITXSS1_FRL_CACHE_SIZE;
+
+  /* No latency tracker until XV_HdmiTxSs1_SetLatency */
+  HdmiTxSs1Ptr->Latency = NULL;
   HdmiTxSs1Ptr->DrmInfoframe.EOTF = 0xff;
 
   /* Determine sub-cores included in the provided instance of subsystem */
@@ -1051,6 +1061,9 @@ static void XV_HdmiTxSs1_ConnectCallback(void *CallbackRef)
     /* Set stream connected flag */
     HdmiTxSs1Ptr->IsStreamConnected = (FALSE);
 
+    /* The next sink is not known until its EDID is read */
+    HdmiTxSs1Ptr->FrlCache.SinkValid = (FALSE);
+
 #ifdef USE_HDCP_TX
     /* Push disconnect event to the HDCP event queue */
     XV_HdmiTxSs1_HdcpPushEvent(HdmiTxSs1Ptr, XV_HDMITXSS1_HDCP_DISCONNECT_EVT);
@@ -1215,6 +1228,11 @@ static void XV_HdmiTxSs1_VsCallback(void *CallbackRef)
 {
   XV_HdmiTxSs1 *HdmiTxSs1Ptr = (XV_HdmiTxSs1 *)CallbackRef;
 
+  /* Time stamp the frame sent out */
+  if (HdmiTxSs1Ptr->Latency) {
+      (void)XVidC_LatMark(HdmiTxSs1Ptr->Latency, HdmiTxSs1Ptr->LatStage);
+  }
+
   /* Check if user callback has been registered*/
   if (HdmiTxSs1Ptr->VsCallback) {
       HdmiTxSs1Ptr->VsCallback(HdmiTxSs1Ptr->VsRef);
@@ -1679,6 +1697,32 @@ int XV_HdmiTxSs1_SetLogCallback(XV_HdmiTxSs1 *InstancePtr,
     return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function attaches a latency tracker to the subsystem. With a tracker
+* attached, every Vsync of the HDMI TX core marks the frame sent out as a
+* stage of the pipeline, the newest frame of the stage before.
+*
+* @param    InstancePtr is a pointer to the HDMI TX Subsystem instance.
+* @param    LatPtr is a pointer to an initialized latency tracker, or NULL to
+*       detach the tracker.
+* @param    Stage is the pipeline stage of the subsystem.
+*
+* @return   None.
+*
+******************************************************************************/
+void XV_HdmiTxSs1_SetLatency(XV_HdmiTxSs1 *InstancePtr,
+    XVidC_Latency *LatPtr, u8 Stage)
+{
+    Xil_AssertVoid(InstancePtr != NULL);
+    Xil_AssertVoid((LatPtr == NULL) || (Stage < LatPtr->NumStages));
+
+    InstancePtr->Latency = NULL;
+    InstancePtr->LatStage = Stage;
+    InstancePtr->Latency = LatPtr;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1785,6 +1829,15 @@ int XV_HdmiTxSs1_ReadEdid(XV_HdmiTxSs1 *InstancePtr, u8 *Buffer, u32 BufferSize)
 								      Segment++;
 			}
 		}
+
+		/* Identify the sink for the FRL training cache */
+		if (Status == (XST_SUCCESS)) {
+			InstancePtr->FrlCache.SinkHash =
+				XV_HdmiTxSs1_FrlCacheHash(Buffer,
+					(ExtensionFlag + 1) *
+					XV_HDMITXSS1_DDC_EDID_LENGTH);
+			InstancePtr->FrlCache.SinkValid = (TRUE);
+		}
 	}
 	return Status;
 }
@@ -3956,6 +4009,8 @@ static void XV_HdmiTxSs1_FrlLts4Callback(void *CallbackRef)
 			(HdmiTxSs1Ptr->HdmiTx1Ptr->Stream.Frl.FfeLevels << 4) |
 			HdmiTxSs1Ptr->HdmiTx1Ptr->Stream.Frl.LineRate);
 #endif
+
+	XV_HdmiTxSs1_FrlCacheLts4(HdmiTxSs1Ptr);
 }
 
 static void XV_HdmiTxSs1_FrlLtsPCallback(void *CallbackRef)
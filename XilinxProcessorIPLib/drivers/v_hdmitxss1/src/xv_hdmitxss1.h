@@ -33,6 +33,8 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  EB   22/05/18 Initial release.
+* 3.4   fl   10/14/26 Added cache of FRL training results per sink.
+*                     Added latency tracker mark on Vsync.
 * </pre>
 *
 ******************************************************************************/
@@ -49,6 +51,7 @@ extern "C" {
 #include "xv_hdmic.h"
 #include "xv_hdmic_vsif.h"
 #include "xvidc_edid.h"
+#include "xvidc_lat.h"
 #include "xv_hdmitx1.h"
 #include "xvtc.h"
 #include "xv_hdmitxss1_frl.h"
@@ -466,6 +469,11 @@ typedef struct
     u8 CnmvrrEnabled;	/* Cnmvrr enabled by user */
     u8 VrrMode;
 
+    XV_HdmiTxSs1_FrlCache FrlCache;	/**< FRL training cache */
+
+    XVidC_Latency *Latency;	/**< Latency tracker, NULL if not used */
+    u8 LatStage;		/**< Pipeline stage of the subsystem */
+
     XV_HdmiTxSs1_HdcpProtocol    HdcpProtocol;    /**< HDCP protocol selected */
 #ifdef USE_HDCP_TX
     /**< HDCP specific */
@@ -519,6 +527,8 @@ int XV_HdmiTxSs1_SetCallback(XV_HdmiTxSs1 *InstancePtr,
 int XV_HdmiTxSs1_SetLogCallback(XV_HdmiTxSs1 *InstancePtr,
 	u64 *CallbackFunc,
 	void *CallbackRef);
+void XV_HdmiTxSs1_SetLatency(XV_HdmiTxSs1 *InstancePtr,
+	XVidC_Latency *LatPtr, u8 Stage);
 int XV_HdmiTxSs1_SendCvtemAuxPackets(XV_HdmiTxSs1 *InstancePtr, XHdmiC_Aux *DscAuxFifo);
 int XV_HdmiTxSs1_ReadEdid(XV_HdmiTxSs1 *InstancePtr, u8 *BufferPtr, u32 BufferSize);
 int XV_HdmiTxSs1_ReadEdidSegment(XV_HdmiTxSs1 *InstancePtr, u8 *Buffer, u8 segment);
@@ -694,6 +704,11 @@ void XV_HdmiTxSS1_StartFRLStream(XV_HdmiTxSs1 *InstancePtr);
 void XV_HdmiTxSs1_SetFrlExtVidCke(XV_HdmiTxSs1 *InstancePtr);
 void XV_HdmiTxSs1_SetFrlIntVidCke(XV_HdmiTxSs1 *InstancePtr);
 u8 *XV_HdmiTxSs1_GetScdcEdRegisters(XV_HdmiTxSs1 *InstancePtr);
+void XV_HdmiTxSs1_FrlCacheEnable(XV_HdmiTxSs1 *InstancePtr, u8 Enable);
+void XV_HdmiTxSs1_FrlCacheClear(XV_HdmiTxSs1 *InstancePtr);
+void XV_HdmiTxSs1_FrlCacheSetSink(XV_HdmiTxSs1 *InstancePtr, const u8 *Edid,
+				u32 Size);
+void XV_HdmiTxSs1_FrlCacheInvalidate(XV_HdmiTxSs1 *InstancePtr);
 #ifdef __cplusplus
 }
 #endif
@@ -17,6 +17,7 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  EB   22/05/18 Initial release.
+* 3.4   fl   10/14/26 Added cache of FRL training results per sink.
 * </pre>
 *
 ******************************************************************************/
@@ -27,8 +28,13 @@
 #include "xstatus.h"
 #include "xv_hdmitxss1_frl.h"
 #include "xv_hdmitxss1.h"
+#include "string.h"
 
 /************************** Function Prototypes ******************************/
+static XV_HdmiTxSs1_FrlCacheEntry *XV_HdmiTxSs1_FrlCacheLookup(
+		XV_HdmiTxSs1 *InstancePtr);
+static void XV_HdmiTxSs1_FrlCacheStore(XV_HdmiTxSs1 *InstancePtr);
+static void XV_HdmiTxSs1_FrlCacheLtsL(XV_HdmiTxSs1 *InstancePtr);
 
 /************************** Function Definition ******************************/
 
@@ -160,6 +166,16 @@ void XV_HdmiTxSs1_FrlConfigCallback(void *CallbackRef)
 void XV_HdmiTxSs1_FrlFfeCallback(void *CallbackRef)
 {
 	XV_HdmiTxSs1 *HdmiTxSs1Ptr = (XV_HdmiTxSs1 *)CallbackRef;
+	XV_HdmiTx1_Frl *FrlPtr = &HdmiTxSs1Ptr->HdmiTx1Ptr->Stream.Frl;
+	XV_HdmiTxSs1_FrlCache *CachePtr = &HdmiTxSs1Ptr->FrlCache;
+
+	/* Start LTS:3 with the cached TxFFE instead of the lowest level */
+	if (CachePtr->Active < XV_HDMITXSS1_FRL_CACHE_SIZE &&
+	    FrlPtr->TrainingState == XV_HDMITX1_FRLSTATE_LTS_2) {
+		memcpy(FrlPtr->LaneFfeAdjReq.Byte,
+		       CachePtr->Entry[CachePtr->Active].LaneFfe,
+		       sizeof(FrlPtr->LaneFfeAdjReq.Byte));
+	}
 
 	/* Check if user callback has been registered */
 	if (HdmiTxSs1Ptr->FrlFfeCallback) {
@@ -188,6 +204,8 @@ void XV_HdmiTxSs1_FrlStartCallback(void *CallbackRef)
 	XV_HdmiTxSs1_LogWrite(HdmiTxSs1Ptr, XV_HDMITXSS1_LOG_EVT_FRL_LT_PASS, 0);
 #endif
 
+	XV_HdmiTxSs1_FrlCacheStore(HdmiTxSs1Ptr);
+
 	/* Check if user callback has been registered */
 	if (HdmiTxSs1Ptr->FrlStartCallback) {
 	  HdmiTxSs1Ptr->FrlStartCallback(HdmiTxSs1Ptr->FrlStartRef);
@@ -237,6 +255,8 @@ void XV_HdmiTxSs1_TmdsConfigCallback(void *CallbackRef)
 	XV_HdmiTxSs1_LogWrite(HdmiTxSs1Ptr, XV_HDMITXSS1_LOG_EVT_TMDS_START, 0);
 #endif
 
+	XV_HdmiTxSs1_FrlCacheLtsL(HdmiTxSs1Ptr);
+
 	/* Check if user callback has been registered */
 	if (HdmiTxSs1Ptr->TmdsConfigCallback) {
 	  HdmiTxSs1Ptr->TmdsConfigCallback(HdmiTxSs1Ptr->TmdsConfigRef);
@@ -305,17 +325,34 @@ int XV_HdmiTxSs1_StartTmdsMode(XV_HdmiTxSs1 *InstancePtr)
 *
 * @return	Status on if FrlTraining can be started or not.
 *
-* @note     None.
+* @note     When the FRL training cache is enabled and holds a result for
+*           the connected sink, the training starts at the cached FRL rate
+*           with the cached TxFFE levels. If the sink rejects them, the
+*           training continues from FrlRate as without the cache.
 *
 ******************************************************************************/
 int XV_HdmiTxSs1_StartFrlTraining(XV_HdmiTxSs1 *InstancePtr,
 		XHdmiC_MaxFrlRate FrlRate)
 {
+	XV_HdmiTxSs1_FrlCacheEntry *EntryPtr;
+	XV_HdmiTxSs1_FrlCache *CachePtr = &InstancePtr->FrlCache;
+
 #ifdef XV_HDMITXSS1_LOG_ENABLE
 	XV_HdmiTxSs1_LogWrite(InstancePtr, XV_HDMITXSS1_LOG_EVT_FRL_START,
 			FrlRate);
 #endif
 
+	CachePtr->RequestedRate = FrlRate;
+	CachePtr->Active = XV_HDMITXSS1_FRL_CACHE_SIZE;
+	CachePtr->UseCount++;
+
+	EntryPtr = XV_HdmiTxSs1_FrlCacheLookup(InstancePtr);
+	if (EntryPtr != NULL && EntryPtr->FrlRate <= FrlRate) {
+		EntryPtr->LastUse = CachePtr->UseCount;
+		CachePtr->Active = EntryPtr - CachePtr->Entry;
+		FrlRate = (XHdmiC_MaxFrlRate)EntryPtr->FrlRate;
+	}
+
 	return XV_HdmiTx1_StartFrlTraining(InstancePtr->HdmiTx1Ptr,
 			FrlRate);
 }
@@ -476,3 +513,283 @@ void XV_HdmiTxSs1_SetFrlIntVidCke(XV_HdmiTxSs1 *InstancePtr)
 {
 	XV_HdmiTx1_FrlExtVidCkeSource(InstancePtr->HdmiTx1Ptr, FALSE);
 }
+
+/*****************************************************************************/
+/**
+*
+* This function enables or disables the FRL training cache.
+*
+* @param    InstancePtr is a pointer to the XV_HdmiTxSs1 core instance.
+* @param    Enable specifies TRUE to start trainings from the cached results
+*           of known sinks, FALSE to always run a full training.
+*
+* @return   None.
+*
+* @note     Results are still recorded while the cache is disabled.
+*
+******************************************************************************/
+void XV_HdmiTxSs1_FrlCacheEnable(XV_HdmiTxSs1 *InstancePtr, u8 Enable)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->FrlCache.Enable = Enable;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function removes all the entries of the FRL training cache.
+*
+* @param    InstancePtr is a pointer to the XV_HdmiTxSs1 core instance.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XV_HdmiTxSs1_FrlCacheClear(XV_HdmiTxSs1 *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	memset(InstancePtr->FrlCache.Entry, 0,
+	       sizeof(InstancePtr->FrlCache.Entry));
+	InstancePtr->FrlCache.Active = XV_HDMITXSS1_FRL_CACHE_SIZE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function identifies the connected sink for the FRL training cache.
+*
+* @param    InstancePtr is a pointer to the XV_HdmiTxSs1 core instance.
+* @param    Edid is a pointer to the EDID of the sink.
+* @param    Size is the size of the EDID in bytes.
+*
+* @return   None.
+*
+* @note     XV_HdmiTxSs1_ReadEdid does this already, call this function
+*           when the EDID is obtained otherwise.
+*
+******************************************************************************/
+void XV_HdmiTxSs1_FrlCacheSetSink(XV_HdmiTxSs1 *InstancePtr, const u8 *Edid,
+				u32 Size)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(Edid != NULL);
+
+	InstancePtr->FrlCache.SinkHash = XV_HdmiTxSs1_FrlCacheHash(Edid, Size);
+	InstancePtr->FrlCache.SinkValid = (TRUE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function removes the entry of the connected sink from the FRL training
+* cache, so that the next training of the sink is a full training.
+*
+* @param    InstancePtr is a pointer to the XV_HdmiTxSs1 core instance.
+*
+* @return   None.
+*
+* @note     Use when the link fails after a training passed with cached
+*           parameters, for example on character errors reported by CED.
+*
+******************************************************************************/
+void XV_HdmiTxSs1_FrlCacheInvalidate(XV_HdmiTxSs1 *InstancePtr)
+{
+	XV_HdmiTxSs1_FrlCacheEntry *EntryPtr;
+	u8 Enable;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	/* Look the entry up regardless of Enable */
+	Enable = InstancePtr->FrlCache.Enable;
+	InstancePtr->FrlCache.Enable = (TRUE);
+	EntryPtr = XV_HdmiTxSs1_FrlCacheLookup(InstancePtr);
+	InstancePtr->FrlCache.Enable = Enable;
+
+	if (EntryPtr != NULL) {
+		EntryPtr->Valid = (FALSE);
+	}
+	InstancePtr->FrlCache.Active = XV_HDMITXSS1_FRL_CACHE_SIZE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function hashes an EDID with the 32-bit FNV-1a hash.
+*
+* @param    Data is a pointer to the EDID.
+* @param    Size is the size of the EDID in bytes.
+*
+* @return   The hash.
+*
+* @note     None.
+*
+******************************************************************************/
+u32 XV_HdmiTxSs1_FrlCacheHash(const u8 *Data, u32 Size)
+{
+	u32 Hash = 0x811C9DC5;
+	u32 Index;
+
+	for (Index = 0; Index < Size; Index++) {
+		Hash ^= Data[Index];
+		Hash *= 0x01000193;
+	}
+
+	return Hash;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is called when the sink requests a lower FRL rate in LTS:4.
+* If the training started from cached parameters, the cached result is
+* dropped and the training restarts from the FRL rate requested by the
+* application.
+*
+* @param    CallbackRef is a pointer to the XV_HdmiTxSs1 core instance.
+*
+* @return   None.
+*
+* @note     Called before the new FRL rate is written to the sink.
+*
+******************************************************************************/
+void XV_HdmiTxSs1_FrlCacheLts4(void *CallbackRef)
+{
+	XV_HdmiTxSs1 *HdmiTxSs1Ptr = (XV_HdmiTxSs1 *)CallbackRef;
+	XV_HdmiTxSs1_FrlCache *CachePtr = &HdmiTxSs1Ptr->FrlCache;
+	XV_HdmiTx1_Frl *FrlPtr = &HdmiTxSs1Ptr->HdmiTx1Ptr->Stream.Frl;
+	u8 FrlRate;
+
+	if (CachePtr->Active >= XV_HDMITXSS1_FRL_CACHE_SIZE) {
+		return;
+	}
+
+	CachePtr->Entry[CachePtr->Active].Valid = (FALSE);
+	CachePtr->Active = XV_HDMITXSS1_FRL_CACHE_SIZE;
+	CachePtr->Misses++;
+
+	/* The rate was lowered from the cached rate, go back to the rate the
+	 * application asked for unless the sink asked to go below it */
+	FrlRate = CachePtr->RequestedRate;
+	if (FrlRate > FrlPtr->MaxFrlRate) {
+		FrlRate = FrlPtr->MaxFrlRate;
+	}
+	if (FrlRate > (FrlPtr->FrlRate + 1)) {
+		FrlPtr->FrlRate = FrlRate;
+		FrlPtr->LineRate = FrlRateTable[FrlRate].LineRate;
+		FrlPtr->Lanes = FrlRateTable[FrlRate].Lanes;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is called when the FRL link training falls back to LTS:L. A
+* cached result that led to it is dropped.
+*
+* @param    InstancePtr is a pointer to the XV_HdmiTxSs1 core instance.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+static void XV_HdmiTxSs1_FrlCacheLtsL(XV_HdmiTxSs1 *InstancePtr)
+{
+	XV_HdmiTxSs1_FrlCache *CachePtr = &InstancePtr->FrlCache;
+
+	if (CachePtr->Active >= XV_HDMITXSS1_FRL_CACHE_SIZE) {
+		return;
+	}
+
+	CachePtr->Entry[CachePtr->Active].Valid = (FALSE);
+	CachePtr->Active = XV_HDMITXSS1_FRL_CACHE_SIZE;
+	CachePtr->Misses++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the cache entry of the connected sink.
+*
+* @param    InstancePtr is a pointer to the XV_HdmiTxSs1 core instance.
+*
+* @return   Pointer to the entry, or NULL if the cache is disabled, the sink
+*           is unknown or not in the cache.
+*
+* @note     None.
+*
+******************************************************************************/
+static XV_HdmiTxSs1_FrlCacheEntry *XV_HdmiTxSs1_FrlCacheLookup(
+		XV_HdmiTxSs1 *InstancePtr)
+{
+	XV_HdmiTxSs1_FrlCache *CachePtr = &InstancePtr->FrlCache;
+	u8 Index;
+
+	if (CachePtr->Enable == (FALSE) || CachePtr->SinkValid == (FALSE)) {
+		return NULL;
+	}
+
+	for (Index = 0; Index < XV_HDMITXSS1_FRL_CACHE_SIZE; Index++) {
+		if (CachePtr->Entry[Index].Valid == (TRUE) &&
+		    CachePtr->Entry[Index].EdidHash == CachePtr->SinkHash) {
+			return &CachePtr->Entry[Index];
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function records the result of a passed FRL link training for the
+* connected sink, replacing the least recently used entry when the cache is
+* full.
+*
+* @param    InstancePtr is a pointer to the XV_HdmiTxSs1 core instance.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+static void XV_HdmiTxSs1_FrlCacheStore(XV_HdmiTxSs1 *InstancePtr)
+{
+	XV_HdmiTxSs1_FrlCache *CachePtr = &InstancePtr->FrlCache;
+	XV_HdmiTx1_Frl *FrlPtr = &InstancePtr->HdmiTx1Ptr->Stream.Frl;
+	XV_HdmiTxSs1_FrlCacheEntry *EntryPtr = NULL;
+	u8 Index;
+
+	if (CachePtr->Active < XV_HDMITXSS1_FRL_CACHE_SIZE) {
+		CachePtr->Hits++;
+	}
+	CachePtr->Active = XV_HDMITXSS1_FRL_CACHE_SIZE;
+
+	if (CachePtr->SinkValid == (FALSE)) {
+		return;
+	}
+
+	for (Index = 0; Index < XV_HDMITXSS1_FRL_CACHE_SIZE; Index++) {
+		if (CachePtr->Entry[Index].Valid == (TRUE) &&
+		    CachePtr->Entry[Index].EdidHash == CachePtr->SinkHash) {
+			EntryPtr = &CachePtr->Entry[Index];
+			break;
+		}
+		if (EntryPtr == NULL ||
+		    CachePtr->Entry[Index].Valid == (FALSE) ||
+		    (EntryPtr->Valid == (TRUE) &&
+		     CachePtr->Entry[Index].LastUse < EntryPtr->LastUse)) {
+			EntryPtr = &CachePtr->Entry[Index];
+		}
+	}
+
+	EntryPtr->EdidHash = CachePtr->SinkHash;
+	EntryPtr->FrlRate = FrlPtr->FrlRate;
+	memcpy(EntryPtr->LaneFfe, FrlPtr->LaneFfeAdjReq.Byte,
+	       sizeof(EntryPtr->LaneFfe));
+	EntryPtr->LastUse = CachePtr->UseCount;
+	EntryPtr->Valid = (TRUE);
+}
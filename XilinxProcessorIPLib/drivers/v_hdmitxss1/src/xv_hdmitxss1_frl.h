@@ -32,6 +32,7 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  EB   22/05/18 Initial release.
+* 3.4   fl   10/14/26 Added cache of FRL training results per sink.
 * </pre>
 *
 ******************************************************************************/
@@ -47,6 +48,43 @@ extern "C" {
 #include "xil_assert.h"
 #include "xstatus.h"
 
+/************************** Constant Definitions *****************************/
+#define XV_HDMITXSS1_FRL_CACHE_SIZE	4	/**< Sinks kept in the FRL
+						  *  training cache */
+
+/**************************** Type Definitions *******************************/
+/**
+* This typedef contains the result of a successful FRL link training with
+* one sink.
+*/
+typedef struct {
+	u32 EdidHash;		/**< Hash of the sink EDID */
+	u8 Valid;		/**< Entry holds a training result */
+	u8 FrlRate;		/**< Trained FRL rate */
+	u8 LaneFfe[4];		/**< Trained TxFFE level of each lane */
+	u32 LastUse;		/**< Value of UseCount when last used */
+} XV_HdmiTxSs1_FrlCacheEntry;
+
+/**
+* This typedef contains the FRL training cache. When the connected sink has a
+* cached result, the training starts at the cached FRL rate with the cached
+* TxFFE levels, which usually passes LTS:3 at the first attempt.
+*/
+typedef struct {
+	u8 Enable;		/**< Cache is used by
+				  *  XV_HdmiTxSs1_StartFrlTraining */
+	u8 SinkValid;		/**< SinkHash belongs to the connected sink */
+	u32 SinkHash;		/**< Hash of the EDID of the connected sink */
+	u8 Active;		/**< Entry used by the current training, or
+				  *  XV_HDMITXSS1_FRL_CACHE_SIZE */
+	u8 RequestedRate;	/**< FRL rate requested by the application */
+	u32 UseCount;		/**< Trainings started, orders the entries */
+	u32 Hits;		/**< Trainings passed with cached parameters */
+	u32 Misses;		/**< Cached parameters rejected by the sink */
+	XV_HdmiTxSs1_FrlCacheEntry Entry[XV_HDMITXSS1_FRL_CACHE_SIZE];
+				/**< Cached training results */
+} XV_HdmiTxSs1_FrlCache;
+
 #ifdef __cplusplus
 }
 #endif
@@ -56,5 +94,7 @@ void XV_HdmiTxSs1_FrlFfeCallback(void *CallbackRef);
 void XV_HdmiTxSs1_FrlStartCallback(void *CallbackRef);
 void XV_HdmiTxSs1_FrlStopCallback(void *CallbackRef);
 void XV_HdmiTxSs1_TmdsConfigCallback(void *CallbackRef);
+void XV_HdmiTxSs1_FrlCacheLts4(void *CallbackRef);
+u32 XV_HdmiTxSs1_FrlCacheHash(const u8 *Data, u32 Size);
 
 #endif /* end of protection macro */
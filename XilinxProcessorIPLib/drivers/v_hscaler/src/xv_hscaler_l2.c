@@ -31,6 +31,7 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.3   vsa   04/07/20   Improve quality with better coefficient tables
+* 3.4   fl    10/14/26   Added coefficient and phase cache
 * </pre>
 *
 ******************************************************************************/
@@ -48,6 +49,9 @@
 #define XHSC_MASK_LOW_20BITS	   (0x000FFFFF)
 #define XHSC_MASK_LOW_12BITS	   (0x00000FFF)
 
+/* Cache key flag, the entry holds the coefficients selected by the driver */
+#define XHSC_CACHE_DEFAULT_COEFF   (0x1)
+
 /**************************** Type Definitions *******************************/
 
 /**************************** Local Global *******************************/
@@ -75,8 +79,15 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
                             u32 WidthOut,
                             u32 PixelRate);
 
-static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr);
-static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr);
+static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr, u32 *Words);
+static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr, u32 *Words);
+static void XV_HScalerOut(UINTPTR Addr, u32 Val, u32 **WordsPtr);
+static u32 XV_HScalerCoeffWords(XV_Hscaler_l2 *HscPtr);
+static u32 XV_HScalerPhaseWords(XV_Hscaler_l2 *HscPtr);
+static void XV_HScalerWriteCachedCoeff(XV_Hscaler_l2 *HscPtr,
+                                       const u32 *Words);
+static void XV_HScalerWriteCachedPhase(XV_Hscaler_l2 *HscPtr,
+                                       const u32 *Words);
 
 /*****************************************************************************/
 /**
@@ -433,6 +444,7 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
 * This function programs the phase data into core registers
 *
 * @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  Words is filled with the words written, or NULL
 *
 * @return None
 *
@@ -440,7 +452,7 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
 *        User must load the coefficients, using the provided API, before
 *        scaler can be used
 ******************************************************************************/
-static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
+static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr, u32 *Words)
 {
   u32 loopWidth;
   UINTPTR baseAddr;
@@ -464,7 +476,7 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
                 lsb = (u32)(HscPtr->phasesH[i]   & (u64)XHSC_MASK_LOW_16BITS);
                 msb = (u32)(HscPtr->phasesH[i+1] & (u64)XHSC_MASK_LOW_16BITS);
                 val = (msb<<16 | lsb);
-                Xil_Out32(baseAddr+(index*4), val);
+                XV_HScalerOut(baseAddr+(index*4), val, &Words);
                 ++index;
               }
             }
@@ -480,7 +492,7 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
               for(i=0; i < loopWidth; ++i)
               {
                 val = (u32)(HscPtr->phasesH[i] & XHSC_MASK_LOW_32BITS);
-                Xil_Out32(baseAddr+(i*4), val);
+                XV_HScalerOut(baseAddr+(i*4), val, &Words);
               }
             }
             break;
@@ -501,8 +513,8 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
                 phaseHData = HscPtr->phasesH[index];
                 lsb = (u32)(phaseHData & XHSC_MASK_LOW_32BITS);
                 msb = (u32)((phaseHData>>32) & XHSC_MASK_LOW_32BITS);
-                Xil_Out32(baseAddr+(offset*4), lsb);
-                Xil_Out32(baseAddr+((offset+1)*4), msb);
+                XV_HScalerOut(baseAddr+(offset*4), lsb, &Words);
+                XV_HScalerOut(baseAddr+((offset+1)*4), msb, &Words);
                 ++index;
                 offset += 2;
               }
@@ -534,9 +546,9 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
 			bits_32_63 |= ((u32)((phaseHData_H & XHSC_MASK_LOW_20BITS)) << 12);
 			bits_64_95 = (((u32)(phaseHData_H & XHSC_MASK_LOW_32BITS)) >> 20);
 			bits_64_95 |= (((u32)(phaseHData_H>>32) & XHSC_MASK_LOW_12BITS) << 12);
-			Xil_Out32(baseAddr+(offset*4), bits_0_31);
-			Xil_Out32(baseAddr+((offset+1)*4), bits_32_63);
-			Xil_Out32(baseAddr+((offset+2)*4), bits_64_95);
+			XV_HScalerOut(baseAddr+(offset*4), bits_0_31, &Words);
+			XV_HScalerOut(baseAddr+((offset+1)*4), bits_32_63, &Words);
+			XV_HScalerOut(baseAddr+((offset+2)*4), bits_64_95, &Words);
 			/*(offset+3)*4 register is reserved,so increment offset by 4*/
 			offset += 4;
 			index++;
@@ -557,6 +569,7 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
 * registers
 *
 * @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  Words is filled with the words written, or NULL
 *
 * @return None
 *
@@ -564,7 +577,7 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
 *        User must load the coefficients, using the provided API, before
 *        scaler can be used
 ******************************************************************************/
-static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr)
+static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr, u32 *Words)
 {
   int num_phases = 1<<HscPtr->Hsc.Config.PhaseShift;
   int num_taps   = HscPtr->Hsc.Config.NumTaps/2;
@@ -579,9 +592,178 @@ static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr)
     {
        rdIndx = j*2+offset;
        val = (HscPtr->coeff[i][rdIndx+1] << 16) | (HscPtr->coeff[i][rdIndx] & XHSC_MASK_LOW_16BITS);
-       Xil_Out32(baseAddr+((i*num_taps+j)*4), val);
+       XV_HScalerOut(baseAddr+((i*num_taps+j)*4), val, &Words);
+    }
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function writes a core register and records the value when Words is
+* not NULL
+*
+* @param  Addr is the register address
+* @param  Val is the value
+* @param  WordsPtr points to the next free word, or to NULL
+*
+* @return None
+*
+******************************************************************************/
+static void XV_HScalerOut(UINTPTR Addr, u32 Val, u32 **WordsPtr)
+{
+  Xil_Out32(Addr, Val);
+  if(*WordsPtr != NULL)
+  {
+    *(*WordsPtr)++ = Val;
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function returns the number of coefficient words of the core
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+*
+* @return Number of words XV_HScalerSetCoeff() writes
+*
+******************************************************************************/
+static u32 XV_HScalerCoeffWords(XV_Hscaler_l2 *HscPtr)
+{
+  return (1<<HscPtr->Hsc.Config.PhaseShift) * (HscPtr->Hsc.Config.NumTaps/2);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the number of phase words of the core
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+*
+* @return Number of words XV_HScalerSetPhase() writes
+*
+******************************************************************************/
+static u32 XV_HScalerPhaseWords(XV_Hscaler_l2 *HscPtr)
+{
+  u32 loopWidth = HscPtr->Hsc.Config.MaxWidth/HscPtr->Hsc.Config.PixPerClk;
+
+  switch(HscPtr->Hsc.Config.PixPerClk)
+  {
+    case XVIDC_PPC_1:
+            return (loopWidth+1)/2;
+    case XVIDC_PPC_2:
+            return loopWidth;
+    case XVIDC_PPC_4:
+            return loopWidth*2;
+    case XVIDC_PPC_8:
+            return loopWidth*3;
+    default:
+            return 0;
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function writes coefficient words recorded by XV_HScalerSetCoeff()
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  Words is the recorded words
+*
+* @return None
+*
+******************************************************************************/
+static void XV_HScalerWriteCachedCoeff(XV_Hscaler_l2 *HscPtr,
+                                       const u32 *Words)
+{
+  u32 count = XV_HScalerCoeffWords(HscPtr);
+  UINTPTR baseAddr;
+  u32 i;
+
+  baseAddr = XV_hscaler_Get_HwReg_hfltCoeff_BaseAddress(&HscPtr->Hsc);
+  for(i=0; i < count; i++)
+  {
+    Xil_Out32(baseAddr+(i*4), Words[i]);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function writes phase words recorded by XV_HScalerSetPhase()
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  Words is the recorded words
+*
+* @return None
+*
+******************************************************************************/
+static void XV_HScalerWriteCachedPhase(XV_Hscaler_l2 *HscPtr,
+                                       const u32 *Words)
+{
+  u32 count = XV_HScalerPhaseWords(HscPtr);
+  UINTPTR baseAddr;
+  u32 i;
+
+  baseAddr = XV_hscaler_Get_HwReg_phasesH_V_BaseAddress(&HscPtr->Hsc);
+  if(HscPtr->Hsc.Config.PixPerClk == XVIDC_PPC_8)
+  {
+    /* 3 words per entry, the 4th register of an entry is reserved */
+    for(i=0; i < count; i++)
+    {
+      Xil_Out32(baseAddr+(((i/3)*4 + (i%3))*4), Words[i]);
     }
   }
+  else
+  {
+    for(i=0; i < count; i++)
+    {
+      Xil_Out32(baseAddr+(i*4), Words[i]);
+    }
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function returns the size of a cache entry for the core
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return Number of words of a cache entry
+*
+******************************************************************************/
+u32 XV_HScalerGetCacheEntryWords(XV_Hscaler_l2 *InstancePtr)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  return XV_HScalerCoeffWords(InstancePtr) + XV_HScalerPhaseWords(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+* This function sets the coefficient and phase cache of the core
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  CachePtr is a pointer to an initialized cache, or NULL to compute
+*         every configuration
+*
+* @return XST_SUCCESS if the cache was set
+*         XST_INVALID_PARAM if the cache entries are too small
+*
+******************************************************************************/
+int XV_HScalerSetCache(XV_Hscaler_l2 *InstancePtr, XVidC_CoeffCache *CachePtr)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if((CachePtr != NULL) &&
+     (CachePtr->EntryWords < XV_HScalerGetCacheEntryWords(InstancePtr)))
+  {
+    return XST_INVALID_PARAM;
+  }
+
+  InstancePtr->Cache = CachePtr;
+  if(CachePtr != NULL)
+  {
+    XVidC_CoeffCacheFlush(CachePtr);
+  }
+
+  return XST_SUCCESS;
 }
 
 /*****************************************************************************/
@@ -608,6 +790,9 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
                      u32 ColorFormatOut)
 {
   u32 PixelRate;
+  XVidC_CoeffCacheKey Key;
+  u32 *Words = NULL;
+  u8 Hit = 0;
 
   /*
    * Assert validates the input arguments
@@ -626,22 +811,52 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
 
   PixelRate = (WidthIn * STEP_PRECISION)/WidthOut;
 
+  if(InstancePtr->Cache != NULL)
+  {
+    Key.SizeIn = WidthIn;
+    Key.SizeOut = WidthOut;
+    Key.NumTaps = InstancePtr->Hsc.Config.NumTaps;
+    Key.Flags = ((InstancePtr->Hsc.Config.ScalerType == XV_HSCALER_POLYPHASE) &&
+                 !InstancePtr->UseExtCoeff) ? XHSC_CACHE_DEFAULT_COEFF : 0;
+    Words = XVidC_CoeffCacheGet(InstancePtr->Cache, &Key, &Hit);
+  }
+
   if(InstancePtr->Hsc.Config.ScalerType == XV_HSCALER_POLYPHASE)
   {
     if(!InstancePtr->UseExtCoeff)  //No user defined coefficients
     {
-      /* Determine coefficient table to use */
-      XV_HScalerSelectCoeff(InstancePtr, WidthIn, WidthOut);
+      if(Hit)
+      {
+        XV_HScalerWriteCachedCoeff(InstancePtr, Words);
+      }
+      else
+      {
+        /* Determine coefficient table to use */
+        XV_HScalerSelectCoeff(InstancePtr, WidthIn, WidthOut);
+        /* Program generated coefficients into the IP register bank */
+        XV_HScalerSetCoeff(InstancePtr, Words);
+      }
+    }
+    else
+    {
+      XV_HScalerSetCoeff(InstancePtr, NULL);
     }
-    /* Program generated coefficients into the IP register bank */
-    XV_HScalerSetCoeff(InstancePtr);
   }
 
-  /* Compute Phase for 1 line */
-  CalculatePhases(InstancePtr, WidthIn, WidthOut, PixelRate);
+  if(Hit)
+  {
+    XV_HScalerWriteCachedPhase(InstancePtr,
+                               Words + XV_HScalerCoeffWords(InstancePtr));
+  }
+  else
+  {
+    /* Compute Phase for 1 line */
+    CalculatePhases(InstancePtr, WidthIn, WidthOut, PixelRate);
 
-  /* Program computed Phase into the IP register bank */
-  XV_HScalerSetPhase(InstancePtr);
+    /* Program computed Phase into the IP register bank */
+    XV_HScalerSetPhase(InstancePtr,
+                       (Words != NULL) ? Words + XV_HScalerCoeffWords(InstancePtr) : NULL);
+  }
 
   XV_hscaler_Set_HwReg_Height(&InstancePtr->Hsc,        HeightIn);
   XV_hscaler_Set_HwReg_WidthIn(&InstancePtr->Hsc,       WidthIn);
@@ -59,6 +59,15 @@
 * This driver is not thread safe. Any needs for threads or thread mutual
 * exclusion must be satisfied by the layer above this driver.
 *
+* <b> Coefficient Cache </b>
+*
+* A cache set with XV_HScalerSetCache() keeps the packed coefficients and
+* phases of the last configurations. XV_HScalerSetup() of a cached
+* configuration writes them to the core without selecting the coefficients
+* or computing the phases again. The cache is keyed by the input and output
+* widths and the number of taps, the color formats do not change the
+* coefficients or the phases.
+*
 * <b>Limitations</b>
 *
 * <pre>
@@ -71,6 +80,7 @@
 *       dmc   12/17/15   Add macro to query the Is422Enabled flag that was
 *                        added to the XV_hscaler_Config structure
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
+* 3.4   fl    10/14/26   Added coefficient and phase cache
 * </pre>
 *
 ******************************************************************************/
@@ -82,6 +92,7 @@ extern "C" {
 #endif
 
 #include "xvidc.h"
+#include "xvidc_coeffcache.h"
 #include "xv_hscaler.h"
 
 /************************** Constant Definitions *****************************/
@@ -127,6 +138,7 @@ typedef struct
   short coeff[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_MAX_H_TAPS];
   u64 phasesH[XV_HSCALER_MAX_LINE_WIDTH];
   u64 phasesH_H[XV_HSCALER_MAX_LINE_WIDTH];
+  XVidC_CoeffCache *Cache; /*<< Optional coefficient and phase cache */
 }XV_Hscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -185,6 +197,8 @@ int XV_HScalerValidateConfig(XV_Hscaler_l2 *InstancePtr,
                              u32 ColorFormatIn,
                              u32 ColorFormatOut);
 void XV_HScalerDbgReportStatus(XV_Hscaler_l2 *InstancePtr);
+u32 XV_HScalerGetCacheEntryWords(XV_Hscaler_l2 *InstancePtr);
+int XV_HScalerSetCache(XV_Hscaler_l2 *InstancePtr, XVidC_CoeffCache *CachePtr);
 
 #ifdef __cplusplus
 }
@@ -49,6 +49,8 @@
 * 6.00  pg    01/10/20   Add Colorimetry feature.
 *                        Program Mixer CSC registers to do color conversion
 *                        from YUV to RGB and RGB to YUV.
+* 7.00  fl    10/14/26   Add shadow registers and batched layer updates
+*                        Add XVidC_VideoBuf support for layers
 * </pre>
 *
 ******************************************************************************/
@@ -94,6 +96,10 @@ static void SetPowerOnDefaultState(XV_Mix_l2 *InstancePtr);
 static int IsWindowValid(XVidC_VideoStream *Strm,
                          XVidC_VideoWindow *Win,
                          XVMix_Scalefactor ScaleFactor);
+static int XVMix_ShadowSlot(u32 Offset);
+static u32 XVMix_ShadowOffset(u32 Slot);
+static void XVMix_WriteReg(XV_Mix_l2 *InstancePtr, u32 Offset, u32 Value);
+static u32 XVMix_ReadReg(XV_Mix_l2 *InstancePtr, u32 Offset);
 
 /*****************************************************************************/
 /**
@@ -269,6 +275,245 @@ void XVMix_Stop(XV_Mix_l2 *InstancePtr)
 
   if (Data == 0)
         return;
+
+  /* Core is reset after the flush, register contents are not known */
+  memset(InstancePtr->Shadow.Known, 0, sizeof(InstancePtr->Shadow.Known));
+}
+
+/*****************************************************************************/
+/**
+* This function returns the shadow slot of a register
+*
+* @param  Offset is the register offset
+*
+* @return Slot index, or -1 if the register is not shadowed
+*
+******************************************************************************/
+static int XVMix_ShadowSlot(u32 Offset)
+{
+  u32 Window, Reg;
+
+  if(Offset == XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA) {
+    return 0;
+  }
+  if((Offset >= XV_MIX_CTRL_ADDR_HWREG_BACKGROUND_Y_R_DATA) &&
+     (Offset <= XV_MIX_CTRL_ADDR_HWREG_BACKGROUND_V_B_DATA)) {
+    return 1 + (Offset - XV_MIX_CTRL_ADDR_HWREG_BACKGROUND_Y_R_DATA)/8;
+  }
+  if((Offset >= XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA) &&
+     (Offset <= XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMAX_B_DATA)) {
+    return 4 + (Offset - XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA)/8;
+  }
+
+  /* Layer1-16 registers, one XVMIX_REG_OFFSET window per layer */
+  Window = Offset/XVMIX_REG_OFFSET;
+  if((Window < 2) || (Window > (XVMIX_MAX_SUPPORTED_LAYERS + 1))) {
+    return -1;
+  }
+  Reg = Offset % XVMIX_REG_OFFSET;
+  if(Reg <= (XV_MIX_CTRL_ADDR_HWREG_LAYERVIDEOFORMAT_0_DATA - XVMIX_REG_OFFSET)) {
+    Reg = Reg/8;
+  } else if(Reg == (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA - 2*XVMIX_REG_OFFSET)) {
+    Reg = 8;
+  } else if(Reg == (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA - 2*XVMIX_REG_OFFSET)) {
+    Reg = 9;
+  } else {
+    return -1;
+  }
+  return 16 + (Window - 2)*XVMIX_SHADOW_LAYER_REGS + Reg;
+}
+
+/*****************************************************************************/
+/**
+* This function returns the register offset of a shadow slot
+*
+* @param  Slot is the slot index returned by XVMix_ShadowSlot()
+*
+* @return Register offset
+*
+******************************************************************************/
+static u32 XVMix_ShadowOffset(u32 Slot)
+{
+  u32 Window, Reg;
+
+  if(Slot == 0) {
+    return XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA;
+  }
+  if(Slot < 4) {
+    return XV_MIX_CTRL_ADDR_HWREG_BACKGROUND_Y_R_DATA + (Slot - 1)*8;
+  }
+  if(Slot < 16) {
+    return XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA + (Slot - 4)*8;
+  }
+
+  Window = 2 + (Slot - 16)/XVMIX_SHADOW_LAYER_REGS;
+  Reg = (Slot - 16) % XVMIX_SHADOW_LAYER_REGS;
+  if(Reg == 8) {
+    Reg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA - 2*XVMIX_REG_OFFSET;
+  } else if(Reg == 9) {
+    Reg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA - 2*XVMIX_REG_OFFSET;
+  } else {
+    Reg = Reg*8;
+  }
+  return Window*XVMIX_REG_OFFSET + Reg;
+}
+
+/*****************************************************************************/
+/**
+* This function writes a layer register. During a batched update the value
+* is kept in the shadow until XVMix_CommitUpdate().
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Offset is the register offset
+* @param  Value is the register value
+*
+* @return None
+*
+******************************************************************************/
+static void XVMix_WriteReg(XV_Mix_l2 *InstancePtr, u32 Offset, u32 Value)
+{
+  XVMix_Shadow *ShadowPtr = &InstancePtr->Shadow;
+  int Slot = XVMix_ShadowSlot(Offset);
+  u32 Mask;
+
+  if(Slot < 0) {
+    XV_mix_WriteReg(InstancePtr->Mix.Config.BaseAddress, Offset, Value);
+    return;
+  }
+
+  Mask = 1 << (Slot % 32);
+  ShadowPtr->Value[Slot] = Value;
+  if(ShadowPtr->State == XVMIX_UPDATE_OPEN) {
+    ShadowPtr->Dirty[Slot/32] |= Mask;
+  } else {
+    XV_mix_WriteReg(InstancePtr->Mix.Config.BaseAddress, Offset, Value);
+    ShadowPtr->Written[Slot] = Value;
+    ShadowPtr->Known[Slot/32] |= Mask;
+    ShadowPtr->Dirty[Slot/32] &= ~Mask;
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function reads a layer register. During a batched update the value
+* not yet written to the core is returned.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Offset is the register offset
+*
+* @return Register value
+*
+******************************************************************************/
+static u32 XVMix_ReadReg(XV_Mix_l2 *InstancePtr, u32 Offset)
+{
+  XVMix_Shadow *ShadowPtr = &InstancePtr->Shadow;
+  int Slot = XVMix_ShadowSlot(Offset);
+
+  if((Slot >= 0) && (ShadowPtr->Dirty[Slot/32] & (1 << (Slot % 32)))) {
+    return ShadowPtr->Value[Slot];
+  }
+  return XV_mix_ReadReg(InstancePtr->Mix.Config.BaseAddress, Offset);
+}
+
+/*****************************************************************************/
+/**
+* This function starts a batched update. The layer settings that follow are
+* kept in the shadow until XVMix_EndUpdate().
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return XST_SUCCESS if the update was started
+*         XST_DEVICE_BUSY if an update is already open
+*
+* @note   An update ended but not yet committed is reopened, its settings are
+*         committed with the new ones.
+*
+******************************************************************************/
+int XVMix_BeginUpdate(XV_Mix_l2 *InstancePtr)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if(InstancePtr->Shadow.State == XVMIX_UPDATE_OPEN) {
+    return(XST_DEVICE_BUSY);
+  }
+  InstancePtr->Shadow.State = XVMIX_UPDATE_OPEN;
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function ends a batched update. In interrupt mode the settings are
+* written by the interrupt handler before the next frame is started.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return XST_SUCCESS if the update was ended
+*         XST_FAILURE if no update is open
+*
+******************************************************************************/
+int XVMix_EndUpdate(XV_Mix_l2 *InstancePtr)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if(InstancePtr->Shadow.State != XVMIX_UPDATE_OPEN) {
+    return(XST_FAILURE);
+  }
+  InstancePtr->Shadow.State = XVMIX_UPDATE_PENDING;
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function writes an ended batched update to the core. Registers whose
+* value is already in the core are skipped.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return Number of registers written
+*
+* @note   Called by XVMix_InterruptHandler() in interrupt mode. In polling
+*         mode the application calls it after XVMix_EndUpdate().
+*
+******************************************************************************/
+u32 XVMix_CommitUpdate(XV_Mix_l2 *InstancePtr)
+{
+  XVMix_Shadow *ShadowPtr;
+  u32 Word, Bits, Slot, Mask;
+  u32 Count = 0;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  ShadowPtr = &InstancePtr->Shadow;
+  if(ShadowPtr->State != XVMIX_UPDATE_PENDING) {
+    return 0;
+  }
+
+  for(Word = 0; Word < XVMIX_SHADOW_MASK_WORDS; ++Word) {
+    Bits = ShadowPtr->Dirty[Word];
+    while(Bits) {
+      Mask = Bits & (~Bits + 1);
+      Bits &= ~Mask;
+      Slot = Word*32;
+      while(!(Mask & (1 << (Slot % 32)))) {
+        ++Slot;
+      }
+      if(!(ShadowPtr->Known[Word] & Mask) ||
+         (ShadowPtr->Written[Slot] != ShadowPtr->Value[Slot])) {
+        XV_mix_WriteReg(InstancePtr->Mix.Config.BaseAddress,
+                        XVMix_ShadowOffset(Slot), ShadowPtr->Value[Slot]);
+        ShadowPtr->Written[Slot] = ShadowPtr->Value[Slot];
+        ShadowPtr->Known[Word] |= Mask;
+        ++Count;
+      }
+    }
+    ShadowPtr->Dirty[Word] = 0;
+  }
+  ShadowPtr->CommitWrites = Count;
+  ShadowPtr->State = XVMIX_UPDATE_NONE;
+
+  return Count;
 }
 
 /*****************************************************************************/
@@ -349,7 +594,6 @@ void XVMix_SetVidStream(XV_Mix_l2 *InstancePtr,
 ******************************************************************************/
 int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 NumLayers, CurrenState;
   int Status = XST_FAILURE;
 
@@ -357,21 +601,20 @@ int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
   Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LAST));
 
-  MixPtr = &InstancePtr->Mix;
   NumLayers = XVMix_GetNumLayers(InstancePtr);
 
   //Check if request is to enable all layers or single layer
   if(LayerId == XVMIX_LAYER_ALL) {
-    XV_mix_Set_HwReg_layerEnable(MixPtr, XVMIX_MASK_ENABLE_ALL_LAYERS);
+    XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA, XVMIX_MASK_ENABLE_ALL_LAYERS);
     Status = XST_SUCCESS;
   }
   else if((LayerId < NumLayers) ||
           ((LayerId == XVMIX_LAYER_LOGO) &&
            (XVMix_IsLogoEnabled(InstancePtr)))) {
 
-    CurrenState = XV_mix_Get_HwReg_layerEnable(MixPtr);
+    CurrenState = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA);
     CurrenState |= (1<<LayerId);
-    XV_mix_Set_HwReg_layerEnable(MixPtr, CurrenState);
+    XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA, CurrenState);
     Status = XST_SUCCESS;
   }
   return(Status);
@@ -391,7 +634,6 @@ int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 ******************************************************************************/
 int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 NumLayers, CurrenState;
   int Status = XST_FAILURE;
 
@@ -399,20 +641,19 @@ int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
   Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LAST));
 
-  MixPtr = &InstancePtr->Mix;
   NumLayers = XVMix_GetNumLayers(InstancePtr);
 
   //Check if request is to disable all layers or single layer
   if(LayerId == XVMIX_LAYER_ALL) {
-    XV_mix_Set_HwReg_layerEnable(MixPtr, XVMIX_MASK_DISABLE_ALL_LAYERS);
+    XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA, XVMIX_MASK_DISABLE_ALL_LAYERS);
     Status = XST_SUCCESS;
   }
   else if((LayerId < NumLayers) ||
           ((LayerId == XVMIX_LAYER_LOGO) &&
            (XVMix_IsLogoEnabled(InstancePtr)))) {
-    CurrenState = XV_mix_Get_HwReg_layerEnable(MixPtr);
+    CurrenState = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA);
     CurrenState &= ~(1<<LayerId);
-    XV_mix_Set_HwReg_layerEnable(MixPtr, CurrenState);
+    XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA, CurrenState);
     Status = XST_SUCCESS;
   }
   return(Status);
@@ -431,16 +672,14 @@ int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 ******************************************************************************/
 int XVMix_IsLayerEnabled(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 State, Mask;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LAST));
 
-  MixPtr = &InstancePtr->Mix;
   Mask = (1<<LayerId);
-  State = XV_mix_Get_HwReg_layerEnable(MixPtr);
+  State = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA);
   return ((State & Mask) ? TRUE : FALSE);
 }
 
@@ -487,9 +726,9 @@ void XVMix_SetBackgndColor(XV_Mix_l2 *InstancePtr,
   }
 
   /* Set Background Color */
-  XV_mix_Set_HwReg_background_Y_R(&InstancePtr->Mix, y_r_val);
-  XV_mix_Set_HwReg_background_U_G(&InstancePtr->Mix, u_g_val);
-  XV_mix_Set_HwReg_background_V_B(&InstancePtr->Mix, v_b_val);
+  XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_BACKGROUND_Y_R_DATA, y_r_val);
+  XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_BACKGROUND_U_G_DATA, u_g_val);
+  XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_BACKGROUND_V_B_DATA, v_b_val);
 }
 
 /*****************************************************************************/
@@ -545,10 +784,10 @@ int XVMix_SetLayerWindow(XV_Mix_l2 *InstancePtr,
                           (Win->Width  <= MixPtr->Config.MaxLogoWidth) &&
                           (Win->Height <= MixPtr->Config.MaxLogoHeight));
          if(WinResInRange) {
-            XV_mix_Set_HwReg_logoStartX(MixPtr, Win->StartX);
-            XV_mix_Set_HwReg_logoStartY(MixPtr, Win->StartY);
-            XV_mix_Set_HwReg_logoWidth(MixPtr,  Win->Width);
-            XV_mix_Set_HwReg_logoHeight(MixPtr, Win->Height);
+            XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA, Win->StartX);
+            XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA, Win->StartY);
+            XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOWIDTH_DATA, Win->Width);
+            XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOHEIGHT_DATA, Win->Height);
 
             InstancePtr->Layer[LayerId].Win = *Win;
             Status = XST_SUCCESS;
@@ -598,17 +837,17 @@ int XVMix_SetLayerWindow(XV_Mix_l2 *InstancePtr,
              BaseStrideReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTRIDE_0_DATA;
              Offset = LayerId*XVMIX_REG_OFFSET;
 
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+             XVMix_WriteReg(InstancePtr,
                              (BaseStartXReg+Offset), Win->StartX);
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+             XVMix_WriteReg(InstancePtr,
                              (BaseStartYReg+Offset), Win->StartY);
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+             XVMix_WriteReg(InstancePtr,
                              (BaseWidthReg+Offset),  Win->Width);
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+             XVMix_WriteReg(InstancePtr,
                              (BaseHeightReg+Offset), Win->Height);
 
              if(!XVMix_IsLayerInterfaceStream(InstancePtr, LayerId)) {
-                XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+                XVMix_WriteReg(InstancePtr,
                                 (BaseStrideReg+Offset), StrideInBytes);
              }
              InstancePtr->Layer[LayerId].Win = *Win;
@@ -643,7 +882,6 @@ int XVMix_GetLayerWindow(XV_Mix_l2 *InstancePtr,
                          XVMix_LayerId LayerId,
                          XVidC_VideoWindow *Win)
 {
-  XV_mix *MixPtr;
   int Status = XST_FAILURE;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -651,16 +889,14 @@ int XVMix_GetLayerWindow(XV_Mix_l2 *InstancePtr,
                     (LayerId <= XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Win != NULL);
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
 
-        Win->StartX = XV_mix_Get_HwReg_logoStartX(MixPtr);
-        Win->StartY = XV_mix_Get_HwReg_logoStartY(MixPtr);
-        Win->Width  = XV_mix_Get_HwReg_logoWidth(MixPtr);
-        Win->Height = XV_mix_Get_HwReg_logoHeight(MixPtr);
+        Win->StartX = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA);
+        Win->StartY = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA);
+        Win->Width  = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOWIDTH_DATA);
+        Win->Height = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOHEIGHT_DATA);
 
         Status = XST_SUCCESS;
       } else {
@@ -681,13 +917,13 @@ int XVMix_GetLayerWindow(XV_Mix_l2 *InstancePtr,
         BaseHeightReg = XV_MIX_CTRL_ADDR_HWREG_LAYERHEIGHT_0_DATA;
         Offset = LayerId*XVMIX_REG_OFFSET;
 
-        Win->StartX = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+        Win->StartX = XVMix_ReadReg(InstancePtr,
                                      (BaseStartXReg+Offset));
-        Win->StartY = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+        Win->StartY = XVMix_ReadReg(InstancePtr,
                                      (BaseStartYReg+Offset));
-        Win->Width  = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+        Win->Width  = XVMix_ReadReg(InstancePtr,
                                      (BaseWidthReg+Offset));
-        Win->Height = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+        Win->Height = XVMix_ReadReg(InstancePtr,
                                      (BaseHeightReg+Offset));
 
         Status = XST_SUCCESS;
@@ -720,7 +956,6 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
                           u16 StartX,
                           u16 StartY)
 {
-  XV_mix *MixPtr;
   XVidC_VideoWindow CurrWin;
   XVMix_Scalefactor Scale;
   int Status = XST_FAILURE;
@@ -749,14 +984,12 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
       return(XVMIX_ERR_LAYER_WINDOW_INVALID);
   }
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
 
-        XV_mix_Set_HwReg_logoStartX(MixPtr, StartX);
-        XV_mix_Set_HwReg_logoStartY(MixPtr, StartY);
+        XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA, StartX);
+        XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA, StartY);
 
         InstancePtr->Layer[LayerId].Win.StartX = StartX;
         InstancePtr->Layer[LayerId].Win.StartY = StartY;
@@ -773,9 +1006,9 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
         BaseStartYReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTY_0_DATA;
         Offset = LayerId*XVMIX_REG_OFFSET;
 
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+        XVMix_WriteReg(InstancePtr,
                         (BaseStartXReg+Offset), StartX);
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+        XVMix_WriteReg(InstancePtr,
                         (BaseStartYReg+Offset), StartY);
 
         InstancePtr->Layer[LayerId].Win.StartX = StartX;
@@ -804,7 +1037,6 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
                               XVMix_LayerId LayerId,
                               XVMix_Scalefactor Scale)
 {
-  XV_mix *MixPtr;
   XVidC_VideoWindow CurrWin;
   int Status = XST_FAILURE;
   int WinStatus;
@@ -825,12 +1057,10 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
       return(XVMIX_ERR_LAYER_WINDOW_INVALID);
   }
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
-        XV_mix_Set_HwReg_logoScaleFactor(MixPtr, Scale);
+        XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSCALEFACTOR_DATA, Scale);
         Status = XST_SUCCESS;
       }
       break;
@@ -842,7 +1072,7 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA;
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+        XVMix_WriteReg(InstancePtr,
                         (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Scale);
 
         Status = XST_SUCCESS;
@@ -866,19 +1096,16 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
 ******************************************************************************/
 int XVMix_GetLayerScaleFactor(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 ReadVal = ~0;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId <= XVMIX_LAYER_LOGO));
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
-        ReadVal = XV_mix_Get_HwReg_logoScaleFactor(MixPtr);
+        ReadVal = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSCALEFACTOR_DATA);
       }
       break;
 
@@ -888,7 +1115,7 @@ int XVMix_GetLayerScaleFactor(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA;
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+        ReadVal = XVMix_ReadReg(InstancePtr,
                                  (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
       }
       break;
@@ -913,7 +1140,6 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
                         XVMix_LayerId LayerId,
                         u16 Alpha)
 {
-  XV_mix *MixPtr;
   int Status = XST_FAILURE;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -921,12 +1147,10 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
                     (LayerId <= XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Alpha <= XVMIX_ALPHA_MAX);
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
-        XV_mix_Set_HwReg_logoAlpha(MixPtr, Alpha);
+        XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOALPHA_DATA, Alpha);
         Status = XST_SUCCESS;
       } else {
         Status = XVMIX_ERR_DISABLED_IN_HW;
@@ -939,7 +1163,7 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA;
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+        XVMix_WriteReg(InstancePtr,
                         (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Alpha);
         Status = XST_SUCCESS;
       } else {
@@ -964,19 +1188,16 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
 ******************************************************************************/
 int XVMix_GetLayerAlpha(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 ReadVal = ~0;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId <= XVMIX_LAYER_LOGO));
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
-        ReadVal = XV_mix_Get_HwReg_logoAlpha(MixPtr);
+        ReadVal = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOALPHA_DATA);
       }
       break;
 
@@ -986,7 +1207,7 @@ int XVMix_GetLayerAlpha(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA;
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+        ReadVal = XVMix_ReadReg(InstancePtr,
                                  (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
       }
       break;
@@ -1031,7 +1252,7 @@ int XVMix_SetLayerColorFormat(XV_Mix_l2 *InstancePtr,
           u32 BaseReg;
 
           BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERVIDEOFORMAT_0_DATA;
-          XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+          XVMix_WriteReg(InstancePtr,
                           (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Cfmt);
       }
       InstancePtr->Layer[LayerId].ColorFormat = Cfmt;
@@ -1077,7 +1298,7 @@ int XVMix_GetLayerColorFormat(XV_Mix_l2 *InstancePtr,
           u32 BaseReg;
 
           BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERVIDEOFORMAT_0_DATA;
-          *Cfmt = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+          *Cfmt = XVMix_ReadReg(InstancePtr,
                                  (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
       }
 #endif
@@ -1109,7 +1330,6 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
                              XVMix_LayerId LayerId,
                              UINTPTR Addr)
 {
-  XV_mix *MixPtr;
   UINTPTR BaseReg, Align;
   u32 WinValid = FALSE;
   int Status = XST_FAILURE;
@@ -1119,8 +1339,6 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
                     (LayerId < XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Addr != 0);
 
-  MixPtr = &InstancePtr->Mix;
-
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
       /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
       Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
@@ -1134,7 +1352,7 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
       if(WinValid) {
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA;
 
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+        XVMix_WriteReg(InstancePtr,
                         (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
 
         InstancePtr->Layer[LayerId].BufAddr = Addr;
@@ -1158,7 +1376,6 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
 ******************************************************************************/
 UINTPTR XVMix_GetLayerBufferAddr(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 BaseReg;
   UINTPTR ReadVal = 0;
 
@@ -1166,12 +1383,10 @@ UINTPTR XVMix_GetLayerBufferAddr(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LOGO));
 
-  MixPtr = &InstancePtr->Mix;
-
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA;
 
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+        ReadVal = XVMix_ReadReg(InstancePtr,
                                  (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)));
   }
   return(ReadVal);
@@ -1195,7 +1410,6 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                                    XVMix_LayerId LayerId,
                                    UINTPTR Addr)
 {
-  XV_mix *MixPtr;
   UINTPTR BaseReg, Align;
   u32 WinValid = FALSE;
   int Status = XST_FAILURE;
@@ -1205,8 +1419,6 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                     (LayerId < XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Addr != 0);
 
-  MixPtr = &InstancePtr->Mix;
-
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
       /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
       Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
@@ -1220,7 +1432,7 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
       if(WinValid) {
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA;
 
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+        XVMix_WriteReg(InstancePtr,
                         (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
 
         InstancePtr->Layer[LayerId].ChromaBufAddr = Addr;
@@ -1246,7 +1458,6 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
 UINTPTR XVMix_GetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                                        XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 BaseReg;
   UINTPTR ReadVal = 0;
 
@@ -1254,17 +1465,51 @@ UINTPTR XVMix_GetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LOGO));
 
-  MixPtr = &InstancePtr->Mix;
-
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA;
 
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+        ReadVal = XVMix_ReadReg(InstancePtr,
                                  (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)));
   }
   return(ReadVal);
 }
 
+/*****************************************************************************/
+/**
+* This function sets the buffer addresses of the specified layer from a
+* video buffer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated
+* @param  BufPtr is the video buffer to be read by the layer
+*
+* @return XST_SUCCESS or an error of the Set*BufferAddr functions
+*
+* @note   Applicable only for Layer1-8. The layer window must have been set
+*         with a stride of BufPtr->Plane[0].Stride. The buffer is flushed
+*         only when the CPU wrote it since it was last flushed.
+*
+******************************************************************************/
+int XVMix_SetLayerVideoBuf(XV_Mix_l2 *InstancePtr,
+                           XVMix_LayerId LayerId,
+                           XVidC_VideoBuf *BufPtr)
+{
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(BufPtr != NULL);
+
+  XVidC_VBufForDevice(BufPtr);
+
+  Status = XVMix_SetLayerBufferAddr(InstancePtr, LayerId,
+                                    BufPtr->Plane[0].Addr);
+  if ((Status == XST_SUCCESS) && (BufPtr->NumPlanes > 1)) {
+    Status = XVMix_SetLayerChromaBufferAddr(InstancePtr, LayerId,
+                                            BufPtr->Plane[1].Addr);
+  }
+  return(Status);
+}
+
 /*****************************************************************************/
 /**
 * This function sets the logo layer color key data
@@ -1280,7 +1525,6 @@ UINTPTR XVMix_GetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
 int XVMix_SetLogoColorKey(XV_Mix_l2 *InstancePtr,
                           XVMix_LogoColorKey ColorKeyData)
 {
-  XV_mix *MixPtr;
   int Status = XST_FAILURE;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -1288,14 +1532,12 @@ int XVMix_SetLogoColorKey(XV_Mix_l2 *InstancePtr,
   if(XVMix_IsLogoEnabled(InstancePtr) &&
      XVMix_IsLogoColorKeyEnabled(InstancePtr)) {
 
-      MixPtr = &InstancePtr->Mix;
-
-      XV_mix_Set_HwReg_logoClrKeyMin_R(MixPtr, ColorKeyData.RGB_Min[0]);
-      XV_mix_Set_HwReg_logoClrKeyMin_G(MixPtr, ColorKeyData.RGB_Min[1]);
-      XV_mix_Set_HwReg_logoClrKeyMin_B(MixPtr, ColorKeyData.RGB_Min[2]);
-      XV_mix_Set_HwReg_logoClrKeyMax_R(MixPtr, ColorKeyData.RGB_Max[0]);
-      XV_mix_Set_HwReg_logoClrKeyMax_G(MixPtr, ColorKeyData.RGB_Max[1]);
-      XV_mix_Set_HwReg_logoClrKeyMax_B(MixPtr, ColorKeyData.RGB_Max[2]);
+      XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMIN_R_DATA, ColorKeyData.RGB_Min[0]);
+      XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMIN_G_DATA, ColorKeyData.RGB_Min[1]);
+      XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMIN_B_DATA, ColorKeyData.RGB_Min[2]);
+      XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMAX_R_DATA, ColorKeyData.RGB_Max[0]);
+      XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMAX_G_DATA, ColorKeyData.RGB_Max[1]);
+      XVMix_WriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMAX_B_DATA, ColorKeyData.RGB_Max[2]);
 
       Status = XST_SUCCESS;
   }
@@ -1317,7 +1559,6 @@ int XVMix_SetLogoColorKey(XV_Mix_l2 *InstancePtr,
 int XVMix_GetLogoColorKey(XV_Mix_l2 *InstancePtr,
                           XVMix_LogoColorKey *ColorKeyData)
 {
-  XV_mix *MixPtr;
   int Status = XST_FAILURE;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -1325,14 +1566,12 @@ int XVMix_GetLogoColorKey(XV_Mix_l2 *InstancePtr,
   if(XVMix_IsLogoEnabled(InstancePtr) &&
      XVMix_IsLogoColorKeyEnabled(InstancePtr)) {
 
-      MixPtr = &InstancePtr->Mix;
-
-      ColorKeyData->RGB_Min[0] = XV_mix_Get_HwReg_logoClrKeyMin_R(MixPtr);
-      ColorKeyData->RGB_Min[1] = XV_mix_Get_HwReg_logoClrKeyMin_G(MixPtr);
-      ColorKeyData->RGB_Min[2] = XV_mix_Get_HwReg_logoClrKeyMin_B(MixPtr);
-      ColorKeyData->RGB_Max[0] = XV_mix_Get_HwReg_logoClrKeyMax_R(MixPtr);
-      ColorKeyData->RGB_Max[1] = XV_mix_Get_HwReg_logoClrKeyMax_G(MixPtr);
-      ColorKeyData->RGB_Max[2] = XV_mix_Get_HwReg_logoClrKeyMax_B(MixPtr);
+      ColorKeyData->RGB_Min[0] = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMIN_R_DATA);
+      ColorKeyData->RGB_Min[1] = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMIN_G_DATA);
+      ColorKeyData->RGB_Min[2] = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMIN_B_DATA);
+      ColorKeyData->RGB_Max[0] = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMAX_R_DATA);
+      ColorKeyData->RGB_Max[1] = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMAX_G_DATA);
+      ColorKeyData->RGB_Max[2] = XVMix_ReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOCLRKEYMAX_B_DATA);
 
       Status = XST_SUCCESS;
   }
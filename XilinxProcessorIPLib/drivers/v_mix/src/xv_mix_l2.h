@@ -80,6 +80,18 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Layer Updates </b>
+*
+* Layer settings are written to the core as soon as the corresponding API is
+* called, and a frame may use some of the new settings and not the others.
+* To update many layers at once, enclose the calls in XVMix_BeginUpdate() and
+* XVMix_EndUpdate(). The settings are then kept in a shadow of the layer
+* registers and XVMix_InterruptHandler() writes them to the core in a single
+* burst before it starts the next frame, so the next frame uses all of them.
+* Registers whose value is already in the core are not written again. In
+* polling mode the core runs free, XVMix_CommitUpdate() writes the settings
+* immediately. Settings written with the layer-1 API bypass the shadow.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -107,6 +119,9 @@
 * 4.00  vyc   04/04/18   Add 8th overlayer
 *                        Move logo layer enable from bit 8 to bit 15
 * 6.00  pg    01/10/20   Add Colorimetry Feature
+* 7.00  fl    10/14/26   Add shadow registers and batched layer updates
+*                        Add XVidC_VideoBuf support for layers
+*                        Add latency tracker marks
 * </pre>
 *
 ******************************************************************************/
@@ -118,6 +133,8 @@ extern "C" {
 #endif
 
 #include "xvidc.h"
+#include "xvidc_vbuf.h"
+#include "xvidc_lat.h"
 #include "xv_mix.h"
 
 /************************** Constant Definitions *****************************/
@@ -125,6 +142,12 @@ extern "C" {
 #define XVMIX_ALPHA_MIN                  (0)
 #define XVMIX_ALPHA_MAX                  (256)
 
+/* Shadowed registers: layer enable, background, logo and 10 per layer */
+#define XVMIX_SHADOW_LAYER_REGS          (10)
+#define XVMIX_SHADOW_REGS                (16 + (XVMIX_SHADOW_LAYER_REGS * \
+                                          XVMIX_MAX_SUPPORTED_LAYERS))
+#define XVMIX_SHADOW_MASK_WORDS          ((XVMIX_SHADOW_REGS + 31) / 32)
+
 #define XVMIX_IRQ_DONE_MASK              (0x01)
 #define XVMIX_IRQ_READY_MASK             (0x02)
 
@@ -295,6 +318,27 @@ typedef struct {
 */
 typedef void (*XVMix_Callback)(void *CallbackRef);
 
+/**
+ * This typedef enumerates the states of a batched layer update
+ */
+typedef enum {
+  XVMIX_UPDATE_NONE = 0,   /**< Settings are written immediately */
+  XVMIX_UPDATE_OPEN,       /**< Settings are kept in the shadow */
+  XVMIX_UPDATE_PENDING     /**< Settings wait for the next frame */
+}XVMix_UpdateState;
+
+/**
+ * Shadow of the layer registers
+ */
+typedef struct {
+  u32 Value[XVMIX_SHADOW_REGS];    /**< Latest value of each register */
+  u32 Dirty[XVMIX_SHADOW_MASK_WORDS]; /**< Value not written to the core */
+  u32 Known[XVMIX_SHADOW_MASK_WORDS]; /**< Value last written is known */
+  u32 Written[XVMIX_SHADOW_REGS];  /**< Value last written to the core */
+  volatile XVMix_UpdateState State;   /**< Batched update state */
+  u32 CommitWrites;                /**< Registers written by last commit */
+}XVMix_Shadow;
+
 /**
  * Mixer driver Layer 2 data. The user is required to allocate a variable
  * of this type for every mixer device in the system. A pointer to a
@@ -313,6 +357,11 @@ typedef struct {
     XVMix_BackgroundId BkgndColor;
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+
+    XVMix_Shadow Shadow;         /**< Shadow of the layer registers */
+
+    XVidC_Latency *Latency;      /**< Latency tracker, NULL if not used */
+    u8 LatStage;                 /**< Pipeline stage of the core */
 }XV_Mix_l2;
 
 /************************** Macros Definitions *******************************/
@@ -516,6 +565,9 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                                    UINTPTR Addr);
 UINTPTR XVMix_GetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                                        XVMix_LayerId LayerId);
+int XVMix_SetLayerVideoBuf(XV_Mix_l2 *InstancePtr,
+                           XVMix_LayerId LayerId,
+                           XVidC_VideoBuf *BufPtr);
 
 int XVMix_SetLogoColorKey(XV_Mix_l2 *InstancePtr,
                           XVMix_LogoColorKey ColorKeyData);
@@ -534,12 +586,17 @@ int XVMix_LoadLogoPixelAlpha(XV_Mix_l2 *InstancePtr,
                              XVidC_VideoWindow *Win,
                              u8 *ABuffer);
 
+int XVMix_BeginUpdate(XV_Mix_l2 *InstancePtr);
+int XVMix_EndUpdate(XV_Mix_l2 *InstancePtr);
+u32 XVMix_CommitUpdate(XV_Mix_l2 *InstancePtr);
+
 void XVMix_DbgReportStatus(XV_Mix_l2 *InstancePtr);
 void XVMix_DbgLayerInfo(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
 
 /* Interrupt related function */
 void XVMix_InterruptHandler(void *InstancePtr);
 int XVMix_SetCallback(XV_Mix_l2 *InstancePtr, void *CallbackFunc, void *CallbackRef);
+void XVMix_SetLatency(XV_Mix_l2 *InstancePtr, XVidC_Latency *LatPtr, u8 Stage);
 void XVMix_InterruptEnable(XV_Mix_l2 *InstancePtr);
 void XVMix_InterruptDisable(XV_Mix_l2 *InstancePtr);
 static void XVMix_SetCoeffForYuvToRgb(XV_Mix_l2 *InstancePtr,
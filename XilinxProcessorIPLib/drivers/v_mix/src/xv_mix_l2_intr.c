@@ -21,6 +21,8 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   12/14/15   Initial Release
 *             02/12/16   Move user call back before frame start trigger
+* 7.00  fl    10/14/26   Commit pending layer updates before frame start
+*                        Mark frame done in the latency tracker
 *
 * </pre>
 *
@@ -60,6 +62,34 @@ int XVMix_SetCallback(XV_Mix_l2 *InstancePtr, void *CallbackFunc, void *Callback
   return(XST_SUCCESS);
 }
 
+/*****************************************************************************/
+/**
+*
+* This function attaches a latency tracker to the mixer
+*
+* With a tracker attached, the frame done interrupt handler marks the frame
+* as a stage of the pipeline, the newest frame of the stage before.
+*
+* @param    InstancePtr is a pointer to the mixer core instance.
+* @param    LatPtr is a pointer to an initialized latency tracker, or NULL to
+*           detach the tracker.
+* @param    Stage is the pipeline stage of the mixer.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XVMix_SetLatency(XV_Mix_l2 *InstancePtr, XVidC_Latency *LatPtr, u8 Stage)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid((LatPtr == NULL) || (Stage < LatPtr->NumStages));
+
+  InstancePtr->Latency = NULL;
+  InstancePtr->LatStage = Stage;
+  InstancePtr->Latency = LatPtr;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -99,10 +129,17 @@ void XVMix_InterruptHandler(void *InstancePtr)
 
   /* Check for Done Signal */
   if(Status & XVMIX_IRQ_DONE_MASK) {
+    if(MixPtr->Latency) {
+      (void)XVidC_LatMark(MixPtr->Latency, MixPtr->LatStage);
+    }
     //Call user registered callback function, if any
     if(MixPtr->FrameDoneCallback) {
 	      MixPtr->FrameDoneCallback(MixPtr->CallbackRef);
     }
+    //Apply batched layer updates, if any
+    if(MixPtr->Shadow.State == XVMIX_UPDATE_PENDING) {
+      XVMix_CommitUpdate(MixPtr);
+    }
     XV_mix_Start(&MixPtr->Mix);
   }
 }
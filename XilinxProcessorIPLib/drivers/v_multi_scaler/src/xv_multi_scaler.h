@@ -105,6 +105,8 @@ typedef struct {
     XVMultiScaler_Callback FrameDoneCallback;
     void *CallbackRef;
     u8 OutBitMask;
+    XVMultiScaler_Callback JobDoneHandler;
+    void *JobRef;
 } XV_multi_scaler;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -80,6 +80,8 @@ void *XV_MultiScalerIntrHandler(void *InstancePtr)
 		XV_multi_scaler_InterruptClear(MscPtr,
 			XV_MULTI_SCALER_ISR_DONE_BIT_MASK |
 			XV_MULTI_SCALER_ISR_READY_BIT_MASK);
+		if (MscPtr->JobDoneHandler)
+			MscPtr->JobDoneHandler(MscPtr->JobRef);
 		if (MscPtr->FrameDoneCallback)
 			MscPtr->FrameDoneCallback(MscPtr);
 	}
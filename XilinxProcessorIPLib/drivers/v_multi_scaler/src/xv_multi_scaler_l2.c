@@ -20,6 +20,7 @@
 
 /***************************** Include Files *********************************/
 #include "xv_multi_scaler_l2.h"
+#include <string.h>
 #include "xvidc.h"
 
 /************************** Constant Definitions *****************************/
@@ -262,9 +263,67 @@ static const void (*XV_MS_Set_DstImgBuf1[XV_MAX_OUTS])(XV_multi_scaler
 	XV_multi_scaler_Set_HwReg_dstImgBuf1_6_V,
 	XV_multi_scaler_Set_HwReg_dstImgBuf1_7_V};
 
+/* Layout of the register image of a channel job */
+enum {
+	XV_MS_REG_WIDTHIN = 0,
+	XV_MS_REG_WIDTHOUT,
+	XV_MS_REG_HEIGHTIN,
+	XV_MS_REG_HEIGHTOUT,
+	XV_MS_REG_LINERATE,
+	XV_MS_REG_PIXELRATE,
+	XV_MS_REG_INPIXELFMT,
+	XV_MS_REG_OUTPIXELFMT,
+	XV_MS_REG_INSTRIDE,
+	XV_MS_REG_OUTSTRIDE,
+	XV_MS_REG_SRCIMGBUF0,
+	XV_MS_REG_SRCIMGBUF0_HI,
+	XV_MS_REG_SRCIMGBUF1,
+	XV_MS_REG_SRCIMGBUF1_HI,
+	XV_MS_REG_DSTIMGBUF0,
+	XV_MS_REG_DSTIMGBUF0_HI,
+	XV_MS_REG_DSTIMGBUF1,
+	XV_MS_REG_DSTIMGBUF1_HI
+};
+
+#define XV_MS_CHAN_REG_OFFSETS(n) { \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_WIDTHIN_##n##_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_WIDTHOUT_##n##_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_HEIGHTIN_##n##_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_HEIGHTOUT_##n##_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_LINERATE_##n##_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_PIXELRATE_##n##_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_INPIXELFMT_##n##_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_OUTPIXELFMT_##n##_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_INSTRIDE_##n##_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_OUTSTRIDE_##n##_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_SRCIMGBUF0_##n##_V_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_SRCIMGBUF0_##n##_V_DATA + 4, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_SRCIMGBUF1_##n##_V_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_SRCIMGBUF1_##n##_V_DATA + 4, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_DSTIMGBUF0_##n##_V_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_DSTIMGBUF0_##n##_V_DATA + 4, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_DSTIMGBUF1_##n##_V_DATA, \
+	XV_MULTI_SCALER_CTRL_ADDR_HWREG_DSTIMGBUF1_##n##_V_DATA + 4 }
+
+static const u32 XV_MS_ChanRegOffset[XV_MAX_OUTS]
+	[XV_MULTISCALER_NUM_CHAN_REGS] = {
+	XV_MS_CHAN_REG_OFFSETS(0), XV_MS_CHAN_REG_OFFSETS(1),
+	XV_MS_CHAN_REG_OFFSETS(2), XV_MS_CHAN_REG_OFFSETS(3),
+	XV_MS_CHAN_REG_OFFSETS(4), XV_MS_CHAN_REG_OFFSETS(5),
+	XV_MS_CHAN_REG_OFFSETS(6), XV_MS_CHAN_REG_OFFSETS(7)};
+
 /************************** Function Prototypes ******************************/
-static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
-				   XV_multi_scaler_Video_Config *MS_cfg);
+static const short *XV_MultiScalerSelectCoeff(XV_multi_scaler *MscPtr,
+	u32 SizeIn, u32 SizeOut);
+static void XV_MultiScalerWriteCoeff(XV_multi_scaler *MscPtr,
+	u32 Offset, const short *coeff);
+static void XV_MultiScalerComputeChannel(XV_multi_scaler *InstancePtr,
+	XV_multi_scaler_Video_Config *MS_cfg,
+	XV_multi_scaler_Channel_Job *ChanPtr);
+static void XV_MultiScalerSetAddr(u32 *Reg, UINTPTR Addr);
+static void XV_MultiScalerJobApply(XV_multi_scaler_Job_Queue *QueuePtr,
+	XV_multi_scaler_Job *JobPtr);
+static void XV_MultiScalerJobDone(void *CallbackRef);
 
 /*****************************************************************************/
 /**
@@ -345,30 +404,22 @@ void XV_MultiScalerSetNumOutputs(XV_multi_scaler *InstancePtr, u32 NumOuts)
 
 /*****************************************************************************/
 /**
-* This function programs the computed filter coefficients and phase data into
-* core registers
+* This function selects the fixed filter coefficients for a scaling ratio
 *
 * @param	MscPtr is a pointer to the core instance to be worked on.
-* @param	NumOut is the output channel number.
+* @param	SizeIn is the input width or height.
+* @param	SizeOut is the output width or height.
 *
-* @return None
+* @return Pointer to the coefficients, XV_MULTISCALER_TAPS_12 per phase
 *
 ******************************************************************************/
-static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
-		XV_multi_scaler_Video_Config *MS_cfg)
+static const short *XV_MultiScalerSelectCoeff(XV_multi_scaler *MscPtr,
+	u32 SizeIn, u32 SizeOut)
 {
-	u32 num_phases = 1<<MscPtr->PhaseShift;
-	u32 num_taps	= MscPtr->NumTaps/2;
-	u32 val;
-	u32 i;
-	u32 j;
-	u32 baseAddr;
-	short *coeff;
-	u32 vfltcoef_offset;
-	u32 hfltcoef_offset;
+	const short *coeff = NULL;
 	float scale;
 
-	scale = (float)MS_cfg->HeightIn / MS_cfg->HeightOut;
+	scale = (float)SizeIn / SizeOut;
 	if ((scale >= 2) && (scale < 2.5))
 	{
 		if(MscPtr->NumTaps == 6)
@@ -416,73 +467,32 @@ static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 	if(scale < 1)
 		coeff = &XV_multiscaler_fixedcoeff_taps6_12C[0][0];
 
-	vfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE +
-		MS_cfg->ChannelId *
-		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
-
-	baseAddr = MscPtr->Ctrl_BaseAddress + vfltcoef_offset;
-	for (i = 0; i < num_phases; i++) {
-		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
-			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
-				(coeff[i * XV_MULTISCALER_TAPS_12 + j] & 0x0000FFFF);
-			XV_multi_scaler_WriteReg(baseAddr,
-					((i * num_taps + j / 2) * 4), val);
-		}
-	}
-
-	scale = (float)MS_cfg->WidthIn / MS_cfg->WidthOut;
-	if ((scale >= 2) && (scale < 2.5))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		else
-			coeff = &XV_multiscaler_fixedcoeff_taps8_12C[0][0];
-	}
-	if ((scale >= 2.5) && (scale < 3))
-	{
-		if(MscPtr->NumTaps >= 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			else
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		}
-	}
-
-	if ((scale >= 3) && (scale < 3.5))
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			if(MscPtr->NumTaps == 8)
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-			if(MscPtr->NumTaps == 10)
-				coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		}
-
-	if ((scale >= 3.5) || (scale < 2 && scale >= 1))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		if(MscPtr->NumTaps == 8)
-			coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		if(MscPtr->NumTaps == 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
-	}
-	if(scale < 1)
-		coeff = &XV_multiscaler_fixedcoeff_taps6_12C[0][0];
+	return coeff;
+}
 
-	hfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE +
-		MS_cfg->ChannelId *
-		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+/*****************************************************************************/
+/**
+* This function programs filter coefficients and phase data into core
+* registers
+*
+* @param	MscPtr is a pointer to the core instance to be worked on.
+* @param	Offset is the offset of the coefficient memory of the channel.
+* @param	coeff is the coefficient table.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerWriteCoeff(XV_multi_scaler *MscPtr,
+	u32 Offset, const short *coeff)
+{
+	u32 num_phases = 1<<MscPtr->PhaseShift;
+	u32 num_taps	= MscPtr->NumTaps/2;
+	u32 val;
+	u32 i;
+	u32 j;
+	u32 baseAddr;
 
-	baseAddr = MscPtr->Ctrl_BaseAddress + hfltcoef_offset;
+	baseAddr = MscPtr->Ctrl_BaseAddress + Offset;
 	for (i = 0; i < num_phases; i++) {
 		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
 			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
@@ -536,28 +546,45 @@ void XV_MultiScalerGetChannelConfig(XV_multi_scaler *InstancePtr,
 
 /*****************************************************************************/
 /**
-* This function configures the scaler core registers with the specified
-* configuration parameters
+* This function splits an address over the two words of a 64 bit register
+*
+* @param	Reg points to the low word in a channel register image.
+* @param	Addr is the address.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerSetAddr(u32 *Reg, UINTPTR Addr)
+{
+	Reg[0] = (u32)Addr;
+	Reg[1] = (u32)((u64)Addr >> 32);
+}
+
+/*****************************************************************************/
+/**
+* This function validates a channel configuration and computes the register
+* values and the filter coefficients of the channel
 *
 * @param	InstancePtr is a pointer to the core instance to be worked on.
 * @param	MS_cfg is a pointer to the multi scaler config structure.
+* @param	ChanPtr is filled with the channel configuration.
 *
 * @return None
 *
 ******************************************************************************/
-void XV_MultiScalerSetChannelConfig(XV_multi_scaler *InstancePtr,
-	XV_multi_scaler_Video_Config *MS_cfg)
+static void XV_MultiScalerComputeChannel(XV_multi_scaler *InstancePtr,
+	XV_multi_scaler_Video_Config *MS_cfg,
+	XV_multi_scaler_Channel_Job *ChanPtr)
 {
 	u32 PixelRate;
 	u32 LineRate;
 	u32 i;
 	u16 Cfmt;
-	UINTPTR SrcImgBuf0;
-	UINTPTR SrcImgBuf1;
 	u8 buf0_numerator;
 	u8 buf0_denominator;
 	u8 buf1_numerator;
 	u8 buf1_denominator;
+	u32 *Reg = ChanPtr->Reg;
 
 	/*
 	* Assert validates the input arguments
@@ -591,7 +618,8 @@ void XV_MultiScalerSetChannelConfig(XV_multi_scaler *InstancePtr,
 		Xil_AssertVoid(MS_cfg->SrcImgBuf1 > (MS_cfg->DstImgBuf1 +
 			(MS_cfg->HeightOut * MS_cfg->OutStride)));
 	}
-	InstancePtr->OutBitMask |= 0x1 << i;
+	ChanPtr->SrcOffset0 = 0;
+	ChanPtr->SrcOffset1 = 0;
 	if (MS_cfg->CropWin.Crop) {
 		Xil_AssertVoid(MS_cfg->CropWin.StartY <= MS_cfg->HeightIn);
 		Xil_AssertVoid(MS_cfg->CropWin.StartX <= MS_cfg->WidthIn);
@@ -602,8 +630,6 @@ void XV_MultiScalerSetChannelConfig(XV_multi_scaler *InstancePtr,
 			(MS_cfg->CropWin.Width <= (MS_cfg->WidthIn -
 			MS_cfg->CropWin.StartX)));
 		Cfmt = MS_cfg->ColorFormatIn;
-		SrcImgBuf0 = MS_cfg->SrcImgBuf0;
-		SrcImgBuf1 = MS_cfg->SrcImgBuf1;
 		/* Table 3 Pixel formats supported in PG325 */
 		switch (Cfmt) {
 			case XV_MULTI_SCALER_Y_UV10:
@@ -657,38 +683,328 @@ void XV_MultiScalerSetChannelConfig(XV_multi_scaler *InstancePtr,
 				buf1_denominator = 1;
 				break;
 		}
-		SrcImgBuf0 += (MS_cfg->CropWin.StartY * MS_cfg->InStride)
+		ChanPtr->SrcOffset0 = (MS_cfg->CropWin.StartY * MS_cfg->InStride)
 			+ ((MS_cfg->CropWin.StartX * buf0_numerator) / buf0_denominator);
-		SrcImgBuf1 += (MS_cfg->CropWin.StartY * MS_cfg->InStride)
+		ChanPtr->SrcOffset1 = (MS_cfg->CropWin.StartY * MS_cfg->InStride)
 			+ ((MS_cfg->CropWin.StartX * buf1_numerator) / buf1_denominator);
-		XV_MS_Set_SrcImgBuf0[i](InstancePtr, SrcImgBuf0);
-		XV_MS_Set_SrcImgBuf1[i](InstancePtr, SrcImgBuf1);
 		PixelRate = (u32) ((float)(MS_cfg->CropWin.Width * STEP_PRECISION +
 			MS_cfg->WidthOut / 2) / MS_cfg->WidthOut);
 		LineRate = (u32) ((float)(MS_cfg->CropWin.Height * STEP_PRECISION +
 			MS_cfg->HeightOut / 2) / MS_cfg->HeightOut);
-		XV_MS_Set_HeightIn[i](InstancePtr, MS_cfg->CropWin.Height);
-		XV_MS_Set_WidthIn[i](InstancePtr, MS_cfg->CropWin.Width);
+		Reg[XV_MS_REG_HEIGHTIN] = MS_cfg->CropWin.Height;
+		Reg[XV_MS_REG_WIDTHIN] = MS_cfg->CropWin.Width;
 	} else {
-		XV_MS_Set_SrcImgBuf0[i](InstancePtr, MS_cfg->SrcImgBuf0);
-		XV_MS_Set_SrcImgBuf1[i](InstancePtr, MS_cfg->SrcImgBuf1);
 		PixelRate = (u32) ((float)(MS_cfg->WidthIn * STEP_PRECISION +
 			MS_cfg->WidthOut / 2) / MS_cfg->WidthOut);
 		LineRate = (u32) ((float)(MS_cfg->HeightIn * STEP_PRECISION +
 			MS_cfg->HeightOut / 2) / MS_cfg->HeightOut);
-		XV_MS_Set_HeightIn[i](InstancePtr, MS_cfg->HeightIn);
-		XV_MS_Set_WidthIn[i](InstancePtr, MS_cfg->WidthIn);
+		Reg[XV_MS_REG_HEIGHTIN] = MS_cfg->HeightIn;
+		Reg[XV_MS_REG_WIDTHIN] = MS_cfg->WidthIn;
+	}
+	ChanPtr->VCoeff = XV_MultiScalerSelectCoeff(InstancePtr,
+		MS_cfg->HeightIn, MS_cfg->HeightOut);
+	ChanPtr->HCoeff = XV_MultiScalerSelectCoeff(InstancePtr,
+		MS_cfg->WidthIn, MS_cfg->WidthOut);
+	Reg[XV_MS_REG_WIDTHOUT] = MS_cfg->WidthOut;
+	Reg[XV_MS_REG_HEIGHTOUT] = MS_cfg->HeightOut;
+	Reg[XV_MS_REG_LINERATE] = LineRate;
+	Reg[XV_MS_REG_PIXELRATE] = PixelRate;
+	Reg[XV_MS_REG_INPIXELFMT] = MS_cfg->ColorFormatIn;
+	Reg[XV_MS_REG_OUTPIXELFMT] = MS_cfg->ColorFormatOut;
+	Reg[XV_MS_REG_INSTRIDE] = MS_cfg->InStride;
+	Reg[XV_MS_REG_OUTSTRIDE] = MS_cfg->OutStride;
+	XV_MultiScalerSetAddr(&Reg[XV_MS_REG_SRCIMGBUF0],
+		MS_cfg->SrcImgBuf0 + ChanPtr->SrcOffset0);
+	XV_MultiScalerSetAddr(&Reg[XV_MS_REG_SRCIMGBUF1],
+		MS_cfg->SrcImgBuf1 + ChanPtr->SrcOffset1);
+	XV_MultiScalerSetAddr(&Reg[XV_MS_REG_DSTIMGBUF0], MS_cfg->DstImgBuf0);
+	XV_MultiScalerSetAddr(&Reg[XV_MS_REG_DSTIMGBUF1], MS_cfg->DstImgBuf1);
+}
+
+/*****************************************************************************/
+/**
+* This function configures the scaler core registers with the specified
+* configuration parameters
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+* @param	MS_cfg is a pointer to the multi scaler config structure.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerSetChannelConfig(XV_multi_scaler *InstancePtr,
+	XV_multi_scaler_Video_Config *MS_cfg)
+{
+	XV_multi_scaler_Channel_Job Chan;
+	u32 i;
+	u32 r;
+
+	XV_MultiScalerComputeChannel(InstancePtr, MS_cfg, &Chan);
+
+	i = MS_cfg->ChannelId;
+	InstancePtr->OutBitMask |= 0x1 << i;
+	for (r = 0; r < XV_MULTISCALER_NUM_CHAN_REGS; r++)
+		XV_multi_scaler_WriteReg(InstancePtr->Ctrl_BaseAddress,
+			XV_MS_ChanRegOffset[i][r], Chan.Reg[r]);
+	XV_MultiScalerWriteCoeff(InstancePtr,
+		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE +
+		i * XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET,
+		Chan.VCoeff);
+	XV_MultiScalerWriteCoeff(InstancePtr,
+		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE +
+		i * XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET,
+		Chan.HCoeff);
+}
+
+/*****************************************************************************/
+/**
+* This function clears a job
+*
+* @param	JobPtr is a pointer to the job.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerJobInit(XV_multi_scaler_Job *JobPtr)
+{
+	Xil_AssertVoid(JobPtr != NULL);
+
+	(void)memset(JobPtr, 0, sizeof(*JobPtr));
+}
+
+/*****************************************************************************/
+/**
+* This function computes the configuration of a channel into a job. The
+* configuration is validated as in XV_MultiScalerSetChannelConfig() but no
+* register is written.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+* @param	JobPtr is a pointer to the job.
+* @param	MS_cfg is a pointer to the multi scaler config structure.
+*
+* @return None
+*
+* @note Channels of a job must start at 0 and be contiguous, as for
+*	XV_MultiScalerStart().
+*
+******************************************************************************/
+void XV_MultiScalerJobSetChannel(XV_multi_scaler *InstancePtr,
+	XV_multi_scaler_Job *JobPtr, XV_multi_scaler_Video_Config *MS_cfg)
+{
+	Xil_AssertVoid(JobPtr != NULL);
+	Xil_AssertVoid(MS_cfg != NULL);
+	Xil_AssertVoid(MS_cfg->ChannelId < XV_MAX_OUTS);
+
+	XV_MultiScalerComputeChannel(InstancePtr, MS_cfg,
+		&JobPtr->Chan[MS_cfg->ChannelId]);
+	JobPtr->OutBitMask |= 0x1 << MS_cfg->ChannelId;
+}
+
+/*****************************************************************************/
+/**
+* This function changes the buffers of a channel of a job. The crop window
+* of the channel is applied to the new source buffers.
+*
+* @param	JobPtr is a pointer to the job.
+* @param	ChannelId is a channel set with XV_MultiScalerJobSetChannel().
+* @param	SrcImgBuf0 is the source luma or packed buffer.
+* @param	SrcImgBuf1 is the source chroma buffer.
+* @param	DstImgBuf0 is the destination luma or packed buffer.
+* @param	DstImgBuf1 is the destination chroma buffer.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerJobSetBuffers(XV_multi_scaler_Job *JobPtr, u32 ChannelId,
+	UINTPTR SrcImgBuf0, UINTPTR SrcImgBuf1, UINTPTR DstImgBuf0,
+	UINTPTR DstImgBuf1)
+{
+	XV_multi_scaler_Channel_Job *ChanPtr;
+
+	Xil_AssertVoid(JobPtr != NULL);
+	Xil_AssertVoid(ChannelId < XV_MAX_OUTS);
+	Xil_AssertVoid(JobPtr->OutBitMask & (0x1 << ChannelId));
+
+	ChanPtr = &JobPtr->Chan[ChannelId];
+	XV_MultiScalerSetAddr(&ChanPtr->Reg[XV_MS_REG_SRCIMGBUF0],
+		SrcImgBuf0 + ChanPtr->SrcOffset0);
+	XV_MultiScalerSetAddr(&ChanPtr->Reg[XV_MS_REG_SRCIMGBUF1],
+		SrcImgBuf1 + ChanPtr->SrcOffset1);
+	XV_MultiScalerSetAddr(&ChanPtr->Reg[XV_MS_REG_DSTIMGBUF0], DstImgBuf0);
+	XV_MultiScalerSetAddr(&ChanPtr->Reg[XV_MS_REG_DSTIMGBUF1], DstImgBuf1);
+}
+
+/*****************************************************************************/
+/**
+* This function initializes the job queue of a core. The core must be idle.
+*
+* @param	QueuePtr is a pointer to the job queue.
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+* @note The first job writes all the registers of its channels.
+*
+******************************************************************************/
+void XV_MultiScalerJobQueueInit(XV_multi_scaler_Job_Queue *QueuePtr,
+	XV_multi_scaler *InstancePtr)
+{
+	Xil_AssertVoid(QueuePtr != NULL);
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	(void)memset(QueuePtr, 0, sizeof(*QueuePtr));
+	QueuePtr->MscPtr = InstancePtr;
+	InstancePtr->JobDoneHandler = XV_MultiScalerJobDone;
+	InstancePtr->JobRef = QueuePtr;
+}
+
+/*****************************************************************************/
+/**
+* This function writes a job to the core and starts it for one frame. Only
+* the registers and coefficients that differ from the previous job are
+* written.
+*
+* @param	QueuePtr is a pointer to the job queue.
+* @param	JobPtr is a pointer to the job.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerJobApply(XV_multi_scaler_Job_Queue *QueuePtr,
+	XV_multi_scaler_Job *JobPtr)
+{
+	XV_multi_scaler *MscPtr = QueuePtr->MscPtr;
+	XV_multi_scaler_Channel_Job *ChanPtr;
+	u32 num_outs = 0;
+	u32 i;
+	u32 r;
+
+	while ((num_outs < XV_MAX_OUTS) &&
+		(JobPtr->OutBitMask & (0x1 << num_outs)))
+		num_outs++;
+
+	if (num_outs != QueuePtr->NumOuts) {
+		XV_multi_scaler_Set_HwReg_num_outs(MscPtr, num_outs);
+		QueuePtr->NumOuts = num_outs;
+	}
+
+	for (i = 0; i < num_outs; i++) {
+		ChanPtr = &JobPtr->Chan[i];
+		for (r = 0; r < XV_MULTISCALER_NUM_CHAN_REGS; r++) {
+			if ((QueuePtr->ShadowValid & (0x1 << i)) &&
+				(QueuePtr->Shadow[i][r] == ChanPtr->Reg[r]))
+				continue;
+			XV_multi_scaler_WriteReg(MscPtr->Ctrl_BaseAddress,
+				XV_MS_ChanRegOffset[i][r], ChanPtr->Reg[r]);
+			QueuePtr->Shadow[i][r] = ChanPtr->Reg[r];
+		}
+		if (QueuePtr->VCoeff[i] != ChanPtr->VCoeff) {
+			XV_MultiScalerWriteCoeff(MscPtr,
+				XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE +
+				i * XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET,
+				ChanPtr->VCoeff);
+			QueuePtr->VCoeff[i] = ChanPtr->VCoeff;
+		}
+		if (QueuePtr->HCoeff[i] != ChanPtr->HCoeff) {
+			XV_MultiScalerWriteCoeff(MscPtr,
+				XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE +
+				i * XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET,
+				ChanPtr->HCoeff);
+			QueuePtr->HCoeff[i] = ChanPtr->HCoeff;
+		}
+		QueuePtr->ShadowValid |= 0x1 << i;
+	}
+
+	MscPtr->OutBitMask = JobPtr->OutBitMask;
+	QueuePtr->Busy = 1;
+	XV_multi_scaler_DisableAutoRestart(MscPtr);
+	XV_multi_scaler_Start(MscPtr);
+}
+
+/*****************************************************************************/
+/**
+* This function is called when a job is complete and starts the queued job.
+*
+* @param	CallbackRef is a pointer to the job queue.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerJobDone(void *CallbackRef)
+{
+	XV_multi_scaler_Job_Queue *QueuePtr = CallbackRef;
+	XV_multi_scaler_Job *JobPtr = QueuePtr->Pending;
+
+	QueuePtr->Busy = 0;
+	if (JobPtr != NULL) {
+		QueuePtr->Pending = NULL;
+		XV_MultiScalerJobApply(QueuePtr, JobPtr);
 	}
-	XV_MultiScalerSetCoeff(InstancePtr, MS_cfg);
-	XV_MS_Set_WidthOut[i](InstancePtr, MS_cfg->WidthOut);
-	XV_MS_Set_HeightOut[i](InstancePtr, MS_cfg->HeightOut);
-	XV_MS_Set_LineRate[i](InstancePtr, LineRate);
-	XV_MS_Set_PixelRate[i](InstancePtr, PixelRate);
-	XV_MS_Set_ColorFormatIn[i](InstancePtr, MS_cfg->ColorFormatIn);
-	XV_MS_Set_ColorFormatOut[i](InstancePtr, MS_cfg->ColorFormatOut);
-	XV_MS_Set_InStride[i](InstancePtr, MS_cfg->InStride);
-	XV_MS_Set_OutStride[i](InstancePtr, MS_cfg->OutStride);
-	XV_MS_Set_DstImgBuf0[i](InstancePtr, MS_cfg->DstImgBuf0);
-	XV_MS_Set_DstImgBuf1[i](InstancePtr, MS_cfg->DstImgBuf1);
+}
+
+/*****************************************************************************/
+/**
+* This function submits a job. An idle core starts the job at once, a busy
+* core starts it when the running job is complete.
+*
+* @param	QueuePtr is a pointer to the job queue.
+* @param	JobPtr is a pointer to the job. The job is read when it starts,
+*		it must not be changed until then.
+*
+* @return
+*		- XST_SUCCESS if the job was started or queued.
+*		- XST_DEVICE_BUSY if a job is already queued.
+*
+******************************************************************************/
+int XV_MultiScalerJobSubmit(XV_multi_scaler_Job_Queue *QueuePtr,
+	XV_multi_scaler_Job *JobPtr)
+{
+	XV_multi_scaler *MscPtr;
+	u32 Ier;
+	int Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(JobPtr != NULL);
+	Xil_AssertNonvoid(JobPtr->OutBitMask & 0x1);
+	Xil_AssertNonvoid(!(JobPtr->OutBitMask & (JobPtr->OutBitMask + 1)));
+
+	MscPtr = QueuePtr->MscPtr;
+
+	/* Keep the done interrupt out while the queue is updated */
+	Ier = XV_multi_scaler_InterruptGetEnabled(MscPtr);
+	if (Ier)
+		XV_multi_scaler_InterruptDisable(MscPtr, Ier);
+
+	if (!QueuePtr->Busy)
+		XV_MultiScalerJobApply(QueuePtr, JobPtr);
+	else if (QueuePtr->Pending == NULL)
+		QueuePtr->Pending = JobPtr;
+	else
+		Status = XST_DEVICE_BUSY;
+
+	if (Ier)
+		XV_multi_scaler_InterruptEnable(MscPtr, Ier);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* This function checks for the completion of the running job when the done
+* interrupt is not used, and starts the queued job.
+*
+* @param	QueuePtr is a pointer to the job queue.
+*
+* @return TRUE while a job runs, FALSE when the core is idle.
+*
+******************************************************************************/
+u32 XV_MultiScalerJobPoll(XV_multi_scaler_Job_Queue *QueuePtr)
+{
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	if (QueuePtr->Busy && XV_multi_scaler_IsIdle(QueuePtr->MscPtr))
+		XV_MultiScalerJobDone(QueuePtr);
+
+	return QueuePtr->Busy ? TRUE : FALSE;
 }
 /** @} */
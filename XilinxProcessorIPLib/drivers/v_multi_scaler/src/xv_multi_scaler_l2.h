@@ -32,6 +32,21 @@
 * This driver is not thread safe. Any needs for threads or thread mutual
 * exclusion must be satisfied by the layer above this driver.
 *
+* <b> Jobs </b>
+*
+* XV_MultiScalerSetChannelConfig() computes and writes every register of a
+* channel, including the filter coefficients, each time it is called. For a
+* configuration that repeats every frame, the channels can instead be computed
+* once into an XV_multi_scaler_Job with XV_MultiScalerJobSetChannel(). Per
+* frame, only the buffer addresses are updated with
+* XV_MultiScalerJobSetBuffers() and the job is passed to
+* XV_MultiScalerJobSubmit(). The job queue keeps a shadow of the channel
+* registers and the loaded coefficients and only writes what differs from the
+* previous job, then starts the core for a single frame. A job submitted while
+* one runs is queued and started from the interrupt handler, or from
+* XV_MultiScalerJobPoll() when interrupts are not used. The job queue assumes
+* it is the only user of the channel registers once initialized.
+*
 * <b>Limitations</b>
 *
 ******************************************************************************/
@@ -56,6 +71,7 @@ extern "C" {
 #define STEP_PRECISION 65536
 #define XVSC_MASK_LOW_16BITS 0x0000FFFF
 #define XVSC_MASK_HIGH_16BITS 0xFFFF0000
+#define XV_MULTISCALER_NUM_CHAN_REGS 18
 
 /**************************** Type Definitions *******************************/
 /**
@@ -124,6 +140,43 @@ typedef struct {
 	XV_multi_scaler_Crop_Window CropWin;
 } XV_multi_scaler_Video_Config;
 
+/**
+ * Precomputed configuration of a channel, see XV_MultiScalerJobSetChannel()
+ */
+typedef struct {
+	u32 Reg[XV_MULTISCALER_NUM_CHAN_REGS];	/**< Channel register image */
+	const short *VCoeff;	/**< Vertical filter coefficients */
+	const short *HCoeff;	/**< Horizontal filter coefficients */
+	UINTPTR SrcOffset0;	/**< Crop offset into SrcImgBuf0 */
+	UINTPTR SrcOffset1;	/**< Crop offset into SrcImgBuf1 */
+} XV_multi_scaler_Channel_Job;
+
+/**
+ * Configuration of all the channels for one frame
+ */
+typedef struct {
+	u8 OutBitMask;		/**< Channels set in the job */
+	XV_multi_scaler_Channel_Job Chan[XV_MAX_OUTS];	/**< Channels */
+} XV_multi_scaler_Job;
+
+/**
+ * Job queue of a core. Holds the shadow of the channel registers, the job
+ * that runs and the job queued after it.
+ */
+typedef struct {
+	XV_multi_scaler *MscPtr;	/**< Core instance */
+	u32 Shadow[XV_MAX_OUTS][XV_MULTISCALER_NUM_CHAN_REGS];	/**< Last
+					values written to the channel registers */
+	const short *VCoeff[XV_MAX_OUTS];	/**< Loaded vertical
+						coefficients */
+	const short *HCoeff[XV_MAX_OUTS];	/**< Loaded horizontal
+						coefficients */
+	u8 ShadowValid;			/**< Channels with a valid shadow */
+	u32 NumOuts;			/**< Last number of outputs written */
+	XV_multi_scaler_Job *Pending;	/**< Job queued after the running one */
+	volatile u8 Busy;		/**< Set while a job runs */
+} XV_multi_scaler_Job_Queue;
+
 /*extern const short XV_multiscaler_fixedcoeff_taps6[XV_MULTISCALER_MAX_V_PHASES]
 	[XV_MULTISCALER_TAPS_12];
 extern const short XV_multiscaler_fixedcoeff_taps8[XV_MULTISCALER_MAX_V_PHASES]
@@ -156,6 +209,17 @@ void XV_MultiScalerGetChannelConfig(XV_multi_scaler  *InstancePtr,
 	XV_multi_scaler_Video_Config *multi_scaler_cfg);
 void XV_MultiScalerSetChannelConfig(XV_multi_scaler  *InstancePtr,
 	XV_multi_scaler_Video_Config *multi_scaler_cfg);
+void XV_MultiScalerJobInit(XV_multi_scaler_Job *JobPtr);
+void XV_MultiScalerJobSetChannel(XV_multi_scaler *InstancePtr,
+	XV_multi_scaler_Job *JobPtr, XV_multi_scaler_Video_Config *MS_cfg);
+void XV_MultiScalerJobSetBuffers(XV_multi_scaler_Job *JobPtr, u32 ChannelId,
+	UINTPTR SrcImgBuf0, UINTPTR SrcImgBuf1, UINTPTR DstImgBuf0,
+	UINTPTR DstImgBuf1);
+void XV_MultiScalerJobQueueInit(XV_multi_scaler_Job_Queue *QueuePtr,
+	XV_multi_scaler *InstancePtr);
+int XV_MultiScalerJobSubmit(XV_multi_scaler_Job_Queue *QueuePtr,
+	XV_multi_scaler_Job *JobPtr);
+u32 XV_MultiScalerJobPoll(XV_multi_scaler_Job_Queue *QueuePtr);
 
 #ifdef __cplusplus
 }
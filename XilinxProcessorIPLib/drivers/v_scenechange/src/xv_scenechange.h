@@ -38,6 +38,7 @@ extern "C" {
 #define XV_SCD_IDLE_TIMEOUT		(1000000)
 #define XV_SCD_MEMORY_MODE		1
 #define XV_SCD_STREAM_MODE		0
+#define XV_SCD_RESULT_RING_SIZE		64	/* Power of two */
 
 /**************************** Type Definitions ******************************/
 
@@ -79,6 +80,29 @@ typedef struct {
 */
 
 typedef void (*XVSceneChange_Callback)(void *InstancePtr);
+
+/* Time stamp source of the streaming mode, called from the done interrupt */
+typedef u64 (*XVScd_TimeFunc)(void);
+
+/* Result of one stream for one run of the core */
+typedef struct {
+    u64 Timestamp;	/* Time of the done interrupt, 0 without source */
+    u32 Seq;		/* Run of the core, same for all streams of a run */
+    u32 SAD;		/* Sum of absolute differences */
+    u8  LayerId;	/* Stream the result belongs to */
+    u8  Detected;	/* SAD reached the threshold of the stream */
+} XVScdResult;
+
+/*
+ * Ring of results, written by the done interrupt and read by one consumer.
+ * Head and Tail are free running.
+ */
+typedef struct {
+    u32 Head;
+    u32 Tail;
+    u32 Overruns;	/* Results dropped because the ring was full */
+    XVScdResult Entry[XV_SCD_RESULT_RING_SIZE];
+} XVScdResultRing;
 typedef struct {
     u64 BufferAddr;
     u32 SAD;
@@ -100,6 +124,10 @@ typedef struct {
     XV_scenechange_Config *ScdConfig;
     XVScdLayerConfig LayerConfig[XV_SCD_IP_MAX_STREAMS];
     XVSceneChange_Callback FrameDoneCallback;
+    u8 Streaming;		/* Streaming mode is running */
+    u32 Seq;			/* Runs completed in streaming mode */
+    XVScd_TimeFunc GetTime;	/* Time stamp source, optional */
+    XVScdResultRing Results;	/* Results of the streaming mode */
 } XV_scenechange;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -263,6 +291,11 @@ int XV_scenechange_Layer_config(XV_scenechange *InstancePtr, u8 layerid);
 void XV_scenechange_Layer_stream_enable(XV_scenechange *InstancePtr, u32 Data);
 u32 XV_scenechange_Stop(XV_scenechange *InstancePtr);
 u32 XV_scenechange_WaitForIdle(XV_scenechange *InstancePtr);
+int XV_scenechange_StartStreaming(XV_scenechange *InstancePtr, u32 Streams,
+				  XVScd_TimeFunc GetTime);
+u32 XV_scenechange_StopStreaming(XV_scenechange *InstancePtr);
+u32 XV_scenechange_ReadResults(XV_scenechange *InstancePtr,
+			       XVScdResult *Results, u32 MaxResults);
 #ifdef __cplusplus
 }
 #endif
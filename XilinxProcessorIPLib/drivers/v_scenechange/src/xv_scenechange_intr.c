@@ -20,6 +20,8 @@
  * Ver   Who    Date     Changes
  * ----- ---- -------- -------------------------------------------------------
  * 1.00  praveenv   13/09/18   Initial Release
+ * 1.4   fl         10/14/26   Push per stream results to the result ring in
+ *                             streaming mode
  * </pre>
  *
  ******************************************************************************/
@@ -44,12 +46,57 @@ static u32 XV_scenechange_get_sad(XV_scenechange *InstancePtr, u8 streamid)
 	return Data;
 }
 
+/*****************************************************************************/
+/**
+ *
+ * This function adds a result to the result ring, the result is dropped when
+ * the ring is full.
+ *
+ * @param    ScdPtr is a pointer to the SceneChange IP instance.
+ * @param    LayerId is the stream of the result.
+ * @param    SAD is the SAD of the stream.
+ * @param    Detected is 1 when the SAD reached the threshold.
+ * @param    Timestamp is the time of the done interrupt.
+ *
+ * @return	None.
+ *
+ * @note     The entry is written before the release store of the head, so a
+ *           consumer that sees the new head also sees the entry.
+ *
+ ******************************************************************************/
+static void XV_scenechange_push_result(XV_scenechange *ScdPtr, u8 LayerId,
+				       u32 SAD, u8 Detected, u64 Timestamp)
+{
+	XVScdResultRing *RingPtr = &ScdPtr->Results;
+	XVScdResult *EntryPtr;
+	u32 Head = RingPtr->Head;
+
+	if ((Head - __atomic_load_n(&RingPtr->Tail, __ATOMIC_ACQUIRE)) >=
+			XV_SCD_RESULT_RING_SIZE) {
+		RingPtr->Overruns++;
+		return;
+	}
+
+	EntryPtr = &RingPtr->Entry[Head & (XV_SCD_RESULT_RING_SIZE - 1)];
+	EntryPtr->Timestamp = Timestamp;
+	EntryPtr->Seq = ScdPtr->Seq;
+	EntryPtr->SAD = SAD;
+	EntryPtr->LayerId = LayerId;
+	EntryPtr->Detected = Detected;
+	__atomic_store_n(&RingPtr->Head, Head + 1, __ATOMIC_RELEASE);
+}
+
 static void XV_scenechange_handler(XV_scenechange *ScdPtr)
 {
 	u32 index, Data, SADTF, SAD;
+	u64 Timestamp = 0;
+	u8 Detected;
 
 	Data = XV_scenechange_Get_HwReg_stream_enable(ScdPtr);
 
+	if (ScdPtr->Streaming && (ScdPtr->GetTime != NULL))
+		Timestamp = ScdPtr->GetTime();
+
 	for (index = 0; index < ScdPtr->ScdConfig->NumStreams; index++) {
 		if (Data & (1 << index)) {
 			SAD = XV_scenechange_get_sad(ScdPtr, index);
@@ -58,14 +105,24 @@ static void XV_scenechange_handler(XV_scenechange *ScdPtr)
 					 ScdPtr->LayerConfig[index].Width));
 
 			ScdPtr->LayerConfig[index].SAD = SAD;
+			Detected = (SADTF >=
+				    ScdPtr->LayerConfig[index].Threshold);
 
-			if (SADTF >= ScdPtr->LayerConfig[index].Threshold) {
+			if (ScdPtr->Streaming)
+				XV_scenechange_push_result(ScdPtr, index, SAD,
+							   Detected, Timestamp);
+
+			if (Detected) {
 				ScdPtr->ScdLayerDetSAD = SAD;
 				ScdPtr->ScdDetLayerId = index;
-				ScdPtr->FrameDoneCallback(ScdPtr);
+				if (ScdPtr->FrameDoneCallback != NULL)
+					ScdPtr->FrameDoneCallback(ScdPtr);
 			}
 		}
 	}
+
+	if (ScdPtr->Streaming)
+		ScdPtr->Seq++;
 }
 
 /*****************************************************************************/
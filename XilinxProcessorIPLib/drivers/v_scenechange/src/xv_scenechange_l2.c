@@ -27,6 +27,7 @@
  *			 software to flush pending transactions.IP is expecting
  *			 a hard reset, when flushing is done.(There is a flush
  *			 status bit and is asserted when the flush is done).
+ * 1.4   fl   10/14/26   Added streaming mode with a result ring.
  * <pre>
  *
  * ****************************************************************************/
@@ -263,3 +264,112 @@ void XV_scenechange_EnableInterrupts(void *InstancePtr)
 	XV_scenechange_InterruptEnable(InstancePtr,
 			XV_SCENECHANGE_CTRL_ADDR_ISR_AP_DONE);
 }
+
+/*****************************************************************************/
+/**
+* This function starts the streaming mode. The core restarts automatically
+* after every run and processes all the given streams in each run. The done
+* interrupt pushes one result per stream and run to the result ring, where
+* XV_scenechange_ReadResults() collects them.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Streams is the mask of the streams to analyze, configured with
+*         XV_scenechange_Layer_config()
+* @param  GetTime is the time stamp source, called from the done interrupt,
+*         or NULL to leave the time stamps at 0
+*
+* @return XST_SUCCESS if the streaming mode is started
+*         XST_INVALID_PARAM if Streams is empty or names a missing stream
+*
+* @note   XV_scenechange_InterruptHandler must be connected to the
+*         interrupt controller. The frame done callback, if any, is still
+*         called when a scene change is detected.
+*
+******************************************************************************/
+int XV_scenechange_StartStreaming(XV_scenechange *InstancePtr, u32 Streams,
+				  XVScd_TimeFunc GetTime)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((Streams == 0) ||
+	    ((Streams >> InstancePtr->ScdConfig->NumStreams) != 0))
+		return XST_INVALID_PARAM;
+
+	InstancePtr->Results.Head = 0;
+	InstancePtr->Results.Tail = 0;
+	InstancePtr->Results.Overruns = 0;
+	InstancePtr->Seq = 0;
+	InstancePtr->GetTime = GetTime;
+	__atomic_store_n(&InstancePtr->Streaming, 1, __ATOMIC_RELEASE);
+
+	XV_scenechange_Layer_stream_enable(InstancePtr, Streams);
+	XV_scenechange_InterruptEnable(InstancePtr,
+			XV_SCENECHANGE_CTRL_ADDR_ISR_AP_DONE);
+	XV_scenechange_InterruptGlobalEnable(InstancePtr);
+	XV_scenechange_EnableAutoRestart(InstancePtr);
+	XV_scenechange_Start(InstancePtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function stops the streaming mode. Results already in the ring can
+* still be read.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return XST_SUCCESS if the core in stop state
+*         XST_FAILURE if the core is not in stop state
+*
+******************************************************************************/
+u32 XV_scenechange_StopStreaming(XV_scenechange *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	__atomic_store_n(&InstancePtr->Streaming, 0, __ATOMIC_RELEASE);
+
+	return XV_scenechange_Stop(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+* This function takes the oldest results of the streaming mode from the
+* result ring
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Results is an array filled with up to MaxResults results, oldest
+*         first
+* @param  MaxResults is the size of the Results array
+*
+* @return Number of results taken, 0 when no result is pending
+*
+* @note   Only one context may read the results. Results.Overruns counts
+*         the results dropped because the ring was full.
+*
+******************************************************************************/
+u32 XV_scenechange_ReadResults(XV_scenechange *InstancePtr,
+			       XVScdResult *Results, u32 MaxResults)
+{
+	XVScdResultRing *RingPtr;
+	u32 Head, Tail, Count;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Results != NULL);
+
+	RingPtr = &InstancePtr->Results;
+	Tail = RingPtr->Tail;
+	Head = __atomic_load_n(&RingPtr->Head, __ATOMIC_ACQUIRE);
+
+	for (Count = 0; (Count < MaxResults) && (Tail != Head); Count++) {
+		Results[Count] =
+			RingPtr->Entry[Tail & (XV_SCD_RESULT_RING_SIZE - 1)];
+		Tail++;
+	}
+
+	__atomic_store_n(&RingPtr->Tail, Tail, __ATOMIC_RELEASE);
+
+	return Count;
+}
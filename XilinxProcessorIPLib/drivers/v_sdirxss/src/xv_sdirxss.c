@@ -18,6 +18,8 @@
  * ----- ------ -------- -------------------------------------------------------
  * 1.00  jsr    07/17/17  Initial release.
  * 2.00  kar    01/25/18  Second release.
+ * 3.4   fl     10/14/26  Restart the RX on stream down with the search mode
+ *                        it was started with
  * </pre>
  *
  ******************************************************************************/
@@ -208,6 +210,9 @@ XV_SdiRxSs_Config *CfgPtr, UINTPTR EffectiveAddr)
 		}
 	}
 
+	/* The core initialization starts the RX in multi search mode */
+	SdiRxSsPtr->SearchMode = XV_SDIRX_MULTISEARCHMODE;
+
 	/* Register Callbacks */
 	XV_SdiRxSs_RegisterSubsysCallbacks(SdiRxSsPtr);
 
@@ -239,8 +244,10 @@ static void XV_SdiRxSs_StreamDownCallback(void *CallbackRef)
 	XV_SdiRxSs_Stop(SdiRxSsPtr);
 	XV_SdiRxSs_StreamFlowDisable(SdiRxSsPtr);
 
-	/* TODO: Should only start RX based on earlier SEARCHMODE selection. */
-	XV_SdiRxSs_Start(SdiRxSsPtr, XV_SDIRX_MULTISEARCHMODE);
+	/* Search again in the mode the RX was started with, a single mode
+	 * search locks to a format change of the same mode without trying
+	 * the other modes first */
+	XV_SdiRxSs_Start(SdiRxSsPtr, SdiRxSsPtr->SearchMode);
 	XV_SdiRxSs_LogWrite(SdiRxSsPtr, XV_SDIRXSS_LOG_EVT_STREAMDOWN, 0);
 
 	/* Check if user callback has been registered */
@@ -407,7 +414,7 @@ void XV_SdiRxSs_Start(XV_SdiRxSs *InstancePtr, XV_SdiRx_SearchMode Mode)
 {
 	Xil_AssertVoid(InstancePtr != NULL);
 
-	/* TODO: Should only start RX based on earlier SEARCHMODE selection. */
+	InstancePtr->SearchMode = Mode;
 	XV_SdiRx_Start(InstancePtr->SdiRxPtr, Mode);
 
 	/* Stat_reset */
@@ -32,6 +32,7 @@
 * Ver   Who    Date     Changes
 * ----- ------ -------- --------------------------------------------------
 * 1.00  jsr    07/17/17 Initial release.
+* 3.4   fl     10/14/26 Keep the search mode to restart the RX with
 * </pre>
 *
 ******************************************************************************/
@@ -173,6 +174,8 @@ typedef struct {
 	void *VsyncRef;		/**< To be passed to the Vsync callback */
 
 	u8 IsStreamUp;			/**< SDI RX Stream Up */
+	XV_SdiRx_SearchMode SearchMode;	/**< Search mode the RX was started
+					  *  with, used again on stream down */
 } XV_SdiRxSs;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -24,6 +24,8 @@
 			to SDI common driver
 * 3.1   vsa    08/12/20 Avoid workaround in XV_SdiTx_StreamStart() for versal
 *			device
+* 3.3   fl     10/14/26 Added XV_SdiTx_UpdatePayloadIds to write only the
+*			payload ids that changed
 * </pre>
 *
 ******************************************************************************/
@@ -905,6 +907,57 @@ void XV_SdiTx_SetPayloadId(XV_SdiTx *InstancePtr, u8 DataStream, u32 Payload)
 	XV_SdiTx_WriteReg((InstancePtr)->Config.BaseAddress,
 			(XV_SDITX_TX_ST352_DATA_CH0_OFFSET + (DataStream * 4)),
 			Payload);
+
+	if (DataStream < XV_SDITX_MAX_DATASTREAM) {
+		InstancePtr->PayloadWritten[DataStream] = Payload;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes the ST352 payload ids of the streams to the core, and
+* to the C stream registers when the core inserts ST352 in the C stream.
+*
+* @param    InstancePtr is a pointer to the XV_SdiTx core instance.
+* @param    ChangedOnly specifies whether only the payload ids that differ
+*			from the ones in the core are written.
+*
+* @return   Number of data streams whose payload id was written.
+*
+* @note     On a switch between video formats of the same SDI mode most
+*			payload ids do not change, writing only the changed ones saves
+*			the register accesses.
+*
+******************************************************************************/
+u32 XV_SdiTx_UpdatePayloadIds(XV_SdiTx *InstancePtr, u8 ChangedOnly)
+{
+	u32 Data;
+	u32 Payload;
+	u32 Count = 0;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	Data = XV_SdiTx_ReadReg(InstancePtr->Config.BaseAddress,
+				XV_SDITX_MDL_CTRL_OFFSET);
+
+	for (int StreamId = 0; StreamId < XV_SDITX_MAX_DATASTREAM; StreamId++) {
+		Payload = InstancePtr->Stream[StreamId].PayloadId;
+		if (ChangedOnly &&
+		    (InstancePtr->PayloadWritten[StreamId] == Payload)) {
+			continue;
+		}
+
+		XV_SdiTx_SetPayloadId(InstancePtr, StreamId, Payload);
+		if (Data & XV_SDITX_MDL_CTRL_C_ST352_MASK) {
+			XV_SdiTx_SetPayloadId(InstancePtr,
+					      StreamId + CHROMA_ST352_REG_OFFSET,
+					      Payload);
+		}
+		Count++;
+	}
+
+	return Count;
 }
 
 /*****************************************************************************/
@@ -963,25 +1016,13 @@ void XV_SdiTx_SetPayloadLineNum(XV_SdiTx *InstancePtr,
 ******************************************************************************/
 void XV_SdiTx_StreamStart(XV_SdiTx *InstancePtr)
 {
+#ifndef versal
 	u32 Data;
+#endif
 	XV_SdiTx_MuxPattern MuxPattern;
 
-	for (int StreamId = 0; StreamId < XV_SDITX_MAX_DATASTREAM; StreamId++) {
-		XV_SdiTx_SetPayloadId(InstancePtr,
-		StreamId,
-		InstancePtr->Stream[StreamId].PayloadId);
-	}
+	XV_SdiTx_UpdatePayloadIds(InstancePtr, FALSE);
 
-	Data = XV_SdiTx_ReadReg(InstancePtr->Config.BaseAddress,
-				XV_SDITX_MDL_CTRL_OFFSET);
-	if (Data & XV_SDITX_MDL_CTRL_C_ST352_MASK) {
-		for (int StreamId = 0; StreamId < XV_SDITX_MAX_DATASTREAM;
-			StreamId++) {
-			XV_SdiTx_SetPayloadId(InstancePtr,
-					      StreamId + CHROMA_ST352_REG_OFFSET,
-					      InstancePtr->Stream[StreamId].PayloadId);
-		}
-	}
 	switch (InstancePtr->Transport.TMode) {
 	case XSDIVID_MODE_SD:
 	case XSDIVID_MODE_HD:
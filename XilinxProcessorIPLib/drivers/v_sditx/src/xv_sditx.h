@@ -16,6 +16,8 @@
 * 1.00  jsr    07/17/17 Initial release.
 * 	jsr    02/23/2018 YUV420 color format support.
 # 2.0   vve    10/03/18 Add support for ST352 in C Stream
+* 3.3   fl     10/14/26 Keep the payload ids written to the core, add
+*                       XV_SdiTx_UpdatePayloadIds
 * </pre>
 *
 ******************************************************************************/
@@ -204,6 +206,8 @@ typedef struct {
   XV_SdiTx_State	State;		/**< State */
   u8			IsStreamUp;
   XVidC_ColorDepth	bitdepth;	/**< bit depth */
+  u32			PayloadWritten[XV_SDITX_MAX_DATASTREAM];
+					/**< ST352 payload ids in the core */
 } XV_SdiTx;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -257,6 +261,7 @@ void XV_SdiTx_ClearDetectedError(XV_SdiTx *InstancePtr);
 u32 XV_SdiTx_GetPayloadEotf(XV_SdiTx *InstancePtr, XVidC_Eotf Eotf, XVidC_ColorStd Colorimetry);
 u32 XV_SdiTx_GetPayload(XV_SdiTx *InstancePtr, XVidC_VideoMode VideoMode, XSdiVid_TransMode SdiMode, u8 DataStream);
 void XV_SdiTx_SetPayloadId(XV_SdiTx *InstancePtr, u8 DataStream, u32 Payload);
+u32 XV_SdiTx_UpdatePayloadIds(XV_SdiTx *InstancePtr, u8 ChangedOnly);
 void XV_SdiTx_SetPayloadLineNum(XV_SdiTx *InstancePtr,
 				XV_SdiTx_PayloadLineNum1 Field1LineNum,
 				XV_SdiTx_PayloadLineNum2 Field2LineNum,
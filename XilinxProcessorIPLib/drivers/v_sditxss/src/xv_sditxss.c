@@ -24,6 +24,8 @@
  * 2.1   jsr    07/03/2018 Corrected 720x480_60_I to be 720x486_60_I for SD mode
  * 2.2   jsr    10/01/2018 Programming the Field register for 720x480_60_I SD mode
  * 3.0   vve    10/03/18 Add support for ST352 in C Stream
+ * 4.4   fl     10/14/26 Keep the settings of each video format in a profile
+ *                       cache, added XV_SdiTxSs_SwitchFormat
  * </pre>
  *
  ******************************************************************************/
@@ -73,7 +75,11 @@ XV_SdiTxSs_SubCores XV_SdiTxSs_SubCoreRepo[XPAR_XV_SDITXSS_NUM_INSTANCES];
 									included in the design */
 
 /************************** Function Prototypes ******************************/
-static int XV_SdiTxSs_VtcSetup(XVtc *XVtcPtr, XV_SdiTx *SdiTxPtr);
+static int XV_SdiTxSs_VtcCompute(XV_SdiTx *SdiTxPtr, XVtc_Timing *TimingPtr,
+				 XVtc_Polarity *PolarityPtr);
+static int XV_SdiTxSs_VtcApply(XVtc *XVtcPtr,
+			       const XV_SdiTxSs_Profile *ProfilePtr, u8 Reset);
+static XV_SdiTxSs_Profile *XV_SdiTxSs_GetProfile(XV_SdiTxSs *InstancePtr);
 static void XV_SdiTxSs_ReportCoreInfo(XV_SdiTxSs *InstancePtr);
 static void XV_SdiTxSs_ReportTiming(XV_SdiTxSs *InstancePtr);
 static void XV_SdiTxSs_GtReadyCallback(void *CallbackRef);
@@ -586,99 +592,75 @@ int XV_SdiTxSs_SetColorFormat(XV_SdiTxSs *InstancePtr, XVidC_ColorFormat ColorFo
 /*****************************************************************************/
 /**
 *
-* This function configures Video Timing Controller (VTC).
+* This function computes the Video Timing Controller (VTC) settings of the
+* video stream 0 of the SDI TX core.
 *
-* @param	XVtcPtr is a pointer to the XVtc core instance.
 * @param	SdiTxPtr is a pointer to the XV_SdiTx core instance.
+* @param	TimingPtr is a pointer to the generator timing to compute.
+* @param	PolarityPtr is a pointer to the output polarities to compute.
 *
-* @return None.
+* @return	XST_SUCCESS if the timing can be generated else XST_FAILURE.
 *
-* @note   None.
+* @note		None.
 *
 ******************************************************************************/
-static int XV_SdiTxSs_VtcSetup(XVtc *XVtcPtr, XV_SdiTx *SdiTxPtr)
+static int XV_SdiTxSs_VtcCompute(XV_SdiTx *SdiTxPtr, XVtc_Timing *TimingPtr,
+				 XVtc_Polarity *PolarityPtr)
 {
-	/* Polarity configuration */
-	XVtc_Polarity Polarity;
-	XVtc_SourceSelect SourceSelect;
-	XVtc_Timing VideoTiming;
 	u32 SdiTx_Hblank;
 	u32 Vtc_Hblank;
-	u32 RegValue;
 
-	/* Disable Generator */
-	XVtc_Reset(XVtcPtr);
-	XVtc_DisableGenerator(XVtcPtr);
-	XVtc_Disable(XVtcPtr);
-
-	/* Set up source select */
-	memset((void *)&SourceSelect, 0, sizeof(SourceSelect));
-
-	/* 1 = Generator registers, 0 = Detector registers */
-	SourceSelect.VChromaSrc = 1;
-	SourceSelect.VActiveSrc = 1;
-	SourceSelect.VBackPorchSrc = 1;
-	SourceSelect.VSyncSrc = 1;
-	SourceSelect.VFrontPorchSrc = 1;
-	SourceSelect.VTotalSrc = 1;
-	SourceSelect.HActiveSrc = 1;
-	SourceSelect.HBackPorchSrc = 1;
-	SourceSelect.HSyncSrc = 1;
-	SourceSelect.HFrontPorchSrc = 1;
-	SourceSelect.HTotalSrc = 1;
-
-	XVtc_SetSource(XVtcPtr, &SourceSelect);
-	VideoTiming.HActiveVideo = SdiTxPtr->Stream[0].Video.Timing.HActive;
-	VideoTiming.HFrontPorch = SdiTxPtr->Stream[0].Video.Timing.HFrontPorch;
-	VideoTiming.HSyncWidth = SdiTxPtr->Stream[0].Video.Timing.HSyncWidth;
-	VideoTiming.HBackPorch = SdiTxPtr->Stream[0].Video.Timing.HBackPorch;
-	VideoTiming.HSyncPolarity = SdiTxPtr->Stream[0].Video.Timing.HSyncPolarity;
+	TimingPtr->HActiveVideo = SdiTxPtr->Stream[0].Video.Timing.HActive;
+	TimingPtr->HFrontPorch = SdiTxPtr->Stream[0].Video.Timing.HFrontPorch;
+	TimingPtr->HSyncWidth = SdiTxPtr->Stream[0].Video.Timing.HSyncWidth;
+	TimingPtr->HBackPorch = SdiTxPtr->Stream[0].Video.Timing.HBackPorch;
+	TimingPtr->HSyncPolarity = SdiTxPtr->Stream[0].Video.Timing.HSyncPolarity;
 
 	/* Vertical Timing */
-	VideoTiming.VActiveVideo = SdiTxPtr->Stream[0].Video.Timing.VActive;
+	TimingPtr->VActiveVideo = SdiTxPtr->Stream[0].Video.Timing.VActive;
 
-	VideoTiming.V0FrontPorch = SdiTxPtr->Stream[0].Video.Timing.F0PVFrontPorch;
-	VideoTiming.V0BackPorch = SdiTxPtr->Stream[0].Video.Timing.F0PVBackPorch;
-	VideoTiming.V0SyncWidth = SdiTxPtr->Stream[0].Video.Timing.F0PVSyncWidth;
+	TimingPtr->V0FrontPorch = SdiTxPtr->Stream[0].Video.Timing.F0PVFrontPorch;
+	TimingPtr->V0BackPorch = SdiTxPtr->Stream[0].Video.Timing.F0PVBackPorch;
+	TimingPtr->V0SyncWidth = SdiTxPtr->Stream[0].Video.Timing.F0PVSyncWidth;
 
-	VideoTiming.V1FrontPorch = SdiTxPtr->Stream[0].Video.Timing.F1VFrontPorch;
-	VideoTiming.V1SyncWidth = SdiTxPtr->Stream[0].Video.Timing.F1VSyncWidth;
-	VideoTiming.V1BackPorch = SdiTxPtr->Stream[0].Video.Timing.F1VBackPorch;
+	TimingPtr->V1FrontPorch = SdiTxPtr->Stream[0].Video.Timing.F1VFrontPorch;
+	TimingPtr->V1SyncWidth = SdiTxPtr->Stream[0].Video.Timing.F1VSyncWidth;
+	TimingPtr->V1BackPorch = SdiTxPtr->Stream[0].Video.Timing.F1VBackPorch;
 
-	VideoTiming.VSyncPolarity = SdiTxPtr->Stream[0].Video.Timing.VSyncPolarity;
+	TimingPtr->VSyncPolarity = SdiTxPtr->Stream[0].Video.Timing.VSyncPolarity;
 
-	VideoTiming.Interlaced = SdiTxPtr->Stream[0].Video.IsInterlaced;
+	TimingPtr->Interlaced = SdiTxPtr->Stream[0].Video.IsInterlaced;
 
 	/* 4 pixels per clock */
 	if (SdiTxPtr->Stream[0].Video.PixPerClk == XVIDC_PPC_4) {
-		VideoTiming.HActiveVideo = VideoTiming.HActiveVideo/4;
-		VideoTiming.HFrontPorch = VideoTiming.HFrontPorch/4;
-		VideoTiming.HBackPorch = VideoTiming.HBackPorch/4;
-		VideoTiming.HSyncWidth = VideoTiming.HSyncWidth/4;
+		TimingPtr->HActiveVideo = TimingPtr->HActiveVideo/4;
+		TimingPtr->HFrontPorch = TimingPtr->HFrontPorch/4;
+		TimingPtr->HBackPorch = TimingPtr->HBackPorch/4;
+		TimingPtr->HSyncWidth = TimingPtr->HSyncWidth/4;
 	}
 
 	/* 2 pixels per clock */
 	else if (SdiTxPtr->Stream[0].Video.PixPerClk == XVIDC_PPC_2) {
-		VideoTiming.HActiveVideo = VideoTiming.HActiveVideo/2;
-		VideoTiming.HFrontPorch = VideoTiming.HFrontPorch/2;
-		VideoTiming.HBackPorch = VideoTiming.HBackPorch/2;
-		VideoTiming.HSyncWidth = VideoTiming.HSyncWidth/2;
+		TimingPtr->HActiveVideo = TimingPtr->HActiveVideo/2;
+		TimingPtr->HFrontPorch = TimingPtr->HFrontPorch/2;
+		TimingPtr->HBackPorch = TimingPtr->HBackPorch/2;
+		TimingPtr->HSyncWidth = TimingPtr->HSyncWidth/2;
 	}
 
 	/* 1 pixels per clock */
 	else {
-		VideoTiming.HActiveVideo = VideoTiming.HActiveVideo;
-		VideoTiming.HFrontPorch = VideoTiming.HFrontPorch;
-		VideoTiming.HBackPorch = VideoTiming.HBackPorch;
-		VideoTiming.HSyncWidth = VideoTiming.HSyncWidth;
+		TimingPtr->HActiveVideo = TimingPtr->HActiveVideo;
+		TimingPtr->HFrontPorch = TimingPtr->HFrontPorch;
+		TimingPtr->HBackPorch = TimingPtr->HBackPorch;
+		TimingPtr->HSyncWidth = TimingPtr->HSyncWidth;
 	}
 
 	/* For YUV420 the line width is double there for double the blanking */
 	if (SdiTxPtr->Stream[0].Video.ColorFormatId == XVIDC_CSF_YCRCB_420) {
-		VideoTiming.HActiveVideo = VideoTiming.HActiveVideo/2;
-		VideoTiming.HFrontPorch = VideoTiming.HFrontPorch/2;
-		VideoTiming.HBackPorch = VideoTiming.HBackPorch/2;
-		VideoTiming.HSyncWidth = VideoTiming.HSyncWidth/2;
+		TimingPtr->HActiveVideo = TimingPtr->HActiveVideo/2;
+		TimingPtr->HFrontPorch = TimingPtr->HFrontPorch/2;
+		TimingPtr->HBackPorch = TimingPtr->HBackPorch/2;
+		TimingPtr->HSyncWidth = TimingPtr->HSyncWidth/2;
 	}
 
 /** When compensating the vtc horizontal timing parameters for the pixel mode
@@ -697,9 +679,9 @@ static int XV_SdiTxSs_VtcSetup(XVtc *XVtcPtr, XV_SdiTx *SdiTxPtr)
 
 	do {
 		/* Calculate vtc horizontal blanking */
-		Vtc_Hblank = VideoTiming.HFrontPorch +
-		VideoTiming.HBackPorch +
-		VideoTiming.HSyncWidth;
+		Vtc_Hblank = TimingPtr->HFrontPorch +
+		TimingPtr->HBackPorch +
+		TimingPtr->HSyncWidth;
 
 		/* Quad pixel mode */
 		if (SdiTxPtr->Stream[0].Video.PixPerClk == XVIDC_PPC_4) {
@@ -724,7 +706,7 @@ static int XV_SdiTxSs_VtcSetup(XVtc *XVtcPtr, XV_SdiTx *SdiTxPtr)
 		/* If the horizontal total blanking differs, */
 		/* then increment the Vtc horizontal front porch. */
 		if (Vtc_Hblank != SdiTx_Hblank) {
-			VideoTiming.HFrontPorch++;
+			TimingPtr->HFrontPorch++;
 		}
 
 	} while (Vtc_Hblank < SdiTx_Hblank);
@@ -739,28 +721,16 @@ static int XV_SdiTxSs_VtcSetup(XVtc *XVtcPtr, XV_SdiTx *SdiTxPtr)
 		return XST_FAILURE;
 	}
 
-	XVtc_SetGeneratorTiming(XVtcPtr, &VideoTiming);
-
-	/* Only for XVIDC_VM_720x486_60_I (SDI NTSC), the FIELD1 vactive
-	 * size is different from FIELD0. As there is no vactive FIELD1
-	 * entry in the video common library, program it separately as below */
-	if (SdiTxPtr->Stream[0].Video.VmId == XVIDC_VM_720x486_60_I)
-	{
-		RegValue = (XSDITXSS_SD_NTSC_F1_V_ACTIVE << XSDITXSS_XVTC_ASIZE_VERT_SHIFT) &
-				XSDITXSS_XVTC_ASIZE_VERT_MASK;
-		XVtc_WriteReg(XVtcPtr->Config.BaseAddress,
-				XSDITXSS_XVTC_GASIZE_F1_OFFSET, RegValue);
-	}
 	/* Set up Polarity of all outputs */
-	memset((void *)&Polarity, 0, sizeof(XVtc_Polarity));
-	Polarity.ActiveChromaPol = 1;
-	Polarity.ActiveVideoPol = 1;
+	memset((void *)PolarityPtr, 0, sizeof(XVtc_Polarity));
+	PolarityPtr->ActiveChromaPol = 1;
+	PolarityPtr->ActiveVideoPol = 1;
 
 	/* Polarity.FieldIdPol = 0; */
-	if (VideoTiming.Interlaced) {
-		Polarity.FieldIdPol = 1;
+	if (TimingPtr->Interlaced) {
+		PolarityPtr->FieldIdPol = 1;
 	} else {
-		Polarity.FieldIdPol = 0;
+		PolarityPtr->FieldIdPol = 0;
 	}
 
 	/* SDI requires blanking polarity to be 1, which differs from what
@@ -769,15 +739,94 @@ static int XV_SdiTxSs_VtcSetup(XVtc *XVtcPtr, XV_SdiTx *SdiTxPtr)
 */
 	if (SdiTxPtr->Stream[0].Video.VmId == XVIDC_VM_720x486_60_I ||
 			SdiTxPtr->Stream[0].Video.VmId == XVIDC_VM_720x576_50_I) {
-		Polarity.VBlankPol = 1;
-		Polarity.VSyncPol = 1;
-		Polarity.HBlankPol = 1;
-		Polarity.HSyncPol = 1;
+		PolarityPtr->VBlankPol = 1;
+		PolarityPtr->VSyncPol = 1;
+		PolarityPtr->HBlankPol = 1;
+		PolarityPtr->HSyncPol = 1;
 	} else {
-		Polarity.VBlankPol = VideoTiming.VSyncPolarity;
-		Polarity.VSyncPol = VideoTiming.VSyncPolarity;
-		Polarity.HBlankPol = VideoTiming.HSyncPolarity;
-		Polarity.HSyncPol = VideoTiming.HSyncPolarity;
+		PolarityPtr->VBlankPol = TimingPtr->VSyncPolarity;
+		PolarityPtr->VSyncPol = TimingPtr->VSyncPolarity;
+		PolarityPtr->HBlankPol = TimingPtr->HSyncPolarity;
+		PolarityPtr->HSyncPol = TimingPtr->HSyncPolarity;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function configures Video Timing Controller (VTC) with the settings
+* of a profile.
+*
+* @param	XVtcPtr is a pointer to the XVtc core instance.
+* @param	ProfilePtr is a pointer to the profile of the video format.
+* @param	Reset specifies whether the VTC is reset and its source set up
+*		first. Without reset the new timing is taken by the generator
+*		at the start of its next frame.
+*
+* @return	XST_SUCCESS if the VTC is configured else XST_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static int XV_SdiTxSs_VtcApply(XVtc *XVtcPtr,
+			       const XV_SdiTxSs_Profile *ProfilePtr, u8 Reset)
+{
+	XVtc_SourceSelect SourceSelect;
+	XVtc_Timing VideoTiming;
+	XVtc_Polarity Polarity;
+	u32 RegValue;
+
+	if (Reset) {
+		/* Disable Generator */
+		XVtc_Reset(XVtcPtr);
+		XVtc_DisableGenerator(XVtcPtr);
+		XVtc_Disable(XVtcPtr);
+
+		/* Set up source select */
+		memset((void *)&SourceSelect, 0, sizeof(SourceSelect));
+
+		/* 1 = Generator registers, 0 = Detector registers */
+		SourceSelect.VChromaSrc = 1;
+		SourceSelect.VActiveSrc = 1;
+		SourceSelect.VBackPorchSrc = 1;
+		SourceSelect.VSyncSrc = 1;
+		SourceSelect.VFrontPorchSrc = 1;
+		SourceSelect.VTotalSrc = 1;
+		SourceSelect.HActiveSrc = 1;
+		SourceSelect.HBackPorchSrc = 1;
+		SourceSelect.HSyncSrc = 1;
+		SourceSelect.HFrontPorchSrc = 1;
+		SourceSelect.HTotalSrc = 1;
+
+		XVtc_SetSource(XVtcPtr, &SourceSelect);
+	}
+
+	if (!ProfilePtr->IsVtcValid) {
+		return XST_FAILURE;
+	}
+
+	/* Hold the register update until all of the new timing is written */
+	if (!Reset) {
+		XVtc_RegUpdateDisable(XVtcPtr);
+	}
+
+	/* The VTC driver takes non-const pointers */
+	VideoTiming = ProfilePtr->VtcTiming;
+	Polarity = ProfilePtr->VtcPolarity;
+
+	XVtc_SetGeneratorTiming(XVtcPtr, &VideoTiming);
+
+	/* Only for XVIDC_VM_720x486_60_I (SDI NTSC), the FIELD1 vactive
+	 * size is different from FIELD0. As there is no vactive FIELD1
+	 * entry in the video common library, program it separately as below */
+	if (ProfilePtr->VmId == XVIDC_VM_720x486_60_I)
+	{
+		RegValue = (XSDITXSS_SD_NTSC_F1_V_ACTIVE << XSDITXSS_XVTC_ASIZE_VERT_SHIFT) &
+				XSDITXSS_XVTC_ASIZE_VERT_MASK;
+		XVtc_WriteReg(XVtcPtr->Config.BaseAddress,
+				XSDITXSS_XVTC_GASIZE_F1_OFFSET, RegValue);
 	}
 
 	XVtc_SetPolarity(XVtcPtr, &Polarity);
@@ -800,7 +849,221 @@ static int XV_SdiTxSs_VtcSetup(XVtc *XVtcPtr, XV_SdiTx *SdiTxPtr)
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function checks whether a profile was computed for the video format
+* configured in the SDI TX core.
+*
+* @param	ProfilePtr is a pointer to the profile.
+* @param	SdiTxPtr is a pointer to the XV_SdiTx core instance.
+*
+* @return	TRUE if the profile is the one of the format else FALSE.
+*
+* @note		None.
+*
+******************************************************************************/
+static u8 XV_SdiTxSs_ProfileMatch(const XV_SdiTxSs_Profile *ProfilePtr,
+				  const XV_SdiTx *SdiTxPtr)
+{
+	const XVidC_VideoStream *Video = &SdiTxPtr->Stream[0].Video;
+	const XVidC_VideoTiming *T = &Video->Timing;
+	const XVidC_VideoTiming *P = &ProfilePtr->Timing;
+
+	if (!ProfilePtr->IsValid ||
+	    ProfilePtr->TMode != SdiTxPtr->Transport.TMode ||
+	    ProfilePtr->IsFractional != SdiTxPtr->Transport.IsFractional ||
+	    ProfilePtr->IsLevelB3G != SdiTxPtr->Transport.IsLevelB3G ||
+	    ProfilePtr->VmId != Video->VmId ||
+	    ProfilePtr->ColorFormatId != Video->ColorFormatId ||
+	    ProfilePtr->FrameRate != Video->FrameRate ||
+	    ProfilePtr->InIsInterlaced != Video->IsInterlaced ||
+	    ProfilePtr->PixPerClk != Video->PixPerClk ||
+	    ProfilePtr->PayloadId != SdiTxPtr->Stream[0].PayloadId) {
+		return FALSE;
+	}
+
+	/* Compare field by field, the structure has padding */
+	return (T->HActive == P->HActive &&
+		T->HFrontPorch == P->HFrontPorch &&
+		T->HSyncWidth == P->HSyncWidth &&
+		T->HBackPorch == P->HBackPorch &&
+		T->HSyncPolarity == P->HSyncPolarity &&
+		T->VActive == P->VActive &&
+		T->F0PVFrontPorch == P->F0PVFrontPorch &&
+		T->F0PVSyncWidth == P->F0PVSyncWidth &&
+		T->F0PVBackPorch == P->F0PVBackPorch &&
+		T->F1VFrontPorch == P->F1VFrontPorch &&
+		T->F1VSyncWidth == P->F1VSyncWidth &&
+		T->F1VBackPorch == P->F1VBackPorch &&
+		T->VSyncPolarity == P->VSyncPolarity) ? TRUE : FALSE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes the profile of the video format configured in the
+* SDI TX core.
+*
+* @param	InstancePtr is a pointer to the XV_SdiTxSs core instance.
+* @param	ProfilePtr is a pointer to the profile to compute.
+*
+* @return	None.
+*
+* @note		The 3GB DL interlaced setting of the stream 0 is applied to
+*		the SDI TX core, as the profile key holds the configured one.
+*
+******************************************************************************/
+static void XV_SdiTxSs_ComputeProfile(XV_SdiTxSs *InstancePtr,
+				      XV_SdiTxSs_Profile *ProfilePtr)
+{
+	XV_SdiTx *SdiTxPtr = InstancePtr->SdiTxPtr;
+	XVidC_VideoStream *Video = &SdiTxPtr->Stream[0].Video;
+
+	memset((void *)ProfilePtr, 0, sizeof(XV_SdiTxSs_Profile));
+	ProfilePtr->TMode = SdiTxPtr->Transport.TMode;
+	ProfilePtr->IsFractional = SdiTxPtr->Transport.IsFractional;
+	ProfilePtr->IsLevelB3G = SdiTxPtr->Transport.IsLevelB3G;
+	ProfilePtr->VmId = Video->VmId;
+	ProfilePtr->ColorFormatId = Video->ColorFormatId;
+	ProfilePtr->FrameRate = Video->FrameRate;
+	ProfilePtr->InIsInterlaced = Video->IsInterlaced;
+	ProfilePtr->PixPerClk = Video->PixPerClk;
+	ProfilePtr->PayloadId = SdiTxPtr->Stream[0].PayloadId;
+	ProfilePtr->Timing = Video->Timing;
+	ProfilePtr->MaxDataStreams = InstancePtr->MaxDataStreams;
+
+	switch (SdiTxPtr->Transport.TMode) {
+	case XSDIVID_MODE_SD:
+		if (Video->VmId == XVIDC_VM_720x486_60_I) {
+			/* NTSC */
+			ProfilePtr->PayloadLineNum1 = XV_SDITX_PAYLOADLN1_SDNTSC;
+			ProfilePtr->PayloadLineNum2 = XV_SDITX_PAYLOADLN2_SDNTSC;
+		} else {
+			/* PAL */
+			ProfilePtr->PayloadLineNum1 = XV_SDITX_PAYLOADLN1_SDPAL;
+			ProfilePtr->PayloadLineNum2 = XV_SDITX_PAYLOADLN2_SDPAL;
+		}
+		break;
+
+	case XSDIVID_MODE_3GA:
+	case XSDIVID_MODE_3GB:
+		/* Only for 3GB DL case we need to change the IsInterlaced
+		 * to true as it should be true for 3GB DL. For remaining
+		 * cases it should be as it is configured from the upper layer*/
+		if (XV_SdiTxSs_Is3GBDLor3GA1125L(InstancePtr))
+			Video->IsInterlaced = 1;
+	case XSDIVID_MODE_HD:
+	case XSDIVID_MODE_12G:
+		ProfilePtr->PayloadLineNum1 = XV_SDITX_PAYLOADLN1_HD_3G_6G_12G;
+		ProfilePtr->PayloadLineNum2 = XV_SDITX_PAYLOADLN2_HD_3G_6G_12G;
+		break;
+	case XSDIVID_MODE_6G:
+		if (Video->ColorFormatId == XVIDC_CSF_YCRCB_444) {
+			ProfilePtr->MaxDataStreams = 4;
+		} else if (Video->ColorFormatId == XVIDC_CSF_YCRCB_422){
+			ProfilePtr->MaxDataStreams =
+					(InstancePtr->Config.bitdepth == 10) ? 8 : 4;
+		} else {
+			ProfilePtr->MaxDataStreams = 8;
+		}
+		ProfilePtr->PayloadLineNum1 = XV_SDITX_PAYLOADLN1_HD_3G_6G_12G;
+		ProfilePtr->PayloadLineNum2 = XV_SDITX_PAYLOADLN2_HD_3G_6G_12G;
+		break;
+	default:
+		ProfilePtr->PayloadLineNum1 = 0;
+		ProfilePtr->PayloadLineNum2 = 0;
+		break;
+	}
+	ProfilePtr->IsInterlaced = Video->IsInterlaced;
+
+	if (XV_SdiTxSs_VtcCompute(SdiTxPtr, &ProfilePtr->VtcTiming,
+				  &ProfilePtr->VtcPolarity) == XST_SUCCESS) {
+		ProfilePtr->IsVtcValid = TRUE;
+	}
+	ProfilePtr->IsValid = TRUE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the profile of the video format configured in the
+* SDI TX core, from the cache or computed into it. The least recently used
+* entry is replaced, except the ones of the configured and the running
+* format.
+*
+* @param	InstancePtr is a pointer to the XV_SdiTxSs core instance.
+*
+* @return	Pointer to the profile.
+*
+* @note		The interlaced setting and the number of data streams of the
+*		profile are applied to the SDI TX core and the instance.
+*
+******************************************************************************/
+static XV_SdiTxSs_Profile *XV_SdiTxSs_GetProfile(XV_SdiTxSs *InstancePtr)
+{
+	XV_SdiTxSs_Profile *ProfilePtr = NULL;
+	XV_SdiTxSs_Profile *Entry;
+	int Index;
+
+	for (Index = 0; Index < XV_SDITXSS_MAX_PROFILES; Index++) {
+		Entry = &InstancePtr->Profile[Index];
+		if (XV_SdiTxSs_ProfileMatch(Entry, InstancePtr->SdiTxPtr)) {
+			ProfilePtr = Entry;
+			break;
+		}
+	}
+
+	if (ProfilePtr == NULL) {
+		for (Index = 0; Index < XV_SDITXSS_MAX_PROFILES; Index++) {
+			Entry = &InstancePtr->Profile[Index];
+			if (Entry == InstancePtr->CurProfile ||
+			    Entry == InstancePtr->VtcProfile) {
+				continue;
+			}
+			if (!Entry->IsValid) {
+				ProfilePtr = Entry;
+				break;
+			}
+			if (ProfilePtr == NULL ||
+			    Entry->LastUsed < ProfilePtr->LastUsed) {
+				ProfilePtr = Entry;
+			}
+		}
+		XV_SdiTxSs_ComputeProfile(InstancePtr, ProfilePtr);
+	}
+
+	InstancePtr->SdiTxPtr->Stream[0].Video.IsInterlaced =
+			ProfilePtr->IsInterlaced;
+	InstancePtr->MaxDataStreams = ProfilePtr->MaxDataStreams;
+	ProfilePtr->LastUsed = ++InstancePtr->ProfileAge;
+
+	return ProfilePtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function clears the profile cache of the subsystem. It should be
+* called when a setting the profiles do not hold is changed, for example
+* the bit depth of the subsystem configuration.
+*
+* @param  InstancePtr pointer to XV_SdiTxSs instance
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+void XV_SdiTxSs_ClearProfiles(XV_SdiTxSs *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
 
+	(void)memset((void *)InstancePtr->Profile, 0,
+		     sizeof(InstancePtr->Profile));
+	InstancePtr->CurProfile = NULL;
+	InstancePtr->VtcProfile = NULL;
+}
 
 /*****************************************************************************/
 /**
@@ -836,8 +1099,16 @@ void XV_SdiTxSs_StreamStart(XV_SdiTxSs *InstancePtr)
 
 	/* Configure VTC */
 	if (InstancePtr->VtcPtr) {
+		/* The profile is normally picked by XV_SdiTxSs_StreamConfig */
+		if (InstancePtr->CurProfile == NULL) {
+			InstancePtr->CurProfile =
+					XV_SdiTxSs_GetProfile(InstancePtr);
+		}
+
 		/* Setup VTC */
-		XV_SdiTxSs_VtcSetup(InstancePtr->VtcPtr, InstancePtr->SdiTxPtr);
+		XV_SdiTxSs_VtcApply(InstancePtr->VtcPtr,
+				    InstancePtr->CurProfile, TRUE);
+		InstancePtr->VtcProfile = InstancePtr->CurProfile;
 	}
 
 	XV_SdiTx_Axi4sBridgeVtcEnable(InstancePtr->SdiTxPtr);
@@ -854,70 +1125,108 @@ void XV_SdiTxSs_StreamStart(XV_SdiTxSs *InstancePtr)
 *
 * @return None.
 *
-* @note   None.
+* @note   The settings of the video format, VTC timing included, are taken
+*         from the profile cache or computed here, before the SDI mode is
+*         written, so that only register writes are left for the GT ready
+*         interrupt.
 *
 ******************************************************************************/
 void XV_SdiTxSs_StreamConfig(XV_SdiTxSs *InstancePtr)
 {
-	u32 PayloadLineNum1;
-	u32 PayloadLineNum2;
+	XV_SdiTxSs_Profile *ProfilePtr;
 
-	switch (InstancePtr->SdiTxPtr->Transport.TMode) {
-	case XSDIVID_MODE_SD:
-		if (InstancePtr->SdiTxPtr->Stream[0].Video.VmId
-				== XVIDC_VM_720x486_60_I) {
-			/* NTSC */
-			PayloadLineNum1 = XV_SDITX_PAYLOADLN1_SDNTSC;
-			PayloadLineNum2 = XV_SDITX_PAYLOADLN2_SDNTSC;
-		} else {
-			/* PAL */
-			PayloadLineNum1 = XV_SDITX_PAYLOADLN1_SDPAL;
-			PayloadLineNum2 = XV_SDITX_PAYLOADLN2_SDPAL;
-		}
-		break;
-
-	case XSDIVID_MODE_3GA:
-	case XSDIVID_MODE_3GB:
-		/* Only for 3GB DL case we need to change the IsInterlaced
-		 * to true as it should be true for 3GB DL. For remaining
-		 * cases it should be as it is configured from the upper layer*/
-		if (XV_SdiTxSs_Is3GBDLor3GA1125L(InstancePtr))
-			InstancePtr->SdiTxPtr->Stream[0].Video.IsInterlaced = 1;
-	case XSDIVID_MODE_HD:
-	case XSDIVID_MODE_12G:
-		PayloadLineNum1 = XV_SDITX_PAYLOADLN1_HD_3G_6G_12G;
-		PayloadLineNum2 = XV_SDITX_PAYLOADLN2_HD_3G_6G_12G;
-		break;
-	case XSDIVID_MODE_6G:
-		if (InstancePtr->SdiTxPtr->Stream[0].Video.ColorFormatId ==
-				XVIDC_CSF_YCRCB_444) {
-			InstancePtr->MaxDataStreams = 4;
-		} else if (InstancePtr->SdiTxPtr->Stream[0].Video.ColorFormatId ==
-				XVIDC_CSF_YCRCB_422){
-			InstancePtr->MaxDataStreams =
-					(InstancePtr->Config.bitdepth == 10) ? 8 : 4;
-		} else {
-			InstancePtr->MaxDataStreams = 8;
-		}
-		PayloadLineNum1 = XV_SDITX_PAYLOADLN1_HD_3G_6G_12G;
-		PayloadLineNum2 = XV_SDITX_PAYLOADLN2_HD_3G_6G_12G;
-		break;
-	default:
-		PayloadLineNum1 = 0;
-		PayloadLineNum2 = 0;
-		break;
-	}
+	ProfilePtr = XV_SdiTxSs_GetProfile(InstancePtr);
+	InstancePtr->CurProfile = ProfilePtr;
 
 	XV_SdiTx_SetPayloadLineNum(InstancePtr->SdiTxPtr,
-	PayloadLineNum1,
-	PayloadLineNum2,
-	InstancePtr->SdiTxPtr->Stream[0].Video.IsInterlaced);
+	ProfilePtr->PayloadLineNum1,
+	ProfilePtr->PayloadLineNum2,
+	ProfilePtr->IsInterlaced);
 
 	XV_SdiTx_StreamStart(InstancePtr->SdiTxPtr);
 
 	XV_SdiTxSs_LogWrite(InstancePtr, XV_SDITXSS_LOG_EVT_STREAMCFG, 0);
 }
 
+/*****************************************************************************/
+/**
+*
+* This function switches the running SDI TX stream to the video format set
+* with XV_SdiTxSs_SetVideoStream() and XV_SdiTxSs_SetTransport(), without a
+* GT reset, when the format has the SDI mode, bit rate, 3G level, color
+* format and frame rate class of the running one, so the same line rate and
+* data stream layout. Only the ST352 line numbers and payload ids that
+* changed are written, and the VTC takes the new timing at its next frame.
+*
+* @param  InstancePtr pointer to XV_SdiTxSs instance
+*
+* @return
+*         - XST_SUCCESS if the stream was switched.
+*         - XST_FAILURE if the stream is not running or the format needs
+*           the full sequence, XV_SdiTxSs_Stop() then
+*           XV_SdiTxSs_StreamConfig(). Only the profile of the format has
+*           been computed then.
+*
+* @note   The upstream video should change its format at the same frame.
+*
+******************************************************************************/
+int XV_SdiTxSs_SwitchFormat(XV_SdiTxSs *InstancePtr)
+{
+	XV_SdiTxSs_Profile *ProfilePtr;
+	XV_SdiTxSs_Profile *OldPtr;
+	XV_SdiTx *SdiTxPtr;
+	u8 OldHfr;
+	u8 NewHfr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	SdiTxPtr = InstancePtr->SdiTxPtr;
+	OldPtr = InstancePtr->CurProfile;
+	if (!SdiTxPtr->IsStreamUp || OldPtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	ProfilePtr = XV_SdiTxSs_GetProfile(InstancePtr);
+
+	/* The core enables HFR above 96Hz, which changes the mux pattern */
+	OldHfr = (OldPtr->FrameRate >= XVIDC_FR_96HZ &&
+		  OldPtr->FrameRate <= XVIDC_FR_240HZ);
+	NewHfr = (ProfilePtr->FrameRate >= XVIDC_FR_96HZ &&
+		  ProfilePtr->FrameRate <= XVIDC_FR_240HZ);
+
+	if (ProfilePtr->TMode != OldPtr->TMode ||
+	    ProfilePtr->IsFractional != OldPtr->IsFractional ||
+	    ProfilePtr->IsLevelB3G != OldPtr->IsLevelB3G ||
+	    ProfilePtr->ColorFormatId != OldPtr->ColorFormatId ||
+	    ProfilePtr->MaxDataStreams != OldPtr->MaxDataStreams ||
+	    OldHfr != NewHfr ||
+	    (InstancePtr->VtcPtr && !ProfilePtr->IsVtcValid)) {
+		return XST_FAILURE;
+	}
+
+	if (ProfilePtr->PayloadLineNum1 != OldPtr->PayloadLineNum1 ||
+	    ProfilePtr->PayloadLineNum2 != OldPtr->PayloadLineNum2 ||
+	    ProfilePtr->IsInterlaced != OldPtr->IsInterlaced) {
+		XV_SdiTx_SetPayloadLineNum(SdiTxPtr,
+		ProfilePtr->PayloadLineNum1,
+		ProfilePtr->PayloadLineNum2,
+		ProfilePtr->IsInterlaced);
+	}
+
+	XV_SdiTx_UpdatePayloadIds(SdiTxPtr, TRUE);
+
+	if (InstancePtr->VtcPtr && ProfilePtr != InstancePtr->VtcProfile) {
+		XV_SdiTxSs_VtcApply(InstancePtr->VtcPtr, ProfilePtr, FALSE);
+		InstancePtr->VtcProfile = ProfilePtr;
+	}
+
+	InstancePtr->CurProfile = ProfilePtr;
+
+	XV_SdiTxSs_LogWrite(InstancePtr, XV_SDITXSS_LOG_EVT_STREAMCFG, 0);
+
+	return XST_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
 *
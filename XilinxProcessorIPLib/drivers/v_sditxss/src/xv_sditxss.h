@@ -26,6 +26,22 @@
 *   - YCbCr color space
 *   - Up to 4k2k 60Hz resolution at both Input and Output interface
 *   - Interlaced output support (1080i 50Hz/60Hz)
+*
+* <b>Video Format Switching</b>
+*
+* The settings the subsystem derives from a video format (ST352 line numbers,
+* data streams, VTC timing and polarity) are kept in a cache of
+* XV_SDITXSS_MAX_PROFILES profiles, computed the first time a format is
+* configured and reused on every later switch to it. XV_SdiTxSs_StreamConfig()
+* picks the profile before the SDI mode is written and the GT starts its
+* rate change, so that XV_SdiTxSs_StreamStart() only writes registers once
+* the GT is ready.
+*
+* Between formats of the same SDI mode, bit rate and data stream layout, for
+* example 1080p50 to 1080i50 or 1080p60 to 2048x1080p60 in 3G, the line rate
+* does not change and XV_SdiTxSs_SwitchFormat() switches the running stream
+* without a GT reset: only the ST352 settings and VTC timing that differ are
+* written, and the VTC takes them on its next frame.
 
 * <pre>
 * MODIFICATION HISTORY:
@@ -36,6 +52,7 @@
 * 2.00  kar  01/25/18 Second  release.
 *       jsr  03/02/2018 Added core settings API
 * 3.0   vve  10/03/18 Add support for ST352 in C Stream
+* 4.4   fl   10/14/26 Added video format profiles and XV_SdiTxSs_SwitchFormat
 * </pre>
 *
 ******************************************************************************/
@@ -69,6 +86,9 @@ extern "C" {
 #define XV_SDITXSS_IER_UNDERFLOW_MASK		XV_SDITX_IER_UNDERFLOW_MASK
 #define XV_SDITXSS_IER_ALLINTR_MASK		XV_SDITX_IER_ALLINTR_MASK
 
+#define XV_SDITXSS_MAX_PROFILES		8	/**< Video formats kept in the
+						  *  profile cache */
+
 /**************************** Type Definitions *******************************/
 /**
 * This typedef contains the enum for various logging events.
@@ -155,6 +175,33 @@ typedef struct {
 */
 typedef void (*XV_SdiTxSs_Callback)(void *CallbackRef);
 
+/**
+* Settings of the subsystem for one video format. The key is the transport
+* and stream 0 format configured by the application, the rest is derived
+* from it.
+*/
+typedef struct {
+	u8 IsValid;			/**< Entry holds a profile */
+	XSdiVid_TransMode TMode;	/**< Key: SDI mode */
+	XSdiVid_BitRate IsFractional;	/**< Key: bit rate */
+	u8 IsLevelB3G;			/**< Key: 3G level B */
+	XVidC_VideoMode VmId;		/**< Key: video mode */
+	XVidC_ColorFormat ColorFormatId; /**< Key: color format */
+	XVidC_FrameRate FrameRate;	/**< Key: frame rate */
+	u8 InIsInterlaced;		/**< Key: interlaced as configured */
+	u32 PayloadId;			/**< Key: stream 0 ST352 payload id */
+	XVidC_PixelsPerClock PixPerClk;	/**< Key: pixels per clock */
+	XVidC_VideoTiming Timing;	/**< Key: stream 0 timing */
+	u8 IsInterlaced;		/**< Interlaced as transmitted */
+	u8 MaxDataStreams;		/**< Data streams of the format */
+	u32 PayloadLineNum1;		/**< ST352 line of field 1 */
+	u32 PayloadLineNum2;		/**< ST352 line of field 2 */
+	u8 IsVtcValid;			/**< VTC timing could be derived */
+	XVtc_Timing VtcTiming;		/**< VTC generator timing */
+	XVtc_Polarity VtcPolarity;	/**< VTC output polarities */
+	u32 LastUsed;			/**< Age of the entry, for replacement */
+} XV_SdiTxSs_Profile;
+
 /**
 * The XV_SdiTxSs driver instance data. An instance must be allocated for each
 * SDI TX core in use.
@@ -183,6 +230,12 @@ typedef struct {
 
 	u8 IsStreamUp;                /**< SDI TX Stream Up */
 	u8 MaxDataStreams;	/**< Maximum number of data streams*/
+
+	XV_SdiTxSs_Profile Profile[XV_SDITXSS_MAX_PROFILES]; /**< Profile
+							       *  cache */
+	XV_SdiTxSs_Profile *CurProfile;	/**< Profile of the configured format */
+	XV_SdiTxSs_Profile *VtcProfile;	/**< Profile programmed in the VTC */
+	u32 ProfileAge;			/**< Age counter of the cache */
 } XV_SdiTxSs;
 
 /** @name SDITxSs Core Configurable Settings
@@ -234,6 +287,8 @@ int XV_SdiTxSs_SetCallback(XV_SdiTxSs *InstancePtr,
 
 void XV_SdiTxSs_StreamStart(XV_SdiTxSs *InstancePtr);
 void XV_SdiTxSs_StreamConfig(XV_SdiTxSs *InstancePtr);
+int XV_SdiTxSs_SwitchFormat(XV_SdiTxSs *InstancePtr);
+void XV_SdiTxSs_ClearProfiles(XV_SdiTxSs *InstancePtr);
 void XV_SdiTxSs_Stop(XV_SdiTxSs *InstancePtr);
 u32 *XV_SdiTxSs_GetPayloadId(XV_SdiTxSs *InstancePtr, u8 StreamId);
 void XV_SdiTxSs_SetEotf(XV_SdiTxSs *InstancePtr, XVidC_Eotf Eotf,
@@ -28,6 +28,7 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.2   fl    10/14/26   Added coefficient cache
 *
 * </pre>
 *
@@ -64,7 +65,9 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 		                          u32 HeightIn,
 		                          u32 HeightOut);
 
-static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr);
+static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr, u32 *Words);
+static void XV_VScalerWriteCachedCoeff(XV_Vscaler_l2 *VscPtr,
+                                       const u32 *Words);
 
 /*****************************************************************************/
 /**
@@ -323,7 +326,7 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
 * core registers
 *
 * @param  InstancePtr is a pointer to the core instance to be worked on.
-* @param  VCoeff is the array that holds computed coefficients
+* @param  Words is filled with the words written, or NULL
 *
 * @return None
 *
@@ -334,7 +337,7 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
 *        maintain the sw latency for driver version which would eventually use
 *        computed coefficients
 ******************************************************************************/
-static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr)
+static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr, u32 *Words)
 {
   int num_phases = 1<<VscPtr->Vsc.Config.PhaseShift;
   int num_taps   = VscPtr->Vsc.Config.NumTaps/2;
@@ -350,10 +353,86 @@ static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr)
        rdIndx = j*2+offset;
        val = (VscPtr->coeff[i][rdIndx+1] << 16) | (VscPtr->coeff[i][rdIndx] & XVSC_MASK_LOW_16BITS);
        Xil_Out32(baseAddr+((i*num_taps+j)*4), val);
+       if(Words != NULL)
+       {
+         *Words++ = val;
+       }
     }
   }
 }
 
+/*****************************************************************************/
+/**
+* This function writes coefficient words recorded by XV_VScalerSetCoeff()
+*
+* @param  VscPtr is a pointer to the core instance to be worked on.
+* @param  Words is the recorded words
+*
+* @return None
+*
+******************************************************************************/
+static void XV_VScalerWriteCachedCoeff(XV_Vscaler_l2 *VscPtr,
+                                       const u32 *Words)
+{
+  u32 count = XV_VScalerGetCacheEntryWords(VscPtr);
+  UINTPTR baseAddr;
+  u32 i;
+
+  baseAddr = XV_vscaler_Get_HwReg_vfltCoeff_BaseAddress(&VscPtr->Vsc);
+  for(i=0; i < count; i++)
+  {
+    Xil_Out32(baseAddr+(i*4), Words[i]);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function returns the size of a cache entry for the core
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return Number of words of a cache entry
+*
+******************************************************************************/
+u32 XV_VScalerGetCacheEntryWords(XV_Vscaler_l2 *InstancePtr)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  return (1<<InstancePtr->Vsc.Config.PhaseShift) *
+         (InstancePtr->Vsc.Config.NumTaps/2);
+}
+
+/*****************************************************************************/
+/**
+* This function sets the coefficient cache of the core
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  CachePtr is a pointer to an initialized cache, or NULL to select
+*         the coefficients of every configuration
+*
+* @return XST_SUCCESS if the cache was set
+*         XST_INVALID_PARAM if the cache entries are too small
+*
+******************************************************************************/
+int XV_VScalerSetCache(XV_Vscaler_l2 *InstancePtr, XVidC_CoeffCache *CachePtr)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if((CachePtr != NULL) &&
+     (CachePtr->EntryWords < XV_VScalerGetCacheEntryWords(InstancePtr)))
+  {
+    return XST_INVALID_PARAM;
+  }
+
+  InstancePtr->Cache = CachePtr;
+  if(CachePtr != NULL)
+  {
+    XVidC_CoeffCacheFlush(CachePtr);
+  }
+
+  return XST_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
 * This function configures the scaler core registers with the specified
@@ -375,6 +454,9 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
                     u32            ColorFormat)
 {
   u32 LineRate;
+  XVidC_CoeffCacheKey Key;
+  u32 *Words = NULL;
+  u8 Hit = 0;
 
   /*
    * Assert validates the input arguments
@@ -394,12 +476,34 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
   {
     if(!InstancePtr->UseExtCoeff) //No user defined coefficients
     {
-      /* Determine coefficient table to use */
-      XV_VScalerSelectCoeff(InstancePtr,  HeightIn, HeightOut);
-    }
+      if(InstancePtr->Cache != NULL)
+      {
+        Key.SizeIn = HeightIn;
+        Key.SizeOut = HeightOut;
+        Key.NumTaps = InstancePtr->Vsc.Config.NumTaps;
+        Key.Flags = 0;
+        Words = XVidC_CoeffCacheGet(InstancePtr->Cache, &Key, &Hit);
+      }
+
+      if(Hit)
+      {
+        /* Program cached coefficients into the IP register bank */
+        XV_VScalerWriteCachedCoeff(InstancePtr, Words);
+      }
+      else
+      {
+        /* Determine coefficient table to use */
+        XV_VScalerSelectCoeff(InstancePtr,  HeightIn, HeightOut);
 
-    /* Program coefficients into the IP register bank */
-    XV_VScalerSetCoeff(InstancePtr);
+        /* Program coefficients into the IP register bank */
+        XV_VScalerSetCoeff(InstancePtr, Words);
+      }
+    }
+    else
+    {
+      /* Program coefficients into the IP register bank */
+      XV_VScalerSetCoeff(InstancePtr, NULL);
+    }
   }
 
   LineRate = (HeightIn * STEP_PRECISION)/HeightOut;
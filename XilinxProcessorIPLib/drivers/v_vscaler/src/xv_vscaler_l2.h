@@ -59,6 +59,14 @@
 * This driver is not thread safe. Any needs for threads or thread mutual
 * exclusion must be satisfied by the layer above this driver.
 *
+* <b> Coefficient Cache </b>
+*
+* A cache set with XV_VScalerSetCache() keeps the packed coefficients of the
+* last configurations. XV_VScalerSetup() of a cached configuration writes
+* them to the core without selecting the coefficients again. The cache is
+* keyed by the input and output heights and the number of taps, the color
+* format does not change the coefficients.
+*
 * <b>Limitations</b>
 *
 * <pre>
@@ -70,6 +78,7 @@
 * 2.00  rco   11/05/15   Integrate layer-1 with layer-2
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.2   fl    10/14/26   Added coefficient cache
 *
 * </pre>
 *
@@ -82,6 +91,7 @@ extern "C" {
 #endif
 
 #include "xvidc.h"
+#include "xvidc_coeffcache.h"
 #include "xv_vscaler.h"
 
 /************************** Constant Definitions *****************************/
@@ -125,6 +135,7 @@ typedef struct
   XV_vscaler Vsc; /*<< Layer 1 instance */
   u8 UseExtCoeff;
   short coeff[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_MAX_V_TAPS];
+  XVidC_CoeffCache *Cache; /*<< Optional coefficient cache */
 }XV_Vscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -155,6 +166,8 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
                     u32 HeightOut,
                     u32 ColorFormat);
 void XV_VScalerDbgReportStatus(XV_Vscaler_l2 *InstancePtr);
+u32 XV_VScalerGetCacheEntryWords(XV_Vscaler_l2 *InstancePtr);
+int XV_VScalerSetCache(XV_Vscaler_l2 *InstancePtr, XVidC_CoeffCache *CachePtr);
 
 #ifdef __cplusplus
 }
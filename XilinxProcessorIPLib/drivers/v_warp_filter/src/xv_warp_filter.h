@@ -57,6 +57,9 @@ typedef struct {
     void *CallbackRef;
 	UINTPTR WarpFilterDesc_BaseAddr;
 	u32 NumDescriptors;
+	UINTPTR DescSet_BaseAddr[2];	/* Ping-pong descriptor sets */
+	u32 DescSet_NumDescriptors;
+	u32 DescSet_Next;		/* Set prepared for the next frame */
 } XV_warp_filter;
 
 typedef u32 word_type;
@@ -8,6 +8,7 @@
 #include "xil_types.h"
 #include "xv_warp_filter_l2.h"
 #include "sleep.h"
+#include "xil_cache.h"
 #include <stdlib.h>
 
 /************************** Constant Definitions *****************************/
@@ -21,10 +22,14 @@ typedef u16 offset_t;
 #define XV_WAIT_FOR_FLUSH_DONE		         (25)
 #define XV_WAIT_FOR_FLUSH_DONE_TIMEOUT		 (2000)
 #define WARP_FILTER_ADDR_WIDTH				 128
+#define WARP_FILTER_DESC_STRIDE \
+	align_up(sizeof(XVWarpFilter_Desc), WARP_FILTER_ADDR_WIDTH/8)
 
 /**************************Static Function Prototypes ************************/
 static void *XVWarpFilter_AlignedMalloc(size_t align, size_t size);
 static void XVWarpFilter_AlignedFree(void * ptr);
+static XVWarpFilter_Desc *XVWarpFilter_DescSetGet(XV_warp_filter *InstancePtr,
+		u32 Set, u32 DescNum);
 
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
@@ -309,6 +314,221 @@ s32 XVWarpFilter_Stop(XV_warp_filter *InstancePtr)
   return(Status);
 }
 
+/*****************************************************************************/
+/**
+* This function returns a descriptor of a descriptor set.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Set is the descriptor set, 0 or 1
+* @param  DescNum is the descriptor number
+*
+* @return Pointer to the descriptor
+*
+******************************************************************************/
+static XVWarpFilter_Desc *XVWarpFilter_DescSetGet(XV_warp_filter *InstancePtr,
+		u32 Set, u32 DescNum)
+{
+	return (XVWarpFilter_Desc *)(InstancePtr->DescSet_BaseAddr[Set] +
+			(DescNum * WARP_FILTER_DESC_STRIDE));
+}
+
+/*****************************************************************************/
+/**
+* This function creates two persistent sets of descriptors, used in turn for
+* consecutive frames. The descriptors of a set are contiguous and chained, a
+* descriptor is reached without walking the chain.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  num_descriptors is the number of descriptors in each set
+*
+* @return XST_SUCCESS if the descriptor sets are created
+*         XST_FAILURE if the allocation failed
+*
+* @note   The sets are independent of XVWarpFilter_SetNumOfDescriptors().
+*
+******************************************************************************/
+s32 XVWarpFilter_DescSetCreate(XV_warp_filter *InstancePtr,
+		u32 num_descriptors)
+{
+	XVWarpFilter_Desc *descptr;
+	u32 set, descnum;
+	UINTPTR base;
+
+	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(num_descriptors > 0);
+
+	for (set = 0; set < 2; set++) {
+		base = (UINTPTR)XVWarpFilter_AlignedMalloc(WARP_FILTER_ADDR_WIDTH/8,
+				num_descriptors * WARP_FILTER_DESC_STRIDE);
+		if (!base) {
+			if (set)
+				XVWarpFilter_AlignedFree((void *)InstancePtr->DescSet_BaseAddr[0]);
+			InstancePtr->DescSet_BaseAddr[0] = 0;
+			return XST_FAILURE;
+		}
+		InstancePtr->DescSet_BaseAddr[set] = base;
+	}
+	InstancePtr->DescSet_NumDescriptors = num_descriptors;
+	InstancePtr->DescSet_Next = 0;
+
+	for (set = 0; set < 2; set++) {
+		for (descnum = 0; descnum < num_descriptors; descnum++) {
+			descptr = XVWarpFilter_DescSetGet(InstancePtr, set, descnum);
+			if (descnum == (num_descriptors - 1))
+				descptr->Warp_NextDescAddr = (u64)0;
+			else
+				descptr->Warp_NextDescAddr = (u64)(UINTPTR)
+					XVWarpFilter_DescSetGet(InstancePtr, set, descnum + 1);
+		}
+		Xil_DCacheFlushRange(InstancePtr->DescSet_BaseAddr[set],
+				num_descriptors * WARP_FILTER_DESC_STRIDE);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function de-allocates the descriptor sets.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return none
+*
+******************************************************************************/
+void XVWarpFilter_DescSetDestroy(XV_warp_filter *InstancePtr)
+{
+	u32 set;
+
+	Xil_AssertVoid(InstancePtr);
+
+	for (set = 0; set < 2; set++) {
+		if (InstancePtr->DescSet_BaseAddr[set])
+			XVWarpFilter_AlignedFree((void *)InstancePtr->DescSet_BaseAddr[set]);
+		InstancePtr->DescSet_BaseAddr[set] = 0;
+	}
+	InstancePtr->DescSet_NumDescriptors = 0;
+}
+
+/*****************************************************************************/
+/**
+* This function programs a descriptor of both descriptor sets. The remap
+* vector and the frame geometry are kept for every frame that follows.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  DescNum is the descriptor number which to be configured
+* @param  configPtr is the input configuration pointer which to be configured
+* 					into the descriptor
+* @param  valid_seg is the number of valid segs in the remap vector
+* @param  lblock_count is the number of output blocks decoded by the first warp
+* 					   filter core.
+* @param  line_num is the line number from which the second warp filter core
+* 				   starts reading the source image
+*
+* @return XST_SUCCESS if programming descriptor is successful
+*         XST_FAILURE if Descriptor is not valid.
+*
+******************************************************************************/
+s32 XVWarpFilter_DescSetProgram(XV_warp_filter *InstancePtr, u32 DescNum,
+		XVWarpFilter_InputConfigs *configPtr, u32 valid_seg,
+		u32 lblock_count, u32 line_num)
+{
+	XVWarpFilter_Desc *descptr;
+	u32 set;
+
+	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(configPtr);
+
+	if (DescNum >= InstancePtr->DescSet_NumDescriptors) {
+		xil_printf("Wrong descriptor\n\r");
+		return XST_FAILURE;
+	}
+
+	for (set = 0; set < 2; set++) {
+		descptr = XVWarpFilter_DescSetGet(InstancePtr, set, DescNum);
+		descptr->height = configPtr->height;
+		descptr->width = configPtr->width;
+		descptr->stride = configPtr->stride;
+		descptr->format = configPtr->format;
+		descptr->valid_seg = valid_seg;
+		descptr->lblock_count = lblock_count;
+		descptr->line_num = line_num;
+		descptr->reserved = 0;
+		descptr->src_buf_addr = configPtr->src_buf_addr;
+		descptr->seg_table_addr = configPtr->seg_table_addr;
+		descptr->dest_buf_addr = configPtr->dest_buf_addr;
+		Xil_DCacheFlushRange((UINTPTR)descptr, sizeof(XVWarpFilter_Desc));
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function patches the frame buffer addresses of a descriptor of the
+* set prepared for the next frame. Only the cache lines of the address
+* fields are flushed.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  DescNum is the descriptor number which to be configured
+* @param  src_buf_addr is the address of the source frame buffer
+* @param  dest_buf_addr is the address of the destination frame buffer
+*
+* @return XST_SUCCESS if the addresses are updated
+*         XST_FAILURE if Descriptor is not valid.
+*
+* @note   The core may run the other set meanwhile, the update takes
+*         effect after XVWarpFilter_DescSetSubmit().
+*
+******************************************************************************/
+s32 XVWarpFilter_DescSetUpdateAddr(XV_warp_filter *InstancePtr,
+		u32 DescNum, u64 src_buf_addr, u64 dest_buf_addr)
+{
+	XVWarpFilter_Desc *descptr;
+	UINTPTR start, end;
+
+	Xil_AssertNonvoid(InstancePtr);
+
+	if (DescNum >= InstancePtr->DescSet_NumDescriptors) {
+		xil_printf("Wrong descriptor\n\r");
+		return XST_FAILURE;
+	}
+
+	descptr = XVWarpFilter_DescSetGet(InstancePtr, InstancePtr->DescSet_Next,
+			DescNum);
+	descptr->src_buf_addr = src_buf_addr;
+	descptr->dest_buf_addr = dest_buf_addr;
+
+	start = (UINTPTR)&descptr->src_buf_addr;
+	end = (UINTPTR)&descptr->dest_buf_addr + sizeof(descptr->dest_buf_addr);
+	Xil_DCacheFlushRange(start, end - start);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function hands the prepared descriptor set to the core, it is used
+* with the next start. The other set is then prepared for the frame after.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return none
+*
+* @note   Call before XVWarpFilter_Start(), or before the current frame
+*         completes when auto restart is enabled.
+*
+******************************************************************************/
+void XVWarpFilter_DescSetSubmit(XV_warp_filter *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr);
+	Xil_AssertVoid(InstancePtr->DescSet_NumDescriptors > 0);
+
+	XV_warp_filter_Set_desc_addr(InstancePtr,
+			(u64)InstancePtr->DescSet_BaseAddr[InstancePtr->DescSet_Next]);
+	InstancePtr->DescSet_Next ^= 1;
+}
+
 /*****************************************************************************/
 /*****************************************************************************/
 /**
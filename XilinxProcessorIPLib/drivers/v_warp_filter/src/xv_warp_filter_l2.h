@@ -70,4 +70,13 @@ s32 XVWarpFilter_update_dst_frame_addr(XV_warp_filter *InstancePtr,
 		u32 Descnum, u64 dest_buf_addr);
 void XVWarpFilter_Start(XV_warp_filter *InstancePtr);
 s32 XVWarpFilter_Stop(XV_warp_filter *InstancePtr);
+s32 XVWarpFilter_DescSetCreate(XV_warp_filter *InstancePtr,
+		u32 num_descriptors);
+void XVWarpFilter_DescSetDestroy(XV_warp_filter *InstancePtr);
+s32 XVWarpFilter_DescSetProgram(XV_warp_filter *InstancePtr, u32 DescNum,
+		XVWarpFilter_InputConfigs *configPtr, u32 valid_seg,
+		u32 lblock_count, u32 line_num);
+s32 XVWarpFilter_DescSetUpdateAddr(XV_warp_filter *InstancePtr,
+		u32 DescNum, u64 src_buf_addr, u64 dest_buf_addr);
+void XVWarpFilter_DescSetSubmit(XV_warp_filter *InstancePtr);
 #endif
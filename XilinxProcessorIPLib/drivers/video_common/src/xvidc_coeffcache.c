@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_coeffcache.c
+ * @addtogroup video_common Overview
+ * @{
+ *
+ * Contains the cache of scaler register blocks. See xvidc_coeffcache.h for a
+ * description of the cache.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.14  fl   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include <string.h>
+#include "xil_assert.h"
+#include "xvidc_coeffcache.h"
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function initializes a cache, all the entries start empty.
+ *
+ * @param	CachePtr is a pointer to the cache.
+ * @param	Mem is the entry storage, NumEntries * EntryWords words.
+ * @param	NumEntries is the number of entries, from 1 to
+ *		XVIDC_CC_MAX_ENTRIES.
+ * @param	EntryWords is the number of words of an entry.
+ *
+ * @return
+ *		- XST_SUCCESS if the cache was initialized.
+ *		- XST_INVALID_PARAM if NumEntries or EntryWords is out of range.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_CoeffCacheInit(XVidC_CoeffCache *CachePtr, u32 *Mem,
+		u8 NumEntries, u32 EntryWords)
+{
+	u8 Idx;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(Mem != NULL);
+
+	if ((NumEntries == 0) || (NumEntries > XVIDC_CC_MAX_ENTRIES) ||
+			(EntryWords == 0)) {
+		return XST_INVALID_PARAM;
+	}
+
+	(void)memset(CachePtr, 0, sizeof(*CachePtr));
+	CachePtr->NumEntries = NumEntries;
+	CachePtr->EntryWords = EntryWords;
+	for (Idx = 0; Idx < NumEntries; Idx++) {
+		CachePtr->Entry[Idx].Data = Mem + (Idx * EntryWords);
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function invalidates all the entries of a cache.
+ *
+ * @param	CachePtr is a pointer to the cache.
+ *
+ * @return	None.
+ *
+ * @note	Call it after loading coefficients that are not derived from
+ *		the key, for example external coefficients.
+ *
+*******************************************************************************/
+void XVidC_CoeffCacheFlush(XVidC_CoeffCache *CachePtr)
+{
+	u8 Idx;
+
+	Xil_AssertVoid(CachePtr != NULL);
+
+	for (Idx = 0; Idx < CachePtr->NumEntries; Idx++) {
+		CachePtr->Entry[Idx].Valid = 0;
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function returns the entry of a configuration. When the configuration
+ * is not in the cache, the least recently used entry is given to it.
+ *
+ * @param	CachePtr is a pointer to the cache.
+ * @param	KeyPtr is the configuration.
+ * @param	HitPtr is set to 1 if the entry holds the data of the
+ *		configuration, or 0 if the caller has to fill it.
+ *
+ * @return	Pointer to the EntryWords words of the entry.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 *XVidC_CoeffCacheGet(XVidC_CoeffCache *CachePtr,
+		const XVidC_CoeffCacheKey *KeyPtr, u8 *HitPtr)
+{
+	XVidC_CoeffCacheEntry *EntryPtr;
+	XVidC_CoeffCacheEntry *VictimPtr = NULL;
+	u8 Idx;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(KeyPtr != NULL);
+	Xil_AssertNonvoid(HitPtr != NULL);
+
+	CachePtr->Clock++;
+	for (Idx = 0; Idx < CachePtr->NumEntries; Idx++) {
+		EntryPtr = &CachePtr->Entry[Idx];
+		if (EntryPtr->Valid &&
+				(EntryPtr->Key.SizeIn == KeyPtr->SizeIn) &&
+				(EntryPtr->Key.SizeOut == KeyPtr->SizeOut) &&
+				(EntryPtr->Key.NumTaps == KeyPtr->NumTaps) &&
+				(EntryPtr->Key.Flags == KeyPtr->Flags)) {
+			EntryPtr->LastUse = CachePtr->Clock;
+			CachePtr->Hits++;
+			*HitPtr = 1;
+			return EntryPtr->Data;
+		}
+
+		/* Empty entries first, then the least recently used */
+		if ((VictimPtr == NULL) || (VictimPtr->Valid &&
+				(!EntryPtr->Valid ||
+				 ((CachePtr->Clock - EntryPtr->LastUse) >
+				  (CachePtr->Clock - VictimPtr->LastUse))))) {
+			VictimPtr = EntryPtr;
+		}
+	}
+
+	VictimPtr->Key = *KeyPtr;
+	VictimPtr->LastUse = CachePtr->Clock;
+	VictimPtr->Valid = 1;
+	CachePtr->Misses++;
+	*HitPtr = 0;
+
+	return VictimPtr->Data;
+}
+/** @} */
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_coeffcache.h
+ * @addtogroup video_common Overview
+ * @{
+ * @details
+ *
+ * Least recently used cache of scaler register blocks, shared by the scaler
+ * drivers.
+ *
+ * A scaler driver computes the filter coefficients and phases of a scaling
+ * configuration, packs them in the words it writes to the core and keeps
+ * them in a cache entry keyed by the configuration. When the configuration
+ * is used again, the words are written to the core as is, without selecting
+ * the coefficients or computing the phases.
+ *
+ * The application provides the entry storage, NumEntries blocks of
+ * EntryWords words. The size of a block is given by the scaler driver, for
+ * example XV_HScalerGetCacheEntryWords(). A cache belongs to a single core.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.14  fl   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_COEFFCACHE_H_  /* Prevent circular inclusions by using protection macros. */
+#define XVIDC_COEFFCACHE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_CC_MAX_ENTRIES	8	/**< Entries per cache */
+
+/**************************** Type Definitions ********************************/
+
+/**
+ * Scaling configuration an entry was computed for.
+ */
+typedef struct {
+	u32 SizeIn;		/**< Input width or height */
+	u32 SizeOut;		/**< Output width or height */
+	u16 NumTaps;		/**< Filter taps of the core */
+	u16 Flags;		/**< Driver specific */
+} XVidC_CoeffCacheKey;
+
+/**
+ * Cache entry.
+ */
+typedef struct {
+	XVidC_CoeffCacheKey Key;	/**< Configuration of the entry */
+	u32 LastUse;			/**< Cache clock at the last use */
+	u8 Valid;			/**< Entry holds computed data */
+	u32 *Data;			/**< EntryWords words */
+} XVidC_CoeffCacheEntry;
+
+/**
+ * Cache. The user allocates a variable of this type for every scaler core
+ * and initializes it with XVidC_CoeffCacheInit().
+ */
+typedef struct {
+	XVidC_CoeffCacheEntry Entry[XVIDC_CC_MAX_ENTRIES]; /**< Entries */
+	u8 NumEntries;			/**< Entries in use */
+	u32 EntryWords;			/**< Words per entry */
+	u32 Clock;			/**< Lookups so far */
+	u32 Hits;			/**< Lookups that found their entry */
+	u32 Misses;			/**< Lookups that reused an entry */
+} XVidC_CoeffCache;
+
+/**************************** Function Prototypes *****************************/
+
+u32 XVidC_CoeffCacheInit(XVidC_CoeffCache *CachePtr, u32 *Mem,
+		u8 NumEntries, u32 EntryWords);
+void XVidC_CoeffCacheFlush(XVidC_CoeffCache *CachePtr);
+u32 *XVidC_CoeffCacheGet(XVidC_CoeffCache *CachePtr,
+		const XVidC_CoeffCacheKey *KeyPtr, u8 *HitPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_COEFFCACHE_H_ */
+/** @} */
@@ -0,0 +1,347 @@
+/*******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_frmq.c
+ * @addtogroup video_common Overview
+ * @{
+ *
+ * Contains the frame queue shared by video producers and consumers. See
+ * xvidc_frmq.h for a description of the queue.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.14  fl   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include <string.h>
+#include "xil_assert.h"
+#include "xvidc_frmq.h"
+
+/**************************** Function Prototypes *****************************/
+
+static void XVidC_FrmQPush(XVidC_FrmQRing *RingPtr, u8 Idx);
+static u8 XVidC_FrmQPop(XVidC_FrmQRing *RingPtr);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function adds a buffer to a ring. Only the producer of the ring may
+ * call it.
+ *
+ * @param	RingPtr is a pointer to the ring.
+ * @param	Idx is the buffer index.
+ *
+ * @return	None.
+ *
+ * @note	The slot is written before the release store of the head, so
+ *		a consumer that sees the new head also sees the index.
+ *
+*******************************************************************************/
+static void XVidC_FrmQPush(XVidC_FrmQRing *RingPtr, u8 Idx)
+{
+	u32 Head = RingPtr->Head;
+
+	RingPtr->Slot[Head % XVIDC_FRMQ_MAX_BUFS] = Idx;
+	__atomic_store_n(&RingPtr->Head, Head + 1, __ATOMIC_RELEASE);
+}
+
+/******************************************************************************/
+/**
+ * This function takes the oldest buffer from a ring. Any context may call it.
+ *
+ * @param	RingPtr is a pointer to the ring.
+ *
+ * @return	Buffer index, or XVIDC_FRMQ_NONE if the ring is empty.
+ *
+ * @note	The tail is free running, so a slot rewritten by the producer
+ *		while the index was read always fails the compare and swap.
+ *
+*******************************************************************************/
+static u8 XVidC_FrmQPop(XVidC_FrmQRing *RingPtr)
+{
+	u32 Tail;
+	u8 Idx;
+
+	Tail = __atomic_load_n(&RingPtr->Tail, __ATOMIC_ACQUIRE);
+	do {
+		if (Tail == __atomic_load_n(&RingPtr->Head, __ATOMIC_ACQUIRE)) {
+			return XVIDC_FRMQ_NONE;
+		}
+		Idx = RingPtr->Slot[Tail % XVIDC_FRMQ_MAX_BUFS];
+	} while (!__atomic_compare_exchange_n(&RingPtr->Tail, &Tail, Tail + 1,
+			0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+	return Idx;
+}
+
+/******************************************************************************/
+/**
+ * This function initializes a frame queue, all the buffers start free.
+ *
+ * @param	QueuePtr is a pointer to the frame queue.
+ * @param	Bufs is an array of NumBufs buffer descriptions, the addresses
+ *		are copied into the queue.
+ * @param	NumBufs is the number of buffers, from 3 + NumStages to
+ *		XVIDC_FRMQ_MAX_BUFS. The producer and the consumer each hold
+ *		up to two buffers, one more per software stage keeps them
+ *		running without drops.
+ * @param	NumStages is the number of software stages, up to
+ *		XVIDC_FRMQ_MAX_STAGES.
+ * @param	Policy selects what the producer does when no buffer is free.
+ *
+ * @return
+ *		- XST_SUCCESS if the queue was initialized.
+ *		- XST_INVALID_PARAM if NumBufs or NumStages is out of range.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_FrmQInit(XVidC_FrameQueue *QueuePtr, const XVidC_FrameBuf *Bufs,
+		u8 NumBufs, u8 NumStages, XVidC_FrmQPolicy Policy)
+{
+	u8 Idx;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(Bufs != NULL);
+
+	if ((NumStages > XVIDC_FRMQ_MAX_STAGES) ||
+			(NumBufs > XVIDC_FRMQ_MAX_BUFS) ||
+			(NumBufs < (3 + NumStages))) {
+		return XST_INVALID_PARAM;
+	}
+
+	(void)memset(QueuePtr, 0, sizeof(*QueuePtr));
+	QueuePtr->NumBufs = NumBufs;
+	QueuePtr->NumStages = NumStages;
+	QueuePtr->Policy = Policy;
+
+	for (Idx = 0; Idx < NumBufs; Idx++) {
+		QueuePtr->Buf[Idx].Addr = Bufs[Idx].Addr;
+		QueuePtr->Buf[Idx].ChromaAddr = Bufs[Idx].ChromaAddr;
+		QueuePtr->Buf[Idx].VChromaAddr = Bufs[Idx].VChromaAddr;
+		QueuePtr->Buf[Idx].LatId = XVIDC_LAT_NO_FRAME;
+		XVidC_FrmQPush(&QueuePtr->Free, Idx);
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function sets the source of the frame time stamps.
+ *
+ * @param	QueuePtr is a pointer to the frame queue.
+ * @param	GetTime is called from the producer context when a frame is
+ *		complete, or NULL to leave the time stamps at 0.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_FrmQSetTimeFunc(XVidC_FrameQueue *QueuePtr,
+		XVidC_FrmQTimeFunc GetTime)
+{
+	Xil_AssertVoid(QueuePtr != NULL);
+
+	QueuePtr->GetTime = GetTime;
+}
+
+/******************************************************************************/
+/**
+ * This function takes the oldest frame ready for a software stage.
+ *
+ * @param	QueuePtr is a pointer to the frame queue.
+ * @param	Stage is the software stage, from 1 to NumStages.
+ * @param	IdxPtr is filled with the buffer index.
+ *
+ * @return
+ *		- XST_SUCCESS if a frame was taken.
+ *		- XST_NO_DATA if no frame is ready.
+ *
+ * @note	The stage owns the buffer until it passes it on with
+ *		XVidC_FrmQPut(). Frames reach a stage in order.
+ *
+*******************************************************************************/
+u32 XVidC_FrmQGet(XVidC_FrameQueue *QueuePtr, u8 Stage, u8 *IdxPtr)
+{
+	u8 Idx;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid((Stage >= 1) && (Stage <= QueuePtr->NumStages));
+	Xil_AssertNonvoid(IdxPtr != NULL);
+
+	Idx = XVidC_FrmQPop(&QueuePtr->Ready[Stage - 1]);
+	if (Idx == XVIDC_FRMQ_NONE) {
+		return XST_NO_DATA;
+	}
+	*IdxPtr = Idx;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function passes a frame from a software stage to the next stage, or
+ * to the consumer after the last stage.
+ *
+ * @param	QueuePtr is a pointer to the frame queue.
+ * @param	Stage is the software stage, from 1 to NumStages.
+ * @param	Idx is the buffer index returned by XVidC_FrmQGet().
+ *
+ * @return	XST_SUCCESS.
+ *
+ * @note	Only one context may put frames for a given stage.
+ *
+*******************************************************************************/
+u32 XVidC_FrmQPut(XVidC_FrameQueue *QueuePtr, u8 Stage, u8 Idx)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid((Stage >= 1) && (Stage <= QueuePtr->NumStages));
+	Xil_AssertNonvoid(Idx < QueuePtr->NumBufs);
+
+	XVidC_FrmQPush(&QueuePtr->Ready[Stage], Idx);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function takes the first buffer of a producer.
+ *
+ * @param	QueuePtr is a pointer to the frame queue.
+ *
+ * @return	Buffer index, or XVIDC_FRMQ_NONE if no buffer is free.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u8 XVidC_FrmQFirstFree(XVidC_FrameQueue *QueuePtr)
+{
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	return XVidC_FrmQPop(&QueuePtr->Free);
+}
+
+/******************************************************************************/
+/**
+ * This function takes the first frame of a consumer.
+ *
+ * @param	QueuePtr is a pointer to the frame queue.
+ *
+ * @return	Buffer index, or XVIDC_FRMQ_NONE if no frame is ready yet.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u8 XVidC_FrmQFirstReady(XVidC_FrameQueue *QueuePtr)
+{
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	return XVidC_FrmQPop(&QueuePtr->Ready[QueuePtr->NumStages]);
+}
+
+/******************************************************************************/
+/**
+ * This function completes a frame of the producer and returns the buffer it
+ * writes next.
+ *
+ * @param	QueuePtr is a pointer to the frame queue.
+ * @param	Done is the buffer the producer finished, or XVIDC_FRMQ_NONE.
+ *
+ * @return	Buffer to program for the next frame, or XVIDC_FRMQ_NONE to
+ *		keep the current one.
+ *
+ * @note	Called from the producer interrupt handler. The finished frame
+ *		is time stamped and queued, unless it has to be overwritten
+ *		because no buffer is free.
+ *
+*******************************************************************************/
+u8 XVidC_FrmQProduce(XVidC_FrameQueue *QueuePtr, u8 Done)
+{
+	XVidC_FrameBuf *BufPtr;
+	u8 Next;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	Next = XVidC_FrmQPop(&QueuePtr->Free);
+	if ((Next == XVIDC_FRMQ_NONE) &&
+			(QueuePtr->Policy == XVIDC_FRMQ_DROP_OLDEST)) {
+		Next = XVidC_FrmQPop(&QueuePtr->Ready[0]);
+		if (Next != XVIDC_FRMQ_NONE) {
+			QueuePtr->Dropped++;
+		}
+	}
+
+	if (Done == XVIDC_FRMQ_NONE) {
+		return Next;
+	}
+
+	if (Next == XVIDC_FRMQ_NONE) {
+		/* Nothing to write next, write the finished frame again */
+		QueuePtr->Dropped++;
+		return Done;
+	}
+
+	BufPtr = &QueuePtr->Buf[Done];
+	BufPtr->Seq = QueuePtr->Seq++;
+	BufPtr->Timestamp = (QueuePtr->GetTime != NULL) ?
+			QueuePtr->GetTime() : 0;
+	XVidC_FrmQPush(&QueuePtr->Ready[0], Done);
+
+	return Next;
+}
+
+/******************************************************************************/
+/**
+ * This function releases a frame of the consumer and returns the buffer it
+ * reads next.
+ *
+ * @param	QueuePtr is a pointer to the frame queue.
+ * @param	Released is the buffer the consumer no longer reads, or
+ *		XVIDC_FRMQ_NONE.
+ * @param	Current is the buffer the consumer reads now.
+ *
+ * @return	Buffer to program for the next frame, Current when no new frame
+ *		is ready.
+ *
+ * @note	Called from the consumer interrupt handler.
+ *
+*******************************************************************************/
+u8 XVidC_FrmQConsume(XVidC_FrameQueue *QueuePtr, u8 Released, u8 Current)
+{
+	u8 Next;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	if ((Released != XVIDC_FRMQ_NONE) && (Released != Current)) {
+		XVidC_FrmQPush(&QueuePtr->Free, Released);
+	}
+
+	Next = XVidC_FrmQPop(&QueuePtr->Ready[QueuePtr->NumStages]);
+	if (Next == XVIDC_FRMQ_NONE) {
+		QueuePtr->Repeated++;
+		Next = Current;
+	}
+
+	return Next;
+}
+/** @} */
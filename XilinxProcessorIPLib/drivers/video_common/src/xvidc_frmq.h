@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_frmq.h
+ * @addtogroup video_common Overview
+ * @{
+ * @details
+ *
+ * Frame queue shared by a video producer and a video consumer, typically the
+ * Frame Buffer Write and Frame Buffer Read drivers.
+ *
+ * The queue owns a fixed set of frame buffers, identified by their index.
+ * A buffer moves from the free ring to the producer, through one ready ring
+ * per software stage and from the last ready ring to the consumer, which
+ * returns it to the free ring. Software stages take a buffer with
+ * XVidC_FrmQGet() and pass it on in place with XVidC_FrmQPut(), no frame is
+ * copied. Every ring is a lock free ring with a single producer, buffers may
+ * be taken from it by several consumers, so the producer may drop the oldest
+ * ready frame while a stage or the consumer takes frames from the same ring.
+ *
+ * When the producer runs out of free buffers, XVIDC_FRMQ_DROP_OLDEST takes
+ * back the oldest frame not yet consumed, XVIDC_FRMQ_REPEAT_LAST keeps every
+ * queued frame and overwrites the newest one instead. A consumer without a
+ * new frame always repeats its last frame.
+ *
+ * The queue does not maintain the caches, software stages must invalidate a
+ * buffer after XVidC_FrmQGet() and flush it before XVidC_FrmQPut().
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.14  fl   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_FRMQ_H_  /* Prevent circular inclusions by using protection macros. */
+#define XVIDC_FRMQ_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xvidc_lat.h"
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_FRMQ_MAX_BUFS	8	/**< Buffers per queue */
+#define XVIDC_FRMQ_MAX_STAGES	2	/**< Software stages per queue */
+#define XVIDC_FRMQ_NONE		0xFF	/**< No buffer */
+
+/**
+ * This typedef enumerates what the producer does when no buffer is free.
+ */
+typedef enum {
+	XVIDC_FRMQ_DROP_OLDEST = 0,	/**< Reuse the oldest ready frame */
+	XVIDC_FRMQ_REPEAT_LAST		/**< Overwrite the newest frame */
+} XVidC_FrmQPolicy;
+
+/**************************** Type Definitions ********************************/
+
+/**
+ * Time stamp source, called by the producer when a frame is complete.
+ */
+typedef u64 (*XVidC_FrmQTimeFunc)(void);
+
+/**
+ * Frame buffer of a queue. Addresses of the planes the memory format does
+ * not use are 0.
+ */
+typedef struct {
+	UINTPTR Addr;		/**< Luma or packed plane */
+	UINTPTR ChromaAddr;	/**< UV plane, or U plane for 3 planar formats */
+	UINTPTR VChromaAddr;	/**< V plane for 3 planar formats */
+	u64 Timestamp;		/**< Completion time of the frame */
+	u32 Seq;		/**< Frame sequence number */
+	u32 LatId;		/**< Frame ID of the latency tracker */
+} XVidC_FrameBuf;
+
+/**
+ * Lock free ring of buffer indexes. Head and Tail are free running, a ring
+ * never holds more than XVIDC_FRMQ_MAX_BUFS entries.
+ */
+typedef struct {
+	u32 Head;			/**< Written by the ring producer */
+	u32 Tail;			/**< Advanced with compare and swap */
+	u8 Slot[XVIDC_FRMQ_MAX_BUFS];	/**< Buffer indexes */
+} XVidC_FrmQRing;
+
+/**
+ * Frame queue. The user allocates a variable of this type for every pair of
+ * producer and consumer and initializes it with XVidC_FrmQInit().
+ */
+typedef struct {
+	XVidC_FrameBuf Buf[XVIDC_FRMQ_MAX_BUFS];	/**< Frame buffers */
+	u8 NumBufs;			/**< Buffers in use */
+	u8 NumStages;			/**< Software stages */
+	XVidC_FrmQPolicy Policy;	/**< Producer overrun policy */
+	XVidC_FrmQTimeFunc GetTime;	/**< Time stamp source, optional */
+	XVidC_FrmQRing Free;		/**< Buffers available to the producer */
+	XVidC_FrmQRing Ready[XVIDC_FRMQ_MAX_STAGES + 1]; /**< Ready[N] is
+						consumed by stage N + 1, the
+						last one by the consumer */
+	u32 Seq;			/**< Frames produced */
+	u32 Dropped;			/**< Frames dropped by the producer */
+	u32 Repeated;			/**< Frames repeated by the consumer */
+} XVidC_FrameQueue;
+
+/***************** Macros (Inline Functions) Definitions **********************/
+
+/******************************************************************************/
+/**
+ * This macro returns a buffer of a frame queue.
+ *
+ * @param	QueuePtr is a pointer to the frame queue.
+ * @param	Idx is the buffer index.
+ *
+ * @return	Pointer to the XVidC_FrameBuf.
+ *
+ * @note	C-style signature:
+ *		XVidC_FrameBuf *XVidC_FrmQGetBuf(XVidC_FrameQueue *QueuePtr,
+ *				u8 Idx)
+ *
+*******************************************************************************/
+#define XVidC_FrmQGetBuf(QueuePtr, Idx)	(&(QueuePtr)->Buf[(Idx)])
+
+/**************************** Function Prototypes *****************************/
+
+u32 XVidC_FrmQInit(XVidC_FrameQueue *QueuePtr, const XVidC_FrameBuf *Bufs,
+		u8 NumBufs, u8 NumStages, XVidC_FrmQPolicy Policy);
+void XVidC_FrmQSetTimeFunc(XVidC_FrameQueue *QueuePtr,
+		XVidC_FrmQTimeFunc GetTime);
+u32 XVidC_FrmQGet(XVidC_FrameQueue *QueuePtr, u8 Stage, u8 *IdxPtr);
+u32 XVidC_FrmQPut(XVidC_FrameQueue *QueuePtr, u8 Stage, u8 Idx);
+
+/* Used by the producer and consumer drivers */
+u8 XVidC_FrmQFirstFree(XVidC_FrameQueue *QueuePtr);
+u8 XVidC_FrmQFirstReady(XVidC_FrameQueue *QueuePtr);
+u8 XVidC_FrmQProduce(XVidC_FrameQueue *QueuePtr, u8 Done);
+u8 XVidC_FrmQConsume(XVidC_FrameQueue *QueuePtr, u8 Released, u8 Current);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_FRMQ_H_ */
+/** @} */
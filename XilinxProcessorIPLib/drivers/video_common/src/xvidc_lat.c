@@ -0,0 +1,389 @@
+/*******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_lat.c
+ * @addtogroup video_common Overview
+ * @{
+ *
+ * Contains the latency tracker shared by the drivers of a video pipeline.
+ * See xvidc_lat.h for a description of the tracker.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.14  fl   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include <string.h>
+#include "xil_assert.h"
+#include "xil_printf.h"
+#include "xvidc_lat.h"
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_LAT_DONE	0x80000000	/**< Marked bit of a counted frame */
+
+/**************************** Function Prototypes *****************************/
+
+static void XVidC_LatHistAdd(XVidC_Latency *LatPtr, u8 Idx, u64 Start,
+		u64 End);
+static void XVidC_LatComplete(XVidC_Latency *LatPtr, XVidC_LatFrame *FramePtr);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function initializes a latency tracker, disabled and with empty
+ * histograms.
+ *
+ * @param	LatPtr is a pointer to the latency tracker.
+ * @param	NumStages is the number of stages of the pipeline, 2 to
+ *		XVIDC_LAT_MAX_STAGES.
+ * @param	GetTime is the time stamp source.
+ * @param	BinWidth is the width of a histogram bin in time stamp ticks.
+ *
+ * @return
+ *		- XST_SUCCESS if the tracker was initialized.
+ *		- XST_INVALID_PARAM if NumStages or BinWidth is out of range.
+ *
+ * @note	Enable the tracker with XVidC_LatSetEnable().
+ *
+*******************************************************************************/
+u32 XVidC_LatInit(XVidC_Latency *LatPtr, u8 NumStages,
+		XVidC_LatTimeFunc GetTime, u64 BinWidth)
+{
+	Xil_AssertNonvoid(LatPtr != NULL);
+	Xil_AssertNonvoid(GetTime != NULL);
+
+	if ((NumStages < 2) || (NumStages > XVIDC_LAT_MAX_STAGES) ||
+			(BinWidth == 0)) {
+		return XST_INVALID_PARAM;
+	}
+
+	memset(LatPtr, 0, sizeof(*LatPtr));
+	LatPtr->GetTime = GetTime;
+	LatPtr->BinWidth = BinWidth;
+	LatPtr->NumStages = NumStages;
+	XVidC_LatReset(LatPtr);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function clears the frames in flight and the statistics of a latency
+ * tracker. The stages, time source and enable state are kept.
+ *
+ * @param	LatPtr is a pointer to the latency tracker.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_LatReset(XVidC_Latency *LatPtr)
+{
+	u32 Idx;
+
+	Xil_AssertVoid(LatPtr != NULL);
+
+	LatPtr->NextId = 0;
+	for (Idx = 0; Idx < XVIDC_LAT_MAX_STAGES; Idx++) {
+		LatPtr->LastId[Idx] = XVIDC_LAT_NO_FRAME;
+		memset(&LatPtr->Hist[Idx], 0, sizeof(LatPtr->Hist[Idx]));
+		LatPtr->Hist[Idx].Min = ~(u64)0;
+	}
+	for (Idx = 0; Idx < XVIDC_LAT_RING_FRAMES; Idx++) {
+		LatPtr->Ring[Idx].FrameId = XVIDC_LAT_NO_FRAME;
+		LatPtr->Ring[Idx].Marked = 0;
+	}
+	LatPtr->Incomplete = 0;
+	LatPtr->Lost = 0;
+}
+
+/******************************************************************************/
+/**
+ * This function takes the time stamp of a stage for the frame it belongs to.
+ * A stage 0 mark starts a new frame, the mark of another stage belongs to
+ * the newest frame marked by the stage before.
+ *
+ * @param	LatPtr is a pointer to the latency tracker.
+ * @param	Stage is the stage that completed a frame.
+ *
+ * @return	ID of the marked frame, XVIDC_LAT_NO_FRAME if the tracker is
+ *		disabled or the stage before has not marked a frame yet.
+ *
+ * @note	Called from the frame done or vsync interrupt of the stage.
+ *
+*******************************************************************************/
+u32 XVidC_LatMark(XVidC_Latency *LatPtr, u8 Stage)
+{
+	XVidC_LatFrame *FramePtr;
+	u32 FrameId;
+
+	Xil_AssertNonvoid(LatPtr != NULL);
+	Xil_AssertNonvoid(Stage < LatPtr->NumStages);
+
+	if (!LatPtr->Enabled) {
+		return XVIDC_LAT_NO_FRAME;
+	}
+
+	if (Stage != 0) {
+		FrameId = LatPtr->LastId[Stage - 1];
+		if (FrameId != XVIDC_LAT_NO_FRAME) {
+			XVidC_LatMarkFrame(LatPtr, Stage, FrameId);
+		}
+		return FrameId;
+	}
+
+	FrameId = LatPtr->NextId++;
+	if (LatPtr->NextId == XVIDC_LAT_NO_FRAME) {
+		LatPtr->NextId = 0;
+	}
+
+	FramePtr = &LatPtr->Ring[FrameId % XVIDC_LAT_RING_FRAMES];
+	if ((FramePtr->Marked != 0) &&
+			((FramePtr->Marked & XVIDC_LAT_DONE) == 0)) {
+		LatPtr->Incomplete++;
+	}
+	FramePtr->FrameId = FrameId;
+	FramePtr->Marked = 1;
+	FramePtr->Stamp[0] = LatPtr->GetTime();
+	LatPtr->LastId[0] = FrameId;
+
+	return FrameId;
+}
+
+/******************************************************************************/
+/**
+ * This function takes the time stamp of a stage for a given frame, used
+ * where frames are buffered between the stage before and this one.
+ *
+ * @param	LatPtr is a pointer to the latency tracker.
+ * @param	Stage is the stage that completed the frame, not 0.
+ * @param	FrameId is the frame, as returned by XVidC_LatMark() for an
+ *		earlier stage.
+ *
+ * @return	None.
+ *
+ * @note	A repeated frame keeps the time stamp of its first mark.
+ *
+*******************************************************************************/
+void XVidC_LatMarkFrame(XVidC_Latency *LatPtr, u8 Stage, u32 FrameId)
+{
+	XVidC_LatFrame *FramePtr;
+	u32 Bit;
+
+	Xil_AssertVoid(LatPtr != NULL);
+	Xil_AssertVoid((Stage > 0) && (Stage < LatPtr->NumStages));
+
+	if (!LatPtr->Enabled || (FrameId == XVIDC_LAT_NO_FRAME)) {
+		return;
+	}
+
+	FramePtr = &LatPtr->Ring[FrameId % XVIDC_LAT_RING_FRAMES];
+	if (FramePtr->FrameId != FrameId) {
+		LatPtr->Lost++;
+		return;
+	}
+
+	LatPtr->LastId[Stage] = FrameId;
+	Bit = (u32)1 << Stage;
+	if ((FramePtr->Marked & Bit) != 0) {
+		return;
+	}
+	FramePtr->Stamp[Stage] = LatPtr->GetTime();
+	FramePtr->Marked |= Bit;
+
+	if (Stage == (LatPtr->NumStages - 1)) {
+		XVidC_LatComplete(LatPtr, FramePtr);
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function marks a stage of a latency tracker, in the signature of the
+ * VTC callbacks, so that a driver without latency support can mark its
+ * stage from its frame sync or vsync callback.
+ *
+ * @param	CallbackRef is a pointer to an XVidC_LatStage.
+ * @param	Mask is the interrupt mask of the callback, not used.
+ *
+ * @return	None.
+ *
+ * @note	For example, installed with XVtc_SetCallBack() as the
+ *		XVTC_HANDLER_FRAMESYNC callback.
+ *
+*******************************************************************************/
+void XVidC_LatStageCallback(void *CallbackRef, u32 Mask)
+{
+	XVidC_LatStage *StagePtr = (XVidC_LatStage *)CallbackRef;
+
+	Xil_AssertVoid(StagePtr != NULL);
+	(void)Mask;
+
+	(void)XVidC_LatMark(StagePtr->LatPtr, StagePtr->Stage);
+}
+
+/******************************************************************************/
+/**
+ * This function returns a percentile of a latency histogram.
+ *
+ * @param	LatPtr is a pointer to the latency tracker.
+ * @param	Stage is XVIDC_LAT_TOTAL for the total latency, or the stage
+ *		for the latency from the stage before.
+ * @param	Pct is the percentile, 1 to 100.
+ *
+ * @return	Upper edge of the bin of the percentile in ticks, the longest
+ *		latency if it is in the last bin, 0 if no frame was counted.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u64 XVidC_LatPercentile(const XVidC_Latency *LatPtr, u8 Stage, u32 Pct)
+{
+	const XVidC_LatHist *HistPtr;
+	u64 Target;
+	u64 Sum = 0;
+	u32 Idx;
+
+	Xil_AssertNonvoid(LatPtr != NULL);
+	Xil_AssertNonvoid(Stage < LatPtr->NumStages);
+	Xil_AssertNonvoid((Pct > 0) && (Pct <= 100));
+
+	HistPtr = &LatPtr->Hist[Stage];
+	if (HistPtr->Count == 0) {
+		return 0;
+	}
+
+	Target = (((u64)HistPtr->Count * Pct) + 99) / 100;
+	for (Idx = 0; Idx < (XVIDC_LAT_HIST_BINS - 1); Idx++) {
+		Sum += HistPtr->Bin[Idx];
+		if (Sum >= Target) {
+			return (Idx + 1) * LatPtr->BinWidth;
+		}
+	}
+
+	return HistPtr->Max;
+}
+
+/******************************************************************************/
+/**
+ * This function prints the latency statistics of the tracker, in time stamp
+ * ticks, one line per stage and one for the total latency.
+ *
+ * @param	LatPtr is a pointer to the latency tracker.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_LatReport(const XVidC_Latency *LatPtr)
+{
+	const XVidC_LatHist *HistPtr;
+	u8 Stage;
+
+	Xil_AssertVoid(LatPtr != NULL);
+
+	xil_printf("\tStage\tFrames\tMin\tAvg\tMax\tP99\r\n");
+	for (Stage = 0; Stage < LatPtr->NumStages; Stage++) {
+		HistPtr = &LatPtr->Hist[Stage];
+		if (Stage == XVIDC_LAT_TOTAL) {
+			xil_printf("\tTotal");
+		} else {
+			xil_printf("\t%d-%d", Stage - 1, Stage);
+		}
+		if (HistPtr->Count == 0) {
+			xil_printf("\t0\r\n");
+			continue;
+		}
+		xil_printf("\t%d\t%lu\t%lu\t%lu\t%lu\r\n", HistPtr->Count,
+				(unsigned long)HistPtr->Min,
+				(unsigned long)(HistPtr->Sum / HistPtr->Count),
+				(unsigned long)HistPtr->Max,
+				(unsigned long)XVidC_LatPercentile(LatPtr,
+					Stage, 99));
+	}
+	xil_printf("\tIncomplete frames: %d, lost marks: %d\r\n",
+			LatPtr->Incomplete, LatPtr->Lost);
+}
+
+/******************************************************************************/
+/**
+ * This function adds a latency to a histogram.
+ *
+ * @param	LatPtr is a pointer to the latency tracker.
+ * @param	Idx is the histogram.
+ * @param	Start is the time stamp the latency starts at.
+ * @param	End is the time stamp the latency ends at.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_LatHistAdd(XVidC_Latency *LatPtr, u8 Idx, u64 Start,
+		u64 End)
+{
+	XVidC_LatHist *HistPtr = &LatPtr->Hist[Idx];
+	u64 Ticks = (End > Start) ? (End - Start) : 0;
+	u64 Bin = Ticks / LatPtr->BinWidth;
+
+	if (Ticks < HistPtr->Min) {
+		HistPtr->Min = Ticks;
+	}
+	if (Ticks > HistPtr->Max) {
+		HistPtr->Max = Ticks;
+	}
+	HistPtr->Sum += Ticks;
+	HistPtr->Count++;
+	HistPtr->Bin[(Bin < XVIDC_LAT_HIST_BINS) ?
+			Bin : (XVIDC_LAT_HIST_BINS - 1)]++;
+}
+
+/******************************************************************************/
+/**
+ * This function counts a frame marked by the last stage in the histograms,
+ * if every stage marked it.
+ *
+ * @param	LatPtr is a pointer to the latency tracker.
+ * @param	FramePtr is a pointer to the frame.
+ *
+ * @return	None.
+ *
+ * @note	Every stage marks a frame only once, so that it is counted
+ *		once.
+ *
+*******************************************************************************/
+static void XVidC_LatComplete(XVidC_Latency *LatPtr, XVidC_LatFrame *FramePtr)
+{
+	u32 All = ((u32)1 << LatPtr->NumStages) - 1;
+	u8 Stage;
+
+	if ((FramePtr->Marked & All) != All) {
+		return;
+	}
+
+	for (Stage = 1; Stage < LatPtr->NumStages; Stage++) {
+		XVidC_LatHistAdd(LatPtr, Stage, FramePtr->Stamp[Stage - 1],
+				FramePtr->Stamp[Stage]);
+	}
+	XVidC_LatHistAdd(LatPtr, XVIDC_LAT_TOTAL, FramePtr->Stamp[0],
+			FramePtr->Stamp[LatPtr->NumStages - 1]);
+	FramePtr->Marked |= XVIDC_LAT_DONE;
+}
+/** @} */
@@ -0,0 +1,184 @@
+/*******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_lat.h
+ * @addtogroup video_common Overview
+ * @{
+ * @details
+ *
+ * Latency tracker of a video pipeline, shared by the drivers of its stages,
+ * typically the VTC, Frame Buffer Write, Frame Buffer Read, Video Mixer and
+ * HDMI or DisplayPort TX subsystem.
+ *
+ * Every stage is given a number along the pipeline, stage 0 being the input,
+ * and its driver takes a time stamp in the frame done or vsync interrupt
+ * with XVidC_LatMark(). Stage 0 starts a new frame ID on every mark, the
+ * marks of the other stages belong to the newest frame of the stage before.
+ * Where frames are buffered, the Frame Buffer Write driver stores the frame
+ * ID in the XVidC_FrameBuf of the frame queue and the Frame Buffer Read
+ * driver marks that frame with XVidC_LatMarkFrame(), so that a delayed,
+ * dropped or repeated frame keeps its own ID.
+ *
+ * The Frame Buffer, Video Mixer, HDMI TX and DisplayPort TX drivers mark
+ * their stage once a tracker is attached with their SetLatency function.
+ * The VTC driver does not depend on this library, its stage is marked by
+ * XVidC_LatStageCallback() installed as its frame sync callback, with an
+ * XVidC_LatStage as callback reference.
+ *
+ * The time stamps of the newest XVIDC_LAT_RING_FRAMES frames are kept in a
+ * ring. When the last stage marks a frame whose every stage was marked, the
+ * time from each stage to the next one and from stage 0 to the last stage
+ * are added to histograms of XVIDC_LAT_HIST_BINS bins of BinWidth ticks,
+ * the last bin also counting every longer latency. A frame that is
+ * overwritten in the ring before it completes is counted as incomplete, a
+ * mark of a frame no longer in the ring as lost.
+ *
+ * Time stamps come from the function given to XVidC_LatInit(), in any unit,
+ * for example the ticks of XTime_GetTime(). The marks are expected from the
+ * interrupt handlers of one processor, the statistics should be read with
+ * the tracker disabled or the interrupts masked.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.14  fl   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_LAT_H_  /* Prevent circular inclusions by using protection macros. */
+#define XVIDC_LAT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_LAT_MAX_STAGES	8	/**< Stages per pipeline */
+#define XVIDC_LAT_RING_FRAMES	16	/**< Frames in flight tracked */
+#define XVIDC_LAT_HIST_BINS	32	/**< Bins per histogram */
+#define XVIDC_LAT_TOTAL		0	/**< Histogram of the total latency */
+#define XVIDC_LAT_NO_FRAME	0xFFFFFFFF /**< No frame ID */
+
+/**************************** Type Definitions ********************************/
+
+/**
+ * Time stamp source of the tracker.
+ */
+typedef u64 (*XVidC_LatTimeFunc)(void);
+
+/**
+ * Latency histogram, in time stamp ticks.
+ */
+typedef struct {
+	u64 Min;			/**< Shortest latency */
+	u64 Max;			/**< Longest latency */
+	u64 Sum;			/**< Sum of the latencies */
+	u32 Count;			/**< Frames counted */
+	u32 Bin[XVIDC_LAT_HIST_BINS];	/**< Frames per BinWidth ticks */
+} XVidC_LatHist;
+
+/**
+ * Time stamps of a frame in the ring.
+ */
+typedef struct {
+	u32 FrameId;				/**< Frame of the entry */
+	u32 Marked;				/**< Bit N set when stage N
+						  *  is marked */
+	u64 Stamp[XVIDC_LAT_MAX_STAGES];	/**< Time stamp per stage */
+} XVidC_LatFrame;
+
+/**
+ * Latency tracker. The user allocates a variable of this type for every
+ * pipeline and initializes it with XVidC_LatInit().
+ */
+typedef struct {
+	XVidC_LatTimeFunc GetTime;	/**< Time stamp source */
+	u64 BinWidth;			/**< Ticks per histogram bin */
+	u8 NumStages;			/**< Stages of the pipeline */
+	u8 Enabled;			/**< Marks are recorded when set */
+	u32 NextId;			/**< ID of the next stage 0 frame */
+	u32 LastId[XVIDC_LAT_MAX_STAGES]; /**< Newest frame per stage */
+	XVidC_LatFrame Ring[XVIDC_LAT_RING_FRAMES]; /**< Frames in flight */
+	XVidC_LatHist Hist[XVIDC_LAT_MAX_STAGES]; /**< Hist[0] is the total
+						  *  latency, Hist[N] the
+						  *  latency from stage N - 1
+						  *  to stage N */
+	u32 Incomplete;			/**< Frames that missed a stage */
+	u32 Lost;			/**< Marks of frames not tracked */
+} XVidC_Latency;
+
+/**
+ * Callback reference of XVidC_LatStageCallback().
+ */
+typedef struct {
+	XVidC_Latency *LatPtr;		/**< Latency tracker */
+	u8 Stage;			/**< Stage marked by the callback */
+} XVidC_LatStage;
+
+/***************** Macros (Inline Functions) Definitions **********************/
+
+/******************************************************************************/
+/**
+ * This macro enables or disables the recording of marks.
+ *
+ * @param	LatPtr is a pointer to the latency tracker.
+ * @param	Enable is TRUE to record marks, FALSE to ignore them.
+ *
+ * @return	None.
+ *
+ * @note	C-style signature:
+ *		void XVidC_LatSetEnable(XVidC_Latency *LatPtr, u8 Enable)
+ *
+*******************************************************************************/
+#define XVidC_LatSetEnable(LatPtr, Enable)	\
+	((LatPtr)->Enabled = (u8)(Enable))
+
+/******************************************************************************/
+/**
+ * This macro returns a latency histogram of the tracker.
+ *
+ * @param	LatPtr is a pointer to the latency tracker.
+ * @param	Stage is XVIDC_LAT_TOTAL for the total latency, or the stage
+ *		for the latency from the stage before.
+ *
+ * @return	Pointer to the XVidC_LatHist.
+ *
+ * @note	C-style signature:
+ *		const XVidC_LatHist *XVidC_LatGetHist(XVidC_Latency *LatPtr,
+ *				u8 Stage)
+ *
+*******************************************************************************/
+#define XVidC_LatGetHist(LatPtr, Stage)	\
+	((const XVidC_LatHist *)&(LatPtr)->Hist[(Stage)])
+
+/**************************** Function Prototypes *****************************/
+
+u32 XVidC_LatInit(XVidC_Latency *LatPtr, u8 NumStages,
+		XVidC_LatTimeFunc GetTime, u64 BinWidth);
+void XVidC_LatReset(XVidC_Latency *LatPtr);
+u32 XVidC_LatMark(XVidC_Latency *LatPtr, u8 Stage);
+void XVidC_LatMarkFrame(XVidC_Latency *LatPtr, u8 Stage, u32 FrameId);
+void XVidC_LatStageCallback(void *CallbackRef, u32 Mask);
+u64 XVidC_LatPercentile(const XVidC_Latency *LatPtr, u8 Stage, u32 Pct);
+void XVidC_LatReport(const XVidC_Latency *LatPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_LAT_H_ */
+/** @} */
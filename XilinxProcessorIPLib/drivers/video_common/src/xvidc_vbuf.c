@@ -0,0 +1,400 @@
+/*******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_vbuf.c
+ * @addtogroup video_common Overview
+ * @{
+ *
+ * Contains the video buffer descriptor and the buffer pool. See
+ * xvidc_vbuf.h for a description of the buffers.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.14  fl   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include <string.h>
+#include "xil_assert.h"
+#include "xil_cache.h"
+#include "xvidc_vbuf.h"
+
+/**************************** Type Definitions ********************************/
+
+/**
+ * Layout of a memory format. A line of Width pixels takes
+ * Width * BytesNum / BytesDen bytes, rounded up, in every plane.
+ */
+typedef struct {
+	u8 BytesNum;	/**< Bytes per BytesDen pixels */
+	u8 BytesDen;	/**< Pixels per BytesNum bytes */
+	u8 NumPlanes;	/**< Planes of the format */
+	u8 ChromaVSub;	/**< Vertical subsampling of the chroma planes */
+} XVidC_VBufFmt;
+
+/**************************** Variable Definitions ****************************/
+
+/* Indexed by memory format - XVIDC_CSF_MEM_START */
+static const XVidC_VBufFmt XVidC_VBufFmtTable[XVIDC_CSF_NUM_MEM] = {
+	{4, 1, 1, 1},	/* XVIDC_CSF_MEM_RGBX8 */
+	{4, 1, 1, 1},	/* XVIDC_CSF_MEM_YUVX8 */
+	{2, 1, 1, 1},	/* XVIDC_CSF_MEM_YUYV8 */
+	{4, 1, 1, 1},	/* XVIDC_CSF_MEM_RGBA8 */
+	{4, 1, 1, 1},	/* XVIDC_CSF_MEM_YUVA8 */
+	{4, 1, 1, 1},	/* XVIDC_CSF_MEM_RGBX10 */
+	{4, 1, 1, 1},	/* XVIDC_CSF_MEM_YUVX10 */
+	{2, 1, 1, 1},	/* XVIDC_CSF_MEM_RGB565 */
+	{1, 1, 2, 1},	/* XVIDC_CSF_MEM_Y_UV8 */
+	{1, 1, 2, 2},	/* XVIDC_CSF_MEM_Y_UV8_420 */
+	{3, 1, 1, 1},	/* XVIDC_CSF_MEM_RGB8 */
+	{3, 1, 1, 1},	/* XVIDC_CSF_MEM_YUV8 */
+	{4, 3, 2, 1},	/* XVIDC_CSF_MEM_Y_UV10 */
+	{4, 3, 2, 2},	/* XVIDC_CSF_MEM_Y_UV10_420 */
+	{1, 1, 1, 1},	/* XVIDC_CSF_MEM_Y8 */
+	{4, 3, 1, 1},	/* XVIDC_CSF_MEM_Y10 */
+	{4, 1, 1, 1},	/* XVIDC_CSF_MEM_BGRA8 */
+	{4, 1, 1, 1},	/* XVIDC_CSF_MEM_BGRX8 */
+	{2, 1, 1, 1},	/* XVIDC_CSF_MEM_UYVY8 */
+	{3, 1, 1, 1},	/* XVIDC_CSF_MEM_BGR8 */
+	{5, 1, 1, 1},	/* XVIDC_CSF_MEM_RGBX12 */
+	{5, 1, 1, 1},	/* XVIDC_CSF_MEM_YUVX12 */
+	{3, 2, 2, 1},	/* XVIDC_CSF_MEM_Y_UV12 */
+	{3, 2, 2, 2},	/* XVIDC_CSF_MEM_Y_UV12_420 */
+	{5, 3, 1, 1},	/* XVIDC_CSF_MEM_Y12 */
+	{6, 1, 1, 1},	/* XVIDC_CSF_MEM_RGB16 */
+	{6, 1, 1, 1},	/* XVIDC_CSF_MEM_YUV16 */
+	{2, 1, 2, 1},	/* XVIDC_CSF_MEM_Y_UV16 */
+	{2, 1, 2, 2},	/* XVIDC_CSF_MEM_Y_UV16_420 */
+	{2, 1, 1, 1},	/* XVIDC_CSF_MEM_Y16 */
+	{1, 1, 3, 1},	/* XVIDC_CSF_MEM_R_G_B8 */
+	{1, 1, 3, 2},	/* XVIDC_CSF_MEM_Y_U_V8_420 */
+	{1, 1, 3, 1},	/* XVIDC_CSF_MEM_Y_U_V8 */
+	{4, 3, 3, 1},	/* XVIDC_CSF_MEM_Y_U_V10 */
+};
+
+/************************** Function Prototypes *******************************/
+
+static u32 XVidC_VBufRoundUp(u32 Value, u32 Align);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function rounds a value up to a power of two.
+ *
+ * @param	Value is the value to round.
+ * @param	Align is the power of two.
+ *
+ * @return	Rounded value.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XVidC_VBufRoundUp(u32 Value, u32 Align)
+{
+	return (Value + Align - 1) & ~(Align - 1);
+}
+
+/******************************************************************************/
+/**
+ * This function computes the layout of a buffer. The planes are not placed
+ * in memory until XVidC_VBufSetBase() is called or the buffer is allocated
+ * from a pool.
+ *
+ * @param	BufPtr is a pointer to the buffer.
+ * @param	MemFmt is the memory format, XVIDC_CSF_MEM_*.
+ * @param	Width is the number of pixels per line.
+ * @param	Height is the number of lines.
+ * @param	Align is the alignment of the stride and of every plane in
+ *		bytes, a power of two. Use at least the AXI-MM data width of
+ *		the IPs accessing the buffer, 4096 to keep every line within
+ *		a 4 KB page.
+ *
+ * @return
+ *		- XST_SUCCESS if the layout was computed.
+ *		- XST_INVALID_PARAM if a parameter is out of range.
+ *
+ * @note	For 4:2:0 formats the chroma planes have half as many lines.
+ *
+*******************************************************************************/
+u32 XVidC_VBufInit(XVidC_VideoBuf *BufPtr, XVidC_ColorFormat MemFmt,
+		u32 Width, u32 Height, u32 Align)
+{
+	const XVidC_VBufFmt *FmtPtr;
+	u32 Stride;
+	u8 Idx;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(BufPtr != NULL);
+
+	if ((MemFmt < XVIDC_CSF_MEM_START) || (MemFmt >= XVIDC_CSF_MEM_END) ||
+			(Width == 0) || (Height == 0) || (Align == 0) ||
+			((Align & (Align - 1)) != 0)) {
+		return XST_INVALID_PARAM;
+	}
+
+	FmtPtr = &XVidC_VBufFmtTable[MemFmt - XVIDC_CSF_MEM_START];
+	Stride = ((Width * FmtPtr->BytesNum) + FmtPtr->BytesDen - 1) /
+			FmtPtr->BytesDen;
+	Stride = XVidC_VBufRoundUp(Stride, Align);
+
+	(void)memset(BufPtr, 0, sizeof(*BufPtr));
+	BufPtr->MemFmt = MemFmt;
+	BufPtr->Width = Width;
+	BufPtr->Height = Height;
+	BufPtr->NumPlanes = FmtPtr->NumPlanes;
+	BufPtr->Align = Align;
+
+	for (Idx = 0; Idx < FmtPtr->NumPlanes; Idx++) {
+		BufPtr->Plane[Idx].Stride = Stride;
+		BufPtr->Plane[Idx].Lines = (Idx == 0) ? Height :
+			(Height + FmtPtr->ChromaVSub - 1) / FmtPtr->ChromaVSub;
+		BufPtr->Size += XVidC_VBufRoundUp(Stride *
+				BufPtr->Plane[Idx].Lines, Align);
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function places the planes of a buffer one after the other.
+ *
+ * @param	BufPtr is a pointer to a buffer initialized with
+ *		XVidC_VBufInit().
+ * @param	Base is the address of the first plane, aligned to the
+ *		alignment of the buffer.
+ *
+ * @return	None.
+ *
+ * @note	Planes may also be placed apart by writing their address.
+ *
+*******************************************************************************/
+void XVidC_VBufSetBase(XVidC_VideoBuf *BufPtr, UINTPTR Base)
+{
+	u8 Idx;
+
+	Xil_AssertVoid(BufPtr != NULL);
+	Xil_AssertVoid((Base & (BufPtr->Align - 1)) == 0);
+
+	for (Idx = 0; Idx < BufPtr->NumPlanes; Idx++) {
+		BufPtr->Plane[Idx].Addr = Base;
+		Base += XVidC_VBufRoundUp(BufPtr->Plane[Idx].Stride *
+				BufPtr->Plane[Idx].Lines, BufPtr->Align);
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function makes a buffer ready for a device, it flushes the planes
+ * when the CPU wrote the buffer.
+ *
+ * @param	BufPtr is a pointer to the buffer.
+ *
+ * @return	None.
+ *
+ * @note	Also call it before a device writes the buffer, so that no
+ *		dirty line is evicted over the frame.
+ *
+*******************************************************************************/
+void XVidC_VBufForDevice(XVidC_VideoBuf *BufPtr)
+{
+	u8 Idx;
+
+	Xil_AssertVoid(BufPtr != NULL);
+
+	if (BufPtr->CacheState != XVIDC_VBUF_CPU_DIRTY) {
+		return;
+	}
+
+	for (Idx = 0; Idx < BufPtr->NumPlanes; Idx++) {
+		Xil_DCacheFlushRange(BufPtr->Plane[Idx].Addr,
+				BufPtr->Plane[Idx].Stride *
+				BufPtr->Plane[Idx].Lines);
+	}
+	BufPtr->CacheState = XVIDC_VBUF_CLEAN;
+}
+
+/******************************************************************************/
+/**
+ * This function makes a buffer ready for the CPU, it invalidates the planes
+ * when a device wrote the buffer.
+ *
+ * @param	BufPtr is a pointer to the buffer.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_VBufForCpu(XVidC_VideoBuf *BufPtr)
+{
+	u8 Idx;
+
+	Xil_AssertVoid(BufPtr != NULL);
+
+	if (BufPtr->CacheState != XVIDC_VBUF_DEV_WRITTEN) {
+		return;
+	}
+
+	for (Idx = 0; Idx < BufPtr->NumPlanes; Idx++) {
+		Xil_DCacheInvalidateRange(BufPtr->Plane[Idx].Addr,
+				BufPtr->Plane[Idx].Stride *
+				BufPtr->Plane[Idx].Lines);
+	}
+	BufPtr->CacheState = XVIDC_VBUF_CLEAN;
+}
+
+/******************************************************************************/
+/**
+ * This function initializes a pool with as many buffers of a layout as fit
+ * in a memory region, all the buffers start free.
+ *
+ * @param	PoolPtr is a pointer to the pool.
+ * @param	Layout is a buffer initialized with XVidC_VBufInit(), its
+ *		addresses are ignored.
+ * @param	Base is the start of the memory region.
+ * @param	Size is the size of the memory region in bytes.
+ *
+ * @return
+ *		- XST_SUCCESS if the pool was initialized.
+ *		- XST_BUFFER_TOO_SMALL if no buffer fits in the region.
+ *
+ * @note	The region is rounded to the alignment of the layout and at
+ *		most XVIDC_VBUF_POOL_MAX buffers are used.
+ *
+*******************************************************************************/
+u32 XVidC_VBufPoolInit(XVidC_VBufPool *PoolPtr, const XVidC_VideoBuf *Layout,
+		UINTPTR Base, u32 Size)
+{
+	UINTPTR Start;
+	u32 NumBufs;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(PoolPtr != NULL);
+	Xil_AssertNonvoid(Layout != NULL);
+	Xil_AssertNonvoid(Layout->Size != 0);
+
+	Start = (Base + Layout->Align - 1) & ~((UINTPTR)Layout->Align - 1);
+	if ((Start - Base) >= Size) {
+		return XST_BUFFER_TOO_SMALL;
+	}
+	NumBufs = (Size - (u32)(Start - Base)) / Layout->Size;
+	if (NumBufs == 0) {
+		return XST_BUFFER_TOO_SMALL;
+	}
+	if (NumBufs > XVIDC_VBUF_POOL_MAX) {
+		NumBufs = XVIDC_VBUF_POOL_MAX;
+	}
+
+	PoolPtr->Layout = *Layout;
+	PoolPtr->Layout.CacheState = XVIDC_VBUF_CLEAN;
+	PoolPtr->Base = Start;
+	PoolPtr->NumBufs = (u8)NumBufs;
+	__atomic_store_n(&PoolPtr->FreeMask, (NumBufs == 32) ? 0xFFFFFFFFU :
+			((1U << NumBufs) - 1), __ATOMIC_RELEASE);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function allocates a buffer from a pool.
+ *
+ * @param	PoolPtr is a pointer to the pool.
+ * @param	BufPtr is filled with the buffer.
+ *
+ * @return
+ *		- XST_SUCCESS if a buffer was allocated.
+ *		- XST_NO_DATA if all the buffers are in use.
+ *
+ * @note	The cache state of the buffer is XVIDC_VBUF_CLEAN, the caller
+ *		marks it when it writes the buffer.
+ *
+*******************************************************************************/
+u32 XVidC_VBufPoolAlloc(XVidC_VBufPool *PoolPtr, XVidC_VideoBuf *BufPtr)
+{
+	u32 Mask;
+	u32 Idx;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(PoolPtr != NULL);
+	Xil_AssertNonvoid(BufPtr != NULL);
+
+	Mask = __atomic_load_n(&PoolPtr->FreeMask, __ATOMIC_ACQUIRE);
+	do {
+		if (Mask == 0) {
+			return XST_NO_DATA;
+		}
+		Idx = (u32)__builtin_ctz(Mask);
+	} while (!__atomic_compare_exchange_n(&PoolPtr->FreeMask, &Mask,
+			Mask & ~(1U << Idx), 0, __ATOMIC_ACQ_REL,
+			__ATOMIC_ACQUIRE));
+
+	*BufPtr = PoolPtr->Layout;
+	XVidC_VBufSetBase(BufPtr, PoolPtr->Base +
+			((UINTPTR)Idx * PoolPtr->Layout.Size));
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function returns a buffer to its pool.
+ *
+ * @param	PoolPtr is a pointer to the pool.
+ * @param	BufPtr is a buffer allocated with XVidC_VBufPoolAlloc().
+ *
+ * @return
+ *		- XST_SUCCESS if the buffer was freed.
+ *		- XST_INVALID_PARAM if the buffer is not an allocated buffer of
+ *		  the pool.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_VBufPoolFree(XVidC_VBufPool *PoolPtr, const XVidC_VideoBuf *BufPtr)
+{
+	UINTPTR Offset;
+	u32 Idx;
+	u32 Old;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(PoolPtr != NULL);
+	Xil_AssertNonvoid(BufPtr != NULL);
+
+	if (BufPtr->Plane[0].Addr < PoolPtr->Base) {
+		return XST_INVALID_PARAM;
+	}
+	Offset = BufPtr->Plane[0].Addr - PoolPtr->Base;
+	if ((Offset % PoolPtr->Layout.Size) != 0) {
+		return XST_INVALID_PARAM;
+	}
+	Idx = (u32)(Offset / PoolPtr->Layout.Size);
+	if (Idx >= PoolPtr->NumBufs) {
+		return XST_INVALID_PARAM;
+	}
+
+	Old = __atomic_fetch_or(&PoolPtr->FreeMask, 1U << Idx,
+			__ATOMIC_ACQ_REL);
+	if ((Old & (1U << Idx)) != 0) {
+		/* Freed twice */
+		return XST_INVALID_PARAM;
+	}
+
+	return XST_SUCCESS;
+}
+/** @} */
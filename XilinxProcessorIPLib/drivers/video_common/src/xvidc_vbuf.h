@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_vbuf.h
+ * @addtogroup video_common Overview
+ * @{
+ * @details
+ *
+ * Video buffer descriptor shared by the video IP drivers that access memory,
+ * and a pool allocator for such buffers.
+ *
+ * A buffer describes up to three planes, each with its own address, so the
+ * planes of a frame do not have to be contiguous. All the planes of a buffer
+ * share the stride, as the frame buffer IPs only have one stride register.
+ * XVidC_VBufInit() computes the layout of a memory format, with the stride
+ * rounded up to the requested alignment. An alignment of 4096 bytes keeps
+ * every line on its own page, so AXI bursts never cross a 4 KB boundary.
+ *
+ * A pool carves fixed size buffers of one layout from a memory region.
+ * Buffers may be allocated and freed from any context.
+ *
+ * The buffer records who wrote it last, so the caches are only maintained
+ * when needed: XVidC_VBufForDevice() flushes a buffer the CPU wrote and
+ * XVidC_VBufForCpu() invalidates a buffer a device wrote.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.14  fl   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_VBUF_H_  /* Prevent circular inclusions by using protection macros. */
+#define XVIDC_VBUF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xvidc.h"
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_VBUF_MAX_PLANES	3	/**< Planes per buffer */
+#define XVIDC_VBUF_POOL_MAX	32	/**< Buffers per pool */
+
+/**
+ * This typedef enumerates the cache state of a buffer.
+ */
+typedef enum {
+	XVIDC_VBUF_CLEAN = 0,		/**< Memory is up to date */
+	XVIDC_VBUF_CPU_DIRTY,		/**< Written by the CPU, not flushed */
+	XVIDC_VBUF_DEV_WRITTEN		/**< Written by a device, not
+					  invalidated */
+} XVidC_VBufCacheState;
+
+/**************************** Type Definitions ********************************/
+
+/**
+ * Plane of a video buffer.
+ */
+typedef struct {
+	UINTPTR Addr;		/**< First byte of the plane */
+	u32 Stride;		/**< Bytes between two lines */
+	u32 Lines;		/**< Lines of the plane */
+} XVidC_VBufPlane;
+
+/**
+ * Video buffer. Planes the memory format does not use have an address of 0.
+ */
+typedef struct {
+	XVidC_ColorFormat MemFmt;	/**< Memory format, XVIDC_CSF_MEM_* */
+	u32 Width;			/**< Pixels per line */
+	u32 Height;			/**< Lines of the luma plane */
+	u8 NumPlanes;			/**< Planes in use */
+	XVidC_VBufPlane Plane[XVIDC_VBUF_MAX_PLANES]; /**< Planes */
+	u32 Align;			/**< Alignment of strides and planes */
+	u32 Size;			/**< Bytes of all planes, aligned */
+	XVidC_VBufCacheState CacheState; /**< Last writer of the buffer */
+} XVidC_VideoBuf;
+
+/**
+ * Pool of video buffers of one layout. The user allocates a variable of
+ * this type and initializes it with XVidC_VBufPoolInit().
+ */
+typedef struct {
+	XVidC_VideoBuf Layout;	/**< Layout of every buffer */
+	UINTPTR Base;		/**< First buffer, aligned */
+	u8 NumBufs;		/**< Buffers in the pool */
+	u32 FreeMask;		/**< Bit N set when buffer N is free */
+} XVidC_VBufPool;
+
+/***************** Macros (Inline Functions) Definitions **********************/
+
+/******************************************************************************/
+/**
+ * This macro records that the CPU wrote a buffer.
+ *
+ * @param	BufPtr is a pointer to the buffer.
+ *
+ * @return	None.
+ *
+ * @note	C-style signature:
+ *		void XVidC_VBufCpuWritten(XVidC_VideoBuf *BufPtr)
+ *
+*******************************************************************************/
+#define XVidC_VBufCpuWritten(BufPtr) \
+	((BufPtr)->CacheState = XVIDC_VBUF_CPU_DIRTY)
+
+/******************************************************************************/
+/**
+ * This macro records that a device wrote, or is going to write, a buffer.
+ *
+ * @param	BufPtr is a pointer to the buffer.
+ *
+ * @return	None.
+ *
+ * @note	C-style signature:
+ *		void XVidC_VBufDeviceWritten(XVidC_VideoBuf *BufPtr)
+ *
+*******************************************************************************/
+#define XVidC_VBufDeviceWritten(BufPtr) \
+	((BufPtr)->CacheState = XVIDC_VBUF_DEV_WRITTEN)
+
+/**************************** Function Prototypes *****************************/
+
+u32 XVidC_VBufInit(XVidC_VideoBuf *BufPtr, XVidC_ColorFormat MemFmt,
+		u32 Width, u32 Height, u32 Align);
+void XVidC_VBufSetBase(XVidC_VideoBuf *BufPtr, UINTPTR Base);
+void XVidC_VBufForDevice(XVidC_VideoBuf *BufPtr);
+void XVidC_VBufForCpu(XVidC_VideoBuf *BufPtr);
+
+u32 XVidC_VBufPoolInit(XVidC_VBufPool *PoolPtr, const XVidC_VideoBuf *Layout,
+		UINTPTR Base, u32 Size);
+u32 XVidC_VBufPoolAlloc(XVidC_VBufPool *PoolPtr, XVidC_VideoBuf *BufPtr);
+u32 XVidC_VBufPoolFree(XVidC_VBufPool *PoolPtr, const XVidC_VideoBuf *BufPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_VBUF_H_ */
+/** @} */
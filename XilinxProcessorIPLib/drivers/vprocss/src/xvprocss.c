@@ -38,6 +38,7 @@
 * 2.40  vyc  10/04/17   Added support for conversion from 420/422/444/RGB to
 *                       420/422/444/RGB with CSC-only topology
 * 2.50  vyc  04/04/18   Fix for HScaler setup with 420 input
+* 2.13  fl   10/14/26   Added XVprocSs_SetScalerCache
 *
 * </pre>
 *
@@ -2422,6 +2423,42 @@ void XVprocSs_LoadScalerCoeff(XVprocSs *InstancePtr,
   }
 }
 
+/*****************************************************************************/
+/**
+* This function sets the coefficient caches of the Scaler cores. Mode
+* changes back to a cached scaling configuration then write the cached
+* coefficients and phases instead of computing them again.
+*
+* @param  InstancePtr is a pointer to the Subsystem instance to be worked on.
+* @param  HCachePtr is the cache of the H Scaler, or NULL
+* @param  VCachePtr is the cache of the V Scaler, or NULL
+*
+* @return XST_SUCCESS if the caches were set
+*         XST_INVALID_PARAM if the entries of a cache are too small, see
+*         XV_HScalerGetCacheEntryWords() and XV_VScalerGetCacheEntryWords()
+*
+* @note   Applicable only if Scaler cores are included in the subsystem
+*
+******************************************************************************/
+int XVprocSs_SetScalerCache(XVprocSs *InstancePtr,
+                            XVidC_CoeffCache *HCachePtr,
+                            XVidC_CoeffCache *VCachePtr)
+{
+  int Status = XST_SUCCESS;
+
+  /* Verify arguments */
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if(InstancePtr->HscalerPtr) {
+    Status = XV_HScalerSetCache(InstancePtr->HscalerPtr, HCachePtr);
+  }
+  if((Status == XST_SUCCESS) && InstancePtr->VscalerPtr) {
+    Status = XV_VScalerSetCache(InstancePtr->VscalerPtr, VCachePtr);
+  }
+
+  return Status;
+}
+
 /*****************************************************************************/
 /**
 * This function enables user to load external filter coefficients for
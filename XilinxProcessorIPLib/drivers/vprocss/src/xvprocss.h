@@ -183,6 +183,7 @@
 *                       XVprocSs_SetFrameBufBaseaddr API
 * 2.30  rco  11/15/16   Make debug log optional (can be disabled via makefile)
 * 			 12/15/16   Added HasMADI configuration option
+* 2.13  fl   10/14/26   Added XVprocSs_SetScalerCache
 *
 * </pre>
 *
@@ -663,6 +664,9 @@ void XVprocSs_LoadChromaResamplerCoeff(XVprocSs *InstancePtr,
 		                               u32 CoreId,
                                        u16 num_taps,
                                        const short *Coeff);
+int XVprocSs_SetScalerCache(XVprocSs *InstancePtr,
+                            XVidC_CoeffCache *HCachePtr,
+                            XVidC_CoeffCache *VCachePtr);
 
 /* Debug functions */
 void XVprocSs_ReportSubsystemConfig(XVprocSs *InstancePtr);
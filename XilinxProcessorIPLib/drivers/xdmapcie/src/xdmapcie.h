@@ -17,6 +17,7 @@
 * The driver provides its user with entry points
 *   - To initialize and configure itself and the hardware
 *   - To access PCIe configuration space locally
+*   - To stream data between host and card with the XDMA engine
 *
 * <b>Driver Initialization & Configuration</b>
 *
@@ -43,6 +44,27 @@
 * the caller to enable/disable each individual interrupt as well as get/clear
 * pending interrupts. Implementation of callback handlers is left to the user.
 *
+* <b>Streaming Engine</b>
+*
+* On an endpoint, the streaming engine drives the H2C and C2H channels of
+* the XDMA engine from the card. Each channel has one descriptor queue,
+* implemented in xdmapcie_stream.c:
+*
+*   - XDmaPcie_StreamInitialize() finds the channels of the engine.
+*   - XDmaPcie_StreamQueueSetup() links a circular descriptor ring to a
+*   channel, and XDmaPcie_StreamQueueStart() runs the channel in credit
+*   mode.
+*   - XDmaPcie_StreamPost() pre-posts buffers. Descriptors are handed to the
+*   engine by a single credit write, the doorbell, once BatchCnt
+*   descriptors are posted or when XDmaPcie_StreamDoorbell() is called.
+*   - XDmaPcie_StreamReap() returns the number of completed descriptors.
+*
+* The descriptor rings are fetched by the engine over PCIe, so they are
+* usually in host memory, written by the card through an AXI BAR of the
+* bridge. Each queue can be mapped to its own MSI-X vector with
+* XDmaPcie_StreamSetVector(), and the last descriptor of each batch raises
+* the interrupt of the queue.
+*
 * @note
 *
 * <pre>
@@ -51,6 +73,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 1.0	tk	01/30/2019	First release
+* 1.7	fl	10/14/2026	Added the streaming engine
 * </pre>
 *
 *****************************************************************************/
@@ -91,6 +114,13 @@ extern "C" {
 #define XDMAPCIE_VSEC1		0x00 /**< First VSEC Register */
 #define XDMAPCIE_VSEC2		0x01 /**< Second VSEC Register */
 
+/*
+ * Streaming engine directions and channels.
+ */
+#define XDMAPCIE_STREAM_H2C	0x00 /**< Host to card queue */
+#define XDMAPCIE_STREAM_C2H	0x01 /**< Card to host queue */
+#define XDMAPCIE_STREAM_MAX_CHANNELS	4 /**< Channels per direction */
+
 /**************************** Type Definitions ******************************/
 
 /**
@@ -163,6 +193,67 @@ typedef struct {
 	u32 UpperAddr;		/**< Upper 32 bits of translation value */
 } XDmaPcie_BarAddr;
 
+/**
+ * XDMA engine descriptor. The hardware requires 32 byte alignment.
+ */
+typedef struct {
+	u32 Control;		/**< Magic, adjacent count and control bits */
+	u32 Length;		/**< Transfer length in bytes */
+	u32 SrcAddrLo;		/**< Source address, lower 32 bits */
+	u32 SrcAddrHi;		/**< Source address, upper 32 bits */
+	u32 DstAddrLo;		/**< Destination address, lower 32 bits */
+	u32 DstAddrHi;		/**< Destination address, upper 32 bits */
+	u32 NextLo;		/**< Next descriptor address, lower 32 bits */
+	u32 NextHi;		/**< Next descriptor address, upper 32 bits */
+} XDmaPcie_Desc;
+
+/**
+ * Result written by a C2H stream channel for each descriptor.
+ */
+typedef struct {
+	u32 Status;		/**< Magic and end of packet */
+	u32 Length;		/**< Bytes received */
+} XDmaPcie_StreamResult;
+
+/**
+ * One descriptor queue of the streaming engine.
+ */
+typedef struct {
+	UINTPTR ChanBase;	/**< Channel registers */
+	UINTPTR SgdmaBase;	/**< SGDMA registers of the channel */
+	UINTPTR CommonBase;	/**< SGDMA common registers */
+	u8 Dir;			/**< XDMAPCIE_STREAM_H2C or _C2H */
+	u8 Channel;		/**< Channel number */
+	u8 IsStream;		/**< AXI4-Stream channel */
+	u8 IsReady;		/**< Queue has been set up */
+	XDmaPcie_Desc *DescRing;	/**< Local address of the ring */
+	u64 DescBusAddr;		/**< PCIe address of the ring */
+	XDmaPcie_StreamResult *ResultRing; /**< Local address of the C2H
+					    * stream results
+					    */
+	u64 ResultBusAddr;		/**< PCIe address of the results */
+	u32 NumDesc;		/**< Ring size, a power of 2 */
+	u32 BatchCnt;		/**< Descriptors per doorbell */
+	u32 PostIdx;		/**< Descriptors posted */
+	u32 DoorbellIdx;	/**< Descriptors handed to the engine */
+	u32 DoneIdx;		/**< Descriptors completed */
+} XDmaPcie_StreamQueue;
+
+/**
+ * The streaming engine instance data.
+ */
+typedef struct {
+	UINTPTR DmaBaseAddr;	/**< Base address of the DMA registers */
+	u8 NumH2c;		/**< Number of H2C channels */
+	u8 NumC2h;		/**< Number of C2H channels */
+	XDmaPcie_StreamQueue H2c[XDMAPCIE_STREAM_MAX_CHANNELS]; /**< H2C
+								 * queues
+								 */
+	XDmaPcie_StreamQueue C2h[XDMAPCIE_STREAM_MAX_CHANNELS]; /**< C2H
+								 * queues
+								 */
+} XDmaPcie_Stream;
+
 /***************** Macros (Inline Functions) Definitions ********************/
 
 #ifndef XDmaPcie_GetRequestId
@@ -205,6 +296,25 @@ typedef struct {
 	(XDmaPcie_ReadReg((InstancePtr)->Config.BaseAddress, 	\
 	XDMAPCIE_BSC_OFFSET) & XDMAPCIE_BSC_ECAM_BUSY_MASK) ? TRUE : FALSE
 
+/****************************************************************************/
+/**
+* Get a queue of the streaming engine.
+*
+* @param	StreamPtr is the streaming engine to operate on.
+* @param	Dir is XDMAPCIE_STREAM_H2C or XDMAPCIE_STREAM_C2H.
+* @param	Channel is the channel number of the queue.
+*
+* @return	Pointer to the queue.
+*
+* @note		C-style signature:
+*		XDmaPcie_StreamQueue *XDmaPcie_StreamGetQueue(
+*			XDmaPcie_Stream *StreamPtr, u8 Dir, u8 Channel)
+*
+*****************************************************************************/
+#define XDmaPcie_StreamGetQueue(StreamPtr, Dir, Channel)	\
+	(((Dir) == XDMAPCIE_STREAM_H2C) ? &(StreamPtr)->H2c[(Channel)] : \
+	&(StreamPtr)->C2h[(Channel)])
+
 /************************** Function Prototypes *****************************/
 
 /*
@@ -279,6 +389,34 @@ void XDmaPcie_DisableInterrupts(XDmaPcie *InstancePtr, u32 DisableMask);
 void XDmaPcie_GetEnabledInterrupts(XDmaPcie *InstancePtr, u32 *EnabledMaskPtr);
 void XDmaPcie_GetPendingInterrupts(XDmaPcie *InstancePtr, u32 *PendingMaskPtr);
 void XDmaPcie_ClearPendingInterrupts(XDmaPcie *InstancePtr, u32 ClearMask);
+void XDmaPcie_StreamSetVector(XDmaPcie_Stream *StreamPtr, u8 Dir, u8 Channel,
+								u8 Vector);
+void XDmaPcie_StreamEnableIntr(XDmaPcie_Stream *StreamPtr, u8 Dir,
+								u8 Channel);
+void XDmaPcie_StreamDisableIntr(XDmaPcie_Stream *StreamPtr, u8 Dir,
+								u8 Channel);
+u32 XDmaPcie_StreamGetPendingIntr(XDmaPcie_Stream *StreamPtr);
+
+/*
+ * Streaming Engine Functions.
+ * This API is implemented in xdmapcie_stream.c
+ */
+int XDmaPcie_StreamInitialize(XDmaPcie_Stream *StreamPtr,
+							UINTPTR DmaBaseAddr);
+int XDmaPcie_StreamQueueSetup(XDmaPcie_Stream *StreamPtr, u8 Dir,
+		u8 Channel, XDmaPcie_Desc *DescRing, u64 DescBusAddr,
+		u32 NumDesc, u32 BatchCnt);
+int XDmaPcie_StreamSetResultRing(XDmaPcie_StreamQueue *QueuePtr,
+		XDmaPcie_StreamResult *ResultRing, u64 ResultBusAddr);
+int XDmaPcie_StreamQueueStart(XDmaPcie_StreamQueue *QueuePtr);
+int XDmaPcie_StreamQueueStop(XDmaPcie_StreamQueue *QueuePtr);
+int XDmaPcie_StreamPost(XDmaPcie_StreamQueue *QueuePtr, u64 SrcAddr,
+					u64 DstAddr, u32 Length, u8 Eop);
+void XDmaPcie_StreamDoorbell(XDmaPcie_StreamQueue *QueuePtr);
+u32 XDmaPcie_StreamReap(XDmaPcie_StreamQueue *QueuePtr);
+int XDmaPcie_StreamGetResult(XDmaPcie_StreamQueue *QueuePtr, u32 Index,
+						u32 *LengthPtr, u8 *EopPtr);
+u32 XDmaPcie_StreamGetStatus(XDmaPcie_StreamQueue *QueuePtr);
 
 /*
  * Capabilites Functions.
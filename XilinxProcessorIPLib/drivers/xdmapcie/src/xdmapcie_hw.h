@@ -20,6 +20,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 1.0	tk	01/30/2019	First release
+* 1.7	fl	10/14/2026	Added XDMA engine register definitions for the
+*				streaming engine
 * </pre>
 *
 ******************************************************************************/
@@ -665,6 +667,112 @@ extern "C" {
 #define XDMAPCIE_ECAM_BYT_SHIFT		0   /**< Byte Offset Shift Value */
 /*@}*/
 
+/** @name XDMA engine registers
+ *
+ * Register offsets of the XDMA engine, from the base address of the DMA
+ * registers as seen on the AXI4-Lite slave interface.
+ * @{
+ */
+#define XDMAPCIE_DMA_H2C_CHAN_OFFSET	0x0000 /**< H2C channel registers */
+#define XDMAPCIE_DMA_C2H_CHAN_OFFSET	0x1000 /**< C2H channel registers */
+#define XDMAPCIE_DMA_IRQ_OFFSET		0x2000 /**< IRQ block registers */
+#define XDMAPCIE_DMA_H2C_SGDMA_OFFSET	0x4000 /**< H2C SGDMA registers */
+#define XDMAPCIE_DMA_C2H_SGDMA_OFFSET	0x5000 /**< C2H SGDMA registers */
+#define XDMAPCIE_DMA_SGDMA_COMMON_OFFSET 0x6000 /**< SGDMA common registers */
+#define XDMAPCIE_DMA_CHAN_STRIDE	0x100  /**< Distance between the
+						 * registers of two channels
+						 */
+
+#define XDMAPCIE_DMA_CHAN_ID_OFFSET	0x00 /**< Channel identifier */
+#define XDMAPCIE_DMA_CHAN_CTRL_OFFSET	0x04 /**< Channel control */
+#define XDMAPCIE_DMA_CHAN_CTRL_W1S_OFFSET 0x08 /**< Channel control W1S */
+#define XDMAPCIE_DMA_CHAN_CTRL_W1C_OFFSET 0x0C /**< Channel control W1C */
+#define XDMAPCIE_DMA_CHAN_STATUS_OFFSET	0x40 /**< Channel status */
+#define XDMAPCIE_DMA_CHAN_STATUS_RC_OFFSET 0x44 /**< Channel status, clear
+						  * on read
+						  */
+#define XDMAPCIE_DMA_CHAN_CMPL_CNT_OFFSET 0x48 /**< Completed descriptor
+						 * count
+						 */
+
+#define XDMAPCIE_DMA_SGDMA_DESC_LO_OFFSET 0x80 /**< First descriptor
+						 * address, lower 32 bits
+						 */
+#define XDMAPCIE_DMA_SGDMA_DESC_HI_OFFSET 0x84 /**< First descriptor
+						 * address, upper 32 bits
+						 */
+#define XDMAPCIE_DMA_SGDMA_DESC_ADJ_OFFSET 0x88 /**< Adjacent descriptors
+						  * of the first one
+						  */
+#define XDMAPCIE_DMA_SGDMA_CREDIT_OFFSET 0x8C /**< Descriptor credits */
+
+#define XDMAPCIE_DMA_CREDIT_EN_W1S_OFFSET 0x24 /**< Credit mode enable W1S,
+						 * SGDMA common
+						 */
+#define XDMAPCIE_DMA_CREDIT_EN_W1C_OFFSET 0x28 /**< Credit mode enable W1C,
+						 * SGDMA common
+						 */
+
+#define XDMAPCIE_DMA_IRQ_CHAN_EN_W1S_OFFSET 0x14 /**< Channel interrupt
+						   * enable mask W1S
+						   */
+#define XDMAPCIE_DMA_IRQ_CHAN_EN_W1C_OFFSET 0x18 /**< Channel interrupt
+						   * enable mask W1C
+						   */
+#define XDMAPCIE_DMA_IRQ_CHAN_PEND_OFFSET 0x4C /**< Channel interrupt
+						 * pending
+						 */
+#define XDMAPCIE_DMA_IRQ_H2C_VEC_OFFSET	0xA0 /**< H2C channel vectors */
+#define XDMAPCIE_DMA_IRQ_C2H_VEC_OFFSET	0xA4 /**< C2H channel vectors */
+/*@}*/
+
+/** @name XDMA engine register bitmaps and masks
+ *
+ * @{
+ */
+#define XDMAPCIE_DMA_ID_MASK		0xFFF00000 /**< Subsystem identifier */
+#define XDMAPCIE_DMA_ID_VALUE		0x1FC00000 /**< XDMA identifier */
+#define XDMAPCIE_DMA_ID_TARGET_MASK	0x000F0000 /**< Target of the block */
+#define XDMAPCIE_DMA_ID_TARGET_SHIFT	16	   /**< Target shift */
+#define XDMAPCIE_DMA_ID_STREAM_MASK	0x00008000 /**< AXI4-Stream channel */
+
+#define XDMAPCIE_DMA_CTRL_RUN_MASK	0x00000001 /**< Run the channel */
+#define XDMAPCIE_DMA_CTRL_IE_MASK	0x00F83E7E /**< Descriptor stopped,
+						    * completed, error and
+						    * idle interrupt enables
+						    */
+
+#define XDMAPCIE_DMA_STS_BUSY_MASK	0x00000001 /**< Channel is busy */
+#define XDMAPCIE_DMA_STS_ERR_MASK	0x00FFFE38 /**< Alignment, magic,
+						    * length, read, write and
+						    * descriptor errors
+						    */
+
+#define XDMAPCIE_DMA_CREDIT_MAX		0x3FF	   /**< Largest credit write */
+#define XDMAPCIE_DMA_CREDIT_C2H_SHIFT	16	   /**< C2H credit enables */
+
+#define XDMAPCIE_DMA_IRQ_VEC_MASK	0x1F	   /**< Vector of a channel */
+#define XDMAPCIE_DMA_IRQ_VEC_SHIFT	8	   /**< Distance between the
+						    * vectors of two channels
+						    */
+
+#define XDMAPCIE_DMA_DESC_MAGIC		0xAD4B0000 /**< Descriptor magic */
+#define XDMAPCIE_DMA_DESC_STOP_MASK	0x00000001 /**< Stop after this one */
+#define XDMAPCIE_DMA_DESC_CMPL_MASK	0x00000002 /**< Interrupt on
+						    * completion
+						    */
+#define XDMAPCIE_DMA_DESC_EOP_MASK	0x00000010 /**< End of packet */
+#define XDMAPCIE_DMA_DESC_LEN_MASK	0x0FFFFFFF /**< Transfer length */
+
+#define XDMAPCIE_DMA_RESULT_MAGIC_MASK	0xFFFF0000 /**< C2H stream result
+						    * magic mask
+						    */
+#define XDMAPCIE_DMA_RESULT_MAGIC	0x52B40000 /**< C2H stream result
+						    * magic
+						    */
+#define XDMAPCIE_DMA_RESULT_EOP_MASK	0x00000001 /**< End of packet */
+/*@}*/
+
 /* Offset used for getting the VSEC register contents */
 #define XDMAPCIE_VSEC2_OFFSET_WRT_VSEC1 	0xD8
 
@@ -17,6 +17,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 1.0	tk	01/30/2019	First release
+* 1.7	fl	10/14/2026	Added MSI-X vector and interrupt control of the
+*				streaming engine queues
 * </pre>
 *
 ******************************************************************************/
@@ -34,6 +36,9 @@
 
 /*************************** Function Prototypes *****************************/
 
+static u32 XDmaPcie_StreamIntrBit(XDmaPcie_Stream *StreamPtr, u8 Dir,
+								u8 Channel);
+
 /*****************************************************************************/
 /**
 * Enable the Global Interrupt.
@@ -225,3 +230,132 @@ void XDmaPcie_ClearPendingInterrupts(XDmaPcie *InstancePtr, u32 ClearMask)
 			XDmaPcie_ReadReg((InstancePtr->Config.BaseAddress),
 				XDMAPCIE_ID_OFFSET) & (ClearMask));
 }
+
+/*****************************************************************************/
+/**
+* Map the interrupt of a streaming engine queue to an MSI-X vector, so that
+* the host is notified of each queue on its own vector.
+*
+* @param 	StreamPtr is the streaming engine to operate on.
+* @param 	Dir is XDMAPCIE_STREAM_H2C or XDMAPCIE_STREAM_C2H.
+* @param 	Channel is the channel number of the queue.
+* @param 	Vector is the MSI-X vector, 0 to 31.
+*
+* @return 	None.
+*
+* @note 	None.
+*
+******************************************************************************/
+void XDmaPcie_StreamSetVector(XDmaPcie_Stream *StreamPtr, u8 Dir, u8 Channel,
+								u8 Vector)
+{
+	u32 Offset;
+	u32 Shift;
+	u32 Data;
+
+	Xil_AssertVoid(StreamPtr != NULL);
+	Xil_AssertVoid(Channel < XDMAPCIE_STREAM_MAX_CHANNELS);
+	Xil_AssertVoid(Vector <= XDMAPCIE_DMA_IRQ_VEC_MASK);
+
+	Offset = (Dir == XDMAPCIE_STREAM_H2C) ?
+			XDMAPCIE_DMA_IRQ_H2C_VEC_OFFSET :
+			XDMAPCIE_DMA_IRQ_C2H_VEC_OFFSET;
+	Shift = (u32)Channel * XDMAPCIE_DMA_IRQ_VEC_SHIFT;
+
+	Data = XDmaPcie_ReadReg(StreamPtr->DmaBaseAddr,
+			XDMAPCIE_DMA_IRQ_OFFSET + Offset);
+	Data &= ~((u32)XDMAPCIE_DMA_IRQ_VEC_MASK << Shift);
+	Data |= (u32)Vector << Shift;
+	XDmaPcie_WriteReg(StreamPtr->DmaBaseAddr,
+			XDMAPCIE_DMA_IRQ_OFFSET + Offset, Data);
+}
+
+/*****************************************************************************/
+/**
+* Enable the interrupt of a streaming engine queue in the IRQ block.
+*
+* @param 	StreamPtr is the streaming engine to operate on.
+* @param 	Dir is XDMAPCIE_STREAM_H2C or XDMAPCIE_STREAM_C2H.
+* @param 	Channel is the channel number of the queue.
+*
+* @return 	None.
+*
+* @note 	None.
+*
+******************************************************************************/
+void XDmaPcie_StreamEnableIntr(XDmaPcie_Stream *StreamPtr, u8 Dir,
+								u8 Channel)
+{
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	XDmaPcie_WriteReg(StreamPtr->DmaBaseAddr, XDMAPCIE_DMA_IRQ_OFFSET +
+			XDMAPCIE_DMA_IRQ_CHAN_EN_W1S_OFFSET,
+			XDmaPcie_StreamIntrBit(StreamPtr, Dir, Channel));
+}
+
+/*****************************************************************************/
+/**
+* Disable the interrupt of a streaming engine queue in the IRQ block.
+*
+* @param 	StreamPtr is the streaming engine to operate on.
+* @param 	Dir is XDMAPCIE_STREAM_H2C or XDMAPCIE_STREAM_C2H.
+* @param 	Channel is the channel number of the queue.
+*
+* @return 	None.
+*
+* @note 	None.
+*
+******************************************************************************/
+void XDmaPcie_StreamDisableIntr(XDmaPcie_Stream *StreamPtr, u8 Dir,
+								u8 Channel)
+{
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	XDmaPcie_WriteReg(StreamPtr->DmaBaseAddr, XDMAPCIE_DMA_IRQ_OFFSET +
+			XDMAPCIE_DMA_IRQ_CHAN_EN_W1C_OFFSET,
+			XDmaPcie_StreamIntrBit(StreamPtr, Dir, Channel));
+}
+
+/*****************************************************************************/
+/**
+* Get the pending channel interrupts of the streaming engine.
+*
+* @param 	StreamPtr is the streaming engine to operate on.
+*
+* @return 	The pending channel interrupts, H2C channels from bit 0
+*		followed by the C2H channels.
+*
+* @note 	None.
+*
+******************************************************************************/
+u32 XDmaPcie_StreamGetPendingIntr(XDmaPcie_Stream *StreamPtr)
+{
+	Xil_AssertNonvoid(StreamPtr != NULL);
+
+	return XDmaPcie_ReadReg(StreamPtr->DmaBaseAddr,
+			XDMAPCIE_DMA_IRQ_OFFSET +
+			XDMAPCIE_DMA_IRQ_CHAN_PEND_OFFSET);
+}
+
+/*****************************************************************************/
+/**
+* Get the IRQ block bit of a streaming engine queue.
+*
+* @param 	StreamPtr is the streaming engine to operate on.
+* @param 	Dir is XDMAPCIE_STREAM_H2C or XDMAPCIE_STREAM_C2H.
+* @param 	Channel is the channel number of the queue.
+*
+* @return 	The bit of the queue in the channel interrupt registers.
+*
+* @note 	None.
+*
+******************************************************************************/
+static u32 XDmaPcie_StreamIntrBit(XDmaPcie_Stream *StreamPtr, u8 Dir,
+								u8 Channel)
+{
+	if (Dir == XDMAPCIE_STREAM_H2C) {
+		return (u32)1U << Channel;
+	}
+
+	return (u32)1U << (StreamPtr->NumH2c + Channel);
+}
@@ -0,0 +1,577 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+* @file xdmapcie_stream.c
+*
+* This file implements the streaming engine of the XDmaPcie driver. It drives
+* the H2C and C2H channels of the XDMA engine from the endpoint.
+*
+* Each queue is a circular ring of descriptors, which is run in credit mode:
+* the engine fetches a descriptor only if the queue has a credit for it, so
+* the ring never needs a stop descriptor and buffers can be pre-posted while
+* the channel runs. Posting only writes descriptors; the credits for all the
+* descriptors posted since the last doorbell are given in one register
+* write, so the engine sees a whole batch at once.
+*
+* Completion is tracked with the completed descriptor count of the channel,
+* without reading back the descriptors.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------
+* 1.7	fl	10/14/2026	First release
+* </pre>
+*
+******************************************************************************/
+
+/****************************** Include Files ********************************/
+#include "xdmapcie.h"
+
+/*************************** Constant Definitions ****************************/
+
+#define XDMAPCIE_STREAM_TARGET_H2C	0x0 /**< Identifier target of H2C */
+#define XDMAPCIE_STREAM_TARGET_C2H	0x1 /**< Identifier target of C2H */
+
+#define XDMAPCIE_STREAM_STOP_TIMEOUT	1000000U /**< Polls for the channel
+						  * to go idle
+						  */
+
+/***************************** Type Definitions ******************************/
+
+/****************** Macros (Inline Functions) Definitions ********************/
+
+/*************************** Variable Definitions ****************************/
+
+/*************************** Function Prototypes *****************************/
+
+static u8 XDmaPcie_StreamProbe(UINTPTR ChanBase, u32 Target);
+
+/*****************************************************************************/
+/**
+* Initialize the streaming engine and find the channels of the XDMA engine.
+*
+* @param 	StreamPtr is the streaming engine to initialize.
+* @param 	DmaBaseAddr is the base address of the DMA registers on the
+*		AXI4-Lite slave interface of the XDMA IP.
+*
+* @return
+*		- XST_SUCCESS if at least one channel is found
+*		- XST_DEVICE_NOT_FOUND if the engine has no channel
+*
+* @note 	None
+*
+******************************************************************************/
+int XDmaPcie_StreamInitialize(XDmaPcie_Stream *StreamPtr, UINTPTR DmaBaseAddr)
+{
+	u8 Channel;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+
+	memset(StreamPtr, 0, sizeof(XDmaPcie_Stream));
+	StreamPtr->DmaBaseAddr = DmaBaseAddr;
+
+	/* Channels are numbered from 0 without holes */
+	for (Channel = 0; Channel < XDMAPCIE_STREAM_MAX_CHANNELS; Channel++) {
+		if (XDmaPcie_StreamProbe(DmaBaseAddr +
+				XDMAPCIE_DMA_H2C_CHAN_OFFSET +
+				Channel * XDMAPCIE_DMA_CHAN_STRIDE,
+				XDMAPCIE_STREAM_TARGET_H2C) == FALSE) {
+			break;
+		}
+		StreamPtr->NumH2c++;
+	}
+
+	for (Channel = 0; Channel < XDMAPCIE_STREAM_MAX_CHANNELS; Channel++) {
+		if (XDmaPcie_StreamProbe(DmaBaseAddr +
+				XDMAPCIE_DMA_C2H_CHAN_OFFSET +
+				Channel * XDMAPCIE_DMA_CHAN_STRIDE,
+				XDMAPCIE_STREAM_TARGET_C2H) == FALSE) {
+			break;
+		}
+		StreamPtr->NumC2h++;
+	}
+
+	if ((StreamPtr->NumH2c == 0) && (StreamPtr->NumC2h == 0)) {
+		return XST_DEVICE_NOT_FOUND;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Link a circular descriptor ring to a channel. The channel must be stopped.
+*
+* @param 	StreamPtr is the streaming engine to operate on.
+* @param 	Dir is XDMAPCIE_STREAM_H2C or XDMAPCIE_STREAM_C2H.
+* @param 	Channel is the channel number.
+* @param 	DescRing is the local address of the ring, 32 byte aligned.
+* @param 	DescBusAddr is the PCIe address of the ring, as fetched by
+*		the engine.
+* @param 	NumDesc is the number of descriptors of the ring, a power of 2.
+* @param 	BatchCnt is the number of posted descriptors that rings the
+*		doorbell, 1 to NumDesc.
+*
+* @return
+*		- XST_SUCCESS if successful
+*		- XST_INVALID_PARAM if the channel does not exist or a ring
+*		parameter is out of range
+*
+* @note 	None
+*
+******************************************************************************/
+int XDmaPcie_StreamQueueSetup(XDmaPcie_Stream *StreamPtr, u8 Dir,
+		u8 Channel, XDmaPcie_Desc *DescRing, u64 DescBusAddr,
+		u32 NumDesc, u32 BatchCnt)
+{
+	XDmaPcie_StreamQueue *QueuePtr;
+	u64 NextAddr;
+	u32 Index;
+	u32 Id;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(DescRing != NULL);
+
+	if (((Dir == XDMAPCIE_STREAM_H2C) && (Channel >= StreamPtr->NumH2c)) ||
+	    ((Dir == XDMAPCIE_STREAM_C2H) && (Channel >= StreamPtr->NumC2h)) ||
+	    (Dir > XDMAPCIE_STREAM_C2H)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((NumDesc < 2U) || ((NumDesc & (NumDesc - 1U)) != 0U) ||
+	    (BatchCnt == 0U) || (BatchCnt > NumDesc) ||
+	    ((DescBusAddr & (sizeof(XDmaPcie_Desc) - 1U)) != 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	QueuePtr = XDmaPcie_StreamGetQueue(StreamPtr, Dir, Channel);
+	memset(QueuePtr, 0, sizeof(XDmaPcie_StreamQueue));
+
+	QueuePtr->Dir = Dir;
+	QueuePtr->Channel = Channel;
+	QueuePtr->CommonBase = StreamPtr->DmaBaseAddr +
+				XDMAPCIE_DMA_SGDMA_COMMON_OFFSET;
+	if (Dir == XDMAPCIE_STREAM_H2C) {
+		QueuePtr->ChanBase = StreamPtr->DmaBaseAddr +
+				XDMAPCIE_DMA_H2C_CHAN_OFFSET;
+		QueuePtr->SgdmaBase = StreamPtr->DmaBaseAddr +
+				XDMAPCIE_DMA_H2C_SGDMA_OFFSET;
+	} else {
+		QueuePtr->ChanBase = StreamPtr->DmaBaseAddr +
+				XDMAPCIE_DMA_C2H_CHAN_OFFSET;
+		QueuePtr->SgdmaBase = StreamPtr->DmaBaseAddr +
+				XDMAPCIE_DMA_C2H_SGDMA_OFFSET;
+	}
+	QueuePtr->ChanBase += Channel * XDMAPCIE_DMA_CHAN_STRIDE;
+	QueuePtr->SgdmaBase += Channel * XDMAPCIE_DMA_CHAN_STRIDE;
+
+	Id = XDmaPcie_ReadReg(QueuePtr->ChanBase, XDMAPCIE_DMA_CHAN_ID_OFFSET);
+	QueuePtr->IsStream = ((Id & XDMAPCIE_DMA_ID_STREAM_MASK) != 0U) ?
+				TRUE : FALSE;
+
+	QueuePtr->DescRing = DescRing;
+	QueuePtr->DescBusAddr = DescBusAddr;
+	QueuePtr->NumDesc = NumDesc;
+	QueuePtr->BatchCnt = BatchCnt;
+
+	/* Close the ring, the credits stop the engine */
+	for (Index = 0U; Index < NumDesc; Index++) {
+		NextAddr = DescBusAddr + (u64)((Index + 1U) & (NumDesc - 1U)) *
+				sizeof(XDmaPcie_Desc);
+
+		DescRing[Index].Control = XDMAPCIE_DMA_DESC_MAGIC;
+		DescRing[Index].Length = 0U;
+		DescRing[Index].NextLo = LOWER_32_BITS(NextAddr);
+		DescRing[Index].NextHi = UPPER_32_BITS(NextAddr);
+	}
+
+	QueuePtr->IsReady = TRUE;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Give a C2H stream queue the ring where the engine writes the result of each
+* descriptor. The ring has one entry per descriptor.
+*
+* @param 	QueuePtr is the queue to operate on.
+* @param 	ResultRing is the local address of the result ring.
+* @param 	ResultBusAddr is the PCIe address of the result ring.
+*
+* @return
+*		- XST_SUCCESS if successful
+*		- XST_INVALID_PARAM if the queue is not a C2H stream queue
+*
+* @note 	This must be called before XDmaPcie_StreamQueueStart().
+*
+******************************************************************************/
+int XDmaPcie_StreamSetResultRing(XDmaPcie_StreamQueue *QueuePtr,
+		XDmaPcie_StreamResult *ResultRing, u64 ResultBusAddr)
+{
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->IsReady == TRUE);
+
+	if ((QueuePtr->Dir != XDMAPCIE_STREAM_C2H) ||
+	    (QueuePtr->IsStream == FALSE)) {
+		return XST_INVALID_PARAM;
+	}
+
+	QueuePtr->ResultRing = ResultRing;
+	QueuePtr->ResultBusAddr = ResultBusAddr;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Start the channel of a queue in credit mode. No descriptor is fetched until
+* the first doorbell.
+*
+* @param 	QueuePtr is the queue to operate on.
+*
+* @return
+*		- XST_SUCCESS if successful
+*		- XST_DEVICE_BUSY if the channel is running
+*		- XST_FAILURE if a C2H stream queue has no result ring
+*
+* @note 	The completed descriptor count of the channel restarts from 0.
+*
+******************************************************************************/
+int XDmaPcie_StreamQueueStart(XDmaPcie_StreamQueue *QueuePtr)
+{
+	u32 CreditBit;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->IsReady == TRUE);
+
+	if ((XDmaPcie_ReadReg(QueuePtr->ChanBase,
+			XDMAPCIE_DMA_CHAN_CTRL_OFFSET) &
+			XDMAPCIE_DMA_CTRL_RUN_MASK) != 0U) {
+		return XST_DEVICE_BUSY;
+	}
+
+	if ((QueuePtr->Dir == XDMAPCIE_STREAM_C2H) &&
+	    (QueuePtr->IsStream == TRUE) && (QueuePtr->ResultRing == NULL)) {
+		return XST_FAILURE;
+	}
+
+	QueuePtr->PostIdx = 0U;
+	QueuePtr->DoorbellIdx = 0U;
+	QueuePtr->DoneIdx = 0U;
+
+	XDmaPcie_WriteReg(QueuePtr->SgdmaBase,
+			XDMAPCIE_DMA_SGDMA_DESC_LO_OFFSET,
+			LOWER_32_BITS(QueuePtr->DescBusAddr));
+	XDmaPcie_WriteReg(QueuePtr->SgdmaBase,
+			XDMAPCIE_DMA_SGDMA_DESC_HI_OFFSET,
+			UPPER_32_BITS(QueuePtr->DescBusAddr));
+	XDmaPcie_WriteReg(QueuePtr->SgdmaBase,
+			XDMAPCIE_DMA_SGDMA_DESC_ADJ_OFFSET, 0U);
+
+	CreditBit = (u32)1U << QueuePtr->Channel;
+	if (QueuePtr->Dir == XDMAPCIE_STREAM_C2H) {
+		CreditBit <<= XDMAPCIE_DMA_CREDIT_C2H_SHIFT;
+	}
+	XDmaPcie_WriteReg(QueuePtr->CommonBase,
+			XDMAPCIE_DMA_CREDIT_EN_W1S_OFFSET, CreditBit);
+
+	/* Clear the latched status of the previous run */
+	(void)XDmaPcie_ReadReg(QueuePtr->ChanBase,
+			XDMAPCIE_DMA_CHAN_STATUS_RC_OFFSET);
+
+	XDmaPcie_WriteReg(QueuePtr->ChanBase, XDMAPCIE_DMA_CHAN_CTRL_W1S_OFFSET,
+			XDMAPCIE_DMA_CTRL_RUN_MASK | XDMAPCIE_DMA_CTRL_IE_MASK);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Stop the channel of a queue and wait for it to go idle. The descriptors
+* that were not completed are dropped.
+*
+* @param 	QueuePtr is the queue to operate on.
+*
+* @return
+*		- XST_SUCCESS if the channel is stopped
+*		- XST_FAILURE if the channel did not go idle
+*
+* @note 	None
+*
+******************************************************************************/
+int XDmaPcie_StreamQueueStop(XDmaPcie_StreamQueue *QueuePtr)
+{
+	u32 TimeOut = XDMAPCIE_STREAM_STOP_TIMEOUT;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->IsReady == TRUE);
+
+	XDmaPcie_WriteReg(QueuePtr->ChanBase, XDMAPCIE_DMA_CHAN_CTRL_W1C_OFFSET,
+			XDMAPCIE_DMA_CTRL_RUN_MASK | XDMAPCIE_DMA_CTRL_IE_MASK);
+
+	while ((XDmaPcie_ReadReg(QueuePtr->ChanBase,
+			XDMAPCIE_DMA_CHAN_STATUS_OFFSET) &
+			XDMAPCIE_DMA_STS_BUSY_MASK) != 0U) {
+		if (TimeOut == 0U) {
+			return XST_FAILURE;
+		}
+		TimeOut--;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Post one buffer to a queue. The doorbell is rung when BatchCnt descriptors
+* have been posted since the previous one.
+*
+* @param 	QueuePtr is the queue to operate on.
+* @param 	SrcAddr is the source address: the PCIe address of the host
+*		buffer for H2C, the AXI address of the card buffer for C2H
+*		memory mapped. It is ignored for C2H stream.
+* @param 	DstAddr is the destination address: the AXI address of the card
+*		buffer for H2C memory mapped, the PCIe address of the host
+*		buffer for C2H. It is ignored for H2C stream.
+* @param 	Length is the length of the buffer in bytes.
+* @param 	Eop is TRUE to end an H2C stream packet with this buffer.
+*
+* @return
+*		- XST_SUCCESS if the buffer is posted
+*		- XST_INVALID_PARAM if Length is 0 or too large
+*		- XST_FIFO_NO_ROOM if the ring is full, see
+*		XDmaPcie_StreamReap()
+*
+* @note 	None
+*
+******************************************************************************/
+int XDmaPcie_StreamPost(XDmaPcie_StreamQueue *QueuePtr, u64 SrcAddr,
+					u64 DstAddr, u32 Length, u8 Eop)
+{
+	XDmaPcie_Desc *DescPtr;
+	u32 Index;
+	u32 Control = XDMAPCIE_DMA_DESC_MAGIC;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->IsReady == TRUE);
+
+	if ((Length == 0U) || (Length > XDMAPCIE_DMA_DESC_LEN_MASK)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((QueuePtr->PostIdx - QueuePtr->DoneIdx) == QueuePtr->NumDesc) {
+		return XST_FIFO_NO_ROOM;
+	}
+
+	Index = QueuePtr->PostIdx & (QueuePtr->NumDesc - 1U);
+	DescPtr = &QueuePtr->DescRing[Index];
+
+	/* A C2H stream channel writes the result of the descriptor where
+	 * the source address points
+	 */
+	if ((QueuePtr->Dir == XDMAPCIE_STREAM_C2H) &&
+	    (QueuePtr->IsStream == TRUE)) {
+		SrcAddr = QueuePtr->ResultBusAddr +
+			(u64)Index * sizeof(XDmaPcie_StreamResult);
+	}
+
+	if (Eop == TRUE) {
+		Control |= XDMAPCIE_DMA_DESC_EOP_MASK;
+	}
+
+	DescPtr->Length = Length;
+	DescPtr->SrcAddrLo = LOWER_32_BITS(SrcAddr);
+	DescPtr->SrcAddrHi = UPPER_32_BITS(SrcAddr);
+	DescPtr->DstAddrLo = LOWER_32_BITS(DstAddr);
+	DescPtr->DstAddrHi = UPPER_32_BITS(DstAddr);
+	DescPtr->Control = Control;
+
+	QueuePtr->PostIdx++;
+
+	if ((QueuePtr->PostIdx - QueuePtr->DoorbellIdx) >= QueuePtr->BatchCnt) {
+		XDmaPcie_StreamDoorbell(QueuePtr);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Hand all the descriptors posted since the previous doorbell to the engine.
+* The last descriptor of the batch raises the channel interrupt.
+*
+* @param 	QueuePtr is the queue to operate on.
+*
+* @return 	None
+*
+* @note 	Call this after the last post of a burst that is shorter than
+*		BatchCnt.
+*
+******************************************************************************/
+void XDmaPcie_StreamDoorbell(XDmaPcie_StreamQueue *QueuePtr)
+{
+	volatile XDmaPcie_Desc *LastPtr;
+	u32 Credits;
+
+	Xil_AssertVoid(QueuePtr != NULL);
+	Xil_AssertVoid(QueuePtr->IsReady == TRUE);
+
+	Credits = QueuePtr->PostIdx - QueuePtr->DoorbellIdx;
+	if (Credits == 0U) {
+		return;
+	}
+
+	LastPtr = &QueuePtr->DescRing[(QueuePtr->PostIdx - 1U) &
+				(QueuePtr->NumDesc - 1U)];
+	LastPtr->Control |= XDMAPCIE_DMA_DESC_CMPL_MASK;
+
+	/* The ring is written through the bridge and the credits through the
+	 * register interface: read back the last descriptor so that all the
+	 * posted writes have reached the ring before the engine fetches it
+	 */
+	(void)LastPtr->Control;
+
+	QueuePtr->DoorbellIdx = QueuePtr->PostIdx;
+
+	while (Credits > XDMAPCIE_DMA_CREDIT_MAX) {
+		XDmaPcie_WriteReg(QueuePtr->SgdmaBase,
+				XDMAPCIE_DMA_SGDMA_CREDIT_OFFSET,
+				XDMAPCIE_DMA_CREDIT_MAX);
+		Credits -= XDMAPCIE_DMA_CREDIT_MAX;
+	}
+	XDmaPcie_WriteReg(QueuePtr->SgdmaBase,
+			XDMAPCIE_DMA_SGDMA_CREDIT_OFFSET, Credits);
+}
+
+/*****************************************************************************/
+/**
+* Get the number of descriptors completed since the previous call. The
+* descriptors complete in the order they were posted, and their slots in the
+* ring can be posted again.
+*
+* @param 	QueuePtr is the queue to operate on.
+*
+* @return 	The number of newly completed descriptors.
+*
+* @note 	For a C2H stream queue, call XDmaPcie_StreamGetResult() for the
+*		completed descriptors before posting their slots again.
+*
+******************************************************************************/
+u32 XDmaPcie_StreamReap(XDmaPcie_StreamQueue *QueuePtr)
+{
+	u32 Count;
+	u32 NumDone;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->IsReady == TRUE);
+
+	Count = XDmaPcie_ReadReg(QueuePtr->ChanBase,
+			XDMAPCIE_DMA_CHAN_CMPL_CNT_OFFSET);
+	NumDone = Count - QueuePtr->DoneIdx;
+	QueuePtr->DoneIdx = Count;
+
+	return NumDone;
+}
+
+/*****************************************************************************/
+/**
+* Get the result of a completed descriptor of a C2H stream queue.
+*
+* @param 	QueuePtr is the queue to operate on.
+* @param 	Index is the number of the descriptor, counted from the start
+*		of the queue as the posts are.
+* @param 	LengthPtr returns the number of bytes received.
+* @param 	EopPtr returns TRUE if the buffer ends a packet.
+*
+* @return
+*		- XST_SUCCESS if successful
+*		- XST_INVALID_PARAM if the queue is not a C2H stream queue
+*		- XST_FAILURE if the result has no valid magic
+*
+* @note 	None
+*
+******************************************************************************/
+int XDmaPcie_StreamGetResult(XDmaPcie_StreamQueue *QueuePtr, u32 Index,
+						u32 *LengthPtr, u8 *EopPtr)
+{
+	volatile XDmaPcie_StreamResult *ResultPtr;
+	u32 Status;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(LengthPtr != NULL);
+	Xil_AssertNonvoid(EopPtr != NULL);
+
+	if (QueuePtr->ResultRing == NULL) {
+		return XST_INVALID_PARAM;
+	}
+
+	ResultPtr = &QueuePtr->ResultRing[Index & (QueuePtr->NumDesc - 1U)];
+	Status = ResultPtr->Status;
+
+	if ((Status & XDMAPCIE_DMA_RESULT_MAGIC_MASK) !=
+			XDMAPCIE_DMA_RESULT_MAGIC) {
+		return XST_FAILURE;
+	}
+
+	*LengthPtr = ResultPtr->Length;
+	*EopPtr = ((Status & XDMAPCIE_DMA_RESULT_EOP_MASK) != 0U) ?
+			TRUE : FALSE;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Get the status of the channel of a queue.
+*
+* @param 	QueuePtr is the queue to operate on.
+*
+* @return 	The channel status register. The queue has failed if any of
+*		the XDMAPCIE_DMA_STS_ERR_MASK bits is set, and must be stopped
+*		and started again.
+*
+* @note 	None
+*
+******************************************************************************/
+u32 XDmaPcie_StreamGetStatus(XDmaPcie_StreamQueue *QueuePtr)
+{
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->IsReady == TRUE);
+
+	return XDmaPcie_ReadReg(QueuePtr->ChanBase,
+			XDMAPCIE_DMA_CHAN_STATUS_OFFSET);
+}
+
+/*****************************************************************************/
+/**
+* Check whether a channel is present in the XDMA engine.
+*
+* @param 	ChanBase is the base address of the channel registers.
+* @param 	Target is the identifier target expected for the channel.
+*
+* @return 	TRUE if the channel is present, FALSE otherwise.
+*
+* @note 	None
+*
+******************************************************************************/
+static u8 XDmaPcie_StreamProbe(UINTPTR ChanBase, u32 Target)
+{
+	u32 Id;
+
+	Id = XDmaPcie_ReadReg(ChanBase, XDMAPCIE_DMA_CHAN_ID_OFFSET);
+
+	if (((Id & XDMAPCIE_DMA_ID_MASK) != XDMAPCIE_DMA_ID_VALUE) ||
+	    (((Id & XDMAPCIE_DMA_ID_TARGET_MASK) >>
+			XDMAPCIE_DMA_ID_TARGET_SHIFT) != Target)) {
+		return FALSE;
+	}
+
+	return TRUE;
+}
@@ -22,6 +22,7 @@
 *       hk   2/15/18  Add support for USXGMII
 * 1.4   rsp  5/08/20  Remove unused variable in usxgmii autoneg reset and
                       restart function.
+* 1.9   fl   10/14/26 Added XXxvEthernet_GetStats.
 *
 * </pre>
 ******************************************************************************/
@@ -41,6 +42,7 @@
 /************************** Function Prototypes ******************************/
 
 static void XXxvEthernet_InitHw(XXxvEthernet *InstancePtr);	/* HW reset */
+static u64 XXxvEthernet_ReadStat(UINTPTR BaseAddress, u32 Offset);
 
 /************************** Variable Definitions *****************************/
 
@@ -793,4 +795,113 @@ int XXxvEthernet_SetAutoNegSpeed(XXxvEthernet *InstancePtr)
 		    "XXxvEthernet_SetOperatingSpeed: done\n");
 	return (XST_SUCCESS);
 }
+
+/*****************************************************************************/
+/**
+ * XXxvEthernet_ReadStat reads a 48-bit statistics counter.
+ *
+ * @param	BaseAddress is the base address of the Xxv Ethernet core.
+ * @param	Offset is the offset of the LSB register of the counter.
+ *
+ * @return	The counter value.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static u64 XXxvEthernet_ReadStat(UINTPTR BaseAddress, u32 Offset)
+{
+	u64 Value;
+
+	Value = XXxvEthernet_ReadReg(BaseAddress, Offset);
+	Value |= (u64)XXxvEthernet_ReadReg(BaseAddress, Offset + 4) << 32;
+
+	return Value;
+}
+
+/*****************************************************************************/
+/**
+ * XXxvEthernet_GetStats latches the statistics counters of the core with a
+ * single write to the TICK register and reads the latched values, so all
+ * the counters of the snapshot cover the same interval.
+ *
+ * @param	InstancePtr references the Xxv Ethernet on which to
+ *		operate.
+ * @param	StatsPtr is the snapshot to fill.
+ *
+ * @return	- XST_SUCCESS if the snapshot was taken.
+ *		- XST_NO_FEATURE if the core is built without statistics
+ *		  counters.
+ *
+ * @note	The core adds the counts since the previous latch, so each
+ *		snapshot holds the traffic since the previous call. The TICK
+ *		register latches the counters only when the tick register mode
+ *		of the MODE register is selected, which this function does; a
+ *		design latching through the pm_tick port must not use it.
+ *
+ ******************************************************************************/
+int XXxvEthernet_GetStats(XXxvEthernet *InstancePtr,
+			  XXxvEthernet_Stats *StatsPtr)
+{
+	UINTPTR BaseAddress;
+	u32 Mode;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(StatsPtr != NULL);
+
+	if (!XXxvEthernet_IsStatsConfigured(InstancePtr)) {
+		return XST_NO_FEATURE;
+	}
+
+	BaseAddress = InstancePtr->Config.BaseAddress;
+
+	Mode = XXxvEthernet_ReadReg(BaseAddress, XXE_MODE_OFFSET);
+	if ((Mode & XXE_MODE_TICKREG_MASK) == 0) {
+		XXxvEthernet_WriteReg(BaseAddress, XXE_MODE_OFFSET,
+				      Mode | XXE_MODE_TICKREG_MASK);
+	}
+	XXxvEthernet_WriteReg(BaseAddress, XXE_TICK_OFFSET,
+			      XXE_TICK_STATEN_MASK);
+
+	StatsPtr->CycleCount = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_CYCLE_COUNT_OFFSET);
+	StatsPtr->TxTotalPkts = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_TX_TOTAL_PKTS_OFFSET);
+	StatsPtr->TxGoodPkts = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_TX_TOTAL_GOOD_PKTS_OFFSET);
+	StatsPtr->TxTotalBytes = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_TX_TOTAL_BYTES_OFFSET);
+	StatsPtr->TxGoodBytes = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_TX_TOTAL_GOOD_BYTES_OFFSET);
+	StatsPtr->TxBadFcs = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_TX_BAD_FCS_OFFSET);
+	StatsPtr->TxUnicast = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_TX_UNICAST_OFFSET);
+	StatsPtr->TxMulticast = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_TX_MULTICAST_OFFSET);
+	StatsPtr->TxBroadcast = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_TX_BROADCAST_OFFSET);
+	StatsPtr->TxPause = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_TX_PAUSE_OFFSET);
+	StatsPtr->RxTotalPkts = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_RX_TOTAL_PKTS_OFFSET);
+	StatsPtr->RxGoodPkts = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_RX_TOTAL_GOOD_PKTS_OFFSET);
+	StatsPtr->RxTotalBytes = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_RX_TOTAL_BYTES_OFFSET);
+	StatsPtr->RxGoodBytes = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_RX_TOTAL_GOOD_BYTES_OFFSET);
+	StatsPtr->RxBadFcs = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_RX_BAD_FCS_OFFSET);
+	StatsPtr->RxUnicast = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_RX_UNICAST_OFFSET);
+	StatsPtr->RxMulticast = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_RX_MULTICAST_OFFSET);
+	StatsPtr->RxBroadcast = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_RX_BROADCAST_OFFSET);
+	StatsPtr->RxPause = XXxvEthernet_ReadStat(BaseAddress,
+				XXE_STAT_RX_PAUSE_OFFSET);
+
+	return XST_SUCCESS;
+}
 /** @} */
@@ -115,6 +115,8 @@
 * 1.4   rsp  05/08/20 Include sleep.h header
 * 1.6	sk   02/18/21 Use UINTPTR instead of u32 for XxvDevBaseAddress
 * 		      variable.
+* 1.9   fl   10/14/26 Added XXxvEthernet_GetStats() to read a snapshot of the
+*		      statistics counters.
 * </pre>
 *
 ******************************************************************************/
@@ -262,6 +264,33 @@ typedef struct XXxvEthernet {
 } XXxvEthernet;
 
 
+/**
+ * This typedef holds a snapshot of the statistics counters, see
+ * XXxvEthernet_GetStats(). All the counters are latched together.
+ */
+typedef struct XXxvEthernet_Stats {
+	u64 CycleCount;		/**< Core clock cycles since the last latch */
+	u64 TxTotalPkts;	/**< Frames transmitted */
+	u64 TxGoodPkts;		/**< Frames transmitted without error */
+	u64 TxTotalBytes;	/**< Bytes transmitted */
+	u64 TxGoodBytes;	/**< Bytes of the good transmitted frames */
+	u64 TxBadFcs;		/**< Frames transmitted with a bad FCS */
+	u64 TxUnicast;		/**< Good unicast frames transmitted */
+	u64 TxMulticast;	/**< Good multicast frames transmitted */
+	u64 TxBroadcast;	/**< Good broadcast frames transmitted */
+	u64 TxPause;		/**< Pause frames transmitted */
+	u64 RxTotalPkts;	/**< Frames received */
+	u64 RxGoodPkts;		/**< Frames received without error */
+	u64 RxTotalBytes;	/**< Bytes received */
+	u64 RxGoodBytes;	/**< Bytes of the good received frames */
+	u64 RxBadFcs;		/**< Frames received with a bad FCS */
+	u64 RxUnicast;		/**< Good unicast frames received */
+	u64 RxMulticast;	/**< Good multicast frames received */
+	u64 RxBroadcast;	/**< Good broadcast frames received */
+	u64 RxPause;		/**< Pause frames received */
+} XXxvEthernet_Stats;
+
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -516,6 +545,12 @@ void XXxvEthernet_UsxgmiiAnMainRestart(XXxvEthernet *InstancePtr);
 int XXxvEthernet_Initialize(XXxvEthernet *InstancePtr,
 			    XXxvEthernet_Config *CfgPtr);
 
+/*
+ * Statistics functions in xxxvethernet.c
+ */
+int XXxvEthernet_GetStats(XXxvEthernet *InstancePtr,
+			  XXxvEthernet_Stats *StatsPtr);
+
 #ifdef __cplusplus
 }
 #endif
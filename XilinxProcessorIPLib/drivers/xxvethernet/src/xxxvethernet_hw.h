@@ -24,6 +24,7 @@
 *       hk   2/15/18  Add support for USXGMII
 * 1.5	sk   10/18/20 Correct the Auto-Negotiation ability macro
 *		      name (XXE_ANA_OFFSET) with XXE_ANASR_OFFSET.
+* 1.9   fl   10/14/26 Added statistics counter offsets.
 *
 * </pre>
 
@@ -86,6 +87,31 @@ extern "C" {
 #define XXE_ANSR_OFFSET		0x00000458
 #define XXE_ANASR_OFFSET	0x0000045C
 
+/** @name Statistics counter offsets
+ *  Each counter is 48 bits wide: the LSB register holds bits 31:0 and the
+ *  register at offset + 4 holds bits 47:32.
+ *  @{
+ */
+#define XXE_STAT_CYCLE_COUNT_OFFSET		0x00000500
+#define XXE_STAT_TX_TOTAL_PKTS_OFFSET		0x00000700
+#define XXE_STAT_TX_TOTAL_GOOD_PKTS_OFFSET	0x00000708
+#define XXE_STAT_TX_TOTAL_BYTES_OFFSET		0x00000710
+#define XXE_STAT_TX_TOTAL_GOOD_BYTES_OFFSET	0x00000718
+#define XXE_STAT_TX_BAD_FCS_OFFSET		0x000007B8
+#define XXE_STAT_TX_UNICAST_OFFSET		0x000007D0
+#define XXE_STAT_TX_MULTICAST_OFFSET		0x000007D8
+#define XXE_STAT_TX_BROADCAST_OFFSET		0x000007E0
+#define XXE_STAT_TX_PAUSE_OFFSET		0x000007F0
+#define XXE_STAT_RX_TOTAL_PKTS_OFFSET		0x00000808
+#define XXE_STAT_RX_TOTAL_GOOD_PKTS_OFFSET	0x00000810
+#define XXE_STAT_RX_TOTAL_BYTES_OFFSET		0x00000818
+#define XXE_STAT_RX_TOTAL_GOOD_BYTES_OFFSET	0x00000820
+#define XXE_STAT_RX_BAD_FCS_OFFSET		0x000008C0
+#define XXE_STAT_RX_UNICAST_OFFSET		0x000008D8
+#define XXE_STAT_RX_MULTICAST_OFFSET		0x000008E0
+#define XXE_STAT_RX_BROADCAST_OFFSET		0x000008E8
+#define XXE_STAT_RX_PAUSE_OFFSET		0x000008F8
+
 /* Register masks. The following constants define bit locations of various
  * bits in the registers. Constants are not defined for those registers
  * that have a single bit field representing all 32 bits. For further
@@ -96,6 +122,9 @@ extern "C" {
  * @{
  */
 #define XXE_MODE_LCLLPBK_MASK	0x80000000
+#define XXE_MODE_TICKREG_MASK	0x40000000	/**< Latch the statistics
+						  *  on a TICK register write
+						  */
 
 
 /** @name TXCFG register masks
@@ -51,6 +51,13 @@
 * functions by using XZDma_SetCallBack API. In this version Descriptor done
 * option is disabled.
 *
+* <b> Copy Engine </b>
+* The copy engine (XZDma_EngInitialize()) spreads memcpy and memset requests
+* over up to 8 channels of a ZDMA. Requests are queued with XZDma_EngSubmit(),
+* consecutive copies are packed into linked list descriptor chains, and
+* completions are collected from a ring with XZDma_EngPoll() and
+* XZDma_EngGetCpl() instead of waiting on each transfer.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -116,6 +123,8 @@
 *                        in applications directly.
 * 1.14	adk	03/15/22 Fixed syntax errors in zdma_tapp.tcl file, when stdout
 * 			 is configured as none.
+* 1.17	fl	10/14/26 Added the copy engine in xzdma_eng.c, a queue
+*			 based memcpy/memset service over several channels.
 * </pre>
 *
 ******************************************************************************/
@@ -137,6 +146,8 @@ extern "C" {
 
 /************************** Constant Definitions *****************************/
 
+#define XZDMA_ENG_MAX_CHANNELS	8U	/**< Channels of one copy engine */
+#define XZDMA_ENG_MAX_BATCH	32U	/**< Copy requests per channel chain */
 
 /**************************** Type Definitions *******************************/
 
@@ -364,6 +375,71 @@ typedef struct {
 				  *  this transfer only for SG mode */
 } XZDma_Transfer;
 
+/******************************************************************************/
+/**
+*
+* This typedef contains the copy engine request operations.
+*/
+typedef enum {
+	XZDMA_ENG_COPY,		/**< Copy from source to destination */
+	XZDMA_ENG_FILL		/**< Fill destination with a pattern */
+} XZDma_EngOp;
+
+/******************************************************************************/
+/**
+*
+* This typedef contains a copy engine request.
+*/
+typedef struct {
+	UINTPTR SrcAddr;	/**< Source address, XZDMA_ENG_COPY only */
+	UINTPTR DstAddr;	/**< Destination address */
+	u32 Size;		/**< Size of the data in bytes */
+	u32 Pattern;		/**< Fill pattern, XZDMA_ENG_FILL only */
+	u32 Tag;		/**< Returned in the completion */
+	XZDma_EngOp Op;		/**< Request operation */
+} XZDma_EngReq;
+
+/******************************************************************************/
+/**
+*
+* This typedef contains a copy engine completion.
+*/
+typedef struct {
+	u32 Tag;		/**< Tag of the completed request */
+	s32 Status;		/**< XST_SUCCESS or XST_FAILURE */
+} XZDma_EngCpl;
+
+/******************************************************************************/
+/**
+*
+* This typedef contains the state of one copy engine channel.
+*/
+typedef struct {
+	XZDma *ZDmaPtr;		/**< ZDMA channel instance */
+	u32 DscrCount;		/**< Copy requests per chain */
+	u32 InFlight;		/**< Requests started, 0 if idle */
+	u32 Tag[XZDMA_ENG_MAX_BATCH]; /**< Tags of the started requests */
+} XZDma_EngChan;
+
+/******************************************************************************/
+/**
+*
+* This typedef contains the copy engine, a set of ZDMA channels fed from one
+* request ring and reporting to one completion ring.
+*/
+typedef struct {
+	XZDma_EngChan Chan[XZDMA_ENG_MAX_CHANNELS]; /**< Engine channels */
+	u32 NumChans;		/**< Number of channels in use */
+	XZDma_EngReq *ReqQ;	/**< Request ring */
+	u32 ReqQLen;		/**< Entries of the request ring */
+	u32 ReqHead;		/**< Oldest queued request */
+	u32 ReqCnt;		/**< Queued requests */
+	XZDma_EngCpl *CplQ;	/**< Completion ring */
+	u32 CplQLen;		/**< Entries of the completion ring */
+	u32 CplHead;		/**< Oldest completion */
+	u32 CplCnt;		/**< Completions not yet popped */
+} XZDma_Engine;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -708,6 +784,15 @@ void XZDma_ScatterGather(XZDma *InstancePtr, XZDma_Transfer *Data,
 			 u32 Num);
 void XZDma_Enable(XZDma *InstancePtr);
 
+s32 XZDma_EngInitialize(XZDma_Engine *EngPtr, XZDma **ChanPtrs, u32 NumChans,
+			UINTPTR Dscr_MemPtr, u32 NoOfBytes,
+			XZDma_EngReq *ReqQ, u32 ReqQLen,
+			XZDma_EngCpl *CplQ, u32 CplQLen);
+s32 XZDma_EngSubmit(XZDma_Engine *EngPtr, const XZDma_EngReq *Req);
+u32 XZDma_EngKick(XZDma_Engine *EngPtr);
+u32 XZDma_EngPoll(XZDma_Engine *EngPtr);
+s32 XZDma_EngGetCpl(XZDma_Engine *EngPtr, XZDma_EngCpl *Cpl);
+
 /*@}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,463 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_eng.c
+* @addtogroup zdma Overview
+* @{
+*
+* This file contains the copy engine of the ZDMA driver. The engine owns a
+* set of ZDMA channels and offloads memcpy() and memset() style requests to
+* them without blocking the caller:
+*
+* - XZDma_EngSubmit() queues a request in the request ring.
+* - XZDma_EngKick() hands queued requests to idle channels. Consecutive copy
+*   requests are packed into one linked list descriptor chain per channel;
+*   a fill request runs on its own in write only mode.
+* - XZDma_EngPoll() retires the channels that have stopped, posts one
+*   completion per request to the completion ring and refills the channels.
+* - XZDma_EngGetCpl() pops completions.
+*
+* Completions of requests that ran on different channels may be posted out
+* of submission order, the Tag of a request identifies its completion.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.17  fl      10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Channel status errors that abort the rest of a descriptor chain */
+#define XZDMA_ENG_ERR_MASK	(XZDMA_IXR_AXI_WR_DATA_MASK | \
+				 XZDMA_IXR_AXI_RD_DATA_MASK | \
+				 XZDMA_IXR_AXI_RD_DST_DSCR_MASK | \
+				 XZDMA_IXR_AXI_RD_SRC_DSCR_MASK | \
+				 XZDMA_IXR_INV_APB_MASK)
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+
+static u32 XZDma_EngStartChan(XZDma_Engine *EngPtr, XZDma_EngChan *ChanPtr);
+static s32 XZDma_EngSetMode(XZDma *InstancePtr, u8 IsSgDma, XZDma_Mode Mode);
+
+/************************** Variable Definitions *****************************/
+
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a copy engine over a set of ZDMA channels. The
+* descriptor memory is split evenly between the channels and the request and
+* completion rings are provided by the caller.
+*
+* @param	EngPtr is a pointer to the engine to be initialized.
+* @param	ChanPtrs is an array of NumChans initialized XZDma instances
+*		in idle state. They must not be used outside of the engine
+*		afterwards.
+* @param	NumChans is the number of channels, 1 to XZDMA_ENG_MAX_CHANNELS.
+* @param	Dscr_MemPtr is the descriptor memory. It should be aligned to
+*		64 bytes.
+* @param	NoOfBytes is the size of the descriptor memory. Each copy
+*		request of a chain takes 64 bytes of it.
+* @param	ReqQ is the request ring of ReqQLen entries.
+* @param	ReqQLen is the number of entries of the request ring.
+* @param	CplQ is the completion ring of CplQLen entries.
+* @param	CplQLen is the number of entries of the completion ring.
+*
+* @return
+*		- XST_SUCCESS if the engine was initialized.
+*		- XST_INVALID_PARAM if the descriptor memory leaves no room
+*		  for a descriptor pair per channel.
+*		- XST_FAILURE if a channel is not idle.
+*
+* @note		Data buffers are not flushed or invalidated by the engine, this
+*		stays with the caller as for XZDma_Start().
+*
+******************************************************************************/
+s32 XZDma_EngInitialize(XZDma_Engine *EngPtr, XZDma **ChanPtrs, u32 NumChans,
+			UINTPTR Dscr_MemPtr, u32 NoOfBytes,
+			XZDma_EngReq *ReqQ, u32 ReqQLen,
+			XZDma_EngCpl *CplQ, u32 CplQLen)
+{
+	XZDma_EngChan *ChanPtr;
+	u32 ChanBytes;
+	u32 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(EngPtr != NULL);
+	Xil_AssertNonvoid(ChanPtrs != NULL);
+	Xil_AssertNonvoid((NumChans != 0x00U) &&
+			  (NumChans <= XZDMA_ENG_MAX_CHANNELS));
+	Xil_AssertNonvoid(Dscr_MemPtr != 0x00);
+	Xil_AssertNonvoid((ReqQ != NULL) && (ReqQLen != 0x00U));
+	Xil_AssertNonvoid((CplQ != NULL) && (CplQLen != 0x00U));
+
+	/* Keep every channel's share 64 byte aligned */
+	ChanBytes = (NoOfBytes / NumChans) & ~(u32)(sizeof(XZDma_LlDscr) * 2U - 1U);
+	if (ChanBytes == 0x00U) {
+		return XST_INVALID_PARAM;
+	}
+
+	for (Index = 0x00U; Index < NumChans; Index++) {
+		ChanPtr = &EngPtr->Chan[Index];
+		ChanPtr->ZDmaPtr = ChanPtrs[Index];
+		ChanPtr->InFlight = 0x00U;
+
+		Xil_AssertNonvoid(ChanPtr->ZDmaPtr != NULL);
+		Xil_AssertNonvoid(ChanPtr->ZDmaPtr->IsReady ==
+				  (u32)(XIL_COMPONENT_IS_READY));
+
+		if (ChanPtr->ZDmaPtr->ChannelState != XZDMA_IDLE) {
+			return XST_FAILURE;
+		}
+
+		ChanPtr->DscrCount = XZDma_CreateBDList(ChanPtr->ZDmaPtr,
+				XZDMA_LINKEDLIST,
+				Dscr_MemPtr + ((UINTPTR)ChanBytes * Index),
+				ChanBytes);
+		if (ChanPtr->DscrCount > XZDMA_ENG_MAX_BATCH) {
+			ChanPtr->DscrCount = XZDMA_ENG_MAX_BATCH;
+		}
+	}
+
+	EngPtr->NumChans = NumChans;
+	EngPtr->ReqQ = ReqQ;
+	EngPtr->ReqQLen = ReqQLen;
+	EngPtr->ReqHead = 0x00U;
+	EngPtr->ReqCnt = 0x00U;
+	EngPtr->CplQ = CplQ;
+	EngPtr->CplQLen = CplQLen;
+	EngPtr->CplHead = 0x00U;
+	EngPtr->CplCnt = 0x00U;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a request to the copy engine. The request is copied,
+* so the caller's structure can be reused on return.
+*
+* @param	EngPtr is a pointer to the engine.
+* @param	Req is the request. For XZDMA_ENG_COPY, Size bytes are copied
+*		from SrcAddr to DstAddr. For XZDMA_ENG_FILL, Size bytes at
+*		DstAddr are filled with the 32 bit Pattern and SrcAddr is
+*		ignored.
+*
+* @return
+*		- XST_SUCCESS if the request was queued.
+*		- XST_INVALID_PARAM if the size is 0 or too large for one
+*		  descriptor.
+*		- XST_FAILURE if the request ring is full.
+*
+* @note		Requests are started by XZDma_EngKick() or XZDma_EngPoll().
+*
+******************************************************************************/
+s32 XZDma_EngSubmit(XZDma_Engine *EngPtr, const XZDma_EngReq *Req)
+{
+	u32 Slot;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(EngPtr != NULL);
+	Xil_AssertNonvoid(Req != NULL);
+	Xil_AssertNonvoid((Req->Op == XZDMA_ENG_COPY) ||
+			  (Req->Op == XZDMA_ENG_FILL));
+
+	if ((Req->Size == 0x00U) || (Req->Size > XZDMA_WORD2_SIZE_MASK)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if (EngPtr->ReqCnt == EngPtr->ReqQLen) {
+		return XST_FAILURE;
+	}
+
+	Slot = EngPtr->ReqHead + EngPtr->ReqCnt;
+	if (Slot >= EngPtr->ReqQLen) {
+		Slot -= EngPtr->ReqQLen;
+	}
+	EngPtr->ReqQ[Slot] = *Req;
+	EngPtr->ReqCnt++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts queued requests on every idle channel of the engine.
+*
+* @param	EngPtr is a pointer to the engine.
+*
+* @return	The number of requests started.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XZDma_EngKick(XZDma_Engine *EngPtr)
+{
+	u32 Started = 0x00U;
+	u32 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(EngPtr != NULL);
+
+	for (Index = 0x00U; (Index < EngPtr->NumChans) &&
+	     (EngPtr->ReqCnt != 0x00U); Index++) {
+		if (EngPtr->Chan[Index].InFlight == 0x00U) {
+			Started += XZDma_EngStartChan(EngPtr,
+						      &EngPtr->Chan[Index]);
+		}
+	}
+
+	return Started;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function retires the channels that have finished their chain, posts a
+* completion for each of their requests and starts queued requests on the
+* channels freed.
+*
+* A channel is retired only when the completion ring has room for all of
+* its requests; otherwise it is left for a later call.
+*
+* @param	EngPtr is a pointer to the engine.
+*
+* @return	The number of completions posted.
+*
+* @note		This function can be called from the ZDMA done callback of
+*		the channels as well as from a polling loop, but not from both.
+*
+******************************************************************************/
+u32 XZDma_EngPoll(XZDma_Engine *EngPtr)
+{
+	XZDma_EngChan *ChanPtr;
+	XZDma *InstancePtr;
+	u32 Posted = 0x00U;
+	u32 ChanSts;
+	u32 IntrSts;
+	u32 Slot;
+	u32 Index;
+	u32 Count;
+	s32 Status;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(EngPtr != NULL);
+
+	for (Index = 0x00U; Index < EngPtr->NumChans; Index++) {
+		ChanPtr = &EngPtr->Chan[Index];
+		InstancePtr = ChanPtr->ZDmaPtr;
+
+		if (ChanPtr->InFlight == 0x00U) {
+			continue;
+		}
+
+		ChanSts = XZDma_ReadReg(InstancePtr->Config.BaseAddress,
+					XZDMA_CH_STS_OFFSET) & XZDMA_STS_ALL_MASK;
+		if ((ChanSts != XZDMA_STS_DONE_MASK) &&
+		    (ChanSts != XZDMA_STS_DONE_ERR_MASK)) {
+			continue;
+		}
+
+		if ((EngPtr->CplQLen - EngPtr->CplCnt) < ChanPtr->InFlight) {
+			continue;
+		}
+
+		IntrSts = XZDma_IntrGetStatus(InstancePtr);
+		XZDma_IntrClear(InstancePtr, XZDMA_IXR_ALL_INTR_MASK);
+
+		Status = XST_SUCCESS;
+		if ((ChanSts == XZDMA_STS_DONE_ERR_MASK) ||
+		    ((IntrSts & XZDMA_ENG_ERR_MASK) != 0x00U)) {
+			Status = XST_FAILURE;
+		}
+
+		for (Count = 0x00U; Count < ChanPtr->InFlight; Count++) {
+			Slot = EngPtr->CplHead + EngPtr->CplCnt;
+			if (Slot >= EngPtr->CplQLen) {
+				Slot -= EngPtr->CplQLen;
+			}
+			EngPtr->CplQ[Slot].Tag = ChanPtr->Tag[Count];
+			EngPtr->CplQ[Slot].Status = Status;
+			EngPtr->CplCnt++;
+		}
+
+		Posted += ChanPtr->InFlight;
+		ChanPtr->InFlight = 0x00U;
+		InstancePtr->ChannelState = XZDMA_IDLE;
+
+		if (EngPtr->ReqCnt != 0x00U) {
+			(void)XZDma_EngStartChan(EngPtr, ChanPtr);
+		}
+	}
+
+	return Posted;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function pops the oldest completion of the engine.
+*
+* @param	EngPtr is a pointer to the engine.
+* @param	Cpl is filled with the completion.
+*
+* @return
+*		- XST_SUCCESS if a completion was returned.
+*		- XST_FAILURE if the completion ring is empty.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_EngGetCpl(XZDma_Engine *EngPtr, XZDma_EngCpl *Cpl)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(EngPtr != NULL);
+	Xil_AssertNonvoid(Cpl != NULL);
+
+	if (EngPtr->CplCnt == 0x00U) {
+		return XST_FAILURE;
+	}
+
+	*Cpl = EngPtr->CplQ[EngPtr->CplHead];
+	EngPtr->CplHead++;
+	if (EngPtr->CplHead == EngPtr->CplQLen) {
+		EngPtr->CplHead = 0x00U;
+	}
+	EngPtr->CplCnt--;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function starts the requests at the head of the request ring on
+* an idle channel: either one fill request, or as many consecutive copy
+* requests as the channel has descriptors for.
+*
+* @param	EngPtr is a pointer to the engine.
+* @param	ChanPtr is the idle channel.
+*
+* @return	The number of requests started.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XZDma_EngStartChan(XZDma_Engine *EngPtr, XZDma_EngChan *ChanPtr)
+{
+	XZDma *InstancePtr = ChanPtr->ZDmaPtr;
+	XZDma_Transfer Data[XZDMA_ENG_MAX_BATCH];
+	XZDma_EngReq *Req = &EngPtr->ReqQ[EngPtr->ReqHead];
+	u32 Pattern[4];
+	u32 Num = 0x00U;
+
+	if (Req->Op == XZDMA_ENG_FILL) {
+		if (XZDma_EngSetMode(InstancePtr, FALSE, XZDMA_WRONLY_MODE) !=
+		    XST_SUCCESS) {
+			return 0x00U;
+		}
+
+		Pattern[0] = Req->Pattern;
+		Pattern[1] = Req->Pattern;
+		Pattern[2] = Req->Pattern;
+		Pattern[3] = Req->Pattern;
+		XZDma_WOData(InstancePtr, Pattern);
+
+		Data[0].SrcAddr = 0x00U;
+		Data[0].DstAddr = Req->DstAddr;
+		Data[0].Size = Req->Size;
+		Data[0].SrcCoherent = 0x00U;
+		Data[0].DstCoherent = InstancePtr->Config.IsCacheCoherent;
+		Data[0].Pause = 0x00U;
+		ChanPtr->Tag[0] = Req->Tag;
+		Num = 1U;
+
+		EngPtr->ReqHead++;
+		if (EngPtr->ReqHead == EngPtr->ReqQLen) {
+			EngPtr->ReqHead = 0x00U;
+		}
+		EngPtr->ReqCnt--;
+	} else {
+		if (XZDma_EngSetMode(InstancePtr, TRUE, XZDMA_NORMAL_MODE) !=
+		    XST_SUCCESS) {
+			return 0x00U;
+		}
+
+		do {
+			Data[Num].SrcAddr = Req->SrcAddr;
+			Data[Num].DstAddr = Req->DstAddr;
+			Data[Num].Size = Req->Size;
+			Data[Num].SrcCoherent = InstancePtr->Config.IsCacheCoherent;
+			Data[Num].DstCoherent = InstancePtr->Config.IsCacheCoherent;
+			Data[Num].Pause = 0x00U;
+			ChanPtr->Tag[Num] = Req->Tag;
+			Num++;
+
+			EngPtr->ReqHead++;
+			if (EngPtr->ReqHead == EngPtr->ReqQLen) {
+				EngPtr->ReqHead = 0x00U;
+			}
+			EngPtr->ReqCnt--;
+			Req = &EngPtr->ReqQ[EngPtr->ReqHead];
+		} while ((Num < ChanPtr->DscrCount) &&
+			 (EngPtr->ReqCnt != 0x00U) &&
+			 (Req->Op == XZDMA_ENG_COPY));
+	}
+
+	/* Stale status of the previous chain must not retire this one */
+	XZDma_IntrClear(InstancePtr, XZDMA_IXR_ALL_INTR_MASK);
+	ChanPtr->InFlight = Num;
+	(void)XZDma_Start(InstancePtr, Data, Num);
+
+	return Num;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function switches a channel between linked list scatter gather
+* and simple write only mode, skipping the register access when the channel
+* is already in the requested mode.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	IsSgDma selects scatter gather mode.
+* @param	Mode is the operation mode.
+*
+* @return	The status of XZDma_SetMode().
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XZDma_EngSetMode(XZDma *InstancePtr, u8 IsSgDma, XZDma_Mode Mode)
+{
+	if ((InstancePtr->IsSgDma == IsSgDma) && (InstancePtr->Mode == Mode)) {
+		return XST_SUCCESS;
+	}
+
+	return XZDma_SetMode(InstancePtr, IsSgDma, Mode);
+}
+/** @} */
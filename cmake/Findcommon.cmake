@@ -81,6 +81,36 @@ function (linker_gen path)
 	        set(HEAP_SIZE 0x2000)
 	    endif()
 	endif()
+        # Hot code and data placement: HOT_MEM names the memory region,
+        # e.g. a TCM or OCM bank, that gets the .hot_text/.hot_data input
+        # sections and the -ffunction-sections/-fdata-sections sections of
+        # the HOT_SYMBOLS list. Without HOT_MEM everything stays in DDR.
+        set(HOT_SECTIONS "")
+        if (DEFINED HOT_MEM)
+            set(HOT_TEXT_SECTIONS "")
+            set(HOT_DATA_SECTIONS "")
+            foreach(sym ${HOT_SYMBOLS})
+                string(APPEND HOT_TEXT_SECTIONS "   *(.text.${sym})\n")
+                string(APPEND HOT_DATA_SECTIONS "   *(.data.${sym})\n   *(.rodata.${sym})\n")
+            endforeach()
+            string(CONCAT HOT_SECTIONS
+                ".hot_text : {\n"
+                "   . = ALIGN(8);\n"
+                "   __hot_text_start = .;\n"
+                "   *(.hot_text)\n"
+                "   *(.hot_text.*)\n"
+                "${HOT_TEXT_SECTIONS}"
+                "   __hot_text_end = .;\n"
+                "} > ${HOT_MEM}\n\n"
+                ".hot_data : {\n"
+                "   . = ALIGN(8);\n"
+                "   __hot_data_start = .;\n"
+                "   *(.hot_data)\n"
+                "   *(.hot_data.*)\n"
+                "${HOT_DATA_SECTIONS}"
+                "   __hot_data_end = .;\n"
+                "} > ${HOT_MEM}\n")
+        endif()
         SET(MEM_NODE_INSTANCES "${TOTAL_MEM_CONTROLLERS}" CACHE STRING "Memory Controller")
         SET_PROPERTY(CACHE MEM_NODE_INSTANCES PROPERTY STRINGS "${TOTAL_MEM_CONTROLLERS}")
         set(CUSTOM_LINKER_FILE "None" CACHE STRING "Custom Linker Script")
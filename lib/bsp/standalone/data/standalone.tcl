@@ -91,6 +91,10 @@
 #                     copy appropriate files based on processor and SoC.
 # 9.1   ml   10/08/23 Updated tcl not to set coresight as stdout/stdin for
 #                     non ARM based processors.
+# 9.1   fl   10/14/26 Support S/W intrusive profiling on the 64 bit
+#                     Cortex-A53/A72/A78 and Cortex-R5/R52 BSPs, sampled with
+#                     PMU overflow interrupts.
+#       fl   10/14/26 Added xil_printf_buffered parameter.
 ##############################################################################
 
 # ----------------------------------------------------------------------------
@@ -548,8 +552,8 @@ proc generate {os_handle} {
 	    foreach entry [glob -nocomplain -types f [file join $platformincludedir *]] {
 	        file copy -force $entry "./src/includes_ps/"
 	    }
-            if { $enable_sw_profile == "true" } {
-                error "ERROR: Profiling is not supported for A53/A72"
+            if { $enable_sw_profile == "true" && ([string compare -nocase $compiler "arm-none-eabi-gcc"] == 0 || [string compare -nocase $compiler "armclang"] == 0) } {
+                error "ERROR: Profiling is supported only for 64 bit A53/A72/A78 with GCC"
             }
 	    set pss_ref_clk_mhz [common::get_property CONFIG.C_PSS_REF_CLK_FREQ $hw_proc_handle]
             if { $pss_ref_clk_mhz == "" } {
@@ -609,8 +613,8 @@ proc generate {os_handle} {
 	        file copy -force $entry "./src/includes_ps/"
 	    }
 
-            if { $enable_sw_profile == "true" } {
-                error "ERROR: Profiling is not supported for R5"
+            if { $enable_sw_profile == "true" && ([string compare -nocase $compiler "iccarm"] == 0 || [string compare -nocase $compiler "armclang"] == 0) } {
+                error "ERROR: Profiling is supported only for R5/R52 with GCC"
             }
 	    set pss_ref_clk_mhz [common::get_property CONFIG.C_PSS_REF_CLK_FREQ $hw_proc_handle]
 	    if { $pss_ref_clk_mhz == "" } {
@@ -719,8 +723,10 @@ proc generate {os_handle} {
         puts $makeconfig "PROFILE_ARCH_OBJS = profile_mcount_mb.o"
     } elseif { $proctype == "psu_cortexr5" ||  $proctype == "psv_cortexr5" || $proctype == "psxl_cortexr52" || $proctype == "psx_cortexr52"} {
 	puts $makeconfig "LIBSOURCES = *.c *.S"
+	puts $makeconfig "PROFILE_ARCH_OBJS = profile_mcount_arm.o"
     } elseif { $proctype == "psu_cortexa53" || $proctype == "psu_cortexa72" || $proctype == "psv_cortexa72" || $proctype == "psxl_cortexa78" || $proctype == "psx_cortexa78"}  {
             puts $makeconfig "LIBSOURCES = *.c *.S"
+            puts $makeconfig "PROFILE_ARCH_OBJS = profile_mcount_arm64.o"
     } elseif { $proctype == "ps7_cortexa9" } {
         if {[string compare -nocase $compiler "armcc"] == 0} {
             puts $makeconfig "LIBSOURCES = *.c *.s"
@@ -835,6 +841,11 @@ proc generate {os_handle} {
         puts $bspcfg_fh "#define XPM_SUPPORT"
     }
 
+    set printf_buffered [common::get_property CONFIG.xil_printf_buffered $os_handle ]
+    if {$printf_buffered == true} {
+        puts $bspcfg_fh "#define XIL_PRINTF_BUFFERED"
+    }
+
     if { $proctype == "microblaze" && [mb_has_pvr $hw_proc_handle] } {
 
         set pvr [common::get_property CONFIG.C_PVR $hw_proc_handle]
@@ -1661,6 +1672,37 @@ proc handle_profile { os_handle proctype } {
 	                puts $config_file "#define SCUGIC_DIST_BASEADDR $scugic_dist_base"
 	            }
         }
+        "psu_cortexa53" -
+        "psu_cortexa72" -
+        "psv_cortexa72" -
+        "psxl_cortexa78" -
+        "psx_cortexa78" -
+        "psu_cortexr5" -
+        "psv_cortexr5" -
+        "psxl_cortexr52" -
+        "psx_cortexr52" {
+                    # PMU overflow interrupt of the core takes the place
+                    # of the timer
+                    puts $config_file "#define PROFILE_PMU 1"
+                    puts $config_file "#define PROFILE_PMU_EVENT [common::get_property CONFIG.profile_pmu_event $os_handle]"
+                    set pmu_intr [common::get_property CONFIG.profile_pmu_intr_id $os_handle]
+                    if { $pmu_intr == "" || $pmu_intr == 0 } {
+                        if { $proctype == "psu_cortexa53" } {
+                            # One SPI per core
+                            puts $config_file "#define PROFILE_PMU_INTR_ID 175U"
+                            puts $config_file "#define PROFILE_PMU_INTR_STRIDE 1U"
+                        } elseif { $proctype == "psv_cortexa72" || $proctype == "psxl_cortexa78" || $proctype == "psx_cortexa78" } {
+                            # PPI 7
+                            puts $config_file "#define PROFILE_PMU_INTR_ID 23U"
+                        } else {
+                            error "ERROR <profile> :: Set profile_pmu_intr_id to the PMU interrupt ID of $proctype" "" "mdt_error"
+                        }
+                    } else {
+                        puts $config_file "#define PROFILE_PMU_INTR_ID $pmu_intr"
+                    }
+                    puts $config_file "#define SCUGIC_CPU_BASEADDR XPAR_SCUGIC_0_CPU_BASEADDR"
+                    puts $config_file "#define SCUGIC_DIST_BASEADDR XPAR_SCUGIC_0_DIST_BASEADDR"
+        }
         "default" {error "ERROR: unknown processor type\n"}
     }
 
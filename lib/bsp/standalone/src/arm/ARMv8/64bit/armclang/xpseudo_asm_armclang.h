@@ -20,6 +20,7 @@
 * 8.0   mus  06/20/22 Added mfcpnotoken and mtcpnotoken macros to fix
 *                     linking errors observed while building application
 *                     with armclang compiler. It fixes CR#1132642.
+* 9.1   fl   10/14/26 Added mtcptlbiva macro.
 * </pre>
 *
 ******************************************************************************/
@@ -113,6 +114,7 @@ extern "C" {
 
 #define mtcpicall(reg)	__asm__ __volatile__("ic " #reg)
 #define mtcptlbi(reg)	__asm__ __volatile__("tlbi " #reg)
+#define mtcptlbiva(reg,val)	__asm__ __volatile__("tlbi " #reg ",%x0" : : "r" (val))
 #define mtcpat(reg,val)	__asm__ __volatile__("at " #reg ",%x0" : : "r" (val))
 
 /* CP15 operations */
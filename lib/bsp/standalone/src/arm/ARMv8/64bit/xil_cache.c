@@ -65,6 +65,10 @@
 * 8.1 mus  12/22/22  Removed workaround added to Xil_DCacheInvalidateRange for
 *                    VERSAL NET.
 * 9.0 ml   03/03/23  Add description to fix doxygen warnings.
+* 9.1 fl   10/14/26  Xil_DCacheInvalidateRange switches to a full flush by
+*                    set/way above XIL_DCACHE_SETWAY_THRESHOLD. Added
+*                    Xil_DCacheInvalidateRanges to maintain several ranges
+*                    with a single barrier.
 * </pre>
 *
 ******************************************************************************/
@@ -86,6 +90,44 @@
 /************************** Variable Definitions *****************************/
 #define IRQ_FIQ_MASK 0xC0U	/**< Mask IRQ and FIQ interrupts in cpsr */
 
+/**
+ * Range length in bytes from which a range clean and invalidate is done on
+ * the whole data cache by set/way, which is faster than walking the range
+ * line by line. Set/way operations are only used at EL3, under a hypervisor
+ * they are trapped or not applied to the physical cache. 0 disables it.
+ */
+#ifndef XIL_DCACHE_SETWAY_THRESHOLD
+#if EL3==1
+#define XIL_DCACHE_SETWAY_THRESHOLD	(0x400000)
+#else
+#define XIL_DCACHE_SETWAY_THRESHOLD	(0)
+#endif
+#endif
+
+/****************************************************************************/
+/**
+* @brief	Clean and invalidate the Data cache lines of a range, without
+*		a barrier. The caller must mask interrupts and issue the dsb.
+*
+* @param	adr: 64bit start address of the range.
+* @param	len: Length of the range in bytes.
+*
+* @return	None.
+*
+****************************************************************************/
+static inline void Xil_DCacheCivacRange(INTPTR adr, INTPTR len)
+{
+	const INTPTR cacheline = 64U;
+	INTPTR end = adr + len;
+	adr = adr & (~0x3F);
+	if (len != 0U) {
+		while (adr < end) {
+			mtcpdc(CIVAC,adr);
+			adr += cacheline;
+		}
+	}
+}
+
 /****************************************************************************/
 /**
 * @brief	Enable the Data cache.
@@ -479,21 +521,64 @@ void Xil_DCacheInvalidateLine(INTPTR adr)
 * 			crashing because of the loss of essential data. Hence, such
 * 			operations are promoted to clean and invalidate which avoids such
 *			corruption.
+*			Ranges of XIL_DCACHE_SETWAY_THRESHOLD bytes or more are
+*			handled with Xil_DCacheFlush.
 *
 ****************************************************************************/
 void Xil_DCacheInvalidateRange(INTPTR  adr, INTPTR len)
 {
-	const INTPTR cacheline = 64U;
-	INTPTR end = adr + len;
-	adr = adr & (~0x3F);
+	if ((XIL_DCACHE_SETWAY_THRESHOLD != 0) &&
+	    (len >= XIL_DCACHE_SETWAY_THRESHOLD)) {
+		Xil_DCacheFlush();
+		return;
+	}
+
 	u32 currmask = mfcpsr();
 	mtcpsr(currmask | IRQ_FIQ_MASK);
-	if (len != 0U) {
-		while (adr < end) {
-			mtcpdc(CIVAC,adr);
-			adr += cacheline;
+	Xil_DCacheCivacRange(adr, len);
+	/* Wait for invalidate to complete */
+	dsb();
+	mtcpsr(currmask);
+}
+
+/****************************************************************************/
+/**
+* @brief	Invalidate the Data cache for a list of ranges. The lines of
+*		all the ranges are cleaned and invalidated before a single
+*		barrier, instead of one barrier per range.
+*
+* @param	ranges: Pointer to the array of ranges.
+* @param	count: Number of ranges in the array.
+*
+* @return	None.
+*
+* @note		As for Xil_DCacheInvalidateRange, the lines are cleaned and
+*			invalidated. If the total length of the ranges is
+*			XIL_DCACHE_SETWAY_THRESHOLD bytes or more, Xil_DCacheFlush
+*			is used instead.
+*
+****************************************************************************/
+void Xil_DCacheInvalidateRanges(const XCacheRange *ranges, u32 count)
+{
+	INTPTR total = 0;
+	u32 index;
+	u32 currmask;
+
+	if (XIL_DCACHE_SETWAY_THRESHOLD != 0) {
+		for (index = 0U; index < count; index++) {
+			total += ranges[index].len;
+		}
+		if (total >= XIL_DCACHE_SETWAY_THRESHOLD) {
+			Xil_DCacheFlush();
+			return;
 		}
 	}
+
+	currmask = mfcpsr();
+	mtcpsr(currmask | IRQ_FIQ_MASK);
+	for (index = 0U; index < count; index++) {
+		Xil_DCacheCivacRange(ranges[index].adr, ranges[index].len);
+	}
 	/* Wait for invalidate to complete */
 	dsb();
 	mtcpsr(currmask);
@@ -25,6 +25,7 @@
 * ----- ---- -------- -----------------------------------------------
 * 5.00 	pkp  05/29/14 First release
 * 9.00  ml   03/03/23 Add description to fix doxygen warnings.
+* 9.10  fl   10/14/26 Added XCacheRange and Xil_DCacheInvalidateRanges.
 * </pre>
 *
 ******************************************************************************/
@@ -49,13 +50,24 @@ extern "C" {
  *@endcond
  */
 
+/**************************** Type Definitions *******************************/
+/**
+ * Address range for the multi range cache maintenance APIs
+ */
+typedef struct {
+	INTPTR adr;	/**< Start address of the range */
+	INTPTR len;	/**< Length of the range in bytes */
+} XCacheRange;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 #define Xil_DCacheFlushRange Xil_DCacheInvalidateRange /**< DCache range */
+#define Xil_DCacheFlushRanges Xil_DCacheInvalidateRanges /**< DCache ranges */
 /************************** Function Prototypes ******************************/
 void Xil_DCacheEnable(void);
 void Xil_DCacheDisable(void);
 void Xil_DCacheInvalidate(void);
 void Xil_DCacheInvalidateRange(INTPTR adr, INTPTR len);
+void Xil_DCacheInvalidateRanges(const XCacheRange *ranges, u32 count);
 void Xil_DCacheInvalidateLine(INTPTR adr);
 void Xil_DCacheFlush(void);
 void Xil_DCacheFlushLine(INTPTR adr);
@@ -21,6 +21,7 @@
 * 5.00 	pkp  05/29/14 First release
 * 6.02  pkp  01/22/17 Added support for EL1 non-secure
 * 9.00  ml   03/03 23 Add description to fix doxygen warnings.
+* 9.10  fl   10/14/26 Added Xil_SetTlbAttributesRange.
 * </pre>
 *
 * @note
@@ -35,6 +36,7 @@
 #include "xpseudo_asm.h"
 #include "xil_types.h"
 #include "xil_mmu.h"
+#include "xstatus.h"
 #include "bspconfig.h"
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -45,12 +47,39 @@
 #define BLOCK_SIZE_2MB 0x200000U /**< block size is 2MB */
 #define BLOCK_SIZE_1GB 0x40000000U /**< block size is 1GB */
 #define ADDRESS_LIMIT_4GB 0x100000000UL /**< Address limit is 4GB */
+#define PAGE_SIZE_4KB 0x1000U /**< page size is 4KB */
+#define ENTRIES_PER_TABLE 512U /**< descriptors in a translation table */
+#define DESC_TYPE_MASK 0x3U /**< descriptor type bits */
+#define DESC_TYPE_TABLE 0x3U /**< table descriptor at level 1/2 */
+#define DESC_TYPE_PAGE 0x3U /**< page descriptor at level 3 */
+#define DESC_ADDR_MASK 0x0000FFFFFFFFF000UL /**< output address bits */
+
+/**
+ * Number of blocks and pages up to which Xil_SetTlbAttributesRange
+ * invalidates the TLB by VA, above it the whole TLB is invalidated
+ */
+#define TLBI_VA_MAX_ENTRIES 64U
+
+/**
+ * Number of level 3 tables available to Xil_SetTlbAttributesRange to split
+ * 2MB blocks below 4GB into 4KB pages. Each table takes 4KB of memory, so
+ * the pool is empty unless the application build defines a size.
+ */
+#ifndef XIL_MMU_NUM_L3_TABLES
+#define XIL_MMU_NUM_L3_TABLES 0U
+#endif
 
 /************************** Variable Definitions *****************************/
 
 extern INTPTR MMUTableL1;
 extern INTPTR MMUTableL2;
 
+#if XIL_MMU_NUM_L3_TABLES > 0U
+static INTPTR MMUTableL3[XIL_MMU_NUM_L3_TABLES][ENTRIES_PER_TABLE]
+	__attribute__((aligned(PAGE_SIZE_4KB)));
+static u32 MMUTableL3Used;
+#endif
+
 /************************** Function Prototypes ******************************/
 /*****************************************************************************/
 /**
@@ -103,3 +132,153 @@ void Xil_SetTlbAttributes(UINTPTR Addr, u64 attrib)
     isb(); /* synchronize context on this processor */
 
 }
+
+/*****************************************************************************/
+/**
+* @brief	It returns the level 3 table for the 2MB block at *ptr, splitting
+*			the block if needed. The pages of a split block keep the
+*			attributes of the block.
+*
+* @param	ptr: Pointer to the level 2 descriptor.
+* @param	BlockAddr: 2MB aligned address mapped by the descriptor.
+*
+* @return	Pointer to the level 3 table, or NULL if no table is left.
+*
+******************************************************************************/
+static INTPTR *Xil_MmuGetL3Table(INTPTR *ptr, UINTPTR BlockAddr)
+{
+	INTPTR *table = NULL;
+#if XIL_MMU_NUM_L3_TABLES > 0U
+	u64 blockattr;
+	u32 index;
+
+	if (((u64)*ptr & DESC_TYPE_MASK) == DESC_TYPE_TABLE) {
+		table = (INTPTR *)((u64)*ptr & DESC_ADDR_MASK);
+	} else if (MMUTableL3Used < XIL_MMU_NUM_L3_TABLES) {
+		table = MMUTableL3[MMUTableL3Used];
+		MMUTableL3Used++;
+		blockattr = (u64)*ptr & ~DESC_ADDR_MASK;
+		for (index = 0U; index < ENTRIES_PER_TABLE; index++) {
+			table[index] = (INTPTR)((BlockAddr + (index * PAGE_SIZE_4KB)) |
+					blockattr | DESC_TYPE_PAGE);
+		}
+		/* Pages must be visible to the table walk before they are linked */
+		dsb();
+		*ptr = (INTPTR)((UINTPTR)table | DESC_TYPE_TABLE);
+	}
+#else
+	(void)ptr;
+	(void)BlockAddr;
+#endif
+
+	return table;
+}
+
+/*****************************************************************************/
+/**
+* @brief	It sets the memory attributes for an address range in the
+*			translation table. Below 4GB, 2MB blocks fully inside the range
+*			are updated as a whole. A 2MB block only partly covered is split
+*			into 4KB pages, if a level 3 table is available
+*			(XIL_MMU_NUM_L3_TABLES). Above 4GB, the attributes are set for
+*			each 1GB block the range touches.
+*			The data cache is flushed and the TLB is invalidated once for the
+*			whole range. The TLB is invalidated by VA when the range spans at
+*			most TLBI_VA_MAX_ENTRIES blocks and pages.
+*
+* @param	Addr: 64-bit start address of the range.
+* @param	Size: Size of the range in bytes.
+* @param	attrib: Attribute for the specified memory region. xil_mmu.h
+*			contains commonly used memory attributes definitions which can be
+*			utilized for this function.
+*
+* @return	XST_SUCCESS if the whole range is updated. XST_FAILURE if a 2MB
+*			block had to be split and no level 3 table was left. The blocks
+*			before it are updated in that case.
+*
+* @note		The MMU and D-cache need not be disabled before changing an
+*			translation table attribute.
+*
+******************************************************************************/
+s32 Xil_SetTlbAttributesRange(UINTPTR Addr, u64 Size, u64 attrib)
+{
+	s32 Status = XST_SUCCESS;
+	INTPTR *ptr;
+	INTPTR *table;
+	UINTPTR end = Addr + Size;
+	UINTPTR blockaddr;
+	UINTPTR pageaddr;
+	UINTPTR cur = Addr;
+	UINTPTR va;
+	u64 block_size;
+	u64 step;
+	u32 entries = 0U;
+
+	while (cur < end) {
+		if (cur < ADDRESS_LIMIT_4GB) {
+			block_size = BLOCK_SIZE_2MB;
+			blockaddr = cur & (~(block_size - 1U));
+			ptr = &MMUTableL2 + (blockaddr / block_size);
+			if (((cur != blockaddr) || ((end - blockaddr) < block_size)) ||
+			    (((u64)*ptr & DESC_TYPE_MASK) == DESC_TYPE_TABLE)) {
+				table = Xil_MmuGetL3Table(ptr, blockaddr);
+				if (table == NULL) {
+					Status = XST_FAILURE;
+					break;
+				}
+				pageaddr = cur & (~((UINTPTR)PAGE_SIZE_4KB - 1U));
+				while ((pageaddr < end) &&
+				       (pageaddr < (blockaddr + block_size))) {
+					table[(pageaddr - blockaddr) / PAGE_SIZE_4KB] =
+						(INTPTR)(pageaddr | attrib | DESC_TYPE_PAGE);
+					pageaddr += PAGE_SIZE_4KB;
+					entries++;
+				}
+			} else {
+				entries++;
+				*ptr = (INTPTR)(blockaddr | attrib);
+			}
+		} else {
+			block_size = BLOCK_SIZE_1GB;
+			blockaddr = cur & (~(block_size - 1U));
+			ptr = &MMUTableL1 + (blockaddr / block_size);
+			*ptr = (INTPTR)(blockaddr | attrib);
+			entries++;
+		}
+		cur = blockaddr + block_size;
+	}
+
+	Xil_DCacheFlush();
+
+	if (entries > TLBI_VA_MAX_ENTRIES) {
+		if (EL3 == 1)
+			mtcptlbi(ALLE3);
+		else if (EL1_NONSECURE == 1)
+			mtcptlbi(VMALLE1);
+	} else {
+		/* One VA per updated block or page */
+		va = Addr;
+		while (va < cur) {
+			if (va < ADDRESS_LIMIT_4GB) {
+				ptr = &MMUTableL2 + (va / BLOCK_SIZE_2MB);
+				if (((u64)*ptr & DESC_TYPE_MASK) == DESC_TYPE_TABLE) {
+					step = PAGE_SIZE_4KB;
+				} else {
+					step = BLOCK_SIZE_2MB;
+				}
+			} else {
+				step = BLOCK_SIZE_1GB;
+			}
+			if (EL3 == 1)
+				mtcptlbiva(VAE3, va >> 12U);
+			else if (EL1_NONSECURE == 1)
+				mtcptlbiva(VAAE1, va >> 12U);
+			va = (va & (~(step - 1U))) + step;
+		}
+	}
+
+	dsb(); /* ensure completion of the BP and TLB invalidation */
+	isb(); /* synchronize context on this processor */
+
+	return Status;
+}
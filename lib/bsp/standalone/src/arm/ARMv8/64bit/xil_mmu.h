@@ -20,6 +20,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 5.00 	pkp  05/29/14 First release
+* 9.10  fl   10/14/26 Added Xil_SetTlbAttributesRange.
 * </pre>
 *
 * @note
@@ -83,6 +84,7 @@ extern "C" {
  */
 
 void Xil_SetTlbAttributes(UINTPTR Addr, u64 attrib);
+s32 Xil_SetTlbAttributesRange(UINTPTR Addr, u64 Size, u64 attrib);
 
 #ifdef __cplusplus
 }
@@ -23,6 +23,7 @@
 * 7.2   dp       04/30/20 Added clobber "cc" to mtcpsr for aarch32 processors
 * 8.0   mus      02/24/22 Added macro mfcpnotoken and mtcpnotoken.
 * 8.1   asa      02/13/23 Create macros to read ESR, FAR and ELR registers.
+* 9.1   fl       10/14/26 Added mtcptlbiva macro.
 * </pre>
 *
 ******************************************************************************/
@@ -233,6 +234,7 @@ extern "C" {
 
 #define mtcpicall(reg)	__asm__ __volatile__("ic " #reg)
 #define mtcptlbi(reg)	__asm__ __volatile__("tlbi " #reg)
+#define mtcptlbiva(reg,val)	__asm__ __volatile__("tlbi " #reg ",%0"  : : "r" (val))
 #define mtcpat(reg,val)	__asm__ __volatile__("at " #reg ",%0"  : : "r" (val))
 /* CP15 operations */
 #define mfcp(reg)	({u64 rval = 0U;\
@@ -150,6 +150,24 @@
 * D) The spinlock mechanism can be used to protect any critical region
 *    implemented through shared memory space.
 *
+* Ticket locks:
+* Xil_TicketLock and Xil_TicketUnlock work on an XTicketLock instance, so
+* independent resources can each have their own lock instead of all CPUs
+* contending on the single lock above. They are available for all ARM
+* processors, including the Cortex-A53/A72/A78 clusters in 64 bit mode.
+* A) Each CPU takes a ticket with an atomic increment and waits until the
+*    lock owner reaches its ticket, so waiters are served first come first
+*    served. The atomics are the compiler __atomic builtins, which use the
+*    LSE instructions when the processor has them (Cortex-A78) and load/
+*    store exclusive otherwise.
+* B) Waiting CPUs sleep in WFE and are woken by the SEV issued on unlock.
+* C) The XTicketLock must be in memory coherent between the CPUs: inner
+*    shareable normal memory in a coherent A53/A72/A78 cluster, or strongly
+*    ordered or device memory as described above for R5 and A9.
+* D) One CPU calls Xil_TicketLockInit before any CPU uses the lock.
+* E) With XIL_SPINLOCK_STATS defined, the lock counts the number of times it
+*    was taken and the number of times a CPU had to wait for it.
+*
 * IMPORTANT NOTE: Circular spinlocks are not allowed (as expected).
 * Use case where an application calls Xil_SpinLock back to back without
 * calling Xil_SpinUnlock in between will/may result in a deadlock
@@ -165,15 +183,17 @@
 *                         dereferencing to address zero.
 * 7.7	sk	 01/10/22 Update values from signed to unsigned to fix
 * 			  misra_c_2012_rule_10_4 violation.
+* 9.1	fl	 10/14/26 Added instance based ticket locks.
 * </pre>
 *
 ******************************************************************************/
 
 
 /***************************** Include Files ********************************/
-#if !defined (__aarch64__) && defined(__GNUC__) && !defined(__clang__)
 #include "xil_spinlock.h"
 
+#if !defined (__aarch64__) && defined(__GNUC__) && !defined(__clang__)
+
 
 /************************** Constant Definitions ****************************/
 
@@ -366,3 +386,100 @@ u32 Xil_IsSpinLockEnabled(void)
     return retVal;
 }
 #endif /* !(__aarch64__) &&  (__GNUC__) && !(__clang__)*/
+
+#if defined(__GNUC__)
+/****************************************************************************/
+/**
+* @brief	Initializes a ticket lock in the released state.
+*
+* @param    Lock: Pointer to the ticket lock.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_TicketLockInit(XTicketLock *Lock)
+{
+	Lock->Next = 0U;
+	Lock->Owner = 0U;
+#ifdef XIL_SPINLOCK_STATS
+	Lock->Acquired = 0U;
+	Lock->Contended = 0U;
+#endif
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+/****************************************************************************/
+/**
+* @brief	Takes a ticket lock. The control returns once all the CPUs that
+*           asked for the lock earlier have released it.
+*
+* @param    Lock: Pointer to the ticket lock.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_TicketLock(XTicketLock *Lock)
+{
+	u32 Ticket = __atomic_fetch_add(&Lock->Next, 1U, __ATOMIC_RELAXED);
+#ifdef XIL_SPINLOCK_STATS
+	u32 Waited = 0U;
+#endif
+
+	while (__atomic_load_n(&Lock->Owner, __ATOMIC_ACQUIRE) != Ticket) {
+#ifdef XIL_SPINLOCK_STATS
+		Waited = 1U;
+#endif
+		__asm__ __volatile__("wfe" : : : "memory");
+	}
+
+#ifdef XIL_SPINLOCK_STATS
+	Lock->Acquired++;
+	Lock->Contended += Waited;
+#endif
+}
+
+/****************************************************************************/
+/**
+* @brief	Takes a ticket lock only if it is free.
+*
+* @param    Lock: Pointer to the ticket lock.
+*
+* @return   XST_SUCCESS: If the lock was taken.
+*           XST_FAILURE: If the lock is held or other CPUs are waiting
+*           for it.
+*
+*****************************************************************************/
+u32 Xil_TicketTryLock(XTicketLock *Lock)
+{
+	u32 Owner = __atomic_load_n(&Lock->Owner, __ATOMIC_RELAXED);
+	u32 Ticket = Owner;
+
+	if (__atomic_compare_exchange_n(&Lock->Next, &Ticket, Owner + 1U, 0,
+			__ATOMIC_ACQUIRE, __ATOMIC_RELAXED) == 0) {
+		return XST_FAILURE;
+	}
+
+#ifdef XIL_SPINLOCK_STATS
+	Lock->Acquired++;
+#endif
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* @brief	Releases a ticket lock taken with Xil_TicketLock or
+*           Xil_TicketTryLock and wakes up the waiting CPUs.
+*
+* @param    Lock: Pointer to the ticket lock.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_TicketUnlock(XTicketLock *Lock)
+{
+	__atomic_store_n(&Lock->Owner, Lock->Owner + 1U, __ATOMIC_RELEASE);
+	/* Make the release visible before waking up the waiters */
+	__asm__ __volatile__("dsb sy\n"
+			     "sev" : : : "memory");
+}
+#endif /* __GNUC__ */
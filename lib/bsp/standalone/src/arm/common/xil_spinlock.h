@@ -25,6 +25,7 @@
 * 7.7	sk	 01/10/22 Update XIL_SPINLOCK_ENABLED from signed to unsigned to
 * 			  fix misra_c_2012_rule_10_4 violation.
 * 9.0   ml       03/03/23 Add description to fix doxygen warnings.
+* 9.1   fl       10/14/26 Added instance based ticket locks.
 * </pre>
 *
 ******************************************************************************/
@@ -75,6 +76,29 @@ u32 Xil_IsSpinLockEnabled(void);
 #define XIL_SPINUNLOCK() /**< Release the lock previously taken */
 #endif /* !(__aarch64__) &&  (__GNUC__) && !(__clang__)*/
 
+#if defined(__GNUC__)
+/**************************** Type Definitions ******************************/
+/**
+ * Ticket lock instance. Waiters are served in the order they arrived.
+ * The instance must be in memory shared and coherent between the CPUs
+ * using it, see xil_spinlock.c.
+ */
+typedef struct {
+	volatile u32 Next;	/**< Next ticket to hand out */
+	volatile u32 Owner;	/**< Ticket currently holding the lock */
+#ifdef XIL_SPINLOCK_STATS
+	volatile u32 Acquired;	/**< Number of times the lock was taken */
+	volatile u32 Contended;	/**< Number of times a CPU had to wait */
+#endif
+} XTicketLock;
+
+/************************** Function Prototypes *****************************/
+void Xil_TicketLockInit(XTicketLock *Lock);
+void Xil_TicketLock(XTicketLock *Lock);
+u32 Xil_TicketTryLock(XTicketLock *Lock);
+void Xil_TicketUnlock(XTicketLock *Lock);
+#endif /* __GNUC__ */
+
 
 #ifdef __cplusplus
 }
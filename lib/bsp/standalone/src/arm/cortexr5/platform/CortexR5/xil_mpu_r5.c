@@ -58,6 +58,9 @@
 *                     arm/cortexr5/platform/versal/ directory. There will be
 *                     separate file for CortexR52.
 * 9.0  ml   04/26/23  Updated code to fix overrun coverity warnings.
+* 9.1  fl   10/14/26  Added Xil_MPURegionSetInit, Xil_MPURegionSetAdd and
+*                     Xil_MPURegionSetApply to switch a precomputed set of
+*                     regions with one barrier sequence.
 * </pre>
 *
 *
@@ -657,3 +660,130 @@ void *Xil_MemMap(UINTPTR PhysAddr, size_t size, u32 flags)
 	}
 	return NULL;
 }
+
+/*****************************************************************************/
+/**
+* @brief    Clears a MPU region set.
+*
+* @param	Set: Region set to be cleared.
+* @return	None.
+*
+******************************************************************************/
+void Xil_MPURegionSetInit(XMpu_RegionSet *Set)
+{
+	Set->NumRegions = 0U;
+}
+
+/*****************************************************************************/
+/**
+* @brief    Adds a region to a MPU region set. The register values are
+*           computed here, so that Xil_MPURegionSetApply only writes them.
+*
+* @param	Set: Region set the region is added to.
+* @param	reg_num: The region number to be programmed.
+* @param	addr: 32 bit address for start of the region.
+* @param	size: Requested size of the region, 0 to disable the region.
+* @param	attrib: Attribute for the corresponding region.
+* @return	XST_SUCCESS: If the region is added to the set.
+* 			XST_FAILURE: If the region number is 16 or more, or the set
+* 			is full.
+*
+******************************************************************************/
+u32 Xil_MPURegionSetAdd(XMpu_RegionSet *Set, u32 reg_num, INTPTR addr,
+			u64 size, u32 attrib)
+{
+	struct XMpuRegionEntry *Entry;
+	INTPTR Localaddr = addr;
+	u32 Regionsize = 0U;
+	u32 Index;
+
+	if ((reg_num >= MAX_POSSIBLE_MPU_REGS) ||
+	    (Set->NumRegions >= MAX_POSSIBLE_MPU_REGS)) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "Invalid region number\r\n");
+		return XST_FAILURE;
+	}
+
+	Entry = &Set->Region[Set->NumRegions];
+	Entry->RegNum = reg_num;
+
+	if (size == 0U) {
+		Entry->BaseAddress = 0U;
+		Entry->SizeEn = 0U;
+		Entry->Attribute = 0U;
+		Entry->Size = 0U;
+	} else {
+		/* Lookup the size.  */
+		for (Index = 0; Index <
+		     (sizeof (region_size) / sizeof (region_size[0])); Index++) {
+			if (size <= region_size[Index].size) {
+				Regionsize = region_size[Index].encoding;
+				break;
+			}
+		}
+		if (Index == (sizeof (region_size) / sizeof (region_size[0]))) {
+			Index -= 1U;
+		}
+		Localaddr &= (UINTPTR)(~(region_size[Index].size - 1U));
+		Regionsize <<= 1;
+		Regionsize |= REGION_EN;
+
+		Entry->BaseAddress = (u32)Localaddr;
+		Entry->SizeEn = Regionsize;
+		Entry->Attribute = attrib;
+		Entry->Size = region_size[Index].size;
+	}
+	Set->NumRegions++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief    Programs all regions of a MPU region set. The regions are written
+*           back to back, with a single DSB before and DSB/ISB after the set,
+*           and the MPU configuration table is updated. Regions of the MPU
+*           that are not in the set are not changed.
+*
+* @param	Set: Region set to be programmed.
+* @return	None.
+*
+* @note     No cache maintenance is done. Memory whose attributes change from
+*           cacheable to non-cacheable must be flushed by the caller before.
+*           The caller also has to make sure no other code changes the MPU
+*           while the set is written, e.g. by masking interrupts.
+*
+******************************************************************************/
+void Xil_MPURegionSetApply(const XMpu_RegionSet *Set)
+{
+	const struct XMpuRegionEntry *Entry;
+	u32 Index;
+
+	dsb();
+	for (Index = 0U; Index < Set->NumRegions; Index++) {
+		Entry = &Set->Region[Index];
+		mtcp(XREG_CP15_MPU_MEMORY_REG_NUMBER, Entry->RegNum);
+		/* The region registers are banked by the region number */
+		isb();
+		mtcp(XREG_CP15_MPU_REG_SIZE_EN, 0U);
+		mtcp(XREG_CP15_MPU_REG_BASEADDR, Entry->BaseAddress);
+		mtcp(XREG_CP15_MPU_REG_ACCESS_CTRL, Entry->Attribute);
+		mtcp(XREG_CP15_MPU_REG_SIZE_EN, Entry->SizeEn);
+	}
+	dsb();
+	isb();
+
+	for (Index = 0U; Index < Set->NumRegions; Index++) {
+		Entry = &Set->Region[Index];
+		if ((Entry->SizeEn & REGION_EN) != 0U) {
+			Mpu_Config[Entry->RegNum].RegionStatus = MPU_REG_ENABLED;
+			Mpu_Config[Entry->RegNum].BaseAddress = (INTPTR)Entry->BaseAddress;
+			Mpu_Config[Entry->RegNum].Size = Entry->Size;
+			Mpu_Config[Entry->RegNum].Attribute = Entry->Attribute;
+		} else {
+			Mpu_Config[Entry->RegNum].RegionStatus = MPU_REG_DISABLED;
+			Mpu_Config[Entry->RegNum].BaseAddress = 0;
+			Mpu_Config[Entry->RegNum].Size = 0U;
+			Mpu_Config[Entry->RegNum].Attribute = 0U;
+		}
+	}
+}
@@ -56,6 +56,8 @@
 * 9.0   ml   03/03/23  Add description to fix doxygen warnings.
 * 9.0   mus  04/20/23  Removed CortexR52 specific changes, separate file is
 *                      created for CortexR52.
+* 9.1   fl   10/14/26  Added the MPU region set APIs Xil_MPURegionSetInit,
+*                      Xil_MPURegionSetAdd and Xil_MPURegionSetApply.
 * </pre>
 *
 *
@@ -87,6 +89,26 @@ struct XMpuConfig{
 
 typedef struct XMpuConfig XMpu_Config[MAX_POSSIBLE_MPU_REGS];
 
+/*
+ * One region of a region set, with the register values precomputed by
+ * Xil_MPURegionSetAdd
+ */
+struct XMpuRegionEntry{
+	u32 RegNum; /* MPU region number */
+	u32 BaseAddress; /* Region base address register value */
+	u32 SizeEn; /* Region size and enable register value */
+	u32 Attribute; /* Region access control register value */
+	u64 Size; /* MPU region size */
+};
+
+/*
+ * Set of MPU regions written in one go by Xil_MPURegionSetApply
+ */
+typedef struct {
+	u32 NumRegions; /* Number of valid entries in Region */
+	struct XMpuRegionEntry Region[MAX_POSSIBLE_MPU_REGS];
+} XMpu_RegionSet;
+
 extern XMpu_Config Mpu_Config;
 /************************** Constant Definitions *****************************/
 
@@ -109,6 +131,10 @@ u32 Xil_DisableMPURegionByRegNum (u32 reg_num);
 u16 Xil_GetMPUFreeRegMask (void);
 u32 Xil_SetMPURegionByRegNum (u32 reg_num, INTPTR addr, u64 size, u32 attrib);
 void* Xil_MemMap(UINTPTR PhysAddr, size_t size, u32 flags);
+void Xil_MPURegionSetInit(XMpu_RegionSet *Set);
+u32 Xil_MPURegionSetAdd(XMpu_RegionSet *Set, u32 reg_num, INTPTR addr,
+			u64 size, u32 attrib);
+void Xil_MPURegionSetApply(const XMpu_RegionSet *Set);
 
 #ifdef __cplusplus
 }
@@ -16,6 +16,9 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 9.0   mus  04/19/23 Initial version
+* 9.1   fl   10/14/26 Added Xil_MPURegionSetInit, Xil_MPURegionSetAdd and
+*                     Xil_MPURegionSetApply to switch a precomputed set of
+*                     regions with one barrier sequence.
 * </pre>
 *
 *
@@ -829,3 +832,100 @@ void *Xil_MemMap(UINTPTR PhysAddr, size_t size, u32 flags)
                                         size, flags) == XST_SUCCESS) ?
                                         (void *)(PhysAddr & XMPU_PBAR_REG_BASEADDR_MASK) : NULL);
 }
+
+/*****************************************************************************/
+/**
+* @brief    Clears a MPU region set.
+*
+* @param	Set: Region set to be cleared.
+* @return	None.
+*
+******************************************************************************/
+void Xil_MPURegionSetInit(XMpu_RegionSet *Set)
+{
+	Set->NumRegions = 0U;
+}
+
+/*****************************************************************************/
+/**
+* @brief    Adds a region to a MPU region set. The PRBAR/PRLAR values are
+*           computed here, so that Xil_MPURegionSetApply only writes them.
+*
+* @param	Set: Region set the region is added to.
+* @param	reg_num: The region number to be programmed.
+* @param	addr: Start address of the region, truncated to 64 byte
+*           alignment.
+* @param	size: Requested size of the region, 0 to disable the region.
+* @param	attrib: Attribute for the corresponding region.
+* @return	XST_SUCCESS: If the region is added to the set.
+* 			XST_FAILURE: If the region number is 16 or more, the set is
+* 			full or the region wraps around the address space.
+*
+******************************************************************************/
+u32 Xil_MPURegionSetAdd(XMpu_RegionSet *Set, u32 reg_num, UINTPTR addr,
+			u64 size, u32 attrib)
+{
+	struct XMpuRegionEntry *Entry;
+	UINTPTR LocalAddr = addr & XMPU_PBAR_REG_BASEADDR_MASK;
+
+	if ((reg_num >= MAX_POSSIBLE_MPU_REGS) ||
+	    (Set->NumRegions >= MAX_POSSIBLE_MPU_REGS) ||
+	    (((u64)LocalAddr + size) > 0x100000000U)) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "Invalid region\r\n");
+		return XST_FAILURE;
+	}
+
+	Entry = &Set->Region[Set->NumRegions];
+	Entry->RegNum = reg_num;
+
+	if (size == 0U) {
+		Entry->Prbar = 0U;
+		Entry->Prlar = 0U;
+	} else {
+		Entry->Prbar = LocalAddr | (attrib & XMPU_PBAR_REG_ATTRIBUTE_MASK);
+		Entry->Prlar = ((u32)(LocalAddr + size - 1U)) & XMPU_PRLAR_REG_ENDADDR_MASK;
+		Entry->Prlar |= ((attrib >> XMPU_PRLAR_ATTRIBUTE_SHIFT) & XMPU_PRLAR_REG_ATTRIBUTE_MASK);
+		Entry->Prlar |= REGION_EN;
+	}
+	Set->NumRegions++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief    Programs all regions of a MPU region set. The regions are written
+*           back to back, with a single DSB before and DSB/ISB after the set.
+*           Unlike Xil_SetTlbAttributes, the MPU stays enabled and the regions
+*           that are not in the set are not changed.
+*
+* @param	Set: Region set to be programmed.
+* @return	None.
+*
+* @note     The regions of the set must not overlap each other or the other
+*           enabled regions. They are not added to Mpu_Config, so a later
+*           Xil_SetTlbAttributes or Xil_DisableMPURegionByRegNum, which
+*           reprogram the MPU from Mpu_Config, drop them; the set has to be
+*           applied again then. No cache maintenance is done: memory whose
+*           attributes change from cacheable to non-cacheable must be flushed
+*           by the caller before.
+*
+******************************************************************************/
+void Xil_MPURegionSetApply(const XMpu_RegionSet *Set)
+{
+	const struct XMpuRegionEntry *Entry;
+	u32 Index;
+
+	dsb();
+	for (Index = 0U; Index < Set->NumRegions; Index++) {
+		Entry = &Set->Region[Index];
+		mtcp(XREG_CP15_MPU_MEMORY_REG_NUMBER, Entry->RegNum);
+		/* PRBAR/PRLAR are banked by PRSELR */
+		isb();
+		mtcp(XREG_CP15_MPU_REG_SIZE_EN, 0U);
+		mtcp(XREG_CP15_MPU_REG_BASEADDR, Entry->Prbar);
+		mtcp(XREG_CP15_MPU_REG_SIZE_EN, Entry->Prlar);
+	}
+	dsb();
+	isb();
+}
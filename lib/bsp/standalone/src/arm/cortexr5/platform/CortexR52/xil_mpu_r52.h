@@ -36,6 +36,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 9.0   mus  04/19/23 Initial version
+* 9.1   fl   10/14/26 Added the MPU region set APIs Xil_MPURegionSetInit,
+*                     Xil_MPURegionSetAdd and Xil_MPURegionSetApply.
 * </pre>
 *
 *
@@ -87,6 +89,24 @@ struct XMpuConfig{
 
 typedef struct XMpuConfig XMpu_Config[MAX_POSSIBLE_MPU_REGS];
 
+/*
+ * One region of a region set, with the register values precomputed by
+ * Xil_MPURegionSetAdd
+ */
+struct XMpuRegionEntry{
+	u32 RegNum; /* MPU region number */
+	u32 Prbar; /* Region base address register value */
+	u32 Prlar; /* Region limit address register value */
+};
+
+/*
+ * Set of MPU regions written in one go by Xil_MPURegionSetApply
+ */
+typedef struct {
+	u32 NumRegions; /* Number of valid entries in Region */
+	struct XMpuRegionEntry Region[MAX_POSSIBLE_MPU_REGS];
+} XMpu_RegionSet;
+
 extern XMpu_Config Mpu_Config;
 /************************** Constant Definitions *****************************/
 
@@ -108,6 +128,10 @@ u32 Xil_DisableMPURegionByRegNum (u32 reg_num) __attribute__((__section__(".boot
 u16 Xil_GetMPUFreeRegMask (void);
 u32 Xil_SetMPURegionByRegNum (u32 reg_num, UINTPTR addr, u64 size, u32 attrib);
 void* Xil_MemMap(UINTPTR PhysAddr, size_t size, u32 flags);
+void Xil_MPURegionSetInit(XMpu_RegionSet *Set);
+u32 Xil_MPURegionSetAdd(XMpu_RegionSet *Set, u32 reg_num, UINTPTR addr,
+			u64 size, u32 attrib);
+void Xil_MPURegionSetApply(const XMpu_RegionSet *Set);
 
 #ifdef __cplusplus
 }
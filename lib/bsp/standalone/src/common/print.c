@@ -29,7 +29,11 @@ void print(const char8 *ptr)
 #else
 #if defined(STDOUT_BASEADDRESS) || defined(SDT)
   while (*ptr != (char8)0) {
+#ifdef XIL_PRINTF_BUFFERED
+    xil_printf_putc (*ptr);
+#else
     outbyte (*ptr);
+#endif
 	ptr++;
   }
 #else
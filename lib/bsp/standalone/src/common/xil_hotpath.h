@@ -0,0 +1,56 @@
+/******************************************************************************/
+/**
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_hotpath.h
+*
+* @addtogroup common_hotpath_api Hot Code Placement Macros
+*
+* The xil_hotpath.h file contains the macros that place a function or an
+* object in the hot sections of the generated linker script. When the
+* application linker script is generated with HOT_MEM set, the .hot_text and
+* .hot_data sections go to that memory, typically TCM or OCM. Otherwise they
+* are linked with .text and .data and the macros have no effect.
+*
+* Hot data must be initialized; zero initialized objects stay in .bss.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 9.1   fl       10/14/26 First release.
+* </pre>
+*
+*****************************************************************************/
+#ifndef XIL_HOTPATH_H	/**< prevent circular inclusions */
+#define XIL_HOTPATH_H	/**< by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************** Macros (Inline Functions) Definitions ********************/
+#if defined (__GNUC__)
+/** Places a function in the .hot_text section */
+#define XIL_HOT_TEXT	__attribute__ ((section (".hot_text")))
+/** Places an initialized object in the .hot_data section */
+#define XIL_HOT_DATA	__attribute__ ((section (".hot_data")))
+#else
+#define XIL_HOT_TEXT
+#define XIL_HOT_DATA
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_HOTPATH_H */
+/**
+* @} End of "addtogroup common_hotpath_api".
+*/
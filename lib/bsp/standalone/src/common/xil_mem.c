@@ -8,8 +8,8 @@
 /**
 * @file xil_mem.c
 *
-* This file contains xil mem copy function to use in case of word aligned
-* data copies.
+* This file contains xil mem copy and set functions to use in case of word
+* aligned data.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -22,6 +22,11 @@
 * 			  violations.
 * 7.7	sk	 01/10/22 Include xil_mem.h header file to fix Xil_MemCpy
 * 			  prototype misra_c_2012_rule_8_4 violation.
+* 9.1	fl	 10/14/26 Copy co-aligned buffers in unrolled blocks of
+* 			  native words after aligning the destination.
+* 	fl	 10/14/26 Use 64-bit words on RV64 and add Xil_MemSet.
+* 	fl	 10/14/26 Keep 32-bit accesses in Xil_MemCpy and Xil_MemSet,
+* 			  add Xil_MemCpy64 for normal memory.
 *
 * </pre>
 *
@@ -32,6 +37,29 @@
 #include "xil_types.h"
 #include "xil_mem.h"
 
+/************************** Constant Definitions *****************************/
+/*
+ * Xil_MemCpy and Xil_MemSet access memory 32 bits at most at a time, so they
+ * can be used on device memory and peripherals that only take 32-bit
+ * accesses. The unrolled loop lets the compiler use LDM/STM on 32-bit ARM.
+ */
+#define XIL_MEM_WORD_SIZE	((u32)sizeof(u32))
+#define XIL_MEM_WORD_MASK	((UINTPTR)XIL_MEM_WORD_SIZE - 1U)
+#define XIL_MEM_BLOCK_WORDS	(8U)
+#define XIL_MEM_BLOCK_SIZE	(XIL_MEM_BLOCK_WORDS * XIL_MEM_WORD_SIZE)
+
+/*
+ * Xil_MemCpy64 copies in 64-bit words on 64-bit processors, which lets the
+ * compiler use LDP/STP on AArch64.
+ */
+#if defined (__aarch64__) || defined (__arch64__) || \
+	(defined (__riscv) && (__riscv_xlen == 64))
+#define XIL_MEM_64BIT
+#define XIL_MEM_DWORD_SIZE	((u32)sizeof(u64))
+#define XIL_MEM_DWORD_MASK	((UINTPTR)XIL_MEM_DWORD_SIZE - 1U)
+#define XIL_MEM_DBLOCK_SIZE	(XIL_MEM_BLOCK_WORDS * XIL_MEM_DWORD_SIZE)
+#endif
+
 /***************** Inline Functions Definitions ********************/
 /*****************************************************************************/
 /**
@@ -43,11 +71,61 @@
 *
 * @param       cnt: 32 bit length of bytes to be copied
 *
+* @note        Memory is accessed 32 bits at most at a time.
+*
 *****************************************************************************/
 void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 {
 	char *d = (char*)(void *)dst;
 	const char *s = src;
+	u32 *dw;
+	const u32 *sw;
+	u32 w0, w1, w2, w3, w4, w5, w6, w7;
+
+	/*
+	 * When source and destination have the same alignment, copy the
+	 * unaligned head byte wise and the bulk in blocks of words.
+	 */
+	if ((((UINTPTR)d ^ (UINTPTR)s) & XIL_MEM_WORD_MASK) == 0U) {
+		while ((((UINTPTR)d & XIL_MEM_WORD_MASK) != 0U) && (cnt > 0U)) {
+			*d = *s;
+			d += 1U;
+			s += 1U;
+			cnt -= 1U;
+		}
+
+		dw = (u32 *)(void *)d;
+		sw = (const u32 *)(const void *)s;
+		while (cnt >= XIL_MEM_BLOCK_SIZE) {
+			w0 = sw[0U];
+			w1 = sw[1U];
+			w2 = sw[2U];
+			w3 = sw[3U];
+			w4 = sw[4U];
+			w5 = sw[5U];
+			w6 = sw[6U];
+			w7 = sw[7U];
+			dw[0U] = w0;
+			dw[1U] = w1;
+			dw[2U] = w2;
+			dw[3U] = w3;
+			dw[4U] = w4;
+			dw[5U] = w5;
+			dw[6U] = w6;
+			dw[7U] = w7;
+			dw += XIL_MEM_BLOCK_WORDS;
+			sw += XIL_MEM_BLOCK_WORDS;
+			cnt -= XIL_MEM_BLOCK_SIZE;
+		}
+		while (cnt >= XIL_MEM_WORD_SIZE) {
+			*dw = *sw;
+			dw += 1U;
+			sw += 1U;
+			cnt -= XIL_MEM_WORD_SIZE;
+		}
+		d = (char *)(void *)dw;
+		s = (const char *)(const void *)sw;
+	}
 
 	while (cnt >= sizeof (s32)) {
 		*(s32*)d = *(s32*)s;
@@ -68,3 +146,132 @@ void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 		cnt -= 1U;
 	}
 }
+
+/*****************************************************************************/
+/**
+* @brief       This function copies memory from one location to other, using
+*              64-bit accesses on 64-bit processors.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       src: pointer pointing to source memory
+*
+* @param       cnt: 32 bit length of bytes to be copied
+*
+* @note        Only use it on normal memory, use Xil_MemCpy for device
+*              memory that does not take 64-bit accesses. On 32-bit
+*              processors it is the same as Xil_MemCpy.
+*
+*****************************************************************************/
+void Xil_MemCpy64(void* dst, const void* src, u32 cnt)
+{
+#ifdef XIL_MEM_64BIT
+	char *d = (char*)(void *)dst;
+	const char *s = src;
+	u64 *dw;
+	const u64 *sw;
+	u64 w0, w1, w2, w3, w4, w5, w6, w7;
+
+	if ((((UINTPTR)d ^ (UINTPTR)s) & XIL_MEM_DWORD_MASK) == 0U) {
+		while ((((UINTPTR)d & XIL_MEM_DWORD_MASK) != 0U) && (cnt > 0U)) {
+			*d = *s;
+			d += 1U;
+			s += 1U;
+			cnt -= 1U;
+		}
+
+		dw = (u64 *)(void *)d;
+		sw = (const u64 *)(const void *)s;
+		while (cnt >= XIL_MEM_DBLOCK_SIZE) {
+			w0 = sw[0U];
+			w1 = sw[1U];
+			w2 = sw[2U];
+			w3 = sw[3U];
+			w4 = sw[4U];
+			w5 = sw[5U];
+			w6 = sw[6U];
+			w7 = sw[7U];
+			dw[0U] = w0;
+			dw[1U] = w1;
+			dw[2U] = w2;
+			dw[3U] = w3;
+			dw[4U] = w4;
+			dw[5U] = w5;
+			dw[6U] = w6;
+			dw[7U] = w7;
+			dw += XIL_MEM_BLOCK_WORDS;
+			sw += XIL_MEM_BLOCK_WORDS;
+			cnt -= XIL_MEM_DBLOCK_SIZE;
+		}
+		while (cnt >= XIL_MEM_DWORD_SIZE) {
+			*dw = *sw;
+			dw += 1U;
+			sw += 1U;
+			cnt -= XIL_MEM_DWORD_SIZE;
+		}
+		d = (char *)(void *)dw;
+		s = (const char *)(const void *)sw;
+	}
+
+	/* Unaligned buffers and the tail */
+	Xil_MemCpy(d, s, cnt);
+#else
+	Xil_MemCpy(dst, src, cnt);
+#endif
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function fills memory with a byte value.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       val: byte value to be written, converted to u8
+*
+* @param       cnt: 32 bit length of bytes to be written
+*
+* @note        Memory is accessed 32 bits at most at a time.
+*
+*****************************************************************************/
+void Xil_MemSet(void* dst, s32 val, u32 cnt)
+{
+	u8 *d = (u8 *)dst;
+	u32 *dw;
+	u32 w = (u32)(u8)val;
+
+	while ((((UINTPTR)d & XIL_MEM_WORD_MASK) != 0U) && (cnt > 0U)) {
+		*d = (u8)val;
+		d += 1U;
+		cnt -= 1U;
+	}
+
+	/* Replicate the byte to every byte lane of the word */
+	w |= w << 8U;
+	w |= w << 16U;
+
+	dw = (u32 *)(void *)d;
+	while (cnt >= XIL_MEM_BLOCK_SIZE) {
+		dw[0U] = w;
+		dw[1U] = w;
+		dw[2U] = w;
+		dw[3U] = w;
+		dw[4U] = w;
+		dw[5U] = w;
+		dw[6U] = w;
+		dw[7U] = w;
+		dw += XIL_MEM_BLOCK_WORDS;
+		cnt -= XIL_MEM_BLOCK_SIZE;
+	}
+	while (cnt >= XIL_MEM_WORD_SIZE) {
+		*dw = w;
+		dw += 1U;
+		cnt -= XIL_MEM_WORD_SIZE;
+	}
+
+	d = (u8 *)(void *)dw;
+	while (cnt > 0U) {
+		*d = (u8)val;
+		d += 1U;
+		cnt -= 1U;
+	}
+}
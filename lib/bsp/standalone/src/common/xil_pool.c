@@ -0,0 +1,221 @@
+/******************************************************************************/
+/**
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_pool.c
+*
+* This file contains the fixed size object pool allocator.
+*
+* Free objects are kept in a singly linked list, with the index of the next
+* free object stored in the first word of each free object. Alloc and free
+* update the list head with a compare and swap, so no lock is taken.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 9.1   fl       10/14/26 First release.
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include "xil_pool.h"
+
+/************************** Constant Definitions *****************************/
+#define XIL_POOL_IDX_MASK	(0xFFFFU)
+#define XIL_POOL_TAG_SHIFT	(16U)
+#define XIL_POOL_TAG_INC	((u32)1U << XIL_POOL_TAG_SHIFT)
+#define XIL_POOL_EMPTY		XIL_POOL_IDX_MASK
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define XIL_POOL_OBJ(Pool, Idx)	\
+	((u32 *)((Pool)->Base + ((UINTPTR)(Idx) * (Pool)->ObjSize)))
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* @brief	Creates a pool of fixed size objects in the given memory region.
+*
+* @param	Pool: Pointer to the pool instance.
+* @param	Mem: Start of the memory region holding the objects.
+* @param	MemSize: Size of the memory region in bytes.
+* @param	ObjSize: Size of each object in bytes.
+* @param	Align: Alignment of each object in bytes, a power of 2 of at
+*		least XIL_POOL_MIN_ALIGN. Use the cache line size for objects
+*		accessed by DMA in cacheable memory.
+*
+* @return	XST_SUCCESS if the pool is created,
+*		XST_INVALID_PARAM if a parameter is invalid or the region does
+*		not hold a single object.
+*
+* @note		Mem is rounded up to Align and ObjSize is rounded up to a
+*		multiple of Align. The pool must not be in use while it is
+*		created.
+*
+******************************************************************************/
+s32 Xil_PoolCreate(XPool *Pool, void *Mem, u32 MemSize, u32 ObjSize,
+		   u32 Align)
+{
+	UINTPTR Base;
+	UINTPTR End;
+	u32 Size;
+	u32 Count;
+	u32 Idx;
+
+	if ((Pool == NULL) || (Mem == NULL) || (ObjSize == 0U) ||
+	    (Align < XIL_POOL_MIN_ALIGN) || ((Align & (Align - 1U)) != 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	Base = ((UINTPTR)Mem + Align - 1U) & ~((UINTPTR)Align - 1U);
+	End = (UINTPTR)Mem + MemSize;
+	Size = (ObjSize + Align - 1U) & ~(Align - 1U);
+	if ((Size < ObjSize) || (Base >= End)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	Count = (u32)((End - Base) / Size);
+	if (Count > XIL_POOL_MAX_OBJS) {
+		Count = XIL_POOL_MAX_OBJS;
+	}
+	if (Count == 0U) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	Pool->Base = Base;
+	Pool->ObjSize = Size;
+	Pool->NumObjs = Count;
+	Pool->InUse = 0U;
+	Pool->HighWater = 0U;
+	for (Idx = 0U; Idx < (Count - 1U); Idx++) {
+		*XIL_POOL_OBJ(Pool, Idx) = Idx + 1U;
+	}
+	*XIL_POOL_OBJ(Pool, Count - 1U) = XIL_POOL_EMPTY;
+	Pool->FreeHead = 0U;
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief	Allocates an object from the pool.
+*
+* @param	Pool: Pointer to the pool instance.
+*
+* @return	Pointer to the object, or NULL if the pool is empty.
+*
+******************************************************************************/
+void *Xil_PoolAlloc(XPool *Pool)
+{
+	u32 Head = __atomic_load_n(&Pool->FreeHead, __ATOMIC_ACQUIRE);
+	u32 NewHead;
+	u32 InUse;
+	u32 HighWater;
+	u32 *Obj;
+
+	do {
+		if ((Head & XIL_POOL_IDX_MASK) == XIL_POOL_EMPTY) {
+			return NULL;
+		}
+		Obj = XIL_POOL_OBJ(Pool, Head & XIL_POOL_IDX_MASK);
+		/*
+		 * The object may be taken by another CPU after the head is
+		 * read; the change counter then makes the exchange fail.
+		 */
+		NewHead = ((Head & ~XIL_POOL_IDX_MASK) + XIL_POOL_TAG_INC) |
+			  (*(volatile u32 *)Obj & XIL_POOL_IDX_MASK);
+	} while (__atomic_compare_exchange_n(&Pool->FreeHead, &Head, NewHead,
+			0, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE) == 0);
+
+	InUse = __atomic_add_fetch(&Pool->InUse, 1U, __ATOMIC_RELAXED);
+	HighWater = __atomic_load_n(&Pool->HighWater, __ATOMIC_RELAXED);
+	while ((InUse > HighWater) &&
+	       (__atomic_compare_exchange_n(&Pool->HighWater, &HighWater,
+			InUse, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED) == 0)) {
+		/* HighWater is updated with the latest value, retry */
+	}
+
+	return (void *)Obj;
+}
+
+/*****************************************************************************/
+/**
+* @brief	Returns an object to the pool.
+*
+* @param	Pool: Pointer to the pool instance.
+* @param	Obj: Object returned by Xil_PoolAlloc.
+*
+* @return	XST_SUCCESS if the object is freed,
+*		XST_INVALID_PARAM if Obj is not an object of the pool.
+*
+******************************************************************************/
+s32 Xil_PoolFree(XPool *Pool, void *Obj)
+{
+	UINTPTR Offset;
+	u32 Idx;
+	u32 Head;
+	u32 NewHead;
+
+	if (((UINTPTR)Obj < Pool->Base) || (Obj == NULL)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+	Offset = (UINTPTR)Obj - Pool->Base;
+	Idx = (u32)(Offset / Pool->ObjSize);
+	if ((Idx >= Pool->NumObjs) ||
+	    ((Offset % Pool->ObjSize) != 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	Head = __atomic_load_n(&Pool->FreeHead, __ATOMIC_RELAXED);
+	do {
+		*(volatile u32 *)Obj = Head & XIL_POOL_IDX_MASK;
+		NewHead = ((Head & ~XIL_POOL_IDX_MASK) + XIL_POOL_TAG_INC) | Idx;
+	} while (__atomic_compare_exchange_n(&Pool->FreeHead, &Head, NewHead,
+			0, __ATOMIC_RELEASE, __ATOMIC_RELAXED) == 0);
+
+	(void)__atomic_sub_fetch(&Pool->InUse, 1U, __ATOMIC_RELAXED);
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief	Returns the number of objects currently allocated from the pool.
+*
+* @param	Pool: Pointer to the pool instance.
+*
+* @return	Number of allocated objects.
+*
+******************************************************************************/
+u32 Xil_PoolGetInUse(const XPool *Pool)
+{
+	return Pool->InUse;
+}
+
+/*****************************************************************************/
+/**
+* @brief	Returns the highest number of objects allocated at the same time
+*		since the pool was created, to size the pool.
+*
+* @param	Pool: Pointer to the pool instance.
+*
+* @return	High-water mark of allocated objects.
+*
+******************************************************************************/
+u32 Xil_PoolGetHighWater(const XPool *Pool)
+{
+	return Pool->HighWater;
+}
@@ -0,0 +1,79 @@
+/******************************************************************************/
+/**
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_pool.h
+*
+* @addtogroup common_pool_api Fixed Size Object Pool APIs
+*
+* The xil_pool.h file contains the fixed size object pool allocator. A pool
+* carves a caller provided memory region into objects of the same size and
+* hands them out in constant time, without the newlib heap and its lock.
+* Because the caller provides the region, the objects can be placed in
+* cache line aligned or non-cacheable (DMA coherent) memory.
+*
+* Allocation and free are lock free. They can be called from interrupt
+* handlers and, when the pool is in memory coherent between the CPUs, from
+* several CPUs at the same time. A pool holds at most XIL_POOL_MAX_OBJS
+* objects.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 9.1   fl       10/14/26 First release.
+* </pre>
+*
+*****************************************************************************/
+#ifndef XIL_POOL_H	/**< prevent circular inclusions */
+#define XIL_POOL_H	/**< by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+#include "xil_types.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions ****************************/
+#define XIL_POOL_MAX_OBJS	(0xFFFFU)	/**< Maximum objects in a pool */
+#define XIL_POOL_MIN_ALIGN	(4U)	/**< Minimum object alignment */
+
+/**************************** Type Definitions ******************************/
+/**
+ * Pool instance. The free list head holds the index of the first free object
+ * in bits 15:0 and a change counter in bits 31:16, so that a concurrent
+ * alloc/free of the same object cannot corrupt the list.
+ */
+typedef struct {
+	UINTPTR Base;		/**< Address of the first object */
+	u32 ObjSize;		/**< Object size including alignment padding */
+	u32 NumObjs;		/**< Number of objects in the pool */
+	volatile u32 FreeHead;	/**< Free list head and change counter */
+	volatile u32 InUse;	/**< Number of allocated objects */
+	volatile u32 HighWater;	/**< Maximum of InUse since creation */
+} XPool;
+
+/************************** Function Prototypes *****************************/
+s32 Xil_PoolCreate(XPool *Pool, void *Mem, u32 MemSize, u32 ObjSize,
+		   u32 Align);
+void *Xil_PoolAlloc(XPool *Pool);
+s32 Xil_PoolFree(XPool *Pool, void *Obj);
+u32 Xil_PoolGetInUse(const XPool *Pool);
+u32 Xil_PoolGetHighWater(const XPool *Pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_POOL_H */
+/**
+* @} End of "addtogroup common_pool_api".
+*/
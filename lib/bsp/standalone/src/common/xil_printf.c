@@ -36,6 +36,112 @@ typedef struct params_s {
     s32 unsigned_flag; /**< unsigned flag */
 } params_t;
 
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#ifdef XIL_PRINTF_BUFFERED
+#define XIL_OUTBYTE(c)	xil_printf_putc(c)
+#else
+#define XIL_OUTBYTE(c)	outbyte(c)
+#endif
+
+#ifdef XIL_PRINTF_BUFFERED
+/************************** Variable Definitions *****************************/
+
+/*
+ * Output ring of the buffered mode. Each core runs its own BSP instance, so
+ * the ring is per core. Formatting code is the only writer of the head and
+ * xil_printf_drain the only writer of the tail, which keeps the ring lock
+ * free as long as prints do not nest (an interrupt handler printing while
+ * the interrupted code is in the middle of a print).
+ */
+static char8 XilPrintfBuf[XIL_PRINTF_BUF_SIZE];
+static volatile u32 XilPrintfHead;
+static volatile u32 XilPrintfTail;
+static volatile u32 XilPrintfOverrun;
+
+/*
+ * Keeps the compiler from moving ring accesses across the head and tail
+ * updates. Both ends of the ring run on the same core, so no hardware
+ * barrier is needed.
+ */
+#if defined (__ICCARM__)
+#define XIL_PRINTF_BARRIER()	asm volatile("" : : : "memory")
+#else
+#define XIL_PRINTF_BARRIER()	__asm__ __volatile__("" : : : "memory")
+#endif
+
+/*****************************************************************************/
+/**
+* This routine queues a byte in the output ring. The byte is dropped and
+* the overrun counter is incremented if the ring is full.
+*
+******************************************************************************/
+void xil_printf_putc(char8 c)
+{
+	u32 Head = XilPrintfHead;
+
+	if ((Head - XilPrintfTail) >= XIL_PRINTF_BUF_SIZE) {
+		XilPrintfOverrun++;
+	} else {
+		XilPrintfBuf[Head & (XIL_PRINTF_BUF_SIZE - 1U)] = c;
+		XIL_PRINTF_BARRIER();
+		XilPrintfHead = Head + 1U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This routine sends up to MaxBytes queued bytes to stdout. It is meant to
+* be called from the idle loop or from the stdout UART TX empty interrupt
+* handler.
+*
+* @return	Number of bytes sent
+*
+******************************************************************************/
+u32 xil_printf_drain(u32 MaxBytes)
+{
+	u32 Tail = XilPrintfTail;
+	u32 Count = 0U;
+
+	while ((Tail != XilPrintfHead) && (Count < MaxBytes)) {
+		XIL_PRINTF_BARRIER();
+#if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
+		outbyte(XilPrintfBuf[Tail & (XIL_PRINTF_BUF_SIZE - 1U)]);
+#endif
+		Tail++;
+		Count++;
+		XIL_PRINTF_BARRIER();
+		XilPrintfTail = Tail;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+* This routine sends all queued bytes to stdout before returning, for use
+* in exception and panic paths.
+*
+******************************************************************************/
+void xil_printf_flush(void)
+{
+	while (xil_printf_drain(XIL_PRINTF_BUF_SIZE) != 0U) {
+		;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This routine returns the number of bytes dropped because the output ring
+* was full.
+*
+******************************************************************************/
+u32 xil_printf_get_overrun(void)
+{
+	return XilPrintfOverrun;
+}
+#endif
+
 
 /*---------------------------------------------------*/
 /* The purpose of this routine is to output data the */
@@ -60,7 +166,7 @@ static void padding( const s32 l_flag, const struct params_s *par)
 		i=(par->len);
         for (; i<(par->num1); i++) {
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-            outbyte( par->pad_character);
+            XIL_OUTBYTE( par->pad_character);
 #endif
 		}
     }
@@ -84,7 +190,7 @@ static void outs(const charptr lp, struct params_s *par)
 		while (((*LocalPtr) != (char8)0) && ((par->num2) != 0)) {
 			(par->num2)--;
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-			outbyte(*LocalPtr);
+			XIL_OUTBYTE(*LocalPtr);
 #endif
 			LocalPtr += 1;
 		}
@@ -145,7 +251,7 @@ static void outnum( const s32 n, const s32 base, struct params_s *par)
     padding( !(par->left_flag), par);
     while (&outbuf[i] >= outbuf) {
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-	outbyte( outbuf[i] );
+	XIL_OUTBYTE( outbuf[i] );
 #endif
 		i--;
 }
@@ -200,7 +306,7 @@ static void outnum1( const s64 n, const s32 base, params_t *par)
     par->len = (s32)strlen(outbuf);
     padding( !(par->left_flag), par);
     while (&outbuf[i] >= outbuf) {
-	outbyte( outbuf[i] );
+	XIL_OUTBYTE( outbuf[i] );
 		i--;
 }
     padding( par->left_flag, par);
@@ -287,7 +393,7 @@ void xil_vprintf(const char8 *ctrl1, va_list argp)
         /* format control is found.                    */
         if (*ctrl != '%') {
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-            outbyte(*ctrl);
+            XIL_OUTBYTE(*ctrl);
 #endif
 			ctrl += 1;
             continue;
@@ -338,7 +444,7 @@ void xil_vprintf(const char8 *ctrl1, va_list argp)
         switch (tolower(ch)) {
             case '%':
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-                outbyte( '%');
+                XIL_OUTBYTE( '%');
 #endif
                 Check = 1;
                 break;
@@ -407,7 +513,7 @@ void xil_vprintf(const char8 *ctrl1, va_list argp)
 
             case 'c':
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-                outbyte( (char8)va_arg( argp, s32));
+                XIL_OUTBYTE( (char8)va_arg( argp, s32));
 #endif
                 Check = 1;
                 break;
@@ -416,28 +522,28 @@ void xil_vprintf(const char8 *ctrl1, va_list argp)
                 switch (*ctrl) {
                     case 'a':
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-                        outbyte( ((char8)0x07));
+                        XIL_OUTBYTE( ((char8)0x07));
 #endif
                         break;
                     case 'h':
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-                        outbyte( ((char8)0x08));
+                        XIL_OUTBYTE( ((char8)0x08));
 #endif
                         break;
                     case 'r':
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-                        outbyte( ((char8)0x0D));
+                        XIL_OUTBYTE( ((char8)0x0D));
 #endif
                         break;
                     case 'n':
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-                        outbyte( ((char8)0x0D));
-                        outbyte( ((char8)0x0A));
+                        XIL_OUTBYTE( ((char8)0x0D));
+                        XIL_OUTBYTE( ((char8)0x0A));
 #endif
                         break;
                     default:
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-                        outbyte( *ctrl);
+                        XIL_OUTBYTE( *ctrl);
 #endif
                         break;
                 }
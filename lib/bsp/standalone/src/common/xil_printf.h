@@ -50,6 +50,21 @@ void print( const char8 *ptr);
 extern void outbyte (char c); /**< To send byte */
 extern char inbyte(void); /**< To receive byte */
 
+#ifdef XIL_PRINTF_BUFFERED
+/**< Size of the buffered mode output ring, must be a power of two */
+#ifndef XIL_PRINTF_BUF_SIZE
+#define XIL_PRINTF_BUF_SIZE	1024U
+#endif
+/**< Queues a byte in the output ring */
+void xil_printf_putc(char8 c);
+/**< Sends up to MaxBytes queued bytes to stdout */
+u32 xil_printf_drain(u32 MaxBytes);
+/**< Sends all queued bytes to stdout */
+void xil_printf_flush(void);
+/**< Returns the number of bytes dropped on a full ring */
+u32 xil_printf_get_overrun(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
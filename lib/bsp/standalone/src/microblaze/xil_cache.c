@@ -24,6 +24,12 @@
 *					  cache/L2 cache. Existing APIs in this file are modified
 *					  to add support for L2 cache.
 *					  These changes are done for implementing PR #697214.
+* 9.1   fl   10/14/26 Range maintenance covers the last cache line of the range
+*                     and walks four lines per iteration. The external cache
+*                     range APIs step by the external cache line length.
+*                     Added Xil_L1DCacheInvalidateRange, which flushes the
+*                     partial lines at the ends of the range with a
+*                     write-back data cache.
 * </pre>
 *
 *
@@ -35,6 +41,30 @@
 
 #define XIL_MICROBLAZE_EXT_CACHE_LINE_LEN	16 /**< Size of Cache line */
 
+/*
+ * Runs Op on every cache line of LineLen bytes from the line aligned Start up
+ * to and including the line at End, four lines per iteration.
+ */
+#define XIL_CACHE_RANGE_OP(Op, Start, End, LineLen) \
+	do { \
+		u32 Bytes = (u32)((End) - (Start)) + (u32)(LineLen); \
+		while (Bytes >= (4U * (u32)(LineLen))) { \
+			Op(Start); \
+			Op((Start) + (LineLen)); \
+			Op((Start) + (2U * (LineLen))); \
+			Op((Start) + (3U * (LineLen))); \
+			(Start) += 4U * (LineLen); \
+			Bytes -= 4U * (u32)(LineLen); \
+		} \
+		while (Bytes > 0U) { \
+			Op(Start); \
+			(Start) += (LineLen); \
+			Bytes -= (u32)(LineLen); \
+		} \
+	} while (0)
+
+#define XIL_WDC_CLEAR(Addr)	mtwdcclear((Addr), 0U)
+
 /************************** Variable Definitions *****************************/
 #ifdef SDT
 static XMicroblaze_Config *CfgPtr = XGet_CpuCfgPtr();
@@ -70,6 +100,64 @@ void Xil_ICacheDisable(void)
 	Xil_L1ICacheDisable();
 }
 
+#if defined(SDT) || (XPAR_MICROBLAZE_DCACHE_USE_WRITEBACK == 1)
+/****************************************************************************/
+/**
+*
+* @brief    Invalidate the L1 data cache for the given address range.
+*           With a write-back data cache, a line that the range covers only
+*           in part is flushed instead, so that modified data around the
+*           range, e.g. next to a DMA buffer, is not lost. The lines fully
+*           within the range are invalidated.
+*
+* @param    Addr is address of range to be invalidated.
+* @param    Len is the length in bytes to be invalidated.
+*
+* @return   None.
+*
+****************************************************************************/
+void Xil_L1DCacheInvalidateRange(UINTPTR Addr, u32 Len)
+{
+#ifndef VERSAL_PLM
+	UINTPTR LineLen;
+	UINTPTR Start = Addr;
+	UINTPTR End = Addr + Len;
+
+	if (Len == 0U) {
+		return;
+	}
+#ifdef SDT
+	if (!CfgPtr->DcacheUseWriteback) {
+		microblaze_invalidate_dcache_range(Addr, Len);
+		return;
+	}
+	LineLen = CfgPtr->DcacheLineLen * 4U;
+#else
+#ifndef XPAR_MICROBLAZE_DCACHE_LINE_LEN
+#error "XPAR_MICROBLAZE_DCACHE_LINE_LEN is missing from xparameters.h"
+#endif
+	LineLen = XPAR_MICROBLAZE_DCACHE_LINE_LEN * 4U;
+#endif
+
+	if ((Start & (LineLen - 1U)) != 0U) {
+		Start &= ~(LineLen - 1U);
+		microblaze_flush_dcache_range(Start, (u32)LineLen);
+		Start += LineLen;
+	}
+	if (((End & (LineLen - 1U)) != 0U) && (End > Start)) {
+		End &= ~(LineLen - 1U);
+		microblaze_flush_dcache_range(End, (u32)LineLen);
+	}
+	if (End > Start) {
+		microblaze_invalidate_dcache_range(Start, (u32)(End - Start));
+	}
+#else
+	(void)Addr;
+	(void)Len;
+#endif
+}
+#endif
+
 #ifdef SDT
 void microblaze_flush_dcache(void) {
 #ifndef VERSAL_PLM
@@ -94,8 +182,9 @@ void microblaze_flush_dcache(void) {
 void microblaze_flush_dcache_range(UINTPTR cacheaddr, u32 len) {
 #ifndef VERSAL_PLM
 	 UINTPTR startadr=0, endadr=0, temp=0;
+	 UINTPTR linelen = CfgPtr->DcacheLineLen * 4;
 
-	 if (CfgPtr->UseDcache && CfgPtr->AllowDcaheWr) {
+	 if (CfgPtr->UseDcache && CfgPtr->AllowDcaheWr && (len != 0U)) {
 		if (CfgPtr->DcacheUseWriteback) {
 			temp = mfmsr();
 			mtmsr(temp & ~(XIL_INTERRUPTS_MASK | XMICROBLAZE_DCACHE_MASK));
@@ -104,21 +193,15 @@ void microblaze_flush_dcache_range(UINTPTR cacheaddr, u32 len) {
 		/*
 		 * Align start and end address with cache line length
 		 */
-		startadr = ( cacheaddr & (- (CfgPtr->DcacheLineLen * 4)));
+		startadr = ( cacheaddr & (- linelen));
 		endadr = cacheaddr + len - 1;
-		endadr = (endadr) & (- (CfgPtr->DcacheLineLen * 4));
+		endadr = (endadr) & (- linelen);
 
-		while ( startadr < endadr) {
-			if (CfgPtr->DcacheUseWriteback) {
-				mtwdcflush(startadr);
-				startadr += (CfgPtr->DcacheLineLen * 4);
-			} else {
-				mtwdc(startadr);
-				startadr += (CfgPtr->DcacheLineLen * 4);
-			}
-		}
 		if (CfgPtr->DcacheUseWriteback) {
+			XIL_CACHE_RANGE_OP(mtwdcflush, startadr, endadr, linelen);
 			mtmsr(temp);
+		} else {
+			XIL_CACHE_RANGE_OP(mtwdc, startadr, endadr, linelen);
 		}
 	}
 #endif
@@ -156,9 +239,9 @@ void microblaze_invalidate_dcache(void) {
 void microblaze_invalidate_dcache_range(UINTPTR cacheaddr, u32 len) {
 #ifndef VERSAL_PLM
 	 UINTPTR startadr=0, endadr=0, temp=0;
-	 INTPTR count=0;
+	 UINTPTR linelen = CfgPtr->DcacheLineLen * 4;
 
-	 if (CfgPtr->UseDcache && CfgPtr->AllowDcaheWr) {
+	 if (CfgPtr->UseDcache && CfgPtr->AllowDcaheWr && (len != 0U)) {
 		if (CfgPtr->DcacheUseWriteback) {
 			temp = mfmsr();
 			mtmsr(temp & ~(XIL_INTERRUPTS_MASK | XMICROBLAZE_DCACHE_MASK));
@@ -167,24 +250,15 @@ void microblaze_invalidate_dcache_range(UINTPTR cacheaddr, u32 len) {
 		/*
 		 * Align start and end address with cache line length
 		 */
-		startadr = ( cacheaddr & (- (CfgPtr->DcacheLineLen * 4)));
+		startadr = ( cacheaddr & (- linelen));
 		endadr = cacheaddr + len - 1;
-		endadr = (endadr & (- (CfgPtr->DcacheLineLen * 4)));
+		endadr = (endadr & (- linelen));
 
-		count  = (endadr - startadr);
-		if (CfgPtr->DcacheUseWriteback) {
-			while ( count >  0) {
-				mtwdcclear(startadr, count);
-				count -= (CfgPtr->DcacheLineLen * 4);
-			}
-		} else {
-			while ( startadr < endadr) {
-				mtwdc(startadr);
-				startadr += (CfgPtr->DcacheLineLen * 4);
-			}
-		}
 		if (CfgPtr->DcacheUseWriteback) {
+			XIL_CACHE_RANGE_OP(XIL_WDC_CLEAR, startadr, endadr, linelen);
 			mtmsr(temp);
+		} else {
+			XIL_CACHE_RANGE_OP(mtwdc, startadr, endadr, linelen);
 		}
 	}
 #endif
@@ -215,7 +289,7 @@ void microblaze_flush_cache_ext_range(UINTPTR cacheaddr, u32 len) {
 #ifndef VERSAL_PLM
 	UINTPTR startadr=0, endadr=0;
 
-	if ((CfgPtr->Interconnect > 3) && CfgPtr->AllowDcaheWr) {
+	if ((CfgPtr->Interconnect > 3) && CfgPtr->AllowDcaheWr && (len != 0U)) {
 
 		/*
 		 * Align start and end address with cache line length
@@ -224,10 +298,8 @@ void microblaze_flush_cache_ext_range(UINTPTR cacheaddr, u32 len) {
 		endadr = cacheaddr + len -1;
 		endadr = (endadr & (- (4 * XIL_MICROBLAZE_EXT_CACHE_LINE_LEN)));
 
-		while ( startadr < endadr) {
-			mtwdcextflush(startadr);
-			startadr += (CfgPtr->DcacheLineLen * 4);
-		}
+		XIL_CACHE_RANGE_OP(mtwdcextflush, startadr, endadr,
+				   (4 * XIL_MICROBLAZE_EXT_CACHE_LINE_LEN));
 	}
 #endif
 }
@@ -257,7 +329,7 @@ void microblaze_invalidate_cache_ext_range(UINTPTR cacheaddr, u32 len) {
 #ifndef VERSAL_PLM
 	UINTPTR startadr=0, endadr=0;
 
-	if ((CfgPtr->Interconnect > 3) && CfgPtr->AllowDcaheWr) {
+	if ((CfgPtr->Interconnect > 3) && CfgPtr->AllowDcaheWr && (len != 0U)) {
 
 		/*
 		 * Align start and end address with cache line length
@@ -266,10 +338,8 @@ void microblaze_invalidate_cache_ext_range(UINTPTR cacheaddr, u32 len) {
 		endadr = cacheaddr + len -1;
 		endadr = (endadr & (- (4 * XIL_MICROBLAZE_EXT_CACHE_LINE_LEN)));
 
-		while ( startadr < endadr) {
-			mtwdcextclear(startadr);
-			startadr += (CfgPtr->DcacheLineLen * 4);
-		}
+		XIL_CACHE_RANGE_OP(mtwdcextclear, startadr, endadr,
+				   (4 * XIL_MICROBLAZE_EXT_CACHE_LINE_LEN));
 	}
 #endif
 }
@@ -304,8 +374,9 @@ void microblaze_invalidate_icache(void) {
 void microblaze_invalidate_icache_range(UINTPTR cacheaddr, u32 len) {
 #ifndef VERSAL_PLM
 	 UINTPTR startadr=0, endadr=0, temp=0;
+	 UINTPTR linelen = CfgPtr->IcacheLineLen * 4;
 
-	 if (CfgPtr->UseIcache && CfgPtr->AllowIcacheWr) {
+	 if (CfgPtr->UseIcache && CfgPtr->AllowIcacheWr && (len != 0U)) {
 		if (CfgPtr->DcacheUseWriteback) {
 			temp = mfmsr();
 			mtmsr(temp & ~(XIL_INTERRUPTS_MASK | XMICROBLAZE_ICACHE_MASK));
@@ -314,14 +385,11 @@ void microblaze_invalidate_icache_range(UINTPTR cacheaddr, u32 len) {
 		/*
 		 * Align start and end address with cache line length
 		 */
-		startadr = ( CfgPtr->IcacheBaseaddr & (- (CfgPtr->IcacheLineLen*4)));
+		startadr = ( cacheaddr & (- linelen));
 		endadr = cacheaddr + len - 1;
-		endadr = (endadr) & (- (CfgPtr->IcacheLineLen * 4));
+		endadr = (endadr) & (- linelen);
 
-		while ( startadr < endadr) {
-				mtwic(startadr);
-				startadr += (CfgPtr->IcacheLineLen * 4);
-		}
+		XIL_CACHE_RANGE_OP(mtwic, startadr, endadr, linelen);
 		if (CfgPtr->DcacheUseWriteback) {
 			mtmsr(temp);
 		}
@@ -36,6 +36,9 @@
 *					  L2 cache. Users can include this file in their application
 *					  to use the various cache related APIs. These changes are
 *					  done for implementing PR #697214.
+* 9.1   fl   10/14/26 Xil_L1DCacheInvalidateRange is a function with a
+*                     write-back data cache, it flushes the partial lines
+*                     at the ends of the range instead of discarding them.
 *
 * </pre>
 *
@@ -93,6 +96,8 @@ extern "C" {
 *           If the bytes specified by the address (Addr) are cached by the L1
 *           data cache, the cacheline containing that byte is invalidated.If
 *           the cacheline is modified (dirty), the modified contents are lost.
+*           With a write-back data cache the lines only partly covered by the
+*           range are flushed instead, see xil_cache.c.
 *
 * @param    Addr is address of range to be invalidated.
 * @param    Len is the length in bytes to be invalidated.
@@ -101,8 +106,12 @@ extern "C" {
 *
 * @note     Processor must be in real mode.
 ****************************************************************************/
+#if defined(SDT) || (XPAR_MICROBLAZE_DCACHE_USE_WRITEBACK == 1)
+void Xil_L1DCacheInvalidateRange(UINTPTR Addr, u32 Len);
+#else
 #define Xil_L1DCacheInvalidateRange(Addr, Len) \
 			microblaze_invalidate_dcache_range((Addr), (Len))
+#endif
 
 /****************************************************************************/
 /**
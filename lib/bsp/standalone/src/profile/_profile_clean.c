@@ -18,4 +18,7 @@ void _profile_clean( void )
 {
 	Xil_ExceptionDisable();
 	disable_timer();
+#ifdef PROFILE_PMU
+	profile_pmu_dump();
+#endif
 }
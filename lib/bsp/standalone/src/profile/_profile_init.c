@@ -17,6 +17,10 @@ extern s32 microblaze_init(void);
 
 extern s32 powerpc405_init(void);
 
+#elif defined PROFILE_PMU
+
+extern s32 profile_pmu_init(void);
+
 #else
 
 extern s32 cortexa9_init(void);
@@ -53,6 +57,8 @@ void _profile_init( void )
 	(void)microblaze_init();
 #elif defined PROC_PPC
 	powerpc405_init();
+#elif defined PROFILE_PMU
+	(void)profile_pmu_init();
 #else
 	(void)cortexa9_init();
 #endif
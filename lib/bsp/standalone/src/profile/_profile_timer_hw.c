@@ -20,7 +20,7 @@
 #endif	/* TIMER_CONNECT_INTC */
 
 /* #ifndef PPC_PIT_INTERRUPT */
-#if (!defined PPC_PIT_INTERRUPT && !defined PROC_CORTEXA9)
+#if (!defined PPC_PIT_INTERRUPT && !defined PROC_CORTEXA9 && !defined PROFILE_PMU)
 #include "xtmrctr_l.h"
 #endif
 
@@ -40,7 +40,7 @@ s32 ppc_dec_init( void );
 s32 powerpc405_init(void);
 #endif	/* PROC_PPC440 */
 
-#if (!defined PPC_PIT_INTERRUPT && !defined PROC_CORTEXA9)
+#if (!defined PPC_PIT_INTERRUPT && !defined PROC_CORTEXA9 && !defined PROFILE_PMU)
 s32 opb_timer_init( void );
 #endif
 
@@ -209,7 +209,7 @@ s32 powerpc405_init(void)
  *
  *-------------------------------------------------------------------- */
 /* #ifndef PPC_PIT_INTERRUPT */
-#if (!defined PPC_PIT_INTERRUPT && !defined PROC_CORTEXA9)
+#if (!defined PPC_PIT_INTERRUPT && !defined PROC_CORTEXA9 && !defined PROFILE_PMU)
 s32 opb_timer_init( void )
 {
 	/* set the number of cycles the timer counts before interrupting */
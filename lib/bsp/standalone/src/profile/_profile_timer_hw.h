@@ -58,7 +58,7 @@ extern "C" {
 #include "xintc.h"
 #endif	/* TIMER_CONNECT_INTC */
 
-#if (!defined PPC_PIT_INTERRUPT && !defined PROC_CORTEXA9)
+#if (!defined PPC_PIT_INTERRUPT && !defined PROC_CORTEXA9 && !defined PROFILE_PMU)
 #include "xtmrctr_l.h"
 #endif
 
@@ -274,6 +274,87 @@ u32 timer_lo_clk_ticks ;	/* Clk ticks when Timer is disabled in CG */
 /*-------------------------------------------------------------------- */
 
 
+/* --------------------------------------------------------------------
+ * PMU sampling (Cortex-A53/A72/A78 and Cortex-R5/R52) - the overflowing
+ * PMU event counter takes the place of the timer, see profile_pmu.c
+ *-------------------------------------------------------------------- */
+#ifdef PROFILE_PMU
+
+#include "xpm_counter.h"
+
+/* CPU cycles, XPM_EVENT_CPU_CYCLES or XPM_EVENT_CLOCKCYCLES */
+#ifndef PROFILE_PMU_EVENT
+#define PROFILE_PMU_EVENT	0x11U
+#endif
+
+/* Events between two samples */
+#ifndef PROFILE_PMU_PERIOD
+#define PROFILE_PMU_PERIOD	TIMER_CLK_TICKS
+#endif
+
+/* Interrupt ID distance between the cores, 0 for a PPI */
+#ifndef PROFILE_PMU_INTR_STRIDE
+#define PROFILE_PMU_INTR_STRIDE	0U
+#endif
+
+/* Samples kept with their call stack, and the stack depth kept */
+#ifndef PROFILE_PMU_SAMPLES
+#define PROFILE_PMU_SAMPLES	512U
+#endif
+#ifndef PROFILE_PMU_STACK_DEPTH
+#define PROFILE_PMU_STACK_DEPTH	8U
+#endif
+
+#ifndef PROFILE_PMU_INTR_ID
+#error "PROFILE_PMU_INTR_ID, the PMU overflow interrupt of core 0, is not set"
+#endif
+
+extern u32 profile_pmu_counter;
+void profile_pmu_reload( void );
+
+#if defined(__aarch64__)
+#define disable_timer()							\
+{								\
+	mtcp(PMCNTENCLR_EL0, (u32)1U << profile_pmu_counter);		\
+	isb();								\
+}
+
+#define enable_timer()							\
+{								\
+	mtcp(PMCNTENSET_EL0, (u32)1U << profile_pmu_counter);		\
+	isb();								\
+}
+
+#define timer_ack()						\
+{							\
+	mtcp(PMOVSCLR_EL0, (u32)1U << profile_pmu_counter);		\
+	profile_pmu_reload();					\
+}
+#else
+#define disable_timer()							\
+{								\
+	mtcp(XREG_CP15_COUNT_ENABLE_CLR, (u32)1U << profile_pmu_counter); \
+	isb();								\
+}
+
+#define enable_timer()							\
+{								\
+	mtcp(XREG_CP15_COUNT_ENABLE_SET, (u32)1U << profile_pmu_counter); \
+	isb();								\
+}
+
+#define timer_ack()						\
+{							\
+	mtcp(XREG_CP15_V_FLAG_STATUS, (u32)1U << profile_pmu_counter);	\
+	profile_pmu_reload();					\
+}
+#endif
+
+/*-------------------------------------------------------------------- */
+#endif	/* PROFILE_PMU */
+/*-------------------------------------------------------------------- */
+
+
 #ifdef __cplusplus
 }
 #endif
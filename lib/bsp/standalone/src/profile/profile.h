@@ -24,6 +24,11 @@ void _system_clean( void ) ;
 void mcount(u32 frompc, u32 selfpc);
 void profile_intr_handler( void ) ;
 void _profile_init( void );
+#ifdef PROFILE_PMU
+s32 profile_pmu_init( void );
+void profile_pmu_sample( void );
+void profile_pmu_dump( void );
+#endif
 
 
 
@@ -31,7 +31,8 @@ void profile_intr_handler( void )
 #elif defined PROC_PPC
 	prof_pc = mfspr(SPR_SRR0);
 #else
-	/* for cortexa9, lr is saved in asm interrupt handler */
+	/* for cortexa9 and the PMU targets, the PC is saved in asm
+	 * interrupt handler */
 #endif
 	/* print("PC: "), putnum(prof_pc), print("\r\n"), */
 	for(j = 0; j < n_gmon_sections; j++ ){
@@ -40,6 +41,9 @@ void profile_intr_handler( void )
 			break;
 		}
 	}
+#ifdef PROFILE_PMU
+	profile_pmu_sample();
+#endif
 	/* Ack the Timer Interrupt */
 	timer_ack();
 }
@@ -0,0 +1,199 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * PMU overflow sampling for the Cortex-A53/A72/A78 (AArch64) and
+ * Cortex-R5/R52 targets, used instead of a profile timer.
+ *
+ * An event counter of the PMU of the core is loaded so that it overflows
+ * after PROFILE_PMU_PERIOD events of PROFILE_PMU_EVENT (CPU cycles, L1 data
+ * cache refills, mispredicted branches, see xpm_counter.h). The overflow
+ * interrupt runs profile_intr_handler, which adds the interrupted PC to the
+ * gmon histogram as the timer interrupt does, and profile_pmu_sample, which
+ * keeps the PC and the call stack of the sample. Every core runs its own
+ * copy of the profiler, with its own PMU and interrupt.
+ *
+ * On AArch64 the call stack is walked through the frame records, so the
+ * application has to be built with -fno-omit-frame-pointer. The AArch32
+ * frame layout depends on the compiler options, the R5/R52 samples only hold
+ * the PC.
+ *
+ * profile_pmu_dump prints the samples as the text output of "perf script",
+ * which FlameGraph (stackcollapse-perf.pl) and speedscope read. The
+ * addresses are resolved against the ELF with addr2line.
+ */
+
+#include "profile.h"
+#include "_profile_timer_hw.h"
+
+#ifdef PROFILE_PMU
+
+#include "xil_printf.h"
+#include "xil_exception.h"
+#include "xplatform_info.h"
+#include "xscugic.h"
+
+extern u32 prof_pc;
+UINTPTR prof_fp;
+
+struct profile_pmu_sample {
+	u32 depth;
+	UINTPTR pc[PROFILE_PMU_STACK_DEPTH];
+};
+
+static struct profile_pmu_sample profile_pmu_samples[PROFILE_PMU_SAMPLES];
+static u32 profile_pmu_nsamples;
+static u32 profile_pmu_lost;
+u32 profile_pmu_counter;
+
+/*--------------------------------------------------------------------
+ * Load the counter so that it overflows after PROFILE_PMU_PERIOD events
+ *-------------------------------------------------------------------- */
+void profile_pmu_reload( void )
+{
+#if defined(__aarch64__)
+	mtcp(PMSELR_EL0, profile_pmu_counter);
+	isb();
+	mtcp(PMXEVCNTR_EL0, (u32)0U - (u32)PROFILE_PMU_PERIOD);
+#else
+	mtcp(XREG_CP15_EVENT_CNTR_SEL, profile_pmu_counter);
+	isb();
+	mtcp(XREG_CP15_PERF_MONITOR_COUNT, (u32)0U - (u32)PROFILE_PMU_PERIOD);
+#endif
+}
+
+/*--------------------------------------------------------------------
+ * Keep the interrupted PC and, on AArch64, its callers
+ *-------------------------------------------------------------------- */
+void profile_pmu_sample( void )
+{
+	struct profile_pmu_sample *s;
+#if defined(__aarch64__)
+	const UINTPTR *frame = (const UINTPTR *)prof_fp;
+	const UINTPTR *prev;
+#endif
+
+	if (profile_pmu_nsamples == (u32)PROFILE_PMU_SAMPLES) {
+		profile_pmu_lost++;
+		return;
+	}
+	s = &profile_pmu_samples[profile_pmu_nsamples];
+	s->pc[0] = (UINTPTR)prof_pc;
+	s->depth = 1U;
+
+#if defined(__aarch64__)
+	/* frame[0] is the caller's frame record, frame[1] the return address.
+	 * The records are on the stack at rising addresses. */
+	while ((frame != NULL) && (((UINTPTR)frame & 0xFU) == 0U) &&
+	       (s->depth < (u32)PROFILE_PMU_STACK_DEPTH) && (frame[1] != 0U)) {
+		s->pc[s->depth] = frame[1];
+		s->depth++;
+		prev = frame;
+		frame = (const UINTPTR *)frame[0];
+		if (frame <= prev) {
+			break;
+		}
+	}
+#endif
+	profile_pmu_nsamples++;
+}
+
+/*--------------------------------------------------------------------
+ * Select the event counter and connect the overflow interrupt
+ *-------------------------------------------------------------------- */
+static s32 profile_pmu_counter_init( void )
+{
+	profile_pmu_counter = Xpm_SetUpAnEvent((u32)PROFILE_PMU_EVENT);
+	if (profile_pmu_counter == XPM_NO_COUNTERS_AVAILABLE) {
+		return -1;
+	}
+	/* Counters start disabled, profile_pmu_init enables the one used */
+	disable_timer();
+	profile_pmu_reload();
+	timer_ack();
+
+#if defined(__aarch64__)
+	mtcp(PMINTENSET_EL1, (u32)1U << profile_pmu_counter);
+#else
+	mtcp(XREG_CP15_INTR_ENABLE_SET, (u32)1U << profile_pmu_counter);
+	/* The AArch32 crt0 does not enable the PMU */
+	mtcp(XREG_CP15_PERF_MONITOR_CTRL,
+	     mfcp(XREG_CP15_PERF_MONITOR_CTRL) | 0x1U);
+#endif
+	isb();
+
+	return 0;
+}
+
+/* --------------------------------------------------------------------
+ * Initialize PMU sampling on the calling core.
+ *	The overflow interrupt of the core is a PPI, or one SPI per core
+ *	PROFILE_PMU_INTR_STRIDE apart.
+ *
+ *-------------------------------------------------------------------- */
+s32 profile_pmu_init( void )
+{
+	u32 intr_id;
+
+	intr_id = (u32)PROFILE_PMU_INTR_ID +
+		  ((u32)PROFILE_PMU_INTR_STRIDE * (u32)XGetCoreId());
+
+	if (profile_pmu_counter_init() != 0) {
+		return -1;
+	}
+
+	Xil_ExceptionInit();
+
+	XScuGic_DeviceInitialize(0);
+
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_IRQ_INT,
+				(Xil_ExceptionHandler)XScuGic_DeviceInterruptHandler,
+				NULL);
+
+	XScuGic_RegisterHandler(SCUGIC_CPU_BASEADDR, (s32)intr_id,
+				(Xil_ExceptionHandler)profile_intr_handler,
+				NULL);
+
+	XScuGic_EnableIntr(SCUGIC_DIST_BASEADDR, intr_id);
+
+	Xil_ExceptionEnableMask(XIL_EXCEPTION_IRQ);
+
+	enable_timer();
+
+	Xil_ExceptionEnable();
+
+	return 0;
+}
+
+/* --------------------------------------------------------------------
+ * Print the samples of the core in the "perf script" format, one block
+ * per sample, the interrupted PC first.
+ *
+ *-------------------------------------------------------------------- */
+void profile_pmu_dump( void )
+{
+	const struct profile_pmu_sample *s;
+	u32 core = (u32)XGetCoreId();
+	u32 i;
+	u32 j;
+
+	for (i = 0U; i < profile_pmu_nsamples; i++) {
+		s = &profile_pmu_samples[i];
+		xil_printf("standalone 0/0 [%03d] %d.000000: %d event-0x%x:\r\n",
+			   core, i, (u32)PROFILE_PMU_PERIOD,
+			   (u32)PROFILE_PMU_EVENT);
+		for (j = 0U; j < s->depth; j++) {
+			xil_printf("\t%lx [unknown] (standalone)\r\n",
+				   (unsigned long)s->pc[j]);
+		}
+		xil_printf("\r\n");
+	}
+	if (profile_pmu_lost != 0U) {
+		xil_printf("# %d samples lost, raise PROFILE_PMU_SAMPLES\r\n",
+			   profile_pmu_lost);
+	}
+}
+
+#endif	/* PROFILE_PMU */
@@ -48,6 +48,11 @@ if(("${CMAKE_MACHINE}" STREQUAL "VersalNet") AND
     set(VERSALNET_PLM " ")
 endif()
 
+option(standalone_xil_printf_buffered "Queue xil_printf output in a ring drained by xil_printf_drain" OFF)
+if(standalone_xil_printf_buffered)
+    set(XIL_PRINTF_BUFFERED " ")
+endif()
+
 string(FIND "${CMAKE_C_FLAGS}" "-flto" has_flto)
 if (${has_flto} EQUAL -1)
     set(XIL_INTERRUPT " ")
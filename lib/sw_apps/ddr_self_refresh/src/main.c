@@ -10,6 +10,9 @@
  *   This DDR self refresh application  provides a simple
  *   demonstration of how to enter to/exit from DDR self refresh mode.
  *   This application runs on R5 out of TCM.
+ *   The time taken to bring DDR out of self refresh is printed. PMU
+ *   firmware built with ENABLE_DDR_FAST_RESUME shortens it and prints the
+ *   per step breakdown when PM_LOG_LEVEL includes info messages.
  */
 
 #include <sleep.h>
@@ -19,8 +22,10 @@
 #include "pm_defs.h"
 #ifndef SDT
 #include <xscugic.h>
+#include "xtime_l.h"
 #else
 #include "xinterrupt_wrap.h"
+#include "xiltimer.h"
 #endif
 
 #ifndef SDT
@@ -35,6 +40,13 @@ static XIpiPsu IpiInst;
 #define PMU_IPI_CHANNEL_BASE_ADDRESS	XPAR_XIPIPSU_0_BASEADDR
 #endif
 
+/* Frequency of the counter read by XTime_GetTime */
+#ifndef SDT
+#define RESUME_TIME_FREQ	COUNTS_PER_SECOND
+#else
+#define RESUME_TIME_FREQ	XTime_GetTimeFreq()
+#endif
+
 #define DDR_STATE_OFF	0U
 #define DDR_STATE_RET	1U
 #define DDR_STATE_ON	2U
@@ -201,6 +213,7 @@ int main(void)
 {
 	XStatus status;
 	XPm_NodeStatus nodestatus;
+	XTime resume_start, resume_end;
 
 	/* Initialize GIC, IPIs, and Xilpm */
 #ifndef SDT
@@ -257,7 +270,9 @@ int main(void)
 	sleep(10);
 
 	xil_printf("Bring DDR out of retention mode.\r\n");
+	XTime_GetTime(&resume_start);
 	status = XPm_SetRequirement(NODE_DDR, PM_CAP_ACCESS, 0, REQUEST_ACK_NO);
+	XTime_GetTime(&resume_end);
 	if (XST_SUCCESS != status) {
 		xil_printf("Failed to set DDR requirement\n");
 	} else {
@@ -269,7 +284,10 @@ int main(void)
 			xil_printf("Failed to get DDR out of self-refresh mode\n");
 			return status;
 		} else if (nodestatus.status == DDR_STATE_ON) {
-			xil_printf("DDR is out of self-refresh mode\n");
+			xil_printf("DDR is out of self-refresh mode, resume took %lu us\n",
+				   (unsigned long)(((u64)(resume_end - resume_start) *
+						    1000000U) /
+						   RESUME_TIME_FREQ));
 		} else {
 			xil_printf("Unknown state\n");
 		}
@@ -0,0 +1,819 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * iperf3 compatible server. Speaks the iperf3 control protocol on
+ * IPERF3_PORT and receives the TCP or UDP streams of an iperf3 client
+ * running in its default (client sends) direction.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "freertos_iperf3_server.h"
+#include "netif/xadapter.h"
+#include "lwip/stats.h"
+#include "xiltimer.h"
+#include "platform_config.h"
+
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+#include "xil_io.h"
+#include "xemacps_hw.h"
+#endif
+
+/* labels for formats [KMG] */
+static const char kLabel[] =
+{
+	' ',
+	'K',
+	'M',
+	'G'
+};
+
+extern struct netif server_netif;
+
+/* Interval time in milliseconds */
+#define REPORT_INTERVAL_TIME (INTERIM_REPORT_INTERVAL * 1000)
+
+/* select() timeout of the stream threads, bounds the time they take to
+ * notice the end of a test
+ */
+#define STREAM_POLL_MSECS 100
+
+static struct {
+	struct iperf3_stream streams[IPERF3_MAX_STREAMS];
+	int num_streams;
+	int udp;
+	int udp_counters_64bit;
+	int udp_sock;
+	volatile int running;
+	sys_sem_t threads_done;
+	u32_t start_time;
+	u32_t end_time;
+	u32_t last_report_time;
+	char json[IPERF3_JSON_SIZE];
+} test;
+
+static char tcp_recv_buf[IPERF3_MAX_STREAMS][RECV_BUF_SIZE];
+static char udp_recv_buf[UDP_RECV_BUF_SIZE];
+
+void print_app_header(void)
+{
+	xil_printf("iperf3 server listening on port %d\r\n", IPERF3_PORT);
+#if LWIP_IPV6==1
+	xil_printf("On Host: Run $iperf3 -6 -c %s%%<interface> -P 4 -t 30\r\n",
+			inet6_ntoa(server_netif.ip6_addr[0]));
+	xil_printf("     or: Run $iperf3 -6 -u -b 100M -c %s%%<interface>\r\n",
+			inet6_ntoa(server_netif.ip6_addr[0]));
+#else
+	xil_printf("On Host: Run $iperf3 -c %s -P 4 -t 30\r\n",
+			inet_ntoa(server_netif.ip_addr));
+	xil_printf("     or: Run $iperf3 -u -b 100M -c %s\r\n",
+			inet_ntoa(server_netif.ip_addr));
+#endif /* LWIP_IPV6 */
+}
+
+static void stats_buffer(char* outString, double data, enum measure_t type)
+{
+	int conv = KCONV_UNIT;
+	const char *format;
+	double unit = 1024.0;
+
+	if (type == SPEED)
+		unit = 1000.0;
+
+	while (data >= unit && conv < KCONV_GIGA) {
+		data /= unit;
+		conv++;
+	}
+
+	/* Fit data in 4 places */
+	if (data < 9.995) { /* 9.995 rounded to 10.0 */
+		format = "%4.2f %c"; /* #.## */
+	} else if (data < 99.95) { /* 99.95 rounded to 100 */
+		format = "%4.1f %c"; /* ##.# */
+	} else {
+		format = "%4.0f %c"; /* #### */
+	}
+	sprintf(outString, format, data, kLabel[conv]);
+}
+
+/* Monotonic time in seconds from the xiltimer counter */
+static double now_secs(void)
+{
+	XTime t;
+
+	XTime_GetTime(&t);
+	return (double)(t / COUNTS_PER_SECOND) +
+		(double)(t % COUNTS_PER_SECOND) / COUNTS_PER_SECOND;
+}
+
+static int recv_all(int sock, void *buf, int len)
+{
+	int n, done = 0;
+
+	while (done < len) {
+		n = lwip_recv(sock, (char *)buf + done, len - done, 0);
+		if (n <= 0)
+			return -1;
+		done += n;
+	}
+	return done;
+}
+
+static int send_all(int sock, const void *buf, int len)
+{
+	int n, done = 0;
+
+	while (done < len) {
+		n = lwip_send(sock, (const char *)buf + done, len - done, 0);
+		if (n <= 0)
+			return -1;
+		done += n;
+	}
+	return done;
+}
+
+static int send_state(int sock, s8_t state)
+{
+	return send_all(sock, &state, 1);
+}
+
+/* JSON messages are preceded by their length, 32 bit in network order */
+static int recv_json(int sock, char *buf, int size)
+{
+	u32_t len, n;
+	char discard[64];
+
+	if (recv_all(sock, &len, sizeof(len)) < 0)
+		return -1;
+	len = ntohl(len);
+
+	n = (len < (u32_t)size - 1) ? len : (u32_t)size - 1;
+	if (recv_all(sock, buf, n) < 0)
+		return -1;
+	buf[n] = '\0';
+
+	/* drop what does not fit, only a few keys are needed */
+	for (len -= n; len; len -= n) {
+		n = (len < sizeof(discard)) ? len : sizeof(discard);
+		if (recv_all(sock, discard, n) < 0)
+			return -1;
+	}
+	return 0;
+}
+
+static int send_json(int sock, const char *json)
+{
+	u32_t len = htonl(strlen(json));
+
+	if (send_all(sock, &len, sizeof(len)) < 0)
+		return -1;
+	return send_all(sock, json, strlen(json));
+}
+
+/*
+ * Minimal lookup of a top level number or boolean in the flat parameter
+ * object iperf3 sends, e.g. {"tcp":true,"omit":0,"time":10,"parallel":4}
+ */
+static const char *json_find(const char *json, const char *key)
+{
+	char pattern[32];
+	const char *p;
+
+	snprintf(pattern, sizeof(pattern), "\"%s\"", key);
+	p = strstr(json, pattern);
+	if (!p)
+		return NULL;
+	p += strlen(pattern);
+	while (*p == ' ' || *p == ':')
+		p++;
+	return p;
+}
+
+static int json_int(const char *json, const char *key, int def)
+{
+	const char *p = json_find(json, key);
+
+	return p ? atoi(p) : def;
+}
+
+static int json_bool(const char *json, const char *key)
+{
+	const char *p = json_find(json, key);
+
+	return p && !strncmp(p, "true", 4);
+}
+
+/* The stream ids iperf3 assigns: 1, 3, 4, ... */
+static int stream_id(int index)
+{
+	return index ? index + 2 : 1;
+}
+
+static int wait_readable(int sock, u32_t msecs)
+{
+	fd_set rfds;
+	struct timeval tv;
+
+	FD_ZERO(&rfds);
+	FD_SET(sock, &rfds);
+	tv.tv_sec = msecs / 1000;
+	tv.tv_usec = (msecs % 1000) * 1000;
+
+	return lwip_select(sock + 1, &rfds, NULL, NULL, &tv);
+}
+
+/* thread spawned for each TCP stream */
+static void tcp_stream_thread(void *p)
+{
+	struct iperf3_stream *stream = (struct iperf3_stream *)p;
+	char *recv_buf = tcp_recv_buf[stream - test.streams];
+	int polled = 0;
+	int read_bytes;
+
+	while (test.running) {
+		read_bytes = lwip_recv(stream->sock, recv_buf, RECV_BUF_SIZE,
+					MSG_DONTWAIT);
+		if (read_bytes > 0) {
+			stream->bytes += read_bytes;
+			polled = 0;
+			continue;
+		}
+
+		/* closed by the client, or failed although readable */
+		if (read_bytes == 0 || polled)
+			break;
+
+		polled = wait_readable(stream->sock, STREAM_POLL_MSECS) > 0;
+	}
+
+	sys_sem_signal(&test.threads_done);
+	vTaskDelete(NULL);
+}
+
+static void udp_update_stats(struct iperf3_stream *stream, char *buf,
+			     int len, double arrival)
+{
+	u32_t sec, usec, pcount32;
+	u64_t pcount;
+	double transit, d;
+	u32_t d_usecs;
+	int bucket;
+
+	memcpy(&sec, buf, 4);
+	memcpy(&usec, buf + 4, 4);
+	if (test.udp_counters_64bit) {
+		memcpy(&pcount32, buf + 8, 4);
+		pcount = (u64_t)ntohl(pcount32) << 32;
+		memcpy(&pcount32, buf + 12, 4);
+		pcount |= ntohl(pcount32);
+	} else {
+		memcpy(&pcount32, buf + 8, 4);
+		pcount = ntohl(pcount32);
+	}
+
+	stream->bytes += len;
+
+	if (pcount >= stream->packet_count + 1) {
+		/* gap in the sequence, count the missing packets as lost */
+		if (pcount > stream->packet_count + 1)
+			stream->cnt_error += (pcount - 1) - stream->packet_count;
+		stream->packet_count = pcount;
+	} else {
+		/* a late packet that was counted as lost before */
+		stream->outoforder++;
+		if (stream->cnt_error > 0)
+			stream->cnt_error--;
+	}
+
+	/* The sender and board clocks are not synchronized, so the one-way
+	 * delay itself is unknown. Differences of consecutive transit times
+	 * are not affected by the clock offset, as in RFC 1889 jitter.
+	 */
+	transit = arrival - ((double)ntohl(sec) + ntohl(usec) / 1000000.0);
+	if (stream->packet_count > 1) {
+		d = transit - stream->prev_transit;
+		if (d < 0)
+			d = -d;
+		stream->jitter += (d - stream->jitter) / 16.0;
+
+		d_usecs = (u32_t)(d * 1000000.0);
+		for (bucket = 0; d_usecs && bucket < 15; bucket++)
+			d_usecs >>= 1;
+		stream->delay_hist[bucket]++;
+	}
+	stream->prev_transit = transit;
+}
+
+/* single thread receiving all UDP streams, told apart by remote port */
+static void udp_stream_thread(void *p)
+{
+#if LWIP_IPV6==1
+	struct sockaddr_in6 from;
+#else
+	struct sockaddr_in from;
+#endif /* LWIP_IPV6 */
+	socklen_t fromlen;
+	int hdr_size = test.udp_counters_64bit ? IPERF3_UDP_HDR_SIZE_64 :
+						IPERF3_UDP_HDR_SIZE;
+	int polled = 0;
+	int read_bytes;
+	u16_t port;
+	int i;
+
+	while (test.running) {
+		fromlen = sizeof(from);
+		read_bytes = lwip_recvfrom(test.udp_sock, udp_recv_buf,
+					UDP_RECV_BUF_SIZE, MSG_DONTWAIT,
+					(struct sockaddr *)&from, &fromlen);
+		if (read_bytes < 0) {
+			if (polled)
+				break;
+			polled = wait_readable(test.udp_sock,
+						STREAM_POLL_MSECS) > 0;
+			continue;
+		}
+		polled = 0;
+
+		if (read_bytes < hdr_size)
+			continue;
+
+#if LWIP_IPV6==1
+		port = ntohs(from.sin6_port);
+#else
+		port = ntohs(from.sin_port);
+#endif /* LWIP_IPV6 */
+		for (i = 0; i < test.num_streams; i++) {
+			if (test.streams[i].port == port) {
+				udp_update_stats(&test.streams[i], udp_recv_buf,
+						read_bytes, now_secs());
+				break;
+			}
+		}
+	}
+
+	sys_sem_signal(&test.threads_done);
+	vTaskDelete(NULL);
+}
+
+static void print_stream_line(int id, double secs_from, double secs_to,
+			      u64_t bytes)
+{
+	char data[16], perf[16], time[64];
+	double bandwidth = 0;
+
+	if (secs_to > secs_from)
+		bandwidth = (bytes / (secs_to - secs_from)) * 8.0;
+
+	stats_buffer(data, bytes, BYTES);
+	stats_buffer(perf, bandwidth, SPEED);
+	/* On 32-bit platforms, xil_printf is not able to print
+	 * u64_t values, so converting these values in strings and
+	 * displaying results
+	 */
+	sprintf(time, "%5.1f-%5.1f sec", secs_from, secs_to);
+	if (id)
+		xil_printf("[%3d] %s  %sBytes  %sbits/sec\n\r", id, time,
+				data, perf);
+	else
+		xil_printf("[SUM] %s  %sBytes  %sbits/sec\n\r", time, data,
+				perf);
+}
+
+static void interval_report(u32_t now)
+{
+	double from = (test.last_report_time - test.start_time) / 1000.0;
+	double to = (now - test.start_time) / 1000.0;
+	u64_t bytes, sum = 0;
+	int i;
+
+	for (i = 0; i < test.num_streams; i++) {
+		bytes = test.streams[i].bytes;
+		print_stream_line(test.streams[i].id, from, to,
+				bytes - test.streams[i].last_bytes);
+		sum += bytes - test.streams[i].last_bytes;
+		test.streams[i].last_bytes = bytes;
+	}
+	if (test.num_streams > 1)
+		print_stream_line(0, from, to, sum);
+
+	test.last_report_time = now;
+}
+
+static void final_report(void)
+{
+	double secs = (test.end_time - test.start_time) / 1000.0;
+	struct iperf3_stream *stream;
+	char jitter[16];
+	u64_t sum = 0;
+	int i, bucket;
+
+	xil_printf("- - - - - - - - - - - - - - - - - - - - - - - - -\n\r");
+	for (i = 0; i < test.num_streams; i++) {
+		stream = &test.streams[i];
+		print_stream_line(stream->id, 0, secs, stream->bytes);
+		sum += stream->bytes;
+	}
+	if (test.num_streams > 1)
+		print_stream_line(0, 0, secs, sum);
+
+	if (!test.udp)
+		return;
+
+	for (i = 0; i < test.num_streams; i++) {
+		stream = &test.streams[i];
+		sprintf(jitter, "%.3f", stream->jitter * 1000.0);
+		xil_printf("[%3d] jitter %s ms  lost %d/%d  out of order %d\n\r",
+				stream->id, jitter, (u32_t)stream->cnt_error,
+				(u32_t)stream->packet_count,
+				(u32_t)stream->outoforder);
+		xil_printf("[%3d] delay variation (us):", stream->id);
+		for (bucket = 0; bucket < 15; bucket++) {
+			if (stream->delay_hist[bucket])
+				xil_printf(" <%d:%d", 1 << bucket,
+					stream->delay_hist[bucket]);
+		}
+		if (stream->delay_hist[15])
+			xil_printf(" >=%d:%d", 1 << 14, stream->delay_hist[15]);
+		xil_printf("\n\r");
+	}
+}
+
+/*
+ * Drop counters of the MAC and of lwIP. The GEM statistics registers
+ * clear on read, so reading them at the start of a test resets them.
+ */
+static void emac_drop_stats(int print)
+{
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+	struct xemac_s *xemac = (struct xemac_s *)server_netif.state;
+	u32_t frames, fcs, reserr, overrun;
+
+	if (xemac->type == xemac_type_emacps) {
+		frames = Xil_In32(PLATFORM_EMAC_BASEADDR + XEMACPS_RXCNT_OFFSET);
+		fcs = Xil_In32(PLATFORM_EMAC_BASEADDR + XEMACPS_RXFCSCNT_OFFSET);
+		reserr = Xil_In32(PLATFORM_EMAC_BASEADDR +
+				XEMACPS_RXRESERRCNT_OFFSET);
+		overrun = Xil_In32(PLATFORM_EMAC_BASEADDR +
+				XEMACPS_RXORCNT_OFFSET);
+		if (print)
+			xil_printf("GEM: rx frames %d, fcs errors %d, "
+				"no rx buffer %d, rx overruns %d\n\r",
+				frames, fcs, reserr, overrun);
+	}
+#endif
+#if LINK_STATS
+	if (print)
+		xil_printf("lwIP link: recv %d, drop %d, memerr %d\n\r",
+				lwip_stats.link.recv, lwip_stats.link.drop,
+				lwip_stats.link.memerr);
+	else
+		memset(&lwip_stats.link, 0, sizeof(lwip_stats.link));
+#endif
+}
+
+static void build_results(void)
+{
+	struct iperf3_stream *stream;
+	double secs = (test.end_time - test.start_time) / 1000.0;
+	int len, i;
+
+	len = snprintf(test.json, IPERF3_JSON_SIZE,
+			"{\"cpu_util_total\":0,\"cpu_util_user\":0,"
+			"\"cpu_util_system\":0,\"sender_has_retransmits\":-1,"
+			"\"streams\":[");
+
+	for (i = 0; i < test.num_streams; i++) {
+		stream = &test.streams[i];
+		len += snprintf(test.json + len, IPERF3_JSON_SIZE - len,
+				"%s{\"id\":%d,\"bytes\":%.0f,"
+				"\"retransmits\":-1,\"jitter\":%f,"
+				"\"errors\":%.0f,\"packets\":%.0f,"
+				"\"start_time\":0,\"end_time\":%f}",
+				i ? "," : "", stream->id, (double)stream->bytes,
+				stream->jitter, (double)stream->cnt_error,
+				(double)stream->packet_count, secs);
+	}
+
+	snprintf(test.json + len, IPERF3_JSON_SIZE - len, "]}");
+}
+
+/* Accepts the TCP streams, each starts with the cookie of the test */
+static int create_tcp_streams(int listen_sock, const char *cookie)
+{
+	char stream_cookie[IPERF3_COOKIE_SIZE];
+	int i, sock;
+
+	for (i = 0; i < test.num_streams; i++) {
+		sock = lwip_accept(listen_sock, NULL, NULL);
+		if (sock < 0)
+			return -1;
+
+		if (recv_all(sock, stream_cookie, IPERF3_COOKIE_SIZE) < 0 ||
+		    memcmp(stream_cookie, cookie, IPERF3_COOKIE_SIZE)) {
+			xil_printf("iperf3: stream of another test refused\r\n");
+			lwip_close(sock);
+			i--;
+			continue;
+		}
+		test.streams[i].sock = sock;
+	}
+	return 0;
+}
+
+/* Answers the connect datagram of every UDP stream */
+static int create_udp_streams(void)
+{
+#if LWIP_IPV6==1
+	struct sockaddr_in6 from;
+#else
+	struct sockaddr_in from;
+#endif /* LWIP_IPV6 */
+	socklen_t fromlen;
+	u32_t msg, reply;
+	int i;
+
+	for (i = 0; i < test.num_streams; i++) {
+		fromlen = sizeof(from);
+		if (lwip_recvfrom(test.udp_sock, &msg, sizeof(msg), 0,
+				(struct sockaddr *)&from, &fromlen) < 0)
+			return -1;
+
+		if (ntohl(msg) == IPERF3_LEGACY_UDP_CONNECT_MSG)
+			reply = htonl(IPERF3_LEGACY_UDP_CONNECT_REPLY);
+		else
+			reply = htonl(IPERF3_UDP_CONNECT_REPLY);
+
+		if (lwip_sendto(test.udp_sock, &reply, sizeof(reply), 0,
+				(struct sockaddr *)&from, fromlen) < 0)
+			return -1;
+
+#if LWIP_IPV6==1
+		test.streams[i].port = ntohs(from.sin6_port);
+#else
+		test.streams[i].port = ntohs(from.sin_port);
+#endif /* LWIP_IPV6 */
+	}
+	return 0;
+}
+
+static int open_udp_socket(void)
+{
+#if LWIP_IPV6==1
+	struct sockaddr_in6 address;
+#else
+	struct sockaddr_in address;
+#endif /* LWIP_IPV6 */
+
+	memset(&address, 0, sizeof(address));
+#if LWIP_IPV6==1
+	test.udp_sock = lwip_socket(AF_INET6, SOCK_DGRAM, 0);
+	address.sin6_family = AF_INET6;
+	address.sin6_port = htons(IPERF3_PORT);
+	address.sin6_len = sizeof(address);
+#else
+	test.udp_sock = lwip_socket(AF_INET, SOCK_DGRAM, 0);
+	address.sin_family = AF_INET;
+	address.sin_port = htons(IPERF3_PORT);
+	address.sin_addr.s_addr = INADDR_ANY;
+#endif /* LWIP_IPV6 */
+	if (test.udp_sock < 0)
+		return -1;
+
+	if (lwip_bind(test.udp_sock, (struct sockaddr *)&address,
+		      sizeof(address)) < 0) {
+		lwip_close(test.udp_sock);
+		test.udp_sock = -1;
+		return -1;
+	}
+	return 0;
+}
+
+static void run_test(int listen_sock, int ctrl)
+{
+	char cookie[IPERF3_COOKIE_SIZE];
+	int threads = 0, i, err = 0;
+	u32_t now, elapsed, next;
+	s8_t state;
+	fd_set rfds;
+	struct timeval tv;
+
+	memset(test.streams, 0, sizeof(test.streams));
+	test.udp_sock = -1;
+	test.running = 0;
+
+	if (recv_all(ctrl, cookie, IPERF3_COOKIE_SIZE) < 0)
+		return;
+
+	if (send_state(ctrl, IPERF3_PARAM_EXCHANGE) < 0 ||
+	    recv_json(ctrl, test.json, IPERF3_JSON_SIZE) < 0)
+		return;
+
+	test.udp = json_bool(test.json, "udp");
+	test.udp_counters_64bit = json_bool(test.json, "udp_counters_64bit");
+	test.num_streams = json_int(test.json, "parallel", 1);
+
+	if (json_bool(test.json, "reverse") ||
+	    json_bool(test.json, "bidirectional") ||
+	    test.num_streams < 1 || test.num_streams > IPERF3_MAX_STREAMS) {
+		xil_printf("iperf3: only up to %d streams from the client "
+			"are supported\r\n", IPERF3_MAX_STREAMS);
+		/* iperf3 reads i_errno and errno after a server error */
+		send_state(ctrl, IPERF3_SERVER_ERROR);
+		memset(cookie, 0, 8);
+		send_all(ctrl, cookie, 8);
+		return;
+	}
+
+	for (i = 0; i < test.num_streams; i++) {
+		test.streams[i].id = stream_id(i);
+		test.streams[i].sock = -1;
+	}
+
+	if (test.udp && open_udp_socket() < 0) {
+		xil_printf("iperf3: Unable to bind UDP port %d\r\n",
+				IPERF3_PORT);
+		return;
+	}
+
+	if (send_state(ctrl, IPERF3_CREATE_STREAMS) < 0)
+		goto close_streams;
+
+	if (test.udp)
+		err = create_udp_streams();
+	else
+		err = create_tcp_streams(listen_sock, cookie);
+	if (err < 0)
+		goto close_streams;
+
+	xil_printf("iperf3: %d %s stream(s) connected\r\n", test.num_streams,
+			test.udp ? "UDP" : "TCP");
+	xil_printf("[ ID] Interval        Transfer     Bandwidth\n\r");
+
+	emac_drop_stats(0);
+
+	if (send_state(ctrl, IPERF3_TEST_START) < 0 ||
+	    send_state(ctrl, IPERF3_TEST_RUNNING) < 0)
+		goto close_streams;
+
+	test.start_time = test.last_report_time = sys_now();
+	test.running = 1;
+
+	if (test.udp) {
+		sys_thread_new("iperf3 udp", udp_stream_thread, NULL,
+				IPERF3_THREAD_STACKSIZE, DEFAULT_THREAD_PRIO);
+		threads = 1;
+	} else {
+		for (i = 0; i < test.num_streams; i++) {
+			sys_thread_new("iperf3 tcp", tcp_stream_thread,
+					&test.streams[i],
+					IPERF3_THREAD_STACKSIZE,
+					DEFAULT_THREAD_PRIO);
+		}
+		threads = test.num_streams;
+	}
+
+	/* report periodically until the client ends the test */
+	while (1) {
+		now = sys_now();
+		elapsed = now - test.last_report_time;
+		if (elapsed >= REPORT_INTERVAL_TIME) {
+			interval_report(now);
+			continue;
+		}
+		next = REPORT_INTERVAL_TIME - elapsed;
+
+		FD_ZERO(&rfds);
+		FD_SET(ctrl, &rfds);
+		tv.tv_sec = next / 1000;
+		tv.tv_usec = (next % 1000) * 1000;
+		err = lwip_select(ctrl + 1, &rfds, NULL, NULL, &tv);
+		if (err == 0)
+			continue;
+
+		if (err < 0 || recv_all(ctrl, &state, 1) < 0 ||
+		    state != IPERF3_TEST_END) {
+			xil_printf("iperf3: test aborted by the client\r\n");
+			err = -1;
+			break;
+		}
+		err = 0;
+		break;
+	}
+
+	test.end_time = sys_now();
+	test.running = 0;
+	while (threads--)
+		sys_sem_wait(&test.threads_done);
+
+	if (err < 0)
+		goto close_streams;
+
+	final_report();
+	emac_drop_stats(1);
+
+	/* client results are not needed, the server reports its own */
+	build_results();
+	if (send_state(ctrl, IPERF3_EXCHANGE_RESULTS) < 0 ||
+	    recv_json(ctrl, cookie, sizeof(cookie)) < 0 ||
+	    send_json(ctrl, test.json) < 0 ||
+	    send_state(ctrl, IPERF3_DISPLAY_RESULTS) < 0)
+		goto close_streams;
+
+	/* wait for IPERF_DONE, or the client closing the connection */
+	recv_all(ctrl, &state, 1);
+	xil_printf("iperf3 test done\n\r");
+
+close_streams:
+	for (i = 0; i < test.num_streams; i++) {
+		if (test.streams[i].sock >= 0)
+			lwip_close(test.streams[i].sock);
+	}
+	if (test.udp_sock >= 0)
+		lwip_close(test.udp_sock);
+}
+
+void start_application(void)
+{
+	int sock, ctrl;
+#if LWIP_IPV6==1
+	struct sockaddr_in6 address;
+#else
+	struct sockaddr_in address;
+#endif /* LWIP_IPV6 */
+
+	if (sys_sem_new(&test.threads_done, 0) != ERR_OK) {
+		xil_printf("iperf3 server: Error creating semaphore\r\n");
+		return;
+	}
+
+	/* set up address to connect to */
+	memset(&address, 0, sizeof(address));
+#if LWIP_IPV6==1
+	if ((sock = lwip_socket(AF_INET6, SOCK_STREAM, 0)) < 0) {
+		xil_printf("iperf3 server: Error creating Socket\r\n");
+		return;
+	}
+	address.sin6_family = AF_INET6;
+	address.sin6_port = htons(IPERF3_PORT);
+	address.sin6_len = sizeof(address);
+#else
+	if ((sock = lwip_socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+		xil_printf("iperf3 server: Error creating Socket\r\n");
+		return;
+	}
+	address.sin_family = AF_INET;
+	address.sin_port = htons(IPERF3_PORT);
+	address.sin_addr.s_addr = INADDR_ANY;
+#endif /* LWIP_IPV6 */
+
+	if (lwip_bind(sock, (struct sockaddr *)&address, sizeof (address)) < 0) {
+		xil_printf("iperf3 server: Unable to bind to port %d\r\n",
+				IPERF3_PORT);
+		lwip_close(sock);
+		return;
+	}
+
+	/* the control connection and the streams of one test */
+	if (lwip_listen(sock, IPERF3_MAX_STREAMS + 1) < 0) {
+		xil_printf("iperf3 server: tcp_listen failed\r\n");
+		lwip_close(sock);
+		return;
+	}
+
+	/* one test at a time, like iperf3 itself */
+	while (1) {
+		ctrl = lwip_accept(sock, NULL, NULL);
+		if (ctrl < 0)
+			continue;
+		run_test(sock, ctrl);
+		lwip_close(ctrl);
+	}
+}
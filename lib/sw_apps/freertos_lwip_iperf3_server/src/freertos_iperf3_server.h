@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __FREERTOS_IPERF3_SERVER_H_
+#define __FREERTOS_IPERF3_SERVER_H_
+
+#include "lwipopts.h"
+#include "lwip/ip_addr.h"
+#include "lwip/inet.h"
+#include "lwip/sockets.h"
+#include "lwip/sys.h"
+#include "xil_printf.h"
+
+/* used as indices into kLabel[] */
+enum {
+	KCONV_UNIT,
+	KCONV_KILO,
+	KCONV_MEGA,
+	KCONV_GIGA,
+};
+
+/* used as type of print */
+enum measure_t {
+	BYTES,
+	SPEED
+};
+
+/* iperf3 control channel states, one signed byte on the wire */
+#define IPERF3_TEST_START		1
+#define IPERF3_TEST_RUNNING		2
+#define IPERF3_TEST_END			4
+#define IPERF3_PARAM_EXCHANGE		9
+#define IPERF3_CREATE_STREAMS		10
+#define IPERF3_SERVER_TERMINATE		11
+#define IPERF3_CLIENT_TERMINATE		12
+#define IPERF3_EXCHANGE_RESULTS		13
+#define IPERF3_DISPLAY_RESULTS		14
+#define IPERF3_IPERF_DONE		16
+#define IPERF3_ACCESS_DENIED		(-1)
+#define IPERF3_SERVER_ERROR		(-2)
+
+/* NUL terminated test cookie sent on the control and every TCP stream */
+#define IPERF3_COOKIE_SIZE		37
+
+/* first datagram of a UDP stream and the server's reply to it */
+#define IPERF3_UDP_CONNECT_MSG		0x36373839
+#define IPERF3_UDP_CONNECT_REPLY	0x39383736
+#define IPERF3_LEGACY_UDP_CONNECT_MSG	123456789
+#define IPERF3_LEGACY_UDP_CONNECT_REPLY	987654321
+
+/* UDP payload header: sec, usec and a 32 or 64 bit packet count */
+#define IPERF3_UDP_HDR_SIZE		12
+#define IPERF3_UDP_HDR_SIZE_64		16
+
+struct iperf3_stream {
+	int id;
+	/* TCP data socket, -1 for UDP streams */
+	int sock;
+	/* remote port, used to demultiplex the UDP streams */
+	u16_t port;
+	volatile u64_t bytes;
+	/* bytes at the previous interval report */
+	u64_t last_bytes;
+
+	/* UDP receive statistics, computed the way iperf3 does */
+	u64_t packet_count;
+	u64_t cnt_error;
+	u64_t outoforder;
+	double jitter;
+	double prev_transit;
+
+	/* log2 histogram of the one-way delay variation in microseconds */
+	u32_t delay_hist[16];
+};
+
+/* server port to listen on */
+#define IPERF3_PORT			5201
+
+/* maximum number of parallel streams (-P) of one test */
+#define IPERF3_MAX_STREAMS		8
+
+#define IPERF3_JSON_SIZE		4096
+#define RECV_BUF_SIZE			4096
+#define UDP_RECV_BUF_SIZE		2048
+
+#define IPERF3_THREAD_STACKSIZE		2048
+
+/* seconds between periodic bandwidth reports */
+#define INTERIM_REPORT_INTERVAL		1
+
+#endif /* __FREERTOS_IPERF3_SERVER_H_ */
@@ -568,8 +568,8 @@ static int Xbir_HttpProcessGetFileReq (struct tcp_pcb *Tpcb, u8 *HttpReq,
 	const char *FileExt;
 	u32 HdrLen;
 	u32 FileSize;
-	u32 DataReadLen;
 	FRESULT Result;
+	Xbir_HttpArg *HttpArg;
 
 	Xbir_HttpExtractFileName((char *)HttpReq, HttpReqLen, FileName,
 		XBIR_HTTP_MAX_FILE_NAME_LEN - 1U);
@@ -603,37 +603,109 @@ static int Xbir_HttpProcessGetFileReq (struct tcp_pcb *Tpcb, u8 *HttpReq,
 	}
 
 	/* Now send the file */
-	while (FileSize > 0U) {
-		int SndBuffer = tcp_sndbuf(Tpcb);
-		if (SndBuffer < XBIR_HTTP_BUFFER_SIZE) {
-			/* Not enough space in sndbuf, so send remaining bytes
-			 * when there is space. this is done by storing the file
-			 * descriptor in as part of the tcp_arg, so that the sent
-			 * callback handler knows to send data
-			 */
-			Xbir_HttpArg *HttpArg = (Xbir_HttpArg *)Tpcb->callback_arg;
-			memcpy(&HttpArg->Fil, &Fil, sizeof(Fil));
-			HttpArg->Fsize = FileSize;
+	if (Xbir_HttpSendFileData(Tpcb, &Fil, &FileSize) != XST_SUCCESS) {
+		Xbir_Printf(DEBUG_INFO, " Error: writing file (%s) to socket,"
+			"remaining unwritten bytes = %d\r\n", FileName, FileSize);
+		f_close(&Fil);
+		Xbir_HttpClose(Tpcb);
+		goto END;
+	}
+
+	if (FileSize > 0U) {
+		/* Not enough space in sndbuf, so send remaining bytes
+		 * when there is space. this is done by storing the file
+		 * descriptor in as part of the tcp_arg, so that the sent
+		 * callback handler knows to send data
+		 */
+		HttpArg = (Xbir_HttpArg *)Tpcb->callback_arg;
+		memcpy(&HttpArg->Fil, &Fil, sizeof(Fil));
+		HttpArg->Fsize = FileSize;
+		goto END;
+	}
+
+	f_close(&Fil);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function sends file data as long as there is space in the TCP send
+ * buffer. When the file is on the RAM disk and f_readptr is enabled in
+ * xilffs, the data is queued by reference to the RAM disk without a copy and
+ * lwIP drops the reference once the data is acknowledged. Otherwise the data
+ * is read and copied in chunks of XBIR_HTTP_BUFFER_SIZE.
+ *
+ * @param	Tpcb		Pointer to TCP PCB
+ * @param	Fil		Pointer to the file being sent
+ * @param	FileSize	Pointer to the number of bytes left to send, it
+ *				is decreased by the number of bytes queued
+ *
+ * @return	XST_SUCCESS if the data is queued until the send buffer is
+ *			full or the whole file is queued
+ *		XST_FAILURE on file read or TCP write error
+ *
+ *****************************************************************************/
+int Xbir_HttpSendFileData (struct tcp_pcb *Tpcb, FIL *Fil, u32 *FileSize)
+{
+	int Status = XST_FAILURE;
+	err_t Error;
+	char Buffer[XBIR_HTTP_BUFFER_SIZE];
+	u32 SndBuffer;
+	UINT DataLen;
+	FRESULT Result;
+#if FF_USE_READPTR
+	const void *Data;
+#endif
+
+	while (*FileSize > 0U) {
+		SndBuffer = tcp_sndbuf(Tpcb);
+		if ((SndBuffer < XBIR_HTTP_BUFFER_SIZE) && (SndBuffer < *FileSize)) {
+			break;
+		}
+
+#if FF_USE_READPTR
+		if (SndBuffer > *FileSize) {
+			SndBuffer = *FileSize;
+		}
+		Result = f_readptr(Fil, &Data, SndBuffer, &DataLen);
+		if (Result == FR_OK) {
+			Error = tcp_write(Tpcb, Data, (u16_t)DataLen,
+				(*FileSize > DataLen) ? TCP_WRITE_FLAG_MORE : 0U);
+			if (Error == ERR_MEM) {
+				/* Out of segments, the sent callback retries */
+				(void)f_lseek(Fil, f_tell(Fil) - DataLen);
+				break;
+			}
+			if (Error != ERR_OK) {
+				goto END;
+			}
+			*FileSize -= DataLen;
+			continue;
+		}
+		if (Result != FR_DENIED) {
 			goto END;
 		}
+		/* Not a memory mapped drive, copy the data */
+#endif
 
-		f_read(&Fil, (void *)Buffer, XBIR_HTTP_BUFFER_SIZE, &DataReadLen);
-		Error = tcp_write(Tpcb, Buffer, DataReadLen,
+		Result = f_read(Fil, (void *)Buffer, XBIR_HTTP_BUFFER_SIZE, &DataLen);
+		if ((Result != FR_OK) || (DataLen == 0U)) {
+			goto END;
+		}
+		Error = tcp_write(Tpcb, Buffer, (u16_t)DataLen,
 			TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE);
 		if (Error != ERR_OK) {
-			Xbir_Printf(DEBUG_INFO, " Error: writing file (%s) to socket,"
-				"remaining unwritten bytes = %d\r\n",
-				FileName, FileSize - DataReadLen);
 			Xbir_Printf(DEBUG_INFO, " Attempted to lwip_write %d bytes,"
-				" tcp write error = %d\r\n", DataReadLen, Error);
-			Xbir_HttpClose(Tpcb);
-			break;
+				" tcp write error = %d\r\n", DataLen, Error);
+			goto END;
 		}
-
-		FileSize -= DataReadLen;
+		*FileSize -= DataLen;
 	}
 
-	f_close(&Fil);
 	Status = XST_SUCCESS;
 
 END:
@@ -21,6 +21,7 @@ extern "C" {
 
 /***************************** Include Files *********************************/
 #include "ff.h"
+#include "xbir_ssi.h"
 
 /************************** Constant Definitions *****************************/
 #define XBIR_HTTP_MAX_BOUNDARY_LEN	(1024U)
@@ -29,6 +30,7 @@ extern "C" {
 /* Clear callback functions and close connection */
 static inline void Xbir_HttpClose(struct tcp_pcb * Tpcb)
 {
+	Xbir_SsiUploadCancel(Tpcb);
 	tcp_recv(Tpcb, NULL);
 	tcp_sent(Tpcb, NULL);
 	tcp_close(Tpcb);
@@ -55,6 +57,7 @@ int Xbir_HttpProcessAdditionalPayload (struct tcp_pcb *Tpcb, u8 *HttpReq,
 int Xbir_HttpSendResponseJson (struct tcp_pcb *Tpcb, u8 *HttpReq,
 	u16 HttpReqLen, char *JsonStr, u16 JsonStrLen);
 Xbir_HttpArg *Xbir_HttpPallocArg (void);
+int Xbir_HttpSendFileData (struct tcp_pcb *Tpcb, FIL *Fil, u32 *FileSize);
 void Xbir_HttpPfreeArg (Xbir_HttpArg *Arg);
 
 #ifdef __cplusplus
@@ -23,6 +23,7 @@
 #include "lwip/priv/tcp_priv.h"
 #include "xbir_nw.h"
 #include "xbir_sys.h"
+#include "xbir_ssi.h"
 
 /************************** Constant Definitions *****************************/
 /* TODO: Read MAC address from EEPROM and assign it */
@@ -184,6 +185,7 @@ void Xbir_NwProcessPkts (struct netif* NetIf)
 		}
 		PktProcessed = xemacif_input(NetIf);
 		PktCnt += PktProcessed;
+		Xbir_SsiExecuteBackgroundTasks();
 		if ((0 == PktProcessed) || (PktCnt >= MAX_PKT_PROC_COUNT)) {
 			Xbir_SysExecuteBackgroundTasks();
 			PktCnt = 0U;
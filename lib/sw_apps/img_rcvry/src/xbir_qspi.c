@@ -23,6 +23,7 @@
 * 1.00  bsv   07/02/20   First release
 * 2.00  bsv   03/15/22   Fix bug in stacked mode
 * 3.00  skd   01/31/23   Added debug print levels
+* 4.00  fl    10/14/26   Added non blocking sector erase
 *
 * </pre>
 *
@@ -55,6 +56,7 @@ static int Xbir_QspiMacronixEnable4B(XQspiPsu *QspiPsuPtr);
 static int Xbir_QspiMacronixEnableQPIMode(XQspiPsu *QspiPsuPtr, int Enable);
 static int Xbir_GetFlashInfo(u8 VendorId, u8 SizeId);
 static int Xbir_FlashEnterExit4BAddMode(XQspiPsu *QspiPsuPtr, u8 Enable);
+static int Xbir_QspiWaitForErase(void);
 
 /************************** Variable Definitions *****************************/
 static XQspiPsu QspiPsuInstance;
@@ -63,6 +65,7 @@ static int StatusCmd = 0;
 static Xbir_QspiFlashInfo FlashInfo;
 static u8 FsrFlag;
 static u8 MacronixFlash = FALSE;
+static u8 EraseInProgress = FALSE;
 
 /*****************************************************************************/
 /**
@@ -514,6 +517,11 @@ int Xbir_QspiRead(u32 SrcAddress, u8* DestAddress, u32 Length)
 	u8 WriteBuf[5U] __attribute__ ((aligned(32U))) = {0U};
 	u32 FlashSize = FlashInfo.FlashSize;
 
+	Status = Xbir_QspiWaitForErase();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
 	if ((QspiPsuInstance.Config.ConnectionMode ==
 		XQSPIPSU_CONNECTION_MODE_STACKED) ||
 		(QspiPsuInstance.Config.ConnectionMode ==
@@ -729,6 +737,11 @@ int Xbir_QspiWrite(u32 Address, u8 *WrBuffer, u32 Length)
 	u32 CmdByteCount;
 	XQspiPsu_Msg FlashMsg[2U] = {0U};
 
+	Status = Xbir_QspiWaitForErase();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
 	WrEnableCmd = WRITE_ENABLE_CMD;
 	/*
 	 * Translate address based on type of connection
@@ -854,15 +867,10 @@ END:
 int Xbir_QspiFlashErase(u32 Address, u32 Length)
 {
 	int Status = XST_FAILURE;
-	u8 WrEnableCmd;
-	u8 RdStatusCmd;
-	u8 FlashStatus[2U] = {0U};
 	int Sector;
-	u32 RealAddr;
 	u32 NumSect;
-	u8 WrBuffer[8U];
-	XQspiPsu_Msg FlashMsg[2U] = {0U};
 	u32 SectorOffset;
+	u8 Busy;
 
 	SectorOffset = Address & (FlashInfo.SectSize - 1U);
 	Address = Address - SectorOffset;
@@ -873,106 +881,201 @@ int Xbir_QspiFlashErase(u32 Address, u32 Length)
 		Length = Length + FlashInfo.SectSize - SectorOffset;
 	}
 	NumSect = (Length / FlashInfo.SectSize);
-	WrEnableCmd = WRITE_ENABLE_CMD;
 
 	for (Sector = 0U; Sector < NumSect; Sector++) {
-		/* Translate address based on type of connection
-		 * If stacked assert the slave select based on address
-		 */
-		RealAddr = Xbir_GetQspiAddr(Address);
-
-		/* Send the write enable command to the Flash so that it can be
-		 * written to, this needs to be sent as a separate
-		 * transfer before the write
-		 */
-		FlashMsg[0U].TxBfrPtr = &WrEnableCmd;
-		FlashMsg[0U].RxBfrPtr = NULL;
-		FlashMsg[0U].ByteCount = 1U;
-		FlashMsg[0U].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-		FlashMsg[0U].Flags = XQSPIPSU_MSG_FLAG_TX;
-		Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, FlashMsg, 1U);
+		Status = Xbir_QspiSectorEraseStart(Address);
 		if (Status != XST_SUCCESS) {
 			goto END;
 		}
 
-		WrBuffer[COMMAND_OFFSET] = SEC_ERASE_CMD;
+		/* Wait for the erase command to be completed */
+		do {
+			Status = Xbir_QspiIsBusy(&Busy);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		} while (Busy == TRUE);
+		Address += FlashInfo.SectSize;
+	}
 
-		/* To be used only if 4B address sector erase cmd is
-		 * supported by flash
-		 */
-		WrBuffer[ADDRESS_1_OFFSET] =
-				(u8)((RealAddr & 0xFF000000U) >> 24U);
-		WrBuffer[ADDRESS_2_OFFSET] =
-				(u8)((RealAddr & 0xFF0000U) >> 16U);
-		WrBuffer[ADDRESS_3_OFFSET] =
-				(u8)((RealAddr & 0xFF00U) >> 8U);
-		WrBuffer[ADDRESS_4_OFFSET] =
-				(u8)(RealAddr & 0xFFU);
+END:
+	return Status;
+}
 
-		FlashMsg[0U].ByteCount = 5U;
-		FlashMsg[0U].TxBfrPtr = WrBuffer;
-		FlashMsg[0U].RxBfrPtr = NULL;
-		FlashMsg[0U].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-		FlashMsg[0U].Flags = XQSPIPSU_MSG_FLAG_TX;
+/*****************************************************************************/
+/**
+ * @brief
+ * This function issues the erase of the sector containing Address and returns
+ * without waiting for the erase to complete. Xbir_QspiIsBusy reports when the
+ * flash is done. Reads and writes issued in the meantime wait for the erase.
+ *
+ * @param	Address 	Address in the sector to be erased
+ *
+ * @return	XST_SUCCESS if the erase is started
+ *		Error code on failure
+ *
+ *****************************************************************************/
+int Xbir_QspiSectorEraseStart(u32 Address)
+{
+	int Status = XST_FAILURE;
+	u8 WrEnableCmd;
+	u32 RealAddr;
+	u8 WrBuffer[8U];
+	XQspiPsu_Msg FlashMsg[1U] = {0U};
 
-		Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, FlashMsg, 1U);
-		if (Status != XST_SUCCESS) {
-			goto END;
-		}
+	Status = Xbir_QspiWaitForErase();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
 
-		/* Wait for the erase command to be completed */
-		while (1U) {
-			RdStatusCmd = StatusCmd;
-			FlashMsg[0U].TxBfrPtr = &RdStatusCmd;
-			FlashMsg[0U].RxBfrPtr = NULL;
-			FlashMsg[0U].ByteCount = 1U;
-			FlashMsg[0U].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-			FlashMsg[0U].Flags = XQSPIPSU_MSG_FLAG_TX;
+	Address = Address & ~(FlashInfo.SectSize - 1U);
+	WrEnableCmd = WRITE_ENABLE_CMD;
 
-			FlashMsg[1U].TxBfrPtr = NULL;
-			FlashMsg[1U].RxBfrPtr = FlashStatus;
-			FlashMsg[1U].ByteCount = 2U;
-			FlashMsg[1U].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-			FlashMsg[1U].Flags = XQSPIPSU_MSG_FLAG_RX;
-			if (QspiPsuInstance.Config.ConnectionMode ==
-					XQSPIPSU_CONNECTION_MODE_PARALLEL) {
-				FlashMsg[1U].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
-			}
+	/* Translate address based on type of connection
+	 * If stacked assert the slave select based on address
+	 */
+	RealAddr = Xbir_GetQspiAddr(Address);
 
-			Status = XQspiPsu_PolledTransfer(&QspiPsuInstance,
-					FlashMsg, 2U);
-			if (Status != XST_SUCCESS) {
-				goto END;
-			}
+	/* Send the write enable command to the Flash so that it can be
+	 * written to, this needs to be sent as a separate
+	 * transfer before the write
+	 */
+	FlashMsg[0U].TxBfrPtr = &WrEnableCmd;
+	FlashMsg[0U].RxBfrPtr = NULL;
+	FlashMsg[0U].ByteCount = 1U;
+	FlashMsg[0U].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[0U].Flags = XQSPIPSU_MSG_FLAG_TX;
+	Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, FlashMsg, 1U);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
 
-			if (QspiPsuInstance.Config.ConnectionMode ==
-					XQSPIPSU_CONNECTION_MODE_PARALLEL) {
-				if (FsrFlag) {
-					FlashStatus[1U] &= FlashStatus[0U];
-				}
-				else {
-					FlashStatus[1U] |= FlashStatus[0U];
-				}
-			}
+	WrBuffer[COMMAND_OFFSET] = SEC_ERASE_CMD;
 
-			if (FsrFlag) {
-				if ((FlashStatus[1U] & 0x80U) != 0U) {
-					break;
-				}
-			}
-			else {
-				if ((FlashStatus[1U] & 0x01U) == 0U) {
-					break;
-				}
-			}
+	/* To be used only if 4B address sector erase cmd is
+	 * supported by flash
+	 */
+	WrBuffer[ADDRESS_1_OFFSET] =
+			(u8)((RealAddr & 0xFF000000U) >> 24U);
+	WrBuffer[ADDRESS_2_OFFSET] =
+			(u8)((RealAddr & 0xFF0000U) >> 16U);
+	WrBuffer[ADDRESS_3_OFFSET] =
+			(u8)((RealAddr & 0xFF00U) >> 8U);
+	WrBuffer[ADDRESS_4_OFFSET] =
+			(u8)(RealAddr & 0xFFU);
+
+	FlashMsg[0U].ByteCount = 5U;
+	FlashMsg[0U].TxBfrPtr = WrBuffer;
+	FlashMsg[0U].RxBfrPtr = NULL;
+	FlashMsg[0U].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[0U].Flags = XQSPIPSU_MSG_FLAG_TX;
+
+	Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, FlashMsg, 1U);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	EraseInProgress = TRUE;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function reads the flash status once and reports whether the last
+ * program or erase operation is still in progress.
+ *
+ * @param	Busy	Pointer to be set to TRUE while the flash is busy
+ *
+ * @return	XST_SUCCESS on successful status read
+ *		Error code on failure
+ *
+ *****************************************************************************/
+int Xbir_QspiIsBusy(u8 *Busy)
+{
+	int Status = XST_FAILURE;
+	u8 RdStatusCmd;
+	u8 FlashStatus[2U] = {0U};
+	XQspiPsu_Msg FlashMsg[2U] = {0U};
+
+	RdStatusCmd = StatusCmd;
+	FlashMsg[0U].TxBfrPtr = &RdStatusCmd;
+	FlashMsg[0U].RxBfrPtr = NULL;
+	FlashMsg[0U].ByteCount = 1U;
+	FlashMsg[0U].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[0U].Flags = XQSPIPSU_MSG_FLAG_TX;
+
+	FlashMsg[1U].TxBfrPtr = NULL;
+	FlashMsg[1U].RxBfrPtr = FlashStatus;
+	FlashMsg[1U].ByteCount = 2U;
+	FlashMsg[1U].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[1U].Flags = XQSPIPSU_MSG_FLAG_RX;
+	if (QspiPsuInstance.Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		FlashMsg[1U].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+	}
+
+	Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, FlashMsg, 2U);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	if (QspiPsuInstance.Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		if (FsrFlag) {
+			FlashStatus[1U] &= FlashStatus[0U];
+		}
+		else {
+			FlashStatus[1U] |= FlashStatus[0U];
 		}
-		Address += FlashInfo.SectSize;
+	}
+
+	*Busy = TRUE;
+	if (FsrFlag) {
+		if ((FlashStatus[1U] & 0x80U) != 0U) {
+			*Busy = FALSE;
+		}
+	}
+	else {
+		if ((FlashStatus[1U] & 0x01U) == 0U) {
+			*Busy = FALSE;
+		}
+	}
+
+	if (*Busy == FALSE) {
+		EraseInProgress = FALSE;
 	}
 
 END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief
+ * This function waits for the sector erase started by
+ * Xbir_QspiSectorEraseStart, if any, to complete.
+ *
+ * @return	XST_SUCCESS on success
+ *		Error code on failure
+ *
+ *****************************************************************************/
+static int Xbir_QspiWaitForErase(void)
+{
+	int Status = XST_SUCCESS;
+	u8 Busy;
+
+	while (EraseInProgress == TRUE) {
+		Status = Xbir_QspiIsBusy(&Busy);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+	}
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief
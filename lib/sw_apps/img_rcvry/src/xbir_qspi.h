@@ -16,6 +16,7 @@
 * Ver   Who    Date       Changes
 * ----- ---- ---------- -------------------------------------------------------
 * 1.00  bsv   07/02/20   First release
+* 2.00  fl    10/14/26   Added non blocking sector erase
 *
 * </pre>
 *
@@ -49,6 +50,8 @@ int Xbir_QspiInit (void);
 int Xbir_QspiRead (u32 SrcAddr, u8 *DestAddr, u32 Length);
 int Xbir_QspiWrite(u32 Addr, u8 *WrBuff, u32 Len);
 int Xbir_QspiFlashErase(u32 Address, u32 Length);
+int Xbir_QspiSectorEraseStart(u32 Address);
+int Xbir_QspiIsBusy(u8 *Busy);
 int Xbir_QspiWrite(u32 Address, u8 *WrBuffer, u32 Length);
 void Xbir_QspiGetPageSize(u16 *PageSize);
 void Xbir_QspiGetSectorSize(u32 *SectorSize);
@@ -56,6 +56,13 @@
 #define XBIR_SSI_IMG_BOOTABLE			(1U)
 #define XBIR_SSI_IMG_NON_BOOTABLE		(0U)
 
+/* Window of the pipelined upload is returned in chunks of at most this */
+#define XBIR_SSI_MAX_RECVED_LEN			(0xFFFFU)
+
+#if ((2U * TCP_WND) > XBIR_SYS_FLASH_PIPE_SIZE)
+#error "TCP_WND is too large for the image upload flash pipeline"
+#endif
+
 /**************************** Type Definitions *******************************/
 typedef enum {
 	XBIR_HTTP_REQ_GET_CONTENT_TYPE,
@@ -87,12 +94,18 @@ static int Xbir_SsiUpdateImg (struct tcp_pcb *Tpcb, u8 *HttpReq,
 	u16 HttpReqLen);
 static int Xbir_SsiInitiateImgUpdate (struct tcp_pcb *Tpcb, u8 *HttpReq,
 	u16 HttpReqLen, Xbir_SysBootImgId BootImgId);
+static int Xbir_SsiStartUpload (struct tcp_pcb *Tpcb,
+	Xbir_SysBootImgId BootImgId, u32 Size);
+static void Xbir_SsiStopUpload (void);
+static void Xbir_SsiUploadErrCallback (void *Arg, err_t Error);
 
 /************************** Variable Definitions *****************************/
 static u32 Xbir_SsiLastUploadSize;
 static Xbir_SysBootImgId Xbir_SsiLastImgUpload;
 static u8 PendingCfgCmd = FALSE;
 static u8 PendingCrcCmd = FALSE;
+static struct tcp_pcb *Xbir_SsiUploadPcb; /* Pipelined upload connection */
+static u32 Xbir_SsiUploadHeld; /* Received bytes not yet given back */
 
 /*****************************************************************************/
 /**
@@ -632,6 +645,13 @@ int Xbir_SsiProcessAdditionalPayload (struct tcp_pcb *Tpcb, u8 *HttpReq,
 			Xbir_Printf(DEBUG_INFO, " Starting img update\r\n");
 
 			Xbir_Printf(DEBUG_INFO, " Starting img upload to flash\r\n");
+			if (XBIR_SYS_BOOT_IMG_WIC != Xbir_SsiLastImgUpload) {
+				Status = Xbir_SsiStartUpload(Tpcb,
+					Xbir_SsiLastImgUpload, ImgSize);
+				if (Status != XST_SUCCESS) {
+					goto END;
+				}
+			}
 			Status = Xbir_SsiUpdateImg(Tpcb, ImgData, ImgSizeInThisPkt);
 			Xbir_SsiLastUploadSize = ImgSize;
 		}
@@ -1022,6 +1042,24 @@ static int Xbir_SsiUpdateImg (struct tcp_pcb *Tpcb, u8 *HttpReq,
 #endif
 		WriteDevice = Xbir_SysWriteFlash;
 
+	if (Xbir_SsiUploadPcb == Tpcb) {
+		/* Programmed by Xbir_SsiExecuteBackgroundTasks */
+		DataSize = HttpArg->Fsize;
+		if (DataSize > HttpReqLen) {
+			DataSize = HttpReqLen;
+		}
+		if (Xbir_SysFlashPipePut(HttpReq, DataSize) != DataSize) {
+			Xbir_Printf(DEBUG_INFO, " ERROR: Image write failed\r\n");
+			Status = XBIR_ERROR_IMAGE_WRITE;
+		}
+		else {
+			HttpArg->Fsize -= DataSize;
+			HttpArg->Offset += DataSize;
+			Status = XST_SUCCESS;
+		}
+		goto END;
+	}
+
 	if (HttpArg->Fsize > 0U) {
 		if (HttpArg->Fsize <= HttpReqLen) {
 			DataSize = HttpArg->Fsize;
@@ -1056,6 +1094,7 @@ static int Xbir_SsiUpdateImg (struct tcp_pcb *Tpcb, u8 *HttpReq,
 		Status = XST_SUCCESS;
 	}
 
+END:
 	return Status;
 }
 
@@ -1101,8 +1140,21 @@ static int Xbir_SsiInitiateImgUpdate (struct tcp_pcb *Tpcb, u8 *HttpReq,
 	}
 	HttpArg->Offset = Offset;
 
+	if (Xbir_SsiUploadPcb != NULL) {
+		Xbir_Printf(DEBUG_INFO, " ERROR: Image upload in progress\r\n");
+		Status = XBIR_ERROR_IMAGE_WRITE;
+		goto END;
+	}
+
 	if (HttpArg->Fsize > 0U) {
-		if ((FlashEraseStats->State != XBIR_FLASH_ERASE_COMPLETED) ||
+		if (XBIR_SYS_BOOT_IMG_WIC != BootImgId) {
+			Status = Xbir_SsiStartUpload(Tpcb, BootImgId,
+				HttpArg->Fsize);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+		else if ((FlashEraseStats->State != XBIR_FLASH_ERASE_COMPLETED) ||
 			(FlashEraseStats->CurrentImgErased != BootImgId)) {
 			goto END;
 		}
@@ -1120,3 +1172,184 @@ static int Xbir_SsiInitiateImgUpdate (struct tcp_pcb *Tpcb, u8 *HttpReq,
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function starts the pipelined upload of a QSPI image on the connection.
+ * The received image data is staged and programmed in the background, and the
+ * TCP window of the data is given back once it is programmed.
+ *
+ * @param	Tpcb		Pointer to TCP PCB
+ * @param	BootImgId	Boot Image ID
+ * @param	Size		Image size
+ *
+ * @return	XST_SUCCESS if the upload is started
+ *		Error code otherwise
+ *
+ *****************************************************************************/
+static int Xbir_SsiStartUpload (struct tcp_pcb *Tpcb,
+	Xbir_SysBootImgId BootImgId, u32 Size)
+{
+	int Status = XST_FAILURE;
+
+	if (Xbir_SsiUploadPcb != NULL) {
+		Xbir_Printf(DEBUG_INFO, " ERROR: Image upload in progress\r\n");
+		Status = XBIR_ERROR_IMAGE_WRITE;
+		goto END;
+	}
+
+	Status = Xbir_SysFlashPipeStart(BootImgId, Size);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Xbir_SsiUploadPcb = Tpcb;
+	Xbir_SsiUploadHeld = 0U;
+	tcp_err(Tpcb, Xbir_SsiUploadErrCallback);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function stops the pipelined upload without using its TCP PCB.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void Xbir_SsiStopUpload (void)
+{
+	Xbir_SysFlashPipeStop();
+	Xbir_SsiUploadPcb = NULL;
+	Xbir_SsiUploadHeld = 0U;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function is called by lwIP when the upload connection is aborted. The
+ * TCP PCB is already freed.
+ *
+ * @param	Arg	Pointer to Xbir_HttpArg instance
+ * @param	Error	Error code
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void Xbir_SsiUploadErrCallback (void *Arg, err_t Error)
+{
+	(void)Arg;
+
+	Xbir_Printf(DEBUG_INFO, " ERROR: Img upload connection aborted (%d)\r\n",
+		Error);
+	Xbir_SsiStopUpload();
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function returns how many of the received bytes are image data of the
+ * pipelined upload. Their TCP window is held back until they are programmed,
+ * so that the sender does not outrun the flash.
+ *
+ * @param	Tpcb	Pointer to TCP PCB
+ * @param	Len	Received payload length
+ *
+ * @return	Number of bytes whose window must not be given back yet
+ *
+ *****************************************************************************/
+u32 Xbir_SsiUploadHoldLen (struct tcp_pcb *Tpcb, u32 Len)
+{
+	u32 Held = 0U;
+	Xbir_HttpArg *HttpArg = (Xbir_HttpArg *)Tpcb->callback_arg;
+
+	if (Xbir_SsiUploadPcb == Tpcb) {
+		Held = HttpArg->Fsize;
+		if (Held > Len) {
+			Held = Len;
+		}
+		Xbir_SsiUploadHeld += Held;
+	}
+
+	return Held;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function cancels the pipelined upload of the connection, if any. It is
+ * called when the connection is closed.
+ *
+ * @param	Tpcb	Pointer to TCP PCB
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void Xbir_SsiUploadCancel (struct tcp_pcb *Tpcb)
+{
+	if ((Tpcb != NULL) && (Xbir_SsiUploadPcb == Tpcb)) {
+		tcp_err(Tpcb, NULL);
+		Xbir_SsiStopUpload();
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function programs the staged image data of the pipelined
+ * upload and gives the TCP window back to the sender. It is run in the loop
+ * present in Xbir_NwProcessPkts.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void Xbir_SsiExecuteBackgroundTasks (void)
+{
+	int Status = XST_FAILURE;
+	struct tcp_pcb *Tpcb = Xbir_SsiUploadPcb;
+	Xbir_FlashEraseStats *FlashEraseStats = Xbir_GetFlashEraseStats();
+	u32 Written;
+	u16 Len;
+
+	if (Tpcb == NULL) {
+		goto END;
+	}
+
+	Status = Xbir_SysFlashPipeRun(&Written);
+	if (Status != XST_SUCCESS) {
+		Xbir_Printf(DEBUG_INFO, " ERROR: Img upload to flash failed\r\n");
+		Xbir_HttpClose(Tpcb);
+		goto END;
+	}
+
+	if (Written > Xbir_SsiUploadHeld) {
+		Written = Xbir_SsiUploadHeld;
+	}
+	Xbir_SsiUploadHeld -= Written;
+	while (Written > 0U) {
+		Len = (Written > XBIR_SSI_MAX_RECVED_LEN) ?
+			XBIR_SSI_MAX_RECVED_LEN : (u16)Written;
+		tcp_recved(Tpcb, Len);
+		Written -= Len;
+	}
+
+	if (Xbir_SysFlashPipeIsDone() == TRUE) {
+		Xbir_SsiUploadCancel(Tpcb);
+		if (FlashEraseStats->State == XBIR_FLASH_ERASE_COMPLETED) {
+			FlashEraseStats->NumOfSectorsErased = 0U;
+			FlashEraseStats->State = XBIR_FLASH_ERASE_NOTSTARTED;
+		}
+		Status = Xbir_HttpSendResponseJson(Tpcb, NULL, 0U,
+				XBIR_SSI_JSON_SUCCESS_RESPONSE,
+				strlen(XBIR_SSI_JSON_SUCCESS_RESPONSE));
+		if (Status == XST_SUCCESS) {
+			(void)tcp_output(Tpcb);
+		}
+		Xbir_Printf(DEBUG_INFO, " Img upload to flash complete\r\n");
+	}
+
+END:
+	return;
+}
@@ -39,6 +39,9 @@ int Xbir_SsiUpdateImgB (struct tcp_pcb *Tpcb, u8 *HttpReq,
 	u16 HttpReqLen);
 u32 Xbir_SsiValidateLastUpdate (char *JsonStr, u16 JsonStrLen);
 int Xbir_SsiUpdateImgWIC (struct tcp_pcb *Tpcb, u8 *HttpReq, u16 HttpReqLen);
+u32 Xbir_SsiUploadHoldLen (struct tcp_pcb *Tpcb, u32 Len);
+void Xbir_SsiUploadCancel (struct tcp_pcb *Tpcb);
+void Xbir_SsiExecuteBackgroundTasks (void);
 
 #ifdef __cplusplus
 }
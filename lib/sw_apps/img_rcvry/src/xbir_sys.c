@@ -29,6 +29,7 @@
 *                        system controllers
 *       skd   01/31/23   Added debug print levels
 * 5.00  skd   05/02/23   Added Image recovery support for KD240 board
+* 6.00  fl    10/14/26   Added pipelined flash update with erase ahead
 *
 * </pre>
 *
@@ -132,10 +133,25 @@
 #define IOU_SLCR_SD_DLL_CTRL_OFFSET		(0XFF180358U)
 #define	IOU_SLCR_SD_CDN_CTRL_OFFSET		(0XFF18035CU)
 
+/* Flash pipeline related macros */
+#define XBIR_SYS_PIPE_PAGES_PER_RUN	(16U)
+#define XBIR_SYS_PIPE_ERASE_AHEAD	(2U) /* Sectors kept erased ahead */
+
 /**************************** Type Definitions *******************************/
 typedef int (*Xbir_ReadDevice) (u32 Offset, u8 *Data, u32 Size);
 typedef int (*Xbir_EraseDevice) (u32 Offset, u32 Size);
 
+/* Image data staged in WriteBuffer, used as a ring, on its way to QSPI */
+typedef struct {
+	u32 Offset;	/* QSPI address of the image */
+	u32 Size;	/* Image size */
+	u32 Staged;	/* Image bytes put in the ring */
+	u32 Programmed;	/* Image bytes written to QSPI */
+	u32 ErasedLen;	/* Image bytes from Offset which are erased */
+	u8 Active;
+	u8 EraseBusy;	/* Sector erase at Offset + ErasedLen is in progress */
+} Xbir_SysFlashPipe;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
@@ -202,11 +218,12 @@ static const u32 Xbir_UtilCrcTable[] = {
 static Xbir_SysBootImgInfo BootImgStatus = \
 		{{0x41U, 0x42U, 0x55U, 0x4DU}, 1U, 4U, 0xAEB1BDB9U, \
 		{0U, 0U, 1U, 1U}, 0x200000U, 0xF80000U, 0x1E00000U};
-static u8 WriteBuffer[XBIR_BUFFER_SIZE * 2U];
+static u8 WriteBuffer[XBIR_SYS_FLASH_PIPE_SIZE];
 static Xbir_SysInfo SysInfo = {0U};
 static Xbir_CCInfo CCInfo = {0U};
 u32 EmacBaseAddr = 0U;
 static u32 CalcCrc = 0xFFFFFFFFU;
+static Xbir_SysFlashPipe FlashPipe = {0U};
 
 /*****************************************************************************/
 /**
@@ -803,6 +820,12 @@ int Xbir_SysEraseBootImg (Xbir_SysBootImgId BootImgId)
 	u32 Offset;
 	Xbir_EraseDevice EraseDevice = NULL;
 
+	if (FlashPipe.Active == TRUE) {
+		Xbir_Printf(DEBUG_INFO, " ERROR: Image upload in progress\r\n");
+		Status = XBIR_ERROR_SECTOR_ERASE;
+		goto END;
+	}
+
 	if (FlashEraseStats->State == XBIR_FLASH_ERASE_NOTSTARTED) {
 		Xbir_QspiEraseStatsInit();
 		FlashEraseStats->State = XBIR_FLASH_ERASE_REQUESTED;
@@ -1374,6 +1397,244 @@ void Xbir_SysExecuteBackgroundTasks(void)
 	}
 }
 
+/*****************************************************************************/
+/**
+ * @brief
+ * This function starts the pipelined update of a QSPI boot image. The image
+ * data put with Xbir_SysFlashPipePut is programmed by Xbir_SysFlashPipeRun
+ * while more data is received. If the image region is not erased already,
+ * its sectors are erased just ahead of the programmed data.
+ *
+ * @param	BootImgId	Boot Image ID
+ * @param	Size		Image size
+ *
+ * @return	XST_SUCCESS if the update is started
+ *		Error code on failure
+ *
+ *****************************************************************************/
+int Xbir_SysFlashPipeStart (Xbir_SysBootImgId BootImgId, u32 Size)
+{
+	int Status = XST_FAILURE;
+	Xbir_FlashEraseStats *FlashEraseStats = Xbir_GetFlashEraseStats();
+	u32 Offset;
+
+	if ((BootImgId != XBIR_SYS_BOOT_IMG_A_ID) &&
+		(BootImgId != XBIR_SYS_BOOT_IMG_B_ID)) {
+		Status = XBIR_ERROR_BOOT_IMG_ID;
+		goto END;
+	}
+
+	if (Size > XBIR_QSPI_MAX_BOOT_IMG_SIZE) {
+		Xbir_Printf(DEBUG_INFO, " ERROR: Invalid image size\r\n");
+		Status = XBIR_ERROR_IMAGE_SIZE;
+		goto END;
+	}
+
+	Status = Xbir_SysGetBootImgOffset(BootImgId, &Offset);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Xbir_SysFlashPipeStop();
+	if ((FlashEraseStats->State == XBIR_FLASH_ERASE_COMPLETED) &&
+		(FlashEraseStats->CurrentImgErased == BootImgId)) {
+		FlashPipe.ErasedLen = Size;
+	}
+	else if (FlashEraseStats->State == XBIR_FLASH_ERASE_NOTSTARTED) {
+		FlashPipe.ErasedLen = 0U;
+	}
+	else {
+		Xbir_Printf(DEBUG_INFO, " ERROR: Flash erase in progress\r\n");
+		Status = XBIR_ERROR_SECTOR_ERASE;
+		goto END;
+	}
+
+	FlashPipe.Offset = Offset;
+	FlashPipe.Size = Size;
+	FlashPipe.Staged = 0U;
+	FlashPipe.Programmed = 0U;
+	FlashPipe.EraseBusy = FALSE;
+	FlashPipe.Active = TRUE;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function copies image data into the flash pipeline.
+ *
+ * @param	Data	Pointer to image data
+ * @param	Size	Size of image data
+ *
+ * @return	Number of bytes staged, less than Size if the pipeline is full
+ *
+ *****************************************************************************/
+u32 Xbir_SysFlashPipePut (const u8 *Data, u32 Size)
+{
+	u32 Free;
+	u32 Pos;
+	u32 Len;
+
+	if (FlashPipe.Active != TRUE) {
+		Size = 0U;
+		goto END;
+	}
+
+	Free = XBIR_SYS_FLASH_PIPE_SIZE - (FlashPipe.Staged - FlashPipe.Programmed);
+	if (Size > Free) {
+		Size = Free;
+	}
+	if (Size > (FlashPipe.Size - FlashPipe.Staged)) {
+		Size = FlashPipe.Size - FlashPipe.Staged;
+	}
+
+	Pos = FlashPipe.Staged & (XBIR_SYS_FLASH_PIPE_SIZE - 1U);
+	Len = XBIR_SYS_FLASH_PIPE_SIZE - Pos;
+	if (Len > Size) {
+		Len = Size;
+	}
+	memcpy(&WriteBuffer[Pos], Data, Len);
+	memcpy(WriteBuffer, &Data[Len], Size - Len);
+	FlashPipe.Staged += Size;
+
+END:
+	return Size;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function moves the flash pipeline forward without waiting for the
+ * flash. It programs up to XBIR_SYS_PIPE_PAGES_PER_RUN staged pages into the
+ * erased region and keeps XBIR_SYS_PIPE_ERASE_AHEAD sectors erased ahead of
+ * them. The last partial page is programmed once the whole image is staged.
+ * It is called repeatedly from the network processing loop.
+ *
+ * @param	Written	Pointer to return the number of bytes programmed
+ *
+ * @return	XST_SUCCESS on success
+ *		Error code on failure
+ *
+ *****************************************************************************/
+int Xbir_SysFlashPipeRun (u32 *Written)
+{
+	int Status = XST_SUCCESS;
+	u16 PageSize;
+	u32 SectorSize;
+	u32 Pages = 0U;
+	u32 Len;
+	u8 Busy;
+
+	*Written = 0U;
+	if (FlashPipe.Active != TRUE) {
+		goto END;
+	}
+
+	Xbir_QspiGetPageSize(&PageSize);
+	Xbir_QspiGetSectorSize(&SectorSize);
+
+	if (FlashPipe.EraseBusy == TRUE) {
+		Status = Xbir_QspiIsBusy(&Busy);
+		if (Status != XST_SUCCESS) {
+			Status = XBIR_ERROR_SECTOR_ERASE;
+			goto END;
+		}
+		if (Busy == TRUE) {
+			goto END;
+		}
+		FlashPipe.EraseBusy = FALSE;
+		FlashPipe.ErasedLen += SectorSize;
+	}
+
+	while (Pages < XBIR_SYS_PIPE_PAGES_PER_RUN) {
+		Len = FlashPipe.Staged - FlashPipe.Programmed;
+		if (Len > PageSize) {
+			Len = PageSize;
+		}
+		if ((Len == 0U) || ((Len < PageSize) &&
+			(FlashPipe.Staged != FlashPipe.Size)) ||
+			((FlashPipe.Programmed + Len) > FlashPipe.ErasedLen)) {
+			break;
+		}
+
+		/* The ring size is a multiple of the page size */
+		Status = Xbir_QspiWrite(FlashPipe.Offset + FlashPipe.Programmed,
+			&WriteBuffer[FlashPipe.Programmed &
+			(XBIR_SYS_FLASH_PIPE_SIZE - 1U)], Len);
+		if (Status != XST_SUCCESS) {
+			Xbir_Printf(DEBUG_INFO, " ERROR: Image write failed\r\n");
+			Status = XBIR_ERROR_IMAGE_WRITE;
+			goto END;
+		}
+		FlashPipe.Programmed += Len;
+		*Written += Len;
+		Pages++;
+	}
+
+	if ((FlashPipe.ErasedLen < FlashPipe.Size) &&
+		((FlashPipe.ErasedLen - FlashPipe.Programmed) <
+		(XBIR_SYS_PIPE_ERASE_AHEAD * SectorSize))) {
+		Status = Xbir_QspiSectorEraseStart(FlashPipe.Offset +
+			FlashPipe.ErasedLen);
+		if (Status != XST_SUCCESS) {
+			Xbir_Printf(DEBUG_INFO, " ERROR: Flash erase failed during"
+				" Boot Image update\r\n");
+			Status = XBIR_ERROR_SECTOR_ERASE;
+			goto END;
+		}
+		FlashPipe.EraseBusy = TRUE;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function tells whether the whole image of the flash pipeline is
+ * programmed.
+ *
+ * @return	TRUE if the image is programmed, FALSE otherwise
+ *
+ *****************************************************************************/
+u8 Xbir_SysFlashPipeIsDone (void)
+{
+	u8 IsDone = FALSE;
+
+	if ((FlashPipe.Active == TRUE) &&
+		(FlashPipe.Programmed == FlashPipe.Size)) {
+		IsDone = TRUE;
+	}
+
+	return IsDone;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function stops the flash pipeline. A sector erase in progress is
+ * waited for as the flash can not be used until it completes.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void Xbir_SysFlashPipeStop (void)
+{
+	int Status;
+	u8 Busy = FALSE;
+
+	if (FlashPipe.EraseBusy == TRUE) {
+		do {
+			Status = Xbir_QspiIsBusy(&Busy);
+		} while ((Status == XST_SUCCESS) && (Busy == TRUE));
+		FlashPipe.EraseBusy = FALSE;
+	}
+	FlashPipe.Active = FALSE;
+}
+
 #if (defined(XBIR_SD_0) || defined(XBIR_SD_1))
 /*****************************************************************************/
 /**
@@ -45,6 +45,8 @@ extern "C" {
 #define XBIR_FLASH_ERASE_STARTED	(2U)
 #define XBIR_FLASH_ERASE_COMPLETED	(3U)
 #define XBIR_BUFFER_SIZE	(0x100000U)
+/* Size of the flash pipeline ring, a power of 2 */
+#define XBIR_SYS_FLASH_PIPE_SIZE	(XBIR_BUFFER_SIZE * 2U)
 
 /**************************** Type Definitions *******************************/
 typedef struct {
@@ -180,6 +182,11 @@ int Xbir_SysWriteFlash (u32 Offset, u8 *Data, u32 Size,
 int Xbir_SysEraseBootImg (Xbir_SysBootImgId BootImgId);
 int Xbir_SysValidateCrc (Xbir_SysBootImgId BootImgId, u32 Size, u32 InCrc);
 void Xbir_SysExecuteBackgroundTasks(void);
+int Xbir_SysFlashPipeStart (Xbir_SysBootImgId BootImgId, u32 Size);
+u32 Xbir_SysFlashPipePut (const u8 *Data, u32 Size);
+int Xbir_SysFlashPipeRun (u32 *Written);
+u8 Xbir_SysFlashPipeIsDone (void);
+void Xbir_SysFlashPipeStop (void);
 #if (defined(XBIR_SD_0) || defined(XBIR_SD_1))
 int Xbir_SysWriteSD (u32 Offset, u8 *Data, u32 Size, Xbir_ImgDataStatus IsLast);
 #endif
@@ -24,7 +24,6 @@
 #include "xbir_ws.h"
 
 /************************** Constant Definitions *****************************/
-#define XBIR_WS_SND_BUF_SIZE		(1400U)
 
 /**************************** Type Definitions *******************************/
 
@@ -160,9 +159,6 @@ END:
 static err_t Xbir_WsHttpSentCallback (void *Arg, struct tcp_pcb *Tpcb,
 	u16_t Len)
 {
-	u32 SndBuffer;
-	u32 DataLen;
-	char Buffer[XBIR_WS_SND_BUF_SIZE];
 	Xbir_HttpArg *HttpArg = (Xbir_HttpArg *) Arg;
 
 #if XBIR_WS_ENABLE_DEBUG
@@ -189,27 +185,14 @@ static err_t Xbir_WsHttpSentCallback (void *Arg, struct tcp_pcb *Tpcb,
 	}
 
 	/* Read more data out of the file and send it */
-	do {
-		err_t Error;
-		SndBuffer = tcp_sndbuf(Tpcb);
-		if (SndBuffer < XBIR_WS_SND_BUF_SIZE) {
-			goto END;
-		}
-
-		Xbir_Printf(DEBUG_INFO, " Attempting to read %u bytes, left = %u bytes\r\n",
-			   XBIR_WS_SND_BUF_SIZE, HttpArg->Fsize);
-
-		f_read(&HttpArg->Fil, Buffer, XBIR_WS_SND_BUF_SIZE,
-			(unsigned int *)&DataLen);
-		Error = tcp_write(Tpcb, Buffer, DataLen, TCP_WRITE_FLAG_COPY);
-		if (Error != ERR_OK) {
-			Xbir_Printf(DEBUG_INFO, " ERROR: Failed to write data; aborting\r\n");
-			Xbir_HttpClose(Tpcb);
-			break;
-		}
-
-		HttpArg->Fsize -= DataLen;
-	} while (HttpArg->Fsize > 0U);
+	if (Xbir_HttpSendFileData(Tpcb, &HttpArg->Fil, &HttpArg->Fsize) !=
+		XST_SUCCESS) {
+		Xbir_Printf(DEBUG_INFO, " ERROR: Failed to write data; aborting\r\n");
+		Xbir_HttpClose(Tpcb);
+	}
+	else if (HttpArg->Fsize > 0U) {
+		goto END;
+	}
 
 	f_close(&HttpArg->Fil);
 
@@ -237,6 +220,7 @@ static err_t Xbir_WsHttpRecvCallback (void *Arg, struct tcp_pcb *Tpcb,
 {
 	err_t OutputError = ERR_VAL;
 	Xbir_HttpArg *HttpArg = (Xbir_HttpArg *) Arg;
+	u32 Held;
 
 	if ((Error != ERR_OK) || (Pkt == NULL)) {
 		Xbir_HttpClose(Tpcb);
@@ -257,8 +241,13 @@ static err_t Xbir_WsHttpRecvCallback (void *Arg, struct tcp_pcb *Tpcb,
 		goto END;
 	}
 
-	/* Acknowledge that we've read the payload */
-	tcp_recved(Tpcb, Pkt->len);
+	/* Acknowledge that we've read the payload, image data of a pipelined
+	 * upload is acknowledged once it is programmed
+	 */
+	Held = Xbir_SsiUploadHoldLen(Tpcb, Pkt->len);
+	if (Pkt->tot_len > Held) {
+		tcp_recved(Tpcb, Pkt->tot_len - Held);
+	}
 
 	HttpArg->PktCount++;
 
@@ -0,0 +1,343 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "xparameters.h"
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xil_cache.h"
+#include "xil_printf.h"
+#include "xiltimer.h"
+
+#include "memory_perf.h"
+
+#ifdef XPAR_XZDMA_0_BASEADDR
+#include "xzdma.h"
+#endif
+
+/*
+ * memory_perf.c: Measure the bandwidth and latency of the memory ranges.
+ *
+ * Every test works on a buffer at the start of the range, the content of the
+ * range is lost. The numbers are printed with integer math, so that the
+ * application still does not need floating point printf support.
+ */
+
+/* Cache line size used by the latency test */
+#define PERF_LINE_BYTES		64U
+
+/* STREAM element, the native word of the processor */
+typedef UINTPTR perf_elem_t;
+
+#define PERF_SCALAR	((perf_elem_t)3)
+
+#ifdef XPAR_XZDMA_0_BASEADDR
+static XZDma perf_zdma;
+static u8 perf_zdma_ready;
+#endif
+
+static u64 perf_ticks(void)
+{
+    XTime now;
+
+    XTime_GetTime(&now);
+    return (u64)now;
+}
+
+static void perf_print_rate(const char8 *label, u64 bytes, u64 ticks)
+{
+    u64 rate = 0U;
+
+    if (ticks != 0U) {
+        rate = (bytes * XTime_GetTimeFreq()) / ticks / 1000000U;
+    }
+    xil_printf("%s%lu MB/s\n\r", label, (unsigned long)rate);
+}
+
+static void perf_stream(perf_elem_t *a, perf_elem_t *b, perf_elem_t *c,
+                        u32 n)
+{
+    static const char8 *labels[4] = {
+        "          STREAM copy: ",
+        "         STREAM scale: ",
+        "           STREAM add: ",
+        "         STREAM triad: ",
+    };
+    /* Bytes moved per element: copy and scale 2 words, add and triad 3 */
+    static const u32 words[4] = { 2U, 2U, 3U, 3U };
+    u64 best[4];
+    u64 start;
+    u64 ticks;
+    u32 i;
+    u32 k;
+    u32 run;
+
+    for (i = 0U; i < n; i++) {
+        a[i] = (perf_elem_t)1;
+        b[i] = (perf_elem_t)2;
+        c[i] = (perf_elem_t)0;
+    }
+
+    for (k = 0U; k < 4U; k++) {
+        best[k] = ~(u64)0;
+    }
+
+    for (run = 0U; run < MEMORY_PERF_NTIMES; run++) {
+        for (k = 0U; k < 4U; k++) {
+            start = perf_ticks();
+            switch (k) {
+            case 0U:
+                for (i = 0U; i < n; i++) {
+                    c[i] = a[i];
+                }
+                break;
+            case 1U:
+                for (i = 0U; i < n; i++) {
+                    b[i] = PERF_SCALAR * c[i];
+                }
+                break;
+            case 2U:
+                for (i = 0U; i < n; i++) {
+                    c[i] = a[i] + b[i];
+                }
+                break;
+            default:
+                for (i = 0U; i < n; i++) {
+                    a[i] = b[i] + PERF_SCALAR * c[i];
+                }
+                break;
+            }
+            ticks = perf_ticks() - start;
+            if (ticks < best[k]) {
+                best[k] = ticks;
+            }
+        }
+    }
+
+    for (k = 0U; k < 4U; k++) {
+        perf_print_rate(labels[k],
+                        (u64)words[k] * n * sizeof(perf_elem_t), best[k]);
+    }
+}
+
+static void perf_latency(UINTPTR base, u32 bytes)
+{
+    u32 lines = bytes / PERF_LINE_BYTES;
+    u32 seed = 1U;
+    u32 i;
+    u32 j;
+    UINTPTR tmp;
+    UINTPTR p;
+    u64 start;
+    u64 ticks;
+    u64 tenths;
+    volatile UINTPTR *line;
+
+    if (lines < 2U) {
+        return;
+    }
+
+    /*
+     * The first word of every line holds the address of the next line of
+     * a single random cycle (Sattolo's shuffle), so each load depends on
+     * the previous one and the prefetchers cannot guess the next address.
+     */
+    for (i = 0U; i < lines; i++) {
+        *(UINTPTR *)(base + ((UINTPTR)i * PERF_LINE_BYTES)) = (UINTPTR)i;
+    }
+    for (i = lines - 1U; i > 0U; i--) {
+        seed = (seed * 1103515245U) + 12345U;
+        j = (seed >> 8) % i;
+        tmp = *(UINTPTR *)(base + ((UINTPTR)i * PERF_LINE_BYTES));
+        *(UINTPTR *)(base + ((UINTPTR)i * PERF_LINE_BYTES)) =
+            *(UINTPTR *)(base + ((UINTPTR)j * PERF_LINE_BYTES));
+        *(UINTPTR *)(base + ((UINTPTR)j * PERF_LINE_BYTES)) = tmp;
+    }
+    for (i = 0U; i < lines; i++) {
+        line = (volatile UINTPTR *)(base + ((UINTPTR)i * PERF_LINE_BYTES));
+        *line = base + (*line * PERF_LINE_BYTES);
+    }
+
+    p = base;
+    start = perf_ticks();
+    for (i = 0U; i < MEMORY_PERF_CHASE_LOADS; i += 8U) {
+        p = *(volatile UINTPTR *)p;
+        p = *(volatile UINTPTR *)p;
+        p = *(volatile UINTPTR *)p;
+        p = *(volatile UINTPTR *)p;
+        p = *(volatile UINTPTR *)p;
+        p = *(volatile UINTPTR *)p;
+        p = *(volatile UINTPTR *)p;
+        p = *(volatile UINTPTR *)p;
+    }
+    ticks = perf_ticks() - start;
+
+    /* Keep the chase alive, p is always inside the buffer */
+    if (p < base) {
+        print("              Latency: FAILED!\n\r");
+        return;
+    }
+
+    tenths = (ticks * 10000000000ULL) / XTime_GetTimeFreq() /
+             MEMORY_PERF_CHASE_LOADS;
+    xil_printf("              Latency: %lu.%lu ns/access\n\r",
+               (unsigned long)(tenths / 10U), (unsigned long)(tenths % 10U));
+}
+
+#ifdef XPAR_XZDMA_0_BASEADDR
+static XStatus perf_zdma_init(void)
+{
+    XZDma_Config *config;
+    XZDma_DataConfig data_config;
+
+    if (perf_zdma_ready != 0U) {
+        return XST_SUCCESS;
+    }
+
+#ifndef SDT
+    config = XZDma_LookupConfig(XPAR_XZDMA_0_DEVICE_ID);
+#else
+    config = XZDma_LookupConfig(XPAR_XZDMA_0_BASEADDR);
+#endif
+    if (config == NULL) {
+        return XST_FAILURE;
+    }
+    if (XZDma_CfgInitialize(&perf_zdma, config, config->BaseAddress) !=
+        XST_SUCCESS) {
+        return XST_FAILURE;
+    }
+    if (XZDma_SetMode(&perf_zdma, FALSE, XZDMA_NORMAL_MODE) != XST_SUCCESS) {
+        return XST_FAILURE;
+    }
+
+    /* Longest bursts and most outstanding reads, as in the ZDMA examples */
+    data_config.OverFetch = 1U;
+    data_config.SrcIssue = 0x1FU;
+    data_config.SrcBurstType = XZDMA_INCR_BURST;
+    data_config.SrcBurstLen = 0xFU;
+    data_config.DstBurstType = XZDMA_INCR_BURST;
+    data_config.DstBurstLen = 0xFU;
+    data_config.SrcCache = 0x2U;
+    data_config.DstCache = 0x2U;
+    if (config->IsCacheCoherent != 0U) {
+        data_config.SrcCache = 0xFU;
+        data_config.DstCache = 0xFU;
+    }
+    data_config.SrcQos = 0U;
+    data_config.DstQos = 0U;
+    (void)XZDma_SetChDataConfig(&perf_zdma, &data_config);
+
+    perf_zdma_ready = 1U;
+    return XST_SUCCESS;
+}
+
+static void perf_dma(UINTPTR base, u32 bytes)
+{
+    XZDma_Transfer data;
+    u64 start;
+    u64 ticks;
+    u64 best = ~(u64)0;
+    u32 status;
+    u32 run;
+
+    if ((bytes == 0U) || (perf_zdma_init() != XST_SUCCESS)) {
+        print("            ZDMA copy: SKIPPED\n\r");
+        return;
+    }
+
+#ifdef MEMORY_PERF_DCACHE
+    Xil_DCacheFlushRange((INTPTR)base, 2U * bytes);
+#endif
+
+    data.SrcAddr = base;
+    data.DstAddr = base + bytes;
+    data.Size = bytes;
+    data.SrcCoherent = 1U;
+    data.DstCoherent = 1U;
+    data.Pause = 0U;
+
+    for (run = 0U; run < MEMORY_PERF_NTIMES; run++) {
+        XZDma_IntrClear(&perf_zdma, XZDMA_IXR_ALL_INTR_MASK);
+        start = perf_ticks();
+        if (XZDma_Start(&perf_zdma, &data, 1U) != XST_SUCCESS) {
+            print("            ZDMA copy: FAILED!\n\r");
+            return;
+        }
+        do {
+            status = XZDma_IntrGetStatus(&perf_zdma);
+        } while ((status & (XZDMA_IXR_DMA_DONE_MASK |
+                            XZDMA_IXR_AXI_WR_DATA_MASK |
+                            XZDMA_IXR_AXI_RD_DATA_MASK)) == 0U);
+        ticks = perf_ticks() - start;
+
+        /* Polled, the interrupt handler does not mark the channel idle */
+        XZDma_IntrClear(&perf_zdma, status);
+        perf_zdma.ChannelState = XZDMA_IDLE;
+
+        if ((status & XZDMA_IXR_DMA_DONE_MASK) == 0U) {
+            print("            ZDMA copy: FAILED!\n\r");
+            return;
+        }
+        if (ticks < best) {
+            best = ticks;
+        }
+    }
+
+#ifdef MEMORY_PERF_DCACHE
+    Xil_DCacheInvalidateRange((INTPTR)(base + bytes), bytes);
+#endif
+
+    /* Every byte is read once and written once */
+    perf_print_rate("            ZDMA copy: ", 2U * (u64)bytes, best);
+}
+#endif
+
+void perf_memory_range(struct memory_range_s *range) {
+    u32 bytes;
+    u32 n;
+
+    print("Measuring memory region: "); print(range->name);  print("\n\r");
+
+#if defined(__MICROBLAZE__) && !defined(__arch64__) && (XPAR_MICROBLAZE_ADDR_SIZE > 32)
+    /* The region may be above 4 GB, out of reach of 32-bit pointers */
+    print("          Performance: SKIPPED\n\r");
+    return;
+#endif
+
+#ifdef MEMORY_PERF_DCACHE
+    Xil_DCacheEnable();
+#endif
+
+    /* Three STREAM arrays of whole cache lines */
+    bytes = range->size / 3U;
+    if (bytes > MEMORY_PERF_MAX_BYTES) {
+        bytes = MEMORY_PERF_MAX_BYTES;
+    }
+    bytes &= ~(PERF_LINE_BYTES - 1U);
+    n = bytes / (u32)sizeof(perf_elem_t);
+    if (n != 0U) {
+        perf_stream((perf_elem_t *)range->base,
+                    (perf_elem_t *)(range->base + bytes),
+                    (perf_elem_t *)(range->base + (2U * (UINTPTR)bytes)), n);
+    }
+
+    bytes = range->size;
+    if (bytes > MEMORY_PERF_MAX_BYTES) {
+        bytes = MEMORY_PERF_MAX_BYTES;
+    }
+    perf_latency(range->base, bytes & ~(PERF_LINE_BYTES - 1U));
+
+#ifdef XPAR_XZDMA_0_BASEADDR
+    /* Copy the first half of the buffer to the second half */
+    bytes = range->size / 2U;
+    if (bytes > MEMORY_PERF_MAX_BYTES) {
+        bytes = MEMORY_PERF_MAX_BYTES;
+    }
+    perf_dma(range->base, bytes & ~(PERF_LINE_BYTES - 1U));
+#endif
+
+#ifdef MEMORY_PERF_DCACHE
+    Xil_DCacheDisable();
+#endif
+}
@@ -0,0 +1,43 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef __MEMORY_PERF_H_
+#define __MEMORY_PERF_H_
+
+#include "memory_config.h"
+
+/*
+ * memory_perf.c: Measure the bandwidth and latency of the memory ranges.
+ *
+ * The performance mode is built in when MEMORY_TESTS_PERF is defined, e.g.
+ * with -DMEMORY_TESTS_PERF in the compiler flags of the application. It runs
+ * after the memory tests, on every range in memory_ranges[]:
+ *   - STREAM copy, scale, add and triad, reported in MB/s
+ *   - dependent loads over a random cycle of cache lines, in ns/access
+ *   - ZDMA copy, in MB/s, when the design has a ZDMA
+ *
+ * Like the memory tests, it runs with the D-Cache disabled and so measures
+ * the memory itself. Define MEMORY_PERF_DCACHE to run it with the D-Cache
+ * enabled instead.
+ */
+
+/* Largest buffer used per range and test, in bytes */
+#ifndef MEMORY_PERF_MAX_BYTES
+#define MEMORY_PERF_MAX_BYTES	(8U * 1024U * 1024U)
+#endif
+
+/* Number of times each STREAM kernel is run, the best run is reported */
+#ifndef MEMORY_PERF_NTIMES
+#define MEMORY_PERF_NTIMES	4U
+#endif
+
+/* Number of loads of the latency test */
+#ifndef MEMORY_PERF_CHASE_LOADS
+#define MEMORY_PERF_CHASE_LOADS	(1U << 20)
+#endif
+
+void perf_memory_range(struct memory_range_s *range);
+
+#endif
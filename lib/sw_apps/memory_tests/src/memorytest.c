@@ -13,6 +13,9 @@
 #include "platform.h"
 #include "memory_config.h"
 #include "xil_printf.h"
+#ifdef MEMORY_TESTS_PERF
+#include "memory_perf.h"
+#endif
 
 /*
  * memory_test.c: Test memory ranges present in the Hardware Design.
@@ -90,6 +93,12 @@ int main()
         test_memory_range(&memory_ranges[i]);
     }
 
+#ifdef MEMORY_TESTS_PERF
+    for (i = 0; i < n_memory_ranges; i++) {
+        perf_memory_range(&memory_ranges[i]);
+    }
+#endif
+
     print("--Memory Test Application Complete--\n\r");
     print("Successfully ran Memory Test Application");
     cleanup_platform();
@@ -19,7 +19,8 @@
 #define __section_t(S)          __attribute__((__section__(#S)))
 #define __resource              __section_t(.resource_table)
 
-#define RPMSG_VDEV_DFEATURES        (1 << VIRTIO_RPMSG_F_NS)
+#define RPMSG_VDEV_DFEATURES        ((1 << VIRTIO_RPMSG_F_NS) | \
+				     VIRTIO_RING_F_EVENT_IDX)
 
 /* VirtIO rpmsg device id */
 #define VIRTIO_ID_RPMSG_             7
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RPC_BENCH_H
+#define RPC_BENCH_H
+
+#include <stdint.h>
+
+#define RPMSG_SERVICE_NAME         "rpmsg-openamp-demo-channel"
+
+/* Function IDs served by the remote */
+#define RPC_BENCH_FUNC_ECHO		0x1	/* Reply with the request payload */
+#define RPC_BENCH_FUNC_DEFERRED_ECHO	0x2	/* Same, completed out of order */
+#define RPC_BENCH_FUNC_STATS		0x3	/* Reply with struct rpc_bench_stats */
+#define RPC_BENCH_FUNC_RESET		0x4	/* Clear the statistics */
+
+/* Deferred echo requests held back and then answered newest first */
+#define RPC_BENCH_DEFER_DEPTH	4
+
+/* Service time histogram, one bin per microsecond, last bin for the rest */
+#define RPC_BENCH_H
+
+#include <stdint.h>IST_BINS	64
+
+/* Sent as a raw 4 byte message, outside the RPC framing */
+#define SHUTDOWN_MSG	0xEF56A55A
+
+struct rpc_bench_stats {
+	uint32_t calls;		/* Requests answered */
+	uint32_t p50_ns;	/* Median service time */
+	uint32_t p99_ns;	/* 99th percentile service time */
+	uint32_t max_ns;	/* Longest service time */
+	uint32_t calls_per_sec;	/* Since the first request */
+};
+
+#endif /* RPC_BENCH_H */
@@ -0,0 +1,299 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * This is a sample demonstration application that showcases pipelined RPC on
+ * top of rpmsg on the remote core. This application is meant to run on the
+ * remote CPU running baremetal code. The host keeps several calls in flight,
+ * the remote answers echo calls in order and deferred echo calls out of
+ * order, and keeps service time statistics that are returned with the
+ * stats call and printed on shutdown. Responses carry the host time stamp
+ * of their request back, so the host measures the round trip latency.
+ */
+
+#include "xil_printf.h"
+#include <string.h>
+#include <openamp/open_amp.h>
+#include "xiltimer.h"
+#include "rpc_pipe.h"
+#include "rpc_bench.h"
+#include "platform_info.h"
+
+/* Set to 0 to send every response in its own rpmsg buffer */
+#ifndef RPC_BENCH_BATCH
+#define RPC_BENCH_BATCH		1
+#endif
+
+/* Longest payload of a deferred echo call */
+#define RPC_BENCH_DEFER_MAX_LEN	64
+
+#define LPRINTF(fmt, ...) xil_printf("%s():%u " fmt, __func__, __LINE__, ##__VA_ARGS__)
+#define LPERROR(fmt, ...) LPRINTF("ERROR: " fmt, ##__VA_ARGS__)
+
+struct rpc_bench_deferred {
+	struct rpc_pipe_hdr req;
+	XTime arrival;
+	uint8_t data[RPC_BENCH_DEFER_MAX_LEN];
+};
+
+/* Local variables */
+static struct rpmsg_endpoint lept;
+static struct rpc_pipe rpc;
+static int shutdown_req = 0;
+
+static struct rpc_bench_deferred deferred[RPC_BENCH_DEFER_DEPTH];
+static unsigned int ndeferred;
+
+/* Arrival time of the message being processed */
+static XTime rx_stamp;
+
+static uint32_t counts_per_us;
+static uint32_t calls;
+static XTime first_call;
+static XTime last_call;
+static XTime max_counts;
+static uint32_t hist[RPC_BENCH_HIST_BINS];
+
+/*-----------------------------------------------------------------------------*
+ *  Service time statistics
+ *-----------------------------------------------------------------------------*/
+static void stats_reset(void)
+{
+	calls = 0;
+	max_counts = 0;
+	memset(hist, 0, sizeof(hist));
+}
+
+static void stats_record(XTime arrival)
+{
+	XTime now = XTimer_GetTimestamp();
+	XTime counts = now - arrival;
+	XTime bin = counts / counts_per_us;
+
+	if (!calls)
+		first_call = arrival;
+	last_call = now;
+	calls++;
+	if (counts > max_counts)
+		max_counts = counts;
+	if (bin >= RPC_BENCH_HIST_BINS)
+		bin = RPC_BENCH_HIST_BINS - 1;
+	hist[bin]++;
+}
+
+static uint32_t stats_percentile_ns(unsigned int pct)
+{
+	uint32_t rank = (calls * pct + 99) / 100;
+	uint32_t seen = 0;
+	unsigned int i;
+
+	for (i = 0; i < RPC_BENCH_HIST_BINS - 1; i++) {
+		seen += hist[i];
+		if (seen >= rank)
+			return (i + 1) * 1000;
+	}
+
+	return (uint32_t)(max_counts * 1000 / counts_per_us);
+}
+
+static void stats_get(struct rpc_bench_stats *stats)
+{
+	XTime elapsed = last_call - first_call;
+
+	stats->calls = calls;
+	stats->p50_ns = calls ? stats_percentile_ns(50) : 0;
+	stats->p99_ns = calls ? stats_percentile_ns(99) : 0;
+	stats->max_ns = (uint32_t)(max_counts * 1000 / counts_per_us);
+	stats->calls_per_sec = elapsed ?
+		(uint32_t)((XTime)calls * XTimer_GetTimestampFreq() / elapsed) :
+		0;
+}
+
+/*-----------------------------------------------------------------------------*
+ *  RPC handlers
+ *-----------------------------------------------------------------------------*/
+static int echo_handler(struct rpc_pipe *p, const struct rpc_pipe_hdr *req,
+			void *data, void *priv)
+{
+	int ret;
+
+	(void)priv;
+
+	ret = rpc_pipe_reply(p, req, 0, data, req->len);
+	stats_record(rx_stamp);
+	return ret;
+}
+
+static int deferred_echo_handler(struct rpc_pipe *p,
+				 const struct rpc_pipe_hdr *req,
+				 void *data, void *priv)
+{
+	struct rpc_bench_deferred *d;
+	int ret = 0;
+
+	(void)priv;
+
+	if (req->len > RPC_BENCH_DEFER_MAX_LEN)
+		return rpc_pipe_reply(p, req, (uint32_t)RPMSG_ERR_PARAM,
+				      NULL, 0);
+
+	d = &deferred[ndeferred++];
+	d->req = *req;
+	d->arrival = rx_stamp;
+	memcpy(d->data, data, req->len);
+
+	/* Once the queue is full, complete it newest first */
+	if (ndeferred == RPC_BENCH_DEFER_DEPTH) {
+		while (ndeferred) {
+			d = &deferred[--ndeferred];
+			ret = rpc_pipe_reply(p, &d->req, 0, d->data,
+					     d->req.len);
+			if (ret)
+				break;
+			stats_record(d->arrival);
+		}
+		ndeferred = 0;
+	}
+
+	return ret;
+}
+
+static int stats_handler(struct rpc_pipe *p, const struct rpc_pipe_hdr *req,
+			 void *data, void *priv)
+{
+	struct rpc_bench_stats stats;
+
+	(void)data;
+	(void)priv;
+
+	stats_get(&stats);
+	return rpc_pipe_reply(p, req, 0, &stats, sizeof(stats));
+}
+
+static int reset_handler(struct rpc_pipe *p, const struct rpc_pipe_hdr *req,
+			 void *data, void *priv)
+{
+	(void)data;
+	(void)priv;
+
+	stats_reset();
+	return rpc_pipe_reply(p, req, 0, NULL, 0);
+}
+
+/*-----------------------------------------------------------------------------*
+ *  RPMSG callbacks setup by remoteproc_resource_init()
+ *-----------------------------------------------------------------------------*/
+static int rpmsg_endpoint_cb(struct rpmsg_endpoint *ept, void *data, size_t len,
+			     uint32_t src, void *priv)
+{
+	(void)ept;
+	(void)priv;
+	(void)src;
+
+	if (len == sizeof(uint32_t) &&
+	    (*(unsigned int *)data) == SHUTDOWN_MSG) {
+		ML_INFO("shutdown message is received.\r\n");
+		shutdown_req = 1;
+		return RPMSG_SUCCESS;
+	}
+
+	rx_stamp = XTimer_GetTimestamp();
+	if (rpc_pipe_receive(&rpc, data, len))
+		ML_ERR("RPC message processing failed\r\n");
+
+	return RPMSG_SUCCESS;
+}
+
+static void rpmsg_service_unbind(struct rpmsg_endpoint *ept)
+{
+	(void)ept;
+	ML_ERR("Endpoint is destroyed\r\n");
+	shutdown_req = 1;
+}
+
+/*-----------------------------------------------------------------------------*
+ *  Application
+ *-----------------------------------------------------------------------------*/
+int app(struct rpmsg_device *rdev, void *priv)
+{
+	struct rpc_bench_stats stats;
+	int ret;
+
+	counts_per_us = XTimer_GetTimestampFreq() / 1000000U;
+	if (!counts_per_us)
+		counts_per_us = 1;
+
+	ret = rpmsg_create_ept(&lept, rdev, RPMSG_SERVICE_NAME,
+			       RPMSG_ADDR_ANY, RPMSG_ADDR_ANY,
+			       rpmsg_endpoint_cb,
+			       rpmsg_service_unbind);
+	if (ret) {
+		ML_ERR("Failed to create endpoint.\r\n");
+		return -1;
+	}
+
+	rpc_pipe_init(&rpc, &lept, RPC_BENCH_BATCH);
+	rpc_pipe_register(&rpc, RPC_BENCH_FUNC_ECHO, echo_handler, NULL);
+	rpc_pipe_register(&rpc, RPC_BENCH_FUNC_DEFERRED_ECHO,
+			  deferred_echo_handler, NULL);
+	rpc_pipe_register(&rpc, RPC_BENCH_FUNC_STATS, stats_handler, NULL);
+	rpc_pipe_register(&rpc, RPC_BENCH_FUNC_RESET, reset_handler, NULL);
+
+	ML_INFO("Waiting for events...\r\n");
+	while(1) {
+		platform_poll(priv);
+		/* we got a shutdown request, exit */
+		if (shutdown_req) {
+			break;
+		}
+	}
+
+	stats_get(&stats);
+	xil_printf("RPC calls %u, %u calls/s, service time p50 %u ns, "
+		   "p99 %u ns, max %u ns\r\n", stats.calls,
+		   stats.calls_per_sec, stats.p50_ns, stats.p99_ns,
+		   stats.max_ns);
+
+	rpmsg_destroy_ept(&lept);
+
+	return 0;
+}
+
+/*-----------------------------------------------------------------------------*
+ *  Application entry point
+ *-----------------------------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+	void *platform;
+	struct rpmsg_device *rpdev;
+	int ret;
+
+	LPRINTF("Starting application...\r\n");
+
+	/* Initialize platform */
+	ret = platform_init(argc, argv, &platform);
+	if (ret) {
+		LPERROR("Failed to initialize platform.\r\n");
+		ret = -1;
+	} else {
+		rpdev = platform_create_rpmsg_vdev(platform, 0,
+						   VIRTIO_DEV_DEVICE,
+						   NULL, NULL);
+		if (!rpdev) {
+			ML_ERR("Failed to create rpmsg virtio device.\r\n");
+			ret = -1;
+		} else {
+			app(rpdev, platform);
+			platform_release_rpmsg_vdev(rpdev, platform);
+			ret = 0;
+		}
+	}
+
+	ML_INFO("Stopping application...\r\n");
+	platform_cleanup(platform);
+
+	return ret;
+}
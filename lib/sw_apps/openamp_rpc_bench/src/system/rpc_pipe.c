@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Pipelined RPC over a single rpmsg endpoint, see rpc_pipe.h.
+ */
+
+#include <string.h>
+#include "rpc_pipe.h"
+
+#define RPC_PIPE_ALIGN(x)	(((x) + 3U) & ~3U)
+
+/* Room for records in a batch, after the container header */
+#define RPC_PIPE_BATCH_ROOM	(RPC_PIPE_BATCH_SIZE - \
+				 sizeof(struct rpc_pipe_hdr))
+
+static int rpc_pipe_send_direct(struct rpc_pipe *pipe,
+				const struct rpc_pipe_hdr *hdr,
+				const void *data)
+{
+	uint32_t size = sizeof(*hdr) + hdr->len;
+	uint32_t buf_size;
+	uint8_t *buf;
+	int ret;
+
+	buf = rpmsg_get_tx_payload_buffer(pipe->ept, &buf_size, 1);
+	if (!buf)
+		return RPMSG_ERR_NO_BUFF;
+	if (size > buf_size) {
+		rpmsg_release_tx_buffer(pipe->ept, buf);
+		return RPMSG_ERR_PARAM;
+	}
+
+	memcpy(buf, hdr, sizeof(*hdr));
+	if (hdr->len)
+		memcpy(buf + sizeof(*hdr), data, hdr->len);
+
+	ret = rpmsg_send_nocopy(pipe->ept, buf, size);
+	return ret < 0 ? ret : 0;
+}
+
+static int rpc_pipe_send_record(struct rpc_pipe *pipe,
+				const struct rpc_pipe_hdr *hdr,
+				const void *data)
+{
+	uint32_t rec_len = RPC_PIPE_ALIGN(sizeof(*hdr) + hdr->len);
+	uint8_t *rec;
+	int ret;
+
+	if (!pipe->batch || rec_len > RPC_PIPE_BATCH_ROOM)
+		return rpc_pipe_send_direct(pipe, hdr, data);
+
+	if (pipe->batch_len + rec_len > RPC_PIPE_BATCH_ROOM) {
+		ret = rpc_pipe_flush(pipe);
+		if (ret)
+			return ret;
+	}
+
+	rec = pipe->batch_buf + sizeof(struct rpc_pipe_hdr) + pipe->batch_len;
+	memcpy(rec, hdr, sizeof(*hdr));
+	if (hdr->len)
+		memcpy(rec + sizeof(*hdr), data, hdr->len);
+	pipe->batch_len += rec_len;
+
+	return 0;
+}
+
+/**
+ * rpc_pipe_init - initialize a pipe on an endpoint
+ *
+ * @pipe: pipe to initialize
+ * @ept: connected rpmsg endpoint
+ * @batch: non-zero to pack records until rpc_pipe_flush()
+ */
+void rpc_pipe_init(struct rpc_pipe *pipe, struct rpmsg_endpoint *ept,
+		   int batch)
+{
+	memset(pipe, 0, sizeof(*pipe));
+	pipe->ept = ept;
+	pipe->batch = batch;
+}
+
+/**
+ * rpc_pipe_register - register a request handler
+ *
+ * @pipe: pipe
+ * @func: function ID
+ * @handler: handler for requests with this function ID
+ * @priv: passed to the handler
+ *
+ * Return: 0 on success, RPMSG_ERR_NO_MEM if the function table is full
+ */
+int rpc_pipe_register(struct rpc_pipe *pipe, uint16_t func,
+		      rpc_pipe_handler handler, void *priv)
+{
+	struct rpc_pipe_func *f;
+
+	if (pipe->nfuncs == RPC_PIPE_MAX_FUNCS || func == RPC_PIPE_FUNC_BATCH)
+		return RPMSG_ERR_NO_MEM;
+
+	f = &pipe->funcs[pipe->nfuncs++];
+	f->func = func;
+	f->handler = handler;
+	f->priv = priv;
+
+	return 0;
+}
+
+/**
+ * rpc_pipe_call - start a call without waiting for its response
+ *
+ * @pipe: pipe
+ * @func: function ID
+ * @stamp: caller time stamp, echoed in the response
+ * @data: request payload
+ * @len: request payload length
+ * @done: called with the response
+ * @priv: passed to done
+ *
+ * Return: request ID (>= 0), or RPMSG_ERR_NO_BUFF if RPC_PIPE_MAX_CALLS
+ * calls are outstanding, or a send error
+ */
+int rpc_pipe_call(struct rpc_pipe *pipe, uint16_t func, uint64_t stamp,
+		  const void *data, uint32_t len, rpc_pipe_done done,
+		  void *priv)
+{
+	struct rpc_pipe_hdr hdr;
+	struct rpc_pipe_call *call;
+	int ret;
+
+	if (pipe->ncalls == RPC_PIPE_MAX_CALLS)
+		return RPMSG_ERR_NO_BUFF;
+
+	hdr.id = pipe->next_id++ & 0x7FFFFFFFU;
+	hdr.func = func;
+	hdr.flags = 0;
+	hdr.len = len;
+	hdr.status = 0;
+	hdr.stamp = stamp;
+
+	call = &pipe->calls[pipe->ncalls];
+	call->id = hdr.id;
+	call->done = done;
+	call->priv = priv;
+
+	ret = rpc_pipe_send_record(pipe, &hdr, data);
+	if (ret)
+		return ret;
+	pipe->ncalls++;
+
+	return (int)hdr.id;
+}
+
+/**
+ * rpc_pipe_reply - send the response of a request
+ *
+ * @pipe: pipe
+ * @req: request header, as passed to the handler
+ * @status: return status
+ * @data: response payload
+ * @len: response payload length
+ *
+ * The request may be answered from its handler or any time later.
+ *
+ * Return: 0 on success, or a send error
+ */
+int rpc_pipe_reply(struct rpc_pipe *pipe, const struct rpc_pipe_hdr *req,
+		   uint32_t status, const void *data, uint32_t len)
+{
+	struct rpc_pipe_hdr hdr;
+
+	hdr.id = req->id;
+	hdr.func = req->func;
+	hdr.flags = RPC_PIPE_F_RESP;
+	hdr.len = len;
+	hdr.status = status;
+	hdr.stamp = req->stamp;
+
+	return rpc_pipe_send_record(pipe, &hdr, data);
+}
+
+/**
+ * rpc_pipe_flush - send the pending batch
+ *
+ * @pipe: pipe
+ *
+ * Return: 0 on success, or a send error
+ */
+int rpc_pipe_flush(struct rpc_pipe *pipe)
+{
+	struct rpc_pipe_hdr *hdr = (struct rpc_pipe_hdr *)pipe->batch_buf;
+	int ret;
+
+	if (!pipe->batch_len)
+		return 0;
+
+	hdr->id = 0;
+	hdr->func = RPC_PIPE_FUNC_BATCH;
+	hdr->flags = 0;
+	hdr->len = pipe->batch_len;
+	hdr->status = 0;
+	hdr->stamp = 0;
+
+	ret = rpmsg_send(pipe->ept, pipe->batch_buf,
+			 sizeof(*hdr) + pipe->batch_len);
+	pipe->batch_len = 0;
+
+	return ret < 0 ? ret : 0;
+}
+
+static void rpc_pipe_dispatch(struct rpc_pipe *pipe,
+			      const struct rpc_pipe_hdr *hdr, void *data)
+{
+	struct rpc_pipe_call call;
+	unsigned int i;
+
+	if (hdr->flags & RPC_PIPE_F_RESP) {
+		for (i = 0; i < pipe->ncalls; i++) {
+			if (pipe->calls[i].id == hdr->id)
+				break;
+		}
+		if (i == pipe->ncalls)
+			return;
+
+		/* Responses arrive in any order, fill the hole with the last */
+		call = pipe->calls[i];
+		pipe->calls[i] = pipe->calls[--pipe->ncalls];
+		if (call.done)
+			call.done(pipe, hdr, data, call.priv);
+		return;
+	}
+
+	for (i = 0; i < pipe->nfuncs; i++) {
+		if (pipe->funcs[i].func == hdr->func) {
+			(void)pipe->funcs[i].handler(pipe, hdr, data,
+						     pipe->funcs[i].priv);
+			return;
+		}
+	}
+
+	(void)rpc_pipe_reply(pipe, hdr, (uint32_t)RPMSG_ERR_PARAM, NULL, 0);
+}
+
+/**
+ * rpc_pipe_receive - process a message received on the endpoint
+ *
+ * @pipe: pipe
+ * @data: message
+ * @len: message length
+ *
+ * Call from the endpoint callback. Replies sent from the handlers of a
+ * received batch go out together when batching is enabled.
+ *
+ * Return: 0 on success, RPMSG_ERR_PARAM for a malformed message
+ */
+int rpc_pipe_receive(struct rpc_pipe *pipe, void *data, size_t len)
+{
+	struct rpc_pipe_hdr *hdr = data;
+	uint8_t *rec;
+	uint8_t *end;
+
+	if (len < sizeof(*hdr) || hdr->len > len - sizeof(*hdr))
+		return RPMSG_ERR_PARAM;
+
+	if (hdr->func != RPC_PIPE_FUNC_BATCH) {
+		rpc_pipe_dispatch(pipe, hdr, hdr + 1);
+	} else {
+		rec = (uint8_t *)(hdr + 1);
+		end = rec + hdr->len;
+		while ((size_t)(end - rec) >= sizeof(*hdr)) {
+			hdr = (struct rpc_pipe_hdr *)rec;
+			if (hdr->len > (size_t)(end - rec) - sizeof(*hdr))
+				return RPMSG_ERR_PARAM;
+			rpc_pipe_dispatch(pipe, hdr, hdr + 1);
+			rec += RPC_PIPE_ALIGN(sizeof(*hdr) + hdr->len);
+		}
+	}
+
+	return rpc_pipe_flush(pipe);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Pipelined RPC over a single rpmsg endpoint.
+ *
+ * Every call carries a request ID that the response echoes, so a caller can
+ * keep up to RPC_PIPE_MAX_CALLS calls outstanding and the callee may
+ * complete them in any order. With batching enabled, records are packed
+ * into one rpmsg buffer and sent with a single kick when the buffer fills
+ * or rpc_pipe_flush() is called.
+ *
+ * Wire format, little endian:
+ *	struct rpc_pipe_hdr, followed by len bytes of payload
+ * A batch is a struct rpc_pipe_hdr with func RPC_PIPE_FUNC_BATCH whose
+ * payload is a sequence of such records, each padded to 4 bytes.
+ */
+
+#ifndef RPC_PIPE_H
+#define RPC_PIPE_H
+
+#include <stdint.h>
+#include <openamp/open_amp.h>
+
+#define RPC_PIPE_MAX_CALLS	32	/* Outstanding calls per pipe */
+#define RPC_PIPE_MAX_FUNCS	8	/* Registered functions per pipe */
+#define RPC_PIPE_BATCH_SIZE	496	/* Fits a 512 byte rpmsg buffer */
+
+#define RPC_PIPE_FUNC_BATCH	0xFFFF	/* Container of several records */
+
+#define RPC_PIPE_F_RESP		0x1	/* Record is a response */
+
+METAL_PACKED_BEGIN
+struct rpc_pipe_hdr {
+	uint32_t id;		/* Request ID, echoed in the response */
+	uint16_t func;		/* Function ID */
+	uint16_t flags;		/* RPC_PIPE_F_* */
+	uint32_t len;		/* Payload length in bytes */
+	uint32_t status;	/* Return status, responses only */
+	uint64_t stamp;		/* Caller time stamp, echoed in the response */
+} METAL_PACKED_END;
+
+struct rpc_pipe;
+
+/*
+ * Called for a request. Return 0 after calling rpc_pipe_reply() from the
+ * handler, or later for out of order completion.
+ */
+typedef int (*rpc_pipe_handler)(struct rpc_pipe *pipe,
+				const struct rpc_pipe_hdr *req,
+				void *data, void *priv);
+
+/* Called when the response of an outstanding call arrives. */
+typedef void (*rpc_pipe_done)(struct rpc_pipe *pipe,
+			      const struct rpc_pipe_hdr *resp,
+			      void *data, void *priv);
+
+struct rpc_pipe_call {
+	uint32_t id;
+	rpc_pipe_done done;
+	void *priv;
+};
+
+struct rpc_pipe_func {
+	uint16_t func;
+	rpc_pipe_handler handler;
+	void *priv;
+};
+
+struct rpc_pipe {
+	struct rpmsg_endpoint *ept;
+	uint32_t next_id;
+	unsigned int ncalls;
+	struct rpc_pipe_call calls[RPC_PIPE_MAX_CALLS];
+	unsigned int nfuncs;
+	struct rpc_pipe_func funcs[RPC_PIPE_MAX_FUNCS];
+	int batch;
+	uint32_t batch_len;
+	uint8_t batch_buf[RPC_PIPE_BATCH_SIZE];
+};
+
+void rpc_pipe_init(struct rpc_pipe *pipe, struct rpmsg_endpoint *ept,
+		   int batch);
+int rpc_pipe_register(struct rpc_pipe *pipe, uint16_t func,
+		      rpc_pipe_handler handler, void *priv);
+int rpc_pipe_call(struct rpc_pipe *pipe, uint16_t func, uint64_t stamp,
+		  const void *data, uint32_t len, rpc_pipe_done done,
+		  void *priv);
+int rpc_pipe_reply(struct rpc_pipe *pipe, const struct rpc_pipe_hdr *req,
+		   uint32_t status, const void *data, uint32_t len);
+int rpc_pipe_flush(struct rpc_pipe *pipe);
+int rpc_pipe_receive(struct rpc_pipe *pipe, void *data, size_t len);
+
+#endif /* RPC_PIPE_H */
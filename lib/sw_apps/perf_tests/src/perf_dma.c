@@ -0,0 +1,192 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+#include "xparameters.h"
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xil_cache.h"
+
+#include "perf_tests.h"
+
+/*
+ * perf_dma.c: DMA submit and small transfer benchmarks.
+ *
+ * axidma_bd_to_hw is the cost of XAxiDma_BdRingToHw() for one BD, that is
+ * the BD pre-processing, the cache flush of the BD and the ring update. The
+ * TX channel is not started, so that no stream sink is needed, and the
+ * tail descriptor register write is not part of the number.
+ * zdma_small_copy is a polled ZDMA transfer of PERF_ZDMA_SIZE bytes, from
+ * XZDma_Start() up to the done status.
+ */
+
+#define PERF_DMA_BUF_SIZE	64U
+
+static u8 perf_dma_src[PERF_DMA_BUF_SIZE] __attribute__ ((aligned(64)));
+static u8 perf_dma_dst[PERF_DMA_BUF_SIZE] __attribute__ ((aligned(64)));
+
+#if defined(XPAR_AXIDMA_0_DEVICE_ID) || defined(XPAR_XAXIDMA_0_BASEADDR)
+#include "xaxidma.h"
+
+#define PERF_AXIDMA_BDS		64U
+
+static XAxiDma perf_axidma_inst;
+static u8 perf_axidma_bds[PERF_AXIDMA_BDS * XAXIDMA_BD_MINIMUM_ALIGNMENT]
+    __attribute__ ((aligned(XAXIDMA_BD_MINIMUM_ALIGNMENT)));
+
+static XStatus perf_axidma_ring(XAxiDma_BdRing *ring)
+{
+    XAxiDma_Bd bd_template;
+
+    if (XAxiDma_BdRingCreate(ring, (UINTPTR)perf_axidma_bds,
+                             (UINTPTR)perf_axidma_bds,
+                             XAXIDMA_BD_MINIMUM_ALIGNMENT,
+                             (int)PERF_AXIDMA_BDS) != XST_SUCCESS) {
+        return XST_FAILURE;
+    }
+    XAxiDma_BdClear(&bd_template);
+    if (XAxiDma_BdRingClone(ring, &bd_template) != XST_SUCCESS) {
+        return XST_FAILURE;
+    }
+
+    return XST_SUCCESS;
+}
+
+void perf_axidma(void)
+{
+    XAxiDma_Config *config;
+    XAxiDma_BdRing *ring;
+    XAxiDma_Bd *bd;
+    struct perf_stat_s stat;
+    u64 start;
+    u64 end;
+    u32 i;
+
+#ifndef SDT
+    config = XAxiDma_LookupConfig(XPAR_AXIDMA_0_DEVICE_ID);
+#else
+    config = XAxiDma_LookupConfig(XPAR_XAXIDMA_0_BASEADDR);
+#endif
+    if ((config == NULL) ||
+        (XAxiDma_CfgInitialize(&perf_axidma_inst, config) != XST_SUCCESS)) {
+        perf_skip("axidma_bd_to_hw", "no AXI DMA");
+        return;
+    }
+    if (!XAxiDma_HasSg(&perf_axidma_inst) || (config->HasMm2S == 0)) {
+        perf_skip("axidma_bd_to_hw", "AXI DMA has no SG TX channel");
+        return;
+    }
+
+    ring = XAxiDma_GetTxRing(&perf_axidma_inst);
+    XAxiDma_BdRingIntDisable(ring, XAXIDMA_IRQ_ALL_MASK);
+
+    perf_stat_init(&stat);
+    for (i = 0U; i < PERF_ITERATIONS; i++) {
+        /* The BDs never complete, start over once all are committed */
+        if (((i % PERF_AXIDMA_BDS) == 0U) &&
+            (perf_axidma_ring(ring) != XST_SUCCESS)) {
+            break;
+        }
+        if (XAxiDma_BdRingAlloc(ring, 1, &bd) != XST_SUCCESS) {
+            break;
+        }
+        (void)XAxiDma_BdSetBufAddr(bd, (UINTPTR)perf_dma_src);
+        (void)XAxiDma_BdSetLength(bd, PERF_DMA_BUF_SIZE, ring->MaxTransferLen);
+        XAxiDma_BdSetCtrl(bd, XAXIDMA_BD_CTRL_TXSOF_MASK |
+                          XAXIDMA_BD_CTRL_TXEOF_MASK);
+        XAxiDma_BdSetId(bd, (UINTPTR)perf_dma_src);
+
+        start = perf_now();
+        if (XAxiDma_BdRingToHw(ring, 1, bd) != XST_SUCCESS) {
+            break;
+        }
+        end = perf_now();
+        perf_stat_add(&stat, start, end);
+    }
+
+    perf_report("axidma_bd_to_hw", PERF_DMA_BUF_SIZE, &stat);
+}
+#else
+void perf_axidma(void)
+{
+    perf_skip("axidma_bd_to_hw", "no AXI DMA");
+}
+#endif
+
+#ifdef XPAR_XZDMA_0_BASEADDR
+#include "xzdma.h"
+
+static XZDma perf_zdma_inst;
+
+void perf_zdma(void)
+{
+    XZDma_Config *config;
+    XZDma_Transfer data;
+    struct perf_stat_s stat;
+    u64 start;
+    u64 end;
+    u32 status = 0U;
+    u32 poll;
+    u32 i;
+
+#ifndef SDT
+    config = XZDma_LookupConfig(XPAR_XZDMA_0_DEVICE_ID);
+#else
+    config = XZDma_LookupConfig(XPAR_XZDMA_0_BASEADDR);
+#endif
+    if ((config == NULL) ||
+        (XZDma_CfgInitialize(&perf_zdma_inst, config,
+                             config->BaseAddress) != XST_SUCCESS) ||
+        (XZDma_SetMode(&perf_zdma_inst, FALSE, XZDMA_NORMAL_MODE) !=
+         XST_SUCCESS)) {
+        perf_skip("zdma_small_copy", "no ZDMA");
+        return;
+    }
+    XZDma_DisableIntr(&perf_zdma_inst, XZDMA_IXR_ALL_INTR_MASK);
+
+    Xil_DCacheFlushRange((INTPTR)perf_dma_src, PERF_DMA_BUF_SIZE);
+    Xil_DCacheFlushRange((INTPTR)perf_dma_dst, PERF_DMA_BUF_SIZE);
+
+    data.SrcAddr = (UINTPTR)perf_dma_src;
+    data.DstAddr = (UINTPTR)perf_dma_dst;
+    data.Size = PERF_DMA_BUF_SIZE;
+    data.SrcCoherent = 1U;
+    data.DstCoherent = 1U;
+    data.Pause = 0U;
+
+    perf_stat_init(&stat);
+    for (i = 0U; i < PERF_ITERATIONS; i++) {
+        XZDma_IntrClear(&perf_zdma_inst, XZDMA_IXR_ALL_INTR_MASK);
+        start = perf_now();
+        if (XZDma_Start(&perf_zdma_inst, &data, 1U) != XST_SUCCESS) {
+            break;
+        }
+        for (poll = 0U; poll < PERF_POLL_TIMEOUT; poll++) {
+            status = XZDma_IntrGetStatus(&perf_zdma_inst);
+            if ((status & (XZDMA_IXR_DMA_DONE_MASK |
+                           XZDMA_IXR_AXI_WR_DATA_MASK |
+                           XZDMA_IXR_AXI_RD_DATA_MASK)) != 0U) {
+                break;
+            }
+        }
+        end = perf_now();
+
+        /* Polled, the interrupt handler does not mark the channel idle */
+        XZDma_IntrClear(&perf_zdma_inst, status);
+        perf_zdma_inst.ChannelState = XZDMA_IDLE;
+
+        if ((status & XZDMA_IXR_DMA_DONE_MASK) == 0U) {
+            break;
+        }
+        perf_stat_add(&stat, start, end);
+    }
+
+    perf_report("zdma_small_copy", PERF_DMA_BUF_SIZE, &stat);
+}
+#else
+void perf_zdma(void)
+{
+    perf_skip("zdma_small_copy", "no ZDMA");
+}
+#endif
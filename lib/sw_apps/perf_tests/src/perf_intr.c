@@ -0,0 +1,204 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+#include "xparameters.h"
+#include "xil_types.h"
+#include "xstatus.h"
+
+#include "perf_tests.h"
+
+/*
+ * perf_intr.c: Interrupt entry and IPI round trip benchmarks.
+ *
+ * gic_sgi_entry is the time from XScuGic_SoftwareIntr() to the first line of
+ * the handler, gic_sgi_return the time until the interrupted code runs again.
+ * ipi_roundtrip sends an IPI message to the own channel, answers it and
+ * reads the response, with the driver calls and polling of both sides.
+ */
+
+#if defined(XPAR_SCUGIC_SINGLE_DEVICE_ID) && !defined(SDT)
+#define PERF_GIC_ID	XPAR_SCUGIC_SINGLE_DEVICE_ID
+#elif defined(XPAR_XSCUGIC_0_BASEADDR) && defined(SDT)
+#define PERF_GIC_ID	XPAR_XSCUGIC_0_BASEADDR
+#endif
+
+#ifdef PERF_GIC_ID
+#include "xil_exception.h"
+#include "xplatform_info.h"
+#include "xscugic.h"
+
+/* Software generated interrupt used by the benchmark */
+#define PERF_SGI_ID	0x0EU
+
+static XScuGic perf_gic_inst;
+static volatile u64 perf_gic_stamp;
+static volatile u32 perf_gic_done;
+
+static void perf_gic_handler(void *ref)
+{
+    perf_gic_stamp = perf_now();
+    perf_gic_done = 1U;
+    (void)ref;
+}
+
+static u32 perf_gic_target(void)
+{
+    u32 core_id = XGetCoreId();
+
+#if defined (VERSAL_NET)
+#if defined (ARMR52)
+    core_id = (1U << core_id);
+#endif
+    return ((u32)XGetClusterId() << XSCUGIC_CLUSTERID_SHIFT) | core_id;
+#else
+    return XSCUGIC_SPI_CPU0_MASK << core_id;
+#endif
+}
+
+void perf_gic(void)
+{
+    XScuGic_Config *config;
+    struct perf_stat_s entry;
+    struct perf_stat_s ret;
+    u64 start;
+    u64 end;
+    u32 target;
+    u32 poll;
+    u32 i;
+
+    config = XScuGic_LookupConfig(PERF_GIC_ID);
+    if ((config == NULL) ||
+        (XScuGic_CfgInitialize(&perf_gic_inst, config,
+                               config->CpuBaseAddress) != XST_SUCCESS)) {
+        perf_skip("gic_sgi_entry", "no interrupt controller");
+        return;
+    }
+
+    Xil_ExceptionInit();
+    Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+                                 (Xil_ExceptionHandler)XScuGic_InterruptHandler,
+                                 &perf_gic_inst);
+    (void)XScuGic_Connect(&perf_gic_inst, PERF_SGI_ID,
+                          (Xil_ExceptionHandler)perf_gic_handler, NULL);
+    XScuGic_Enable(&perf_gic_inst, PERF_SGI_ID);
+    Xil_ExceptionEnable();
+
+    target = perf_gic_target();
+    perf_stat_init(&entry);
+    perf_stat_init(&ret);
+    for (i = 0U; i < PERF_ITERATIONS; i++) {
+        perf_gic_done = 0U;
+        start = perf_now();
+        if (XScuGic_SoftwareIntr(&perf_gic_inst, PERF_SGI_ID, target) !=
+            XST_SUCCESS) {
+            break;
+        }
+        for (poll = 0U; (perf_gic_done == 0U) && (poll < PERF_POLL_TIMEOUT);
+             poll++) {
+        }
+        end = perf_now();
+        if (perf_gic_done == 0U) {
+            break;
+        }
+        perf_stat_add(&entry, start, perf_gic_stamp);
+        perf_stat_add(&ret, start, end);
+    }
+
+    Xil_ExceptionDisable();
+    XScuGic_Disable(&perf_gic_inst, PERF_SGI_ID);
+    XScuGic_Disconnect(&perf_gic_inst, PERF_SGI_ID);
+
+    perf_report("gic_sgi_entry", 0U, &entry);
+    perf_report("gic_sgi_return", 0U, &ret);
+}
+#else
+void perf_gic(void)
+{
+    perf_skip("gic_sgi_entry", "no GIC");
+}
+#endif
+
+#ifdef XPAR_XIPIPSU_0_BASEADDR
+#include "xipipsu.h"
+
+/* Message length in words, within the buffer of every IPI version */
+#define PERF_IPI_MSG_LEN	4U
+
+static XIpiPsu perf_ipi_inst;
+
+void perf_ipi(void)
+{
+    XIpiPsu_Config *config;
+    struct perf_stat_s stat;
+    u32 msg[PERF_IPI_MSG_LEN] = { 0U };
+    u32 rx[PERF_IPI_MSG_LEN];
+    u64 start;
+    u64 end;
+    u32 mask;
+    u32 poll;
+    u32 i;
+
+#ifndef SDT
+    config = XIpiPsu_LookupConfig(XPAR_XIPIPSU_0_DEVICE_ID);
+#else
+    config = XIpiPsu_LookupConfig(XPAR_XIPIPSU_0_BASEADDR);
+#endif
+    if ((config == NULL) ||
+        (XIpiPsu_CfgInitialize(&perf_ipi_inst, config,
+                               config->BaseAddress) != XST_SUCCESS)) {
+        perf_skip("ipi_roundtrip", "no IPI channel");
+        return;
+    }
+
+    /* Both sides are polled, keep the channel interrupt off */
+    XIpiPsu_InterruptDisable(&perf_ipi_inst, XIPIPSU_ALL_MASK);
+    XIpiPsu_ClearInterruptStatus(&perf_ipi_inst, XIPIPSU_ALL_MASK);
+    mask = config->BitMask;
+
+    perf_stat_init(&stat);
+    for (i = 0U; i < PERF_ITERATIONS; i++) {
+        msg[0] = i;
+        start = perf_now();
+
+        (void)XIpiPsu_WriteMessage(&perf_ipi_inst, mask, msg,
+                                   PERF_IPI_MSG_LEN, XIPIPSU_BUF_TYPE_MSG);
+        (void)XIpiPsu_TriggerIpi(&perf_ipi_inst, mask);
+
+        /* Receiver: wait, read the message, answer and ack */
+        for (poll = 0U; ((XIpiPsu_GetInterruptStatus(&perf_ipi_inst) &
+                          mask) == 0U) && (poll < PERF_POLL_TIMEOUT); poll++) {
+        }
+        if (poll == PERF_POLL_TIMEOUT) {
+            break;
+        }
+        (void)XIpiPsu_ReadMessage(&perf_ipi_inst, mask, rx,
+                                  PERF_IPI_MSG_LEN, XIPIPSU_BUF_TYPE_MSG);
+        (void)XIpiPsu_WriteMessage(&perf_ipi_inst, mask, rx,
+                                   PERF_IPI_MSG_LEN, XIPIPSU_BUF_TYPE_RESP);
+        XIpiPsu_ClearInterruptStatus(&perf_ipi_inst, mask);
+
+        /* Sender: wait for the ack and read the response */
+        if (XIpiPsu_PollForAck(&perf_ipi_inst, mask, PERF_POLL_TIMEOUT) !=
+            XST_SUCCESS) {
+            break;
+        }
+        (void)XIpiPsu_ReadMessage(&perf_ipi_inst, mask, rx,
+                                  PERF_IPI_MSG_LEN, XIPIPSU_BUF_TYPE_RESP);
+
+        end = perf_now();
+        if (rx[0] != i) {
+            break;
+        }
+        perf_stat_add(&stat, start, end);
+    }
+
+    perf_report("ipi_roundtrip", PERF_IPI_MSG_LEN * 4U, &stat);
+}
+#else
+void perf_ipi(void)
+{
+    perf_skip("ipi_roundtrip", "no IPI");
+}
+#endif
@@ -0,0 +1,178 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+#include "xparameters.h"
+#include "xil_types.h"
+#include "xil_cache.h"
+#include "xil_mem.h"
+#include "xil_printf.h"
+#include "xiltimer.h"
+
+#include "platform.h"
+#include "perf_tests.h"
+
+/*
+ * perf_tests.c: Benchmark harness, cache maintenance and memcpy benchmarks.
+ *
+ * All times are in ns, converted from the xiltimer ticks. The cost of reading
+ * the timer is measured first and taken off every sample.
+ */
+
+#define PERF_BUF_SIZE	(64U * 1024U)
+
+static u8 perf_buf[PERF_BUF_SIZE] __attribute__ ((aligned(64)));
+static u64 perf_overhead;
+
+u64 perf_now(void)
+{
+    XTime now;
+
+    XTime_GetTime(&now);
+    return (u64)now;
+}
+
+static u64 perf_ns(u64 ticks)
+{
+    return (ticks * 1000000000ULL) / XTime_GetTimeFreq();
+}
+
+void perf_stat_init(struct perf_stat_s *stat)
+{
+    stat->min = ~(u64)0;
+    stat->max = 0U;
+    stat->sum = 0U;
+    stat->count = 0U;
+}
+
+void perf_stat_add(struct perf_stat_s *stat, u64 start, u64 end)
+{
+    u64 ticks = end - start;
+
+    ticks = (ticks > perf_overhead) ? (ticks - perf_overhead) : 0U;
+    if (ticks < stat->min) {
+        stat->min = ticks;
+    }
+    if (ticks > stat->max) {
+        stat->max = ticks;
+    }
+    stat->sum += ticks;
+    stat->count++;
+}
+
+void perf_report(const char8 *name, u32 size, const struct perf_stat_s *stat)
+{
+    if (stat->count == 0U) {
+        perf_skip(name, "no sample");
+        return;
+    }
+
+    xil_printf("%s,%u,%u,%lu,%lu,%lu\n\r", name, size, stat->count,
+               (unsigned long)perf_ns(stat->min),
+               (unsigned long)perf_ns(stat->sum / stat->count),
+               (unsigned long)perf_ns(stat->max));
+}
+
+void perf_skip(const char8 *name, const char8 *reason)
+{
+    xil_printf("# skip %s: %s\n\r", name, reason);
+}
+
+static void perf_timer_overhead(void)
+{
+    u64 start;
+    u64 end;
+    u32 i;
+
+    perf_overhead = ~(u64)0;
+    for (i = 0U; i < PERF_ITERATIONS; i++) {
+        start = perf_now();
+        end = perf_now();
+        if ((end - start) < perf_overhead) {
+            perf_overhead = end - start;
+        }
+    }
+}
+
+static void perf_dirty(u32 size)
+{
+    u32 i;
+
+    for (i = 0U; i < size; i += 32U) {
+        perf_buf[i]++;
+    }
+}
+
+static void perf_cache(void)
+{
+    static const u32 sizes[] = { 64U, 4096U, PERF_BUF_SIZE };
+    struct perf_stat_s stat;
+    u64 start;
+    u32 s;
+    u32 i;
+
+    for (s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++) {
+        perf_stat_init(&stat);
+        for (i = 0U; i < PERF_ITERATIONS; i++) {
+            /* Flush dirty lines, a clean range only costs the walk */
+            perf_dirty(sizes[s]);
+            start = perf_now();
+            Xil_DCacheFlushRange((INTPTR)perf_buf, sizes[s]);
+            perf_stat_add(&stat, start, perf_now());
+        }
+        perf_report("dcache_flush_range", sizes[s], &stat);
+    }
+}
+
+static void perf_memcpy(void)
+{
+    static const u32 sizes[] = { 64U, 4096U, PERF_BUF_SIZE / 2U };
+    struct perf_stat_s stat;
+    u64 start;
+    u32 s;
+    u32 i;
+
+    for (s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++) {
+        perf_stat_init(&stat);
+        for (i = 0U; i < PERF_ITERATIONS; i++) {
+            start = perf_now();
+            Xil_MemCpy(&perf_buf[PERF_BUF_SIZE / 2U], perf_buf, sizes[s]);
+            perf_stat_add(&stat, start, perf_now());
+        }
+        perf_report("xil_memcpy", sizes[s], &stat);
+
+        perf_stat_init(&stat);
+        for (i = 0U; i < PERF_ITERATIONS; i++) {
+            start = perf_now();
+            Xil_MemCpy64(&perf_buf[PERF_BUF_SIZE / 2U], perf_buf, sizes[s]);
+            perf_stat_add(&stat, start, perf_now());
+        }
+        perf_report("xil_memcpy64", sizes[s], &stat);
+    }
+}
+
+int main()
+{
+    init_platform();
+
+    perf_timer_overhead();
+
+    xil_printf("# perf_tests format %u timer_hz %u\n\r", PERF_FORMAT_VERSION,
+               XTime_GetTimeFreq());
+    xil_printf("# timer_overhead_ns %lu\n\r",
+               (unsigned long)perf_ns(perf_overhead));
+    print("# name,size,iterations,min_ns,avg_ns,max_ns\n\r");
+
+    perf_cache();
+    perf_memcpy();
+    perf_gic();
+    perf_ipi();
+    perf_axidma();
+    perf_zdma();
+
+    print("# perf_tests done\n\r");
+
+    cleanup_platform();
+    return 0;
+}
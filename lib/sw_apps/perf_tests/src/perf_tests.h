@@ -0,0 +1,49 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+#ifndef __PERF_TESTS_H_
+#define __PERF_TESTS_H_
+
+#include "xil_types.h"
+
+/*
+ * perf_tests: Microbenchmarks of the BSP and driver hot paths.
+ *
+ * Every benchmark runs PERF_ITERATIONS times and prints one CSV line:
+ *   name,size,iterations,min_ns,avg_ns,max_ns
+ * Lines starting with '#' are comments. A benchmark whose hardware is not in
+ * the design prints "# skip <name>: <reason>" instead. PERF_FORMAT_VERSION
+ * changes whenever the meaning of a column or a benchmark changes, so that
+ * results of different releases can be compared.
+ */
+
+#define PERF_FORMAT_VERSION	1U
+
+#ifndef PERF_ITERATIONS
+#define PERF_ITERATIONS		1000U
+#endif
+
+/* Polls before a benchmark gives up waiting for the hardware */
+#define PERF_POLL_TIMEOUT	1000000U
+
+struct perf_stat_s {
+    u64 min;
+    u64 max;
+    u64 sum;
+    u32 count;
+};
+
+u64 perf_now(void);
+void perf_stat_init(struct perf_stat_s *stat);
+void perf_stat_add(struct perf_stat_s *stat, u64 start, u64 end);
+void perf_report(const char8 *name, u32 size, const struct perf_stat_s *stat);
+void perf_skip(const char8 *name, const char8 *reason);
+
+void perf_gic(void);
+void perf_ipi(void);
+void perf_axidma(void);
+void perf_zdma(void);
+
+#endif
@@ -0,0 +1,97 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+#include <string.h>
+#include "portab.h"
+#include "errors.h"
+#include "binimg.h"
+
+#define CRC32_POLY  0xEDB88320
+
+static uint32 crc_table[256];
+
+static uint32 get_le32 (uint8 *buf)
+{
+	return (uint32)buf[0] | ((uint32)buf[1] << 8) |
+		((uint32)buf[2] << 16) | ((uint32)buf[3] << 24);
+}
+
+static void crc32_init (void)
+{
+	uint32 crc;
+	uint32 i;
+	uint32 j;
+
+	if (crc_table[1] != 0) {
+		return;
+	}
+
+	for (i = 0; i < 256; i++) {
+		crc = i;
+		for (j = 0; j < 8; j++) {
+			crc = (crc & 1) ? ((crc >> 1) ^ CRC32_POLY) : (crc >> 1);
+		}
+		crc_table[i] = crc;
+	}
+}
+
+static uint32 crc32 (uint8 *buf, uint32 len)
+{
+	uint32 crc = 0xFFFFFFFF;
+
+	while (len--) {
+		crc = crc_table[(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
+	}
+
+	return crc ^ 0xFFFFFFFF;
+}
+
+uint8 is_binimg (uint8 *img)
+{
+	return (get_le32 (img) == BINIMG_MAGIC);
+}
+
+uint8 load_binimg (uint8 *img, uint32 *entry)
+{
+	uint8 *seg;
+	uint8 *data;
+	uint8 *addr;
+	uint32 nsegs;
+	uint32 len;
+	uint32 i;
+
+	crc32_init ();
+
+	nsegs = get_le32 (img + 12);
+	if ((get_le32 (img + 4) != BINIMG_VERSION) ||
+	    (nsegs > BINIMG_MAX_SEGMENTS)) {
+		return BIN_HEADER_ERROR;
+	}
+
+	/* The header CRC covers the segment table too */
+	len = BINIMG_HDR_BYTES + (nsegs * BINIMG_SEG_BYTES);
+	if (crc32 (img, len) != get_le32 (img + len)) {
+		return BIN_HEADER_ERROR;
+	}
+
+	seg = img + BINIMG_HDR_BYTES;
+	data = img + len + 4;
+	for (i = 0; i < nsegs; i++, seg += BINIMG_SEG_BYTES) {
+		addr = (uint8 *)get_le32 (seg);
+		len = get_le32 (seg + 4);
+
+		/* One copy per segment, straight to its load address */
+		memcpy ((void *)addr, (void *)data, len);
+		if (crc32 (addr, len) != get_le32 (seg + 8)) {
+			return BIN_CKSUM_ERROR;
+		}
+
+		data += (len + 3) & ~3;
+	}
+
+	*entry = get_le32 (img + 8);
+
+	return 0;
+}
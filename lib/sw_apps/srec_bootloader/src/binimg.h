@@ -0,0 +1,34 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/* Note: This file depends on the following files having been included prior to self being included.
+   1. portab.h
+*/
+
+#ifndef BL_BINIMG_H
+#define BL_BINIMG_H
+
+/*
+ * Binary image container, loaded with plain memory copies instead of
+ * parsing SREC records. All words are little endian:
+ *
+ *   header:   magic "BIMG", version, entry address, segment count
+ *   segments: load address, length in bytes, CRC32 of the data
+ *   crc:      CRC32 of the header and the segment table
+ *   data:     the data of each segment, padded to a multiple of 4 bytes
+ *
+ * The CRC32 is the one of zlib and Ethernet (reflected 0xEDB88320).
+ */
+
+#define BINIMG_MAGIC          0x474D4942  /* "BIMG" */
+#define BINIMG_VERSION        1
+#define BINIMG_HDR_BYTES      16
+#define BINIMG_SEG_BYTES      12
+#define BINIMG_MAX_SEGMENTS   64
+
+uint8   is_binimg (uint8 *img);
+uint8   load_binimg (uint8 *img, uint32 *entry);
+
+#endif /* BL_BINIMG_H */
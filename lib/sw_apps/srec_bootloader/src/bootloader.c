@@ -36,6 +36,8 @@
  *      This simple bootloader is provided with Xilinx EDK for you to easily re-use in your
  *      own software project. It is capable of booting an SREC format image file
  *      (Mototorola S-record format), given the location of the image in memory.
+ *      An image in the binary format of binimg.h is detected by its magic number
+ *      and copied segment by segment, which is much faster than SREC parsing.
  *      In particular, this bootloader is designed for images stored in non-volatile flash
  *      memory that is addressable from the processor.
  *
@@ -58,6 +60,7 @@
 #include "portab.h"
 #include "errors.h"
 #include "srec.h"
+#include "binimg.h"
 
 /* Defines */
 #define CR       13
@@ -68,6 +71,7 @@
 /* Declarations */
 static void display_progress (uint32 lines);
 static uint8 load_exec ();
+static uint8 load_bin_exec ();
 static uint8 flash_get_srec_line (uint8 *buf);
 extern void init_stdout();
 
@@ -96,7 +100,9 @@ static int8 *errors[] = {
 	"Error while copying executable image into RAM",
 	"Error while reading an SREC line from flash",
 	"SREC line is corrupted",
-	"SREC has invalid checksum."
+	"SREC has invalid checksum.",
+	"Binary image header is corrupted",
+	"Binary image segment has invalid checksum."
 };
 #endif
 
@@ -123,12 +129,16 @@ int main()
 #endif
 
 	flbuf = (uint8 *)FLASH_IMAGE_BASEADDR;
-	ret = load_exec ();
+	if (is_binimg (flbuf)) {
+		ret = load_bin_exec ();
+	} else {
+		ret = load_exec ();
+	}
 
 	/* If we reach here, we are in error */
 
 #ifdef VERBOSE
-	if (ret > LD_SREC_LINE_ERROR) {
+	if ((ret > LD_SREC_LINE_ERROR) && (ret <= SREC_CKSUM_ERROR)) {
 		print ("ERROR in SREC line: ");
 		putnum (srec_line);
 		print (errors[ret]);
@@ -204,6 +214,32 @@ static uint8 load_exec ()
 	return 0;
 }
 
+static uint8 load_bin_exec ()
+{
+	uint8 ret;
+	uint32 entry;
+	void (*laddr)();
+
+#ifdef VERBOSE
+	print ("Loading binary image\r\n");
+#endif
+
+	if ((ret = load_binimg (flbuf, &entry)) != 0) {
+		return ret;
+	}
+	laddr = (void (*)())entry;
+
+#ifdef VERBOSE
+	print ("Executing program starting at address: ");
+	putnum ((uint32)laddr);
+	print ("\r\n");
+#endif
+
+	(*laddr)();
+
+	/* We will be dead at this point */
+	return 0;
+}
 
 static uint8 flash_get_srec_line (uint8 *buf)
 {
@@ -37,5 +37,7 @@
 #define LD_SREC_LINE_ERROR  2
 #define SREC_PARSE_ERROR    3
 #define SREC_CKSUM_ERROR    4
+#define BIN_HEADER_ERROR    5
+#define BIN_CKSUM_ERROR     6
 
 #endif /* BL_ERRORS_H */
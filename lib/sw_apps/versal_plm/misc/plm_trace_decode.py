@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+# Copyright (C) 2023 Advanced Micro Devices, Inc.  All rights reserved.
+# SPDX-License-Identifier: MIT
+"""
+Decodes the PLM trace log buffer.
+
+The input is a binary dump of the trace buffer in little endian words, as
+retrieved with the XPLMI_LOGGING_CMD_RETRIEVE_TRACE_DATA event logging
+command (oldest data first). Each record is laid out as
+    word 0 - event ID in bits 15:0, record length in words in bits 30:16,
+             bit 31 set if the time stamp is in timer counts
+    word 1 - time stamp in ms, or timer counts high word
+    word 2 - time stamp fraction, or timer counts low word
+    word 3 onwards - payload
+"""
+
+import argparse
+import struct
+import sys
+
+RAW_TS_MASK = 0x80000000
+LEN_SHIFT = 16
+LEN_MASK = 0x7FFF
+ID_MASK = 0xFFFF
+HDR_WORDS = 3
+
+TRACE_LOG_LOAD_IMAGE = 0x1
+TRACE_LOG_PRTN_PROFILE = 0x2
+TRACE_LOG_TIMER_FREQ = 0x3
+
+EVENTS = {
+    TRACE_LOG_LOAD_IMAGE: ("LOAD_IMAGE", ["ImageId"]),
+    TRACE_LOG_PRTN_PROFILE: ("PRTN_PROFILE", [
+        "ImageId", "PrtnId", "SizeBytes", "TotalUs", "DeviceWaitUs",
+        "SecureUs", "CdoUs", "BytesPerMs"]),
+    TRACE_LOG_TIMER_FREQ: ("TIMER_FREQ", ["FreqHz"]),
+}
+
+# Longest record PLM writes, used to reject words that are not a header
+MAX_RECORD_WORDS = 32
+
+
+def read_words(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    data = data[:len(data) - (len(data) % 4)]
+    return list(struct.unpack("<%dI" % (len(data) // 4), data))
+
+
+def is_header(words, idx):
+    header = words[idx]
+    length = (header >> LEN_SHIFT) & LEN_MASK
+    if (header & ID_MASK) not in EVENTS:
+        return False
+    if length < HDR_WORDS or length > MAX_RECORD_WORDS:
+        return False
+    return idx + length <= len(words)
+
+
+def decode(words, iro_freq):
+    """Yields (time in ms or None, event name, fields) for each record."""
+    idx = 0
+    freq = iro_freq
+    while idx < len(words):
+        # A wrapped buffer starts in the middle of a record, skip to the
+        # next valid header
+        if not is_header(words, idx):
+            idx += 1
+            continue
+        header = words[idx]
+        length = (header >> LEN_SHIFT) & LEN_MASK
+        event_id = header & ID_MASK
+        payload = words[idx + HDR_WORDS:idx + length]
+        if header & RAW_TS_MASK:
+            counts = (words[idx + 1] << 32) | words[idx + 2]
+            if event_id == TRACE_LOG_TIMER_FREQ and payload:
+                freq = payload[0]
+            time_ms = (counts * 1000.0 / freq) if freq else None
+        else:
+            time_ms = words[idx + 1] + (words[idx + 2] / 1000.0)
+        name, fields = EVENTS[event_id]
+        values = dict(zip(fields, payload))
+        yield time_ms, name, values
+        idx += length
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="binary dump of the trace buffer")
+    parser.add_argument("--iro-freq", type=int, default=0,
+        help="PMC IRO frequency in Hz, used for raw time stamps when the "
+             "dump has no timer frequency record")
+    args = parser.parse_args()
+
+    for time_ms, name, values in decode(read_words(args.dump), args.iro_freq):
+        stamp = "%12.3f" % time_ms if time_ms is not None else "%12s" % "?"
+        fields = " ".join("%s=0x%X" % (k, v) if k in ("ImageId", "PrtnId")
+                          else "%s=%d" % (k, v) for k, v in values.items())
+        print("[%s ms] %-14s %s" % (stamp, name, fields))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
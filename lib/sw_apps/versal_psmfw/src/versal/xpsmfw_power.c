@@ -17,6 +17,8 @@
 * Ver	Who	Date		Changes
 * ---- ---- -------- ------------------------------
 * 1.00	rp	07/13/2018 	Initial release
+* 1.01	fl	10/14/2026	Run memory bank transitions from compiled sequences
+*			and power up pending banks of a bank group together
 *
 * </pre>
 *
@@ -1003,9 +1005,96 @@ done:
 	return Status;
 }
 
+static void XPsmFwSeqSet(struct XPsmFwSeqOp_t *Op, u32 Opcode, u32 Addr,
+			 u32 Mask, u32 Value)
+{
+	Op->Opcode = Opcode;
+	Op->Addr = Addr;
+	Op->Mask = Mask;
+	Op->Value = Value;
+}
+
+/**
+ * XPsmFwRunSeq() - Execute a compiled power transition sequence
+ *
+ * @Seq       Sequence terminated by XPSMFW_SEQ_END
+ *
+ * @return    XST_SUCCESS or error code of the first poll that times out
+ */
+static XStatus XPsmFwRunSeq(const struct XPsmFwSeqOp_t *Seq)
+{
+	XStatus Status = XST_SUCCESS;
+	const struct XPsmFwSeqOp_t *Op;
+
+	for (Op = Seq; (XPSMFW_SEQ_END != Op->Opcode) && (XST_SUCCESS == Status); Op++) {
+		switch (Op->Opcode) {
+		case XPSMFW_SEQ_RMW:
+			XPsmFw_RMW32(Op->Addr, Op->Mask, Op->Value);
+			break;
+		case XPSMFW_SEQ_POLL_MASK:
+			Status = XPsmFw_UtilPollForMask(Op->Addr, Op->Mask, Op->Value);
+			break;
+		case XPSMFW_SEQ_POLL_ZERO:
+			Status = XPsmFw_UtilPollForZero(Op->Addr, Op->Mask, Op->Value);
+			break;
+		case XPSMFW_SEQ_WAIT:
+			XPsmFw_UtilWait(Op->Value);
+			break;
+		default:
+			Status = XST_FAILURE;
+			break;
+		}
+	}
+
+	return Status;
+}
+
+/**
+ * XPsmFwMemSeqCompile() - Compile the power up and down sequences of a bank
+ *
+ * @Args      Memory bank power control structure
+ *
+ * The platform does not change at run time, so the power down sequence only
+ * polls the power status on silicon.
+ */
+static void XPsmFwMemSeqCompile(struct XPsmFwMemPwrCtrl_t *Args)
+{
+	struct XPsmFwSeqOp_t *Up = Args->PwrUpSeq;
+	struct XPsmFwSeqOp_t *Dwn = Args->PwrDwnSeq;
+
+	/* Enable power state, poll for power status and wait for the ramp up */
+	XPsmFwSeqSet(&Up[0], XPSMFW_SEQ_RMW, Args->PwrCtrlAddr,
+		     Args->PwrCtrlMask, Args->PwrCtrlMask);
+	XPsmFwSeqSet(&Up[1], XPSMFW_SEQ_POLL_MASK, Args->PwrStatusAddr,
+		     Args->PwrStatusMask, Args->PwrStateAckTimeout);
+	XPsmFwSeqSet(&Up[2], XPSMFW_SEQ_WAIT, 0U, 0U, Args->PwrUpWaitTime);
+	/* Set chip enable bit and mark bank powered up in LOCAL_PWR_STATE */
+	XPsmFwSeqSet(&Up[3], XPSMFW_SEQ_RMW, Args->ChipEnAddr,
+		     Args->ChipEnMask, Args->ChipEnMask);
+	XPsmFwSeqSet(&Up[4], XPSMFW_SEQ_RMW, PSM_LOCAL_PWR_STATE,
+		     Args->PwrStateMask, Args->PwrStateMask);
+	XPsmFwSeqSet(&Up[5], XPSMFW_SEQ_END, 0U, 0U, 0U);
+
+	/* Mark bank powered down, clear chip enable and power state */
+	XPsmFwSeqSet(&Dwn[0], XPSMFW_SEQ_RMW, PSM_LOCAL_PWR_STATE,
+		     Args->PwrStateMask, 0U);
+	XPsmFwSeqSet(&Dwn[1], XPSMFW_SEQ_RMW, Args->ChipEnAddr,
+		     Args->ChipEnMask, 0U);
+	XPsmFwSeqSet(&Dwn[2], XPSMFW_SEQ_RMW, Args->PwrCtrlAddr,
+		     Args->PwrCtrlMask, 0U);
+	if (PLATFORM_VERSION_SILICON == XPsmFw_GetPlatform()) {
+		XPsmFwSeqSet(&Dwn[3], XPSMFW_SEQ_POLL_ZERO, Args->PwrStatusAddr,
+			     Args->PwrStatusMask, Args->PwrStateAckTimeout);
+	} else {
+		XPsmFwSeqSet(&Dwn[3], XPSMFW_SEQ_END, 0U, 0U, 0U);
+	}
+	XPsmFwSeqSet(&Dwn[4], XPSMFW_SEQ_END, 0U, 0U, 0U);
+
+	Args->SeqCompiled = 1U;
+}
+
 static XStatus XPsmFwMemPwrUp(struct XPsmFwMemPwrCtrl_t *Args)
 {
-	/* HERE */
 	XStatus Status = XST_FAILURE;
 	u32 RegVal;
 
@@ -1016,26 +1105,13 @@ static XStatus XPsmFwMemPwrUp(struct XPsmFwMemPwrCtrl_t *Args)
 		goto done;
 	}
 
-	/* Enable power state for selected bank */
-	XPsmFw_RMW32(Args->PwrCtrlAddr, Args->PwrCtrlMask, Args->PwrCtrlMask);
-
-	/* Poll for power status to set */
-	Status = XPsmFw_UtilPollForMask(Args->PwrStatusAddr, Args->PwrStatusMask, Args->PwrStateAckTimeout);
-	if (XST_SUCCESS != Status) {
-		goto done;
+	if (0U == Args->SeqCompiled) {
+		XPsmFwMemSeqCompile(Args);
 	}
 
-	/* Wait for power to ramp up */
-	XPsmFw_UtilWait(Args->PwrUpWaitTime);
-
-	/* Set chip enable bit */
-	XPsmFw_RMW32(Args->ChipEnAddr, Args->ChipEnMask, Args->ChipEnMask);
-
 	/* Mask and clear memory power-up interrupt request */
 	/* This is already handled by common handler so no need to handle here */
-
-	/* Mark memory bank powered up in LOCAL_PWR_STATUS register */
-	XPsmFw_RMW32(PSM_LOCAL_PWR_STATE, Args->PwrStateMask, Args->PwrStateMask);
+	Status = XPsmFwRunSeq(Args->PwrUpSeq);
 
 done:
 	return Status;
@@ -1043,33 +1119,13 @@ done:
 
 static XStatus XPsmFwMemPwrDown(struct XPsmFwMemPwrCtrl_t *Args)
 {
-	XStatus Status = XST_FAILURE;
+	if (0U == Args->SeqCompiled) {
+		XPsmFwMemSeqCompile(Args);
+	}
 
 	/* Mask and clear memory power-down interrupt request */
 	/* This is already handled by common handler so no need to handle here */
-
-	/* Mark memory bank powered down in LOCAL_PWR_STATUS register */
-	XPsmFw_RMW32(PSM_LOCAL_PWR_STATE, Args->PwrStateMask, ~Args->PwrStateMask);
-
-	/* Clear chip enable bit */
-	XPsmFw_RMW32(Args->ChipEnAddr, Args->ChipEnMask, ~Args->ChipEnMask);
-
-	/* Disable power state for selected bank */
-	XPsmFw_RMW32(Args->PwrCtrlAddr, Args->PwrCtrlMask, ~Args->PwrCtrlMask);
-
-	if (PLATFORM_VERSION_SILICON != XPsmFw_GetPlatform()) {
-		Status = XST_SUCCESS;
-		goto done;
-	}
-
-	/* Poll for power status to clear */
-	Status = XPsmFw_UtilPollForZero(Args->PwrStatusAddr, Args->PwrStatusMask, Args->PwrStateAckTimeout);
-	if (XST_SUCCESS != Status) {
-		goto done;
-	}
-
-done:
-	return Status;
+	return XPsmFwRunSeq(Args->PwrDwnSeq);
 }
 
 static XStatus XTcmPwrUp(struct XPsmTcmPwrCtrl_t *Tcm)
@@ -1549,6 +1605,110 @@ static const struct PwrHandlerTable_t PwrUpDwnHandlerTable[] = {
 	{PSM_GLOBAL_REG_REQ_PWRUP_STATUS_ACPU1_MASK, PSM_GLOBAL_REG_REQ_PWRDWN_STATUS_ACPU1_MASK, PowerUp_ACPU1, PowerDwn_ACPU1},
 };
 
+/* Memory banks which can be powered up together with the banks of their group */
+static const struct {
+	u32 PwrUpMask;
+	struct XPsmFwMemPwrCtrl_t *MemPwrCtrl;
+} MemBankTable[] = {
+	{PSM_GLOBAL_REG_REQ_PWRUP_STATUS_OCM_BANK0_MASK, &Ocm0PwrCtrl},
+	{PSM_GLOBAL_REG_REQ_PWRUP_STATUS_OCM_BANK1_MASK, &Ocm1PwrCtrl},
+	{PSM_GLOBAL_REG_REQ_PWRUP_STATUS_OCM_BANK2_MASK, &Ocm2PwrCtrl},
+	{PSM_GLOBAL_REG_REQ_PWRUP_STATUS_OCM_BANK3_MASK, &Ocm3PwrCtrl},
+	{PSM_GLOBAL_REG_REQ_PWRUP_STATUS_TCM0A_MASK, &Tcm0APwrCtrl.TcmMemPwrCtrl},
+	{PSM_GLOBAL_REG_REQ_PWRUP_STATUS_TCM0B_MASK, &Tcm0BPwrCtrl.TcmMemPwrCtrl},
+	{PSM_GLOBAL_REG_REQ_PWRUP_STATUS_TCM1A_MASK, &Tcm1APwrCtrl.TcmMemPwrCtrl},
+	{PSM_GLOBAL_REG_REQ_PWRUP_STATUS_TCM1B_MASK, &Tcm1BPwrCtrl.TcmMemPwrCtrl},
+	{PSM_GLOBAL_REG_REQ_PWRUP_STATUS_GEM0_MASK, &Gem0PwrCtrl.GemMemPwrCtrl},
+	{PSM_GLOBAL_REG_REQ_PWRUP_STATUS_GEM1_MASK, &Gem1PwrCtrl.GemMemPwrCtrl},
+};
+
+/**
+ * XPsmFwMemSeqMerge() - Merge the power up sequence of a bank into Seq
+ *
+ * @Seq       Sequence of the group, same steps and addresses as the bank
+ * @Args      Memory bank power control structure
+ *
+ * The masks are combined and the longest timeout and wait time is kept, so
+ * all banks of the group are enabled by one write and acknowledged by one
+ * poll.
+ */
+static void XPsmFwMemSeqMerge(struct XPsmFwSeqOp_t *Seq,
+			      const struct XPsmFwMemPwrCtrl_t *Args)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < XPSMFW_MEM_PWRUP_SEQ_LEN; Index++) {
+		if (XPSMFW_SEQ_RMW == Seq[Index].Opcode) {
+			Seq[Index].Mask |= Args->PwrUpSeq[Index].Mask;
+			Seq[Index].Value |= Args->PwrUpSeq[Index].Value;
+		} else {
+			Seq[Index].Mask |= Args->PwrUpSeq[Index].Mask;
+			if (Args->PwrUpSeq[Index].Value > Seq[Index].Value) {
+				Seq[Index].Value = Args->PwrUpSeq[Index].Value;
+			}
+		}
+	}
+}
+
+/**
+ * XPsmFwMemGroupPwrUp() - Power up the pending memory banks group wise
+ *
+ * @PwrUpReq  Power up requests which are not masked
+ *
+ * Banks sharing the power control and status registers power up in
+ * parallel instead of one after another. The handlers of the table find
+ * them powered up afterwards. On a timeout nothing is reported here, the
+ * handlers retry the banks one by one and report the error.
+ */
+static void XPsmFwMemGroupPwrUp(u32 PwrUpReq)
+{
+	struct XPsmFwSeqOp_t Seq[XPSMFW_MEM_PWRUP_SEQ_LEN];
+	struct XPsmFwMemPwrCtrl_t *Args;
+	u32 Pending = 0U;
+	u32 PwrState;
+	u32 Index;
+	u32 Other;
+	u32 Count;
+
+	PwrState = XPsmFw_Read32(PSM_LOCAL_PWR_STATE);
+	for (Index = 0U; Index < ARRAYSIZE(MemBankTable); Index++) {
+		Args = MemBankTable[Index].MemPwrCtrl;
+		if (CHECK_BIT(PwrUpReq, MemBankTable[Index].PwrUpMask) &&
+		    !CHECK_BIT(PwrState, Args->PwrStateMask)) {
+			if (0U == Args->SeqCompiled) {
+				XPsmFwMemSeqCompile(Args);
+			}
+			Pending |= ((u32)1U << Index);
+		}
+	}
+
+	for (Index = 0U; Index < ARRAYSIZE(MemBankTable); Index++) {
+		if (0U == (Pending & ((u32)1U << Index))) {
+			continue;
+		}
+		Args = MemBankTable[Index].MemPwrCtrl;
+		Pending &= ~((u32)1U << Index);
+		for (Other = 0U; Other < XPSMFW_MEM_PWRUP_SEQ_LEN; Other++) {
+			Seq[Other] = Args->PwrUpSeq[Other];
+		}
+		Count = 1U;
+
+		for (Other = Index + 1U; Other < ARRAYSIZE(MemBankTable); Other++) {
+			if ((0U != (Pending & ((u32)1U << Other))) &&
+			    (MemBankTable[Other].MemPwrCtrl->PwrCtrlAddr == Args->PwrCtrlAddr)) {
+				XPsmFwMemSeqMerge(Seq, MemBankTable[Other].MemPwrCtrl);
+				Pending &= ~((u32)1U << Other);
+				Count++;
+			}
+		}
+
+		/* A single bank is left to its handler */
+		if (Count > 1U) {
+			(void)XPsmFwRunSeq(Seq);
+		}
+	}
+}
+
 /**
  * XPsmFw_DispatchPwrUpHandler() - Power-up interrupt handler
  *
@@ -1562,6 +1722,9 @@ XStatus XPsmFw_DispatchPwrUpHandler(u32 PwrUpStatus, u32 PwrUpIntMask)
 	XStatus Status = XST_FAILURE;
 	u32 Index;
 
+	/* Power up the requested memory banks of a group in parallel */
+	XPsmFwMemGroupPwrUp(PwrUpStatus & ~PwrUpIntMask);
+
 	for (Index = 0U; Index < ARRAYSIZE(PwrUpDwnHandlerTable); Index++) {
 		if ((CHECK_BIT(PwrUpStatus, PwrUpDwnHandlerTable[Index].PwrUpMask)) &&
 		    !(CHECK_BIT(PwrUpIntMask, PwrUpDwnHandlerTable[Index].PwrUpMask))) {
@@ -17,6 +17,7 @@
 * Ver	Who	Date		Changes
 * ---- ---- -------- ------------------------------
 * 1.00	rp	07/13/2018	Initial release
+* 1.01	fl	10/14/2026	Add compiled memory bank power sequences
 *
 * </pre>
 *
@@ -162,6 +163,31 @@ struct PwrHandlerTable_t {
 	PwrFunction_t PwrDwnHandler;
 };
 
+/* Opcodes of a compiled power transition sequence */
+enum XPsmFwSeqOpcode {
+	XPSMFW_SEQ_END = 0U,
+	XPSMFW_SEQ_RMW,
+	XPSMFW_SEQ_POLL_MASK,
+	XPSMFW_SEQ_POLL_ZERO,
+	XPSMFW_SEQ_WAIT,
+};
+
+/*
+ * One step of a compiled sequence. Value is the value written under Mask
+ * for XPSMFW_SEQ_RMW, the timeout for the polls and the wait time for
+ * XPSMFW_SEQ_WAIT.
+ */
+struct XPsmFwSeqOp_t {
+	u32 Opcode;
+	u32 Addr;
+	u32 Mask;
+	u32 Value;
+};
+
+/* Sequence lengths of a memory bank, including the XPSMFW_SEQ_END step */
+#define XPSMFW_MEM_PWRUP_SEQ_LEN	(6U)
+#define XPSMFW_MEM_PWRDWN_SEQ_LEN	(5U)
+
 struct XPsmFwPwrCtrl_t {
 	enum ProcDeviceId Id;
 
@@ -229,6 +255,11 @@ struct XPsmFwMemPwrCtrl_t {
 
 	/* mem_BANKx_PWRUP_WAIT_TIME */
 	u32 PwrUpWaitTime;
+
+	/* Power up and power down sequences, compiled on first use */
+	struct XPsmFwSeqOp_t PwrUpSeq[XPSMFW_MEM_PWRUP_SEQ_LEN];
+	struct XPsmFwSeqOp_t PwrDwnSeq[XPSMFW_MEM_PWRDWN_SEQ_LEN];
+	u32 SeqCompiled;
 };
 
 /*
@@ -53,6 +53,9 @@
 *                       which is being used instead of one from DDR.
 *                       Deleted GetImageHeaderAndSignature() and added
 *                       GetNAuthImageHeader()
+* 13.0  fl  10/14/26    Calculate the MD5 checksum of partitions read from
+*                       non linear boot devices chunk by chunk while they
+*                       are moved, instead of a second pass over DDR
 *
 * </pre>
 *
@@ -85,6 +88,12 @@
 #define MAXIMUM_IMAGE_WORD_LEN 0x40000000
 #define MD5_CHECKSUM_SIZE   16
 
+/*
+ * Chunk moved from a non linear boot device before its checksum is
+ * updated, a multiple of the MD5 block size that stays in the L2 cache
+ */
+#define MD5_STREAM_CHUNK_SIZE	0x20000
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -93,6 +102,7 @@
 u32 ValidateParition(u32 StartAddr, u32 Length, u32 ChecksumOffset);
 u32 GetPartitionChecksum(u32 ChecksumOffset, u8 *Checksum);
 u32 CalcPartitionChecksum(u32 SourceAddr, u32 DataLength, u8 *Checksum);
+static u32 MoveImageWithChecksum(u32 SourceAddr, u32 DestAddr, u32 Length);
 
 /************************** Variable Definitions *****************************/
 /*
@@ -109,6 +119,14 @@ u8 ApplicationFlag;
 u32 ExecutionAddress;
 ImageMoverType MoveImage;
 
+/*
+ * Checksum of the partition calculated while it was moved
+ */
+static u8 StreamChecksum[MD5_CHECKSUM_SIZE];
+static u32 StreamChecksumAddr;
+static u32 StreamChecksumLength;
+static u8 StreamChecksumValid;
+
 /*
  * Header array
  */
@@ -1138,9 +1156,19 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
 			LoadAddr = DDR_TEMP_START_ADDR;
 		}
 
-		Status = MoveImage(SourceAddr,
+		/*
+		 * The partition is not changed after the move, its checksum
+		 * is calculated on the chunks just read
+		 */
+		if (PartitionChecksumFlag) {
+			Status = MoveImageWithChecksum(SourceAddr,
+						LoadAddr,
+						(ImageWordLen << WORD_LENGTH_SHIFT));
+		} else {
+			Status = MoveImage(SourceAddr,
 						LoadAddr,
 						(ImageWordLen << WORD_LENGTH_SHIFT));
+		}
 		if(Status != XST_SUCCESS) {
 			fsbl_printf(DEBUG_GENERAL, "Move Image Failed\r\n");
 			return XST_FAILURE;
@@ -1362,6 +1390,20 @@ u32 GetPartitionChecksum(u32 ChecksumOffset, u8 *Checksum)
 *******************************************************************************/
 u32 CalcPartitionChecksum(u32 SourceAddr, u32 DataLength, u8 *Checksum)
 {
+	u32 Index;
+
+	/*
+	 * Use the checksum calculated during the move of this data
+	 */
+	if ((StreamChecksumValid != 0) && (StreamChecksumAddr == SourceAddr) &&
+			(StreamChecksumLength == DataLength)) {
+		StreamChecksumValid = 0;
+		for (Index = 0; Index < MD5_CHECKSUM_SIZE; Index++) {
+			Checksum[Index] = StreamChecksum[Index];
+		}
+		return XST_SUCCESS;
+	}
+
 	/*
 	 * Calculate checksum using MD5 algorithm
 	 */
@@ -1370,3 +1412,62 @@ u32 CalcPartitionChecksum(u32 SourceAddr, u32 DataLength, u8 *Checksum)
     return XST_SUCCESS;
 }
 
+
+/******************************************************************************/
+/**
+*
+* This function moves an image from a non linear boot device in chunks and
+* updates the MD5 checksum of each chunk while it is still in the cache. The
+* checksum is used by CalcPartitionChecksum for the same data.
+*
+* @param 	Source address in the boot device
+* @param 	Destination address
+* @param 	Length of the data in bytes
+*
+* @return
+*		- XST_SUCCESS if the move is successful
+*		- XST_FAILURE if the move failed
+*
+* @note		None
+*
+*******************************************************************************/
+static u32 MoveImageWithChecksum(u32 SourceAddr, u32 DestAddr, u32 Length)
+{
+	MD5Context Context;
+	u32 Offset;
+	u32 ChunkSize;
+	u32 Status;
+
+	StreamChecksumValid = 0;
+	MD5Init(&Context);
+
+	for (Offset = 0; Offset < Length; Offset += ChunkSize) {
+		ChunkSize = Length - Offset;
+		if (ChunkSize > MD5_STREAM_CHUNK_SIZE) {
+			ChunkSize = MD5_STREAM_CHUNK_SIZE;
+		}
+
+#ifdef	XPAR_XWDTPS_0_BASEADDR
+		/*
+		 * Prevent WDT reset
+		 */
+		XWdtPs_RestartWdt(&Watchdog);
+#endif
+
+		Status = MoveImage(SourceAddr + Offset, DestAddr + Offset,
+				ChunkSize);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		MD5Update(&Context, (u8 *)(DestAddr + Offset), ChunkSize, 0);
+	}
+
+	MD5Final(&Context, StreamChecksum, 0);
+	StreamChecksumAddr = DestAddr;
+	StreamChecksumLength = Length;
+	StreamChecksumValid = 1;
+
+	return XST_SUCCESS;
+}
+
@@ -67,6 +67,7 @@
 * Ver	Who	Date		Changes
 * ----- ---- -------- -------------------------------------------------------
 * 5.00a sgd	05/17/13 Initial release
+* 6.00  fl	10/14/26 Transform word aligned data in place in MD5Update
 *
 *
 * </pre>
@@ -358,10 +359,18 @@ inline void MD5Update( MD5Context *context, u8 *buffer,
 	 */
 
 	while( len >= MD5_SIGNATURE_BYTE_SIZE ) {
-		MD5Memcpy( context->intermediate, buffer, MD5_SIGNATURE_BYTE_SIZE,
-				 doByteSwap );
-		
-		MD5Transform( context->buffer, (u32 *)context->intermediate );
+		/*
+		 * Word aligned data needs no copy, MD5 words are little endian
+		 */
+		if( ( doByteSwap == FALSE ) && ( ( (u32)buffer & 0x3U ) == 0U ) ) {
+			MD5Transform( context->buffer, (u32 *)buffer );
+		} else {
+			MD5Memcpy( context->intermediate, buffer,
+					MD5_SIGNATURE_BYTE_SIZE, doByteSwap );
+
+			MD5Transform( context->buffer,
+					(u32 *)context->intermediate );
+		}
 		
 		buffer += MD5_SIGNATURE_BYTE_SIZE;
 		len    -= MD5_SIGNATURE_BYTE_SIZE;
@@ -30,6 +30,8 @@
 *       bsv  05/15/21 Support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed is disabled by
 *                     default
+* 5.0   fl   10/14/26 Added FSBL_DDR_PREFETCH_EXCLUDE_VAL and
+*                     FSBL_DDR_CALIB_CACHE_EXCLUDE_VAL configurations
 *
 *</pre>
 *
@@ -52,6 +54,14 @@ extern "C" {
 /* This is the address in DDR where boot.bin will be copied in USB boot mode */
 #define XFSBL_DDR_TEMP_BUFFER_ADDRESS			(0x4000000U)
 
+/*
+ * This is the size of the buffer in OCM where the start of the first
+ * partition is prefetched while DDR is trained (FSBL_DDR_PREFETCH_EXCLUDE_VAL)
+ */
+#ifndef XFSBL_PREFETCH_BUFFER_SIZE
+#define XFSBL_PREFETCH_BUFFER_SIZE		(0x4000U)
+#endif
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -138,6 +148,10 @@ extern "C" {
  *     - FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL Code to "load authenticated
  *       partitions as non secure when EFUSEs are not programmed and when boot
  *       header is not authenticated" is excluded
+ *     - FSBL_DDR_PREFETCH_EXCLUDE_VAL Reading the boot device while DDR is
+ *       trained is excluded
+ *     - FSBL_DDR_CALIB_CACHE_EXCLUDE_VAL Reusing a saved DDR calibration
+ *       in place of DDR training is excluded
  */
 #ifndef FSBL_NAND_EXCLUDE_VAL
 #define FSBL_NAND_EXCLUDE_VAL			(0U)
@@ -211,6 +225,14 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL	(1U)
 #endif
 
+#ifndef FSBL_DDR_PREFETCH_EXCLUDE_VAL
+#define FSBL_DDR_PREFETCH_EXCLUDE_VAL	(1U)
+#endif
+
+#ifndef FSBL_DDR_CALIB_CACHE_EXCLUDE_VAL
+#define FSBL_DDR_CALIB_CACHE_EXCLUDE_VAL	(1U)
+#endif
+
 #if (FSBL_NAND_EXCLUDE_VAL) && (!defined(FSBL_NAND_EXCLUDE))
 #define FSBL_NAND_EXCLUDE
 #endif
@@ -286,6 +308,16 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE
 #endif
 
+#if (FSBL_DDR_PREFETCH_EXCLUDE_VAL == 1U) && \
+	(!defined(FSBL_DDR_PREFETCH_EXCLUDE))
+#define FSBL_DDR_PREFETCH_EXCLUDE
+#endif
+
+#if (FSBL_DDR_CALIB_CACHE_EXCLUDE_VAL == 1U) && \
+	(!defined(FSBL_DDR_CALIB_CACHE_EXCLUDE))
+#define FSBL_DDR_CALIB_CACHE_EXCLUDE
+#endif
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
@@ -33,6 +33,9 @@
  *       bsv  02/05/20 Added support for ZCU208 board
  * 4.0   mn   10/28/21 Added support for ZCU670 board
  * 6.1   ng   07/13/23 Added SDT support
+ *       fl   10/14/26 Allow the SPD EEPROM IIC clock rate to be overridden
+ *       fl   10/14/26 Split the training to let FSBL read the boot device
+ *                     while DDR is trained, reuse a saved DDR calibration
  *
  * </pre>
  *
@@ -48,6 +51,11 @@
 
 #include "xiicps.h"
 #include "xfsbl_ddr_init.h"
+#ifdef XFSBL_DDR_CALIB_CACHE
+#include "xil_cache.h"
+#include "xfsbl_csu_dma.h"
+#include "xfsbl_authentication.h"
+#endif
 
 /************************** Constant Definitions *****************************/
 
@@ -166,8 +174,14 @@
 /* Rank offset Value used for HIF calculation */
 #define XFSBL_HIF_RANK(XVal)				(500U + (XVal))
 
-/* IIC Serial Clock rate */
+/*
+ * IIC Serial Clock rate. SPD EEPROMs and the IIC mux on most boards support
+ * 400KHz, which reduces the time taken to read the 512 bytes of SPD data.
+ * It can be overridden using the compiler build flags.
+ */
+#ifndef XFSBL_IIC_SCLK_RATE
 #define XFSBL_IIC_SCLK_RATE		100000U
+#endif
 /* IIC Mux Address */
 #define XFSBL_MUX_ADDR			0x75U
 /* SODIMM Slave Address */
@@ -185,6 +199,13 @@
 
 #define XFSBL_DDRPHY_BASE_ADDR		0xFD080000U
 
+#ifdef XFSBL_DDR_CALIB_CACHE
+/* Base address of the registers of the first DDR PHY byte lane */
+#define XFSBL_DDR_CALIB_DX0_BASE_ADDR	0xFD080700U
+/* Offset between the registers of two DDR PHY byte lanes */
+#define XFSBL_DDR_CALIB_LANE_STRIDE	0x100U
+#endif
+
 #ifdef SDT
 #define XFSBL_DBI_INFO			XPAR_XDDRCPSU_0_DDRC_DATA_MASK_AND_DBI
 
@@ -226,9 +247,57 @@
 	(Mtb * PDimmPtr->MtbPs + (Ftb * (s8)PDimmPtr->Ftb10thPs) / 10)
 
 /************************** Function Prototypes ******************************/
+static u32 XFsbl_DdrcPhyTrainingStart(struct DdrcInitData *DdrDataPtr,
+		u32 *PollValPtr);
+static void XFsbl_DdrcPhyTrainingFinish(struct DdrcInitData *DdrDataPtr,
+		u32 PollVal);
+#ifdef XFSBL_DDR_CALIB_CACHE
+static u32 XFsbl_DdrCalibRestore(const XFsbl_DimmParams *PDimmPtr);
+static void XFsbl_DdrCalibCapture(const XFsbl_DimmParams *PDimmPtr);
+static void XFsbl_DdrCalibSave(void);
+#endif
 
 /************************** Variable Definitions *****************************/
 
+/*
+ * DDR Initialization data, kept for the end of the training when it is
+ * completed by XFsbl_DdrTrainingWait()
+ */
+static struct DdrcInitData DdrData;
+
+#ifdef XFSBL_DDR_PREFETCH
+static u32 DdrTrainingPending = FALSE;
+static u32 DdrTrainingPollVal;
+#endif
+
+#ifdef XFSBL_DDR_CALIB_CACHE
+/* Offsets of the trained registers in a DDR PHY byte lane */
+static const u32 DdrCalibRegOffset[XFSBL_DDR_CALIB_LANE_REGS] = {
+	0x14U,	/* DXnGCR5, read VREF */
+	0x18U,	/* DXnGCR6, DRAM VREF */
+	0x40U,	/* DXnBDLR0, write DQ bit delays */
+	0x44U,	/* DXnBDLR1 */
+	0x48U,	/* DXnBDLR2, write DM/DQS bit delays */
+	0x50U,	/* DXnBDLR3, read DQ bit delays */
+	0x54U,	/* DXnBDLR4 */
+	0x58U,	/* DXnBDLR5, read DM/DQS bit delays */
+	0x60U,	/* DXnBDLR6, read DQSN bit delay */
+	0x80U,	/* DXnLCDLR0, write leveling delay */
+	0x84U,	/* DXnLCDLR1, write DQ delay */
+	0x88U,	/* DXnLCDLR2, DQS gating delay */
+	0x8CU,	/* DXnLCDLR3, read DQS delay */
+	0x90U,	/* DXnLCDLR4, read DQSN delay */
+	0x94U,	/* DXnLCDLR5, DQS gating status delay */
+	0xA0U,	/* DXnMDLR0, master delay */
+	0xC0U,	/* DXnGTR0, gating and write leveling system latency */
+};
+
+static XFsbl_DdrCalib DdrCalib __attribute__ ((aligned (64U)));
+static u8 DdrCalibSpdHash[XFSBL_DDR_CALIB_HASH_LEN]
+	__attribute__ ((aligned (4U)));
+static u32 DdrCalibRestored = FALSE;
+#endif
+
 /*****************************************************************************/
 /**
  * This function returns log2 of the given value in argument
@@ -5767,23 +5836,26 @@ static void XFsbl_MrsFunc(u32 Addr, u32 Rank, u32 Mr07)
 
 /*****************************************************************************/
 /**
- * This function performs the DDR/PHY training sequence to initialize the DDR
+ * This function starts the DDR/PHY training sequence to initialize the DDR.
+ * It returns once the DDR PHY runs the data training, which is completed
+ * by XFsbl_DdrcPhyTrainingFinish().
  *
  * @param	DdrDataPtr is pointer to DDR Initialization Data Structure
+ * @param	PollValPtr is the DDR PHY general status to wait for at the
+ *		end of the data training
  *
  * @return	Returns XFSBL_SUCCESS or XFSBL_FAILURE
  *
  *****************************************************************************/
-static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr)
+static u32 XFsbl_DdrcPhyTrainingStart(struct DdrcInitData *DdrDataPtr,
+		u32 *PollValPtr)
 {
 	XFsbl_DimmParams *PDimmPtr = &DdrDataPtr->PDimm;
 	u32 ActiveRanks;
 	u32 PollVal = 0U;
-	u32 CurTRefPrd;
 	u32 RegVal = 0U;
 	u32 PllRetry = 100U;
 	u32 PllLocked = 0U;
-	u32 Puad;
 	u32 Status = XFSBL_FAILURE;
 
 	ActiveRanks = Xil_In32(XFSBL_DDRC_BASE_ADDR + 0x0000U);
@@ -5998,6 +6070,15 @@ static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr)
 	XFSBL_PROG_REG(DDR_PHY_PGCR1_OFFSET, DDR_PHY_PGCR1_PUBMODE_MASK,
 			DDR_PHY_PGCR1_PUBMODE_SHIFT, 1U);
 
+#ifdef XFSBL_DDR_CALIB_CACHE
+	/* Skip the data training if the saved calibration is restored */
+	if (XFsbl_DdrCalibRestore(PDimmPtr) == XFSBL_SUCCESS) {
+		*PollValPtr = 0U;
+		Status = XFSBL_SUCCESS;
+		goto END;
+	}
+#endif
+
 	if ((PDimmPtr->MemType == SPD_MEMTYPE_DDR3) ||
 			(PDimmPtr->MemType == SPD_MEMTYPE_DDR4)) {
 		if (PDimmPtr->DeskewTrn == 0U)
@@ -6057,34 +6138,66 @@ static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr)
 		PollVal |= 0x300U;
 	}
 
-	if (PDimmPtr->MemType != SPD_MEMTYPE_LPDDR4) {
-		RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-		while (RegVal != PollVal) {
-			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-		}
-	} else {
-		while (RegVal != 0x8000007EU)
+	*PollValPtr = PollVal;
+	Status = XFSBL_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function waits for the data training started by
+ * XFsbl_DdrcPhyTrainingStart() and completes the DDR/PHY training sequence
+ *
+ * @param	DdrDataPtr is pointer to DDR Initialization Data Structure
+ * @param	PollVal is the DDR PHY general status to wait for, 0 if the
+ *		data training is skipped as the saved calibration is restored
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_DdrcPhyTrainingFinish(struct DdrcInitData *DdrDataPtr,
+		u32 PollVal)
+{
+	XFsbl_DimmParams *PDimmPtr = &DdrDataPtr->PDimm;
+	u32 ActiveRanks;
+	u32 CurTRefPrd;
+	u32 RegVal = 0U;
+	u32 Puad;
+
+	ActiveRanks = Xil_In32(XFSBL_DDRC_BASE_ADDR + 0x0000U);
+
+	if (PollVal != 0U) {
+		if (PDimmPtr->MemType != SPD_MEMTYPE_LPDDR4) {
 			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+			while (RegVal != PollVal) {
+				RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+			}
+		} else {
+			while (RegVal != 0x8000007EU)
+				RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
 
-		RegVal = Xil_In32(XFSBL_DDRPHY_BASE_ADDR + 0x200U);
-		RegVal &= ~(0xFU << 28U);
-		Xil_Out32(XFSBL_DDRPHY_BASE_ADDR + 0x200U, RegVal);
+			RegVal = Xil_In32(XFSBL_DDRPHY_BASE_ADDR + 0x200U);
+			RegVal &= ~(0xFU << 28U);
+			Xil_Out32(XFSBL_DDRPHY_BASE_ADDR + 0x200U, RegVal);
 
-		RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-		while (RegVal != PollVal)
 			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+			while (RegVal != PollVal)
+				RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
 
 
-		RegVal &= ~(0xFU << 28U);
-		RegVal |= (0x8U << 28U);
-		Xil_Out32(XFSBL_DDRPHY_BASE_ADDR + 0x200U, RegVal);
-	}
+			RegVal &= ~(0xFU << 28U);
+			RegVal |= (0x8U << 28U);
+			Xil_Out32(XFSBL_DDRPHY_BASE_ADDR + 0x200U, RegVal);
+		}
 
-	if (PDimmPtr->MemType != SPD_MEMTYPE_LPDDR4) {
-		RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-	}
+		if (PDimmPtr->MemType != SPD_MEMTYPE_LPDDR4) {
+			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+		}
 
-	RegVal = ((Xil_In32(DDR_PHY_PGSR0_OFFSET) & 0x1FFF0000U) >> 18U);
+		RegVal = ((Xil_In32(DDR_PHY_PGSR0_OFFSET) & 0x1FFF0000U) >> 18U);
+	}
 
 	if ((PDimmPtr->Vref == 1U) && (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR4 ||
 				PDimmPtr->MemType == SPD_MEMTYPE_DDR4)) {
@@ -6161,6 +6274,12 @@ static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr)
 
 	}
 
+#ifdef XFSBL_DDR_CALIB_CACHE
+	if (PollVal != 0U) {
+		XFsbl_DdrCalibCapture(PDimmPtr);
+	}
+#endif
+
 	if (PDimmPtr->Slowboot == 1U) {
 		XFSBL_PROG_REG(DDRC_SWCTL_OFFSET, DDRC_SWCTL_SW_DONE_MASK,
 				DDRC_SWCTL_SW_DONE_SHIFT, 0U);
@@ -6307,8 +6426,28 @@ static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr)
 				DDR_PHY_DQSDR0_DFTDTEN_MASK,
 				DDR_PHY_DQSDR0_DFTDTEN_SHIFT, 1U);
 	}
+}
 
-	Status = XFSBL_SUCCESS;
+/*****************************************************************************/
+/**
+ * This function performs the DDR/PHY training sequence to initialize the DDR
+ *
+ * @param	DdrDataPtr is pointer to DDR Initialization Data Structure
+ *
+ * @return	Returns XFSBL_SUCCESS or XFSBL_FAILURE
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr)
+{
+	u32 PollVal;
+	u32 Status;
+
+	Status = XFsbl_DdrcPhyTrainingStart(DdrDataPtr, &PollVal);
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	XFsbl_DdrcPhyTrainingFinish(DdrDataPtr, PollVal);
 
 END:
 	return Status;
@@ -6849,6 +6988,222 @@ END:
 	return UStatus;
 }
 
+#ifdef XFSBL_DDR_CALIB_CACHE
+/*****************************************************************************/
+/**
+ * This function returns the DDR PHY byte lanes used by the DIMM
+ *
+ * @param	PDimmPtr is pointer to DDR DIMM Parameters
+ *
+ * @return	Returns the mask of the byte lanes, bit n set for DXn
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrCalibLanes(const XFsbl_DimmParams *PDimmPtr)
+{
+	u32 Lanes = 0x0FU;
+
+	if (PDimmPtr->BusWidth == 64U) {
+		Lanes = 0xFFU;
+	}
+	if (PDimmPtr->Ecc) {
+		Lanes |= (0x1U << 8U);
+	}
+
+	return Lanes;
+}
+
+/*****************************************************************************/
+/**
+ * This function calculates the SHA3 digest of the saved DDR calibration,
+ * over all its fields but the digest itself
+ *
+ * @param	Hash is the buffer where the digest is written
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_DdrCalibDigest(u8 *Hash)
+{
+	Xil_DCacheFlushRange((INTPTR)&DdrCalib, sizeof(DdrCalib));
+	XFsbl_ShaDigest((const u8 *)&DdrCalib,
+			(u32)(sizeof(DdrCalib) - sizeof(DdrCalib.Hash)), Hash,
+			XFSBL_DDR_CALIB_HASH_LEN);
+}
+
+/*****************************************************************************/
+/**
+ * This function compares two SHA3 digests
+ *
+ * @param	Hash1 is the first digest
+ * @param	Hash2 is the second digest
+ *
+ * @return	Returns XFSBL_SUCCESS if the digests are equal, else
+ *		XFSBL_FAILURE
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrCalibCompare(const u8 *Hash1, const u8 *Hash2)
+{
+	u32 Index;
+	u8 Diff = 0U;
+
+	/* Compare all the bytes, to take the same time for any mismatch */
+	for (Index = 0U; Index < XFSBL_DDR_CALIB_HASH_LEN; Index++) {
+		Diff |= Hash1[Index] ^ Hash2[Index];
+	}
+
+	return (Diff == 0U) ? XFSBL_SUCCESS : XFSBL_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+ * This function restores the DDR calibration saved by an earlier boot in
+ * place of the data training. The calibration is used only if it is intact,
+ * and was saved for the same DIMM, identified by its SPD data.
+ *
+ * @param	PDimmPtr is pointer to DDR DIMM Parameters
+ *
+ * @return	Returns XFSBL_SUCCESS if the calibration is restored, else
+ *		XFSBL_FAILURE and the data training must be run
+ *
+ * @note	Only DDR3 and DDR4 use a saved calibration, LPDDR3 and LPDDR4
+ *		always run the data training.
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrCalibRestore(const XFsbl_DimmParams *PDimmPtr)
+{
+	u8 Hash[XFSBL_DDR_CALIB_HASH_LEN] __attribute__ ((aligned (4U)));
+	u32 Status = XFSBL_FAILURE;
+	u32 Lanes;
+	u32 Lane;
+	u32 Index;
+	UINTPTR LaneAddr;
+
+	if ((PDimmPtr->MemType != SPD_MEMTYPE_DDR3) &&
+			(PDimmPtr->MemType != SPD_MEMTYPE_DDR4)) {
+		goto END;
+	}
+
+	if (XFsbl_HookDdrCalibLoad((u8 *)&DdrCalib, sizeof(DdrCalib)) !=
+			XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	if ((DdrCalib.Magic != XFSBL_DDR_CALIB_MAGIC) ||
+			(DdrCalib.Version != XFSBL_DDR_CALIB_VERSION)) {
+		goto END;
+	}
+
+	XFsbl_DdrCalibDigest(Hash);
+	if (XFsbl_DdrCalibCompare(Hash, DdrCalib.Hash) != XFSBL_SUCCESS) {
+		XFsbl_Printf(DEBUG_GENERAL, "Saved DDR calibration is corrupted\n\r");
+		goto END;
+	}
+
+	if (XFsbl_DdrCalibCompare(DdrCalibSpdHash, DdrCalib.SpdHash) !=
+			XFSBL_SUCCESS) {
+		XFsbl_Printf(DEBUG_INFO, "Saved DDR calibration is of another "
+				"DIMM\n\r");
+		goto END;
+	}
+
+	Lanes = XFsbl_DdrCalibLanes(PDimmPtr);
+	for (Lane = 0U; Lane < XFSBL_DDR_CALIB_LANES; Lane++) {
+		if ((Lanes & (0x1U << Lane)) == 0U) {
+			continue;
+		}
+		LaneAddr = XFSBL_DDR_CALIB_DX0_BASE_ADDR +
+			(Lane * XFSBL_DDR_CALIB_LANE_STRIDE);
+		for (Index = 0U; Index < XFSBL_DDR_CALIB_LANE_REGS; Index++) {
+			Xil_Out32(LaneAddr + DdrCalibRegOffset[Index],
+					DdrCalib.LaneReg[Lane][Index]);
+		}
+	}
+
+	DdrCalibRestored = TRUE;
+	XFsbl_Printf(DEBUG_INFO, "Saved DDR calibration restored\n\r");
+	Status = XFSBL_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function reads the trained registers of the DDR PHY byte lanes at the
+ * end of the data training, to be saved by XFsbl_DdrCalibSave()
+ *
+ * @param	PDimmPtr is pointer to DDR DIMM Parameters
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_DdrCalibCapture(const XFsbl_DimmParams *PDimmPtr)
+{
+	u32 Lanes;
+	u32 Lane;
+	u32 Index;
+	UINTPTR LaneAddr;
+
+	(void)memset(&DdrCalib, 0, sizeof(DdrCalib));
+	DdrCalibRestored = FALSE;
+
+	if ((PDimmPtr->MemType != SPD_MEMTYPE_DDR3) &&
+			(PDimmPtr->MemType != SPD_MEMTYPE_DDR4)) {
+		goto END;
+	}
+
+	Lanes = XFsbl_DdrCalibLanes(PDimmPtr);
+	for (Lane = 0U; Lane < XFSBL_DDR_CALIB_LANES; Lane++) {
+		if ((Lanes & (0x1U << Lane)) == 0U) {
+			continue;
+		}
+		LaneAddr = XFSBL_DDR_CALIB_DX0_BASE_ADDR +
+			(Lane * XFSBL_DDR_CALIB_LANE_STRIDE);
+		for (Index = 0U; Index < XFSBL_DDR_CALIB_LANE_REGS; Index++) {
+			DdrCalib.LaneReg[Lane][Index] =
+				Xil_In32(LaneAddr + DdrCalibRegOffset[Index]);
+		}
+	}
+
+	(void)XFsbl_MemCpy(DdrCalib.SpdHash, DdrCalibSpdHash,
+			XFSBL_DDR_CALIB_HASH_LEN);
+	DdrCalib.Version = XFSBL_DDR_CALIB_VERSION;
+	DdrCalib.Magic = XFSBL_DDR_CALIB_MAGIC;
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * This function gives the calibration of a completed data training to
+ * XFsbl_HookDdrCalibSave(), so that the next boots can restore it
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ * @note	A failure to save is not fatal, the next boot trains DDR.
+ *
+ *****************************************************************************/
+static void XFsbl_DdrCalibSave(void)
+{
+	if ((DdrCalibRestored == TRUE) ||
+			(DdrCalib.Magic != XFSBL_DDR_CALIB_MAGIC)) {
+		goto END;
+	}
+
+	XFsbl_DdrCalibDigest(DdrCalib.Hash);
+	if (XFsbl_HookDdrCalibSave((const u8 *)&DdrCalib, sizeof(DdrCalib)) !=
+			XFSBL_SUCCESS) {
+		XFsbl_Printf(DEBUG_GENERAL, "DDR calibration is not saved\n\r");
+	}
+
+END:
+	return;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * This function checks for the DDR SPD data and Initializes the same based on
@@ -6871,11 +7226,8 @@ u32 XFsbl_DdrInit(void)
 	u32 RegVal;
 #endif
 
-	/* Define and Initialize the DDR Initialization data */
-	struct DdrcInitData DdrData = {
-		.AddrMapCsBit0 = 0x0U,
-		.AddrMapRowBits2To10 = 0x0U,
-	};
+	/* Initialize the DDR Initialization data */
+	(void)memset(&DdrData, 0, sizeof(DdrData));
 
 	/* Get the Model Part Number from the SPD stored in EEPROM */
 	Status = XFsbl_IicReadSpdEeprom(SpdData);
@@ -6884,6 +7236,16 @@ u32 XFsbl_DdrInit(void)
 		goto END;
 	}
 
+#ifdef XFSBL_DDR_CALIB_CACHE
+	/* A saved calibration is only valid for the DIMM it was saved for */
+	Status = XFsbl_CsuDmaInit(NULL);
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+	XFsbl_ShaDigest(SpdData, sizeof(SpdData), DdrCalibSpdHash,
+			XFSBL_DDR_CALIB_HASH_LEN);
+#endif
+
 #if defined(XPS_BOARD_ZCU102) || defined(XPS_BOARD_ZCU106) \
 	|| defined(XPS_BOARD_ZCU111) || defined(XPS_BOARD_ZCU216) \
 	|| defined(XPS_BOARD_ZCU208) || defined(XPS_BOARD_ZCU670)
@@ -6935,26 +7297,63 @@ u32 XFsbl_DdrInit(void)
 	/* Check if DDR is in self refresh mode */
 	RegVal = Xil_In32(XFSBL_DDR_STATUS_REGISTER_OFFSET) &
 		DDR_STATUS_FLAG_MASK;
-	if (!RegVal) {
+	if (!RegVal)
+#endif
+	{
+#ifdef XFSBL_DDR_PREFETCH
+		/*
+		 * Start the Training Sequence, it is completed by
+		 * XFsbl_DdrTrainingWait() after the boot device is read
+		 */
+		Status = XFsbl_DdrcPhyTrainingStart(&DdrData,
+				&DdrTrainingPollVal);
+		if (Status != XFSBL_SUCCESS) {
+			Status = XFSBL_FAILURE;
+			goto END;
+		}
+		DdrTrainingPending = TRUE;
+#else
 		/* Execute the Training Sequence */
 		Status = XFsbl_DdrcPhyTraining(&DdrData);
 		if (Status != XFSBL_SUCCESS) {
 			Status = XFSBL_FAILURE;
 			goto END;
 		}
-	}
-#else
-	/* Execute the Training Sequence */
-	Status = XFsbl_DdrcPhyTraining(&DdrData);
-	if (Status != XFSBL_SUCCESS) {
-		Status = XFSBL_FAILURE;
-		goto END;
-	}
+#ifdef XFSBL_DDR_CALIB_CACHE
+		XFsbl_DdrCalibSave();
 #endif
+#endif
+	}
 
 	Status = XFSBL_SUCCESS;
 END:
 	return Status;
 }
+
+#ifdef XFSBL_DDR_PREFETCH
+/*****************************************************************************/
+/**
+ * This function waits for the DDR training started by XFsbl_DdrInit() and
+ * completes it. DDR can be used once this function returns.
+ *
+ * @param	None
+ *
+ * @return	returns XFSBL_SUCCESS, DDR training errors are reported by
+ *		XFsbl_DdrInit()
+ *
+ *****************************************************************************/
+u32 XFsbl_DdrTrainingWait(void)
+{
+	if (DdrTrainingPending == TRUE) {
+		XFsbl_DdrcPhyTrainingFinish(&DdrData, DdrTrainingPollVal);
+		DdrTrainingPending = FALSE;
+#ifdef XFSBL_DDR_CALIB_CACHE
+		XFsbl_DdrCalibSave();
+#endif
+	}
+
+	return XFSBL_SUCCESS;
+}
+#endif
 #endif /* XPAR_DYNAMIC_DDR_ENABLED */
 #endif /* XFSBL_PS_DDR */
@@ -28,6 +28,8 @@
  *       mn   12/24/19 Enable Address Mirroring based on SPD data
  *       bsv  02/05/20 Added support for ZCU208 board
  * 6.1   ng   07/13/23 Added SDT support
+ * 6.2   fl   10/14/26 Added XFsbl_DdrTrainingWait() and the saved DDR
+ *                     calibration record
  *
  * </pre>
  *
@@ -1863,7 +1865,36 @@ struct DdrcInitData {
 	XFsbl_DimmParams PDimm;
 };
 
+#ifdef XFSBL_DDR_CALIB_CACHE
+/* Identification of a saved DDR calibration, "DCAL" */
+#define XFSBL_DDR_CALIB_MAGIC		0x4C414344U
+/* Version of the saved DDR calibration layout */
+#define XFSBL_DDR_CALIB_VERSION		1U
+/* Number of DDR PHY byte lanes, 8 data lanes and the ECC lane */
+#define XFSBL_DDR_CALIB_LANES		9U
+/* Number of trained registers saved per DDR PHY byte lane */
+#define XFSBL_DDR_CALIB_LANE_REGS	17U
+/* Length of the SHA3 digests in the saved DDR calibration */
+#define XFSBL_DDR_CALIB_HASH_LEN	48U
+
+/*
+ * DDR calibration saved by XFsbl_HookDdrCalibSave() and restored by
+ * XFsbl_HookDdrCalibLoad()
+ */
+typedef struct {
+	u32 Magic; /* XFSBL_DDR_CALIB_MAGIC */
+	u32 Version; /* XFSBL_DDR_CALIB_VERSION */
+	u8 SpdHash[XFSBL_DDR_CALIB_HASH_LEN]; /* SHA3 of the SPD data */
+	u32 LaneReg[XFSBL_DDR_CALIB_LANES][XFSBL_DDR_CALIB_LANE_REGS];
+		/* Trained registers of the DDR PHY byte lanes */
+	u8 Hash[XFSBL_DDR_CALIB_HASH_LEN]; /* SHA3 of the fields above */
+} XFsbl_DdrCalib;
+#endif
+
 u32 XFsbl_DdrInit(void);
+#ifdef XFSBL_DDR_PREFETCH
+u32 XFsbl_DdrTrainingWait(void);
+#endif
 
 #endif /* XPAR_DYNAMIC_DDR_ENABLED */
 #ifdef __cplusplus
@@ -21,6 +21,7 @@
 * 2.0   bv   12/05/16 Made compliance to MISRAC 2012 guidelines
 *       ssc  03/25/17 Set correct value for SYSMON ANALOG_BUS register
 *       sp   12/12/22 Remove DDR IO retention during boot
+*       fl   10/14/26 Added hooks to load and save the DDR calibration
 *
 * </pre>
 *
@@ -217,3 +218,62 @@ u32 XFsbl_HookGetPosBootType(void)
 	return WarmBoot;
 }
 #endif
+
+#ifdef XFSBL_DDR_CALIB_CACHE
+/*****************************************************************************/
+/**
+ * This is a hook function where user can load the DDR calibration saved by
+ * XFsbl_HookDdrCalibSave() in an earlier boot. FSBL then restores it in
+ * place of the DDR data training.
+ *
+ * FSBL checks that the calibration is intact and that it was saved for the
+ * DIMM in use. The storage must be trusted: the calibration must be kept
+ * where it can't be written outside of FSBL, or be authenticated here, for
+ * example with an AES-GCM tag using a device key.
+ *
+ * @param Buffer is where the saved calibration is to be copied
+ * @param Size is the size of the saved calibration in bytes
+ *
+ * @return XFSBL_SUCCESS if the calibration is loaded, XFSBL_FAILURE by
+ * default, to run the DDR data training
+ *
+ *****************************************************************************/
+u32 XFsbl_HookDdrCalibLoad(u8 *Buffer, u32 Size)
+{
+	u32 Status = XFSBL_FAILURE;
+
+	/**
+	 * Add the code here
+	 */
+	(void)Buffer;
+	(void)Size;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This is a hook function where user can save the DDR calibration of a
+ * completed DDR data training, to be loaded by XFsbl_HookDdrCalibLoad() in
+ * the next boots. The storage requirements of XFsbl_HookDdrCalibLoad()
+ * apply.
+ *
+ * @param Buffer is the calibration to save
+ * @param Size is the size of the calibration in bytes
+ *
+ * @return error status based on implemented functionality (SUCCESS by default)
+ *
+ *****************************************************************************/
+u32 XFsbl_HookDdrCalibSave(const u8 *Buffer, u32 Size)
+{
+	u32 Status = XFSBL_SUCCESS;
+
+	/**
+	 * Add the code here
+	 */
+	(void)Buffer;
+	(void)Size;
+
+	return Status;
+}
+#endif
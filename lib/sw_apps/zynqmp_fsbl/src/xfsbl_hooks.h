@@ -17,6 +17,7 @@
 * Ver   Who  Date        Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  kc   10/21/13 Initial release
+* 2.0   fl   10/14/26 Added hooks to load and save the DDR calibration
 *
 * </pre>
 *
@@ -55,6 +56,10 @@ u32 XFsbl_HookPsuInit(void);
 
 u32 XFsbl_HookGetPosBootType(void);
 
+u32 XFsbl_HookDdrCalibLoad(u8 *Buffer, u32 Size);
+
+u32 XFsbl_HookDdrCalibSave(const u8 *Buffer, u32 Size);
+
 #ifdef __cplusplus
 }
 #endif
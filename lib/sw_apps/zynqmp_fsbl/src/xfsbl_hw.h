@@ -30,6 +30,7 @@
 *                     present in design
 * 6.0   bsv  08/03/22 Fix ECC error count for R5 FSBL
 * 6.1   ng   07/13/23 Added SDT support
+* 6.2   fl   10/14/26 Added DDR prefetch and DDR calibration cache options
 *
 * </pre>
 *
@@ -929,6 +930,21 @@ extern "C" {
 #define XFSBL_PL_LOAD_FROM_OCM
 #endif
 
+/**
+ * Definitions for reading the boot device while DDR is trained and for
+ * reusing a saved DDR calibration. Both are possible only with the dynamic
+ * DDR initialization, where FSBL runs the DDR training sequence.
+ */
+#if (!defined(FSBL_DDR_PREFETCH_EXCLUDE) && defined(XFSBL_PS_DDR) && \
+	defined(XPAR_DYNAMIC_DDR_ENABLED))
+#define XFSBL_DDR_PREFETCH
+#endif
+
+#if (!defined(FSBL_DDR_CALIB_CACHE_EXCLUDE) && defined(XFSBL_PS_DDR) && \
+	defined(XPAR_DYNAMIC_DDR_ENABLED))
+#define XFSBL_DDR_CALIB_CACHE
+#endif
+
 #if (!defined(FSBL_USB_EXCLUDE) && defined(XPAR_XUSBPSU_0_BASEADDR) && (XPAR_XUSBPSU_0_BASEADDR == 0xFE200000) && defined(XFSBL_PS_DDR))
 #define XFSBL_USB
 #endif
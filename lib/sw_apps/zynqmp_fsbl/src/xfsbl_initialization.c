@@ -56,6 +56,7 @@
 * 9.0   bsv  10/15/21 Fixed bug to support secondary boot with non-zero
 *                     multiboot offset
 * 9.1   ng   07/13/23 Added SDT support
+* 9.2   fl   10/14/26 Read the boot device while DDR is trained
 *
 * </pre>
 *
@@ -100,6 +101,11 @@ static u32 XFsbl_EccInit(u64 DestAddr, u64 LengthBytes);
 static u32 XFsbl_TcmInit(XFsblPs * FsblInstancePtr);
 static void XFsbl_EnableProgToPL(void);
 static void XFsbl_ClearPendingInterrupts(void);
+#ifdef XFSBL_DDR_PREFETCH
+static u32 XFsbl_BootDevicePrefetch(XFsblPs * FsblInstancePtr);
+static u32 XFsbl_PrefetchCopy(u32 SrcAddress, PTRSIZE DestAddress,
+		u32 Length);
+#endif
 #ifdef XFSBL_TPM
 static u32 XFsbl_MeasureFsbl(u8* PartitionHash);
 #endif
@@ -154,6 +160,20 @@ extern u8 AuthBuffer[XFSBL_AUTH_BUFFER_SIZE];
 extern u32 Iv[XIH_BH_IV_LENGTH / 4U];
 #endif
 u32 SdCdnRegVal;
+
+#ifdef XFSBL_DDR_PREFETCH
+/* Status of the boot device initialization done while DDR is trained */
+static u32 BootDevPrefetched = FALSE;
+static u32 BootDevPrefetchStatus;
+
+/* Start of the first partition, read while DDR is trained */
+static u8 PrefetchBuffer[XFSBL_PREFETCH_BUFFER_SIZE]
+	__attribute__ ((aligned (64U)));
+static u32 PrefetchSrcAddress;
+static u32 PrefetchLength;
+static u32 (*PrefetchDeviceCopy) (u32 SrcAddress, PTRSIZE DestAddress,
+		u32 Length);
+#endif
 /****************************************************************************/
 /**
  * This function is used to save the data section into duplicate data section
@@ -348,6 +368,23 @@ u32 XFsbl_Initialize(XFsblPs * FsblInstancePtr)
 			goto END;
 		}
 
+#ifdef XFSBL_DDR_PREFETCH
+		/*
+		 * DDR PHY is running the data training. Read the boot device
+		 * into OCM meanwhile, then wait for DDR.
+		 */
+		Status = XFsbl_BootDevicePrefetch(FsblInstancePtr);
+		if (XFSBL_SUCCESS != Status) {
+			goto END;
+		}
+
+		Status = XFsbl_DdrTrainingWait();
+		if (XFSBL_SUCCESS != Status) {
+			XFsbl_Printf(DEBUG_GENERAL,"XFSBL_DDR_INIT_FAILED\n\r");
+			goto END;
+		}
+#endif
+
 #ifdef XFSBL_ENABLE_DDR_SR
 		/*
 		 * Read PMU register bit value that indicates DDR is in self
@@ -442,6 +479,15 @@ u32 XFsbl_BootDeviceInitAndValidate(XFsblPs * FsblInstancePtr)
 {
 	u32 Status;
 
+#ifdef XFSBL_DDR_PREFETCH
+	/* Done while DDR was trained, return its status */
+	if (BootDevPrefetched == TRUE) {
+		BootDevPrefetched = FALSE;
+		Status = BootDevPrefetchStatus;
+		goto END;
+	}
+#endif
+
 	/**
 	 * Configure the primary boot device
 	 */
@@ -476,6 +522,118 @@ END:
 	return Status;
 }
 
+#ifdef XFSBL_DDR_PREFETCH
+/*****************************************************************************/
+/**
+ * This function initializes the boot devices and reads the boot header,
+ * image header table and partition headers while DDR is trained, as they
+ * are read into OCM. The start of the first partition is then read into
+ * PrefetchBuffer, and XFsbl_PrefetchCopy() replaces the copy function of the
+ * boot device to use it.
+ *
+ * Errors of the boot device are returned to stage 2 by
+ * XFsbl_BootDeviceInitAndValidate(), as without prefetch.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ *
+ * @return	returns XFSBL_SUCCESS
+ *
+ ******************************************************************************/
+static u32 XFsbl_BootDevicePrefetch(XFsblPs * FsblInstancePtr)
+{
+	u32 Status;
+	u32 BootMode;
+	u32 Length;
+	const XFsblPs_PartitionHeader *PartitionHeader;
+
+	/* USB boot mode downloads boot.bin to DDR, it is read in stage 2 */
+	BootMode = XFsbl_In32(CRL_APB_BOOT_MODE_USER) &
+			CRL_APB_BOOT_MODE_USER_BOOT_MODE_MASK;
+	if (BootMode == XFSBL_USB_BOOT_MODE) {
+		Status = XFSBL_SUCCESS;
+		goto END;
+	}
+
+	BootDevPrefetchStatus = XFsbl_BootDeviceInitAndValidate(FsblInstancePtr);
+	BootDevPrefetched = TRUE;
+	Status = XFSBL_SUCCESS;
+	if ((XFSBL_SUCCESS != BootDevPrefetchStatus) ||
+		(FsblInstancePtr->ImageHeader.ImageHeaderTable.NoOfPartitions
+			<= 1U)) {
+		goto END;
+	}
+
+	/* Partition 0 is FSBL, partition loading starts from 1 */
+	PartitionHeader = &FsblInstancePtr->ImageHeader.PartitionHeader[1U];
+	PrefetchSrcAddress = FsblInstancePtr->ImageOffsetAddress +
+		(PartitionHeader->DataWordOffset * XIH_PARTITION_WORD_LENGTH);
+	Length = PartitionHeader->TotalDataWordLength *
+		XIH_PARTITION_WORD_LENGTH;
+	if (Length > XFSBL_PREFETCH_BUFFER_SIZE) {
+		Length = XFSBL_PREFETCH_BUFFER_SIZE;
+	}
+
+	PrefetchDeviceCopy = FsblInstancePtr->DeviceOps.DeviceCopy;
+	if (PrefetchDeviceCopy(PrefetchSrcAddress, (PTRSIZE)PrefetchBuffer,
+			Length) != XFSBL_SUCCESS) {
+		/* Not fatal, the partition is read from the boot device */
+		goto END;
+	}
+
+	PrefetchLength = Length;
+	FsblInstancePtr->DeviceOps.DeviceCopy = XFsbl_PrefetchCopy;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function is the copy function of the boot device once the start of
+ * the first partition is prefetched. The prefetched bytes are copied from
+ * PrefetchBuffer, the others are read from the boot device.
+ *
+ * @param	SrcAddress is the address in the boot device
+ * @param	DestAddress is the address of the destination
+ * @param	Length is the number of bytes to copy
+ *
+ * @return	returns the error codes of the boot device copy function
+ * 		returns XFSBL_SUCCESS on success
+ *
+ ******************************************************************************/
+static u32 XFsbl_PrefetchCopy(u32 SrcAddress, PTRSIZE DestAddress,
+		u32 Length)
+{
+	u32 Status = XFSBL_SUCCESS;
+	u32 Offset;
+	u32 Size;
+
+	if ((SrcAddress >= PrefetchSrcAddress) &&
+		(SrcAddress < (PrefetchSrcAddress + PrefetchLength))) {
+		Offset = SrcAddress - PrefetchSrcAddress;
+		Size = PrefetchLength - Offset;
+		if (Size > Length) {
+			Size = Length;
+		}
+
+		(void)XFsbl_MemCpy((void *)DestAddress, &PrefetchBuffer[Offset],
+				Size);
+		/* Partitions are read by DMA, make the copy visible to DMA */
+		Xil_DCacheFlushRange((INTPTR)DestAddress, Size);
+
+		SrcAddress += Size;
+		DestAddress += Size;
+		Length -= Size;
+	}
+
+	if (Length != 0U) {
+		Status = PrefetchDeviceCopy(SrcAddress, DestAddress, Length);
+	}
+
+	return Status;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * This function enables the propagation of the PROG signal to PL after
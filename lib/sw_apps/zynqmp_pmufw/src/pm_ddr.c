@@ -160,6 +160,7 @@
 #define DDRPHY_DX8SLDXCTL2(n)	(DDRPHY_BASE + 0x142cU + (0x40U * (n)))
 #define DDRPHY_DX8SLIOCR(n)	(DDRPHY_BASE + 0x1430U + (0x40U * (n)))
 #define DDRPHY_DX8SLBOSC	(DDRPHY_BASE + 0x17c0U)
+#define DDRPHY_DX(n)		(DDRPHY_BASE + 0X700U + (0x100U * (n)))
 
 #define DDRPHY_PIR_INIT			BIT(0U)
 #define DDRPHY_PIR_ZCAL			BIT(1U)
@@ -288,6 +289,8 @@
 #define DDRPHY_RANK1_WRITE		BIT(1U)
 #define DDRPHY_RANK0_READ		BIT(16U)
 #define DDRPHY_RANK1_READ		BIT(17U)
+#define DDRPHY_RANKWID_SHIFT		0U
+#define DDRPHY_RANKRID_SHIFT		16U
 
 #define DDRQOS_BASE		0xFD090000U
 #define DDRQOS_DDR_CLK_CTRL	(DDRQOS_BASE + 0x700U)
@@ -306,6 +309,16 @@
 			PmErr("@line %d\r\n", __LINE__); \
 		}
 
+#ifdef ENABLE_DDR_FAST_RESUME
+#define DDR_FAST_RESUME_EN	true
+
+/* Byte lanes and ranks whose trained delays are kept over self-refresh */
+#define DDR_TRAIN_LANES		9U
+#define DDR_TRAIN_RANKS		2U
+#else
+#define DDR_FAST_RESUME_EN	false
+#endif
+
 /* Power states of DDR */
 #define PM_DDR_STATE_OFF	0U
 #define PM_DDR_STATE_SR		1U
@@ -660,6 +673,38 @@ static PmRegisterContext ctx_ddrphy_zqdata[] __attribute__((__section__(".srdata
 	{ },
 };
 
+#ifdef ENABLE_DDR_FAST_RESUME
+/*
+ * Trained delays within a DATX8 lane: LCDLR0-5 and GTR0 are selected by the
+ * rank ID, the bit delay lines BDLR0-6 are common to all ranks.
+ */
+static const u32 ddr_train_rank_regs[] = {
+	0x80U, 0x84U, 0x88U, 0x8CU, 0x90U, 0x94U, 0xC0U,
+};
+
+static const u32 ddr_train_regs[] = {
+	0x40U, 0x44U, 0x48U, 0x50U, 0x54U, 0x58U, 0x60U,
+};
+
+static u32 ctx_ddrphy_train_rank[DDR_TRAIN_RANKS][DDR_TRAIN_LANES]
+	[ARRAY_SIZE(ddr_train_rank_regs)] __attribute__((__section__(".srdata")));
+static u32 ctx_ddrphy_train[DDR_TRAIN_LANES][ARRAY_SIZE(ddr_train_regs)]
+	__attribute__((__section__(".srdata")));
+
+/* Trained delays are stored, resume restores them instead of training */
+static u8 ddr_fast_resume __attribute__((__section__(".srdata")));
+
+/* PMU clock ticks taken by each step of the last resume, counted by PIT3 */
+static struct {
+	u32 ctx_restore;
+	u32 phy_init;
+	u32 sr_exit;
+	u32 training;
+	u32 data_restore;
+	u32 last;
+} ddr_resume_ticks;
+#endif
+
 static void ddr_disable_wr_drift(void)
 {
 	u32 r;
@@ -996,6 +1041,98 @@ static void restore_ddrphy_odtcr(PmRegisterContext *context)
 	}
 }
 
+#ifdef ENABLE_DDR_FAST_RESUME
+static u32 ddr_train_ranks(void)
+{
+	u32 rank = Xil_In32(DDRC_MSTR) & DDRC_DUAL_RANK_MASK;
+
+	return (DDRC_DUAL_RANK_MASK == rank) ? DDR_TRAIN_RANKS : 1U;
+}
+
+static void store_trained_delays(void)
+{
+	u32 rank, lane, i;
+
+	for (rank = 0U; rank < ddr_train_ranks(); rank++) {
+		XPfw_RMW32(DDRPHY_RANKIDR, DDRPHY_RANKRID_MASK,
+			   rank << DDRPHY_RANKRID_SHIFT);
+		for (lane = 0U; lane < DDR_TRAIN_LANES; lane++) {
+			for (i = 0U; i < ARRAY_SIZE(ddr_train_rank_regs); i++) {
+				ctx_ddrphy_train_rank[rank][lane][i] =
+					Xil_In32(DDRPHY_DX(lane) +
+						 ddr_train_rank_regs[i]);
+			}
+		}
+	}
+	XPfw_RMW32(DDRPHY_RANKIDR, DDRPHY_RANKRID_MASK, 0U);
+
+	for (lane = 0U; lane < DDR_TRAIN_LANES; lane++) {
+		for (i = 0U; i < ARRAY_SIZE(ddr_train_regs); i++) {
+			ctx_ddrphy_train[lane][i] =
+				Xil_In32(DDRPHY_DX(lane) + ddr_train_regs[i]);
+		}
+	}
+}
+
+static void restore_trained_delays(void)
+{
+	u32 rank, lane, i;
+
+	for (rank = 0U; rank < ddr_train_ranks(); rank++) {
+		XPfw_RMW32(DDRPHY_RANKIDR, DDRPHY_RANKWID_MASK,
+			   rank << DDRPHY_RANKWID_SHIFT);
+		for (lane = 0U; lane < DDR_TRAIN_LANES; lane++) {
+			for (i = 0U; i < ARRAY_SIZE(ddr_train_rank_regs); i++) {
+				Xil_Out32(DDRPHY_DX(lane) +
+					  ddr_train_rank_regs[i],
+					  ctx_ddrphy_train_rank[rank][lane][i]);
+			}
+		}
+	}
+	XPfw_RMW32(DDRPHY_RANKIDR, DDRPHY_RANKWID_MASK, 0U);
+
+	for (lane = 0U; lane < DDR_TRAIN_LANES; lane++) {
+		for (i = 0U; i < ARRAY_SIZE(ddr_train_regs); i++) {
+			Xil_Out32(DDRPHY_DX(lane) + ddr_train_regs[i],
+				  ctx_ddrphy_train[lane][i]);
+		}
+	}
+}
+
+static void ddr_resume_timer_start(void)
+{
+	/* PIT3 is free running from its maximum, counting down */
+	Xil_Out32(PMU_IOMODULE_PIT3_CONTROL, 0U);
+	Xil_Out32(PMU_IOMODULE_PIT3_PRELOAD,
+		  PMU_IOMODULE_PIT3_PRELOAD_PIT3_PRELOAD_MASK);
+	Xil_Out32(PMU_IOMODULE_PIT3_CONTROL, PMU_IOMODULE_PIT3_CONTROL_EN_MASK |
+		  PMU_IOMODULE_PIT3_CONTROL_PRELOAD_MASK);
+	ddr_resume_ticks.last = Xil_In32(PMU_IOMODULE_PIT3_COUNTER);
+}
+
+static void ddr_resume_mark(u32 *ticks)
+{
+	u32 now = Xil_In32(PMU_IOMODULE_PIT3_COUNTER);
+
+	*ticks = ddr_resume_ticks.last - now;
+	ddr_resume_ticks.last = now;
+}
+
+static void ddr_resume_report(void)
+{
+	PmInfo("DDR resume (%s) ticks: ctx %lu, phy %lu, sr exit %lu, "
+	       "training %lu, data %lu\r\n",
+	       (0U != ddr_fast_resume) ? "fast" : "full",
+	       ddr_resume_ticks.ctx_restore, ddr_resume_ticks.phy_init,
+	       ddr_resume_ticks.sr_exit, ddr_resume_ticks.training,
+	       ddr_resume_ticks.data_restore);
+}
+#else
+#define ddr_resume_timer_start()
+#define ddr_resume_mark(ticks)
+#define ddr_resume_report()
+#endif
+
 static void ddr_io_retention_set(bool en)
 {
 	u32 r = Xil_In32(PMU_GLOBAL_DDR_CNTRL);
@@ -1129,6 +1266,30 @@ static void ddr_power_down_io(void)
 	}
 }
 
+static void ddr_retrain_eyes(void)
+{
+	XStatus status;
+
+	Xil_Out32(DDRPHY_PIR, DDRPHY_PIR_WREYE |
+			      DDRPHY_PIR_RDEYE |
+			      DDRPHY_PIR_WRDSKW |
+			      DDRPHY_PIR_RDDSKW);
+	Xil_Out32(DDRPHY_PIR, DDRPHY_PIR_WREYE |
+			      DDRPHY_PIR_RDEYE |
+			      DDRPHY_PIR_WRDSKW |
+			      DDRPHY_PIR_RDDSKW |
+			      DDRPHY_PIR_INIT);
+	status = XPfw_UtilPollForMask(DDRPHY_PGSR(0U),
+				      DDRPHY_PGSR0_IDONE,
+				      PM_DDR_POLL_PERIOD);
+	REPORT_IF_ERROR(status);
+
+	status = XPfw_UtilPollForZero(DDRPHY_PGSR(0U),
+				      DDRPHY_PGSR0_TRAIN_ERRS,
+				      PM_DDR_POLL_PERIOD);
+	REPORT_IF_ERROR(status);
+}
+
 static void DDR_reinit(bool ddrss_is_reset)
 {
 	size_t i;
@@ -1285,6 +1446,7 @@ static void DDR_reinit(bool ddrss_is_reset)
 		Xil_Out32(DDRC_DFIMISC, DDRC_DFIMISC_DFI_INIT_COMP_EN);
 		Xil_Out32(DDRC_SWCTL, DDRC_SWCTL_SW_DONE);
 	}
+	ddr_resume_mark(&ddr_resume_ticks.phy_init);
 
 	Xil_Out32(DDRC_PWRCTL, 0U);
 	do {
@@ -1297,9 +1459,16 @@ static void DDR_reinit(bool ddrss_is_reset)
 		readVal &= DDRC_STAT_OPMODE_MASK;
 		readVal >>= DDRC_STAT_OPMODE_SHIFT;
 	} while (readVal != DDRC_STAT_OPMODE_NORMAL);
+	ddr_resume_mark(&ddr_resume_ticks.sr_exit);
 
 	if (true == ddrss_is_reset) {
 		readVal = Xil_In32(DDRC_MSTR) & DDRC_MSTR_DDR_TYPE;
+#ifdef ENABLE_DDR_FAST_RESUME
+		if (0U != ddr_fast_resume) {
+			/* Write back the delays trained before self-refresh */
+			restore_trained_delays();
+		} else
+#endif
 		if (readVal == DDRC_MSTR_LPDDR3 ) {
 			Xil_Out32(DDRPHY_PIR, DDRPHY_PIR_CTLDINIT |
 					      DDRPHY_PIR_WREYE |
@@ -1450,24 +1619,14 @@ static void DDR_reinit(bool ddrss_is_reset)
 		readVal &= ~DDRC_ZQCTL0_ZQ_DIS;
 		Xil_Out32(DDRC_ZQCTL(0U), readVal);
 	} else {
-		Xil_Out32(DDRPHY_PIR, DDRPHY_PIR_WREYE |
-				      DDRPHY_PIR_RDEYE |
-				      DDRPHY_PIR_WRDSKW |
-				      DDRPHY_PIR_RDDSKW);
-		Xil_Out32(DDRPHY_PIR, DDRPHY_PIR_WREYE |
-				      DDRPHY_PIR_RDEYE |
-				      DDRPHY_PIR_WRDSKW |
-				      DDRPHY_PIR_RDDSKW |
-					  DDRPHY_PIR_INIT);
-		status = XPfw_UtilPollForMask(DDRPHY_PGSR(0U),
-					      DDRPHY_PGSR0_IDONE,
-					      PM_DDR_POLL_PERIOD);
-		REPORT_IF_ERROR(status);
-
-		status = XPfw_UtilPollForZero(DDRPHY_PGSR(0U),
-					      DDRPHY_PGSR0_TRAIN_ERRS,
-					      PM_DDR_POLL_PERIOD);
-		REPORT_IF_ERROR(status);
+#ifdef ENABLE_DDR_FAST_RESUME
+		/* The PHY kept its delays, the eyes need no retraining */
+		if (0U == ddr_fast_resume) {
+			ddr_retrain_eyes();
+		}
+#else
+		ddr_retrain_eyes();
+#endif
 
 		/* enable AXI ports */
 		for (i = 0U; i < 6U; i++) {
@@ -1479,6 +1638,7 @@ static void DDR_reinit(bool ddrss_is_reset)
 			Xil_Out32(DDRC_PCTRL(i), readVal);
 		}
 	}
+	ddr_resume_mark(&ddr_resume_ticks.training);
 	ddr_enable_drift();
 }
 
@@ -1742,11 +1902,22 @@ static void restore_training_data(void)
 #endif
 }
 
-static s32 pm_ddr_sr_enter(void)
+static s32 pm_ddr_sr_enter(bool fast_resume)
 {
 	s32 ret;
 
+#ifdef ENABLE_DDR_FAST_RESUME
+	/* Without training on resume the training area keeps its data */
+	ddr_fast_resume = (true == fast_resume) ? 1U : 0U;
+	if (0U == ddr_fast_resume) {
+		ret = store_training_data();
+	} else {
+		ret = XST_SUCCESS;
+	}
+#else
+	(void)fast_resume;
 	ret = store_training_data();
+#endif
 	if (XST_SUCCESS != ret) {
 		goto err;
 	}
@@ -1764,6 +1935,12 @@ static s32 pm_ddr_sr_enter(void)
 	store_state(ctx_ddrphy);
 	store_state(ctx_ddrphy_zqdata);
 	store_ddrphy_odtcr(ctx_ddrphy_odtcr);
+#ifdef ENABLE_DDR_FAST_RESUME
+	if (0U != ddr_fast_resume) {
+		/* Drift compensation is off, the delays stay as stored */
+		store_trained_delays();
+	}
+#endif
 
 	ret = ddrc_enable_sr();
 	if (XST_SUCCESS != ret) {
@@ -1784,6 +1961,8 @@ err:
 
 static void pm_ddr_sr_exit(bool ddrss_is_reset)
 {
+	ddr_resume_timer_start();
+
 	if (true == ddrss_is_reset) {
 		u32 readVal;
 
@@ -1799,10 +1978,19 @@ static void pm_ddr_sr_exit(bool ddrss_is_reset)
 
 		restore_state(ctx_ddrphy);
 	}
+	ddr_resume_mark(&ddr_resume_ticks.ctx_restore);
 
 	DDR_reinit(ddrss_is_reset);
 
+#ifdef ENABLE_DDR_FAST_RESUME
+	if (0U == ddr_fast_resume) {
+		restore_training_data();
+	}
+#else
 	restore_training_data();
+#endif
+	ddr_resume_mark(&ddr_resume_ticks.data_restore);
+	ddr_resume_report();
 
 #ifdef ENABLE_DDR_SR_WR
 	/* Clear self refresh mode indication flag */
@@ -1826,7 +2014,8 @@ s32 PmDdrEnterSr(void)
 	}
 
 	XPfw_AibEnable(XPFW_AIB_LPD_TO_DDR);
-	status = pm_ddr_sr_enter();
+	/* Resume after a warm restart always takes the full training path */
+	status = pm_ddr_sr_enter(false);
 	if (XST_SUCCESS != status) {
 		goto err;
 	}
@@ -1901,7 +2090,7 @@ static s32 PmDdrFsmHandler(PmSlave* const slave, const PmStateId nextState)
 	case PM_DDR_STATE_ON:
 		if (PM_DDR_STATE_SR == nextState) {
 			XPfw_AibEnable(XPFW_AIB_LPD_TO_DDR);
-			status = pm_ddr_sr_enter();
+			status = pm_ddr_sr_enter(DDR_FAST_RESUME_EN);
 		} else {
 			status = XST_NO_FEATURE;
 		}
@@ -98,6 +98,9 @@ extern "C" {
  * 	               macro is also defined
  *	- ENABLE_POS : Enables Power Off Suspend feature
  *	- ENABLE_DDR_SR_WR : Enables DDR self refresh over warm restart feature
+ *	- ENABLE_DDR_FAST_RESUME : Keeps the trained DDR PHY delays over DDR
+ *				   self refresh and writes them back on resume
+ *				   instead of training again
  *	- ENABLE_UNUSED_RPU_PWR_DWN : Enables unused RPU power down feature
  *	- DISABLE_CLK_PERMS : Disable clock permission checking (it is not safe
  *			to ever disable clock permission checking). Do this at
@@ -120,6 +123,8 @@ extern "C" {
  * 	- EXT_RESET_MIO_PIN_STATE_VAL : Board external reset MIO pin active state (0-1)
  *	- ENABLE_DYNAMIC_MIO_CONFIG: Enables IOCTL support for configuring MIO
  *				     regiisters
+ *	- ENABLE_DEADLINE_SCHEDULER: Arms the scheduler PIT for the nearest task
+ *				     deadline instead of a fixed 10ms tick
  */
 #ifndef ENABLE_PM_VAL
 #define	ENABLE_PM_VAL						(1U)
@@ -221,6 +226,10 @@ extern "C" {
 #define	ENABLE_DDR_SR_WR_VAL				(0U)
 #endif
 
+#ifndef ENABLE_DDR_FAST_RESUME_VAL
+#define ENABLE_DDR_FAST_RESUME_VAL			(0U)
+#endif
+
 #ifndef DISABLE_CLK_PERMS_VAL
 #define DISABLE_CLK_PERMS_VAL				(0U)
 #endif
@@ -293,6 +302,10 @@ extern "C" {
 #define ENABLE_SMMU_VAL					(0U)
 #endif
 
+#ifndef ENABLE_DEADLINE_SCHEDULER_VAL
+#define ENABLE_DEADLINE_SCHEDULER_VAL			(0U)
+#endif
+
 /*
  * XPFW_CFG_PMU_DEFAULT_WDT_TIMEOUT
  * 		Default watchdog timeout
@@ -601,6 +614,14 @@ extern "C" {
 #define ENABLE_SMMU
 #endif
 
+#if (ENABLE_DEADLINE_SCHEDULER_VAL) && (!defined(ENABLE_DEADLINE_SCHEDULER))
+#define ENABLE_DEADLINE_SCHEDULER
+#endif
+
+#if (ENABLE_DDR_FAST_RESUME_VAL) && (!defined(ENABLE_DDR_FAST_RESUME))
+#define ENABLE_DDR_FAST_RESUME
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,85 @@
 #define PIT_COUNTER_OFFSET	4U
 #define PIT_CONTROL_OFFSET	8U
 
+#ifdef ENABLE_DEADLINE_SCHEDULER
+/* PIT control value to run once without reload */
+#define PIT_CONTROL_ONE_SHOT	1U
+/* MSR interrupt enable bit */
+#define MSR_IE_MASK		0x2U
+
+/**
+ * Trigger the tasks whose deadline is reached after advancing the scheduler
+ * time by the given number of ticks and arm the PIT for the nearest
+ * deadline of the remaining tasks. Must be called with interrupts disabled.
+ */
+static void XPfw_SchedulerAdvance(XPfw_Scheduler_t *SchedPtr, u32 Ticks)
+{
+	u32 Idx;
+	u32 Delta;
+	u32 NextDelta = 0U;
+	u32 MaxTicks = 0xFFFFFFFFU / SchedPtr->CountPerTick;
+	struct XPfw_Task_t *TaskPtr;
+
+	SchedPtr->Tick += Ticks;
+	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
+		TaskPtr = &SchedPtr->TaskList[Idx];
+		if (NULL == TaskPtr->Callback) {
+			continue;
+		}
+		/* Deadlines are compared as signed to handle the Tick wrap */
+		if ((s32)(SchedPtr->Tick - TaskPtr->Deadline) >= 0) {
+			TaskPtr->Status = XPFW_TASK_STATUS_TRIGGERED;
+			if (0U == TaskPtr->Interval) {
+				/* Non-Periodic task is removed once processed */
+				continue;
+			}
+			TaskPtr->Deadline += TaskPtr->Interval;
+			if ((s32)(SchedPtr->Tick - TaskPtr->Deadline) >= 0) {
+				/* Missed periods are not replayed */
+				TaskPtr->Deadline = SchedPtr->Tick + TaskPtr->Interval;
+			}
+		}
+		Delta = TaskPtr->Deadline - SchedPtr->Tick;
+		if ((0U == NextDelta) || (Delta < NextDelta)) {
+			NextDelta = Delta;
+		}
+	}
+
+	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U);
+	if (NextDelta > MaxTicks) {
+		NextDelta = MaxTicks;
+	}
+	SchedPtr->ArmedTicks = NextDelta;
+	if (0U != NextDelta) {
+		XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET,
+				NextDelta * SchedPtr->CountPerTick);
+		XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET,
+				PIT_CONTROL_ONE_SHOT);
+	}
+}
+
+/**
+ * Ticks elapsed since the PIT was armed, used when a task is added between
+ * two deadlines. The pending PIT interrupt is dropped as the caller advances
+ * the scheduler time. Must be called with interrupts disabled.
+ */
+static u32 XPfw_SchedulerElapsedTicks(const XPfw_Scheduler_t *SchedPtr)
+{
+	u32 Elapsed = SchedPtr->ArmedTicks;
+	u32 Count;
+
+	if ((0U != SchedPtr->ArmedTicks) &&
+		((XPfw_Read32(PMU_IOMODULE_IRQ_PENDING) &
+			PMU_IOMODULE_IRQ_PENDING_PIT1_MASK) == 0U)) {
+		Count = XPfw_Read32(SchedPtr->PitBaseAddr + PIT_COUNTER_OFFSET);
+		Elapsed = ((SchedPtr->ArmedTicks * SchedPtr->CountPerTick) -
+				Count) / SchedPtr->CountPerTick;
+	}
+	XPfw_Write32(PMU_IOMODULE_IRQ_ACK, PMU_IOMODULE_IRQ_ACK_PIT1_MASK);
+
+	return Elapsed;
+}
+#else
 static u32 is_task_active(XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
 {
 	u32 ReturnVal;
@@ -42,6 +121,7 @@ static u32 is_task_active(XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
 
 	return ReturnVal;
 }
+#endif
 
 static u32 is_task_non_periodic(XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
 {
@@ -77,6 +157,12 @@ XStatus XPfw_SchedulerInit(XPfw_Scheduler_t *SchedPtr, u32 PitBaseAddr)
 	SchedPtr->Enabled = (u32)FALSE;
 	SchedPtr->PitBaseAddr = PitBaseAddr;
 	SchedPtr->Tick = 0U;
+#ifdef ENABLE_DEADLINE_SCHEDULER
+	SchedPtr->ArmedTicks = 0U;
+#ifndef SDT
+	SchedPtr->CountPerTick = COUNT_PER_TICK;
+#endif
+#endif
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U);
 
 	/* Successfully completed init */
@@ -101,6 +187,12 @@ XStatus XPfw_SchedulerStart(XPfw_Scheduler_t *SchedPtr)
 
 	SchedPtr->Enabled = (u32)TRUE;
 
+#ifdef ENABLE_DEADLINE_SCHEDULER
+#ifdef SDT
+	SchedPtr->CountPerTick = CountPerTick;
+#endif
+	XPfw_SchedulerAdvance(SchedPtr, 0U);
+#else
 #ifndef SDT
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET,
 			COUNT_PER_TICK);
@@ -109,6 +201,7 @@ XStatus XPfw_SchedulerStart(XPfw_Scheduler_t *SchedPtr)
 			CountPerTick);
 #endif
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 3U);
+#endif
 	Status = XST_SUCCESS;
 
 done:
@@ -118,6 +211,9 @@ done:
 XStatus XPfw_SchedulerStop(XPfw_Scheduler_t *SchedPtr)
 {
 	SchedPtr->Enabled = (u32)FALSE;
+#ifdef ENABLE_DEADLINE_SCHEDULER
+	SchedPtr->ArmedTicks = 0U;
+#endif
 
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET, 0U );
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U );
@@ -127,6 +223,14 @@ XStatus XPfw_SchedulerStop(XPfw_Scheduler_t *SchedPtr)
 
 void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr)
 {
+#ifdef ENABLE_DEADLINE_SCHEDULER
+	/* Ignore the interrupt if a task add has already handled it */
+	if (((u32)TRUE == SchedPtr->Enabled) &&
+		((XPfw_Read32(PMU_IOMODULE_IRQ_PENDING) &
+			PMU_IOMODULE_IRQ_PENDING_PIT1_MASK) != 0U)) {
+		XPfw_SchedulerAdvance(SchedPtr, SchedPtr->ArmedTicks);
+	}
+#else
 	u32 Idx;
 
 	SchedPtr->Tick++;
@@ -137,6 +241,7 @@ void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr)
 			SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_TRIGGERED;
 		}
 	}
+#endif
 }
 
 void XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
@@ -165,6 +270,12 @@ XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliS
 {
 	u32 Idx;
 	XStatus Status;
+#ifdef ENABLE_DEADLINE_SCHEDULER
+	u32 Elapsed = 0U;
+	u32 Msr = mfmsr();
+
+	microblaze_disable_interrupts();
+#endif
 
 	/* Get the Next Free Task Index */
 	for (Idx=0U;Idx < XPFW_SCHED_MAX_TASK;Idx++) {
@@ -183,9 +294,26 @@ XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliS
 	SchedPtr->TaskList[Idx].Interval = MilliSeconds/TICK_MILLISECONDS;
 	SchedPtr->TaskList[Idx].OwnerId = OwnerId;
 	SchedPtr->TaskList[Idx].Callback = CallbackFn;
+#ifdef ENABLE_DEADLINE_SCHEDULER
+	if ((u32)TRUE == SchedPtr->Enabled) {
+		Elapsed = XPfw_SchedulerElapsedTicks(SchedPtr);
+	}
+	/* Non-Periodic task runs on the next tick */
+	SchedPtr->TaskList[Idx].Deadline = SchedPtr->Tick + Elapsed +
+		((0U != SchedPtr->TaskList[Idx].Interval) ?
+			SchedPtr->TaskList[Idx].Interval : 1U);
+	if ((u32)TRUE == SchedPtr->Enabled) {
+		XPfw_SchedulerAdvance(SchedPtr, Elapsed);
+	}
+#endif
 	Status = XST_SUCCESS;
 
 done:
+#ifdef ENABLE_DEADLINE_SCHEDULER
+	if ((Msr & MSR_IE_MASK) != 0U) {
+		microblaze_enable_interrupts();
+	}
+#endif
 	return Status;
 }
 
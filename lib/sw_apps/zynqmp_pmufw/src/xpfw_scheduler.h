@@ -26,6 +26,9 @@ struct XPfw_Task_t{
 	u32 OwnerId;
 	u32 Status;
 	XPfw_Callback_t Callback;
+#ifdef ENABLE_DEADLINE_SCHEDULER
+	u32 Deadline;
+#endif
 };
 
 typedef struct {
@@ -33,6 +36,10 @@ typedef struct {
 	u32 PitBaseAddr;
 	u32 Tick;
 	u32 Enabled;
+#ifdef ENABLE_DEADLINE_SCHEDULER
+	u32 ArmedTicks;
+	u32 CountPerTick;
+#endif
 } XPfw_Scheduler_t ;
 
 void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr);
@@ -20,6 +20,7 @@
 * ----- ---- ---------- -------------------------------------------------------
 * 1.0   har  01/09/2023 Initial release
 * 1.1   am   08/18/2023 Renamed error codes which starts with XOCP with XCERT
+* 1.2   fl   10/14/2026 Reuse the last certificate generated for the same inputs
 *
 * </pre>
 * @note
@@ -73,6 +74,8 @@ static const u8 Oid_Sha3_384[]		= {0x06U, 0x09U, 0x60U, 0x86U, 0x48U, 0x01U, 0x6
 			/**< Mask to get lower nibble */
 #define XCERT_SIGN_AVAILABLE				(0x3U)
 			/**< Signature available in SignStore */
+#define XCERT_CERT_AVAILABLE				(0x3U)
+			/**< Certificate available in CertCache */
 #define XCERT_BYTE_MASK					(0xFFU)
 			/**< Mask to get byte */
 #define XCERT_MAX_CERT_SUPPORT				(4U)
@@ -143,6 +146,10 @@ static int XCert_GenPubKeyAlgIdentifierField(u8* TBSCertBuf, u32 *Len);
 static int XCert_GenPublicKeyInfoField(u8* TBSCertBuf, u8* SubjectPublicKey,u32 *PubKeyInfoLen);
 static int XCert_GenSignField(u8* X509CertBuf, u8* Signature, u32 *SignLen);
 static int XCert_GetSignStored(u32 SubsystemId, XCert_SignStore **SignStore);
+static int XCert_GetCertCache(u32 SubsystemId, XCert_CertCache **CertCache);
+static int XCert_IsCertCacheValid(const XCert_CertCache *CertCache, const XCert_Config *Cfg);
+static int XCert_UpdateCertCache(XCert_CertCache *CertCache, const XCert_Config *Cfg,
+	const u8 *Cert, u32 CertSize);
 #endif
 static int XCert_GenTBSCertificate(u8* TBSCertBuf, XCert_Config* Cfg, u32 *TBSCertLen);
 static void XCert_CopyCertificate(const u32 Size, const u8 *Src, const u64 DstAddr);
@@ -334,6 +341,144 @@ static int XCert_GetSignStored(u32 SubsystemId, XCert_SignStore **SignStore)
 		}
 	}
 
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function finds the provided Subsystem ID in InfoStore DB and
+ *		returns the pointer to the corresponding certificate cache entry.
+ *
+ * @param	SubsystemId - SubsystemId for which certificate cache is requested
+ * @param	CertCache - Pointer to the entry in DB for the provided Subsystem ID
+ *
+ * @return
+ *		 - XST_SUCCESS  If subsystem ID is found
+ *		 - Error Code  Upon any failure
+ *
+ ******************************************************************************/
+static int XCert_GetCertCache(u32 SubsystemId, XCert_CertCache **CertCache)
+{
+	int Status = XST_FAILURE;
+	XCert_InfoStore *CertDB = XCert_GetCertDB();
+	u32 *NumOfEntriesInCertDB = XCert_GetNumOfEntriesInUserCfgDB();
+	u32 Idx;
+
+	for (Idx = 0; Idx < *NumOfEntriesInCertDB; Idx++) {
+		if (CertDB[Idx].SubsystemId == SubsystemId) {
+			*CertCache = &CertDB[Idx].CertCache;
+			Status = XST_SUCCESS;
+			goto END;
+		}
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the cached certificate was generated for
+ *		the same application configuration. The user configuration is
+ *		covered as updating it drops the cached certificate.
+ *
+ * @param	CertCache - Pointer to the certificate cache entry
+ * @param	Cfg - Configuration of the requested certificate
+ *
+ * @return
+ *		 - XST_SUCCESS  If the cached certificate can be reused
+ *		 - XST_FAILURE  If the certificate needs to be generated
+ *
+ ******************************************************************************/
+static int XCert_IsCertCacheValid(const XCert_CertCache *CertCache, const XCert_Config *Cfg)
+{
+	int Status = XST_FAILURE;
+
+	if ((CertCache->IsCertAvailable != XCERT_CERT_AVAILABLE) ||
+		(CertCache->IsSelfSigned != Cfg->AppCfg.IsSelfSigned) ||
+		(CertCache->IsCsr != Cfg->AppCfg.IsCsr)) {
+		goto END;
+	}
+
+	Status = Xil_SMemCmp(CertCache->SubjectPublicKey, sizeof(CertCache->SubjectPublicKey),
+		Cfg->AppCfg.SubjectPublicKey, XCERT_ECC_P384_PUBLIC_KEY_LEN,
+		XCERT_ECC_P384_PUBLIC_KEY_LEN);
+	if ((Status != XST_SUCCESS) || (Cfg->AppCfg.IsCsr == TRUE)) {
+		goto END;
+	}
+
+	/**
+	 * Issuer public key and firmware hash are only part of the certificate
+	 */
+	Status = Xil_SMemCmp(CertCache->IssuerPublicKey, sizeof(CertCache->IssuerPublicKey),
+		Cfg->AppCfg.IssuerPublicKey, XCERT_ECC_P384_PUBLIC_KEY_LEN,
+		XCERT_ECC_P384_PUBLIC_KEY_LEN);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = Xil_SMemCmp(CertCache->FwHash, sizeof(CertCache->FwHash),
+		Cfg->AppCfg.FwHash, XCERT_HASH_SIZE_IN_BYTES, XCERT_HASH_SIZE_IN_BYTES);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stores the generated certificate and the
+ *		application configuration it was generated for.
+ *
+ * @param	CertCache - Pointer to the certificate cache entry
+ * @param	Cfg - Configuration of the generated certificate
+ * @param	Cert - Pointer to the DER encoded certificate
+ * @param	CertSize - Length of the DER encoded certificate
+ *
+ * @return
+ *		 - XST_SUCCESS  If the certificate is cached
+ *		 - XST_FAILURE  Upon any failure
+ *
+ ******************************************************************************/
+static int XCert_UpdateCertCache(XCert_CertCache *CertCache, const XCert_Config *Cfg,
+	const u8 *Cert, u32 CertSize)
+{
+	int Status = XST_FAILURE;
+
+	CertCache->IsCertAvailable = 0U;
+
+	Status = Xil_SMemCpy(CertCache->SubjectPublicKey, sizeof(CertCache->SubjectPublicKey),
+		Cfg->AppCfg.SubjectPublicKey, XCERT_ECC_P384_PUBLIC_KEY_LEN,
+		XCERT_ECC_P384_PUBLIC_KEY_LEN);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	if (Cfg->AppCfg.IsCsr != TRUE) {
+		Status = Xil_SMemCpy(CertCache->IssuerPublicKey, sizeof(CertCache->IssuerPublicKey),
+			Cfg->AppCfg.IssuerPublicKey, XCERT_ECC_P384_PUBLIC_KEY_LEN,
+			XCERT_ECC_P384_PUBLIC_KEY_LEN);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Status = Xil_SMemCpy(CertCache->FwHash, sizeof(CertCache->FwHash),
+			Cfg->AppCfg.FwHash, XCERT_HASH_SIZE_IN_BYTES, XCERT_HASH_SIZE_IN_BYTES);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	Status = Xil_SMemCpy(CertCache->Cert, sizeof(CertCache->Cert), Cert,
+		CertSize, CertSize);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	CertCache->CertSize = CertSize;
+	CertCache->IsSelfSigned = Cfg->AppCfg.IsSelfSigned;
+	CertCache->IsCsr = Cfg->AppCfg.IsCsr;
+	CertCache->IsCertAvailable = XCERT_CERT_AVAILABLE;
+
 END:
 	return Status;
 }
@@ -398,6 +543,11 @@ int XCert_StoreCertUserInput(u32 SubSystemId, XCert_UserCfgFields FieldType, u8*
 		*NumOfEntriesInUserCfgDB = (*NumOfEntriesInUserCfgDB) + 1U;
 	}
 
+	/**
+	 * The cached certificate is encoded with the previous user input
+	 */
+	CertDB[IdxToBeUpdated].CertCache.IsCertAvailable = 0U;
+
 	if (FieldType == XCERT_ISSUER) {
 		XSecure_MemCpy(CertDB[IdxToBeUpdated].UserCfg.Issuer, Val, Len);
 		CertDB[IdxToBeUpdated].UserCfg.IssuerLen = Len;
@@ -434,11 +584,15 @@ END:
  *			signatureAlgorithm   AlgorithmIdentifier,
  *			signatureValue       BIT STRING  }
  *
+ *		The last certificate of each subsystem is cached and returned
+ *		as is while the public keys, firmware hash and user
+ *		configuration it was encoded from do not change.
+ *
  ******************************************************************************/
 int XCert_GenerateX509Cert(u64 X509CertAddr, u32 MaxCertSize, u32* X509CertSize, XCert_Config *Cfg)
 {
 	int Status = XST_FAILURE;
-	u8 X509CertBuf[1024];
+	u8 X509CertBuf[XCERT_MAX_CERT_SIZE];
 	u8* Start = X509CertBuf;
 	u8* Curr = Start;
 	u8* SequenceLenIdx;
@@ -452,6 +606,7 @@ int XCert_GenerateX509Cert(u64 X509CertAddr, u32 MaxCertSize, u32* X509CertSize,
 	u8 SignTmp[XSECURE_ECC_P384_SIZE_IN_BYTES * 2U] = {0U};
 	u8 Hash[XCERT_HASH_SIZE_IN_BYTES] = {0U};
 	XCert_SignStore *SignStore;
+	XCert_CertCache *CertCache = NULL;
 #endif
 	u8 HashTmp[XCERT_HASH_SIZE_IN_BYTES] = {0U};
 	u8 *TbsCertStart;
@@ -471,6 +626,22 @@ int XCert_GenerateX509Cert(u64 X509CertAddr, u32 MaxCertSize, u32* X509CertSize,
 		goto END;
 	}
 
+#ifndef PLM_ECDSA_EXCLUDE
+	/**
+	 * Return the cached certificate if it was encoded from the same inputs
+	 */
+	Status = XCert_GetCertCache(Cfg->SubSystemId, &CertCache);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	if (XCert_IsCertCacheValid(CertCache, Cfg) == XST_SUCCESS) {
+		*X509CertSize = CertCache->CertSize;
+		XCert_CopyCertificate(CertCache->CertSize, CertCache->Cert, X509CertAddr);
+		Status = XST_SUCCESS;
+		goto END;
+	}
+#endif
+
 	TbsCertStart = Curr;
 	if (Cfg->AppCfg.IsCsr == TRUE) {
 		Status = XCert_GenCertReqInfo(Curr, Cfg, &DataLen);
@@ -591,6 +762,12 @@ int XCert_GenerateX509Cert(u64 X509CertAddr, u32 MaxCertSize, u32* X509CertSize,
 	Curr = Curr + ((*SequenceLenIdx) & XCERT_LOWER_NIBBLE_MASK);
 	*X509CertSize = Curr - Start;
 
+#ifndef PLM_ECDSA_EXCLUDE
+	/**
+	 * A failure to cache only costs a regeneration on the next request
+	 */
+	(void)XCert_UpdateCertCache(CertCache, Cfg, X509CertBuf, *X509CertSize);
+#endif
 	XCert_CopyCertificate(*X509CertSize, (u8 *)X509CertBuf, X509CertAddr);
 
 END:
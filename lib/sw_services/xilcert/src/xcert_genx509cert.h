@@ -19,6 +19,7 @@
 * ----- ---- ---------- -------------------------------------------------------
 * 1.0   har  01/09/2023 Initial release
 * 1.1   am   08/18/2023 Added XCert_ErrorStatus enum
+* 1.2   fl   10/14/2026 Added XCert_CertCache structure
 *
 * </pre>
 *
@@ -53,6 +54,8 @@ extern "C" {
 				/**< Alias of XPlmi_Printf to be used in XilCert*/
 #define XCERT_ECC_P384_PUBLIC_KEY_LEN				(96U)
 					/**< Length of ECC P-384 Public Key */
+#define XCERT_MAX_CERT_SIZE					(1024U)
+			/**< Max length of the DER encoded X.509 certificate/CSR */
 
 /**************************** Type Definitions *******************************/
 typedef enum {
@@ -76,10 +79,22 @@ typedef struct {
 	u32 ValidityLen;	/**< Length of DER encoded Validity field */
 } XCert_UserCfg;
 
+typedef struct {
+	u8 Cert[XCERT_MAX_CERT_SIZE];	/**< DER encoded certificate/CSR */
+	u32 CertSize;		/**< Length of the DER encoded certificate/CSR */
+	u32 IsSelfSigned;	/**< IsSelfSigned of the cached certificate */
+	u32 IsCsr;		/**< IsCsr of the cached certificate */
+	u8 SubjectPublicKey[XCERT_ECC_P384_PUBLIC_KEY_LEN]; /**< Subject Public Key */
+	u8 IssuerPublicKey[XCERT_ECC_P384_PUBLIC_KEY_LEN]; /**< Issuer Public Key */
+	u8 FwHash[XCERT_HASH_SIZE_IN_BYTES];	/**< Firmware Hash */
+	u8 IsCertAvailable;	/**< Flag to check if certificate is available */
+} XCert_CertCache;
+
 typedef struct {
 	u32 SubsystemId;	/**< Subsystem Id */
 	XCert_UserCfg UserCfg;	/**< User configuration */
 	XCert_SignStore SignStore; /**< Signature store */
+	XCert_CertCache CertCache; /**< Last generated certificate */
 } XCert_InfoStore;
 
 typedef struct {
@@ -94,6 +94,12 @@ proc xgen_opts_file {libhandle} {
 	set set_fs_rpath [common::get_property CONFIG.set_fs_rpath $libhandle]
 	set word_access [common::get_property CONFIG.word_access $libhandle]
 	set use_chmod [common::get_property CONFIG.use_chmod $libhandle]
+	set use_contig [common::get_property CONFIG.use_contig $libhandle]
+	set enable_reentrant [common::get_property CONFIG.enable_reentrant $libhandle]
+	set reader_bufs [common::get_property CONFIG.reader_bufs $libhandle]
+	set os_type [hsi::get_os]
+	set sector_cache_size [common::get_property CONFIG.sector_cache_size $libhandle]
+	set cache_burst_size [common::get_property CONFIG.cache_burst_size $libhandle]
 
 	# do processor specific checks
 	set proc  [hsi::get_sw_processor];
@@ -102,6 +108,7 @@ proc xgen_opts_file {libhandle} {
 	if {$fs_interface == 2} {
 		set ramfs_size [common::get_property CONFIG.ramfs_size $libhandle]
 		set ramfs_start_addr [common::get_property CONFIG.ramfs_start_addr $libhandle]
+		set use_readptr [common::get_property CONFIG.use_readptr $libhandle]
 
 		puts $file_handle "\#define FILE_SYSTEM_INTERFACE_RAM"
 
@@ -119,6 +126,9 @@ proc xgen_opts_file {libhandle} {
 		} else {
 			puts $file_handle "\#define RAMFS_START_ADDR $ramfs_start_addr"
 		}
+		if {$use_readptr == true} {
+			puts $file_handle "\#define FILE_SYSTEM_USE_READPTR"
+		}
 	}
 
 
@@ -131,6 +141,15 @@ proc xgen_opts_file {libhandle} {
 		if {$periph == "ps7_sdio" || $periph == "psu_sd" || $periph == "psv_pmc_sd" || $periph == "psxl_pmc_sd" || $periph == "psxl_pmc_emmc" || $periph == "psx_pmc_sd" || $periph == "psx_pmc_emmc"} {
 			if {$fs_interface == 1} {
 				puts $file_handle "\#define FILE_SYSTEM_INTERFACE_SD"
+				if {$sector_cache_size > 0} {
+					if {$cache_burst_size < 1} {
+						puts "WARNING : Invalid cache_burst_size, setting \
+								back to 8\n"
+						set cache_burst_size 8
+					}
+					puts $file_handle "\#define FILE_SYSTEM_SECTOR_CACHE_SIZE $sector_cache_size"
+					puts $file_handle "\#define FILE_SYSTEM_CACHE_BURST $cache_burst_size"
+				}
 				break
 			}
 		}
@@ -164,6 +183,20 @@ proc xgen_opts_file {libhandle} {
 		if {$use_trim == true} {
 			puts $file_handle "\#define FILE_SYSTEM_USE_TRIM"
 		}
+		if {$use_contig == true} {
+			puts $file_handle "\#define FILE_SYSTEM_USE_CONTIG"
+		}
+		if {$enable_reentrant == true} {
+			if {$os_type == "freertos10_xilinx"} {
+				puts $file_handle "\#define FILE_SYSTEM_FS_REENTRANT"
+				if {$reader_bufs > 0} {
+					puts $file_handle "\#define FILE_SYSTEM_READER_BUFS $reader_bufs"
+				}
+			} else {
+				puts "WARNING : Reentrant file system is supported \
+						only with FreeRTOS"
+			}
+		}
 		if {$num_logical_vol > 10} {
 			puts "WARNING : File System supports only up to 10 logical drives\
 					Setting back the num of vol to 10\n"
@@ -30,6 +30,10 @@
 *		write files using ADMA2 in polled mode.
 *		The file system can be used to read from and write to an
 *		SD card that is already formatted as FATFS.
+*		When FILE_SYSTEM_SECTOR_CACHE_SIZE is defined, single sector
+*		requests to the SD card go through a write-back LRU cache of
+*		that many sectors. Dirty sectors reach the card on CTRL_SYNC
+*		(f_sync and f_close) or when they are evicted.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -68,6 +72,11 @@
 * 4.6   sk   07/20/21 Fixed compilation warning in RAM interface.
 * 4.8   sk   05/05/22 Replace standard lib functions with Xilinx functions.
 * 5.1   ro   06/12/23 Added support for system device-tree flow.
+*       fl   10/14/26 Added write-back sector cache with read-ahead for SD.
+*       fl   10/14/26 Split SD transfers larger than one ADMA2 descriptor
+*                     table for the multi-cluster reads of contiguous files.
+*       fl   10/14/26 Added GET_SECTOR_ADDR ioctl for in place reads of the
+*                     RAM disk.
 *
 * </pre>
 *
@@ -91,8 +100,21 @@
 #include "xil_util.h"
 
 #define SD_CD_DELAY		10000U
+/* Sectors of the largest transfer described by the 32 ADMA2 descriptors */
+#define SD_MAX_XFER_SECTORS	((32U * XSDPS_DESC_MAX_LENGTH) / XSDPS_BLK_SIZE_512_MASK)
 #define XSDPS_NUM_INSTANCES	2
 
+#if defined(FILE_SYSTEM_INTERFACE_SD) && defined(FILE_SYSTEM_SECTOR_CACHE_SIZE)
+#define SD_SECTOR_CACHE
+#define SD_SECTOR_SIZE		512U
+#ifndef FILE_SYSTEM_CACHE_BURST
+#define FILE_SYSTEM_CACHE_BURST	8U
+#endif
+#if (FILE_SYSTEM_SECTOR_CACHE_SIZE < 1) || (FILE_SYSTEM_CACHE_BURST < 1)
+#error "Sector cache and burst sizes must be at least one sector"
+#endif
+#endif
+
 #ifdef FILE_SYSTEM_INTERFACE_RAM
 #include "xparameters.h"
 
@@ -123,6 +145,395 @@ static u32 SlotType[XSDPS_NUM_INSTANCES];
 static u8 HostCntrlrVer[XSDPS_NUM_INSTANCES];
 #endif
 
+#ifdef SD_SECTOR_CACHE
+/*
+ * Write-back sector cache shared by all SD drives. Single sector requests,
+ * which is how FatFs accesses the FAT and directory sectors through its
+ * window, are served from the cache. Sequential single sector misses read
+ * FILE_SYSTEM_CACHE_BURST sectors ahead. Dirty sectors are written back in
+ * runs of consecutive sectors on CTRL_SYNC, or when a dirty sector has to be
+ * evicted.
+ */
+#define SD_CACHE_NONE		((u32)FILE_SYSTEM_SECTOR_CACHE_SIZE)
+#define SD_CACHE_VALID		0x1U
+#define SD_CACHE_DIRTY		0x2U
+/* Largest cache line size of the processors with an SD controller */
+#define SD_CACHE_ALIGN		64U
+
+typedef struct {
+	LBA_t Sector;		/**< Sector held by the entry */
+	u32 Stamp;		/**< Value of SdCacheTick at the last access */
+	u8 Drive;		/**< Drive of the sector */
+	u8 Flags;		/**< SD_CACHE_VALID and SD_CACHE_DIRTY */
+} SdCacheEntry;
+
+static SdCacheEntry SdCache[FILE_SYSTEM_SECTOR_CACHE_SIZE];
+static u8 SdCacheData[FILE_SYSTEM_SECTOR_CACHE_SIZE][SD_SECTOR_SIZE]
+__attribute__ ((aligned(SD_CACHE_ALIGN)));
+/* Staging buffer of the read-ahead and of the coalesced write back */
+static u8 SdCacheBurst[FILE_SYSTEM_CACHE_BURST][SD_SECTOR_SIZE]
+__attribute__ ((aligned(SD_CACHE_ALIGN)));
+static u32 SdCacheTick;
+/* Sector following the last single sector miss, detects sequential reads */
+static LBA_t SdCacheNextSector[XSDPS_NUM_INSTANCES];
+#endif
+
+#ifdef FILE_SYSTEM_INTERFACE_SD
+/*****************************************************************************/
+/**
+*
+* Reads sectors from the SD card, converting the LBA to a byte address for
+* standard capacity cards. Transfers larger than SD_MAX_XFER_SECTORS are
+* split.
+*
+* @param	pdrv - Drive number
+* @param	Sector - Start sector number
+* @param	Count - Sector count
+* @param	Buff - Pointer to the data buffer to store read data
+*
+* @return	XST_SUCCESS if successful, otherwise the XSdPs_ReadPolled status
+*
+******************************************************************************/
+static s32 SdReadSectors(BYTE pdrv, LBA_t Sector, UINT Count, BYTE *Buff)
+{
+	DWORD LocSector;
+	UINT Chunk;
+	s32 Status = XST_SUCCESS;
+
+	while (Count > 0U) {
+		Chunk = (Count > SD_MAX_XFER_SECTORS) ? SD_MAX_XFER_SECTORS : Count;
+		LocSector = Sector;
+		/* Convert LBA to byte address if needed */
+		if ((SdInstance[pdrv].HCS) == 0U) {
+			LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+		}
+
+		Status = XSdPs_ReadPolled(&SdInstance[pdrv], (u32)LocSector,
+					  Chunk, Buff);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		Sector += Chunk;
+		Buff += (Chunk * XSDPS_BLK_SIZE_512_MASK);
+		Count -= Chunk;
+	}
+
+	return Status;
+}
+
+#if FF_FS_READONLY == 0
+/*****************************************************************************/
+/**
+*
+* Writes sectors to the SD card, converting the LBA to a byte address for
+* standard capacity cards. Transfers larger than SD_MAX_XFER_SECTORS are
+* split.
+*
+* @param	pdrv - Drive number
+* @param	Sector - Start sector number
+* @param	Count - Sector count
+* @param	Buff - Pointer to the data to be written
+*
+* @return	XST_SUCCESS if successful, otherwise the XSdPs_WritePolled status
+*
+******************************************************************************/
+static s32 SdWriteSectors(BYTE pdrv, LBA_t Sector, UINT Count,
+			  const BYTE *Buff)
+{
+	DWORD LocSector;
+	UINT Chunk;
+	s32 Status = XST_SUCCESS;
+
+	while (Count > 0U) {
+		Chunk = (Count > SD_MAX_XFER_SECTORS) ? SD_MAX_XFER_SECTORS : Count;
+		LocSector = Sector;
+		/* Convert LBA to byte address if needed */
+		if ((SdInstance[pdrv].HCS) == 0U) {
+			LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+		}
+
+		Status = XSdPs_WritePolled(&SdInstance[pdrv], (u32)LocSector,
+					   Chunk, Buff);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		Sector += Chunk;
+		Buff += (Chunk * XSDPS_BLK_SIZE_512_MASK);
+		Count -= Chunk;
+	}
+
+	return Status;
+}
+#endif
+#endif
+
+#ifdef SD_SECTOR_CACHE
+/*****************************************************************************/
+/**
+*
+* Looks up a sector in the sector cache.
+*
+* @param	pdrv - Drive number
+* @param	Sector - Sector number
+*
+* @return	Index of the cache entry, SD_CACHE_NONE if not cached
+*
+******************************************************************************/
+static u32 SdCache_Find(BYTE pdrv, LBA_t Sector)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < (u32)FILE_SYSTEM_SECTOR_CACHE_SIZE; Index++) {
+		if (((SdCache[Index].Flags & SD_CACHE_VALID) != 0U) &&
+		    (SdCache[Index].Drive == pdrv) &&
+		    (SdCache[Index].Sector == Sector)) {
+			return Index;
+		}
+	}
+
+	return SD_CACHE_NONE;
+}
+
+/*****************************************************************************/
+/**
+*
+* Drops the cached sectors of a drive in the range [First, Last], including
+* dirty ones.
+*
+* @param	pdrv - Drive number
+* @param	First - First sector of the range
+* @param	Last - Last sector of the range
+*
+******************************************************************************/
+static void SdCache_Drop(BYTE pdrv, LBA_t First, LBA_t Last)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < (u32)FILE_SYSTEM_SECTOR_CACHE_SIZE; Index++) {
+		if ((SdCache[Index].Drive == pdrv) &&
+		    (SdCache[Index].Sector >= First) &&
+		    (SdCache[Index].Sector <= Last)) {
+			SdCache[Index].Flags = 0U;
+		}
+	}
+}
+
+#if FF_FS_READONLY == 0
+/*****************************************************************************/
+/**
+*
+* Writes the dirty sectors of a drive back to the card. The dirty sectors
+* are sorted and runs of up to FILE_SYSTEM_CACHE_BURST consecutive sectors
+* are written with one multiple block write.
+*
+* @param	pdrv - Drive number
+*
+* @return
+*		RES_OK		All dirty sectors written
+*		RES_ERROR	Write failed, the unwritten sectors stay dirty
+*
+******************************************************************************/
+static DRESULT SdCache_Flush(BYTE pdrv)
+{
+	static u32 Order[FILE_SYSTEM_SECTOR_CACHE_SIZE];
+	u32 Count = 0U;
+	u32 Index;
+	u32 Pos;
+	u32 Run;
+	u32 Slot;
+	s32 Status;
+
+	/* Collect the dirty entries of the drive sorted by sector */
+	for (Index = 0U; Index < (u32)FILE_SYSTEM_SECTOR_CACHE_SIZE; Index++) {
+		if ((SdCache[Index].Drive != pdrv) ||
+		    ((SdCache[Index].Flags & SD_CACHE_DIRTY) == 0U)) {
+			continue;
+		}
+		Pos = Count;
+		while ((Pos > 0U) &&
+		       (SdCache[Order[Pos - 1U]].Sector > SdCache[Index].Sector)) {
+			Order[Pos] = Order[Pos - 1U];
+			Pos--;
+		}
+		Order[Pos] = Index;
+		Count++;
+	}
+
+	for (Pos = 0U; Pos < Count; Pos += Run) {
+		Run = 1U;
+		while (((Pos + Run) < Count) &&
+		       (Run < (u32)FILE_SYSTEM_CACHE_BURST) &&
+		       (SdCache[Order[Pos + Run]].Sector ==
+			(SdCache[Order[Pos]].Sector + Run))) {
+			Run++;
+		}
+
+		if (Run == 1U) {
+			Status = SdWriteSectors(pdrv, SdCache[Order[Pos]].Sector, 1U,
+						SdCacheData[Order[Pos]]);
+		} else {
+			for (Slot = 0U; Slot < Run; Slot++) {
+				(void)Xil_SMemCpy(SdCacheBurst[Slot], SD_SECTOR_SIZE,
+						  SdCacheData[Order[Pos + Slot]],
+						  SD_SECTOR_SIZE, SD_SECTOR_SIZE);
+			}
+			Status = SdWriteSectors(pdrv, SdCache[Order[Pos]].Sector, Run,
+						SdCacheBurst[0]);
+		}
+		if (Status != XST_SUCCESS) {
+			return RES_ERROR;
+		}
+
+		for (Slot = 0U; Slot < Run; Slot++) {
+			SdCache[Order[Pos + Slot]].Flags &= ~SD_CACHE_DIRTY;
+		}
+	}
+
+	return RES_OK;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Frees the least recently used cache entry for a new sector. A dirty entry
+* is written back together with the other dirty sectors of its drive.
+*
+* @param	AllowFlush - 0 to fail rather than write back a dirty entry,
+*		which must be used while SdCacheBurst holds data
+*
+* @return	Index of the free entry, SD_CACHE_NONE if none could be freed
+*
+******************************************************************************/
+static u32 SdCache_Victim(u32 AllowFlush)
+{
+	u32 Victim = 0U;
+	u32 Index;
+
+	for (Index = 0U; Index < (u32)FILE_SYSTEM_SECTOR_CACHE_SIZE; Index++) {
+		if ((SdCache[Index].Flags & SD_CACHE_VALID) == 0U) {
+			return Index;
+		}
+		if ((SdCacheTick - SdCache[Index].Stamp) >
+		    (SdCacheTick - SdCache[Victim].Stamp)) {
+			Victim = Index;
+		}
+	}
+
+	if ((SdCache[Victim].Flags & SD_CACHE_DIRTY) != 0U) {
+#if FF_FS_READONLY == 0
+		if ((AllowFlush == 0U) ||
+		    (SdCache_Flush(SdCache[Victim].Drive) != RES_OK)) {
+			return SD_CACHE_NONE;
+		}
+#else
+		return SD_CACHE_NONE;
+#endif
+	}
+	SdCache[Victim].Flags = 0U;
+
+	return Victim;
+}
+
+/*****************************************************************************/
+/**
+*
+* Inserts a sector into a cache entry and marks it most recently used.
+*
+* @param	Index - Cache entry returned by SdCache_Victim()
+* @param	pdrv - Drive number
+* @param	Sector - Sector number
+* @param	Flags - SD_CACHE_VALID, optionally ORed with SD_CACHE_DIRTY
+*
+******************************************************************************/
+static void SdCache_Fill(u32 Index, BYTE pdrv, LBA_t Sector, u8 Flags)
+{
+	SdCache[Index].Drive = pdrv;
+	SdCache[Index].Sector = Sector;
+	SdCache[Index].Flags = Flags;
+	SdCacheTick++;
+	SdCache[Index].Stamp = SdCacheTick;
+}
+
+/*****************************************************************************/
+/**
+*
+* Reads one sector through the sector cache. A miss on the sector following
+* the previous miss reads FILE_SYSTEM_CACHE_BURST sectors ahead.
+*
+* @param	pdrv - Drive number
+* @param	Buff - Pointer to the data buffer to store read data
+* @param	Sector - Sector number
+*
+* @return	RES_OK if successful, RES_ERROR if the read failed
+*
+******************************************************************************/
+static DRESULT SdCache_ReadSector(BYTE pdrv, BYTE *Buff, LBA_t Sector)
+{
+	u32 Index;
+	u32 Burst;
+	u32 Slot;
+
+	Index = SdCache_Find(pdrv, Sector);
+	if (Index != SD_CACHE_NONE) {
+		SdCacheTick++;
+		SdCache[Index].Stamp = SdCacheTick;
+		(void)Xil_SMemCpy(Buff, SD_SECTOR_SIZE, SdCacheData[Index],
+				  SD_SECTOR_SIZE, SD_SECTOR_SIZE);
+		return RES_OK;
+	}
+
+	Burst = 1U;
+	if (Sector == SdCacheNextSector[pdrv]) {
+		Burst = (u32)FILE_SYSTEM_CACHE_BURST;
+		if ((SdInstance[pdrv].SectorCount - Sector) < Burst) {
+			Burst = SdInstance[pdrv].SectorCount - Sector;
+		}
+	}
+
+	if (Burst > 1U) {
+		if (SdReadSectors(pdrv, Sector, Burst, SdCacheBurst[0]) != XST_SUCCESS) {
+			return RES_ERROR;
+		}
+		(void)Xil_SMemCpy(Buff, SD_SECTOR_SIZE, SdCacheBurst[0],
+				  SD_SECTOR_SIZE, SD_SECTOR_SIZE);
+		/* Cached copies of the sectors ahead may be newer than the card */
+		for (Slot = 0U; Slot < Burst; Slot++) {
+			if ((Slot != 0U) &&
+			    (SdCache_Find(pdrv, Sector + Slot) != SD_CACHE_NONE)) {
+				continue;
+			}
+			Index = SdCache_Victim(0U);
+			if (Index == SD_CACHE_NONE) {
+				break;
+			}
+			(void)Xil_SMemCpy(SdCacheData[Index], SD_SECTOR_SIZE,
+					  SdCacheBurst[Slot], SD_SECTOR_SIZE,
+					  SD_SECTOR_SIZE);
+			SdCache_Fill(Index, pdrv, Sector + Slot, SD_CACHE_VALID);
+		}
+	} else {
+		Index = SdCache_Victim(1U);
+		if (Index == SD_CACHE_NONE) {
+			if (SdReadSectors(pdrv, Sector, 1U, Buff) != XST_SUCCESS) {
+				return RES_ERROR;
+			}
+		} else {
+			if (SdReadSectors(pdrv, Sector, 1U,
+					  SdCacheData[Index]) != XST_SUCCESS) {
+				return RES_ERROR;
+			}
+			SdCache_Fill(Index, pdrv, Sector, SD_CACHE_VALID);
+			(void)Xil_SMemCpy(Buff, SD_SECTOR_SIZE, SdCacheData[Index],
+					  SD_SECTOR_SIZE, SD_SECTOR_SIZE);
+		}
+	}
+	SdCacheNextSector[pdrv] = Sector + Burst;
+
+	return RES_OK;
+}
+#endif
+
 /*-----------------------------------------------------------------------*/
 /* Get Disk Status							*/
 /*-----------------------------------------------------------------------*/
@@ -312,6 +723,12 @@ DSTATUS disk_initialize (
 	}
 
 
+#ifdef SD_SECTOR_CACHE
+	/* The card may have been replaced */
+	SdCache_Drop(pdrv, (LBA_t)0, ~(LBA_t)0);
+	SdCacheNextSector[pdrv] = ~(LBA_t)0;
+#endif
+
 	/*
 	 * Disk is initialized.
 	 * Store the same in Stat.
@@ -366,7 +783,9 @@ DRESULT disk_read (
 	DSTATUS s;
 #ifdef FILE_SYSTEM_INTERFACE_SD
 	s32 Status = XST_FAILURE;
-	DWORD LocSector = sector;
+#endif
+#ifdef SD_SECTOR_CACHE
+	u32 Index;
 #endif
 
 	s = disk_status(pdrv);
@@ -378,18 +797,34 @@ DRESULT disk_read (
 		return RES_PARERR;
 	}
 
-#ifdef FILE_SYSTEM_INTERFACE_SD
-	/* Convert LBA to byte address if needed */
-	if ((SdInstance[pdrv].HCS) == 0U) {
-		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+#ifdef SD_SECTOR_CACHE
+	if (count == 1U) {
+		return SdCache_ReadSector(pdrv, buff, sector);
 	}
+#endif
 
-	Status  = XSdPs_ReadPolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
+#ifdef FILE_SYSTEM_INTERFACE_SD
+	Status = SdReadSectors(pdrv, sector, count, buff);
 	if (Status != XST_SUCCESS) {
 		return RES_ERROR;
 	}
 #endif
 
+#ifdef SD_SECTOR_CACHE
+	/* Cached sectors may hold data not yet written to the card */
+	for (Index = 0U; Index < (u32)FILE_SYSTEM_SECTOR_CACHE_SIZE; Index++) {
+		if (((SdCache[Index].Flags & SD_CACHE_DIRTY) != 0U) &&
+		    (SdCache[Index].Drive == pdrv) &&
+		    (SdCache[Index].Sector >= sector) &&
+		    (SdCache[Index].Sector < (sector + count))) {
+			(void)Xil_SMemCpy(buff + ((SdCache[Index].Sector - sector) *
+						  SD_SECTOR_SIZE), SD_SECTOR_SIZE,
+					  SdCacheData[Index], SD_SECTOR_SIZE,
+					  SD_SECTOR_SIZE);
+		}
+	}
+#endif
+
 #ifdef FILE_SYSTEM_INTERFACE_RAM
 	Xil_SMemCpy(buff, count * SECTORSIZE, dataramfs + (sector * SECTORSIZE),
 		    count * SECTORSIZE, count * SECTORSIZE);
@@ -424,7 +859,11 @@ DRESULT disk_ioctl (
 
 	switch (cmd) {
 		case (BYTE)CTRL_SYNC :	/* Make sure that no pending write process */
+#if defined(SD_SECTOR_CACHE) && (FF_FS_READONLY == 0)
+			res = SdCache_Flush(pdrv);
+#else
 			res = RES_OK;
+#endif
 			break;
 
 		case (BYTE)GET_SECTOR_COUNT : /* Get number of sectors on the disk (DWORD) */
@@ -438,6 +877,9 @@ DRESULT disk_ioctl (
 			break;
 
 		case (BYTE)CTRL_TRIM :	/* Erase the data */
+#ifdef SD_SECTOR_CACHE
+			SdCache_Drop(pdrv, (LBA_t)SendBuff[0], (LBA_t)SendBuff[1]);
+#endif
 			if ((SdInstance[pdrv].HCS) == 0U) {
 				SendBuff[0] *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
 				SendBuff[1] *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
@@ -469,6 +911,15 @@ DRESULT disk_ioctl (
 			*(DWORD *)buff = SECTORCNT;
 			res = RES_OK;
 			break;
+		case (BYTE)GET_SECTOR_ADDR:
+			if (*(UINTPTR *)buff < SECTORCNT) {
+				*(UINTPTR *)buff = (UINTPTR)dataramfs +
+						   (*(UINTPTR *)buff * SECTORSIZE);
+				res = RES_OK;
+			} else {
+				res = RES_PARERR;
+			}
+			break;
 		default:
 			res = RES_PARERR;
 			break;
@@ -537,7 +988,9 @@ DRESULT disk_write (
 	DSTATUS s;
 #ifdef FILE_SYSTEM_INTERFACE_SD
 	s32 Status = XST_FAILURE;
-	DWORD LocSector = sector;
+#endif
+#ifdef SD_SECTOR_CACHE
+	u32 Index;
 #endif
 
 	s = disk_status(pdrv);
@@ -548,19 +1001,46 @@ DRESULT disk_write (
 		return RES_PARERR;
 	}
 
-#ifdef FILE_SYSTEM_INTERFACE_SD
-	/* Convert LBA to byte address if needed */
-	if ((SdInstance[pdrv].HCS) == 0U) {
-		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+#ifdef SD_SECTOR_CACHE
+	if (count == 1U) {
+		Index = SdCache_Find(pdrv, sector);
+		if (Index == SD_CACHE_NONE) {
+			Index = SdCache_Victim(1U);
+		}
+		if (Index != SD_CACHE_NONE) {
+			(void)Xil_SMemCpy(SdCacheData[Index], SD_SECTOR_SIZE, buff,
+					  SD_SECTOR_SIZE, SD_SECTOR_SIZE);
+			SdCache_Fill(Index, pdrv, sector,
+				     SD_CACHE_VALID | SD_CACHE_DIRTY);
+			return RES_OK;
+		}
 	}
+#endif
 
-	Status  = XSdPs_WritePolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
+#ifdef FILE_SYSTEM_INTERFACE_SD
+	Status = SdWriteSectors(pdrv, sector, count, buff);
 	if (Status != XST_SUCCESS) {
 		return RES_ERROR;
 	}
 
 #endif
 
+#ifdef SD_SECTOR_CACHE
+	/* Keep cached copies of the written sectors up to date and clean */
+	for (Index = 0U; Index < (u32)FILE_SYSTEM_SECTOR_CACHE_SIZE; Index++) {
+		if (((SdCache[Index].Flags & SD_CACHE_VALID) != 0U) &&
+		    (SdCache[Index].Drive == pdrv) &&
+		    (SdCache[Index].Sector >= sector) &&
+		    (SdCache[Index].Sector < (sector + count))) {
+			(void)Xil_SMemCpy(SdCacheData[Index], SD_SECTOR_SIZE,
+					  buff + ((SdCache[Index].Sector - sector) *
+						  SD_SECTOR_SIZE), SD_SECTOR_SIZE,
+					  SD_SECTOR_SIZE);
+			SdCache[Index].Flags &= ~SD_CACHE_DIRTY;
+		}
+	}
+#endif
+
 #ifdef FILE_SYSTEM_INTERFACE_RAM
 	Xil_SMemCpy(dataramfs + (sector * SECTORSIZE), count * SECTORSIZE, buff,
 		    count * SECTORSIZE, count * SECTORSIZE);
@@ -267,6 +267,18 @@
 #else
 #define LEAVE_FF(fs, res)	return res
 #endif
+#if FF_FS_RWLOCK
+#if FF_FS_TINY
+#error Reader/writer lock cannot be used in tiny buffer configuration
+#endif
+#if FF_FS_RWBUFS < 1
+#error Wrong FF_FS_RWBUFS setting
+#endif
+#define RWIO_MUTEX(vol)	(FF_VOLUMES + 1 + (vol))	/* I/O mutex of the shared readers of the volume */
+#define READ_FILE(fs, fp, buff, sect, count)	((fp)->fwin ? read_shared(fs, buff, sect, count) : disk_read((fs)->pdrv, buff, sect, count))
+#else
+#define READ_FILE(fs, fp, buff, sect, count)	disk_read((fs)->pdrv, buff, sect, count)
+#endif
 
 
 /* Definitions of logical drive - physical location conversion */
@@ -499,6 +511,20 @@ static BYTE SysLock;				/* System lock flag (0:no mutex, 1:unlocked, 2:locked) *
 #endif
 #endif
 
+#if FF_FS_RWLOCK
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+static BYTE RwBuf[FF_VOLUMES][FF_FS_RWBUFS][FF_MAX_SS];	/* FAT sector buffers of the shared readers */
+#else
+#ifdef __aarch64__
+static BYTE RwBuf[FF_VOLUMES][FF_FS_RWBUFS][FF_MAX_SS] __attribute__ ((aligned(64)));	/* FAT sector buffers of the shared readers */
+#else
+static BYTE RwBuf[FF_VOLUMES][FF_FS_RWBUFS][FF_MAX_SS] __attribute__ ((aligned(32)));	/* FAT sector buffers of the shared readers */
+#endif
+#endif
+static BYTE RwBufUsed[FF_VOLUMES][FF_FS_RWBUFS];	/* Buffer is assigned to an open file */
+#endif
+
 #if FF_STR_VOLUME_ID
 #ifdef FF_VOLUME_STRS
 static const char *const VolumeStr[FF_VOLUMES] = {FF_VOLUME_STRS};	/* Pre-defined volume ID */
@@ -1039,7 +1065,26 @@ static int lock_volume (	/* 1:Ok, 0:timeout */
 	int rv;
 
 
+#if FF_FS_RWLOCK
+	rv = ff_rwlock_take(fs->ldrv, 0);	/* Lock the volume exclusively */
+	if (rv) {
+		fs->wlock = 1;
+	}
 #if FF_FS_LOCK
+	if (rv && syslock) {			/* System lock reqiered? */
+		rv = ff_mutex_take(FF_VOLUMES);	/* Lock the system */
+		if (rv) {
+			SysLock = 2;				/* System lock succeeded */
+		}
+		else {
+			fs->wlock = 0;
+			ff_rwlock_give(fs->ldrv, 0);	/* Failed system lock */
+		}
+	}
+#else
+	(void)syslock;
+#endif
+#elif FF_FS_LOCK
 	rv = ff_mutex_take(fs->ldrv);	/* Lock the volume */
 	if (rv && syslock) {			/* System lock reqiered? */
 		rv = ff_mutex_take(FF_VOLUMES);	/* Lock the system */
@@ -1070,7 +1115,17 @@ static void unlock_volume (
 			ff_mutex_give(FF_VOLUMES);
 		}
 #endif
+#if FF_FS_RWLOCK
+		if (fs->wlock) {	/* A shared reader never sees the flag of a writer */
+			fs->wlock = 0;
+			ff_rwlock_give(fs->ldrv, 0);	/* Unlock the exclusive volume */
+		}
+		else {
+			ff_rwlock_give(fs->ldrv, 1);	/* Leave the shared volume */
+		}
+#else
 		ff_mutex_give(fs->ldrv);	/* Unlock the volume */
+#endif
 	}
 }
 
@@ -1078,6 +1133,66 @@ static void unlock_volume (
 
 
 
+#if FF_FS_RWLOCK
+/*-----------------------------------------------------------------------*/
+/* Shared readers - Disk access and private FAT sector buffers           */
+/*-----------------------------------------------------------------------*/
+
+static DRESULT read_shared (	/* Read sectors with the I/O mutex of the volume */
+	FATFS *fs,		/* Filesystem object */
+	BYTE *buff,		/* Data buffer to store read data */
+	LBA_t sect,		/* Start sector */
+	UINT count		/* Number of sectors to read */
+)
+{
+	DRESULT dr = RES_ERROR;
+
+
+	if (ff_mutex_take(RWIO_MUTEX(fs->ldrv))) {
+		dr = disk_read(fs->pdrv, buff, sect, count);
+		ff_mutex_give(RWIO_MUTEX(fs->ldrv));
+	}
+	return dr;
+}
+
+
+static void get_rwbuf (
+	FIL *fp			/* File object opened without FA_WRITE (volume locked exclusively) */
+)
+{
+	UINT i;
+	BYTE vol = fp->obj.fs->ldrv;
+
+
+	fp->fwin = 0;
+	for (i = 0; i < FF_FS_RWBUFS; i++) {
+		if (!RwBufUsed[vol][i]) {
+			RwBufUsed[vol][i] = 1;
+			fp->fwin = RwBuf[vol][i];
+			fp->fwsect = (LBA_t)0 - 1;	/* Invalidate the buffer */
+			break;
+		}
+	}
+}
+
+
+static void put_rwbuf (
+	FIL *fp			/* File object (volume locked exclusively) */
+)
+{
+	BYTE vol = fp->obj.fs->ldrv;
+
+
+	if (fp->fwin) {
+		RwBufUsed[vol][(UINT)(fp->fwin - RwBuf[vol][0]) / FF_MAX_SS] = 0;
+		fp->fwin = 0;
+	}
+}
+
+#endif	/* FF_FS_RWLOCK */
+
+
+
 #if FF_FS_LOCK
 /*-----------------------------------------------------------------------*/
 /* File shareing control functions                                       */
@@ -1332,13 +1447,43 @@ static LBA_t clst2sect (	/* !=0:Sector number, 0:Failed (invalid cluster#) */
 /* FAT access - Read value of an FAT entry                               */
 /*-----------------------------------------------------------------------*/
 
-static DWORD get_fat (		/* 0xFFFFFFFF:Disk error, 1:Internal error, 2..0x7FFFFFFF:Cluster status */
+static BYTE* fat_window (	/* Pointer to the FAT sector data, 0:Disk error */
+	FATFS *fs,		/* Filesystem object */
+	FIL *fp,		/* Shared reader with a private FAT buffer (0:use the fs->win[]) */
+	LBA_t sect		/* FAT sector to access */
+)
+{
+#if FF_FS_RWLOCK
+	if (fp && fp->fwin) {
+		if (sect != fp->fwsect || fp->fwgen != fs->fgen) {	/* Reload the private buffer */
+			if (sect == fs->winsect) {	/* No writer is in the volume, the win[] is up to date */
+				mem_cpy(fp->fwin, fs->win, SS(fs));
+			}
+			else if (read_shared(fs, fp->fwin, sect, 1) != RES_OK) {
+				fp->fwsect = (LBA_t)0 - 1;
+				return 0;
+			}
+			fp->fwsect = sect;
+			fp->fwgen = fs->fgen;
+		}
+		return fp->fwin;
+	}
+#else
+	(void)fp;
+#endif
+	return (move_window(fs, sect) == FR_OK) ? fs->win : 0;
+}
+
+
+static DWORD get_fat_win (	/* 0xFFFFFFFF:Disk error, 1:Internal error, 2..0x7FFFFFFF:Cluster status */
 	FFOBJID *obj,	/* Corresponding object */
-	DWORD clst		/* Cluster number to get the value */
+	DWORD clst,		/* Cluster number to get the value */
+	FIL *fp			/* Shared reader with a private FAT buffer (0:use the fs->win[]) */
 )
 {
 	UINT wc, bc;
 	DWORD val;
+	BYTE *win;
 	FATFS *fs = obj->fs;
 
 
@@ -1353,29 +1498,33 @@ static DWORD get_fat (		/* 0xFFFFFFFF:Disk error, 1:Internal error, 2..0x7FFFFFF
 			case FS_FAT12 :
 				bc = (UINT)clst;
 				bc += bc / 2;
-				if (move_window(fs, fs->fatbase + (bc / SS(fs))) != FR_OK) {
+				win = fat_window(fs, fp, fs->fatbase + (bc / SS(fs)));
+				if (win == 0) {
 					break;
 				}
-				wc = fs->win[bc++ % SS(fs)];		/* Get 1st byte of the entry */
-				if (move_window(fs, fs->fatbase + (bc / SS(fs))) != FR_OK) {
+				wc = win[bc++ % SS(fs)];		/* Get 1st byte of the entry */
+				win = fat_window(fs, fp, fs->fatbase + (bc / SS(fs)));
+				if (win == 0) {
 					break;
 				}
-				wc |= fs->win[bc % SS(fs)] << 8;	/* Merge 2nd byte of the entry */
+				wc |= win[bc % SS(fs)] << 8;	/* Merge 2nd byte of the entry */
 				val = (clst & 1) ? (wc >> 4) : (wc & 0xFFF);	/* Adjust bit position */
 				break;
 
 			case FS_FAT16 :
-				if (move_window(fs, fs->fatbase + (clst / (SS(fs) / 2))) != FR_OK) {
+				win = fat_window(fs, fp, fs->fatbase + (clst / (SS(fs) / 2)));
+				if (win == 0) {
 					break;
 				}
-				val = ld_word(fs->win + clst * 2 % SS(fs));		/* Simple WORD array */
+				val = ld_word(win + clst * 2 % SS(fs));		/* Simple WORD array */
 				break;
 
 			case FS_FAT32 :
-				if (move_window(fs, fs->fatbase + (clst / (SS(fs) / 4))) != FR_OK) {
+				win = fat_window(fs, fp, fs->fatbase + (clst / (SS(fs) / 4)));
+				if (win == 0) {
 					break;
 				}
-				val = ld_dword(fs->win + clst * 4 % SS(fs)) & 0x0FFFFFFF;	/* Simple DWORD array but mask out upper 4 bits */
+				val = ld_dword(win + clst * 4 % SS(fs)) & 0x0FFFFFFF;	/* Simple DWORD array but mask out upper 4 bits */
 				break;
 #if FF_FS_EXFAT
 			case FS_EXFAT :
@@ -1397,10 +1546,11 @@ static DWORD get_fat (		/* 0xFFFFFFFF:Disk error, 1:Internal error, 2..0x7FFFFFF
 							val = 0x7FFFFFFF;	/* Generate EOC */
 						}
 						else {
-							if (move_window(fs, fs->fatbase + (clst / (SS(fs) / 4))) != FR_OK) {
+							win = fat_window(fs, fp, fs->fatbase + (clst / (SS(fs) / 4)));
+							if (win == 0) {
 								break;
 							}
-							val = ld_dword(fs->win + clst * 4 % SS(fs)) & 0x7FFFFFFF;
+							val = ld_dword(win + clst * 4 % SS(fs)) & 0x7FFFFFFF;
 						}
 						break;
 					}
@@ -1417,6 +1567,15 @@ static DWORD get_fat (		/* 0xFFFFFFFF:Disk error, 1:Internal error, 2..0x7FFFFFF
 }
 
 
+static DWORD get_fat (		/* 0xFFFFFFFF:Disk error, 1:Internal error, 2..0x7FFFFFFF:Cluster status */
+	FFOBJID *obj,	/* Corresponding object */
+	DWORD clst		/* Cluster number to get the value */
+)
+{
+	return get_fat_win(obj, clst, 0);
+}
+
+
 
 
 #if !FF_FS_READONLY
@@ -1436,6 +1595,9 @@ static FRESULT put_fat (	/* FR_OK(0):succeeded, !=0:error */
 
 
 	if (clst >= 2 && clst < fs->n_fatent) {	/* Check if in valid range */
+#if FF_FS_RWLOCK
+		fs->fgen++;		/* Invalidate the FAT buffers of the shared readers */
+#endif
 		switch (fs->fs_type) {
 			case FS_FAT12:
 				bc = (UINT)clst;
@@ -1946,6 +2108,45 @@ static DWORD clmt_clust (	/* <2:Error, >=2:Cluster number */
 
 
 
+#if FF_USE_CONTIG
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Get number of contiguous clusters from top of the file */
+/*-----------------------------------------------------------------------*/
+
+static DWORD count_contig (	/* Number of contiguous clusters */
+	FIL *fp			/* Pointer to the file object */
+)
+{
+	DWORD bcs, clst, nxt, ncl, n;
+	FATFS *fs = fp->obj.fs;
+
+
+	if (fp->obj.sclust == 0 || fp->obj.objsize == 0) {
+		return 0;        /* No cluster chain */
+	}
+	bcs = (DWORD)fs->csize * SS(fs);	/* Cluster size (byte) */
+	ncl = (DWORD)((fp->obj.objsize + bcs - 1) / bcs);	/* Number of clusters of the file */
+#if FF_FS_EXFAT
+	if (fp->obj.stat == 2) {
+		return ncl;        /* No FAT chain, the whole file is contiguous */
+	}
+#endif
+	clst = fp->obj.sclust;
+	for (n = 1; n < ncl; n++) {
+		nxt = get_fat(&fp->obj, clst);
+		if (nxt != clst + 1) {
+			break;        /* Fragmented, end of chain or error */
+		}
+		clst = nxt;
+	}
+	return n;
+}
+
+#endif	/* FF_USE_CONTIG */
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Directory handling - Fill a cluster with zeros                        */
 /*-----------------------------------------------------------------------*/
@@ -4377,6 +4578,9 @@ static FRESULT mount_volume (	/* FR_OK(0): successful, !=0: an error occurred */
 
 	fs->fs_type = (BYTE)fmt;/* FAT sub-type (the filesystem object gets valid) */
 	fs->id = ++Fsid;		/* Volume mount ID */
+#if FF_FS_RWLOCK
+	memset(RwBufUsed[fs->ldrv], 0, sizeof RwBufUsed[0]);	/* Release buffers of the files of previous mount */
+#endif
 #if FF_USE_LFN == 1
 	fs->lfnbuf = LfnBuf;	/* Static LFN working buffer */
 #if FF_FS_EXFAT
@@ -4431,6 +4635,43 @@ static FRESULT validate (	/* Returns FR_OK or FR_INVALID_OBJECT */
 }
 
 
+#if FF_FS_RWLOCK
+static FRESULT validate_read (	/* Returns FR_OK or FR_INVALID_OBJECT */
+	FIL *fp,				/* Pointer to the file object to check validity */
+	FATFS **rfs				/* Pointer to pointer to the owner filesystem object to return */
+)
+{
+	FRESULT res = FR_INVALID_OBJECT;
+	FATFS *fs = fp->obj.fs;
+	DSTATUS stat = STA_NOINIT;
+
+
+	if (!fp->fwin) {	/* No FAT buffer, lock the volume exclusively */
+		return validate(&fp->obj, rfs);
+	}
+	if (fs && fs->fs_type && fp->obj.id == fs->id) {	/* Test if the object is valid */
+		if (ff_rwlock_take(fs->ldrv, 1)) {	/* Take a shared grant to access the volume */
+			if (ff_mutex_take(RWIO_MUTEX(fs->ldrv))) {
+				stat = disk_status(fs->pdrv);
+				ff_mutex_give(RWIO_MUTEX(fs->ldrv));
+			}
+			if (fp->obj.id == fs->id && !(stat & STA_NOINIT)) {	/* Test again, the volume may have been remounted */
+				res = FR_OK;
+			}
+			else {
+				ff_rwlock_give(fs->ldrv, 1);	/* Invalidated volume, abort to access */
+			}
+		}
+		else {	/* Could not take */
+			res = FR_TIMEOUT;
+		}
+	}
+	*rfs = (res == FR_OK) ? fs : 0;	/* Return corresponding filesystem object if it is valid */
+	return res;
+}
+#endif
+
+
 
 
 /*---------------------------------------------------------------------------
@@ -4469,7 +4710,11 @@ FRESULT f_mount (
 #if FF_FS_LOCK
 		clear_share(cfs);
 #endif
-#if FF_FS_REENTRANT				/* Discard mutex of the current volume */
+#if FF_FS_RWLOCK				/* Discard locks of the current volume */
+		ff_rwlock_delete(vol);
+		ff_mutex_delete(RWIO_MUTEX(vol));
+		memset(RwBufUsed[vol], 0, sizeof RwBufUsed[0]);
+#elif FF_FS_REENTRANT			/* Discard mutex of the current volume */
 		ff_mutex_delete(vol);
 #endif
 		cfs->fs_type = 0;		/* Invalidate the filesystem object to be unregistered */
@@ -4479,13 +4724,29 @@ FRESULT f_mount (
 		fs->pdrv = LD2PD(vol);	/* Volume hosting physical drive */
 #if FF_FS_REENTRANT				/* Create a volume mutex */
 		fs->ldrv = (BYTE)vol;	/* Owner volume ID */
+#if FF_FS_RWLOCK
+		fs->wlock = 0;
+		if (!ff_rwlock_create(vol)) {
+			return FR_INT_ERR;
+		}
+		if (!ff_mutex_create(RWIO_MUTEX(vol))) {
+			ff_rwlock_delete(vol);
+			return FR_INT_ERR;
+		}
+#else
 		if (!ff_mutex_create(vol)) {
 			return FR_INT_ERR;
 		}
+#endif
 #if FF_FS_LOCK
 		if (SysLock == 0) {		/* Create a system mutex if needed */
 			if (!ff_mutex_create(FF_VOLUMES)) {
+#if FF_FS_RWLOCK
+				ff_rwlock_delete(vol);
+				ff_mutex_delete(RWIO_MUTEX(vol));
+#else
 				ff_mutex_delete(vol);
+#endif
 				return FR_INT_ERR;
 			}
 			SysLock = 1;		/* System mutex is ready */
@@ -4675,6 +4936,12 @@ FRESULT f_open (
 			fp->err = 0;		/* Clear error flag */
 			fp->sect = 0;		/* Invalidate current data sector */
 			fp->fptr = 0;		/* Set file pointer top of the file */
+#if FF_USE_CONTIG
+			fp->ncont = count_contig(fp);	/* Get size of the contiguous area */
+#endif
+#if FF_FS_RWLOCK
+			fp->fwin = 0;		/* Exclusive access until a FAT buffer is assigned */
+#endif
 #if !FF_FS_READONLY
 #if !FF_FS_TINY
 			memset(fp->buf, 0, sizeof fp->buf);	/* Clear sector buffer */
@@ -4722,6 +4989,11 @@ FRESULT f_open (
 	if (res != FR_OK) {
 		fp->obj.fs = 0;        /* Invalidate file object on error */
 	}
+#if FF_FS_RWLOCK
+	else if (!(fp->flag & FA_WRITE)) {
+		get_rwbuf(fp);		/* Read only file, shares the volume if a FAT buffer is free */
+	}
+#endif
 
 	LEAVE_FF(fs, res);
 }
@@ -4747,10 +5019,17 @@ FRESULT f_read (
 	FSIZE_t remain;
 	UINT rcnt, cc, csect;
 	BYTE *rbuff = (BYTE *)buff;
+#if FF_USE_CONTIG
+	DWORD ccl;
+#endif
 
 
 	*br = 0;	/* Clear read byte counter */
+#if FF_FS_RWLOCK
+	res = validate_read(fp, &fs);				/* Check validity of the file object, shared for a reader */
+#else
 	res = validate(&fp->obj, &fs);				/* Check validity of the file object */
+#endif
 	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) {
 		LEAVE_FF(fs, res);        /* Check validity */
 	}
@@ -4777,7 +5056,7 @@ FRESULT f_read (
 					else
 #endif
 					{
-						clst = get_fat(&fp->obj, fp->clust);	/* Follow cluster chain on the FAT */
+						clst = get_fat_win(&fp->obj, fp->clust, fp);	/* Follow cluster chain on the FAT */
 					}
 				}
 				if (clst < 2) {
@@ -4795,12 +5074,24 @@ FRESULT f_read (
 			sect += csect;
 			cc = btr / SS(fs);					/* When remaining bytes >= sector size, */
 			if (cc > 0) {						/* Read maximum contiguous sectors directly */
+#if FF_USE_CONTIG
+				ccl = (DWORD)(fp->fptr / SS(fs) / fs->csize);	/* Cluster index in the file */
+				if (ccl < fp->ncont) {			/* Clip at end of the contiguous area */
+					if (cc > (fp->ncont - ccl) * fs->csize - csect) {
+						cc = (fp->ncont - ccl) * fs->csize - csect;
+					}
+				}
+				else
+#endif
 				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
 					cc = fs->csize - csect;
 				}
-				if (disk_read(fs->pdrv, rbuff, sect, cc) != RES_OK) {
+				if (READ_FILE(fs, fp, rbuff, sect, cc) != RES_OK) {
 					ABORT(fs, FR_DISK_ERR);
 				}
+#if FF_USE_CONTIG
+				fp->clust += (csect + cc - 1) / fs->csize;	/* Move to the cluster of the last sector read */
+#endif
 #if !FF_FS_READONLY && FF_FS_MINIMIZE <= 2		/* Replace one of the read sectors with cached data if it contains a dirty sector */
 #if FF_FS_TINY
 				if (fs->wflag && fs->winsect - sect < cc) {
@@ -4825,7 +5116,7 @@ FRESULT f_read (
 					fp->flag &= (BYTE)~FA_DIRTY;
 				}
 #endif
-				if (disk_read(fs->pdrv, fp->buf, sect, 1) != RES_OK) {
+				if (READ_FILE(fs, fp, fp->buf, sect, 1) != RES_OK) {
 					ABORT(fs, FR_DISK_ERR);        /* Fill sector cache */
 				}
 			}
@@ -5114,6 +5405,9 @@ FRESULT f_close (
 	{
 		res = validate(&fp->obj, &fs);	/* Lock volume */
 		if (res == FR_OK) {
+#if FF_FS_RWLOCK
+			put_rwbuf(fp);		/* Release the FAT buffer */
+#endif
 #if FF_FS_LOCK
 			res = dec_share(fp->obj.lockid);		/* Decrement file open counter */
 			if (res == FR_OK) {
@@ -5369,7 +5663,11 @@ FRESULT f_lseek (
 	LBA_t dsc;
 #endif
 
+#if FF_FS_RWLOCK
+	res = validate_read(fp, &fs);		/* Check validity of the file object, shared for a reader */
+#else
 	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
+#endif
 	if (res == FR_OK) {
 		res = (FRESULT)fp->err;
 	}
@@ -5398,7 +5696,7 @@ FRESULT f_lseek (
 					do {
 						pcl = cl;
 						ncl++;
-						cl = get_fat(&fp->obj, cl);
+						cl = get_fat_win(&fp->obj, cl, fp);
 						if (cl <= 1) {
 							ABORT(fs, FR_INT_ERR);
 						}
@@ -5444,7 +5742,7 @@ FRESULT f_lseek (
 						fp->flag &= (BYTE)~FA_DIRTY;
 					}
 #endif
-					if (disk_read(fs->pdrv, fp->buf, dsc, 1) != RES_OK) {
+					if (READ_FILE(fs, fp, fp->buf, dsc, 1) != RES_OK) {
 						ABORT(fs, FR_DISK_ERR);        /* Load current sector */
 					}
 #endif
@@ -5510,9 +5808,15 @@ FRESULT f_lseek (
 						}
 					}
 					else
+#endif
+#if FF_USE_CONTIG
+					if (fp->fptr / bcs < fp->ncont) {
+						clst++;							/* Next cluster in the contiguous area */
+					}
+					else
 #endif
 					{
-						clst = get_fat(&fp->obj, clst);	/* Follow cluster chain if not in write mode */
+						clst = get_fat_win(&fp->obj, clst, fp);	/* Follow cluster chain if not in write mode */
 					}
 					if (clst == 0xFFFFFFFF) {
 						ABORT(fs, FR_DISK_ERR);
@@ -5546,7 +5850,7 @@ FRESULT f_lseek (
 				fp->flag &= (BYTE)~FA_DIRTY;
 			}
 #endif
-			if (disk_read(fs->pdrv, fp->buf, nsect, 1) != RES_OK) {
+			if (READ_FILE(fs, fp, fp->buf, nsect, 1) != RES_OK) {
 				ABORT(fs, FR_DISK_ERR);        /* Fill sector cache */
 			}
 #endif
@@ -5965,6 +6269,12 @@ FRESULT f_truncate (
 		}
 		fp->obj.objsize = fp->fptr;	/* Set file size to current read/write point */
 		fp->flag |= FA_MODIFIED;
+#if FF_USE_CONTIG
+		ncl = (DWORD)((fp->fptr + (DWORD)fs->csize * SS(fs) - 1) / ((DWORD)fs->csize * SS(fs)));
+		if (fp->ncont > ncl) {
+			fp->ncont = ncl;		/* Clip contiguous area at the new file size */
+		}
+#endif
 #if !FF_FS_TINY
 		if (res == FR_OK && (fp->flag & FA_DIRTY)) {
 			if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) {
@@ -6772,6 +7082,9 @@ FRESULT f_expand (
 		if (opt) {	/* Is it allocated now? */
 			fp->obj.sclust = scl;		/* Update object allocation information */
 			fp->obj.objsize = fsz;
+#if FF_USE_CONTIG
+			fp->ncont = tcl;
+#endif
 			if (FF_FS_EXFAT) {
 				fp->obj.stat = 2;        /* Set status 'contiguous chain' */
 			}
@@ -6884,6 +7197,98 @@ FRESULT f_forward (
 
 
 
+#if FF_USE_READPTR
+/*-----------------------------------------------------------------------*/
+/* Read Data in Place (memory mapped drive)                              */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_readptr (
+	FIL *fp, 		/* Open file to be read */
+	const void **ptr,	/* Pointer to the variable to return the address of the data */
+	UINT btr,		/* Number of bytes to read */
+	UINT *br		/* Number of bytes available at the address */
+)
+{
+	FRESULT res = FR_DISK_ERR;
+	FATFS *fs;
+	DWORD clst, nxt, bcs;
+	LBA_t sect;
+	FSIZE_t remain;
+	UINT cofs, rcnt;
+	UINTPTR addr;
+
+
+	*ptr = 0;
+	*br = 0;	/* Clear read byte counter */
+	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
+	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) {
+		LEAVE_FF(fs, res);
+	}
+	if (!(fp->flag & FA_READ)) {
+		LEAVE_FF(fs, FR_DENIED);        /* Check access mode */
+	}
+	remain = fp->obj.objsize - fp->fptr;
+	if (btr > remain) {
+		btr = (UINT)remain;        /* Truncate btr by remaining bytes */
+	}
+	if (btr == 0) {
+		LEAVE_FF(fs, FR_OK);
+	}
+#if !FF_FS_READONLY
+	if (fp->flag & FA_DIRTY) {		/* Write-back dirty sector cache, the data is read in place */
+		if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) {
+			ABORT(fs, FR_DISK_ERR);
+		}
+		fp->flag &= (BYTE)~FA_DIRTY;
+	}
+#endif
+
+	bcs = (DWORD)fs->csize * SS(fs);	/* Cluster size (byte) */
+	cofs = (UINT)(fp->fptr % bcs);		/* Offset in the cluster */
+	if (cofs == 0) {					/* On the cluster boundary? */
+		clst = (fp->fptr == 0) ?		/* On the top of the file? */
+		       fp->obj.sclust : get_fat(&fp->obj, fp->clust);
+		if (clst <= 1) {
+			ABORT(fs, FR_INT_ERR);
+		}
+		if (clst == 0xFFFFFFFF) {
+			ABORT(fs, FR_DISK_ERR);
+		}
+		fp->clust = clst;				/* Update current cluster */
+	}
+	sect = clst2sect(fs, fp->clust);	/* Get current data sector */
+	if (sect == 0) {
+		ABORT(fs, FR_INT_ERR);
+	}
+	addr = (UINTPTR)(sect + cofs / SS(fs));
+	if (disk_ioctl(fs->pdrv, GET_SECTOR_ADDR, &addr) != RES_OK) {
+		LEAVE_FF(fs, FR_DENIED);        /* The drive is not memory mapped */
+	}
+
+	rcnt = (UINT)(bcs - cofs);			/* Number of bytes remains in the cluster */
+	clst = fp->clust;
+	while (rcnt < btr) {				/* Extend the data over the following contiguous clusters */
+		nxt = get_fat(&fp->obj, clst);
+		if (nxt != clst + 1) {
+			break;        /* Fragmented, the next call continues from here */
+		}
+		clst = nxt;
+		rcnt = (btr - rcnt > bcs) ? rcnt + (UINT)bcs : btr;
+	}
+	if (rcnt > btr) {
+		rcnt = btr;        /* Clip it by btr if needed */
+	}
+	fp->clust = clst;					/* Cluster of the last byte returned */
+	fp->fptr += rcnt;
+	*ptr = (const void *)(addr + cofs % SS(fs));
+	*br = rcnt;
+
+	LEAVE_FF(fs, FR_OK);
+}
+#endif /* FF_USE_READPTR */
+
+
+
 #if !FF_FS_READONLY && FF_USE_MKFS
 /*-----------------------------------------------------------------------*/
 /* Create FAT/exFAT volume (with sub-functions)                          */
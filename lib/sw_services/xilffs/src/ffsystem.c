@@ -39,30 +39,34 @@ void ff_memfree (
 /* Definitions of Mutex                                                   */
 /*------------------------------------------------------------------------*/
 
-#define OS_TYPE	0	/* 0:Win32, 1:uITRON4.0, 2:uC/OS-II, 3:FreeRTOS, 4:CMSIS-RTOS */
+#define OS_TYPE	3	/* 0:Win32, 1:uITRON4.0, 2:uC/OS-II, 3:FreeRTOS, 4:CMSIS-RTOS */
+
+/* Volume mutexes, system mutex and, with FF_FS_RWLOCK, the I/O mutexes of
+/  the shared readers (FF_VOLUMES + 1 + vol) */
+#define MUTEX_NUM	(FF_VOLUMES + 1 + (FF_FS_RWLOCK ? FF_VOLUMES : 0))
 
 
 #if   OS_TYPE == 0	/* Win32 */
 #include <windows.h>
-static HANDLE Mutex[FF_VOLUMES + 1];	/* Table of mutex handle */
+static HANDLE Mutex[MUTEX_NUM];	/* Table of mutex handle */
 
 #elif OS_TYPE == 1	/* uITRON */
 #include "itron.h"
 #include "kernel.h"
-static mtxid Mutex[FF_VOLUMES + 1];		/* Table of mutex ID */
+static mtxid Mutex[MUTEX_NUM];		/* Table of mutex ID */
 
 #elif OS_TYPE == 2	/* uc/OS-II */
 #include "includes.h"
-static OS_EVENT *Mutex[FF_VOLUMES + 1];	/* Table of mutex pinter */
+static OS_EVENT *Mutex[MUTEX_NUM];	/* Table of mutex pinter */
 
 #elif OS_TYPE == 3	/* FreeRTOS */
 #include "FreeRTOS.h"
 #include "semphr.h"
-static SemaphoreHandle_t Mutex[FF_VOLUMES + 1];	/* Table of mutex handle */
+static SemaphoreHandle_t Mutex[MUTEX_NUM];	/* Table of mutex handle */
 
 #elif OS_TYPE == 4	/* CMSIS-RTOS */
 #include "cmsis_os.h"
-static osMutexId Mutex[FF_VOLUMES + 1];	/* Table of mutex ID */
+static osMutexId Mutex[MUTEX_NUM];	/* Table of mutex ID */
 
 #endif
 
@@ -77,7 +81,7 @@ static osMutexId Mutex[FF_VOLUMES + 1];	/* Table of mutex ID */
 */
 
 int ff_mutex_create (	/* Returns 1:Function succeeded or 0:Could not create the mutex */
-	int vol				/* Mutex ID: Volume mutex (0 to FF_VOLUMES - 1) or system mutex (FF_VOLUMES) */
+	int vol				/* Mutex ID: Volume mutex (0 to FF_VOLUMES - 1), system mutex (FF_VOLUMES) or I/O mutex */
 )
 {
 #if OS_TYPE == 0	/* Win32 */
@@ -118,7 +122,7 @@ int ff_mutex_create (	/* Returns 1:Function succeeded or 0:Could not create the
 */
 
 void ff_mutex_delete (	/* Returns 1:Function succeeded or 0:Could not delete due to an error */
-	int vol				/* Mutex ID: Volume mutex (0 to FF_VOLUMES - 1) or system mutex (FF_VOLUMES) */
+	int vol				/* Mutex ID: Volume mutex (0 to FF_VOLUMES - 1), system mutex (FF_VOLUMES) or I/O mutex */
 )
 {
 #if OS_TYPE == 0	/* Win32 */
@@ -150,7 +154,7 @@ void ff_mutex_delete (	/* Returns 1:Function succeeded or 0:Could not delete due
 */
 
 int ff_mutex_take (	/* Returns 1:Succeeded or 0:Timeout */
-	int vol			/* Mutex ID: Volume mutex (0 to FF_VOLUMES - 1) or system mutex (FF_VOLUMES) */
+	int vol			/* Mutex ID: Volume mutex (0 to FF_VOLUMES - 1), system mutex (FF_VOLUMES) or I/O mutex */
 )
 {
 #if OS_TYPE == 0	/* Win32 */
@@ -183,7 +187,7 @@ int ff_mutex_take (	/* Returns 1:Succeeded or 0:Timeout */
 */
 
 void ff_mutex_give (
-	int vol			/* Mutex ID: Volume mutex (0 to FF_VOLUMES - 1) or system mutex (FF_VOLUMES) */
+	int vol			/* Mutex ID: Volume mutex (0 to FF_VOLUMES - 1), system mutex (FF_VOLUMES) or I/O mutex */
 )
 {
 #if OS_TYPE == 0	/* Win32 */
@@ -205,3 +209,137 @@ void ff_mutex_give (
 }
 
 #endif	/* FF_FS_REENTRANT */
+
+
+
+
+#if FF_FS_RWLOCK	/* Reader/writer lock */
+/*------------------------------------------------------------------------*/
+/* Definitions of Reader/Writer Lock                                      */
+/*------------------------------------------------------------------------*/
+/* A writer holds the turnstile of the volume for the whole access, so that
+/  readers arriving after it wait behind it. The first reader in takes the
+/  room and the last reader out releases it, a writer takes the room after
+/  the turnstile.
+*/
+
+#if OS_TYPE != 3
+#error The reader/writer lock is available for FreeRTOS only
+#endif
+
+static SemaphoreHandle_t RwTurn[FF_VOLUMES];	/* Turnstile mutex */
+static SemaphoreHandle_t RwCount[FF_VOLUMES];	/* Mutex of the reader count */
+static SemaphoreHandle_t RwRoom[FF_VOLUMES];	/* Binary semaphore, taken while the volume is in use */
+static UINT RwReaders[FF_VOLUMES];				/* Number of shared readers */
+
+
+
+/*------------------------------------------------------------------------*/
+/* Create a Reader/Writer Lock                                            */
+/*------------------------------------------------------------------------*/
+/* This function is called in f_mount function instead of ff_mutex_create
+/  for the volume. When a 0 is returned, the f_mount function fails with
+/  FR_INT_ERR.
+*/
+
+int ff_rwlock_create (	/* Returns 1:Function succeeded or 0:Could not create the lock */
+	int vol				/* Volume (0 to FF_VOLUMES - 1) */
+)
+{
+	RwTurn[vol] = xSemaphoreCreateMutex();
+	RwCount[vol] = xSemaphoreCreateMutex();
+	RwRoom[vol] = xSemaphoreCreateBinary();
+	RwReaders[vol] = 0;
+	if (RwTurn[vol] == NULL || RwCount[vol] == NULL || RwRoom[vol] == NULL) {
+		ff_rwlock_delete(vol);
+		return 0;
+	}
+	xSemaphoreGive(RwRoom[vol]);	/* The room is free */
+	return 1;
+}
+
+
+/*------------------------------------------------------------------------*/
+/* Delete a Reader/Writer Lock                                            */
+/*------------------------------------------------------------------------*/
+
+void ff_rwlock_delete (
+	int vol				/* Volume (0 to FF_VOLUMES - 1) */
+)
+{
+	if (RwTurn[vol] != NULL) {
+		vSemaphoreDelete(RwTurn[vol]);
+		RwTurn[vol] = NULL;
+	}
+	if (RwCount[vol] != NULL) {
+		vSemaphoreDelete(RwCount[vol]);
+		RwCount[vol] = NULL;
+	}
+	if (RwRoom[vol] != NULL) {
+		vSemaphoreDelete(RwRoom[vol]);
+		RwRoom[vol] = NULL;
+	}
+}
+
+
+/*------------------------------------------------------------------------*/
+/* Request a Shared or Exclusive Grant to Access the Volume               */
+/*------------------------------------------------------------------------*/
+/* When a 0 is returned, the file function fails with FR_TIMEOUT.
+*/
+
+int ff_rwlock_take (	/* Returns 1:Succeeded or 0:Timeout */
+	int vol,			/* Volume (0 to FF_VOLUMES - 1) */
+	int shared			/* 1:Reader, 0:Writer */
+)
+{
+	int rv = 0;
+
+
+	if (xSemaphoreTake(RwTurn[vol], FF_FS_TIMEOUT) != pdTRUE) {
+		return 0;
+	}
+	if (!shared) {		/* Writer keeps the turnstile until it leaves */
+		if (xSemaphoreTake(RwRoom[vol], FF_FS_TIMEOUT) == pdTRUE) {
+			return 1;
+		}
+		xSemaphoreGive(RwTurn[vol]);
+		return 0;
+	}
+	if (xSemaphoreTake(RwCount[vol], FF_FS_TIMEOUT) == pdTRUE) {
+		rv = 1;
+		if (RwReaders[vol] == 0) {	/* First reader takes the room */
+			rv = (int)(xSemaphoreTake(RwRoom[vol], FF_FS_TIMEOUT) == pdTRUE);
+		}
+		if (rv) {
+			RwReaders[vol]++;
+		}
+		xSemaphoreGive(RwCount[vol]);
+	}
+	xSemaphoreGive(RwTurn[vol]);
+	return rv;
+}
+
+
+/*------------------------------------------------------------------------*/
+/* Release a Shared or Exclusive Grant to Access the Volume               */
+/*------------------------------------------------------------------------*/
+
+void ff_rwlock_give (
+	int vol,			/* Volume (0 to FF_VOLUMES - 1) */
+	int shared			/* 1:Reader, 0:Writer */
+)
+{
+	if (!shared) {
+		xSemaphoreGive(RwRoom[vol]);
+		xSemaphoreGive(RwTurn[vol]);
+		return;
+	}
+	xSemaphoreTake(RwCount[vol], portMAX_DELAY);
+	if (--RwReaders[vol] == 0) {	/* Last reader releases the room */
+		xSemaphoreGive(RwRoom[vol]);
+	}
+	xSemaphoreGive(RwCount[vol]);
+}
+
+#endif	/* FF_FS_RWLOCK */
@@ -76,6 +76,9 @@ DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff);
 #define ATA_GET_MODEL		21U	/* Get model name */
 #define ATA_GET_SN			22U	/* Get serial number */
 
+/* Memory mapped drive specific ioctl command */
+#define GET_SECTOR_ADDR		60U	/* Get address of a sector (UINTPTR, sector number in and address out) */
+
 #ifdef __cplusplus
 }
 #endif
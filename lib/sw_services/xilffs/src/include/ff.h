@@ -171,6 +171,10 @@ typedef struct {
 	LBA_t	bitbase;		/* Allocation bitmap base sector */
 #endif
 	LBA_t	winsect;		/* Current sector appearing in the win[] */
+#if FF_FS_RWLOCK
+	DWORD	fgen;			/* FAT generation, changed on every FAT update */
+	BYTE	wlock;			/* Volume is locked exclusively */
+#endif
 #ifdef __ICCARM__
 #pragma data_alignment = 32
 	BYTE	win[FF_MAX_SS];
@@ -224,6 +228,14 @@ typedef struct {
 #if FF_USE_FASTSEEK
 	DWORD*	cltbl;			/* Pointer to the cluster link map table (nulled on open, set by application) */
 #endif
+#if FF_USE_CONTIG
+	DWORD	ncont;			/* Number of contiguous clusters from top of the file */
+#endif
+#if FF_FS_RWLOCK
+	BYTE*	fwin;			/* Private FAT sector buffer of a shared reader (0:none) */
+	LBA_t	fwsect;			/* Sector number appearing in fwin[] */
+	DWORD	fwgen;			/* FAT generation of fwin[] */
+#endif
 #if !FF_FS_TINY
 #ifdef __ICCARM__
 #pragma data_alignment = 32
@@ -345,6 +357,7 @@ FRESULT f_getfree (const TCHAR* path, DWORD* nclst, FATFS** fatfs);	/* Get numbe
 FRESULT f_getlabel (const TCHAR* path, TCHAR* label, DWORD* vsn);	/* Get volume label */
 FRESULT f_setlabel (const TCHAR* label);							/* Set volume label */
 FRESULT f_forward (FIL* fp, UINT(*func)(const BYTE*,UINT), UINT btf, UINT* bf);	/* Forward data to the stream */
+FRESULT f_readptr (FIL* fp, const void** ptr, UINT btr, UINT* br);	/* Get address of the file data on a memory mapped drive */
 FRESULT f_expand (FIL* fp, FSIZE_t fsz, BYTE opt);					/* Allocate a contiguous block to the file */
 FRESULT f_mount (FATFS* fs, const TCHAR* path, BYTE opt);			/* Mount/Unmount a logical drive */
 FRESULT f_mkfs (const TCHAR* path, const MKFS_PARM* opt, void* work, UINT len);	/* Create a FAT volume */
@@ -400,6 +413,12 @@ void ff_mutex_delete (int vol);		/* Delete a sync object */
 int ff_mutex_take (int vol);		/* Lock sync object */
 void ff_mutex_give (int vol);		/* Unlock sync object */
 #endif
+#if FF_FS_RWLOCK	/* Reader/writer lock functions */
+int ff_rwlock_create (int vol);		/* Create a reader/writer lock */
+void ff_rwlock_delete (int vol);	/* Delete a reader/writer lock */
+int ff_rwlock_take (int vol, int shared);	/* Lock shared or exclusive */
+void ff_rwlock_give (int vol, int shared);	/* Unlock shared or exclusive */
+#endif
 
 
 
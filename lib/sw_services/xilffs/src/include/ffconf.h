@@ -73,6 +73,17 @@ extern "C" {
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
 
+#ifdef FILE_SYSTEM_USE_CONTIG
+#define FF_USE_CONTIG	1	/* 1:Enable */
+#else
+#define FF_USE_CONTIG	0	/* 0:Disable */
+#endif
+/* This option switches the contiguous file fast path. f_open() counts the
+/  contiguous clusters from the top of the file and f_read() and f_lseek()
+/  use them without following the FAT chain, so that large reads are issued
+/  as multi-cluster transfers. (0:Disable or 1:Enable) */
+
+
 #ifdef FILE_SYSTEM_USE_CHMOD
 #define FF_USE_CHMOD	1	/* 1:Enable */
 #else
@@ -91,6 +102,17 @@ extern "C" {
 /* This option switches f_forward() function. (0:Disable or 1:Enable) */
 
 
+#ifdef FILE_SYSTEM_USE_READPTR
+#define FF_USE_READPTR	1	/* 1:Enable */
+#else
+#define FF_USE_READPTR	0	/* 0:Disable */
+#endif
+/* This option switches f_readptr() function. It returns the address of the
+/  file data on a memory mapped drive, such as the RAM disk, instead of copying
+/  them. The disk_ioctl() function needs to implement GET_SECTOR_ADDR command.
+/  (0:Disable or 1:Enable) */
+
+
 #define FF_USE_STRFUNC	0
 #define FF_PRINT_LLI	1
 #define FF_PRINT_FLOAT	1
@@ -352,7 +374,11 @@ extern "C" {
 /      lock control is independent of re-entrancy. */
 
 
+#ifdef FILE_SYSTEM_FS_REENTRANT
+#define FF_FS_REENTRANT	1
+#else
 #define FF_FS_REENTRANT	0
+#endif
 #define FF_FS_TIMEOUT	1000
 /* The option FF_FS_REENTRANT switches the re-entrancy (thread safe) of the FatFs
 /  module itself. Note that regardless of this option, file access to different
@@ -367,6 +393,31 @@ extern "C" {
 /
 /  The FF_FS_TIMEOUT defines timeout period in unit of O/S time tick.
 */
+
+
+#if defined(FILE_SYSTEM_FS_REENTRANT) && defined(FILE_SYSTEM_READER_BUFS)
+#define FF_FS_RWLOCK	1
+#define FF_FS_RWBUFS	FILE_SYSTEM_READER_BUFS
+#else
+#define FF_FS_RWLOCK	0
+#define FF_FS_RWBUFS	0
+#endif
+/* The option FF_FS_RWLOCK switches the volume lock of the re-entrant
+/  configuration to a reader/writer lock. f_read() and f_lseek() on files
+/  opened without FA_WRITE share the volume with each other, all other
+/  functions lock the volume exclusively. A shared reader follows the FAT
+/  chain in a private sector buffer instead of the win[] of the volume.
+/  FF_FS_RWBUFS defines how many of these buffers each volume has; a read
+/  only file opened while all of them are in use locks the volume
+/  exclusively. Disk accesses of the shared readers are still serialized
+/  by a per-volume I/O mutex.
+/
+/   0: Disable reader/writer lock.
+/   1: Enable reader/writer lock. Also user provided lock handlers,
+/      ff_rwlock_create(), ff_rwlock_delete(), ff_rwlock_take() and
+/      ff_rwlock_give() function, must be added to the project. A sample for
+/      FreeRTOS is available in ffsystem.c.
+*/
 #ifdef FILE_SYSTEM_WORD_ACCESS
 #define FF_WORD_ACCESS	1
 #else
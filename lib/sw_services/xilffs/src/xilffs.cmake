@@ -17,9 +17,16 @@ SET(XILFFS_set_fs_rpath	 0 CACHE STRING "Configures relative path feature (valid
 SET_PROPERTY(CACHE XILFFS_set_fs_rpath PROPERTY STRINGS 0 1 2)
 option(XILFFS_word_access "Enables word access for misaligned memory access platform" ON)
 option(XILFFS_use_chmod "Enables use of CHMOD functionality for changing attributes (valid only with read_only set to false)" OFF)
+option(XILFFS_enable_reentrant "Enables thread safe access with a lock per volume, FreeRTOS only (use_lfn must not be 1)" OFF)
+SET(XILFFS_reader_bufs 0 CACHE STRING "Number of FAT sector buffers per volume that let read only files be read concurrently, 0 locks every access exclusively (valid only with enable_reentrant set to true)")
+option(XILFFS_use_contig "Enables the contiguous file fast path for large sequential reads" OFF)
+
+SET(XILFFS_sector_cache_size 0 CACHE STRING "Number of SD sectors held by the write-back sector cache, 0 disables the cache")
+SET(XILFFS_cache_burst_size 8 CACHE STRING "Number of sectors of the sector cache read-ahead and of one coalesced write back")
 
 SET(XILFFS_ramfs_size 3145728 CACHE STRING "RAM FS size")
 SET(XILFFS_ramfs_start_addr CACHE STRING "RAM FS start address")
+option(XILFFS_use_readptr "Enables f_readptr() to read the RAM disk in place without copying (valid only with fs_interface set to 2)" OFF)
 
 if (${XILFFS_fs_interface} EQUAL 2)
 	set(FILE_SYSTEM_INTERFACE_RAM " ")
@@ -29,10 +36,17 @@ if (${XILFFS_fs_interface} EQUAL 2)
 	else()
 		set(RAMFS_START_ADDR 0x10000000)
 	endif()
+	if (${XILFFS_use_readptr})
+		set(FILE_SYSTEM_USE_READPTR " ")
+	endif()
 endif()
 
 if (${XILFFS_fs_interface} EQUAL 1)
 	set(FILE_SYSTEM_INTERFACE_SD " ")
+	if (${XILFFS_sector_cache_size} GREATER 0)
+		set(FILE_SYSTEM_SECTOR_CACHE_SIZE ${XILFFS_sector_cache_size})
+		set(FILE_SYSTEM_CACHE_BURST ${XILFFS_cache_burst_size})
+	endif()
 endif()
 
 if (${XILFFS_fs_interface})
@@ -52,6 +66,19 @@ if (${XILFFS_fs_interface})
 	if (${XILFFS_enable_multi_partition})
 		set(FILE_SYSTEM_MULTI_PARTITION " ")
 	endif()
+	if (${XILFFS_enable_reentrant})
+		if ("${CMAKE_SYSTEM_NAME}" STREQUAL "FreeRTOS")
+			set(FILE_SYSTEM_FS_REENTRANT " ")
+			if (${XILFFS_reader_bufs} GREATER 0)
+				set(FILE_SYSTEM_READER_BUFS ${XILFFS_reader_bufs})
+			endif()
+		else()
+			message("WARNING : Reentrant file system is supported only with FreeRTOS\n")
+		endif()
+	endif()
+	if (${XILFFS_use_contig})
+		set(FILE_SYSTEM_USE_CONTIG " ")
+	endif()
 	if (${XILFFS_use_chmod})
 		if (${XILFFS_read_only})
 			message("WARNING : Cannot Enable CHMOD in read only mode\n")
@@ -25,6 +25,7 @@
 *		      (CR 781697).
 * 4.7   akm  07/10/19 Updated XFlashAmd_Write() to use adjusted base address
 *                     in write operation(CR-1029074).
+* 4.11	fl   10/14/26 Added XFL_AMD_ERASE_QUEUE_SIZE.
 * </pre>
 *
 ******************************************************************************/
@@ -125,6 +126,8 @@ extern "C" {
 						  */
 #define XFL_COUNT_FOR_A_MICROSECOND	(63)	 /* Number of clock pulse for 1
 						  * micro second */
+#define XFL_AMD_ERASE_QUEUE_SIZE	(16)	 /* Blocks queued in one erase
+						  * operation */
 /**************************** Type Definitions *******************************/
 
 
@@ -59,6 +59,10 @@
 *		      in write operation(CR-1029074).
 * 4.7	akm  07/23/19 Initialized Status variable to XST_FAILURE.
 * 4.10	akm  07/14/23 Added support for system device-tree flow.
+* 4.11	fl   10/14/26 Queue up to XFL_AMD_ERASE_QUEUE_SIZE blocks in one
+*		      erase operation and defer polling by half of the typical
+*		      erase time. Program through the write buffer in page
+*		      aligned chunks of the CFI write buffer size.
 * </pre>
 *
 ******************************************************************************/
@@ -180,6 +184,8 @@ static int WriteBufferAmd(XFlash *InstancePtr, void *DestPtr,
 			  void *SrcPtr, u32 Bytes);
 static int WriteBufferSpansion(XFlash *InstancePtr, void *DestPtr,
 			       void *SrcPtr, u32 Bytes);
+static int ProgramBufferAmd(XFlash *InstancePtr, u32 WordAddr,
+			    u16 *SrcPtr, u32 Words);
 void AmdDevice_is_Ready(XFlash *InstancePtr);
 
 /************************** Variable Definitions *****************************/
@@ -313,6 +319,17 @@ int XFlashAmd_Initialize(XFlash *InstancePtr)
 	 */
 	GetPartID(InstancePtr);
 
+	/*
+	 * Parts of the standard command set accept more block addresses
+	 * within the erase timeout window and erase them in one operation.
+	 * Spansion parts are driven through the status register and keep
+	 * to one block.
+	 */
+	if (InstancePtr->Properties.PartID.ManufacturerID != 0x01) {
+		InstancePtr->Properties.ProgCap.EraseQueueSize =
+			XFL_AMD_ERASE_QUEUE_SIZE;
+	}
+
 	/*
 	 * Setup bank information as per the boot block location.
 	 */
@@ -632,9 +649,11 @@ int XFlashAmd_Erase(XFlash *InstancePtr, u32 Offset, u32 Bytes)
 	u16 EndBlock;
 	u16 BlocksLeft;
 	u16 BlocksQueued;
+	u16 Index;
 	u32 Dummy;
 	u32 StartOffset;
 	u32 EndOffset;
+	u32 PollOffset;
 	int Status = (int)XST_FAILURE;
 	XFlashGeometry *GeomPtr;
 	XFlashVendorData_Amd *DevDataPtr;
@@ -687,10 +706,26 @@ int XFlashAmd_Erase(XFlash *InstancePtr, u32 Offset, u32 Bytes)
 					     EndRegion, EndBlock);
 
 	while (BlocksLeft > 0) {
+		/*
+		 * The status shows in the bank of the blocks being erased,
+		 * poll the first block of this queue.
+		 */
+		(void) XFlashGeometry_ToAbsolute(GeomPtr, StartRegion,
+						 StartBlock, 0, &PollOffset);
 		BlocksQueued = EnqueueEraseBlocks(InstancePtr, &StartRegion,
 						  &StartBlock, BlocksLeft);
 		BlocksLeft -= BlocksQueued;
-		Status = DevDataPtr->PollSR(GeomPtr->BaseAddress, StartOffset);
+
+		/*
+		 * Leave the bus alone for half of the typical erase time of
+		 * the queued blocks before the toggle bits are read.
+		 */
+		for (Index = 0; Index < BlocksQueued; Index++) {
+			FlashPause((u32)InstancePtr->Properties.TimeTypical.
+				   EraseBlock_Ms * 500);
+		}
+
+		Status = DevDataPtr->PollSR(GeomPtr->BaseAddress, PollOffset);
 		if (Status != XFLASH_READY) {
 			(void) XFlashAmd_ResetBank(InstancePtr, StartOffset,
 						   Bytes);
@@ -1606,6 +1641,10 @@ static int WriteBuffer16(XFlash *InstancePtr, void *DestPtr,
 * the flash first and will fail if the block(s) are not erased first. The
 * device(s) are programmed in parallel.
 *
+* The data is programmed through the write buffer in chunks that do not cross
+* a write buffer page, the first one runs up to the next page boundary and
+* the following ones are full pages.
+*
 * @param	InstancePtr is the instance to work on.
 * @param	DestPtr is the physical destination address in flash memory
 *		space.
@@ -1623,30 +1662,29 @@ static int WriteBuffer16(XFlash *InstancePtr, void *DestPtr,
 static int WriteBufferSpansion(XFlash *InstancePtr, void *DestPtr,
 			       void *SrcPtr, u32 Bytes)
 {
-	u32 DestinationPtr = (u32)DestPtr;
-	u32 BaseAddress = InstancePtr->Geometry.BaseAddress;
 	u16 *Tempsrcptr = (u16 *)SrcPtr;
-	u32 Index = 0;
 	int Status = (int)XST_FAILURE;
-	XFlashVendorData_Amd *DevDataPtr = GET_PARTDATA(InstancePtr);
 	u32 BufferSize = InstancePtr->Properties.ProgCap.WriteBufferSize;
+	u32 AlignMask =
+		InstancePtr->Properties.ProgCap.WriteBufferAlignmentMask;
+	u32 Count;
 
 	while (Bytes != 0) {
-		/* Bytes to write should not exceed the buffer size. */
-		if (Bytes > BufferSize) {
-			Status = WriteSingleBuffer(InstancePtr, DestPtr,
-						   Tempsrcptr, BufferSize);
-			Bytes = Bytes - BufferSize;
-			DestPtr = DestPtr + BufferSize;
-			Tempsrcptr = Tempsrcptr + BufferSize / 2;
-		} else {
-			Status = WriteSingleBuffer(InstancePtr, DestPtr,
-						   Tempsrcptr, Bytes);
-			Bytes = 0;
+		/* Bytes to write should not cross the buffer page. */
+		Count = BufferSize - ((u32)DestPtr & AlignMask);
+		if (Count > Bytes) {
+			Count = Bytes;
 		}
+
+		Status = WriteSingleBuffer(InstancePtr, DestPtr, Tempsrcptr,
+					   Count);
 		if (Status != XST_SUCCESS) {
 			return Status;
 		}
+
+		Bytes = Bytes - Count;
+		DestPtr = (u8 *)DestPtr + Count;
+		Tempsrcptr = Tempsrcptr + Count / 2;
 	}
 
 	Status = (int)XST_SUCCESS;
@@ -1662,6 +1700,10 @@ static int WriteBufferSpansion(XFlash *InstancePtr, void *DestPtr,
 * the flash first and will fail if the block(s) are not erased first. The
 * device(s) are programmed in parallel.
 *
+* Parts with a write buffer in the CFI query table are programmed a buffer
+* page at a time with one status poll per page, the others a word at a time
+* in unlock bypass mode.
+*
 * @param	InstancePtr is the instance to work on.
 * @param	DestPtr is the physical destination address in flash memory
 *		space.
@@ -1685,6 +1727,33 @@ static int WriteBufferAmd(XFlash *InstancePtr, void *DestPtr,
 	u32 Index = 0;
 	int Status = (int)XST_FAILURE;
 	XFlashVendorData_Amd *DevDataPtr = GET_PARTDATA(InstancePtr);
+	u32 PageWords = InstancePtr->Properties.ProgCap.WriteBufferSize / 2;
+	u32 Words = (Bytes + 1) / 2;
+	u32 Count;
+
+	if (PageWords > 1) {
+		while (Words != 0) {
+			/* Words to write should not cross the buffer page. */
+			Count = PageWords - (DestinationPtr & (PageWords - 1));
+			if (Count > Words) {
+				Count = Words;
+			}
+
+			Status = ProgramBufferAmd(InstancePtr, DestinationPtr,
+						  &SourcePtr[Index], Count);
+			if (Status != XST_SUCCESS) {
+				(void) XFlashAmd_ResetBank(InstancePtr,
+							   (u32)DestPtr, Bytes);
+				return (Status);
+			}
+
+			DestinationPtr += Count;
+			Index += Count;
+			Words -= Count;
+		}
+
+		return (XST_SUCCESS);
+	}
 
 	/* Send the Unlock Bypass command. */
 	DevDataPtr->SendCmdSeq(BaseAddress,
@@ -1723,6 +1792,76 @@ static int WriteBufferAmd(XFlash *InstancePtr, void *DestPtr,
 
 	return (XST_SUCCESS);
 }
+
+/*****************************************************************************/
+/**
+*
+* This function programs one write buffer page of an Amd device and polls the
+* toggle bits once the page is committed.
+*
+* @param	InstancePtr is the instance to work on.
+* @param	WordAddr is the word offset of the first word to program.
+* @param	SrcPtr is the source data.
+* @param	Words is the number of words to program, the words must not
+*		cross a write buffer page.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XFLASH_ERROR if a write error occurred. This error is
+*		  usually device specific.
+*
+* @note		None.
+*
+******************************************************************************/
+static int ProgramBufferAmd(XFlash *InstancePtr, u32 WordAddr,
+			    u16 *SrcPtr, u32 Words)
+{
+	u16 Region;
+	u16 Block;
+	u32 Dummy;
+	u32 Index;
+	u32 SectorAddress;
+	u32 BaseAddress = InstancePtr->Geometry.BaseAddress;
+	int Status = (int)XST_FAILURE;
+	XFlashVendorData_Amd *DevDataPtr = GET_PARTDATA(InstancePtr);
+
+	Status = XFlashGeometry_ToBlock(&InstancePtr->Geometry, WordAddr,
+					&Region, &Block, &Dummy);
+	if (Status != XST_SUCCESS) {
+		return (XFLASH_ADDRESS_ERROR);
+	}
+	(void) XFlashGeometry_ToAbsolute(&InstancePtr->Geometry, Region,
+					 Block, 0, &SectorAddress);
+
+	/* Load the buffer and confirm it. */
+	DevDataPtr->SendCmdSeq(BaseAddress,
+			       XFL_AMD_CMD1_ADDR, XFL_AMD_CMD2_ADDR,
+			       XFL_AMD_CMD1_DATA, XFL_AMD_CMD2_DATA);
+	DevDataPtr->WriteFlash(BaseAddress, SectorAddress,
+			       XFL_AMD_CMD_WRITE_BUFFER);
+	DevDataPtr->WriteFlash(BaseAddress, SectorAddress, Words - 1);
+	for (Index = 0; Index < Words; Index++) {
+		DevDataPtr->WriteFlash(BaseAddress, WordAddr + Index,
+				       SrcPtr[Index]);
+	}
+	DevDataPtr->WriteFlash(BaseAddress, SectorAddress,
+			       XFL_AMD_CMD_PROGRAM_BUFFER);
+
+	/* The toggle bits show at the last loaded address. */
+	Status = DevDataPtr->PollSR(BaseAddress, WordAddr + Words - 1);
+	if (Status != XFLASH_READY) {
+		/* Write to buffer abort reset. */
+		DevDataPtr->SendCmdSeq(BaseAddress,
+				       XFL_AMD_CMD1_ADDR, XFL_AMD_CMD2_ADDR,
+				       XFL_AMD_CMD1_DATA, XFL_AMD_CMD2_DATA);
+		DevDataPtr->SendCmd(BaseAddress, XFL_AMD_CMD1_ADDR,
+				    XFL_AMD_CMD_RESET);
+		return (Status);
+	}
+
+	return (XST_SUCCESS);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -2271,12 +2410,15 @@ static void GetPartID(XFlash *InstancePtr)
 *		Region and Block parameters are incremented the number of blocks
 *		queued.
 *
-* @note		Limitation: Only support enqueuing one block at a time.
+* @note		Up to ProgCap.EraseQueueSize blocks are queued. Further blocks
+*		are added while DQ3 shows the erase timeout window still open,
+*		all of them are erased in one operation.
 *
 ******************************************************************************/
 static u16 EnqueueEraseBlocks(XFlash *InstancePtr, u16 *Region,
 			      u16 *Block, u16 MaxBlocks)
 {
+	u16 BlocksQueued;
 	u32 BlockAddress;
 	XFlashGeometry *GeomPtr;
 	XFlashVendorData_Amd *DevDataPtr;
@@ -2318,9 +2460,29 @@ static u16 EnqueueEraseBlocks(XFlash *InstancePtr, u16 *Region,
 
 	/* Increment Region/Block. */
 	XFL_GEOMETRY_INCREMENT(GeomPtr, *Region, *Block);
+	BlocksQueued = 1;
+
+	while ((BlocksQueued < MaxBlocks) &&
+	       (BlocksQueued < InstancePtr->Properties.ProgCap.EraseQueueSize)) {
+		/*
+		 * Once DQ3 is set the erase has started and further block
+		 * addresses are no longer accepted.
+		 */
+		if (DevDataPtr->GetStatus(GeomPtr->BaseAddress, BlockAddress) &
+		    XFL_AMD_SR_ERASE_START_MASK) {
+			break;
+		}
+
+		(void) XFlashGeometry_ToAbsolute(GeomPtr, *Region, *Block, 0,
+						 &BlockAddress);
+		DevDataPtr->WriteFlash(GeomPtr->BaseAddress, BlockAddress,
+				       XFL_AMD_CMD_ERASE_BLOCK);
+		XFL_GEOMETRY_INCREMENT(GeomPtr, *Region, *Block);
+		BlocksQueued++;
+	}
 
 	/* Return the number of blocks enqueued. */
-	return (1);
+	return (BlocksQueued);
 }
 
 /*****************************************************************************/
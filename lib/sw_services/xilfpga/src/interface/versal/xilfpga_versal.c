@@ -48,6 +48,8 @@
  * 6.5  Nava  07/17/23  Fixed compiler optimization issues relevant to the function
  *                      pointer validation checks.
  * 6.5  Nava  08/18/23  Resolved the doxygen issues.
+ * 6.6  fl    10/14/26  Added XFpga_BitStream_LoadAsync() and
+ *                      XFpga_BitStream_LoadPoll().
  * </pre>
  *
  * @note
@@ -66,6 +68,7 @@
 #define XMAILBOX_DEVICE_ID	0x0U
 #define FPGA_PDI_SRC_DDR	0xFU
 #define FPGA_IPI_TYPE_BLOCKING	0x1U
+#define FPGA_IPI_TYPE_NON_BLOCKING	0x0U
 
 /**************************** Type Definitions *******************************/
 
@@ -74,8 +77,15 @@
 /************************** Function Prototypes ******************************/
 
 static u32 XFpga_WriteToPl(XFpga *InstancePtr);
+static u32 XFpga_FillLoadReq(const XFpga *InstancePtr, u32 *ReqBuffer);
 /************************** Variable Definitions *****************************/
 
+/* Mailbox of the asynchronous load, PLM serves one request at a time */
+static XMailbox XFpga_AsyncMbox;
+static XFpga_LoadDoneHandler XFpga_AsyncHandler;
+static void *XFpga_AsyncRef;
+static u8 XFpga_AsyncPending;
+
 
 /* Create a constant pointer to XFpga_WriteToPl. */
 u32 (*const Write_To_Pl)(struct XFpgatag *InstancePtr) = XFpga_WriteToPl;
@@ -134,48 +144,210 @@ static u32 XFpga_WriteToPl(XFpga *InstancePtr)
 	XMailbox XMboxInstance;
 	u32 ReqBuffer[LOAD_PDI_MSG_LEN] = {0U};
 
-	UINTPTR BitstreamAddr = InstancePtr->WriteInfo.BitstreamAddr;
+	/* The IPI channel is taken by an asynchronous load */
+	if (XFpga_AsyncPending != 0U) {
+		Status = XFPGA_BUSY;
+		goto END;
+	}
 
 	Status = XMailbox_Initialize(&XMboxInstance, XMAILBOX_DEVICE_ID);
 	if (Status != (u32)XST_SUCCESS) {
 		goto END;
 	}
 
+	Status = XFPGA_FAILURE;
+	Status = XFpga_FillLoadReq(InstancePtr, ReqBuffer);
+	if (Status != XFPGA_SUCCESS) {
+		goto END;
+	}
+
+	/* Send an IPI Req Message */
+	Status = XFPGA_FAILURE;
+	Status = XMailbox_SendData(&XMboxInstance, XMAILBOX_IPIPMC, ReqBuffer,
+				   LOAD_PDI_MSG_LEN, XILMBOX_MSG_TYPE_REQ,
+				   FPGA_IPI_TYPE_BLOCKING);
+	if (Status != (u32)XST_SUCCESS) {
+		xil_printf("Sending Req Message Failed\n\r");
+		goto END;
+	}
+
+	Status = XFPGA_FAILURE;
+	Status = XMailbox_Recv(&XMboxInstance, XMAILBOX_IPIPMC, &RecBuffer,
+				FPGA_IPI_RESP1, XILMBOX_MSG_TYPE_RESP);
+	if (Status == (u32)XST_SUCCESS) {
+		Status = RecBuffer;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function fills the IPI request of a PDI load from the write details
+ * of the instance.
+ *
+ * @param InstancePtr Pointer to the XFpga structure.
+ * @param ReqBuffer Request buffer of LOAD_PDI_MSG_LEN words.
+ *
+ * @return	Returns Status
+ *		- XFPGA_SUCCESS on success
+ *		- XFPGA_FAILURE for an unknown load type
+ *
+ *****************************************************************************/
+static u32 XFpga_FillLoadReq(const XFpga *InstancePtr, u32 *ReqBuffer)
+{
+	u32 Status = XFPGA_FAILURE;
+	UINTPTR BitstreamAddr = InstancePtr->WriteInfo.BitstreamAddr;
+
 	if (InstancePtr->WriteInfo.Flags == XFPGA_DELAYED_PDI_LOAD) {
 		ReqBuffer[0U] = DELAYED_PDI_LOAD;
 		ReqBuffer[1U] = (u32)BitstreamAddr; /* Image ID */
 		ReqBuffer[2U] = 0U;
 		ReqBuffer[3U] = 0U;
+		Status = XFPGA_SUCCESS;
 	} else if (InstancePtr->WriteInfo.Flags == XFPGA_PDI_LOAD) {
 		ReqBuffer[0U] = PDI_LOAD;
 		ReqBuffer[1U] = FPGA_PDI_SRC_DDR;
 		ReqBuffer[2U] = UPPER_32_BITS(BitstreamAddr);
 		ReqBuffer[3U] = LOWER_32_BITS(BitstreamAddr);
+		Status = XFPGA_SUCCESS;
 	} else {
-		Status = XFPGA_FAILURE;
+		/* Unknown load type */
+	}
+
+	return Status;
+}
+
+/* @endcond */
+
+/*****************************************************************************/
+/**
+ * This API sends a PDI load request to the PLM and returns without waiting
+ * for the PL to be programmed. The application keeps running, for example to
+ * fetch the next PDI, and calls XFpga_BitStream_LoadPoll() until the load has
+ * ended.
+ *
+ * @param InstancePtr Pointer to the XFpga structure.
+ * @param BitstreamImageAddr PDI image base address for XFPGA_PDI_LOAD, image
+ *        ID for XFPGA_DELAYED_PDI_LOAD.
+ * @param Flags XFPGA_PDI_LOAD or XFPGA_DELAYED_PDI_LOAD.
+ * @param Handler Called by XFpga_BitStream_LoadPoll() with the status of the
+ *        load once it has ended. It may be NULL.
+ * @param CallBackRef Passed to Handler.
+ *
+ * @return Returns Status
+ *		- XFPGA_SUCCESS if the request was sent
+ *		- XFPGA_INVALID_PARAM for invalid arguments
+ *		- XFPGA_BUSY if a load is still in progress
+ *		- Error code on failure
+ *
+ * @note The PDI image must stay in memory until the load has ended. The PLM
+ *	 does not report progress within a load, only its completion.
+ *****************************************************************************/
+u32 XFpga_BitStream_LoadAsync(XFpga *InstancePtr, UINTPTR BitstreamImageAddr,
+			      u32 Flags, XFpga_LoadDoneHandler Handler,
+			      void *CallBackRef)
+{
+	volatile u32 Status = XFPGA_INVALID_PARAM;
+	u32 ReqBuffer[LOAD_PDI_MSG_LEN] = {0U};
+
+	/* Validate the input arguments */
+	if ((InstancePtr == NULL) ||
+	    ((Flags != XFPGA_PDI_LOAD) && (Flags != XFPGA_DELAYED_PDI_LOAD))) {
 		goto END;
 	}
 
-	/* Send an IPI Req Message */
+	if (XFpga_AsyncPending != 0U) {
+		Status = XFPGA_BUSY;
+		goto END;
+	}
+
+	InstancePtr->WriteInfo.BitstreamAddr = BitstreamImageAddr;
+	InstancePtr->WriteInfo.KeyAddr = 0U;
+	InstancePtr->WriteInfo.Size = 0U;
+	InstancePtr->WriteInfo.Flags = Flags;
+
 	Status = XFPGA_FAILURE;
-	Status = XMailbox_SendData(&XMboxInstance, XMAILBOX_IPIPMC, ReqBuffer,
+	Status = XFpga_FillLoadReq(InstancePtr, ReqBuffer);
+	if (Status != XFPGA_SUCCESS) {
+		goto END;
+	}
+
+	Status = XFPGA_FAILURE;
+	Status = XMailbox_Initialize(&XFpga_AsyncMbox, XMAILBOX_DEVICE_ID);
+	if (Status != (u32)XST_SUCCESS) {
+		goto END;
+	}
+
+	XFpga_AsyncHandler = Handler;
+	XFpga_AsyncRef = CallBackRef;
+
+	/* Send the IPI Req Message without waiting for the acknowledgement */
+	Status = XFPGA_FAILURE;
+	Status = XMailbox_SendData(&XFpga_AsyncMbox, XMAILBOX_IPIPMC, ReqBuffer,
 				   LOAD_PDI_MSG_LEN, XILMBOX_MSG_TYPE_REQ,
-				   FPGA_IPI_TYPE_BLOCKING);
+				   FPGA_IPI_TYPE_NON_BLOCKING);
 	if (Status != (u32)XST_SUCCESS) {
-		xil_printf("Sending Req Message Failed\n\r");
+		Status = XFPGA_UPDATE_ERR(XFPGA_WRITE_BITSTREAM_ERROR, Status);
+		goto END;
+	}
+
+	XFpga_AsyncPending = 1U;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This API checks, without waiting, whether the load started by
+ * XFpga_BitStream_LoadAsync() has ended. When it has, the PLM response is
+ * read and the load handler is called with it before this API returns.
+ *
+ * @param InstancePtr Pointer to the XFpga structure.
+ *
+ * @return Returns Status
+ *		- XFPGA_BUSY while the PLM is programming the PL
+ *		- XFPGA_SUCCESS if the PL was programmed
+ *		- XFPGA_INVALID_PARAM if no load is in progress
+ *		- Error code of the load on failure
+ *
+ * @note It can be called from the main loop or from a timer handler, but
+ *	 not from several contexts at the same time.
+ *****************************************************************************/
+u32 XFpga_BitStream_LoadPoll(XFpga *InstancePtr)
+{
+	volatile u32 Status = XFPGA_INVALID_PARAM;
+	u32 RecBuffer = XFPGA_FAILURE;
+
+	/* Validate the input arguments */
+	if ((InstancePtr == NULL) || (XFpga_AsyncPending == 0U)) {
+		goto END;
+	}
+
+	if (XMailbox_IsDone(&XFpga_AsyncMbox, XMAILBOX_IPIPMC) !=
+	    (u32)XST_SUCCESS) {
+		Status = XFPGA_BUSY;
 		goto END;
 	}
 
 	Status = XFPGA_FAILURE;
-	Status = XMailbox_Recv(&XMboxInstance, XMAILBOX_IPIPMC, &RecBuffer,
+	Status = XMailbox_Recv(&XFpga_AsyncMbox, XMAILBOX_IPIPMC, &RecBuffer,
 				FPGA_IPI_RESP1, XILMBOX_MSG_TYPE_RESP);
 	if (Status == (u32)XST_SUCCESS) {
 		Status = RecBuffer;
 	}
+	if (Status != XFPGA_SUCCESS) {
+		Status = XFPGA_UPDATE_ERR(XFPGA_WRITE_BITSTREAM_ERROR, Status);
+	}
+
+	XFpga_AsyncPending = 0U;
+	if (XFpga_AsyncHandler != NULL) {
+		XFpga_AsyncHandler(XFpga_AsyncRef, Status);
+	}
 
 END:
 	return Status;
 }
-
-/* @endcond */
 /** @} */
@@ -129,6 +129,8 @@
  * 6.5 Nava  08/18/23  Resolved the doxygen issues.
  * 6.5 ml    09/14/23  Fixed by proper type casting of the operands to fix
  *                     MISRA-C ciolations for Rule 10.3
+ * 6.6 fl    10/14/26  Added XFpga_BitStream_LoadStream() to load a
+ *                     non-secure bitstream from double-buffered chunks.
  * </pre>
  *
  * @note
@@ -136,6 +138,7 @@
  ******************************************************************************/
 /***************************** Include Files *********************************/
 #include "xilfpga.h"
+#include "xil_cache.h"
 
 /* @cond nocomments */
 /************************** Constant Definitions *****************************/
@@ -183,6 +186,9 @@
 #define XFPGA_AES_TAG_SIZE	(XSECURE_SECURE_HDR_SIZE + \
 				 XSECURE_SECURE_GCM_TAG_SIZE) /* AES block decryption tag size */
 
+/* Smallest stream chunk, it holds the Bootgen header and the Vivado sync search */
+#define XFPGA_STREAM_MIN_CHUNK		(0x4000U)
+
 #define XFPGA_REG_CONFIG_CMD_LEN	9U
 #define XFPGA_DATA_CONFIG_CMD_LEN	88U
 
@@ -224,7 +230,9 @@ static u32 XFpga_WriteToPlPcap(XFpga *InstancePtr);
 static u32 XFpga_PostConfigPcap(XFpga *InstancePtr);
 static u32 XFpga_PcapStatus(void);
 static void XFpga_SetFirmwareState(u8 State);
-static u32 XFpga_SelectEndianess(u8 *Buf, u32 Size, u32 *Pos);
+static u32 XFpga_SelectEndianess(u8 *Buf, u32 Size, u32 *Pos, u32 *Shift);
+static u32 XFpga_ValidateStreamHeader(UINTPTR Buf, u32 Bytes, u32 *Pos,
+				      u32 *Shift, u32 *Size);
 #if defined(XFPGA_READ_CONFIG_REG)
 static u32 XFpga_GetConfigRegPcap(const XFpga *InstancePtr);
 #endif
@@ -359,6 +367,7 @@ static u32 XFpga_ValidateBitstreamImage(XFpga *InstancePtr)
 	XSecure_ImageInfo *ImageHdrDataPtr =
 		&InstancePtr->PLInfo.SecureImageInfo;
 	u32 BitstreamPos = 0U;
+	u32 BitstreamShift = 0U;
 	u32 PartHeaderOffset = 0U;
 
 #ifndef XFPGA_SECURE_MODE
@@ -398,7 +407,7 @@ static u32 XFpga_ValidateBitstreamImage(XFpga *InstancePtr)
 			Status = XFpga_SelectEndianess(
 					 (u8 *)InstancePtr->WriteInfo.BitstreamAddr,
 					 (u32)InstancePtr->WriteInfo.Size,
-					 &BitstreamPos);
+					 &BitstreamPos, &BitstreamShift);
 
 			if (Status != XFPGA_SUCCESS) {
 				Status = XFPGA_PCAP_UPDATE_ERR(Status, (u32)0U);
@@ -765,6 +774,266 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * This function validates the first chunk of a streamed non-secure bitstream
+ * and finds where the configuration data starts.
+ *
+ * @param Buf Address of the first chunk.
+ * @param Bytes Number of bytes in the first chunk.
+ * @param Pos Set to the offset of the configuration data in the chunk.
+ * @param Shift Set to the number of bytes the chunk was moved down to word
+ *        align the configuration data.
+ * @param Size Set to the size of the configuration data in bytes for
+ *        Bootgen images, to 0 for Vivado images whose data runs up to the
+ *        end of the stream.
+ *
+ * @return Returns Status
+ *		- XFPGA_SUCCESS on success
+ *		- Error code on failure
+ *****************************************************************************/
+static u32 XFpga_ValidateStreamHeader(UINTPTR Buf, u32 Bytes, u32 *Pos,
+				      u32 *Shift, u32 *Size)
+{
+	volatile u32 Status = XFPGA_FAILURE;
+	u32 PartHeaderOffset;
+
+#ifndef XFPGA_SKIP_EFUSE_CHECK
+	/* eFUSE checks */
+	if ((XSecure_IsRsaEnabled() == XSECURE_ENABLED) ||
+	    (XSecure_IsEncOnlyEnabled() == XSECURE_ENABLED)) {
+		Status = XFPGA_PCAP_UPDATE_ERR((u32)XFPGA_ERROR_EFUSE_CHECK,
+					       (u32)0U);
+		goto END;
+	}
+#endif
+
+	if (Bytes < XFPGA_STREAM_MIN_CHUNK) {
+		Status = XFPGA_PCAP_UPDATE_ERR((u32)XFPGA_ERROR_BITSTREAM_FORMAT,
+					       (u32)0U);
+		goto END;
+	}
+
+	*Shift = 0U;
+	*Size = 0U;
+	Status = (u32)Xil_SMemCmp((u8 *)(Buf + BOOTGEN_DATA_OFFSET +
+					 SYNC_BYTE_POSITION),
+				  Bytes - (BOOTGEN_DATA_OFFSET + SYNC_BYTE_POSITION),
+				  BootgenBinFormat, ARRAY_LENGTH(BootgenBinFormat),
+				  ARRAY_LENGTH(BootgenBinFormat));
+	if (Status == (u32)XST_SUCCESS) {
+		PartHeaderOffset = Xil_In32(Buf + PARTATION_HEADER_OFFSET);
+		if ((PartHeaderOffset > (Bytes - WORD_LEN)) ||
+		    ((PartHeaderOffset & XFPGA_ADDR_WORD_ALIGN_MASK) != 0U)) {
+			Status = XFPGA_PCAP_UPDATE_ERR(
+					 (u32)XFPGA_ERROR_BITSTREAM_FORMAT, (u32)0U);
+			goto END;
+		}
+		*Size = Xil_In32(Buf + PartHeaderOffset) * WORD_LEN;
+		*Pos = BOOTGEN_DATA_OFFSET;
+		if (*Size == 0U) {
+			Status = XFPGA_PCAP_UPDATE_ERR(
+					 (u32)XFPGA_ERROR_BITSTREAM_FORMAT, (u32)0U);
+		}
+		goto END;
+	}
+
+	Status = XFpga_SelectEndianess((u8 *)Buf, Bytes, Pos, Shift);
+	if (Status != XFPGA_SUCCESS) {
+		Status = XFPGA_PCAP_UPDATE_ERR(Status, (u32)0U);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This API loads a non-secure bitstream into the PL without the whole image
+ * in memory. The image is read in chunks through a callback, for example a
+ * wrapper around f_read() of xilffs, into two buffers used in turn: while
+ * the CSU DMA sends chunk k to the PCAP the callback reads chunk k + 1 into
+ * the other buffer.
+ *
+ * @param InstancePtr Pointer to the XFpga structure.
+ * @param ReadFn Callback reading the next bytes of the image.
+ * @param CallBackRef Passed to ReadFn, for example the file handle.
+ * @param Buf0 First chunk buffer, word aligned.
+ * @param Buf1 Second chunk buffer, word aligned.
+ * @param ChunkSize Size of each buffer in bytes, a multiple of 4 and at least
+ *        16 KB so that the first chunk holds the bitstream header.
+ * @param Flags XFPGA_FULLBIT_EN or XFPGA_PARTIAL_EN.
+ *
+ * @return Returns Status
+ *		- XFPGA_SUCCESS on success
+ *		- XFPGA_INVALID_PARAM for invalid arguments or secure Flags
+ *		- Error code on failure, as for XFpga_BitStream_Load()
+ *
+ * @note Supports the same Vivado (.bit, .bin) and Bootgen (.bin) images as
+ *	 XFpga_BitStream_Load(). The image ends at the size given by the
+ *	 Bootgen header, or for Vivado images when ReadFn returns fewer bytes
+ *	 than asked. Authenticated and encrypted images need the whole image
+ *	 to verify and are not supported.
+ *****************************************************************************/
+u32 XFpga_BitStream_LoadStream(XFpga *InstancePtr, XFpga_StreamReadFn ReadFn,
+			       void *CallBackRef, UINTPTR Buf0, UINTPTR Buf1,
+			       u32 ChunkSize, u32 Flags)
+{
+	volatile u32 Status = XFPGA_INVALID_PARAM;
+	UINTPTR Buf[2U];
+	u32 Cur = 0U;
+	u32 Start;
+	u32 Len;
+	u32 NextLen = 0U;
+	u32 Shift = 0U;
+	u32 Remaining = 0U;
+	u32 ReadBytes = 0U;
+	u32 ReadStatus = XFPGA_SUCCESS;
+	u32 Words;
+	u32 Carry;
+	u32 Index;
+	u8 IsEof = 0U;
+	u8 IsLast = 0U;
+
+	/* Validate the input arguments */
+	if ((InstancePtr == NULL) || (ReadFn == NULL) ||
+	    (Buf0 == 0U) || (Buf1 == 0U) ||
+	    ((Buf0 & XFPGA_ADDR_WORD_ALIGN_MASK) != 0U) ||
+	    ((Buf1 & XFPGA_ADDR_WORD_ALIGN_MASK) != 0U) ||
+	    (ChunkSize < XFPGA_STREAM_MIN_CHUNK) ||
+	    ((ChunkSize & XFPGA_ADDR_WORD_ALIGN_MASK) != 0U) ||
+	    ((Flags & ~XFPGA_PARTIAL_EN) != 0U)) {
+		goto END;
+	}
+
+	Buf[0U] = Buf0;
+	Buf[1U] = Buf1;
+
+	Status = ReadFn(CallBackRef, Buf0, ChunkSize, &ReadBytes);
+	if ((Status != XFPGA_SUCCESS) || (ReadBytes > ChunkSize)) {
+		Status = XFPGA_UPDATE_ERR(XFPGA_VALIDATE_ERROR,
+				XFPGA_PCAP_UPDATE_ERR(
+				(u32)XFPGA_ERROR_BITSTREAM_LOAD_FAIL, (u32)0U));
+		goto END;
+	}
+	IsEof = (ReadBytes < ChunkSize) ? 1U : 0U;
+
+	Status = XFPGA_FAILURE;
+	Status = XFpga_ValidateStreamHeader(Buf0, ReadBytes, &Start, &Shift,
+					    &Remaining);
+	if (Status != XFPGA_SUCCESS) {
+		Status = XFPGA_UPDATE_ERR(XFPGA_VALIDATE_ERROR, Status);
+		goto END;
+	}
+	Len = ReadBytes - Shift - Start;
+
+	InstancePtr->WriteInfo.BitstreamAddr = Buf0 + Start;
+	InstancePtr->WriteInfo.KeyAddr = 0U;
+	InstancePtr->WriteInfo.Size = Remaining;
+	InstancePtr->WriteInfo.Flags = Flags;
+
+	Status = XFPGA_FAILURE;
+	Status = XFpga_PreConfigPcap(InstancePtr);
+	if (Status != XFPGA_SUCCESS) {
+		Status = XFPGA_UPDATE_ERR(XFPGA_PRE_CONFIG_ERROR, Status);
+		goto END;
+	}
+
+	/* Setup the SSS, setup the PCAP to receive from DMA source */
+	Xil_Out32(CSU_CSU_SSS_CFG, XFPGA_CSU_SSS_SRC_SRC_DMA);
+	Xil_Out32(CSU_PCAP_RDWR, 0x0U);
+
+	while (IsLast == 0U) {
+		if ((Remaining != 0U) && (Len >= Remaining)) {
+			Len = Remaining;
+			IsLast = 1U;
+		} else if (IsEof != 0U) {
+			IsLast = 1U;
+		} else {
+			/* More chunks to come */
+		}
+
+		Words = Len / WORD_LEN;
+		Carry = Len % WORD_LEN;
+		if (Words != 0U) {
+			Xil_DCacheFlushRange(Buf[Cur] + Start, Words * WORD_LEN);
+			XCsuDma_Transfer(CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+					 Buf[Cur] + Start, Words, 0U);
+		}
+
+		if (IsLast == 0U) {
+			/*
+			 * Move the bytes which do not fill a word to the other
+			 * buffer, then read the next chunk behind them while
+			 * the DMA runs.
+			 */
+			for (Index = 0U; Index < Carry; Index++) {
+				Xil_Out8(Buf[Cur ^ 1U] + Index,
+					 Xil_In8(Buf[Cur] + Start +
+						 (Words * WORD_LEN) + Index));
+			}
+			ReadStatus = ReadFn(CallBackRef, Buf[Cur ^ 1U] + Carry,
+					    ChunkSize - Carry, &ReadBytes);
+			if (ReadBytes > (ChunkSize - Carry)) {
+				ReadStatus = XFPGA_FAILURE;
+			}
+			IsEof = (ReadBytes < (ChunkSize - Carry)) ? 1U : 0U;
+			NextLen = Carry + ReadBytes;
+		}
+
+		if (Words != 0U) {
+			Status = XFPGA_FAILURE;
+			Status = XCsuDma_WaitForDoneTimeout(CsuDmaPtr,
+							    XCSUDMA_SRC_CHANNEL);
+			if (Status != XFPGA_SUCCESS) {
+				break;
+			}
+			XCsuDma_IntrClear(CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+					  XCSUDMA_IXR_DONE_MASK);
+			if (Remaining != 0U) {
+				Remaining -= Words * WORD_LEN;
+			}
+		}
+
+		Status = ReadStatus;
+		if (Status != XFPGA_SUCCESS) {
+			break;
+		}
+
+		Cur ^= 1U;
+		Start = 0U;
+		Len = NextLen;
+	}
+
+	if (Status == XFPGA_SUCCESS) {
+		Status = XFPGA_FAILURE;
+		Status = XFpga_PcapWaitForDone();
+	}
+	if (Status != XFPGA_SUCCESS) {
+		Status = XFPGA_UPDATE_ERR(XFPGA_WRITE_BITSTREAM_ERROR,
+				XFPGA_PCAP_UPDATE_ERR(
+				(u32)XFPGA_ERROR_BITSTREAM_LOAD_FAIL, (u32)0U));
+		goto END;
+	}
+
+	Status = XFPGA_FAILURE;
+	Status = XFpga_PLWaitForDone();
+	if (Status != XFPGA_SUCCESS) {
+		Status = XFPGA_UPDATE_ERR(XFPGA_WRITE_BITSTREAM_ERROR,
+					  XFPGA_PCAP_UPDATE_ERR(Status, (u32)0U));
+		goto END;
+	}
+
+	Status = XFPGA_FAILURE;
+	Status = XFpga_PostConfigPcap(InstancePtr);
+	if (Status != XFPGA_SUCCESS) {
+		Status = XFPGA_UPDATE_ERR(XFPGA_POST_CONFIG_ERROR, Status);
+	}
+
+END:
+	return Status;
+}
+
 #if defined(XFPGA_READ_CONFIG_DATA)
 /*****************************************************************************/
 /**
@@ -2587,13 +2856,15 @@ static u32 XFpga_GetFirmwareState(void)
  * @param Buf  Linear memory image base address
  * @param Size Size of the Bitstream Image(Number of bytes).
  * @Param Pos Bitstream First Dummy Word position.
+ * @param Shift Number of bytes the image was moved down to word align the
+ *        first dummy word.
  *
  * @return
  *	- XFPGA_SUCCESS if successful
  *	- XFPGA_ERROR_BITSTREAM_FORMAT if unsuccessful
  *
  *****************************************************************************/
-static u32 XFpga_SelectEndianess(u8 *Buf, u32 Size, u32 *Pos)
+static u32 XFpga_SelectEndianess(u8 *Buf, u32 Size, u32 *Pos, u32 *Shift)
 {
 	u32 Index;
 	u32 RegVal;
@@ -2658,6 +2929,7 @@ static u32 XFpga_SelectEndianess(u8 *Buf, u32 Size, u32 *Pos)
 			  ((u32)XCSUDMA_SRC_CHANNEL *
 			   (u32)(XCSUDMA_OFFSET_DIFF))), RegVal);
 	*Pos = Index;
+	*Shift = IsBitNonAligned;
 
 END:
 
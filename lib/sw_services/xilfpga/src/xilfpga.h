@@ -87,6 +87,9 @@
  * 6.5  Nava  08/18/23  Resolved the doxygen issues.
  * 6.5  Nava  08/02/23  Updated version info macro to align with the library mld version.
  * 6.5  Nava  09/04/23  Added proper ifdef platform checks for user-accessible APIs.
+ * 6.6  fl    10/14/26  Added XFpga_BitStream_LoadStream() for ZynqMP.
+ * 6.6  fl    10/14/26  Added XFpga_BitStream_LoadAsync() and
+ *                      XFpga_BitStream_LoadPoll() for Versal.
  * </pre>
  *
  *
@@ -147,6 +150,34 @@ typedef struct XFpgatag{
 	u32 FeatureList;
 #endif
 }XFpga;
+
+#if !defined(versal) && !defined(XFPGA_SECURE_IPI_MODE_EN)
+/**
+ * Callback reading the next bytes of a streamed bitstream, see
+ * XFpga_BitStream_LoadStream().
+ *
+ * @param CallBackRef Reference given to XFpga_BitStream_LoadStream().
+ * @param Buf Address to read to.
+ * @param Size Number of bytes to read.
+ * @param BytesRead Set to the number of bytes read, less than Size only at
+ *        the end of the image.
+ *
+ * @return XFPGA_SUCCESS or an error code which stops the load.
+ */
+typedef u32 (*XFpga_StreamReadFn)(void *CallBackRef, UINTPTR Buf, u32 Size,
+				  u32 *BytesRead);
+#endif
+
+#ifdef versal
+/**
+ * Callback called once an asynchronous PDI load has ended, see
+ * XFpga_BitStream_LoadAsync().
+ *
+ * @param CallBackRef Reference given to XFpga_BitStream_LoadAsync().
+ * @param Status XFPGA_SUCCESS or the error code of the load.
+ */
+typedef void (*XFpga_LoadDoneHandler)(void *CallBackRef, u32 Status);
+#endif
 /************************** Variable Definitions *****************************/
 /***************** Macros (Inline Functions) Definitions *********************/
 /*
@@ -162,6 +193,7 @@ typedef struct XFpgatag{
 #define XFPGA_POST_CONFIG_ERROR		(0x5U)
 #define XFPGA_OPS_NOT_IMPLEMENTED	(0x6U)
 #define XFPGA_INVALID_PARAM		(0x8U)
+#define XFPGA_BUSY			(0x9U)
 
 #ifndef versal
 #define XFPGA_FULLBIT_EN			(0x00000000U)
@@ -275,6 +307,16 @@ u32 XFpga_GetPlConfigData(XFpga *InstancePtr, UINTPTR ReadbackAddr,
 u32 XFpga_GetPlConfigReg(XFpga *InstancePtr, UINTPTR ReadbackAddr,
 			 u32 ConfigRegAddr);
 u32 XFpga_InterfaceStatus(XFpga *InstancePtr);
+#ifndef XFPGA_SECURE_IPI_MODE_EN
+u32 XFpga_BitStream_LoadStream(XFpga *InstancePtr, XFpga_StreamReadFn ReadFn,
+			       void *CallBackRef, UINTPTR Buf0, UINTPTR Buf1,
+			       u32 ChunkSize, u32 Flags);
+#endif
+#else
+u32 XFpga_BitStream_LoadAsync(XFpga *InstancePtr, UINTPTR BitstreamImageAddr,
+			      u32 Flags, XFpga_LoadDoneHandler Handler,
+			      void *CallBackRef);
+u32 XFpga_BitStream_LoadPoll(XFpga *InstancePtr);
 #pragma message ("From 2023.1 release onwards the XilFPGA BSP user configuration  flags ‘reg_readback_en’ and  ‘data_readback_en’ will be disabled by default but users can still be able to enable these flags as needed")
 #endif
 
@@ -516,6 +516,13 @@
  *                    flashes.
  * 5.14 akm  08/01/19 Initialized Status variable to XST_FAILURE.
  * 5.14	akm  09/09/19 Added message regarding deprecation of Xilisf.
+ * 5.15 fl   10/14/26 Added the request queue of xilisf_queue.c.
+ *			  New API:
+ *				XIsf_QueueInit()
+ *				XIsf_QueueAdd()
+ *				XIsf_QueuePoll()
+ *				XIsf_QueueWait()
+ *				XIsf_QueueGetStats()
  *
  *
  * </pre>
@@ -1089,6 +1096,75 @@ typedef struct {
 				  */
 } XIsf_BufferReadParam;
 
+/**
+ * The following definitions determine the type of operation queued with the
+ * XIsf_QueueAdd API.
+ */
+typedef enum {
+	XISF_QUEUE_READ,	/**< Read from the Serial Flash */
+	XISF_QUEUE_WRITE,	/**< Program the Serial Flash */
+	XISF_QUEUE_ERASE	/**< Erase the sectors of a range */
+} XIsf_QueueOperation;
+
+#define XISF_QUEUE_NUM_BANKS	2 /**< Flashes of a stacked connection */
+
+/**
+ * The following structure definition specifies a request of the queue.
+ */
+typedef struct {
+	XIsf_QueueOperation Operation;	/**< Queued operation */
+	u32 Address;		/**< Start address in the Serial Flash */
+	u8 *BufPtr;		/**< Data buffer, unused for erase */
+	u32 NumBytes;		/**< Number of bytes to read, program or
+				  *  erase
+				  */
+	u32 Done;		/**< Number of bytes completed */
+	u32 Chunk;		/**< Bytes of the program/erase in flight */
+} XIsf_QueueReq;
+
+/**
+ * The following structure definition specifies the throughput counters of
+ * the queue.
+ */
+typedef struct {
+	u32 NumReads;		/**< Read requests completed */
+	u32 NumWrites;		/**< Write requests completed */
+	u32 NumErases;		/**< Erase requests completed */
+	u64 BytesRead;		/**< Bytes read */
+	u64 BytesWritten;	/**< Bytes programmed */
+	u64 BytesErased;	/**< Bytes erased */
+	u32 StatusPolls;	/**< Status reads of busy flashes */
+	u32 Overlapped;		/**< Operations started while the other flash
+				  *  was busy
+				  */
+} XIsf_QueueStats;
+
+/**
+ * The following structure definition specifies the request queue of an
+ * XIsf instance.
+ */
+typedef struct {
+	XIsf *IsfPtr;		/**< Serial Flash instance */
+	XIsf_QueueReq *Req;	/**< Request ring supplied by the user */
+	u32 NumReq;		/**< Number of entries of the ring */
+	u32 Head;		/**< Oldest request */
+	u32 Count;		/**< Number of queued requests */
+	XIsf_ReadOperation ReadOp;	/**< Read operation of the requests */
+	int NumDummyBytes;	/**< Dummy bytes of the read operation */
+	u8 Overlap;		/**< Program/erase overlapped across banks */
+	u32 BankSize;		/**< Size of a flash of the stacked pair */
+	u32 BankReq[XISF_QUEUE_NUM_BANKS];
+	/**< Request in flight on each flash, NumReq if none */
+	XIsf_QueueStats Stats;	/**< Throughput counters */
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+	u8 CmdBfr[5];		/**< Command and address bytes */
+	u8 StatusCmd;		/**< Status or flag status command */
+	u8 FlashStatus[2] __attribute__ ((aligned(4)));
+	/**< Status read back */
+	XQspiPsu_Msg Msg[2];	/**< Messages of the transfers */
+#endif
+} XIsf_Queue;
+
 
 /************************** Variable Declaration *****************************/
 
@@ -1249,6 +1325,18 @@ void XIsf_IfaceHandler(void *CallBackRef, u32 StatusEvent,
 void XIsf_IfaceHandler(void *CallBackRef, u32 StatusEvent);
 #endif
 
+/*
+ * Functions of the request queue.
+ */
+int XIsf_QueueInit(XIsf_Queue *QueuePtr, XIsf *InstancePtr,
+		XIsf_QueueReq *ReqPtr, u32 NumReq,
+		XIsf_ReadOperation ReadOp, int NumDummyBytes);
+int XIsf_QueueAdd(XIsf_Queue *QueuePtr, XIsf_QueueOperation Operation,
+		u32 Address, u8 *BufPtr, u32 NumBytes);
+int XIsf_QueuePoll(XIsf_Queue *QueuePtr);
+int XIsf_QueueWait(XIsf_Queue *QueuePtr);
+void XIsf_QueueGetStats(XIsf_Queue *QueuePtr, XIsf_QueueStats *StatsPtr);
+
 #ifdef __cplusplus
 }
 #endif
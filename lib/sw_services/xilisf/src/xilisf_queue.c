@@ -0,0 +1,704 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xilisf_queue.c
+ *
+ * This file contains the request queue of the Serial Flash. Read, program
+ * and erase requests are queued with XIsf_QueueAdd() and carried out by
+ * XIsf_QueuePoll(), which starts as many of them as the flashes allow and
+ * returns without waiting for a program or erase to complete.
+ *
+ * With the QSPIPSU interface in stacked connection mode the program and
+ * erase operations are sent without waiting for the flash, the status of
+ * the busy flash is polled on the following calls. Requests for the other
+ * flash of the pair are started meanwhile, so a write or erase on one flash
+ * overlaps the operations on the other. Requests of one flash complete in
+ * the order they were queued. With the other interfaces and connection
+ * modes the requests are carried out in order with the blocking XIsf_Read(),
+ * XIsf_Write() and XIsf_Erase() APIs.
+ *
+ * Refer xilisf.h for a detailed description.
+ *
+ * <pre>
+ *
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who      Date     Changes
+ * ----- -------  -------- -----------------------------------------------
+ * 5.15  fl       10/14/26 First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "include/xilisf.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XISF_QUEUE_SR_BUSY_MASK		0x01 /**< Write in progress */
+#define XISF_QUEUE_FSR_READY_MASK	0x80 /**< Program/erase controller
+					       *  ready
+					       */
+#define XISF_QUEUE_3BYTE_ADDR_SIZE	0x1000000 /**< Flash size reached with
+						    *  3 byte addresses
+						    */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static u32 QueueSectorSize(XIsf *InstancePtr);
+static u32 QueueBank(XIsf_Queue *QueuePtr, u32 Address);
+static u32 QueueChunk(XIsf_Queue *QueuePtr, XIsf_QueueReq *ReqPtr);
+static int QueueStart(XIsf_Queue *QueuePtr, u32 Index);
+static int QueueCheckBank(XIsf_Queue *QueuePtr, u32 Bank);
+static void QueueComplete(XIsf_Queue *QueuePtr, XIsf_QueueReq *ReqPtr);
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+static int QueueIssue(XIsf_Queue *QueuePtr, XIsf_QueueReq *ReqPtr, u32 Bank);
+static int QueueIsBusy(XIsf_Queue *QueuePtr, u32 Bank, u8 *BusyPtr);
+#endif
+
+/************************** Variable Definitions *****************************/
+
+/************************** Function Definitions ******************************/
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API initializes a request queue of the Serial Flash.
+ *
+ * @param	QueuePtr	Pointer to the queue to be initialized.
+ * @param	InstancePtr	Pointer to the initialized XIsf instance.
+ * @param	ReqPtr		Array of NumReq requests holding the queue.
+ * @param	NumReq		Number of requests of the array.
+ * @param	ReadOp		Read operation used for the read requests,
+ *				such as XISF_READ or XISF_QUAD_OP_FAST_READ.
+ * @param	NumDummyBytes	Dummy bytes of the read operation.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if it fails.
+ *
+ * @note	The program and erase operations are overlapped only for the
+ *		QSPIPSU interface in stacked connection mode, with the flashes
+ *		in 4 byte addressing mode when larger than 16MB.
+ *
+ ******************************************************************************/
+int XIsf_QueueInit(XIsf_Queue *QueuePtr, XIsf *InstancePtr,
+		XIsf_QueueReq *ReqPtr, u32 NumReq,
+		XIsf_ReadOperation ReadOp, int NumDummyBytes)
+{
+	u32 Bank;
+
+	if ((QueuePtr == NULL) || (InstancePtr == NULL) || (ReqPtr == NULL))
+		return (int)(XST_FAILURE);
+
+	if ((InstancePtr->IsReady != TRUE) || (NumReq == 0U))
+		return (int)(XST_FAILURE);
+
+	(void)memset(QueuePtr, 0, sizeof(XIsf_Queue));
+	QueuePtr->IsfPtr = InstancePtr;
+	QueuePtr->Req = ReqPtr;
+	QueuePtr->NumReq = NumReq;
+	QueuePtr->ReadOp = ReadOp;
+	QueuePtr->NumDummyBytes = NumDummyBytes;
+	for (Bank = 0U; Bank < (u32)XISF_QUEUE_NUM_BANKS; Bank++)
+		QueuePtr->BankReq[Bank] = NumReq;
+
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+	if (InstancePtr->SpiInstPtr->Config.ConnectionMode ==
+			XISF_QSPIPS_CONNECTION_MODE_STACKED) {
+		QueuePtr->BankSize = (InstancePtr->NumSectors / 2U) *
+				InstancePtr->SectorSize;
+		if ((QueuePtr->BankSize <= XISF_QUEUE_3BYTE_ADDR_SIZE) ||
+			(InstancePtr->FourByteAddrMode == TRUE))
+			QueuePtr->Overlap = 1U;
+	}
+
+	/* Use the flag status register of the multi die Micron parts */
+	if ((InstancePtr->NumDie > (u8)1) &&
+		(InstancePtr->ManufacturerID ==
+			(u32)XISF_MANUFACTURER_ID_MICRON))
+		QueuePtr->StatusCmd = READ_FLAG_STATUS_CMD;
+	else
+		QueuePtr->StatusCmd = READ_STATUS_CMD;
+#endif
+
+	return (int)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API adds a request to the queue. The request is started by the
+ * following calls to XIsf_QueuePoll().
+ *
+ * @param	QueuePtr	Pointer to the XIsf_Queue.
+ * @param	Operation	XISF_QUEUE_READ, XISF_QUEUE_WRITE or
+ *				XISF_QUEUE_ERASE.
+ * @param	Address		Start address in the Serial Flash.
+ * @param	BufPtr		Buffer to read into or to program from, it must
+ *				stay valid until the request completes. Unused
+ *				for erase.
+ * @param	NumBytes	Number of bytes to read or program, or size of
+ *				the range whose sectors are erased.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FIFO_NO_ROOM if the queue is full.
+ *		- XST_FAILURE if the arguments are not valid.
+ *
+ ******************************************************************************/
+int XIsf_QueueAdd(XIsf_Queue *QueuePtr, XIsf_QueueOperation Operation,
+		u32 Address, u8 *BufPtr, u32 NumBytes)
+{
+	XIsf_QueueReq *ReqPtr;
+
+	if ((QueuePtr == NULL) || (NumBytes == 0U))
+		return (int)(XST_FAILURE);
+
+	if ((Operation != XISF_QUEUE_ERASE) && (BufPtr == NULL))
+		return (int)(XST_FAILURE);
+
+	if (QueuePtr->Count == QueuePtr->NumReq)
+		return (int)(XST_FIFO_NO_ROOM);
+
+	ReqPtr = &QueuePtr->Req[(QueuePtr->Head + QueuePtr->Count) %
+				QueuePtr->NumReq];
+	ReqPtr->Operation = Operation;
+	ReqPtr->Address = Address;
+	ReqPtr->BufPtr = BufPtr;
+	ReqPtr->NumBytes = NumBytes;
+	ReqPtr->Done = 0U;
+	ReqPtr->Chunk = 0U;
+	QueuePtr->Count++;
+
+	return (int)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API advances the queue. The status of the flashes with a program or
+ * erase in flight is checked, then the queued requests are started in order
+ * on the idle flashes. Reads are carried out before returning.
+ *
+ * @param	QueuePtr	Pointer to the XIsf_Queue.
+ *
+ * @return
+ *		- XST_SUCCESS if the queue is empty.
+ *		- XST_DEVICE_BUSY if requests are still in progress.
+ *		- XST_FAILURE if an operation failed, the queue must then be
+ *		initialized again.
+ *
+ ******************************************************************************/
+int XIsf_QueuePoll(XIsf_Queue *QueuePtr)
+{
+	int Status;
+	u32 Bank;
+	u32 Pos;
+	u32 Index;
+	u32 Seen = 0U;
+	XIsf_QueueReq *ReqPtr;
+
+	if (QueuePtr == NULL)
+		return (int)(XST_FAILURE);
+
+	for (Bank = 0U; Bank < (u32)XISF_QUEUE_NUM_BANKS; Bank++) {
+		Status = QueueCheckBank(QueuePtr, Bank);
+		if (Status != (int)(XST_SUCCESS))
+			return (int)(XST_FAILURE);
+	}
+
+	/*
+	 * Start the requests in order, a request waits for the earlier
+	 * requests of its flash.
+	 */
+	for (Pos = 0U; Pos < QueuePtr->Count; Pos++) {
+		Index = (QueuePtr->Head + Pos) % QueuePtr->NumReq;
+		ReqPtr = &QueuePtr->Req[Index];
+		if (ReqPtr->Done == ReqPtr->NumBytes)
+			continue;
+
+		Bank = QueueBank(QueuePtr, ReqPtr->Address + ReqPtr->Done);
+		if ((Seen & ((u32)1U << Bank)) != 0U)
+			continue;
+		Seen |= (u32)1U << Bank;
+
+		if (QueuePtr->BankReq[Bank] != QueuePtr->NumReq)
+			continue;
+
+		Status = QueueStart(QueuePtr, Index);
+		if (Status != (int)(XST_SUCCESS))
+			return (int)(XST_FAILURE);
+	}
+
+	/* Retire the completed requests */
+	while (QueuePtr->Count != 0U) {
+		ReqPtr = &QueuePtr->Req[QueuePtr->Head];
+		if (ReqPtr->Done != ReqPtr->NumBytes)
+			break;
+		QueuePtr->Head = (QueuePtr->Head + 1U) % QueuePtr->NumReq;
+		QueuePtr->Count--;
+	}
+
+	if (QueuePtr->Count != 0U)
+		return (int)(XST_DEVICE_BUSY);
+
+	return (int)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API polls the queue until all the requests are completed.
+ *
+ * @param	QueuePtr	Pointer to the XIsf_Queue.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if an operation failed.
+ *
+ ******************************************************************************/
+int XIsf_QueueWait(XIsf_Queue *QueuePtr)
+{
+	int Status;
+
+	do {
+		Status = XIsf_QueuePoll(QueuePtr);
+	} while (Status == (int)(XST_DEVICE_BUSY));
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API returns the throughput counters of the queue.
+ *
+ * @param	QueuePtr	Pointer to the XIsf_Queue.
+ * @param	StatsPtr	Pointer to the counters to be filled in.
+ *
+ * @return	None.
+ *
+ ******************************************************************************/
+void XIsf_QueueGetStats(XIsf_Queue *QueuePtr, XIsf_QueueStats *StatsPtr)
+{
+	Xil_AssertVoid(QueuePtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	*StatsPtr = QueuePtr->Stats;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function returns the sector size of the Serial Flash.
+ *
+ * @param	InstancePtr is a pointer to the XIsf instance.
+ *
+ * @return	Sector size in bytes.
+ *
+ ******************************************************************************/
+static u32 QueueSectorSize(XIsf *InstancePtr)
+{
+#if defined(XPAR_XISF_INTERFACE_PSQSPI) || \
+	defined(XPAR_XISF_INTERFACE_QSPIPSU) || \
+	defined(XPAR_XISF_INTERFACE_OSPIPSV)
+	return InstancePtr->SectorSize;
+#elif (XPAR_XISF_FLASH_FAMILY == ATMEL)
+	return (u32)InstancePtr->BytesPerPage *
+		(u32)InstancePtr->PagesPerBlock *
+		(u32)InstancePtr->BlocksPerSector;
+#else
+	return (u32)InstancePtr->BytesPerPage *
+		(u32)InstancePtr->PagesPerBlock;
+#endif
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function returns the flash of the stacked pair holding an address.
+ *
+ * @param	QueuePtr is a pointer to the XIsf_Queue.
+ * @param	Address is the address in the Serial Flash.
+ *
+ * @return	0 for the lower flash, 1 for the upper flash.
+ *
+ ******************************************************************************/
+static u32 QueueBank(XIsf_Queue *QueuePtr, u32 Address)
+{
+	if ((QueuePtr->Overlap != 0U) && (Address >= QueuePtr->BankSize))
+		return 1U;
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function returns the size of the next operation of a request. Reads
+ * stop at the end of a flash of the stacked pair, programs at the end of a
+ * page and erases cover the sector of the address.
+ *
+ * @param	QueuePtr is a pointer to the XIsf_Queue.
+ * @param	ReqPtr is a pointer to the request.
+ *
+ * @return	Number of bytes of the request covered by the operation.
+ *
+ ******************************************************************************/
+static u32 QueueChunk(XIsf_Queue *QueuePtr, XIsf_QueueReq *ReqPtr)
+{
+	u32 Address = ReqPtr->Address + ReqPtr->Done;
+	u32 Remaining = ReqPtr->NumBytes - ReqPtr->Done;
+	u32 Size;
+	u32 Chunk;
+
+	switch (ReqPtr->Operation) {
+	case XISF_QUEUE_WRITE:
+		Size = QueuePtr->IsfPtr->BytesPerPage;
+		break;
+	case XISF_QUEUE_ERASE:
+		Size = QueueSectorSize(QueuePtr->IsfPtr);
+		break;
+	default:
+		Size = 0U;
+		if ((QueuePtr->Overlap != 0U) && (Address < QueuePtr->BankSize))
+			Size = QueuePtr->BankSize;
+		break;
+	}
+
+	if (Size == 0U)
+		return Remaining;
+
+	Chunk = Size - (Address % Size);
+	if (Chunk > Remaining)
+		Chunk = Remaining;
+
+	return Chunk;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function starts the next operation of a request. Reads, and the
+ * programs and erases when they are not overlapped, complete before
+ * returning. An overlapped program or erase is marked in flight on its
+ * flash.
+ *
+ * @param	QueuePtr is a pointer to the XIsf_Queue.
+ * @param	Index is the index of the request in the ring.
+ *
+ * @return	XST_SUCCESS if successful else XST_FAILURE.
+ *
+ ******************************************************************************/
+static int QueueStart(XIsf_Queue *QueuePtr, u32 Index)
+{
+	XIsf *InstancePtr = QueuePtr->IsfPtr;
+	XIsf_QueueReq *ReqPtr = &QueuePtr->Req[Index];
+	XIsf_ReadParam ReadParam;
+	XIsf_WriteParam WriteParam;
+	int Status = (int)(XST_FAILURE);
+	u32 Address;
+	u32 Chunk;
+	u32 Bank;
+	u32 Other;
+
+	while (ReqPtr->Done != ReqPtr->NumBytes) {
+		Address = ReqPtr->Address + ReqPtr->Done;
+		Bank = QueueBank(QueuePtr, Address);
+		Chunk = QueueChunk(QueuePtr, ReqPtr);
+
+		if (ReqPtr->Operation == XISF_QUEUE_READ) {
+			ReadParam.Address = Address;
+			ReadParam.ReadPtr = ReqPtr->BufPtr + ReqPtr->Done;
+			ReadParam.NumBytes = Chunk;
+			ReadParam.NumDummyBytes = QueuePtr->NumDummyBytes;
+			Status = XIsf_Read(InstancePtr, QueuePtr->ReadOp,
+					(void *)&ReadParam);
+			if (Status != (int)(XST_SUCCESS))
+				return (int)(XST_FAILURE);
+
+			ReqPtr->Done += Chunk;
+			QueuePtr->Stats.BytesRead += Chunk;
+			if (ReqPtr->Done == ReqPtr->NumBytes)
+				QueueComplete(QueuePtr, ReqPtr);
+
+			/* The rest is on the other flash, wait if it is busy */
+			if (QueueBank(QueuePtr, Address + Chunk) != Bank)
+				break;
+			continue;
+		}
+
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+		if (QueuePtr->Overlap != 0U) {
+			ReqPtr->Chunk = Chunk;
+			Status = QueueIssue(QueuePtr, ReqPtr, Bank);
+			if (Status != (int)(XST_SUCCESS))
+				return (int)(XST_FAILURE);
+
+			Other = (Bank == 0U) ? 1U : 0U;
+			if (QueuePtr->BankReq[Other] != QueuePtr->NumReq)
+				QueuePtr->Stats.Overlapped++;
+			QueuePtr->BankReq[Bank] = Index;
+			break;
+		}
+#else
+		(void)Other;
+#endif
+
+#if ((XPAR_XISF_FLASH_FAMILY == INTEL) || (XPAR_XISF_FLASH_FAMILY == STM) || \
+	(XPAR_XISF_FLASH_FAMILY == WINBOND) ||  \
+	(XPAR_XISF_FLASH_FAMILY == SPANSION) || (XPAR_XISF_FLASH_FAMILY == SST))
+		Status = XIsf_WriteEnable(InstancePtr, XISF_WRITE_ENABLE);
+		if (Status != (int)(XST_SUCCESS))
+			return (int)(XST_FAILURE);
+#endif
+		if (ReqPtr->Operation == XISF_QUEUE_WRITE) {
+			WriteParam.Address = Address;
+			WriteParam.WritePtr = ReqPtr->BufPtr + ReqPtr->Done;
+			WriteParam.NumBytes = Chunk;
+			Status = XIsf_Write(InstancePtr, XISF_WRITE,
+					(void *)&WriteParam);
+			QueuePtr->Stats.BytesWritten += Chunk;
+		} else {
+			Status = XIsf_Erase(InstancePtr, XISF_SECTOR_ERASE,
+					Address);
+			QueuePtr->Stats.BytesErased +=
+				QueueSectorSize(InstancePtr);
+		}
+		if (Status != (int)(XST_SUCCESS))
+			return (int)(XST_FAILURE);
+
+		ReqPtr->Done += Chunk;
+		if (ReqPtr->Done == ReqPtr->NumBytes)
+			QueueComplete(QueuePtr, ReqPtr);
+	}
+
+	return (int)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function checks the flash with a program or erase in flight. When
+ * the flash is ready the operation is accounted to its request and the
+ * flash is released.
+ *
+ * @param	QueuePtr is a pointer to the XIsf_Queue.
+ * @param	Bank is the flash of the stacked pair.
+ *
+ * @return	XST_SUCCESS if successful else XST_FAILURE.
+ *
+ ******************************************************************************/
+static int QueueCheckBank(XIsf_Queue *QueuePtr, u32 Bank)
+{
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+	XIsf_QueueReq *ReqPtr;
+	int Status;
+	u8 Busy;
+
+	if (QueuePtr->BankReq[Bank] == QueuePtr->NumReq)
+		return (int)(XST_SUCCESS);
+
+	Status = QueueIsBusy(QueuePtr, Bank, &Busy);
+	if (Status != (int)(XST_SUCCESS))
+		return (int)(XST_FAILURE);
+
+	QueuePtr->Stats.StatusPolls++;
+	if (Busy != 0U)
+		return (int)(XST_SUCCESS);
+
+	ReqPtr = &QueuePtr->Req[QueuePtr->BankReq[Bank]];
+	if (ReqPtr->Operation == XISF_QUEUE_WRITE)
+		QueuePtr->Stats.BytesWritten += ReqPtr->Chunk;
+	else
+		QueuePtr->Stats.BytesErased +=
+			QueueSectorSize(QueuePtr->IsfPtr);
+
+	ReqPtr->Done += ReqPtr->Chunk;
+	ReqPtr->Chunk = 0U;
+	if (ReqPtr->Done == ReqPtr->NumBytes)
+		QueueComplete(QueuePtr, ReqPtr);
+
+	QueuePtr->BankReq[Bank] = QueuePtr->NumReq;
+#else
+	(void)QueuePtr;
+	(void)Bank;
+#endif
+
+	return (int)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function counts a completed request.
+ *
+ * @param	QueuePtr is a pointer to the XIsf_Queue.
+ * @param	ReqPtr is a pointer to the completed request.
+ *
+ * @return	None.
+ *
+ ******************************************************************************/
+static void QueueComplete(XIsf_Queue *QueuePtr, XIsf_QueueReq *ReqPtr)
+{
+	switch (ReqPtr->Operation) {
+	case XISF_QUEUE_READ:
+		QueuePtr->Stats.NumReads++;
+		break;
+	case XISF_QUEUE_WRITE:
+		QueuePtr->Stats.NumWrites++;
+		break;
+	default:
+		QueuePtr->Stats.NumErases++;
+		break;
+	}
+}
+
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+/*****************************************************************************/
+/**
+ *
+ * This function selects a flash of the stacked pair.
+ *
+ * @param	InstancePtr is a pointer to the XIsf instance.
+ * @param	Bank is the flash of the stacked pair.
+ *
+ * @return	None.
+ *
+ ******************************************************************************/
+static void QueueSelectBank(XIsf *InstancePtr, u32 Bank)
+{
+	if (Bank != 0U)
+		XQspiPsu_SelectFlash(InstancePtr->SpiInstPtr,
+				XQSPIPSU_SELECT_FLASH_CS_UPPER,
+				XQSPIPSU_SELECT_FLASH_BUS_LOWER);
+	else
+		XQspiPsu_SelectFlash(InstancePtr->SpiInstPtr,
+				XQSPIPSU_SELECT_FLASH_CS_LOWER,
+				XQSPIPSU_SELECT_FLASH_BUS_LOWER);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function sends the write enable and the page program or sector erase
+ * command of a request to its flash, without waiting for the flash.
+ *
+ * @param	QueuePtr is a pointer to the XIsf_Queue.
+ * @param	ReqPtr is a pointer to the request, its Chunk is the size of
+ *		the operation.
+ * @param	Bank is the flash of the stacked pair.
+ *
+ * @return	XST_SUCCESS if successful else XST_FAILURE.
+ *
+ ******************************************************************************/
+static int QueueIssue(XIsf_Queue *QueuePtr, XIsf_QueueReq *ReqPtr, u32 Bank)
+{
+	XIsf *InstancePtr = QueuePtr->IsfPtr;
+	u32 RealAddr;
+	u32 NumMsg = 1U;
+	u32 Len = 0U;
+	int Status;
+
+	RealAddr = ReqPtr->Address + ReqPtr->Done - (Bank * QueuePtr->BankSize);
+	QueueSelectBank(InstancePtr, Bank);
+
+	QueuePtr->CmdBfr[0] = WRITE_ENABLE_CMD;
+	QueuePtr->Msg[0].TxBfrPtr = QueuePtr->CmdBfr;
+	QueuePtr->Msg[0].RxBfrPtr = NULL;
+	QueuePtr->Msg[0].ByteCount = 1;
+	QueuePtr->Msg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	QueuePtr->Msg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+	InstancePtr->SpiInstPtr->Msg = QueuePtr->Msg;
+
+	Status = XIsf_Transfer(InstancePtr, NULL, NULL, 1);
+	if (Status != (int)(XST_SUCCESS))
+		return (int)(XST_FAILURE);
+
+	if (ReqPtr->Operation == XISF_QUEUE_WRITE)
+		QueuePtr->CmdBfr[Len++] = XISF_CMD_PAGEPROG_WRITE;
+	else
+		QueuePtr->CmdBfr[Len++] = XISF_CMD_SECTOR_ERASE;
+	if (InstancePtr->FourByteAddrMode == TRUE)
+		QueuePtr->CmdBfr[Len++] = (u8)(RealAddr >> XISF_ADDR_SHIFT24);
+	QueuePtr->CmdBfr[Len++] = (u8)(RealAddr >> XISF_ADDR_SHIFT16);
+	QueuePtr->CmdBfr[Len++] = (u8)(RealAddr >> XISF_ADDR_SHIFT8);
+	QueuePtr->CmdBfr[Len++] = (u8)(RealAddr);
+	QueuePtr->Msg[0].ByteCount = Len;
+
+	if (ReqPtr->Operation == XISF_QUEUE_WRITE) {
+		QueuePtr->Msg[1].TxBfrPtr = ReqPtr->BufPtr + ReqPtr->Done;
+		QueuePtr->Msg[1].RxBfrPtr = NULL;
+		QueuePtr->Msg[1].ByteCount = ReqPtr->Chunk;
+		QueuePtr->Msg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+		QueuePtr->Msg[1].Flags = XQSPIPSU_MSG_FLAG_TX;
+		NumMsg = 2U;
+	}
+	InstancePtr->SpiInstPtr->Msg = QueuePtr->Msg;
+
+	Status = XIsf_Transfer(InstancePtr, NULL, NULL, NumMsg);
+	if (Status != (int)(XST_SUCCESS))
+		return (int)(XST_FAILURE);
+
+	return (int)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function reads the status of a flash of the stacked pair.
+ *
+ * @param	QueuePtr is a pointer to the XIsf_Queue.
+ * @param	Bank is the flash of the stacked pair.
+ * @param	BusyPtr is filled in with 1 if the flash is busy, 0 if ready.
+ *
+ * @return	XST_SUCCESS if successful else XST_FAILURE.
+ *
+ ******************************************************************************/
+static int QueueIsBusy(XIsf_Queue *QueuePtr, u32 Bank, u8 *BusyPtr)
+{
+	XIsf *InstancePtr = QueuePtr->IsfPtr;
+	int Status;
+
+	QueueSelectBank(InstancePtr, Bank);
+
+	QueuePtr->Msg[0].TxBfrPtr = &QueuePtr->StatusCmd;
+	QueuePtr->Msg[0].RxBfrPtr = NULL;
+	QueuePtr->Msg[0].ByteCount = 1;
+	QueuePtr->Msg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	QueuePtr->Msg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+
+	QueuePtr->Msg[1].TxBfrPtr = NULL;
+	QueuePtr->Msg[1].RxBfrPtr = QueuePtr->FlashStatus;
+	QueuePtr->Msg[1].ByteCount = 2;
+	QueuePtr->Msg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	QueuePtr->Msg[1].Flags = XQSPIPSU_MSG_FLAG_RX;
+	InstancePtr->SpiInstPtr->Msg = QueuePtr->Msg;
+
+	Status = XIsf_Transfer(InstancePtr, NULL, NULL, 2);
+	if (Status != (int)(XST_SUCCESS))
+		return (int)(XST_FAILURE);
+
+	if (QueuePtr->StatusCmd == READ_FLAG_STATUS_CMD)
+		*BusyPtr = ((QueuePtr->FlashStatus[1] &
+			XISF_QUEUE_FSR_READY_MASK) == 0U) ? 1U : 0U;
+	else
+		*BusyPtr = ((QueuePtr->FlashStatus[1] &
+			XISF_QUEUE_SR_BUSY_MASK) != 0U) ? 1U : 0U;
+
+	return (int)(XST_SUCCESS);
+}
+#endif
@@ -164,6 +164,10 @@
 *                       debug level_0 option
 *       dd   09/11/2023 MISRA-C violation Rule 10.3 fixed
 *       dd   09/11/2023 MISRA-C violation Rule 17.8 fixed
+* 1.08  fl   10/14/2026 Added hash index for the image info table and image
+*                       store, RestartImage only reads the PDIs holding the
+*                       image
+*       fl   10/14/2026 Mark the image info table changed for the PLM update
 * </pre>
 *
 * @note
@@ -203,6 +207,15 @@
 #define XLOADER_IMAGE_INFO_TBL_MAX_NUM	(XPLMI_IMAGE_INFO_TBL_BUFFER_LEN / \
 		sizeof(XLoader_ImageInfo)) /**< Maximum number of image info
 					     tables in the available buffer */
+#define XLOADER_IMAGE_INFO_IDX_SIZE	(64U) /**< Buckets of the image info
+					index, a power of two above the number
+					of table entries */
+#define XLOADER_IMG_STORE_IDX_SIZE	(128U) /**< Buckets of the image store
+					index, a power of two */
+#define XLOADER_IDX_HASH_MULT		(0x9E3779B1U) /**< Multiplier of the
+					index hash */
+#define XLOADER_HASH_IDX(Key, Size)	(((((u32)(Key)) * \
+		XLOADER_IDX_HASH_MULT) >> 16U) & ((Size) - 1U)) /**< Bucket of a key in an index */
 
 /************************** Function Prototypes ******************************/
 static int XLoader_ReadAndValidateHdrs(XilPdi* PdiPtr, u32 RegVal, u64 PdiAddr);
@@ -215,8 +228,27 @@ static int XLoader_InvalidateChildImgInfo(u32 ParentImgID, u32 *ChangeCount);
 static int XLoader_LoadImage(XilPdi *PdiPtr);
 static int XLoader_ReloadImage(XilPdi *PdiPtr, u32 ImageId, const u32 *FuncID);
 static int XLoader_StoreImageInfo(const XLoader_ImageInfo *ImageInfo);
+static void XLoader_ImageInfoIdxAdd(u32 ImgID, u32 Slot);
+static void XLoader_ImgStoreIdxAdd(const XilPdi *PdiPtr, u32 PdiIdx);
+static u8 XLoader_ImgStoreIdxSkip(u32 ImageId, u32 PdiIdx);
 
 /************************** Variable Definitions *****************************/
+/**
+ * Index of the image info table, bucket holds the table slot + 1U or 0U
+ * when empty. It is rebuilt when the table count differs from IdxCount or
+ * entries were moved.
+ */
+static u8 ImageInfoIdx[XLOADER_IMAGE_INFO_IDX_SIZE];
+static u32 ImageInfoIdxCount;
+static u8 ImageInfoIdxValid = (u8)FALSE;
+
+/**
+ * Index of the images in the image store PDIs whose headers were read and
+ * authenticated by RestartImage. IndexedPdis has a bit per PdiList entry
+ * whose images are all in ImgStoreIdx.
+ */
+static XLoader_ImgStoreIdxEntry ImgStoreIdx[XLOADER_IMG_STORE_IDX_SIZE];
+static u32 IndexedPdis;
 /*****************************************************************************/
 /**
  * @{
@@ -1072,6 +1104,7 @@ static int XLoader_InvalidateChildImgInfo(u32 ParentImgID, u32 *ChangeCount)
 			}
 			(*ChangeCount)++;
 			ImageInfoTbl->IsBufferFull = (u8)FALSE;
+			ImageInfoIdxValid = (u8)FALSE;
 			--Index;
 		}
 	}
@@ -1095,18 +1128,41 @@ XLoader_ImageInfo* XLoader_GetImageInfoEntry(u32 ImgID)
 {
 	XLoader_ImageInfo *ImageEntry = NULL;
 	u32 Index;
+	u32 Bucket;
+	u32 Slot;
 	XLoader_ImageInfoTbl *ImageInfoTbl = XLoader_GetImageInfoTbl();
 	XLoader_ImageInfo *ImageInfoTblPtr = (XLoader_ImageInfo *)
 		XPLMI_IMAGE_INFO_TBL_BUFFER_ADDR;
 
+	/**
+	 * Rebuild the index if the table changed behind it, like after
+	 * child image entries are invalidated or an In-Place PLM Update
+	 */
+	if ((ImageInfoIdxValid != (u8)TRUE) ||
+		(ImageInfoIdxCount != ImageInfoTbl->Count)) {
+		for (Index = 0U; Index < XLOADER_IMAGE_INFO_IDX_SIZE; Index++) {
+			ImageInfoIdx[Index] = 0U;
+		}
+		for (Index = 0U; Index < ImageInfoTbl->Count; Index++) {
+			XLoader_ImageInfoIdxAdd(ImageInfoTblPtr[Index].ImgID, Index);
+		}
+		ImageInfoIdxCount = ImageInfoTbl->Count;
+		ImageInfoIdxValid = (u8)TRUE;
+	}
+
 	/**
 	 * Check for a existing valid image entry matching given ImgID
 	 */
-	for (Index = 0U; Index < ImageInfoTbl->Count; Index++) {
-		if (ImageInfoTblPtr[Index].ImgID == ImgID) {
-			ImageEntry = &ImageInfoTblPtr[Index];
+	Bucket = XLOADER_HASH_IDX(ImgID, XLOADER_IMAGE_INFO_IDX_SIZE);
+	for (Index = 0U; (Index < XLOADER_IMAGE_INFO_IDX_SIZE) &&
+		(ImageInfoIdx[Bucket] != 0U); Index++) {
+		Slot = (u32)ImageInfoIdx[Bucket] - 1U;
+		if ((Slot < ImageInfoTbl->Count) &&
+			(ImageInfoTblPtr[Slot].ImgID == ImgID)) {
+			ImageEntry = &ImageInfoTblPtr[Slot];
 			goto END;
 		}
+		Bucket = (Bucket + 1U) & (XLOADER_IMAGE_INFO_IDX_SIZE - 1U);
 	}
 	if (ImageInfoTbl->Count < XLOADER_IMAGE_INFO_TBL_MAX_NUM) {
 		ImageEntry = &ImageInfoTblPtr[ImageInfoTbl->Count];
@@ -1117,6 +1173,29 @@ END:
 	return ImageEntry;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function adds an image info table slot to the image info
+ * 			index
+ *
+ * @param	ImgID of the entry in the slot
+ * @param	Slot is the index of the entry in the image info table
+ *
+ *****************************************************************************/
+static void XLoader_ImageInfoIdxAdd(u32 ImgID, u32 Slot)
+{
+	u32 Bucket = XLOADER_HASH_IDX(ImgID, XLOADER_IMAGE_INFO_IDX_SIZE);
+	u32 Index;
+
+	for (Index = 0U; Index < XLOADER_IMAGE_INFO_IDX_SIZE; Index++) {
+		if (ImageInfoIdx[Bucket] == 0U) {
+			ImageInfoIdx[Bucket] = (u8)(Slot + 1U);
+			break;
+		}
+		Bucket = (Bucket + 1U) & (XLOADER_IMAGE_INFO_IDX_SIZE - 1U);
+	}
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function stores the ImageInfo to Image Info Table
@@ -1139,6 +1218,8 @@ static int XLoader_StoreImageInfo(const XLoader_ImageInfo *ImageInfo)
 	u32 NodeId = NODESUBCLASS(ImageInfo->ImgID);
 	XLoader_ImageInfoTbl *ImageInfoTbl = XLoader_GetImageInfoTbl();
 
+	XLoader_ImageInfoTblChanged();
+
 	if (ImageInfo->ImgID == PM_DEV_PLD_0) {
 		XPlmi_Out32(XPLMI_RTCFG_USR_ACCESS_ADDR, ImageInfo->FuncID);
 	}
@@ -1171,6 +1252,11 @@ static int XLoader_StoreImageInfo(const XLoader_ImageInfo *ImageInfo)
 
 	if (ImageEntry->ImgID == XLOADER_INVALID_IMG_ID) {
 		ImageInfoTbl->Count++;
+		if (ImageInfoIdxCount == (ImageInfoTbl->Count - 1U)) {
+			XLoader_ImageInfoIdxAdd(ImageInfo->ImgID,
+				ImageInfoIdxCount);
+			ImageInfoIdxCount = ImageInfoTbl->Count;
+		}
 	}
 	ChangeCount++;
 	/**
@@ -1495,11 +1581,19 @@ int XLoader_RestartImage(u32 ImageId, u32 *FuncID)
 	 PdiPtr->PdiType = XLOADER_PDI_TYPE_PARTIAL;
 	 PdiPtr->PdiSrc = XLOADER_PDI_SRC_DDR;
 	for (Index = (int)PdiList->Count - 1; Index >= 0; Index--) {
+		/**
+		 * - Skip the PDIs whose authenticated headers are indexed and
+		 * have no such image, without reading them again
+		 */
+		if (XLoader_ImgStoreIdxSkip(ImageId, (u32)Index) == (u8)TRUE) {
+			continue;
+		}
 		PdiAddr = PdiList->ImgList[Index].PdiAddr;
 		Status = XLoader_PdiInit(PdiPtr, XLOADER_PDI_SRC_DDR, PdiAddr);
 		if (Status != XST_SUCCESS) {
 			goto END1;
 		}
+		XLoader_ImgStoreIdxAdd(PdiPtr, (u32)Index);
 
 		XPlmi_Printf(DEBUG_GENERAL, "Loading from PdiAddr: "
 			"0x%0x%08x\n\r", (u32)(PdiAddr >> 32U),
@@ -1558,6 +1652,112 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function clears the image store index. It must be called
+ * 			whenever the image store PdiList changes.
+ *
+ *****************************************************************************/
+void XLoader_ClearImgStoreIdx(void)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < XLOADER_IMG_STORE_IDX_SIZE; Index++) {
+		ImgStoreIdx[Index].PdiTag = XLOADER_IMG_STORE_IDX_EMPTY;
+	}
+	IndexedPdis = 0U;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function adds the images of an image store PDI, whose
+ * 			headers are read and authenticated, to the image store index.
+ * 			The PDI is marked as indexed only if all its images fit.
+ *
+ * @param	PdiPtr is Pdi instance pointer
+ * @param	PdiIdx is the index of the PDI in PdiList
+ *
+ *****************************************************************************/
+static void XLoader_ImgStoreIdxAdd(const XilPdi *PdiPtr, u32 PdiIdx)
+{
+	u32 ImgNum;
+	u32 Bucket;
+	u32 Index;
+	u32 ImgID;
+	u32 PdiTag = PdiIdx + 1U;
+
+	if ((IndexedPdis & ((u32)1U << PdiIdx)) != 0U) {
+		goto END;
+	}
+
+	for (ImgNum = 0U; ImgNum < PdiPtr->MetaHdr.ImgHdrTbl.NoOfImgs;
+		ImgNum++) {
+		ImgID = PdiPtr->MetaHdr.ImgHdr[ImgNum].ImgID;
+		Bucket = XLOADER_HASH_IDX(ImgID ^ PdiIdx,
+				XLOADER_IMG_STORE_IDX_SIZE);
+		for (Index = 0U; Index < XLOADER_IMG_STORE_IDX_SIZE; Index++) {
+			if ((ImgStoreIdx[Bucket].PdiTag ==
+				XLOADER_IMG_STORE_IDX_EMPTY) ||
+				((ImgStoreIdx[Bucket].PdiTag == PdiTag) &&
+				(ImgStoreIdx[Bucket].ImageId == ImgID))) {
+				ImgStoreIdx[Bucket].ImageId = ImgID;
+				ImgStoreIdx[Bucket].PdiTag = PdiTag;
+				break;
+			}
+			Bucket = (Bucket + 1U) & (XLOADER_IMG_STORE_IDX_SIZE - 1U);
+		}
+		if (Index == XLOADER_IMG_STORE_IDX_SIZE) {
+			/* Index is full, the PDI is read on every restart */
+			goto END;
+		}
+	}
+	IndexedPdis |= ((u32)1U << PdiIdx);
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks in the image store index if a PDI can be
+ * 			skipped when looking for an image.
+ *
+ * @param	ImageId Id of the image to be restarted
+ * @param	PdiIdx is the index of the PDI in PdiList
+ *
+ * @return
+ * 			- TRUE if the PDI is indexed and does not have the image
+ * 			- FALSE if the PDI has to be read
+ *
+ *****************************************************************************/
+static u8 XLoader_ImgStoreIdxSkip(u32 ImageId, u32 PdiIdx)
+{
+	u8 Skip = (u8)FALSE;
+	u32 Bucket;
+	u32 Index;
+	u32 PdiTag = PdiIdx + 1U;
+
+	if ((IndexedPdis & ((u32)1U << PdiIdx)) == 0U) {
+		goto END;
+	}
+
+	Skip = (u8)TRUE;
+	Bucket = XLOADER_HASH_IDX(ImageId ^ PdiIdx, XLOADER_IMG_STORE_IDX_SIZE);
+	for (Index = 0U; (Index < XLOADER_IMG_STORE_IDX_SIZE) &&
+		(ImgStoreIdx[Bucket].PdiTag != XLOADER_IMG_STORE_IDX_EMPTY);
+		Index++) {
+		if ((ImgStoreIdx[Bucket].PdiTag == PdiTag) &&
+			(ImgStoreIdx[Bucket].ImageId == ImageId)) {
+			Skip = (u8)FALSE;
+			break;
+		}
+		Bucket = (Bucket + 1U) & (XLOADER_IMG_STORE_IDX_SIZE - 1U);
+	}
+
+END:
+	return Skip;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to reload the image only in PDI. This
@@ -1901,6 +2101,7 @@ int XLoader_ReadImageStoreCfg(void)
 	PdiList->PdiImgStrAddr = XPlmi_In32(XPLMI_RTCFG_IMG_STORE_ADDRESS_HIGH);
 	PdiList->PdiImgStrAddr = XPlmi_In32(XPLMI_RTCFG_IMG_STORE_ADDRESS_LOW) | (PdiList->PdiImgStrAddr << 32U);
 	PdiList->PdiImgStrSize = XPlmi_In32(XPLMI_RTCFG_IMG_STORE_SIZE);
+	XLoader_ClearImgStoreIdx();
 
 	/**
 	 * - Validate if address is unaligned.
@@ -116,6 +116,8 @@
 *                       Moved minor error codes to plat headers
 *       sk   08/18/2023 Renamed ValidHeader member to DiscardUartLogs in XilPdi
 *       dd   09/11/2023 MISRA-C violation Rule 17.8 fixed
+*       fl   10/14/2026 Added XLoader_PrtnProfile structure
+*       fl   10/14/2026 Added XLoader_ImgStoreIdxEntry structure
 *
 * </pre>
 *
@@ -258,6 +260,7 @@ typedef struct {
 #define XLOADER_SHA3_LEN				(48U)
 
 #define XLOADER_MAX_PDI_LIST		(32U)
+#define XLOADER_IMG_STORE_IDX_EMPTY	(0U)
 
 #if defined(XLOADER_SD_0) || defined(XLOADER_SD_1)
 #define XLOADER_SD_ADDR_MASK		(0xFFFFU)
@@ -362,6 +365,12 @@ typedef struct {
 	u8 Count;
 } XLoader_ImageStore;
 
+/* Entry of the index of the images in the image store PDIs */
+typedef struct {
+	u32 ImageId; /**< Image ID */
+	u32 PdiTag; /**< Index of the PDI in PdiList + 1U, 0U when empty */
+} XLoader_ImgStoreIdxEntry;
+
 typedef struct {
 	u64 DataAddr;
 	u32 DataSize;
@@ -372,6 +381,14 @@ typedef struct {
 	u32 OverWrite;
 } XLoader_ImageMeasureInfo;
 
+/* Structure to store the time spent in each stage of a partition load */
+typedef struct {
+	u64 CopyTime;	/**< Timer ticks waiting for the boot device */
+	u64 SecureTime;	/**< Timer ticks in authentication, decryption and
+			  checksum */
+	u64 CdoTime;	/**< Timer ticks executing CDO commands */
+} XLoader_PrtnProfile;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 /*****************************************************************************/
 /**
@@ -414,11 +431,13 @@ int XLoader_LoadImageInfoTbl(u64 DestAddr, u32 MaxSize, u32 *NumEntries);
 int XLoader_PdiInit(XilPdi* PdiPtr, PdiSrc_t PdiSource, u64 PdiAddr);
 int XLoader_ReadImageStoreCfg(void);
 int XLoader_IsPdiAddrLookup(u32 PdiId, u64 *PdiAddr);
+void XLoader_ClearImgStoreIdx(void);
 
 /* Functions defined in xloader_prtn_load.c */
 int XLoader_LoadImagePrtns(XilPdi* PdiPtr);
 int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* DeviceCopy,
 	void* SecureParamsPtr);
+XLoader_PrtnProfile *XLoader_GetPrtnProfile(void);
 
 /* Functions defined in xloader_cmds.c */
 void XLoader_CmdsInit(void);
@@ -79,6 +79,7 @@
 *       sk   07/31/2023 Updated Image Store Error Codes
 *       dd   09/11/2023 MISRA-C violation Rule 10.3 fixed
 *       dd   09/11/2023 MISRA-C violation Rule 17.8 fixed
+*       fl   10/14/2026 Clear the image store index when PdiList changes
 *
 * </pre>
 *
@@ -691,6 +692,8 @@ static int XLoader_AddImageStorePdi(XPlmi_Cmd *Cmd)
 
 	PdiAddr = ((u64)Cmd->Payload[XLOADER_CMD_IMGSTORE_PDIADDR_LOW_INDEX]) |
 			(PdiAddr << 32U);
+	/* PdiList entries move, drop the index of the stored images */
+	XLoader_ClearImgStoreIdx();
 	for (Index = 0U; Index < PdiList->Count; Index++) {
 		if (PdiList->ImgList[Index].PdiId == PdiId) {
 			break;
@@ -797,6 +800,8 @@ static int XLoader_WriteImageStorePdi(XPlmi_Cmd *Cmd)
 			goto END;
 		}
 
+		/* PdiList entries move, drop the index of the stored images */
+		XLoader_ClearImgStoreIdx();
 		for (Index = 0U; Index < PdiList->Count; Index++) {
 			if (PdiList->ImgList[Index].PdiId == PdiId) {
 				break;
@@ -889,6 +894,8 @@ static int XLoader_RemoveImageStorePdi(XPlmi_Cmd *Cmd)
 		goto END;
 	}
 
+	/* PdiList entries move, drop the index of the stored images */
+	XLoader_ClearImgStoreIdx();
 	/** If PdiId matches with any entry in the List, remove it */
 	for (Index = 0U; Index < PdiList->Count; Index++) {
 		if (PdiList->ImgList[Index].PdiId  == PdiId) {
@@ -910,6 +917,7 @@ static int XLoader_RemoveImageStorePdi(XPlmi_Cmd *Cmd)
 	}
 
 	PdiList->Count--;
+	XLoader_ClearImgStoreIdx();
 	if (PdiList->Count == 0U) {
 		Status = XLoader_DdrRelease();
 		if (Status != XST_SUCCESS) {
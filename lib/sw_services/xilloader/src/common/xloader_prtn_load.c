@@ -103,6 +103,11 @@
 *       rama 08/10/2023 Changed partition ID print to DEBUG_ALWAYS for
 *                       debug level_0 option
 *       dd   09/11/2023 MISRA-C violation Rule 10.3 fixed
+*       fl   10/14/2026 Log the partition profile to the Trace Log buffer
+*       fl   10/14/2026 Added task preemption point between CDO chunks
+*       fl   10/14/2026 Stream the slave SLR data of QSPI and OSPI boot over
+*                       both PMC DMAs on SSIT master
+*       fl   10/14/2026 Drain skipped SBI partitions in 1MB AXI FIXED transfers
 *
 * </pre>
 *
@@ -129,6 +134,9 @@
 #include "xloader_plat.h"
 #include "xplmi_wdt.h"
 #include "xplmi_tamper.h"
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+#include "xplmi_ssit.h"
+#endif
 
 /************************** Constant Definitions *****************************/
 
@@ -136,12 +144,16 @@
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XLOADER_SUCCESS_NOT_PRTN_OWNER	(0x100U) /**< Indicates that PLM is not the partition owner */
+#define XLOADER_SBI_DRAIN_LEN		(0x100000U) /**< Maximum length of one
+					SBI transfer draining a skipped partition, 1MB */
 
 /************************** Function Prototypes ******************************/
 static int XLoader_PrtnHdrValidation(const XilPdi_PrtnHdr* PrtnHdr, u32 PrtnNum);
 static int XLoader_ProcessPrtn(XilPdi* PdiPtr, u32 PrtnIndex);
 static int XLoader_ProcessCdo (const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCopy,
 	XLoader_SecureParams* SecureParams);
+static u32 XLoader_TicksToUs(u64 Ticks);
+static void XLoader_LogPrtnProfile(const XilPdi* PdiPtr, u64 PrtnLoadTime);
 
 /************************** Variable Definitions *****************************/
 
@@ -163,6 +175,7 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 	u32 PrtnIndex;
 	u64 PrtnLoadTime;
 	XPlmi_PerfTime PerfTime;
+	XLoader_PrtnProfile *PrtnProfile = XLoader_GetPrtnProfile();
 
 	if (PdiPtr->DelayLoad == (u8)FALSE) {
 		XPlmi_Printf(DEBUG_PRINT_ALWAYS,
@@ -229,10 +242,16 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 		/**
 		 * - Otherwise process the partition.
 		 */
+		PrtnProfile->CopyTime = 0U;
+		PrtnProfile->SecureTime = 0U;
+		PrtnProfile->CdoTime = 0U;
 		Status = XLoader_ProcessPrtn(PdiPtr, PrtnIndex);
 		if (XST_SUCCESS != Status) {
 			goto END;
 		}
+		if (PdiPtr->DelayLoad == (u8)FALSE) {
+			XLoader_LogPrtnProfile(PdiPtr, PrtnLoadTime);
+		}
 		XPlmi_MeasurePerfTime(PrtnLoadTime, &PerfTime);
 		XPlmi_Printf(DEBUG_PRINT_PERF,
 			" %u.%03u ms for Partition#: 0x%0x, Size: %u Bytes\n\r",
@@ -350,6 +369,9 @@ int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* DeviceCopy,
 	const XilPdi_PrtnHdr * PrtnHdr = &(PdiPtr->MetaHdr.PrtnHdr[PrtnNum]);
 	u32 PcrInfo = PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].PcrInfo;
 	XLoader_ImageMeasureInfo ImageMeasureInfo = {0U};
+	XLoader_PrtnProfile *PrtnProfile = XLoader_GetPrtnProfile();
+	u64 StageStart = XPlmi_GetTimerValue();
+	u64 CopyTime = PrtnProfile->CopyTime;
 
 	/**
 	 * - Check if security is enabled and start the partition copy securely.
@@ -360,6 +382,7 @@ int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* DeviceCopy,
 			(SecureParams->IsCheckSumEnabled == (u8)FALSE)) {
 		Status = PdiPtr->MetaHdr.DeviceCopy(DeviceCopy->SrcAddr,
 			DeviceCopy->DestAddr,DeviceCopy->Len, DeviceCopy->Flags);
+		PrtnProfile->CopyTime += StageStart - XPlmi_GetTimerValue();
 	}
 	else {
 		XSECURE_TEMPORAL_IMPL(Status, StatusTmp, XLoader_SecureCopy,
@@ -368,6 +391,9 @@ int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* DeviceCopy,
 		if ((XST_SUCCESS != Status) || (XST_SUCCESS != StatusTmp)) {
 			Status |= StatusTmp;
 		}
+		/* The chunk copies are accounted by XLoader_SecureChunkCopy */
+		PrtnProfile->SecureTime += (StageStart - XPlmi_GetTimerValue()) -
+			(PrtnProfile->CopyTime - CopyTime);
 	}
 	if (Status != XST_SUCCESS) {
 		XPlmi_Printf(DEBUG_GENERAL, "Device Copy Failed\n\r");
@@ -421,6 +447,9 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 #endif
 	u32 PcrInfo = PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].PcrInfo;
 	XLoader_ImageMeasureInfo ImageMeasureInfo = {0U};
+	XLoader_PrtnProfile *PrtnProfile = XLoader_GetPrtnProfile();
+	u64 StageStart;
+	u64 CopyTime;
 
 	XPlmi_Printf(DEBUG_INFO, "Processing CDO partition \n\r");
 	/**
@@ -445,6 +474,17 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 		}
 		else {
 			Cdo.Cmd.KeyHoleParams.Func = PdiPtr->MetaHdr.DeviceCopy;
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+			/**
+			 * QSPI and OSPI copies use the controller DMA, so both
+			 * PMC DMAs are free to stream the slave SLR data
+			 */
+			if ((PdiPtr->SlrType == XLOADER_SSIT_MASTER_SLR) &&
+				((PdiPtr->PdiIndex == XLOADER_QSPI_INDEX) ||
+				(PdiPtr->PdiIndex == XLOADER_OSPI_INDEX))) {
+				Cdo.Cmd.KeyHoleParams.IsSlrStreamEn = (u8)TRUE;
+			}
+#endif
 		}
 	}
 
@@ -464,12 +504,39 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 			}
 			else {
 				Flags = XPLMI_DEVICE_COPY_STATE_BLK;
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+				/**
+				 * The blocking copy may overwrite the chunk the
+				 * slave SLR streams read from
+				 */
+				if (Cdo.Cmd.KeyHoleParams.IsSlrStreamEn == (u8)TRUE) {
+					Status = XPlmi_SsitStreamFlush();
+					if (Status != XST_SUCCESS) {
+						goto END;
+					}
+				}
+#endif
 			}
+			StageStart = XPlmi_GetTimerValue();
 			Status = PdiPtr->MetaHdr.DeviceCopy(DeviceCopy->SrcAddr,
 				ChunkAddr, ChunkLen, (DeviceCopy->Flags | Flags));
+			PrtnProfile->CopyTime += StageStart - XPlmi_GetTimerValue();
 			if (Status != XST_SUCCESS) {
 					goto END;
 			}
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+			/**
+			 * The slave SLR streams of the previous chunk ran during
+			 * the copy, complete them before its buffer is reused
+			 */
+			if ((Cdo.Cmd.KeyHoleParams.IsSlrStreamEn == (u8)TRUE) &&
+				(Flags == XPLMI_DEVICE_COPY_STATE_WAIT_DONE)) {
+				Status = XPlmi_SsitStreamFlush();
+				if (Status != XST_SUCCESS) {
+					goto END;
+				}
+			}
+#endif
 			/** Update variables for next chunk */
 			Cdo.BufPtr = (u32 *)ChunkAddr;
 			Cdo.BufLen = ChunkLen >> XPLMI_WORD_LEN_SHIFT;
@@ -477,6 +544,10 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 			DeviceCopy->SrcAddr += ChunkLen;
 			DeviceCopy->Len -= ChunkLen;
 			Cdo.Cmd.KeyHoleParams.SrcAddr = DeviceCopy->SrcAddr;
+			/**
+			 * Run the pending tasks while no copy is in progress
+			 */
+			XPlmi_TaskPreemptionPoint();
 			/**
 			 * Start the copy of the next chunk for increasing performance
 			 */
@@ -510,8 +581,13 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 		else {
 			SecureParams->RemainingDataLen = DeviceCopy->Len;
 
+			StageStart = XPlmi_GetTimerValue();
+			CopyTime = PrtnProfile->CopyTime;
 			Status = SecureParams->ProcessPrtn(SecureParams,
 					SecureParams->SecureData, ChunkLen, LastChunk);
+			/* The chunk copy is accounted by XLoader_SecureChunkCopy */
+			PrtnProfile->SecureTime += (StageStart - XPlmi_GetTimerValue()) -
+				(PrtnProfile->CopyTime - CopyTime);
 			if (Status != XST_SUCCESS) {
 				goto END;
 			}
@@ -528,7 +604,9 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 		CdoProcessTimeStart = XPlmi_GetTimerValue();
 #endif
 		/** Process the chunk */
+		StageStart = XPlmi_GetTimerValue();
 		Status = XPlmi_ProcessCdo(&Cdo);
+		PrtnProfile->CdoTime += StageStart - XPlmi_GetTimerValue();
 		if (Status != XST_SUCCESS) {
 			goto END;
 		}
@@ -553,7 +631,10 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 				Cdo.Cmd.KeyHoleParams.ExtraWords = 0x0U;
 				Cdo.Cmd.KeyHoleParams.SrcAddr = DeviceCopy->SrcAddr;
 				Cdo.Cmd.KeyHoleParams.IsNextChunkCopyStarted = (u8)FALSE;
+				StageStart = XPlmi_GetTimerValue();
 				Status = XPlmi_ProcessCdo(&Cdo);
+				PrtnProfile->CdoTime += StageStart -
+					XPlmi_GetTimerValue();
 				if (Status != XST_SUCCESS) {
 					goto END;
 				}
@@ -586,6 +667,15 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 		}
 	}
 
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+	if (Cdo.Cmd.KeyHoleParams.IsSlrStreamEn == (u8)TRUE) {
+		Status = XPlmi_SsitStreamFlush();
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+#endif
+
 	/** If deferred error, flagging it after CDO process complete */
 	if (Cdo.DeferredError == (u8)TRUE) {
 		Status = XLoader_ProcessDeferredError();
@@ -594,6 +684,10 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 	Status = XST_SUCCESS;
 
 END:
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+	/** Leave the PMC DMAs idle on errors as well, no-op if none is queued */
+	(void)XPlmi_SsitStreamFlush();
+#endif
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
 	XPlmi_MeasurePerfTime((XPlmi_GetTimerValue() + CdoProcessTime),
 				&PerfTime);
@@ -646,15 +740,21 @@ static int XLoader_ProcessPrtn(XilPdi* PdiPtr, u32 PrtnIndex)
 
 	if (PdiPtr->DelayLoad == (u8)TRUE) {
 		if (PdiPtr->PdiIndex == XLOADER_SBI_INDEX) {
+			/**
+			 * Drain the skipped partition in large transfers, all
+			 * written to the same PMC RAM address
+			 */
 			while (PrtnParams.DeviceCopy.Len > 0U) {
-				if (PrtnParams.DeviceCopy.Len > XLOADER_CHUNK_SIZE) {
-					TrfLen = XLOADER_CHUNK_SIZE;
+				if (PrtnParams.DeviceCopy.Len > XLOADER_SBI_DRAIN_LEN) {
+					TrfLen = XLOADER_SBI_DRAIN_LEN;
 				}
 				else {
 					TrfLen = PrtnParams.DeviceCopy.Len;
 				}
+				XPlmi_SetPlmLiveStatus();
 				Status = PdiPtr->MetaHdr.DeviceCopy(PrtnParams.DeviceCopy.SrcAddr,
-					XPLMI_PMCRAM_CHUNK_MEMORY, TrfLen, 0U);
+					XPLMI_PMCRAM_CHUNK_MEMORY, TrfLen,
+					XPLMI_DST_CH_AXI_FIXED);
 				if (Status != XST_SUCCESS) {
 					Status = XPlmi_UpdateStatus(XLOADER_ERR_DELAY_LOAD, Status);
 					goto END;
@@ -732,3 +832,66 @@ static int XLoader_ProcessPrtn(XilPdi* PdiPtr, u32 PrtnIndex)
 END:
 	return Status;
 }
+
+/****************************************************************************/
+/**
+ * @brief	This function returns the pointer to the profile of the partition
+ * 			being loaded.
+ *
+ * @return	Pointer to XLoader_PrtnProfile
+ *
+ *****************************************************************************/
+XLoader_PrtnProfile *XLoader_GetPrtnProfile(void)
+{
+	static XLoader_PrtnProfile PrtnProfile;
+
+	return &PrtnProfile;
+}
+
+/****************************************************************************/
+/**
+ * @brief	This function converts PMC timer ticks to microseconds.
+ *
+ * @param	Ticks is the number of timer ticks
+ *
+ * @return	Time in microseconds
+ *
+ *****************************************************************************/
+static u32 XLoader_TicksToUs(u64 Ticks)
+{
+	u32 PmcIroFreqMHz = *XPlmi_GetPmcIroFreq() / XPLMI_MEGA;
+
+	return (u32)(Ticks / (u64)PmcIroFreqMHz);
+}
+
+/****************************************************************************/
+/**
+ * @brief	This function logs the profile of the partition just loaded to
+ * 			the Trace Log buffer, from where it is retrieved with the
+ * 			retrieve trace log data event logging command.
+ *
+ * @param	PdiPtr is pointer to XilPdi instance
+ * @param	PrtnLoadTime is the timer value at the start of the partition
+ * 			load
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XLoader_LogPrtnProfile(const XilPdi* PdiPtr, u64 PrtnLoadTime)
+{
+	const XilPdi_PrtnHdr *PrtnHdr = &(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum]);
+	const XLoader_PrtnProfile *PrtnProfile = XLoader_GetPrtnProfile();
+	u32 TotalUs = XLoader_TicksToUs(PrtnLoadTime - XPlmi_GetTimerValue());
+	u32 Size = PrtnHdr->TotalDataWordLen << XPLMI_WORD_LEN_SHIFT;
+	u32 TraceBuffer[] = {XPLMI_TRACE_LOG_PRTN_PROFILE, 0U, 0U,
+		PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID, PrtnHdr->PrtnId,
+		Size, TotalUs, XLoader_TicksToUs(PrtnProfile->CopyTime),
+		XLoader_TicksToUs(PrtnProfile->SecureTime),
+		XLoader_TicksToUs(PrtnProfile->CdoTime), 0U};
+
+	if (TotalUs != 0U) {
+		TraceBuffer[XPLMI_ARRAY_SIZE(TraceBuffer) - 1U] =
+			(u32)(((u64)Size * XPLMI_KILO) / TotalUs);
+	}
+	XPlmi_StoreTraceLog(TraceBuffer, XPLMI_ARRAY_SIZE(TraceBuffer));
+}
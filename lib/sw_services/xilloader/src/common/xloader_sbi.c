@@ -36,6 +36,8 @@
 * 1.06  bm   07/06/2022 Refactor versal and versal_net code
 * 1.07  ng   11/11/2022 Updated doxygen comments
 *       ng   03/30/2023 Updated algorithm and return values in doxygen comments
+* 1.08  fl   10/14/2026 Pass AXI FIXED destination flag to SBI DMA transfers,
+*                       added SBI throughput print
 *
 * </pre>
 *
@@ -51,12 +53,22 @@
 #include "xloader_sbi.h"
 #include "xplmi.h"
 #include "xplmi_dma.h"
+#include "xplmi_proc.h"
 #include "xloader_plat.h"
 
 #if defined(XLOADER_SBI)
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+#ifdef PLM_PRINT_PERF_DMA
+/* Structure to measure the SBI throughput of a PDI load */
+typedef struct {
+	u64 Bytes; /**< Bytes read from SBI */
+	u64 BusyTicks; /**< Timer ticks SBI DMA transfers were in progress */
+	u64 FirstStart; /**< Timer value at the first transfer, 0 if none */
+	u64 XfrStart; /**< Timer value at the start of non blocking transfer */
+} XLoader_SbiPerf;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 /* SBI definitions */
@@ -65,8 +77,14 @@
 #define XLOADER_SBI_CTRL_INTERFACE_AXI_SLAVE             (0x8U)
 
 /************************** Function Prototypes ******************************/
+#ifdef PLM_PRINT_PERF_DMA
+static u32 XLoader_SbiKBps(u64 Bytes, u64 Ticks);
+#endif
 
 /************************** Variable Definitions *****************************/
+#ifdef PLM_PRINT_PERF_DMA
+static XLoader_SbiPerf SbiPerf;
+#endif
 
 /*****************************************************************************/
 /**
@@ -137,7 +155,9 @@ END:
  * @param	DestAddr is the address of the destination to which the data
  *			should be copied to
  * @param	Length is number of bytes to be copied
- * @param	Flags indicate parameters for DMA transfer
+ * @param	Flags indicate parameters for DMA transfer. With
+ *			XPLMI_DST_CH_AXI_FIXED set, a blocking transfer writes all the
+ *			data to DestAddr, which is used to drain skipped data.
  *
  * @return
  * 			- XST_SUCCESS on success and error code on failure
@@ -147,6 +167,9 @@ int XLoader_SbiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 {
 	int Status = XST_FAILURE;
 	u32 ReadFlags;
+#ifdef PLM_PRINT_PERF_DMA
+	u64 XfrStart = XPlmi_GetTimerValue();
+#endif
 	(void) (SrcAddr);
 
 	ReadFlags = Flags & XPLMI_DEVICE_COPY_STATE_MASK;
@@ -155,8 +178,17 @@ int XLoader_SbiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
     */
 	if (ReadFlags == XPLMI_DEVICE_COPY_STATE_WAIT_DONE) {
 		Status = XPlmi_WaitForNonBlkDestDma(XPLMI_PMCDMA_1);
+#ifdef PLM_PRINT_PERF_DMA
+		SbiPerf.BusyTicks += SbiPerf.XfrStart - XPlmi_GetTimerValue();
+#endif
 		goto END;
 	}
+#ifdef PLM_PRINT_PERF_DMA
+	if (SbiPerf.FirstStart == 0U) {
+		SbiPerf.FirstStart = XfrStart;
+	}
+	SbiPerf.Bytes += Length;
+#endif
 
 	/**
      * - Update the flags for NON blocking DMA call.
@@ -164,12 +196,23 @@ int XLoader_SbiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	if (ReadFlags == XPLMI_DEVICE_COPY_STATE_INITIATE) {
 		ReadFlags = XPLMI_DMA_DST_NONBLK;
 	}
+	else {
+		ReadFlags |= (Flags & XPLMI_DST_CH_AXI_FIXED);
+	}
 	ReadFlags |= XPLMI_PMCDMA_1;
     /**
      * - Start the DMA transfer.
      */
 	Status = XPlmi_SbiDmaXfer(DestAddr, (Length >> XPLMI_WORD_LEN_SHIFT),
 		ReadFlags);
+#ifdef PLM_PRINT_PERF_DMA
+	if ((ReadFlags & XPLMI_DMA_DST_NONBLK) != 0U) {
+		SbiPerf.XfrStart = XfrStart;
+	}
+	else {
+		SbiPerf.BusyTicks += XfrStart - XPlmi_GetTimerValue();
+	}
+#endif
 
 END:
 	return Status;
@@ -187,6 +230,27 @@ int XLoader_SbiRecovery(void)
 {
 	int Status = XST_FAILURE;
 	u32 SbiCtrl;
+#ifdef PLM_PRINT_PERF_DMA
+	XPlmi_PerfTime PerfTime = {0U};
+
+	/**
+	 * - Print the SBI throughput of the PDI load. Busy is while SBI DMA
+	 * transfers were in progress, effective is from the first transfer.
+	 */
+	if (SbiPerf.FirstStart != 0U) {
+		XPlmi_MeasurePerfTime(SbiPerf.FirstStart, &PerfTime);
+		XPlmi_Printf(DEBUG_PRINT_PERF, " %u.%03u ms SBI: %u Bytes, "
+			"%u KB/s busy, %u KB/s effective\n\r",
+			(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac,
+			(u32)SbiPerf.Bytes,
+			XLoader_SbiKBps(SbiPerf.Bytes, SbiPerf.BusyTicks),
+			XLoader_SbiKBps(SbiPerf.Bytes,
+				SbiPerf.FirstStart - XPlmi_GetTimerValue()));
+		SbiPerf.Bytes = 0U;
+		SbiPerf.BusyTicks = 0U;
+		SbiPerf.FirstStart = 0U;
+	}
+#endif
 
 	if (XLoader_IsJtagSbiMode() == (u8)FALSE) {
 		goto END;
@@ -212,6 +276,30 @@ END:
 	return Status;
 }
 
+#ifdef PLM_PRINT_PERF_DMA
+/*****************************************************************************/
+/**
+ * @brief	This function returns the throughput of an SBI transfer.
+ *
+ * @param	Bytes is the number of bytes transferred
+ * @param	Ticks is the number of timer ticks taken
+ *
+ * @return	Throughput in KB/s, 0 if no time was measured
+ *
+ *****************************************************************************/
+static u32 XLoader_SbiKBps(u64 Bytes, u64 Ticks)
+{
+	u32 KBps = 0U;
+	u64 Us = (Ticks * XPLMI_MEGA) / (u64)(*XPlmi_GetPmcIroFreq());
+
+	if (Us != 0U) {
+		KBps = (u32)((Bytes * XPLMI_KILO) / Us);
+	}
+
+	return KBps;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief	This function checks if the boot mode is jtag or not.
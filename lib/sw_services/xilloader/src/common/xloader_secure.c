@@ -125,6 +125,9 @@
 *       ng   07/10/23 Added support for system device-tree flow
 *       yog  08/17/23 Added a check to return error when secure is excluded
 *                     and trying to do secure boot
+*       fl   10/14/26 Start the next chunk copy from the first block of the
+*                     checksum only partitions
+*       fl   10/14/26 Account the chunk copies to the partition profile
 *
 * </pre>
 *
@@ -700,6 +703,8 @@ int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 {
 	int Status = XST_FAILURE;
 	u8 Flags = XPLMI_DEVICE_COPY_STATE_BLK;
+	XLoader_PrtnProfile *PrtnProfile = XLoader_GetPrtnProfile();
+	u64 CopyStart;
 
 	if (SecurePtr->IsNextChunkCopyStarted == (u8)TRUE) {
 		SecurePtr->IsNextChunkCopyStarted = (u8)FALSE;
@@ -710,8 +715,10 @@ int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 	 * - Copy the next chunk securely, and then wait for the process to
 	 *   be completed.
 	 */
+	CopyStart = XPlmi_GetTimerValue();
 	Status = SecurePtr->PdiPtr->MetaHdr.DeviceCopy(SrcAddr,
 		SecurePtr->ChunkAddr, TotalSize, (u32)(Flags | SecurePtr->DmaFlags));
+	PrtnProfile->CopyTime += CopyStart - XPlmi_GetTimerValue();
 	if (Status != XST_SUCCESS) {
 		Status = XPlmi_UpdateStatus(
 				XLOADER_ERR_DATA_COPY_FAIL, Status);
@@ -729,8 +736,12 @@ int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 	 *   when processing the first chunk, and only enabled from the second chunk
 	 *   onwards. The third chunk is loaded at 0xf2008120, and from then on, the
 	 *   chunks are loaded alternatively to the two 32KB chunks of the PMC RAM.
+	 * - Partitions without authentication and encryption keep nothing in the
+	 *   second chunk, their second chunk is copied while the first one is
+	 *   processed.
 	 */
-	if ((Last != (u8)TRUE) && (SecurePtr->BlockNum != 0U) &&
+	if ((Last != (u8)TRUE) && ((SecurePtr->BlockNum != 0U) ||
+		(SecurePtr->SecureEn == (u8)FALSE)) &&
 	((SecurePtr->DmaFlags & XPLMI_PMCDMA_0) != XPLMI_PMCDMA_0)) {
 		Status = XLoader_StartNextChunkCopy(SecurePtr,
 					(SecurePtr->RemainingDataLen - TotalSize),
@@ -28,6 +28,7 @@
 *       sk   07/31/2023 Added error code for Image Store feature
 *       dd   08/11/2023 Updated doxygen comments
 *       dd   09/11/2023 MISRA-C violation Directive 4.5 fixed
+* 1.02  fl   10/14/2026 Added XLoader_ImageInfoTblChanged stub
 *
 * </pre>
 *
@@ -226,6 +227,16 @@ static inline int XLoader_PlatInit(void)
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function is called before the image info table is changed.
+ *
+ *****************************************************************************/
+static inline void XLoader_ImageInfoTblChanged(void)
+{
+	/* Not Applicable for Versal */
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function measures the PDI's meta header data by calculating
@@ -41,6 +41,8 @@
 *                       Removed XLoader_GetLoadAddr targeting TCM Memory
 *       ng   06/26/2023 Added support for system device tree flow
 *       dd   08/11/2023 Updated doxygen comments
+* 1.03  fl   10/14/2026 Track the changes of the image info table for the
+*                       incremental PLM update database
 *
 * </pre>
 *
@@ -981,11 +983,38 @@ int XLoader_PlatInit(void)
 		goto END;
 	}
 	Status = XLoader_InitTrngInstance();
+#ifdef PLM_ENABLE_INCREMENTAL_UPDATE_DB
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	/* Only store the image info table again if an image was loaded */
+	Status = XPlmi_DsTrackChanges(XPLMI_MODULE_LOADER_ID,
+			XLOADER_IMAGE_INFO_DS_ID);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XPlmi_DsTrackChanges(XPLMI_MODULE_LOADER_ID,
+			XLOADER_IMAGE_INFO_PTR_DS_ID);
+#endif
 
 END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function is called before the image info table is changed,
+ *		the tables are stored again in the next PLM update database.
+ *
+ *****************************************************************************/
+void XLoader_ImageInfoTblChanged(void)
+{
+#ifdef PLM_ENABLE_INCREMENTAL_UPDATE_DB
+	XPlmi_DsMarkDirty(XPLMI_MODULE_LOADER_ID, XLOADER_IMAGE_INFO_DS_ID);
+	XPlmi_DsMarkDirty(XPLMI_MODULE_LOADER_ID, XLOADER_IMAGE_INFO_PTR_DS_ID);
+#endif
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function measures the PDI's meta header data by calculating
@@ -34,6 +34,7 @@
 *       sk   07/10/2023 Removed TCM Address, Offset defines
 *       sk   07/31/2023 Added error code for Image Store feature
 *	ro   08/01/2023 Added error codes for DDR initialization
+* 1.02  fl   10/14/2026 Added XLoader_ImageInfoTblChanged declaration
 *
 * </pre>
 *
@@ -302,6 +303,7 @@ int XLoader_ProcessElf(XilPdi* PdiPtr, const XilPdi_PrtnHdr * PrtnHdr,
 XLoader_ImageStore* XLoader_GetPdiList(void);
 int XLoader_UpdateHandler(XPlmi_ModuleOp Op);
 int XLoader_PlatInit(void);
+void XLoader_ImageInfoTblChanged(void);
 int XLoader_HdrMeasurement(XilPdi* PdiPtr);
 int XLoader_DataMeasurement(XLoader_ImageMeasureInfo *ImageInfo);
 int XLoader_SecureConfigMeasurement(XLoader_SecureParams* SecurePtr, u32 PcrInfo, u32 *DigestIndex, u32 OverWrite);
@@ -34,6 +34,7 @@
  *	 ht   05/30/23	  Added support for system device-tree flow.
  *	 ht   06/12/23	  Fix MISRA-C warnings
  *	 ht   07/24/23	  Restructure the code for more modularity
+ *       fl   10/14/26    Registered XIpiPs_IsDone
  *</pre>
  *
  *@note
@@ -78,6 +79,7 @@ u32 XMailbox_Initialize(XMailbox *InstancePtr, UINTPTR BaseAddress)
 	InstancePtr->XMbox_IPI_SendData = XIpiPs_SendData;
 	InstancePtr->XMbox_IPI_Send = XIpiPs_Send;
 	InstancePtr->XMbox_IPI_Recv = XIpiPs_RecvData;
+	InstancePtr->XMbox_IPI_IsDone = XIpiPs_IsDone;
 
 	/* Initialize the InstancePtr */
 #ifndef SDT
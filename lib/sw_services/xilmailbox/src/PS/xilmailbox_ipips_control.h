@@ -17,6 +17,7 @@
  * Ver   Who  Date        Changes
  * ----- ---- -------- -------------------------------------------------------
  * 1.8   ht   07/24/23    Restructure the code for more modularity.
+ *       fl   10/14/26    Added XIpiPs_IsDone
  *
  *  *</pre>
  *
@@ -59,6 +60,7 @@ u32 XIpiPs_SendData(XMailbox *InstancePtr, void *MsgBufferPtr,
 u32 XIpiPs_RecvData(XMailbox *InstancePtr, void *MsgBufferPtr,
 		    u32 MsgLen, u8 BufferType);
 u32 XIpiPs_PollforDone(XMailbox *InstancePtr);
+u32 XIpiPs_IsDone(XMailbox *InstancePtr);
 #ifndef __MICROBLAZE__
 void XIpiPs_ErrorIntrHandler(void *XMailboxPtr);
 void XIpiPs_IntrHandler(void *XMailboxPtr);
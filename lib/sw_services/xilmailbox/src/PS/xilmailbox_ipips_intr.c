@@ -11,7 +11,8 @@
  * @{
  * @details
  *
- * This file contains the definitions for XIpiPs_PollforDone and XIpiPs_RegisterIrq.
+ * This file contains the definitions for XIpiPs_PollforDone, XIpiPs_IsDone
+ * and XIpiPs_RegisterIrq.
  *
  * <pre>
  * MODIFICATION HISTORY:
@@ -19,6 +20,7 @@
  * Ver   Who  Date        Changes
  * ----- ---- -------- -------------------------------------------------------
  * 1.8   ht   07/24/23    Restructure the code for more modularity
+ *       fl   10/14/26    Added XIpiPs_IsDone
  *
  *  *</pre>
  *
@@ -69,6 +71,30 @@ u32 XIpiPs_PollforDone(XMailbox *InstancePtr)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * Check the Observation Register once for an acknowledgement.
+ *
+ * @param InstancePtr Pointer to the XMailbox instance
+ *
+ * @return      XST_SUCCESS if the remote agent acknowledged
+ *              XST_DEVICE_BUSY if the remote agent is still busy
+ */
+/****************************************************************************/
+u32 XIpiPs_IsDone(XMailbox *InstancePtr)
+{
+	XMailbox_Agent *DataPtr = &InstancePtr->Agent;
+	XIpiPsu *IpiInstancePtr = &DataPtr->IpiInst;
+	u32 Status = XST_DEVICE_BUSY;
+
+	if ((XIpiPsu_ReadReg(IpiInstancePtr->Config.BaseAddress,
+			     XIPIPSU_OBS_OFFSET) & (DataPtr->RemoteId)) == 0U) {
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
 #ifndef __MICROBLAZE__
 /*****************************************************************************/
 /**
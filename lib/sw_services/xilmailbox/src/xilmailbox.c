@@ -25,6 +25,8 @@
  * 1.3   sd   03/03/21    Doxygen Fixes
  * 1.4   sd   23/06/21    Fix MISRA-C warnings
  * 1.6   kpt  03/16/22    Added shared memory API's for IPI utilization
+ *       fl   10/14/26    Added XMailbox_IsDone
+ *       fl   10/14/26    Release the message queue with the shared memory
  *</pre>
  *
  *@note
@@ -143,6 +145,28 @@ u32 XMailbox_Recv(XMailbox *InstancePtr, u32 SourceId, void *BufferPtr,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * This function checks, without waiting, whether the destination CPU has
+ * acknowledged a message sent with Is_Blocking cleared
+ *
+ * @param InstancePtr Pointer to the XMailbox instance
+ * @param RemoteId is the Mask of the CPU to which the message was sent
+ *
+ * @return
+ *	- XST_SUCCESS if the message is acknowledged
+ *	- XST_DEVICE_BUSY if the destination CPU is still processing it
+ *
+ ****************************************************************************/
+u32 XMailbox_IsDone(XMailbox *InstancePtr, u32 RemoteId)
+{
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	InstancePtr->Agent.RemoteId = RemoteId;
+	return InstancePtr->XMbox_IPI_IsDone(InstancePtr);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -276,6 +300,7 @@ int XMailbox_ReleaseSharedMem(XMailbox *InstancePtr)
 
 	/* Release the shared memory */
 	if (InstancePtr != NULL) {
+		InstancePtr->Queue.IsReady = (u8)FALSE;
 		InstancePtr->SharedMem.Address = 0U;
 		InstancePtr->SharedMem.Size = 0U;
 		InstancePtr->SharedMem.SharedMemState = XMAILBOX_SHARED_MEM_UNINITIALIZED;
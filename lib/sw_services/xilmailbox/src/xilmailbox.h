@@ -33,6 +33,13 @@
  *   Message type should be either XILMBOX_MSG_TYPE_REQ (OR) XILMBOX_MSG_TYPE_RESP.
  * - XMailbox_SetCallBack() using this function user can register call backs
  *   for recv and error events.
+ * - XMailbox_IsDone() checks without waiting whether the remote agent has
+ *   acknowledged a message sent in non-blocking mode.
+ * - XMailbox_QueueInit() sets up a message queue in the shared memory given
+ *   to XMailbox_SetSharedMem(). XMailbox_QueueSend() and XMailbox_QueueRecv()
+ *   then exchange messages larger than the IPI buffer through it, using the
+ *   IPI only as a doorbell when the queue goes non-empty, or not at all in
+ *   polling mode.
  *
  * <pre>
  * MODIFICATION HISTORY:
@@ -48,6 +55,8 @@
  * 1.7   sd   10/11/22    Fix a typo
  * 1.8   am   09/03/23    Added payload length macros
  *	 ht   05/30/23	  Added support for system device-tree flow.
+ *       fl   10/14/26    Added XMailbox_IsDone for non-blocking requests
+ *       fl   10/14/26    Added shared memory message queue
  *
  *</pre>
  *
@@ -103,6 +112,36 @@ typedef struct {
 	XMailbox_IpiSharedMemState SharedMemState; /**< State of shared memory */
 } XMailbox_IpiSharedMem;
 
+/**
+ * This typedef contains the shared memory queue notification modes.
+ */
+typedef enum {
+	XMAILBOX_QUEUE_MODE_IPI = 0, /**< Trigger IPI when queue goes non-empty */
+	XMAILBOX_QUEUE_MODE_POLL, /**< No IPI, the receiver polls the queue */
+} XMailbox_QueueMode;
+
+/**
+ * This typedef selects which half of the shared memory is used for sending.
+ * The two agents sharing the memory must use opposite sides.
+ */
+typedef enum {
+	XMAILBOX_QUEUE_SIDE_0 = 0, /**< Send on lower half, receive on upper */
+	XMAILBOX_QUEUE_SIDE_1, /**< Send on upper half, receive on lower */
+} XMailbox_QueueSide;
+
+typedef struct {
+	UINTPTR TxRing; /**< Ring this agent produces into */
+	UINTPTR RxRing; /**< Ring this agent consumes from */
+	u32 SlotSize; /**< Size of a ring slot in bytes */
+	u32 NumSlots; /**< Number of slots in each ring */
+	u32 MaxMsgLen; /**< Maximum message length in bytes */
+	u32 TxHead; /**< Local copy of the Tx ring producer index */
+	u32 RxTail; /**< Local copy of the Rx ring consumer index */
+	u32 RemoteId; /**< Mask of the agent to ring */
+	XMailbox_QueueMode Mode; /**< Notification mode */
+	u8 IsReady; /**< Set once the queue is initialized */
+} XMailbox_Queue;
+
 /**
  * Data structure used to refer XilMailbox
  */
@@ -112,12 +151,14 @@ typedef struct XMboxTag {
 				  u32 MsgLen, u8 BufferType, u8 Is_Blocking); /**< Sends an IPI message to a destination CPU */
 	u32 (*XMbox_IPI_Recv)(struct XMboxTag *InstancePtr, void *BufferPtr,
 			      u32 MsgLen, u8 BufferType); /**< Reads an IPI message */
+	u32 (*XMbox_IPI_IsDone)(struct XMboxTag *InstancePtr); /**< Checks if the destination CPU acknowledged */
 	XMailbox_RecvHandler RecvHandler;   /**< Receive handler */
 	XMailbox_ErrorHandler ErrorHandler; /**< Callback for rx IPI event */
 	void *ErrorRefPtr; /**<  To be passed to the error interrupt callback */
 	void *RecvRefPtr;  /**< To be passed to the receive interrupt callback */
 	XMailbox_Agent Agent; /**< Agent to store IPI channel information */
 	XMailbox_IpiSharedMem SharedMem; /**< shared memory segment */
+	XMailbox_Queue Queue; /**< Message queue in the shared memory */
 } XMailbox; /**< XilMailbox structure */
 
 /**
@@ -143,6 +184,7 @@ u32 XMailbox_SendData(XMailbox *InstancePtr, u32 RemoteId,
 		      void *BufferPtr, u32 MsgLen, u8 BufferType, u8 Is_Blocking);
 u32 XMailbox_Recv(XMailbox *InstancePtr, u32 SourceId, void *BufferPtr,
 		  u32 MsgLen, u8 BufferType);
+u32 XMailbox_IsDone(XMailbox *InstancePtr, u32 RemoteId);
 s32 XMailbox_SetCallBack(XMailbox *InstancePtr, XMailbox_Handler HandlerType,
 			 void *CallBackFuncPtr, void *CallBackRefPtr);
 u32 XMailbox_SetSharedMem(XMailbox *InstancePtr, u64 Address, u32 Size);
@@ -150,6 +192,18 @@ u32 XMailbox_GetSharedMem(XMailbox *InstancePtr, u64 **Address);
 int XMailbox_ReleaseSharedMem(XMailbox *InstancePtr);
 /** @} */
 
+/**
+ * Functions for xilmailbox_queue.c
+ * @{
+ */
+u32 XMailbox_QueueInit(XMailbox *InstancePtr, u32 RemoteId, u32 MaxMsgLen,
+		       XMailbox_QueueSide Side, XMailbox_QueueMode Mode);
+u32 XMailbox_QueueSend(XMailbox *InstancePtr, const void *BufferPtr,
+		       u32 MsgLen);
+u32 XMailbox_QueueRecv(XMailbox *InstancePtr, void *BufferPtr, u32 MaxLen,
+		       u32 *MsgLen);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
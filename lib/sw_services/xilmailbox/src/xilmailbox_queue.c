@@ -0,0 +1,319 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xilmailbox_queue.c
+ * @addtogroup xilmailbox Overview
+ * @{
+ * @details
+ *
+ * This file contains the shared memory message queue transport. The shared
+ * memory set with XMailbox_SetSharedMem() is split into two single producer,
+ * single consumer rings, one per direction. Each ring is laid out as
+ *	- producer index, in its own cache line
+ *	- consumer index, in its own cache line
+ *	- slots, each holding a message length word followed by the payload
+ * Indices run freely and the ring is full when they differ by the number of
+ * slots. The IPI is only triggered when a message is added to an empty ring,
+ * so the receiver must drain the queue until XMailbox_QueueRecv() returns
+ * XST_NO_DATA.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.8   fl   10/14/26    Initial Release
+ *</pre>
+ *
+ *@note
+ *****************************************************************************/
+/***************************** Include Files *********************************/
+#include "xilmailbox.h"
+#include "xil_cache.h"
+#include "xil_util.h"
+
+/************************** Constant Definitions *****************************/
+#define XMAILBOX_QUEUE_ALIGN		(64U) /**< Cache line size */
+#define XMAILBOX_QUEUE_HEAD_OFFSET	(0U) /**< Producer index offset */
+#define XMAILBOX_QUEUE_TAIL_OFFSET	(XMAILBOX_QUEUE_ALIGN) /**< Consumer
+								index offset */
+#define XMAILBOX_QUEUE_SLOT_OFFSET	(2U * XMAILBOX_QUEUE_ALIGN) /**< First
+								slot offset */
+#define XMAILBOX_QUEUE_LEN_SIZE		(4U) /**< Message length word size */
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define XMAILBOX_QUEUE_ROUNDUP(x)	(((x) + XMAILBOX_QUEUE_ALIGN - 1U) & \
+					 ~(XMAILBOX_QUEUE_ALIGN - 1U))
+
+/************************** Function Prototypes ******************************/
+static u32 XMailbox_QueueReadIdx(UINTPTR Addr);
+static void XMailbox_QueueWriteIdx(UINTPTR Addr, u32 Value);
+
+/*****************************************************************************/
+/**
+ * This function sets up the message queue in the shared memory of the
+ * instance. Both agents must call it with the same MaxMsgLen and opposite
+ * sides before either of them sends.
+ *
+ * @param InstancePtr Pointer to the XMailbox instance
+ * @param RemoteId is the Mask of the CPU to ring when the queue goes
+ *	  non-empty
+ * @param MaxMsgLen is the maximum message length in bytes
+ * @param Side selects the half of the shared memory used for sending
+ * @param Mode is XMAILBOX_QUEUE_MODE_IPI or XMAILBOX_QUEUE_MODE_POLL
+ *
+ * @return
+ *	- XST_SUCCESS if successful
+ *	- XST_FAILURE if the shared memory is not set
+ *	- XST_BUFFER_TOO_SMALL if the shared memory cannot hold one message
+ *	  per direction
+ *
+ ****************************************************************************/
+u32 XMailbox_QueueInit(XMailbox *InstancePtr, u32 RemoteId, u32 MaxMsgLen,
+		       XMailbox_QueueSide Side, XMailbox_QueueMode Mode)
+{
+	u32 Status = XST_FAILURE;
+	XMailbox_Queue *Queue;
+	UINTPTR Lower;
+	UINTPTR Upper;
+	u32 HalfSize;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(MaxMsgLen != 0U);
+	Xil_AssertNonvoid((Side == XMAILBOX_QUEUE_SIDE_0) ||
+			  (Side == XMAILBOX_QUEUE_SIDE_1));
+	Xil_AssertNonvoid((Mode == XMAILBOX_QUEUE_MODE_IPI) ||
+			  (Mode == XMAILBOX_QUEUE_MODE_POLL));
+
+	Queue = &InstancePtr->Queue;
+	Queue->IsReady = (u8)FALSE;
+
+	if (InstancePtr->SharedMem.SharedMemState !=
+	    XMAILBOX_SHARED_MEM_INITIALIZED) {
+		goto END;
+	}
+
+	Lower = XMAILBOX_QUEUE_ROUNDUP((UINTPTR)InstancePtr->SharedMem.Address);
+	if (InstancePtr->SharedMem.Size <= (u32)(Lower -
+	    (UINTPTR)InstancePtr->SharedMem.Address)) {
+		Status = XST_BUFFER_TOO_SMALL;
+		goto END;
+	}
+	HalfSize = (u32)((UINTPTR)InstancePtr->SharedMem.Address +
+			 InstancePtr->SharedMem.Size - Lower) / 2U;
+	HalfSize &= ~(XMAILBOX_QUEUE_ALIGN - 1U);
+	Upper = Lower + HalfSize;
+
+	Queue->SlotSize = XMAILBOX_QUEUE_ROUNDUP(XMAILBOX_QUEUE_LEN_SIZE +
+						 MaxMsgLen);
+	if (HalfSize < (XMAILBOX_QUEUE_SLOT_OFFSET + Queue->SlotSize)) {
+		Status = XST_BUFFER_TOO_SMALL;
+		goto END;
+	}
+	Queue->NumSlots = (HalfSize - XMAILBOX_QUEUE_SLOT_OFFSET) /
+			  Queue->SlotSize;
+	Queue->MaxMsgLen = MaxMsgLen;
+	Queue->RemoteId = RemoteId;
+	Queue->Mode = Mode;
+
+	if (Side == XMAILBOX_QUEUE_SIDE_0) {
+		Queue->TxRing = Lower;
+		Queue->RxRing = Upper;
+	} else {
+		Queue->TxRing = Upper;
+		Queue->RxRing = Lower;
+	}
+
+	/* Each agent only writes the index it owns */
+	Queue->TxHead = 0U;
+	Queue->RxTail = 0U;
+	XMailbox_QueueWriteIdx(Queue->TxRing + XMAILBOX_QUEUE_HEAD_OFFSET, 0U);
+	XMailbox_QueueWriteIdx(Queue->RxRing + XMAILBOX_QUEUE_TAIL_OFFSET, 0U);
+	Queue->IsReady = (u8)TRUE;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function adds a message to the queue and, in IPI mode, triggers the
+ * remote agent if the queue was empty
+ *
+ * @param InstancePtr Pointer to the XMailbox instance
+ * @param BufferPtr is the pointer to the message
+ * @param MsgLen is the length of the message in bytes
+ *
+ * @return
+ *	- XST_SUCCESS if successful
+ *	- XST_FAILURE if the queue is not initialized or the IPI fails
+ *	- XST_INVALID_PARAM if MsgLen exceeds the queue maximum
+ *	- XST_DEVICE_BUSY if the queue is full
+ *
+ ****************************************************************************/
+u32 XMailbox_QueueSend(XMailbox *InstancePtr, const void *BufferPtr,
+		       u32 MsgLen)
+{
+	u32 Status = XST_FAILURE;
+	XMailbox_Queue *Queue;
+	UINTPTR Slot;
+	u32 Tail;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+
+	Queue = &InstancePtr->Queue;
+	if (Queue->IsReady != (u8)TRUE) {
+		goto END;
+	}
+	if (MsgLen > Queue->MaxMsgLen) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	Tail = XMailbox_QueueReadIdx(Queue->TxRing + XMAILBOX_QUEUE_TAIL_OFFSET);
+	if ((Queue->TxHead - Tail) >= Queue->NumSlots) {
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	Slot = Queue->TxRing + XMAILBOX_QUEUE_SLOT_OFFSET +
+	       ((Queue->TxHead % Queue->NumSlots) * Queue->SlotSize);
+	Xil_Out32(Slot, MsgLen);
+	if (MsgLen != 0U) {
+		Status = (u32)Xil_SMemCpy((void *)(Slot +
+					  XMAILBOX_QUEUE_LEN_SIZE), MsgLen,
+					  BufferPtr, MsgLen, MsgLen);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	/* Message must be visible before the producer index moves */
+	Xil_DCacheFlushRange(Slot, XMAILBOX_QUEUE_LEN_SIZE + MsgLen);
+
+	Queue->TxHead++;
+	XMailbox_QueueWriteIdx(Queue->TxRing + XMAILBOX_QUEUE_HEAD_OFFSET,
+			       Queue->TxHead);
+	Status = XST_SUCCESS;
+
+	/* Ring the doorbell only when the remote may have gone idle */
+	if ((Queue->Mode == XMAILBOX_QUEUE_MODE_IPI) &&
+	    ((Queue->TxHead - 1U) == Tail)) {
+		InstancePtr->Agent.RemoteId = Queue->RemoteId;
+		Status = InstancePtr->XMbox_IPI_Send(InstancePtr, 0U);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function removes the oldest message from the queue
+ *
+ * @param InstancePtr Pointer to the XMailbox instance
+ * @param BufferPtr is the pointer to Buffer to which the message is copied
+ * @param MaxLen is the size of the buffer in bytes
+ * @param MsgLen is updated with the length of the message
+ *
+ * @return
+ *	- XST_SUCCESS if a message was read
+ *	- XST_FAILURE if the queue is not initialized
+ *	- XST_NO_DATA if the queue is empty
+ *	- XST_BUFFER_TOO_SMALL if the message does not fit in the buffer, the
+ *	  message is left in the queue and MsgLen holds its length
+ *
+ ****************************************************************************/
+u32 XMailbox_QueueRecv(XMailbox *InstancePtr, void *BufferPtr, u32 MaxLen,
+		       u32 *MsgLen)
+{
+	u32 Status = XST_FAILURE;
+	XMailbox_Queue *Queue;
+	UINTPTR Slot;
+	u32 Head;
+	u32 Len;
+
+	/* Validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid(MsgLen != NULL);
+
+	Queue = &InstancePtr->Queue;
+	if (Queue->IsReady != (u8)TRUE) {
+		goto END;
+	}
+
+	Head = XMailbox_QueueReadIdx(Queue->RxRing + XMAILBOX_QUEUE_HEAD_OFFSET);
+	if (Head == Queue->RxTail) {
+		Status = XST_NO_DATA;
+		goto END;
+	}
+
+	Slot = Queue->RxRing + XMAILBOX_QUEUE_SLOT_OFFSET +
+	       ((Queue->RxTail % Queue->NumSlots) * Queue->SlotSize);
+	Xil_DCacheInvalidateRange(Slot, Queue->SlotSize);
+	Len = Xil_In32(Slot);
+	if (Len > Queue->MaxMsgLen) {
+		/* Corrupted slot, drop it */
+		Len = 0U;
+	}
+	*MsgLen = Len;
+	if (Len > MaxLen) {
+		Status = XST_BUFFER_TOO_SMALL;
+		goto END;
+	}
+	if (Len != 0U) {
+		Status = (u32)Xil_SMemCpy(BufferPtr, MaxLen,
+					  (const void *)(Slot +
+					  XMAILBOX_QUEUE_LEN_SIZE), Len, Len);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	/* Hand the slot back to the producer */
+	Queue->RxTail++;
+	XMailbox_QueueWriteIdx(Queue->RxRing + XMAILBOX_QUEUE_TAIL_OFFSET,
+			       Queue->RxTail);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function reads a ring index written by the remote agent
+ *
+ * @param Addr is the address of the index
+ *
+ * @return Index value
+ *
+ ****************************************************************************/
+static u32 XMailbox_QueueReadIdx(UINTPTR Addr)
+{
+	Xil_DCacheInvalidateRange(Addr, XMAILBOX_QUEUE_ALIGN);
+	return Xil_In32(Addr);
+}
+
+/*****************************************************************************/
+/**
+ * This function publishes a ring index owned by this agent
+ *
+ * @param Addr is the address of the index
+ * @param Value is the index value
+ *
+ ****************************************************************************/
+static void XMailbox_QueueWriteIdx(UINTPTR Addr, u32 Value)
+{
+	Xil_Out32(Addr, Value);
+	Xil_DCacheFlushRange(Addr, XMAILBOX_QUEUE_ALIGN);
+}
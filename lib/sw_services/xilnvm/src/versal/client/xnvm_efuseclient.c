@@ -35,6 +35,7 @@
 *       skg  10/25/22 Added in body comments for APIs
 * 3.2   am   03/09/23 Replaced xnvm payload lengths with xmailbox payload lengths
 *	vss  09/19/23 Fixed MISRA-C 8.3 violation
+*       fl   10/14/26 Added XNvm_EfuseReadSecSnapshot
 *
 * </pre>
 *
@@ -867,6 +868,45 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function sends IPI request to read the eFuse security
+ * 		fields (control bits, PPK hashes, revocation IDs, DecOnly and
+ * 		DNA) in a single request
+ *
+ * @param	InstancePtr Pointer to the client instance
+ * @param	SnapshotAddr	Address of the XNvm_EfuseSecSnapshot structure
+ * 				where the eFuse data is stored
+ *
+ * @return	- XST_SUCCESS - If the read is successful
+ * 		- XST_FAILURE - If there is a failure
+ *
+ ******************************************************************************/
+int XNvm_EfuseReadSecSnapshot(const XNvm_ClientInstance *InstancePtr, const u64 SnapshotAddr)
+{
+	int Status = XST_FAILURE;
+	u32 Payload[XMAILBOX_PAYLOAD_LEN_3U];
+
+    /**
+	 *  Validate input parameters. Return XST_FAILURE if input parameters are invalid
+	 */
+	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL)) {
+		goto END;
+	}
+
+	Payload[0U] = Header(0U, (u32)(((InstancePtr->SlrIndex) << XNVM_SLR_INDEX_SHIFT) | (u32)XNVM_API_ID_EFUSE_READ_SEC_SNAPSHOT));
+	Payload[1U] = (u32)SnapshotAddr;
+	Payload[2U] = (u32)(SnapshotAddr >> 32U);
+
+    /**
+	 *  Send CDO to PLM to read the eFuse security fields from eFuse cache. Return XST_FAILURE if IPI request not success
+	 */
+	Status = XNvm_ProcessMailbox(InstancePtr->MailboxPtr, Payload, sizeof(Payload)/sizeof(u32));
+
+END:
+	return Status;
+}
+
 #ifdef XNVM_ACCESS_PUF_USER_DATA
 
 /*****************************************************************************/
@@ -30,6 +30,7 @@
 *       kpt  03/03/22 Fixed alignment issue in XNvm_EfusePufFuseAddr
 *                     by rearranging the structure elements
 * 3.1   skg  10/28/22 Added comments
+*       fl   10/14/26 Added XNvm_EfuseSecSnapshot and its API ID
 *
 * </pre>
 * @note
@@ -114,6 +115,20 @@ typedef struct {
 } XNvm_EfuseAdditionalPpkHash;
 #endif
 
+/**< Snapshot of eFuse security fields returned by a single request */
+typedef struct {
+	XNvm_EfuseSecCtrlBits SecCtrlBits;
+	XNvm_EfusePufSecCtrlBits PufSecCtrlBits;
+	XNvm_EfuseMiscCtrlBits MiscCtrlBits;
+	XNvm_EfuseSecMisc1Bits SecMisc1Bits;
+	XNvm_EfuseBootEnvCtrlBits BootEnvCtrlBits;
+	XNvm_PpkHash PpkHash[XNVM_EFUSE_PPK2 + 1U];
+	u32 RevokeId[XNVM_NUM_OF_REVOKE_ID_FUSES];
+	u32 OffChipId[XNVM_NUM_OF_OFFCHIP_ID_FUSES];
+	u32 DecOnly;
+	XNvm_Dna Dna;
+} XNvm_EfuseSecSnapshot;
+
 /**< XilNVM API ids */
 typedef enum {
 	XNVM_API_FEATURES = 0,
@@ -139,6 +154,7 @@ typedef enum {
 	XNVM_API_ID_EFUSE_READ_DNA,
 	XNVM_API_ID_EFUSE_READ_PUF_USER_FUSE,
 	XNVM_API_ID_EFUSE_READ_PUF,
+	XNVM_API_ID_EFUSE_READ_SEC_SNAPSHOT,
 	XNVM_API_MAX,
 } XNvm_ApiId;
 
@@ -26,6 +26,7 @@
 * 2.5   am   02/28/2022 Fixed MISRA C violation rule 4.5
 * 3.1   skg  10/04/2022 Added invalid hidden handler for PLM to PLM communication
 * 3.2   bm   06/23/2023 Added access permissions for IPI commands
+*       fl   10/14/2026 Added eFuse security snapshot read command
 *
 * </pre>
 *
@@ -80,6 +81,7 @@ static XPlmi_AccessPerm_t XNvm_AccessPermBuff[XNVM_API_MAX] =
 	XPLMI_ALL_IPI_FULL_ACCESS(XNVM_API_ID_EFUSE_READ_DNA),
 	XPLMI_ALL_IPI_FULL_ACCESS(XNVM_API_ID_EFUSE_READ_PUF_USER_FUSE),
 	XPLMI_ALL_IPI_FULL_ACCESS(XNVM_API_ID_EFUSE_READ_PUF),
+	XPLMI_ALL_IPI_FULL_ACCESS(XNVM_API_ID_EFUSE_READ_SEC_SNAPSHOT),
 };
 
 static XPlmi_Module XPlmi_Nvm =
@@ -148,6 +150,7 @@ static int XNvm_FeaturesCmd(u32 ApiId)
 	case XNVM_API_ID_EFUSE_READ_PPK_HASH:
 	case XNVM_API_ID_EFUSE_READ_DEC_EFUSE_ONLY:
 	case XNVM_API_ID_EFUSE_READ_DNA:
+	case XNVM_API_ID_EFUSE_READ_SEC_SNAPSHOT:
 #ifdef XNVM_ACCESS_PUF_USER_DATA
 	case XNVM_API_ID_EFUSE_READ_PUF_USER_FUSE:
 	case XNVM_API_ID_EFUSE_PUF_USER_FUSE_WRITE:
@@ -210,6 +213,7 @@ static int XNvm_ProcessCmd(XPlmi_Cmd *Cmd)
 	case XNVM_API(XNVM_API_ID_EFUSE_READ_PPK_HASH):
 	case XNVM_API(XNVM_API_ID_EFUSE_READ_DEC_EFUSE_ONLY):
 	case XNVM_API(XNVM_API_ID_EFUSE_READ_DNA):
+	case XNVM_API(XNVM_API_ID_EFUSE_READ_SEC_SNAPSHOT):
 #ifdef XNVM_ACCESS_PUF_USER_DATA
 	case XNVM_API(XNVM_API_ID_EFUSE_PUF_USER_FUSE_WRITE):
 	case XNVM_API(XNVM_API_ID_EFUSE_READ_PUF_USER_FUSE):
@@ -30,6 +30,7 @@
 *       dc   08/29/2022 Removed initializations for optimization
 * 3.1   skg  10/25/2022 Added in body comments for APIs
 *       skg  12/07/2022 Added Additonal PPKs support
+*       fl   10/14/2026 Added eFuse security snapshot read
 *
 * </pre>
 *
@@ -72,6 +73,7 @@ static int XNvm_EfuseOffChipIdRead(XNvm_OffchipId IdNum, u32 AddrLow,
 	u32 AddrHigh);
 static int XNvm_EfuseDecEfuseOnlyRead(u32 AddrLow, u32 AddrHigh);
 static int XNvm_EfuseDnaRead(u32 AddrLow, u32 AddrHigh);
+static int XNvm_EfuseSecSnapshotRead(u32 AddrLow, u32 AddrHigh);
 #ifdef XNVM_ACCESS_PUF_USER_DATA
 static int XNvm_EfusePufUserDataWrite(u32 AddrLow, u32 AddrHigh);
 static int XNvm_EfusePufUserFusesRead(u32 AddrLow, u32 AddrHigh);
@@ -168,6 +170,9 @@ int XNvm_EfuseIpiHandler(XPlmi_Cmd *Cmd)
 	case XNVM_API(XNVM_API_ID_EFUSE_READ_DNA):
 		Status = XNvm_EfuseDnaRead(Pload[0U], Pload[1U]);
 		break;
+	case XNVM_API(XNVM_API_ID_EFUSE_READ_SEC_SNAPSHOT):
+		Status = XNvm_EfuseSecSnapshotRead(Pload[0U], Pload[1U]);
+		break;
 	default:
 		XNvm_Printf(XNVM_DEBUG_GENERAL, "CMD: INVALID PARAM\r\n");
 		Status = XST_INVALID_PARAM;
@@ -985,6 +990,95 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief       This function reads the eFuse security fields from the eFuse
+ * 		cache into one XNvm_EfuseSecSnapshot, so that a client can
+ * 		get all of them with a single request
+ *
+ * @param	AddrLow		Lower 32 bit address of the
+ * 				XNvm_EfuseSecSnapshot structure
+ *
+ * @param	AddrHigh	Higher 32 bit address of the
+ *				XNvm_EfuseSecSnapshot structure
+ *
+ * @return	- XST_SUCCESS - If the read is successful
+ * 		- ErrorCode - If there is a failure
+ *
+ ******************************************************************************/
+static int XNvm_EfuseSecSnapshotRead(u32 AddrLow, u32 AddrHigh)
+{
+	volatile int Status = XST_FAILURE;
+	u64 Addr = ((u64)AddrHigh << 32U) | (u64)AddrLow;
+	XNvm_EfuseSecSnapshot Snapshot;
+	u32 Idx;
+
+	Status = XNvm_EfuseReadSecCtrlBits(&Snapshot.SecCtrlBits);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XNvm_EfuseReadPufSecCtrlBits(&Snapshot.PufSecCtrlBits);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XNvm_EfuseReadMiscCtrlBits(&Snapshot.MiscCtrlBits);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XNvm_EfuseReadSecMisc1Bits(&Snapshot.SecMisc1Bits);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XNvm_EfuseReadBootEnvCtrlBits(&Snapshot.BootEnvCtrlBits);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	for (Idx = 0U; Idx <= (u32)XNVM_EFUSE_PPK2; Idx++) {
+		Status = XNvm_EfuseReadPpkHash(&Snapshot.PpkHash[Idx],
+				(XNvm_PpkType)Idx);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	for (Idx = 0U; Idx < XNVM_NUM_OF_REVOKE_ID_FUSES; Idx++) {
+		Status = XNvm_EfuseReadRevocationId(&Snapshot.RevokeId[Idx],
+				(XNvm_RevocationId)Idx);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	for (Idx = 0U; Idx < XNVM_NUM_OF_OFFCHIP_ID_FUSES; Idx++) {
+		Status = XNvm_EfuseReadOffchipRevokeId(&Snapshot.OffChipId[Idx],
+				(XNvm_OffchipId)Idx);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	Status = XNvm_EfuseReadDecOnly(&Snapshot.DecOnly);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XNvm_EfuseReadDna(&Snapshot.Dna);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XNvm_EfuseMemCopy((u64)(UINTPTR)&Snapshot, Addr,
+			sizeof(Snapshot));
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function copies word aligned or non word aligned data
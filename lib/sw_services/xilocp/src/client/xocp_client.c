@@ -21,6 +21,7 @@
 *       am   01/10/23 Added client side API for dme
 * 1.2   kpt  06/02/23 Updated XOcp_GetHwPcrLog
 *       kal  06/02/23 Added client side API for SW PCR
+* 1.3   fl   10/14/26 Added XOcp_ExtendSwPcrBatch
 *
 * </pre>
 *
@@ -228,6 +229,47 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief   This function sends one IPI request to extend the SW PCRs with a
+ *          list of hashes/data. The server validates the whole list before
+ *          it extends the first item and notifies the log update once.
+ *
+ * @param   InstancePtr - Pointer to the client instance
+ * @param   Items - Pointer to the XOcp_SwPcrExtendParams list
+ * @param   NumItems - Number of items, at most XOCP_MAX_SWPCR_BATCH_ITEMS
+ *
+ * @return
+ *          - XST_SUCCESS - If all the items are extended
+ *          - XST_FAILURE - Upon any failure
+ *
+ ******************************************************************************/
+int XOcp_ExtendSwPcrBatch(XOcp_ClientInstance *InstancePtr, XOcp_SwPcrExtendParams *Items,
+	u32 NumItems)
+{
+	volatile int Status = XST_FAILURE;
+	u32 Payload[XOCP_PAYLOAD_LEN_4U];
+	u64 ItemsAddr = (u64)(UINTPTR)Items;
+
+	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL) ||
+		(Items == NULL) || (NumItems == 0U) ||
+		(NumItems > XOCP_MAX_SWPCR_BATCH_ITEMS)) {
+		goto END;
+	}
+
+	/** Fill IPI Payload */
+	Payload[0U] = OcpHeader(0U, XOCP_API_EXTEND_SWPCR_BATCH);
+	Payload[1U] = (u32)ItemsAddr;
+	Payload[2U] = (u32)(ItemsAddr >> 32);
+	Payload[3U] = NumItems;
+
+	Status = XOcp_ProcessMailbox(InstancePtr->MailboxPtr, Payload,
+		sizeof(Payload)/sizeof(u32));
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief   This function sends IPI request to get the SW PCR value from
@@ -23,6 +23,7 @@
 *       am   01/10/23 Added client side API for dme
 * 1.2   kpt  06/02/23 Updated XOcp_GetHwPcrLog prototype
 *       kal  06/02/23 Added client side API for SW PCR
+* 1.3   fl   10/14/26 Added XOcp_ExtendSwPcrBatch
 *
 * </pre>
 *
@@ -62,6 +63,8 @@ int XOcp_GenDmeResp(XOcp_ClientInstance *InstancePtr, u64 NonceAddr, u64 DmeStru
 int XOcp_GetX509Cert(XOcp_ClientInstance *InstancePtr, u64 GetX509CertAddr);
 int XOcp_ClientAttestWithDevAk(XOcp_ClientInstance *InstancePtr, u64 AttestWithDevAk);
 int XOcp_ExtendSwPcr(XOcp_ClientInstance *InstancePtr, XOcp_SwPcrExtendParams *ExtendParams);
+int XOcp_ExtendSwPcrBatch(XOcp_ClientInstance *InstancePtr, XOcp_SwPcrExtendParams *Items,
+	u32 NumItems);
 int XOcp_GetSwPcr(XOcp_ClientInstance *InstancePtr, u32 PcrMask, u8 *PcrBuf, u32 PcrBufSize);
 int XOcp_GetSwPcrLog(XOcp_ClientInstance *InstancePtr, XOcp_SwPcrLogReadData *LogParams);
 int XOcp_GetSwPcrData(XOcp_ClientInstance *InstancePtr, XOcp_SwPcrReadData *DataParams);
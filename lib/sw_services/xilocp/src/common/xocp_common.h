@@ -24,6 +24,7 @@
 *       kal  06/02/2023 Added SW PCR related structures and macros
 *       am   08/18/2023 Added XOcp_OcpErrorStatus enum
 *       am   09/04/2023 Added XOCP_DICE_CDI_SEED_ZERO enum
+* 1.3   fl   10/14/2026 Added XOCP_MAX_SWPCR_BATCH_ITEMS macro
 *
 * </pre>
 *
@@ -64,6 +65,7 @@ extern "C" {
 #define XOCP_NUM_OF_SWPCRS			(0x8U) /**< Number of software pcrs */
 #define XOCP_EVENT_ID_NUM_OF_BYTES		(4U) /**< Number of bytes of pcr event ID*/
 #define XOCP_VERSION_NUM_OF_BYTES		(1U) /**< Number of bytes of ocp version */
+#define XOCP_MAX_SWPCR_BATCH_ITEMS		(16U) /**< Maximum SW PCR extends in one batch */
 
 /**************************** Type Definitions *******************************/
 
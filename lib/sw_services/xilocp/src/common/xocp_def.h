@@ -22,6 +22,7 @@
 * 1.1   am   12/21/22 Initial release
 *       am   01/10/23 Added XOCP_DME_NONCE_SIZE_IN_BITS macro for dme
 * 1.2   kal  05/28/23 Added SW PCR API IDs
+* 1.3   fl   10/14/26 Added XOCP_API_EXTEND_SWPCR_BATCH API ID
 *
 * </pre>
 * @note
@@ -99,7 +100,8 @@ typedef enum {
 	XOCP_API_GET_SWPCRLOG,	/**< 12U */
 	XOCP_API_GET_SWPCRDATA,	/**< 13U */
 	XOCP_API_GEN_SHARED_SECRET, /**< 14U*/
-	XOCP_API_MAX		/**< 15U */
+	XOCP_API_EXTEND_SWPCR_BATCH, /**< 15U */
+	XOCP_API_MAX		/**< 16U */
 } XOcp_ApiId;
 /** @} */
 
@@ -22,6 +22,7 @@
 * 1.2   kpt  06/02/23 Fixed circular buffer issues during HWPCR logging
 *       kal  06/02/23 Added SW PCR extend and logging functions
 *       yog  08/07/23 Replaced trng API calls using trngpsx driver
+* 1.3   fl   10/14/26 Added XOcp_ExtendSwPcrBatch
 *
 * </pre>
 * @note
@@ -128,6 +129,9 @@ static int XOcp_ClearDigestData(u32 PcrNum);
 static void XOcp_DmeStoreXppuDefaultConfig(void);
 static void XOcp_DmeRestoreXppuDefaultConfig(void);
 static int XOcp_GetPcr(u32 PcrMask, u64 PcrBuf, u32 PcrBufSize, u32 PcrType);
+static int XOcp_CheckSwPcrExtend(u32 PcrNum, u32 MeasurementIdx, u32 OverWrite);
+static int XOcp_StoreSwPcrExtend(u32 PcrNum, u32 MeasurementIdx, u64 DataAddr,
+	u32 DataSize, u32 OverWrite);
 
 /************************** Variable Definitions *****************************/
 /**< HW PCR log struture */
@@ -413,29 +417,22 @@ END:
 
 /*****************************************************************************/
 /**
- * @brief	This function extends the SW PCR with the provided data and also
- * 		stores the data into SW PCR log.
+ * @brief	This function validates a SW PCR extend request against the
+ * 		SW PCR configuration and the SW PCR log.
  *
  * @param	PcrNum 		To which SwPcr data needs to be extended
  * @param	MeasurementIdx	Position in which order the data has to be
  * 				extended
- * @param	DataAddr 	Address where the data to be extended is stored
- * @param 	DataSize 	Size of the data to be extended.
- *				If the data size exceeds the 48 bytes, the data
- *				pointer is stored and its caller responsibility
- *				to retain this data till lifetime of the PCR extended.
- *				Otherwise data is copied to internal PCR buffer.
  *		OverWrite	TRUE or FALSE
  *
  * @return
- *		- XST_SUCCESS - Upon success
- *		- XST_FAILURE - Upon failure
+ *		- XST_SUCCESS - If the request can be extended
+ *		- Error code - Upon failure
  *
  ******************************************************************************/
-int XOcp_ExtendSwPcr(u32 PcrNum, u32 MeasurementIdx, u64 DataAddr, u32 DataSize, u32 OverWrite)
+static int XOcp_CheckSwPcrExtend(u32 PcrNum, u32 MeasurementIdx, u32 OverWrite)
 {
 	int Status = XST_FAILURE;
-	u8 DataBlobHash[XOCP_PCR_HASH_SIZE_IN_BYTES] = {0U};
 	XOcp_SwPcrStore *SwPcr = XOcp_GetSwPcrInstance();
 	XOcp_SwPcrConfig *SwPcrConfig = XOcp_GetSwPcrConfigInstance();
 	u32 DigestIdxInLog = 0U;
@@ -479,6 +476,155 @@ int XOcp_ExtendSwPcr(u32 PcrNum, u32 MeasurementIdx, u64 DataAddr, u32 DataSize,
 		goto END;
 	}
 
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function extends the SW PCR with the provided data and also
+ * 		stores the data into SW PCR log.
+ *
+ * @param	PcrNum 		To which SwPcr data needs to be extended
+ * @param	MeasurementIdx	Position in which order the data has to be
+ * 				extended
+ * @param	DataAddr 	Address where the data to be extended is stored
+ * @param 	DataSize 	Size of the data to be extended.
+ *				If the data size exceeds the 48 bytes, the data
+ *				pointer is stored and its caller responsibility
+ *				to retain this data till lifetime of the PCR extended.
+ *				Otherwise data is copied to internal PCR buffer.
+ *		OverWrite	TRUE or FALSE
+ *
+ * @return
+ *		- XST_SUCCESS - Upon success
+ *		- XST_FAILURE - Upon failure
+ *
+ ******************************************************************************/
+int XOcp_ExtendSwPcr(u32 PcrNum, u32 MeasurementIdx, u64 DataAddr, u32 DataSize, u32 OverWrite)
+{
+	int Status = XST_FAILURE;
+
+	Status = XOcp_StoreSwPcrExtend(PcrNum, MeasurementIdx, DataAddr,
+		DataSize, OverWrite);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	/* Send Notification to the subscriber about the log update */
+	XPlmi_HandleSwError(XIL_NODETYPE_EVENT_ERROR_SW_ERR,
+                        XIL_EVENT_ERROR_PCR_LOG_UPDATE);
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function extends a list of SW PCR measurements in one
+ * 		request. All the items are validated before the first one is
+ * 		stored, then they are stored in list order, as consecutive
+ * 		XOcp_ExtendSwPcr calls would, and the subscribers are notified
+ * 		once about the log update.
+ *
+ * @param	ItemsAddr	Address of the XOcp_SwPcrExtendParams list
+ * @param	NumItems	Number of items in the list, at most
+ * 				XOCP_MAX_SWPCR_BATCH_ITEMS
+ *
+ * @return
+ *		- XST_SUCCESS - Upon success
+ *		- Error code - Upon failure, no item is stored if the list
+ *		  fails validation
+ *
+ ******************************************************************************/
+int XOcp_ExtendSwPcrBatch(u64 ItemsAddr, u32 NumItems)
+{
+	int Status = XST_FAILURE;
+	XOcp_SwPcrExtendParams Items[XOCP_MAX_SWPCR_BATCH_ITEMS];
+	u32 Index;
+	u32 Prev;
+
+	if ((NumItems == 0U) || (NumItems > XOCP_MAX_SWPCR_BATCH_ITEMS)) {
+		Status = (int)XST_INVALID_PARAM;
+		goto END;
+	}
+
+	Status = XPlmi_MemCpy64((u64)(UINTPTR)Items, ItemsAddr,
+		NumItems * (u32)sizeof(XOcp_SwPcrExtendParams));
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < NumItems; Index++) {
+		Status = XOcp_CheckSwPcrExtend(Items[Index].PcrNum,
+			Items[Index].MeasurementIdx, Items[Index].OverWrite);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		/* A digest extended earlier in the list is a duplicate too */
+		if (Items[Index].OverWrite == FALSE) {
+			for (Prev = 0U; Prev < Index; Prev++) {
+				if ((Items[Prev].PcrNum == Items[Index].PcrNum) &&
+					(Items[Prev].MeasurementIdx ==
+					Items[Index].MeasurementIdx)) {
+					Status = (int)XOCP_PCR_ERR_SWPCR_DUP_EXTEND;
+					goto END;
+				}
+			}
+		}
+	}
+
+	for (Index = 0U; Index < NumItems; Index++) {
+		Status = XOcp_StoreSwPcrExtend(Items[Index].PcrNum,
+			Items[Index].MeasurementIdx, Items[Index].DataAddr,
+			Items[Index].DataSize, Items[Index].OverWrite);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+	}
+
+	/* Send Notification to the subscriber about the log update */
+	if (Index != 0U) {
+		XPlmi_HandleSwError(XIL_NODETYPE_EVENT_ERROR_SW_ERR,
+			XIL_EVENT_ERROR_PCR_LOG_UPDATE);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function validates a SW PCR extend request, stores the
+ * 		data into SW PCR log and calculates the hash of the data blob.
+ *
+ * @param	PcrNum 		To which SwPcr data needs to be extended
+ * @param	MeasurementIdx	Position in which order the data has to be
+ * 				extended
+ * @param	DataAddr 	Address where the data to be extended is stored
+ * @param 	DataSize 	Size of the data to be extended
+ *		OverWrite	TRUE or FALSE
+ *
+ * @return
+ *		- XST_SUCCESS - Upon success
+ *		- Error code - Upon failure
+ *
+ ******************************************************************************/
+static int XOcp_StoreSwPcrExtend(u32 PcrNum, u32 MeasurementIdx, u64 DataAddr,
+	u32 DataSize, u32 OverWrite)
+{
+	int Status = XST_FAILURE;
+	u8 DataBlobHash[XOCP_PCR_HASH_SIZE_IN_BYTES] = {0U};
+	XOcp_SwPcrStore *SwPcr = XOcp_GetSwPcrInstance();
+	u32 DigestIdxInLog = 0U;
+
+	Status = XOcp_CheckSwPcrExtend(PcrNum, MeasurementIdx, OverWrite);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	DigestIdxInLog = XOcp_GetPcrOffsetInLog(PcrNum) + MeasurementIdx;
+
 	/*
 	 * Clear Digest data if it is already extended,
 	 * when OverWrite is TRUE.
@@ -537,9 +683,6 @@ int XOcp_ExtendSwPcr(u32 PcrNum, u32 MeasurementIdx, u64 DataAddr, u32 DataSize,
 	SwPcr->Data[DigestIdxInLog].IsReqExtended = TRUE;
 	SwPcr->CountPerPcr[PcrNum] += 1U ;
 
-	/* Send Notification to the subscriber about the log update */
-	XPlmi_HandleSwError(XIL_NODETYPE_EVENT_ERROR_SW_ERR,
-                        XIL_EVENT_ERROR_PCR_LOG_UPDATE);
 END:
 	return Status;
 }
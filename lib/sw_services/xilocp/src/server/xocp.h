@@ -20,6 +20,7 @@
 * 1.1   am   01/10/2023 Modified function argument type to u64 in
 *                       XOcp_GenerateDmeResponse().
 * 1.2   kal  05/28/2023 Added SW PCR extend and logging functions
+* 1.3   fl   10/14/2026 Added XOcp_ExtendSwPcrBatch
 *
 * </pre>
 *
@@ -112,6 +113,7 @@ int XOcp_GetHwPcr(u32 PcrMask, u64 PcrBuf, u32 PcrBufSize);
 int XOcp_GetHwPcrLog(u64 HwPcrEventsAddr, u64 HwPcrLogInfoAddr, u32 NumOfLogEntries);
 int XOcp_GenerateDmeResponse(u64 NonceAddr, u64 DmeStructResAddr);
 int XOcp_ExtendSwPcr(u32 PcrNum, u32 MeasurementIdx, u64 DataAddr, u32 DataSize, u32 PdiType);
+int XOcp_ExtendSwPcrBatch(u64 ItemsAddr, u32 NumItems);
 int XOcp_StoreSwPcrConfig(u32 *Pload, u32 Len);
 int XOcp_GetSwPcrLog(u64 Addr);
 int XOcp_GetSwPcrData(u64 Addr);
@@ -22,6 +22,7 @@
 *       kal  05/28/23 Added SW PCR extend and logging functions
 *       bm   06/23/23 Added access permissions for IPI commands
 *       har  07/21/23 Add access permission for XOCP_API_GEN_SHARED_SECRET
+* 1.3   fl   10/14/26 Added XOCP_API_EXTEND_SWPCR_BATCH
 *
 * </pre>
 *
@@ -64,6 +65,7 @@ static XPlmi_AccessPerm_t XOcp_AccessPermBuff[XOCP_API_MAX] =
 	XPLMI_ALL_IPI_FULL_ACCESS(XOCP_API_GET_SWPCRLOG),
 	XPLMI_ALL_IPI_FULL_ACCESS(XOCP_API_GET_SWPCRDATA),
 	XPLMI_ALL_IPI_FULL_ACCESS(XOCP_API_GEN_SHARED_SECRET),
+	XPLMI_ALL_IPI_FULL_ACCESS(XOCP_API_EXTEND_SWPCR_BATCH),
 };
 
 static XPlmi_Module XPlmi_Ocp =
@@ -120,6 +122,7 @@ static int XOcp_FeaturesCmd(u32 ApiId)
 		case XOCP_API(XOCP_API_GET_SWPCRLOG):
 		case XOCP_API(XOCP_API_GET_SWPCRDATA):
 		case XOCP_API(XOCP_API_GEN_SHARED_SECRET):
+		case XOCP_API(XOCP_API_EXTEND_SWPCR_BATCH):
 			Status = XST_SUCCESS;
 			break;
 		default:
@@ -168,6 +171,7 @@ static int XOcp_ProcessCmd(XPlmi_Cmd *Cmd)
 		case XOCP_API(XOCP_API_GET_SWPCRLOG):
 		case XOCP_API(XOCP_API_GET_SWPCRDATA):
 		case XOCP_API(XOCP_API_GEN_SHARED_SECRET):
+		case XOCP_API(XOCP_API_EXTEND_SWPCR_BATCH):
 			Status = XOcp_IpiHandler(Cmd);
 			break;
 		case XOCP_API(XOCP_API_DEVAKINPUT):
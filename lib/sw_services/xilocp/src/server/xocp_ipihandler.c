@@ -21,6 +21,7 @@
 * 1.2   kpt  06/02/23 Updated XOcp_GetPcrLogIpi to XOcp_GetHwPcrLogIpi
 *       kal  06/02/23 Added handler API for SW PCR
 *       am   09/04/23 Cleared SharedSecretTmp array
+* 1.3   fl   10/14/26 Added handler API for SW PCR batch extend
 *
 * </pre>
 *
@@ -56,6 +57,7 @@ static int XOcp_AttestWithDevAkIpi(u32 AttestWithDevAkLow,
 			u32 AttestWithDevAkHigh, u32 SubSystemID);
 static int XOcp_SetSwPcrConfig(u32 *Pload, u32 Len);
 static int XOcp_ExtendSwPcrIpi(u32 ExtParamsAddrLow, u32 ExtParamsAddrHigh);
+static int XOcp_ExtendSwPcrBatchIpi(u32 ItemsAddrLow, u32 ItemsAddrHigh, u32 NumItems);
 static int XOcp_GetSwPcrIpi(u32 PcrMask, u32 PcrBuffAddrLow, u32 PcrBuffAddrHigh, u32 PcrBufSize);
 static int XOcp_GetSwPcrLogIpi(u32 AddrLow, u32 AddrHigh);
 static int XOcp_GetSwPcrDataIpi(u32 AddrLow, u32 AddrHigh);
@@ -112,6 +114,9 @@ int XOcp_IpiHandler(XPlmi_Cmd *Cmd)
 		case XOCP_API(XOCP_API_EXTEND_SWPCR):
 			Status = XOcp_ExtendSwPcrIpi(Pload[0], Pload[1]);
 			break;
+		case XOCP_API(XOCP_API_EXTEND_SWPCR_BATCH):
+			Status = XOcp_ExtendSwPcrBatchIpi(Pload[0], Pload[1], Pload[2]);
+			break;
 		case XOCP_API(XOCP_API_GET_SWPCR):
 			Status = XOcp_GetSwPcrIpi(Pload[0], Pload[1], Pload[2], Pload[3]);
 			break;
@@ -365,6 +370,29 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief   This function handler calls XOcp_ExtendSwPcrBatch to extend a
+ * 	    list of measurements to the SW PCRs
+ *
+ * @param   ItemsAddrLow - Lower 32 bit address of the XOcp_SwPcrExtendParams list
+ * @param   ItemsAddrHigh - Higher 32 bit address of the XOcp_SwPcrExtendParams list
+ * @param   NumItems - Number of items in the list
+ *
+ * @return
+ *          - XST_SUCCESS - Upon success
+ *          - ErrorCode - Upon any failure
+ ******************************************************************************/
+static int XOcp_ExtendSwPcrBatchIpi(u32 ItemsAddrLow, u32 ItemsAddrHigh, u32 NumItems)
+{
+	volatile int Status = XST_FAILURE;
+	u64 Addr = ((u64)ItemsAddrHigh << 32U) | (u64)ItemsAddrLow;
+
+	Status = XOcp_ExtendSwPcrBatch(Addr, NumItems);
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief   This function handler calls XOcp_GetSwPcr server API to get
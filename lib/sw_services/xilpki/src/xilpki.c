@@ -24,6 +24,7 @@
  *                       other secure library version info API's.
  * 2.0   Nava  09/07/23  Fixed issues with IRQ signal.
  * 2.0   Nava  09/11/23  Fixed doxygen warnings.
+ * 2.0   fl    10/14/26  Added XilPki_EnQueueMultiple() to submit a list of requests.
  *
  *</pre>
  *
@@ -812,6 +813,62 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief      This function is used to submit a list of crypto operations to
+ *		the PKI Queues without waiting for any of them to complete.
+ *
+ * @param   InstancePtr     Pointer to the XPki instance
+ * @param   Request_InfoList	Pointer to the list of queue info structures
+ * @param   Count		Number of requests in Request_InfoList
+ * @param   RequestIDList	Pointer to the list of RequestIDs, filled with the
+ *				unique id of each submitted request
+ * @param   SubmitCount	Pointer to the number of requests submitted
+ *
+ * @return
+ *      -       XST_SUCCESS - If all the requests are submitted
+ *      -       XPKI_INVALID_PARAM - On invalid argument
+ *      -       XPKI_QUEUE_FULL - If the queues are full, the remaining
+ *				requests can be submitted after the submitted
+ *				ones are dequeued
+ *      -       XPKI_UNSUPPORTED_OPS - If the requested operation is
+ *						  not supported.
+ *      -       XST_FAILURE - On failure
+ *
+ * @note	Submission stops at the first request which fails, SubmitCount
+ *		gives the index of that request. Completion of each submitted
+ *		request is notified through its XPki_CompletionCallBack.
+******************************************************************************/
+int XilPki_EnQueueMultiple(XPki_Instance *InstancePtr,
+			   XPki_Request_Info *Request_InfoList, u32 Count,
+			   u32 *RequestIDList, u32 *SubmitCount)
+{
+	volatile int Status = XST_FAILURE;
+	u32 Index = 0U;
+
+	/* Validate the input arguments */
+	if ((InstancePtr == NULL) || (Request_InfoList == NULL) ||
+	    (RequestIDList == NULL) || (SubmitCount == NULL)) {
+		Status = XPKI_INVALID_PARAM;
+		goto END;
+	}
+
+	Status = XST_SUCCESS;
+	while (Index < Count) {
+		Status = XilPki_EnQueue(InstancePtr, &Request_InfoList[Index],
+					&RequestIDList[Index]);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		Index++;
+	}
+
+	*SubmitCount = Index;
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief       This function is used to get the crypto operation results from
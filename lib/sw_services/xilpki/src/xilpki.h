@@ -40,6 +40,7 @@
  *                       other secure library version info API's.
  * 2.0   Nava  09/07/23  Fixed issues with IRQ signal.
  * 2.0   Nava  09/11/23  Fixed doxygen warnings.
+ * 2.0   fl    10/14/26  Added XilPki_EnQueueMultiple() to submit a list of requests.
  *
  * </pre>
  *
@@ -292,6 +293,9 @@ int XPki_EcdsaPwct(XPki_Instance *InstancePtr, XPki_EcdsaCrvInfo *CrvInfo,
 int XPki_TrngGenerateRandomNum(u8 GenSize, u8 *RandBuf);
 int XilPki_EnQueue(XPki_Instance *InstancePtr, XPki_Request_Info *Request_InfoPtr,
 		   u32 *RequestID);
+int XilPki_EnQueueMultiple(XPki_Instance *InstancePtr,
+			   XPki_Request_Info *Request_InfoList, u32 Count,
+			   u32 *RequestIDList, u32 *SubmitCount);
 int XilPki_DeQueue(XPki_Instance *InstancePtr, XPki_Request_Info *Request_InfoPtr,
 		   u32 RequestID);
 void XPki_Close(void);
@@ -62,6 +62,8 @@
 *       rama 08/10/2023 Changed CDO cmd execute failure prints to DEBUG_ALWAYS
 *                       for debug level_0 option
 *       dd   09/12/2023 MISRA-C violation Rule 10.3 fixed
+* 1.09  fl   10/14/2026 Complete the slave SLR streams before commands
+*                       other than keyhole writes
 *
 * </pre>
 *
@@ -78,10 +80,17 @@
 #include "xplmi_generic.h"
 #include "xplmi_wdt.h"
 #include "xplmi_tamper.h"
+#include "xplmi_modules.h"
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+#include "xplmi_ssit.h"
+#endif
 
 /************************** Constant Definitions *****************************/
 #define XPLMI_CMD_LEN_TEMPBUF		(0x8U) /**< This buffer is used to
 			store commands which extend across 32K boundaries */
+#define XPLMI_CMD_KEYHOLE_HDR		((XPLMI_MODULE_GENERIC_ID << \
+			XPLMI_CMD_MODULE_ID_SHIFT) | XPLMI_WRITE_KEYHOLE_CMD_ID) /**<
+			Module and API ID of the keyhole write command */
 
 /**************************** Type Definitions *******************************/
 
@@ -373,6 +382,20 @@ static int XPlmi_CdoCmdExecute(XPlmiCdo *CdoPtr, u32 *BufPtr, u32 BufLen, u32 *S
 		XPlmi_Out32(PMC_GLOBAL_PMC_GSW_ERR, CdoPtr->PartitionOffset +
 			CdoPtr->ProcessedCdoLen + XPLMI_CDO_HDR_LEN);
 	}
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+	/**
+	 * Only keyhole writes run while slave SLR streams are in progress,
+	 * any other command may depend on the streamed data or use the DMAs
+	 */
+	if ((CmdPtr->KeyHoleParams.IsSlrStreamEn == (u8)TRUE) &&
+		((CmdPtr->CmdId & (XPLMI_CMD_MODULE_ID_MASK |
+		XPLMI_CMD_API_ID_MASK)) != XPLMI_CMD_KEYHOLE_HDR)) {
+		Status = XPlmi_SsitStreamFlush();
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+#endif
 	Status = XPlmi_CmdExecute(CmdPtr);
 	if (Status != XST_SUCCESS) {
 		XPlmi_Printf(DEBUG_PRINT_ALWAYS,
@@ -27,6 +27,7 @@
 *       bm   03/09/2023 Add NULL check for module before using it
 *       ng   03/30/2023 Updated algorithm and return values in doxygen comments
 * 1.05  bm   06/13/2023 Add API to just log PLM error
+*       fl   10/14/2026 Added optional command handler cache
 * </pre>
 *
 * @note
@@ -40,42 +41,68 @@
 #include "xil_assert.h"
 
 /************************** Constant Definitions *****************************/
+#ifdef PLM_ENABLE_CMD_HANDLER_CACHE
+#define XPLMI_CMD_HANDLER_CACHE_SIZE	(32U) /**< Number of cached handlers,
+						power of 2 */
+#define XPLMI_CMD_HDR_MASK		(XPLMI_CMD_MODULE_ID_MASK | \
+					XPLMI_CMD_API_ID_MASK)
+#endif
 
 /**************************** Type Definitions *******************************/
+#ifdef PLM_ENABLE_CMD_HANDLER_CACHE
+typedef struct {
+	u32 CmdHdr;	/**< Module and API IDs of the command */
+	const XPlmi_ModuleCmd *ModuleCmd; /**< Registered command, NULL if the
+					  entry is empty */
+} XPlmi_CmdHandlerCacheEntry;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static int XPlmi_GetModuleCmd(u32 CmdId, const XPlmi_ModuleCmd **ModuleCmdPtr);
 
 /************************** Variable Definitions *****************************/
+#ifdef PLM_ENABLE_CMD_HANDLER_CACHE
+/* Modules are registered only once, so the cached handlers never go stale */
+static XPlmi_CmdHandlerCacheEntry CmdHandlerCache[XPLMI_CMD_HANDLER_CACHE_SIZE];
+#endif
 
 /*****************************************************************************/
 /*****************************************************************************/
 /**
- * @brief	This function will call the command handler registered with the
- * 			command. Command handler shall execute the command till the
- * 			payload length.
+ * @brief	This function looks up the registered command of a command ID.
  *
- * @param	CmdPtr is pointer to command structure
+ * @param	CmdId is the command header
+ * @param	ModuleCmdPtr is updated with the registered command
  *
  * @return
  * 			- XST_SUCCESS on success.
  * 			- XPLMI_ERR_MODULE_MAX if the module is not registered.
  * 			- XPLMI_ERR_CMD_APIID on invalid module and unregistered CMD ID.
  * 			- XPLMI_ERR_CMD_HANDLER_NULL if command handler is not registered.
- * 			- XPLMI_ERR_CDO_CMD on invalid CDO command handler.
  *
  *****************************************************************************/
-int XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr)
+static int XPlmi_GetModuleCmd(u32 CmdId, const XPlmi_ModuleCmd **ModuleCmdPtr)
 {
 	int Status = XST_FAILURE;
-	u32 CdoErr;
-	u32 ModuleId = (CmdPtr->CmdId & XPLMI_CMD_MODULE_ID_MASK) >> 8U;
-	u32 ApiId = CmdPtr->CmdId & XPLMI_CMD_API_ID_MASK;
+	u32 ModuleId = (CmdId & XPLMI_CMD_MODULE_ID_MASK) >> 8U;
+	u32 ApiId = CmdId & XPLMI_CMD_API_ID_MASK;
 	const XPlmi_Module *Module = NULL;
 	const XPlmi_ModuleCmd *ModuleCmd = NULL;
+#ifdef PLM_ENABLE_CMD_HANDLER_CACHE
+	XPlmi_CmdHandlerCacheEntry *Entry = &CmdHandlerCache[(ModuleId ^ ApiId) &
+		(XPLMI_CMD_HANDLER_CACHE_SIZE - 1U)];
+
+	/** - Use the cached command if it was looked up before */
+	if ((Entry->ModuleCmd != NULL) &&
+		(Entry->CmdHdr == (CmdId & XPLMI_CMD_HDR_MASK))) {
+		*ModuleCmdPtr = Entry->ModuleCmd;
+		Status = XST_SUCCESS;
+		goto END;
+	}
+#endif
 
-	XPlmi_Printf(DEBUG_DETAILED, "CMD Execute \n\r");
 	/** - Assign Module */
 	if (ModuleId >= XPLMI_MAX_MODULES) {
 		Status = XPlmi_UpdateStatus(XPLMI_ERR_MODULE_MAX, 0);
@@ -101,6 +128,44 @@ int XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr)
 		Status = XPlmi_UpdateStatus(XPLMI_ERR_CMD_HANDLER_NULL, 0);
 		goto END;
 	}
+#ifdef PLM_ENABLE_CMD_HANDLER_CACHE
+	Entry->CmdHdr = CmdId & XPLMI_CMD_HDR_MASK;
+	Entry->ModuleCmd = ModuleCmd;
+#endif
+	*ModuleCmdPtr = ModuleCmd;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function will call the command handler registered with the
+ * 			command. Command handler shall execute the command till the
+ * 			payload length.
+ *
+ * @param	CmdPtr is pointer to command structure
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XPLMI_ERR_MODULE_MAX if the module is not registered.
+ * 			- XPLMI_ERR_CMD_APIID on invalid module and unregistered CMD ID.
+ * 			- XPLMI_ERR_CMD_HANDLER_NULL if command handler is not registered.
+ * 			- XPLMI_ERR_CDO_CMD on invalid CDO command handler.
+ *
+ *****************************************************************************/
+int XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr)
+{
+	int Status = XST_FAILURE;
+	u32 CdoErr;
+	const XPlmi_ModuleCmd *ModuleCmd = NULL;
+
+	XPlmi_Printf(DEBUG_DETAILED, "CMD Execute \n\r");
+	Status = XPlmi_GetModuleCmd(CmdPtr->CmdId, &ModuleCmd);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
 	XPlmi_Printf(DEBUG_DETAILED, "CMD 0x%0x, Len 0x%0x, PayloadLen 0x%0x \n\r",
 			CmdPtr->CmdId, CmdPtr->Len, CmdPtr->PayloadLen);
 
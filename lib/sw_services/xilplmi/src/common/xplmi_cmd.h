@@ -46,6 +46,7 @@
 *                       boundaries
 * 1.8   skg  10/04/2022 Added masks for SLR ID and Zeriozing the SLR ID
 * 1.9   bm   07/06/2023 Added XPlmi_ClearEndStack member to XPlmi_Cmd structure
+* 1.10  fl   10/14/2026 Added IsSlrStreamEn member to XPlmi_KeyHoleParams
 *
 * </pre>
 *
@@ -92,6 +93,7 @@ struct XPlmi_KeyHoleParams {
 	u32 ExtraWords; /**< Words that are directly DMAed to CFI */
 	int (*Func) (u64 SrcAddr, u64 DestAddress, u32 Length, u32 Flags);
 	u8 IsNextChunkCopyStarted; /**< Used to check if next chunk is copied or not */
+	u8 IsSlrStreamEn; /**< Keyhole writes to slave SLRs are streamed */
 };
 
 struct XPlmi_Cmd {
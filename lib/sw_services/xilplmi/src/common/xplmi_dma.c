@@ -49,6 +49,8 @@
 *       ng   03/30/2023 Updated algorithm and return values in doxygen comments
 * 1.09  ng   07/06/2023 Added support for SDT flow
 *       am   08/23/2023 Fixed doxygen comment for XPlmi_DmaXfr Len in words
+* 1.10  fl   10/14/2026 Added XPlmi_DmaXfrQueue with completion callbacks
+*                       dispatched from the task loop
 *
 * </pre>
 *
@@ -65,11 +67,38 @@
 #include "xplmi_status.h"
 #include "xplmi_hw.h"
 #include "xplmi_plat.h"
+#include "xplmi_task.h"
 
 /************************** Constant Definitions *****************************/
 #define XPLMI_XCSUDMA_DEST_CTRL_OFFSET		(0x80CU) /**< CSUDMA destination control offset */
+#define XPLMI_DMA_QUEUE_LEN		(8U) /**< Transfers queued per PMC DMA */
+#define XPLMI_DMA_QUEUE_NUM		(2U) /**< One queue per PMC DMA */
+#define XPLMI_DMA_QUEUE_SRC_ERR_MASK	(XPMCDMA_IXR_INVALID_APB_MASK | \
+	XPMCDMA_IXR_TIMEOUT_MEM_MASK | XPMCDMA_IXR_TIMEOUT_STRM_MASK | \
+	XPMCDMA_IXR_AXI_WRERR_MASK) /**< Source channel error interrupts */
+#define XPLMI_DMA_QUEUE_DST_ERR_MASK	(XPLMI_DMA_QUEUE_SRC_ERR_MASK | \
+	XPMCDMA_IXR_FIFO_OVERFLOW_MASK) /**< Destination channel error
+						interrupts */
 
 /**************************** Type Definitions *******************************/
+/** Transfer queued with XPlmi_DmaXfrQueue */
+typedef struct {
+	u64 SrcAddr;		/**< Source address */
+	u64 DestAddr;		/**< Destination address */
+	u32 Len;		/**< Length in words */
+	u32 Flags;		/**< DMA and burst flags */
+	XPlmi_DmaDoneCb_t DoneCb;	/**< Completion callback */
+	void *CbData;		/**< Completion callback data */
+} XPlmi_DmaQueueEntry;
+
+/** Transfer queue of one PMC DMA */
+typedef struct {
+	XPmcDma *DmaPtr;	/**< PMC DMA serving the queue */
+	XPlmi_DmaQueueEntry Entry[XPLMI_DMA_QUEUE_LEN]; /**< Queued transfers */
+	u8 Head;		/**< Oldest queued transfer */
+	u8 Count;		/**< Number of queued transfers */
+	u8 Active;		/**< TRUE if the head transfer is started */
+} XPlmi_DmaQueue;
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -86,12 +115,18 @@ static void XPlmi_SSSCfgDmaSbi(u32 Flags);
 static int XPlmi_DmaChXfer(u64 Addr, u32 Len, XPmcDma_Channel Channel, u32 Flags);
 static int XPlmi_StartDma(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags,
                 XPmcDma** DmaPtrAddr);
+static int XPlmi_DmaQueueTask(void *Arg);
+static XPlmi_DmaQueue *XPlmi_GetDmaQueue(u32 Flags);
+static void XPlmi_DmaQueueStart(XPlmi_DmaQueue *Queue);
+static int XPlmi_DmaQueueService(XPlmi_DmaQueue *Queue, u8 Wait);
 
 /************************** Variable Definitions *****************************/
 static XPmcDma PmcDma0;		/**<Instance of the Pmc_Dma Device */
 static XPmcDma PmcDma1;		/**<Instance of the Pmc_Dma Device */
 static XPmcDma_Configure DmaCtrl = {0x40U, 0U, 0U, 0U, 0xFFEU, 0x80U,
 			0U, 0U, 0U, 0xFFFU, 0x8U};  /* Default values of CTRL */
+static XPlmi_DmaQueue DmaQueue[XPLMI_DMA_QUEUE_NUM]; /**< PMC DMA queues */
+static XPlmi_TaskNode *DmaQueueTask = NULL; /**< Task serving the queues */
 
 /*****************************************************************************/
 /**
@@ -823,6 +858,291 @@ static int XPlmi_StartDma(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function queues a DMA to DMA transfer on the PMC DMA selected
+ * by Flags. The transfer is started at once if the DMA is idle, otherwise
+ * when the transfers queued before it are done. The completion callback is
+ * called from the PLM task loop.
+ *
+ * @param	SrcAddr for SRC channel to fetch data from
+ * @param	DestAddr for DST channel to store the data
+ * @param	Len of the data in words
+ * @param	Flags to select PMC DMA and DMA Burst type, non blocking flags
+ *		are ignored
+ * @param	DoneCb is called with CbData and the transfer status once the
+ *		transfer is done, it can be NULL
+ * @param	CbData is passed to DoneCb
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XST_INVALID_PARAM if Len is zero.
+ * 			- XST_DEVICE_BUSY if the queue of the DMA is full.
+ * 			- XPLM_ERR_TASK_CREATE if the queue task creation fails.
+ *
+ *****************************************************************************/
+int XPlmi_DmaXfrQueue(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags,
+	XPlmi_DmaDoneCb_t DoneCb, void *CbData)
+{
+	int Status = XST_FAILURE;
+	XPlmi_DmaQueue *Queue;
+	XPlmi_DmaQueueEntry *Entry;
+	u32 Slot;
+
+	if (Len == 0U) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	if (DmaQueueTask == NULL) {
+		DmaQueueTask = XPlmi_GetTaskInstance(XPlmi_DmaQueueTask, NULL,
+				XPLMI_INVALID_INTR_ID);
+		if (DmaQueueTask == NULL) {
+			DmaQueueTask = XPlmi_TaskCreate(XPLM_TASK_PRIORITY_1,
+					XPlmi_DmaQueueTask, NULL);
+			if (DmaQueueTask == NULL) {
+				Status = XPlmi_UpdateStatus(XPLM_ERR_TASK_CREATE, 0);
+				goto END;
+			}
+			DmaQueueTask->IntrId = XPLMI_INVALID_INTR_ID;
+		}
+	}
+
+	Queue = XPlmi_GetDmaQueue(Flags);
+	if (Queue->Count == XPLMI_DMA_QUEUE_LEN) {
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	Slot = ((u32)Queue->Head + (u32)Queue->Count) % XPLMI_DMA_QUEUE_LEN;
+	Entry = &Queue->Entry[Slot];
+	Entry->SrcAddr = SrcAddr;
+	Entry->DestAddr = DestAddr;
+	Entry->Len = Len;
+	Entry->Flags = Flags & ~(XPLMI_DMA_SRC_NONBLK | XPLMI_DMA_DST_NONBLK);
+	Entry->DoneCb = DoneCb;
+	Entry->CbData = CbData;
+	++Queue->Count;
+
+	if (Queue->Active == (u8)FALSE) {
+		XPlmi_DmaQueueStart(Queue);
+	}
+	XPlmi_TaskTriggerNow(DmaQueueTask);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits until all transfers queued on a PMC DMA with
+ * XPlmi_DmaXfrQueue are done, calling their completion callbacks. It must be
+ * called before the blocking DMA APIs are used on the same PMC DMA.
+ *
+ * @param	DmaFlags to differentiate between PMCDMA_0 and PMCDMA_1
+ *
+ * @return
+ * 			- XST_SUCCESS if all transfers completed successfully.
+ * 			- Error code of the first failed transfer otherwise.
+ *
+ *****************************************************************************/
+int XPlmi_DmaQueueFlush(u32 DmaFlags)
+{
+	int Status = XST_SUCCESS;
+	int XfrStatus;
+	XPlmi_DmaQueue *Queue = XPlmi_GetDmaQueue(DmaFlags);
+
+	while (Queue->Active == (u8)TRUE) {
+		XfrStatus = XPlmi_DmaQueueService(Queue, (u8)TRUE);
+		if ((XfrStatus != XST_SUCCESS) && (Status == XST_SUCCESS)) {
+			Status = XfrStatus;
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is the PLM task serving the DMA queues. It retires
+ * the completed transfer of each PMC DMA, starts the next queued one and
+ * triggers itself again while transfers are in progress.
+ *
+ * @param	Arg is not used
+ *
+ * @return
+ * 			- XST_SUCCESS always, transfer errors are reported through
+ * 			the completion callbacks.
+ *
+ *****************************************************************************/
+static int XPlmi_DmaQueueTask(void *Arg)
+{
+	u32 Index;
+
+	(void)Arg;
+
+	for (Index = 0U; Index < XPLMI_DMA_QUEUE_NUM; Index++) {
+		(void)XPlmi_DmaQueueService(&DmaQueue[Index], (u8)FALSE);
+	}
+
+	if ((DmaQueue[0U].Active == (u8)TRUE) ||
+		(DmaQueue[1U].Active == (u8)TRUE)) {
+		XPlmi_TaskTriggerNow(DmaQueueTask);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the queue of the PMC DMA selected by Flags.
+ *
+ * @param	Flags to differentiate between PMCDMA_0 and PMCDMA_1
+ *
+ * @return
+ * 			- Pointer to the DMA queue
+ *
+ *****************************************************************************/
+static XPlmi_DmaQueue *XPlmi_GetDmaQueue(u32 Flags)
+{
+	XPlmi_DmaQueue *Queue;
+
+	if ((Flags & XPLMI_PMCDMA_0) == XPLMI_PMCDMA_0) {
+		Queue = &DmaQueue[0U];
+		Queue->DmaPtr = &PmcDma0;
+	} else {
+		Queue = &DmaQueue[1U];
+		Queue->DmaPtr = &PmcDma1;
+	}
+
+	return Queue;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function starts the transfer at the head of a DMA queue.
+ *
+ * @param	Queue is pointer to the DMA queue
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_DmaQueueStart(XPlmi_DmaQueue *Queue)
+{
+	const XPlmi_DmaQueueEntry *Entry = &Queue->Entry[Queue->Head];
+	XPmcDma *DmaPtr;
+
+	(void)XPlmi_StartDma(Entry->SrcAddr, Entry->DestAddr, Entry->Len,
+		Entry->Flags, &DmaPtr);
+	Queue->Active = (u8)TRUE;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function retires the transfer in progress on a DMA queue
+ * once both channels are done, starts the next queued transfer and then
+ * calls the completion callback of the retired one.
+ *
+ * @param	Queue is pointer to the DMA queue
+ * @param	Wait is TRUE to wait for the transfer to complete, FALSE to
+ *		return at once if it is still in progress
+ *
+ * @return
+ * 			- XST_SUCCESS if the transfer completed or none was active.
+ * 			- XST_DEVICE_BUSY if the transfer is still in progress.
+ * 			- XPLMI_ERR_DMA_XFER_WAIT_SRC if Dma Xfer failed in Src Channel
+ * 			wait for done or reported an error.
+ * 			- XPLMI_ERR_DMA_XFER_WAIT_DEST if Dma Xfer failed in Dest Channel
+ * 			wait for done or reported an error.
+ *
+ *****************************************************************************/
+static int XPlmi_DmaQueueService(XPlmi_DmaQueue *Queue, u8 Wait)
+{
+	int Status = XST_FAILURE;
+	XPmcDma *DmaPtr = Queue->DmaPtr;
+	XPlmi_DmaQueueEntry Entry;
+	XPlmi_WaitForDmaDone_t XPlmi_WaitForDmaDone;
+	u32 SrcIntr;
+	u32 DstIntr;
+
+	if (Queue->Active == (u8)FALSE) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	Entry = Queue->Entry[Queue->Head];
+	if (Wait == (u8)TRUE) {
+		XPlmi_WaitForDmaDone = XPlmi_GetPlmiWaitForDone(Entry.DestAddr);
+		if (XPlmi_WaitForDmaDone == NULL) {
+			goto RETIRE;
+		}
+		Status = XPlmi_WaitForDmaDone(DmaPtr, XPMCDMA_SRC_CHANNEL);
+		if (Status != XST_SUCCESS) {
+			Status = XPlmi_UpdateStatus(XPLMI_ERR_DMA_XFER_WAIT_SRC,
+					Status);
+			goto RETIRE;
+		}
+		Status = XPlmi_WaitForDmaDone(DmaPtr, XPMCDMA_DST_CHANNEL);
+		if (Status != XST_SUCCESS) {
+			Status = XPlmi_UpdateStatus(XPLMI_ERR_DMA_XFER_WAIT_DEST,
+					Status);
+			goto RETIRE;
+		}
+	} else {
+		SrcIntr = XPmcDma_IntrGetStatus(DmaPtr, XPMCDMA_SRC_CHANNEL);
+		DstIntr = XPmcDma_IntrGetStatus(DmaPtr, XPMCDMA_DST_CHANNEL);
+		/* A failed transfer may never signal done, check errors first */
+		if ((SrcIntr & XPLMI_DMA_QUEUE_SRC_ERR_MASK) != 0U) {
+			Status = XPlmi_UpdateStatus(XPLMI_ERR_DMA_XFER_WAIT_SRC,
+				(int)(SrcIntr & XPLMI_DMA_QUEUE_SRC_ERR_MASK));
+			goto RETIRE;
+		}
+		if ((DstIntr & XPLMI_DMA_QUEUE_DST_ERR_MASK) != 0U) {
+			Status = XPlmi_UpdateStatus(XPLMI_ERR_DMA_XFER_WAIT_DEST,
+				(int)(DstIntr & XPLMI_DMA_QUEUE_DST_ERR_MASK));
+			goto RETIRE;
+		}
+		if (((SrcIntr & XPMCDMA_IXR_DONE_MASK) == 0U) ||
+			((DstIntr & XPMCDMA_IXR_DONE_MASK) == 0U)) {
+			Status = XST_DEVICE_BUSY;
+			goto END;
+		}
+		Status = XST_SUCCESS;
+	}
+
+RETIRE:
+	/* To acknowledge the transfer has completed or failed */
+	XPmcDma_IntrClear(DmaPtr, XPMCDMA_SRC_CHANNEL, XPMCDMA_IXR_DONE_MASK |
+		XPLMI_DMA_QUEUE_SRC_ERR_MASK);
+	XPmcDma_IntrClear(DmaPtr, XPMCDMA_DST_CHANNEL, XPMCDMA_IXR_DONE_MASK |
+		XPLMI_DMA_QUEUE_DST_ERR_MASK);
+
+	/* Reverting the AXI Burst setting of PMC_DMA */
+	if ((Entry.Flags & (XPLMI_SRC_CH_AXI_FIXED | XPLMI_DST_CH_AXI_FIXED)) !=
+		0U) {
+		DmaCtrl.AxiBurstType = 0U;
+		XPmcDma_SetConfig(DmaPtr, XPMCDMA_SRC_CHANNEL, &DmaCtrl);
+		XPmcDma_SetConfig(DmaPtr, XPMCDMA_DST_CHANNEL, &DmaCtrl);
+	}
+
+	Queue->Head = (u8)((Queue->Head + 1U) % XPLMI_DMA_QUEUE_LEN);
+	--Queue->Count;
+	Queue->Active = (u8)FALSE;
+
+	/* Keep the DMA busy before running the callback */
+	if (Queue->Count != 0U) {
+		XPlmi_DmaQueueStart(Queue);
+	}
+
+	if (Entry.DoneCb != NULL) {
+		Entry.DoneCb(Entry.CbData, Status);
+	}
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to initialize the ECC memory.
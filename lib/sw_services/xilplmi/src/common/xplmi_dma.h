@@ -30,6 +30,7 @@
 * 1.05  bm   01/20/2022 Fix compilation warnings in Xil_SMemCpy
 * 1.06  bm   07/06/2022 Refactor versal and versal_net code
 * 1.09  ng   07/06/2023 Added support for SDT flow
+* 1.10  fl   10/14/2026 Added XPlmi_DmaXfrQueue and XPlmi_DmaQueueFlush
 *
 * </pre>
 *
@@ -85,6 +86,9 @@ extern "C" {
 #define XPLMI_WORD_LEN_MASK			(0x3U)
 #define XPLMI_WORD_LEN_SHIFT			(0x2U)
 
+/* Completion callback of XPlmi_DmaXfrQueue */
+typedef void (*XPlmi_DmaDoneCb_t)(void *CbData, int Status);
+
 /* Type Definition of XPlmi_WaitForDmaDone */
 typedef int (*XPlmi_WaitForDmaDone_t)(XPmcDma *DmaPtr, XPmcDma_Channel Channel);
 
@@ -117,6 +121,9 @@ void XPlmi_SetMaxOutCmds(u8 Val);
 int XPlmi_MemSet(u64 DestAddr, u32 Val, u32 Len);
 int XPlmi_MemSetBytes(void *const DestPtr, u32 DestLen, u8 Val, u32 Len);
 int XPlmi_MemCpy64(u64 DestAddr, u64 SrcAddr, u32 Len);
+int XPlmi_DmaXfrQueue(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags,
+	XPlmi_DmaDoneCb_t DoneCb, void *CbData);
+int XPlmi_DmaQueueFlush(u32 DmaFlags);
 
 /**
  * @}
@@ -51,6 +51,8 @@
 * 1.07  ng   03/12/2023 Fixed Coverity warnings
 * 1.07  ng   03/30/2023 Updated algorithm and return values in doxygen comments
 *       dd   09/12/2023 MISRA-C violation Rule 10.8 fixed
+*       fl   10/14/2026 Commit trace records with the header write and
+*                       added raw timer time stamp option
 *
 * </pre>
 *
@@ -346,8 +348,21 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
 void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len)
 {
 	u32 Index;
-	XPlmi_PerfTime PerfTime;
+	u32 Offset;
+	u32 HeaderOffset = 0U;
 	XPlmi_CircularBuffer *TraceLog = XPlmi_GetTraceLogInst();
+#ifdef PLM_TRACE_LOG_RAW_TIMESTAMP
+	u64 TimeStamp;
+
+	/* Timer counts elapsed since PLM start, converted on the host */
+	TimeStamp = ((XPLMI_PIT1_CYCLE_VALUE << 32U) | XPLMI_PIT2_CYCLE_VALUE) -
+		XPlmi_GetTimerValue();
+	TraceData[0U] = TraceData[0U] | (Len << XPLMI_TRACE_LOG_LEN_SHIFT) |
+		XPLMI_TRACE_LOG_RAW_TS_MASK;
+	TraceData[1U] = (u32)(TimeStamp >> 32U);
+	TraceData[2U] = (u32)TimeStamp;
+#else
+	XPlmi_PerfTime PerfTime;
 
 	/* Get time stamp of PLM */
 	XPlmi_MeasurePerfTime((XPLMI_PIT1_CYCLE_VALUE << 32U) |
@@ -356,16 +371,28 @@ void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len)
 	TraceData[0U] = TraceData[0U] | (Len << XPLMI_TRACE_LOG_LEN_SHIFT);
 	TraceData[1U] = (u32)PerfTime.TPerfMs;
 	TraceData[2U] = (u32)PerfTime.TPerfMsFrac;
+#endif
 
+	/*
+	 * Write the header last, so the record is committed by a single word
+	 * write and a reader never finds the header of a partial record
+	 */
+	Offset = TraceLog->Offset;
 	for (Index = 0U; Index < Len; Index++) {
-		if (TraceLog->Offset >= TraceLog->Len) {
-			TraceLog->Offset = 0x0U;
+		if (Offset >= TraceLog->Len) {
+			Offset = 0x0U;
 			TraceLog->IsBufferFull = (u32)TRUE;
 		}
 
-		XPlmi_Out64((TraceLog->StartAddr + TraceLog->Offset), TraceData[Index]);
-		TraceLog->Offset += XPLMI_WORD_LEN;
+		if (Index == 0U) {
+			HeaderOffset = Offset;
+		} else {
+			XPlmi_Out64((TraceLog->StartAddr + Offset), TraceData[Index]);
+		}
+		Offset += XPLMI_WORD_LEN;
 	}
+	XPlmi_Out64((TraceLog->StartAddr + HeaderOffset), TraceData[0U]);
+	TraceLog->Offset = Offset;
 }
 
 /*****************************************************************************/
@@ -29,6 +29,8 @@
 *       bsv  07/19/2021 Disable UART prints when invalid header is encountered
 *                       in slave boot modes
 *       bm   08/12/2021 Added support to configure uart during run-time
+*       fl   10/14/2026 Added partition profile trace event
+*       fl   10/14/2026 Added raw time stamp flag and timer frequency event
 *
 *
 * </pre>
@@ -90,16 +92,43 @@ void XPlmi_InitDebugLogBuffer(void);
 
 /* Trace log buffer length shift */
 #define XPLMI_TRACE_LOG_LEN_SHIFT		(16U)
+/* Set in the header when the time stamp is in timer counts */
+#define XPLMI_TRACE_LOG_RAW_TS_MASK		(0x80000000U)
 
 /* Trace event IDs */
 #define XPLMI_TRACE_LOG_LOAD_IMAGE		(0x1U)
+#define XPLMI_TRACE_LOG_PRTN_PROFILE	(0x2U)
+#define XPLMI_TRACE_LOG_TIMER_FREQ	(0x3U)
+
+/*
+ * Partition profile trace event payload, logged by XilLoader after each
+ * partition is loaded. Times are in microseconds, throughput in bytes per
+ * millisecond.
+ * 		3U - Image ID
+ * 		4U - Partition ID
+ * 		5U - Partition size in bytes
+ * 		6U - Total load time
+ * 		7U - Time waiting for the boot device
+ * 		8U - Authentication, decryption and checksum time
+ * 		9U - CDO execution time
+ * 		10U - Throughput
+ */
+
+/*
+ * Timer frequency trace event payload, logged at PLM start when
+ * PLM_TRACE_LOG_RAW_TIMESTAMP is enabled.
+ * 		3U - Timer frequency in Hz
+ */
 
 /*
  * Trace log functions
  * TraceBuffer structure
- * 		0U - Header
- * 		1U - Time stamp in ms
- * 		2U - Time stamp fraction
+ * 		0U - Header, event ID in bits 15:0, record length in words in
+ * 		     bits 30:16 and XPLMI_TRACE_LOG_RAW_TS_MASK
+ * 		1U - Time stamp in ms, or timer counts high word with
+ * 		     XPLMI_TRACE_LOG_RAW_TS_MASK
+ * 		2U - Time stamp fraction, or timer counts low word with
+ * 		     XPLMI_TRACE_LOG_RAW_TS_MASK
  * 		3U - Payload
  * 		...
  */
@@ -102,6 +102,8 @@
 *       bm   07/06/2023 Added list commands
 *       sk   08/30/2023 Added Address range check for PSM Buff List
 *       dd   09/12/2023 MISRA-C violation Rule 14.4 fixed
+*       fl   10/14/2026 Added IPI batch command
+*       fl   10/14/2026 Stream keyhole writes to slave SLRs when enabled
 *
 * </pre>
 *
@@ -130,6 +132,7 @@
 #endif
 #include "xplmi_plat.h"
 #include "xplmi_tamper.h"
+#include "xplmi_ipi.h"
 
 /**@cond xplmi_internal
  * @{
@@ -202,6 +205,7 @@ static int XPlmi_KeyHoleXfr(XPlmi_KeyHoleXfrParams* KeyHoleXfrParams);
 static int XPlmi_StackPush(XPlmi_CdoParamsStack *CdoParamsStack, u32 *Data);
 static int XPlmi_StackPop(XPlmi_CdoParamsStack *CdoParamsStack, u32 PopLevel, u32 *Data);
 static int XPlmi_TamperTrigger(XPlmi_Cmd *Cmd);
+static int XPlmi_IpiBatch(XPlmi_Cmd *Cmd);
 
 /************************** Variable Definitions *****************************/
 
@@ -1283,6 +1287,7 @@ static int XPlmi_DmaWriteKeyHole(XPlmi_Cmd *Cmd)
 	u64 BaseAddr;
 	u32 DestOffset;
 	XPlmi_KeyHoleXfrParams KeyHoleXfrParams;
+	u8 IsSlrStream = (u8)FALSE;
 #ifdef PLM_PRINT_PERF_KEYHOLE
 	u64 KeyHoleTime = XPlmi_GetTimerValue();
 	XPlmi_PerfTime PerfTime = {0U};
@@ -1312,7 +1317,23 @@ static int XPlmi_DmaWriteKeyHole(XPlmi_Cmd *Cmd)
 	DestAddr = (u64)Cmd->ResumeData[1U] | (DestAddr << 32U);
 	BaseAddr = DestAddr;
 
-	if (Cmd->KeyHoleParams.Func != NULL) {
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+	if (Cmd->KeyHoleParams.IsSlrStreamEn == (u8)TRUE) {
+		/*
+		 * Slave SLR writes are streamed from PMCRAM, the other keyhole
+		 * writes need the PMC DMAs free
+		 */
+		IsSlrStream = XPlmi_SsitIsSlaveSlrAddr(BaseAddr);
+		if (IsSlrStream == (u8)FALSE) {
+			Status = XPlmi_SsitStreamFlush();
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+	}
+#endif
+
+	if ((Cmd->KeyHoleParams.Func != NULL) && (IsSlrStream == (u8)FALSE)) {
 		/* This is for direct DMA to CFI from PdiSrc bypassing PMCRAM */
 		Status = XPlmi_CfiWrite(SrcAddr, DestAddr, Keyholesize, Len, Cmd);
 		goto END;
@@ -1327,6 +1348,11 @@ static int XPlmi_DmaWriteKeyHole(XPlmi_Cmd *Cmd)
 	KeyHoleXfrParams.Keyholesize = Keyholesize;
 	KeyHoleXfrParams.Flags = XPLMI_PMCDMA_0;
 	KeyHoleXfrParams.Func = NULL;
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+	if (IsSlrStream == (u8)TRUE) {
+		KeyHoleXfrParams.Func = XPlmi_SsitStreamXfr;
+	}
+#endif
 	Status = XPlmi_KeyHoleXfr(&KeyHoleXfrParams);
 	if (Status != XST_SUCCESS) {
 		XPlmi_Printf(DEBUG_GENERAL, "DMA WRITE Key Hole Failed\n\r");
@@ -2342,6 +2368,41 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function executes several IPI commands placed by the client
+ *          in a request buffer and writes their responses to a completion
+ *          buffer, with a single IPI round trip.
+ *
+ * @param	Cmd is pointer to the command structure
+ *              Command payload parameters are
+ *              - Request buffer address high
+ *              - Request buffer address low
+ *              - Request buffer length in words
+ *              - Number of commands
+ *              - Completion buffer address high
+ *              - Completion buffer address low
+ *
+ * @return
+ * 			- XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XPlmi_IpiBatch(XPlmi_Cmd *Cmd)
+{
+	int Status = XST_FAILURE;
+	XPLMI_EXPORT_CMD(XPLMI_IPI_BATCH_CMD_ID, XPLMI_MODULE_GENERIC_ID,
+		XPLMI_CMD_ARG_CNT_SIX, XPLMI_CMD_ARG_CNT_SIX);
+
+#ifdef XPLMI_IPI_DEVICE_ID
+	Status = XPlmi_IpiBatchExecute(Cmd);
+#else
+	(void)Cmd;
+	Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_CMD, 0);
+#endif
+
+	return Status;
+}
+
 /**
  * @{
  * @cond xplmi_internal
@@ -2405,6 +2466,7 @@ void XPlmi_GenericInit(void)
 		XPLMI_MODULE_COMMAND(XPlmi_ListWrite),
 		XPLMI_MODULE_COMMAND(XPlmi_ListMaskWrite),
 		XPLMI_MODULE_COMMAND(XPlmi_ListMaskPoll),
+		XPLMI_MODULE_COMMAND(XPlmi_IpiBatch),
 	};
 
 	/* Buffer to store access permissions of xilplmi generic module */
@@ -2456,6 +2518,7 @@ void XPlmi_GenericInit(void)
 		XPLMI_ALL_IPI_NO_ACCESS(XPLMI_LIST_WRITE_CMD_ID),
 		XPLMI_ALL_IPI_NO_ACCESS(XPLMI_LIST_MASK_WRITE_CMD_ID),
 		XPLMI_ALL_IPI_NO_ACCESS(XPLMI_LIST_MASK_POLL_CMD_ID),
+		XPLMI_ALL_IPI_FULL_ACCESS(XPLMI_IPI_BATCH_CMD_ID),
 	};
 
 	/* This is to store CMD_END in xplm_modules section */
@@ -76,6 +76,9 @@
  *                       CheckIpiAccess
  *       ng   03/30/2023 Updated algorithm and return values in doxygen comments
  * 1.08  bm   06/23/2023 Added IPI access permissions validation
+ * 1.09  fl   10/14/2026 Defer non XilPm IPI commands at task preemption
+ *                       points
+ *       fl   10/14/2026 Added batch IPI command execution
  *
  * </pre>
  *
@@ -98,6 +101,14 @@
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XPLMI_IPI_XSDB_MASTER_MASK	IPI_PMC_ISR_IPI5_BIT_MASK
+
+/* Batch IPI command payload indices */
+#define XPLMI_IPI_BATCH_REQ_ADDR_HIGH_INDEX	(0U)
+#define XPLMI_IPI_BATCH_REQ_ADDR_LOW_INDEX	(1U)
+#define XPLMI_IPI_BATCH_REQ_LEN_INDEX		(2U)
+#define XPLMI_IPI_BATCH_CMD_CNT_INDEX		(3U)
+#define XPLMI_IPI_BATCH_RESP_ADDR_HIGH_INDEX	(4U)
+#define XPLMI_IPI_BATCH_RESP_ADDR_LOW_INDEX	(5U)
 #define XPLMI_PMC_IMAGE_ID		(0x1C000001U)
 #define XPLMI_IPI_PMC_IMR_MASK		(0xFCU)
 #define XPLMI_IPI_PMC_IMR_SHIFT		(0x2U)
@@ -316,6 +327,20 @@ static int XPlmi_IpiDispatchHandler(void *Data)
 		 * Get IPI request type
 		 */
 		Cmd.CmdId = Payload[0U];
+
+		/**
+		 * At a preemption point only XilPm commands are executed, the
+		 * message of other commands is read again once the preempted
+		 * task completes
+		 */
+		if ((XPlmi_TaskIsPreempting() == (u8)TRUE) &&
+			(((Cmd.CmdId & XPLMI_CMD_MODULE_ID_MASK) >>
+			XPLMI_CMD_MODULE_ID_SHIFT) != XPLMI_MODULE_XILPM_ID)) {
+			XPlmi_TaskDefer();
+			Cmd.AckInPLM = (u8)FALSE;
+			goto END;
+		}
+
 		Cmd.IpiReqType = XPlmi_GetIpiReqType(Cmd.CmdId,
 				IpiInst.Config.TargetList[MaskIndex].BufferIndex);
 
@@ -720,4 +745,153 @@ static int XPlmi_IpiCmdExecute(XPlmi_Cmd * CmdPtr, u32 * Payload)
 END:
       return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function executes the commands of a batch IPI request. The
+ * 			request buffer holds the commands back to back, each one as a
+ * 			header word in IPI format followed by its payload of up to
+ * 			XPLMI_IPI_MAX_MSG_LEN - 1 words. Every command is validated
+ * 			against the IPI access permissions of the requesting channel.
+ * 			The response of each command, XPLMI_CMD_RESP_SIZE words with
+ * 			the status first, is written to the completion buffer. The
+ * 			batch stops at the first command with an error, or at a
+ * 			command that acknowledges the IPI from its own handler.
+ *
+ * @param	Cmd is pointer to the batch command, the payload parameters are
+ * 			- Request buffer address high
+ * 			- Request buffer address low
+ * 			- Request buffer length in words
+ * 			- Number of commands
+ * 			- Completion buffer address high
+ * 			- Completion buffer address low
+ *
+ * @return
+ * 			- XST_SUCCESS if all the commands succeeded. Response[1] holds
+ * 			the number of commands executed.
+ * 			- XPLMI_ERR_IPI_CMD if not received through an IPI channel or a
+ * 			batch command is nested.
+ * 			- XPLMI_ERR_INVALID_PAYLOAD_LEN on invalid length or count.
+ * 			- XPLMI_ERROR_INVALID_ADDRESS on invalid buffer address.
+ * 			- Error code of the first failed command otherwise.
+ *
+ *****************************************************************************/
+int XPlmi_IpiBatchExecute(XPlmi_Cmd *Cmd)
+{
+	volatile int Status = XST_FAILURE;
+	volatile int StatusTmp = XST_FAILURE;
+	u32 Payload[XPLMI_IPI_MAX_MSG_LEN];
+	XPlmi_Cmd BatchCmd;
+	u64 ReqAddr;
+	u64 ReqEndAddr;
+	u64 RespAddr;
+	u32 CmdCnt = Cmd->Payload[XPLMI_IPI_BATCH_CMD_CNT_INDEX];
+	u32 SrcIndex = IPI_NO_BUF_CHANNEL_INDEX;
+	u32 Index;
+	u32 Len;
+	u32 Offset;
+	u32 ExecCnt = 0U;
+
+	/** - Get the source channel for the access permission checks */
+	for (Index = 0U; Index < XPLMI_IPI_MASK_COUNT; Index++) {
+		if (IpiInst.Config.TargetList[Index].Mask == Cmd->IpiMask) {
+			SrcIndex = IpiInst.Config.TargetList[Index].BufferIndex;
+			break;
+		}
+	}
+	if ((Cmd->IpiMask == 0U) || (SrcIndex == IPI_NO_BUF_CHANNEL_INDEX)) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_CMD, 0);
+		goto END;
+	}
+
+	if ((CmdCnt == 0U) ||
+		(Cmd->Payload[XPLMI_IPI_BATCH_REQ_LEN_INDEX] < CmdCnt)) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_INVALID_PAYLOAD_LEN, 0);
+		goto END;
+	}
+
+	/** - Validate the request and completion buffers */
+	ReqAddr = ((u64)Cmd->Payload[XPLMI_IPI_BATCH_REQ_ADDR_HIGH_INDEX] << 32U) |
+		(u64)Cmd->Payload[XPLMI_IPI_BATCH_REQ_ADDR_LOW_INDEX];
+	ReqEndAddr = ReqAddr + ((u64)Cmd->Payload[XPLMI_IPI_BATCH_REQ_LEN_INDEX] *
+		XPLMI_WORD_LEN);
+	Status = XPlmi_VerifyAddrRange(ReqAddr, ReqEndAddr - 1U);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	RespAddr = ((u64)Cmd->Payload[XPLMI_IPI_BATCH_RESP_ADDR_HIGH_INDEX] << 32U) |
+		(u64)Cmd->Payload[XPLMI_IPI_BATCH_RESP_ADDR_LOW_INDEX];
+	Status = XPlmi_VerifyAddrRange(RespAddr, RespAddr +
+		((u64)CmdCnt * XPLMI_CMD_RESP_SIZE * XPLMI_WORD_LEN) - 1U);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < CmdCnt; Index++) {
+		Status = XST_FAILURE;
+		/** - Read the command header and payload */
+		Payload[0U] = XPlmi_In64(ReqAddr);
+		Len = (Payload[0U] >> 16U) & 255U;
+		if ((Len >= XPLMI_IPI_MAX_MSG_LEN) ||
+			((ReqAddr + (((u64)Len + 1U) * XPLMI_WORD_LEN)) > ReqEndAddr)) {
+			Status = XPlmi_UpdateStatus(XPLMI_ERR_INVALID_PAYLOAD_LEN, 0);
+			break;
+		}
+		for (Offset = 1U; Offset <= Len; Offset++) {
+			Payload[Offset] = XPlmi_In64(ReqAddr +
+				((u64)Offset * XPLMI_WORD_LEN));
+		}
+		ReqAddr += ((u64)Len + 1U) * XPLMI_WORD_LEN;
+
+		(void)XPlmi_MemSetBytes(&BatchCmd, sizeof(BatchCmd), 0U,
+			sizeof(BatchCmd));
+		BatchCmd.CmdId = Payload[0U];
+		BatchCmd.Len = Len;
+		BatchCmd.Payload = &Payload[1U];
+		BatchCmd.IpiMask = Cmd->IpiMask;
+		BatchCmd.SubsystemId = Cmd->SubsystemId;
+		BatchCmd.AckInPLM = (u8)TRUE;
+		BatchCmd.IpiReqType = XPlmi_GetIpiReqType(BatchCmd.CmdId,
+				SrcIndex);
+
+		/** - Batch commands are not nested */
+		if ((BatchCmd.CmdId & (XPLMI_CMD_MODULE_ID_MASK |
+			XPLMI_PLM_GENERIC_CMD_ID_MASK)) == ((XPLMI_MODULE_GENERIC_ID <<
+			XPLMI_CMD_MODULE_ID_SHIFT) | XPLMI_IPI_BATCH_CMD_ID)) {
+			Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_CMD, 0);
+		} else {
+			XSECURE_REDUNDANT_CALL(Status, StatusTmp, XPlmi_ValidateIpiCmd,
+				&BatchCmd, SrcIndex);
+			if ((Status != XST_SUCCESS) || (StatusTmp != XST_SUCCESS)) {
+				Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_CMD,
+					Status | StatusTmp);
+			} else {
+				Status = XPlmi_IpiCmdExecute(&BatchCmd, Payload);
+			}
+		}
+
+		/** - Write the response to the completion buffer */
+		BatchCmd.Response[0U] = (u32)Status &
+			(~(u32)XPLMI_WARNING_STATUS_MASK);
+		for (Offset = 0U; Offset < XPLMI_CMD_RESP_SIZE; Offset++) {
+			XPlmi_Out64(RespAddr + ((u64)Offset * XPLMI_WORD_LEN),
+				BatchCmd.Response[Offset]);
+		}
+		RespAddr += (u64)XPLMI_CMD_RESP_SIZE * XPLMI_WORD_LEN;
+		++ExecCnt;
+
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		/** - Leave the IPI ack to the handler that took it over */
+		if (BatchCmd.AckInPLM == (u8)FALSE) {
+			Cmd->AckInPLM = (u8)FALSE;
+			break;
+		}
+	}
+	Cmd->Response[1U] = ExecCnt;
+
+END:
+	return Status;
+}
 #endif /* XPLMI_IPI_DEVICE_ID */
@@ -41,6 +41,7 @@
 *       bm   07/06/2023 Added command id for run_proc command
 *       bm   07/06/2023 Added list command ids
 *       bm   07/24/2023 Type cast IPI Access macros properly
+*       fl   10/14/2026 Added IPI batch command ID
 *
 * </pre>
 *
@@ -199,6 +200,7 @@ typedef struct {
 #define XPLMI_LIST_WRITE_CMD_ID		(40U)
 #define XPLMI_LIST_MASK_WRITE_CMD_ID	(41U)
 #define XPLMI_LIST_MASK_POLL_CMD_ID	(42U)
+#define XPLMI_IPI_BATCH_CMD_ID		(43U)
 #define XPLMI_CDO_END_CMD_ID		(0xFFU)
 
 /************************** Function Prototypes ******************************/
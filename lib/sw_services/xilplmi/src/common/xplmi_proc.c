@@ -52,6 +52,9 @@
 * 1.10  bm   04/28/2023 Use XPlmi_GetRomIroFreq API to get IRO frequency used
 *                       during ROM
 *       ng   06/21/2023 Added support for system device-tree flow
+* 1.11  fl   10/14/2026 Added XPlmi_SetSchedTimer to program PIT3 for the
+*                       next scheduler deadline
+*       fl   10/14/2026 Log the timer frequency for raw trace time stamps
 *
 * </pre>
 *
@@ -320,6 +323,9 @@ int XPlmi_StartTimer(void)
 		Status = XPlmi_UpdateStatus(XPLMI_ERR_SET_PMC_IRO_FREQ, Status);
 		goto END;
 	}
+#ifdef PLM_TRACE_LOG_RAW_TIMESTAMP
+	XPlmi_TraceLog3(XPLMI_TRACE_LOG_TIMER_FREQ, PmcIroFreq);
+#endif
 
 	/*
 	 * PLM scheduler is running too fast for QEMU, so increasing the
@@ -331,8 +337,6 @@ int XPlmi_StartTimer(void)
 		Pit3ResetValue = PmcIroFreq / XPLMI_PIT_FREQ_DIVISOR;
 	}
 
-	XPlmi_SchedulerInit();
-
 	/**
 	 * - Initialize and start the timer
 	 *   - Use PIT1 and PIT2 in prescaler mode
@@ -344,10 +348,33 @@ int XPlmi_StartTimer(void)
 	XPlmi_InitPitTimer((u8)XPLMI_PIT1, Pit1ResetValue);
 	XPlmi_InitPitTimer((u8)XPLMI_PIT3, Pit3ResetValue);
 
+	/**
+	 * - Initialize the scheduler with PIT3 period as the scheduler tick
+	 */
+	XPlmi_SchedulerInit(Pit3ResetValue);
+
 END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* @brief	It restarts PIT3, the scheduler timer, to expire after the given
+* 			number of timer counts.
+*
+* @param	Count is the number of timer counts after which PIT3 expires
+*
+* @return
+* 			- None
+*
+*****************************************************************************/
+void XPlmi_SetSchedTimer(u32 Count)
+{
+	XIOModule_Timer_Stop(&IOModule, (u8)XPLMI_PIT3);
+	XIOModule_SetResetValue(&IOModule, (u8)XPLMI_PIT3, Count);
+	XIOModule_Timer_Start(&IOModule, (u8)XPLMI_PIT3);
+}
+
 /******************************************************************************/
 /**
 *
@@ -39,6 +39,7 @@
 * 1.07  bm   01/03/2023 Remove usage of double data type
 * 1.08  bm   04/28/2023 Update Trim related macros
 * 1.09  ng   07/06/2023 Added support for SDT flow
+* 1.10  fl   10/14/2026 Added XPlmi_SetSchedTimer prototype
 *
 * </pre>
 *
@@ -106,6 +107,7 @@ typedef struct {
 /************************** Function Prototypes ******************************/
 int XPlmi_StartTimer(void);
 u64 XPlmi_GetTimerValue(void);
+void XPlmi_SetSchedTimer(u32 Count);
 int XPlmi_SetUpInterruptSystem(void);
 void XPlmi_MeasurePerfTime(u64 TCur, XPlmi_PerfTime *PerfTime);
 void XPlmi_PlmIntrEnable(u32 IntrId);
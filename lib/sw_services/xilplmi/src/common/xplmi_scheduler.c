@@ -48,6 +48,9 @@
 *       ng   03/30/2023 Updated algorithm and return values in doxygen comments
 * 1.08  nb   06/28/2023 Move XPLMI_SCHED_TICK to header
 *       dd   09/12/2023 MISRA-C violation Rule 13.4 fixed
+* 1.09  fl   10/14/2026 Program PIT3 for the next task deadline instead of
+*                       scanning the tasks on every tick, and added
+*                       XPlmi_SchedulerAddTaskUs for sub-millisecond periods
 *
 * </pre>
 *
@@ -58,6 +61,7 @@
 /***************************** Include Files *********************************/
 #include "xplmi_scheduler.h"
 #include "xplmi_debug.h"
+#include "xplmi_proc.h"
 #include "xplmi_wdt.h"
 
 /**@cond xplmi_internal
@@ -78,6 +82,7 @@
 /************************** Function Prototypes ******************************/
 static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
 	u32 TaskListIndex);
+static void XPlmi_SchedArmTimer(void);
 
 /************************** Variable Definitions *****************************/
 static XPlmi_Scheduler_t Sched;
@@ -91,11 +96,13 @@ static XPlmi_Scheduler_t Sched;
 *
 * @param   	SchedPtr is Scheduler pointer
 * @param   	TaskListIndex is Task index
+* @param   	Now is the current timer value
 *
 * @return	TRUE or FALSE based on the task active status
 *
 ****************************************************************************/
-static u8 XPlmi_IsTaskActive(XPlmi_Scheduler_t *SchedPtr, u32 TaskListIndex)
+static u8 XPlmi_IsTaskActive(const XPlmi_Scheduler_t *SchedPtr,
+	u32 TaskListIndex, u64 Now)
 {
 	u8 ReturnVal = (u8)FALSE;
 
@@ -103,18 +110,9 @@ static u8 XPlmi_IsTaskActive(XPlmi_Scheduler_t *SchedPtr, u32 TaskListIndex)
 		goto END;
 	}
 
-	if (XPlmi_IsTaskNonPeriodic(SchedPtr, TaskListIndex) == (u8)TRUE) {
-		if (SchedPtr->TaskList[TaskListIndex].TriggerTime <=
-			SchedPtr->Tick) {
-			ReturnVal = (u8)TRUE;
-		}
-	} else {
-		if ((0U != SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (0U == (SchedPtr->Tick
-		% SchedPtr->TaskList[TaskListIndex].Interval))) {
-			/* Periodic */
-			ReturnVal = (u8)TRUE;
-		}
+	/* Timer counts down, so the task is due once it reaches TriggerTime */
+	if (SchedPtr->TaskList[TaskListIndex].TriggerTime >= Now) {
+		ReturnVal = (u8)TRUE;
 	}
 
 END:
@@ -144,16 +142,55 @@ static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
 	return ReturnVal;
 }
 
+/******************************************************************************/
+/**
+* @brief	The function programs PIT3 to expire at the earliest of the next
+* 			scheduler tick and the deadlines of the registered tasks.
+* 			It must be called with interrupts disabled.
+*
+* @return
+* 			- None
+*
+****************************************************************************/
+static void XPlmi_SchedArmTimer(void)
+{
+	u8 Idx;
+	u64 Next = Sched.TickDeadline;
+	u64 Now;
+	u64 Count = 0U;
+
+	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
+		if ((Sched.TaskList[Idx].CustomerFunc != NULL) &&
+			(Sched.TaskList[Idx].TriggerTime > Next)) {
+			Next = Sched.TaskList[Idx].TriggerTime;
+		}
+	}
+	Sched.NextDeadline = Next;
+
+	Now = XPlmi_GetTimerValue();
+	if (Now > Next) {
+		Count = Now - Next;
+	}
+	/* Deadline already passed, expire as soon as possible */
+	if (Count < (u64)Sched.CountsPerUs) {
+		Count = Sched.CountsPerUs;
+	}
+	XPlmi_SetSchedTimer((u32)Count);
+}
+
 /******************************************************************************/
 /**
 * @brief	The function initializes scheduler and returns the
 * 			initialization status.
 *
+* @param	TickPeriod is the period of the scheduler tick in timer counts.
+* 			PIT3 is already started with this period.
+*
 * @return
 * 			- None
 *
 ****************************************************************************/
-void XPlmi_SchedulerInit(void)
+void XPlmi_SchedulerInit(u32 TickPeriod)
 {
 	u8 Idx;
 
@@ -163,15 +200,19 @@ void XPlmi_SchedulerInit(void)
 		Sched.TaskList[Idx].CustomerFunc = NULL;
 	}
 
-	Sched.LastTimerTick = XPlmi_GetTimerValue();
+	Sched.TickPeriod = TickPeriod;
+	Sched.CountsPerUs = *XPlmi_GetPmcIroFreq() / XPLMI_MEGA;
+	Sched.TickDeadline = XPlmi_GetTimerValue() - (u64)TickPeriod;
+	Sched.NextDeadline = Sched.TickDeadline;
 	Sched.Tick = 0U;
 }
 
 /******************************************************************************/
 /**
-* @brief	The function is scheduler handler and it is called at regular
-* 			intervals based on configured interval. Scheduler handler checks
-* 			and adds the user periodic task to PLM task queue.
+* @brief	The function is scheduler handler and it is called when PIT3
+* 			expires. Scheduler handler adds the tasks whose deadline has
+* 			elapsed to PLM task queue, services the WDT on every scheduler
+* 			tick and programs PIT3 for the next deadline.
 *
 * @param	Data - Not used currently. Added as a part of generic interrupt
 * 			handler
@@ -185,15 +226,28 @@ void XPlmi_SchedulerHandler(void *Data)
 	u8 Idx;
 	(void)Data;
 	XPlmi_TaskNode *Task = NULL;
+	u64 Now = XPlmi_GetTimerValue();
+	u64 Period;
+	u8 TickElapsed = (u8)FALSE;
 
-	Sched.LastTimerTick = XPlmi_GetTimerValue();
-	Sched.Tick++;
 	XPlmi_UtilRMW(PMC_PMC_MB_IO_IRQ_ACK, PMC_PMC_MB_IO_IRQ_ACK, 0x20U);
+	/**
+	 * - Move to the next scheduler tick if it elapsed, skipping the missed
+	 *   ticks as the fixed tick did
+	 */
+	if (Sched.TickDeadline >= Now) {
+		Sched.Tick++;
+		TickElapsed = (u8)TRUE;
+		do {
+			Sched.TickDeadline -= (u64)Sched.TickPeriod;
+		} while (Sched.TickDeadline >= Now);
+	}
+
 	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
 		/**
 		 * - Check if the task is active and has a valid Callback
 		 */
-		if (XPlmi_IsTaskActive(&Sched, Idx) == (u8)TRUE) {
+		if (XPlmi_IsTaskActive(&Sched, Idx, Now) == (u8)TRUE) {
 			Task = Sched.TaskList[Idx].Task;
 			/**
 			 * - Skip the task, if its already present in the queue
@@ -221,16 +275,26 @@ void XPlmi_SchedulerHandler(void *Data)
 				}
 			}
 			/**
-			 * - Remove the task from scheduler if it is non-periodic
+			 * - Remove the task from scheduler if it is non-periodic,
+			 *   else move it to its next period
 			 */
-			if (Sched.TaskList[Idx].Type == XPLMI_NON_PERIODIC_TASK) {
+			if (XPlmi_IsTaskNonPeriodic(&Sched, Idx) == (u8)TRUE) {
 				Sched.TaskList[Idx].OwnerId = 0U;
 				Sched.TaskList[Idx].CustomerFunc = NULL;
 				Sched.TaskList[Idx].ErrorFunc = NULL;
+			} else {
+				Period = (u64)Sched.TaskList[Idx].Interval *
+					(u64)Sched.CountsPerUs;
+				do {
+					Sched.TaskList[Idx].TriggerTime -= Period;
+				} while (Sched.TaskList[Idx].TriggerTime >= Now);
 			}
 		}
 	}
-	XPlmi_WdtHandler();
+	if (TickElapsed == (u8)TRUE) {
+		XPlmi_WdtHandler();
+	}
+	XPlmi_SchedArmTimer();
 
 	return;
 }
@@ -246,7 +310,7 @@ void XPlmi_SchedulerHandler(void *Data)
 * 			on scheduled interval
 * @param	MilliSeconds For Periodic tasks, it's the Periodicity of the task.
 *			For Non-Periodic tasks, it's the delay after which task has to
-*			be scheduled. Value should be in multiples of 10ms
+*			be scheduled.
 * @param	Priority is the priority of the task
 * @param	Data is the pointer to the private data of the task
 * @param	TaskType is the type of Task (periodic or non-periodic)
@@ -264,9 +328,52 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 		TaskPriority_t Priority, void *Data, u8 TaskType)
 {
 	int Status = XST_FAILURE;
-	XPlmi_PerfTime ExtraTime;
+
+	if (MilliSeconds > XPLMI_SCHED_MAX_PERIOD_MS) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_INVALID_TASK_PERIOD, 0);
+		goto END;
+	}
+
+	Status = XPlmi_SchedulerAddTaskUs(OwnerId, CallbackFn, ErrorFunc,
+		MilliSeconds * XPLMI_KILO, Priority, Data, TaskType);
+
+END:
+	return Status;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function adds user task to scheduler queue with the period or
+* 			delay in microseconds. Periodic tasks are scheduled on their own
+* 			deadline, independent of the scheduler tick.
+*
+* @param	OwnerId Id of the owner, used while removing the task.
+* @param	CallbackFn callback function that should be called
+* @param	ErrorFunc error function to be called when task does not execute
+* 			on scheduled interval
+* @param	MicroSeconds For Periodic tasks, it's the Periodicity of the task
+*			and should be at least XPLMI_SCHED_MIN_PERIOD_US.
+*			For Non-Periodic tasks, it's the delay after which task has to
+*			be scheduled.
+* @param	Priority is the priority of the task
+* @param	Data is the pointer to the private data of the task
+* @param	TaskType is the type of Task (periodic or non-periodic)
+*
+* @return
+* 			- XST_SUCCESS if scheduler task is registered properly.
+* 			- XPLMI_ERR_INVALID_TASK_TYPE on invalid task type.
+* 			- XPLMI_ERR_INVALID_TASK_PERIOD on invalid task period.
+* 			- XPLMI_ERR_TASK_EXISTS if task is already present.
+* 			- XPLM_ERR_TASK_CREATE if failed to create the task.
+*
+****************************************************************************/
+int XPlmi_SchedulerAddTaskUs(u32 OwnerId, XPlmi_Callback_t CallbackFn,
+		XPlmi_ErrorFunc_t ErrorFunc, u32 MicroSeconds,
+		TaskPriority_t Priority, void *Data, u8 TaskType)
+{
+	int Status = XST_FAILURE;
 	u8 Idx;
-	u32 TriggerTime = 0U;
+	u64 TriggerTime;
 	XPlmi_TaskNode *Task = NULL;
 	u8 TaskNodePresent = (u8)FALSE;
 
@@ -276,11 +383,12 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 		goto END;
 	}
 
-	if ((TaskType == XPLMI_PERIODIC_TASK) && (MilliSeconds == 0U)) {
+	if ((TaskType == XPLMI_PERIODIC_TASK) &&
+		(MicroSeconds < XPLMI_SCHED_MIN_PERIOD_US)) {
 		Status = XPlmi_UpdateStatus(XPLMI_ERR_INVALID_TASK_PERIOD, 0);
 		goto END;
 	}
-    Task = XPlmi_GetTaskInstance(CallbackFn, Data, XPLMI_INVALID_INTR_ID);
+	Task = XPlmi_GetTaskInstance(CallbackFn, Data, XPLMI_INVALID_INTR_ID);
 	if (Task != NULL) {
 		if (metal_list_is_empty(&Task->TaskNode) == (int)FALSE) {
 			Status = XPlmi_UpdateStatus(XPLMI_ERR_TASK_EXISTS, 0);
@@ -296,12 +404,8 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	 */
 	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
 		if (NULL == Sched.TaskList[Idx].CustomerFunc) {
-			/**
-			 * - Add Interval as a factor of TICK_MILLISECONDS
-			 */
-			Sched.TaskList[Idx].Interval = MilliSeconds / XPLMI_SCHED_TICK;
+			Sched.TaskList[Idx].Interval = MicroSeconds;
 			Sched.TaskList[Idx].OwnerId = OwnerId;
-			Sched.TaskList[Idx].CustomerFunc = CallbackFn;
 			Sched.TaskList[Idx].ErrorFunc = ErrorFunc;
 			Sched.TaskList[Idx].Type = TaskType;
 			Sched.TaskList[Idx].Data = Data;
@@ -320,18 +424,19 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 			}
 			Task->IntrId = XPLMI_INVALID_INTR_ID;
 			Sched.TaskList[Idx].Task = Task;
-			if (TaskType != XPLMI_PERIODIC_TASK) {
-				microblaze_disable_interrupts();
-				XPlmi_MeasurePerfTime(Sched.LastTimerTick, &ExtraTime);
-				if (Sched.Tick == 0U) {
-					ExtraTime.TPerfMs %= XPLMI_SCHED_TICK;
-				}
-				TriggerTime = Sched.Tick +
-					   (((u32)ExtraTime.TPerfMs + MilliSeconds) /
-					   XPLMI_SCHED_TICK);
-				microblaze_enable_interrupts();
-			}
+			/**
+			 * - Set the deadline and enable the task, reprogram PIT3
+			 *   if the task is due before its current expiry
+			 */
+			microblaze_disable_interrupts();
+			TriggerTime = XPlmi_GetTimerValue() -
+				((u64)MicroSeconds * (u64)Sched.CountsPerUs);
 			Sched.TaskList[Idx].TriggerTime = TriggerTime;
+			Sched.TaskList[Idx].CustomerFunc = CallbackFn;
+			if (TriggerTime > Sched.NextDeadline) {
+				XPlmi_SchedArmTimer();
+			}
+			microblaze_enable_interrupts();
 			Status = XST_SUCCESS;
 			break;
 		}
@@ -350,7 +455,8 @@ END:
 * @param	OwnerId Id of the owner, removed only if matches the ownerid
 *			while adding the task.
 * @param	CallbackFn callback function that is given while adding.
-* @param	MilliSeconds Periodicity of the task given while adding.
+* @param	MilliSeconds Periodicity of the task given while adding, 0 to
+*			remove the task irrespective of its period.
 * @param	Data is the pointer to the private data of the task
 *
 * @return
@@ -370,7 +476,7 @@ int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 			(Sched.TaskList[Idx].OwnerId == OwnerId) &&
 			(Sched.TaskList[Idx].Data == Data) &&
 			((Sched.TaskList[Idx].Interval ==
-				(MilliSeconds / XPLMI_SCHED_TICK)) ||
+				(MilliSeconds * XPLMI_KILO)) ||
 				(0U == MilliSeconds))) {
 			Sched.TaskList[Idx].Interval = 0U;
 			Sched.TaskList[Idx].OwnerId = 0U;
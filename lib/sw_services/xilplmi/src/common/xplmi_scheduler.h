@@ -32,6 +32,8 @@
 *       bsv  08/15/2021 Removed redundant element in structure
 * 1.04  bm   07/06/2022 Refactor versal and versal_net code
 * 1.05  nb   06/28/2023 Move XPLMI_SCHED_TICK here from .c file
+* 1.06  fl   10/14/2026 Keep task deadlines in timer counts and added
+*                       XPlmi_SchedulerAddTaskUs for sub-millisecond periods
 *
 * </pre>
 *
@@ -58,14 +60,16 @@ extern "C" {
 #define XPLMI_PERIODIC_TASK		(0U)
 #define XPLMI_NON_PERIODIC_TASK		(1U)
 #define XPLMI_SCHED_TICK		(10U)
+#define XPLMI_SCHED_MIN_PERIOD_US	(100U) /**< Minimum periodic task period */
+#define XPLMI_SCHED_MAX_PERIOD_MS	(4294967U) /**< Maximum period in ms */
 
 typedef int (*XPlmi_Callback_t)(void *Data);
 typedef void (*XPlmi_ErrorFunc_t)(int Status);
 
 struct XPlmi_Task_t{
-	u32 Interval;
+	u32 Interval; /**< Period or delay of the task in microseconds */
 	u32 OwnerId;
-	u32 TriggerTime;
+	u64 TriggerTime; /**< Timer value at which the task is due */
 	XPlmi_Callback_t CustomerFunc;
 	XPlmi_ErrorFunc_t ErrorFunc;
 	XPlmi_TaskNode *Task;
@@ -75,16 +79,22 @@ struct XPlmi_Task_t{
 
 typedef struct {
 	struct XPlmi_Task_t TaskList[XPLMI_SCHED_MAX_TASK];
-	u64 LastTimerTick;
+	u64 TickDeadline; /**< Timer value of the next scheduler tick */
+	u64 NextDeadline; /**< Timer value at which PIT3 expires next */
+	u32 TickPeriod; /**< Scheduler tick in timer counts */
+	u32 CountsPerUs; /**< Timer counts in a microsecond */
 	u32 TaskCount;
 	u32 Tick;
 } XPlmi_Scheduler_t ;
 
-void XPlmi_SchedulerInit(void);
+void XPlmi_SchedulerInit(u32 TickPeriod);
 void XPlmi_SchedulerHandler(void *Data);
 int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	XPlmi_ErrorFunc_t ErrorFunc, u32 MilliSeconds, TaskPriority_t Priority,
 	void *Data,	u8 TaskType);
+int XPlmi_SchedulerAddTaskUs(u32 OwnerId, XPlmi_Callback_t CallbackFn,
+	XPlmi_ErrorFunc_t ErrorFunc, u32 MicroSeconds, TaskPriority_t Priority,
+	void *Data, u8 TaskType);
 int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	u32 MilliSeconds, const void *Data);
 
@@ -43,6 +43,8 @@
 *       bsv  03/11/2022 Restore race condition fix that got disturbed by
 *                       previous patch
 * 1.08  ng   11/11/2022 Updated doxygen comments
+* 1.09  fl   10/14/2026 Added preemption points to run pending tasks from
+*                       long running tasks
 *
 * </pre>
 *
@@ -64,9 +66,19 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static XPlmi_TaskNode *XPlmi_TaskGetNext(void);
+static void XPlmi_TaskRun(XPlmi_TaskNode *Task);
+static void XPlmi_TaskResumeDeferred(void);
 
 /************************** Variable Definitions *****************************/
 static struct metal_list TaskQueue[XPLMI_TASK_PRIORITIES];
+/* Next task to be run in round robin from each priority queue */
+static struct metal_list *Node[XPLMI_TASK_PRIORITIES];
+#ifdef PLM_ENABLE_TASK_PREEMPTION
+static struct metal_list DeferredQueue; /* Tasks deferred at preemption */
+static XPlmi_TaskNode *CurrentTask; /* Task in execution */
+static u8 Preempting = (u8)FALSE; /* Tasks run from a preemption point */
+#endif
 
 /*****************************************************************************/
 
@@ -183,85 +195,232 @@ void XPlmi_TaskInit(void)
 	/* Initialize the list pointers */
 	for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
 		metal_list_init(&TaskQueue[Index]);
+		Node[Index] = &TaskQueue[Index];
 	}
+#ifdef PLM_ENABLE_TASK_PREEMPTION
+	metal_list_init(&DeferredQueue);
+#endif
 }
 
 /*****************************************************************************/
 /**
- * @brief	This function will be checking for tasks in the queue based on the
- * priority. After calling every task handlers, next high priority task will
- * be called.
+ * @brief	This function removes the next task to be run from the task
+ * queues, the highest priority queue first and round robin within a queue.
+ * It must be called with interrupts disabled.
+ *
+ * @return	Pointer to the task, NULL if no task is pending
+ *
+ *****************************************************************************/
+static XPlmi_TaskNode *XPlmi_TaskGetNext(void)
+{
+	XPlmi_TaskNode *Task = NULL;
+	u32 Index;
+
+	/**
+	 * Perform Priority based task handling
+	 */
+	for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
+		/**
+		 * If no pending tasks are present, go to sleep
+		 */
+		if (metal_list_is_empty(&TaskQueue[Index]) != (int)FALSE) {
+			XPlmi_Printf(DEBUG_DETAILED,
+			 "No pending tasks in Priority%d Queue\n\r",
+			 Index);
+			continue;
+		} else {
+			/* Skip the first element as it
+			 * is not proper task
+			 */
+			if ((metal_list_is_empty(Node[Index]) != (int)FALSE) ||
+				(Node[Index] == &TaskQueue[Index])) {
+				Node[Index] = TaskQueue[Index].next;
+			}
+			/**
+			 * - Get the next task in round robin
+			 */
+			Task = metal_container_of(Node[Index],
+				XPlmi_TaskNode, TaskNode);
+			Node[Index] = Node[Index]->next;
+			Xil_AssertNonvoid(Task->Handler != NULL);
+			metal_list_del(&Task->TaskNode);
+			break;
+		}
+	}
+
+	return Task;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function calls the task handler and reports the error
+ * returned by it.
+ *
+ * @param	Task Pointer to the task node
  *
  * @return	None
  *
  *****************************************************************************/
-void XPlmi_TaskDispatchLoop(void)
+static void XPlmi_TaskRun(XPlmi_TaskNode *Task)
 {
 	int Status = XST_FAILURE;
-	struct metal_list *Node[XPLMI_TASK_PRIORITIES];
-	XPlmi_TaskNode *Task;
-	u32 Index;
 #ifdef PLM_DEBUG_DETAILED
 	u64 TaskStartTime;
 	XPlmi_PerfTime PerfTime = {0U};
+
+	/* Call the task handler */
+	TaskStartTime = XPlmi_GetTimerValue();
+#endif
+#ifdef PLM_ENABLE_TASK_PREEMPTION
+	CurrentTask = Task;
 #endif
+	Status = Task->Handler(Task->PrivData);
+#ifdef PLM_DEBUG_DETAILED
+	XPlmi_MeasurePerfTime(TaskStartTime, &PerfTime);
+	XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms: Task Time\n\r",
+		(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
+#endif
+	if (Status != XST_SUCCESS) {
+		XPlmi_ErrMgr(Status);
+	}
+}
 
-	XPlmi_Printf(DEBUG_DETAILED, "%s\n\r", __func__);
-	for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
-		Node[Index] = &TaskQueue[Index];
+/*****************************************************************************/
+/**
+ * @brief	This function is a preemption point for long running tasks. It
+ * runs up to XPLMI_TASK_PREEMPT_MAX_RUN pending tasks and returns to the
+ * caller. The caller must not have a transfer in progress that the pending
+ * tasks can disturb. Preemption points are not nested, the task in
+ * execution is not run again from its own preemption point.
+ * It does nothing if PLM_ENABLE_TASK_PREEMPTION is not defined.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_TaskPreemptionPoint(void)
+{
+#ifdef PLM_ENABLE_TASK_PREEMPTION
+	XPlmi_TaskNode *PreemptedTask = CurrentTask;
+	XPlmi_TaskNode *Task;
+	u32 Count;
+
+	if ((Preempting == (u8)TRUE) || (PreemptedTask == NULL)) {
+		goto END;
+	}
+
+	Preempting = (u8)TRUE;
+	for (Count = 0U; Count < XPLMI_TASK_PREEMPT_MAX_RUN; Count++) {
+		microblaze_disable_interrupts();
+		Task = XPlmi_TaskGetNext();
+		if (Task == PreemptedTask) {
+			/* Triggered again while running, run it after it returns */
+			metal_list_add_tail(&DeferredQueue, &Task->TaskNode);
+		}
+		microblaze_enable_interrupts();
+		if (Task == NULL) {
+			break;
+		}
+		if (Task != PreemptedTask) {
+			XPlmi_TaskRun(Task);
+		}
+	}
+	CurrentTask = PreemptedTask;
+	Preempting = (u8)FALSE;
+
+END:
+	return;
+#endif
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function tells if the task in execution is run from a
+ * preemption point.
+ *
+ * @return	TRUE if run from a preemption point, FALSE otherwise
+ *
+ *****************************************************************************/
+u8 XPlmi_TaskIsPreempting(void)
+{
+#ifdef PLM_ENABLE_TASK_PREEMPTION
+	return Preempting;
+#else
+	return (u8)FALSE;
+#endif
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function defers the task in execution, when it is run from a
+ * preemption point and cannot do its work at this point. The task is
+ * triggered again once the preempted task returns.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_TaskDefer(void)
+{
+#ifdef PLM_ENABLE_TASK_PREEMPTION
+	if ((Preempting == (u8)TRUE) && (CurrentTask != NULL)) {
+		microblaze_disable_interrupts();
+		if (metal_list_is_empty(&CurrentTask->TaskNode) == (int)FALSE) {
+			metal_list_del(&CurrentTask->TaskNode);
+		}
+		metal_list_add_tail(&DeferredQueue, &CurrentTask->TaskNode);
+		microblaze_enable_interrupts();
 	}
+#endif
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function triggers the tasks deferred at the preemption
+ * points of the task that returned.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_TaskResumeDeferred(void)
+{
+#ifdef PLM_ENABLE_TASK_PREEMPTION
+	XPlmi_TaskNode *Task;
+
+	CurrentTask = NULL;
+	microblaze_disable_interrupts();
+	while (metal_list_is_empty(&DeferredQueue) == (int)FALSE) {
+		Task = metal_container_of(DeferredQueue.next, XPlmi_TaskNode,
+			TaskNode);
+		metal_list_del(&Task->TaskNode);
+		XPlmi_TaskTriggerNow(Task);
+	}
+	microblaze_enable_interrupts();
+#endif
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function will be checking for tasks in the queue based on the
+ * priority. After calling every task handlers, next high priority task will
+ * be called.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_TaskDispatchLoop(void)
+{
+	XPlmi_TaskNode *Task;
+
+	XPlmi_Printf(DEBUG_DETAILED, "%s\n\r", __func__);
 
 	while (TRUE) {
-		Task = NULL;
 		XPlmi_SetPlmLiveStatus();
 
 		microblaze_disable_interrupts();
-		/**
-		 * Perform Priority based task handling
-		 */
-		for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
-			/**
-			 * If no pending tasks are present, go to sleep
-			 */
-			if (metal_list_is_empty(&TaskQueue[Index]) != (int)FALSE) {
-				XPlmi_Printf(DEBUG_DETAILED,
-				 "No pending tasks in Priority%d Queue\n\r",
-				 Index);
-				continue;
-			} else {
-				/* Skip the first element as it
-				 * is not proper task
-				 */
-				if ((metal_list_is_empty(Node[Index]) != (int)FALSE) ||
-					(Node[Index] == &TaskQueue[Index])) {
-					Node[Index] = TaskQueue[Index].next;
-				}
-				/**
-				 * - Get the next task in round robin
-				 */
-				Task = metal_container_of(Node[Index],
-					XPlmi_TaskNode, TaskNode);
-				Node[Index] = Node[Index]->next;
-				break;
-			}
-		}
+		Task = XPlmi_TaskGetNext();
 		if (Task != NULL) {
-#ifdef PLM_DEBUG_DETAILED
-			/* Call the task handler */
-			TaskStartTime = XPlmi_GetTimerValue();
-#endif
-			Xil_AssertVoid(Task->Handler != NULL);
-			metal_list_del(&Task->TaskNode);
 			microblaze_enable_interrupts();
-			Status = Task->Handler(Task->PrivData);
-#ifdef PLM_DEBUG_DETAILED
-			XPlmi_MeasurePerfTime(TaskStartTime, &PerfTime);
-			XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms: Task Time\n\r",
-				(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
-#endif
-			if (Status != XST_SUCCESS) {
-				XPlmi_ErrMgr(Status);
-			}
+			XPlmi_TaskRun(Task);
+			XPlmi_TaskResumeDeferred();
 			continue;
 		}
 
@@ -32,6 +32,7 @@
 * 1.05  bsv  03/05/2022 Fix exception while deleting two consecutive tasks of
 *                       same priority
 * 1.06  bm   01/03/2023 Create Secure Lockdown as a Critical Priority Task
+* 1.07  fl   10/14/2026 Added task preemption point and defer APIs
 *
 * </pre>
 *
@@ -63,6 +64,7 @@ extern "C" {
 
 
 #define XPLMI_SCHED_TASK_MISSED				(0x1U)
+#define XPLMI_TASK_PREEMPT_MAX_RUN	(4U) /**< Tasks run per preemption point */
 
 #define XPLM_TASK_PRIORITY_CRITICAL	(0U)
 #define XPLM_TASK_PRIORITY_0		(1U)
@@ -99,6 +101,9 @@ void XPlmi_TaskInit(void);
 void XPlmi_TaskDispatchLoop(void);
 XPlmi_TaskNode* XPlmi_GetTaskInstance(int (*Handler)(void *Arg),
 	const void *PrivData, const u32 IntrId);
+void XPlmi_TaskPreemptionPoint(void);
+u8 XPlmi_TaskIsPreempting(void);
+void XPlmi_TaskDefer(void);
 
 /************************** Variable Definitions *****************************/
 
@@ -47,6 +47,13 @@
 *                       PLM to PLM communication
 * 1.09  ng   11/11/2022 Fixed doxygen file name error
 * 1.10  ng   06/21/2023 Added support for system device-tree flow
+*       fl   10/14/2026 Added PLM_ENABLE_CMD_HANDLER_CACHE option
+*       fl   10/14/2026 Added PLM_ENABLE_TASK_PREEMPTION option
+*       fl   10/14/2026 Added PLM_TRACE_LOG_RAW_TIMESTAMP option
+*       fl   10/14/2026 Added PLM_ENABLE_LAZY_KAT option
+*       fl   10/14/2026 Added PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD option
+*       fl   10/14/2026 PLM_PRINT_PERF_DMA also prints the SBI throughput
+*       fl   10/14/2026 Added PLM_ENABLE_PUF_REGEN_CACHE option
 * </pre>
 *
 * @note
@@ -191,7 +198,8 @@ extern "C" {
 /**
  * Enable the below defines as per the requirement.
  * POLL prints the time taken for any poll for MASK_POLL command.
- * DMA prints the time taken for PMC DMA, QSPI, OSPI.
+ * DMA prints the time taken for PMC DMA, QSPI, OSPI and the SBI throughput
+ * of each PDI load.
  * CDO_PROCESS will print the time taken to process CDO file.
  * KEYHOLE will print the time taken to process keyhole command.
  * Keyhole command is used for Cframe and slave slr image loading.
@@ -204,6 +212,36 @@ extern "C" {
 //#define PLM_PRINT_PERF_KEYHOLE
 //#define PLM_PRINT_PERF_PL
 
+/**
+ * Enable the below define to keep the handlers of the recently executed
+ * commands in a cache. Commands executed again, like the CDO commands of a
+ * restarted subsystem, are then dispatched without the module table lookup.
+ */
+//#define PLM_ENABLE_CMD_HANDLER_CACHE
+
+/**
+ * Enable the below define to let long running PLM work, like the CDO
+ * processing of a PDI load, run the pending tasks between chunks. XilPm
+ * IPI commands are then served during the load, other IPI commands are
+ * deferred till the load completes.
+ */
+//#define PLM_ENABLE_TASK_PREEMPTION
+
+/**
+ * Enable the below define to store the time stamp of the trace events as
+ * timer counts instead of milliseconds. This avoids the division for every
+ * event, the host converts the counts using the timer frequency event.
+ */
+//#define PLM_TRACE_LOG_RAW_TIMESTAMP
+
+/**
+ * Enable the below define to run the SHA3, RSA and ECDSA KATs the first time
+ * the algorithm is requested over IPI, instead of failing the request with
+ * XSECURE_ERR_KAT_NOT_EXECUTED until a client runs the KAT. The result is
+ * kept in the KAT status mask, so each KAT runs only once.
+ */
+//#define PLM_ENABLE_LAZY_KAT
+
 #define XPLMI_MJTAG_WA_GASKET_TOGGLE_CNT 10U /**< Number of clock cyles required
 					to change tap state to RESET */
 #define XPLMI_MJTAG_WA_DELAY_USED_IN_GASKET_TOGGLE 1U /**< Delay in usec in
@@ -215,6 +253,22 @@ extern "C" {
  */
 //#define PLM_ENABLE_PLM_TO_PLM_COMM
 
+/**
+ * Enable the below define to let the master PLM stream the keyhole writes to
+ * the slave SLRs from the PMCRAM chunks over both PMC DMAs, without waiting
+ * for each write to complete. The writes complete before any other CDO
+ * command runs and before their chunk is reused. Used for non secure
+ * partitions loaded from QSPI or OSPI, whose copies do not use the PMC DMAs.
+ */
+//#define PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+
+/**
+ * Enable the below define to keep the PUF key and ID of a regeneration loaded
+ * for later regeneration requests with the same helper data. They are served
+ * without regenerating until the PUF ID is cleared or the PUF key zeroized.
+ */
+//#define PLM_ENABLE_PUF_REGEN_CACHE
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
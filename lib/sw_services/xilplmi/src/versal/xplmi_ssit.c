@@ -56,6 +56,8 @@
 *       rama 08/10/2023 Changed SSIT sync error prints to DEBUG_ALWAYS for
 *                       debug level_0 option
 *       dd   09/12/2023 MISRA-C violation Rule 10.3 fixed
+* 1.08  fl   10/14/2026 Added concurrent slave SLR streaming over both
+*                       PMC DMAs
 *
 * </pre>
 *
@@ -73,9 +75,17 @@
 #include "xplmi_util.h"
 #include "xplmi_proc.h"
 #include "xplmi_tamper.h"
+#include "xplmi_dma.h"
 
 /************************** Function Prototypes ******************************/
 static u32 XPlmi_SsitGetSlaveErrorMask(void);
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+static u32 XPlmi_SsitGetStreamDma(u64 DestAddr);
+static void XPlmi_SsitStreamDone(void *CbData, int Status);
+
+/************************** Variable Definitions *****************************/
+static int SsitStreamStatus = XST_SUCCESS; /**< First failed stream transfer */
+#endif
 
 #ifdef PLM_ENABLE_PLM_TO_PLM_COMM
 /************************** Constant Definitions *****************************/
@@ -1654,6 +1664,143 @@ static u32 XPlmi_SsitGetSlaveErrorMask(void)
 	return SlrErrMask;
 }
 
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the given address is in the global
+ * 		address window of a slave SLR.
+ *
+ * @param	Address is the global address
+ *
+ * @return
+ * 			- TRUE if the address belongs to a slave SLR
+ * 			- FALSE otherwise
+ *
+ *****************************************************************************/
+u8 XPlmi_SsitIsSlaveSlrAddr(u64 Address)
+{
+	u8 IsSlaveSlrAddr = (u8)FALSE;
+
+	if ((Address >= XPLMI_SSIT_SLAVE_SLR_BASEADDR) &&
+		(Address < XPLMI_SSIT_SLAVE_SLR_ADDR_END)) {
+		IsSlaveSlrAddr = (u8)TRUE;
+	}
+
+	return IsSlaveSlrAddr;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the PMC DMA streaming the data of the slave
+ * 		SLR the given address belongs to. Slave SLR0 and SLR2 use PMC DMA0,
+ * 		slave SLR1 uses PMC DMA1, so that the streams of adjacent slave
+ * 		SLRs run in parallel and each stream stays in order on one DMA.
+ *
+ * @param	DestAddr is the slave SLR global address
+ *
+ * @return	XPLMI_PMCDMA_0 or XPLMI_PMCDMA_1
+ *
+ *****************************************************************************/
+static u32 XPlmi_SsitGetStreamDma(u64 DestAddr)
+{
+	u32 DmaFlags = XPLMI_PMCDMA_0;
+	u64 SlrNum = (DestAddr - XPLMI_SSIT_SLAVE_SLR_BASEADDR) /
+			XPLMI_SSIT_SLAVE_SLR_ADDR_DIFF;
+
+	if ((SlrNum & 0x1U) != 0U) {
+		DmaFlags = XPLMI_PMCDMA_1;
+	}
+
+	return DmaFlags;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is the completion callback of the slave SLR stream
+ * 		transfers. It keeps the status of the first failed transfer.
+ *
+ * @param	CbData is not used
+ * @param	Status is the status of the transfer
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_SsitStreamDone(void *CbData, int Status)
+{
+	(void)CbData;
+
+	if ((Status != XST_SUCCESS) && (SsitStreamStatus == XST_SUCCESS)) {
+		SsitStreamStatus = Status;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function queues a keyhole write of a slave SLR on the PMC
+ * 		DMA of that SLR and returns without waiting for it. It has the
+ * 		prototype of the keyhole copy function so that XPlmi_KeyHoleXfr
+ * 		can use it. The source must stay valid till XPlmi_SsitStreamFlush
+ * 		is called.
+ *
+ * @param	SrcAddr is the source address
+ * @param	DestAddr is the slave SLR global address
+ * @param	Len is the length of the data in bytes
+ * @param	Flags are not used, the PMC DMA is selected by DestAddr
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- Error code of the failed stream transfer otherwise.
+ *
+ *****************************************************************************/
+int XPlmi_SsitStreamXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+{
+	int Status = XST_FAILURE;
+	u32 DmaFlags = XPlmi_SsitGetStreamDma(DestAddr);
+
+	(void)Flags;
+
+	Status = XPlmi_DmaXfrQueue(SrcAddr, DestAddr, Len >> XPLMI_WORD_LEN_SHIFT,
+			DmaFlags, XPlmi_SsitStreamDone, NULL);
+	if (Status == XST_DEVICE_BUSY) {
+		/** - If the queue of the DMA is full, drain it and queue again */
+		Status = XPlmi_DmaQueueFlush(DmaFlags);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Status = XPlmi_DmaXfrQueue(SrcAddr, DestAddr,
+				Len >> XPLMI_WORD_LEN_SHIFT, DmaFlags,
+				XPlmi_SsitStreamDone, NULL);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits until all queued slave SLR stream transfers
+ * 		are done. It must be called before the PMC DMAs are used in
+ * 		blocking mode and before the source of the transfers is reused.
+ *
+ * @return
+ * 			- XST_SUCCESS if all stream transfers completed successfully.
+ * 			- Error code of the first failed stream transfer otherwise.
+ *
+ *****************************************************************************/
+int XPlmi_SsitStreamFlush(void)
+{
+	int Status = XST_FAILURE;
+
+	(void)XPlmi_DmaQueueFlush(XPLMI_PMCDMA_0);
+	(void)XPlmi_DmaQueueFlush(XPLMI_PMCDMA_1);
+
+	Status = SsitStreamStatus;
+	SsitStreamStatus = XST_SUCCESS;
+
+	return Status;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief	This function provides SSIT Sync Master command execution.
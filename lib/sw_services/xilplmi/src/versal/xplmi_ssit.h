@@ -35,6 +35,7 @@
 *       is   12/19/2022 Added support for XPLMI_SLRS_SINGLE_EAM_EVENT_INDEX
 *       bm   01/03/2023 Handle SSIT Events from PPU1 IRQ directly
 *       dd   03/28/2023 Updated doxygen comments
+* 1.07  fl   10/14/2026 Added concurrent slave SLR streaming APIs
 *
 * </pre>
 *
@@ -74,6 +75,16 @@ extern "C" {
 #define SSIT_SLAVE_1_MASK			(2U)
 #define SSIT_SLAVE_2_MASK			(4U)
 
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+/**
+ * Global address window of the slave SLRs, used by the concurrent slave SLR
+ * streaming
+ */
+#define XPLMI_SSIT_SLAVE_SLR_BASEADDR		(0x108000000UL)
+#define XPLMI_SSIT_SLAVE_SLR_ADDR_DIFF		(0x8000000UL)
+#define XPLMI_SSIT_SLAVE_SLR_ADDR_END		(0x120000000UL)
+#endif
+
 /**
  * SSIT PLM-PLM communication related event handler definition
  */
@@ -212,6 +223,13 @@ int XPlmi_SsitSingleEamEventHandler(void *Data);
 int XPlmi_SsitSyncMaster(XPlmi_Cmd *Cmd);
 int XPlmi_SsitSyncSlaves(XPlmi_Cmd *Cmd);
 int XPlmi_SsitWaitSlaves(XPlmi_Cmd *Cmd);
+
+#ifdef PLM_ENABLE_SSIT_CONCURRENT_SLR_LOAD
+/* Concurrent slave SLR streaming related functions */
+u8 XPlmi_SsitIsSlaveSlrAddr(u64 Address);
+int XPlmi_SsitStreamXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags);
+int XPlmi_SsitStreamFlush(void);
+#endif
 #ifdef __cplusplus
 }
 #endif
@@ -27,6 +27,14 @@
 *       dc   07/17/2022 Added PLM_OCP configuration
 * 1.01  ng   11/11/2022 Fixed doxygen file name error
 * 1.02  ng   06/21/2023 Added support for system device-tree flow
+*       fl   10/14/2026 Added PLM_ENABLE_CMD_HANDLER_CACHE option
+*       fl   10/14/2026 Added PLM_ENABLE_TASK_PREEMPTION option
+*       fl   10/14/2026 Added PLM_TRACE_LOG_RAW_TIMESTAMP option
+*       fl   10/14/2026 Added PLM_ENABLE_TRNG_POOL option
+*       fl   10/14/2026 Added PLM_ENABLE_LAZY_KAT option
+*       fl   10/14/2026 PLM_PRINT_PERF_DMA also prints the SBI throughput
+*       fl   10/14/2026 Added PLM_ENABLE_INCREMENTAL_UPDATE_DB option
+*       fl   10/14/2026 Added PLM_ENABLE_PUF_REGEN_CACHE option
 *
 * </pre>
 *
@@ -160,7 +168,8 @@ extern "C" {
 /**
  * Enable the below defines as per the requirement.
  * POLL prints the time taken for any poll for MASK_POLL command.
- * DMA prints the time taken for PMC DMA, QSPI, OSPI.
+ * DMA prints the time taken for PMC DMA, QSPI, OSPI and the SBI throughput
+ * of each PDI load.
  * CDO_PROCESS will print the time taken to process CDO file.
  * KEYHOLE will print the time taken to process keyhole command.
  * Keyhole command is used for Cframe and slave slr image loading.
@@ -173,6 +182,60 @@ extern "C" {
 //#define PLM_PRINT_PERF_KEYHOLE
 //#define PLM_PRINT_PERF_PL
 
+/**
+ * Enable the below define to keep the handlers of the recently executed
+ * commands in a cache. Commands executed again, like the CDO commands of a
+ * restarted subsystem, are then dispatched without the module table lookup.
+ */
+//#define PLM_ENABLE_CMD_HANDLER_CACHE
+
+/**
+ * Enable the below define to let long running PLM work, like the CDO
+ * processing of a PDI load, run the pending tasks between chunks. XilPm
+ * IPI commands are then served during the load, other IPI commands are
+ * deferred till the load completes.
+ */
+//#define PLM_ENABLE_TASK_PREEMPTION
+
+/**
+ * Enable the below define to store the time stamp of the trace events as
+ * timer counts instead of milliseconds. This avoids the division for every
+ * event, the host converts the counts using the timer frequency event.
+ */
+//#define PLM_TRACE_LOG_RAW_TIMESTAMP
+
+/**
+ * Enable the below define to run the SHA3, RSA and ECDSA KATs the first time
+ * the algorithm is requested over IPI, instead of failing the request with
+ * XSECURE_ERR_KAT_NOT_EXECUTED until a client runs the KAT. The result is
+ * kept in the KAT status mask, so each KAT runs only once.
+ */
+//#define PLM_ENABLE_LAZY_KAT
+
+/**
+ * Enable the below define to keep a pool of TRNG output, refilled by a low
+ * priority task when PLM is idle. Random number requests of up to the pool
+ * size, like IV and nonce generation, are then served without waiting for
+ * the TRNG. The pool is only filled in HRNG mode.
+ */
+//#define PLM_ENABLE_TRNG_POOL
+
+/**
+ * Enable the below define to store the In-Place PLM Update database
+ * incrementally. Data structures whose changes are tracked are stored to the
+ * database when the update is requested and only stored again later if they
+ * changed. The other data structures are stored without their trailing zero
+ * words. The database layout is unchanged, any PLM can restore it.
+ */
+//#define PLM_ENABLE_INCREMENTAL_UPDATE_DB
+
+/**
+ * Enable the below define to keep the PUF key and ID of a regeneration loaded
+ * for later regeneration requests with the same helper data. They are served
+ * without regenerating until the PUF ID is cleared or the PUF key zeroized.
+ */
+//#define PLM_ENABLE_PUF_REGEN_CACHE
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
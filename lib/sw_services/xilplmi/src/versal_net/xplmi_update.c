@@ -35,6 +35,8 @@
 *       bm   09/04/2023 Added support to use DDR region for backup of PLM data
 *                       structures during In-Place PLM Update
 *       sk   09/07/2023 Removed redundant code in XPlmi_PlmUpdate
+* 1.03  fl   10/14/2026 Added incremental database store with tracking of
+*                       data structure changes
 *
 * </pre>
 *
@@ -74,11 +76,22 @@
 #define XPLMI_UPDATE_DONE		(0x2U) /**< Update done */
 #define XPLMI_INVALID_UPDATE_ADDR	(0xFFFFFFFFU) /**< Invalid update address */
 #define XPLMI_UPDATE_TASK_DELAY		(10U) /**< Update task delay */
+#define XPLMI_DS_TRACK_MAX		(128U) /**< Number of data structures
+						whose changes can be tracked */
+#define XPLMI_DS_TRACK_WORDS		(XPLMI_DS_TRACK_MAX / 32U) /**< Words of
+						the tracking bitmaps */
+#define XPLMI_DS_TRACK_MASK(Index)	((u32)1U << ((Index) % 32U)) /**< Bit
+						of a data structure in the bitmaps */
 
 /************************** Function Prototypes ******************************/
 static int XPlmi_PlmUpdateMgr(void) __attribute__((section(".update_mgr_a")));
 static XPlmi_CompatibilityCheck_t XPlmi_CompatibilityCheck;
 static int XPlmi_PlmUpdateTask(void *Arg);
+#ifdef PLM_ENABLE_INCREMENTAL_UPDATE_DB
+static u32 XPlmi_GetDsIndex(u32 ModuleId, u32 DsId);
+static u8 XPlmi_IsDsTracked(u32 Index);
+static int XPlmi_DsStoreCompact(u64 Addr, const XPlmi_DsEntry *DsEntry);
+#endif
 
 /************************** Variable Definitions *****************************/
 extern XPlmi_DsEntry __data_struct_start[];
@@ -95,6 +108,15 @@ EXPORT_GENERIC_DS(PlmUpdateIpiMask, XPLMI_UPDATE_IPIMASK_DS_ID,
 	sizeof(PlmUpdateIpiMask), (u32)(UINTPTR)&PlmUpdateIpiMask);
 static u32 DbStartAddr; /** Db Start Address */
 static u32 DbEndAddr; /** Db End Address */
+#ifdef PLM_ENABLE_INCREMENTAL_UPDATE_DB
+static u32 DsTracked[XPLMI_DS_TRACK_WORDS]; /** Data structures whose
+						changes are tracked */
+static u32 DsDirty[XPLMI_DS_TRACK_WORDS]; /** Tracked data structures changed
+						since the last checkpoint */
+static u32 CheckpointStartAddr; /** Db Start Address of the checkpoint */
+static u64 CheckpointEndAddr; /** End of the tracked data structures of the
+				checkpoint, 0 if there is no checkpoint */
+#endif
 
 /*****************************************************************************/
 
@@ -521,17 +543,48 @@ static int XPlmi_StoreDataBackup(void)
 	DbHdr->HdrSize = sizeof(XPlmi_DbHdr);
 	DsAddr = DbStartAddr + DbHdr->HdrSize;
 
+#ifdef PLM_ENABLE_INCREMENTAL_UPDATE_DB
+	/**
+	 * The tracked data structures follow the header, only the ones changed
+	 * since the checkpoint are stored again. The others are stored after
+	 * them in the compact form.
+	 */
+	Status = XPlmi_UpdateCheckpoint();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	DsAddr = CheckpointEndAddr;
+#endif
+
 	for (Index = 0; Index < DsCnt; Index++) {
 		if (DsEntry[Index].Handler == NULL) {
 			Status = XPLMI_ERR_INVALID_STORE_DS_HANDLER;
 			break;
 		}
+#ifdef PLM_ENABLE_INCREMENTAL_UPDATE_DB
+		if (XPlmi_IsDsTracked(Index) == (u8)TRUE) {
+			continue;
+		}
+		if (DsEntry[Index].Handler == XPlmi_DsOps) {
+			Status = XPlmi_DsStoreCompact(DsAddr, &DsEntry[Index]);
+		}
+		else {
+			Status = DsEntry[Index].Handler(XPLMI_STORE_DATABASE,
+				DsAddr, &DsEntry[Index]);
+		}
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		DsAddr += XPLMI_DS_HDR_SIZE +
+			((XPlmi_DsHdr *)(UINTPTR)DsAddr)->Len;
+#else
 		Status = DsEntry[Index].Handler(XPLMI_STORE_DATABASE,
 				DsAddr, &DsEntry[Index]);
 		if (Status != XST_SUCCESS) {
 			break;
 		}
 		DsAddr += XPLMI_DS_HDR_SIZE + DsEntry[Index].DsHdr.Len;
+#endif
 	}
 	if (Index == DsCnt) {
 		DbHdr->DbSize = (u32)(DsAddr - (u64)DbStartAddr -
@@ -542,6 +595,225 @@ END:
 	return Status;
 }
 
+#ifdef PLM_ENABLE_INCREMENTAL_UPDATE_DB
+/*****************************************************************************/
+/**
+ * @brief	This function returns the index of a data structure in the
+ *		list of data structure entries
+ *
+ * @param	ModuleId is the module ID of the data structure
+ * @param	DsId is the ID of the data structure
+ *
+ * @return	Index of the data structure, XPLMI_DS_CNT if not found
+ *
+ *****************************************************************************/
+static u32 XPlmi_GetDsIndex(u32 ModuleId, u32 DsId)
+{
+	XPlmi_DsEntry *DsEntry = NULL;
+	XPlmi_DsVer DsVer;
+	u32 Index = XPLMI_DS_CNT;
+
+	DsVer.ModuleId = (u8)ModuleId;
+	DsVer.DsId = (u8)DsId;
+	DsEntry = XPlmi_GetDsEntry(__data_struct_start, XPLMI_DS_CNT, &DsVer);
+	if (DsEntry != NULL) {
+		Index = (u32)(DsEntry - __data_struct_start);
+	}
+
+	return Index;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the changes of a data structure are
+ *		tracked
+ *
+ * @param	Index is the index of the data structure entry
+ *
+ * @return	TRUE if the changes are tracked and FALSE otherwise
+ *
+ *****************************************************************************/
+static u8 XPlmi_IsDsTracked(u32 Index)
+{
+	u8 IsTracked = (u8)FALSE;
+
+	if ((Index < XPLMI_DS_TRACK_MAX) && ((DsTracked[Index / 32U] &
+		XPLMI_DS_TRACK_MASK(Index)) != 0U)) {
+		IsTracked = (u8)TRUE;
+	}
+
+	return IsTracked;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function enables the tracking of the changes of a data
+ *		structure. The module must call XPlmi_DsMarkDirty after every
+ *		change of the data structure from then on.
+ *
+ * @param	ModuleId is the module ID of the data structure
+ * @param	DsId is the ID of the data structure
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XPLMI_ERR_INVALID_DS_ENTRY if the data structure is not
+ * 			exported or can not be tracked.
+ *
+ *****************************************************************************/
+int XPlmi_DsTrackChanges(u32 ModuleId, u32 DsId)
+{
+	int Status = XPLMI_ERR_INVALID_DS_ENTRY;
+	u32 Index = XPlmi_GetDsIndex(ModuleId, DsId);
+
+	if (Index < XPLMI_DS_TRACK_MAX) {
+		DsTracked[Index / 32U] |= XPLMI_DS_TRACK_MASK(Index);
+		DsDirty[Index / 32U] |= XPLMI_DS_TRACK_MASK(Index);
+		/* The layout of the tracked data structures changes */
+		CheckpointEndAddr = 0U;
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function marks a tracked data structure as changed since
+ *		the last checkpoint
+ *
+ * @param	ModuleId is the module ID of the data structure
+ * @param	DsId is the ID of the data structure
+ *
+ *****************************************************************************/
+void XPlmi_DsMarkDirty(u32 ModuleId, u32 DsId)
+{
+	u32 Index = XPlmi_GetDsIndex(ModuleId, DsId);
+
+	if (Index < XPLMI_DS_TRACK_MAX) {
+		DsDirty[Index / 32U] |= XPLMI_DS_TRACK_MASK(Index);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stores the tracked data structures changed since
+ *		the last checkpoint to the database. Each of them has a fixed
+ *		place of its full length after the database header, unchanged
+ *		ones are not stored again.
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XPLMI_ERR_INVALID_STORE_DS_HANDLER if invalid Data Structure
+ * 			Handler is used for a tracked data structure.
+ * 			- Errors from the data structure handler.
+ *
+ *****************************************************************************/
+int XPlmi_UpdateCheckpoint(void)
+{
+	int Status = XST_SUCCESS;
+	XPlmi_DsEntry *DsEntry = __data_struct_start;
+	u32 DsCnt = XPLMI_DS_CNT;
+	u64 DsAddr = (u64)DbStartAddr + sizeof(XPlmi_DbHdr);
+	u32 Index;
+	u32 Mask;
+
+	/* Store all tracked data structures to a new database region */
+	if ((CheckpointEndAddr == 0U) || (CheckpointStartAddr != DbStartAddr)) {
+		for (Index = 0U; Index < XPLMI_DS_TRACK_WORDS; Index++) {
+			DsDirty[Index] |= DsTracked[Index];
+		}
+	}
+
+	for (Index = 0U; Index < DsCnt; Index++) {
+		if (XPlmi_IsDsTracked(Index) != (u8)TRUE) {
+			continue;
+		}
+		Mask = XPLMI_DS_TRACK_MASK(Index);
+		if ((DsDirty[Index / 32U] & Mask) != 0U) {
+			if (DsEntry[Index].Handler != XPlmi_DsOps) {
+				Status = XPLMI_ERR_INVALID_STORE_DS_HANDLER;
+				break;
+			}
+			/* Clear first, a change during the store marks it again */
+			DsDirty[Index / 32U] &= ~Mask;
+			Status = XPlmi_DsOps(XPLMI_STORE_DATABASE, DsAddr,
+					&DsEntry[Index]);
+			if (Status != XST_SUCCESS) {
+				DsDirty[Index / 32U] |= Mask;
+				break;
+			}
+		}
+		DsAddr += XPLMI_DS_HDR_SIZE + DsEntry[Index].DsHdr.Len;
+	}
+
+	if (Status == XST_SUCCESS) {
+		CheckpointStartAddr = DbStartAddr;
+		CheckpointEndAddr = DsAddr;
+	}
+	else {
+		CheckpointEndAddr = 0U;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stores a data structure without its trailing zero
+ *		words. The restore zeroizes the part of the data structure that
+ *		is not in the database, so the layout is the one of XPlmi_DsOps.
+ *
+ * @param	Addr is the memory address to which data structure is stored
+ * @param	DsEntry is the Data Structure Entry
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XPLMI_ERR_DS_ALIGNMENT_INCORRECT if the data structure
+ * 			length is not word aligned.
+ * 			- XPLMI_ERR_PLM_UPDATE_DB_OVERFLOW if the data structure
+ * 			does not fit in the database.
+ * 			- XPLMI_ERR_MEMCPY_STORE_DB if memcpy failed to store database.
+ *
+ *****************************************************************************/
+static int XPlmi_DsStoreCompact(u64 Addr, const XPlmi_DsEntry *DsEntry)
+{
+	int Status = XST_FAILURE;
+	const u32 *Data = (const u32 *)(UINTPTR)DsEntry->Addr;
+	u32 Len = DsEntry->DsHdr.Len;
+
+	if ((Len % XPLMI_WORD_LEN) != 0U) {
+		Status = XPLMI_ERR_DS_ALIGNMENT_INCORRECT;
+		goto END;
+	}
+
+	/* Keep at least one word, the restore copy needs a non zero length */
+	while ((Len > XPLMI_WORD_LEN) &&
+		(Data[(Len / XPLMI_WORD_LEN) - 1U] == 0U)) {
+		Len -= XPLMI_WORD_LEN;
+	}
+
+	if ((Addr + XPLMI_DS_HDR_SIZE + Len) > DbEndAddr) {
+		Status = XPLMI_ERR_PLM_UPDATE_DB_OVERFLOW;
+		goto END;
+	}
+
+	if (Len != 0U) {
+		Status = Xil_SMemCpy((void *)(UINTPTR)(Addr + XPLMI_DS_HDR_SIZE),
+			Len, (const void *)Data, Len, Len);
+		if (Status != XST_SUCCESS) {
+			Status = XPLMI_ERR_MEMCPY_STORE_DB;
+			goto END;
+		}
+	}
+	XPlmi_Out64(Addr, DsEntry->DsHdr.Ver.HdrVal);
+	XPlmi_Out64(Addr + XPLMI_WORD_LEN, Len);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief	This function shutdown all the modules gracefully
@@ -672,6 +944,18 @@ int XPlmi_PlmUpdate(XPlmi_Cmd *Cmd)
 		goto END;
 	}
 
+#ifdef PLM_ENABLE_INCREMENTAL_UPDATE_DB
+	/**
+	 * Store the tracked data structures while the modules still run, the
+	 * update task only stores the ones changed after this
+	 */
+	Status = XPlmi_UpdateCheckpoint();
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_STORE_DATA_BACKUP, Status);
+		goto END;
+	}
+#endif
+
 	Status = XST_FAILURE;
 	PlmUpdateState |= XPLMI_UPDATE_IN_PROGRESS;
 	PlmUpdateStateTmp |= XPLMI_UPDATE_IN_PROGRESS;
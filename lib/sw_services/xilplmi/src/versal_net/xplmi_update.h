@@ -20,6 +20,7 @@
 * 1.01  ng   11/11/2022 Fixed doxygen file name error
 *       dd   03/28/2023 Updated doxygen comments
 * 1.02  vns  07/06/2023 Added EXPORT_OCP_DS
+* 1.03  fl   10/14/2026 Added data structure change tracking APIs
 *
 * </pre>
 *
@@ -167,6 +168,9 @@ int XPlmi_RestoreDataBackup(void);
 int XPlmi_DsOps(u32 Op, u64 Addr, void *Data);
 int XPlmi_UpdateInit(XPlmi_CompatibilityCheck_t CompatibilityHandler);
 XPlmi_DsEntry* XPlmi_GetDsEntry(XPlmi_DsEntry *DsList, u32 DsCnt, XPlmi_DsVer *DsVer);
+int XPlmi_DsTrackChanges(u32 ModuleId, u32 DsId);
+void XPlmi_DsMarkDirty(u32 ModuleId, u32 DsId);
+int XPlmi_UpdateCheckpoint(void);
 
 #ifdef __cplusplus
 }
@@ -22,6 +22,13 @@
 static XPm_Subsystem *PmSubsystems;
 static u32 MaxSubsysIdx;
 
+/*
+ * Subsystems by node index, and the subsystem last resolved for each IPI
+ * channel bit, so the PM command path does not walk the subsystem list.
+ */
+static XPm_Subsystem *PmSubsystemsByIdx[MAX_NUM_SUBSYSTEMS];
+static const XPm_Subsystem *PmSubsystemsByIpi[32U];
+
 XStatus XPmSubsystem_AddPermission(const XPm_Subsystem *Host,
                                    XPm_Subsystem *Target,
                                    const u32 Operations)
@@ -287,12 +294,9 @@ XPm_Subsystem * XPmSubsystem_GetById(u32 SubsystemId)
                 goto done;
         }
 
-        SubSystem = PmSubsystems;
-        while (NULL != SubSystem) {
-                if (SubSystem->Id == SubsystemId) {
-                        break;
-                }
-                SubSystem = SubSystem->NextSubsystem;
+        SubSystem = PmSubsystemsByIdx[NODEINDEX(SubsystemId)];
+        if ((NULL != SubSystem) && (SubSystem->Id != SubsystemId)) {
+                SubSystem = NULL;
         }
 
 done:
@@ -317,17 +321,14 @@ done:
  ****************************************************************************/
 XPm_Subsystem *XPmSubsystem_GetByIndex(u32 SubSysIdx)
 {
-        XPm_Subsystem *Subsystem = PmSubsystems;
+        XPm_Subsystem *Subsystem = NULL;
 
         /*
          * We assume that Subsystem class, subclass and type have been
          * validated before, so just validate index against bounds here
          */
-        while (NULL != Subsystem) {
-                if (SubSysIdx == NODEINDEX(Subsystem->Id)) {
-                        break;
-                }
-                Subsystem = Subsystem->NextSubsystem;
+        if (MAX_NUM_SUBSYSTEMS > SubSysIdx) {
+                Subsystem = PmSubsystemsByIdx[SubSysIdx];
         }
 
         return Subsystem;
@@ -642,6 +643,8 @@ XStatus XPmSubsystem_Add(u32 SubsystemId)
                 Subsystem->IpiMask = 0U;
         }
         PmSubsystems = Subsystem;
+        /* A re-added subsystem replaces its offline instance */
+        PmSubsystemsByIdx[NODEINDEX(SubsystemId)] = Subsystem;
 
         if (NODEINDEX(SubsystemId) > MaxSubsysIdx) {
                 MaxSubsysIdx = NODEINDEX(SubsystemId);
@@ -792,6 +795,7 @@ u32 XPmSubsystem_GetSubSysIdByIpiMask(u32 IpiMask)
 {
         u32 SubsystemId = INVALID_SUBSYSID;
         const XPm_Subsystem *Subsystem;
+        u32 IpiBit = 0U;
 
         /*
          * Subsystem with least one IPI channel
@@ -801,6 +805,24 @@ u32 XPmSubsystem_GetSubSysIdByIpiMask(u32 IpiMask)
                 goto done;
         }
 
+        /*
+         * Commands come from a single IPI channel, try the subsystem
+         * resolved last time for it. The entry is checked again as
+         * subsystems go offline and are re-added.
+         */
+        if (0U == (IpiMask & (IpiMask - 1U))) {
+                while (0U == (IpiMask & ((u32)1U << IpiBit))) {
+                        IpiBit++;
+                }
+                Subsystem = PmSubsystemsByIpi[IpiBit];
+                if ((NULL != Subsystem) &&
+                    ((Subsystem->IpiMask & IpiMask) == IpiMask) &&
+                    ((u8)OFFLINE != Subsystem->State)) {
+                        SubsystemId = Subsystem->Id;
+                        goto done;
+                }
+        }
+
         Subsystem = PmSubsystems;
         while (NULL != Subsystem) {
                 if (((Subsystem->IpiMask & IpiMask) == IpiMask) &&
@@ -811,6 +833,10 @@ u32 XPmSubsystem_GetSubSysIdByIpiMask(u32 IpiMask)
                 Subsystem = Subsystem->NextSubsystem;
         }
 
+        if ((NULL != Subsystem) && (0U == (IpiMask & (IpiMask - 1U)))) {
+                PmSubsystemsByIpi[IpiBit] = Subsystem;
+        }
+
 done:
         return SubsystemId;
 }
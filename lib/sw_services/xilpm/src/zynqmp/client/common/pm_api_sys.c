@@ -52,6 +52,15 @@
  * @endcond
  */
 
+/** @cond xilpm_internal */
+/*
+ * Node status cache, only used for nodes with a registered state change
+ * notifier so that a status change by any PU drops the cached value
+ */
+static XPm_NodeStatus pm_status_cache[NODE_ID_MAX];
+static u8 pm_status_cached[NODE_ID_MAX];
+/** @endcond */
+
 /****************************************************************************/
 /**
  * @brief  Initialize xilpm library
@@ -75,6 +84,7 @@ XStatus XPm_InitXilpm(XIpiPsu *IpiInst)
 	}
 
 	XPm_ClientSetPrimaryMaster();
+	XPm_NodeStatusInvalidate(NODE_UNKNOWN);
 
 	if (NULL != primary_master) {
 		primary_master->ipi = IpiInst;
@@ -447,6 +457,7 @@ XStatus XPm_SelfSuspend(const enum XPmNodeId nid,
 	XPm_ClientSuspend(master);
 
 	/* Send request to the PMU */
+	XPm_NodeStatusInvalidate(NODE_UNKNOWN);
 	PACK_PAYLOAD5(payload, PM_SELF_SUSPEND, nid, latency, state, (u32)address,
 		     (u32)(address >> 32U));
 	ret = pm_ipi_send(master, payload);
@@ -482,6 +493,7 @@ XStatus XPm_SetConfiguration(const u32 address)
 
 	if (NULL != primary_master) {
 		/* Send request to the PMU */
+		XPm_NodeStatusInvalidate(NODE_UNKNOWN);
 		PACK_PAYLOAD1(payload, PM_SET_CONFIGURATION, address);
 		status = pm_ipi_send(primary_master, payload);
 
@@ -563,6 +575,7 @@ XStatus XPm_RequestSuspend(const enum XPmNodeId target,
 
 	if (NULL != primary_master) {
 		/* Send request to the PMU */
+		XPm_NodeStatusInvalidate(target);
 		PACK_PAYLOAD4(payload, PM_REQUEST_SUSPEND, target, ack, latency, state);
 		ret = pm_ipi_send(primary_master, payload);
 
@@ -611,6 +624,7 @@ XStatus XPm_RequestWakeUp(const enum XPmNodeId target,
 
 	if (NULL != primary_master) {
 		/* Send request to the PMU */
+		XPm_NodeStatusInvalidate(target);
 		PACK_PAYLOAD4(payload, PM_REQUEST_WAKEUP, target, (u32)encodedAddress,
 				 (u32)(encodedAddress >> 32), ack);
 		ret = pm_ipi_send(primary_master, payload);
@@ -647,6 +661,7 @@ XStatus XPm_ForcePowerDown(const enum XPmNodeId target,
 
 	if (NULL != primary_master) {
 		/* Send request to the PMU */
+		XPm_NodeStatusInvalidate(target);
 		PACK_PAYLOAD2(payload, PM_FORCE_POWERDOWN, target, ack);
 		ret = pm_ipi_send(primary_master, payload);
 
@@ -781,6 +796,7 @@ XStatus XPm_SystemShutdown(u32 type, u32 subtype)
 
 	if (NULL != primary_master) {
 		/* Send request to the PMU */
+		XPm_NodeStatusInvalidate(NODE_UNKNOWN);
 		PACK_PAYLOAD2(payload, PM_SYSTEM_SHUTDOWN, type, subtype);
 		status = pm_ipi_send(primary_master, payload);
 
@@ -831,6 +847,7 @@ XStatus XPm_RequestNode(const enum XPmNodeId node,
 	u32 payload[PAYLOAD_ARG_CNT];
 
 	if (NULL != primary_master) {
+		XPm_NodeStatusInvalidate(node);
 		PACK_PAYLOAD4(payload, PM_REQUEST_NODE, node, capabilities, qos, ack);
 		ret = pm_ipi_send(primary_master, payload);
 
@@ -869,6 +886,7 @@ XStatus XPm_SetRequirement(const enum XPmNodeId nid,
 	u32 payload[PAYLOAD_ARG_CNT];
 
 	if (NULL != primary_master) {
+		XPm_NodeStatusInvalidate(nid);
 		PACK_PAYLOAD4(payload, PM_SET_REQUIREMENT, nid, capabilities, qos, ack);
 		ret = pm_ipi_send(primary_master, payload);
 
@@ -901,6 +919,7 @@ XStatus XPm_ReleaseNode(const enum XPmNodeId node)
 
 	if (NULL != primary_master) {
 		/* Send request to the PMU */
+		XPm_NodeStatusInvalidate(node);
 		PACK_PAYLOAD1(payload, PM_RELEASE_NODE, node);
 		status = pm_ipi_send(primary_master, payload);
 
@@ -940,6 +959,7 @@ XStatus XPm_SetMaxLatency(const enum XPmNodeId node,
 
 	if (NULL != primary_master) {
 		/* Send request to the PMU */
+		XPm_NodeStatusInvalidate(node);
 		PACK_PAYLOAD2(payload, PM_SET_MAX_LATENCY, node, latency);
 		status = pm_ipi_send(primary_master, payload);
 
@@ -1134,6 +1154,7 @@ void XPm_NotifyCb(const enum XPmNodeId node,
 		  const u32 oppoint)
 {
 	pm_dbg("%s (%d, %d, %d)\n", __func__, node, event, oppoint);
+	XPm_NodeStatusInvalidate(node);
 	XPm_NotifierProcessEvent(node, event, oppoint);
 }
 
@@ -1209,7 +1230,12 @@ done:
  * @return XST_SUCCESS if successful else XST_FAILURE or an error code
  * or a reason code
  *
- * @note   None
+ * @note   The status of a node with a registered EVENT_STATE_CHANGE
+ * notifier is cached, and repeated queries are served without an IPI
+ * until a notification for the node or a PM call of this PU that affects
+ * it. Other PUs releasing or requesting the node without changing its
+ * state are not notified, call XPm_NodeStatusInvalidate() before the query
+ * if an up-to-date usage is needed.
  *
  ****************************************************************************/
 XStatus XPm_GetNodeStatus(const enum XPmNodeId node,
@@ -1218,6 +1244,12 @@ XStatus XPm_GetNodeStatus(const enum XPmNodeId node,
 	XStatus ret = (XStatus)XST_FAILURE;
 	u32 payload[PAYLOAD_ARG_CNT];
 
+	if ((node < NODE_ID_MAX) && (0U != pm_status_cached[node])) {
+		*nodestatus = pm_status_cache[node];
+		ret = (XStatus)XST_SUCCESS;
+		goto done;
+	}
+
 	if (NULL != primary_master) {
 		/* Send request to the PMU */
 		PACK_PAYLOAD1(payload, PM_GET_NODE_STATUS, node);
@@ -1231,11 +1263,112 @@ XStatus XPm_GetNodeStatus(const enum XPmNodeId node,
 		ret = pm_ipi_buff_read32(primary_master, &nodestatus->status,
 					  &nodestatus->requirements,
 					  &nodestatus->usage);
+
+		if ((XST_SUCCESS == ret) && (node < NODE_ID_MAX) &&
+		    (0U != XPm_NotifierIsRegistered(node, EVENT_STATE_CHANGE))) {
+			pm_status_cache[node] = *nodestatus;
+			pm_status_cached[node] = 1U;
+		}
 	}
 done:
 	return ret;
 }
 
+/****************************************************************************/
+/**
+ * @brief  This function drops the cached status of a node, the next
+ * XPm_GetNodeStatus call for it queries the power management controller.
+ *
+ * @param  node ID of the node, NODE_UNKNOWN drops the status of all nodes.
+ *
+ * @return None
+ *
+ * @note   None
+ *
+ ****************************************************************************/
+void XPm_NodeStatusInvalidate(const enum XPmNodeId node)
+{
+	u32 i;
+
+	if (NODE_UNKNOWN == node) {
+		for (i = 0U; i < (u32)NODE_ID_MAX; i++) {
+			pm_status_cached[i] = 0U;
+		}
+	} else if (node < NODE_ID_MAX) {
+		pm_status_cached[node] = 0U;
+	} else {
+		/* Not a cached node */
+	}
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function runs a list of slave node operations. Each one is
+ * sent with a blocking acknowledge, and the list stops at the first one
+ * that fails.
+ *
+ * @param  ops   List of operations, the api member of each one is
+ * PM_REQUEST_NODE, PM_SET_REQUIREMENT, PM_RELEASE_NODE or PM_SET_MAX_LATENCY
+ * @param  count Number of operations in the list
+ * @param  done  Returns the number of operations that succeeded (optional)
+ *
+ * @return XST_SUCCESS if all operations succeeded, else the status of the
+ * failing one, or XST_INVALID_PARAM for an unsupported api
+ *
+ * @note   The power management controller serves one request per IPI
+ * buffer, so the operations still take one IPI each. The list replaces the
+ * per-call status checks of the caller.
+ *
+ ****************************************************************************/
+XStatus XPm_Batch(const XPm_BatchOp *const ops, const u32 count,
+		  u32 *const done)
+{
+	XStatus ret = (XStatus)XST_SUCCESS;
+	u32 i;
+
+	if ((NULL == ops) && (0U != count)) {
+		ret = (XStatus)XST_INVALID_PARAM;
+		i = 0U;
+		goto exit;
+	}
+
+	for (i = 0U; i < count; i++) {
+		switch (ops[i].api) {
+		case PM_REQUEST_NODE:
+			ret = XPm_RequestNode(ops[i].node, ops[i].capabilities,
+					      ops[i].qos, REQUEST_ACK_BLOCKING);
+			break;
+		case PM_SET_REQUIREMENT:
+			ret = XPm_SetRequirement(ops[i].node,
+						 ops[i].capabilities,
+						 ops[i].qos,
+						 REQUEST_ACK_BLOCKING);
+			break;
+		case PM_RELEASE_NODE:
+			ret = XPm_ReleaseNode(ops[i].node);
+			break;
+		case PM_SET_MAX_LATENCY:
+			ret = XPm_SetMaxLatency(ops[i].node, ops[i].capabilities);
+			break;
+		default:
+			ret = (XStatus)XST_INVALID_PARAM;
+			break;
+		}
+
+		if (XST_SUCCESS != ret) {
+			pm_dbg("%s: ERROR operation %d failed\n", __func__, i);
+			break;
+		}
+	}
+
+exit:
+	if (NULL != done) {
+		*done = i;
+	}
+
+	return ret;
+}
+
 /****************************************************************************/
 /**
  * @brief  Call this function to request the power management controller to
@@ -1460,6 +1593,7 @@ XStatus XPm_UnregisterNotifier(XPm_Notifier* const notifier)
 	if (XST_SUCCESS != ret) {
 		goto done;
 	}
+	XPm_NodeStatusInvalidate(notifier->node);
 
 	if (NULL != primary_master) {
 		/* Send request to the PMU */
@@ -131,6 +131,16 @@ typedef struct XPm_NdStatus {
 	u32 usage;			/**< Usage information (which master is currently using the slave) */
 } XPm_NodeStatus;
 
+/**
+ * XPm_BatchOp - slave node operation of XPm_Batch
+ */
+typedef struct XPm_BtchOp {
+	XPm_ApiId api;			/**< PM_REQUEST_NODE, PM_SET_REQUIREMENT, PM_RELEASE_NODE or PM_SET_MAX_LATENCY */
+	enum XPmNodeId node;	/**< Slave node */
+	u32 capabilities;	/**< Capabilities, or latency for PM_SET_MAX_LATENCY */
+	u32 qos;			/**< Quality of Service */
+} XPm_BatchOp;
+
 /********************************************************************/
 /*
  * Global data declarations
@@ -163,12 +173,15 @@ XStatus XPm_SetRequirement(const enum XPmNodeId nid,
 			   const enum XPmRequestAck ack);
 XStatus XPm_SetMaxLatency(const enum XPmNodeId node,
 			  const u32 latency);
+XStatus XPm_Batch(const XPm_BatchOp *const ops, const u32 count,
+		  u32 *const done);
 
 /* Miscellaneous API functions */
 XStatus XPm_GetApiVersion(u32 *version);
 
 XStatus XPm_GetNodeStatus(const enum XPmNodeId node,
 			  XPm_NodeStatus *const nodestatus);
+void XPm_NodeStatusInvalidate(const enum XPmNodeId node);
 
 XStatus XPm_RegisterNotifier(XPm_Notifier* const notifier);
 XStatus XPm_UnregisterNotifier(XPm_Notifier* const notifier);
@@ -137,5 +137,34 @@ void XPm_NotifierProcessEvent(const enum XPmNodeId node,
 		notifier = notifier->next;
 	}
 }
+
+/****************************************************************************/
+/**
+ * @brief  Check whether a notifier is registered for a node and event
+ *
+ * @param  node  Node which is the subject of notification
+ * @param  event Event which is the subject of notification
+ *
+ * @return 1 if a notifier is registered, else 0
+ *
+ * @note   None
+ *
+ ****************************************************************************/
+u8 XPm_NotifierIsRegistered(const enum XPmNodeId node,
+			    const enum XPmNotifyEvent event)
+{
+	const XPm_Notifier* notifier = notifierList;
+	u8 found = 0U;
+
+	while (notifier != NULL) {
+		if ((node == notifier->node) && (event == notifier->event)) {
+			found = 1U;
+			break;
+		}
+		notifier = notifier->next;
+	}
+
+	return found;
+}
 /** @endcond */
  /** @} */
@@ -31,6 +31,9 @@ XStatus XPm_NotifierRemove(XPm_Notifier* const notifier);
 void XPm_NotifierProcessEvent(const enum XPmNodeId node,
 			      const enum XPmNotifyEvent event,
 			      const u32 oppoint);
+
+u8 XPm_NotifierIsRegistered(const enum XPmNodeId node,
+			    const enum XPmNotifyEvent event);
 /** @endcond */
 
 #ifdef __cplusplus
@@ -58,6 +58,7 @@
 *       vss  02/21/2023 Fixed PUF aux shift issue
 * 2.2	kpt  08/03/2023 Fix passing efuse cache value and changed XPuf_IsRegistrationEnabled to
 *                       XPuf_IsRegistrationDisabled
+* 2.3   fl   10/14/2026 Added regeneration cache under PLM_ENABLE_PUF_REGEN_CACHE
 *
 * </pre>
 *
@@ -73,6 +74,7 @@
 #include "xil_io.h"
 #include "xil_printf.h"
 #include "xpuf_plat.h"
+#include "xplmi_config.h"
 
 /************************** Constant Definitions *****************************/
 #define XPUF_STATUS_WAIT_TIMEOUT		(1000000U)
@@ -177,6 +179,33 @@ static int XPuf_ValidateAccessRules(const XPuf_Data *PufData);
 static int XPuf_UpdateHelperData(const XPuf_Data *PufData);
 static int XPuf_StartRegeneration(XPuf_Data *PufData);
 static int XPuf_ChangeIroFreq(u32 IroFreq, u8 *IroFreqUpdated);
+#ifdef PLM_ENABLE_PUF_REGEN_CACHE
+static u32 XPuf_RegenCacheLookup(XPuf_Data *PufData);
+static void XPuf_RegenCacheUpdate(const XPuf_Data *PufData);
+#endif
+
+/************************** Variable Definitions *****************************/
+#ifdef PLM_ENABLE_PUF_REGEN_CACHE
+/**
+ * Inputs and PUF ID of the last successful regeneration. The PUF key and ID
+ * stay loaded in hardware until they are zeroized, so a later regeneration
+ * with the same inputs only needs to return the ID.
+ */
+static struct {
+	u32 IsValid;		/**< TRUE if the entry describes the loaded key/ID */
+	u8 PufOperation;	/**< On demand or ID only regeneration */
+	u8 GlobalVarFilter;	/**< Global Variation Filter option */
+	XPuf_ReadOption ReadOption;	/**< Helper data location */
+	u32 ShutterValue;	/**< Shutter value */
+	u32 Chash;		/**< Chash of the helper data in RAM */
+	u32 Aux;		/**< Aux of the helper data in RAM */
+	u32 SyndromeAddr;	/**< Address of the syndrome data in RAM */
+#if defined (VERSAL_NET)
+	u32 RoSwapVal;		/**< PUF Ring Oscillator Swap setting */
+#endif
+	u32 PufID[XPUF_ID_LEN_IN_WORDS];	/**< Regenerated PUF ID */
+} XPuf_RegenCache;
+#endif
 
 /************************** Function Definitions *****************************/
 
@@ -254,6 +283,13 @@ int XPuf_Registration(XPuf_Data *PufData)
 		goto END;
 	}
 
+#ifdef PLM_ENABLE_PUF_REGEN_CACHE
+	/**
+	 * Registration replaces the PUF key and ID, drop the cached regeneration.
+	 */
+	XPuf_RegenCache.IsValid = FALSE;
+#endif
+
 	/**
 	 * Check GlobalVariationFilter user option. If TRUE then set GLBL_FILTER and HASH_SEL bits
 	 * else, set only HASH_SEL bit in in PUF_CFG0 register.
@@ -429,6 +465,18 @@ int XPuf_Regeneration(XPuf_Data *PufData)
 		goto END;
 	}
 
+#ifdef PLM_ENABLE_PUF_REGEN_CACHE
+	/**
+	 * If the key and ID of an earlier regeneration with the same inputs
+	 * are still loaded, return the cached PUF ID without regenerating.
+	 */
+	if (XPuf_RegenCacheLookup(PufData) == TRUE) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+	XPuf_RegenCache.IsValid = FALSE;
+#endif
+
 	Status = XST_FAILURE;
 
 	/**
@@ -488,6 +536,11 @@ int XPuf_Regeneration(XPuf_Data *PufData)
 	 * If invalid input, return XPUF_ERROR_INVALID_REGENERATION_TYPE.
 	 */
 	Status = XPuf_StartRegeneration(PufData);
+#ifdef PLM_ENABLE_PUF_REGEN_CACHE
+	if (Status == XST_SUCCESS) {
+		XPuf_RegenCacheUpdate(PufData);
+	}
+#endif
 
 	/**
 	 * Enabling the SLVERR after regeneration, if SLVERR is enabled previously in PMC_GLOBAL.
@@ -532,6 +585,13 @@ int XPuf_ClearPufID(void)
 	int Status = XST_FAILURE;
 	int WaitStatus = XST_FAILURE;
 
+#ifdef PLM_ENABLE_PUF_REGEN_CACHE
+	/**
+	 * The next regeneration has to run on hardware again.
+	 */
+	XPuf_RegenCache.IsValid = FALSE;
+#endif
+
 	/**
 	 * Set least significant bit in the PUF_CLEAR register.
 	 */
@@ -1111,3 +1171,121 @@ static int XPuf_ChangeIroFreq(u32 IroFreq, u8 *IroFreqUpdated)
 END:
 	return Status;
 }
+
+#ifdef PLM_ENABLE_PUF_REGEN_CACHE
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the last successful regeneration used the
+ *		same inputs and its key and ID are still loaded. On a hit the cached
+ *		PUF ID is copied to PufData.
+ *
+ * @param	PufData - Pointer to XPuf_Data structure which includes options
+ *                        to configure PUF
+ *
+ * @return
+ *			 - TRUE  Cached regeneration is valid for PufData
+ *			 - FALSE Regeneration has to run on hardware
+ *
+ *****************************************************************************/
+static u32 XPuf_RegenCacheLookup(XPuf_Data *PufData)
+{
+	u32 IsHit = FALSE;
+	u32 Index;
+
+	if (XPuf_RegenCache.IsValid != TRUE) {
+		goto END;
+	}
+
+	/**
+	 * An on demand regeneration also loads the ID, so it serves ID only
+	 * requests. An ID only regeneration does not load the key.
+	 */
+	if ((PufData->PufOperation != XPuf_RegenCache.PufOperation) &&
+		(XPuf_RegenCache.PufOperation != XPUF_REGEN_ON_DEMAND)) {
+		goto END;
+	}
+
+	if ((PufData->GlobalVarFilter != XPuf_RegenCache.GlobalVarFilter) ||
+		(PufData->ShutterValue != XPuf_RegenCache.ShutterValue) ||
+		(PufData->ReadOption != XPuf_RegenCache.ReadOption)) {
+		goto END;
+	}
+
+#if defined (VERSAL_NET)
+	if (PufData->RoSwapVal != XPuf_RegenCache.RoSwapVal) {
+		goto END;
+	}
+#endif
+
+	/**
+	 * Helper data in eFuses can not change. Helper data in RAM is identified
+	 * by its Chash and Aux, the hardware only accepts syndrome data that
+	 * matches the Chash.
+	 */
+	if ((PufData->ReadOption == XPUF_READ_FROM_RAM) &&
+		((PufData->Chash != XPuf_RegenCache.Chash) ||
+		(PufData->Aux != XPuf_RegenCache.Aux) ||
+		(PufData->SyndromeAddr != XPuf_RegenCache.SyndromeAddr))) {
+		goto END;
+	}
+
+	/**
+	 * The PUF key must not have been zeroized since.
+	 */
+	if ((PufData->PufOperation == XPUF_REGEN_ON_DEMAND) &&
+		((XPuf_ReadReg(XPUF_AES_BASEADDR,
+		XPUF_AES_KEY_ZEROED_STATUS_OFFSET) &
+		XPUF_AES_PUF_KEY_ZEROED_MASK) != 0U)) {
+		goto END;
+	}
+
+	/**
+	 * The PUF ID registers must still hold the regenerated ID, they read
+	 * zero after XPuf_ClearPufID.
+	 */
+	for (Index = 0U; Index < XPUF_ID_LEN_IN_WORDS; Index++) {
+		if (XPuf_ReadReg(XPUF_PMC_GLOBAL_BASEADDR,
+			(XPUF_PMC_GLOBAL_PUF_ID_0_OFFSET + (Index * XPUF_WORD_LENGTH))) !=
+			XPuf_RegenCache.PufID[Index]) {
+			goto END;
+		}
+	}
+
+	for (Index = 0U; Index < XPUF_ID_LEN_IN_WORDS; Index++) {
+		PufData->PufID[Index] = XPuf_RegenCache.PufID[Index];
+	}
+	IsHit = TRUE;
+
+END:
+	return IsHit;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function records the inputs and PUF ID of a successful
+ *		regeneration.
+ *
+ * @param	PufData - Pointer to XPuf_Data structure which includes options
+ *                        to configure PUF
+ *
+ *****************************************************************************/
+static void XPuf_RegenCacheUpdate(const XPuf_Data *PufData)
+{
+	u32 Index;
+
+	XPuf_RegenCache.PufOperation = PufData->PufOperation;
+	XPuf_RegenCache.GlobalVarFilter = PufData->GlobalVarFilter;
+	XPuf_RegenCache.ReadOption = PufData->ReadOption;
+	XPuf_RegenCache.ShutterValue = PufData->ShutterValue;
+	XPuf_RegenCache.Chash = PufData->Chash;
+	XPuf_RegenCache.Aux = PufData->Aux;
+	XPuf_RegenCache.SyndromeAddr = PufData->SyndromeAddr;
+#if defined (VERSAL_NET)
+	XPuf_RegenCache.RoSwapVal = PufData->RoSwapVal;
+#endif
+	for (Index = 0U; Index < XPUF_ID_LEN_IN_WORDS; Index++) {
+		XPuf_RegenCache.PufID[Index] = PufData->PufID[Index];
+	}
+	XPuf_RegenCache.IsValid = TRUE;
+}
+#endif
@@ -33,6 +33,7 @@
 *       kpt  03/24/2021 Added macro XPUF_IRO_TRIM_FUSE_SEL_BIT
 * 2.2	vss  09/07/2023	Fixed MISRA-C Rule 2.5 violation
 *	vss  09/21/2023 Fixed doxygen warnings
+* 2.3   fl   10/14/2026 Added AES_KEY_ZEROED_STATUS register definitions
 *
 * </pre>
 *
@@ -138,9 +139,15 @@ extern "C" {
 
 /* EFUSE_CACHE SECURITY_CONTROL register definition */
 #define XPUF_PUF_DIS				((u32)1U << 18U)
-
 /** @} */
 
+#define XPUF_AES_BASEADDR			(0xF11E0000U)
+				/**< AES Base Address */
+
+/* AES_KEY_ZEROED_STATUS register offset and definition */
+#define XPUF_AES_KEY_ZEROED_STATUS_OFFSET	(0x00000064U)
+#define XPUF_AES_PUF_KEY_ZEROED_MASK		((u32)1U << 21U)
+
 #define XPUF_EFUSE_CTRL_BASEADDR		(0xF1240000U)
 					/**< EFUSE_CTRL Base Address */
 #define XPUF_ANLG_OSC_SW_1LP_OFFSET		(0x00000060U)
@@ -28,6 +28,8 @@
 *       am   03/08/22 Fixed MISRA C violations
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
 * 5.2   yog  05/04/23 Fixed HIS COMF violations
+*       fl   10/14/26 Added XSecure_ProcessMailboxNonBlocking and
+*                     XSecure_GetMailboxResponse
 *
 * </pre>
 *
@@ -95,6 +97,73 @@ END:
 	return Status;
 }
 
+/****************************************************************************/
+/**
+ * @brief  This function sends IPI request to the target module and returns
+ * without waiting for the response
+ *
+ * @param	MailboxPtr	Pointer to the mailbox instance
+ * @param	MsgPtr		Pointer to the payload message
+ * @param	MsgLen		Length of the message
+ *
+ * @return
+ *	-	XST_SUCCESS - If the IPI request is sent
+ *	-	XST_FAILURE - If there is a failure
+ *
+ * @note	PLM serves one request per IPI channel at a time, so the
+ *		response must be collected with XSecure_GetMailboxResponse
+ *		before another request is sent on the same mailbox. Data
+ *		buffers of the request must stay valid until then.
+ *
+ ****************************************************************************/
+int XSecure_ProcessMailboxNonBlocking(XMailbox *MailboxPtr, u32 *MsgPtr, u32 MsgLen)
+{
+	/**
+	 * Send CDO to PLM through IPI without polling for the acknowledgement
+	 */
+	return (int)XMailbox_SendData(MailboxPtr, XSECURE_TARGET_IPI_INT_MASK, MsgPtr, MsgLen,
+				XILMBOX_MSG_TYPE_REQ, FALSE);
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function checks whether the target module has completed the
+ * request sent by XSecure_ProcessMailboxNonBlocking and reads its response
+ *
+ * @param	MailboxPtr	Pointer to the mailbox instance
+ * @param	Response	Pointer to store the status of the request
+ *
+ * @return
+ *	-	XST_SUCCESS - If the response is read into Response
+ *	-	XST_DEVICE_BUSY - If the request is still in progress
+ *	-	XST_FAILURE - If there is a failure
+ *
+ ****************************************************************************/
+int XSecure_GetMailboxResponse(XMailbox *MailboxPtr, int *Response)
+{
+	int Status = XST_FAILURE;
+	u32 RespBuf[RESPONSE_ARG_CNT];
+
+	/**
+	 * Return XST_DEVICE_BUSY while PLM has not acknowledged the request
+	 */
+	Status = (int)XMailbox_IsDone(MailboxPtr, XSECURE_TARGET_IPI_INT_MASK);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = (int)XMailbox_Recv(MailboxPtr, XSECURE_TARGET_IPI_INT_MASK, RespBuf, RESPONSE_ARG_CNT,
+				XILMBOX_MSG_TYPE_RESP);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	*Response = (int)RespBuf[0];
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -32,6 +32,7 @@
 *       am   03/21/23 Match the shared memory size in secure library to reuse for customer
 * 	yog  05/03/23 Fixed MISRA C violation of Rule 12.2
 *       kal  09/14/23 Added XSecure_SetSlrIndex function
+*       fl   10/14/26 Added non-blocking mailbox request APIs
 *
 * </pre>
 * @note
@@ -126,6 +127,8 @@ static inline int XSecure_SetSlrIndex(XSecure_ClientInstance *InstancePtr, u32 S
 
 /************************** Function Definitions *****************************/
 int XSecure_ProcessMailbox(XMailbox *MailboxPtr, u32 *MsgPtr, u32 MsgLen);
+int XSecure_ProcessMailboxNonBlocking(XMailbox *MailboxPtr, u32 *MsgPtr, u32 MsgLen);
+int XSecure_GetMailboxResponse(XMailbox *MailboxPtr, int *Response);
 int XSecure_ClientInit(XSecure_ClientInstance* const InstancePtr, XMailbox* const MailboxPtr);
 
 #ifdef __cplusplus
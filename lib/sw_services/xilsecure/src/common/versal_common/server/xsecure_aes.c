@@ -90,6 +90,7 @@
 *	vss  09/11/2023 Fixed Coverity warning EXPRESSION_WITH_MAGIC_NUMBERS and MISRA-C Rule 10.1 violation
 *	vss  09/11/2023 Fixed MISRA-C Rule 8.13 violation
 *	vss  09/11/2023 Fixed MISRA-C Rule 10.3 and 10.4 violation
+*       fl   10/14/2026 Added scatter gather encrypt and decrypt update APIs
 *
 * </pre>
 *
@@ -148,6 +149,10 @@ static int XSecure_AesPmcDmaCfgAndXfer(const XSecure_Aes *InstancePtr,
 static int XSecureAesUpdate(const XSecure_Aes *InstancePtr, u64 InDataAddr,
 	u64 OutDataAddr, u32 Size, u8 IsLastChunk);
 static int XSecure_AesIvXfer(const XSecure_Aes *InstancePtr, u64 IvAddr);
+static int XSecure_AesSssCfg(const XSecure_Aes *InstancePtr);
+static int XSecure_AesSgUpdate(XSecure_Aes *InstancePtr,
+	const XSecure_AesSgEntry *SgList, u32 SgCount, u8 IsLastList,
+	XSecure_AesState AesState);
 
 /************************** Variable Definitions *****************************/
 static const XSecure_AesKeyLookup AesKeyLookupTbl [XSECURE_MAX_KEY_SOURCES] =
@@ -1014,6 +1019,36 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function updates the AES engine for decryption with a list
+ * 		of segments, each segment is decrypted from its source to its
+ * 		destination address in order, as one stream
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance
+ * @param	SgList		Pointer to the list of segments
+ * @param	SgCount		Number of segments in the list
+ * @param	IsLastList	If the last segment of this list is the last update
+ *				  of data to be decrypted, this parameter should be
+ *				  set to TRUE otherwise FALSE
+ *
+ * @return
+ *	-	XST_SUCCESS - On successful decryption of the data
+ *	-	XSECURE_AES_INVALID_PARAM - On invalid parameter
+ *	-	XSECURE_AES_STATE_MISMATCH_ERROR - If State mismatch is occurred
+ *	-	XST_FAILURE - On failure
+ *
+ * @note	Segment sizes follow the same alignment rules as
+ *		XSecure_AesDecryptUpdate.
+ *
+ ******************************************************************************/
+int XSecure_AesDecryptUpdateSg(XSecure_Aes *InstancePtr,
+	const XSecure_AesSgEntry *SgList, u32 SgCount, u8 IsLastList)
+{
+	return XSecure_AesSgUpdate(InstancePtr, SgList, SgCount, IsLastList,
+		XSECURE_AES_DECRYPT_INITIALIZED);
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function verifies the GCM tag provided for the data decrypted
@@ -1350,6 +1385,36 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function updates the AES engine for encryption with a list
+ * 		of segments, each segment is encrypted from its source to its
+ * 		destination address in order, as one stream
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance
+ * @param	SgList		Pointer to the list of segments
+ * @param	SgCount		Number of segments in the list
+ * @param	IsLastList	If the last segment of this list is the last update
+ *				  of data to be encrypted, this parameter should be
+ *				  set to TRUE otherwise FALSE
+ *
+ * @return
+ *	-	XST_SUCCESS - On successful encryption of the data
+ *	-	XSECURE_AES_INVALID_PARAM - On invalid parameter
+ *	-	XSECURE_AES_STATE_MISMATCH_ERROR - If State mismatch is occurred
+ *	-	XST_FAILURE - On failure
+ *
+ * @note	Segment sizes follow the same alignment rules as
+ *		XSecure_AesEncryptUpdate.
+ *
+ ******************************************************************************/
+int XSecure_AesEncryptUpdateSg(XSecure_Aes *InstancePtr,
+	const XSecure_AesSgEntry *SgList, u32 SgCount, u8 IsLastList)
+{
+	return XSecure_AesSgUpdate(InstancePtr, SgList, SgCount, IsLastList,
+		XSECURE_AES_ENCRYPT_INITIALIZED);
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function updates the GCM tag for the encrypted data
@@ -2064,18 +2129,7 @@ static int XSecure_AesPmcDmaCfgAndXfer(const XSecure_Aes *InstancePtr,
 	int Status = XST_FAILURE;
 
 	/* Configure the SSS for AES. */
-#ifndef SDT
-	if (InstancePtr->PmcDmaPtr->Config.DeviceId == (u16)PMCDMA_0_DEVICE_ID) {
-#else
-	if (InstancePtr->PmcDmaPtr->Config.BaseAddress == PMCDMA_0_DEVICE_ID) {
-#endif
-		Status = XSecure_SssAes(&InstancePtr->SssInstance,
-				XSECURE_SSS_DMA0, XSECURE_SSS_DMA0);
-	}
-	else {
-		Status = XSecure_SssAes(&InstancePtr->SssInstance,
-				XSECURE_SSS_DMA1, XSECURE_SSS_DMA1);
-	}
+	Status = XSecure_AesSssCfg(InstancePtr);
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
@@ -2182,6 +2236,155 @@ static int XSecureAesUpdate(const XSecure_Aes *InstancePtr, u64 InDataAddr,
 
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function configures the secure stream switch for AES with
+ * 		the PMC DMA used by the AES instance
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	XST_FAILURE - On failure to configure switch
+ *
+ ******************************************************************************/
+static int XSecure_AesSssCfg(const XSecure_Aes *InstancePtr)
+{
+	int Status = XST_FAILURE;
+
+#ifndef SDT
+	if (InstancePtr->PmcDmaPtr->Config.DeviceId == (u16)PMCDMA_0_DEVICE_ID) {
+#else
+	if (InstancePtr->PmcDmaPtr->Config.BaseAddress == PMCDMA_0_DEVICE_ID) {
+#endif
+		Status = XSecure_SssAes(&InstancePtr->SssInstance,
+				XSECURE_SSS_DMA0, XSECURE_SSS_DMA0);
+	}
+	else {
+		Status = XSecure_SssAes(&InstancePtr->SssInstance,
+				XSECURE_SSS_DMA1, XSECURE_SSS_DMA1);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function pushes a list of segments through the AES engine
+ * 		back to back. The list is validated before any data is
+ * 		transferred and the secure stream switch and AES data swap are
+ * 		configured once for the whole list.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance
+ * @param	SgList		Pointer to the list of segments
+ * @param	SgCount		Number of segments in the list
+ * @param	IsLastList	TRUE if the last segment of the list is the last
+ * 				chunk of the data, FALSE otherwise
+ * @param	AesState	Expected AES state, encrypt or decrypt initialized
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	XSECURE_AES_INVALID_PARAM - On invalid parameter
+ *	-	XSECURE_AES_STATE_MISMATCH_ERROR - If State mismatch is occurred
+ *	-	XSECURE_AES_UNALIGNED_SIZE_ERROR - If a segment size is unaligned
+ *	-	XST_FAILURE - On failure
+ *
+ ******************************************************************************/
+static int XSecure_AesSgUpdate(XSecure_Aes *InstancePtr,
+	const XSecure_AesSgEntry *SgList, u32 SgCount, u8 IsLastList,
+	XSecure_AesState AesState)
+{
+	int Status = XST_FAILURE;
+	XSecure_AesDmaCfg AesDmaCfg = {0U, 0U, 0U, 0U, 0U, 0U};
+	u32 Index;
+	u8 IsLastChunk = FALSE;
+
+	/* Validate the input arguments */
+	if ((InstancePtr == NULL) || (SgList == NULL) || (SgCount == 0U)) {
+		Status = (int)XSECURE_AES_INVALID_PARAM;
+		goto END;
+	}
+
+	if ((IsLastList != TRUE) && (IsLastList != FALSE)) {
+		Status = (int)XSECURE_AES_INVALID_PARAM;
+		goto END_RST;
+	}
+
+	/* Validate the AES state */
+	if (InstancePtr->AesState != AesState) {
+		Status = (int)XSECURE_AES_STATE_MISMATCH_ERROR;
+		goto END_RST;
+	}
+
+	/* Only the last segment of the last list may be non qword aligned */
+	for (Index = 0U; Index < SgCount; Index++) {
+		if ((IsLastList == TRUE) && (Index == (SgCount - 1U))) {
+			IsLastChunk = TRUE;
+		}
+		Status = XSecure_AesValidateSize(SgList[Index].Size, IsLastChunk);
+		if (Status != XST_SUCCESS) {
+			goto END_RST;
+		}
+	}
+
+	/* Enable AES Data swap */
+	XSecure_WriteReg(InstancePtr->BaseAddress,
+			XSECURE_AES_DATA_SWAP_OFFSET, XSECURE_ENABLE_BYTE_SWAP);
+
+	Status = XSecure_AesSssCfg(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		goto END_RST;
+	}
+
+	AesDmaCfg.SrcChannelCfg = TRUE;
+	AesDmaCfg.DestChannelCfg = TRUE;
+	AesDmaCfg.IsLastChunkDest = FALSE;
+	IsLastChunk = FALSE;
+	for (Index = 0U; Index < SgCount; Index++) {
+		if ((IsLastList == TRUE) && (Index == (SgCount - 1U))) {
+			IsLastChunk = TRUE;
+		}
+		AesDmaCfg.SrcDataAddr = SgList[Index].SrcDataAddr;
+		AesDmaCfg.DestDataAddr = SgList[Index].DstDataAddr;
+		AesDmaCfg.IsLastChunkSrc = IsLastChunk;
+		Status = XSecure_AesPlatPmcDmaCfgAndXfer(InstancePtr->PmcDmaPtr,
+			&AesDmaCfg, SgList[Index].Size, InstancePtr->BaseAddress);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+	}
+
+	/* Clear endianness */
+	XSecure_AesPmcDmaCfgEndianness(InstancePtr->PmcDmaPtr,
+				XPMCDMA_SRC_CHANNEL, XSECURE_DISABLE_BYTE_SWAP);
+	XSecure_AesPmcDmaCfgEndianness(InstancePtr->PmcDmaPtr,
+				XPMCDMA_DST_CHANNEL, XSECURE_DISABLE_BYTE_SWAP);
+	if (Status != XST_SUCCESS) {
+		goto END_RST;
+	}
+
+	if ((XSecure_AesIsEcbModeEn(InstancePtr) == TRUE) && (IsLastList == TRUE)) {
+		/* Wait for AES Done for last chunk in ECB mode */
+		Status = XSecure_AesWaitForDone(InstancePtr);
+	}
+
+END_RST:
+	if (Status != XST_SUCCESS) {
+		/*
+		 * Issue a soft to reset to AES engine and
+		 * set the AES state back to initialization state
+		 */
+		InstancePtr->NextBlkLen = 0U;
+		InstancePtr->AesState = XSECURE_AES_INITIALIZED;
+		XSecure_SetReset(InstancePtr->BaseAddress,
+			XSECURE_AES_SOFT_RST_OFFSET);
+	}
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to set the Data context bit
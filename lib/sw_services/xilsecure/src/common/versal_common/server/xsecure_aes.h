@@ -44,6 +44,7 @@
 *       vss  07/14/2023 Added IsResourceBusy flag and IpiMask variable in Xsecure_Aes instance
 *       kpt  07/20/2023 Renamed XSecure_AesDpaCmDecryptKat to XSecure_AesDpaCmDecryptData
 *	vss  09/07/2023 Reverted the fix for NO_EFFECT coverity warning
+*       fl   10/14/2026 Added scatter gather encrypt and decrypt update APIs
 *
 * </pre>
 *
@@ -154,6 +155,12 @@ typedef enum {
 	XSECURE_AES_KEY_SIZE_256 = 2,	/**< Key Length = 16 bytes = 128 bits */
 }XSecure_AesKeySize;
 
+typedef struct {
+	u64 SrcDataAddr;	/**< Address of the input segment */
+	u64 DstDataAddr;	/**< Address of the output segment */
+	u32 Size;		/**< Size of the segment in bytes */
+} XSecure_AesSgEntry;
+
 /** @cond xsecure_internal
  * @{
  */
@@ -244,6 +251,12 @@ int XSecure_AesEncryptUpdate(XSecure_Aes *InstancePtr, u64 InDataAddr,
 	u64 OutDataAddr, u32 Size, u8 IsLastChunk);
 int XSecure_AesEncryptFinal(XSecure_Aes *InstancePtr, u64 GcmTagAddr);
 
+int XSecure_AesDecryptUpdateSg(XSecure_Aes *InstancePtr,
+	const XSecure_AesSgEntry *SgList, u32 SgCount, u8 IsLastList);
+
+int XSecure_AesEncryptUpdateSg(XSecure_Aes *InstancePtr,
+	const XSecure_AesSgEntry *SgList, u32 SgCount, u8 IsLastList);
+
 int XSecure_AesEncryptData(XSecure_Aes *InstancePtr, u64 InDataAddr,
 	u64 OutDataAddr, u32 Size, u64 GcmTagAddr);
 
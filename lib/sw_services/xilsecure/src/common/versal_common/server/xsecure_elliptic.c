@@ -55,6 +55,7 @@
 *                     XSecure_EllipticGetCrvSize functions
 *       yog  09/04/23 Restricted XSecure_ECCRandInit API support to VersalNet
 *	vss  09/11/2023 Fixed MISRA-C Rule 8.13 violation
+*       fl   10/14/2026 Added XSecure_EllipticVerifySignBatch_64Bit
 *
 * </pre>
 *
@@ -90,6 +91,10 @@
 EcdsaCrvInfo* XSecure_EllipticGetCrvData(XSecure_EllipticCrvTyp CrvTyp);
 static u32 XSecure_EllipticValidateAndGetCrvInfo(XSecure_EllipticCrvTyp CrvType,
 	EcdsaCrvInfo** Crv);
+static int XSecure_EllipticVerifySignItem(EcdsaCrvInfo *Crv, u32 Size,
+	u32 OffSet, const XSecure_EllipticHashData *HashInfo,
+	const XSecure_EllipticKeyAddr *KeyAddr,
+	const XSecure_EllipticSignAddr *SignAddr);
 
 /************************** Variable Definitions *****************************/
 
@@ -602,19 +607,7 @@ int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 	const XSecure_EllipticSignAddr *SignAddr)
 {
 	volatile int Status = (int)XSECURE_ELLIPTIC_NON_SUPPORTED_CRV;
-	volatile int VerifyStatus = XST_FAILURE;
-	volatile int VerifyStatusTmp = XST_FAILURE;
 	EcdsaCrvInfo *Crv = NULL;
-	u8 PaddedHash[XSECURE_ECC_P521_SIZE_IN_BYTES];
-	volatile u32 HashLenTmp = 0xFFFFFFFFU;
-	u8 PubKey[XSECURE_ECC_P521_SIZE_IN_BYTES +
-		XSECURE_ECDSA_P521_ALIGN_BYTES +
-		XSECURE_ECC_P521_SIZE_IN_BYTES];
-	u8 Signature[XSECURE_ECC_P521_SIZE_IN_BYTES +
-		XSECURE_ECDSA_P521_ALIGN_BYTES +
-		XSECURE_ECC_P521_SIZE_IN_BYTES];
-	EcdsaKey Key;
-	EcdsaSign Sign;
 	u32 OffSet = 0U;
 	u32 Size = 0U;
 
@@ -623,15 +616,85 @@ int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 		goto END;
 	}
 
-	HashLenTmp = HashInfo->Len;
-	if ((HashInfo->Len > XSECURE_ECC_P521_SIZE_IN_BYTES) ||
-		(HashLenTmp > XSECURE_ECC_P521_SIZE_IN_BYTES)) {
+	if ((HashInfo == NULL) || (KeyAddr == NULL) || (SignAddr == NULL)) {
 		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
 		goto END;
 	}
 
-	if ((HashInfo == NULL) || (KeyAddr == NULL) || (SignAddr == NULL)) {
+	OffSet = XSecure_EllipticValidateAndGetCrvInfo(CrvType, &Crv);
+	if ((OffSet == 0U) || (Crv == NULL)) {
+		Status = (int)XSECURE_ELLIPTIC_NON_SUPPORTED_CRV;
+		goto END;
+	}
+
+	Size = OffSet;
+	if (CrvType == XSECURE_ECC_NIST_P521) {
+		OffSet += XSECURE_ECDSA_P521_ALIGN_BYTES;
+	}
+
+	XSecure_ReleaseReset(XSECURE_ECDSA_RSA_BASEADDR,
+		XSECURE_ECDSA_RSA_RESET_OFFSET);
+
+	Status = XST_FAILURE;
+	Status = XSecure_EllipticVerifySignItem(Crv, Size, OffSet, HashInfo,
+			KeyAddr, SignAddr);
+
+END:
+	XSecure_SetReset(XSECURE_ECDSA_RSA_BASEADDR,
+		XSECURE_ECDSA_RSA_RESET_OFFSET);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function verifies a list of signatures on the same curve
+ *		where data is located at 64-bit address. The curve lookup,
+ *		crypto check and ECDSA core reset are done once for the list.
+ *
+ * @param	CrvType - Type of elliptic curve
+ * @param	VerifyList - Pointer to the list of hash, key and signature
+ *			addresses to be verified
+ * @param	Count - Number of entries in VerifyList
+ * @param	StatusList - Pointer to an array of Count entries which is
+ *			updated with the verification status of each entry
+ *
+ * @return
+ *	-	XST_SUCCESS - If all signatures are verified
+ *	-	XSECURE_ELLIPTIC_INVALID_PARAM - On invalid argument
+ *	-	XSECURE_ELLIPTIC_NON_SUPPORTED_CRV - On unsupported curve
+ *	-	Status of the first entry which failed verification
+ *	-	XST_FAILURE - If the number of verified entries does not match
+ *			Count
+ *
+ * @note	All entries are verified even if an earlier entry fails, entries
+ *		not verified due to an invalid argument are set to XST_FAILURE.
+ *		Success is only returned when the count of verified entries,
+ *		checked twice, equals Count.
+ *
+ *****************************************************************************/
+int XSecure_EllipticVerifySignBatch_64Bit(XSecure_EllipticCrvTyp CrvType,
+	const XSecure_EllipticVerifyItem *VerifyList, u32 Count, int *StatusList)
+{
+	volatile int Status = XST_FAILURE;
+	volatile int ItemStatus = XST_FAILURE;
+	volatile int FailStatus = XST_SUCCESS;
+	volatile u32 SuccessCnt = 0U;
+	EcdsaCrvInfo *Crv = NULL;
+	u32 OffSet = 0U;
+	u32 Size = 0U;
+	u32 Index;
+
+	if ((VerifyList == NULL) || (StatusList == NULL) || (Count == 0U)) {
 		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
+		goto RET;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		StatusList[Index] = XST_FAILURE;
+	}
+
+	Status = XSecure_CryptoCheck();
+	if (Status != XST_SUCCESS) {
 		goto END;
 	}
 
@@ -646,6 +709,89 @@ int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 		OffSet += XSECURE_ECDSA_P521_ALIGN_BYTES;
 	}
 
+	XSecure_ReleaseReset(XSECURE_ECDSA_RSA_BASEADDR,
+		XSECURE_ECDSA_RSA_RESET_OFFSET);
+
+	for (Index = 0U; Index < Count; Index++) {
+		ItemStatus = XST_FAILURE;
+		ItemStatus = XSecure_EllipticVerifySignItem(Crv, Size, OffSet,
+				&VerifyList[Index].HashInfo, &VerifyList[Index].KeyAddr,
+				&VerifyList[Index].SignAddr);
+		StatusList[Index] = ItemStatus;
+		if ((ItemStatus == XST_SUCCESS) &&
+			(StatusList[Index] == XST_SUCCESS)) {
+			SuccessCnt++;
+		}
+		else if (FailStatus == XST_SUCCESS) {
+			FailStatus = ItemStatus;
+		}
+		else {
+			/* Keep the status of the first failed entry */
+		}
+	}
+
+	Status = XST_FAILURE;
+	if ((SuccessCnt == Count) && (SuccessCnt == Count)) {
+		Status = XST_SUCCESS;
+	}
+	else if (FailStatus != XST_SUCCESS) {
+		Status = FailStatus;
+	}
+	else {
+		/* Counter mismatch without a failed entry, keep XST_FAILURE */
+	}
+
+END:
+	XSecure_SetReset(XSECURE_ECDSA_RSA_BASEADDR,
+		XSECURE_ECDSA_RSA_RESET_OFFSET);
+RET:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function verifies one signature with the ECDSA core taken
+ *		out of reset by the caller
+ *
+ * @param	Crv - Pointer to the curve information
+ * @param	Size - Size of the curve in bytes
+ * @param	OffSet - Offset of the second component in the local buffers
+ * @param	HashInfo - Pointer to Hash Data i.e. Hash Address and length
+ * @param	KeyAddr  - Pointer to public key address
+ * @param	SignAddr - Pointer to signature address
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	Error code as returned by XSecure_EllipticVerifySign_64Bit
+ *		otherwise
+ *
+ *****************************************************************************/
+static int XSecure_EllipticVerifySignItem(EcdsaCrvInfo *Crv, u32 Size,
+	u32 OffSet, const XSecure_EllipticHashData *HashInfo,
+	const XSecure_EllipticKeyAddr *KeyAddr,
+	const XSecure_EllipticSignAddr *SignAddr)
+{
+	volatile int Status = XST_FAILURE;
+	volatile int VerifyStatus = XST_FAILURE;
+	volatile int VerifyStatusTmp = XST_FAILURE;
+	u8 PaddedHash[XSECURE_ECC_P521_SIZE_IN_BYTES];
+	volatile u32 HashLenTmp = 0xFFFFFFFFU;
+	u8 PubKey[XSECURE_ECC_P521_SIZE_IN_BYTES +
+		XSECURE_ECDSA_P521_ALIGN_BYTES +
+		XSECURE_ECC_P521_SIZE_IN_BYTES];
+	u8 Signature[XSECURE_ECC_P521_SIZE_IN_BYTES +
+		XSECURE_ECDSA_P521_ALIGN_BYTES +
+		XSECURE_ECC_P521_SIZE_IN_BYTES];
+	EcdsaKey Key;
+	EcdsaSign Sign;
+
+	HashLenTmp = HashInfo->Len;
+	if ((HashInfo->Len > XSECURE_ECC_P521_SIZE_IN_BYTES) ||
+		(HashLenTmp > XSECURE_ECC_P521_SIZE_IN_BYTES)) {
+		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
+		goto END;
+	}
+
 	Status = XST_FAILURE;
 	Status = Xil_SMemSet(PaddedHash, XSECURE_ECC_P521_SIZE_IN_BYTES,
 				0U, XSECURE_ECC_P521_SIZE_IN_BYTES);
@@ -671,9 +817,6 @@ int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 	Sign.r = (u8 *)(UINTPTR)Signature;
 	Sign.s = (u8 *)(UINTPTR)(Signature + OffSet);
 
-	XSecure_ReleaseReset(XSECURE_ECDSA_RSA_BASEADDR,
-		XSECURE_ECDSA_RSA_RESET_OFFSET);
-
 	/** Verify signature with provided hash, key and curve type */
 	XSECURE_TEMPORAL_IMPL(VerifyStatus, VerifyStatusTmp, Ecdsa_VerifySign,
 		Crv, PaddedHash, Crv->Bits, (EcdsaKey *)&Key, (EcdsaSign *)&Sign);
@@ -711,8 +854,6 @@ int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 	}
 
 END:
-	XSecure_SetReset(XSECURE_ECDSA_RSA_BASEADDR,
-		XSECURE_ECDSA_RSA_RESET_OFFSET);
 	return Status;
 }
 
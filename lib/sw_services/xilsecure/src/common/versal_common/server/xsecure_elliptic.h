@@ -36,6 +36,7 @@
 *       mmd  07/09/23 Included header file for crypto algorithm information
 *       am   08/18/23 Added XSecure_EllipticGetCrvSize() prototype
 *	vss  09/11/2023 Fixed MISRA-C Rule 8.13 violation
+*       fl   10/14/2026 Added XSecure_EllipticVerifySignBatch_64Bit() prototype
 *
 * </pre>
 *
@@ -97,6 +98,12 @@ typedef struct {
 	u32 Len;		/**< Length of the hash */
 } XSecure_EllipticHashData;
 
+typedef struct {
+	XSecure_EllipticHashData HashInfo;	/**< Hash address and length */
+	XSecure_EllipticKeyAddr KeyAddr;	/**< Public key address */
+	XSecure_EllipticSignAddr SignAddr;	/**< Signature address */
+} XSecure_EllipticVerifyItem;
+
 /***************************** Function Prototypes ***************************/
 int XSecure_EllipticGenerateKey(XSecure_EllipticCrvTyp CrvType, const u8* D,
 	const XSecure_EllipticKey *Key);
@@ -118,6 +125,8 @@ int XSecure_EllipticValidateKey_64Bit(XSecure_EllipticCrvTyp CrvType,
 int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 	const XSecure_EllipticHashData *HashInfo, const XSecure_EllipticKeyAddr *KeyAddr,
 	const XSecure_EllipticSignAddr *SignAddr);
+int XSecure_EllipticVerifySignBatch_64Bit(XSecure_EllipticCrvTyp CrvType,
+	const XSecure_EllipticVerifyItem *VerifyList, u32 Count, int *StatusList);
 void XSecure_PutData(const u32 Size, u8 *Dst, const u64 SrcAddr);
 void XSecure_GetData(const u32 Size, const u8 *Src, const u64 DstAddr);
 void XSecure_FixEndiannessNCopy(const u32 Size, u64 DstAddr, const u64 SrcAddr);
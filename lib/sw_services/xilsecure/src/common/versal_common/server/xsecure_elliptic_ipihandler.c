@@ -26,6 +26,7 @@
 *      yog   08/07/2023 Removed trng init call in XSecure_EllipticIpiHandler API
 *                       since trng is being initialised in server API's
 *      am    08/17/2023 Replaced curve size check with XSecure_EllipticGetCrvSize() call
+*      fl    10/14/2026 Run ECDSA KATs on first use with XSecure_KatRunOnce
 *
 * </pre>
 *
@@ -48,6 +49,7 @@
 #include "xsecure_error.h"
 #include "xsecure_kat.h"
 #include "xsecure_init.h"
+#include "xsecure_kat_ipihandler.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -194,8 +196,8 @@ static int XSecure_EllipticGenSign(u32 SrcAddrLow, u32 SrcAddrHigh,
 	XSecure_EllipticSignGenParams EcdsaParams;
 	u32 Size = 0U;
 
-	if (XPlmi_IsKatRan(XPLMI_SECURE_ECC_SIGN_GEN_SHA3_384_KAT_MASK) != TRUE) {
-		Status = (int)XSECURE_ERR_KAT_NOT_EXECUTED;
+	Status = XSecure_KatRunOnce(XPLMI_SECURE_ECC_SIGN_GEN_SHA3_384_KAT_MASK);
+	if (Status != XST_SUCCESS) {
 		goto END;
 	}
 
@@ -285,8 +287,8 @@ static int XSecure_EllipticVerifySignature(u32 SrcAddrLow, u32 SrcAddrHigh)
 	XSecure_EllipticSignVerifyParams EcdsaParams;
 	u32 Size = 0U;
 
-	if (XPlmi_IsKatRan(XPLMI_SECURE_ECC_SIGN_VERIFY_SHA3_384_KAT_MASK) != TRUE) {
-		Status = (int)XSECURE_ERR_KAT_NOT_EXECUTED;
+	Status = XSecure_KatRunOnce(XPLMI_SECURE_ECC_SIGN_VERIFY_SHA3_384_KAT_MASK);
+	if (Status != XST_SUCCESS) {
 		goto END;
 	}
 
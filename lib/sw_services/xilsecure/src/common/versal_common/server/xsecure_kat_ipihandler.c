@@ -25,6 +25,7 @@
 * 5.2   ng   07/13/2023 Added SDT support
 *       yog  08/07/2023 Removed trng init call in XSecure_EllipticSignGenKat API
 *                       since trng is being initialised in server API's
+*       fl   10/14/2026 Added XSecure_KatRunOnce for KAT on first use
 * </pre>
 *
 * @note
@@ -126,6 +127,68 @@ int XSecure_KatIpiHandler(XPlmi_Cmd *Cmd)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief       This function checks that the KAT of an algorithm has passed
+ *		before the algorithm is used. With PLM_ENABLE_LAZY_KAT, a KAT
+ *		which has not run yet is run here and its result is kept in the
+ *		KAT status mask, so it is not run again until the mask is
+ *		cleared or a client requests the KAT.
+ *
+ * @param	KatMask		KAT mask of the algorithm
+ *
+ * @return
+ *	-	XST_SUCCESS - If the KAT has passed
+ *	-	XSECURE_ERR_KAT_NOT_EXECUTED - If the KAT has not run and can
+ *		not be run here
+ *	-	ErrorCode - If the KAT fails
+ *
+ * @note	AES KATs are not run here since they use and clear a user key
+ *		register which may hold the key of the request.
+ *
+ ******************************************************************************/
+int XSecure_KatRunOnce(u32 KatMask)
+{
+	volatile int Status = (int)XSECURE_ERR_KAT_NOT_EXECUTED;
+
+	if (XPlmi_IsKatRan(KatMask) == TRUE) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+#ifdef PLM_ENABLE_LAZY_KAT
+	switch (KatMask) {
+	case XPLMI_SECURE_SHA3_KAT_MASK:
+		Status = XSecure_ShaKat();
+		break;
+#ifndef PLM_SECURE_EXCLUDE
+#ifndef PLM_RSA_EXCLUDE
+	case XPLMI_SECURE_RSA_KAT_MASK:
+		Status = XSecure_RsaPubEncKat();
+		break;
+	case XPLMI_SECURE_RSA_PRIVATE_DEC_KAT_MASK:
+		Status = XSecure_RsaPrivateDecKat();
+		break;
+#endif
+#ifndef PLM_ECDSA_EXCLUDE
+	case XPLMI_SECURE_ECC_SIGN_VERIFY_SHA3_384_KAT_MASK:
+		Status = XSecure_EllipticSignVerifyKat(XSECURE_ECC_PRIME);
+		break;
+	case XPLMI_SECURE_ECC_SIGN_GEN_SHA3_384_KAT_MASK:
+		Status = XSecure_EllipticSignGenKat(XSECURE_ECC_PRIME);
+		break;
+#endif
+#endif
+	default:
+		Status = (int)XSECURE_ERR_KAT_NOT_EXECUTED;
+		break;
+	}
+#endif
+
+END:
+	return Status;
+}
+
 #ifndef PLM_SECURE_EXCLUDE
 
 /*****************************************************************************/
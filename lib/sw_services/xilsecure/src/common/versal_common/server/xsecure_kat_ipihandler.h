@@ -20,6 +20,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.0   kpt  07/15/22 Initial release
 * 1.01  ng   05/10/23 Removed XSecure_PerformKatOperation
+*       fl   10/14/26 Added XSecure_KatRunOnce
 *
 * </pre>
 *
@@ -45,6 +46,7 @@ extern "C" {
 
 /************************** Function Prototypes ******************************/
 int XSecure_KatIpiHandler(XPlmi_Cmd *Cmd);
+int XSecure_KatRunOnce(u32 KatMask);
 
 #ifdef __cplusplus
 }
@@ -23,6 +23,7 @@
 * 5.0  kpt   07/24/22 Moved XSecure_RsaKat into xsecure_kat_plat_ipihanlder.c
 *      dc    08/22/22 Fixed RSA key accesses address based on RSA key size
 * 5.1  yog   05/03/23 Fixed MISRA C violation of Rule 10.3
+* 5.2  fl    10/14/26 Run RSA KATs on first use with XSecure_KatRunOnce
 *
 * </pre>
 *
@@ -40,6 +41,7 @@
 #include "xsecure_rsa.h"
 #include "xsecure_rsa_ipihandler.h"
 #include "xsecure_init.h"
+#include "xsecure_kat_ipihandler.h"
 #include "xplmi.h"
 #include "xsecure_error.h"
 
@@ -123,8 +125,8 @@ static int XSecure_RsaDecrypt(u32 SrcAddrLow, u32 SrcAddrHigh,
 	XSecure_RsaInParam RsaParams;
 	XSecure_Rsa *XSecureRsaInstPtr = XSecure_GetRsaInstance();
 
-	if (XPlmi_IsKatRan(XPLMI_SECURE_RSA_PRIVATE_DEC_KAT_MASK) != TRUE) {
-		Status = (int)XSECURE_ERR_KAT_NOT_EXECUTED;
+	Status = XSecure_KatRunOnce(XPLMI_SECURE_RSA_PRIVATE_DEC_KAT_MASK);
+	if (Status != XST_SUCCESS) {
 		goto END;
 	}
 
@@ -178,8 +180,8 @@ static int XSecure_RsaEncrypt(u32 SrcAddrLow, u32 SrcAddrHigh,
 	XSecure_RsaInParam RsaParams;
 	XSecure_Rsa *XSecureRsaInstPtr = XSecure_GetRsaInstance();
 
-	if (XPlmi_IsKatRan(XPLMI_SECURE_RSA_KAT_MASK) != TRUE) {
-		Status = (int)XSECURE_ERR_KAT_NOT_EXECUTED;
+	Status = XSecure_KatRunOnce(XPLMI_SECURE_RSA_KAT_MASK);
+	if (Status != XST_SUCCESS) {
 		goto END;
 	}
 
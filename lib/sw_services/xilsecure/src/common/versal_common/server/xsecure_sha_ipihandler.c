@@ -31,6 +31,7 @@
 * 5.2   ng    07/13/2023 Added SDT support
 *	vss  09/11/2023 Fixed MISRA-C Rule 8.13 violation
 *	vss  09/11/2023 Fixed MISRA-C Rule 10.3 and 10.4 violation
+*       fl   10/14/2026 Run SHA3 KAT on first use with XSecure_KatRunOnce
 *
 * </pre>
 *
@@ -45,6 +46,7 @@
 #include "xsecure_sha.h"
 #include "xsecure_sha_ipihandler.h"
 #include "xsecure_init.h"
+#include "xsecure_kat_ipihandler.h"
 #include "xsecure_error.h"
 #include "xplmi_hw.h"
 #include "xplmi.h"
@@ -124,8 +126,8 @@ static int XSecure_ShaInitialize(void)
 		goto END;
 	}
 
-	if (XPlmi_IsKatRan(XPLMI_SECURE_SHA3_KAT_MASK) != TRUE) {
-		Status = (int)XSECURE_ERR_KAT_NOT_EXECUTED;
+	Status = XSecure_KatRunOnce(XPLMI_SECURE_SHA3_KAT_MASK);
+	if (Status != XST_SUCCESS) {
 		goto END;
 	}
 
@@ -234,8 +236,8 @@ static int XSecure_ShaOperation(const XPlmi_Cmd *Cmd)
 		if (NULL == PmcDmaInstPtr) {
 			goto END;
 		}
-		if (XPlmi_IsKatRan(XPLMI_SECURE_SHA3_KAT_MASK) != TRUE) {
-			Status = XSECURE_ERR_KAT_NOT_EXECUTED;
+		Status = XSecure_KatRunOnce(XPLMI_SECURE_SHA3_KAT_MASK);
+		if (Status != XST_SUCCESS) {
 			goto END;
 		}
 		/* Initializes a XSecure_Sha3 structure for operating the SHA3 engine */
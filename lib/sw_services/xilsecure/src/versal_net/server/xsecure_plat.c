@@ -21,6 +21,7 @@
 *       kpt     07/09/23 Added XSecure_GetRandomNum function
 *       yog     08/07/23 Moved functions from xsecure_trng.c to xsecure_plat.c
 *       kpt     08/29/23 Added volatile keyword to avoid compiler optimization
+*       fl      10/14/26 Added TRNG pool support under PLM_ENABLE_TRNG_POOL
 *
 * </pre>
 *
@@ -32,6 +33,8 @@
 #include "xsecure_sha.h"
 #include "xsecure_plat_kat.h"
 #include "xplmi.h"
+#include "xplmi_task.h"
+#include "xil_util.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -39,6 +42,11 @@
 #define XSECURE_SHA_ADDRESS			  (0xF1210000U) /**< SHA BaseAddress */
 #define XSECURE_RSA_ECDSA_RSA_ADDRESS (0xF1200000U) /**< RSA ECDSA BaseAddress */
 
+#ifdef PLM_ENABLE_TRNG_POOL
+#define XSECURE_TRNG_POOL_LEN	(8U * XTRNGPSX_SEC_STRENGTH_IN_BYTES)
+					/**< Size of the TRNG pool in bytes */
+#endif
+
 /************************** Variable Definitions *****************************/
 
 /* XSecure_SssLookupTable[Input source][Resource] */
@@ -76,7 +84,17 @@ const XSecure_Sha3Config Sha3ConfigTable[XSECURE_SHA3_NUM_OF_INSTANCES] =
 	}
 };
 
+#ifdef PLM_ENABLE_TRNG_POOL
+static u8 XSecure_TrngPool[XSECURE_TRNG_POOL_LEN]; /**< Pre generated random bytes */
+static u32 XSecure_TrngPoolCount = 0U; /**< Number of valid bytes in the pool */
+static XPlmi_TaskNode *XSecure_TrngPoolTask = NULL; /**< Task refilling the pool */
+#endif
+
 /************************** Function Prototypes ******************************/
+#ifdef PLM_ENABLE_TRNG_POOL
+static int XSecure_TrngPoolRefill(void *Arg);
+static int XSecure_TrngPoolGet(u8 *Output, u32 Size);
+#endif
 
 static void XSecure_UpdateEcdsaCryptoStatus(u32 Op);
 static int XSecure_AesPmcDmaByteXfer(XPmcDma *PmcDmaPtr,
@@ -581,6 +599,15 @@ int XSecure_GetRandomNum(u8 *Output, u32 Size)
 		}
 	}
 
+#ifdef PLM_ENABLE_TRNG_POOL
+	/* Serve the request from the pool when it holds enough bytes */
+	Status = XST_FAILURE;
+	Status = XSecure_TrngPoolGet(Output, Size);
+	if (Status == XST_SUCCESS) {
+		goto END;
+	}
+#endif
+
 	for (Index = 0U; Index < NoOfGenerates; Index++) {
 		if (Index == (NoOfGenerates - 1U)) {
 			RandBufSize = TotalSize;
@@ -596,6 +623,103 @@ END:
 	return Status;
 }
 
+#ifdef PLM_ENABLE_TRNG_POOL
+/*****************************************************************************/
+/**
+ * @brief	This function copies random bytes from the TRNG pool and
+ *		triggers the refill task
+ *
+ * @param Output is pointer to the output buffer
+ * @param Size is the number of random bytes to be read
+ *
+ * @return
+ *	-	XST_SUCCESS - If the bytes are served from the pool
+ *	-	XST_FAILURE - If the pool does not hold Size bytes or on failure
+ *
+ * @note	Bytes served from the pool are zeroized so that they are never
+ *		handed out twice
+ *
+ *****************************************************************************/
+static int XSecure_TrngPoolGet(u8 *Output, u32 Size)
+{
+	volatile int Status = XST_FAILURE;
+	u32 Offset;
+
+	if (XSecure_TrngPoolTask == NULL) {
+		XSecure_TrngPoolTask = XPlmi_TaskCreate(XPLM_TASK_PRIORITY_1,
+				XSecure_TrngPoolRefill, NULL);
+		if (XSecure_TrngPoolTask == NULL) {
+			goto END;
+		}
+		XSecure_TrngPoolTask->IntrId = XPLMI_INVALID_INTR_ID;
+	}
+
+	if (Size <= XSecure_TrngPoolCount) {
+		Offset = XSecure_TrngPoolCount - Size;
+		Status = Xil_SMemCpy(Output, Size, &XSecure_TrngPool[Offset], Size,
+				Size);
+		if (Status != XST_SUCCESS) {
+			goto TRIGGER;
+		}
+		XSecure_TrngPoolCount = Offset;
+		Status = XST_FAILURE;
+		Status = Xil_SMemSet(&XSecure_TrngPool[Offset], Size, 0U, Size);
+	}
+
+TRIGGER:
+	XPlmi_TaskTriggerNow(XSecure_TrngPoolTask);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This task generates one block of random bytes into the TRNG pool
+ *		and re-triggers itself till the pool is full. The TRNG health
+ *		tests and reseeding are done by the HRNG mode as for any other
+ *		generate request.
+ *
+ * @param Arg is not used
+ *
+ * @return
+ *	-	XST_SUCCESS always, a failed generate leaves the pool as is
+ *
+ *****************************************************************************/
+static int XSecure_TrngPoolRefill(void *Arg)
+{
+	volatile int Status = XST_FAILURE;
+	XTrngpsx_Instance *TrngInstance = XSecure_GetTrngInstance();
+
+	(void)Arg;
+
+	/* Fill only in HRNG mode, KAT and DRBG users own the TRNG otherwise */
+	if ((TrngInstance->UserCfg.Mode != XTRNGPSX_HRNG_MODE) ||
+		(TrngInstance->State == XTRNGPSX_UNINITIALIZED_STATE) ||
+		(TrngInstance->ErrorState != XTRNGPSX_HEALTHY)) {
+		goto END;
+	}
+
+	if ((XSecure_TrngPoolCount + XTRNGPSX_SEC_STRENGTH_IN_BYTES) >
+		XSECURE_TRNG_POOL_LEN) {
+		goto END;
+	}
+
+	XSECURE_TEMPORAL_CHECK(END, Status, XTrngpsx_Generate, TrngInstance,
+		&XSecure_TrngPool[XSecure_TrngPoolCount],
+		XTRNGPSX_SEC_STRENGTH_IN_BYTES, FALSE);
+	XSecure_TrngPoolCount += XTRNGPSX_SEC_STRENGTH_IN_BYTES;
+
+	if ((XSecure_TrngPoolCount + XTRNGPSX_SEC_STRENGTH_IN_BYTES) <=
+		XSECURE_TRNG_POOL_LEN) {
+		XPlmi_TaskTriggerNow(XSecure_TrngPoolTask);
+	}
+
+END:
+	return XST_SUCCESS;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief	This function initializes the trng in HRNG mode if it is not initialized
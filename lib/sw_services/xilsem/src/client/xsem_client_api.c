@@ -48,6 +48,7 @@
 * 2.1	hv   08/15/2022   Updated APIs to read status of all SLRs seperately
 *						  in case of broadcast
 * 2.2	rama 08/28/2022   Updated CRAM & NPI status bit information
+* 2.3   fl   10/14/26     Added scan budget APIs
 * </pre>
 *
 * @note
@@ -1265,6 +1266,324 @@ void XSem_CmdCfrGetTotalFrames(u32 RowIndex, u32 *FrameCntPtr)
 	FrameCntPtr[6] = (Buf[5] & CFRAME_BIT_40_59_MASK) >> \
 									CFRAME_BIT_40_59_SHIFT_R;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function starts the scans of the scan budget.
+ *
+ * @param[in]	IpiInst		Pointer to IPI driver instance
+ * @param[in]	Budget		Pointer to the scan budget
+ *
+ * @return	This API returns the success or failure.
+ *		- XST_FAILURE: On CRAM or NPI start scan failure
+ *		- XST_SUCCESS: On start scan success
+ *****************************************************************************/
+static XStatus XSem_ScanBudgetStart(XIpiPsu *IpiInst, XSemScanBudget *Budget)
+{
+	XStatus Status = XST_SUCCESS;
+	XSemIpiResp Resp = {0U};
+
+	if ((Budget->Modules & XSEM_SCAN_BUDGET_CRAM) != 0U) {
+		Status = XSem_CmdCfrStartScan(IpiInst, &Resp);
+		if (XST_SUCCESS != Status) {
+			goto END;
+		}
+	}
+	if ((Budget->Modules & XSEM_SCAN_BUDGET_NPI) != 0U) {
+		Status = XSem_CmdNpiStartScan(IpiInst, &Resp);
+		if (XST_SUCCESS != Status) {
+			goto END;
+		}
+	}
+	Budget->Running = 1U;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stops the scans of the scan budget.
+ *
+ * @param[in]	IpiInst		Pointer to IPI driver instance
+ * @param[in]	Budget		Pointer to the scan budget
+ *
+ * @return	This API returns the success or failure.
+ *		- XST_FAILURE: On CRAM or NPI stop scan failure
+ *		- XST_SUCCESS: On stop scan success
+ *****************************************************************************/
+static XStatus XSem_ScanBudgetStop(XIpiPsu *IpiInst, XSemScanBudget *Budget)
+{
+	XStatus Status = XST_SUCCESS;
+	XSemIpiResp Resp = {0U};
+
+	if (((Budget->Modules & XSEM_SCAN_BUDGET_CRAM) != 0U) &&
+		((Xil_In32(PMC_RAM_SEM_CRAM_STATUS) &
+		XSEM_CRAM_STATUS_OBSERVATION_MASK) != 0U)) {
+		Status = XSem_CmdCfrStopScan(IpiInst, &Resp);
+		if (XST_SUCCESS != Status) {
+			goto END;
+		}
+	}
+	if (((Budget->Modules & XSEM_SCAN_BUDGET_NPI) != 0U) &&
+		((Xil_In32(PMC_RAM_SEM_NPI_STATUS) &
+		XSEM_NPI_STATUS_SCHEDULED_MASK) != 0U)) {
+		Status = XSem_CmdNpiStopScan(IpiInst, &Resp);
+		if (XST_SUCCESS != Status) {
+			goto END;
+		}
+	}
+	Budget->Running = 0U;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is used to run CRAM and/or NPI scan within a CPU
+ *		budget. The scans are started here and then run for OnTicks and
+ *		stop for OffTicks calls of XSem_ScanBudgetTick, so the scan share
+ *		of the PLM is OnTicks / (OnTicks + OffTicks).
+ *
+ * @param[in]	IpiInst		Pointer to IPI driver instance
+ * @param[out]	Budget		Pointer to the scan budget to initialize
+ * @param[in]	Modules		XSEM_SCAN_BUDGET_CRAM and/or XSEM_SCAN_BUDGET_NPI
+ * @param[in]	OnTicks		Ticks with the scans running, at least 1
+ * @param[in]	OffTicks	Ticks with the scans stopped. With 0 the scans
+ *				are never stopped and only the progress is tracked
+ *
+ * @return	This API returns the success or failure.
+ *		- XST_FAILURE: On invalid arguments or start scan failure
+ *		- XST_SUCCESS: On scan budget initialization success
+ *
+ * @note	CRAM scan must be initialized before it is added to a budget.
+ *		The application calls XSem_ScanBudgetTick from its periodic
+ *		timer, not from the interrupt context as it sends IPI requests.
+ *****************************************************************************/
+XStatus XSem_ScanBudgetInit(XIpiPsu *IpiInst, XSemScanBudget *Budget,
+		u32 Modules, u32 OnTicks, u32 OffTicks)
+{
+	XStatus Status = XST_FAILURE;
+
+	if ((NULL == IpiInst) || (NULL == Budget)) {
+		XSem_Dbg("[%s] ERROR: NULL argument\n\r", __func__);
+		goto END;
+	}
+	if ((0U == OnTicks) || (0U == Modules) ||
+		((Modules & ~(XSEM_SCAN_BUDGET_CRAM | XSEM_SCAN_BUDGET_NPI)) != 0U)) {
+		XSem_Dbg("[%s] ERROR: Invalid budget\n\r", __func__);
+		goto END;
+	}
+
+	Budget->Modules = Modules;
+	Budget->OnTicks = OnTicks;
+	Budget->OffTicks = OffTicks;
+	Budget->TickCnt = 0U;
+	Budget->Running = 0U;
+	Budget->PauseCnt = 0U;
+	Budget->TotalTicks = 0U;
+	Budget->ScanTicks = 0U;
+	Budget->BaseScanCnt = Xil_In32(PMC_RAM_SEM_NPI_SCAN_CNT);
+	Budget->LastScanCnt = Budget->BaseScanCnt;
+	Budget->LastScanHbCnt = Xil_In32(PMC_RAM_SEM_NPI_HEARTBEAT_CNT);
+	Budget->HbPerScan = 0U;
+
+	Status = XSem_ScanBudgetStart(IpiInst, Budget);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is used to advance the scan budget by one tick.
+ *		It stops the scans after OnTicks ticks, starts them again after
+ *		OffTicks ticks and updates the progress counters. Nothing is
+ *		started while the budget is paused.
+ *
+ * @param[in]	IpiInst		Pointer to IPI driver instance
+ * @param[in]	Budget		Pointer to the scan budget
+ *
+ * @return	This API returns the success or failure.
+ *		- XST_FAILURE: On NULL argument or start/stop scan failure
+ *		- XST_SUCCESS: On success
+ *****************************************************************************/
+XStatus XSem_ScanBudgetTick(XIpiPsu *IpiInst, XSemScanBudget *Budget)
+{
+	XStatus Status = XST_FAILURE;
+	u32 ScanCnt;
+	u32 HbCnt;
+
+	if ((NULL == IpiInst) || (NULL == Budget)) {
+		XSem_Dbg("[%s] ERROR: NULL argument\n\r", __func__);
+		goto END;
+	}
+
+	/* Learn the heartbeats of a full NPI scan from the scan count */
+	ScanCnt = Xil_In32(PMC_RAM_SEM_NPI_SCAN_CNT);
+	if (ScanCnt != Budget->LastScanCnt) {
+		HbCnt = Xil_In32(PMC_RAM_SEM_NPI_HEARTBEAT_CNT);
+		Budget->HbPerScan = (HbCnt - Budget->LastScanHbCnt) /
+				(ScanCnt - Budget->LastScanCnt);
+		Budget->LastScanCnt = ScanCnt;
+		Budget->LastScanHbCnt = HbCnt;
+	}
+
+	Status = XST_SUCCESS;
+	if (Budget->PauseCnt != 0U) {
+		goto END;
+	}
+
+	Budget->TotalTicks++;
+	if (Budget->Running != 0U) {
+		Budget->ScanTicks++;
+	}
+	if (0U == Budget->OffTicks) {
+		goto END;
+	}
+
+	Budget->TickCnt++;
+	if ((Budget->Running != 0U) && (Budget->TickCnt >= Budget->OnTicks)) {
+		Budget->TickCnt = 0U;
+		Status = XSem_ScanBudgetStop(IpiInst, Budget);
+	} else if ((0U == Budget->Running) &&
+			(Budget->TickCnt >= Budget->OffTicks)) {
+		Budget->TickCnt = 0U;
+		Status = XSem_ScanBudgetStart(IpiInst, Budget);
+	} else {
+		/* Stay in the current phase */
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is used to pause the scans of a scan budget, e.g.
+ *		around a partial PDI load, so the scans do not see the frames
+ *		being written. Pauses nest, the scans are resumed by the last
+ *		XSem_ScanBudgetResume.
+ *
+ * @param[in]	IpiInst		Pointer to IPI driver instance
+ * @param[in]	Budget		Pointer to the scan budget
+ *
+ * @return	This API returns the success or failure.
+ *		- XST_FAILURE: On NULL argument or stop scan failure
+ *		- XST_SUCCESS: On success
+ *****************************************************************************/
+XStatus XSem_ScanBudgetPause(XIpiPsu *IpiInst, XSemScanBudget *Budget)
+{
+	XStatus Status = XST_FAILURE;
+
+	if ((NULL == IpiInst) || (NULL == Budget)) {
+		XSem_Dbg("[%s] ERROR: NULL argument\n\r", __func__);
+		goto END;
+	}
+
+	Status = XST_SUCCESS;
+	Budget->PauseCnt++;
+	if ((1U == Budget->PauseCnt) && (Budget->Running != 0U)) {
+		Status = XSem_ScanBudgetStop(IpiInst, Budget);
+		/* Resume restarts the scans in a fresh on phase */
+		Budget->TickCnt = 0U;
+		Budget->Running = 1U;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is used to resume the scans of a paused scan
+ *		budget. The scans are started again if they were running when
+ *		the budget was paused.
+ *
+ * @param[in]	IpiInst		Pointer to IPI driver instance
+ * @param[in]	Budget		Pointer to the scan budget
+ *
+ * @return	This API returns the success or failure.
+ *		- XST_FAILURE: On NULL argument, budget not paused or start scan
+ *		failure
+ *		- XST_SUCCESS: On success
+ *****************************************************************************/
+XStatus XSem_ScanBudgetResume(XIpiPsu *IpiInst, XSemScanBudget *Budget)
+{
+	XStatus Status = XST_FAILURE;
+
+	if ((NULL == IpiInst) || (NULL == Budget)) {
+		XSem_Dbg("[%s] ERROR: NULL argument\n\r", __func__);
+		goto END;
+	}
+	if (0U == Budget->PauseCnt) {
+		XSem_Dbg("[%s] ERROR: Budget is not paused\n\r", __func__);
+		goto END;
+	}
+
+	Status = XST_SUCCESS;
+	Budget->PauseCnt--;
+	if ((0U == Budget->PauseCnt) && (Budget->Running != 0U)) {
+		Status = XSem_ScanBudgetStart(IpiInst, Budget);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is used to read the progress and coverage
+ *		counters of a scan budget.
+ *
+ * @param[in]	Budget		Pointer to the scan budget
+ * @param[out]	Progress	Pointer to the progress structure
+ *
+ * @return	This API returns the success or failure.
+ *		- XST_FAILURE: On NULL argument
+ *		- XST_SUCCESS: On successful read
+ *
+ * @note	NpiScanProgress is estimated from the heartbeat count of the
+ *		last full NPI scan seen by XSem_ScanBudgetTick.
+ *****************************************************************************/
+XStatus XSem_ScanBudgetGetProgress(const XSemScanBudget *Budget,
+		XSemScanProgress *Progress)
+{
+	XStatus Status = XST_FAILURE;
+	u32 HbCnt;
+
+	if ((NULL == Budget) || (NULL == Progress)) {
+		XSem_Dbg("[%s] ERROR: NULL argument\n\r", __func__);
+		goto END;
+	}
+
+	Progress->NpiScanCnt = Xil_In32(PMC_RAM_SEM_NPI_SCAN_CNT) -
+			Budget->BaseScanCnt;
+	Progress->NpiScanProgress = 0U;
+	if (Budget->HbPerScan != 0U) {
+		HbCnt = Xil_In32(PMC_RAM_SEM_NPI_HEARTBEAT_CNT) -
+				Budget->LastScanHbCnt;
+		if (HbCnt >= Budget->HbPerScan) {
+			Progress->NpiScanProgress = 99U;
+		} else {
+			Progress->NpiScanProgress = (HbCnt * 100U) /
+					Budget->HbPerScan;
+		}
+	}
+	Progress->ScanTicks = Budget->ScanTicks;
+	Progress->TotalTicks = Budget->TotalTicks;
+	Progress->DutyCycle = 100U;
+	if (Budget->TotalTicks != 0U) {
+		Progress->DutyCycle = (u32)(((u64)Budget->ScanTicks * 100U) /
+				Budget->TotalTicks);
+	}
+	Progress->CramCorCnt = Xil_In32(PMC_RAM_SEM_CRAM_COR_BITCNT);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
 /** @} */
 #else
 /****************************************************************************/
@@ -48,6 +48,7 @@
 * 2.4	hv   02/14/2023   Removed XSEM_SSIT_MAX_SLR_CNT macro as this is
 *                         available in xparameters.h
 * 2.5   rama 08/03/2023   Added support for system device-tree flow
+* 2.6   fl   10/14/26     Added scan budget structures and APIs
 * </pre>
 *
 * @note
@@ -178,6 +179,17 @@ extern "C" {
 /** Total number of possible descriptors in NPI scan */
 #define NPI_MAX_DESCRIPTORS	(50U)
 
+/* Scan budget modules */
+/** Scan budget controls CRAM scan */
+#define XSEM_SCAN_BUDGET_CRAM		(0x1U)
+/** Scan budget controls NPI scan */
+#define XSEM_SCAN_BUDGET_NPI		(0x2U)
+
+/** CRAM scan is in the observation state */
+#define XSEM_CRAM_STATUS_OBSERVATION_MASK	(0x00000004U)
+/** NPI scan task is added to PLM Scheduler */
+#define XSEM_NPI_STATUS_SCHEDULED_MASK		(0x00000800U)
+
 /** Base address for CFRAME Registers  */
 #define CFRAME_BASE_ADDRESS				(0xF12D0000U)
 
@@ -465,6 +477,40 @@ typedef struct {
 } XSem_Notifier;
 
 #ifndef XILSEM_ENABLE_SSIT
+/**
+ * XSemScanBudget - Scan budget structure. It holds the on/off ratio of the
+ * scans, counted in calls to XSem_ScanBudgetTick, and the counters used to
+ * report the scan progress. Its members are private to the scan budget APIs.
+ */
+typedef struct {
+	u32 Modules; /**< XSEM_SCAN_BUDGET_CRAM and/or XSEM_SCAN_BUDGET_NPI */
+	u32 OnTicks; /**< Ticks with the scans running */
+	u32 OffTicks; /**< Ticks with the scans stopped, 0 to never stop */
+	u32 TickCnt; /**< Ticks spent in the current phase */
+	u32 Running; /**< Scans are running */
+	u32 PauseCnt; /**< Nesting count of XSem_ScanBudgetPause */
+	u32 TotalTicks; /**< Ticks since XSem_ScanBudgetInit */
+	u32 ScanTicks; /**< Ticks with the scans running */
+	u32 BaseScanCnt; /**< NPI scan count at XSem_ScanBudgetInit */
+	u32 LastScanCnt; /**< NPI scan count at the last tick */
+	u32 LastScanHbCnt; /**< NPI heartbeat count at the last full scan */
+	u32 HbPerScan; /**< NPI heartbeats of one full scan, 0 if unknown */
+} XSemScanBudget;
+
+/**
+ * XSemScanProgress - Scan progress structure filled by
+ * XSem_ScanBudgetGetProgress
+ */
+typedef struct {
+	u32 NpiScanCnt; /**< Full NPI scans since XSem_ScanBudgetInit */
+	u32 NpiScanProgress; /**< Percent of the current NPI scan done, 0 until
+	one full scan was seen */
+	u32 ScanTicks; /**< Ticks with the scans running */
+	u32 TotalTicks; /**< Ticks since XSem_ScanBudgetInit */
+	u32 DutyCycle; /**< Percent of the ticks with the scans running */
+	u32 CramCorCnt; /**< Count of CRAM correctable errors */
+} XSemScanProgress;
+
 /* CRAM functions */
 XStatus XSem_CmdCfrInit(XIpiPsu *IpiInst, XSemIpiResp *Resp);
 XStatus XSem_CmdCfrStartScan(XIpiPsu *IpiInst, XSemIpiResp *Resp);
@@ -485,6 +531,15 @@ XStatus XSem_CmdNpiGetGldnSha(XIpiPsu *IpiInst, XSemIpiResp * Resp,
 		XSem_DescriptorData * DescData);
 XStatus XSem_CmdNpiGetStatus(XSemNpiStatus *NpiStatusInfo);
 XStatus XSem_CmdGetConfig(XIpiPsu *IpiInst, XSemIpiResp *Resp);
+
+/* Scan budget functions */
+XStatus XSem_ScanBudgetInit(XIpiPsu *IpiInst, XSemScanBudget *Budget,
+		u32 Modules, u32 OnTicks, u32 OffTicks);
+XStatus XSem_ScanBudgetTick(XIpiPsu *IpiInst, XSemScanBudget *Budget);
+XStatus XSem_ScanBudgetPause(XIpiPsu *IpiInst, XSemScanBudget *Budget);
+XStatus XSem_ScanBudgetResume(XIpiPsu *IpiInst, XSemScanBudget *Budget);
+XStatus XSem_ScanBudgetGetProgress(const XSemScanBudget *Budget,
+		XSemScanProgress *Progress);
 #else
 
 /**
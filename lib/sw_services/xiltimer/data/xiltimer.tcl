@@ -217,6 +217,9 @@ proc generate {lib_handle} {
 	if {$interval_timer_is_default != 0} {
 		puts $fd "\#define XTIMER_NO_TICK_TIMER"
 	}
+	if {[common::get_property CONFIG.en_profiling $lib_handle] == true} {
+		puts $fd "\#define XTIMER_PROFILING"
+	}
 	puts $fd ""
 	puts $fd "\#endif /* XTIMER_CONFIG_H */"
 	close $fd
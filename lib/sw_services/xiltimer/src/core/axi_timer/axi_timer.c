@@ -21,6 +21,7 @@
  *  1.0  adk   24/11/21 Initial release.
  *  	 adk   07/02/22 Updated the IntrHandler as per XTimer_SetHandler() API.
  *  1.1	 adk   08/08/22 Added doxygen tags.
+ *  1.3  fl    14/10/26 Added XTime_GetTimeFreq().
  *</pre>
  *
  *@note
@@ -339,5 +340,22 @@ void XTime_GetTime(XTime *Xtime_Global)
 
 	*Xtime_Global = XTmrCtr_GetValue(AxiTimerInstPtr, 0);
 }
+
+/****************************************************************************/
+/**
+ * Get the frequency of the counter read by XTime_GetTime().
+ *
+ * @return	Counter frequency in Hz.
+ *
+ ****************************************************************************/
+u32 XTime_GetTimeFreq(void)
+{
+	XTime Time;
+
+	/* Makes sure the sleep timer instance is initialized */
+	XTime_GetTime(&Time);
+
+	return TimerInst.AxiTimer_SleepInst.Config.SysClockFreqHz;
+}
 #endif
 /*@}*/
@@ -23,6 +23,7 @@
 *  	adk	 12/01/22 Fix compilation errors.
 *  1.1	adk      08/08/22 Added support for versal net.
 *  	adk      08/08/22 Added doxygen tags.
+*  1.3  fl       14/10/26 Added XTime_GetTimeFreq().
  *</pre>
  *
  *@note
@@ -190,6 +191,25 @@ void XTime_GetTime(XTime *Xtime_Global) {
 	*Xtime_Global = Xpm_ReadCycleCounterVal();
 #endif
 }
+
+/****************************************************************************/
+/**
+ * Get the frequency of the counter read by XTime_GetTime().
+ *
+ * @return	Counter frequency in Hz.
+ *
+ ****************************************************************************/
+u32 XTime_GetTimeFreq(void)
+{
+#if defined (ARMR52)
+	return XIOU_SCNTRS_FREQ;
+#elif !defined (SDT)
+	/* Boot code sets the PMCR "D" bit, the counter runs at CPU clock/64 */
+	return XPAR_CPU_CORTEXR5_0_CPU_CLK_FREQ_HZ / 64U;
+#else
+	return XGet_CpuFreq() / 64U;
+#endif
+}
 #endif
 
 #ifdef XTIMER_NO_TICK_TIMER
@@ -23,6 +23,7 @@
  *  	 adk  25/03/22 Fix compilation errors for a72 processor.
  * 1.1	 adk  08/08/22 Added support for versal net.
  *  	 adk  08/08/22 Added doxygen tags.
+ * 1.3   fl   14/10/26 Added XTime_GetTimeFreq().
  *</pre>
  *
  *@note
@@ -174,6 +175,28 @@ void XTime_GetTime(XTime *Xtime_Global)
 	*Xtime_Global = mfcp(CNTPCT_EL0);
 }
 
+/****************************************************************************/
+/**
+ * Get the frequency of the counter read by XTime_GetTime().
+ *
+ * @return	Counter frequency in Hz.
+ *
+ ****************************************************************************/
+u32 XTime_GetTimeFreq(void)
+{
+#ifndef SDT
+#if defined(VERSAL_NET)
+	return XPAR_CPU_CORTEXA78_0_TIMESTAMP_CLK_FREQ;
+#elif defined (versal)
+	return XPAR_CPU_CORTEXA72_0_TIMESTAMP_CLK_FREQ;
+#else
+	return XPAR_CPU_CORTEXA53_0_TIMESTAMP_CLK_FREQ;
+#endif
+#else
+	return XGet_TimeStampFreq();
+#endif
+}
+
 #endif /* XTIMER_IS_DEFAULT_TIMER */
 
 #ifdef XTIMER_NO_TICK_TIMER
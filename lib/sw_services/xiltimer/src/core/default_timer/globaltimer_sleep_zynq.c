@@ -21,6 +21,7 @@
  * ----- ---- -------- -------------------------------------------------------
  * 1.0  adk	 24/11/21 Initial release.
  * 1.1	adk      08/08/22 Added doxygen tags.
+ * 1.3	fl       14/10/26 Added XTime_GetTimeFreq().
  *</pre>
  *
  *@note
@@ -153,6 +154,23 @@ void XTime_GetTime(XTime *Xtime_Global)
 	*Xtime_Global = (((XTime) high) << 32U) | (XTime) low;
 }
 
+/****************************************************************************/
+/**
+ * Get the frequency of the counter read by XTime_GetTime().
+ *
+ * @return	Counter frequency in Hz.
+ *
+ ****************************************************************************/
+u32 XTime_GetTimeFreq(void)
+{
+	/* Global Timer is always clocked at half of the CPU frequency */
+#ifndef SDT
+	return XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ / 2U;
+#else
+	return XGet_CpuFreq() / 2U;
+#endif
+}
+
 #endif /* XTIMER_IS_DEFAULT_TIMER */
 
 #ifdef XTIMER_NO_TICK_TIMER
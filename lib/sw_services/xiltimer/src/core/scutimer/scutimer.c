@@ -27,6 +27,7 @@
  *                      a decrementing counter.
  *                      Update XTimer_ScutimerTickInterval to add support for SDT
  *                      flow.
+ *  1.3  fl    14/10/26 Added XTime_GetTimeFreq().
  *</pre>
  *
  *@note
@@ -362,4 +363,20 @@ void XTime_GetTime(XTime *Xtime_Global)
 
 	*Xtime_Global = XScuTimer_GetCounterValue(ScuTimerInstPtr);
 }
+
+/****************************************************************************/
+/**
+ * Get the frequency of the counter read by XTime_GetTime().
+ *
+ * @return	Counter frequency in Hz.
+ *
+ ****************************************************************************/
+u32 XTime_GetTimeFreq(void)
+{
+#ifdef SDT
+	return XSLEEPTIMER_FREQ;
+#else
+	return XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ / 2U;
+#endif
+}
 #endif
@@ -25,6 +25,8 @@
  * 1.3   gm    21/07/23 Added Timer Release Callback function support.
  * 1.3   asa   08/09/23 Added macros to ensure that for Zynq/CortexA9
  *                      16 bit TTC counters are used.
+ * 1.3   fl    14/10/26 Added XTime_GetTimeFreq().
+ * 1.3   fl    14/10/26 Reset the counter when the tick interval changes.
  *
  *</pre>
  *
@@ -196,6 +198,8 @@ static void XTimer_TtcTickInterval(XTimer *InstancePtr, u32 Delay)
 	XTtcPs_SetInterval(TtcPsInstPtr, Interval);
 	XTtcPs_SetPrescaler(TtcPsInstPtr, Prescaler);
 	XTtcPs_EnableInterrupts(TtcPsInstPtr, XTTCPS_IXR_INTERVAL_MASK);
+	/* Count the new interval from now, the counter may be past it */
+	XTtcPs_ResetCounterValue(TtcPsInstPtr);
 	XTtcPs_Start(TtcPsInstPtr);
 }
 
@@ -370,5 +374,23 @@ void XTime_GetTime(XTime *Xtime_Global)
 	}
 
 	*Xtime_Global = XTtcPs_GetCounterValue(TtcPsInstPtr);
-}/*@}*/
+}
+
+/****************************************************************************/
+/**
+ * Get the frequency of the counter read by XTime_GetTime().
+ *
+ * @return	Counter frequency in Hz.
+ *
+ ****************************************************************************/
+u32 XTime_GetTimeFreq(void)
+{
+	XTime Time;
+
+	/* Makes sure the sleep timer instance is initialized */
+	XTime_GetTime(&Time);
+
+	return TimerInst.TtcPs_SleepInst.Config.InputClockHz;
+}
+/*@}*/
 #endif
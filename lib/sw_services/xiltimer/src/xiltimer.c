@@ -26,6 +26,7 @@
 *  	adk      08/08/22 Added doxygen tags.
 *  1.2  adk	 22/12/22 Fixed doxygen style and indentation issues.
 *  1.3  gm	 21/07/23 Added Timer Release Callback function.
+*  	fl	 14/10/26 Added 64-bit timestamp and profiling probe APIs.
 *
 * </pre>
 ******************************************************************************/
@@ -36,8 +37,39 @@
 #include "xiltimer.h"
 
 /****************************  Constant Definitions  *************************/
+/*
+ * Width and direction of the counter read by XTime_GetTime(), used to extend
+ * it to a monotonic 64-bit timestamp.
+ */
+#if defined (XSLEEPTIMER_IS_SCUTIMER)
+#define XTIMER_TS_BITS		32U
+#define XTIMER_TS_DOWN_COUNT
+#elif defined (XSLEEPTIMER_IS_AXITIMER)
+#define XTIMER_TS_BITS		32U
+#elif defined (XSLEEPTIMER_IS_TTCPS)
+#if defined (ARMR5) || (__aarch64__) || (ARMA53_32)
+#define XTIMER_TS_BITS		32U
+#else
+#define XTIMER_TS_BITS		16U
+#endif
+#elif defined (__MICROBLAZE__)
+/* The MicroBlaze default timer is a delay loop and has no counter */
+#define XTIMER_TS_NO_COUNTER
+#elif defined (ARMR5) && !defined (ARMR52)
+#define XTIMER_TS_BITS		32U
+#else
+#define XTIMER_TS_BITS		64U
+#endif
+
 XTimer TimerInst;
 void XilTimer_Sleep(unsigned long delay, XTimer_DelayType DelayType);
+#if !defined (XTIMER_TS_NO_COUNTER) && (XTIMER_TS_BITS < 64U)
+static XTime XTimer_TsLast;	/**< Last counter value read */
+static XTime XTimer_TsHigh;	/**< Counts added for the counter wraps */
+#endif
+#ifdef XTIMER_PROFILING
+static XTimer_Probe XTimer_Probes[XTIMER_PROF_NUM_PROBES];
+#endif
 
 /*****************************************************************************/
 /**
@@ -211,4 +243,199 @@ void XTimer_ClearTickInterrupt( void )
 	InstancePtr = &TimerInst;
 	if (InstancePtr->XTickTimer_ClearInterrupt)
 		InstancePtr->XTickTimer_ClearInterrupt(InstancePtr);
-}/*@}*/
+}
+
+/****************************************************************************/
+/**
+*
+* This API returns a monotonic 64-bit timestamp from the sleep timer counter.
+* Counters narrower than 64 bits are extended in software, so this API must
+* be called at least once per counter wrap period.
+*
+* @return           Timestamp in counts of XTimer_GetTimestampFreq(), 0 if
+*                   the sleep timer has no counter
+*
+* @note             The counter extension is not protected against being
+*                   called from interrupt handlers and the main loop at the
+*                   same time. With the scutimer as sleep timer, sleep
+*                   reloads the counter and the timestamp only stays valid
+*                   when no sleep is done between two timestamps.
+*
+*****************************************************************************/
+XTime XTimer_GetTimestamp(void)
+{
+#if defined (XTIMER_TS_NO_COUNTER)
+	return 0U;
+#else
+	XTime Count;
+
+	XTime_GetTime(&Count);
+#if (XTIMER_TS_BITS < 64U)
+	Count &= ((XTime)1U << XTIMER_TS_BITS) - 1U;
+#ifdef XTIMER_TS_DOWN_COUNT
+	Count = (((XTime)1U << XTIMER_TS_BITS) - 1U) - Count;
+#endif
+	if (Count < XTimer_TsLast) {
+		XTimer_TsHigh += (XTime)1U << XTIMER_TS_BITS;
+	}
+	XTimer_TsLast = Count;
+	Count |= XTimer_TsHigh;
+#endif
+
+	return Count;
+#endif
+}
+
+/****************************************************************************/
+/**
+*
+* This API returns the resolution of XTimer_GetTimestamp().
+*
+* @return           Timestamp frequency in Hz, 0 if the sleep timer has no
+*                   counter
+*
+*****************************************************************************/
+u32 XTimer_GetTimestampFreq(void)
+{
+#if defined (XTIMER_TS_NO_COUNTER)
+	return 0U;
+#else
+	return XTime_GetTimeFreq();
+#endif
+}
+
+#ifdef XTIMER_PROFILING
+/****************************************************************************/
+/**
+*
+* This API marks the start of a profiled section.
+*
+* @param            ProbeId Probe index, less than XTIMER_PROF_NUM_PROBES
+*
+* @return           none
+*
+*****************************************************************************/
+void XTimer_ProfStart(u32 ProbeId)
+{
+	if (ProbeId < XTIMER_PROF_NUM_PROBES) {
+		XTimer_Probes[ProbeId].Start = XTimer_GetTimestamp();
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This API marks the end of a profiled section and adds its duration to the
+* probe statistics.
+*
+* @param            ProbeId Probe index, less than XTIMER_PROF_NUM_PROBES
+*
+* @return           none
+*
+*****************************************************************************/
+void XTimer_ProfStop(u32 ProbeId)
+{
+	XTime Now = XTimer_GetTimestamp();
+	XTimer_Probe *Probe;
+	XTime Delta;
+	u32 Bin = 0U;
+
+	if (ProbeId >= XTIMER_PROF_NUM_PROBES) {
+		return;
+	}
+
+	Probe = &XTimer_Probes[ProbeId];
+	Delta = Now - Probe->Start;
+	if ((Probe->Count == 0U) || (Delta < Probe->Min)) {
+		Probe->Min = Delta;
+	}
+	if (Delta > Probe->Max) {
+		Probe->Max = Delta;
+	}
+	Probe->Total += Delta;
+	Probe->Count++;
+
+	while ((Delta != 0U) && (Bin < (XTIMER_PROF_HIST_BINS - 1U))) {
+		Delta >>= 1U;
+		Bin++;
+	}
+	Probe->Hist[Bin]++;
+}
+
+/****************************************************************************/
+/**
+*
+* This API returns the statistics of a probe.
+*
+* @param            ProbeId Probe index, less than XTIMER_PROF_NUM_PROBES
+*
+* @return           Pointer to the probe statistics, NULL for an invalid
+*                   probe
+*
+*****************************************************************************/
+const XTimer_Probe *XTimer_ProfGet(u32 ProbeId)
+{
+	if (ProbeId >= XTIMER_PROF_NUM_PROBES) {
+		return NULL;
+	}
+
+	return &XTimer_Probes[ProbeId];
+}
+
+/****************************************************************************/
+/**
+*
+* This API clears the statistics of a probe.
+*
+* @param            ProbeId Probe index, less than XTIMER_PROF_NUM_PROBES
+*
+* @return           none
+*
+*****************************************************************************/
+void XTimer_ProfReset(u32 ProbeId)
+{
+	u8 *Ptr;
+	u32 Index;
+
+	if (ProbeId >= XTIMER_PROF_NUM_PROBES) {
+		return;
+	}
+
+	Ptr = (u8 *)&XTimer_Probes[ProbeId];
+	for (Index = 0U; Index < sizeof(XTimer_Probe); Index++) {
+		Ptr[Index] = 0U;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This API prints the statistics of a probe, with durations in timestamp
+* counts, followed by the non empty histogram bins.
+*
+* @param            ProbeId Probe index, less than XTIMER_PROF_NUM_PROBES
+*
+* @return           none
+*
+*****************************************************************************/
+void XTimer_ProfPrint(u32 ProbeId)
+{
+	const XTimer_Probe *Probe = XTimer_ProfGet(ProbeId);
+	u32 Bin;
+
+	if ((Probe == NULL) || (Probe->Count == 0U)) {
+		return;
+	}
+
+	xil_printf("Probe %d: count %d min %d max %d avg %d (%d Hz)\r\n",
+		   ProbeId, Probe->Count, (u32)Probe->Min, (u32)Probe->Max,
+		   (u32)(Probe->Total / Probe->Count),
+		   XTimer_GetTimestampFreq());
+	for (Bin = 0U; Bin < XTIMER_PROF_HIST_BINS; Bin++) {
+		if (Probe->Hist[Bin] != 0U) {
+			xil_printf("  < 2^%d: %d\r\n", Bin, Probe->Hist[Bin]);
+		}
+	}
+}
+#endif
+/*@}*/
@@ -25,6 +25,10 @@ else()
     SET_PROPERTY(CACHE XILTIMER_tick_timer PROPERTY STRINGS "None")
 endif()
 option(XILTIMER_en_interval_timer "Enable Interval Timer" OFF)
+option(XILTIMER_en_profiling "Enable timestamp based profiling probes" OFF)
+if (${XILTIMER_en_profiling})
+    set(XTIMER_PROFILING " ")
+endif()
 
 
 if ("${XILTIMER_sleep_timer}" STREQUAL "${XILTIMER_tick_timer}")
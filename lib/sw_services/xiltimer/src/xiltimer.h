@@ -25,6 +25,8 @@
 *  	adk      08/08/22 Added doxygen tags.
 *  1.2  adk	 22/12/22 Fixed doxygen style and indentation issues.
 *  1.3  gm      21/07/23 Added Timer Release Callback function.
+*  	fl      14/10/26 Added 64-bit timestamp and profiling probe APIs.
+*  	fl      14/10/26 Added software timers multiplexed on the tick timer.
 *
 * </pre>
 ******************************************************************************/
@@ -125,6 +127,48 @@ typedef struct XTimerTag {
 
 typedef u64 XTime;
 extern XTimer TimerInst;
+
+#ifdef XTIMER_PROFILING
+#ifndef XTIMER_PROF_NUM_PROBES
+#define XTIMER_PROF_NUM_PROBES	8U	/**< Number of profiling probes */
+#endif
+#define XTIMER_PROF_HIST_BINS	32U	/**< Histogram bins, one per power of 2 */
+
+/**
+ * Statistics of a profiling probe. Durations are in timestamp counts, see
+ * XTimer_GetTimestampFreq(). Histogram bin N counts the durations of N
+ * significant bits, that is [2^(N-1), 2^N) counts, the last bin also holds
+ * all the longer durations.
+ */
+typedef struct {
+	XTime Start;		/**< Timestamp of the last XTimer_ProfStart() */
+	XTime Min;		/**< Shortest duration */
+	XTime Max;		/**< Longest duration */
+	XTime Total;		/**< Sum of all durations */
+	u32 Count;		/**< Number of start/stop pairs */
+	u32 Hist[XTIMER_PROF_HIST_BINS];	/**< Duration histogram */
+} XTimer_Probe;
+#endif
+
+#ifndef XTIMER_WHEEL_SLOTS
+#define XTIMER_WHEEL_SLOTS	256U	/**< Timer wheel slots, power of 2 */
+#endif
+
+typedef void (*XTimer_SwHandler) (void *CallBackRef);
+
+/**
+ * Software timer. The structure is owned by the caller, must be zeroed
+ * before it is first started and must stay valid while the timer is running.
+ */
+typedef struct XTimer_SwTimerTag {
+	struct XTimer_SwTimerTag *Next;	/**< Next timer in the wheel slot */
+	struct XTimer_SwTimerTag *Prev;	/**< Previous timer in the wheel slot */
+	u64 Expiry;			/**< Expiry time in milliseconds */
+	u32 Period;			/**< Period in milliseconds, 0 for one-shot */
+	XTimer_SwHandler Handler;	/**< Expiry callback */
+	void *CallBackRef;		/**< Callback reference for handler */
+	u8 IsActive;			/**< Set while the timer is running */
+} XTimer_SwTimer;
 /************************** Function Prototypes ******************************/
 /**
  * This API is used for initializing sleep timer
@@ -138,6 +182,23 @@ u32 XilTickTimer_Init(XTimer *InstancePtr);
  * Get the time
  */
 void XTime_GetTime(XTime *Xtime_Global);
+/**
+ * Get the frequency of the counter read by XTime_GetTime
+ */
+u32 XTime_GetTimeFreq(void);
+XTime XTimer_GetTimestamp(void);
+u32 XTimer_GetTimestampFreq(void);
+u32 XTimer_SwTimerInit(u8 Priority);
+void XTimer_SwTimerStart(XTimer_SwTimer *Timer, u32 DelayMs, u32 PeriodMs,
+			 XTimer_SwHandler Handler, void *CallBackRef);
+void XTimer_SwTimerStop(XTimer_SwTimer *Timer);
+#ifdef XTIMER_PROFILING
+void XTimer_ProfStart(u32 ProbeId);
+void XTimer_ProfStop(u32 ProbeId);
+const XTimer_Probe *XTimer_ProfGet(u32 ProbeId);
+void XTimer_ProfReset(u32 ProbeId);
+void XTimer_ProfPrint(u32 ProbeId);
+#endif
 void XTimer_SetInterval(unsigned long delay);
 void XTimer_SetHandler(XTimer_TickHandler FuncPtr, void *CallBackRef,
 		       u8 Priority);
@@ -0,0 +1,378 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xtimer_wheel.c
+* @addtogroup xiltimer_api XilTimer APIs
+*
+* This file contains the software timers. Any number of one-shot and
+* periodic timers share the tick timer through a hashed timer wheel: a timer
+* is linked in the slot of its expiry millisecond, so start and stop are
+* O(1). The tick timer is programmed for the nearest expiry only and is
+* stopped when no timer is running.
+* @{
+* @details
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+*  1.3  fl	 14/10/26 Initial release.
+*
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xiltimer.h"
+#include "xil_exception.h"
+
+/****************************  Constant Definitions  *************************/
+#define XTIMER_WHEEL_MASK	((u64)XTIMER_WHEEL_SLOTS - 1U)
+/*
+ * Longest interval programmed in the tick timer. The tick backends convert
+ * the interval to an integral rate per second.
+ */
+#define XTIMER_WHEEL_MAX_INTERVAL	1000U
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	XTimer_SwTimer *Slots[XTIMER_WHEEL_SLOTS]; /**< Timers per slot */
+	u64 Now;		/**< Time of the last wheel update in ms */
+	u32 CountsPerMs;	/**< Timestamp counts per millisecond */
+	u32 NumActive;		/**< Number of running timers */
+	u32 Interval;		/**< Programmed interval, 0 if stopped */
+	u8 InHandler;		/**< Set while the expiry callbacks run */
+} XTimer_Wheel;
+
+/************************** Function Prototypes ******************************/
+static void XTimer_WheelTickHandler(void *CallBackRef, u32 StatusEvent);
+
+/************************** Variable Definitions *****************************/
+static XTimer_Wheel Wheel;
+
+/****************************************************************************/
+/**
+*
+* This function returns the current time in milliseconds.
+*
+* @return           Time in milliseconds
+*
+*****************************************************************************/
+static u64 XTimer_WheelTime(void)
+{
+	return XTimer_GetTimestamp() / Wheel.CountsPerMs;
+}
+
+/****************************************************************************/
+/**
+*
+* This function links a timer in the slot of its expiry time.
+*
+* @param            Timer Pointer to the software timer
+*
+* @return           none
+*
+*****************************************************************************/
+static void XTimer_WheelLink(XTimer_SwTimer *Timer)
+{
+	XTimer_SwTimer **Slot = &Wheel.Slots[Timer->Expiry & XTIMER_WHEEL_MASK];
+
+	Timer->Prev = NULL;
+	Timer->Next = *Slot;
+	if (*Slot != NULL) {
+		(*Slot)->Prev = Timer;
+	}
+	*Slot = Timer;
+}
+
+/****************************************************************************/
+/**
+*
+* This function unlinks a timer from its wheel slot.
+*
+* @param            Timer Pointer to the software timer
+*
+* @return           none
+*
+*****************************************************************************/
+static void XTimer_WheelUnlink(XTimer_SwTimer *Timer)
+{
+	if (Timer->Prev != NULL) {
+		Timer->Prev->Next = Timer->Next;
+	} else {
+		Wheel.Slots[Timer->Expiry & XTIMER_WHEEL_MASK] = Timer->Next;
+	}
+	if (Timer->Next != NULL) {
+		Timer->Next->Prev = Timer->Prev;
+	}
+	Timer->Next = NULL;
+	Timer->Prev = NULL;
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the milliseconds until the nearest expiry. Slots are
+* scanned for at most one wheel revolution, timers further away are handled
+* by waking up once per revolution.
+*
+* @return           Milliseconds until the nearest expiry
+*
+*****************************************************************************/
+static u32 XTimer_WheelNextExpiry(void)
+{
+	XTimer_SwTimer *Timer;
+	u64 Tick;
+
+	for (Tick = Wheel.Now + 1U; Tick <= (Wheel.Now + XTIMER_WHEEL_SLOTS);
+	     Tick++) {
+		for (Timer = Wheel.Slots[Tick & XTIMER_WHEEL_MASK];
+		     Timer != NULL; Timer = Timer->Next) {
+			if (Timer->Expiry <= Tick) {
+				return (u32)(Tick - Wheel.Now);
+			}
+		}
+	}
+
+	return XTIMER_WHEEL_SLOTS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function programs the tick timer for the nearest expiry, or stops it
+* when no timer is running.
+*
+* @return           none
+*
+*****************************************************************************/
+static void XTimer_WheelProgram(void)
+{
+	u32 Interval;
+
+	if (Wheel.NumActive == 0U) {
+		if ((Wheel.Interval != 0U) &&
+		    (TimerInst.XTickTimer_Stop != NULL)) {
+			TimerInst.XTickTimer_Stop(&TimerInst);
+		}
+		Wheel.Interval = 0U;
+		return;
+	}
+
+	Interval = XTimer_WheelNextExpiry();
+	if (Interval > XTIMER_WHEEL_MAX_INTERVAL) {
+		Interval = XTIMER_WHEEL_MAX_INTERVAL;
+	}
+	/*
+	 * Round down to an interval whose rate per second is integral, so the
+	 * tick never comes later than the expiry. An early tick reprograms the
+	 * timer for the remaining time.
+	 */
+	Interval = XTIMER_DELAY_MSEC / ((XTIMER_DELAY_MSEC + Interval - 1U) /
+					Interval);
+	if (Interval != Wheel.Interval) {
+		XTimer_SetInterval(Interval);
+		Wheel.Interval = Interval;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function runs the callbacks of the expired timers and restarts the
+* periodic ones.
+*
+* @return           none
+*
+*****************************************************************************/
+static void XTimer_WheelExpire(void)
+{
+	XTimer_SwTimer *Timer;
+	XTimer_SwTimer *Next;
+	u64 Last = Wheel.Now;
+	u64 Tick;
+
+	Wheel.Now = XTimer_WheelTime();
+	/* After a long gap every slot is visited once */
+	if ((Wheel.Now - Last) >= XTIMER_WHEEL_SLOTS) {
+		Last = Wheel.Now - XTIMER_WHEEL_SLOTS;
+	}
+
+	Wheel.InHandler = (u8)TRUE;
+	for (Tick = Last + 1U; Tick <= Wheel.Now; Tick++) {
+		Timer = Wheel.Slots[Tick & XTIMER_WHEEL_MASK];
+		while (Timer != NULL) {
+			Next = Timer->Next;
+			if (Timer->Expiry <= Wheel.Now) {
+				XTimer_WheelUnlink(Timer);
+				if (Timer->Period != 0U) {
+					Timer->Expiry += Timer->Period;
+					if (Timer->Expiry <= Wheel.Now) {
+						Timer->Expiry = Wheel.Now +
+							Timer->Period;
+					}
+					XTimer_WheelLink(Timer);
+				} else {
+					Timer->IsActive = (u8)FALSE;
+					Wheel.NumActive--;
+				}
+				/* The callback may stop or start any timer */
+				Timer->Handler(Timer->CallBackRef);
+				/* Next may have been stopped, restart the slot */
+				Next = Wheel.Slots[Tick & XTIMER_WHEEL_MASK];
+				while ((Next != NULL) &&
+				       (Next->Expiry > Wheel.Now)) {
+					Next = Next->Next;
+				}
+			}
+			Timer = Next;
+		}
+	}
+	Wheel.InHandler = (u8)FALSE;
+}
+
+/****************************************************************************/
+/**
+*
+* This function is the tick timer handler of the software timers.
+*
+* @param            CallBackRef Unused
+* @param            StatusEvent Unused
+*
+* @return           none
+*
+*****************************************************************************/
+static void XTimer_WheelTickHandler(void *CallBackRef, u32 StatusEvent)
+{
+	(void)CallBackRef;
+	(void)StatusEvent;
+
+	XTimer_ClearTickInterrupt();
+	XTimer_WheelExpire();
+	XTimer_WheelProgram();
+}
+
+/****************************************************************************/
+/**
+*
+* This API initializes the software timers and installs their handler on the
+* tick timer. The tick timer must not be used for anything else afterwards.
+*
+* @param            Priority Priority of the tick timer interrupt
+*
+* @return           XST_SUCCESS on success,
+*                   XST_FAILURE if there is no tick timer or the sleep timer
+*                   provides no millisecond timestamp
+*
+*****************************************************************************/
+u32 XTimer_SwTimerInit(u8 Priority)
+{
+	u32 Index;
+
+	Wheel.CountsPerMs = XTimer_GetTimestampFreq() / XTIMER_DELAY_MSEC;
+	if ((TimerInst.XTimer_TickInterval == NULL) ||
+	    (Wheel.CountsPerMs == 0U)) {
+		return XST_FAILURE;
+	}
+
+	for (Index = 0U; Index < XTIMER_WHEEL_SLOTS; Index++) {
+		Wheel.Slots[Index] = NULL;
+	}
+	Wheel.NumActive = 0U;
+	Wheel.Interval = 0U;
+	Wheel.InHandler = (u8)FALSE;
+	Wheel.Now = XTimer_WheelTime();
+	XTimer_SetHandler(XTimer_WheelTickHandler, NULL, Priority);
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This API starts a software timer, or restarts it if it is running.
+*
+* @param            Timer Pointer to the software timer
+* @param            DelayMs Time to the first expiry in milliseconds
+* @param            PeriodMs Period in milliseconds, 0 for a one-shot timer
+* @param            Handler Callback called on expiry, from the tick timer
+*                   interrupt
+* @param            CallBackRef Reference passed to the callback
+*
+* @return           none
+*
+* @note             Can be called from the expiry callbacks. From other
+*                   contexts, interrupts are disabled while the wheel is
+*                   updated.
+*
+*****************************************************************************/
+void XTimer_SwTimerStart(XTimer_SwTimer *Timer, u32 DelayMs, u32 PeriodMs,
+			 XTimer_SwHandler Handler, void *CallBackRef)
+{
+	u8 InHandler = Wheel.InHandler;
+
+	if (InHandler == (u8)FALSE) {
+		Xil_ExceptionDisable();
+	}
+
+	if (Timer->IsActive == (u8)TRUE) {
+		XTimer_WheelUnlink(Timer);
+	} else {
+		Wheel.NumActive++;
+	}
+	if (InHandler == (u8)FALSE) {
+		Wheel.Now = XTimer_WheelTime();
+	}
+	Timer->Expiry = Wheel.Now + ((DelayMs != 0U) ? DelayMs : 1U);
+	Timer->Period = PeriodMs;
+	Timer->Handler = Handler;
+	Timer->CallBackRef = CallBackRef;
+	Timer->IsActive = (u8)TRUE;
+	XTimer_WheelLink(Timer);
+
+	if (InHandler == (u8)FALSE) {
+		/* Forces reprogramming, the running interval started earlier */
+		Wheel.Interval = (Wheel.Interval != 0U) ? 0xFFFFFFFFU : 0U;
+		XTimer_WheelProgram();
+		Xil_ExceptionEnable();
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This API stops a software timer. Stopping a timer which is not running
+* has no effect.
+*
+* @param            Timer Pointer to the software timer
+*
+* @return           none
+*
+* @note             The tick timer is not reprogrammed, a tick programmed
+*                   for this timer only reprograms it for the next expiry.
+*
+*****************************************************************************/
+void XTimer_SwTimerStop(XTimer_SwTimer *Timer)
+{
+	u8 InHandler = Wheel.InHandler;
+
+	if (InHandler == (u8)FALSE) {
+		Xil_ExceptionDisable();
+	}
+
+	if (Timer->IsActive == (u8)TRUE) {
+		XTimer_WheelUnlink(Timer);
+		Timer->IsActive = (u8)FALSE;
+		Wheel.NumActive--;
+	}
+
+	if (InHandler == (u8)FALSE) {
+		Xil_ExceptionEnable();
+	}
+}
+/*@}*/
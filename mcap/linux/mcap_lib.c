@@ -30,6 +30,11 @@
 *
 ******************************************************************************/
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #include "mcap_lib.h"
 
 /* Library Specific Definitions */
@@ -47,6 +52,9 @@
 #define MCAP_BIT_FILE	".bit"
 #define MCAP_BIN_FILE	".bin"
 
+/* Words written between two progress callbacks */
+#define MCAP_PROGRESS_WORDS	(64 * 1024)
+
 static char *MCapFindTypeofFile(const char *s1, const char *s2)
 {
 	size_t l1, l2;
@@ -93,64 +101,23 @@ static u32 MCapProcessRBT(FILE *fptr, u32 *buf)
 	return len;
 }
 
-static u32 MCapProcessBIT(FILE *fptr, u32 *buf, int sz)
+static long MCapFindSyncWord(const u8 *map, size_t sz)
 {
-	int err;
-	u8 value, len = 0;
+	size_t i;
 
 	/*
 	 * .bit files are not guaranteed to be aligned with
 	 * the bitstream sync word on a 32-bit boundary. So,
 	 * we need to check every byte here.
 	 */
-	while ((err = fread(&value, 1, 1, fptr)) == 1) {
-		len++; if (value == MCAP_SYNC_BYTE0)
-		  if ((err = fread(&value, 1, 1, fptr)) == 1) {
-		    len++; if (value == MCAP_SYNC_BYTE1)
-		      if ((err = fread(&value, 1, 1, fptr)) == 1) {
-			len++; if (value == MCAP_SYNC_BYTE2)
-			  if ((err = fread(&value, 1, 1, fptr)) == 1) {
-				len++; if (value == MCAP_SYNC_BYTE3)
-					break;
-			  }
-		      }
-		}
-	}
-
-	if (err != 1 && !feof(fptr)) {
-		pr_err("Failed to Read BIT file\n");
-		return 0;
-	}
-
-	if (err != 1 && feof(fptr)) {
-		pr_err("Failed to find SYNC Word in BIT file\n");
-		return 0;
-	}
-
-	*buf++ = __bswap_32(MCAP_SYNC_DWORD);
-
-	while ((err = fread(buf, sz - len, 1, fptr)) == 1)
-		;
-
-	if (err != 1 && !feof(fptr)) {
-		pr_err("Failed to Read BIT file\n");
-		return 0;
-	}
-
-	return (sz - len)/4 + 1;
-}
-
-static u32 MCapProcessBIN(FILE *fptr, u32 *buf, int sz)
-{
-	int err;
-
-	err = fread(buf, sz, 1, fptr);
-	if (err != 1 && !feof(fptr)) {
-		pr_err("Failed to Read BIN file\n");
-		return 0;
+	for (i = 0; i + 4 <= sz; i++) {
+		if (map[i] == MCAP_SYNC_BYTE0 && map[i + 1] == MCAP_SYNC_BYTE1 &&
+		    map[i + 2] == MCAP_SYNC_BYTE2 &&
+		    map[i + 3] == MCAP_SYNC_BYTE3)
+			return i;
 	}
 
-	return sz/4;
+	return -1;
 }
 
 static int MCapDoBusWalk(struct mcap_dev *mdev)
@@ -220,11 +187,47 @@ static int Checkforcompletion(struct mcap_dev *mdev)
 	return 0;
 }
 
-static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
-					int len, u8 bswap)
+static void MCapWriteData(struct mcap_dev *mdev, const void *data,
+			  int len, u8 bswap, MCapProgressFn progress,
+			  void *ref)
+{
+	const u8 *src = data;
+	u32 val;
+	int count, end;
+
+	/*
+	 * The data register takes one DWORD per configuration write, so
+	 * the stream goes out word by word. The source may be a file
+	 * mapping with the sync word at any byte offset.
+	 */
+	for (count = 0; count < len; count = end) {
+		end = count + MCAP_PROGRESS_WORDS;
+		if (end > len)
+			end = len;
+
+		if (!bswap) {
+			for (; count < end; count++) {
+				memcpy(&val, src + count * 4, 4);
+				MCapRegWrite(mdev, MCAP_DATA, val);
+			}
+		} else {
+			for (; count < end; count++) {
+				memcpy(&val, src + count * 4, 4);
+				MCapRegWrite(mdev, MCAP_DATA, __bswap_32(val));
+			}
+		}
+
+		if (progress)
+			progress(ref, (size_t)end * 4, (size_t)len * 4);
+	}
+}
+
+static int MCapWritePartialBitStream(struct mcap_dev *mdev, const void *data,
+					int len, u8 bswap,
+					MCapProgressFn progress, void *ref)
 {
 	u32 set, restore;
-	int err, count = 0, i;
+	int err, i;
 
 	if (!data || !len) {
 		pr_err("Invalid Arguments\n");
@@ -254,13 +257,7 @@ static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
 	MCapRegWrite(mdev, MCAP_CONTROL, set);
 
 	/* Write Data */
-	if (!bswap) {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, data[count]);
-	} else {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, __bswap_32(data[count]));
-	}
+	MCapWriteData(mdev, data, len, bswap, progress, ref);
 
 	for (i = 0 ; i < EMCAP_EOS_LOOP_COUNT; i++) {
 		MCapRegWrite(mdev, MCAP_DATA, EMCAP_NOOP_VAL);
@@ -283,11 +280,12 @@ static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
 	return 0;
 }
 
-static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
-			      int len, u8 bswap)
+static int MCapWriteBitStream(struct mcap_dev *mdev, const void *data,
+			      int len, u8 bswap, MCapProgressFn progress,
+			      void *ref)
 {
 	u32 set, restore;
-	int err, count = 0;
+	int err;
 
 	if (!data || !len) {
 		pr_err("Invalid Arguments\n");
@@ -319,13 +317,7 @@ static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
 	}
 
 	/* Write Data */
-	if (!bswap) {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, data[count]);
-	} else {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, __bswap_32(data[count]));
-	}
+	MCapWriteData(mdev, data, len, bswap, progress, ref);
 
 	/* Check for Completion */
 	err = Checkforcompletion(mdev);
@@ -589,13 +581,38 @@ void MCapDumpRegs(struct mcap_dev *mdev)
 	MCapDumpReadRegs(mdev);
 }
 
-int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type)
+static int MCapProgramFPGA(struct mcap_dev *mdev, const void *data,
+			   u32 wrdatasz, u8 bswap, u32 bitfile_type,
+			   MCapProgressFn progress, void *ref)
+{
+	int err = 0;
+
+	/* Program FPGA */
+	if (bitfile_type == EMCAP_PARTIALCONFIG_FILE) {
+		err = MCapWritePartialBitStream(mdev, data, wrdatasz, bswap,
+						progress, ref);
+		if (err)
+			return -EMCAPCFG;
+		pr_info("FPGA Partial Configuration Done!!\n");
+	} else if (bitfile_type == EMCAP_CONFIG_FILE) {
+		err = MCapWriteBitStream(mdev, data, wrdatasz, bswap,
+					 progress, ref);
+		if (err)
+			return -EMCAPCFG;
+		pr_info("FPGA Configuration Done!!\n");
+	}
+
+	return err;
+}
+
+static int MCapConfigureRBT(struct mcap_dev *mdev, char *file_path,
+			    u32 bitfile_type, MCapProgressFn progress,
+			    void *ref)
 {
 	FILE *fptr;
 	u32 *data;
 	u32 binsz, wrdatasz;
-	int err = 0;
-	u8 bswap = 0;
+	int err;
 
 	/* Get the size */
 	fptr = fopen(file_path, "rb");
@@ -607,56 +624,88 @@ int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type)
 
 	/* Allocate the buffer */
 	data = malloc(binsz);
-	if (data == NULL)
+	if (data == NULL) {
+		fclose(fptr);
 		return -EMCAPCFG;
+	}
 
-	/* Process files and Read the data */
-	if (MCapFindTypeofFile(file_path, MCAP_RBT_FILE)) {
+	/* Read the RBT file */
+	wrdatasz = MCapProcessRBT(fptr, data);
 
-		/* Read the RBT file */
-		wrdatasz = MCapProcessRBT(fptr, data);
+	err = MCapProgramFPGA(mdev, data, wrdatasz, 0, bitfile_type,
+			      progress, ref);
 
-	} else if (MCapFindTypeofFile(file_path, MCAP_BIT_FILE)) {
+	free(data);
+	fclose(fptr);
 
-		/* Read the BIT file */
-		wrdatasz = MCapProcessBIT(fptr, data, binsz);
-		bswap = 1;
+	return err;
+}
 
-	} else if (MCapFindTypeofFile(file_path, MCAP_BIN_FILE)) {
+int MCapConfigureFPGAProgress(struct mcap_dev *mdev, char *file_path,
+			      u32 bitfile_type, MCapProgressFn progress,
+			      void *ref)
+{
+	struct stat st;
+	u8 *map;
+	long start = 0;
+	int fd, err;
 
-		/* Read the BIN file */
-		wrdatasz = MCapProcessBIN(fptr, data, binsz);
-		bswap = 1;
+	if (MCapFindTypeofFile(file_path, MCAP_RBT_FILE))
+		return MCapConfigureRBT(mdev, file_path, bitfile_type,
+					progress, ref);
 
-	} else {
+	if (!MCapFindTypeofFile(file_path, MCAP_BIT_FILE) &&
+	    !MCapFindTypeofFile(file_path, MCAP_BIN_FILE)) {
 		pr_err("Unknown File Format.. This may be");
 		pr_err(" due to .bit/.bin/.rbt files does not exist at the.");
 		pr_err(" specified location, Please cross check the");
 		pr_err(" path is correct or not\n");
-		goto free_resources;
+		return 0;
 	}
 
-	/* Program FPGA */
-	if (bitfile_type == EMCAP_PARTIALCONFIG_FILE) {
-		err = MCapWritePartialBitStream(mdev, data, wrdatasz, bswap);
-		if (err)
-			return -EMCAPCFG;
-		pr_info("FPGA Partial Configuration Done!!\n");
-	} else if (bitfile_type == EMCAP_CONFIG_FILE) {
-		err = MCapWriteBitStream(mdev, data, wrdatasz, bswap);
-		if (err)
+	/*
+	 * Map the file instead of reading it into a buffer, the pages are
+	 * read ahead by the kernel while the data goes out to the MCAP.
+	 */
+	fd = open(file_path, O_RDONLY);
+	if (fd < 0)
+		return -EMCAPCFG;
+
+	if (fstat(fd, &st) || st.st_size < 4) {
+		close(fd);
+		return -EMCAPCFG;
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return -EMCAPCFG;
+
+	madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+	if (MCapFindTypeofFile(file_path, MCAP_BIT_FILE)) {
+		start = MCapFindSyncWord(map, st.st_size);
+		if (start < 0) {
+			pr_err("Failed to find SYNC Word in BIT file\n");
+			munmap(map, st.st_size);
 			return -EMCAPCFG;
-		pr_info("FPGA Configuration Done!!\n");
+		}
 	}
 
-free_resources:
-	if (data)
-		free(data);
-	fclose(fptr);
+	err = MCapProgramFPGA(mdev, map + start, (st.st_size - start) / 4, 1,
+			      bitfile_type, progress, ref);
+
+	munmap(map, st.st_size);
 
 	return err;
 }
 
+int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type)
+{
+	return MCapConfigureFPGAProgress(mdev, file_path, bitfile_type,
+					 NULL, NULL);
+}
+
 int MCapAccessConfigSpace(struct mcap_dev *mdev, int argc, char **argv)
 {
 	unsigned long wrval, rdval;
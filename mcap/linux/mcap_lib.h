@@ -146,6 +146,12 @@ struct mcap_dev {
 	((MCapRegRead(mdev, MCAP_STATUS) & \
 		MCAP_STS_REG_READ_COUNT_MASK) >> 5)
 
+/*
+ * Progress callback of a configuration, called with the number of bytes
+ * written to the MCAP so far and the total number of bytes
+ */
+typedef void (*MCapProgressFn)(void *ref, size_t done, size_t total);
+
 /* Function Prototypes */
 struct mcap_dev *MCapLibInit(int device_id);
 void MCapLibFree(struct mcap_dev *mdev);
@@ -156,5 +162,8 @@ int MCapModuleReset(struct mcap_dev *mdev);
 int MCapFullReset(struct mcap_dev *mdev);
 int MCapShowDevice(struct mcap_dev *mdev, int verbose);
 int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type);
+int MCapConfigureFPGAProgress(struct mcap_dev *mdev, char *file_path,
+			      u32 bitfile_type, MCapProgressFn progress,
+			      void *ref);
 int MCapReadRegisters(struct mcap_dev *mdev, u32 *data);
 int MCapAccessConfigSpace(struct mcap_dev *mdev, int argc, char **argv);
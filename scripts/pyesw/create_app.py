@@ -258,6 +258,7 @@ if __name__ == "__main__":
             - freertos_lwip_echo_server
             - freertos_lwip_tcp_perf_client
             - freertos_lwip_tcp_perf_server
+            - freertos_lwip_iperf3_server
             - freertos_lwip_udp_perf_client
             - freertos_lwip_udp_perf_server
             - lwip_tcp_perf_client
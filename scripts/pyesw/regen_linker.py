@@ -8,6 +8,7 @@ using the domain information provided to it.
 import utils
 import argparse
 import os
+import re
 from build_bsp import BSP
 from repo import Repo
 
@@ -22,6 +23,35 @@ class RegenLinker(BSP, Repo):
         Repo.__init__(self, repo_yaml_path=args['repo_info'])
         self.repo_paths_list = self.repo_schema['paths']
         self.app_src_dir = utils.get_abs_path(args["src_dir"])
+        self.hot_mem = args.get("hot_mem")
+        self.hot_symbols = args.get("hot_symbols")
+
+def read_hot_symbols(symbol_file):
+    """
+    Reads the hot symbols to be placed in the hot memory. Lines starting
+    with '#' are comments. A line with one column names a symbol; in a line
+    with more columns the last one is the symbol if the first one is a
+    number, so that gprof flat profiles and perf report text dumps can be
+    given as they are.
+
+    Args:
+        symbol_file (str): Path of the symbol list.
+    Returns:
+        list: Symbol names, in the order of the file, without duplicates.
+    """
+    symbols = []
+    with open(symbol_file, "r") as f:
+        for line in f:
+            cols = line.split()
+            if not cols or cols[0].startswith("#"):
+                continue
+            if len(cols) > 1:
+                if not re.match(r"^[0-9.]+%?$", cols[0]):
+                    continue
+            sym = cols[-1]
+            if re.match(r"^[A-Za-z_][A-Za-z0-9_.$]*$", sym) and sym not in symbols:
+                symbols.append(sym)
+    return symbols
 
 def regen_linker(args):
     """
@@ -57,12 +87,22 @@ def regen_linker(args):
     else:
         utils.runcmd(linker_cmd)
 
+    hot_cmds = ""
+    if obj.hot_mem:
+        hot_cmds = f"set(HOT_MEM {obj.hot_mem})"
+        if obj.hot_symbols:
+            symbols = read_hot_symbols(utils.get_abs_path(obj.hot_symbols))
+            hot_cmds += f"\nset(HOT_SYMBOLS {' '.join(symbols)})"
+    elif obj.hot_symbols:
+        print("Hot symbols are ignored without a hot memory (-m)")
+
     cmake_file = os.path.join(app_linker_build, "CMakeLists.txt")
     cmake_file_cmds = f"""
 cmake_minimum_required(VERSION 3.15)
 project(bsp)
 find_package(common)
 include({template.capitalize()}Example.cmake)
+{hot_cmds}
 linker_gen({linker_dir})
     """
     cmake_file_cmds = cmake_file_cmds.replace('\\', '/')
@@ -99,5 +139,19 @@ if __name__ == "__main__":
         help="Specify the .repo.yaml absolute path to use the set repo info",
         default='.repo.yaml',
     )
+    parser.add_argument(
+        "-m",
+        "--hot_mem",
+        action="store",
+        help="Memory region for the hot code and data, e.g. psu_r5_0_btcm_MEM_0",
+    )
+    parser.add_argument(
+        "-p",
+        "--hot_symbols",
+        action="store",
+        help="File with the hot functions and data, one symbol per line or a\n"
+             "gprof/perf report profile. Needs the app to be compiled with\n"
+             "-ffunction-sections -fdata-sections",
+    )
     args = vars(parser.parse_args())
     regen_linker(args)